@@ -0,0 +1,6644 @@
+code
+proc swapfunc 24 0
+ADDRFP4 12
+INDIRI4
+CNSTI4 1
+GTI4 $24
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+CNSTI4 2
+RSHU4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $26
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $27
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $26
+ADDRGP4 $25
+JUMPV
+LABELV $24
+ADDRLP4 8
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+CVUI4 4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+LABELV $29
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 20
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 12
+INDIRI1
+ASGNI1
+LABELV $30
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GTI4 $29
+LABELV $25
+LABELV $23
+endproc swapfunc 24 0
+proc med3 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $38
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $40
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $41
+JUMPV
+LABELV $40
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+GEI4 $42
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $43
+JUMPV
+LABELV $42
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $43
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $41
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $39
+JUMPV
+LABELV $38
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+LEI4 $44
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $45
+JUMPV
+LABELV $44
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+GEI4 $46
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $47
+JUMPV
+LABELV $46
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+ASGNP4
+LABELV $47
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $45
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+LABELV $39
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $32
+endproc med3 40 8
+export qsort
+proc qsort 124 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+LABELV $49
+ADDRLP4 52
+CNSTU4 3
+ASGNU4
+ADDRLP4 56
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CVUI4 4
+CVIU4 4
+ADDRLP4 52
+INDIRU4
+BANDU4
+ADDRLP4 56
+INDIRU4
+NEU4 $54
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+ADDRLP4 52
+INDIRU4
+BANDU4
+ADDRLP4 56
+INDIRU4
+EQU4 $52
+LABELV $54
+ADDRLP4 44
+CNSTI4 2
+ASGNI4
+ADDRGP4 $53
+JUMPV
+LABELV $52
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+CNSTU4 4
+NEU4 $55
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRGP4 $56
+JUMPV
+LABELV $55
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+LABELV $56
+ADDRLP4 44
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $53
+ADDRLP4 16
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 7
+GEI4 $57
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $62
+JUMPV
+LABELV $59
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 $66
+JUMPV
+LABELV $63
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $67
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $68
+JUMPV
+LABELV $67
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $68
+LABELV $64
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ASGNP4
+LABELV $66
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+LEU4 $69
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+GTI4 $63
+LABELV $69
+LABELV $60
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $62
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CVPU4 4
+LTU4 $59
+ADDRGP4 $48
+JUMPV
+LABELV $57
+ADDRLP4 32
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 7
+LEI4 $70
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 40
+LEI4 $72
+ADDRLP4 40
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+DIVI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 88
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 100
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+LSHI4
+SUBP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 100
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 104
+INDIRP4
+ASGNP4
+LABELV $72
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 med3
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 72
+INDIRP4
+ASGNP4
+LABELV $70
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $74
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $75
+JUMPV
+LABELV $74
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $75
+ADDRLP4 72
+ADDRFP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRGP4 $81
+JUMPV
+LABELV $80
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $83
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $85
+ADDRLP4 80
+ADDRLP4 20
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $86
+JUMPV
+LABELV $85
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $86
+ADDRLP4 20
+ADDRFP4 8
+INDIRI4
+ADDRLP4 20
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $83
+ADDRLP4 4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $81
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+GTU4 $87
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+LEI4 $80
+LABELV $87
+ADDRGP4 $89
+JUMPV
+LABELV $88
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $91
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $93
+ADDRLP4 88
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRGP4 $94
+JUMPV
+LABELV $93
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $94
+ADDRLP4 24
+ADDRLP4 24
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ASGNP4
+LABELV $91
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ASGNP4
+LABELV $89
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+GTU4 $95
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GEI4 $88
+LABELV $95
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+LEU4 $96
+ADDRGP4 $78
+JUMPV
+LABELV $96
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $98
+ADDRLP4 96
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRGP4 $99
+JUMPV
+LABELV $98
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $99
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ASGNP4
+ADDRGP4 $81
+JUMPV
+LABELV $78
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $100
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 $105
+JUMPV
+LABELV $102
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRGP4 $109
+JUMPV
+LABELV $106
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $110
+ADDRLP4 80
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRGP4 $111
+JUMPV
+LABELV $110
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $111
+LABELV $107
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ASGNP4
+LABELV $109
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+LEU4 $112
+ADDRLP4 0
+INDIRP4
+ADDRFP4 8
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRFP4 12
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+GTI4 $106
+LABELV $112
+LABELV $103
+ADDRLP4 32
+ADDRFP4 8
+INDIRI4
+ADDRLP4 32
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $105
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CVPU4 4
+LTU4 $102
+ADDRGP4 $48
+JUMPV
+LABELV $100
+ADDRLP4 36
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 88
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 88
+INDIRU4
+SUBU4
+CVUI4 4
+GEI4 $114
+ADDRLP4 80
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRLP4 80
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+LABELV $115
+ADDRLP4 12
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $116
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $116
+ADDRLP4 100
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 100
+INDIRU4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+ADDRLP4 100
+INDIRU4
+SUBU4
+CVUI4 4
+ADDRFP4 8
+INDIRI4
+SUBI4
+GEI4 $119
+ADDRLP4 96
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $120
+JUMPV
+LABELV $119
+ADDRLP4 96
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRFP4 8
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $120
+ADDRLP4 12
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $121
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 12
+INDIRI4
+SUBP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 swapfunc
+CALLV
+pop
+LABELV $121
+ADDRLP4 108
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LEI4 $123
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ADDRFP4 8
+INDIRI4
+DIVI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $123
+ADDRLP4 116
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LEI4 $125
+ADDRFP4 0
+ADDRLP4 36
+INDIRP4
+ADDRLP4 12
+INDIRI4
+SUBP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 12
+INDIRI4
+ADDRFP4 8
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $49
+JUMPV
+LABELV $125
+LABELV $48
+endproc qsort 124 16
+export strlen
+proc strlen 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $129
+JUMPV
+LABELV $128
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $129
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $128
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+RETI4
+LABELV $127
+endproc strlen 4 0
+export strcat
+proc strcat 16 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $133
+JUMPV
+LABELV $132
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $133
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $132
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $136
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $135
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $131
+endproc strcat 16 0
+export strcpy
+proc strcpy 16 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $140
+JUMPV
+LABELV $139
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $140
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $139
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $138
+endproc strcpy 16 0
+export strcmp
+proc strcmp 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $144
+JUMPV
+LABELV $143
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $144
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $147
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $147
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $143
+LABELV $147
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+SUBI4
+RETI4
+LABELV $142
+endproc strcmp 12 0
+export strchr
+proc strchr 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $150
+JUMPV
+LABELV $149
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI4
+NEI4 $152
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $148
+JUMPV
+LABELV $152
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $150
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $149
+CNSTP4 0
+RETP4
+LABELV $148
+endproc strchr 0 0
+export strstr
+proc strstr 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $156
+JUMPV
+LABELV $155
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $161
+JUMPV
+LABELV $158
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+EQI4 $162
+ADDRGP4 $160
+JUMPV
+LABELV $162
+LABELV $159
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $161
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $158
+LABELV $160
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $164
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $154
+JUMPV
+LABELV $164
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $156
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $155
+CNSTP4 0
+RETP4
+LABELV $154
+endproc strstr 8 0
+export tolower
+proc tolower 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $167
+ADDRFP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $167
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+LABELV $167
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $166
+endproc tolower 4 0
+export toupper
+proc toupper 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $170
+ADDRFP4 0
+INDIRI4
+CNSTI4 122
+GTI4 $170
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -32
+ADDI4
+ASGNI4
+LABELV $170
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $169
+endproc toupper 4 0
+export memmove
+proc memmove 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+LEU4 $173
+ADDRLP4 0
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $178
+JUMPV
+LABELV $175
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $176
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $178
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $175
+ADDRGP4 $174
+JUMPV
+LABELV $173
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $182
+JUMPV
+LABELV $179
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $180
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $182
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $179
+LABELV $174
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $172
+endproc memmove 8 0
+export tan
+proc tan 8 4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+DIVF4
+RETF4
+LABELV $183
+endproc tan 8 4
+data
+align 4
+LABELV randSeed
+byte 4 0
+export srand
+code
+proc srand 0 0
+ADDRGP4 randSeed
+ADDRFP4 0
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $184
+endproc srand 0 0
+export rand
+proc rand 4 0
+ADDRLP4 0
+ADDRGP4 randSeed
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 69069
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 32767
+BANDI4
+RETI4
+LABELV $185
+endproc rand 4 0
+export atof
+proc atof 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $188
+JUMPV
+LABELV $187
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $190
+CNSTF4 0
+RETF4
+ADDRGP4 $186
+JUMPV
+LABELV $190
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $188
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $187
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 43
+EQI4 $195
+ADDRLP4 12
+INDIRI4
+CNSTI4 45
+EQI4 $196
+ADDRGP4 $192
+JUMPV
+LABELV $195
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $193
+JUMPV
+LABELV $196
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 $193
+JUMPV
+LABELV $192
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+LABELV $193
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 46
+EQI4 $197
+LABELV $199
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $204
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $202
+LABELV $204
+ADDRGP4 $198
+JUMPV
+LABELV $202
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1092616192
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $200
+ADDRGP4 $199
+JUMPV
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $198
+ADDRLP4 0
+INDIRI4
+CNSTI4 46
+NEI4 $205
+ADDRLP4 20
+CNSTF4 1036831949
+ASGNF4
+LABELV $207
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $212
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $210
+LABELV $212
+ADDRGP4 $209
+JUMPV
+LABELV $210
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1036831949
+ADDRLP4 20
+INDIRF4
+MULF4
+ASGNF4
+LABELV $208
+ADDRGP4 $207
+JUMPV
+LABELV $209
+LABELV $205
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+RETF4
+LABELV $186
+endproc atof 36 0
+export _atof
+proc _atof 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 48
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $217
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+CNSTF4 0
+RETF4
+ADDRGP4 $213
+JUMPV
+LABELV $217
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $215
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $214
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 43
+EQI4 $222
+ADDRLP4 16
+INDIRI4
+CNSTI4 45
+EQI4 $223
+ADDRGP4 $219
+JUMPV
+LABELV $222
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $220
+JUMPV
+LABELV $223
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 $220
+JUMPV
+LABELV $219
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $220
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 46
+EQI4 $224
+LABELV $226
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $231
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $229
+LABELV $231
+ADDRGP4 $228
+JUMPV
+LABELV $229
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1092616192
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+LABELV $227
+ADDRGP4 $226
+JUMPV
+LABELV $228
+LABELV $224
+ADDRLP4 0
+INDIRI4
+CNSTI4 46
+NEI4 $232
+ADDRLP4 24
+CNSTF4 1036831949
+ASGNF4
+LABELV $234
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $239
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $237
+LABELV $239
+ADDRGP4 $236
+JUMPV
+LABELV $237
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1036831949
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+LABELV $235
+ADDRGP4 $234
+JUMPV
+LABELV $236
+LABELV $232
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+RETF4
+LABELV $213
+endproc _atof 40 0
+export atoi
+proc atoi 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $242
+JUMPV
+LABELV $241
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $244
+CNSTI4 0
+RETI4
+ADDRGP4 $240
+JUMPV
+LABELV $244
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $242
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $241
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 43
+EQI4 $249
+ADDRLP4 12
+INDIRI4
+CNSTI4 45
+EQI4 $250
+ADDRGP4 $246
+JUMPV
+LABELV $249
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $247
+JUMPV
+LABELV $250
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $247
+JUMPV
+LABELV $246
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $247
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $251
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $256
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $254
+LABELV $256
+ADDRGP4 $253
+JUMPV
+LABELV $254
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 10
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $252
+ADDRGP4 $251
+JUMPV
+LABELV $253
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+RETI4
+LABELV $240
+endproc atoi 28 0
+export _atoi
+proc _atoi 32 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $261
+CNSTI4 0
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $261
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $259
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+LEI4 $258
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 43
+EQI4 $266
+ADDRLP4 16
+INDIRI4
+CNSTI4 45
+EQI4 $267
+ADDRGP4 $263
+JUMPV
+LABELV $266
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $264
+JUMPV
+LABELV $267
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $264
+JUMPV
+LABELV $263
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+LABELV $264
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $268
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+LTI4 $273
+ADDRLP4 0
+INDIRI4
+CNSTI4 57
+LEI4 $271
+LABELV $273
+ADDRGP4 $270
+JUMPV
+LABELV $271
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 10
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $269
+ADDRGP4 $268
+JUMPV
+LABELV $270
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+RETI4
+LABELV $257
+endproc _atoi 32 0
+export abs
+proc abs 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $276
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+LABELV $277
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $274
+endproc abs 4 0
+export fabs
+proc fabs 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $280
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $281
+JUMPV
+LABELV $280
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+LABELV $281
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $278
+endproc fabs 4 0
+proc dopr 276 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $284
+JUMPV
+LABELV $283
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $286
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+LABELV $286
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $289
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+GTI4 $289
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $396
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $396
+address $290
+address $293
+address $303
+address $308
+address $311
+address $318
+address $329
+address $334
+address $289
+code
+LABELV $290
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 37
+NEI4 $291
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $292
+JUMPV
+LABELV $291
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 56
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $292
+ADDRLP4 60
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 60
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 60
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $289
+JUMPV
+LABELV $293
+ADDRLP4 64
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 72
+CNSTI4 32
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 72
+INDIRI4
+EQI4 $299
+ADDRLP4 64
+INDIRI4
+CNSTI4 35
+EQI4 $300
+ADDRLP4 64
+INDIRI4
+ADDRLP4 72
+INDIRI4
+LTI4 $294
+LABELV $302
+ADDRLP4 64
+INDIRI4
+CNSTI4 43
+EQI4 $298
+ADDRLP4 64
+INDIRI4
+CNSTI4 45
+EQI4 $297
+ADDRLP4 64
+INDIRI4
+CNSTI4 48
+EQI4 $301
+ADDRGP4 $294
+JUMPV
+LABELV $297
+ADDRLP4 84
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 80
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 80
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 80
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $289
+JUMPV
+LABELV $298
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 88
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $289
+JUMPV
+LABELV $299
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRLP4 92
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 92
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 92
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $289
+JUMPV
+LABELV $300
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 96
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 96
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 96
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $289
+JUMPV
+LABELV $301
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 100
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 100
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $289
+JUMPV
+LABELV $294
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $303
+ADDRLP4 80
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+CNSTI4 48
+ADDRLP4 80
+INDIRI4
+GTI4 $304
+ADDRLP4 80
+INDIRI4
+CNSTI4 57
+GTI4 $304
+ADDRLP4 16
+CNSTI4 10
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $289
+JUMPV
+LABELV $304
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $306
+ADDRLP4 88
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 88
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 88
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $306
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $308
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 46
+NEI4 $309
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 84
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $289
+JUMPV
+LABELV $309
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $311
+ADDRLP4 84
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+CNSTI4 48
+ADDRLP4 84
+INDIRI4
+GTI4 $312
+ADDRLP4 84
+INDIRI4
+CNSTI4 57
+GTI4 $312
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $314
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $314
+ADDRLP4 8
+CNSTI4 10
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 88
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $289
+JUMPV
+LABELV $312
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $316
+ADDRLP4 92
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 92
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 88
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 88
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $316
+ADDRLP4 0
+CNSTI4 5
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $318
+ADDRLP4 88
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 96
+CNSTI4 104
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $322
+ADDRLP4 88
+INDIRI4
+ADDRLP4 96
+INDIRI4
+GTI4 $326
+LABELV $325
+ADDRLP4 88
+INDIRI4
+CNSTI4 76
+EQI4 $324
+ADDRGP4 $320
+JUMPV
+LABELV $326
+ADDRLP4 88
+INDIRI4
+CNSTI4 108
+EQI4 $323
+ADDRGP4 $320
+JUMPV
+LABELV $322
+ADDRLP4 104
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 100
+INDIRP4
+ADDRLP4 104
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 100
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $320
+JUMPV
+LABELV $323
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 108
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 108
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 108
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $320
+JUMPV
+LABELV $324
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 112
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 112
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 112
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $320
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $327
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $327
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $329
+ADDRLP4 100
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 108
+EQI4 $333
+ADDRGP4 $331
+JUMPV
+LABELV $333
+ADDRLP4 12
+CNSTI4 3
+ASGNI4
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 104
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 104
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $331
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $334
+ADDRLP4 104
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 69
+EQI4 $370
+ADDRLP4 112
+CNSTI4 71
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 112
+INDIRI4
+EQI4 $374
+ADDRLP4 104
+INDIRI4
+ADDRLP4 112
+INDIRI4
+GTI4 $391
+LABELV $390
+ADDRLP4 104
+INDIRI4
+CNSTI4 37
+EQI4 $388
+ADDRGP4 $336
+JUMPV
+LABELV $391
+ADDRLP4 120
+CNSTI4 88
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ADDRLP4 120
+INDIRI4
+EQI4 $359
+ADDRLP4 104
+INDIRI4
+ADDRLP4 120
+INDIRI4
+LTI4 $336
+LABELV $392
+ADDRLP4 104
+INDIRI4
+CNSTI4 99
+LTI4 $336
+ADDRLP4 104
+INDIRI4
+CNSTI4 120
+GTI4 $336
+ADDRLP4 104
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $393-396
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $393
+address $378
+address $338
+address $371
+address $367
+address $375
+address $336
+address $338
+address $336
+address $336
+address $336
+address $336
+address $381
+address $345
+address $380
+address $336
+address $336
+address $379
+address $336
+address $352
+address $336
+address $389
+address $360
+code
+LABELV $338
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $339
+ADDRLP4 128
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 128
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 128
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+CVII2 4
+CVII4 2
+ASGNI4
+ADDRGP4 $340
+JUMPV
+LABELV $339
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $341
+ADDRLP4 132
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 132
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $342
+JUMPV
+LABELV $341
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $343
+ADDRLP4 136
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 136
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $344
+JUMPV
+LABELV $343
+ADDRLP4 140
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 140
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $344
+LABELV $342
+LABELV $340
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 144
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 144
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $345
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $346
+ADDRLP4 148
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 148
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CNSTU4 65535
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $347
+JUMPV
+LABELV $346
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $348
+ADDRLP4 152
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 152
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 152
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $350
+ADDRLP4 156
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 156
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRLP4 160
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 160
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $351
+LABELV $349
+LABELV $347
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 164
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 164
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $352
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $353
+ADDRLP4 168
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 168
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 168
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CNSTU4 65535
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $354
+JUMPV
+LABELV $353
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $355
+ADDRLP4 172
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 172
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $356
+JUMPV
+LABELV $355
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $357
+ADDRLP4 176
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 176
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $358
+JUMPV
+LABELV $357
+ADDRLP4 180
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 180
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $358
+LABELV $356
+LABELV $354
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 184
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $359
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $360
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $361
+ADDRLP4 188
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 188
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 188
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CNSTU4 65535
+BANDU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $362
+JUMPV
+LABELV $361
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $363
+ADDRLP4 192
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 192
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 192
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $364
+JUMPV
+LABELV $363
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $365
+ADDRLP4 196
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 196
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+ADDRGP4 $366
+JUMPV
+LABELV $365
+ADDRLP4 200
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 200
+INDIRP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 200
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRU4
+CVUI4 4
+ASGNI4
+LABELV $366
+LABELV $364
+LABELV $362
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 204
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $367
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+NEI4 $368
+ADDRLP4 208
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 208
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $369
+JUMPV
+LABELV $368
+ADDRLP4 212
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 212
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 212
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $369
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 216
+ADDRGP4 fmtfp
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 216
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $370
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $371
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+NEI4 $372
+ADDRLP4 220
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 220
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 220
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $373
+JUMPV
+LABELV $372
+ADDRLP4 224
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 224
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 224
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $373
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 228
+ADDRGP4 fmtfp
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 228
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $374
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $375
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+NEI4 $376
+ADDRLP4 232
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 232
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 232
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $377
+JUMPV
+LABELV $376
+ADDRLP4 236
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 236
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 236
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $377
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 240
+ADDRGP4 fmtfp
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 240
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $378
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 244
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 244
+INDIRP4
+ASGNP4
+ADDRLP4 244
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 248
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 248
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $379
+ADDRLP4 252
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 252
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 252
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 256
+ADDRGP4 fmtstr
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 256
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $380
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 260
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 260
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CVUI4 4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 fmtint
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 264
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $381
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+NEI4 $382
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRGP4 $336
+JUMPV
+LABELV $382
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+NEI4 $384
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $384
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+NEI4 $386
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $386
+ADDRLP4 272
+ADDRFP4 12
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 272
+INDIRP4
+ASGNP4
+ADDRLP4 268
+ADDRLP4 272
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $388
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 268
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 268
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $336
+JUMPV
+LABELV $389
+ADDRLP4 272
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 272
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 272
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $336
+ADDRLP4 128
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRLP4 128
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 128
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+LABELV $289
+LABELV $284
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $283
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $397
+ADDRLP4 28
+INDIRI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $399
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $400
+JUMPV
+LABELV $399
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $400
+LABELV $397
+ADDRLP4 24
+INDIRI4
+RETI4
+LABELV $282
+endproc dopr 276 32
+proc fmtstr 32 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $402
+ADDRFP4 12
+ADDRGP4 $404
+ASGNP4
+LABELV $402
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $408
+JUMPV
+LABELV $405
+LABELV $406
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $408
+ADDRLP4 8
+INDIRI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $405
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+LTI4 $409
+ADDRFP4 24
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GEI4 $409
+ADDRLP4 8
+ADDRFP4 24
+INDIRI4
+ASGNI4
+LABELV $409
+ADDRLP4 0
+ADDRFP4 20
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $411
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $411
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $416
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $416
+JUMPV
+LABELV $415
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 20
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $416
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $415
+ADDRGP4 $419
+JUMPV
+LABELV $418
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRLP4 20
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $419
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+EQI4 $421
+ADDRFP4 24
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $418
+ADDRLP4 12
+INDIRI4
+ADDRFP4 24
+INDIRI4
+LTI4 $418
+LABELV $421
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 28
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $423
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $422
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $401
+endproc fmtstr 32 16
+proc fmtint 84 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 24
+INDIRI4
+CNSTI4 0
+GEI4 $426
+ADDRFP4 24
+CNSTI4 0
+ASGNI4
+LABELV $426
+ADDRLP4 8
+ADDRFP4 12
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRFP4 28
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $428
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $430
+ADDRLP4 48
+CNSTI4 45
+ASGNI4
+ADDRLP4 8
+ADDRFP4 12
+INDIRI4
+NEGI4
+CVIU4 4
+ASGNU4
+ADDRGP4 $431
+JUMPV
+LABELV $430
+ADDRFP4 28
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $432
+ADDRLP4 48
+CNSTI4 43
+ASGNI4
+ADDRGP4 $433
+JUMPV
+LABELV $432
+ADDRFP4 28
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $434
+ADDRLP4 48
+CNSTI4 32
+ASGNI4
+LABELV $434
+LABELV $433
+LABELV $431
+LABELV $428
+ADDRFP4 28
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $436
+ADDRLP4 44
+ADDRGP4 $438
+ASGNP4
+ADDRGP4 $437
+JUMPV
+LABELV $436
+ADDRLP4 44
+ADDRGP4 $439
+ASGNP4
+LABELV $437
+LABELV $440
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 8
+INDIRU4
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+MODU4
+ADDRLP4 44
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRU4
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+DIVU4
+ASGNU4
+LABELV $441
+ADDRLP4 8
+INDIRU4
+CNSTU4 0
+EQU4 $443
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 24
+LTU4 $440
+LABELV $443
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 24
+NEU4 $444
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $444
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 40
+ADDRFP4 24
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 24
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $448
+ADDRLP4 52
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $448
+ADDRLP4 52
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $449
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $450
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $451
+JUMPV
+LABELV $450
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $451
+ADDRLP4 4
+ADDRFP4 20
+INDIRI4
+ADDRLP4 52
+INDIRI4
+SUBI4
+ADDRLP4 56
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GEI4 $452
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $452
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $454
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $454
+ADDRFP4 28
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $456
+ADDRLP4 40
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $459
+ADDRLP4 68
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $460
+JUMPV
+LABELV $459
+ADDRLP4 68
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $460
+ADDRLP4 40
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $456
+ADDRFP4 28
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $464
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+NEGI4
+ASGNI4
+ADDRGP4 $464
+JUMPV
+LABELV $463
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 68
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $464
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GTI4 $463
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $466
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 68
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $466
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LEI4 $474
+ADDRGP4 $471
+JUMPV
+LABELV $470
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRLP4 72
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 72
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $471
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+GTI4 $470
+ADDRGP4 $474
+JUMPV
+LABELV $473
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 72
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 16
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 76
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 76
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $474
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $473
+ADDRGP4 $477
+JUMPV
+LABELV $476
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 80
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $477
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $476
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $425
+endproc fmtint 84 16
+proc abs_val 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $480
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $480
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $479
+endproc abs_val 4 0
+proc pow10 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $484
+JUMPV
+LABELV $483
+ADDRLP4 0
+CNSTF4 1092616192
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $484
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $483
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $482
+endproc pow10 4 0
+proc round 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1056964608
+LTF4 $487
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $487
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $486
+endproc round 8 0
+proc fmtfp 136 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $490
+ADDRFP4 20
+CNSTI4 6
+ASGNI4
+LABELV $490
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 80
+ADDRGP4 abs_val
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $492
+ADDRLP4 72
+CNSTI4 45
+ASGNI4
+ADDRGP4 $493
+JUMPV
+LABELV $492
+ADDRFP4 24
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $494
+ADDRLP4 72
+CNSTI4 43
+ASGNI4
+ADDRGP4 $495
+JUMPV
+LABELV $494
+ADDRFP4 24
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $496
+ADDRLP4 72
+CNSTI4 32
+ASGNI4
+LABELV $496
+LABELV $495
+LABELV $493
+ADDRLP4 12
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 20
+INDIRI4
+CNSTI4 9
+LEI4 $498
+ADDRFP4 20
+CNSTI4 9
+ASGNI4
+LABELV $498
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 pow10
+CALLF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+ARGF4
+ADDRLP4 88
+ADDRGP4 round
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 pow10
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 92
+INDIRF4
+LTF4 $500
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 pow10
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 96
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+LABELV $500
+LABELV $502
+ADDRLP4 100
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $506
+ADDRLP4 96
+ADDRGP4 $438
+ASGNP4
+ADDRGP4 $507
+JUMPV
+LABELV $506
+ADDRLP4 96
+ADDRGP4 $439
+ASGNP4
+LABELV $507
+ADDRLP4 100
+INDIRI4
+ADDRLP4 24
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+MODI4
+ADDRLP4 96
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $503
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $508
+ADDRLP4 8
+INDIRI4
+CNSTI4 20
+LTI4 $502
+LABELV $508
+ADDRLP4 8
+INDIRI4
+CNSTI4 20
+NEI4 $509
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $509
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $511
+ADDRLP4 100
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $515
+ADDRLP4 96
+ADDRGP4 $438
+ASGNP4
+ADDRGP4 $516
+JUMPV
+LABELV $515
+ADDRLP4 96
+ADDRGP4 $439
+ASGNP4
+LABELV $516
+ADDRLP4 100
+INDIRI4
+ADDRLP4 48
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+MODI4
+ADDRLP4 96
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $512
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $517
+ADDRLP4 20
+INDIRI4
+CNSTI4 20
+LTI4 $511
+LABELV $517
+ADDRLP4 20
+INDIRI4
+CNSTI4 20
+NEI4 $518
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $518
+ADDRLP4 20
+INDIRI4
+ADDRLP4 48
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $521
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRGP4 $522
+JUMPV
+LABELV $521
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $522
+ADDRLP4 0
+ADDRFP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ADDRFP4 20
+INDIRI4
+SUBI4
+CNSTI4 1
+SUBI4
+ADDRLP4 96
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 68
+ADDRFP4 20
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+GEI4 $523
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $523
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $525
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $525
+ADDRFP4 24
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $527
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $527
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRFP4 24
+INDIRI4
+CNSTI4 16
+BANDI4
+ADDRLP4 100
+INDIRI4
+EQI4 $537
+ADDRLP4 0
+INDIRI4
+ADDRLP4 100
+INDIRI4
+LEI4 $537
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $534
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRGP4 $534
+JUMPV
+LABELV $533
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $534
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $533
+ADDRGP4 $537
+JUMPV
+LABELV $536
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $537
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $536
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $542
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+CVII1 4
+CVII4 1
+ARGI4
+ADDRLP4 104
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $542
+JUMPV
+LABELV $541
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ADDRLP4 24
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 112
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $542
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $541
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+LEI4 $553
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 46
+ARGI4
+ADDRLP4 116
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $547
+JUMPV
+LABELV $546
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRLP4 120
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $547
+ADDRLP4 124
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 124
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+GTI4 $546
+ADDRGP4 $550
+JUMPV
+LABELV $549
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 128
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ADDRLP4 48
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 132
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 132
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $550
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GTI4 $549
+ADDRGP4 $553
+JUMPV
+LABELV $552
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRLP4 116
+ADDRGP4 dopr_outch
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $553
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $552
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $489
+endproc fmtfp 136 16
+proc dopr_outch 8 0
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 8
+INDIRI4
+GEI4 $556
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRFP4 12
+INDIRI1
+ASGNI1
+LABELV $556
+CNSTI4 1
+RETI4
+LABELV $555
+endproc dopr_outch 8 0
+export Q_vsnprintf
+proc Q_vsnprintf 4 16
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $559
+ADDRFP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $559
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 dopr
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $558
+endproc Q_vsnprintf 4 16
+export Q_snprintf
+proc Q_snprintf 12 16
+ADDRLP4 0
+ADDRFP4 8+4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_vsnprintf
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $561
+endproc Q_snprintf 12 16
+export sscanf
+proc sscanf 32 4
+ADDRLP4 4
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $566
+JUMPV
+LABELV $565
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 37
+EQI4 $568
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $566
+JUMPV
+LABELV $568
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRFP4 4
+ADDRLP4 12
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 100
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $572
+ADDRLP4 0
+INDIRI4
+CNSTI4 102
+EQI4 $573
+ADDRLP4 0
+INDIRI4
+CNSTI4 105
+EQI4 $572
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $570
+LABELV $574
+ADDRLP4 0
+INDIRI4
+CNSTI4 117
+EQI4 $572
+ADDRGP4 $570
+JUMPV
+LABELV $572
+ADDRFP4 0
+ARGP4
+ADDRLP4 24
+ADDRGP4 _atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $571
+JUMPV
+LABELV $573
+ADDRFP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 _atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+LABELV $570
+LABELV $571
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+LABELV $566
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $565
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $563
+endproc sscanf 32 4
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import strncpy
+lit
+align 1
+LABELV $439
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 97
+byte 1 98
+byte 1 99
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 0
+align 1
+LABELV $438
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+byte 1 53
+byte 1 54
+byte 1 55
+byte 1 56
+byte 1 57
+byte 1 65
+byte 1 66
+byte 1 67
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 0
+align 1
+LABELV $404
+byte 1 60
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 62
+byte 1 0
@@ -0,0 +1,8997 @@
+data
+export bg_itemlist
+align 4
+LABELV bg_itemlist
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+address $41
+address $41
+address $42
+address $43
+address $44
+address $45
+byte 4 0
+byte 4 0
+address $46
+address $47
+byte 4 5
+byte 4 3
+byte 4 0
+address $41
+address $41
+address $48
+address $49
+address $50
+byte 4 0
+byte 4 0
+byte 4 0
+address $51
+address $52
+byte 4 50
+byte 4 3
+byte 4 0
+address $41
+address $41
+address $53
+address $49
+address $54
+byte 4 0
+byte 4 0
+byte 4 0
+address $55
+address $56
+byte 4 100
+byte 4 3
+byte 4 0
+address $41
+address $41
+address $57
+address $58
+address $59
+address $60
+byte 4 0
+byte 4 0
+address $61
+address $62
+byte 4 5
+byte 4 4
+byte 4 0
+address $41
+address $41
+address $63
+address $64
+address $65
+address $66
+byte 4 0
+byte 4 0
+address $67
+address $68
+byte 4 25
+byte 4 4
+byte 4 0
+address $41
+address $41
+address $69
+address $70
+address $71
+address $72
+byte 4 0
+byte 4 0
+address $73
+address $74
+byte 4 50
+byte 4 4
+byte 4 0
+address $41
+address $41
+address $75
+address $76
+address $77
+address $78
+byte 4 0
+byte 4 0
+address $79
+address $80
+byte 4 100
+byte 4 4
+byte 4 0
+address $41
+address $41
+address $81
+address $82
+address $83
+byte 4 0
+byte 4 0
+byte 4 0
+address $84
+address $85
+byte 4 0
+byte 4 1
+byte 4 1
+address $41
+address $41
+address $86
+address $82
+address $87
+byte 4 0
+byte 4 0
+byte 4 0
+address $88
+address $89
+byte 4 10
+byte 4 1
+byte 4 3
+address $41
+address $41
+address $90
+address $82
+address $91
+byte 4 0
+byte 4 0
+byte 4 0
+address $92
+address $93
+byte 4 40
+byte 4 1
+byte 4 2
+address $41
+address $41
+address $94
+address $82
+address $95
+byte 4 0
+byte 4 0
+byte 4 0
+address $96
+address $97
+byte 4 10
+byte 4 1
+byte 4 4
+address $41
+address $98
+address $99
+address $82
+address $100
+byte 4 0
+byte 4 0
+byte 4 0
+address $101
+address $102
+byte 4 10
+byte 4 1
+byte 4 5
+address $41
+address $41
+address $103
+address $82
+address $104
+byte 4 0
+byte 4 0
+byte 4 0
+address $105
+address $106
+byte 4 100
+byte 4 1
+byte 4 6
+address $41
+address $41
+address $107
+address $82
+address $108
+byte 4 0
+byte 4 0
+byte 4 0
+address $109
+address $110
+byte 4 10
+byte 4 1
+byte 4 7
+address $41
+address $41
+address $111
+address $82
+address $112
+byte 4 0
+byte 4 0
+byte 4 0
+address $113
+address $114
+byte 4 50
+byte 4 1
+byte 4 8
+address $41
+address $41
+address $115
+address $82
+address $116
+byte 4 0
+byte 4 0
+byte 4 0
+address $117
+address $118
+byte 4 20
+byte 4 1
+byte 4 9
+address $41
+address $41
+address $119
+address $82
+address $120
+byte 4 0
+byte 4 0
+byte 4 0
+address $121
+address $122
+byte 4 0
+byte 4 1
+byte 4 10
+address $41
+address $41
+address $123
+address $124
+address $125
+byte 4 0
+byte 4 0
+byte 4 0
+address $126
+address $127
+byte 4 10
+byte 4 2
+byte 4 3
+address $41
+address $41
+address $128
+address $124
+address $129
+byte 4 0
+byte 4 0
+byte 4 0
+address $130
+address $131
+byte 4 50
+byte 4 2
+byte 4 2
+address $41
+address $41
+address $132
+address $124
+address $133
+byte 4 0
+byte 4 0
+byte 4 0
+address $134
+address $135
+byte 4 5
+byte 4 2
+byte 4 4
+address $41
+address $41
+address $136
+address $124
+address $137
+byte 4 0
+byte 4 0
+byte 4 0
+address $138
+address $139
+byte 4 30
+byte 4 2
+byte 4 8
+address $41
+address $41
+address $140
+address $124
+address $141
+byte 4 0
+byte 4 0
+byte 4 0
+address $142
+address $143
+byte 4 60
+byte 4 2
+byte 4 6
+address $41
+address $41
+address $144
+address $124
+address $145
+byte 4 0
+byte 4 0
+byte 4 0
+address $146
+address $147
+byte 4 5
+byte 4 2
+byte 4 5
+address $41
+address $41
+address $148
+address $124
+address $149
+byte 4 0
+byte 4 0
+byte 4 0
+address $150
+address $151
+byte 4 10
+byte 4 2
+byte 4 7
+address $41
+address $41
+address $152
+address $124
+address $153
+byte 4 0
+byte 4 0
+byte 4 0
+address $154
+address $155
+byte 4 15
+byte 4 2
+byte 4 9
+address $41
+address $41
+address $156
+address $157
+address $158
+byte 4 0
+byte 4 0
+byte 4 0
+address $159
+address $160
+byte 4 60
+byte 4 6
+byte 4 1
+address $41
+address $41
+address $161
+address $157
+address $162
+address $163
+byte 4 0
+byte 4 0
+address $164
+address $165
+byte 4 60
+byte 4 6
+byte 4 2
+address $41
+address $166
+address $167
+address $168
+address $169
+address $170
+byte 4 0
+byte 4 0
+address $171
+address $172
+byte 4 30
+byte 4 5
+byte 4 1
+address $41
+address $173
+address $174
+address $175
+address $176
+address $177
+byte 4 0
+byte 4 0
+address $178
+address $179
+byte 4 30
+byte 4 5
+byte 4 2
+address $41
+address $180
+address $181
+address $182
+address $183
+address $184
+byte 4 0
+byte 4 0
+address $185
+address $186
+byte 4 30
+byte 4 5
+byte 4 3
+address $41
+address $41
+address $187
+address $188
+address $189
+address $190
+byte 4 0
+byte 4 0
+address $191
+address $192
+byte 4 30
+byte 4 5
+byte 4 4
+address $41
+address $41
+address $193
+address $194
+address $195
+address $196
+byte 4 0
+byte 4 0
+address $197
+address $198
+byte 4 30
+byte 4 5
+byte 4 5
+address $41
+address $199
+address $200
+address $201
+address $202
+address $203
+byte 4 0
+byte 4 0
+address $204
+address $205
+byte 4 60
+byte 4 5
+byte 4 6
+address $41
+address $201
+address $206
+byte 4 0
+address $207
+byte 4 0
+byte 4 0
+byte 4 0
+address $208
+address $209
+byte 4 0
+byte 4 8
+byte 4 7
+address $41
+address $41
+address $210
+byte 4 0
+address $211
+byte 4 0
+byte 4 0
+byte 4 0
+address $212
+address $213
+byte 4 0
+byte 4 8
+byte 4 8
+address $41
+address $41
+byte 4 0
+skip 48
+export bg_numItems
+align 4
+LABELV bg_numItems
+byte 4 36
+export BG_FindItemForPowerup
+code
+proc BG_FindItemForPowerup 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $218
+JUMPV
+LABELV $215
+ADDRLP4 4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $226
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 8
+EQI4 $226
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $219
+LABELV $226
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $219
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+RETP4
+ADDRGP4 $214
+JUMPV
+LABELV $219
+LABELV $216
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $218
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $215
+CNSTP4 0
+RETP4
+LABELV $214
+endproc BG_FindItemForPowerup 8 0
+export BG_FindItemForHoldable
+proc BG_FindItemForHoldable 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $231
+JUMPV
+LABELV $228
+ADDRLP4 4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $232
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $232
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+RETP4
+ADDRGP4 $227
+JUMPV
+LABELV $232
+LABELV $229
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $231
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $228
+CNSTI4 1
+ARGI4
+ADDRGP4 $236
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+CNSTP4 0
+RETP4
+LABELV $227
+endproc BG_FindItemForHoldable 8 8
+export BG_FindItemForWeapon
+proc BG_FindItemForWeapon 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $241
+JUMPV
+LABELV $238
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $243
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $243
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $237
+JUMPV
+LABELV $243
+LABELV $239
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $241
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $238
+CNSTI4 1
+ARGI4
+ADDRGP4 $245
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_Error
+CALLV
+pop
+CNSTP4 0
+RETP4
+LABELV $237
+endproc BG_FindItemForWeapon 8 12
+export BG_FindItem
+proc BG_FindItem 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $250
+JUMPV
+LABELV $247
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $252
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $246
+JUMPV
+LABELV $252
+LABELV $248
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $250
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $247
+CNSTP4 0
+RETP4
+LABELV $246
+endproc BG_FindItem 8 8
+export BG_PlayerTouchesItem
+proc BG_PlayerTouchesItem 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 1110441984
+GTF4 $265
+ADDRLP4 16
+INDIRF4
+CNSTF4 3259498496
+LTF4 $265
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1108344832
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ADDRLP4 24
+INDIRF4
+GTF4 $265
+ADDRLP4 28
+CNSTF4 3255828480
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ADDRLP4 28
+INDIRF4
+LTF4 $265
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ADDRLP4 24
+INDIRF4
+GTF4 $265
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ADDRLP4 28
+INDIRF4
+GEF4 $255
+LABELV $265
+CNSTI4 0
+RETI4
+ADDRGP4 $254
+JUMPV
+LABELV $255
+CNSTI4 1
+RETI4
+LABELV $254
+endproc BG_PlayerTouchesItem 36 12
+export BG_CanItemBeGrabbed
+proc BG_CanItemBeGrabbed 32 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $269
+ADDRLP4 4
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $267
+LABELV $269
+CNSTI4 1
+ARGI4
+ADDRGP4 $270
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $267
+ADDRLP4 0
+CNSTI4 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $272
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+GTI4 $272
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $312
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $312
+address $310
+address $274
+address $275
+address $278
+address $281
+address $289
+address $307
+address $272
+address $290
+code
+LABELV $274
+CNSTI4 1
+RETI4
+ADDRGP4 $266
+JUMPV
+LABELV $275
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 200
+LTI4 $276
+CNSTI4 0
+RETI4
+ADDRGP4 $266
+JUMPV
+LABELV $276
+CNSTI4 1
+RETI4
+ADDRGP4 $266
+JUMPV
+LABELV $278
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+LTI4 $279
+CNSTI4 0
+RETI4
+ADDRGP4 $266
+JUMPV
+LABELV $279
+CNSTI4 1
+RETI4
+ADDRGP4 $266
+JUMPV
+LABELV $281
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $284
+ADDRLP4 20
+INDIRI4
+CNSTI4 100
+NEI4 $282
+LABELV $284
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+LTI4 $285
+CNSTI4 0
+RETI4
+ADDRGP4 $266
+JUMPV
+LABELV $285
+CNSTI4 1
+RETI4
+ADDRGP4 $266
+JUMPV
+LABELV $282
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+LTI4 $287
+CNSTI4 0
+RETI4
+ADDRGP4 $266
+JUMPV
+LABELV $287
+CNSTI4 1
+RETI4
+ADDRGP4 $266
+JUMPV
+LABELV $289
+CNSTI4 1
+RETI4
+ADDRGP4 $266
+JUMPV
+LABELV $290
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+NEI4 $291
+ADDRFP4 8
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $293
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 8
+EQI4 $298
+ADDRLP4 28
+INDIRI4
+CNSTI4 7
+NEI4 $299
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $298
+LABELV $299
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $294
+ADDRFP4 8
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $294
+LABELV $298
+CNSTI4 1
+RETI4
+ADDRGP4 $266
+JUMPV
+LABELV $293
+ADDRFP4 8
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $300
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 7
+EQI4 $305
+ADDRLP4 28
+INDIRI4
+CNSTI4 8
+NEI4 $306
+ADDRFP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $305
+LABELV $306
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $302
+ADDRFP4 8
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $302
+LABELV $305
+CNSTI4 1
+RETI4
+ADDRGP4 $266
+JUMPV
+LABELV $302
+LABELV $300
+LABELV $294
+LABELV $291
+CNSTI4 0
+RETI4
+ADDRGP4 $266
+JUMPV
+LABELV $307
+ADDRFP4 8
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $308
+CNSTI4 0
+RETI4
+ADDRGP4 $266
+JUMPV
+LABELV $308
+CNSTI4 1
+RETI4
+ADDRGP4 $266
+JUMPV
+LABELV $310
+CNSTI4 1
+ARGI4
+ADDRGP4 $311
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $272
+CNSTI4 0
+RETI4
+LABELV $266
+endproc BG_CanItemBeGrabbed 32 8
+export BG_EvaluateTrajectory
+proc BG_EvaluateTrajectory 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $314
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+GTI4 $314
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $327
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $327
+address $317
+address $317
+address $318
+address $320
+address $319
+address $325
+code
+LABELV $317
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $315
+JUMPV
+LABELV $318
+ADDRLP4 0
+CNSTF4 981668463
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $315
+JUMPV
+LABELV $319
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+CNSTF4 1073741824
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $315
+JUMPV
+LABELV $320
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+LEI4 $321
+ADDRFP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $321
+ADDRLP4 0
+CNSTF4 981668463
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $323
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $323
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $315
+JUMPV
+LABELV $325
+ADDRLP4 0
+CNSTF4 981668463
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 80
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTF4 1137180672
+ADDRLP4 80
+INDIRF4
+MULF4
+ADDRLP4 80
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $315
+JUMPV
+LABELV $314
+CNSTI4 1
+ARGI4
+ADDRGP4 $326
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $315
+LABELV $313
+endproc BG_EvaluateTrajectory 84 12
+export BG_EvaluateTrajectoryDelta
+proc BG_EvaluateTrajectoryDelta 44 12
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $329
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+GTI4 $329
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $340
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $340
+address $332
+address $332
+address $333
+address $335
+address $334
+address $338
+code
+LABELV $332
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRGP4 $330
+JUMPV
+LABELV $333
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $330
+JUMPV
+LABELV $334
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 24
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+CNSTF4 1073741824
+CNSTF4 1078530011
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $330
+JUMPV
+LABELV $335
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+LEI4 $336
+ADDRLP4 36
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRGP4 $328
+JUMPV
+LABELV $336
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $330
+JUMPV
+LABELV $338
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 981668463
+ADDRFP4 4
+INDIRI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 $330
+JUMPV
+LABELV $329
+CNSTI4 1
+ARGI4
+ADDRGP4 $339
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $330
+LABELV $328
+endproc BG_EvaluateTrajectoryDelta 44 12
+data
+export eventnames
+align 4
+LABELV eventnames
+address $341
+address $342
+address $343
+address $344
+address $345
+address $346
+address $347
+address $348
+address $349
+address $350
+address $351
+address $352
+address $353
+address $354
+address $355
+address $356
+address $357
+address $358
+address $359
+address $360
+address $361
+address $362
+address $363
+address $364
+address $365
+address $366
+address $367
+address $368
+address $369
+address $370
+address $371
+address $372
+address $373
+address $374
+address $375
+address $376
+address $377
+address $378
+address $379
+address $380
+address $381
+address $382
+address $383
+address $384
+address $385
+address $386
+address $387
+address $388
+address $389
+address $390
+address $391
+address $392
+address $393
+address $394
+address $395
+address $396
+address $397
+address $398
+address $399
+address $400
+address $401
+address $402
+address $403
+address $404
+address $405
+address $406
+address $407
+address $408
+address $409
+address $410
+address $411
+address $412
+address $413
+address $414
+address $415
+address $416
+export BG_AddPredictableEventToPlayerstate
+code
+proc BG_AddPredictableEventToPlayerstate 12 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $417
+endproc BG_AddPredictableEventToPlayerstate 12 0
+export BG_TouchJumpPad
+proc BG_TouchJumpPad 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $419
+ADDRGP4 $418
+JUMPV
+LABELV $419
+ADDRFP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $421
+ADDRGP4 $418
+JUMPV
+LABELV $421
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+EQI4 $423
+ADDRFP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleNormalize180
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1110704128
+GEF4 $425
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $426
+JUMPV
+LABELV $425
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+LABELV $426
+CNSTI4 13
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddPredictableEventToPlayerstate
+CALLV
+pop
+LABELV $423
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $418
+endproc BG_TouchJumpPad 28 12
+export BG_PlayerStateToEntityState
+proc BG_PlayerStateToEntityState 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+EQI4 $430
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $428
+LABELV $430
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $429
+JUMPV
+LABELV $428
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 -40
+GTI4 $431
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $431
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $432
+LABELV $429
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $433
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $433
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $435
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $435
+ADDRFP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $437
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $437
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $438
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $439
+ADDRFP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $439
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+GEI4 $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+GEI4 $443
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $443
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 8
+LSHI4
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $441
+LABELV $440
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $445
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $449
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $449
+LABELV $446
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $445
+ADDRFP4 4
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $427
+endproc BG_PlayerStateToEntityState 32 0
+export BG_PlayerStateToEntityStateExtraPolate
+proc BG_PlayerStateToEntityStateExtraPolate 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+EQI4 $454
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $452
+LABELV $454
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $453
+JUMPV
+LABELV $452
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 -40
+GTI4 $455
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $456
+JUMPV
+LABELV $455
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $456
+LABELV $453
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $457
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $457
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $459
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $459
+ADDRFP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $461
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $462
+JUMPV
+LABELV $461
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $462
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $463
+ADDRFP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $464
+JUMPV
+LABELV $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+GEI4 $465
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+GEI4 $467
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $467
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 8
+LSHI4
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $465
+LABELV $464
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $469
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $473
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $473
+LABELV $470
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $469
+ADDRFP4 4
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $451
+endproc BG_PlayerStateToEntityStateExtraPolate 32 0
+import trap_Cvar_VariableStringBuffer
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $416
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 0
+align 1
+LABELV $415
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 79
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 80
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $414
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 0
+align 1
+LABELV $413
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 66
+byte 1 79
+byte 1 76
+byte 1 84
+byte 1 0
+align 1
+LABELV $412
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 73
+byte 1 67
+byte 1 69
+byte 1 68
+byte 1 0
+align 1
+LABELV $411
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 86
+byte 1 85
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 77
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 84
+byte 1 0
+align 1
+LABELV $410
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 69
+byte 1 76
+byte 1 73
+byte 1 83
+byte 1 75
+byte 1 69
+byte 1 88
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 0
+align 1
+LABELV $409
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 75
+byte 1 65
+byte 1 77
+byte 1 73
+byte 1 75
+byte 1 65
+byte 1 90
+byte 1 69
+byte 1 0
+align 1
+LABELV $408
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 88
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $407
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 82
+byte 1 79
+byte 1 88
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 89
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 0
+align 1
+LABELV $406
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 67
+byte 1 79
+byte 1 82
+byte 1 69
+byte 1 80
+byte 1 76
+byte 1 85
+byte 1 77
+byte 1 0
+align 1
+LABELV $405
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 73
+byte 1 66
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $404
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 0
+align 1
+LABELV $403
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 85
+byte 1 73
+byte 1 84
+byte 1 0
+align 1
+LABELV $402
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 81
+byte 1 85
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $401
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 73
+byte 1 84
+byte 1 85
+byte 1 65
+byte 1 82
+byte 1 89
+byte 1 0
+align 1
+LABELV $400
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 51
+byte 1 0
+align 1
+LABELV $399
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 50
+byte 1 0
+align 1
+LABELV $398
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 49
+byte 1 0
+align 1
+LABELV $397
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 0
+align 1
+LABELV $396
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 0
+align 1
+LABELV $395
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 84
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 0
+align 1
+LABELV $394
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 0
+align 1
+LABELV $393
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 0
+align 1
+LABELV $392
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 0
+align 1
+LABELV $391
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 0
+align 1
+LABELV $390
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 0
+align 1
+LABELV $389
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 70
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $388
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $387
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $386
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $385
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 69
+byte 1 0
+align 1
+LABELV $384
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 0
+align 1
+LABELV $383
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 0
+align 1
+LABELV $382
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 80
+byte 1 0
+align 1
+LABELV $381
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 0
+align 1
+LABELV $380
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $379
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 52
+byte 1 0
+align 1
+LABELV $378
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $377
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $376
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $375
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $374
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 57
+byte 1 0
+align 1
+LABELV $373
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 56
+byte 1 0
+align 1
+LABELV $372
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 55
+byte 1 0
+align 1
+LABELV $371
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 54
+byte 1 0
+align 1
+LABELV $370
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 53
+byte 1 0
+align 1
+LABELV $369
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 52
+byte 1 0
+align 1
+LABELV $368
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 51
+byte 1 0
+align 1
+LABELV $367
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 50
+byte 1 0
+align 1
+LABELV $366
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 0
+align 1
+LABELV $365
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 48
+byte 1 0
+align 1
+LABELV $364
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 73
+byte 1 82
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $363
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 78
+byte 1 71
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 0
+align 1
+LABELV $362
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $361
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 0
+align 1
+LABELV $360
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 0
+align 1
+LABELV $359
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $358
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $357
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 0
+align 1
+LABELV $356
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 79
+byte 1 85
+byte 1 67
+byte 1 72
+byte 1 0
+align 1
+LABELV $355
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 0
+align 1
+LABELV $354
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $353
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $352
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 68
+byte 1 73
+byte 1 85
+byte 1 77
+byte 1 0
+align 1
+LABELV $351
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 0
+align 1
+LABELV $350
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 49
+byte 1 54
+byte 1 0
+align 1
+LABELV $349
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $348
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 56
+byte 1 0
+align 1
+LABELV $347
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 52
+byte 1 0
+align 1
+LABELV $346
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 87
+byte 1 73
+byte 1 77
+byte 1 0
+align 1
+LABELV $345
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 87
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 0
+align 1
+LABELV $344
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $343
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 0
+align 1
+LABELV $342
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 0
+align 1
+LABELV $341
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 78
+byte 1 69
+byte 1 0
+align 1
+LABELV $339
+byte 1 66
+byte 1 71
+byte 1 95
+byte 1 69
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 97
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $326
+byte 1 66
+byte 1 71
+byte 1 95
+byte 1 69
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 114
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $311
+byte 1 66
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 66
+byte 1 101
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 98
+byte 1 98
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 68
+byte 1 0
+align 1
+LABELV $270
+byte 1 66
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 66
+byte 1 101
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 98
+byte 1 98
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $245
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $236
+byte 1 72
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $213
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $212
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 49
+byte 1 0
+align 1
+LABELV $211
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $210
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $209
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $208
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $207
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $206
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $205
+byte 1 70
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $204
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $203
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $202
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $201
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $200
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $199
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $198
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $197
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $196
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $195
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $194
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $193
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $192
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $191
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 0
+align 1
+LABELV $190
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $189
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $188
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $187
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 0
+align 1
+LABELV $186
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $185
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $184
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $183
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $182
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $181
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $180
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $179
+byte 1 66
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $178
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $177
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 114
+byte 1 111
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $176
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 114
+byte 1 111
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $175
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $174
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 114
+byte 1 111
+byte 1 0
+align 1
+LABELV $173
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $172
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $171
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $170
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $169
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $168
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $167
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $166
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $165
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $164
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $163
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $162
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $161
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $160
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $159
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $158
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $157
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $156
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $155
+byte 1 66
+byte 1 102
+byte 1 103
+byte 1 32
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $154
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $153
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $152
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $151
+byte 1 83
+byte 1 108
+byte 1 117
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $150
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $149
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $148
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 115
+byte 1 108
+byte 1 117
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $147
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $146
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $145
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $144
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $143
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $142
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $141
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $140
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $139
+byte 1 67
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $138
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 0
+align 1
+LABELV $137
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $136
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $135
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $134
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $133
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $132
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $131
+byte 1 66
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $130
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $129
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $128
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $127
+byte 1 83
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $126
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $125
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $124
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 112
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $123
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 0
+align 1
+LABELV $122
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 72
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $121
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $120
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $119
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 107
+byte 1 0
+align 1
+LABELV $118
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 49
+byte 1 48
+byte 1 75
+byte 1 0
+align 1
+LABELV $117
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $116
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $115
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 32
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $113
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 0
+align 1
+LABELV $112
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $111
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $110
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $109
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $108
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $107
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $106
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $105
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $103
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $102
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $101
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $99
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $98
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 98
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 98
+byte 1 50
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $97
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $96
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $94
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $93
+byte 1 77
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $92
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $91
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $90
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $89
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $88
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $87
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $86
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $85
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $84
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 119
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $83
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $82
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 119
+byte 1 95
+byte 1 112
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $81
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $80
+byte 1 77
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 32
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $79
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 104
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $78
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $77
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $76
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $75
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $74
+byte 1 53
+byte 1 48
+byte 1 32
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $73
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 104
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $72
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $71
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $70
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $69
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $68
+byte 1 50
+byte 1 53
+byte 1 32
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $67
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 104
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $66
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $65
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $64
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $63
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $62
+byte 1 53
+byte 1 32
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $61
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 104
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $60
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 47
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $59
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 47
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $58
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $57
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $56
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 121
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $55
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $54
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $53
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 100
+byte 1 121
+byte 1 0
+align 1
+LABELV $52
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $51
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $50
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $49
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 50
+byte 1 95
+byte 1 112
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $48
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $47
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $46
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $45
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $44
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $43
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 49
+byte 1 95
+byte 1 112
+byte 1 107
+byte 1 117
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $42
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $41
+byte 1 0
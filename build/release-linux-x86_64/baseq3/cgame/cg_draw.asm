@@ -0,0 +1,9804 @@
+data
+export drawTeamOverlayModificationCount
+align 4
+LABELV drawTeamOverlayModificationCount
+byte 4 -1
+code
+proc CG_DrawField 64 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+GEI4 $72
+ADDRGP4 $71
+JUMPV
+LABELV $72
+ADDRFP4 8
+INDIRI4
+CNSTI4 5
+LEI4 $74
+ADDRFP4 8
+CNSTI4 5
+ASGNI4
+LABELV $74
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $76
+ADDRFP4 8
+INDIRI4
+CNSTI4 4
+GTI4 $76
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $106-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $106
+address $78
+address $85
+address $92
+address $99
+code
+LABELV $78
+ADDRFP4 12
+INDIRI4
+CNSTI4 9
+LEI4 $80
+ADDRLP4 32
+CNSTI4 9
+ASGNI4
+ADDRGP4 $81
+JUMPV
+LABELV $80
+ADDRLP4 32
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $81
+ADDRFP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $83
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 $84
+JUMPV
+LABELV $83
+ADDRLP4 36
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $84
+ADDRFP4 12
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $77
+JUMPV
+LABELV $85
+ADDRFP4 12
+INDIRI4
+CNSTI4 99
+LEI4 $87
+ADDRLP4 40
+CNSTI4 99
+ASGNI4
+ADDRGP4 $88
+JUMPV
+LABELV $87
+ADDRLP4 40
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $88
+ADDRFP4 12
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 -9
+GEI4 $90
+ADDRLP4 44
+CNSTI4 -9
+ASGNI4
+ADDRGP4 $91
+JUMPV
+LABELV $90
+ADDRLP4 44
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $91
+ADDRFP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $77
+JUMPV
+LABELV $92
+ADDRFP4 12
+INDIRI4
+CNSTI4 999
+LEI4 $94
+ADDRLP4 48
+CNSTI4 999
+ASGNI4
+ADDRGP4 $95
+JUMPV
+LABELV $94
+ADDRLP4 48
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $95
+ADDRFP4 12
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 -99
+GEI4 $97
+ADDRLP4 52
+CNSTI4 -99
+ASGNI4
+ADDRGP4 $98
+JUMPV
+LABELV $97
+ADDRLP4 52
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $98
+ADDRFP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $77
+JUMPV
+LABELV $99
+ADDRFP4 12
+INDIRI4
+CNSTI4 9999
+LEI4 $101
+ADDRLP4 56
+CNSTI4 9999
+ASGNI4
+ADDRGP4 $102
+JUMPV
+LABELV $101
+ADDRLP4 56
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $102
+ADDRFP4 12
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 -999
+GEI4 $104
+ADDRLP4 60
+CNSTI4 -999
+ASGNI4
+ADDRGP4 $105
+JUMPV
+LABELV $104
+ADDRLP4 60
+ADDRFP4 12
+INDIRI4
+ASGNI4
+LABELV $105
+ADDRFP4 12
+ADDRLP4 60
+INDIRI4
+ASGNI4
+LABELV $76
+LABELV $77
+ADDRLP4 12
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $108
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 32
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LEI4 $109
+ADDRLP4 4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $109
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 5
+LSHI4
+CNSTI4 2
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+ASGNP4
+ADDRGP4 $112
+JUMPV
+LABELV $111
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $114
+ADDRLP4 8
+CNSTI4 10
+ASGNI4
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+LABELV $115
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1107296256
+ARGF4
+CNSTF4 1111490560
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+300
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $112
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+EQI4 $118
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $111
+LABELV $118
+LABELV $71
+endproc CG_DrawField 64 20
+export CG_Draw3DModel
+proc CG_Draw3DModel 512 16
+ADDRLP4 508
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 508
+INDIRI4
+EQI4 $124
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 508
+INDIRI4
+NEI4 $120
+LABELV $124
+ADDRGP4 $119
+JUMPV
+LABELV $120
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 368
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 368
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRLP4 368+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 368+68
+ADDRFP4 24
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 368+8
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 368+108
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 368+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 0+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0+16
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0+20
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+72
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRLP4 368
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $119
+endproc CG_Draw3DModel 512 16
+export CG_DrawHead
+proc CG_DrawHead 56 32
+ADDRLP4 0
+CNSTI4 1708
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $141
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $144
+ADDRGP4 $139
+JUMPV
+LABELV $144
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 4+8
+CNSTF4 3204448256
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1056964608
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1060320051
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $142
+JUMPV
+LABELV $141
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $158
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $158
+LABELV $142
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $161
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+132
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $161
+LABELV $139
+endproc CG_DrawHead 56 32
+export CG_DrawFlagModel
+proc CG_DrawFlagModel 72 32
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $166
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $166
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 cgs+152340+36
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 12+8
+CNSTF4 3204448256
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1056964608
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 1056964608
+ADDRLP4 36+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 52
+INDIRF4
+CNSTF4 1049179980
+DIVF4
+ASGNF4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1157234688
+DIVF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 1114636288
+ADDRLP4 68
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $183
+ADDRLP4 56
+ADDRGP4 cgs+152340+36
+INDIRI4
+ASGNI4
+ADDRGP4 $184
+JUMPV
+LABELV $183
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $187
+ADDRLP4 56
+ADDRGP4 cgs+152340+40
+INDIRI4
+ASGNI4
+ADDRGP4 $188
+JUMPV
+LABELV $187
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $165
+ADDRLP4 56
+ADDRGP4 cgs+152340+44
+INDIRI4
+ASGNI4
+LABELV $192
+LABELV $188
+LABELV $184
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+ADDRGP4 $167
+JUMPV
+LABELV $166
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $195
+ADDRFP4 16
+INDIRI4
+CNSTI4 1
+NEI4 $198
+CNSTI4 7
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $200
+CNSTI4 8
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $200
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $165
+CNSTI4 9
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 68
+INDIRP4
+ASGNP4
+LABELV $203
+LABELV $201
+LABELV $199
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $204
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 64
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $204
+LABELV $195
+LABELV $167
+LABELV $165
+endproc CG_DrawFlagModel 72 32
+proc CG_DrawStatusBarHead 60 24
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 cg+124688
+INDIRF4
+CNSTF4 0
+EQF4 $210
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+124688
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+GEF4 $210
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+124688
+INDIRF4
+SUBF4
+CNSTF4 1140457472
+DIVF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1114636288
+ASGNF4
+ADDRLP4 32
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16
+ADDRLP4 28
+INDIRF4
+CNSTF4 1069547520
+ADDRLP4 32
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+124692
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+124724
+CNSTF4 1110704128
+ADDRGP4 cg+124692
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+124712
+CNSTF4 1101004800
+ADDRLP4 44
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+124708
+CNSTF4 1084227584
+ADDRLP4 52
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+124728
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+124716
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $211
+JUMPV
+LABELV $210
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+124716
+INDIRI4
+LTI4 $226
+ADDRGP4 cg+124724
+ADDRGP4 cg+124712
+INDIRF4
+ASGNF4
+ADDRGP4 cg+124720
+ADDRGP4 cg+124708
+INDIRF4
+ASGNF4
+ADDRGP4 cg+124728
+ADDRGP4 cg+124716
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cg+124716
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+CNSTF4 1157234688
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+124712
+CNSTF4 1101004800
+ADDRLP4 36
+INDIRF4
+MULF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 cg+124708
+CNSTF4 1084227584
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+LABELV $226
+ADDRLP4 16
+CNSTF4 1114636288
+ASGNF4
+LABELV $211
+ADDRGP4 cg+124728
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $240
+ADDRGP4 cg+124728
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $240
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+124728
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+124716
+INDIRI4
+ADDRGP4 cg+124728
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+CNSTF4 1077936128
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRGP4 cg+124724
+INDIRF4
+ADDRGP4 cg+124712
+INDIRF4
+ADDRGP4 cg+124724
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRGP4 cg+124720
+INDIRF4
+ADDRGP4 cg+124708
+INDIRF4
+ADDRGP4 cg+124720
+INDIRF4
+SUBF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTF4 1139802112
+ADDRLP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+LABELV $207
+endproc CG_DrawStatusBarHead 60 24
+proc CG_DrawStatusBarFlag 4 24
+ADDRFP4 0
+INDIRF4
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 0
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+LABELV $258
+endproc CG_DrawStatusBarFlag 4 24
+export CG_DrawTeamBackground
+proc CG_DrawTeamBackground 20 20
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+NEI4 $261
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $262
+JUMPV
+LABELV $261
+ADDRFP4 20
+INDIRI4
+CNSTI4 2
+NEI4 $259
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $266
+LABELV $262
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+152340+128
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $259
+endproc CG_DrawTeamBackground 20 20
+data
+align 4
+LABELV $272
+byte 4 1065353216
+byte 4 1060152279
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+code
+proc CG_DrawStatusBar 80 32
+ADDRGP4 cg_drawStatus+12
+INDIRI4
+CNSTI4 0
+NEI4 $273
+ADDRGP4 $271
+JUMPV
+LABELV $273
+CNSTI4 0
+ARGI4
+CNSTI4 420
+ARGI4
+CNSTI4 640
+ARGI4
+CNSTI4 60
+ARGI4
+CNSTF4 1051260355
+ARGF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 728
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $281
+CNSTI4 136
+ADDRLP4 60
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRI4
+EQI4 $281
+ADDRLP4 24
+CNSTF4 1116471296
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 8+4
+CNSTF4 1101004800
+ADDRLP4 68
+INDIRF4
+MULF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+CNSTF4 1120403456
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 72
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+CNSTI4 136
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+76
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $281
+CNSTF4 1133412352
+ARGF4
+ADDRGP4 CG_DrawStatusBarHead
+CALLV
+pop
+ADDRGP4 cg+107636+312+28
+INDIRI4
+CNSTI4 0
+EQI4 $289
+CNSTF4 1134985216
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawStatusBarFlag
+CALLV
+pop
+ADDRGP4 $290
+JUMPV
+LABELV $289
+ADDRGP4 cg+107636+312+32
+INDIRI4
+CNSTI4 0
+EQI4 $294
+CNSTF4 1134985216
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_DrawStatusBarFlag
+CALLV
+pop
+ADDRGP4 $295
+JUMPV
+LABELV $294
+ADDRGP4 cg+107636+312+36
+INDIRI4
+CNSTI4 0
+EQI4 $299
+CNSTF4 1134985216
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStatusBarFlag
+CALLV
+pop
+LABELV $299
+LABELV $295
+LABELV $290
+ADDRLP4 20
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $304
+ADDRLP4 24
+CNSTF4 1119092736
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 3240099840
+ASGNF4
+ADDRLP4 8+4
+CNSTI4 360
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+CNSTF4 1139474432
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 68
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+120
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_Draw3DModel
+CALLV
+pop
+LABELV $304
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $312
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+LEI4 $314
+ADDRGP4 cg+107636+148
+INDIRI4
+CNSTI4 3
+NEI4 $316
+ADDRGP4 cg+107636+44
+INDIRI4
+CNSTI4 100
+LEI4 $316
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+ADDRGP4 $317
+JUMPV
+LABELV $316
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $322
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 $323
+JUMPV
+LABELV $322
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+LABELV $323
+LABELV $317
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 $272
+ADDP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 0
+ARGI4
+CNSTI4 432
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $324
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $324
+ADDRLP4 72
+CNSTI4 136
+ADDRGP4 cg+107636+144
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $331
+CNSTF4 1120403456
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 76
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $331
+LABELV $324
+LABELV $314
+LABELV $312
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+LEI4 $333
+ADDRGP4 $272+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $334
+JUMPV
+LABELV $333
+ADDRLP4 0
+INDIRI4
+CNSTI4 25
+LEI4 $336
+ADDRGP4 $272
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $337
+JUMPV
+LABELV $336
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $338
+ADDRLP4 52
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 8
+RSHI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 $272
+ADDP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $339
+JUMPV
+LABELV $338
+ADDRGP4 $272+16
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $339
+LABELV $337
+LABELV $334
+CNSTI4 185
+ARGI4
+CNSTI4 432
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $342
+ADDRGP4 $272
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTI4 370
+ARGI4
+CNSTI4 432
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_draw3dIcons+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $344
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $344
+CNSTF4 1139474432
+ARGF4
+CNSTF4 1138229248
+ARGF4
+ADDRLP4 72
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+124
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $344
+LABELV $342
+LABELV $271
+endproc CG_DrawStatusBar 80 32
+proc CG_DrawAttacker 52 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg+107636+184
+INDIRI4
+CNSTI4 0
+GTI4 $351
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $350
+JUMPV
+LABELV $351
+ADDRGP4 cg+124416
+INDIRI4
+CNSTI4 0
+NEI4 $355
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $350
+JUMPV
+LABELV $355
+ADDRLP4 0
+ADDRGP4 cg+107636+248+24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $365
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $365
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $361
+LABELV $365
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $350
+JUMPV
+LABELV $361
+ADDRLP4 24
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+124416
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 10000
+LEI4 $368
+ADDRGP4 cg+124416
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $350
+JUMPV
+LABELV $368
+ADDRLP4 4
+CNSTF4 1114636288
+ASGNF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+4
+CNSTF4 1127481344
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+CNSTF4 1142947840
+ADDRLP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 $373
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_PrintStrlen
+CALLI4
+ASGNI4
+CNSTI4 640
+ADDRLP4 48
+INDIRI4
+CNSTI4 4
+LSHI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1073741824
+ADDF4
+RETF4
+LABELV $350
+endproc CG_DrawAttacker 52 24
+proc CG_DrawSnapshot 16 16
+ADDRGP4 $375
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+28
+INDIRI4
+ARGI4
+ADDRGP4 cgs+31444
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $374
+endproc CG_DrawSnapshot 16 16
+bss
+align 4
+LABELV $380
+skip 16
+align 4
+LABELV $381
+skip 4
+align 4
+LABELV $382
+skip 4
+code
+proc CG_DrawFPS 56 16
+ADDRLP4 28
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 $382
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $381
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $380
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 $381
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 4
+LEI4 $383
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $385
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $380
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $386
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $385
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $389
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $389
+ADDRLP4 24
+CNSTI4 4000
+ADDRLP4 4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $391
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 20
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $383
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $379
+endproc CG_DrawFPS 56 16
+proc CG_DrawTimer 56 16
+ADDRLP4 20
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cgs+34796
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 60
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 10
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 $395
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 635
+ADDRLP4 16
+INDIRI4
+SUBI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+CNSTF4 1082130432
+ADDF4
+RETF4
+LABELV $392
+endproc CG_DrawTimer 56 16
+proc CG_DrawTeamOverlay 152 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 0
+NEI4 $397
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $396
+JUMPV
+LABELV $397
+ADDRLP4 92
+CNSTI4 304
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $400
+ADDRGP4 cg+36
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $400
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $396
+JUMPV
+LABELV $400
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+CNSTI4 8
+LEI4 $405
+ADDRLP4 96
+CNSTI4 8
+ASGNI4
+ADDRGP4 $406
+JUMPV
+LABELV $405
+ADDRLP4 96
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+LABELV $406
+ADDRLP4 48
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $410
+JUMPV
+LABELV $407
+ADDRLP4 4
+CNSTI4 1708
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $412
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+NEI4 $412
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 56
+INDIRI4
+LEI4 $415
+ADDRLP4 56
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $415
+LABELV $412
+LABELV $408
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $410
+ADDRLP4 8
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $407
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $417
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $396
+JUMPV
+LABELV $417
+ADDRLP4 56
+INDIRI4
+CNSTI4 12
+LEI4 $419
+ADDRLP4 56
+CNSTI4 12
+ASGNI4
+LABELV $419
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $421
+ADDRLP4 8
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 104
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $425
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $425
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $427
+ADDRLP4 44
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $427
+LABELV $425
+LABELV $422
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+LTI4 $421
+ADDRLP4 44
+INDIRI4
+CNSTI4 16
+LEI4 $429
+ADDRLP4 44
+CNSTI4 16
+ASGNI4
+LABELV $429
+ADDRLP4 80
+ADDRLP4 56
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CNSTI4 3
+LSHI4
+CNSTI4 32
+ADDI4
+CNSTI4 56
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $431
+ADDRLP4 52
+CNSTI4 640
+ADDRLP4 80
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $431
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+LABELV $432
+ADDRLP4 84
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $433
+ADDRLP4 88
+ADDRFP4 0
+INDIRF4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $434
+JUMPV
+LABELV $433
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 88
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $434
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $435
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $436
+JUMPV
+LABELV $435
+ADDRLP4 104
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+12
+CNSTF4 1051260355
+ASGNF4
+LABELV $436
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 52
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+152340+128
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $449
+JUMPV
+LABELV $446
+ADDRLP4 4
+CNSTI4 1708
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $451
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+NEI4 $451
+ADDRLP4 108
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24+12
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 112
+CNSTI4 8
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ADDRLP4 112
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $457
+ADDRLP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 608
+ADDI4
+ARGI4
+ADDRLP4 120
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $461
+ADDRLP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $459
+LABELV $461
+ADDRLP4 20
+ADDRGP4 $462
+ASGNP4
+LABELV $459
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $463
+ADDRLP4 40
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $463
+ADDRLP4 132
+CNSTI4 16
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ADDRLP4 132
+INDIRI4
+ADDI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 140
+CNSTI4 8
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $457
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+ADDRLP4 60
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $465
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 128
+CNSTI4 3
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+CNSTI4 24
+ADDI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LSHI4
+ADDI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LSHI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 136
+CNSTI4 8
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 24
+ADDI4
+ASGNI4
+CNSTI4 136
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $466
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 140
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+CNSTI4 136
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $467
+JUMPV
+LABELV $466
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 140
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+132
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $467
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $472
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $473
+JUMPV
+LABELV $472
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ADDRLP4 80
+INDIRI4
+ADDI4
+CNSTI4 8
+SUBI4
+ASGNI4
+LABELV $473
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $474
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $478
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 140
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $480
+ADDRLP4 16
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 148
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $482
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+SUBI4
+ASGNI4
+ADDRGP4 $483
+JUMPV
+LABELV $482
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+ADDI4
+ASGNI4
+LABELV $483
+LABELV $480
+LABELV $478
+LABELV $475
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LEI4 $474
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+LABELV $451
+LABELV $447
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $449
+ADDRLP4 8
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $446
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+RETF4
+LABELV $396
+endproc CG_DrawTeamOverlay 152 36
+proc CG_DrawUpperRight 16 12
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $485
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 1
+NEI4 $485
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $485
+ADDRGP4 cg_drawSnapshot+12
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_DrawSnapshot
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $489
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_drawFPS+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $492
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $495
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+NEI4 $492
+LABELV $495
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawFPS
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $492
+ADDRGP4 cg_drawTimer+12
+INDIRI4
+CNSTI4 0
+EQI4 $496
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawTimer
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $496
+ADDRGP4 cg_drawAttacker+12
+INDIRI4
+CNSTI4 0
+EQI4 $499
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 CG_DrawAttacker
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $499
+LABELV $484
+endproc CG_DrawUpperRight 16 12
+proc CG_DrawScores 92 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 cgs+34800
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 cgs+34804
+INDIRI4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $505
+ADDRLP4 16
+CNSTI4 640
+ASGNI4
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $511
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 60
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $512
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+152340+212
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $512
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+NEI4 $517
+CNSTI4 8
+ARGI4
+ADDRLP4 68
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $520
+ADDRLP4 36
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRGP4 cgs+34812
+INDIRI4
+CNSTI4 0
+LTI4 $522
+ADDRGP4 cgs+34812
+INDIRI4
+CNSTI4 2
+GTI4 $522
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+34812
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+60
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $522
+LABELV $520
+LABELV $517
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $511
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 72
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $532
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+152340+212
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $532
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+NEI4 $537
+CNSTI4 7
+ARGI4
+ADDRLP4 80
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $540
+ADDRLP4 36
+ADDRFP4 0
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 0
+LTI4 $542
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 2
+GTI4 $542
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+34808
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+48
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $542
+LABELV $540
+LABELV $537
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+LTI4 $549
+ADDRLP4 44
+ADDRGP4 cgs+31472
+INDIRI4
+ASGNI4
+ADDRGP4 $550
+JUMPV
+LABELV $549
+ADDRLP4 44
+ADDRGP4 cgs+31468
+INDIRI4
+ASGNI4
+LABELV $550
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $506
+ADDRGP4 $511
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 80
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 88
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 84
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 88
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 $506
+JUMPV
+LABELV $505
+ADDRLP4 16
+CNSTI4 640
+ASGNI4
+ADDRLP4 40
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $559
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $560
+JUMPV
+LABELV $559
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $560
+ADDRLP4 52
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $561
+ADDRLP4 32
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $561
+ADDRLP4 32
+INDIRI4
+CNSTI4 -9999
+EQI4 $563
+ADDRGP4 $511
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 64
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $565
+ADDRLP4 68
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $565
+ADDRLP4 68
+INDIRI4
+ADDRLP4 28
+INDIRI4
+EQI4 $565
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+152340+212
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $566
+JUMPV
+LABELV $565
+ADDRLP4 72
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $566
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $563
+ADDRLP4 28
+INDIRI4
+CNSTI4 -9999
+EQI4 $575
+ADDRGP4 $511
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 64
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $577
+ADDRLP4 40
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $577
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRGP4 cgs+152340+212
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $578
+JUMPV
+LABELV $577
+ADDRLP4 68
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1051260355
+ASGNF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1103101952
+ARGF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $578
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $575
+ADDRGP4 cgs+31468
+INDIRI4
+CNSTI4 0
+EQI4 $587
+ADDRGP4 $511
+ARGP4
+ADDRGP4 cgs+31468
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 64
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 68
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $587
+LABELV $506
+ADDRLP4 36
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+RETF4
+LABELV $502
+endproc CG_DrawScores 92 20
+data
+align 4
+LABELV $592
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1045220557
+byte 4 1065353216
+code
+proc CG_DrawPowerups 212 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 148
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $594
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $591
+JUMPV
+LABELV $594
+ADDRLP4 172
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 172
+INDIRI4
+ASGNI4
+LABELV $596
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $600
+ADDRGP4 $597
+JUMPV
+LABELV $600
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LTI4 $605
+ADDRLP4 140
+INDIRI4
+CNSTI4 999000
+LEI4 $603
+LABELV $605
+ADDRGP4 $597
+JUMPV
+LABELV $603
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $606
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $610
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $615
+JUMPV
+LABELV $612
+ADDRLP4 180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 68+4
+ADDP4
+ADDRLP4 180
+INDIRI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 184
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $613
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $615
+ADDRLP4 0
+INDIRI4
+ADDRLP4 132
+INDIRI4
+GEI4 $612
+ADDRGP4 $608
+JUMPV
+LABELV $610
+LABELV $607
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $609
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $606
+LABELV $608
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $597
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 16
+LTI4 $596
+ADDRLP4 168
+CNSTI4 528
+ASGNI4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 $621
+JUMPV
+LABELV $618
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 152
+ADDRLP4 176
+INDIRP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $622
+ADDRLP4 164
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1111490560
+SUBF4
+ASGNF4
+ADDRLP4 164
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 $592
+ADDP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 168
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 180
+CNSTI4 2
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ADDRLP4 180
+INDIRI4
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+CNSTI4 1000
+DIVI4
+ARGI4
+ADDRGP4 CG_DrawField
+CALLV
+pop
+ADDRLP4 184
+CNSTI4 2
+ASGNI4
+ADDRLP4 140
+ADDRLP4 144
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+ADDRLP4 184
+INDIRI4
+LSHI4
+ADDRLP4 148
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CNSTI4 5000
+LTI4 $624
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $625
+JUMPV
+LABELV $624
+ADDRLP4 160
+ADDRLP4 140
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 160
+ADDRLP4 160
+INDIRF4
+ADDRLP4 160
+INDIRF4
+CVFI4 4
+CVIF4 4
+SUBF4
+ASGNF4
+ADDRLP4 188+12
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 188+8
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 188+4
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $625
+ADDRGP4 cg+124408
+INDIRI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRI4
+NEI4 $631
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+124412
+INDIRI4
+SUBI4
+CNSTI4 200
+GEI4 $631
+ADDRLP4 188
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 160
+ADDRLP4 188
+INDIRF4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+124412
+INDIRI4
+CVIF4 4
+SUBF4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+CNSTF4 1111490560
+CNSTF4 1056964608
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDRLP4 188
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $632
+JUMPV
+LABELV $631
+ADDRLP4 156
+CNSTF4 1111490560
+ASGNF4
+LABELV $632
+ADDRLP4 152
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 188
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+CNSTF4 1142947840
+ADDRLP4 156
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ADDRLP4 156
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ARGF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRLP4 156
+INDIRF4
+ARGF4
+ADDRLP4 188
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $622
+LABELV $619
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $621
+ADDRLP4 144
+INDIRI4
+ADDRLP4 136
+INDIRI4
+LTI4 $618
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $591
+endproc CG_DrawPowerups 212 20
+proc CG_DrawLowerRight 12 12
+ADDRLP4 0
+CNSTF4 1138229248
+ASGNF4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $639
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 2
+NEI4 $639
+ADDRLP4 0
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+LABELV $639
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 CG_DrawScores
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 CG_DrawPowerups
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $638
+endproc CG_DrawLowerRight 12 12
+proc CG_DrawPickupItem 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $644
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $643
+JUMPV
+LABELV $644
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+124664
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $648
+ADDRGP4 cg+124668
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $651
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTF4 1090519040
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+ADDI4
+ARGI4
+CNSTI4 52
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $651
+LABELV $648
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $643
+endproc CG_DrawPickupItem 16 20
+proc CG_DrawLowerLeft 16 12
+ADDRLP4 0
+CNSTF4 1138229248
+ASGNF4
+ADDRLP4 4
+CNSTI4 3
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $656
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $656
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_DrawTeamOverlay
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $656
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_DrawPickupItem
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $655
+endproc CG_DrawLowerLeft 16 12
+proc CG_DrawTeamInfo 56 36
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+CNSTI4 8
+GEI4 $661
+ADDRLP4 8
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+ASGNI4
+ADDRGP4 $662
+JUMPV
+LABELV $661
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+LABELV $662
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GTI4 $665
+ADDRGP4 $660
+JUMPV
+LABELV $665
+ADDRGP4 cgs+152248
+INDIRI4
+ADDRGP4 cgs+152244
+INDIRI4
+EQI4 $667
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cgs+152248
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152212
+ADDP4
+INDIRI4
+SUBI4
+ADDRGP4 cg_teamChatTime+12
+INDIRI4
+LEI4 $671
+ADDRLP4 36
+ADDRGP4 cgs+152248
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $671
+ADDRLP4 32
+ADDRGP4 cgs+152244
+INDIRI4
+ADDRGP4 cgs+152248
+INDIRI4
+SUBI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+152248
+INDIRI4
+ASGNI4
+ADDRGP4 $683
+JUMPV
+LABELV $680
+CNSTI4 241
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+150284
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $687
+ADDRLP4 28
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $687
+LABELV $681
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $683
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+152244
+INDIRI4
+LTI4 $680
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $689
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $690
+JUMPV
+LABELV $689
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $695
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 1051260355
+ASGNF4
+ADDRGP4 $696
+JUMPV
+LABELV $695
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 1051260355
+ASGNF4
+LABELV $696
+LABELV $690
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 36
+ADDRLP4 32
+INDIRI4
+ASGNI4
+CNSTI4 420
+ADDRLP4 36
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+152340+128
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cgs+152244
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $712
+JUMPV
+LABELV $709
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+CNSTI4 420
+ADDRGP4 cgs+152244
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 3
+LSHI4
+SUBI4
+ARGI4
+CNSTI4 241
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+150284
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $710
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $712
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+152248
+INDIRI4
+GEI4 $709
+LABELV $667
+LABELV $660
+endproc CG_DrawTeamInfo 56 36
+proc CG_DrawHoldableItem 8 20
+ADDRLP4 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $719
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+CNSTF4 1142161408
+ARGF4
+CNSTF4 1129840640
+ARGF4
+ADDRLP4 4
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+CNSTI4 24
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $719
+LABELV $717
+endproc CG_DrawHoldableItem 8 20
+proc CG_DrawReward 68 36
+ADDRGP4 cg_drawRewards+12
+INDIRI4
+CNSTI4 0
+NEI4 $723
+ADDRGP4 $722
+JUMPV
+LABELV $723
+ADDRGP4 cg+124428
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 52
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $727
+ADDRGP4 cg+124424
+INDIRI4
+CNSTI4 0
+LEI4 $722
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $735
+JUMPV
+LABELV $732
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cg+124512
+ADDP4
+ADDRLP4 56
+INDIRI4
+ADDRGP4 cg+124512+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+124472
+ADDP4
+ADDRLP4 60
+INDIRI4
+ADDRGP4 cg+124472+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+124432
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDRGP4 cg+124432+4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $733
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $735
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+124424
+INDIRI4
+LTI4 $732
+ADDRGP4 cg+124428
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 cg+124424
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+124428
+INDIRI4
+ARGI4
+CNSTI4 3000
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRGP4 cg+124512
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $730
+LABELV $727
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+124432
+INDIRI4
+CNSTI4 10
+LTI4 $751
+ADDRLP4 8
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 4
+CNSTF4 1133772800
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 56
+CNSTF4 1110441984
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cg+124472
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 $755
+ARGP4
+ADDRGP4 cg+124432
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 60
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 640
+ADDRLP4 60
+INDIRI4
+CNSTI4 3
+LSHI4
+SUBI4
+CNSTI4 2
+DIVI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+CVFI4 4
+ARGI4
+ADDRLP4 20
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $752
+JUMPV
+LABELV $751
+ADDRLP4 12
+ADDRGP4 cg+124432
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1113587712
+ASGNF4
+ADDRLP4 4
+CNSTI4 320
+CNSTI4 48
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $761
+JUMPV
+LABELV $758
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 56
+CNSTF4 1110441984
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cg+124472
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+LABELV $759
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $761
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $758
+LABELV $752
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $722
+endproc CG_DrawReward 68 36
+export CG_AddLagometerFrameInfo
+proc CG_AddLagometerFrameInfo 8 0
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+32
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 lagometer+512
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $764
+endproc CG_AddLagometerFrameInfo 8 0
+export CG_AddLagometerSnapshotInfo
+proc CG_AddLagometerSnapshotInfo 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $770
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $769
+JUMPV
+LABELV $770
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 127
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 lagometer+1540
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $769
+endproc CG_AddLagometerSnapshotInfo 4 0
+proc CG_DrawDisconnect 64 20
+ADDRLP4 44
+ADDRGP4 trap_GetCurrentCmdNumber
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 44
+INDIRI4
+CNSTI4 64
+SUBI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_GetUserCmd
+CALLI4
+pop
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+LEI4 $785
+ADDRLP4 48
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $781
+LABELV $785
+ADDRGP4 $780
+JUMPV
+LABELV $781
+ADDRLP4 24
+ADDRGP4 $786
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 100
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 9
+RSHI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $787
+ADDRGP4 $780
+JUMPV
+LABELV $787
+ADDRLP4 28
+CNSTF4 1142161408
+ASGNF4
+ADDRLP4 32
+CNSTF4 1138229248
+ASGNF4
+ADDRGP4 $790
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $780
+endproc CG_DrawDisconnect 64 20
+proc CG_DrawLagometer 76 36
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_lagometer+12
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $796
+ADDRGP4 cgs+31452
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $792
+LABELV $796
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+ADDRGP4 $791
+JUMPV
+LABELV $792
+ADDRLP4 44
+CNSTI4 592
+ASGNI4
+ADDRLP4 48
+CNSTI4 432
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 56
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+264
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 12
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+CNSTF4 1077936128
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 36
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+CNSTF4 1133903872
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $802
+JUMPV
+LABELV $799
+ADDRLP4 8
+ADDRGP4 lagometer+512
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $804
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+EQI4 $806
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_color_table+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $806
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $809
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $809
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $805
+JUMPV
+LABELV $804
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $813
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+EQI4 $815
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRGP4 g_color_table+64
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $815
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $818
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $818
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $813
+LABELV $805
+LABELV $800
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $802
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+LTF4 $799
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 16
+INDIRF4
+CNSTF4 1147207680
+DIVF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $825
+JUMPV
+LABELV $822
+ADDRLP4 8
+ADDRGP4 lagometer+1540
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+1028
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $828
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 lagometer+516
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $830
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $831
+ADDRLP4 20
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_color_table+48
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $831
+JUMPV
+LABELV $830
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $836
+ADDRLP4 20
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_color_table+32
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $836
+LABELV $831
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $839
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $839
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $829
+JUMPV
+LABELV $828
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $843
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+EQI4 $845
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRGP4 g_color_table+16
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $845
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $843
+LABELV $829
+LABELV $823
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $825
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+LTF4 $822
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+NEI4 $854
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $850
+LABELV $854
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 $855
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $850
+ADDRGP4 CG_DrawDisconnect
+CALLV
+pop
+LABELV $791
+endproc CG_DrawLagometer 76 36
+export CG_CenterPrint
+proc CG_CenterPrint 8 12
+ADDRGP4 cg+123364
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+123352
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+123360
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+123356
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cg+124388
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cg+123364
+ASGNP4
+ADDRGP4 $866
+JUMPV
+LABELV $865
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+NEI4 $868
+ADDRLP4 4
+ADDRGP4 cg+124388
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $868
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $866
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $865
+LABELV $856
+endproc CG_CenterPrint 8 12
+proc CG_DrawCenterString 1064 36
+ADDRGP4 cg+123352
+INDIRI4
+CNSTI4 0
+NEI4 $872
+ADDRGP4 $871
+JUMPV
+LABELV $872
+ADDRGP4 cg+123352
+INDIRI4
+ARGI4
+CNSTF4 1148846080
+ADDRGP4 cg_centertime+8
+INDIRF4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $877
+ADDRGP4 $871
+JUMPV
+LABELV $877
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cg+123364
+ASGNP4
+ADDRLP4 8
+ADDRGP4 cg+123360
+INDIRI4
+ADDRGP4 cg+124388
+INDIRI4
+CNSTI4 4
+LSHI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $883
+JUMPV
+LABELV $882
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $885
+ADDRLP4 1052
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $891
+ADDRLP4 1052
+INDIRI4
+CNSTI4 10
+NEI4 $889
+LABELV $891
+ADDRGP4 $887
+JUMPV
+LABELV $889
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $886
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 50
+LTI4 $885
+LABELV $887
+ADDRLP4 4
+INDIRI4
+ADDRLP4 28
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 28
+ARGP4
+ADDRLP4 1052
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cg+123356
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 640
+ADDRLP4 16
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cg+123356
+INDIRI4
+ARGI4
+CNSTF4 1069547520
+ADDRGP4 cg+123356
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+CNSTF4 1069547520
+ADDRGP4 cg+123356
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $897
+JUMPV
+LABELV $896
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $897
+ADDRLP4 1060
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $899
+ADDRLP4 1060
+INDIRI4
+CNSTI4 10
+NEI4 $896
+LABELV $899
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $900
+ADDRGP4 $884
+JUMPV
+LABELV $900
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $883
+ADDRGP4 $882
+JUMPV
+LABELV $884
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $871
+endproc CG_DrawCenterString 1064 36
+proc CG_DrawCrosshair 56 36
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $903
+ADDRGP4 $902
+JUMPV
+LABELV $903
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $906
+ADDRGP4 $902
+JUMPV
+LABELV $906
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+EQI4 $909
+ADDRGP4 $902
+JUMPV
+LABELV $909
+ADDRGP4 cg_crosshairHealth+12
+INDIRI4
+CNSTI4 0
+EQI4 $912
+ADDRLP4 28
+ARGP4
+ADDRGP4 CG_ColorForHealth
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $913
+JUMPV
+LABELV $912
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $913
+ADDRLP4 28
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+124672
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+LEF4 $918
+ADDRLP4 8
+INDIRF4
+CNSTF4 1128792064
+GEF4 $918
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+LABELV $918
+ADDRLP4 16
+ADDRGP4 cg_crosshairX+12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 cg_crosshairY+12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $923
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $923
+ADDRLP4 24
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+224
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 40
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+109044
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 36
+INDIRF4
+ADDRGP4 cg+109044+8
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 44
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRGP4 cg+109044+4
+INDIRI4
+CVIF4 4
+ADDF4
+ADDRLP4 36
+INDIRF4
+ADDRGP4 cg+109044+12
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 48
+INDIRF4
+ARGF4
+ADDRLP4 52
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $902
+endproc CG_DrawCrosshair 56 36
+proc CG_DrawCrosshair3D 400 28
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $935
+ADDRGP4 $934
+JUMPV
+LABELV $935
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $938
+ADDRGP4 $934
+JUMPV
+LABELV $938
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+EQI4 $941
+ADDRGP4 $934
+JUMPV
+LABELV $941
+ADDRLP4 372
+ADDRGP4 cg_crosshairSize+8
+INDIRF4
+ASGNF4
+ADDRLP4 368
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRLP4 356
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRLP4 276
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+124672
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 276
+INDIRF4
+CNSTF4 0
+LEF4 $947
+ADDRLP4 276
+INDIRF4
+CNSTF4 1128792064
+GEF4 $947
+ADDRLP4 276
+ADDRLP4 276
+INDIRF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRLP4 380
+ADDRLP4 276
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 356
+ADDRLP4 356
+INDIRF4
+ADDRLP4 380
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 368
+ADDRLP4 368
+INDIRF4
+ADDRLP4 380
+INDIRF4
+MULF4
+ASGNF4
+LABELV $947
+ADDRLP4 292
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+GEI4 $950
+ADDRLP4 292
+CNSTI4 0
+ASGNI4
+LABELV $950
+ADDRLP4 360
+ADDRLP4 292
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+224
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $954
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRLP4 380
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 268
+ADDRLP4 380
+INDIRF4
+ASGNF4
+ADDRGP4 $955
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRLP4 384
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 364
+ADDRLP4 268
+INDIRF4
+ADDRLP4 384
+INDIRF4
+DIVF4
+ASGNF4
+CNSTF4 1078530011
+ADDRGP4 cg+109044+16
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+ARGF4
+ADDRLP4 388
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 352
+ADDRLP4 268
+INDIRF4
+ADDRLP4 388
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 272
+ADDRGP4 cgs+20100+11304
+INDIRI4
+CVIF4 4
+ADDRLP4 364
+INDIRF4
+MULF4
+ADDRLP4 268
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 352
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 280
+ADDRGP4 cg+109044+24
+INDIRF4
+ADDRGP4 cg+109044+36
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 280+4
+ADDRGP4 cg+109044+24+4
+INDIRF4
+ADDRGP4 cg+109044+36+4
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 280+8
+ADDRGP4 cg+109044+24+8
+INDIRF4
+ADDRGP4 cg+109044+36+8
+INDIRF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 296
+ARGP4
+ADDRGP4 cg+109044+24
+ARGP4
+ADDRLP4 396
+CNSTP4 0
+ASGNP4
+ADDRLP4 396
+INDIRP4
+ARGP4
+ADDRLP4 396
+INDIRP4
+ARGP4
+ADDRLP4 280
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 24
+ASGNI4
+ADDRLP4 0+68
+ADDRLP4 296+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+132
+ADDRLP4 356
+INDIRF4
+CNSTF4 1142947840
+DIVF4
+ADDRLP4 352
+INDIRF4
+MULF4
+ADDRLP4 296+8
+INDIRF4
+MULF4
+ADDRLP4 272
+INDIRF4
+MULF4
+ADDRLP4 268
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0+112
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $934
+endproc CG_DrawCrosshair3D 400 28
+proc CG_ScanForCrosshairEntity 96 28
+ADDRLP4 56
+ADDRGP4 cg+109044+24
+INDIRB
+ASGNB 12
+ADDRLP4 84
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 68
+ADDRLP4 56
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRGP4 cg+109044+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRGP4 cg+109044+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 56+8
+INDIRF4
+CNSTF4 1207959552
+ADDRGP4 cg+109044+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 88
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33554433
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 64
+LTI4 $1002
+ADDRGP4 $986
+JUMPV
+LABELV $1002
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 92
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $1006
+ADDRGP4 $986
+JUMPV
+LABELV $1006
+CNSTI4 728
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+188
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1008
+ADDRGP4 $986
+JUMPV
+LABELV $1008
+ADDRGP4 cg+124400
+ADDRLP4 0+52
+INDIRI4
+ASGNI4
+ADDRGP4 cg+124404
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $986
+endproc CG_ScanForCrosshairEntity 96 28
+proc CG_DrawCrosshairNames 20 16
+ADDRGP4 cg_drawCrosshair+12
+INDIRI4
+CNSTI4 0
+NEI4 $1017
+ADDRGP4 $1016
+JUMPV
+LABELV $1017
+ADDRGP4 cg_drawCrosshairNames+12
+INDIRI4
+CNSTI4 0
+NEI4 $1020
+ADDRGP4 $1016
+JUMPV
+LABELV $1020
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+EQI4 $1023
+ADDRGP4 $1016
+JUMPV
+LABELV $1023
+ADDRGP4 CG_ScanForCrosshairEntity
+CALLV
+pop
+ADDRGP4 cg+124404
+INDIRI4
+ARGI4
+CNSTI4 1000
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1027
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $1016
+JUMPV
+LABELV $1027
+ADDRLP4 4
+CNSTI4 1708
+ADDRGP4 cg+124400
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LSHI4
+CVIF4 4
+ASGNF4
+CNSTF4 1134559232
+ADDRLP4 8
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+CVFI4 4
+ARGI4
+CNSTI4 170
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $1016
+endproc CG_DrawCrosshairNames 20 16
+proc CG_DrawSpectator 0 16
+CNSTI4 248
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $1033
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 1
+NEI4 $1034
+CNSTI4 200
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $1037
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 $1035
+JUMPV
+LABELV $1034
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $1038
+CNSTI4 8
+ARGI4
+CNSTI4 460
+ARGI4
+ADDRGP4 $1041
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $1038
+LABELV $1035
+LABELV $1032
+endproc CG_DrawSpectator 0 16
+proc CG_DrawVote 12 20
+ADDRGP4 cgs+31676
+INDIRI4
+CNSTI4 0
+NEI4 $1043
+ADDRGP4 $1042
+JUMPV
+LABELV $1043
+ADDRGP4 cgs+31688
+INDIRI4
+CNSTI4 0
+EQI4 $1046
+ADDRGP4 cgs+31688
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+152340+728
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1046
+ADDRLP4 0
+CNSTI4 30000
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cgs+31676
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1054
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1054
+ADDRGP4 $1056
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgs+31692
+ARGP4
+ADDRGP4 cgs+31680
+INDIRI4
+ARGI4
+ADDRGP4 cgs+31684
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 58
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $1042
+endproc CG_DrawVote 12 20
+proc CG_DrawTeamVote 24 20
+ADDRGP4 cgs+40972+68
+INDIRI4
+CNSTI4 1
+NEI4 $1061
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1062
+JUMPV
+LABELV $1061
+ADDRGP4 cgs+40972+68
+INDIRI4
+CNSTI4 2
+NEI4 $1060
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $1066
+LABELV $1062
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32716
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1069
+ADDRGP4 $1060
+JUMPV
+LABELV $1069
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32740
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1072
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32740
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+152340+728
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1072
+ADDRLP4 4
+CNSTI4 30000
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32716
+ADDP4
+INDIRI4
+SUBI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1080
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1080
+ADDRGP4 $1082
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cgs+32748
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cgs+32724
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cgs+32732
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+CNSTI4 0
+ARGI4
+CNSTI4 90
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawSmallString
+CALLV
+pop
+LABELV $1060
+endproc CG_DrawTeamVote 24 20
+proc CG_DrawScoreboard 4 0
+ADDRLP4 0
+ADDRGP4 CG_DrawOldScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1086
+endproc CG_DrawScoreboard 4 0
+proc CG_DrawIntermission 4 0
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 2
+NEI4 $1088
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+ADDRGP4 $1087
+JUMPV
+LABELV $1088
+ADDRGP4 cg+114328
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+114324
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1087
+endproc CG_DrawIntermission 4 0
+proc CG_DrawFollow 36 36
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $1095
+CNSTI4 0
+RETI4
+ADDRGP4 $1094
+JUMPV
+LABELV $1095
+ADDRLP4 24
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+CNSTI4 248
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRGP4 $1101
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 1708
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 20
+CNSTF4 1056964608
+CNSTI4 640
+ADDRLP4 28
+INDIRI4
+CNSTI4 5
+LSHI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 40
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1094
+endproc CG_DrawFollow 36 36
+proc CG_DrawAmmoWarning 12 16
+ADDRGP4 cg_drawAmmoWarning+12
+INDIRI4
+CNSTI4 0
+NEI4 $1106
+ADDRGP4 $1105
+JUMPV
+LABELV $1106
+ADDRGP4 cg+124392
+INDIRI4
+CNSTI4 0
+NEI4 $1109
+ADDRGP4 $1105
+JUMPV
+LABELV $1109
+ADDRGP4 cg+124392
+INDIRI4
+CNSTI4 2
+NEI4 $1112
+ADDRLP4 0
+ADDRGP4 $1115
+ASGNP4
+ADDRGP4 $1113
+JUMPV
+LABELV $1112
+ADDRLP4 0
+ADDRGP4 $1116
+ASGNP4
+LABELV $1113
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $1105
+endproc CG_DrawAmmoWarning 12 16
+proc CG_DrawWarmup 60 36
+ADDRLP4 4
+ADDRGP4 cg+124656
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1119
+ADDRGP4 $1117
+JUMPV
+LABELV $1119
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1121
+ADDRLP4 8
+ADDRGP4 $1123
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cg+124660
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1117
+JUMPV
+LABELV $1121
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 1
+NEI4 $1125
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1131
+JUMPV
+LABELV $1128
+ADDRLP4 36
+CNSTI4 1708
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 cgs+40972
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $1133
+ADDRLP4 36
+INDIRI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $1133
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1138
+ADDRLP4 20
+CNSTI4 1708
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRGP4 $1139
+JUMPV
+LABELV $1138
+ADDRLP4 24
+CNSTI4 1708
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+LABELV $1139
+LABELV $1133
+LABELV $1129
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1131
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+31480
+INDIRI4
+LTI4 $1128
+ADDRLP4 36
+CNSTU4 0
+ASGNU4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+ADDRLP4 36
+INDIRU4
+EQU4 $1126
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+ADDRLP4 36
+INDIRU4
+EQU4 $1126
+ADDRGP4 $1144
+ARGP4
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 20
+LEI4 $1145
+ADDRLP4 12
+CNSTI4 640
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $1146
+JUMPV
+LABELV $1145
+ADDRLP4 12
+CNSTI4 32
+ASGNI4
+LABELV $1146
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 20
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTF4 1069547520
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $1126
+JUMPV
+LABELV $1125
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 0
+NEI4 $1147
+ADDRLP4 8
+ADDRGP4 $1150
+ASGNP4
+ADDRGP4 $1148
+JUMPV
+LABELV $1147
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+NEI4 $1151
+ADDRLP4 8
+ADDRGP4 $1154
+ASGNP4
+ADDRGP4 $1152
+JUMPV
+LABELV $1151
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+NEI4 $1155
+ADDRLP4 8
+ADDRGP4 $1158
+ASGNP4
+ADDRGP4 $1156
+JUMPV
+LABELV $1155
+ADDRLP4 8
+ADDRGP4 $1159
+ASGNP4
+LABELV $1156
+LABELV $1152
+LABELV $1148
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 20
+LEI4 $1160
+ADDRLP4 12
+CNSTI4 640
+ADDRLP4 16
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 $1161
+JUMPV
+LABELV $1160
+ADDRLP4 12
+CNSTI4 32
+ASGNI4
+LABELV $1161
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 25
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTF4 1066192077
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1126
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $1163
+ADDRGP4 cg+124656
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1163
+ADDRGP4 $1166
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+124660
+INDIRI4
+EQI4 $1167
+ADDRGP4 cg+124660
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1173
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $1176
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $1179
+ADDRGP4 $1172
+JUMPV
+LABELV $1173
+ADDRGP4 cgs+152340+964
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1172
+JUMPV
+LABELV $1176
+ADDRGP4 cgs+152340+960
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $1172
+JUMPV
+LABELV $1179
+ADDRGP4 cgs+152340+956
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $1172
+LABELV $1167
+ADDRLP4 28
+CNSTF4 1055286886
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cg+124660
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $1185
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+EQI4 $1186
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+EQI4 $1187
+ADDRGP4 $1182
+JUMPV
+LABELV $1185
+ADDRLP4 12
+CNSTI4 28
+ASGNI4
+ADDRLP4 28
+CNSTF4 1057635697
+ASGNF4
+ADDRGP4 $1183
+JUMPV
+LABELV $1186
+ADDRLP4 12
+CNSTI4 24
+ASGNI4
+ADDRLP4 28
+CNSTF4 1057132380
+ASGNF4
+ADDRGP4 $1183
+JUMPV
+LABELV $1187
+ADDRLP4 12
+CNSTI4 20
+ASGNI4
+ADDRLP4 28
+CNSTF4 1056293519
+ASGNF4
+ADDRGP4 $1183
+JUMPV
+LABELV $1182
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+ADDRLP4 28
+CNSTF4 1055286886
+ASGNF4
+LABELV $1183
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 320
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 2
+DIVI4
+SUBI4
+ARGI4
+CNSTI4 70
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 colorWhite
+ARGP4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTF4 1069547520
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $1117
+endproc CG_DrawWarmup 60 36
+proc CG_Draw2D 8 4
+ADDRGP4 cg+12
+INDIRI4
+CNSTI4 0
+EQI4 $1189
+ADDRGP4 $1188
+JUMPV
+LABELV $1189
+ADDRGP4 cg_draw2D+12
+INDIRI4
+CNSTI4 0
+NEI4 $1192
+ADDRGP4 $1188
+JUMPV
+LABELV $1192
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $1195
+ADDRGP4 CG_DrawIntermission
+CALLV
+pop
+ADDRGP4 $1188
+JUMPV
+LABELV $1195
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1198
+ADDRGP4 CG_DrawSpectator
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1201
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1201
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 $1199
+JUMPV
+LABELV $1198
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+114320
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1203
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $1203
+ADDRGP4 CG_DrawStatusBar
+CALLV
+pop
+ADDRGP4 CG_DrawAmmoWarning
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1207
+ADDRGP4 CG_DrawCrosshair
+CALLV
+pop
+LABELV $1207
+ADDRGP4 CG_DrawCrosshairNames
+CALLV
+pop
+ADDRGP4 CG_DrawWeaponSelect
+CALLV
+pop
+ADDRGP4 CG_DrawHoldableItem
+CALLV
+pop
+ADDRGP4 CG_DrawReward
+CALLV
+pop
+LABELV $1203
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $1209
+ADDRGP4 CG_DrawTeamInfo
+CALLV
+pop
+LABELV $1209
+LABELV $1199
+ADDRGP4 CG_DrawVote
+CALLV
+pop
+ADDRGP4 CG_DrawTeamVote
+CALLV
+pop
+ADDRGP4 CG_DrawLagometer
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawUpperRight
+CALLV
+pop
+ADDRGP4 CG_DrawLowerRight
+CALLV
+pop
+ADDRGP4 CG_DrawLowerLeft
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 CG_DrawFollow
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1212
+ADDRGP4 CG_DrawWarmup
+CALLV
+pop
+LABELV $1212
+ADDRLP4 4
+ADDRGP4 CG_DrawScoreboard
+CALLI4
+ASGNI4
+ADDRGP4 cg+114324
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+114324
+INDIRI4
+CNSTI4 0
+NEI4 $1215
+ADDRGP4 CG_DrawCenterString
+CALLV
+pop
+LABELV $1215
+LABELV $1188
+endproc CG_Draw2D 8 4
+proc CG_DrawTourneyScoreboard 0 0
+ADDRGP4 CG_DrawOldTourneyScoreboard
+CALLV
+pop
+LABELV $1218
+endproc CG_DrawTourneyScoreboard 0 0
+export CG_DrawActive
+proc CG_DrawActive 0 4
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1220
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $1219
+JUMPV
+LABELV $1220
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $1223
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $1223
+ADDRGP4 CG_DrawTourneyScoreboard
+CALLV
+pop
+ADDRGP4 $1219
+JUMPV
+LABELV $1223
+ADDRGP4 CG_TileClear
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1227
+ADDRGP4 CG_DrawCrosshair3D
+CALLV
+pop
+LABELV $1227
+ADDRGP4 cg+109044
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Draw2D
+CALLV
+pop
+LABELV $1219
+endproc CG_DrawActive 0 4
+bss
+export lagometer
+align 4
+LABELV lagometer
+skip 1544
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+export teamChat2
+align 1
+LABELV teamChat2
+skip 256
+export teamChat1
+align 1
+LABELV teamChat1
+skip 256
+export systemChat
+align 1
+LABELV systemChat
+skip 256
+export numSortedTeamPlayers
+align 4
+LABELV numSortedTeamPlayers
+skip 4
+export sortedTeamPlayers
+align 4
+LABELV sortedTeamPlayers
+skip 128
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1166
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1159
+byte 1 0
+align 1
+LABELV $1158
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $1154
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $1150
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $1144
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 118
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $1123
+byte 1 87
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $1116
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 32
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $1115
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 32
+byte 1 79
+byte 1 70
+byte 1 32
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 0
+align 1
+LABELV $1101
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1082
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1056
+byte 1 86
+byte 1 79
+byte 1 84
+byte 1 69
+byte 1 40
+byte 1 37
+byte 1 105
+byte 1 41
+byte 1 58
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $1041
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 69
+byte 1 83
+byte 1 67
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 74
+byte 1 79
+byte 1 73
+byte 1 78
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1037
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1033
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 65
+byte 1 84
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $955
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 111
+byte 1 83
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $954
+byte 1 114
+byte 1 95
+byte 1 122
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 0
+align 1
+LABELV $855
+byte 1 115
+byte 1 110
+byte 1 99
+byte 1 0
+align 1
+LABELV $790
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $786
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $755
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $511
+byte 1 37
+byte 1 50
+byte 1 105
+byte 1 0
+align 1
+LABELV $465
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 0
+align 1
+LABELV $462
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $395
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $391
+byte 1 37
+byte 1 105
+byte 1 102
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $375
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $373
+byte 1 110
+byte 1 0
+align 1
+LABELV $108
+byte 1 37
+byte 1 105
+byte 1 0
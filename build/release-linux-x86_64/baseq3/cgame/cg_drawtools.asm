@@ -0,0 +1,3901 @@
+export CG_AdjustFrom640
+code
+proc CG_AdjustFrom640 16 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+31432
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+31436
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+31432
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 cgs+31436
+INDIRF4
+MULF4
+ASGNF4
+LABELV $71
+endproc CG_AdjustFrom640 16 0
+export CG_FillRect
+proc CG_FillRect 4 36
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $76
+endproc CG_FillRect 4 36
+export CG_DrawSides
+proc CG_DrawSides 12 36
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ADDRGP4 cgs+31432
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDF4
+ADDRFP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $79
+endproc CG_DrawSides 12 36
+export CG_DrawTopBottom
+proc CG_DrawTopBottom 12 36
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ADDRGP4 cgs+31436
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 16
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $85
+endproc CG_DrawTopBottom 12 36
+export CG_DrawRect
+proc CG_DrawRect 0 20
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawTopBottom
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawSides
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $91
+endproc CG_DrawRect 0 20
+export CG_DrawPic
+proc CG_DrawPic 8 36
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $92
+endproc CG_DrawPic 8 36
+export CG_DrawChar
+proc CG_DrawChar 56 36
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+CNSTI4 255
+BANDI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+CNSTI4 32
+NEI4 $94
+ADDRGP4 $93
+JUMPV
+LABELV $94
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 24
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 CG_AdjustFrom640
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 16
+INDIRI4
+CNSTI4 4
+RSHI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 16
+INDIRI4
+CNSTI4 15
+BANDI4
+ASGNI4
+ADDRLP4 40
+CNSTF4 1031798784
+ASGNF4
+ADDRLP4 0
+ADDRLP4 40
+INDIRF4
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1031798784
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 cgs+152340
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $93
+endproc CG_DrawChar 56 36
+export CG_DrawStringExt
+proc CG_DrawStringExt 56 20
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 28
+ADDRFP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 32
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 32
+INDIRI4
+CNSTI4 0
+GTI4 $98
+ADDRFP4 32
+CNSTI4 32767
+ASGNI4
+LABELV $98
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $100
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $105
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $108
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $108
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $108
+ADDRLP4 36
+INDIRI4
+CNSTI4 65
+LTI4 $111
+ADDRLP4 36
+INDIRI4
+CNSTI4 90
+LEI4 $110
+LABELV $111
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 97
+LTI4 $112
+ADDRLP4 40
+INDIRI4
+CNSTI4 122
+LEI4 $110
+LABELV $112
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 48
+LTI4 $108
+ADDRLP4 44
+INDIRI4
+CNSTI4 57
+GTI4 $108
+LABELV $110
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $106
+JUMPV
+LABELV $108
+ADDRLP4 48
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRGP4 CG_DrawChar
+CALLV
+pop
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $106
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $113
+ADDRLP4 8
+INDIRI4
+ADDRFP4 32
+INDIRI4
+LTI4 $105
+LABELV $113
+LABELV $100
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $117
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $117
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $117
+ADDRLP4 32
+INDIRI4
+CNSTI4 65
+LTI4 $120
+ADDRLP4 32
+INDIRI4
+CNSTI4 90
+LEI4 $119
+LABELV $120
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 97
+LTI4 $121
+ADDRLP4 36
+INDIRI4
+CNSTI4 122
+LEI4 $119
+LABELV $121
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 48
+LTI4 $117
+ADDRLP4 40
+INDIRI4
+CNSTI4 57
+GTI4 $117
+LABELV $119
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $122
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 g_color_table
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 12+12
+ADDRFP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $122
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $115
+JUMPV
+LABELV $117
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRGP4 CG_DrawChar
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $115
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $125
+ADDRLP4 8
+INDIRI4
+ADDRFP4 32
+INDIRI4
+LTI4 $114
+LABELV $125
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $97
+endproc CG_DrawStringExt 56 20
+export CG_DrawBigString
+proc CG_DrawBigString 28 36
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+CNSTI4 16
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $126
+endproc CG_DrawBigString 28 36
+export CG_DrawBigStringColor
+proc CG_DrawBigStringColor 8 36
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+CNSTI4 16
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $130
+endproc CG_DrawBigStringColor 8 36
+export CG_DrawSmallString
+proc CG_DrawSmallString 24 36
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $131
+endproc CG_DrawSmallString 24 36
+export CG_DrawSmallStringColor
+proc CG_DrawSmallStringColor 4 36
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $135
+endproc CG_DrawSmallStringColor 4 36
+export CG_DrawStrlen
+proc CG_DrawStrlen 28 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $138
+JUMPV
+LABELV $137
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $140
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $140
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $140
+ADDRLP4 12
+INDIRI4
+CNSTI4 65
+LTI4 $143
+ADDRLP4 12
+INDIRI4
+CNSTI4 90
+LEI4 $142
+LABELV $143
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 97
+LTI4 $144
+ADDRLP4 16
+INDIRI4
+CNSTI4 122
+LEI4 $142
+LABELV $144
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 48
+LTI4 $140
+ADDRLP4 20
+INDIRI4
+CNSTI4 57
+GTI4 $140
+LABELV $142
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $141
+JUMPV
+LABELV $140
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $141
+LABELV $138
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $137
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $136
+endproc CG_DrawStrlen 28 0
+proc CG_TileClearBox 44 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 40
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+CVIF4 4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+LABELV $145
+endproc CG_TileClearBox 44 36
+export CG_TileClear
+proc CG_TileClear 56 20
+ADDRLP4 8
+ADDRGP4 cgs+20100+11304
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 cgs+20100+11308
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+109044
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $151
+ADDRGP4 cg+109044+4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $151
+ADDRGP4 cg+109044+8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $151
+ADDRGP4 cg+109044+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $151
+ADDRGP4 $146
+JUMPV
+LABELV $151
+ADDRLP4 0
+ADDRGP4 cg+109044+4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+109044+12
+INDIRI4
+ADDI4
+ADDRLP4 32
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+109044
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 12
+INDIRI4
+ADDRGP4 cg+109044+8
+INDIRI4
+ADDI4
+ADDRLP4 32
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 cgs+152340+268
+INDIRI4
+ARGI4
+ADDRGP4 CG_TileClearBox
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 cgs+152340+268
+INDIRI4
+ARGI4
+ADDRGP4 CG_TileClearBox
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 cgs+152340+268
+INDIRI4
+ARGI4
+ADDRGP4 CG_TileClearBox
+CALLV
+pop
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 cgs+152340+268
+INDIRI4
+ARGI4
+ADDRGP4 CG_TileClearBox
+CALLV
+pop
+LABELV $146
+endproc CG_TileClear 56 20
+bss
+align 4
+LABELV $176
+skip 16
+export CG_FadeColor
+code
+proc CG_FadeColor 8 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $177
+CNSTP4 0
+RETP4
+ADDRGP4 $175
+JUMPV
+LABELV $177
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $180
+CNSTP4 0
+RETP4
+ADDRGP4 $175
+JUMPV
+LABELV $180
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 200
+GEI4 $182
+ADDRGP4 $176+12
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRGP4 $183
+JUMPV
+LABELV $182
+ADDRGP4 $176+12
+CNSTF4 1065353216
+ASGNF4
+LABELV $183
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $176+8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $176+4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $176
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $176
+RETP4
+LABELV $175
+endproc CG_FadeColor 8 0
+data
+align 4
+LABELV $189
+byte 4 1065353216
+byte 4 1045220557
+byte 4 1045220557
+byte 4 1065353216
+align 4
+LABELV $190
+byte 4 1045220557
+byte 4 1045220557
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $191
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $192
+byte 4 1060320051
+byte 4 1060320051
+byte 4 1060320051
+byte 4 1065353216
+export CG_TeamColor
+code
+proc CG_TeamColor 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $195
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $196
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+EQI4 $197
+ADDRGP4 $193
+JUMPV
+LABELV $195
+ADDRGP4 $189
+RETP4
+ADDRGP4 $188
+JUMPV
+LABELV $196
+ADDRGP4 $190
+RETP4
+ADDRGP4 $188
+JUMPV
+LABELV $197
+ADDRGP4 $192
+RETP4
+ADDRGP4 $188
+JUMPV
+LABELV $193
+ADDRGP4 $191
+RETP4
+LABELV $188
+endproc CG_TeamColor 4 0
+export CG_GetColorForHealth
+proc CG_GetColorForHealth 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $199
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $198
+JUMPV
+LABELV $199
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1059648963
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1051595899
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+GEI4 $201
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $201
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 100
+LTI4 $203
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $204
+JUMPV
+LABELV $203
+ADDRFP4 0
+INDIRI4
+CNSTI4 66
+GEI4 $205
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $206
+JUMPV
+LABELV $205
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 66
+SUBI4
+CVIF4 4
+CNSTF4 1107558400
+DIVF4
+ASGNF4
+LABELV $206
+LABELV $204
+ADDRFP4 0
+INDIRI4
+CNSTI4 60
+LEI4 $207
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $208
+JUMPV
+LABELV $207
+ADDRFP4 0
+INDIRI4
+CNSTI4 30
+GEI4 $209
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $210
+JUMPV
+LABELV $209
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 30
+SUBI4
+CVIF4 4
+CNSTF4 1106247680
+DIVF4
+ASGNF4
+LABELV $210
+LABELV $208
+LABELV $198
+endproc CG_GetColorForHealth 16 0
+export CG_ColorForHealth
+proc CG_ColorForHealth 0 12
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_GetColorForHealth
+CALLV
+pop
+LABELV $211
+endproc CG_ColorForHealth 0 12
+data
+align 4
+LABELV propMap
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 -1
+byte 4 0
+byte 4 0
+byte 4 8
+byte 4 11
+byte 4 122
+byte 4 7
+byte 4 154
+byte 4 181
+byte 4 14
+byte 4 55
+byte 4 122
+byte 4 17
+byte 4 79
+byte 4 122
+byte 4 18
+byte 4 101
+byte 4 122
+byte 4 23
+byte 4 153
+byte 4 122
+byte 4 18
+byte 4 9
+byte 4 93
+byte 4 7
+byte 4 207
+byte 4 122
+byte 4 8
+byte 4 230
+byte 4 122
+byte 4 9
+byte 4 177
+byte 4 122
+byte 4 18
+byte 4 30
+byte 4 152
+byte 4 18
+byte 4 85
+byte 4 181
+byte 4 7
+byte 4 34
+byte 4 93
+byte 4 11
+byte 4 110
+byte 4 181
+byte 4 6
+byte 4 130
+byte 4 152
+byte 4 14
+byte 4 22
+byte 4 64
+byte 4 17
+byte 4 41
+byte 4 64
+byte 4 12
+byte 4 58
+byte 4 64
+byte 4 17
+byte 4 78
+byte 4 64
+byte 4 18
+byte 4 98
+byte 4 64
+byte 4 19
+byte 4 120
+byte 4 64
+byte 4 18
+byte 4 141
+byte 4 64
+byte 4 18
+byte 4 204
+byte 4 64
+byte 4 16
+byte 4 162
+byte 4 64
+byte 4 17
+byte 4 182
+byte 4 64
+byte 4 18
+byte 4 59
+byte 4 181
+byte 4 7
+byte 4 35
+byte 4 181
+byte 4 7
+byte 4 203
+byte 4 152
+byte 4 14
+byte 4 56
+byte 4 93
+byte 4 14
+byte 4 228
+byte 4 152
+byte 4 14
+byte 4 177
+byte 4 181
+byte 4 18
+byte 4 28
+byte 4 122
+byte 4 22
+byte 4 5
+byte 4 4
+byte 4 18
+byte 4 27
+byte 4 4
+byte 4 18
+byte 4 48
+byte 4 4
+byte 4 18
+byte 4 69
+byte 4 4
+byte 4 17
+byte 4 90
+byte 4 4
+byte 4 13
+byte 4 106
+byte 4 4
+byte 4 13
+byte 4 121
+byte 4 4
+byte 4 18
+byte 4 143
+byte 4 4
+byte 4 17
+byte 4 164
+byte 4 4
+byte 4 8
+byte 4 175
+byte 4 4
+byte 4 16
+byte 4 195
+byte 4 4
+byte 4 18
+byte 4 216
+byte 4 4
+byte 4 12
+byte 4 230
+byte 4 4
+byte 4 23
+byte 4 6
+byte 4 34
+byte 4 18
+byte 4 27
+byte 4 34
+byte 4 18
+byte 4 48
+byte 4 34
+byte 4 18
+byte 4 68
+byte 4 34
+byte 4 18
+byte 4 90
+byte 4 34
+byte 4 17
+byte 4 110
+byte 4 34
+byte 4 18
+byte 4 130
+byte 4 34
+byte 4 14
+byte 4 146
+byte 4 34
+byte 4 18
+byte 4 166
+byte 4 34
+byte 4 19
+byte 4 185
+byte 4 34
+byte 4 29
+byte 4 215
+byte 4 34
+byte 4 18
+byte 4 234
+byte 4 34
+byte 4 18
+byte 4 5
+byte 4 64
+byte 4 14
+byte 4 60
+byte 4 152
+byte 4 7
+byte 4 106
+byte 4 151
+byte 4 13
+byte 4 83
+byte 4 152
+byte 4 7
+byte 4 128
+byte 4 122
+byte 4 17
+byte 4 4
+byte 4 152
+byte 4 21
+byte 4 134
+byte 4 181
+byte 4 5
+byte 4 5
+byte 4 4
+byte 4 18
+byte 4 27
+byte 4 4
+byte 4 18
+byte 4 48
+byte 4 4
+byte 4 18
+byte 4 69
+byte 4 4
+byte 4 17
+byte 4 90
+byte 4 4
+byte 4 13
+byte 4 106
+byte 4 4
+byte 4 13
+byte 4 121
+byte 4 4
+byte 4 18
+byte 4 143
+byte 4 4
+byte 4 17
+byte 4 164
+byte 4 4
+byte 4 8
+byte 4 175
+byte 4 4
+byte 4 16
+byte 4 195
+byte 4 4
+byte 4 18
+byte 4 216
+byte 4 4
+byte 4 12
+byte 4 230
+byte 4 4
+byte 4 23
+byte 4 6
+byte 4 34
+byte 4 18
+byte 4 27
+byte 4 34
+byte 4 18
+byte 4 48
+byte 4 34
+byte 4 18
+byte 4 68
+byte 4 34
+byte 4 18
+byte 4 90
+byte 4 34
+byte 4 17
+byte 4 110
+byte 4 34
+byte 4 18
+byte 4 130
+byte 4 34
+byte 4 14
+byte 4 146
+byte 4 34
+byte 4 18
+byte 4 166
+byte 4 34
+byte 4 19
+byte 4 185
+byte 4 34
+byte 4 29
+byte 4 215
+byte 4 34
+byte 4 18
+byte 4 234
+byte 4 34
+byte 4 18
+byte 4 5
+byte 4 64
+byte 4 14
+byte 4 153
+byte 4 152
+byte 4 13
+byte 4 11
+byte 4 181
+byte 4 5
+byte 4 180
+byte 4 152
+byte 4 13
+byte 4 79
+byte 4 93
+byte 4 17
+byte 4 0
+byte 4 0
+byte 4 -1
+align 4
+LABELV propMapB
+byte 4 11
+byte 4 12
+byte 4 33
+byte 4 49
+byte 4 12
+byte 4 31
+byte 4 85
+byte 4 12
+byte 4 31
+byte 4 120
+byte 4 12
+byte 4 30
+byte 4 156
+byte 4 12
+byte 4 21
+byte 4 183
+byte 4 12
+byte 4 21
+byte 4 207
+byte 4 12
+byte 4 32
+byte 4 13
+byte 4 55
+byte 4 30
+byte 4 49
+byte 4 55
+byte 4 13
+byte 4 66
+byte 4 55
+byte 4 29
+byte 4 101
+byte 4 55
+byte 4 31
+byte 4 135
+byte 4 55
+byte 4 21
+byte 4 158
+byte 4 55
+byte 4 40
+byte 4 204
+byte 4 55
+byte 4 32
+byte 4 12
+byte 4 97
+byte 4 31
+byte 4 48
+byte 4 97
+byte 4 31
+byte 4 82
+byte 4 97
+byte 4 30
+byte 4 118
+byte 4 97
+byte 4 30
+byte 4 153
+byte 4 97
+byte 4 30
+byte 4 185
+byte 4 97
+byte 4 25
+byte 4 213
+byte 4 97
+byte 4 30
+byte 4 11
+byte 4 139
+byte 4 32
+byte 4 42
+byte 4 139
+byte 4 51
+byte 4 93
+byte 4 139
+byte 4 32
+byte 4 126
+byte 4 139
+byte 4 31
+byte 4 158
+byte 4 139
+byte 4 25
+code
+proc UI_DrawBannerString2 60 36
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+31432
+INDIRF4
+MULF4
+ADDRGP4 cgs+31440
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+31432
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $219
+JUMPV
+LABELV $218
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+CNSTI4 32
+NEI4 $221
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+CNSTF4 1098907648
+ADDRGP4 cgs+31432
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRLP4 40
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 65
+LTI4 $224
+ADDRLP4 40
+INDIRI4
+CNSTI4 90
+GTI4 $224
+ADDRLP4 0
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+CNSTI4 65
+SUBI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 44
+CNSTI4 12
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+MULI4
+ASGNI4
+ADDRLP4 48
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRI4
+ADDRGP4 propMapB
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 48
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 44
+INDIRI4
+ADDRGP4 propMapB+4
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 48
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 44
+INDIRI4
+ADDRGP4 propMapB+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 48
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1041235968
+ASGNF4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ADDRGP4 propMapB+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+31432
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1108344832
+ADDRGP4 cgs+31432
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRGP4 cgs+152340+12
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 cgs+31432
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+LABELV $224
+LABELV $222
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $219
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $218
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $214
+endproc UI_DrawBannerString2 60 36
+export UI_DrawBannerString
+proc UI_DrawBannerString 44 16
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $236
+JUMPV
+LABELV $235
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+NEI4 $238
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+ADDI4
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $238
+ADDRLP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $240
+ADDRLP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $240
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 propMapB-780+8
+ADDP4
+INDIRI4
+CNSTI4 4
+ADDI4
+ADDI4
+ASGNI4
+LABELV $240
+LABELV $239
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $236
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $235
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 4
+SUBI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $245
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $247
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+EQI4 $248
+ADDRGP4 $245
+JUMPV
+LABELV $247
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $248
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $245
+ADDRFP4 12
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $250
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 12+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 UI_DrawBannerString2
+CALLV
+pop
+LABELV $250
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawBannerString2
+CALLV
+pop
+LABELV $234
+endproc UI_DrawBannerString 44 16
+export UI_ProportionalStringWidth
+proc UI_ProportionalStringWidth 16 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $257
+JUMPV
+LABELV $256
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 12
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+EQI4 $260
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+ADDI4
+ASGNI4
+LABELV $260
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $257
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $256
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+SUBI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $255
+endproc UI_ProportionalStringWidth 16 0
+proc UI_DrawProportionalString2 60 36
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+31432
+INDIRF4
+MULF4
+ADDRGP4 cgs+31440
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+31432
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+CNSTI4 32
+NEI4 $269
+ADDRLP4 8
+CNSTF4 1090519040
+ADDRGP4 cgs+31432
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $270
+JUMPV
+LABELV $269
+CNSTI4 12
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+MULI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $272
+ADDRLP4 40
+CNSTI4 12
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+MULI4
+ASGNI4
+ADDRLP4 44
+CNSTF4 1132462080
+ASGNF4
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+ADDRGP4 propMap
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ADDRGP4 propMap+4
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 40
+INDIRI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 44
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1037565952
+ASGNF4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+ADDRGP4 propMap+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 cgs+31432
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1104674816
+ADDRGP4 cgs+31432
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ARGF4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 $273
+JUMPV
+LABELV $272
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+LABELV $273
+LABELV $270
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1077936128
+ADDRGP4 cgs+31432
+INDIRF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $267
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $266
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $262
+endproc UI_DrawProportionalString2 60 36
+export UI_ProportionalSizeScale
+proc UI_ProportionalSizeScale 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $282
+CNSTF4 1061158912
+RETF4
+ADDRGP4 $281
+JUMPV
+LABELV $282
+CNSTF4 1065353216
+RETF4
+LABELV $281
+endproc UI_ProportionalSizeScale 0 0
+export UI_DrawProportionalString
+proc UI_DrawProportionalString 52 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_ProportionalSizeScale
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 12
+INDIRI4
+CNSTI4 7
+BANDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $286
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+EQI4 $288
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+EQI4 $289
+ADDRGP4 $286
+JUMPV
+LABELV $288
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRGP4 $286
+JUMPV
+LABELV $289
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $286
+ADDRFP4 12
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $291
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+LABELV $291
+ADDRFP4 12
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $298
+ADDRLP4 36
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1061997773
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+ADDRGP4 $284
+JUMPV
+LABELV $298
+ADDRFP4 12
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $305
+ADDRLP4 36
+CNSTF4 1061997773
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 36
+INDIRF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1061997773
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+12
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1056964608
+ADDRLP4 48
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+8
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+ADDRGP4 $284
+JUMPV
+LABELV $305
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawProportionalString2
+CALLV
+pop
+LABELV $284
+endproc UI_DrawProportionalString 52 24
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawString
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
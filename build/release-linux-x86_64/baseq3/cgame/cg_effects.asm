@@ -0,0 +1,3602 @@
+export CG_BubbleTrail
+code
+proc CG_BubbleTrail 96 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 cg_noProjectileTrail+12
+INDIRI4
+CNSTI4 0
+EQI4 $72
+ADDRGP4 $71
+JUMPV
+LABELV $72
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRLP4 12+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRLP4 12+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 52
+INDIRI4
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+MODI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $90
+JUMPV
+LABELV $87
+ADDRLP4 72
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 1000
+ADDI4
+CVIF4 4
+CNSTF4 1132068864
+ADDRLP4 76
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 64
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 64
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 68
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+152340+292
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 68
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 68
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 68
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 64
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 84
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1084227584
+CNSTF4 1073741824
+ADDRLP4 84
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 88
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 1084227584
+CNSTF4 1073741824
+ADDRLP4 88
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 92
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1084227584
+CNSTF4 1073741824
+ADDRLP4 92
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1086324736
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $88
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ADDRFP4 8
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $90
+ADDRLP4 24
+INDIRI4
+CVIF4 4
+ADDRLP4 28
+INDIRF4
+LTF4 $87
+LABELV $71
+endproc CG_BubbleTrail 96 4
+data
+align 4
+LABELV $104
+byte 4 146
+export CG_SmokePuff
+code
+proc CG_SmokePuff 52 4
+ADDRFP4 32
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRGP4 $104
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_random
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+CNSTF4 1135869952
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRFP4 32
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 32
+INDIRI4
+CVIF4 4
+ADDRFP4 28
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 36
+INDIRI4
+ADDRFP4 32
+INDIRI4
+LEI4 $105
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRGP4 $106
+JUMPV
+LABELV $105
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+LABELV $106
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRFP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+20100+11288
+INDIRI4
+CNSTI4 3
+NEI4 $107
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+152340+280
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 4
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 4
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 4
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $108
+JUMPV
+LABELV $107
+ADDRLP4 20
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LTF4 $114
+ADDRLP4 16
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $115
+JUMPV
+LABELV $114
+ADDRLP4 16
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $115
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 16
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $117
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $118
+JUMPV
+LABELV $117
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $118
+ADDRLP4 4
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 28
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 44
+CNSTF4 1132396544
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+LTF4 $120
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $121
+JUMPV
+LABELV $120
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $121
+ADDRLP4 4
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 40
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 4
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $108
+ADDRLP4 4
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $103
+endproc CG_SmokePuff 52 4
+export CG_SpawnEffect
+proc CG_SpawnEffect 28 4
+ADDRLP4 8
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+152340+480
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cgs+152340+476
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+LABELV $122
+endproc CG_SpawnEffect 28 4
+bss
+align 4
+LABELV $131
+skip 12
+export CG_ScorePlum
+code
+proc CG_ScorePlum 52 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $137
+ADDRGP4 cg_scorePlum+12
+INDIRI4
+CNSTI4 0
+NEI4 $132
+LABELV $137
+ADDRGP4 $130
+JUMPV
+LABELV $132
+ADDRLP4 20
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 4000
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRGP4 $131+8
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+LTF4 $140
+ADDRLP4 40
+INDIRF4
+ADDRGP4 $131+8
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDF4
+GTF4 $140
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+LABELV $140
+ADDRGP4 $131
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $130
+endproc CG_ScorePlum 52 8
+export CG_MakeExplosion
+proc CG_MakeExplosion 60 8
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+GTI4 $147
+ADDRGP4 $149
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $147
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 36
+INDIRI4
+CNSTI4 63
+BANDI4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $150
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+ADDRLP4 44
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 52
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 48
+INDIRF4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1098907648
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 16+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $151
+JUMPV
+LABELV $150
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $158
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRGP4 $159
+JUMPV
+LABELV $158
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 44
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRGP4 RotateAroundDirection
+CALLV
+pop
+LABELV $159
+LABELV $151
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 28
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 280
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 56
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $146
+endproc CG_MakeExplosion 60 8
+export CG_Bleed
+proc CG_Bleed 20 0
+ADDRGP4 cg_blood+12
+INDIRI4
+CNSTI4 0
+NEI4 $162
+ADDRGP4 $161
+JUMPV
+LABELV $162
+ADDRLP4 4
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 288
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 284
+ADDP4
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+ADDRGP4 cgs+152340+472
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $168
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $168
+LABELV $161
+endproc CG_Bleed 20 0
+export CG_LaunchGib
+proc CG_LaunchGib 24 8
+ADDRLP4 8
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 5000
+ADDI4
+CVIF4 4
+CNSTF4 1161527296
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 axisDefault
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $171
+endproc CG_LaunchGib 24 8
+export CG_GibPlayer
+proc CG_GibPlayer 148 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_blood+12
+INDIRI4
+CNSTI4 0
+NEI4 $175
+ADDRGP4 $174
+JUMPV
+LABELV $175
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1132068864
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $180
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cgs+152340+168
+INDIRI4
+ARGI4
+ADDRGP4 CG_LaunchGib
+CALLV
+pop
+ADDRGP4 $181
+JUMPV
+LABELV $180
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cgs+152340+172
+INDIRI4
+ARGI4
+ADDRGP4 CG_LaunchGib
+CALLV
+pop
+LABELV $181
+ADDRGP4 cg_gibs+12
+INDIRI4
+CNSTI4 0
+NEI4 $186
+ADDRGP4 $174
+JUMPV
+LABELV $186
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1132068864
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cgs+152340+136
+INDIRI4
+ARGI4
+ADDRGP4 CG_LaunchGib
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 52
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1132068864
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cgs+152340+140
+INDIRI4
+ARGI4
+ADDRGP4 CG_LaunchGib
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 68
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 68
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1132068864
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cgs+152340+144
+INDIRI4
+ARGI4
+ADDRGP4 CG_LaunchGib
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 76
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 76
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 80
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 84
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 84
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1132068864
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cgs+152340+148
+INDIRI4
+ARGI4
+ADDRGP4 CG_LaunchGib
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 88
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 88
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 92
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 92
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 96
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 96
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1132068864
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cgs+152340+152
+INDIRI4
+ARGI4
+ADDRGP4 CG_LaunchGib
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 100
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 100
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1132068864
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cgs+152340+156
+INDIRI4
+ARGI4
+ADDRGP4 CG_LaunchGib
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 112
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 112
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 116
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 116
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 120
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 120
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1132068864
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cgs+152340+160
+INDIRI4
+ARGI4
+ADDRGP4 CG_LaunchGib
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 124
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 124
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 128
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 128
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 132
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 132
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1132068864
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cgs+152340+164
+INDIRI4
+ARGI4
+ADDRGP4 CG_LaunchGib
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 136
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 144
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 1132068864
+CNSTF4 1073741824
+ADDRLP4 144
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1132068864
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cgs+152340+164
+INDIRI4
+ARGI4
+ADDRGP4 CG_LaunchGib
+CALLV
+pop
+LABELV $174
+endproc CG_GibPlayer 148 12
+export CG_LaunchExplode
+proc CG_LaunchExplode 24 8
+ADDRLP4 8
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 10000
+ADDI4
+CVIF4 4
+CNSTF4 1169915904
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 axisDefault
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1036831949
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $225
+endproc CG_LaunchExplode 24 8
+export CG_BigExplode
+proc CG_BigExplode 92 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_blood+12
+INDIRI4
+CNSTI4 0
+NEI4 $229
+ADDRGP4 $228
+JUMPV
+LABELV $229
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1125515264
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cgs+152340+176
+INDIRI4
+ARGI4
+ADDRGP4 CG_LaunchExplode
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 36
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1125515264
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cgs+152340+176
+INDIRI4
+ARGI4
+ADDRGP4 CG_LaunchExplode
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1069547520
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1069547520
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 52
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1125515264
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cgs+152340+176
+INDIRI4
+ARGI4
+ADDRGP4 CG_LaunchExplode
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+ADDRLP4 64
+INDIRF4
+CNSTF4 1120403456
+ADDRLP4 64
+INDIRF4
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 68
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 72
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 72
+INDIRF4
+CNSTF4 1120403456
+ADDRLP4 72
+INDIRF4
+ADDRLP4 68
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 76
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1125515264
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cgs+152340+176
+INDIRI4
+ARGI4
+ADDRGP4 CG_LaunchExplode
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1075838976
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 84
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1075838976
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 84
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 88
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 88
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1125515264
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cgs+152340+176
+INDIRI4
+ARGI4
+ADDRGP4 CG_LaunchExplode
+CALLV
+pop
+LABELV $228
+endproc CG_BigExplode 92 12
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $149
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 77
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
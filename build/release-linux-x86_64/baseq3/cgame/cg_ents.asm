@@ -0,0 +1,3919 @@
+export CG_PositionEntityOnTag
+code
+proc CG_PositionEntityOnTag 84 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LerpTag
+CALLI4
+pop
+ADDRLP4 56
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $72
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $73
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $72
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 60
+CNSTI4 28
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 64
+CNSTI4 100
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $71
+endproc CG_PositionEntityOnTag 84 24
+export CG_PositionRotatedEntityOnTag
+proc CG_PositionRotatedEntityOnTag 120 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_LerpTag
+CALLI4
+pop
+ADDRLP4 92
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $78
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $79
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $78
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 52
+ARGP4
+ADDRLP4 96
+CNSTI4 28
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+LABELV $77
+endproc CG_PositionRotatedEntityOnTag 120 24
+export CG_SetEntitySoundPosition
+proc CG_SetEntitySoundPosition 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+NEI4 $84
+ADDRLP4 12
+CNSTI4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+37900
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_S_UpdateEntityPosition
+CALLV
+pop
+ADDRGP4 $85
+JUMPV
+LABELV $84
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 trap_S_UpdateEntityPosition
+CALLV
+pop
+LABELV $85
+LABELV $83
+endproc CG_SetEntitySoundPosition 24 8
+proc CG_EntityEffects 32 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetEntitySoundPosition
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $90
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 7
+EQI4 $92
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35848
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+ADDRGP4 $93
+JUMPV
+LABELV $92
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35848
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddRealLoopingSound
+CALLV
+pop
+LABELV $93
+LABELV $90
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $96
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 255
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+CNSTI4 8
+RSHI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+CNSTI4 16
+RSHI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+CNSTI4 24
+RSHI4
+ADDRLP4 28
+INDIRI4
+BANDI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $96
+LABELV $89
+endproc CG_EntityEffects 32 20
+proc CG_General 144 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $99
+ADDRGP4 $98
+JUMPV
+LABELV $99
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+80
+ADDRLP4 140
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 0+80
+INDIRI4
+ASGNI4
+ADDRLP4 0+100
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 140
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+34824
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $109
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $109
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $98
+endproc CG_General 144 12
+proc CG_Speaker 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $115
+ADDRGP4 $114
+JUMPV
+LABELV $115
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRI4
+GEI4 $117
+ADDRGP4 $114
+JUMPV
+LABELV $117
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35848
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 100
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+CVIF4 4
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+CVIF4 4
+CNSTF4 1073741824
+ADDRLP4 4
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $114
+endproc CG_Speaker 16 16
+proc CG_Item 216 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $123
+ADDRGP4 $125
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $123
+ADDRLP4 168
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRLP4 168
+INDIRI4
+EQI4 $128
+ADDRLP4 144
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+ADDRLP4 168
+INDIRI4
+EQI4 $126
+LABELV $128
+ADDRGP4 $122
+JUMPV
+LABELV $126
+ADDRLP4 140
+CNSTI4 52
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRGP4 cg_simpleItems+12
+INDIRI4
+CNSTI4 0
+EQI4 $129
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 8
+EQI4 $129
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+132
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 0+112
+CNSTI4 24
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_items+20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $122
+JUMPV
+LABELV $129
+ADDRLP4 160
+CNSTF4 925353388
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1000593162
+ADDF4
+ASGNF4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 1000
+ADDI4
+CVIF4 4
+ADDRLP4 160
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 176
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ADDRLP4 180
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRLP4 176
+INDIRF4
+MULF4
+CNSTF4 1082130432
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $144
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRGP4 cg+108996
+INDIRB
+ASGNB 12
+ADDRGP4 cg+109008
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRGP4 $145
+JUMPV
+LABELV $144
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRGP4 cg+108948
+INDIRB
+ASGNB 12
+ADDRGP4 cg+108960
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+LABELV $145
+ADDRLP4 152
+CNSTP4 0
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $152
+ADDRLP4 152
+CNSTI4 136
+ADDRLP4 140
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 184
+INDIRP4
+INDIRF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ADDRLP4 192
+INDIRP4
+INDIRF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 200
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 152
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ADDF4
+SUBF4
+ASGNF4
+ADDRLP4 208
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ADDRLP4 208
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+LABELV $152
+ADDRLP4 0+8
+CNSTI4 24
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+64
+CNSTI4 0
+ASGNI4
+ADDRLP4 156
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+LTI4 $181
+ADDRLP4 156
+INDIRI4
+CNSTI4 1000
+GEI4 $181
+ADDRLP4 148
+ADDRLP4 156
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 0+28
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+ADDRLP4 0+28+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+ADDRLP4 0+28+12
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+ADDRLP4 0+28+24
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $182
+JUMPV
+LABELV $181
+ADDRLP4 148
+CNSTF4 1065353216
+ASGNF4
+LABELV $182
+ADDRLP4 188
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 1
+EQI4 $228
+ADDRLP4 188
+INDIRI4
+CNSTI4 3
+NEI4 $226
+LABELV $228
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $226
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $230
+ADDRLP4 0+28
+CNSTF4 1069547520
+ADDRLP4 0+28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1069547520
+ADDRLP4 0+28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1069547520
+ADDRLP4 0+28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+CNSTF4 1069547520
+ADDRLP4 0+28+12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+CNSTF4 1069547520
+ADDRLP4 0+28+12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+CNSTF4 1069547520
+ADDRLP4 0+28+12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+CNSTF4 1069547520
+ADDRLP4 0+28+24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+CNSTF4 1069547520
+ADDRLP4 0+28+24+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+CNSTF4 1069547520
+ADDRLP4 0+28+24+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+64
+CNSTI4 1
+ASGNI4
+LABELV $230
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 cg_simpleItems+12
+INDIRI4
+CNSTI4 0
+NEI4 $275
+ADDRLP4 204
+CNSTF4 0
+ASGNF4
+ADDRLP4 192+8
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 192+4
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 192
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 208
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 4
+EQI4 $282
+ADDRLP4 208
+INDIRI4
+CNSTI4 5
+NEI4 $280
+LABELV $282
+ADDRLP4 212
+CNSTI4 24
+ADDRLP4 144
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_items+4+4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+EQI4 $283
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $288
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRLP4 192+4
+CNSTI4 360
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 1023
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 3296722944
+DIVF4
+ASGNF4
+LABELV $288
+ADDRLP4 192
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 148
+INDIRF4
+CNSTF4 1065353216
+EQF4 $295
+ADDRLP4 0+28
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+8
+ADDRLP4 0+28+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12
+ADDRLP4 0+28+12
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+12+8
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24
+ADDRLP4 0+28+24
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+28+24+8
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+64
+CNSTI4 1
+ASGNI4
+LABELV $295
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $283
+LABELV $280
+LABELV $275
+LABELV $122
+endproc CG_Item 216 12
+proc CG_Missile 168 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 11
+LEI4 $341
+ADDRLP4 144
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $341
+ADDRLP4 140
+CNSTI4 136
+ADDRLP4 144
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $343
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $343
+ADDRLP4 140
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $345
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $345
+ADDRLP4 140
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $347
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+ADDRGP4 BG_EvaluateTrajectoryDelta
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+LABELV $347
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $352
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0+136
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+112
+ADDRGP4 cgs+152340+288
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $340
+JUMPV
+LABELV $352
+ADDRLP4 0+104
+ADDRGP4 cg
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 140
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 140
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 144
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 152
+ADDRGP4 VectorNormalize2
+CALLF4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+CNSTF4 0
+NEF4 $362
+ADDRLP4 0+28+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $362
+ADDRLP4 144
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $367
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 4
+DIVI4
+CVIF4 4
+ARGF4
+ADDRGP4 RotateAroundDirection
+CALLV
+pop
+ADDRGP4 $368
+JUMPV
+LABELV $367
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 RotateAroundDirection
+CALLV
+pop
+LABELV $368
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+LABELV $340
+endproc CG_Missile 168 20
+proc CG_Grapple 156 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 11
+LEI4 $373
+ADDRLP4 140
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $373
+ADDRLP4 144
+CNSTI4 136
+ADDRLP4 140
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRLP4 140
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRGP4 CG_GrappleTrail
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+104
+ADDRGP4 cg
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 144
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 144
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 140
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 152
+ADDRGP4 VectorNormalize2
+CALLF4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+CNSTF4 0
+NEF4 $380
+ADDRLP4 0+28+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $380
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $372
+endproc CG_Grapple 156 12
+proc CG_Mover 144 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 0+104
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 6
+RSHI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 140
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+CNSTI4 16777215
+NEI4 $392
+ADDRLP4 0+8
+ADDRLP4 140
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36876
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $393
+JUMPV
+LABELV $392
+ADDRLP4 0+8
+ADDRLP4 140
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+34824
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $393
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 140
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $398
+ADDRLP4 0+104
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 140
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+34824
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $398
+LABELV $385
+endproc CG_Mover 144 12
+export CG_Beam
+proc CG_Beam 144 12
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRLP4 140
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRLP4 140
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 3
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $403
+endproc CG_Beam 144 12
+proc CG_Portal 144 12
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+84
+ADDRLP4 140
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0+28+12
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 0+28+12
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRLP4 0+28+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+28+12+4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRLP4 0+28+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+28+12+8
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRLP4 0+28+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 0+28+12
+ARGP4
+ADDRLP4 0+28+24
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 140
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+80
+ADDRLP4 140
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+104
+CNSTF4 1135869952
+ADDRLP4 140
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1132462080
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $408
+endproc CG_Portal 144 12
+export CG_AdjustPositionForMover
+proc CG_AdjustPositionForMover 92 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LEI4 $444
+ADDRFP4 4
+INDIRI4
+CNSTI4 1022
+LTI4 $442
+LABELV $444
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $441
+JUMPV
+LABELV $442
+ADDRLP4 0
+CNSTI4 728
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 80
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $445
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $441
+JUMPV
+LABELV $445
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 52
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 40+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+8
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 40+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+CNSTI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+CNSTI4 8
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $441
+endproc CG_AdjustPositionForMover 92 12
+proc CG_InterpolateEntityPosition 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $462
+ADDRGP4 $465
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $462
+ADDRLP4 24
+ADDRGP4 cg+107588
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRGP4 cg+40
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 28
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 256
+ADDP4
+ARGP4
+ADDRGP4 cg+40
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 12+4
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+INDIRF4
+ARGF4
+ADDRLP4 12+8
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 LerpAngle
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 724
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+LABELV $461
+endproc CG_InterpolateEntityPosition 44 12
+proc CG_CalcEntityLerpPositions 24 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_smoothClients+12
+INDIRI4
+CNSTI4 0
+NEI4 $482
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+GEI4 $485
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $485
+LABELV $482
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $487
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $487
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_InterpolateEntityPosition
+CALLV
+pop
+ADDRGP4 $481
+JUMPV
+LABELV $487
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $489
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+GEI4 $489
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_InterpolateEntityPosition
+CALLV
+pop
+ADDRGP4 $481
+JUMPV
+LABELV $489
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg+108104
+CVPU4 4
+EQU4 $493
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_AdjustPositionForMover
+CALLV
+pop
+LABELV $493
+LABELV $481
+endproc CG_CalcEntityLerpPositions 24 20
+proc CG_TeamBase 140 12
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+NEI4 $499
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $505
+ADDRLP4 0+8
+ADDRGP4 cgs+152340+108
+INDIRI4
+ASGNI4
+ADDRGP4 $506
+JUMPV
+LABELV $505
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $510
+ADDRLP4 0+8
+ADDRGP4 cgs+152340+112
+INDIRI4
+ASGNI4
+ADDRGP4 $511
+JUMPV
+LABELV $510
+ADDRLP4 0+8
+ADDRGP4 cgs+152340+116
+INDIRI4
+ASGNI4
+LABELV $511
+LABELV $506
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $499
+LABELV $498
+endproc CG_TeamBase 140 12
+proc CG_AddCEntity 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+LTI4 $519
+ADDRGP4 $518
+JUMPV
+LABELV $519
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CalcEntityLerpPositions
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_EntityEffects
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $521
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+GTI4 $521
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $536
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $536
+address $526
+address $527
+address $528
+address $529
+address $530
+address $531
+address $532
+address $533
+address $522
+address $522
+address $522
+address $534
+address $535
+code
+LABELV $521
+ADDRGP4 $524
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $526
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_General
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $527
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Player
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $528
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Item
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $529
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Missile
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $530
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Mover
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $531
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Beam
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $532
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Portal
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $533
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Speaker
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $534
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Grapple
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $535
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_TeamBase
+CALLV
+pop
+LABELV $522
+LABELV $518
+endproc CG_AddCEntity 8 8
+export CG_AddPacketEntities
+proc CG_AddPacketEntities 20 12
+ADDRGP4 cg+40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $538
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+40
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $543
+ADDRGP4 cg+107588
+CNSTF4 0
+ASGNF4
+ADDRGP4 $539
+JUMPV
+LABELV $543
+ADDRGP4 cg+107588
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRGP4 $539
+JUMPV
+LABELV $538
+ADDRGP4 cg+107588
+CNSTF4 0
+ASGNF4
+LABELV $539
+ADDRGP4 cg+108948
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+108948+4
+CNSTI4 360
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 2047
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1157627904
+DIVF4
+ASGNF4
+ADDRGP4 cg+108948+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+108996
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+108996+4
+CNSTI4 360
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 1023
+BANDI4
+MULI4
+CVIF4 4
+CNSTF4 1149239296
+DIVF4
+ASGNF4
+ADDRGP4 cg+108996+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg+108948
+ARGP4
+ADDRGP4 cg+108960
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+108996
+ARGP4
+ADDRGP4 cg+109008
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 cg+107636
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 cg+108104
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+ADDRGP4 cg+108104
+ARGP4
+ADDRGP4 CG_AddCEntity
+CALLV
+pop
+CNSTI4 728
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_CalcEntityLerpPositions
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $573
+JUMPV
+LABELV $570
+ADDRLP4 4
+CNSTI4 728
+CNSTI4 208
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddCEntity
+CALLV
+pop
+LABELV $571
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $573
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+LTI4 $570
+LABELV $537
+endproc CG_AddPacketEntities 20 12
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $524
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $465
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 112
+byte 1 111
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 80
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 0
+align 1
+LABELV $125
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
@@ -0,0 +1,7109 @@
+bss
+align 1
+LABELV $72
+skip 64
+export CG_PlaceString
+code
+proc CG_PlaceString 12 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $73
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 $75
+ASGNP4
+ADDRGP4 $74
+JUMPV
+LABELV $73
+ADDRLP4 4
+ADDRGP4 $76
+ASGNP4
+LABELV $74
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $77
+ADDRLP4 0
+ADDRGP4 $79
+ASGNP4
+ADDRGP4 $78
+JUMPV
+LABELV $77
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $80
+ADDRLP4 0
+ADDRGP4 $82
+ASGNP4
+ADDRGP4 $81
+JUMPV
+LABELV $80
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $83
+ADDRLP4 0
+ADDRGP4 $85
+ASGNP4
+ADDRGP4 $84
+JUMPV
+LABELV $83
+ADDRFP4 0
+INDIRI4
+CNSTI4 11
+NEI4 $86
+ADDRLP4 0
+ADDRGP4 $88
+ASGNP4
+ADDRGP4 $87
+JUMPV
+LABELV $86
+ADDRFP4 0
+INDIRI4
+CNSTI4 12
+NEI4 $89
+ADDRLP4 0
+ADDRGP4 $91
+ASGNP4
+ADDRGP4 $90
+JUMPV
+LABELV $89
+ADDRFP4 0
+INDIRI4
+CNSTI4 13
+NEI4 $92
+ADDRLP4 0
+ADDRGP4 $94
+ASGNP4
+ADDRGP4 $93
+JUMPV
+LABELV $92
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 1
+NEI4 $95
+ADDRGP4 $97
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $96
+JUMPV
+LABELV $95
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 2
+NEI4 $98
+ADDRGP4 $100
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $99
+JUMPV
+LABELV $98
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+MODI4
+CNSTI4 3
+NEI4 $101
+ADDRGP4 $103
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $102
+JUMPV
+LABELV $101
+ADDRGP4 $104
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+LABELV $102
+LABELV $99
+LABELV $96
+LABELV $93
+LABELV $90
+LABELV $87
+LABELV $84
+LABELV $81
+LABELV $78
+ADDRGP4 $72
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $105
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $72
+RETP4
+LABELV $71
+endproc CG_PlaceString 12 20
+proc CG_Obituary 136 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $109
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $107
+LABELV $109
+ADDRGP4 $110
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $107
+ADDRLP4 92
+CNSTI4 1708
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $114
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $112
+LABELV $114
+ADDRLP4 0
+CNSTI4 1022
+ASGNI4
+ADDRLP4 52
+CNSTP4 0
+ASGNP4
+ADDRGP4 $113
+JUMPV
+LABELV $112
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 112
+INDIRP4
+ASGNP4
+LABELV $113
+ADDRLP4 4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 112
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $115
+ADDRGP4 $106
+JUMPV
+LABELV $115
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $117
+ARGP4
+ADDRLP4 116
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+CNSTI4 30
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 $118
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 88
+ADDRGP4 $76
+ASGNP4
+ADDRLP4 44
+INDIRI4
+CNSTI4 14
+LTI4 $119
+ADDRLP4 44
+INDIRI4
+CNSTI4 22
+GTI4 $119
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $137-56
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $137
+address $127
+address $129
+address $131
+address $125
+address $119
+address $123
+address $121
+address $133
+address $135
+code
+LABELV $121
+ADDRLP4 40
+ADDRGP4 $122
+ASGNP4
+ADDRGP4 $120
+JUMPV
+LABELV $123
+ADDRLP4 40
+ADDRGP4 $124
+ASGNP4
+ADDRGP4 $120
+JUMPV
+LABELV $125
+ADDRLP4 40
+ADDRGP4 $126
+ASGNP4
+ADDRGP4 $120
+JUMPV
+LABELV $127
+ADDRLP4 40
+ADDRGP4 $128
+ASGNP4
+ADDRGP4 $120
+JUMPV
+LABELV $129
+ADDRLP4 40
+ADDRGP4 $130
+ASGNP4
+ADDRGP4 $120
+JUMPV
+LABELV $131
+ADDRLP4 40
+ADDRGP4 $132
+ASGNP4
+ADDRGP4 $120
+JUMPV
+LABELV $133
+ADDRLP4 40
+ADDRGP4 $134
+ASGNP4
+ADDRGP4 $120
+JUMPV
+LABELV $135
+ADDRLP4 40
+ADDRGP4 $136
+ASGNP4
+ADDRGP4 $120
+JUMPV
+LABELV $119
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+LABELV $120
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $139
+ADDRLP4 96
+ADDRLP4 92
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 128
+CNSTI4 5
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 128
+INDIRI4
+EQI4 $143
+ADDRLP4 44
+INDIRI4
+CNSTI4 7
+EQI4 $151
+ADDRLP4 44
+INDIRI4
+CNSTI4 9
+EQI4 $159
+ADDRLP4 44
+INDIRI4
+ADDRLP4 128
+INDIRI4
+LTI4 $141
+LABELV $176
+ADDRLP4 44
+INDIRI4
+CNSTI4 13
+EQI4 $167
+ADDRGP4 $141
+JUMPV
+LABELV $143
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+NEI4 $144
+ADDRLP4 40
+ADDRGP4 $146
+ASGNP4
+ADDRGP4 $142
+JUMPV
+LABELV $144
+ADDRLP4 96
+INDIRI4
+CNSTI4 2
+NEI4 $147
+ADDRLP4 40
+ADDRGP4 $149
+ASGNP4
+ADDRGP4 $142
+JUMPV
+LABELV $147
+ADDRLP4 40
+ADDRGP4 $150
+ASGNP4
+ADDRGP4 $142
+JUMPV
+LABELV $151
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+NEI4 $152
+ADDRLP4 40
+ADDRGP4 $154
+ASGNP4
+ADDRGP4 $142
+JUMPV
+LABELV $152
+ADDRLP4 96
+INDIRI4
+CNSTI4 2
+NEI4 $155
+ADDRLP4 40
+ADDRGP4 $157
+ASGNP4
+ADDRGP4 $142
+JUMPV
+LABELV $155
+ADDRLP4 40
+ADDRGP4 $158
+ASGNP4
+ADDRGP4 $142
+JUMPV
+LABELV $159
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+NEI4 $160
+ADDRLP4 40
+ADDRGP4 $162
+ASGNP4
+ADDRGP4 $142
+JUMPV
+LABELV $160
+ADDRLP4 96
+INDIRI4
+CNSTI4 2
+NEI4 $163
+ADDRLP4 40
+ADDRGP4 $165
+ASGNP4
+ADDRGP4 $142
+JUMPV
+LABELV $163
+ADDRLP4 40
+ADDRGP4 $166
+ASGNP4
+ADDRGP4 $142
+JUMPV
+LABELV $167
+ADDRLP4 40
+ADDRGP4 $168
+ASGNP4
+ADDRGP4 $142
+JUMPV
+LABELV $141
+ADDRLP4 96
+INDIRI4
+CNSTI4 1
+NEI4 $169
+ADDRLP4 40
+ADDRGP4 $171
+ASGNP4
+ADDRGP4 $142
+JUMPV
+LABELV $169
+ADDRLP4 96
+INDIRI4
+CNSTI4 2
+NEI4 $172
+ADDRLP4 40
+ADDRGP4 $174
+ASGNP4
+ADDRGP4 $142
+JUMPV
+LABELV $172
+ADDRLP4 40
+ADDRGP4 $175
+ASGNP4
+LABELV $142
+LABELV $139
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $177
+ADDRGP4 $179
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $106
+JUMPV
+LABELV $177
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $180
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+GEI4 $183
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $186
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 124
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRGP4 $184
+JUMPV
+LABELV $183
+ADDRGP4 $189
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 128
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 124
+ADDRLP4 128
+INDIRP4
+ASGNP4
+LABELV $184
+ADDRLP4 124
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $180
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $190
+ADDRLP4 0
+CNSTI4 1022
+ASGNI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 $192
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $190
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRGP4 $117
+ARGP4
+ADDRLP4 124
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+CNSTI4 30
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRGP4 $118
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $193
+ADDRGP4 cg+114332
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $193
+LABELV $191
+ADDRLP4 0
+INDIRI4
+CNSTI4 1022
+EQI4 $198
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+LTI4 $200
+ADDRLP4 44
+INDIRI4
+CNSTI4 23
+GTI4 $200
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $235-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $235
+address $208
+address $204
+address $206
+address $210
+address $213
+address $216
+address $218
+address $220
+address $223
+address $224
+address $226
+address $228
+address $228
+address $200
+address $200
+address $200
+address $200
+address $231
+address $200
+address $200
+address $200
+address $200
+address $202
+code
+LABELV $202
+ADDRLP4 40
+ADDRGP4 $203
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $204
+ADDRLP4 40
+ADDRGP4 $205
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $206
+ADDRLP4 40
+ADDRGP4 $207
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $208
+ADDRLP4 40
+ADDRGP4 $209
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $210
+ADDRLP4 40
+ADDRGP4 $211
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $212
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $213
+ADDRLP4 40
+ADDRGP4 $214
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $215
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $216
+ADDRLP4 40
+ADDRGP4 $211
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $217
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $218
+ADDRLP4 40
+ADDRGP4 $219
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $217
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $220
+ADDRLP4 40
+ADDRGP4 $221
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $222
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $223
+ADDRLP4 40
+ADDRGP4 $221
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $222
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $224
+ADDRLP4 40
+ADDRGP4 $225
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $226
+ADDRLP4 40
+ADDRGP4 $227
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $228
+ADDRLP4 40
+ADDRGP4 $229
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $230
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $231
+ADDRLP4 40
+ADDRGP4 $232
+ASGNP4
+ADDRLP4 88
+ADDRGP4 $233
+ASGNP4
+ADDRGP4 $201
+JUMPV
+LABELV $200
+ADDRLP4 40
+ADDRGP4 $234
+ASGNP4
+LABELV $201
+ADDRLP4 40
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $237
+ADDRGP4 $239
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $106
+JUMPV
+LABELV $237
+LABELV $198
+ADDRGP4 $240
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $106
+endproc CG_Obituary 136 20
+proc CG_UseItem 32 16
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+CNSTI4 24
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $244
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LEI4 $242
+LABELV $244
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $242
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $245
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $248
+ADDRGP4 $250
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $249
+JUMPV
+LABELV $248
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 BG_FindItemForHoldable
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRGP4 $251
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $249
+LABELV $245
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $254
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $253
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $258
+ADDRGP4 $252
+JUMPV
+LABELV $252
+LABELV $254
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+152340+540
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $253
+JUMPV
+LABELV $258
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LTI4 $259
+ADDRLP4 28
+INDIRI4
+CNSTI4 64
+GEI4 $259
+ADDRLP4 16
+CNSTI4 1708
+ADDRLP4 12
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $259
+CNSTP4 0
+ARGP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+152340+860
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $253
+LABELV $241
+endproc CG_UseItem 32 16
+proc CG_ItemPickup 0 0
+ADDRGP4 cg+124664
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+124668
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+124672
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $271
+ADDRGP4 cg_autoswitch+12
+INDIRI4
+CNSTI4 0
+EQI4 $274
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $274
+ADDRGP4 cg+124676
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+108944
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $274
+LABELV $271
+LABELV $265
+endproc CG_ItemPickup 0 0
+export CG_PainEvent
+proc CG_PainEvent 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 500
+GEI4 $283
+ADDRGP4 $282
+JUMPV
+LABELV $283
+ADDRFP4 4
+INDIRI4
+CNSTI4 25
+GEI4 $286
+ADDRLP4 0
+ADDRGP4 $288
+ASGNP4
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRFP4 4
+INDIRI4
+CNSTI4 50
+GEI4 $289
+ADDRLP4 0
+ADDRGP4 $291
+ASGNP4
+ADDRGP4 $290
+JUMPV
+LABELV $289
+ADDRFP4 4
+INDIRI4
+CNSTI4 75
+GEI4 $292
+ADDRLP4 0
+ADDRGP4 $294
+ASGNP4
+ADDRGP4 $293
+JUMPV
+LABELV $292
+ADDRLP4 0
+ADDRGP4 $295
+ASGNP4
+LABELV $293
+LABELV $290
+LABELV $287
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+LABELV $282
+endproc CG_PainEvent 12 16
+lit
+align 4
+LABELV $443
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export CG_EntityEvent
+code
+proc CG_EntityEvent 108 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $298
+ADDRGP4 $301
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $298
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $302
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $297
+ADDRGP4 $307
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $297
+JUMPV
+LABELV $302
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $310
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $308
+LABELV $310
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $308
+ADDRLP4 12
+CNSTI4 1708
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $312
+ADDRLP4 8
+INDIRI4
+CNSTI4 76
+GTI4 $312
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $923-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $923
+address $314
+address $324
+address $335
+address $346
+address $357
+address $408
+address $408
+address $408
+address $408
+address $368
+address $382
+address $394
+address $438
+address $450
+address $461
+address $468
+address $475
+address $482
+address $488
+address $506
+address $520
+address $528
+address $535
+address $540
+address $545
+address $550
+address $555
+address $560
+address $565
+address $570
+address $575
+address $580
+address $585
+address $590
+address $595
+address $600
+address $605
+address $610
+address $312
+address $636
+address $629
+address $615
+address $622
+address $644
+address $697
+address $706
+address $717
+address $687
+address $682
+address $660
+address $665
+address $670
+address $675
+address $692
+address $312
+address $841
+address $849
+address $849
+address $849
+address $855
+address $860
+address $873
+address $886
+address $899
+address $655
+address $312
+address $312
+address $312
+address $312
+address $312
+address $312
+address $312
+address $312
+address $913
+address $908
+address $455
+code
+LABELV $314
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $315
+ADDRGP4 $318
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $315
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $313
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 cgs+152340+548
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $324
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $325
+ADDRGP4 $328
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $325
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $313
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+548+80
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $335
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $336
+ADDRGP4 $339
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $336
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $313
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+548+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $346
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $347
+ADDRGP4 $350
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $347
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $313
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+548+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $357
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $358
+ADDRGP4 $361
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $358
+ADDRGP4 cg_footsteps+12
+INDIRI4
+CNSTI4 0
+EQI4 $313
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+548+96
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $368
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $369
+ADDRGP4 $372
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $369
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+152340+732
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $313
+ADDRGP4 cg+108936
+CNSTF4 3238002688
+ASGNF4
+ADDRGP4 cg+108940
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $313
+JUMPV
+LABELV $382
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $383
+ADDRGP4 $386
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $383
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $295
+ARGP4
+ADDRLP4 40
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $313
+ADDRGP4 cg+108936
+CNSTF4 3246391296
+ASGNF4
+ADDRGP4 cg+108940
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $313
+JUMPV
+LABELV $394
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $395
+ADDRGP4 $398
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $395
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $399
+ARGP4
+ADDRLP4 44
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $313
+ADDRGP4 cg+108936
+CNSTF4 3250585600
+ASGNF4
+ADDRGP4 cg+108940
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $313
+JUMPV
+LABELV $408
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $409
+ADDRGP4 $412
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $409
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+EQI4 $413
+ADDRGP4 $313
+JUMPV
+LABELV $413
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+8
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $425
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+ADDRLP4 60
+INDIRI4
+NEI4 $425
+ADDRGP4 cg_nopredict+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $425
+ADDRGP4 cg_synchronousClients+12
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $417
+LABELV $425
+ADDRGP4 $313
+JUMPV
+LABELV $417
+ADDRLP4 48
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+108924
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 200
+GEI4 $428
+ADDRLP4 52
+ADDRGP4 cg+108920
+INDIRF4
+CNSTI4 200
+ADDRLP4 48
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1128792064
+DIVF4
+ASGNF4
+ADDRGP4 $429
+JUMPV
+LABELV $428
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+LABELV $429
+ADDRLP4 56
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+CNSTI4 24
+SUBI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRGP4 cg+108920
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 cg+108920
+INDIRF4
+CNSTF4 1107296256
+LEF4 $432
+ADDRGP4 cg+108920
+CNSTF4 1107296256
+ASGNF4
+LABELV $432
+ADDRGP4 cg+108924
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $313
+JUMPV
+LABELV $438
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $439
+ADDRGP4 $442
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $439
+ADDRLP4 48
+ADDRGP4 $443
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRLP4 48
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRLP4 64
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+ADDRLP4 64
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1148846080
+ARGF4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+152340+276
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 cgs+152340+740
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $449
+ARGP4
+ADDRLP4 48
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $450
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $451
+ADDRGP4 $454
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $451
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $449
+ARGP4
+ADDRLP4 52
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $455
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $456
+ADDRGP4 $459
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $456
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $460
+ARGP4
+ADDRLP4 56
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $461
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $462
+ADDRGP4 $465
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $462
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+152340+844
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $468
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $469
+ADDRGP4 $472
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $469
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+152340+848
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $475
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $476
+ADDRGP4 $479
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $476
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+152340+852
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $482
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $483
+ADDRGP4 $486
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $483
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $487
+ARGP4
+ADDRLP4 60
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $488
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRGP4 $492
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $489
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+LTI4 $495
+ADDRLP4 72
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $493
+LABELV $495
+ADDRGP4 $313
+JUMPV
+LABELV $493
+ADDRLP4 68
+CNSTI4 52
+ADDRLP4 64
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 68
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 5
+EQI4 $498
+ADDRLP4 76
+INDIRI4
+CNSTI4 8
+NEI4 $496
+LABELV $498
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+152340+996
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $497
+JUMPV
+LABELV $496
+ADDRLP4 68
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $501
+ADDRGP4 $502
+JUMPV
+LABELV $501
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $502
+LABELV $497
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $313
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 CG_ItemPickup
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $506
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $507
+ADDRGP4 $510
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $507
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+LTI4 $513
+ADDRLP4 72
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $511
+LABELV $513
+ADDRGP4 $313
+JUMPV
+LABELV $511
+ADDRLP4 68
+CNSTI4 52
+ADDRLP4 64
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $514
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $514
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $313
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 CG_ItemPickup
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $520
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $521
+ADDRGP4 $524
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $521
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $313
+ADDRGP4 CG_OutOfAmmoChange
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $528
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $529
+ADDRGP4 $532
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $529
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+152340+536
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $535
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $536
+ADDRGP4 $539
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $536
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FireWeapon
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $540
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $541
+ADDRGP4 $544
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $541
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $545
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $546
+ADDRGP4 $549
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $546
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $550
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $551
+ADDRGP4 $554
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $551
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $555
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $556
+ADDRGP4 $559
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $556
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $560
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $561
+ADDRGP4 $564
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $561
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $565
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $566
+ADDRGP4 $569
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $566
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $570
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $571
+ADDRGP4 $574
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $571
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $575
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $576
+ADDRGP4 $579
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $576
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $580
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $581
+ADDRGP4 $584
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $581
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $585
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $586
+ADDRGP4 $589
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $586
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $590
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $591
+ADDRGP4 $594
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $591
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $595
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $596
+ADDRGP4 $599
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $596
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $600
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $601
+ADDRGP4 $604
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $601
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $605
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $606
+ADDRGP4 $609
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $606
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $610
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $611
+ADDRGP4 $614
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $611
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_UseItem
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $615
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $616
+ADDRGP4 $619
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $616
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+152340+712
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SpawnEffect
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $622
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $623
+ADDRGP4 $626
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $623
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+152340+716
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_SpawnEffect
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $629
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $630
+ADDRGP4 $633
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $630
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+152340+724
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $636
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $637
+ADDRGP4 $640
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $637
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+152340+724
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $644
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $645
+ADDRGP4 $648
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $645
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $649
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+152340+1000
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $649
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+152340+1004
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $655
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $656
+ADDRGP4 $659
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $656
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ScorePlum
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $660
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $661
+ADDRGP4 $664
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $661
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitPlayer
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $665
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $666
+ADDRGP4 $669
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $666
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $670
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $671
+ADDRGP4 $674
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $671
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $675
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $676
+ADDRGP4 $679
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $676
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CG_RailTrail
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 255
+EQI4 $313
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $682
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $683
+ADDRGP4 $686
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $683
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 ByteToDir
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1022
+ARGI4
+ADDRGP4 CG_Bullet
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $687
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $688
+ADDRGP4 $691
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $688
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Bullet
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $692
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $693
+ADDRGP4 $696
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $693
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_ShotgunFire
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $697
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $698
+ADDRGP4 $701
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $698
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35848
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $702
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35848
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $702
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $706
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $707
+ADDRGP4 $710
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $707
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35848
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $711
+CNSTP4 0
+ARGP4
+ADDRLP4 92
+CNSTI4 184
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35848
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $711
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $717
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $718
+ADDRGP4 $721
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $718
+ADDRLP4 92
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+LTI4 $313
+ADDRLP4 92
+INDIRI4
+CNSTI4 12
+GTI4 $313
+ADDRLP4 92
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $840
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $840
+address $725
+address $735
+address $745
+address $757
+address $769
+address $789
+address $809
+address $817
+address $825
+address $828
+address $831
+address $834
+address $837
+code
+LABELV $725
+CNSTI4 1708
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $726
+ADDRGP4 cgs+152340+892
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $726
+ADDRGP4 cgs+152340+896
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $735
+CNSTI4 1708
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $736
+ADDRGP4 cgs+152340+892
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $736
+ADDRGP4 cgs+152340+896
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $745
+CNSTI4 1708
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $746
+ADDRGP4 cgs+152340+900
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $747
+JUMPV
+LABELV $746
+ADDRGP4 cgs+152340+904
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $747
+ADDRGP4 cgs+152340+920
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $757
+CNSTI4 1708
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $758
+ADDRGP4 cgs+152340+900
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $759
+JUMPV
+LABELV $758
+ADDRGP4 cgs+152340+904
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+LABELV $759
+ADDRGP4 cgs+152340+916
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $769
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 388
+ADDP4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+NEI4 $774
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+EQI4 $770
+LABELV $774
+ADDRGP4 $313
+JUMPV
+LABELV $770
+CNSTI4 1708
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $775
+ADDRGP4 cgs+152340+928
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $775
+CNSTI4 1708
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $313
+ADDRGP4 cgs+152340+936
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $789
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 384
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+NEI4 $794
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 392
+ADDP4
+INDIRI4
+ADDRLP4 104
+INDIRI4
+EQI4 $790
+LABELV $794
+ADDRGP4 $313
+JUMPV
+LABELV $790
+CNSTI4 1708
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $795
+ADDRGP4 cgs+152340+928
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $795
+CNSTI4 1708
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $313
+ADDRGP4 cgs+152340+936
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $809
+CNSTI4 1708
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $313
+ADDRGP4 cgs+152340+948
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $817
+CNSTI4 1708
+ADDRGP4 cg+4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $313
+ADDRGP4 cgs+152340+948
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $825
+ADDRGP4 cgs+152340+872
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $828
+ADDRGP4 cgs+152340+876
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $831
+ADDRGP4 cgs+152340+880
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $834
+ADDRGP4 cgs+152340+884
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $837
+ADDRGP4 cgs+152340+888
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddBufferedSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $841
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $842
+ADDRGP4 $845
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $842
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+EQI4 $313
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_PainEvent
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $849
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $850
+ADDRGP4 $853
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $850
+ADDRGP4 $854
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 57
+SUBI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 CG_CustomSound
+CALLI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $855
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $856
+ADDRGP4 $859
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $856
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Obituary
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $860
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $861
+ADDRGP4 $864
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $861
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $865
+ADDRGP4 cg+124408
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+124412
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $865
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+152340+528
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $873
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $874
+ADDRGP4 $877
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $874
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $878
+ADDRGP4 cg+124408
+CNSTI4 2
+ASGNI4
+ADDRGP4 cg+124412
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $878
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+152340+992
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $886
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $887
+ADDRGP4 $890
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $887
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $891
+ADDRGP4 cg+124408
+CNSTI4 5
+ASGNI4
+ADDRGP4 cg+124412
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $891
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+152340+988
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $899
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $900
+ADDRGP4 $903
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $900
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+NEI4 $904
+CNSTP4 0
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+ADDRGP4 cgs+152340+696
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $904
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 CG_GibPlayer
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $908
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $909
+ADDRGP4 $912
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $909
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StopLoopingSound
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $313
+JUMPV
+LABELV $913
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $914
+ADDRGP4 $917
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $914
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Beam
+CALLV
+pop
+ADDRGP4 $313
+JUMPV
+LABELV $312
+ADDRGP4 cg_debugEvents+12
+INDIRI4
+CNSTI4 0
+EQI4 $918
+ADDRGP4 $921
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $918
+ADDRGP4 $922
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $313
+LABELV $297
+endproc CG_EntityEvent 108 48
+export CG_CheckEvents
+proc CG_CheckEvents 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+LEI4 $926
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $928
+ADDRGP4 $925
+JUMPV
+LABELV $928
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $930
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $930
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+SUBI4
+ASGNI4
+ADDRGP4 $927
+JUMPV
+LABELV $926
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+INDIRI4
+NEI4 $932
+ADDRGP4 $925
+JUMPV
+LABELV $932
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+CNSTI4 0
+NEI4 $934
+ADDRGP4 $925
+JUMPV
+LABELV $934
+LABELV $927
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_SetEntitySoundPosition
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 CG_EntityEvent
+CALLV
+pop
+LABELV $925
+endproc CG_CheckEvents 8 12
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $922
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $921
+byte 1 85
+byte 1 78
+byte 1 75
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $917
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 66
+byte 1 85
+byte 1 71
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $912
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 79
+byte 1 80
+byte 1 76
+byte 1 79
+byte 1 79
+byte 1 80
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $903
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 73
+byte 1 66
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $890
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $877
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 66
+byte 1 65
+byte 1 84
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 85
+byte 1 73
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $864
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 87
+byte 1 69
+byte 1 82
+byte 1 85
+byte 1 80
+byte 1 95
+byte 1 81
+byte 1 85
+byte 1 65
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $859
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 79
+byte 1 66
+byte 1 73
+byte 1 84
+byte 1 85
+byte 1 65
+byte 1 82
+byte 1 89
+byte 1 10
+byte 1 0
+align 1
+LABELV $854
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $853
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 68
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 72
+byte 1 120
+byte 1 10
+byte 1 0
+align 1
+LABELV $845
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $721
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $710
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $701
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $696
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 84
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $691
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 70
+byte 1 76
+byte 1 69
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $686
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 66
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $679
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 84
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $674
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $669
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 10
+byte 1 0
+align 1
+LABELV $664
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 95
+byte 1 72
+byte 1 73
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $659
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 67
+byte 1 79
+byte 1 82
+byte 1 69
+byte 1 80
+byte 1 76
+byte 1 85
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $648
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 95
+byte 1 66
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 67
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $640
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 87
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $633
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $626
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 79
+byte 1 85
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $619
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $614
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 52
+byte 1 10
+byte 1 0
+align 1
+LABELV $609
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $604
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $599
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $594
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $589
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 57
+byte 1 10
+byte 1 0
+align 1
+LABELV $584
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 56
+byte 1 10
+byte 1 0
+align 1
+LABELV $579
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 55
+byte 1 10
+byte 1 0
+align 1
+LABELV $574
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 54
+byte 1 10
+byte 1 0
+align 1
+LABELV $569
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 53
+byte 1 10
+byte 1 0
+align 1
+LABELV $564
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 52
+byte 1 10
+byte 1 0
+align 1
+LABELV $559
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $554
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 50
+byte 1 10
+byte 1 0
+align 1
+LABELV $549
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $544
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 85
+byte 1 83
+byte 1 69
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $539
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 73
+byte 1 82
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $532
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 67
+byte 1 72
+byte 1 65
+byte 1 78
+byte 1 71
+byte 1 69
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 10
+byte 1 0
+align 1
+LABELV $524
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 78
+byte 1 79
+byte 1 65
+byte 1 77
+byte 1 77
+byte 1 79
+byte 1 10
+byte 1 0
+align 1
+LABELV $510
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $492
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 95
+byte 1 80
+byte 1 73
+byte 1 67
+byte 1 75
+byte 1 85
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $487
+byte 1 42
+byte 1 103
+byte 1 97
+byte 1 115
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $486
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 67
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $479
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 69
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $472
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 76
+byte 1 69
+byte 1 65
+byte 1 86
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $465
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 84
+byte 1 79
+byte 1 85
+byte 1 67
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $460
+byte 1 42
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $459
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $454
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $449
+byte 1 42
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $442
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 74
+byte 1 85
+byte 1 77
+byte 1 80
+byte 1 95
+byte 1 80
+byte 1 65
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $412
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $399
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $398
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 82
+byte 1 10
+byte 1 0
+align 1
+LABELV $386
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 68
+byte 1 73
+byte 1 85
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $372
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $361
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 83
+byte 1 87
+byte 1 73
+byte 1 77
+byte 1 10
+byte 1 0
+align 1
+LABELV $350
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 87
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $339
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 10
+byte 1 0
+align 1
+LABELV $328
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 95
+byte 1 77
+byte 1 69
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 10
+byte 1 0
+align 1
+LABELV $318
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 70
+byte 1 79
+byte 1 79
+byte 1 84
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 80
+byte 1 10
+byte 1 0
+align 1
+LABELV $307
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 69
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 10
+byte 1 0
+align 1
+LABELV $301
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 0
+align 1
+LABELV $295
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $294
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 55
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $291
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 53
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $288
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $251
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $250
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $240
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $239
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $234
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $233
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $232
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $230
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $229
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $227
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $225
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $222
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $221
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $219
+byte 1 97
+byte 1 108
+byte 1 109
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 100
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $217
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $215
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $214
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $212
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $211
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $209
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $207
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $205
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 117
+byte 1 109
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $203
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 0
+align 1
+LABELV $192
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $189
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $186
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $179
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $175
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $174
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $171
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $168
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $166
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $165
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $162
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 0
+align 1
+LABELV $158
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $157
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $154
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 102
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $150
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $149
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $146
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $136
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $134
+byte 1 115
+byte 1 97
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $132
+byte 1 100
+byte 1 111
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 0
+align 1
+LABELV $130
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $128
+byte 1 115
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $126
+byte 1 119
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 113
+byte 1 117
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $124
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $122
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $118
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $117
+byte 1 110
+byte 1 0
+align 1
+LABELV $110
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 79
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $105
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $104
+byte 1 37
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $103
+byte 1 37
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $100
+byte 1 37
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $97
+byte 1 37
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $94
+byte 1 49
+byte 1 51
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $91
+byte 1 49
+byte 1 50
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $88
+byte 1 49
+byte 1 49
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $85
+byte 1 94
+byte 1 51
+byte 1 51
+byte 1 114
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $82
+byte 1 94
+byte 1 49
+byte 1 50
+byte 1 110
+byte 1 100
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $79
+byte 1 94
+byte 1 52
+byte 1 49
+byte 1 115
+byte 1 116
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $76
+byte 1 0
+align 1
+LABELV $75
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 0
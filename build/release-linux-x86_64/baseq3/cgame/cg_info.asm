@@ -0,0 +1,2193 @@
+code
+proc CG_DrawLoadingIcons 20 20
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $75
+JUMPV
+LABELV $72
+ADDRLP4 8
+CNSTI4 78
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 284
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 loadingPlayerIcons
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $73
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $75
+ADDRLP4 0
+INDIRI4
+ADDRGP4 loadingPlayerIconCount
+INDIRI4
+LTI4 $72
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $79
+JUMPV
+LABELV $76
+ADDRLP4 4
+CNSTI4 360
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+LTI4 $80
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 40
+ADDI4
+ASGNI4
+LABELV $80
+ADDRLP4 8
+CNSTI4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+MODI4
+MULI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 loadingItemIcons
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $77
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $79
+ADDRLP4 0
+INDIRI4
+ADDRGP4 loadingItemIconCount
+INDIRI4
+LTI4 $76
+LABELV $71
+endproc CG_DrawLoadingIcons 20 20
+export CG_LoadingString
+proc CG_LoadingString 0 12
+ADDRGP4 cg+109436
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 trap_UpdateScreen
+CALLV
+pop
+LABELV $82
+endproc CG_LoadingString 0 12
+export CG_LoadingItem
+proc CG_LoadingItem 16 4
+ADDRLP4 0
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $86
+ADDRGP4 loadingItemIconCount
+INDIRI4
+CNSTI4 26
+GEI4 $86
+ADDRLP4 8
+ADDRGP4 loadingItemIconCount
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 loadingItemIcons
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $86
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+LABELV $85
+endproc CG_LoadingItem 16 4
+export CG_LoadingClient
+proc CG_LoadingClient 220 20
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 200
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 200
+INDIRP4
+ASGNP4
+ADDRGP4 loadingPlayerIconCount
+INDIRI4
+CNSTI4 16
+GEI4 $89
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 $91
+ARGP4
+ADDRLP4 204
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 72
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 208
+ADDRGP4 Q_strrchr
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 208
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $92
+ADDRLP4 212
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 212
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 212
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $93
+JUMPV
+LABELV $92
+ADDRLP4 68
+ADDRGP4 $94
+ASGNP4
+LABELV $93
+ADDRLP4 136
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $95
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 136
+ARGP4
+ADDRLP4 212
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 loadingPlayerIconCount
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 loadingPlayerIcons
+ADDP4
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 loadingPlayerIconCount
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 loadingPlayerIcons
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $96
+ADDRLP4 136
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $98
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 136
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 loadingPlayerIconCount
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 loadingPlayerIcons
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+LABELV $96
+ADDRGP4 loadingPlayerIconCount
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 loadingPlayerIcons
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $99
+ADDRLP4 136
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $95
+ARGP4
+ADDRGP4 $101
+ARGP4
+ADDRGP4 $94
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 136
+ARGP4
+ADDRLP4 216
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 loadingPlayerIconCount
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 loadingPlayerIcons
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+LABELV $99
+ADDRGP4 loadingPlayerIconCount
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 loadingPlayerIcons
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $102
+ADDRLP4 216
+ADDRGP4 loadingPlayerIconCount
+ASGNP4
+ADDRLP4 216
+INDIRP4
+ADDRLP4 216
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $102
+LABELV $89
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRGP4 $104
+ARGP4
+ADDRLP4 204
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 204
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 2
+NEI4 $105
+ADDRGP4 $108
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 208
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $105
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+LABELV $88
+endproc CG_LoadingClient 220 20
+export CG_DrawInformation
+proc CG_DrawInformation 1124 36
+CNSTI4 0
+ARGI4
+ADDRLP4 1052
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 1056
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1044
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $110
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1060
+INDIRP4
+ASGNP4
+ADDRGP4 $111
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $112
+ADDRGP4 $114
+ARGP4
+ADDRLP4 1072
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1072
+INDIRI4
+ASGNI4
+LABELV $112
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 1072
+CNSTF4 0
+ASGNF4
+ADDRLP4 1072
+INDIRF4
+ARGF4
+ADDRLP4 1072
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $115
+ARGP4
+ADDRLP4 1076
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 1048
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRLP4 1080
+CNSTF4 0
+ASGNF4
+ADDRLP4 1080
+INDIRF4
+ARGF4
+ADDRLP4 1080
+INDIRF4
+ARGF4
+ADDRGP4 cgs+20100+11304
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 cgs+20100+11308
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1080
+INDIRF4
+ARGF4
+ADDRLP4 1080
+INDIRF4
+ARGF4
+CNSTF4 1075838976
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 1048
+INDIRI4
+ARGI4
+ADDRGP4 trap_R_DrawStretchPic
+CALLV
+pop
+ADDRGP4 CG_DrawLoadingIcons
+CALLV
+pop
+ADDRGP4 cg+109436
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $120
+ADDRGP4 $123
+ARGP4
+ADDRGP4 cg+109436
+ARGP4
+ADDRLP4 1084
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 320
+ARGI4
+CNSTI4 96
+ARGI4
+ADDRLP4 1084
+INDIRP4
+ARGP4
+CNSTI4 2065
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $121
+JUMPV
+LABELV $120
+CNSTI4 320
+ARGI4
+CNSTI4 96
+ARGI4
+ADDRGP4 $125
+ARGP4
+CNSTI4 2065
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $121
+ADDRLP4 4
+CNSTI4 148
+ASGNI4
+ADDRGP4 $126
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 1084
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1084
+INDIRI4
+CNSTI4 0
+NEI4 $127
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $129
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 1088
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+CNSTI4 320
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 2065
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 27
+ADDI4
+ASGNI4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 $130
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1092
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 49
+NEI4 $131
+CNSTI4 320
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $133
+ARGP4
+CNSTI4 2065
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 27
+ADDI4
+ASGNI4
+LABELV $131
+CNSTI4 4
+ARGI4
+ADDRLP4 1096
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1096
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $134
+CNSTI4 320
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 2065
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 27
+ADDI4
+ASGNI4
+LABELV $134
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+LABELV $127
+CNSTI4 3
+ARGI4
+ADDRLP4 1088
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1088
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $136
+CNSTI4 320
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 2065
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 27
+ADDI4
+ASGNI4
+LABELV $136
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 $138
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1092
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 49
+NEI4 $139
+CNSTI4 320
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $141
+ARGP4
+CNSTI4 2065
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 27
+ADDI4
+ASGNI4
+LABELV $139
+ADDRLP4 1096
+ADDRGP4 cgs+31456
+INDIRI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+LTI4 $142
+ADDRLP4 1096
+INDIRI4
+CNSTI4 4
+GTI4 $142
+ADDRLP4 1096
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $157
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $157
+address $146
+address $150
+address $148
+address $152
+address $154
+code
+LABELV $146
+ADDRLP4 0
+ADDRGP4 $147
+ASGNP4
+ADDRGP4 $143
+JUMPV
+LABELV $148
+ADDRLP4 0
+ADDRGP4 $149
+ASGNP4
+ADDRGP4 $143
+JUMPV
+LABELV $150
+ADDRLP4 0
+ADDRGP4 $151
+ASGNP4
+ADDRGP4 $143
+JUMPV
+LABELV $152
+ADDRLP4 0
+ADDRGP4 $153
+ASGNP4
+ADDRGP4 $143
+JUMPV
+LABELV $154
+ADDRLP4 0
+ADDRGP4 $155
+ASGNP4
+ADDRGP4 $143
+JUMPV
+LABELV $142
+ADDRLP4 0
+ADDRGP4 $156
+ASGNP4
+LABELV $143
+CNSTI4 320
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 2065
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 27
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1104
+INDIRP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $159
+ADDRGP4 $161
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 320
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1112
+INDIRP4
+ARGP4
+CNSTI4 2065
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 27
+ADDI4
+ASGNI4
+LABELV $159
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+GEI4 $162
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $165
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1112
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1116
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $166
+ADDRGP4 $168
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1120
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 320
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1120
+INDIRP4
+ARGP4
+CNSTI4 2065
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 27
+ADDI4
+ASGNI4
+LABELV $166
+LABELV $162
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+LTI4 $169
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 1112
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1112
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1116
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $173
+ADDRGP4 $175
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1120
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 320
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1120
+INDIRP4
+ARGP4
+CNSTI4 2065
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 27
+ADDI4
+ASGNI4
+LABELV $173
+LABELV $169
+LABELV $109
+endproc CG_DrawInformation 1124 36
+bss
+align 4
+LABELV loadingItemIcons
+skip 104
+align 4
+LABELV loadingPlayerIcons
+skip 64
+align 4
+LABELV loadingItemIconCount
+skip 4
+align 4
+LABELV loadingPlayerIconCount
+skip 4
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $175
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $172
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $168
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $165
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $161
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $158
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $156
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $155
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $153
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $151
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $149
+byte 1 83
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $147
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $141
+byte 1 67
+byte 1 72
+byte 1 69
+byte 1 65
+byte 1 84
+byte 1 83
+byte 1 32
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 32
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 68
+byte 1 0
+align 1
+LABELV $138
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $133
+byte 1 80
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $130
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $129
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $126
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $125
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $123
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $115
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $114
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $111
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $108
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $104
+byte 1 110
+byte 1 0
+align 1
+LABELV $101
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $98
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $94
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $91
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
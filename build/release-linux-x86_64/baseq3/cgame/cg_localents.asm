@@ -0,0 +1,3558 @@
+export CG_InitLocalEntities
+code
+proc CG_InitLocalEntities 12 12
+ADDRGP4 cg_localEntities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 149504
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_activeLocalEntities+4
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_freeLocalEntities
+ADDRGP4 cg_localEntities
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $73
+ADDRLP4 8
+CNSTI4 292
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_localEntities+4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_localEntities+292
+ADDP4
+ASGNP4
+LABELV $74
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 511
+LTI4 $73
+LABELV $71
+endproc CG_InitLocalEntities 12 12
+export CG_FreeLocalEntity
+proc CG_FreeLocalEntity 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $80
+ADDRGP4 $82
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $80
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_freeLocalEntities
+INDIRP4
+ASGNP4
+ADDRGP4 cg_freeLocalEntities
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $79
+endproc CG_FreeLocalEntity 12 4
+export CG_AllocLocalEntity
+proc CG_AllocLocalEntity 12 12
+ADDRGP4 cg_freeLocalEntities
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $84
+ADDRGP4 cg_activeLocalEntities
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+LABELV $84
+ADDRLP4 4
+ADDRGP4 cg_freeLocalEntities
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 292
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_activeLocalEntities+4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 cg_activeLocalEntities
+ASGNP4
+ADDRGP4 cg_activeLocalEntities+4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_activeLocalEntities+4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $83
+endproc CG_AllocLocalEntity 12 12
+export CG_BloodTrail
+proc CG_BloodTrail 44 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 150
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+107600
+INDIRI4
+SUBI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 20
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRGP4 $96
+JUMPV
+LABELV $93
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+CNSTF4 1157234688
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 cgs+152340+296
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 40
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1109393408
+ASGNF4
+LABELV $94
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $96
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $93
+LABELV $89
+endproc CG_BloodTrail 44 48
+export CG_FragmentBounceMark
+proc CG_FragmentBounceMark 20 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $100
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+372
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 8
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $100
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $104
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 15
+BANDI4
+CNSTI4 8
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+380
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 8
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+LABELV $104
+LABELV $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $99
+endproc CG_FragmentBounceMark 20 44
+export CG_FragmentBounceSound
+proc CG_FragmentBounceSound 16 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $109
+ADDRLP4 0
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $110
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $113
+ADDRLP4 8
+ADDRGP4 cgs+152340+700
+INDIRI4
+ASGNI4
+ADDRGP4 $114
+JUMPV
+LABELV $113
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $117
+ADDRLP4 8
+ADDRGP4 cgs+152340+704
+INDIRI4
+ASGNI4
+ADDRGP4 $118
+JUMPV
+LABELV $117
+ADDRLP4 8
+ADDRGP4 cgs+152340+708
+INDIRI4
+ASGNI4
+LABELV $118
+LABELV $114
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+ADDRGP4 $110
+JUMPV
+LABELV $109
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $123
+LABELV $123
+LABELV $110
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $108
+endproc CG_FragmentBounceSound 16 16
+export CG_ReflectVelocity
+proc CG_ReflectVelocity 64 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+107600
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRGP4 cg+107600
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BG_EvaluateTrajectoryDelta
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 12
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $138
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $134
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 1109393408
+LTF4 $138
+ADDRLP4 60
+INDIRF4
+ADDRGP4 cg+107600
+INDIRI4
+NEGI4
+CVIF4 4
+ADDRLP4 60
+INDIRF4
+MULF4
+GEF4 $134
+LABELV $138
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $134
+LABELV $135
+LABELV $125
+endproc CG_ReflectVelocity 64 12
+export CG_AddFragment
+proc CG_AddFragment 88 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $140
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 1000
+GEI4 $143
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+CNSTF4 1098907648
+CNSTF4 1065353216
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 228
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRGP4 $139
+JUMPV
+LABELV $143
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $139
+JUMPV
+LABELV $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ARGP4
+ADDRLP4 68
+CNSTP4 0
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $146
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+ADDRLP4 56
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $149
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 72
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $149
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $139
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_BloodTrail
+CALLV
+pop
+ADDRGP4 $139
+JUMPV
+LABELV $146
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+EQU4 $154
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $139
+JUMPV
+LABELV $154
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FragmentBounceMark
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_FragmentBounceSound
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_ReflectVelocity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $139
+endproc CG_AddFragment 88 28
+export CG_AddFadeRGB
+proc CG_AddFadeRGB 60 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LTF4 $160
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $161
+JUMPV
+LABELV $160
+ADDRLP4 8
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $161
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 8
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+LTF4 $163
+ADDRLP4 24
+ADDRLP4 28
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $164
+JUMPV
+LABELV $163
+ADDRLP4 24
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $164
+ADDRLP4 0
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+LTF4 $166
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $167
+JUMPV
+LABELV $166
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $167
+ADDRLP4 0
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 36
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRF4
+LTF4 $169
+ADDRLP4 48
+ADDRLP4 52
+INDIRF4
+ADDRLP4 56
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $170
+JUMPV
+LABELV $169
+ADDRLP4 48
+ADDRLP4 52
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $170
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 48
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $157
+endproc CG_AddFadeRGB 60 4
+proc CG_AddMoveScaleFade 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LEI4 $172
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GEI4 $172
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTF4 1065353216
+ADDRLP4 36
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 36
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $173
+JUMPV
+LABELV $172
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $173
+ADDRLP4 36
+CNSTF4 1132396544
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+LTF4 $178
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $179
+JUMPV
+LABELV $178
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $179
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 32
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $180
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+LABELV $180
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+109044+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+109044+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+109044+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+GEF4 $193
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $171
+JUMPV
+LABELV $193
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $171
+endproc CG_AddMoveScaleFade 52 12
+proc CG_AddScaleFade 48 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $198
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $199
+JUMPV
+LABELV $198
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $199
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+109044+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+109044+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+109044+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+GEF4 $210
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $195
+JUMPV
+LABELV $210
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $195
+endproc CG_AddScaleFade 48 4
+proc CG_AddFallScaleFade 52 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $215
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $216
+JUMPV
+LABELV $215
+ADDRLP4 24
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $216
+ADDRLP4 0
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 4
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 cg+109044+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDRGP4 cg+109044+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDRGP4 cg+109044+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+GEF4 $227
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $212
+JUMPV
+LABELV $227
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $212
+endproc CG_AddFallScaleFade 52 4
+proc CG_AddExplosion 20 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $230
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+GEF4 $233
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $234
+JUMPV
+LABELV $233
+ADDRLP4 4
+CNSTF4 1065353216
+CNSTF4 1073741824
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $234
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $230
+LABELV $229
+endproc CG_AddExplosion 20 20
+proc CG_AddSpriteExplosion 180 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 140
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 148
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRLP4 148
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1065353216
+LEF4 $237
+ADDRLP4 140
+CNSTF4 1065353216
+ASGNF4
+LABELV $237
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 156
+CNSTF4 1051260355
+CNSTF4 1132396544
+ADDRLP4 140
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 160
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+LTF4 $247
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $248
+JUMPV
+LABELV $247
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $248
+ADDRLP4 0+116+3
+ADDRLP4 152
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1109917696
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1106247680
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $250
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 172
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 172
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 1056964608
+GEF4 $253
+ADDRLP4 164
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $254
+JUMPV
+LABELV $253
+ADDRLP4 164
+CNSTF4 1065353216
+CNSTF4 1073741824
+ADDRLP4 164
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $254
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ADDRLP4 164
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 164
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $250
+LABELV $235
+endproc CG_AddSpriteExplosion 180 20
+lit
+align 4
+LABELV $257
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export CG_AddScorePlum
+code
+proc CG_AddScorePlum 172 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 112
+ADDRGP4 $257
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $259
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 17
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 17
+ASGNU1
+ADDRGP4 $260
+JUMPV
+LABELV $259
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 12
+INDIRI4
+CNSTI4 50
+LTI4 $261
+ADDRLP4 8
+INDIRP4
+CNSTI4 117
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $262
+JUMPV
+LABELV $261
+ADDRLP4 12
+INDIRI4
+CNSTI4 20
+LTI4 $263
+ADDRLP4 136
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRGP4 $264
+JUMPV
+LABELV $263
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+LTI4 $265
+ADDRLP4 8
+INDIRP4
+CNSTI4 118
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $266
+JUMPV
+LABELV $265
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LTI4 $267
+ADDRLP4 136
+CNSTU1 0
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+ADDRLP4 8
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 136
+INDIRU1
+ASGNU1
+LABELV $267
+LABELV $266
+LABELV $264
+LABELV $262
+LABELV $260
+ADDRLP4 80
+INDIRF4
+CNSTF4 1048576000
+GEF4 $269
+ADDRLP4 136
+CNSTF4 1149173760
+ADDRLP4 80
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 140
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+LTF4 $272
+ADDRLP4 132
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $273
+JUMPV
+LABELV $272
+ADDRLP4 132
+ADDRLP4 136
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $273
+ADDRLP4 8
+INDIRP4
+CNSTI4 119
+ADDP4
+ADDRLP4 132
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $270
+JUMPV
+LABELV $269
+ADDRLP4 8
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $270
+ADDRLP4 8
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+CNSTF4 1121714176
+CNSTF4 1120403456
+ADDRLP4 80
+INDIRF4
+MULF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+ADDRGP4 cg+109044+24
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96+4
+ADDRGP4 cg+109044+24+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96+8
+ADDRGP4 cg+109044+24+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 144
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 144
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 148
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 148
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+CNSTF4 1078530011
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRF4
+MULF4
+MULF4
+ARGF4
+ADDRLP4 152
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 152
+INDIRF4
+MULF4
+CNSTF4 3240099840
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 16
+INDIRF4
+ADDRGP4 cg+109044+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 16+4
+INDIRF4
+ADDRGP4 cg+109044+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 16+8
+INDIRF4
+ADDRGP4 cg+109044+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 84
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 1101004800
+GEF4 $305
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $256
+JUMPV
+LABELV $305
+ADDRLP4 160
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 160
+INDIRI4
+GEI4 $307
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $307
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $312
+JUMPV
+LABELV $309
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+MODI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+DIVI4
+ASGNI4
+LABELV $310
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $312
+ADDRLP4 164
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 164
+INDIRI4
+EQI4 $309
+ADDRLP4 12
+INDIRI4
+ADDRLP4 164
+INDIRI4
+NEI4 $309
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+EQI4 $313
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $313
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $318
+JUMPV
+LABELV $315
+ADDRLP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1090519040
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+CNSTF4 1090519040
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1090519040
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1073741824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ADDRLP4 168
+INDIRI4
+LSHI4
+ADDRLP4 40
+ADDP4
+INDIRI4
+ADDRLP4 168
+INDIRI4
+LSHI4
+ADDRGP4 cgs+152340+300
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $316
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $318
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LTI4 $315
+LABELV $256
+endproc CG_AddScorePlum 172 12
+export CG_AddLocalEntities
+proc CG_AddLocalEntities 20 8
+ADDRLP4 0
+ADDRGP4 cg_activeLocalEntities
+INDIRP4
+ASGNP4
+ADDRGP4 $329
+JUMPV
+LABELV $326
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+LTI4 $330
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeLocalEntity
+CALLV
+pop
+ADDRGP4 $327
+JUMPV
+LABELV $330
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $333
+ADDRLP4 12
+INDIRI4
+CNSTI4 8
+GTI4 $333
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $346
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $346
+address $334
+address $339
+address $338
+address $340
+address $341
+address $343
+address $342
+address $344
+address $345
+code
+LABELV $333
+ADDRGP4 $336
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $334
+JUMPV
+LABELV $338
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddSpriteExplosion
+CALLV
+pop
+ADDRGP4 $334
+JUMPV
+LABELV $339
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddExplosion
+CALLV
+pop
+ADDRGP4 $334
+JUMPV
+LABELV $340
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddFragment
+CALLV
+pop
+ADDRGP4 $334
+JUMPV
+LABELV $341
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddMoveScaleFade
+CALLV
+pop
+ADDRGP4 $334
+JUMPV
+LABELV $342
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddFadeRGB
+CALLV
+pop
+ADDRGP4 $334
+JUMPV
+LABELV $343
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddFallScaleFade
+CALLV
+pop
+ADDRGP4 $334
+JUMPV
+LABELV $344
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddScaleFade
+CALLV
+pop
+ADDRGP4 $334
+JUMPV
+LABELV $345
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_AddScorePlum
+CALLV
+pop
+LABELV $334
+LABELV $327
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $329
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeLocalEntities
+CVPU4 4
+NEU4 $326
+LABELV $325
+endproc CG_AddLocalEntities 20 8
+bss
+export cg_freeLocalEntities
+align 4
+LABELV cg_freeLocalEntities
+skip 4
+export cg_activeLocalEntities
+align 4
+LABELV cg_activeLocalEntities
+skip 292
+export cg_localEntities
+align 4
+LABELV cg_localEntities
+skip 149504
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $336
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $82
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
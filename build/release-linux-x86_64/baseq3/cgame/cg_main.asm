@@ -0,0 +1,11446 @@
+data
+export forceModelModificationCount
+align 4
+LABELV forceModelModificationCount
+byte 4 -1
+export vmMain
+code
+proc vmMain 16 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $72
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+GTI4 $72
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $84
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $84
+address $74
+address $75
+address $76
+address $77
+address $78
+address $79
+address $80
+address $81
+address $82
+code
+LABELV $74
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Init
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $75
+ADDRGP4 CG_Shutdown
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $76
+ADDRLP4 4
+ADDRGP4 CG_ConsoleCommand
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $77
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawActiveFrame
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $78
+ADDRLP4 8
+ADDRGP4 CG_CrosshairPlayer
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $79
+ADDRLP4 12
+ADDRGP4 CG_LastAttacker
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $80
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_KeyEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $81
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_MouseEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $82
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_EventHandling
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $72
+ADDRGP4 $83
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $73
+CNSTI4 -1
+RETI4
+LABELV $71
+endproc vmMain 16 12
+data
+align 4
+LABELV cvarTable
+address cg_ignore
+address $86
+address $87
+byte 4 0
+address cg_autoswitch
+address $88
+address $89
+byte 4 1
+address cg_drawGun
+address $90
+address $89
+byte 4 1
+address cg_zoomFov
+address $91
+address $92
+byte 4 1
+address cg_fov
+address $93
+address $94
+byte 4 1
+address cg_viewsize
+address $95
+address $96
+byte 4 1
+address cg_shadows
+address $97
+address $89
+byte 4 1
+address cg_gibs
+address $98
+address $89
+byte 4 1
+address cg_draw2D
+address $99
+address $89
+byte 4 1
+address cg_drawStatus
+address $100
+address $89
+byte 4 1
+address cg_drawTimer
+address $101
+address $87
+byte 4 1
+address cg_drawFPS
+address $102
+address $87
+byte 4 1
+address cg_drawSnapshot
+address $103
+address $87
+byte 4 1
+address cg_draw3dIcons
+address $104
+address $89
+byte 4 1
+address cg_drawIcons
+address $105
+address $89
+byte 4 1
+address cg_drawAmmoWarning
+address $106
+address $89
+byte 4 1
+address cg_drawAttacker
+address $107
+address $89
+byte 4 1
+address cg_drawCrosshair
+address $108
+address $109
+byte 4 1
+address cg_drawCrosshairNames
+address $110
+address $89
+byte 4 1
+address cg_drawRewards
+address $111
+address $89
+byte 4 1
+address cg_crosshairSize
+address $112
+address $113
+byte 4 1
+address cg_crosshairHealth
+address $114
+address $89
+byte 4 1
+address cg_crosshairX
+address $115
+address $87
+byte 4 1
+address cg_crosshairY
+address $116
+address $87
+byte 4 1
+address cg_brassTime
+address $117
+address $118
+byte 4 1
+address cg_simpleItems
+address $119
+address $87
+byte 4 1
+address cg_addMarks
+address $120
+address $89
+byte 4 1
+address cg_lagometer
+address $121
+address $89
+byte 4 1
+address cg_railTrailTime
+address $122
+address $123
+byte 4 1
+address cg_gun_x
+address $124
+address $87
+byte 4 512
+address cg_gun_y
+address $125
+address $87
+byte 4 512
+address cg_gun_z
+address $126
+address $87
+byte 4 512
+address cg_centertime
+address $127
+address $128
+byte 4 512
+address cg_runpitch
+address $129
+address $130
+byte 4 1
+address cg_runroll
+address $131
+address $132
+byte 4 1
+address cg_bobup
+address $133
+address $132
+byte 4 512
+address cg_bobpitch
+address $134
+address $130
+byte 4 1
+address cg_bobroll
+address $135
+address $130
+byte 4 1
+address cg_swingSpeed
+address $136
+address $137
+byte 4 512
+address cg_animSpeed
+address $138
+address $89
+byte 4 512
+address cg_debugAnim
+address $139
+address $87
+byte 4 512
+address cg_debugPosition
+address $140
+address $87
+byte 4 512
+address cg_debugEvents
+address $141
+address $87
+byte 4 512
+address cg_errorDecay
+address $142
+address $96
+byte 4 0
+address cg_nopredict
+address $143
+address $87
+byte 4 0
+address cg_noPlayerAnims
+address $144
+address $87
+byte 4 512
+address cg_showmiss
+address $145
+address $87
+byte 4 0
+address cg_footsteps
+address $146
+address $89
+byte 4 512
+address cg_tracerChance
+address $147
+address $148
+byte 4 512
+address cg_tracerWidth
+address $149
+address $89
+byte 4 512
+address cg_tracerLength
+address $150
+address $96
+byte 4 512
+address cg_thirdPersonRange
+address $151
+address $152
+byte 4 512
+address cg_thirdPersonAngle
+address $153
+address $87
+byte 4 512
+address cg_thirdPerson
+address $154
+address $87
+byte 4 0
+address cg_teamChatTime
+address $155
+address $156
+byte 4 1
+address cg_teamChatHeight
+address $157
+address $87
+byte 4 1
+address cg_forceModel
+address $158
+address $87
+byte 4 1
+address cg_predictItems
+address $159
+address $89
+byte 4 1
+address cg_deferPlayers
+address $160
+address $89
+byte 4 1
+address cg_drawTeamOverlay
+address $161
+address $87
+byte 4 1
+address cg_teamOverlayUserinfo
+address $162
+address $87
+byte 4 66
+address cg_stats
+address $163
+address $87
+byte 4 0
+address cg_drawFriend
+address $164
+address $89
+byte 4 1
+address cg_teamChatsOnly
+address $165
+address $87
+byte 4 1
+address cg_noVoiceChats
+address $166
+address $87
+byte 4 1
+address cg_noVoiceText
+address $167
+address $87
+byte 4 1
+address cg_buildScript
+address $168
+address $87
+byte 4 0
+address cg_paused
+address $169
+address $87
+byte 4 64
+address cg_blood
+address $170
+address $89
+byte 4 1
+address cg_synchronousClients
+address $171
+address $87
+byte 4 0
+address cg_cameraOrbit
+address $172
+address $87
+byte 4 512
+address cg_cameraOrbitDelay
+address $173
+address $174
+byte 4 1
+address cg_timescaleFadeEnd
+address $175
+address $89
+byte 4 0
+address cg_timescaleFadeSpeed
+address $176
+address $87
+byte 4 0
+address cg_timescale
+address $177
+address $89
+byte 4 0
+address cg_scorePlum
+address $178
+address $89
+byte 4 3
+address cg_smoothClients
+address $179
+address $87
+byte 4 3
+address cg_cameraMode
+address $180
+address $87
+byte 4 512
+address pmove_fixed
+address $181
+address $87
+byte 4 0
+address pmove_msec
+address $182
+address $183
+byte 4 0
+address cg_noTaunt
+address $184
+address $87
+byte 4 1
+address cg_noProjectileTrail
+address $185
+address $87
+byte 4 1
+address cg_smallFont
+address $186
+address $187
+byte 4 1
+address cg_bigFont
+address $188
+address $148
+byte 4 1
+address cg_oldRail
+address $189
+address $89
+byte 4 1
+address cg_oldRocket
+address $190
+address $89
+byte 4 1
+address cg_oldPlasma
+address $191
+address $89
+byte 4 1
+address cg_trueLightning
+address $192
+address $193
+byte 4 1
+align 4
+LABELV cvarTableSize
+byte 4 88
+export CG_RegisterCvars
+code
+proc CG_RegisterCvars 1036 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $198
+JUMPV
+LABELV $195
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $196
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $198
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $195
+ADDRGP4 $199
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 1032
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31452
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+ADDRGP4 forceModelModificationCount
+ADDRGP4 cg_forceModel+4
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 $202
+ARGP4
+ADDRGP4 $203
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 $204
+ARGP4
+ADDRGP4 $203
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 $205
+ARGP4
+ADDRGP4 $203
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 $203
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $194
+endproc CG_RegisterCvars 1036 16
+proc CG_ForceModelChange 12 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $208
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $212
+ADDRGP4 $209
+JUMPV
+LABELV $212
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+LABELV $209
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $208
+LABELV $207
+endproc CG_ForceModelChange 12 4
+export CG_UpdateCvars
+proc CG_UpdateCvars 8 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $218
+JUMPV
+LABELV $215
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $216
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $218
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $215
+ADDRGP4 drawTeamOverlayModificationCount
+INDIRI4
+ADDRGP4 cg_drawTeamOverlay+4
+INDIRI4
+EQI4 $219
+ADDRGP4 drawTeamOverlayModificationCount
+ADDRGP4 cg_drawTeamOverlay+4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_drawTeamOverlay+12
+INDIRI4
+CNSTI4 0
+LEI4 $223
+ADDRGP4 $162
+ARGP4
+ADDRGP4 $89
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $224
+JUMPV
+LABELV $223
+ADDRGP4 $162
+ARGP4
+ADDRGP4 $87
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $224
+LABELV $219
+ADDRGP4 forceModelModificationCount
+INDIRI4
+ADDRGP4 cg_forceModel+4
+INDIRI4
+EQI4 $226
+ADDRGP4 forceModelModificationCount
+ADDRGP4 cg_forceModel+4
+INDIRI4
+ASGNI4
+ADDRGP4 CG_ForceModelChange
+CALLV
+pop
+LABELV $226
+LABELV $214
+endproc CG_UpdateCvars 8 8
+export CG_CrosshairPlayer
+proc CG_CrosshairPlayer 0 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+124404
+INDIRI4
+CNSTI4 1000
+ADDI4
+LEI4 $231
+CNSTI4 -1
+RETI4
+ADDRGP4 $230
+JUMPV
+LABELV $231
+ADDRGP4 cg+124400
+INDIRI4
+RETI4
+LABELV $230
+endproc CG_CrosshairPlayer 0 0
+export CG_LastAttacker
+proc CG_LastAttacker 0 0
+ADDRGP4 cg+124416
+INDIRI4
+CNSTI4 0
+NEI4 $237
+CNSTI4 -1
+RETI4
+ADDRGP4 $236
+JUMPV
+LABELV $237
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+RETI4
+LABELV $236
+endproc CG_LastAttacker 0 0
+export CG_Printf
+proc CG_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $241
+endproc CG_Printf 1028 16
+export CG_Error
+proc CG_Error 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $243
+endproc CG_Error 1028 16
+export Com_Error
+proc Com_Error 1028 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $247
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $245
+endproc Com_Error 1028 16
+export Com_Printf
+proc Com_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $247
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $248
+endproc Com_Printf 1028 16
+bss
+align 1
+LABELV $251
+skip 1024
+export CG_Argv
+code
+proc CG_Argv 0 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $251
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRGP4 $251
+RETP4
+LABELV $250
+endproc CG_Argv 0 12
+proc CG_RegisterItemSounds 96 12
+ADDRLP4 76
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $253
+ADDRLP4 76
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $253
+ADDRLP4 0
+ADDRLP4 76
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $257
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $259
+LABELV $257
+ADDRGP4 $252
+JUMPV
+LABELV $258
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $262
+JUMPV
+LABELV $261
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $262
+ADDRLP4 84
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $264
+ADDRLP4 84
+INDIRI4
+CNSTI4 32
+NEI4 $261
+LABELV $264
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $267
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+GEI4 $265
+LABELV $267
+ADDRGP4 $268
+ARGP4
+ADDRLP4 76
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $265
+ADDRLP4 8
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $269
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $269
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8-3
+ADDP4
+ARGP4
+ADDRGP4 $274
+ARGP4
+ADDRLP4 92
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $271
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $271
+LABELV $259
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $258
+LABELV $252
+endproc CG_RegisterItemSounds 96 12
+proc CG_RegisterSounds 548 16
+ADDRGP4 $278
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 332
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+744
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $281
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 336
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+748
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $284
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 340
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+752
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $287
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 344
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+764
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRGP4 $290
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 348
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+760
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $293
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 352
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+756
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRGP4 $296
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 356
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+956
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $299
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 360
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+960
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 $302
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 364
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+964
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $305
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 368
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+968
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRGP4 $308
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+972
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+GEI4 $313
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $309
+LABELV $313
+ADDRGP4 $316
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 376
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+868
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $319
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+880
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $322
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 384
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+884
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $325
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+888
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $328
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+780
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $331
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+872
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $334
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+876
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $316
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+892
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $339
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+896
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $342
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 412
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+900
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $345
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 416
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+904
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $348
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 420
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+908
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $351
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 424
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+912
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $356
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $352
+LABELV $356
+ADDRGP4 $359
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+916
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $362
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+920
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $365
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+928
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $368
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 440
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+936
+ADDRLP4 440
+INDIRI4
+ASGNI4
+LABELV $352
+ADDRGP4 $371
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+944
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $374
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+952
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $345
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+924
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $379
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 440
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+940
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $382
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 444
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+932
+ADDRLP4 444
+INDIRI4
+ASGNI4
+LABELV $309
+ADDRGP4 $385
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 376
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+532
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $388
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 380
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+536
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 $391
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 384
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+544
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $394
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 388
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+540
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $397
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+696
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $400
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 396
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+700
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $403
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 400
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+704
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $406
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 404
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+708
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $409
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 408
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+712
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $412
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 412
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+716
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $415
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 416
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+724
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $418
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 420
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+720
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $421
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 424
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+728
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $424
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+732
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $427
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+768
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $430
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 436
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+784
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $433
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 440
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+788
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $436
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 444
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+792
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $439
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 448
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+796
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 $442
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 452
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+800
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $445
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 456
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+804
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $448
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 460
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+820
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $451
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 464
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+824
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $454
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 468
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+828
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $457
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 472
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+844
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $460
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+848
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $463
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 480
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+852
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $466
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 484
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+740
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $467
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $471
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 488
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+548
+ADDP4
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $474
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 492
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+548+16
+ADDP4
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $478
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+548+32
+ADDP4
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $482
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+548+48
+ADDP4
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $486
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 504
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+548+64
+ADDP4
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $490
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 508
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+548+96
+ADDP4
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $494
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 512
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+548+80
+ADDP4
+ADDRLP4 512
+INDIRI4
+ASGNI4
+LABELV $468
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $467
+CNSTI4 27
+ARGI4
+ADDRLP4 488
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 488
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $501
+JUMPV
+LABELV $498
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemSounds
+CALLV
+pop
+LABELV $499
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $501
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $498
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $502
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 492
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 492
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $506
+ADDRGP4 $504
+JUMPV
+LABELV $506
+ADDRLP4 68
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $508
+ADDRGP4 $503
+JUMPV
+LABELV $508
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35848
+ADDP4
+ADDRLP4 496
+INDIRI4
+ASGNI4
+LABELV $503
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $502
+LABELV $504
+ADDRGP4 $513
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 492
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+856
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 $516
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 496
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+860
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 $519
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 500
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+528
+ADDRLP4 500
+INDIRI4
+ASGNI4
+ADDRGP4 $522
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 504
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+672
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $525
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 508
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+676
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $528
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 512
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+680
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRGP4 $531
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 516
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+684
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRGP4 $534
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 520
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+688
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 $537
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 524
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+692
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $540
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 528
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+988
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRGP4 $543
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 532
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+992
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRGP4 $546
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 536
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+996
+ADDRLP4 536
+INDIRI4
+ASGNI4
+ADDRGP4 $549
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 540
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+1000
+ADDRLP4 540
+INDIRI4
+ASGNI4
+ADDRGP4 $552
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 544
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+1004
+ADDRLP4 544
+INDIRI4
+ASGNI4
+LABELV $275
+endproc CG_RegisterSounds 548 16
+data
+align 4
+LABELV $554
+address $555
+address $556
+address $557
+address $558
+address $559
+address $560
+address $561
+address $562
+address $563
+address $564
+address $565
+code
+proc CG_RegisterGraphics 588 16
+ADDRGP4 cg+109044
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 368
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRGP4 cgs+31484
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 cgs+31484
+ARGP4
+ADDRGP4 trap_R_LoadWorldMap
+CALLV
+pop
+ADDRGP4 $570
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $571
+ADDRLP4 264
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRGP4 $554
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRGP4 cgs+152340+300
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+LABELV $572
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+LTI4 $571
+ADDRGP4 $579
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+348
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $583
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+348+4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRGP4 $587
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+348+8
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRGP4 $591
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+348+12
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 $595
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+348+16
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRGP4 $598
+ARGP4
+ADDRLP4 284
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+216
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRGP4 $601
+ARGP4
+ADDRLP4 288
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+132
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRGP4 $604
+ARGP4
+ADDRLP4 292
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+488
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRGP4 $607
+ARGP4
+ADDRLP4 296
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+492
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRGP4 $610
+ARGP4
+ADDRLP4 300
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+496
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRGP4 $613
+ARGP4
+ADDRLP4 304
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+500
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRGP4 $616
+ARGP4
+ADDRLP4 308
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+276
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRGP4 $619
+ARGP4
+ADDRLP4 312
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+280
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRGP4 $622
+ARGP4
+ADDRLP4 316
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+284
+ADDRLP4 316
+INDIRI4
+ASGNI4
+ADDRGP4 $625
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+288
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRGP4 $628
+ARGP4
+ADDRLP4 324
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+296
+ADDRLP4 324
+INDIRI4
+ASGNI4
+ADDRGP4 $631
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+264
+ADDRLP4 328
+INDIRI4
+ASGNI4
+ADDRGP4 $634
+ARGP4
+ADDRLP4 332
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+208
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRGP4 $637
+ARGP4
+ADDRLP4 336
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+292
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRGP4 $640
+ARGP4
+ADDRLP4 340
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+220
+ADDRLP4 340
+INDIRI4
+ASGNI4
+ADDRGP4 $643
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+212
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $644
+ADDRGP4 $650
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+ADDI4
+ARGI4
+ADDRLP4 352
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 356
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+224
+ADDP4
+ADDRLP4 356
+INDIRI4
+ASGNI4
+LABELV $645
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $644
+ADDRGP4 $653
+ARGP4
+ADDRLP4 348
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+268
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRGP4 $656
+ARGP4
+ADDRLP4 352
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+272
+ADDRLP4 352
+INDIRI4
+ASGNI4
+ADDRGP4 $659
+ARGP4
+ADDRLP4 356
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+392
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRGP4 $662
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+400
+ADDRLP4 360
+INDIRI4
+ASGNI4
+ADDRGP4 $665
+ARGP4
+ADDRLP4 364
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+412
+ADDRLP4 364
+INDIRI4
+ASGNI4
+ADDRGP4 $668
+ARGP4
+ADDRLP4 368
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+416
+ADDRLP4 368
+INDIRI4
+ASGNI4
+ADDRGP4 $671
+ARGP4
+ADDRLP4 372
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+404
+ADDRLP4 372
+INDIRI4
+ASGNI4
+ADDRGP4 $674
+ARGP4
+ADDRLP4 376
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+408
+ADDRLP4 376
+INDIRI4
+ASGNI4
+ADDRGP4 $677
+ARGP4
+ADDRLP4 380
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+420
+ADDRLP4 380
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $682
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $678
+LABELV $682
+ADDRGP4 $685
+ARGP4
+ADDRLP4 384
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+20
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $688
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+24
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $691
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+28
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $694
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+32
+ADDRLP4 396
+INDIRI4
+ASGNI4
+LABELV $678
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+EQI4 $699
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $695
+LABELV $699
+ADDRGP4 $702
+ARGP4
+ADDRLP4 384
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+36
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $705
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+40
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $708
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+48
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $712
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+48+4
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $716
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+48+8
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $719
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+60
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $723
+ARGP4
+ADDRLP4 408
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+60+4
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $727
+ARGP4
+ADDRLP4 412
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+60+8
+ADDRLP4 412
+INDIRI4
+ASGNI4
+LABELV $695
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+GEI4 $732
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $728
+LABELV $732
+ADDRGP4 $735
+ARGP4
+ADDRLP4 384
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+200
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $738
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+396
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $741
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+128
+ADDRLP4 392
+INDIRI4
+ASGNI4
+LABELV $728
+ADDRGP4 $744
+ARGP4
+ADDRLP4 384
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+120
+ADDRLP4 384
+INDIRI4
+ASGNI4
+ADDRGP4 $747
+ARGP4
+ADDRLP4 388
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+124
+ADDRLP4 388
+INDIRI4
+ASGNI4
+ADDRGP4 $750
+ARGP4
+ADDRLP4 392
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+180
+ADDRLP4 392
+INDIRI4
+ASGNI4
+ADDRGP4 $753
+ARGP4
+ADDRLP4 396
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+184
+ADDRLP4 396
+INDIRI4
+ASGNI4
+ADDRGP4 $756
+ARGP4
+ADDRLP4 400
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+136
+ADDRLP4 400
+INDIRI4
+ASGNI4
+ADDRGP4 $759
+ARGP4
+ADDRLP4 404
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+140
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRGP4 $762
+ARGP4
+ADDRLP4 408
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+144
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRGP4 $765
+ARGP4
+ADDRLP4 412
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+148
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRGP4 $768
+ARGP4
+ADDRLP4 416
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+152
+ADDRLP4 416
+INDIRI4
+ASGNI4
+ADDRGP4 $771
+ARGP4
+ADDRLP4 420
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+156
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRGP4 $774
+ARGP4
+ADDRLP4 424
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+160
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRGP4 $777
+ARGP4
+ADDRLP4 428
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+164
+ADDRLP4 428
+INDIRI4
+ASGNI4
+ADDRGP4 $780
+ARGP4
+ADDRLP4 432
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+168
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRGP4 $783
+ARGP4
+ADDRLP4 436
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+172
+ADDRLP4 436
+INDIRI4
+ASGNI4
+ADDRGP4 $753
+ARGP4
+ADDRLP4 440
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+176
+ADDRLP4 440
+INDIRI4
+ASGNI4
+ADDRGP4 $788
+ARGP4
+ADDRLP4 444
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+204
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRGP4 $791
+ARGP4
+ADDRLP4 448
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+472
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRGP4 $794
+ARGP4
+ADDRLP4 452
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+432
+ADDRLP4 452
+INDIRI4
+ASGNI4
+ADDRGP4 $797
+ARGP4
+ADDRLP4 456
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+436
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRGP4 $800
+ARGP4
+ADDRLP4 460
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+440
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRGP4 $803
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+476
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRGP4 $806
+ARGP4
+ADDRLP4 468
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+480
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRGP4 $809
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+484
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRGP4 $812
+ARGP4
+ADDRLP4 476
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+504
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRGP4 $815
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+508
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRGP4 $818
+ARGP4
+ADDRLP4 484
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+512
+ADDRLP4 484
+INDIRI4
+ASGNI4
+ADDRGP4 $821
+ARGP4
+ADDRLP4 488
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+516
+ADDRLP4 488
+INDIRI4
+ASGNI4
+ADDRGP4 $824
+ARGP4
+ADDRLP4 492
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+520
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRGP4 $827
+ARGP4
+ADDRLP4 496
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+524
+ADDRLP4 496
+INDIRI4
+ASGNI4
+ADDRGP4 cg_items
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 6144
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_weapons
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2176
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 27
+ARGI4
+ADDRLP4 500
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 500
+INDIRP4
+ARGP4
+CNSTI4 257
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $831
+JUMPV
+LABELV $828
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 49
+EQI4 $835
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $832
+LABELV $835
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingItem
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+LABELV $832
+LABELV $829
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $831
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $828
+ADDRGP4 $838
+ARGP4
+ADDRLP4 504
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+376
+ADDRLP4 504
+INDIRI4
+ASGNI4
+ADDRGP4 $841
+ARGP4
+ADDRLP4 508
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+380
+ADDRLP4 508
+INDIRI4
+ASGNI4
+ADDRGP4 $844
+ARGP4
+ADDRLP4 512
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+384
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRGP4 $847
+ARGP4
+ADDRLP4 516
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+388
+ADDRLP4 516
+INDIRI4
+ASGNI4
+ADDRGP4 $850
+ARGP4
+ADDRLP4 520
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+344
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 $853
+ARGP4
+ADDRLP4 524
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+368
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRGP4 $856
+ARGP4
+ADDRLP4 528
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+372
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRLP4 532
+ADDRGP4 trap_CM_NumInlineModels
+CALLI4
+ASGNI4
+ADDRGP4 cgs+36872
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $861
+JUMPV
+LABELV $858
+ADDRLP4 564
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRGP4 $863
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 564
+ARGP4
+ADDRLP4 576
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36876
+ADDP4
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+36876
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 540
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 536
+CNSTI4 0
+ASGNI4
+LABELV $866
+ADDRLP4 580
+ADDRLP4 536
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 584
+ADDRLP4 580
+INDIRI4
+ADDRLP4 540
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 580
+INDIRI4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+37900
+ADDP4
+ADDP4
+ADDRLP4 584
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 580
+INDIRI4
+ADDRLP4 552
+ADDP4
+INDIRF4
+ADDRLP4 584
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $867
+ADDRLP4 536
+ADDRLP4 536
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 536
+INDIRI4
+CNSTI4 3
+LTI4 $866
+LABELV $859
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $861
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+36872
+INDIRI4
+LTI4 $858
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $871
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ARGI4
+ADDRLP4 540
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 536
+ADDRLP4 540
+INDIRP4
+ASGNP4
+ADDRLP4 536
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $875
+ADDRGP4 $873
+JUMPV
+LABELV $875
+ADDRLP4 536
+INDIRP4
+ARGP4
+ADDRLP4 544
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+34824
+ADDP4
+ADDRLP4 544
+INDIRI4
+ASGNI4
+LABELV $872
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+LTI4 $871
+LABELV $873
+ADDRGP4 CG_ClearParticles
+CALLV
+pop
+LABELV $553
+endproc CG_RegisterGraphics 588 16
+export CG_BuildSpectatorString
+proc CG_BuildSpectatorString 12 12
+ADDRGP4 cg+114364
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $880
+ADDRLP4 4
+CNSTI4 1708
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+40972
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $884
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $884
+ADDRGP4 $891
+ARGP4
+CNSTI4 1708
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+4
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 cg+114364
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $884
+LABELV $881
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $880
+ADDRGP4 cg+114364
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+115388
+INDIRI4
+EQI4 $895
+ADDRGP4 cg+115388
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+115392
+CNSTF4 3212836864
+ASGNF4
+LABELV $895
+LABELV $878
+endproc CG_BuildSpectatorString 12 12
+proc CG_RegisterClients 12 4
+ADDRGP4 cg+4
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingClient
+CALLV
+pop
+ADDRGP4 cg+4
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $903
+ADDRGP4 cg+4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $907
+ADDRGP4 $904
+JUMPV
+LABELV $907
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $910
+ADDRGP4 $904
+JUMPV
+LABELV $910
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_LoadingClient
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+LABELV $904
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $903
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+LABELV $900
+endproc CG_RegisterClients 12 4
+export CG_ConfigString
+proc CG_ConfigString 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $915
+ADDRFP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $913
+LABELV $915
+ADDRGP4 $916
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $913
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs
+ADDP4
+INDIRI4
+ADDRGP4 cgs+4096
+ADDP4
+RETP4
+LABELV $912
+endproc CG_ConfigString 4 8
+export CG_StartMusic
+proc CG_StartMusic 144 12
+CNSTI4 2
+ARGI4
+ADDRLP4 132
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 136
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 136
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 trap_S_StartBackgroundTrack
+CALLV
+pop
+LABELV $918
+endproc CG_StartMusic 144 12
+export CG_Init
+proc CG_Init 44 12
+ADDRGP4 cgs
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 153364
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 124992
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_entities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 745472
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_weapons
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2176
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_items
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 6144
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg+4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31448
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31444
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $924
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $927
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+16
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $930
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $933
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $936
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 CG_RegisterCvars
+CALLV
+pop
+ADDRGP4 CG_InitConsoleCommands
+CALLV
+pop
+ADDRGP4 cg+108944
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs+34812
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+34808
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+34816
+CNSTI4 -1
+ASGNI4
+ADDRGP4 cgs+20100
+ARGP4
+ADDRGP4 trap_GetGlconfig
+CALLV
+pop
+ADDRGP4 cgs+31432
+ADDRGP4 cgs+20100+11304
+INDIRI4
+CVIF4 4
+CNSTF4 1142947840
+DIVF4
+ASGNF4
+ADDRGP4 cgs+31436
+ADDRGP4 cgs+20100+11308
+INDIRI4
+CVIF4 4
+CNSTF4 1139802112
+DIVF4
+ASGNF4
+ADDRGP4 cgs
+ARGP4
+ADDRGP4 trap_GetGameState
+CALLV
+pop
+CNSTI4 20
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $950
+ARGP4
+ADDRLP4 32
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $948
+ADDRGP4 $951
+ARGP4
+ADDRGP4 $950
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $948
+CNSTI4 21
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34796
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 CG_ParseServerinfo
+CALLV
+pop
+ADDRGP4 $953
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 cgs+31484
+ARGP4
+ADDRGP4 trap_CM_LoadMap
+CALLV
+pop
+ADDRGP4 cg+20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $956
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_RegisterSounds
+CALLV
+pop
+ADDRGP4 $957
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_RegisterGraphics
+CALLV
+pop
+ADDRGP4 $958
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_RegisterClients
+CALLV
+pop
+ADDRGP4 cg+20
+CNSTI4 0
+ASGNI4
+ADDRGP4 CG_InitLocalEntities
+CALLV
+pop
+ADDRGP4 CG_InitMarkPolys
+CALLV
+pop
+ADDRGP4 cg+109436
+CNSTI1 0
+ASGNI1
+ADDRGP4 CG_SetConfigValues
+CALLV
+pop
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+ADDRGP4 $961
+ARGP4
+ADDRGP4 CG_LoadingString
+CALLV
+pop
+ADDRGP4 CG_ShaderStateChanged
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+LABELV $919
+endproc CG_Init 44 12
+export CG_Shutdown
+proc CG_Shutdown 0 0
+LABELV $962
+endproc CG_Shutdown 0 0
+export CG_EventHandling
+proc CG_EventHandling 0 0
+LABELV $963
+endproc CG_EventHandling 0 0
+export CG_KeyEvent
+proc CG_KeyEvent 0 0
+LABELV $964
+endproc CG_KeyEvent 0 0
+export CG_MouseEvent
+proc CG_MouseEvent 0 0
+LABELV $965
+endproc CG_MouseEvent 0 0
+bss
+export cg_pmove_msec
+align 4
+LABELV cg_pmove_msec
+skip 272
+export cg_hudFiles
+align 4
+LABELV cg_hudFiles
+skip 272
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_LoadMenus
+export cg_trueLightning
+align 4
+LABELV cg_trueLightning
+skip 272
+export cg_oldPlasma
+align 4
+LABELV cg_oldPlasma
+skip 272
+export cg_oldRocket
+align 4
+LABELV cg_oldRocket
+skip 272
+export cg_oldRail
+align 4
+LABELV cg_oldRail
+skip 272
+export cg_noProjectileTrail
+align 4
+LABELV cg_noProjectileTrail
+skip 272
+export cg_noTaunt
+align 4
+LABELV cg_noTaunt
+skip 272
+export cg_bigFont
+align 4
+LABELV cg_bigFont
+skip 272
+export cg_smallFont
+align 4
+LABELV cg_smallFont
+skip 272
+export cg_cameraMode
+align 4
+LABELV cg_cameraMode
+skip 272
+export cg_timescale
+align 4
+LABELV cg_timescale
+skip 272
+export cg_timescaleFadeSpeed
+align 4
+LABELV cg_timescaleFadeSpeed
+skip 272
+export cg_timescaleFadeEnd
+align 4
+LABELV cg_timescaleFadeEnd
+skip 272
+export cg_cameraOrbitDelay
+align 4
+LABELV cg_cameraOrbitDelay
+skip 272
+export cg_cameraOrbit
+align 4
+LABELV cg_cameraOrbit
+skip 272
+export pmove_msec
+align 4
+LABELV pmove_msec
+skip 272
+export pmove_fixed
+align 4
+LABELV pmove_fixed
+skip 272
+export cg_smoothClients
+align 4
+LABELV cg_smoothClients
+skip 272
+export cg_scorePlum
+align 4
+LABELV cg_scorePlum
+skip 272
+export cg_noVoiceText
+align 4
+LABELV cg_noVoiceText
+skip 272
+export cg_noVoiceChats
+align 4
+LABELV cg_noVoiceChats
+skip 272
+export cg_teamChatsOnly
+align 4
+LABELV cg_teamChatsOnly
+skip 272
+export cg_drawFriend
+align 4
+LABELV cg_drawFriend
+skip 272
+export cg_deferPlayers
+align 4
+LABELV cg_deferPlayers
+skip 272
+export cg_predictItems
+align 4
+LABELV cg_predictItems
+skip 272
+export cg_blood
+align 4
+LABELV cg_blood
+skip 272
+export cg_paused
+align 4
+LABELV cg_paused
+skip 272
+export cg_buildScript
+align 4
+LABELV cg_buildScript
+skip 272
+export cg_forceModel
+align 4
+LABELV cg_forceModel
+skip 272
+export cg_stats
+align 4
+LABELV cg_stats
+skip 272
+export cg_teamChatHeight
+align 4
+LABELV cg_teamChatHeight
+skip 272
+export cg_teamChatTime
+align 4
+LABELV cg_teamChatTime
+skip 272
+export cg_synchronousClients
+align 4
+LABELV cg_synchronousClients
+skip 272
+export cg_drawAttacker
+align 4
+LABELV cg_drawAttacker
+skip 272
+export cg_lagometer
+align 4
+LABELV cg_lagometer
+skip 272
+export cg_thirdPerson
+align 4
+LABELV cg_thirdPerson
+skip 272
+export cg_thirdPersonAngle
+align 4
+LABELV cg_thirdPersonAngle
+skip 272
+export cg_thirdPersonRange
+align 4
+LABELV cg_thirdPersonRange
+skip 272
+export cg_zoomFov
+align 4
+LABELV cg_zoomFov
+skip 272
+export cg_fov
+align 4
+LABELV cg_fov
+skip 272
+export cg_simpleItems
+align 4
+LABELV cg_simpleItems
+skip 272
+export cg_ignore
+align 4
+LABELV cg_ignore
+skip 272
+export cg_autoswitch
+align 4
+LABELV cg_autoswitch
+skip 272
+export cg_tracerLength
+align 4
+LABELV cg_tracerLength
+skip 272
+export cg_tracerWidth
+align 4
+LABELV cg_tracerWidth
+skip 272
+export cg_tracerChance
+align 4
+LABELV cg_tracerChance
+skip 272
+export cg_viewsize
+align 4
+LABELV cg_viewsize
+skip 272
+export cg_drawGun
+align 4
+LABELV cg_drawGun
+skip 272
+export cg_gun_z
+align 4
+LABELV cg_gun_z
+skip 272
+export cg_gun_y
+align 4
+LABELV cg_gun_y
+skip 272
+export cg_gun_x
+align 4
+LABELV cg_gun_x
+skip 272
+export cg_gun_frame
+align 4
+LABELV cg_gun_frame
+skip 272
+export cg_brassTime
+align 4
+LABELV cg_brassTime
+skip 272
+export cg_addMarks
+align 4
+LABELV cg_addMarks
+skip 272
+export cg_footsteps
+align 4
+LABELV cg_footsteps
+skip 272
+export cg_showmiss
+align 4
+LABELV cg_showmiss
+skip 272
+export cg_noPlayerAnims
+align 4
+LABELV cg_noPlayerAnims
+skip 272
+export cg_nopredict
+align 4
+LABELV cg_nopredict
+skip 272
+export cg_errorDecay
+align 4
+LABELV cg_errorDecay
+skip 272
+export cg_railTrailTime
+align 4
+LABELV cg_railTrailTime
+skip 272
+export cg_debugEvents
+align 4
+LABELV cg_debugEvents
+skip 272
+export cg_debugPosition
+align 4
+LABELV cg_debugPosition
+skip 272
+export cg_debugAnim
+align 4
+LABELV cg_debugAnim
+skip 272
+export cg_animSpeed
+align 4
+LABELV cg_animSpeed
+skip 272
+export cg_draw2D
+align 4
+LABELV cg_draw2D
+skip 272
+export cg_drawStatus
+align 4
+LABELV cg_drawStatus
+skip 272
+export cg_crosshairHealth
+align 4
+LABELV cg_crosshairHealth
+skip 272
+export cg_crosshairSize
+align 4
+LABELV cg_crosshairSize
+skip 272
+export cg_crosshairY
+align 4
+LABELV cg_crosshairY
+skip 272
+export cg_crosshairX
+align 4
+LABELV cg_crosshairX
+skip 272
+export cg_teamOverlayUserinfo
+align 4
+LABELV cg_teamOverlayUserinfo
+skip 272
+export cg_drawTeamOverlay
+align 4
+LABELV cg_drawTeamOverlay
+skip 272
+export cg_drawRewards
+align 4
+LABELV cg_drawRewards
+skip 272
+export cg_drawCrosshairNames
+align 4
+LABELV cg_drawCrosshairNames
+skip 272
+export cg_drawCrosshair
+align 4
+LABELV cg_drawCrosshair
+skip 272
+export cg_drawAmmoWarning
+align 4
+LABELV cg_drawAmmoWarning
+skip 272
+export cg_drawIcons
+align 4
+LABELV cg_drawIcons
+skip 272
+export cg_draw3dIcons
+align 4
+LABELV cg_draw3dIcons
+skip 272
+export cg_drawSnapshot
+align 4
+LABELV cg_drawSnapshot
+skip 272
+export cg_drawFPS
+align 4
+LABELV cg_drawFPS
+skip 272
+export cg_drawTimer
+align 4
+LABELV cg_drawTimer
+skip 272
+export cg_gibs
+align 4
+LABELV cg_gibs
+skip 272
+export cg_shadows
+align 4
+LABELV cg_shadows
+skip 272
+export cg_swingSpeed
+align 4
+LABELV cg_swingSpeed
+skip 272
+export cg_bobroll
+align 4
+LABELV cg_bobroll
+skip 272
+export cg_bobpitch
+align 4
+LABELV cg_bobpitch
+skip 272
+export cg_bobup
+align 4
+LABELV cg_bobup
+skip 272
+export cg_runroll
+align 4
+LABELV cg_runroll
+skip 272
+export cg_runpitch
+align 4
+LABELV cg_runpitch
+skip 272
+export cg_centertime
+align 4
+LABELV cg_centertime
+skip 272
+import cg_markPolys
+export cg_items
+align 4
+LABELV cg_items
+skip 6144
+export cg_weapons
+align 4
+LABELV cg_weapons
+skip 2176
+export cg_entities
+align 4
+LABELV cg_entities
+skip 745472
+export cg
+align 4
+LABELV cg
+skip 124992
+export cgs
+align 4
+LABELV cgs
+skip 153364
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $961
+byte 1 0
+align 1
+LABELV $958
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $957
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $956
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $953
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $951
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 47
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $950
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 51
+byte 1 45
+byte 1 49
+byte 1 0
+align 1
+LABELV $936
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 50
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $933
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $930
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $927
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $924
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $916
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $891
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $863
+byte 1 42
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $856
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $853
+byte 1 119
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 0
+align 1
+LABELV $850
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $847
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $844
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $841
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $838
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 114
+byte 1 107
+byte 1 0
+align 1
+LABELV $827
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $824
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $821
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $818
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $815
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $812
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $809
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 101
+byte 1 108
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $806
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 69
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $803
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 112
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $800
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 48
+byte 1 49
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $797
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 48
+byte 1 50
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $794
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $791
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $788
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $783
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $780
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $777
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $774
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $771
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $768
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $765
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $762
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $759
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $756
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 98
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $753
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $750
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $747
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $744
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 121
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $741
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $738
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $735
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 101
+byte 1 0
+align 1
+LABELV $727
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 51
+byte 1 0
+align 1
+LABELV $723
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 50
+byte 1 0
+align 1
+LABELV $719
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 49
+byte 1 0
+align 1
+LABELV $716
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $712
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 50
+byte 1 0
+align 1
+LABELV $708
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $705
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $702
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $694
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $691
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $688
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 47
+byte 1 98
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $685
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 47
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $677
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $674
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $671
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $668
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $665
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $662
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $659
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $656
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 0
+align 1
+LABELV $653
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $650
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 37
+byte 1 99
+byte 1 0
+align 1
+LABELV $643
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $640
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $637
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 117
+byte 1 98
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $634
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $631
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $628
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $625
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 49
+byte 1 0
+align 1
+LABELV $622
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $619
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 82
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 0
+align 1
+LABELV $616
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $613
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $610
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $607
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $604
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 98
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $601
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $598
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 66
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 66
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $595
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 53
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $591
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 52
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $587
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 51
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $583
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 50
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $579
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $570
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 97
+byte 1 0
+align 1
+LABELV $565
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 115
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $564
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $563
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $562
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $561
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 105
+byte 1 120
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $560
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $559
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $558
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $557
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $556
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $555
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 122
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 95
+byte 1 51
+byte 1 50
+byte 1 98
+byte 1 0
+align 1
+LABELV $552
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 98
+byte 1 50
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $549
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 104
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 98
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $546
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $543
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $540
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $537
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 120
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $534
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 108
+byte 1 120
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $531
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $528
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $525
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $522
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $519
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $516
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 107
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $513
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $494
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $490
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $486
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $482
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $478
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $474
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $471
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 37
+byte 1 105
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $466
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $463
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $460
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $457
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 119
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $454
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $451
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $448
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $445
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $442
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $439
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $436
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $433
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $430
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $427
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $424
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $421
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $418
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 110
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $415
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $412
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $409
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 105
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $406
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $403
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $400
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $397
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 108
+byte 1 116
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $394
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $391
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $388
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $385
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 98
+byte 1 121
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $382
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $379
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 49
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $374
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 108
+byte 1 121
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $371
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $368
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $365
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $362
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $359
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $351
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $348
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 116
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $345
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $342
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $339
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $334
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $331
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 118
+byte 1 111
+byte 1 99
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $328
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $325
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $322
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $319
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $316
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 47
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 95
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $308
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $305
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $302
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $299
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 119
+byte 1 111
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $296
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 116
+byte 1 104
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $293
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 51
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $290
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 50
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $287
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 49
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $284
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 115
+byte 1 117
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $281
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 53
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $278
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 47
+byte 1 49
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $274
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $268
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $247
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $206
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $205
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $204
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $203
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $202
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $199
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $193
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 0
+align 1
+LABELV $192
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 101
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $191
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 0
+align 1
+LABELV $190
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $189
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 111
+byte 1 108
+byte 1 100
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $188
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $187
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 53
+byte 1 0
+align 1
+LABELV $186
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 70
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $185
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $184
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 84
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $183
+byte 1 56
+byte 1 0
+align 1
+LABELV $182
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $181
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $180
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $179
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $178
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 80
+byte 1 108
+byte 1 117
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $177
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $176
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $175
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 70
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 69
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $174
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $173
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $172
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 79
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $171
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $170
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $169
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $168
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $167
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 86
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $166
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 86
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $165
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 79
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $164
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $163
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $162
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $161
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $160
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $159
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $158
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $157
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 72
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $156
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $155
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $154
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $153
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 65
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $152
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $151
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 82
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $150
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $149
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $148
+byte 1 48
+byte 1 46
+byte 1 52
+byte 1 0
+align 1
+LABELV $147
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $146
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $145
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $144
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $143
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $142
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $141
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $140
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $139
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $138
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $137
+byte 1 48
+byte 1 46
+byte 1 51
+byte 1 0
+align 1
+LABELV $136
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $135
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $134
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $133
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 98
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $132
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 48
+byte 1 53
+byte 1 0
+align 1
+LABELV $131
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $130
+byte 1 48
+byte 1 46
+byte 1 48
+byte 1 48
+byte 1 50
+byte 1 0
+align 1
+LABELV $129
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 112
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $128
+byte 1 51
+byte 1 0
+align 1
+LABELV $127
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $126
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 90
+byte 1 0
+align 1
+LABELV $125
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 89
+byte 1 0
+align 1
+LABELV $124
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 88
+byte 1 0
+align 1
+LABELV $123
+byte 1 52
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $122
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $121
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $120
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $119
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 105
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $118
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $117
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $116
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 89
+byte 1 0
+align 1
+LABELV $115
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 88
+byte 1 0
+align 1
+LABELV $114
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $113
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $112
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 83
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $111
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 82
+byte 1 101
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $110
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $109
+byte 1 52
+byte 1 0
+align 1
+LABELV $108
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $107
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $106
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 65
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $105
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $104
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 51
+byte 1 100
+byte 1 73
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $103
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $102
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 70
+byte 1 80
+byte 1 83
+byte 1 0
+align 1
+LABELV $101
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $100
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $99
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 50
+byte 1 68
+byte 1 0
+align 1
+LABELV $98
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 105
+byte 1 98
+byte 1 115
+byte 1 0
+align 1
+LABELV $97
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 0
+align 1
+LABELV $96
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $95
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $94
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $93
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $92
+byte 1 50
+byte 1 50
+byte 1 46
+byte 1 53
+byte 1 0
+align 1
+LABELV $91
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 122
+byte 1 111
+byte 1 111
+byte 1 109
+byte 1 102
+byte 1 111
+byte 1 118
+byte 1 0
+align 1
+LABELV $90
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $89
+byte 1 49
+byte 1 0
+align 1
+LABELV $88
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $87
+byte 1 48
+byte 1 0
+align 1
+LABELV $86
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $83
+byte 1 118
+byte 1 109
+byte 1 77
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
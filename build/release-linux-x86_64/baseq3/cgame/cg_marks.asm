@@ -0,0 +1,15343 @@
+export CG_InitMarkPolys
+code
+proc CG_InitMarkPolys 12 12
+ADDRGP4 cg_markPolys
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 73728
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 cg_activeMarkPolys+4
+ADDRGP4 cg_activeMarkPolys
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg_activeMarkPolys
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_freeMarkPolys
+ADDRGP4 cg_markPolys
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $73
+ADDRLP4 8
+CNSTI4 288
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_markPolys+4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg_markPolys+288
+ADDP4
+ASGNP4
+LABELV $74
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LTI4 $73
+LABELV $71
+endproc CG_InitMarkPolys 12 12
+export CG_FreeMarkPoly
+proc CG_FreeMarkPoly 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $80
+ADDRGP4 $82
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $80
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_freeMarkPolys
+INDIRP4
+ASGNP4
+ADDRGP4 cg_freeMarkPolys
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $79
+endproc CG_FreeMarkPoly 12 4
+export CG_AllocMark
+proc CG_AllocMark 16 12
+ADDRGP4 cg_freeMarkPolys
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $84
+ADDRLP4 4
+ADDRGP4 cg_activeMarkPolys
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $87
+JUMPV
+LABELV $86
+ADDRGP4 cg_activeMarkPolys
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeMarkPoly
+CALLV
+pop
+LABELV $87
+ADDRLP4 8
+ADDRGP4 cg_activeMarkPolys
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $89
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+EQI4 $86
+LABELV $89
+LABELV $84
+ADDRLP4 8
+ADDRGP4 cg_freeMarkPolys
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 288
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg_activeMarkPolys+4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 cg_activeMarkPolys
+ASGNP4
+ADDRGP4 cg_activeMarkPolys+4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_activeMarkPolys+4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $83
+endproc CG_AllocMark 16 12
+export CG_ImpactMark
+proc CG_ImpactMark 6088 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRFP4 20
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 24
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 28
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 32
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 36
+ADDRFP4 36
+INDIRF4
+ASGNF4
+ADDRFP4 40
+ADDRFP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 cg_addMarks+12
+INDIRI4
+CNSTI4 0
+NEI4 $94
+ADDRGP4 $93
+JUMPV
+LABELV $94
+ADDRFP4 36
+INDIRF4
+CNSTF4 0
+GTF4 $97
+ADDRGP4 $99
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $97
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 48
+CNSTF4 1056964608
+ADDRFP4 36
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+LABELV $105
+ADDRLP4 5752
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 5752
+INDIRI4
+ADDRLP4 4664
+ADDP4
+ADDRLP4 5752
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 5752
+INDIRI4
+ADDRLP4 0+12
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 5752
+INDIRI4
+ADDRLP4 0+24
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 5760
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 5760
+INDIRI4
+ADDRLP4 4664+12
+ADDP4
+ADDRLP4 5760
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 5760
+INDIRI4
+ADDRLP4 0+12
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 5760
+INDIRI4
+ADDRLP4 0+24
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 5768
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 5768
+INDIRI4
+ADDRLP4 4664+24
+ADDP4
+ADDRLP4 5768
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 5768
+INDIRI4
+ADDRLP4 0+12
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 5768
+INDIRI4
+ADDRLP4 0+24
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 5776
+ADDRLP4 44
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 5776
+INDIRI4
+ADDRLP4 4664+36
+ADDP4
+ADDRLP4 5776
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 5776
+INDIRI4
+ADDRLP4 0+12
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ADDRFP4 36
+INDIRF4
+ADDRLP4 5776
+INDIRI4
+ADDRLP4 0+24
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $106
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 3
+LTI4 $105
+ADDRLP4 5752
+CNSTF4 3248488448
+ASGNF4
+ADDRLP4 4716
+ADDRLP4 5752
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4716+4
+ADDRLP4 5752
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4716+8
+CNSTF4 3248488448
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 4664
+ARGP4
+ADDRLP4 4716
+ARGP4
+CNSTI4 384
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 4728
+ARGP4
+ADDRLP4 5760
+ADDRGP4 trap_CM_MarkFragments
+CALLI4
+ASGNI4
+ADDRLP4 4712
+ADDRLP4 5760
+INDIRI4
+ASGNI4
+ADDRLP4 5772
+CNSTF4 1132396544
+ADDRFP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 5776
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 5772
+INDIRF4
+ADDRLP4 5776
+INDIRF4
+LTF4 $123
+ADDRLP4 5764
+ADDRLP4 5772
+INDIRF4
+ADDRLP4 5776
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRLP4 5764
+ADDRLP4 5772
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $124
+ADDRLP4 52
+ADDRLP4 5764
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 5780
+CNSTF4 1132396544
+ADDRFP4 20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 5784
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 5780
+INDIRF4
+ADDRLP4 5784
+INDIRF4
+LTF4 $127
+ADDRLP4 5768
+ADDRLP4 5780
+INDIRF4
+ADDRLP4 5784
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $128
+JUMPV
+LABELV $127
+ADDRLP4 5768
+ADDRLP4 5780
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $128
+ADDRLP4 52+1
+ADDRLP4 5768
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 5792
+CNSTF4 1132396544
+ADDRFP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 5796
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 5792
+INDIRF4
+ADDRLP4 5796
+INDIRF4
+LTF4 $131
+ADDRLP4 5788
+ADDRLP4 5792
+INDIRF4
+ADDRLP4 5796
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $132
+JUMPV
+LABELV $131
+ADDRLP4 5788
+ADDRLP4 5792
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $132
+ADDRLP4 52+2
+ADDRLP4 5788
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 5804
+CNSTF4 1132396544
+ADDRFP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 5808
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 5804
+INDIRF4
+ADDRLP4 5808
+INDIRF4
+LTF4 $135
+ADDRLP4 5800
+ADDRLP4 5804
+INDIRF4
+ADDRLP4 5808
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRLP4 5800
+ADDRLP4 5804
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $136
+ADDRLP4 52+3
+ADDRLP4 5800
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+ADDRLP4 4728
+ASGNP4
+ADDRGP4 $140
+JUMPV
+LABELV $137
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $141
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+LABELV $141
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 5812
+ADDRLP4 5820
+ASGNP4
+ADDRGP4 $146
+JUMPV
+LABELV $143
+ADDRLP4 5812
+INDIRP4
+CNSTI4 12
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+MULI4
+ADDRLP4 56
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 6060
+ADDRLP4 5812
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 6080
+CNSTI4 4
+ASGNI4
+ADDRLP4 6060+4
+ADDRLP4 5812
+INDIRP4
+ADDRLP4 6080
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 6080
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 6084
+CNSTI4 8
+ASGNI4
+ADDRLP4 6060+8
+ADDRLP4 5812
+INDIRP4
+ADDRLP4 6084
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 6084
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 5812
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 6060
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+MULF4
+ADDRLP4 6060+4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 6060+8
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 48
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 5812
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 6060
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+MULF4
+ADDRLP4 6060+4
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 6060+8
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 48
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 5812
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+LABELV $144
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 5812
+ADDRLP4 5812
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+LABELV $146
+ADDRLP4 36
+INDIRI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $143
+ADDRFP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $163
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 5820
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRGP4 $138
+JUMPV
+LABELV $163
+ADDRLP4 6060
+ADDRGP4 CG_AllocMark
+CALLP4
+ASGNP4
+ADDRLP4 5816
+ADDRLP4 6060
+INDIRP4
+ASGNP4
+ADDRLP4 5816
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 5816
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 5816
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 5816
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 5816
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 5816
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 5816
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 5816
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 5816
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRLP4 5820
+ARGP4
+CNSTU4 24
+ADDRLP4 40
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 6064
+ADDRGP4 markTotal
+ASGNP4
+ADDRLP4 6064
+INDIRP4
+ADDRLP4 6064
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $138
+ADDRLP4 44
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 40
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+LABELV $140
+ADDRLP4 44
+INDIRI4
+ADDRLP4 4712
+INDIRI4
+LTI4 $137
+LABELV $93
+endproc CG_ImpactMark 6088 28
+export CG_AddMarks
+proc CG_AddMarks 84 12
+ADDRGP4 cg_addMarks+12
+INDIRI4
+CNSTI4 0
+NEI4 $167
+ADDRGP4 $166
+JUMPV
+LABELV $167
+ADDRLP4 0
+ADDRGP4 cg_activeMarkPolys+4
+INDIRP4
+ASGNP4
+ADDRGP4 $174
+JUMPV
+LABELV $171
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 10000
+ADDI4
+LEI4 $175
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_FreeMarkPoly
+CALLV
+pop
+ADDRGP4 $172
+JUMPV
+LABELV $175
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRGP4 cgs+152340+388
+INDIRI4
+NEI4 $178
+ADDRLP4 24
+CNSTF4 1138819072
+ASGNF4
+ADDRLP4 8
+ADDRLP4 24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1161527296
+DIVF4
+MULF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 255
+GEI4 $183
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $185
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $185
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 0
+EQI4 $187
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $192
+JUMPV
+LABELV $189
+ADDRLP4 36
+CNSTI4 20
+ASGNI4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 44
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+LTF4 $194
+ADDRLP4 28
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $195
+JUMPV
+LABELV $194
+ADDRLP4 28
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $195
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRLP4 28
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 56
+CNSTI4 24
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 64
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 64
+INDIRF4
+LTF4 $197
+ADDRLP4 48
+ADDRLP4 60
+INDIRF4
+ADDRLP4 64
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $198
+JUMPV
+LABELV $197
+ADDRLP4 48
+ADDRLP4 60
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $198
+ADDRLP4 56
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 48
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 76
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 80
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 76
+INDIRF4
+ADDRLP4 80
+INDIRF4
+LTF4 $200
+ADDRLP4 68
+ADDRLP4 76
+INDIRF4
+ADDRLP4 80
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $201
+JUMPV
+LABELV $200
+ADDRLP4 68
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $201
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 68
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $190
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $192
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+LTI4 $189
+LABELV $187
+LABELV $183
+LABELV $178
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 10000
+ADDI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000
+GEI4 $203
+ADDRLP4 8
+CNSTI4 255
+ADDRLP4 12
+INDIRI4
+MULI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $205
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $210
+JUMPV
+LABELV $207
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+CNSTI4 23
+ADDP4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+LABELV $208
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $210
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+LTI4 $207
+ADDRGP4 $206
+JUMPV
+LABELV $205
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $214
+JUMPV
+LABELV $211
+ADDRLP4 32
+CNSTI4 20
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+LTF4 $216
+ADDRLP4 24
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $217
+JUMPV
+LABELV $216
+ADDRLP4 24
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $217
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRLP4 24
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 52
+CNSTI4 24
+ASGNI4
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+LTF4 $219
+ADDRLP4 44
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $220
+JUMPV
+LABELV $219
+ADDRLP4 44
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $220
+ADDRLP4 52
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 44
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 76
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+LTF4 $222
+ADDRLP4 64
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRLP4 64
+ADDRLP4 72
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $223
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 64
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $212
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $214
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+LTI4 $211
+LABELV $206
+LABELV $203
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $172
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+LABELV $174
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 cg_activeMarkPolys
+CVPU4 4
+NEU4 $171
+LABELV $166
+endproc CG_AddMarks 84 12
+data
+align 4
+LABELV shaderAnimNames
+address $225
+byte 4 0
+skip 120
+align 4
+LABELV shaderAnimCounts
+byte 4 23
+skip 124
+align 4
+LABELV shaderAnimSTRatio
+byte 4 1065353216
+skip 124
+export cl_numparticles
+align 4
+LABELV cl_numparticles
+byte 4 1024
+export initparticles
+align 4
+LABELV initparticles
+byte 4 0
+export CG_ClearParticles
+code
+proc CG_ClearParticles 28 12
+ADDRGP4 particles
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 126976
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 free_particles
+ADDRGP4 particles
+ASGNP4
+ADDRGP4 active_particles
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $230
+JUMPV
+LABELV $227
+ADDRLP4 4
+CNSTI4 124
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 particles
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 particles+124
+ADDP4
+ASGNP4
+CNSTI4 124
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 particles+64
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $228
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $230
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cl_numparticles
+INDIRI4
+LTI4 $227
+CNSTI4 124
+ADDRGP4 cl_numparticles
+INDIRI4
+MULI4
+ADDRGP4 particles-124
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 oldtime
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $238
+JUMPV
+LABELV $235
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $239
+ADDRGP4 $243
+ARGP4
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRGP4 shaderAnimNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 shaderAnims
+ADDP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $240
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $242
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimCounts
+ADDP4
+INDIRI4
+LTI4 $239
+LABELV $236
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $238
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimNames
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $235
+ADDRGP4 numShaderAnims
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 initparticles
+CNSTI4 1
+ASGNI4
+LABELV $226
+endproc CG_ClearParticles 28 12
+export CG_AddParticleToScene
+proc CG_AddParticleToScene 476 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 240
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 1
+EQI4 $250
+ADDRLP4 240
+INDIRI4
+CNSTI4 5
+EQI4 $250
+ADDRLP4 240
+INDIRI4
+CNSTI4 11
+EQI4 $250
+ADDRLP4 240
+INDIRI4
+CNSTI4 13
+EQI4 $250
+ADDRLP4 240
+INDIRI4
+CNSTI4 14
+NEI4 $245
+LABELV $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 11
+EQI4 $251
+ADDRLP4 244
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 13
+EQI4 $255
+ADDRLP4 244
+INDIRI4
+CNSTI4 14
+NEI4 $253
+LABELV $255
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+LEF4 $254
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 248
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 248
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 14
+NEI4 $254
+ADDRLP4 256
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 256
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 260
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 260
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRGP4 $254
+JUMPV
+LABELV $253
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+GEF4 $261
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 $265
+JUMPV
+LABELV $264
+ADDRLP4 252
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 252
+INDIRP4
+ADDRLP4 252
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+LABELV $265
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+LTF4 $264
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $267
+ADDRLP4 252
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 252
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 256
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 256
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $267
+LABELV $261
+LABELV $254
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $269
+ADDRGP4 $244
+JUMPV
+LABELV $269
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $251
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 244
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 244
+INDIRF4
+CNSTF4 1149239296
+LEF4 $271
+ADDRGP4 $244
+JUMPV
+LABELV $271
+ADDRLP4 248
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 13
+EQI4 $276
+ADDRLP4 248
+INDIRI4
+CNSTI4 14
+NEI4 $274
+LABELV $276
+ADDRLP4 256
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 256
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 256
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 260
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvright
+INDIRF4
+ADDRLP4 260
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvright+4
+INDIRF4
+ADDRLP4 260
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 268
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+LTF4 $298
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $299
+JUMPV
+LABELV $298
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $299
+ADDRLP4 12+20+3
+ADDRLP4 264
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 280
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 280
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 284
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvright
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvright+4
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 292
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 296
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+LTF4 $328
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $329
+JUMPV
+LABELV $328
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $329
+ADDRLP4 12+24+20+3
+ADDRLP4 288
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvright
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvright+4
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 316
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 320
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+LTF4 $358
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $359
+JUMPV
+LABELV $358
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $359
+ADDRLP4 12+48+20+3
+ADDRLP4 312
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 328
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 328
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 328
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvright
+INDIRF4
+ADDRLP4 332
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvright+4
+INDIRF4
+ADDRLP4 332
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+72
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 340
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 344
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 340
+INDIRF4
+ADDRLP4 344
+INDIRF4
+LTF4 $388
+ADDRLP4 336
+ADDRLP4 340
+INDIRF4
+ADDRLP4 344
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $389
+JUMPV
+LABELV $388
+ADDRLP4 336
+ADDRLP4 340
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $389
+ADDRLP4 12+72+20+3
+ADDRLP4 336
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $246
+JUMPV
+LABELV $274
+ADDRLP4 256
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 256
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 256
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 260
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvright
+INDIRF4
+ADDRLP4 260
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvright+4
+INDIRF4
+ADDRLP4 260
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 108+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 108+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 108+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 268
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 272
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+LTF4 $411
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $412
+JUMPV
+LABELV $411
+ADDRLP4 264
+ADDRLP4 268
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $412
+ADDRLP4 108+20+3
+ADDRLP4 264
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 280
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 280
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 284
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvright
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvright+4
+INDIRF4
+ADDRLP4 284
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 108+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 108+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 108+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 292
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 296
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+LTF4 $441
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $442
+JUMPV
+LABELV $441
+ADDRLP4 288
+ADDRLP4 292
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $442
+ADDRLP4 108+24+20+3
+ADDRLP4 288
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 304
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvright
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvright+4
+INDIRF4
+ADDRLP4 308
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 108+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 108+48+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 108+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 108+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 108+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 316
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 320
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+LTF4 $471
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $472
+JUMPV
+LABELV $471
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $472
+ADDRLP4 108+48+20+3
+ADDRLP4 312
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $246
+JUMPV
+LABELV $245
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 15
+NEI4 $473
+ADDRLP4 280
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 184
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 288
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 232
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 296
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRLP4 292
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 300
+INDIRF4
+ADDRLP4 296
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRLP4 300
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $478
+ADDRGP4 cg+109044+36
+ARGP4
+ADDRLP4 268
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 268+8
+ADDRLP4 268+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 268
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 244
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $478
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $483
+ADDRLP4 308
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 244+4
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 244+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 312
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 256
+INDIRF4
+ADDRLP4 312
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 256+4
+INDIRF4
+ADDRLP4 312
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 256+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $484
+JUMPV
+LABELV $483
+ADDRLP4 308
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 312
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvright
+INDIRF4
+ADDRLP4 312
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvright+4
+INDIRF4
+ADDRLP4 312
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvright+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $484
+ADDRLP4 12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $515
+ADDRLP4 304
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 244+4
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 244+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $516
+JUMPV
+LABELV $515
+ADDRLP4 304
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $516
+ADDRLP4 12+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $546
+ADDRLP4 304
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 256
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 256+4
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 256+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $547
+JUMPV
+LABELV $546
+ADDRLP4 304
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvright
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvright+4
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvright+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $547
+ADDRLP4 12+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $577
+ADDRLP4 304
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 244
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 244+4
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 244+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $578
+JUMPV
+LABELV $577
+ADDRLP4 304
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $578
+ADDRLP4 12+72
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $474
+JUMPV
+LABELV $473
+ADDRLP4 244
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 3
+EQI4 $610
+ADDRLP4 244
+INDIRI4
+CNSTI4 12
+NEI4 $608
+LABELV $610
+ADDRLP4 248
+CNSTI4 64
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 248
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 12
+NEI4 $611
+ADDRGP4 cg+36
+INDIRP4
+ADDRLP4 248
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 252
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 252
+INDIRF4
+CNSTF4 1149239296
+LEF4 $611
+ADDRGP4 $244
+JUMPV
+LABELV $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $614
+ADDRLP4 184
+CNSTF4 1046562734
+ASGNF4
+ADDRLP4 184+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 184+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $615
+JUMPV
+LABELV $614
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $618
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 260
+ADDRLP4 268
+INDIRF4
+ASGNF4
+ADDRLP4 260
+INDIRF4
+CNSTF4 0
+NEF4 $621
+ADDRLP4 260
+CNSTF4 1065353216
+ASGNF4
+LABELV $621
+ADDRLP4 264
+CNSTF4 1166016512
+ADDRLP4 260
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 256
+CNSTF4 1048576000
+ADDRLP4 264
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 256
+INDIRF4
+CNSTF4 1056964608
+LEF4 $623
+ADDRLP4 256
+CNSTF4 1056964608
+ASGNF4
+LABELV $623
+ADDRLP4 272
+ADDRLP4 256
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+ADDRLP4 256
+INDIRF4
+ASGNF4
+ADDRGP4 $619
+JUMPV
+LABELV $618
+ADDRLP4 256
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 184
+ADDRLP4 256
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 256
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+CNSTF4 1065353216
+ASGNF4
+LABELV $619
+LABELV $615
+ADDRLP4 264
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 232
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 264
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 264
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+LEF4 $630
+ADDRLP4 272
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 204
+CNSTF4 1065353216
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 272
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+DIVF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $634
+ADDRLP4 280
+ADDRLP4 204
+INDIRF4
+ASGNF4
+ADDRLP4 276
+ADDRLP4 280
+INDIRF4
+ADDRLP4 280
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 276
+INDIRF4
+CNSTF4 0
+GEF4 $636
+ADDRLP4 276
+CNSTF4 0
+ASGNF4
+LABELV $636
+ADDRLP4 284
+ADDRLP4 276
+INDIRF4
+ASGNF4
+ADDRLP4 184
+ADDRLP4 284
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 284
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+ADDRLP4 276
+INDIRF4
+ASGNF4
+LABELV $634
+ADDRLP4 204
+ADDRLP4 204
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $631
+JUMPV
+LABELV $630
+ADDRLP4 204
+CNSTF4 1065353216
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $631
+ADDRGP4 cgs+20100+11288
+INDIRI4
+CNSTI4 3
+NEI4 $640
+ADDRLP4 204
+CNSTF4 1065353216
+ASGNF4
+LABELV $640
+ADDRLP4 204
+INDIRF4
+CNSTF4 1065353216
+LEF4 $644
+ADDRLP4 204
+CNSTF4 1065353216
+ASGNF4
+LABELV $644
+ADDRLP4 272
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 276
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 272
+INDIRF4
+ADDRLP4 276
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRLP4 272
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 280
+INDIRF4
+ADDRLP4 276
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRLP4 280
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 12
+EQI4 $646
+ADDRGP4 rforward
+ARGP4
+ADDRLP4 284
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 300
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 284+8
+ADDRLP4 284+8
+INDIRF4
+CNSTF4 1036831949
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 284
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 208
+ARGP4
+ADDRLP4 220
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 $647
+JUMPV
+LABELV $646
+ADDRLP4 208
+ADDRGP4 rright
+INDIRB
+ASGNB 12
+ADDRLP4 220
+ADDRGP4 rup
+INDIRB
+ASGNB 12
+LABELV $647
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $649
+ADDRLP4 288
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 288
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 220+4
+INDIRF4
+ADDRLP4 288
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 220+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 208+4
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 208+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $650
+JUMPV
+LABELV $649
+ADDRLP4 288
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvright
+INDIRF4
+ADDRLP4 292
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvright+4
+INDIRF4
+ADDRLP4 292
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $650
+ADDRLP4 12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 288
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 292
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 288
+INDIRF4
+ADDRLP4 292
+INDIRF4
+LTF4 $676
+ADDRLP4 284
+ADDRLP4 288
+INDIRF4
+ADDRLP4 292
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $677
+JUMPV
+LABELV $676
+ADDRLP4 284
+ADDRLP4 288
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $677
+ADDRLP4 12+20
+ADDRLP4 284
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 300
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 304
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 300
+INDIRF4
+ADDRLP4 304
+INDIRF4
+LTF4 $682
+ADDRLP4 296
+ADDRLP4 300
+INDIRF4
+ADDRLP4 304
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $683
+JUMPV
+LABELV $682
+ADDRLP4 296
+ADDRLP4 300
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $683
+ADDRLP4 12+20+1
+ADDRLP4 296
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 312
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 316
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 312
+INDIRF4
+ADDRLP4 316
+INDIRF4
+LTF4 $688
+ADDRLP4 308
+ADDRLP4 312
+INDIRF4
+ADDRLP4 316
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $689
+JUMPV
+LABELV $688
+ADDRLP4 308
+ADDRLP4 312
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $689
+ADDRLP4 12+20+2
+ADDRLP4 308
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 324
+CNSTF4 1132396544
+ADDRLP4 204
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 328
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 324
+INDIRF4
+ADDRLP4 328
+INDIRF4
+LTF4 $693
+ADDRLP4 320
+ADDRLP4 324
+INDIRF4
+ADDRLP4 328
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $694
+JUMPV
+LABELV $693
+ADDRLP4 320
+ADDRLP4 324
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $694
+ADDRLP4 12+20+3
+ADDRLP4 320
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $695
+ADDRLP4 336
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 220+4
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 220+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 340
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 340
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 208+4
+INDIRF4
+ADDRLP4 340
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 208+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $696
+JUMPV
+LABELV $695
+ADDRLP4 336
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 336
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 336
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 340
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvright
+INDIRF4
+ADDRLP4 340
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvright+4
+INDIRF4
+ADDRLP4 340
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $696
+ADDRLP4 12+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 336
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 340
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 336
+INDIRF4
+ADDRLP4 340
+INDIRF4
+LTF4 $726
+ADDRLP4 332
+ADDRLP4 336
+INDIRF4
+ADDRLP4 340
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $727
+JUMPV
+LABELV $726
+ADDRLP4 332
+ADDRLP4 336
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $727
+ADDRLP4 12+24+20
+ADDRLP4 332
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 348
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 352
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 348
+INDIRF4
+ADDRLP4 352
+INDIRF4
+LTF4 $733
+ADDRLP4 344
+ADDRLP4 348
+INDIRF4
+ADDRLP4 352
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $734
+JUMPV
+LABELV $733
+ADDRLP4 344
+ADDRLP4 348
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $734
+ADDRLP4 12+24+20+1
+ADDRLP4 344
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 360
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 364
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 360
+INDIRF4
+ADDRLP4 364
+INDIRF4
+LTF4 $740
+ADDRLP4 356
+ADDRLP4 360
+INDIRF4
+ADDRLP4 364
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $741
+JUMPV
+LABELV $740
+ADDRLP4 356
+ADDRLP4 360
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $741
+ADDRLP4 12+24+20+2
+ADDRLP4 356
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 372
+CNSTF4 1132396544
+ADDRLP4 204
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 376
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 372
+INDIRF4
+ADDRLP4 376
+INDIRF4
+LTF4 $746
+ADDRLP4 368
+ADDRLP4 372
+INDIRF4
+ADDRLP4 376
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $747
+JUMPV
+LABELV $746
+ADDRLP4 368
+ADDRLP4 372
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $747
+ADDRLP4 12+24+20+3
+ADDRLP4 368
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $748
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 220+4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 220+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 388
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 388
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 208+4
+INDIRF4
+ADDRLP4 388
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 208+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $749
+JUMPV
+LABELV $748
+ADDRLP4 384
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 384
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 384
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 388
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvright
+INDIRF4
+ADDRLP4 388
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvright+4
+INDIRF4
+ADDRLP4 388
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $749
+ADDRLP4 12+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 384
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 388
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 384
+INDIRF4
+ADDRLP4 388
+INDIRF4
+LTF4 $779
+ADDRLP4 380
+ADDRLP4 384
+INDIRF4
+ADDRLP4 388
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $780
+JUMPV
+LABELV $779
+ADDRLP4 380
+ADDRLP4 384
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $780
+ADDRLP4 12+48+20
+ADDRLP4 380
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 396
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 400
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 396
+INDIRF4
+ADDRLP4 400
+INDIRF4
+LTF4 $786
+ADDRLP4 392
+ADDRLP4 396
+INDIRF4
+ADDRLP4 400
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $787
+JUMPV
+LABELV $786
+ADDRLP4 392
+ADDRLP4 396
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $787
+ADDRLP4 12+48+20+1
+ADDRLP4 392
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 408
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 412
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 408
+INDIRF4
+ADDRLP4 412
+INDIRF4
+LTF4 $793
+ADDRLP4 404
+ADDRLP4 408
+INDIRF4
+ADDRLP4 412
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $794
+JUMPV
+LABELV $793
+ADDRLP4 404
+ADDRLP4 408
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $794
+ADDRLP4 12+48+20+2
+ADDRLP4 404
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 420
+CNSTF4 1132396544
+ADDRLP4 204
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 424
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 420
+INDIRF4
+ADDRLP4 424
+INDIRF4
+LTF4 $799
+ADDRLP4 416
+ADDRLP4 420
+INDIRF4
+ADDRLP4 424
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $800
+JUMPV
+LABELV $799
+ADDRLP4 416
+ADDRLP4 420
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $800
+ADDRLP4 12+48+20+3
+ADDRLP4 416
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $801
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 220
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 220+4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 220+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 436
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 208
+INDIRF4
+ADDRLP4 436
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 208+4
+INDIRF4
+ADDRLP4 436
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 208+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $802
+JUMPV
+LABELV $801
+ADDRLP4 432
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 432
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 432
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 436
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvright
+INDIRF4
+ADDRLP4 436
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvright+4
+INDIRF4
+ADDRLP4 436
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvright+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $802
+ADDRLP4 12+72
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 432
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 436
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 432
+INDIRF4
+ADDRLP4 436
+INDIRF4
+LTF4 $832
+ADDRLP4 428
+ADDRLP4 432
+INDIRF4
+ADDRLP4 436
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $833
+JUMPV
+LABELV $832
+ADDRLP4 428
+ADDRLP4 432
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $833
+ADDRLP4 12+72+20
+ADDRLP4 428
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 444
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 448
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 444
+INDIRF4
+ADDRLP4 448
+INDIRF4
+LTF4 $839
+ADDRLP4 440
+ADDRLP4 444
+INDIRF4
+ADDRLP4 448
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $840
+JUMPV
+LABELV $839
+ADDRLP4 440
+ADDRLP4 444
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $840
+ADDRLP4 12+72+20+1
+ADDRLP4 440
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 456
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 460
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 456
+INDIRF4
+ADDRLP4 460
+INDIRF4
+LTF4 $846
+ADDRLP4 452
+ADDRLP4 456
+INDIRF4
+ADDRLP4 460
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $847
+JUMPV
+LABELV $846
+ADDRLP4 452
+ADDRLP4 456
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $847
+ADDRLP4 12+72+20+2
+ADDRLP4 452
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 468
+CNSTF4 1132396544
+ADDRLP4 204
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 472
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 468
+INDIRF4
+ADDRLP4 472
+INDIRF4
+LTF4 $852
+ADDRLP4 464
+ADDRLP4 468
+INDIRF4
+ADDRLP4 472
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $853
+JUMPV
+LABELV $852
+ADDRLP4 464
+ADDRLP4 468
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $853
+ADDRLP4 12+72+20+3
+ADDRLP4 464
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $609
+JUMPV
+LABELV $608
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $854
+ADDRLP4 272
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 cgs+20100+11288
+INDIRI4
+CNSTI4 3
+NEI4 $856
+ADDRLP4 272
+CNSTF4 1065353216
+ASGNF4
+LABELV $856
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $860
+ADDRGP4 cg+109044+36
+ARGP4
+ADDRLP4 276
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 276+8
+ADDRLP4 276+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 276
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 248
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 $861
+JUMPV
+LABELV $860
+ADDRLP4 260
+ADDRGP4 pvup
+INDIRB
+ASGNB 12
+ADDRLP4 248
+ADDRGP4 pvright
+INDIRB
+ASGNB 12
+LABELV $861
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 260
+INDIRF4
+ADDRLP4 292
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 292
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 260+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+20
+CNSTU1 111
+ASGNU1
+ADDRLP4 12+20+1
+CNSTU1 19
+ASGNU1
+ADDRLP4 12+20+2
+CNSTU1 9
+ASGNU1
+ADDRLP4 304
+CNSTF4 1132396544
+ADDRLP4 272
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 308
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+LTF4 $886
+ADDRLP4 300
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $887
+JUMPV
+LABELV $886
+ADDRLP4 300
+ADDRLP4 304
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $887
+ADDRLP4 12+20+3
+ADDRLP4 300
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 260
+INDIRF4
+ADDRLP4 316
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 316
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 260+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 320
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 320
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+24+20
+CNSTU1 111
+ASGNU1
+ADDRLP4 12+24+20+1
+CNSTU1 19
+ASGNU1
+ADDRLP4 12+24+20+2
+CNSTU1 9
+ASGNU1
+ADDRLP4 328
+CNSTF4 1132396544
+ADDRLP4 272
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 332
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 328
+INDIRF4
+ADDRLP4 332
+INDIRF4
+LTF4 $916
+ADDRLP4 324
+ADDRLP4 328
+INDIRF4
+ADDRLP4 332
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $917
+JUMPV
+LABELV $916
+ADDRLP4 324
+ADDRLP4 328
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $917
+ADDRLP4 12+24+20+3
+ADDRLP4 324
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 340
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 260
+INDIRF4
+ADDRLP4 340
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 340
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 260+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 344
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 344
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 344
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+20
+CNSTU1 111
+ASGNU1
+ADDRLP4 12+48+20+1
+CNSTU1 19
+ASGNU1
+ADDRLP4 12+48+20+2
+CNSTU1 9
+ASGNU1
+ADDRLP4 352
+CNSTF4 1132396544
+ADDRLP4 272
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 356
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 352
+INDIRF4
+ADDRLP4 356
+INDIRF4
+LTF4 $946
+ADDRLP4 348
+ADDRLP4 352
+INDIRF4
+ADDRLP4 356
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $947
+JUMPV
+LABELV $946
+ADDRLP4 348
+ADDRLP4 352
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $947
+ADDRLP4 12+48+20+3
+ADDRLP4 348
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 364
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 260
+INDIRF4
+ADDRLP4 364
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 364
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 260+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 368
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 368
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 368
+INDIRP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+72
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+72+20
+CNSTU1 111
+ASGNU1
+ADDRLP4 12+72+20+1
+CNSTU1 19
+ASGNU1
+ADDRLP4 12+72+20+2
+CNSTU1 9
+ASGNU1
+ADDRLP4 376
+CNSTF4 1132396544
+ADDRLP4 272
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 380
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 376
+INDIRF4
+ADDRLP4 380
+INDIRF4
+LTF4 $976
+ADDRLP4 372
+ADDRLP4 376
+INDIRF4
+ADDRLP4 380
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $977
+JUMPV
+LABELV $976
+ADDRLP4 372
+ADDRLP4 376
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $977
+ADDRLP4 12+72+20+3
+ADDRLP4 372
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRGP4 $855
+JUMPV
+LABELV $854
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $978
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $980
+ADDRLP4 264
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 184
+ADDRLP4 264
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 264
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $981
+JUMPV
+LABELV $980
+ADDRLP4 268
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 184
+ADDRLP4 268
+INDIRF4
+ASGNF4
+ADDRLP4 184+4
+ADDRLP4 268
+INDIRF4
+ASGNF4
+ADDRLP4 184+8
+CNSTF4 1056964608
+ASGNF4
+LABELV $981
+ADDRLP4 276
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 232
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 276
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 276
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 284
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 288
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ASGNP4
+ADDRLP4 256
+ADDRLP4 280
+INDIRF4
+ADDRLP4 284
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+ADDRLP4 280
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 260
+ADDRLP4 292
+INDIRF4
+ADDRLP4 284
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRLP4 292
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 256
+INDIRF4
+ADDRLP4 288
+INDIRP4
+INDIRF4
+LEF4 $987
+ADDRLP4 256
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $987
+ADDRLP4 260
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+LEF4 $989
+ADDRLP4 260
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $989
+CNSTF4 1078530011
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 296
+ADDRGP4 sin
+CALLF4
+ASGNF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 300
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 248
+ADDRLP4 260
+INDIRF4
+ADDRLP4 296
+INDIRF4
+MULF4
+ADDRLP4 300
+INDIRF4
+MULF4
+ASGNF4
+CNSTF4 1078530011
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ARGF4
+ADDRLP4 304
+ADDRGP4 cos
+CALLF4
+ASGNF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 308
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 256
+INDIRF4
+ADDRLP4 304
+INDIRF4
+MULF4
+ADDRLP4 308
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 248
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 252
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 316
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 320
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+LTF4 $997
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+ADDRLP4 320
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $998
+JUMPV
+LABELV $997
+ADDRLP4 312
+ADDRLP4 316
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $998
+ADDRLP4 12+20
+ADDRLP4 312
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 328
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 332
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 328
+INDIRF4
+ADDRLP4 332
+INDIRF4
+LTF4 $1003
+ADDRLP4 324
+ADDRLP4 328
+INDIRF4
+ADDRLP4 332
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1004
+JUMPV
+LABELV $1003
+ADDRLP4 324
+ADDRLP4 328
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1004
+ADDRLP4 12+20+1
+ADDRLP4 324
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 340
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 344
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 340
+INDIRF4
+ADDRLP4 344
+INDIRF4
+LTF4 $1009
+ADDRLP4 336
+ADDRLP4 340
+INDIRF4
+ADDRLP4 344
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1010
+JUMPV
+LABELV $1009
+ADDRLP4 336
+ADDRLP4 340
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1010
+ADDRLP4 12+20+2
+ADDRLP4 336
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 12+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+24
+ADDRLP4 12+24
+INDIRF4
+ADDRLP4 252
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+24+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 352
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 356
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 352
+INDIRF4
+ADDRLP4 356
+INDIRF4
+LTF4 $1025
+ADDRLP4 348
+ADDRLP4 352
+INDIRF4
+ADDRLP4 356
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1026
+JUMPV
+LABELV $1025
+ADDRLP4 348
+ADDRLP4 352
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1026
+ADDRLP4 12+24+20
+ADDRLP4 348
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 364
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 368
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 364
+INDIRF4
+ADDRLP4 368
+INDIRF4
+LTF4 $1032
+ADDRLP4 360
+ADDRLP4 364
+INDIRF4
+ADDRLP4 368
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1033
+JUMPV
+LABELV $1032
+ADDRLP4 360
+ADDRLP4 364
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1033
+ADDRLP4 12+24+20+1
+ADDRLP4 360
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 376
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 380
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 376
+INDIRF4
+ADDRLP4 380
+INDIRF4
+LTF4 $1039
+ADDRLP4 372
+ADDRLP4 376
+INDIRF4
+ADDRLP4 380
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1040
+JUMPV
+LABELV $1039
+ADDRLP4 372
+ADDRLP4 376
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1040
+ADDRLP4 12+24+20+2
+ADDRLP4 372
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 12+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+48
+ADDRLP4 12+48
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48+4
+ADDRLP4 12+48+4
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 388
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 392
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 388
+INDIRF4
+ADDRLP4 392
+INDIRF4
+LTF4 $1056
+ADDRLP4 384
+ADDRLP4 388
+INDIRF4
+ADDRLP4 392
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1057
+JUMPV
+LABELV $1056
+ADDRLP4 384
+ADDRLP4 388
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1057
+ADDRLP4 12+48+20
+ADDRLP4 384
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 400
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 404
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 400
+INDIRF4
+ADDRLP4 404
+INDIRF4
+LTF4 $1063
+ADDRLP4 396
+ADDRLP4 400
+INDIRF4
+ADDRLP4 404
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1064
+JUMPV
+LABELV $1063
+ADDRLP4 396
+ADDRLP4 400
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1064
+ADDRLP4 12+48+20+1
+ADDRLP4 396
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 412
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 416
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 412
+INDIRF4
+ADDRLP4 416
+INDIRF4
+LTF4 $1070
+ADDRLP4 408
+ADDRLP4 412
+INDIRF4
+ADDRLP4 416
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1071
+JUMPV
+LABELV $1070
+ADDRLP4 408
+ADDRLP4 412
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1071
+ADDRLP4 12+48+20+2
+ADDRLP4 408
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 12+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+72
+ADDRLP4 12+72
+INDIRF4
+ADDRLP4 252
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+72+4
+ADDRLP4 12+72+4
+INDIRF4
+ADDRLP4 248
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 424
+CNSTF4 1132396544
+ADDRLP4 184
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 428
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 424
+INDIRF4
+ADDRLP4 428
+INDIRF4
+LTF4 $1087
+ADDRLP4 420
+ADDRLP4 424
+INDIRF4
+ADDRLP4 428
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1088
+JUMPV
+LABELV $1087
+ADDRLP4 420
+ADDRLP4 424
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1088
+ADDRLP4 12+72+20
+ADDRLP4 420
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 436
+CNSTF4 1132396544
+ADDRLP4 184+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 440
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 436
+INDIRF4
+ADDRLP4 440
+INDIRF4
+LTF4 $1094
+ADDRLP4 432
+ADDRLP4 436
+INDIRF4
+ADDRLP4 440
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1095
+JUMPV
+LABELV $1094
+ADDRLP4 432
+ADDRLP4 436
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1095
+ADDRLP4 12+72+20+1
+ADDRLP4 432
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 448
+CNSTF4 1132396544
+ADDRLP4 184+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 452
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 448
+INDIRF4
+ADDRLP4 452
+INDIRF4
+LTF4 $1101
+ADDRLP4 444
+ADDRLP4 448
+INDIRF4
+ADDRLP4 452
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1102
+JUMPV
+LABELV $1101
+ADDRLP4 444
+ADDRLP4 448
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1102
+ADDRLP4 12+72+20+2
+ADDRLP4 444
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 12+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $979
+JUMPV
+LABELV $978
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $1106
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+24
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+24+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+48
+ADDRLP4 12+48
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48+4
+ADDRLP4 12+48+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+72
+ADDRLP4 12+72
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+72+4
+ADDRLP4 12+72+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1107
+JUMPV
+LABELV $1106
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1179
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 232
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 296
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 200
+ADDRLP4 232
+INDIRF4
+ADDRLP4 236
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 200
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1182
+ADDRLP4 200
+CNSTF4 1065351538
+ASGNF4
+LABELV $1182
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 308
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 196
+ADDRLP4 304
+INDIRF4
+ADDRLP4 308
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRLP4 304
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 312
+INDIRF4
+ADDRLP4 308
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRLP4 312
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 316
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 316
+INDIRF4
+ADDRLP4 196
+INDIRF4
+CNSTF4 1069547520
+DIVF4
+GEF4 $1184
+ADDRGP4 $244
+JUMPV
+LABELV $1184
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 272
+ADDRLP4 320
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 200
+INDIRF4
+ADDRLP4 320
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimCounts
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 324
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 276
+ADDRLP4 324
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 276
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRGP4 shaderAnims
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1187
+ADDRGP4 cg+109044+36
+ARGP4
+ADDRLP4 280
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 280+8
+ADDRLP4 280+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 280
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 248
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $1187
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1192
+ADDRLP4 332
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 336
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 260
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 260+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1193
+JUMPV
+LABELV $1192
+ADDRLP4 332
+ADDRLP4 180
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 332
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+ADDRLP4 180
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 336
+ADDRLP4 196
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvright
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvright+4
+INDIRF4
+ADDRLP4 336
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvright+8
+INDIRF4
+ADDRLP4 196
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1193
+ADDRLP4 12
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1224
+ADDRLP4 328
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1225
+JUMPV
+LABELV $1224
+ADDRLP4 328
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1225
+ADDRLP4 12+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1255
+ADDRLP4 328
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 260
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 260+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1256
+JUMPV
+LABELV $1255
+ADDRLP4 328
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvright
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvright+4
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvright+8
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 196
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1256
+ADDRLP4 12+48
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1286
+ADDRLP4 328
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 248
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 248+4
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 248+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1287
+JUMPV
+LABELV $1286
+ADDRLP4 328
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRGP4 pvup
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 pvup+4
+INDIRF4
+ADDRLP4 328
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRGP4 pvup+8
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 180
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1287
+ADDRLP4 12+72
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 12+72+20+3
+CNSTU1 255
+ASGNU1
+LABELV $1179
+LABELV $1107
+LABELV $979
+LABELV $855
+LABELV $609
+LABELV $474
+LABELV $246
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1317
+ADDRGP4 $244
+JUMPV
+LABELV $1317
+ADDRLP4 248
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 1
+EQI4 $1322
+ADDRLP4 248
+INDIRI4
+CNSTI4 5
+EQI4 $1322
+ADDRLP4 248
+INDIRI4
+CNSTI4 11
+NEI4 $1319
+LABELV $1322
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRGP4 $1320
+JUMPV
+LABELV $1319
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $1320
+LABELV $244
+endproc CG_AddParticleToScene 476 16
+data
+align 4
+LABELV roll
+byte 4 0
+export CG_AddParticles
+code
+proc CG_AddParticles 104 16
+ADDRGP4 initparticles
+INDIRI4
+CNSTI4 0
+NEI4 $1324
+ADDRGP4 CG_ClearParticles
+CALLV
+pop
+LABELV $1324
+ADDRGP4 pvforward
+ADDRGP4 cg+109044+36
+INDIRB
+ASGNB 12
+ADDRGP4 pvright
+ADDRGP4 cg+109044+36+12
+INDIRB
+ASGNB 12
+ADDRGP4 pvup
+ADDRGP4 cg+109044+36+24
+INDIRB
+ASGNB 12
+ADDRGP4 cg+109044+36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 60
+ADDRGP4 roll
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTF4 1036831949
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 oldtime
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48+8
+ADDRLP4 48+8
+INDIRF4
+CNSTF4 1063675494
+ADDRLP4 60
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ARGP4
+ADDRGP4 rforward
+ARGP4
+ADDRGP4 rright
+ARGP4
+ADDRGP4 rup
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 oldtime
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 64
+CNSTP4 0
+ASGNP4
+ADDRLP4 44
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 $1342
+JUMPV
+LABELV $1339
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 981668463
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GTF4 $1344
+ADDRLP4 0
+INDIRP4
+ADDRGP4 free_particles
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1340
+JUMPV
+LABELV $1344
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 3
+EQI4 $1350
+ADDRLP4 72
+INDIRI4
+CNSTI4 6
+EQI4 $1350
+ADDRLP4 72
+INDIRI4
+CNSTI4 8
+EQI4 $1350
+ADDRLP4 72
+INDIRI4
+CNSTI4 12
+NEI4 $1346
+LABELV $1350
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+LEF4 $1351
+ADDRLP4 0
+INDIRP4
+ADDRGP4 free_particles
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1340
+JUMPV
+LABELV $1351
+LABELV $1346
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 11
+NEI4 $1354
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+LEF4 $1356
+ADDRLP4 0
+INDIRP4
+ADDRGP4 free_particles
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1340
+JUMPV
+LABELV $1356
+LABELV $1354
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $1359
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+LEF4 $1361
+ADDRLP4 0
+INDIRP4
+ADDRGP4 free_particles
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1340
+JUMPV
+LABELV $1361
+LABELV $1359
+ADDRLP4 76
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 7
+EQI4 $1366
+ADDRLP4 76
+INDIRI4
+CNSTI4 15
+NEI4 $1364
+LABELV $1366
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $1364
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 CG_AddParticleToScene
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ADDRGP4 free_particles
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1340
+JUMPV
+LABELV $1364
+ADDRLP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1367
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1368
+JUMPV
+LABELV $1367
+ADDRLP4 28
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $1368
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065353216
+LEF4 $1369
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+LABELV $1369
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRGP4 CG_AddParticleToScene
+CALLV
+pop
+LABELV $1340
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+LABELV $1342
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1339
+ADDRGP4 active_particles
+ADDRLP4 44
+INDIRP4
+ASGNP4
+LABELV $1323
+endproc CG_AddParticles 104 16
+export CG_ParticleSnowFlurry
+proc CG_ParticleSnowFlurry 80 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1374
+ADDRGP4 $1376
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1374
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1377
+ADDRGP4 $1373
+JUMPV
+LABELV $1377
+ADDRLP4 8
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1063675494
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 100
+MODI4
+CNSTI4 90
+LEI4 $1382
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1036831949
+ASGNF4
+ADDRGP4 $1383
+JUMPV
+LABELV $1382
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $1383
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3248488448
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1384
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3240099840
+ASGNF4
+LABELV $1384
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+CNSTF4 1107296256
+ADDRFP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 52
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+CNSTF4 1107296256
+ADDRFP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1386
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 76
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1386
+LABELV $1373
+endproc CG_ParticleSnowFlurry 80 4
+export CG_ParticleSnow
+proc CG_ParticleSnow 68 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1389
+ADDRGP4 $1391
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1389
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1392
+ADDRGP4 $1388
+JUMPV
+LABELV $1392
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3259498496
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1395
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3263299584
+ASGNF4
+ADDRGP4 $1396
+JUMPV
+LABELV $1395
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1396
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 32
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1397
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1098907648
+CNSTF4 1073741824
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1397
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1388
+endproc CG_ParticleSnow 68 4
+export CG_ParticleBubble
+proc CG_ParticleBubble 80 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1400
+ADDRGP4 $1391
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1400
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1402
+ADDRGP4 $1399
+JUMPV
+LABELV $1402
+ADDRLP4 8
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1056964608
+CNSTF4 1073741824
+ADDRLP4 20
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1112014848
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1405
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 14
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1115815936
+ASGNF4
+ADDRGP4 $1406
+JUMPV
+LABELV $1405
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 13
+ASGNI4
+LABELV $1406
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 36
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1407
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 76
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1407
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1399
+endproc CG_ParticleBubble 80 4
+export CG_ParticleSmoke
+proc CG_ParticleSmoke 40 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1410
+ADDRGP4 $1412
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1410
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1413
+ADDRGP4 $1409
+JUMPV
+LABELV $1413
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1084227584
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1418
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CNSTF4 3212836864
+ADDRLP4 32
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1418
+ADDRLP4 36
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 36
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1090519040
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $1409
+endproc CG_ParticleSmoke 40 4
+export CG_ParticleBulletDebris
+proc CG_ParticleBulletDebris 28 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1421
+ADDRGP4 $1420
+JUMPV
+LABELV $1421
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cgs+152340+220
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 3262119936
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+CNSTF4 3248488448
+ADDF4
+ASGNF4
+LABELV $1420
+endproc CG_ParticleBulletDebris 28 0
+export CG_ParticleExplosion
+proc CG_ParticleExplosion 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 10
+GEU4 $1429
+ADDRGP4 $1431
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1429
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1435
+JUMPV
+LABELV $1432
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1436
+ADDRGP4 $1434
+JUMPV
+LABELV $1436
+LABELV $1433
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1435
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimNames
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1432
+LABELV $1434
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimNames
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1438
+ADDRGP4 $1440
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $1428
+JUMPV
+LABELV $1438
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1441
+ADDRGP4 $1428
+JUMPV
+LABELV $1441
+ADDRLP4 8
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+GEI4 $1444
+ADDRFP4 12
+CNSTI4 -1
+ADDRFP4 12
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1445
+JUMPV
+LABELV $1444
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1127415808
+CNSTF4 1073741824
+ADDRLP4 20
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $1445
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 16
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimSTRatio
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 shaderAnimSTRatio
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $1428
+endproc CG_ParticleExplosion 28 8
+export CG_AddParticleShrapnel
+proc CG_AddParticleShrapnel 0 0
+LABELV $1447
+endproc CG_AddParticleShrapnel 0 0
+export CG_NewParticleArea
+proc CG_NewParticleArea 92 24
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1449
+CNSTI4 0
+RETI4
+ADDRGP4 $1448
+JUMPV
+LABELV $1449
+ADDRLP4 8
+ARGP4
+ADDRLP4 60
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+NEI4 $1451
+ADDRLP4 40
+CNSTF4 1124073472
+ASGNF4
+ADDRGP4 $1452
+JUMPV
+LABELV $1451
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+NEI4 $1453
+ADDRLP4 40
+CNSTF4 1115684864
+ASGNF4
+ADDRGP4 $1454
+JUMPV
+LABELV $1453
+ADDRLP4 36
+INDIRI4
+CNSTI4 3
+NEI4 $1455
+ADDRLP4 40
+CNSTF4 1107296256
+ASGNF4
+ADDRGP4 $1456
+JUMPV
+LABELV $1455
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $1457
+ADDRLP4 40
+CNSTF4 1132462080
+ASGNF4
+ADDRGP4 $1458
+JUMPV
+LABELV $1457
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+NEI4 $1459
+ADDRLP4 40
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 $1460
+JUMPV
+LABELV $1459
+ADDRLP4 36
+INDIRI4
+CNSTI4 5
+NEI4 $1461
+ADDRLP4 40
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 $1462
+JUMPV
+LABELV $1461
+ADDRLP4 36
+INDIRI4
+CNSTI4 6
+NEI4 $1463
+ADDRLP4 40
+CNSTF4 1107296256
+ASGNF4
+ADDRGP4 $1464
+JUMPV
+LABELV $1463
+ADDRLP4 36
+INDIRI4
+CNSTI4 7
+NEI4 $1465
+ADDRLP4 40
+CNSTF4 1115684864
+ASGNF4
+LABELV $1465
+LABELV $1464
+LABELV $1462
+LABELV $1460
+LABELV $1458
+LABELV $1456
+LABELV $1454
+LABELV $1452
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1467
+ADDRLP4 8
+ARGP4
+ADDRLP4 68
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+LABELV $1468
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1467
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1471
+ADDRLP4 8
+ARGP4
+ADDRLP4 68
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 24
+ADDP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+LABELV $1472
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1471
+ADDRLP4 8
+ARGP4
+ADDRLP4 68
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 76
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 76
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 84
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1478
+JUMPV
+LABELV $1475
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+LTI4 $1479
+ADDRGP4 cgs+152340+292
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_ParticleBubble
+CALLV
+pop
+ADDRGP4 $1480
+JUMPV
+LABELV $1479
+ADDRGP4 cgs+152340+292
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 CG_ParticleSnow
+CALLV
+pop
+LABELV $1480
+LABELV $1476
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1478
+ADDRLP4 0
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LTI4 $1475
+CNSTI4 1
+RETI4
+LABELV $1448
+endproc CG_NewParticleArea 92 24
+export CG_SnowLink
+proc CG_SnowLink 16 0
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 $1489
+JUMPV
+LABELV $1486
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $1492
+ADDRLP4 12
+INDIRI4
+CNSTI4 5
+NEI4 $1490
+LABELV $1492
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $1493
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1495
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1496
+JUMPV
+LABELV $1495
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1496
+LABELV $1493
+LABELV $1490
+LABELV $1487
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $1489
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1486
+LABELV $1485
+endproc CG_SnowLink 16 0
+export CG_ParticleImpactSmokePuff
+proc CG_ParticleImpactSmokePuff 36 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1498
+ADDRGP4 $1500
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1498
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1501
+ADDRGP4 $1497
+JUMPV
+LABELV $1501
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1127415808
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 1000
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 4
+MODI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 500
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $1497
+endproc CG_ParticleImpactSmokePuff 36 4
+export CG_Particle_Bleed
+proc CG_Particle_Bleed 36 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1508
+ADDRGP4 $1510
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1508
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1511
+ADDRGP4 $1507
+JUMPV
+LABELV $1511
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1515
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1516
+JUMPV
+LABELV $1515
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+ASGNF4
+LABELV $1516
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+MODI4
+CNSTI4 4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3248488448
+ASGNF4
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 32
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+LABELV $1507
+endproc CG_Particle_Bleed 36 4
+export CG_Particle_OilParticle
+proc CG_Particle_OilParticle 48 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTF4 1153138688
+ASGNF4
+ADDRLP4 8
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1522
+ADDRGP4 $1524
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1522
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1525
+ADDRGP4 $1519
+JUMPV
+LABELV $1525
+ADDRLP4 20
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRLP4 16
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1077936128
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 3248488448
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 44
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+LABELV $1519
+endproc CG_Particle_OilParticle 48 4
+export CG_Particle_OilSlick
+proc CG_Particle_OilSlick 48 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1530
+ADDRGP4 $1532
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1530
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1533
+ADDRGP4 $1529
+JUMPV
+LABELV $1533
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $1536
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $1537
+JUMPV
+LABELV $1536
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 60000
+ADDI4
+CVIF4 4
+ASGNF4
+LABELV $1537
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+NEF4 $1542
+ADDRFP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+EQF4 $1540
+LABELV $1542
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $1541
+JUMPV
+LABELV $1540
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+LABELV $1541
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1056964608
+CNSTF4 1073741824
+ADDRLP4 28
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1057803469
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 44
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+LABELV $1529
+endproc CG_Particle_OilSlick 48 4
+export CG_OilSlickRemove
+proc CG_OilSlickRemove 20 4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $1544
+ADDRGP4 $1546
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1544
+ADDRLP4 0
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 $1550
+JUMPV
+LABELV $1547
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $1551
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $1553
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 10
+ASGNI4
+LABELV $1553
+LABELV $1551
+LABELV $1548
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $1550
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1547
+LABELV $1543
+endproc CG_OilSlickRemove 20 4
+export ValidBloodPool
+proc ValidBloodPool 200 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 168
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 152
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 0
+ASGNF4
+ADDRLP4 96
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 172
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 156
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 156
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 180
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 128
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 128+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 96+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 152
+INDIRF4
+NEGF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRGP4 $1566
+JUMPV
+LABELV $1563
+ADDRLP4 84
+ADDRLP4 128
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 128+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 128+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+ADDRLP4 124
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 120
+INDIRF4
+NEGF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRGP4 $1576
+JUMPV
+LABELV $1573
+ADDRLP4 0
+ADDRLP4 84
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 192
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRF4
+ADDRLP4 192
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 192
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3212836864
+ADDRLP4 96+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 196
+CNSTP4 0
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 28+52
+INDIRI4
+CNSTI4 1022
+GEI4 $1589
+CNSTI4 0
+RETI4
+ADDRGP4 $1556
+JUMPV
+LABELV $1589
+ADDRLP4 28+4
+INDIRI4
+CNSTI4 0
+NEI4 $1596
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1592
+LABELV $1596
+CNSTI4 0
+RETI4
+ADDRGP4 $1556
+JUMPV
+LABELV $1592
+LABELV $1574
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1576
+ADDRLP4 12
+INDIRF4
+ADDRLP4 120
+INDIRF4
+LTF4 $1573
+LABELV $1564
+ADDRLP4 124
+ADDRLP4 124
+INDIRF4
+ADDRLP4 152
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1566
+ADDRLP4 124
+INDIRF4
+ADDRLP4 152
+INDIRF4
+LTF4 $1563
+CNSTI4 1
+RETI4
+LABELV $1556
+endproc ValidBloodPool 200 28
+export CG_BloodPool
+proc CG_BloodPool 60 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1598
+ADDRGP4 $1600
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1598
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1601
+ADDRGP4 $1597
+JUMPV
+LABELV $1601
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ARGP4
+ADDRLP4 24
+ADDRGP4 ValidBloodPool
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $1603
+ADDRGP4 $1597
+JUMPV
+LABELV $1603
+ADDRLP4 28
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 3000
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1058642330
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1053609165
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1090519040
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1090519040
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1098907648
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1098907648
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 56
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $1597
+endproc CG_BloodPool 60 4
+export CG_ParticleBloodCloud
+proc CG_ParticleBloodCloud 96 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 44
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 60
+CNSTP4 0
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 16
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 0
+EQF4 $1608
+ADDRLP4 36
+ADDRLP4 40
+INDIRF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $1608
+ADDRLP4 36
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1610
+ADDRLP4 36
+CNSTF4 1065353216
+ASGNF4
+LABELV $1610
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1615
+JUMPV
+LABELV $1612
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 20+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 20+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1622
+ADDRGP4 $1607
+JUMPV
+LABELV $1622
+ADDRLP4 68
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cgs+152340+276
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 350
+ADDI4
+CVIF4 4
+CNSTF4 1120403456
+CNSTF4 1073741824
+ADDRLP4 80
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 88
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 88
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 92
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+LABELV $1613
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1615
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ADDRLP4 36
+INDIRF4
+LTF4 $1612
+LABELV $1607
+endproc CG_ParticleBloodCloud 96 16
+export CG_ParticleSparks
+proc CG_ParticleSparks 72 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1630
+ADDRGP4 $1629
+JUMPV
+LABELV $1630
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cgs+152340+220
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+ADDRFP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1101004800
+ADDF4
+ADDRFP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 68
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1082130432
+CNSTF4 1073741824
+ADDRLP4 68
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $1629
+endproc CG_ParticleSparks 72 0
+export CG_ParticleDust
+proc CG_ParticleDust 132 16
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 64
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 44
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 72
+CNSTP4 0
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 16
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+EQF4 $1638
+ADDRLP4 40
+ADDRLP4 32
+INDIRF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $1638
+ADDRLP4 40
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1640
+ADDRLP4 40
+CNSTF4 1065353216
+ASGNF4
+LABELV $1640
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1645
+JUMPV
+LABELV $1642
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 20+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 20+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1652
+ADDRGP4 $1637
+JUMPV
+LABELV $1652
+ADDRLP4 80
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 80
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 cgs+152340+276
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+EQF4 $1657
+ADDRLP4 92
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 4500
+ADDI4
+CVIF4 4
+CNSTF4 1163575296
+CNSTF4 1073741824
+ADDRLP4 92
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1658
+JUMPV
+LABELV $1657
+ADDRLP4 96
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 750
+ADDI4
+CVIF4 4
+CNSTF4 1140457472
+CNSTF4 1073741824
+ADDRLP4 96
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1658
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1119879168
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1119879168
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+NEF4 $1662
+ADDRLP4 100
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+CNSTF4 1045220557
+ADDRLP4 100
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 104
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+CNSTF4 1045220557
+ADDRLP4 104
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+LABELV $1662
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 100
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1086324736
+CNSTF4 1073741824
+ADDRLP4 100
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1086324736
+CNSTF4 1073741824
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1101004800
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 112
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1077936128
+CNSTF4 1073741824
+ADDRLP4 112
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 116
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1077936128
+CNSTF4 1073741824
+ADDRLP4 116
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 3246391296
+ASGNF4
+ADDRLP4 124
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 124
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 128
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 128
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+LABELV $1643
+ADDRLP4 36
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1645
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ADDRLP4 40
+INDIRF4
+LTF4 $1642
+LABELV $1637
+endproc CG_ParticleDust 132 16
+export CG_ParticleMisc
+proc CG_ParticleMisc 20 4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1665
+ADDRGP4 $1500
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1665
+ADDRGP4 free_particles
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1667
+ADDRGP4 $1664
+JUMPV
+LABELV $1667
+ADDRLP4 4
+ADDRGP4 free_particles
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRGP4 active_particles
+INDIRP4
+ASGNP4
+ADDRGP4 active_particles
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 179
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $1670
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $1671
+JUMPV
+LABELV $1670
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 12
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $1671
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 15
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $1664
+endproc CG_ParticleMisc 20 4
+bss
+export oldtime
+align 4
+LABELV oldtime
+skip 4
+export rup
+align 4
+LABELV rup
+skip 12
+export rright
+align 4
+LABELV rright
+skip 12
+export rforward
+align 4
+LABELV rforward
+skip 12
+export pvup
+align 4
+LABELV pvup
+skip 12
+export pvright
+align 4
+LABELV pvright
+skip 12
+export pvforward
+align 4
+LABELV pvforward
+skip 12
+export particles
+align 4
+LABELV particles
+skip 126976
+export free_particles
+align 4
+LABELV free_particles
+skip 4
+export active_particles
+align 4
+LABELV active_particles
+skip 4
+align 4
+LABELV numShaderAnims
+skip 4
+align 4
+LABELV shaderAnims
+skip 8192
+align 4
+LABELV markTotal
+skip 4
+export cg_freeMarkPolys
+align 4
+LABELV cg_freeMarkPolys
+skip 4
+export cg_activeMarkPolys
+align 4
+LABELV cg_activeMarkPolys
+skip 288
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+export cg_markPolys
+align 4
+LABELV cg_markPolys
+skip 73728
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1600
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 66
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 80
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1546
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 79
+byte 1 105
+byte 1 108
+byte 1 83
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 82
+byte 1 101
+byte 1 118
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 105
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1532
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 79
+byte 1 105
+byte 1 108
+byte 1 83
+byte 1 108
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1524
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 79
+byte 1 105
+byte 1 108
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1510
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 95
+byte 1 66
+byte 1 108
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1500
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 80
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1440
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1431
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 120
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $1412
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 109
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1391
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $1376
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 83
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 70
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 90
+byte 1 69
+byte 1 82
+byte 1 79
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $243
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $225
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 49
+byte 1 0
+align 1
+LABELV $99
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 73
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 77
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 60
+byte 1 61
+byte 1 32
+byte 1 48
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 115
+byte 1 0
+align 1
+LABELV $82
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
@@ -0,0 +1,12135 @@
+data
+export cg_customSoundNames
+align 4
+LABELV cg_customSoundNames
+address $71
+address $72
+address $73
+address $74
+address $75
+address $76
+address $77
+address $78
+address $79
+address $80
+address $81
+address $82
+address $83
+skip 76
+export CG_CustomSound
+code
+proc CG_CustomSound 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $85
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $85
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $89
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $87
+LABELV $89
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $87
+ADDRLP4 4
+CNSTI4 1708
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $94
+JUMPV
+LABELV $91
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $95
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1580
+ADDP4
+ADDP4
+INDIRI4
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $95
+LABELV $92
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $94
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $97
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $91
+LABELV $97
+ADDRGP4 $98
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $84
+endproc CG_CustomSound 16 8
+proc CG_ParseAnimationFile 20088 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 544
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20032
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20036
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 20036
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+GTI4 $100
+CNSTI4 0
+RETI4
+ADDRGP4 $99
+JUMPV
+LABELV $100
+ADDRLP4 28
+INDIRI4
+CVIU4 4
+CNSTU4 19999
+LTU4 $102
+ADDRGP4 $104
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $99
+JUMPV
+LABELV $102
+ADDRLP4 32
+ARGP4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+ADDRLP4 32
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20032
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 12
+ADDRLP4 32
+ASGNP4
+ADDRLP4 20040
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 20040
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+ADDRLP4 20040
+INDIRI4
+ASGNI4
+ADDRLP4 20048
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 504
+ADDP4
+ADDRLP4 20048
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 500
+ADDP4
+ADDRLP4 20048
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDRLP4 20048
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $105
+ADDRLP4 20
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $108
+ADDRGP4 $107
+JUMPV
+LABELV $108
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $112
+ARGP4
+ADDRLP4 20056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20056
+INDIRI4
+CNSTI4 0
+NEI4 $110
+ADDRLP4 12
+ARGP4
+ADDRLP4 20060
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20060
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $113
+ADDRGP4 $107
+JUMPV
+LABELV $113
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $117
+ARGP4
+ADDRLP4 20064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20064
+INDIRI4
+CNSTI4 0
+EQI4 $119
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $118
+ARGP4
+ADDRLP4 20068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20068
+INDIRI4
+CNSTI4 0
+NEI4 $115
+LABELV $119
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $115
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $122
+ARGP4
+ADDRLP4 20072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 0
+NEI4 $120
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $120
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $125
+ARGP4
+ADDRLP4 20076
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20076
+INDIRI4
+CNSTI4 0
+NEI4 $123
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $123
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $128
+ARGP4
+ADDRLP4 20080
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20080
+INDIRI4
+CNSTI4 0
+NEI4 $126
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $126
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $131
+ARGP4
+ADDRLP4 20084
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20084
+INDIRI4
+CNSTI4 0
+NEI4 $129
+ADDRFP4 4
+INDIRP4
+CNSTI4 508
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $129
+ADDRGP4 $132
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $106
+JUMPV
+LABELV $110
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $135
+ARGP4
+ADDRLP4 20060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20060
+INDIRI4
+CNSTI4 0
+NEI4 $133
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $136
+ADDRLP4 12
+ARGP4
+ADDRLP4 20064
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20064
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $140
+ADDRGP4 $106
+JUMPV
+LABELV $140
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20068
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+ADDP4
+ADDRLP4 20068
+INDIRF4
+ASGNF4
+LABELV $137
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $136
+ADDRGP4 $106
+JUMPV
+LABELV $133
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $144
+ARGP4
+ADDRLP4 20064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20064
+INDIRI4
+CNSTI4 0
+NEI4 $142
+ADDRLP4 12
+ARGP4
+ADDRLP4 20068
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20068
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $145
+ADDRGP4 $107
+JUMPV
+LABELV $145
+ADDRLP4 20072
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 102
+EQI4 $149
+ADDRLP4 20072
+INDIRI4
+CNSTI4 70
+NEI4 $147
+LABELV $149
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $147
+ADDRLP4 20076
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20076
+INDIRI4
+CNSTI4 110
+EQI4 $152
+ADDRLP4 20076
+INDIRI4
+CNSTI4 78
+NEI4 $150
+LABELV $152
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $150
+ADDRFP4 4
+INDIRP4
+CNSTI4 512
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $142
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $155
+ARGP4
+ADDRLP4 20068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20068
+INDIRI4
+CNSTI4 0
+NEI4 $153
+ADDRFP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $153
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 20072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20072
+INDIRI4
+CNSTI4 0
+NEI4 $156
+ADDRFP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $156
+ADDRLP4 20076
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20076
+INDIRI4
+CNSTI4 48
+LTI4 $159
+ADDRLP4 20076
+INDIRI4
+CNSTI4 57
+GTI4 $159
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRGP4 $107
+JUMPV
+LABELV $159
+ADDRGP4 $161
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $106
+ADDRGP4 $105
+JUMPV
+LABELV $107
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $162
+ADDRLP4 12
+ARGP4
+ADDRLP4 20052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $166
+ADDRLP4 4
+INDIRI4
+CNSTI4 25
+LTI4 $164
+ADDRLP4 4
+INDIRI4
+CNSTI4 30
+GTI4 $164
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 176
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $163
+JUMPV
+LABELV $166
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ADDRLP4 20056
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+NEI4 $170
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+CNSTI4 364
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $170
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+LTI4 $172
+ADDRLP4 4
+INDIRI4
+CNSTI4 25
+GEI4 $172
+ADDRLP4 20064
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20064
+INDIRP4
+ADDRLP4 20064
+INDIRP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $172
+ADDRLP4 12
+ARGP4
+ADDRLP4 20064
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20064
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $174
+ADDRGP4 $164
+JUMPV
+LABELV $174
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20068
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20068
+INDIRI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $176
+ADDRLP4 20072
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 20072
+INDIRP4
+ADDRLP4 20072
+INDIRP4
+INDIRI4
+NEGI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $176
+ADDRLP4 12
+ARGP4
+ADDRLP4 20072
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20072
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $178
+ADDRGP4 $164
+JUMPV
+LABELV $178
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20076
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20076
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 20080
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20080
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $180
+ADDRGP4 $164
+JUMPV
+LABELV $180
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20084
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 20084
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CNSTF4 0
+NEF4 $182
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $182
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+LABELV $163
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+LTI4 $162
+LABELV $164
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+EQI4 $184
+ADDRGP4 $186
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $99
+JUMPV
+LABELV $184
+ADDRLP4 8
+INDIRP4
+CNSTI4 896
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 364
+ADDP4
+ARGP4
+CNSTI4 28
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 916
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 924
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 392
+ADDP4
+ARGP4
+CNSTI4 28
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CNSTI4 944
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 956
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 960
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 964
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 968
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 972
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 980
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 984
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 988
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 992
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 996
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1000
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1012
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1016
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1020
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1024
+ADDP4
+CNSTI4 66
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1028
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $99
+endproc CG_ParseAnimationFile 20088 12
+proc CG_FileExists 8 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $188
+CNSTI4 1
+RETI4
+ADDRGP4 $187
+JUMPV
+LABELV $188
+CNSTI4 0
+RETI4
+LABELV $187
+endproc CG_FileExists 8 12
+proc CG_FindClientModelFile 32 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $191
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $197
+ADDRGP4 $194
+JUMPV
+LABELV $197
+ADDRLP4 8
+ADDRGP4 $198
+ASGNP4
+ADDRGP4 $192
+JUMPV
+LABELV $194
+ADDRLP4 8
+ADDRGP4 $199
+ASGNP4
+ADDRGP4 $192
+JUMPV
+LABELV $191
+ADDRLP4 8
+ADDRGP4 $117
+ASGNP4
+LABELV $192
+ADDRLP4 4
+ADDRGP4 $200
+ASGNP4
+ADDRGP4 $202
+JUMPV
+LABELV $201
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $204
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $208
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $208
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+EQI4 $208
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $211
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $209
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $212
+CNSTI4 1
+RETI4
+ADDRGP4 $190
+JUMPV
+LABELV $212
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $214
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $217
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $217
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+EQI4 $217
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $215
+JUMPV
+LABELV $217
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $221
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $221
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+EQI4 $221
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $222
+LABELV $215
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $223
+CNSTI4 1
+RETI4
+ADDRGP4 $190
+JUMPV
+LABELV $223
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $227
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $225
+LABELV $227
+ADDRGP4 $206
+JUMPV
+LABELV $225
+LABELV $205
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $204
+LABELV $206
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $228
+ADDRGP4 $203
+JUMPV
+LABELV $228
+ADDRLP4 4
+ADDRGP4 $230
+ASGNP4
+LABELV $202
+ADDRGP4 $201
+JUMPV
+LABELV $203
+CNSTI4 0
+RETI4
+LABELV $190
+endproc CG_FindClientModelFile 32 40
+proc CG_FindClientHeadFile 32 40
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 24
+ADDRFP4 24
+INDIRP4
+ASGNP4
+ADDRFP4 28
+ADDRFP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $232
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $238
+ADDRGP4 $235
+JUMPV
+LABELV $238
+ADDRLP4 8
+ADDRGP4 $198
+ASGNP4
+ADDRGP4 $233
+JUMPV
+LABELV $235
+ADDRLP4 8
+ADDRGP4 $199
+ASGNP4
+ADDRGP4 $233
+JUMPV
+LABELV $232
+ADDRLP4 8
+ADDRGP4 $117
+ASGNP4
+LABELV $233
+ADDRFP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $239
+ADDRLP4 4
+ADDRGP4 $241
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $243
+JUMPV
+LABELV $239
+ADDRLP4 4
+ADDRGP4 $200
+ASGNP4
+ADDRGP4 $243
+JUMPV
+LABELV $242
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $245
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $249
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $249
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+EQI4 $249
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $251
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $250
+JUMPV
+LABELV $249
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $252
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $250
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $253
+CNSTI4 1
+RETI4
+ADDRGP4 $231
+JUMPV
+LABELV $253
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $255
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $258
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $258
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+EQI4 $258
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $256
+JUMPV
+LABELV $258
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $256
+JUMPV
+LABELV $255
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $260
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $260
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+EQI4 $260
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $219
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $220
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 24
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 28
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $261
+LABELV $256
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_FileExists
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $262
+CNSTI4 1
+RETI4
+ADDRGP4 $231
+JUMPV
+LABELV $262
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $266
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $264
+LABELV $266
+ADDRGP4 $247
+JUMPV
+LABELV $264
+LABELV $246
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $245
+LABELV $247
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $267
+ADDRGP4 $244
+JUMPV
+LABELV $267
+ADDRLP4 4
+ADDRGP4 $241
+ASGNP4
+LABELV $243
+ADDRGP4 $242
+JUMPV
+LABELV $244
+CNSTI4 0
+RETI4
+LABELV $231
+endproc CG_FindClientHeadFile 32 40
+proc CG_RegisterClientSkin 84 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $272
+ARGP4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $270
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+LABELV $270
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $274
+ADDRGP4 $276
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $274
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $279
+ARGP4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 68
+ADDRGP4 CG_FindClientModelFile
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $277
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $277
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $280
+ADDRGP4 $282
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $280
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $285
+ARGP4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 72
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $283
+ADDRLP4 0
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+LABELV $283
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $286
+ADDRGP4 $288
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $286
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $292
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $292
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+NEI4 $289
+LABELV $292
+CNSTI4 0
+RETI4
+ADDRGP4 $269
+JUMPV
+LABELV $289
+CNSTI4 1
+RETI4
+LABELV $269
+endproc CG_RegisterClientSkin 84 32
+proc CG_RegisterClientModelname 292 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $294
+ADDRLP4 128
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $295
+JUMPV
+LABELV $294
+ADDRLP4 128
+ADDRFP4 12
+INDIRP4
+ASGNP4
+LABELV $295
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $296
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 260
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $297
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $299
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $300
+ADDRGP4 $302
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $300
+LABELV $297
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $303
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $304
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $306
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $307
+ADDRGP4 $302
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $307
+LABELV $304
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $309
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $311
+ARGP4
+ADDRLP4 268
+ADDRFP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $310
+JUMPV
+LABELV $309
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $312
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $310
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $313
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $313
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $311
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ADDRLP4 276
+INDIRI4
+ASGNI4
+LABELV $313
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $315
+ADDRGP4 $302
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $315
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 CG_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $317
+ADDRFP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $319
+ADDRFP4 20
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $319
+ADDRGP4 $321
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $322
+ADDRLP4 132
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $324
+ARGP4
+ADDRGP4 $325
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $323
+JUMPV
+LABELV $322
+ADDRLP4 132
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $324
+ARGP4
+ADDRGP4 $326
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $323
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 132
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 CG_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+NEI4 $320
+ADDRGP4 $321
+ARGP4
+ADDRLP4 132
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $319
+ADDRGP4 $329
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $320
+LABELV $317
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $330
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 CG_ParseAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 276
+INDIRI4
+CNSTI4 0
+NEI4 $331
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $333
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 CG_ParseAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+NEI4 $334
+ADDRGP4 $336
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $334
+LABELV $331
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $339
+ARGP4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 280
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $337
+ADDRLP4 0
+ARGP4
+ADDRLP4 284
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRGP4 $338
+JUMPV
+LABELV $337
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRP4
+ARGP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $339
+ARGP4
+ADDRGP4 $342
+ARGP4
+ADDRLP4 284
+ADDRGP4 CG_FindClientHeadFile
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $340
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+ADDRLP4 288
+INDIRI4
+ASGNI4
+LABELV $340
+LABELV $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $343
+CNSTI4 0
+RETI4
+ADDRGP4 $293
+JUMPV
+LABELV $343
+CNSTI4 1
+RETI4
+LABELV $293
+endproc CG_RegisterClientModelname 292 32
+proc CG_ColorFromString 20 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $348
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LEI4 $346
+LABELV $348
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $345
+JUMPV
+LABELV $346
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $349
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $349
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $351
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $351
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $353
+ADDRFP4 4
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $353
+LABELV $345
+endproc CG_ColorFromString 20 4
+proc CG_LoadClientInfo 148 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 288
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 352
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 88
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $356
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $358
+ADDRGP4 $361
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 288
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 352
+ADDP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $358
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $362
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $365
+ADDRLP4 20
+ARGP4
+ADDRGP4 $325
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $366
+JUMPV
+LABELV $365
+ADDRLP4 20
+ARGP4
+ADDRGP4 $326
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $366
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 $369
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRFP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 104
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+NEI4 $363
+ADDRGP4 $370
+ARGP4
+ADDRGP4 $369
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 224
+ADDP4
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $363
+JUMPV
+LABELV $362
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 $369
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 $117
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 100
+ADDRGP4 CG_RegisterClientModelname
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $371
+ADDRGP4 $373
+ARGP4
+ADDRGP4 $369
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $371
+LABELV $363
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $356
+ADDRFP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $374
+ADDRLP4 92
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 140
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_R_LerpTag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $376
+ADDRFP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $376
+LABELV $374
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+ASGNP4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $381
+ADDRLP4 92
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 $382
+JUMPV
+LABELV $381
+ADDRLP4 92
+ADDRGP4 $369
+ASGNP4
+LABELV $382
+ADDRLP4 16
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $383
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg_customSoundNames
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $387
+ADDRGP4 $385
+JUMPV
+LABELV $387
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1580
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $389
+ADDRGP4 $391
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 100
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1580
+ADDP4
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+LABELV $389
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1580
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $392
+ADDRGP4 $391
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 100
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1580
+ADDP4
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+LABELV $392
+LABELV $384
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $383
+LABELV $385
+ADDRFP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $394
+ADDRLP4 96
+CNSTI4 728
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ADDRGP4 cg_entities+168
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $398
+ADDRLP4 96
+INDIRI4
+ADDRGP4 cg_entities+4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $398
+CNSTI4 728
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRGP4 CG_ResetPlayerEntity
+CALLV
+pop
+LABELV $398
+LABELV $395
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $394
+LABELV $355
+endproc CG_LoadClientInfo 148 24
+proc CG_CopyClientInfoModel 52 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 496
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+CNSTI4 508
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 512
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 516
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 520
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 524
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 528
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 532
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 536
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 540
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 484
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 544
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ARGP4
+CNSTI4 1036
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 48
+CNSTI4 1580
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $402
+endproc CG_CopyClientInfoModel 52 12
+proc CG_ScanForExistingClientInfo 60 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $407
+JUMPV
+LABELV $404
+ADDRLP4 0
+CNSTI4 1708
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $410
+ADDRGP4 $405
+JUMPV
+LABELV $410
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $412
+ADDRGP4 $405
+JUMPV
+LABELV $412
+ADDRLP4 8
+CNSTI4 160
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $414
+ADDRLP4 16
+CNSTI4 224
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $414
+ADDRLP4 24
+CNSTI4 288
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $414
+ADDRLP4 32
+CNSTI4 352
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $414
+ADDRLP4 40
+CNSTI4 448
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $414
+ADDRLP4 48
+CNSTI4 416
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $414
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $417
+ADDRLP4 56
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $414
+LABELV $417
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $403
+JUMPV
+LABELV $414
+LABELV $405
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $407
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31480
+INDIRI4
+LTI4 $404
+CNSTI4 0
+RETI4
+LABELV $403
+endproc CG_ScanForExistingClientInfo 60 8
+proc CG_SetDeferredClientInfo 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $422
+JUMPV
+LABELV $419
+ADDRLP4 0
+CNSTI4 1708
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $427
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $425
+LABELV $427
+ADDRGP4 $420
+JUMPV
+LABELV $425
+ADDRLP4 16
+CNSTI4 224
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $432
+ADDRLP4 24
+CNSTI4 160
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $432
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $428
+ADDRLP4 32
+CNSTI4 68
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $428
+LABELV $432
+ADDRGP4 $420
+JUMPV
+LABELV $428
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+ADDRGP4 $418
+JUMPV
+LABELV $420
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $422
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31480
+INDIRI4
+LTI4 $419
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $433
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $439
+JUMPV
+LABELV $436
+ADDRLP4 0
+CNSTI4 1708
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $444
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $442
+LABELV $444
+ADDRGP4 $437
+JUMPV
+LABELV $442
+ADDRLP4 16
+CNSTI4 224
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $448
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $445
+ADDRLP4 24
+CNSTI4 68
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $445
+LABELV $448
+ADDRGP4 $437
+JUMPV
+LABELV $445
+ADDRFP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $418
+JUMPV
+LABELV $437
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $439
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31480
+INDIRI4
+LTI4 $436
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+ADDRGP4 $418
+JUMPV
+LABELV $433
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $452
+JUMPV
+LABELV $449
+ADDRLP4 0
+CNSTI4 1708
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $455
+ADDRGP4 $450
+JUMPV
+LABELV $455
+ADDRFP4 4
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CopyClientInfoModel
+CALLV
+pop
+ADDRGP4 $418
+JUMPV
+LABELV $450
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $452
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31480
+INDIRI4
+LTI4 $449
+ADDRGP4 $457
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $418
+endproc CG_SetDeferredClientInfo 36 8
+export CG_NewClientInfo
+proc CG_NewClientInfo 1892 12
+ADDRLP4 1724
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1720
+CNSTI4 1708
+ADDRLP4 1724
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 1724
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 1728
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 1712
+ADDRLP4 1728
+INDIRP4
+ASGNP4
+ADDRLP4 1712
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $460
+ADDRLP4 1720
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1708
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $458
+JUMPV
+LABELV $460
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1708
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1712
+INDIRP4
+ARGP4
+ADDRGP4 $462
+ARGP4
+ADDRLP4 1732
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1708
+ADDRLP4 1732
+INDIRP4
+ASGNP4
+ADDRLP4 0+4
+ARGP4
+ADDRLP4 1708
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1712
+INDIRP4
+ARGP4
+ADDRGP4 $465
+ARGP4
+ADDRLP4 1736
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1708
+ADDRLP4 1736
+INDIRP4
+ASGNP4
+ADDRLP4 1708
+INDIRP4
+ARGP4
+ADDRLP4 0+76
+ARGP4
+ADDRGP4 CG_ColorFromString
+CALLV
+pop
+ADDRLP4 1712
+INDIRP4
+ARGP4
+ADDRGP4 $467
+ARGP4
+ADDRLP4 1740
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1708
+ADDRLP4 1740
+INDIRP4
+ASGNP4
+ADDRLP4 1708
+INDIRP4
+ARGP4
+ADDRLP4 0+88
+ARGP4
+ADDRGP4 CG_ColorFromString
+CALLV
+pop
+ADDRLP4 1712
+INDIRP4
+ARGP4
+ADDRGP4 $469
+ARGP4
+ADDRLP4 1744
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1708
+ADDRLP4 1744
+INDIRP4
+ASGNP4
+ADDRLP4 1708
+INDIRP4
+ARGP4
+ADDRLP4 1748
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+72
+ADDRLP4 1748
+INDIRI4
+ASGNI4
+ADDRLP4 1712
+INDIRP4
+ARGP4
+ADDRGP4 $471
+ARGP4
+ADDRLP4 1752
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1708
+ADDRLP4 1752
+INDIRP4
+ASGNP4
+ADDRLP4 1708
+INDIRP4
+ARGP4
+ADDRLP4 1756
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+120
+ADDRLP4 1756
+INDIRI4
+ASGNI4
+ADDRLP4 1712
+INDIRP4
+ARGP4
+ADDRGP4 $473
+ARGP4
+ADDRLP4 1760
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1708
+ADDRLP4 1760
+INDIRP4
+ASGNP4
+ADDRLP4 1708
+INDIRP4
+ARGP4
+ADDRLP4 1764
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+124
+ADDRLP4 1764
+INDIRI4
+ASGNI4
+ADDRLP4 1712
+INDIRP4
+ARGP4
+ADDRGP4 $475
+ARGP4
+ADDRLP4 1768
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1708
+ADDRLP4 1768
+INDIRP4
+ASGNP4
+ADDRLP4 1708
+INDIRP4
+ARGP4
+ADDRLP4 1772
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+128
+ADDRLP4 1772
+INDIRI4
+ASGNI4
+ADDRLP4 1712
+INDIRP4
+ARGP4
+ADDRGP4 $477
+ARGP4
+ADDRLP4 1776
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1708
+ADDRLP4 1776
+INDIRP4
+ASGNP4
+ADDRLP4 1708
+INDIRP4
+ARGP4
+ADDRLP4 1780
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+68
+ADDRLP4 1780
+INDIRI4
+ASGNI4
+ADDRLP4 1712
+INDIRP4
+ARGP4
+ADDRGP4 $479
+ARGP4
+ADDRLP4 1784
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1708
+ADDRLP4 1784
+INDIRP4
+ASGNP4
+ADDRLP4 1708
+INDIRP4
+ARGP4
+ADDRLP4 1788
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+132
+ADDRLP4 1788
+INDIRI4
+ASGNI4
+ADDRLP4 1712
+INDIRP4
+ARGP4
+ADDRGP4 $481
+ARGP4
+ADDRLP4 1792
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1708
+ADDRLP4 1792
+INDIRP4
+ASGNP4
+ADDRLP4 1708
+INDIRP4
+ARGP4
+ADDRLP4 1796
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0+136
+ADDRLP4 1796
+INDIRI4
+ASGNI4
+ADDRLP4 1712
+INDIRP4
+ARGP4
+ADDRGP4 $483
+ARGP4
+ADDRLP4 1800
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1708
+ADDRLP4 1800
+INDIRP4
+ASGNP4
+ADDRLP4 0+416
+ARGP4
+ADDRLP4 1708
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1712
+INDIRP4
+ARGP4
+ADDRGP4 $485
+ARGP4
+ADDRLP4 1804
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1708
+ADDRLP4 1804
+INDIRP4
+ASGNP4
+ADDRLP4 0+448
+ARGP4
+ADDRLP4 1708
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1712
+INDIRP4
+ARGP4
+ADDRGP4 $487
+ARGP4
+ADDRLP4 1808
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1708
+ADDRLP4 1808
+INDIRP4
+ASGNP4
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 0
+EQI4 $488
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $491
+ADDRLP4 0+160
+ARGP4
+ADDRGP4 $369
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+224
+ARGP4
+ADDRGP4 $117
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $492
+JUMPV
+LABELV $491
+ADDRGP4 $487
+ARGP4
+ADDRLP4 1812
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1812
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 1880
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1876
+ADDRLP4 1880
+INDIRP4
+ASGNP4
+ADDRLP4 1880
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $498
+ADDRLP4 1876
+ADDRGP4 $117
+ASGNP4
+ADDRGP4 $499
+JUMPV
+LABELV $498
+ADDRLP4 1884
+ADDRLP4 1876
+INDIRP4
+ASGNP4
+ADDRLP4 1876
+ADDRLP4 1884
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1884
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $499
+ADDRLP4 0+224
+ARGP4
+ADDRLP4 1876
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+160
+ARGP4
+ADDRLP4 1812
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $492
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $489
+ADDRLP4 1708
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 1880
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1716
+ADDRLP4 1880
+INDIRP4
+ASGNP4
+ADDRLP4 1716
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $489
+ADDRLP4 0+224
+ARGP4
+ADDRLP4 1716
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $489
+JUMPV
+LABELV $488
+ADDRLP4 0+160
+ARGP4
+ADDRLP4 1708
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+160
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 1812
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1716
+ADDRLP4 1812
+INDIRP4
+ASGNP4
+ADDRLP4 1716
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $514
+ADDRLP4 0+224
+ARGP4
+ADDRGP4 $117
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $515
+JUMPV
+LABELV $514
+ADDRLP4 0+224
+ARGP4
+ADDRLP4 1716
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1716
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $515
+LABELV $489
+ADDRLP4 1712
+INDIRP4
+ARGP4
+ADDRGP4 $520
+ARGP4
+ADDRLP4 1812
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1708
+ADDRLP4 1812
+INDIRP4
+ASGNP4
+ADDRGP4 cg_forceModel+12
+INDIRI4
+CNSTI4 0
+EQI4 $521
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $524
+ADDRLP4 0+288
+ARGP4
+ADDRGP4 $369
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+352
+ARGP4
+ADDRGP4 $117
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $525
+JUMPV
+LABELV $524
+ADDRGP4 $531
+ARGP4
+ADDRLP4 1816
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1816
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 1884
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1880
+ADDRLP4 1884
+INDIRP4
+ASGNP4
+ADDRLP4 1884
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $532
+ADDRLP4 1880
+ADDRGP4 $117
+ASGNP4
+ADDRGP4 $533
+JUMPV
+LABELV $532
+ADDRLP4 1888
+ADDRLP4 1880
+INDIRP4
+ASGNP4
+ADDRLP4 1880
+ADDRLP4 1888
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1888
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $533
+ADDRLP4 0+352
+ARGP4
+ADDRLP4 1880
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+288
+ARGP4
+ADDRLP4 1816
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $525
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $522
+ADDRLP4 1708
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 1884
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1716
+ADDRLP4 1884
+INDIRP4
+ASGNP4
+ADDRLP4 1716
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $522
+ADDRLP4 0+352
+ARGP4
+ADDRLP4 1716
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $522
+JUMPV
+LABELV $521
+ADDRLP4 0+288
+ARGP4
+ADDRLP4 1708
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0+288
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 1816
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1716
+ADDRLP4 1816
+INDIRP4
+ASGNP4
+ADDRLP4 1716
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $548
+ADDRLP4 0+352
+ARGP4
+ADDRGP4 $117
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $549
+JUMPV
+LABELV $548
+ADDRLP4 0+352
+ARGP4
+ADDRLP4 1716
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 1716
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $549
+LABELV $522
+ADDRLP4 0
+ARGP4
+ADDRLP4 1816
+ADDRGP4 CG_ScanForExistingClientInfo
+CALLI4
+ASGNI4
+ADDRLP4 1816
+INDIRI4
+CNSTI4 0
+NEI4 $554
+ADDRLP4 1828
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 1828
+INDIRI4
+CNSTI4 4000000
+GEI4 $557
+ADDRLP4 1824
+CNSTI4 1
+ASGNI4
+ADDRGP4 $558
+JUMPV
+LABELV $557
+ADDRLP4 1824
+CNSTI4 0
+ASGNI4
+LABELV $558
+ADDRLP4 1820
+ADDRLP4 1824
+INDIRI4
+ASGNI4
+ADDRLP4 1832
+CNSTI4 0
+ASGNI4
+ADDRLP4 1820
+INDIRI4
+ADDRLP4 1832
+INDIRI4
+NEI4 $564
+ADDRGP4 cg_deferPlayers+12
+INDIRI4
+ADDRLP4 1832
+INDIRI4
+EQI4 $559
+ADDRGP4 cg_buildScript+12
+INDIRI4
+ADDRLP4 1832
+INDIRI4
+NEI4 $559
+ADDRGP4 cg+20
+INDIRI4
+ADDRLP4 1832
+INDIRI4
+NEI4 $559
+LABELV $564
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_SetDeferredClientInfo
+CALLV
+pop
+ADDRLP4 1820
+INDIRI4
+CNSTI4 0
+EQI4 $560
+ADDRGP4 $567
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0+480
+CNSTI4 0
+ASGNI4
+ADDRGP4 $560
+JUMPV
+LABELV $559
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $560
+LABELV $554
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRLP4 1720
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 1708
+LABELV $458
+endproc CG_NewClientInfo 1892 12
+export CG_LoadDeferredPlayers
+proc CG_LoadDeferredPlayers 20 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+40972
+ASGNP4
+ADDRGP4 $573
+JUMPV
+LABELV $570
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $576
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $576
+ADDRLP4 16
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 4000000
+GEI4 $578
+ADDRGP4 $567
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $571
+JUMPV
+LABELV $578
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_LoadClientInfo
+CALLV
+pop
+LABELV $576
+LABELV $571
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1708
+ADDP4
+ASGNP4
+LABELV $573
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cgs+31480
+INDIRI4
+LTI4 $570
+LABELV $569
+endproc CG_LoadDeferredPlayers 20 8
+proc CG_SetLerpFrameAnimation 12 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $583
+ADDRFP4 8
+INDIRI4
+CNSTI4 37
+LTI4 $581
+LABELV $583
+ADDRGP4 $584
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $581
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 cg_debugAnim+12
+INDIRI4
+CNSTI4 0
+EQI4 $585
+ADDRGP4 $588
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $585
+LABELV $580
+endproc CG_SetLerpFrameAnimation 12 8
+proc CG_RunLerpFrame 48 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_animSpeed+12
+INDIRI4
+CNSTI4 0
+NEI4 $590
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $589
+JUMPV
+LABELV $590
+ADDRFP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+NEI4 $595
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $593
+LABELV $595
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetLerpFrameAnimation
+CALLV
+pop
+LABELV $593
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LTI4 $596
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $599
+ADDRGP4 $589
+JUMPV
+LABELV $599
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+GEI4 $601
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $602
+JUMPV
+LABELV $601
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $602
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRFP4 12
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $604
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+LABELV $604
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $606
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $608
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $608
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $609
+LABELV $606
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $611
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $612
+JUMPV
+LABELV $611
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $613
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $613
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+MODI4
+SUBI4
+ASGNI4
+ADDRGP4 $614
+JUMPV
+LABELV $613
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $614
+LABELV $612
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LEI4 $615
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg_debugAnim+12
+INDIRI4
+CNSTI4 0
+EQI4 $619
+ADDRGP4 $622
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $619
+LABELV $615
+LABELV $596
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 200
+ADDI4
+LEI4 $623
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $623
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $627
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $627
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $631
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $632
+JUMPV
+LABELV $631
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+LABELV $632
+LABELV $589
+endproc CG_RunLerpFrame 48 12
+proc CG_ClearLerpFrame 16 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 CG_SetLerpFrameAnimation
+CALLV
+pop
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $634
+endproc CG_ClearLerpFrame 16 12
+proc CG_PlayerAnimation 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 cg_noPlayerAnims+12
+INDIRI4
+CNSTI4 0
+EQI4 $637
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $636
+JUMPV
+LABELV $637
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $640
+ADDRLP4 4
+CNSTF4 1069547520
+ASGNF4
+ADDRGP4 $641
+JUMPV
+LABELV $640
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+LABELV $641
+ADDRLP4 0
+CNSTI4 1708
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $643
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+CNSTI4 22
+NEI4 $643
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ARGP4
+CNSTI4 24
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRGP4 $644
+JUMPV
+LABELV $643
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+LABELV $644
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $636
+endproc CG_PlayerAnimation 20 16
+proc CG_SwingAngles 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $646
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GTF4 $650
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+NEGF4
+GEF4 $648
+LABELV $650
+ADDRFP4 20
+INDIRP4
+CNSTI4 1
+ASGNI4
+LABELV $648
+LABELV $646
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $651
+ADDRGP4 $645
+JUMPV
+LABELV $651
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+GEF4 $653
+ADDRLP4 4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $654
+JUMPV
+LABELV $653
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+GEF4 $655
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $656
+JUMPV
+LABELV $655
+ADDRLP4 4
+CNSTF4 1073741824
+ASGNF4
+LABELV $656
+LABELV $654
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LTF4 $657
+ADDRLP4 8
+ADDRGP4 cg+107600
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LTF4 $660
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $660
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $658
+JUMPV
+LABELV $657
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $662
+ADDRLP4 8
+ADDRGP4 cg+107600
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+NEGF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GTF4 $665
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $665
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $662
+LABELV $658
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LEF4 $667
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+SUBF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $668
+JUMPV
+LABELV $667
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+GEF4 $669
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $669
+LABELV $668
+LABELV $645
+endproc CG_SwingAngles 28 8
+proc CG_AddPainTwitch 12 0
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 200
+LTI4 $673
+ADDRGP4 $671
+JUMPV
+LABELV $673
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $675
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $676
+JUMPV
+LABELV $675
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $676
+LABELV $671
+endproc CG_AddPainTwitch 12 0
+data
+align 4
+LABELV $678
+byte 4 0
+byte 4 22
+byte 4 45
+byte 4 -22
+byte 4 0
+byte 4 22
+byte 4 -45
+byte 4 -22
+code
+proc CG_PlayerAngles 152 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 24+4
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 84
+CNSTI4 -129
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BANDI4
+CNSTI4 22
+NEI4 $687
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+BANDI4
+CNSTI4 11
+EQI4 $685
+LABELV $687
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $685
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $688
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 $689
+JUMPV
+LABELV $688
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 132
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+LTI4 $692
+ADDRLP4 52
+INDIRI4
+CNSTI4 7
+LEI4 $690
+LABELV $692
+ADDRGP4 $693
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $690
+LABELV $689
+ADDRLP4 12+4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $678
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24+4
+INDIRF4
+CNSTF4 1048576000
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $678
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1119092736
+ARGF4
+ADDRGP4 cg_swingSpeed+8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 12+4
+INDIRF4
+ARGF4
+CNSTF4 1109393408
+ARGF4
+CNSTF4 1119092736
+ARGF4
+ADDRGP4 cg_swingSpeed+8
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1127481344
+LEF4 $704
+ADDRLP4 60
+CNSTF4 1061158912
+ADDRLP4 24
+INDIRF4
+CNSTF4 3283353600
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $705
+JUMPV
+LABELV $704
+ADDRLP4 60
+CNSTF4 1061158912
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+LABELV $705
+ADDRLP4 60
+INDIRF4
+ARGF4
+CNSTF4 1097859072
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $706
+ADDRLP4 36
+INDIRI4
+CNSTI4 64
+GEI4 $706
+ADDRLP4 64
+CNSTI4 1708
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $709
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $709
+LABELV $706
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+ARGP4
+ADDRLP4 108
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 0
+EQF4 $711
+ADDRLP4 56
+CNSTF4 1028443341
+ADDRLP4 56
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 148
+ADDRLP4 56
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 112+12
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 112+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 112+12+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 148
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 56
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 112+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 112+8
+INDIRF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 148
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $711
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $725
+ADDRLP4 36
+INDIRI4
+CNSTI4 64
+GEI4 $725
+ADDRLP4 64
+CNSTI4 1708
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $728
+ADDRLP4 12+4
+ADDRLP4 0+4
+INDIRF4
+ASGNF4
+ADDRLP4 116
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRLP4 116
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 116
+INDIRF4
+ASGNF4
+LABELV $728
+LABELV $725
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_AddPainTwitch
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $677
+endproc CG_PlayerAngles 152 24
+proc CG_HasteTrail 40 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+LEI4 $734
+ADDRGP4 $733
+JUMPV
+LABELV $734
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 15
+EQI4 $737
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+EQI4 $737
+ADDRGP4 $733
+JUMPV
+LABELV $737
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+GEI4 $739
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $739
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRLP4 28
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+CNSTF4 1140457472
+ARGF4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 cgs+152340+420
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $733
+endproc CG_HasteTrail 40 48
+proc CG_TrailItem 192 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 188
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 188
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 152+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 152+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+CNSTF4 1119092736
+ADDF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $747
+endproc CG_TrailItem 192 12
+proc CG_PlayerFlag 356 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+8
+ADDRGP4 cgs+152340+88
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $378
+ARGP4
+ADDRGP4 CG_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140+8
+ADDRGP4 cgs+152340+92
+INDIRI4
+ASGNI4
+ADDRLP4 140+108
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 140+12
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140+24
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 332
+CNSTF4 0
+ASGNF4
+ADDRLP4 280+8
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 280+4
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 280
+ADDRLP4 332
+INDIRF4
+ASGNF4
+ADDRLP4 312
+CNSTI4 0
+ASGNI4
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 22
+EQI4 $779
+ADDRLP4 304
+INDIRI4
+CNSTI4 23
+NEI4 $777
+LABELV $779
+ADDRLP4 320
+CNSTI4 35
+ASGNI4
+ADDRGP4 $778
+JUMPV
+LABELV $777
+ADDRLP4 304
+INDIRI4
+CNSTI4 14
+EQI4 $782
+ADDRLP4 304
+INDIRI4
+CNSTI4 13
+NEI4 $780
+LABELV $782
+ADDRLP4 320
+CNSTI4 35
+ASGNI4
+ADDRLP4 312
+CNSTI4 1
+ASGNI4
+ADDRGP4 $781
+JUMPV
+LABELV $780
+ADDRLP4 320
+CNSTI4 34
+ASGNI4
+ADDRLP4 312
+CNSTI4 1
+ASGNI4
+LABELV $781
+LABELV $778
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $783
+ADDRLP4 292
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 292+8
+ADDRLP4 292+8
+INDIRF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 308
+ADDRLP4 0+28+24
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDRLP4 0+28+24+4
+INDIRF4
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+24+8
+INDIRF4
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+INDIRF4
+ARGF4
+ADDRLP4 344
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 344
+INDIRF4
+CNSTF4 1063675494
+GEF4 $796
+ADDRLP4 308
+ADDRLP4 0+28
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDRLP4 0+28+4
+INDIRF4
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+8
+INDIRF4
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+INDIRF4
+CNSTF4 1065353216
+LEF4 $805
+ADDRLP4 308
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $806
+JUMPV
+LABELV $805
+ADDRLP4 308
+INDIRF4
+CNSTF4 3212836864
+GEF4 $807
+ADDRLP4 308
+CNSTF4 3212836864
+ASGNF4
+LABELV $807
+LABELV $806
+ADDRLP4 308
+INDIRF4
+ARGF4
+ADDRLP4 348
+ADDRGP4 acos
+CALLF4
+ASGNF4
+ADDRLP4 324
+ADDRLP4 348
+INDIRF4
+ASGNF4
+ADDRLP4 308
+ADDRLP4 0+28+12
+INDIRF4
+ADDRLP4 292
+INDIRF4
+MULF4
+ADDRLP4 0+28+12+4
+INDIRF4
+ADDRLP4 292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+28+12+8
+INDIRF4
+ADDRLP4 292+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 308
+INDIRF4
+CNSTF4 0
+GEF4 $819
+ADDRLP4 280+4
+CNSTF4 1135869952
+CNSTF4 1127481344
+ADDRLP4 324
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 $820
+JUMPV
+LABELV $819
+ADDRLP4 280+4
+CNSTF4 1127481344
+ADDRLP4 324
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+LABELV $820
+ADDRLP4 280+4
+INDIRF4
+CNSTF4 0
+GEF4 $823
+ADDRLP4 280+4
+ADDRLP4 280+4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $823
+ADDRLP4 280+4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $827
+ADDRLP4 280+4
+ADDRLP4 280+4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $827
+ADDRLP4 280+4
+INDIRF4
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1119092736
+ARGF4
+CNSTF4 1041865114
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+ARGP4
+ADDRGP4 CG_SwingAngles
+CALLV
+pop
+LABELV $796
+LABELV $783
+ADDRLP4 280+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 316
+CNSTI4 1708
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ARGP4
+ADDRLP4 320
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 CG_RunLerpFrame
+CALLV
+pop
+ADDRLP4 140+96
+ADDRFP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+80
+ADDRFP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+100
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 280
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $378
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $761
+endproc CG_PlayerFlag 356 24
+proc CG_PlayerPowerups 16 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $840
+ADDRGP4 $839
+JUMPV
+LABELV $840
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $842
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $842
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $844
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRGP4 cgs+152340+856
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+LABELV $844
+ADDRLP4 4
+CNSTI4 1708
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $849
+ADDRLP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $851
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+152340+96
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $852
+JUMPV
+LABELV $851
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+152340+36
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $852
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 12
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $849
+ADDRLP4 0
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $857
+ADDRLP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $859
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+152340+100
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $860
+JUMPV
+LABELV $859
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+152340+40
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $860
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1045220557
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $857
+ADDRLP4 0
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $865
+ADDRLP4 4
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $867
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+152340+104
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerFlag
+CALLV
+pop
+ADDRGP4 $868
+JUMPV
+LABELV $867
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+152340+44
+INDIRI4
+ARGI4
+ADDRGP4 CG_TrailItem
+CALLV
+pop
+LABELV $868
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $865
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $873
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_HasteTrail
+CALLV
+pop
+LABELV $873
+LABELV $839
+endproc CG_PlayerPowerups 16 20
+proc CG_PlayerFloatSprite 144 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $876
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $876
+ADDRLP4 140
+CNSTI4 2
+ASGNI4
+ADDRGP4 $877
+JUMPV
+LABELV $876
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+LABELV $877
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+112
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $875
+endproc CG_PlayerFloatSprite 144 12
+proc CG_PlayerSprites 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $894
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+152340+208
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $893
+JUMPV
+LABELV $894
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $898
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+152340+204
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $893
+JUMPV
+LABELV $898
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $902
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+152340+504
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $893
+JUMPV
+LABELV $902
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+CNSTI4 0
+EQI4 $906
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+152340+508
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $893
+JUMPV
+LABELV $906
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $910
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+152340+512
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $893
+JUMPV
+LABELV $910
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $914
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+152340+516
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $893
+JUMPV
+LABELV $914
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 131072
+BANDI4
+CNSTI4 0
+EQI4 $918
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+152340+520
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $893
+JUMPV
+LABELV $918
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $922
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+152340+524
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+ADDRGP4 $893
+JUMPV
+LABELV $922
+ADDRLP4 0
+CNSTI4 1708
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $928
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $928
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $928
+ADDRGP4 cg_drawFriend+12
+INDIRI4
+CNSTI4 0
+EQI4 $893
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cgs+152340+200
+INDIRI4
+ARGI4
+ADDRGP4 CG_PlayerFloatSprite
+CALLV
+pop
+LABELV $928
+LABELV $893
+endproc CG_PlayerSprites 8 8
+lit
+align 4
+LABELV $938
+byte 4 3245342720
+byte 4 3245342720
+byte 4 0
+align 4
+LABELV $939
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1073741824
+code
+proc CG_PlayerShadow 104 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 $938
+INDIRB
+ASGNB 12
+ADDRLP4 84
+ADDRGP4 $939
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 0
+NEI4 $940
+CNSTI4 0
+RETI4
+ADDRGP4 $937
+JUMPV
+LABELV $940
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $943
+CNSTI4 0
+RETI4
+ADDRGP4 $937
+JUMPV
+LABELV $943
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 60+8
+ADDRLP4 60+8
+INDIRF4
+CNSTF4 1124073472
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 33619969
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $951
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $951
+ADDRLP4 0
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $946
+LABELV $951
+CNSTI4 0
+RETI4
+ADDRGP4 $937
+JUMPV
+LABELV $946
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 1
+EQI4 $954
+CNSTI4 1
+RETI4
+ADDRGP4 $937
+JUMPV
+LABELV $954
+ADDRLP4 56
+CNSTF4 1065353216
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 cgs+152340+344
+INDIRI4
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 56
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+CNSTI4 0
+ARGI4
+CNSTF4 1103101952
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $937
+endproc CG_PlayerShadow 104 44
+proc CG_PlayerSplash 196 28
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 0
+NEI4 $963
+ADDRGP4 $962
+JUMPV
+LABELV $963
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 164+8
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 180
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $967
+ADDRGP4 $962
+JUMPV
+LABELV $967
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 152+8
+ADDRLP4 152+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 152
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 184
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 176
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 57
+BANDI4
+CNSTI4 0
+EQI4 $970
+ADDRGP4 $962
+JUMPV
+LABELV $970
+ADDRLP4 96
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 164
+ARGP4
+ADDRLP4 188
+CNSTP4 0
+ASGNP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+ADDRLP4 188
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 96+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $972
+ADDRGP4 $962
+JUMPV
+LABELV $972
+ADDRLP4 0
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 192
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRLP4 0+24
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 0+24+4
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+48
+ADDRLP4 0+48
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 0+48+4
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72
+ADDRLP4 96+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+72
+ADDRLP4 0+72
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRLP4 0+72+4
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cgs+152340+368
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+LABELV $962
+endproc CG_PlayerSplash 196 28
+export CG_AddRefEntityWithPowerups
+proc CG_AddRefEntityWithPowerups 0 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1053
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+152340+404
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $1054
+JUMPV
+LABELV $1053
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1057
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $1059
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+152340+396
+INDIRI4
+ASGNI4
+ADDRGP4 $1060
+JUMPV
+LABELV $1059
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+152340+392
+INDIRI4
+ASGNI4
+LABELV $1060
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1057
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1065
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 100
+DIVI4
+CNSTI4 10
+MODI4
+CNSTI4 1
+NEI4 $1067
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+152340+408
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1067
+LABELV $1065
+ADDRFP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $1072
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+152340+412
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $1072
+LABELV $1054
+LABELV $1052
+endproc CG_AddRefEntityWithPowerups 0 4
+export CG_LightVerts
+proc CG_LightVerts 88 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_R_LightForPoint
+CALLI4
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1080
+JUMPV
+LABELV $1077
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GTF4 $1083
+ADDRLP4 56
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 60
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+LTF4 $1086
+ADDRLP4 52
+ADDRLP4 56
+INDIRF4
+ADDRLP4 60
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1087
+JUMPV
+LABELV $1086
+ADDRLP4 52
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1087
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRLP4 52
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 68
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+LTF4 $1090
+ADDRLP4 64
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1091
+JUMPV
+LABELV $1090
+ADDRLP4 64
+ADDRLP4 68
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1091
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 64
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 80
+ADDRLP4 12+8
+INDIRF4
+ASGNF4
+ADDRLP4 84
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRF4
+LTF4 $1094
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+ADDRLP4 84
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $1095
+JUMPV
+LABELV $1094
+ADDRLP4 76
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $1095
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 76
+INDIRU4
+CVUU1 4
+ASGNU1
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRGP4 $1078
+JUMPV
+LABELV $1083
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LEI4 $1096
+ADDRLP4 0
+CNSTI4 255
+ASGNI4
+LABELV $1096
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LEI4 $1100
+ADDRLP4 0
+CNSTI4 255
+ASGNI4
+LABELV $1100
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 21
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 255
+LEI4 $1104
+ADDRLP4 0
+CNSTI4 255
+ASGNI4
+LABELV $1104
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 22
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+CNSTI4 24
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+CNSTI4 23
+ADDP4
+CNSTU1 255
+ASGNU1
+LABELV $1078
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1080
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $1077
+CNSTI4 1
+RETI4
+LABELV $1076
+endproc CG_LightVerts 88 16
+export CG_Player
+proc CG_Player 448 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 428
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 428
+INDIRI4
+CNSTI4 0
+LTI4 $1109
+ADDRLP4 428
+INDIRI4
+CNSTI4 64
+LTI4 $1107
+LABELV $1109
+ADDRGP4 $1110
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $1107
+ADDRLP4 280
+CNSTI4 1708
+ADDRLP4 428
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1112
+ADDRGP4 $1106
+JUMPV
+LABELV $1112
+ADDRLP4 424
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1114
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $1117
+ADDRLP4 424
+CNSTI4 2
+ASGNI4
+ADDRGP4 $1118
+JUMPV
+LABELV $1117
+ADDRGP4 cg_cameraMode+12
+INDIRI4
+CNSTI4 0
+EQI4 $1120
+ADDRGP4 $1106
+JUMPV
+LABELV $1120
+LABELV $1118
+LABELV $1114
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 284
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 140+28
+ARGP4
+ADDRLP4 284+28
+ARGP4
+ADDRGP4 CG_PlayerAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+96
+ARGP4
+ADDRLP4 0+80
+ARGP4
+ADDRLP4 0+100
+ARGP4
+ADDRLP4 140+96
+ARGP4
+ADDRLP4 140+80
+ARGP4
+ADDRLP4 140+100
+ARGP4
+ADDRGP4 CG_PlayerAnimation
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerSprites
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 432
+ARGP4
+ADDRLP4 444
+ADDRGP4 CG_PlayerShadow
+CALLI4
+ASGNI4
+ADDRLP4 436
+ADDRLP4 444
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_PlayerSplash
+CALLV
+pop
+ADDRGP4 cg_shadows+12
+INDIRI4
+CNSTI4 3
+NEI4 $1132
+ADDRLP4 436
+INDIRI4
+CNSTI4 0
+EQI4 $1132
+ADDRLP4 424
+ADDRLP4 424
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $1132
+ADDRLP4 424
+ADDRLP4 424
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+108
+ADDRLP4 280
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+68
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRLP4 0+84
+ADDRLP4 0+68
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 0
+NEI4 $1143
+ADDRGP4 $1106
+JUMPV
+LABELV $1143
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+8
+INDIRI4
+CNSTI4 0
+NEI4 $1147
+ADDRGP4 $1106
+JUMPV
+LABELV $1147
+ADDRLP4 140+108
+ADDRLP4 280
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1152
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 140+24
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRLP4 284+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 284+8
+INDIRI4
+CNSTI4 0
+NEI4 $1156
+ADDRGP4 $1106
+JUMPV
+LABELV $1156
+ADDRLP4 284+108
+ADDRLP4 280
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 284+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 284
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $1161
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 284+24
+ADDRLP4 432
+INDIRF4
+ASGNF4
+ADDRLP4 284+4
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRLP4 284
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddRefEntityWithPowerups
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddPlayerWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 CG_PlayerPowerups
+CALLV
+pop
+LABELV $1106
+endproc CG_Player 448 28
+export CG_ResetPlayerEntity
+proc CG_ResetPlayerEntity 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+CNSTI4 -99999
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 664
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1708
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+CNSTI4 1708
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ClearLerpFrame
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 48
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_debugPosition+12
+INDIRI4
+CNSTI4 0
+EQI4 $1169
+ADDRGP4 $1172
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $1169
+LABELV $1164
+endproc CG_ResetPlayerEntity 40 12
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1172
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 121
+byte 1 97
+byte 1 119
+byte 1 61
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $1161
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1152
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $1110
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $693
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $622
+byte 1 67
+byte 1 108
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 32
+byte 1 108
+byte 1 102
+byte 1 45
+byte 1 62
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $588
+byte 1 65
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $584
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $567
+byte 1 77
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 85
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $531
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $520
+byte 1 104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $487
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $485
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $483
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $481
+byte 1 116
+byte 1 108
+byte 1 0
+align 1
+LABELV $479
+byte 1 116
+byte 1 116
+byte 1 0
+align 1
+LABELV $477
+byte 1 116
+byte 1 0
+align 1
+LABELV $475
+byte 1 108
+byte 1 0
+align 1
+LABELV $473
+byte 1 119
+byte 1 0
+align 1
+LABELV $471
+byte 1 104
+byte 1 99
+byte 1 0
+align 1
+LABELV $469
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $467
+byte 1 99
+byte 1 50
+byte 1 0
+align 1
+LABELV $465
+byte 1 99
+byte 1 49
+byte 1 0
+align 1
+LABELV $462
+byte 1 110
+byte 1 0
+align 1
+LABELV $457
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $391
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $378
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $373
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $370
+byte 1 68
+byte 1 69
+byte 1 70
+byte 1 65
+byte 1 85
+byte 1 76
+byte 1 84
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 32
+byte 1 47
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $369
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $361
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 40
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 41
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $342
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $339
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $336
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $333
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $330
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $329
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $326
+byte 1 83
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $325
+byte 1 80
+byte 1 97
+byte 1 103
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $324
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $321
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $312
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $311
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $306
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $303
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $302
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $299
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $296
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $288
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $285
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $282
+byte 1 84
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $279
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $276
+byte 1 76
+byte 1 101
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $273
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $272
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $252
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $251
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $241
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $230
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $220
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $219
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $211
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $210
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $200
+byte 1 0
+align 1
+LABELV $199
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $198
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $186
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $161
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $158
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $155
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 108
+byte 1 101
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $144
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $135
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $132
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $131
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 103
+byte 1 121
+byte 1 0
+align 1
+LABELV $128
+byte 1 109
+byte 1 101
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $125
+byte 1 102
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $122
+byte 1 98
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $118
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $117
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $112
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $104
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $98
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $83
+byte 1 42
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $82
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $81
+byte 1 42
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $80
+byte 1 42
+byte 1 103
+byte 1 97
+byte 1 115
+byte 1 112
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $79
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $78
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $77
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 55
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $76
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 53
+byte 1 48
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $75
+byte 1 42
+byte 1 112
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 50
+byte 1 53
+byte 1 95
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $74
+byte 1 42
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $73
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $72
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $71
+byte 1 42
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
@@ -0,0 +1,3308 @@
+code
+proc CG_DrawClientScore 1084 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+LTI4 $75
+ADDRLP4 1048
+INDIRI4
+ADDRGP4 cgs+31480
+INDIRI4
+LTI4 $72
+LABELV $75
+ADDRGP4 $76
+ARGP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $71
+JUMPV
+LABELV $72
+ADDRLP4 12
+CNSTI4 1708
+ADDRFP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 1040
+CNSTI4 80
+ASGNI4
+ADDRLP4 1044
+CNSTI4 112
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $78
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $80
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 1052
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $79
+JUMPV
+LABELV $80
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1052
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1056
+CNSTI4 0
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRLP4 1056
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $79
+JUMPV
+LABELV $78
+ADDRLP4 12
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $82
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $84
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 1052
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $83
+JUMPV
+LABELV $84
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1052
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $83
+JUMPV
+LABELV $82
+ADDRLP4 12
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $86
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $88
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 1052
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $87
+JUMPV
+LABELV $88
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1052
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+ADDRLP4 1052
+INDIRF4
+ARGF4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawFlagModel
+CALLV
+pop
+ADDRGP4 $87
+JUMPV
+LABELV $86
+ADDRLP4 1052
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+LEI4 $90
+ADDRLP4 1052
+INDIRI4
+CNSTI4 5
+GTI4 $90
+ADDRGP4 cg_drawIcons+12
+INDIRI4
+CNSTI4 0
+EQI4 $91
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $95
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 1056
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+348-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $91
+JUMPV
+LABELV $95
+ADDRLP4 1040
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1056
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152340+348-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRGP4 $91
+JUMPV
+LABELV $90
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $103
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $105
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 1
+NEI4 $106
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+ADDRGP4 $107
+JUMPV
+LABELV $106
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $107
+LABELV $103
+LABELV $91
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 1
+NEI4 $109
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $112
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 100
+GEI4 $113
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $113
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+ADDRGP4 $114
+JUMPV
+LABELV $113
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawSmallStringColor
+CALLV
+pop
+LABELV $114
+LABELV $109
+LABELV $87
+LABELV $83
+LABELV $79
+ADDRLP4 1052
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 1052
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1052
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1052
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+CNSTF4 1127481344
+ASGNF4
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $118
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 16
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 1056
+CNSTF4 1111490560
+ASGNF4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+ADDRGP4 $119
+JUMPV
+LABELV $118
+ADDRLP4 1044
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1056
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRLP4 1056
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CG_DrawHead
+CALLV
+pop
+LABELV $119
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $120
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $122
+ARGP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $121
+JUMPV
+LABELV $120
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $123
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $125
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $126
+ARGP4
+ADDRLP4 1060
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1060
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 1060
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $124
+LABELV $121
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $127
+ADDRGP4 localClient
+CNSTI4 1
+ASGNI4
+ADDRLP4 1076
+CNSTI4 3
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+EQI4 $134
+ADDRGP4 cgs+31456
+INDIRI4
+ADDRLP4 1076
+INDIRI4
+LTI4 $130
+LABELV $134
+ADDRLP4 1072
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $131
+JUMPV
+LABELV $130
+ADDRLP4 1072
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+LABELV $131
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $136
+ADDRLP4 1080
+CNSTF4 0
+ASGNF4
+ADDRLP4 1056
+ADDRLP4 1080
+INDIRF4
+ASGNF4
+ADDRLP4 1056+4
+ADDRLP4 1080
+INDIRF4
+ASGNF4
+ADDRLP4 1056+8
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $137
+JUMPV
+LABELV $136
+ADDRLP4 1072
+INDIRI4
+CNSTI4 1
+NEI4 $140
+ADDRLP4 1056
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 1056+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 1056+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $141
+JUMPV
+LABELV $140
+ADDRLP4 1072
+INDIRI4
+CNSTI4 2
+NEI4 $144
+ADDRLP4 1080
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 1056
+ADDRLP4 1080
+INDIRF4
+ASGNF4
+ADDRLP4 1056+4
+ADDRLP4 1080
+INDIRF4
+ASGNF4
+ADDRLP4 1056+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $145
+JUMPV
+LABELV $144
+ADDRLP4 1080
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 1056
+ADDRLP4 1080
+INDIRF4
+ASGNF4
+ADDRLP4 1056+4
+ADDRLP4 1080
+INDIRF4
+ASGNF4
+ADDRLP4 1056+8
+CNSTF4 1060320051
+ASGNF4
+LABELV $145
+LABELV $141
+LABELV $137
+ADDRLP4 1056+12
+CNSTF4 1060320051
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+CNSTF4 1127219200
+ARGF4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1140850688
+ARGF4
+CNSTF4 1099431936
+ARGF4
+ADDRLP4 1056
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+LABELV $127
+CNSTI4 160
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRFP4 4
+INDIRP4
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $151
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $154
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawBigStringColor
+CALLV
+pop
+LABELV $151
+LABELV $71
+endproc CG_DrawClientScore 1084 28
+proc CG_TeamScoreboard 48 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 16+12
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $162
+JUMPV
+LABELV $159
+ADDRLP4 8
+CNSTI4 60
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 cg+110480
+ADDP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 1708
+ADDRLP4 8
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+EQI4 $166
+ADDRGP4 $160
+JUMPV
+LABELV $166
+ADDRFP4 0
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRFP4 8
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRI4
+CNSTI4 40
+NEI4 $169
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $169
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+LABELV $170
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawClientScore
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $160
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $162
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cg+110464
+INDIRI4
+GEI4 $171
+ADDRLP4 0
+INDIRI4
+ADDRFP4 12
+INDIRI4
+LTI4 $159
+LABELV $171
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $155
+endproc CG_TeamScoreboard 48 20
+export CG_DrawOldScoreboard
+proc CG_DrawOldScoreboard 76 24
+ADDRGP4 cg_paused+12
+INDIRI4
+CNSTI4 0
+EQI4 $173
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $173
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 2
+NEI4 $177
+ADDRGP4 cg+107636+4
+INDIRI4
+CNSTI4 5
+NEI4 $177
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $177
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+124656
+INDIRI4
+ADDRLP4 52
+INDIRI4
+EQI4 $183
+ADDRGP4 cg+114320
+INDIRI4
+ADDRLP4 52
+INDIRI4
+NEI4 $183
+CNSTI4 0
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $183
+ADDRGP4 cg+114320
+INDIRI4
+CNSTI4 0
+NEI4 $195
+ADDRGP4 cg+107636+4
+INDIRI4
+CNSTI4 3
+EQI4 $195
+ADDRGP4 cg+107636+4
+INDIRI4
+CNSTI4 5
+NEI4 $187
+LABELV $195
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 20
+ADDRGP4 colorWhite
+ASGNP4
+ADDRGP4 $188
+JUMPV
+LABELV $187
+ADDRGP4 cg+114328
+INDIRI4
+ARGI4
+CNSTI4 200
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $197
+ADDRGP4 cg+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+114332
+CNSTI1 0
+ASGNI1
+CNSTI4 0
+RETI4
+ADDRGP4 $172
+JUMPV
+LABELV $197
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $188
+ADDRGP4 cg+114332
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $201
+ADDRGP4 $204
+ARGP4
+ADDRGP4 cg+114332
+ARGP4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 60
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 640
+ADDRLP4 40
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 40
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $201
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+GEI4 $206
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 304
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $207
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 300
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_PlaceString
+CALLP4
+ASGNP4
+ADDRGP4 $212
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 292
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 60
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 64
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 640
+ADDRLP4 40
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 60
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+ADDRGP4 $207
+JUMPV
+LABELV $206
+ADDRGP4 cg+110472
+INDIRI4
+ADDRGP4 cg+110472+4
+INDIRI4
+NEI4 $215
+ADDRGP4 $220
+ARGP4
+ADDRGP4 cg+110472
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $216
+JUMPV
+LABELV $215
+ADDRGP4 cg+110472
+INDIRI4
+ADDRGP4 cg+110472+4
+INDIRI4
+LTI4 $222
+ADDRGP4 $227
+ARGP4
+ADDRGP4 cg+110472
+INDIRI4
+ARGI4
+ADDRGP4 cg+110472+4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRGP4 $231
+ARGP4
+ADDRGP4 cg+110472+4
+INDIRI4
+ARGI4
+ADDRGP4 cg+110472
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 56
+INDIRP4
+ASGNP4
+LABELV $223
+LABELV $216
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 56
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 640
+ADDRLP4 40
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 60
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRGP4 CG_DrawBigString
+CALLV
+pop
+LABELV $207
+ADDRLP4 4
+CNSTI4 86
+ASGNI4
+CNSTF4 1127219200
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 cgs+152340+496
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1132724224
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 cgs+152340+492
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1135345664
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 cgs+152340+500
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+CNSTF4 1137704960
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1115684864
+ARGF4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 cgs+152340+488
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 118
+ASGNI4
+ADDRGP4 cg+110464
+INDIRI4
+CNSTI4 7
+LEI4 $243
+ADDRLP4 24
+CNSTI4 17
+ASGNI4
+ADDRLP4 56
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 8
+ASGNI4
+ADDRLP4 48
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $244
+JUMPV
+LABELV $243
+ADDRLP4 24
+CNSTI4 7
+ASGNI4
+ADDRLP4 8
+CNSTI4 40
+ASGNI4
+ADDRLP4 56
+CNSTI4 16
+ASGNI4
+ADDRLP4 44
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 56
+INDIRI4
+ASGNI4
+LABELV $244
+ADDRGP4 localClient
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $246
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+ASGNI4
+ADDRGP4 cg+110472
+INDIRI4
+ADDRGP4 cg+110472+4
+INDIRI4
+LTI4 $249
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 56
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ARGI4
+CNSTI4 640
+ARGI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+ARGI4
+CNSTF4 1051260355
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 68
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ARGI4
+CNSTI4 640
+ARGI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+ARGI4
+CNSTF4 1051260355
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 32
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $250
+JUMPV
+LABELV $249
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 56
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ARGI4
+CNSTI4 640
+ARGI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+ARGI4
+CNSTF4 1051260355
+ARGF4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 68
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ARGI4
+CNSTI4 640
+ARGI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+ARGI4
+CNSTF4 1051260355
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_DrawTeamBackground
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+ADDRLP4 32
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $250
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ADDI4
+ASGNI4
+ADDRGP4 $247
+JUMPV
+LABELV $246
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 24
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_TeamScoreboard
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ADDI4
+ASGNI4
+LABELV $247
+ADDRGP4 localClient
+INDIRI4
+CNSTI4 0
+NEI4 $254
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $259
+JUMPV
+LABELV $256
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480
+ADDP4
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $261
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 40
+NEI4 $267
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+ADDRGP4 $268
+JUMPV
+LABELV $267
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $268
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawClientScore
+CALLV
+pop
+ADDRGP4 $258
+JUMPV
+LABELV $261
+LABELV $257
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $259
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+110464
+INDIRI4
+LTI4 $256
+LABELV $258
+LABELV $254
+ADDRLP4 56
+ADDRGP4 cg+16
+ASGNP4
+ADDRLP4 60
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LEI4 $269
+ADDRGP4 CG_LoadDeferredPlayers
+CALLV
+pop
+LABELV $269
+CNSTI4 1
+RETI4
+LABELV $172
+endproc CG_DrawOldScoreboard 76 24
+proc CG_CenterGiantLine 32 36
+ADDRLP4 20
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 16
+CNSTF4 1056964608
+CNSTI4 640
+ADDRLP4 24
+INDIRI4
+CNSTI4 5
+LSHI4
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+LABELV $272
+endproc CG_CenterGiantLine 32 36
+export CG_DrawOldTourneyScoreboard
+proc CG_DrawOldTourneyScoreboard 112 36
+ADDRGP4 cg+110460
+INDIRI4
+CNSTI4 2000
+ADDI4
+ADDRGP4 cg+107604
+INDIRI4
+GEI4 $277
+ADDRGP4 cg+110460
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $283
+ARGP4
+ADDRGP4 trap_SendClientCommand
+CALLV
+pop
+LABELV $277
+ADDRLP4 44
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 8+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+CNSTF4 1142947840
+ARGF4
+CNSTF4 1139802112
+ARGF4
+ADDRLP4 8
+ARGP4
+ADDRGP4 CG_FillRect
+CALLV
+pop
+CNSTI4 4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 56
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $290
+ADDRLP4 4
+ADDRGP4 $292
+ASGNP4
+LABELV $290
+CNSTF4 1090519040
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CenterGiantLine
+CALLV
+pop
+ADDRLP4 32
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 60
+ASGNI4
+ADDRLP4 36
+ADDRLP4 32
+INDIRI4
+ADDRLP4 64
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 64
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 72
+CNSTI4 10
+ASGNI4
+ADDRLP4 40
+ADDRLP4 32
+INDIRI4
+ADDRLP4 72
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+ADDRLP4 72
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $294
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 76
+INDIRP4
+ASGNP4
+CNSTF4 1115684864
+ARGF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_CenterGiantLine
+CALLV
+pop
+ADDRLP4 24
+CNSTI4 160
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 3
+LTI4 $295
+CNSTI4 8
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 $298
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $105
+ARGP4
+ADDRGP4 cg+110472
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+CNSTI4 632
+ADDRLP4 88
+INDIRI4
+CNSTI4 5
+LSHI4
+SUBI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRGP4 $300
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $105
+ARGP4
+ADDRGP4 cg+110472+4
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+CNSTI4 632
+ADDRLP4 104
+INDIRI4
+CNSTI4 5
+LSHI4
+SUBI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 108
+CNSTI4 1
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $303
+ADDRLP4 0
+CNSTI4 1708
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $308
+ADDRGP4 $304
+JUMPV
+LABELV $308
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $310
+ADDRGP4 $304
+JUMPV
+LABELV $310
+CNSTI4 8
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 80
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRGP4 $105
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+CNSTI4 632
+ADDRLP4 88
+INDIRI4
+CNSTI4 5
+LSHI4
+SUBI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 92
+CNSTI4 1
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_DrawStringExt
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 24
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+LABELV $304
+ADDRLP4 28
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 64
+LTI4 $303
+LABELV $296
+LABELV $276
+endproc CG_DrawOldTourneyScoreboard 112 36
+bss
+align 4
+LABELV localClient
+skip 4
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $300
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $298
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $294
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $292
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $283
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $231
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $227
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $220
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $212
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $204
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $154
+byte 1 82
+byte 1 69
+byte 1 65
+byte 1 68
+byte 1 89
+byte 1 0
+align 1
+LABELV $126
+byte 1 37
+byte 1 53
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $125
+byte 1 32
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 32
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $122
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $112
+byte 1 37
+byte 1 105
+byte 1 47
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $105
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $76
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 45
+byte 1 62
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
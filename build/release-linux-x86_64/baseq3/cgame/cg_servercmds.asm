@@ -0,0 +1,6213 @@
+lit
+align 4
+LABELV validOrders
+address $72
+byte 4 1
+address $73
+byte 4 1
+address $74
+byte 4 2
+address $75
+byte 4 2
+address $76
+byte 4 3
+address $77
+byte 4 7
+address $78
+byte 4 4
+address $79
+byte 4 5
+address $80
+byte 4 6
+align 4
+LABELV numValidOrders
+byte 4 9
+code
+proc CG_ParseScores 212 12
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+110464
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110464
+INDIRI4
+CNSTI4 64
+LEI4 $83
+ADDRGP4 cg+110464
+CNSTI4 64
+ASGNI4
+LABELV $83
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+110472
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 3
+ARGI4
+ADDRLP4 24
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+110472+4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 cg+110480
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 3840
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $95
+JUMPV
+LABELV $92
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480+4
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 6
+ADDI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480+8
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 7
+ADDI4
+ARGI4
+ADDRLP4 72
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480+12
+ADDP4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480+16
+ADDP4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 9
+ADDI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 10
+ADDI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480+24
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 11
+ADDI4
+ARGI4
+ADDRLP4 116
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480+28
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 12
+ADDI4
+ARGI4
+ADDRLP4 128
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480+32
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 13
+ADDI4
+ARGI4
+ADDRLP4 140
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480+36
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 148
+CNSTI4 14
+ASGNI4
+ADDRLP4 148
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 148
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480+40
+ADDP4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 15
+ADDI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480+44
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 16
+ADDI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480+52
+ADDP4
+ADDRLP4 184
+INDIRI4
+ASGNI4
+CNSTI4 14
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 17
+ADDI4
+ARGI4
+ADDRLP4 192
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480+48
+ADDP4
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 200
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+ADDRGP4 cg+110480
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $126
+ADDRLP4 200
+INDIRI4
+ADDRGP4 cg+110480
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $122
+LABELV $126
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $122
+ADDRLP4 204
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+CNSTI4 1708
+ADDRLP4 204
+INDIRI4
+ADDRGP4 cg+110480
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+100
+ADDP4
+ADDRLP4 204
+INDIRI4
+ADDRGP4 cg+110480+4
+ADDP4
+INDIRI4
+ASGNI4
+CNSTI4 1708
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg+110480
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+140
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 208
+CNSTI4 60
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+ADDRGP4 cg+110480+56
+ADDP4
+CNSTI4 1708
+ADDRLP4 208
+INDIRI4
+ADDRGP4 cg+110480
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+68
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $93
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $95
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+110464
+INDIRI4
+LTI4 $92
+LABELV $81
+endproc CG_ParseScores 212 12
+proc CG_ParseTeamInfo 76 8
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 numSortedTeamPlayers
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $144
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+LEI4 $142
+LABELV $144
+ADDRGP4 $145
+ARGP4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $141
+JUMPV
+LABELV $142
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $149
+JUMPV
+LABELV $146
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 2
+ADDI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $152
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $150
+LABELV $152
+ADDRGP4 $153
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $141
+JUMPV
+LABELV $150
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 sortedTeamPlayers
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 3
+ADDI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 1708
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+104
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 4
+ADDI4
+ARGI4
+ADDRLP4 40
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 1708
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+108
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 5
+ADDI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 1708
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+112
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 6
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 56
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 1708
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+116
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+CNSTI4 6
+ADDRLP4 4
+INDIRI4
+MULI4
+CNSTI4 7
+ADDI4
+ARGI4
+ADDRLP4 68
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 1708
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+140
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $147
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $149
+ADDRLP4 4
+INDIRI4
+ADDRGP4 numSortedTeamPlayers
+INDIRI4
+LTI4 $146
+LABELV $141
+endproc CG_ParseTeamInfo 76 8
+export CG_ParseServerinfo
+proc CG_ParseServerinfo 84 16
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $166
+ARGP4
+ADDRLP4 12
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31456
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $167
+ARGP4
+ADDRGP4 cgs+31456
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $166
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31460
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31464
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $174
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31468
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $176
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31472
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $178
+ARGP4
+ADDRLP4 56
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31476
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $180
+ARGP4
+ADDRLP4 64
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31480
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $181
+ARGP4
+ADDRLP4 72
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+31484
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $184
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $186
+ARGP4
+ADDRLP4 76
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 cgs+31548
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $186
+ARGP4
+ADDRGP4 cgs+31548
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $190
+ARGP4
+ADDRLP4 80
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 cgs+31612
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $190
+ARGP4
+ADDRGP4 cgs+31612
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $164
+endproc CG_ParseServerinfo 84 16
+proc CG_ParseWarmup 24 8
+CNSTI4 5
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cg+124660
+CNSTI4 -1
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $195
+ADDRGP4 cg+124656
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $195
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $198
+ADDRGP4 cg+124656
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $198
+ADDRGP4 cgs+152340+972
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $198
+LABELV $196
+ADDRGP4 cg+124656
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $193
+endproc CG_ParseWarmup 24 8
+export CG_SetConfigValues
+proc CG_SetConfigValues 36 4
+CNSTI4 6
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34800
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 7
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34804
+ADDRLP4 16
+INDIRI4
+ASGNI4
+CNSTI4 21
+ARGI4
+ADDRLP4 20
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34796
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+NEI4 $208
+CNSTI4 23
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 cgs+34808
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 cgs+34812
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+LABELV $208
+CNSTI4 5
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+124656
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $204
+endproc CG_SetConfigValues 36 4
+export CG_ShaderStateChanged
+proc CG_ShaderStateChanged 188 12
+CNSTI4 24
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRGP4 $216
+JUMPV
+LABELV $215
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $218
+ARGP4
+ADDRLP4 160
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 160
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $217
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $217
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 12
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $221
+ARGP4
+ADDRLP4 172
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 172
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $217
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $217
+ADDRLP4 76
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 76
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $223
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $224
+ARGP4
+ADDRLP4 180
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 180
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $220
+ADDRLP4 140
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ADDRLP4 140
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 trap_R_RemapShader
+CALLV
+pop
+LABELV $220
+LABELV $216
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $227
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $215
+LABELV $227
+LABELV $217
+LABELV $214
+endproc CG_ShaderStateChanged 188 12
+proc CG_ConfigStringModified 48 12
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 cgs
+ARGP4
+ADDRGP4 trap_GetGameState
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_ConfigString
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $229
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+ADDRGP4 $230
+JUMPV
+LABELV $229
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $231
+ADDRGP4 CG_ParseServerinfo
+CALLV
+pop
+ADDRGP4 $232
+JUMPV
+LABELV $231
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+NEI4 $233
+ADDRGP4 CG_ParseWarmup
+CALLV
+pop
+ADDRGP4 $234
+JUMPV
+LABELV $233
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+NEI4 $235
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34800
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $236
+JUMPV
+LABELV $235
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $238
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34804
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $238
+ADDRLP4 0
+INDIRI4
+CNSTI4 21
+NEI4 $241
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+34796
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $242
+JUMPV
+LABELV $241
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $244
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31676
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31688
+CNSTI4 1
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $244
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $248
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31680
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31688
+CNSTI4 1
+ASGNI4
+ADDRGP4 $249
+JUMPV
+LABELV $248
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+NEI4 $252
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cgs+31684
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+31688
+CNSTI4 1
+ASGNI4
+ADDRGP4 $253
+JUMPV
+LABELV $252
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $256
+ADDRGP4 cgs+31692
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $257
+JUMPV
+LABELV $256
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $260
+ADDRLP4 0
+INDIRI4
+CNSTI4 13
+GTI4 $260
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32716-48
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32740-48
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $261
+JUMPV
+LABELV $260
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $266
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+GTI4 $266
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32724-64
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32740-64
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+LTI4 $272
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+GTI4 $272
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32732-72
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+32740-72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $272
+ADDRLP4 0
+INDIRI4
+CNSTI4 14
+LTI4 $278
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+GTI4 $278
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 cgs+32748-14336
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $279
+JUMPV
+LABELV $278
+ADDRLP4 0
+INDIRI4
+CNSTI4 22
+NEI4 $283
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRGP4 cg+24
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $284
+JUMPV
+LABELV $283
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $286
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+GEI4 $286
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+34824-128
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRLP4 0
+INDIRI4
+CNSTI4 288
+LTI4 $290
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+GEI4 $290
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+EQI4 $291
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+35848-1152
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $291
+JUMPV
+LABELV $290
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+LTI4 $296
+ADDRLP4 0
+INDIRI4
+CNSTI4 608
+GEI4 $296
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+SUBI4
+ARGI4
+ADDRGP4 CG_NewClientInfo
+CALLV
+pop
+ADDRGP4 CG_BuildSpectatorString
+CALLV
+pop
+ADDRGP4 $297
+JUMPV
+LABELV $296
+ADDRLP4 0
+INDIRI4
+CNSTI4 23
+NEI4 $298
+ADDRGP4 cgs+31456
+INDIRI4
+CNSTI4 4
+NEI4 $299
+ADDRGP4 cgs+34808
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 cgs+34812
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRGP4 $299
+JUMPV
+LABELV $298
+ADDRLP4 0
+INDIRI4
+CNSTI4 24
+NEI4 $305
+ADDRGP4 CG_ShaderStateChanged
+CALLV
+pop
+LABELV $305
+LABELV $299
+LABELV $297
+LABELV $291
+LABELV $287
+LABELV $284
+LABELV $279
+LABELV $273
+LABELV $267
+LABELV $261
+LABELV $257
+LABELV $253
+LABELV $249
+LABELV $245
+LABELV $242
+LABELV $239
+LABELV $236
+LABELV $234
+LABELV $232
+LABELV $230
+LABELV $228
+endproc CG_ConfigStringModified 48 12
+proc CG_AddToTeamChat 64 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+CNSTI4 8
+GEI4 $308
+ADDRLP4 12
+ADDRGP4 cg_teamChatHeight+12
+INDIRI4
+ASGNI4
+ADDRGP4 $309
+JUMPV
+LABELV $308
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+LABELV $309
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $315
+ADDRGP4 cg_teamChatTime+12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+GTI4 $312
+LABELV $315
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+152248
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 cgs+152244
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $307
+JUMPV
+LABELV $312
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 241
+ADDRGP4 cgs+152244
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+150284
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 16
+CNSTI4 55
+ASGNI4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRGP4 $321
+JUMPV
+LABELV $320
+ADDRLP4 4
+INDIRI4
+CNSTI4 79
+LEI4 $323
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $325
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+SUBP4
+ASGNP4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+SUBP4
+ASGNP4
+LABELV $325
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+152244
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152212
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 cgs+152244
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 241
+ADDRGP4 cgs+152244
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+MULI4
+ADDRGP4 cgs+150284
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI1 94
+ASGNI1
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 16
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+LABELV $323
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $333
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $333
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $333
+ADDRLP4 28
+INDIRI4
+CNSTI4 65
+LTI4 $336
+ADDRLP4 28
+INDIRI4
+CNSTI4 90
+LEI4 $335
+LABELV $336
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 97
+LTI4 $337
+ADDRLP4 32
+INDIRI4
+CNSTI4 122
+LEI4 $335
+LABELV $337
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 48
+LTI4 $333
+ADDRLP4 36
+INDIRI4
+CNSTI4 57
+GTI4 $333
+LABELV $335
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 44
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 56
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 60
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 52
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 56
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRGP4 $321
+JUMPV
+LABELV $333
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $338
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $338
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 40
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 44
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $321
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $320
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 cgs+152244
+INDIRI4
+ADDRLP4 12
+INDIRI4
+MODI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cgs+152212
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 cgs+152244
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cgs+152244
+INDIRI4
+ADDRGP4 cgs+152248
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+LEI4 $344
+ADDRGP4 cgs+152248
+ADDRGP4 cgs+152244
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $344
+LABELV $307
+endproc CG_AddToTeamChat 64 0
+proc CG_MapRestart 0 12
+ADDRGP4 cg_showmiss+12
+INDIRI4
+CNSTI4 0
+EQI4 $351
+ADDRGP4 $354
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $351
+ADDRGP4 CG_InitLocalEntities
+CALLV
+pop
+ADDRGP4 CG_InitMarkPolys
+CALLV
+pop
+ADDRGP4 CG_ClearParticles
+CALLV
+pop
+ADDRGP4 cg+107620
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+107616
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+24
+CNSTI4 0
+ASGNI4
+ADDRGP4 cgs+31676
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+107624
+CNSTI4 1
+ASGNI4
+ADDRGP4 CG_StartMusic
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRGP4 cg+124656
+INDIRI4
+CNSTI4 0
+NEI4 $360
+ADDRGP4 cgs+152340+968
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 $365
+ARGP4
+CNSTI4 120
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+LABELV $360
+ADDRGP4 $366
+ARGP4
+ADDRGP4 $367
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $350
+endproc CG_MapRestart 0 12
+export CG_ParseVoiceChats
+proc CG_ParseVoiceChats 16508 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg_buildScript+12
+INDIRI4
+CNSTI4 0
+EQI4 $369
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $369
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16420
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 16420
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $372
+ADDRGP4 $374
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16424
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16424
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $368
+JUMPV
+LABELV $372
+ADDRLP4 24
+INDIRI4
+CNSTI4 16384
+LTI4 $375
+ADDRGP4 $377
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+CNSTI4 16384
+ARGI4
+ADDRLP4 16424
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16424
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $368
+JUMPV
+LABELV $375
+ADDRLP4 32
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 24
+INDIRI4
+ADDRLP4 32
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 16416
+ADDRLP4 32
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16416
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $378
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $382
+JUMPV
+LABELV $379
+CNSTI4 4420
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $380
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $382
+ADDRLP4 20
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $379
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16424
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16424
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $385
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $383
+LABELV $385
+CNSTI4 1
+RETI4
+ADDRGP4 $368
+JUMPV
+LABELV $383
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $388
+ARGP4
+ADDRLP4 16432
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16432
+INDIRI4
+CNSTI4 0
+NEI4 $386
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $387
+JUMPV
+LABELV $386
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $391
+ARGP4
+ADDRLP4 16436
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16436
+INDIRI4
+CNSTI4 0
+NEI4 $389
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $390
+JUMPV
+LABELV $389
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $394
+ARGP4
+ADDRLP4 16440
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16440
+INDIRI4
+CNSTI4 0
+NEI4 $392
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $393
+JUMPV
+LABELV $392
+ADDRGP4 $395
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16444
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16444
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $368
+JUMPV
+LABELV $393
+LABELV $390
+LABELV $387
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $397
+JUMPV
+LABELV $396
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16444
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16444
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $401
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $399
+LABELV $401
+CNSTI4 1
+RETI4
+ADDRGP4 $368
+JUMPV
+LABELV $399
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16452
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16452
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $404
+ARGP4
+ADDRLP4 16456
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16456
+INDIRI4
+CNSTI4 0
+EQI4 $402
+ADDRGP4 $405
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16460
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16460
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $368
+JUMPV
+LABELV $402
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $407
+JUMPV
+LABELV $406
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16460
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16460
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $411
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $409
+LABELV $411
+CNSTI4 1
+RETI4
+ADDRGP4 $368
+JUMPV
+LABELV $409
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $414
+ARGP4
+ADDRLP4 16468
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16468
+INDIRI4
+CNSTI4 0
+NEI4 $412
+ADDRGP4 $408
+JUMPV
+LABELV $412
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 16472
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16472
+INDIRI4
+ASGNI4
+ADDRLP4 16476
+CNSTI4 68
+ASGNI4
+ADDRLP4 16480
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16476
+INDIRI4
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16480
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16480
+INDIRP4
+ADDRLP4 16476
+INDIRI4
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16484
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16484
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $417
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $415
+LABELV $417
+CNSTI4 1
+RETI4
+ADDRGP4 $368
+JUMPV
+LABELV $415
+ADDRLP4 16492
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16496
+CNSTI4 64
+ASGNI4
+ADDRLP4 16492
+INDIRP4
+ADDRLP4 16496
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRLP4 16492
+INDIRP4
+CNSTI4 324
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 16496
+INDIRI4
+ARGI4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $418
+ADDRLP4 16500
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 16500
+INDIRP4
+ADDRLP4 16500
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $418
+ADDRLP4 16504
+CNSTI4 64
+ASGNI4
+CNSTI4 4420
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ADDRLP4 16504
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 16504
+INDIRI4
+LTI4 $420
+ADDRGP4 $408
+JUMPV
+LABELV $420
+LABELV $407
+ADDRGP4 $406
+JUMPV
+LABELV $408
+ADDRLP4 16460
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 16460
+INDIRP4
+ADDRLP4 16460
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $422
+CNSTI4 1
+RETI4
+ADDRGP4 $368
+JUMPV
+LABELV $422
+LABELV $397
+ADDRGP4 $396
+JUMPV
+CNSTI4 1
+RETI4
+LABELV $368
+endproc CG_ParseVoiceChats 16508 16
+export CG_LoadVoiceChats
+proc CG_LoadVoiceChats 12 12
+ADDRLP4 4
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $425
+ARGP4
+ADDRGP4 voiceChatLists
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $426
+ARGP4
+ADDRGP4 voiceChatLists+282952
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $428
+ARGP4
+ADDRGP4 voiceChatLists+565904
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $430
+ARGP4
+ADDRGP4 voiceChatLists+848856
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $432
+ARGP4
+ADDRGP4 voiceChatLists+1131808
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $434
+ARGP4
+ADDRGP4 voiceChatLists+1414760
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $436
+ARGP4
+ADDRGP4 voiceChatLists+1697712
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRGP4 $438
+ARGP4
+ADDRGP4 voiceChatLists+1980664
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 CG_ParseVoiceChats
+CALLI4
+pop
+ADDRLP4 8
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRGP4 $440
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $424
+endproc CG_LoadVoiceChats 12 12
+export CG_HeadModelVoiceChats
+proc CG_HeadModelVoiceChats 16424 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16408
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16408
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $442
+CNSTI4 -1
+RETI4
+ADDRGP4 $441
+JUMPV
+LABELV $442
+ADDRLP4 8
+INDIRI4
+CNSTI4 16384
+LTI4 $444
+ADDRGP4 $377
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 16384
+ARGI4
+ADDRLP4 16412
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16412
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 -1
+RETI4
+ADDRGP4 $441
+JUMPV
+LABELV $444
+ADDRLP4 16
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 16404
+ADDRLP4 16
+ASGNP4
+ADDRLP4 16400
+ADDRLP4 16404
+ASGNP4
+ADDRLP4 16400
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 16412
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16412
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $448
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $446
+LABELV $448
+CNSTI4 -1
+RETI4
+ADDRGP4 $441
+JUMPV
+LABELV $446
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $449
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 282952
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists
+ADDP4
+ARGP4
+ADDRLP4 16420
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16420
+INDIRI4
+CNSTI4 0
+NEI4 $453
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $441
+JUMPV
+LABELV $453
+LABELV $450
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $449
+CNSTI4 -1
+RETI4
+LABELV $441
+endproc CG_HeadModelVoiceChats 16424 16
+export CG_GetVoiceChat
+proc CG_GetVoiceChat 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $459
+JUMPV
+LABELV $456
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4420
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $460
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 4420
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+CNSTI4 4420
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+CNSTI4 324
+ADDP4
+ADDP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $455
+JUMPV
+LABELV $460
+LABELV $457
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $459
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+LTI4 $456
+CNSTI4 0
+RETI4
+LABELV $455
+endproc CG_GetVoiceChat 20 8
+export CG_VoiceChatListForClient
+proc CG_VoiceChatListForClient 164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $465
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $463
+LABELV $465
+ADDRFP4 0
+CNSTI4 0
+ASGNI4
+LABELV $463
+ADDRLP4 148
+CNSTI4 1708
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+LABELV $467
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $471
+ADDRLP4 148
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $473
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $475
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 289
+ADDP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 352
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $472
+JUMPV
+LABELV $473
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $475
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 288
+ADDP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 352
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $472
+JUMPV
+LABELV $471
+ADDRLP4 148
+INDIRP4
+CNSTI4 288
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $476
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 289
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $477
+JUMPV
+LABELV $476
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 148
+INDIRP4
+CNSTI4 288
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $477
+LABELV $472
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $478
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 156
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $482
+ADDRGP4 $480
+JUMPV
+LABELV $482
+LABELV $479
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $478
+LABELV $480
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $484
+CNSTI4 282952
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat+64
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists
+ADDP4
+RETP4
+ADDRGP4 $462
+JUMPV
+LABELV $484
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $487
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $491
+ADDRLP4 76
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $493
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 76
+ARGP4
+ADDRLP4 160
+ADDRGP4 CG_HeadModelVoiceChats
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 -1
+NEI4 $494
+ADDRGP4 $489
+JUMPV
+LABELV $494
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat+64
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+CNSTI4 282952
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat+64
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists
+ADDP4
+RETP4
+ADDRGP4 $462
+JUMPV
+LABELV $491
+LABELV $488
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $487
+LABELV $489
+LABELV $468
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LTI4 $467
+ADDRLP4 140
+ADDRLP4 148
+INDIRP4
+CNSTI4 512
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+LABELV $498
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $502
+CNSTI4 282952
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $506
+CNSTI4 282952
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists+64
+ADDP4
+INDIRI4
+ADDRLP4 140
+INDIRI4
+NEI4 $508
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $511
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $515
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat+64
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $513
+JUMPV
+LABELV $515
+LABELV $512
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $511
+LABELV $513
+CNSTI4 282952
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 voiceChatLists
+ADDP4
+RETP4
+ADDRGP4 $462
+JUMPV
+LABELV $508
+LABELV $506
+LABELV $503
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $502
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+NEI4 $518
+ADDRGP4 $500
+JUMPV
+LABELV $518
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+LABELV $499
+ADDRLP4 144
+ADDRLP4 144
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LTI4 $498
+LABELV $500
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $520
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $524
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+CNSTI4 68
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 headModelVoiceChat+64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $522
+JUMPV
+LABELV $524
+LABELV $521
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $520
+LABELV $522
+ADDRGP4 voiceChatLists
+RETP4
+LABELV $462
+endproc CG_VoiceChatListForClient 164 20
+export CG_PlayVoiceChat
+proc CG_PlayVoiceChat 0 0
+LABELV $527
+endproc CG_PlayVoiceChat 0 0
+export CG_PlayBufferedVoiceChats
+proc CG_PlayBufferedVoiceChats 0 0
+LABELV $528
+endproc CG_PlayBufferedVoiceChats 0 0
+export CG_AddBufferedVoiceChat
+proc CG_AddBufferedVoiceChat 0 0
+LABELV $529
+endproc CG_AddBufferedVoiceChat 0 0
+export CG_VoiceChatLocal
+proc CG_VoiceChatLocal 0 0
+LABELV $530
+endproc CG_VoiceChatLocal 0 0
+export CG_VoiceChat
+proc CG_VoiceChat 0 0
+LABELV $531
+endproc CG_VoiceChat 0 0
+proc CG_RemoveChatEscapeChar 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $536
+JUMPV
+LABELV $533
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 25
+NEI4 $537
+ADDRGP4 $534
+JUMPV
+LABELV $537
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $534
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $536
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $533
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $532
+endproc CG_RemoveChatEscapeChar 20 0
+proc CG_ServerCommand 416 12
+CNSTI4 0
+ARGI4
+ADDRLP4 156
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $540
+ADDRGP4 $539
+JUMPV
+LABELV $540
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $544
+ARGP4
+ADDRLP4 160
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $542
+CNSTI4 1
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 CG_CenterPrint
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $542
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $547
+ARGP4
+ADDRLP4 164
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $545
+ADDRGP4 CG_ConfigStringModified
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $545
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $550
+ARGP4
+ADDRLP4 168
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+NEI4 $548
+CNSTI4 1
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $548
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 172
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $551
+ADDRGP4 cg_teamChatsOnly+12
+INDIRI4
+CNSTI4 0
+NEI4 $539
+ADDRGP4 cgs+152340+728
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_RemoveChatEscapeChar
+CALLV
+pop
+ADDRGP4 $559
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $551
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $562
+ARGP4
+ADDRLP4 176
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $560
+ADDRGP4 cgs+152340+728
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRLP4 180
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 180
+INDIRP4
+ARGP4
+CNSTI4 150
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_RemoveChatEscapeChar
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_AddToTeamChat
+CALLV
+pop
+ADDRGP4 $559
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $560
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $567
+ARGP4
+ADDRLP4 180
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $565
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_VoiceChat
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $565
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $570
+ARGP4
+ADDRLP4 184
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+NEI4 $568
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_VoiceChat
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $568
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $573
+ARGP4
+ADDRLP4 188
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+NEI4 $571
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_VoiceChat
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $571
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $576
+ARGP4
+ADDRLP4 192
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $574
+ADDRGP4 CG_ParseScores
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $574
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $579
+ARGP4
+ADDRLP4 196
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+NEI4 $577
+ADDRGP4 CG_ParseTeamInfo
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $577
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $582
+ARGP4
+ADDRLP4 200
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+NEI4 $580
+ADDRGP4 CG_MapRestart
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $580
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $585
+ARGP4
+ADDRLP4 204
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+NEI4 $583
+ADDRLP4 208
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 4
+NEI4 $539
+CNSTI4 1
+ARGI4
+ADDRLP4 404
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 212
+ARGP4
+ADDRLP4 404
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRLP4 408
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 276
+ARGP4
+ADDRLP4 408
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+CNSTI4 3
+ARGI4
+ADDRLP4 412
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 340
+ARGP4
+ADDRLP4 412
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 212
+ARGP4
+ADDRLP4 276
+ARGP4
+ADDRLP4 340
+ARGP4
+ADDRGP4 trap_R_RemapShader
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $583
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $590
+ARGP4
+ADDRLP4 208
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+NEI4 $588
+ADDRGP4 CG_LoadDeferredPlayers
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $588
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $593
+ARGP4
+ADDRLP4 212
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $591
+ADDRGP4 cg+12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $539
+JUMPV
+LABELV $591
+ADDRGP4 $595
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $539
+endproc CG_ServerCommand 416 12
+export CG_ExecuteNewServerCommands
+proc CG_ExecuteNewServerCommands 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $598
+JUMPV
+LABELV $597
+ADDRLP4 0
+ADDRGP4 cgs+31444
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_GetServerCommand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $601
+ADDRGP4 CG_ServerCommand
+CALLV
+pop
+LABELV $601
+LABELV $598
+ADDRGP4 cgs+31444
+INDIRI4
+ADDRFP4 0
+INDIRI4
+LTI4 $597
+LABELV $596
+endproc CG_ExecuteNewServerCommands 12 4
+bss
+export voiceChatBuffer
+align 4
+LABELV voiceChatBuffer
+skip 9984
+export headModelVoiceChat
+align 4
+LABELV headModelVoiceChat
+skip 4352
+export voiceChatLists
+align 4
+LABELV voiceChatLists
+skip 2263616
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $595
+byte 1 85
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $593
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 76
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $590
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $585
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 83
+byte 1 104
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $582
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $579
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $576
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $573
+byte 1 118
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $570
+byte 1 118
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $567
+byte 1 118
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $562
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $559
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $553
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $550
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $547
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $544
+byte 1 99
+byte 1 112
+byte 1 0
+align 1
+LABELV $493
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 118
+byte 1 99
+byte 1 0
+align 1
+LABELV $475
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $440
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $438
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 53
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $436
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 52
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $434
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 51
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $432
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 50
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $430
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 49
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $428
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 51
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $426
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 50
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $425
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 49
+byte 1 46
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $414
+byte 1 125
+byte 1 0
+align 1
+LABELV $405
+byte 1 94
+byte 1 49
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 123
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $404
+byte 1 123
+byte 1 0
+align 1
+LABELV $395
+byte 1 94
+byte 1 49
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $394
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $391
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $388
+byte 1 102
+byte 1 101
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $378
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $377
+byte 1 94
+byte 1 49
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $374
+byte 1 94
+byte 1 49
+byte 1 118
+byte 1 111
+byte 1 105
+byte 1 99
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $367
+byte 1 48
+byte 1 0
+align 1
+LABELV $366
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 114
+byte 1 100
+byte 1 80
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $365
+byte 1 70
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 33
+byte 1 0
+align 1
+LABELV $354
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $224
+byte 1 64
+byte 1 0
+align 1
+LABELV $221
+byte 1 58
+byte 1 0
+align 1
+LABELV $218
+byte 1 61
+byte 1 0
+align 1
+LABELV $190
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $186
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $184
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 98
+byte 1 115
+byte 1 112
+byte 1 0
+align 1
+LABELV $181
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $180
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $178
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $176
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $174
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $172
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $170
+byte 1 100
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $167
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $166
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $153
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $145
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 0
+align 1
+LABELV $80
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $79
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $78
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $77
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $76
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $75
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $74
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $73
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $72
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
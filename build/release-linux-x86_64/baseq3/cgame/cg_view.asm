@@ -0,0 +1,3526 @@
+export CG_TestModel_f
+code
+proc CG_TestModel_f 36 12
+ADDRGP4 cg+124784
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 12
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+GEI4 $74
+ADDRGP4 $71
+JUMPV
+LABELV $74
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRGP4 cg+124924
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 cg+124924
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cg+124784+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 3
+NEI4 $80
+CNSTI4 2
+ARGI4
+ADDRLP4 28
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRGP4 cg+124784+100
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 cg+124784+80
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+124784+96
+CNSTI4 0
+ASGNI4
+LABELV $80
+ADDRGP4 cg+124784+8
+INDIRI4
+CNSTI4 0
+NEI4 $88
+ADDRGP4 $92
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $71
+JUMPV
+LABELV $88
+ADDRGP4 cg+124784+68
+ADDRGP4 cg+109044+24
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+109044+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+124784+68+4
+ADDRGP4 cg+109044+24+4
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+109044+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+124784+68+8
+ADDRGP4 cg+109044+24+8
+INDIRF4
+CNSTF4 1120403456
+ADDRGP4 cg+109044+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 cg+109412+4
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+124784+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+124988
+CNSTI4 0
+ASGNI4
+LABELV $71
+endproc CG_TestModel_f 36 12
+export CG_TestGun_f
+proc CG_TestGun_f 0 0
+ADDRGP4 CG_TestModel_f
+CALLV
+pop
+ADDRGP4 cg+124988
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+124784+4
+CNSTI4 13
+ASGNI4
+LABELV $124
+endproc CG_TestGun_f 0 0
+export CG_TestModelNextFrame_f
+proc CG_TestModelNextFrame_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+124784+80
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $131
+ARGP4
+ADDRGP4 cg+124784+80
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $128
+endproc CG_TestModelNextFrame_f 4 8
+export CG_TestModelPrevFrame_f
+proc CG_TestModelPrevFrame_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+124784+80
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+124784+80
+INDIRI4
+CNSTI4 0
+GEI4 $137
+ADDRGP4 cg+124784+80
+CNSTI4 0
+ASGNI4
+LABELV $137
+ADDRGP4 $131
+ARGP4
+ADDRGP4 cg+124784+80
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $134
+endproc CG_TestModelPrevFrame_f 4 8
+export CG_TestModelNextSkin_f
+proc CG_TestModelNextSkin_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+124784+104
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $148
+ARGP4
+ADDRGP4 cg+124784+104
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $145
+endproc CG_TestModelNextSkin_f 4 8
+export CG_TestModelPrevSkin_f
+proc CG_TestModelPrevSkin_f 4 8
+ADDRLP4 0
+ADDRGP4 cg+124784+104
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+124784+104
+INDIRI4
+CNSTI4 0
+GEI4 $154
+ADDRGP4 cg+124784+104
+CNSTI4 0
+ASGNI4
+LABELV $154
+ADDRGP4 $148
+ARGP4
+ADDRGP4 cg+124784+104
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $151
+endproc CG_TestModelPrevSkin_f 4 8
+proc CG_AddTestModel 32 4
+ADDRGP4 cg+124924
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cg+124784+8
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 cg+124784+8
+INDIRI4
+CNSTI4 0
+NEI4 $166
+ADDRGP4 $92
+ARGP4
+ADDRGP4 CG_Printf
+CALLV
+pop
+ADDRGP4 $162
+JUMPV
+LABELV $166
+ADDRGP4 cg+124988
+INDIRI4
+CNSTI4 0
+EQI4 $170
+ADDRGP4 cg+124784+68
+ADDRGP4 cg+109044+24
+INDIRB
+ASGNB 12
+ADDRGP4 cg+124784+28
+ADDRGP4 cg+109044+36
+INDIRB
+ASGNB 12
+ADDRGP4 cg+124784+28+12
+ADDRGP4 cg+109044+36+12
+INDIRB
+ASGNB 12
+ADDRGP4 cg+124784+28+24
+ADDRGP4 cg+109044+36+24
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $193
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+124784+68
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 cg+109044+36
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_x+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+124784+68
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 cg+109044+36+12
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+124784+68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 cg+109044+36+24
+ADDP4
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $194
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $193
+LABELV $170
+ADDRGP4 cg+124784
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $162
+endproc CG_AddTestModel 32 4
+proc CG_CalcVrect 12 8
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $216
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 $217
+JUMPV
+LABELV $216
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 30
+GEI4 $219
+ADDRGP4 $222
+ARGP4
+ADDRGP4 $223
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 30
+ASGNI4
+ADDRGP4 $220
+JUMPV
+LABELV $219
+ADDRGP4 cg_viewsize+12
+INDIRI4
+CNSTI4 100
+LEI4 $224
+ADDRGP4 $222
+ARGP4
+ADDRGP4 $227
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 $225
+JUMPV
+LABELV $224
+ADDRLP4 0
+ADDRGP4 cg_viewsize+12
+INDIRI4
+ASGNI4
+LABELV $225
+LABELV $220
+LABELV $217
+ADDRGP4 cg+109044+8
+ADDRGP4 cgs+20100+11304
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+109044+8
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 cg+109044+12
+ADDRGP4 cgs+20100+11308
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 cg+109044+12
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRGP4 cg+109044
+ADDRGP4 cgs+20100+11304
+INDIRI4
+ADDRGP4 cg+109044+8
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRGP4 cg+109044+4
+ADDRGP4 cgs+20100+11308
+INDIRI4
+ADDRGP4 cg+109044+12
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+LABELV $215
+endproc CG_CalcVrect 12 8
+data
+align 4
+LABELV $253
+byte 4 3229614080
+byte 4 3229614080
+byte 4 3229614080
+align 4
+LABELV $254
+byte 4 1082130432
+byte 4 1082130432
+byte 4 1082130432
+code
+proc CG_OffsetThirdPersonView 188 28
+ADDRLP4 140
+ADDRGP4 cg+109044+24+8
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRF4
+ADDRGP4 cg+107636+164
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 cg+109412
+INDIRB
+ASGNB 12
+ADDRGP4 cg+107636+184
+INDIRI4
+CNSTI4 0
+GTI4 $261
+ADDRLP4 48+4
+ADDRGP4 cg+107636+184+16
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 cg+109412+4
+ADDRGP4 cg+107636+184+16
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $261
+ADDRLP4 48
+INDIRF4
+CNSTF4 1110704128
+LEF4 $274
+ADDRLP4 48
+CNSTF4 1110704128
+ASGNF4
+LABELV $274
+ADDRLP4 48
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 144
+CNSTP4 0
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 148
+CNSTF4 1140850688
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+109044+24
+INDIRF4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 cg+109044+24+4
+INDIRF4
+ADDRLP4 148
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 cg+109044+24+8
+INDIRF4
+CNSTF4 1140850688
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+109044+24
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 152
+ADDRGP4 cg+109412
+ASGNP4
+ADDRLP4 152
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 152
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+109412
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+CNSTF4 1078530011
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 156
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 156
+INDIRF4
+ASGNF4
+CNSTF4 1078530011
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 160
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 60
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 60
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 60
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 64
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 64
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDRGP4 cg_thirdPersonRange+8
+INDIRF4
+NEGF4
+ADDRLP4 64
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_cameraMode+12
+INDIRI4
+CNSTI4 0
+NEI4 $313
+ADDRLP4 72
+ARGP4
+ADDRGP4 cg+109044+24
+ARGP4
+ADDRGP4 $253
+ARGP4
+ADDRGP4 $254
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+107636+140
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $320
+ADDRLP4 0
+ADDRLP4 72+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1107296256
+CNSTF4 1065353216
+ADDRLP4 72+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+ARGP4
+ADDRGP4 cg+109044+24
+ARGP4
+ADDRGP4 $253
+ARGP4
+ADDRGP4 $254
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 cg+107636+140
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 72+12
+INDIRB
+ASGNB 12
+LABELV $320
+LABELV $313
+ADDRGP4 cg+109044+24
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg+109044+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRGP4 cg+109044+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 cg+109044+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ADDRLP4 172
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 176
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRLP4 68
+INDIRF4
+CNSTF4 1065353216
+GEF4 $347
+ADDRLP4 68
+CNSTF4 1065353216
+ASGNF4
+LABELV $347
+ADDRLP4 12+8
+INDIRF4
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 180
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRGP4 cg+109412
+CNSTF4 3261411041
+ADDRLP4 180
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 184
+ADDRGP4 cg+109412+4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+ADDRLP4 184
+INDIRP4
+INDIRF4
+ADDRGP4 cg_thirdPersonAngle+8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $252
+endproc CG_OffsetThirdPersonView 188 28
+proc CG_StepOffset 8 0
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+108924
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 200
+GEI4 $357
+ADDRLP4 4
+ADDRGP4 cg+109044+24+8
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 cg+108920
+INDIRF4
+CNSTI4 200
+ADDRLP4 0
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1128792064
+DIVF4
+SUBF4
+ASGNF4
+LABELV $357
+LABELV $354
+endproc CG_StepOffset 8 0
+proc CG_OffsetFirstPersonView 96 0
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $364
+ADDRGP4 $363
+JUMPV
+LABELV $364
+ADDRLP4 8
+ADDRGP4 cg+109044+24
+ASGNP4
+ADDRLP4 4
+ADDRGP4 cg+109412
+ASGNP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $370
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTF4 3245342720
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 244
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRGP4 cg+107636+164
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 $363
+JUMPV
+LABELV $370
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRGP4 cg+124744
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRGP4 cg+124744+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRGP4 cg+124744+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+124688
+INDIRF4
+CNSTF4 0
+EQF4 $381
+ADDRLP4 32
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+124688
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+GEF4 $386
+ADDRLP4 32
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+124736
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+124740
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $387
+JUMPV
+LABELV $386
+ADDRLP4 32
+CNSTF4 1065353216
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+CNSTF4 1137180672
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 0
+LEF4 $390
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+124736
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 cg+124740
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $390
+LABELV $387
+LABELV $381
+ADDRLP4 12
+ADDRGP4 cg+107636+32
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg+109044+36
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRGP4 cg+109044+36+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 cg+109044+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg_runpitch+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRGP4 cg+109044+36+12
+INDIRF4
+MULF4
+ADDRLP4 12+4
+INDIRF4
+ADDRGP4 cg+109044+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 cg+109044+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg_runroll+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 cg+124776
+INDIRF4
+CNSTF4 1128792064
+LEF4 $424
+ADDRLP4 64
+ADDRGP4 cg+124776
+INDIRF4
+ASGNF4
+ADDRGP4 $425
+JUMPV
+LABELV $424
+ADDRLP4 64
+CNSTF4 1128792064
+ASGNF4
+LABELV $425
+ADDRLP4 28
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+124768
+INDIRF4
+ADDRGP4 cg_bobpitch+8
+INDIRF4
+MULF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+107636+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $428
+ADDRLP4 0
+CNSTF4 1077936128
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $428
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+124768
+INDIRF4
+ADDRGP4 cg_bobroll+8
+INDIRF4
+MULF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg+107636+12
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $434
+ADDRLP4 0
+CNSTF4 1077936128
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $434
+ADDRGP4 cg+124772
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $438
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $438
+ADDRLP4 72
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRGP4 cg+107636+164
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+108932
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 100
+GEI4 $445
+ADDRLP4 80
+ADDRGP4 cg+109044+24+8
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRGP4 cg+108928
+INDIRF4
+CNSTI4 100
+ADDRLP4 36
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1120403456
+DIVF4
+SUBF4
+ASGNF4
+LABELV $445
+ADDRLP4 24
+ADDRGP4 cg+124768
+INDIRF4
+ADDRGP4 cg+124776
+INDIRF4
+MULF4
+ADDRGP4 cg_bobup+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1086324736
+LEF4 $454
+ADDRLP4 24
+CNSTF4 1086324736
+ASGNF4
+LABELV $454
+ADDRLP4 80
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+108940
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1125515264
+GEF4 $458
+ADDRLP4 40
+ADDRLP4 0
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+ASGNF4
+ADDRLP4 84
+ADDRGP4 cg+109044+24+8
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRGP4 cg+108936
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $459
+JUMPV
+LABELV $458
+ADDRLP4 0
+INDIRF4
+CNSTF4 1138819072
+GEF4 $464
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1125515264
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRF4
+CNSTF4 1133903872
+DIVF4
+SUBF4
+ASGNF4
+ADDRLP4 84
+ADDRGP4 cg+109044+24+8
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRGP4 cg+108936
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $464
+LABELV $459
+ADDRGP4 CG_StepOffset
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRGP4 cg+124756
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRF4
+ADDRGP4 cg+124756+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 92
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRF4
+ADDRGP4 cg+124756+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $363
+endproc CG_OffsetFirstPersonView 96 0
+export CG_ZoomDown_f
+proc CG_ZoomDown_f 0 0
+ADDRGP4 cg+109424
+INDIRI4
+CNSTI4 0
+EQI4 $476
+ADDRGP4 $475
+JUMPV
+LABELV $476
+ADDRGP4 cg+109424
+CNSTI4 1
+ASGNI4
+ADDRGP4 cg+109428
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $475
+endproc CG_ZoomDown_f 0 0
+export CG_ZoomUp_f
+proc CG_ZoomUp_f 0 0
+ADDRGP4 cg+109424
+INDIRI4
+CNSTI4 0
+NEI4 $483
+ADDRGP4 $482
+JUMPV
+LABELV $483
+ADDRGP4 cg+109424
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+109428
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+LABELV $482
+endproc CG_ZoomUp_f 0 0
+proc CG_CalcFov 56 8
+ADDRGP4 cg+107636+4
+INDIRI4
+CNSTI4 5
+NEI4 $490
+ADDRLP4 0
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $491
+JUMPV
+LABELV $490
+ADDRGP4 cgs+31460
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $494
+ADDRLP4 0
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $495
+JUMPV
+LABELV $494
+ADDRLP4 0
+ADDRGP4 cg_fov+8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+GEF4 $498
+ADDRLP4 0
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $499
+JUMPV
+LABELV $498
+ADDRLP4 0
+INDIRF4
+CNSTF4 1126170624
+LEF4 $500
+ADDRLP4 0
+CNSTF4 1126170624
+ASGNF4
+LABELV $500
+LABELV $499
+LABELV $495
+ADDRLP4 8
+ADDRGP4 cg_zoomFov+8
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $503
+ADDRLP4 8
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $504
+JUMPV
+LABELV $503
+ADDRLP4 8
+INDIRF4
+CNSTF4 1126170624
+LEF4 $505
+ADDRLP4 8
+CNSTF4 1126170624
+ASGNF4
+LABELV $505
+LABELV $504
+ADDRGP4 cg+109424
+INDIRI4
+CNSTI4 0
+EQI4 $507
+ADDRLP4 28
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+109428
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1125515264
+DIVF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1065353216
+LEF4 $512
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $508
+JUMPV
+LABELV $512
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $508
+JUMPV
+LABELV $507
+ADDRLP4 28
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+109428
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1125515264
+DIVF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 1065353216
+LEF4 $516
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 $517
+JUMPV
+LABELV $516
+ADDRLP4 36
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $517
+LABELV $508
+LABELV $491
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 cg+109044+8
+INDIRI4
+CVIF4 4
+ADDRLP4 36
+INDIRF4
+DIVF4
+ASGNF4
+ADDRGP4 cg+109044+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1135869952
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 cg+109044+24
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 44
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $524
+ADDRLP4 32
+CNSTF4 1073741824
+CNSTF4 1078530011
+CNSTF4 1053609165
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+MULF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1065353216
+ADDRLP4 48
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $525
+JUMPV
+LABELV $524
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $525
+ADDRGP4 cg+109044+16
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 cg+109044+20
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 cg+109424
+INDIRI4
+CNSTI4 0
+NEI4 $531
+ADDRGP4 cg+109432
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $532
+JUMPV
+LABELV $531
+ADDRGP4 cg+109432
+ADDRGP4 cg+109044+20
+INDIRF4
+CNSTF4 1117126656
+DIVF4
+ASGNF4
+LABELV $532
+ADDRLP4 20
+INDIRI4
+RETI4
+LABELV $489
+endproc CG_CalcFov 56 8
+proc CG_DamageBlendBlob 164 12
+ADDRGP4 cg+124700
+INDIRF4
+CNSTF4 0
+NEF4 $539
+ADDRGP4 $538
+JUMPV
+LABELV $539
+ADDRGP4 cgs+20100+11288
+INDIRI4
+CNSTI4 3
+NEI4 $542
+ADDRGP4 $538
+JUMPV
+LABELV $542
+ADDRLP4 144
+CNSTI4 500
+ASGNI4
+ADDRLP4 140
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg+124688
+INDIRF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+LEI4 $550
+ADDRLP4 140
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LTI4 $548
+LABELV $550
+ADDRGP4 $538
+JUMPV
+LABELV $548
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+68
+ADDRGP4 cg+109044+24
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+109044+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRGP4 cg+109044+24+4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+109044+36+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRGP4 cg+109044+24+8
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+109044+36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+109044+36+12
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+124692
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+109044+36+12+4
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+124692
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+109044+36+12+8
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+124692
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+109044+36+24
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+124696
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+109044+36+24+4
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+124696
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+109044+36+24+8
+INDIRF4
+CNSTF4 1090519040
+ADDRGP4 cg+124696
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+132
+CNSTF4 1077936128
+ADDRGP4 cg+124700
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+112
+ADDRGP4 cgs+152340+216
+INDIRI4
+ASGNI4
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 156
+CNSTF4 1128792064
+CNSTF4 1065353216
+ADDRLP4 140
+INDIRI4
+CVIF4 4
+ADDRLP4 144
+INDIRI4
+CVIF4 4
+DIVF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 160
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+LTF4 $634
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+ADDRLP4 160
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $635
+JUMPV
+LABELV $634
+ADDRLP4 152
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $635
+ADDRLP4 0+116+3
+ADDRLP4 152
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $538
+endproc CG_DamageBlendBlob 164 12
+proc CG_CalcViewValues 40 12
+ADDRGP4 cg+109044
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 368
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 CG_CalcVrect
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 cg+107636
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $640
+ADDRGP4 cg+109044+24
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+109412
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+109412
+ARGP4
+ADDRGP4 cg+109044+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 CG_CalcFov
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $636
+JUMPV
+LABELV $640
+ADDRGP4 cg+124772
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 7
+RSHI4
+ASGNI4
+CNSTF4 1078530011
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 127
+BANDI4
+CVIF4 4
+CNSTF4 1123942400
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRGP4 cg+124768
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRGP4 cg+124776
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 cg+109044+24
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg+109412
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 cg_cameraOrbit+12
+INDIRI4
+CNSTI4 0
+EQI4 $654
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+124780
+INDIRI4
+LEI4 $657
+ADDRGP4 cg+124780
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg_cameraOrbitDelay+12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cg_thirdPersonAngle+8
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRGP4 cg_cameraOrbit+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $657
+LABELV $654
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+CNSTF4 0
+LEF4 $666
+ADDRLP4 32
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+108836
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+SUBF4
+ADDRGP4 cg_errorDecay+8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 0
+LEF4 $673
+ADDRLP4 36
+INDIRF4
+CNSTF4 1065353216
+GEF4 $673
+ADDRGP4 cg+109044+24
+ADDRGP4 cg+109044+24
+INDIRF4
+ADDRGP4 cg+108840
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109044+24+4
+ADDRGP4 cg+109044+24+4
+INDIRF4
+ADDRGP4 cg+108840+4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 cg+109044+24+8
+ADDRGP4 cg+109044+24+8
+INDIRF4
+ADDRGP4 cg+108840+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $674
+JUMPV
+LABELV $673
+ADDRGP4 cg+108836
+CNSTI4 0
+ASGNI4
+LABELV $674
+LABELV $666
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+EQI4 $697
+ADDRGP4 CG_OffsetThirdPersonView
+CALLV
+pop
+ADDRGP4 $698
+JUMPV
+LABELV $697
+ADDRGP4 CG_OffsetFirstPersonView
+CALLV
+pop
+LABELV $698
+ADDRGP4 cg+109412
+ARGP4
+ADDRGP4 cg+109044+36
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg+107632
+INDIRI4
+CNSTI4 0
+EQI4 $703
+ADDRLP4 28
+ADDRGP4 cg+109044+76
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 5
+BORI4
+ASGNI4
+LABELV $703
+ADDRLP4 28
+ADDRGP4 CG_CalcFov
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+LABELV $636
+endproc CG_CalcViewValues 40 12
+proc CG_PowerupTimerSounds 16 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $709
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 356
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+GTI4 $714
+ADDRGP4 $710
+JUMPV
+LABELV $714
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+CNSTI4 5000
+LTI4 $717
+ADDRGP4 $710
+JUMPV
+LABELV $717
+ADDRLP4 12
+CNSTI4 1000
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+107608
+INDIRI4
+SUBI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+EQI4 $720
+CNSTP4 0
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+152340+544
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $720
+LABELV $710
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+LTI4 $709
+LABELV $708
+endproc CG_PowerupTimerSounds 16 16
+export CG_AddBufferedSound
+proc CG_AddBufferedSound 4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $728
+ADDRGP4 $727
+JUMPV
+LABELV $728
+ADDRGP4 cg+124552
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+124564
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+124552
+ADDRGP4 cg+124552
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 20
+MODI4
+ASGNI4
+ADDRGP4 cg+124552
+INDIRI4
+ADDRGP4 cg+124556
+INDIRI4
+NEI4 $734
+ADDRLP4 0
+ADDRGP4 cg+124556
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $734
+LABELV $727
+endproc CG_AddBufferedSound 4 0
+proc CG_PlayBufferedSounds 0 8
+ADDRGP4 cg+124560
+INDIRI4
+ADDRGP4 cg+107604
+INDIRI4
+GEI4 $740
+ADDRGP4 cg+124556
+INDIRI4
+ADDRGP4 cg+124552
+INDIRI4
+EQI4 $744
+ADDRGP4 cg+124556
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+124564
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $744
+ADDRGP4 cg+124556
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+124564
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+ADDRGP4 cg+124556
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+124564
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg+124556
+ADDRGP4 cg+124556
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 20
+MODI4
+ASGNI4
+ADDRGP4 cg+124560
+ADDRGP4 cg+107604
+INDIRI4
+CNSTI4 750
+ADDI4
+ASGNI4
+LABELV $744
+LABELV $740
+LABELV $739
+endproc CG_PlayBufferedSounds 0 8
+export CG_DrawActiveFrame
+proc CG_DrawActiveFrame 24 16
+ADDRGP4 cg+107604
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 cg+8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 CG_UpdateCvars
+CALLV
+pop
+ADDRGP4 cg+109436
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $761
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $758
+JUMPV
+LABELV $761
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_ClearLoopingSounds
+CALLV
+pop
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRGP4 CG_ProcessSnapshots
+CALLV
+pop
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $768
+ADDRGP4 cg+36
+INDIRP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $764
+LABELV $768
+ADDRGP4 CG_DrawInformation
+CALLV
+pop
+ADDRGP4 $758
+JUMPV
+LABELV $764
+ADDRGP4 cg+108944
+INDIRI4
+ARGI4
+ADDRGP4 cg+109432
+INDIRF4
+ARGF4
+ADDRGP4 trap_SetUserCmdValue
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 cg
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 CG_PredictPlayerState
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_thirdPerson+12
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $777
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $775
+LABELV $777
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $776
+JUMPV
+LABELV $775
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $776
+ADDRGP4 cg+107628
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 CG_CalcViewValues
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $778
+ADDRGP4 CG_DamageBlendBlob
+CALLV
+pop
+LABELV $778
+ADDRGP4 cg+107632
+INDIRI4
+CNSTI4 0
+NEI4 $781
+ADDRGP4 CG_AddPacketEntities
+CALLV
+pop
+ADDRGP4 CG_AddMarks
+CALLV
+pop
+ADDRGP4 CG_AddParticles
+CALLV
+pop
+ADDRGP4 CG_AddLocalEntities
+CALLV
+pop
+LABELV $781
+ADDRGP4 cg+107636
+ARGP4
+ADDRGP4 CG_AddViewWeapon
+CALLV
+pop
+ADDRGP4 CG_PlayBufferedSounds
+CALLV
+pop
+ADDRGP4 CG_PlayBufferedVoiceChats
+CALLV
+pop
+ADDRGP4 cg+124784+8
+INDIRI4
+CNSTI4 0
+EQI4 $785
+ADDRGP4 CG_AddTestModel
+CALLV
+pop
+LABELV $785
+ADDRGP4 cg+109044+72
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+109044+80
+ARGP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 CG_PowerupTimerSounds
+CALLV
+pop
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 cg+109044+24
+ARGP4
+ADDRGP4 cg+109044+36
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_Respatialize
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $802
+ADDRGP4 cg+107600
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+107608
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 cg+107600
+INDIRI4
+CNSTI4 0
+GEI4 $807
+ADDRGP4 cg+107600
+CNSTI4 0
+ASGNI4
+LABELV $807
+ADDRGP4 cg+107608
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 CG_AddLagometerFrameInfo
+CALLV
+pop
+LABELV $802
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+EQF4 $813
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+GEF4 $817
+ADDRLP4 20
+ADDRGP4 cg_timescale+8
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+ADDRGP4 cg+107600
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+LEF4 $818
+ADDRGP4 cg_timescale+8
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+ASGNF4
+ADDRGP4 $818
+JUMPV
+LABELV $817
+ADDRLP4 20
+ADDRGP4 cg_timescale+8
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+ADDRGP4 cg+107600
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+SUBF4
+ASGNF4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+GEF4 $833
+ADDRGP4 cg_timescale+8
+ADDRGP4 cg_timescaleFadeEnd+8
+INDIRF4
+ASGNF4
+LABELV $833
+LABELV $818
+ADDRGP4 cg_timescaleFadeSpeed+8
+INDIRF4
+CNSTF4 0
+EQF4 $839
+ADDRGP4 $843
+ARGP4
+ADDRGP4 cg_timescale+8
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $842
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $839
+LABELV $813
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawActive
+CALLV
+pop
+ADDRGP4 cg_stats+12
+INDIRI4
+CNSTI4 0
+EQI4 $845
+ADDRGP4 $848
+ARGP4
+ADDRGP4 cg
+INDIRI4
+ARGI4
+ADDRGP4 CG_Printf
+CALLV
+pop
+LABELV $845
+LABELV $758
+endproc CG_DrawActiveFrame 24 16
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_OutOfAmmoChange
+import CG_DrawWeaponSelect
+import CG_AddPlayerWeapon
+import CG_AddViewWeapon
+import CG_GrappleTrail
+import CG_RailTrail
+import CG_Bullet
+import CG_ShotgunFire
+import CG_MissileHitPlayer
+import CG_MissileHitWall
+import CG_FireWeapon
+import CG_RegisterItemVisuals
+import CG_RegisterWeapon
+import CG_Weapon_f
+import CG_PrevWeapon_f
+import CG_NextWeapon_f
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $848
+byte 1 99
+byte 1 103
+byte 1 46
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $843
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $842
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $227
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $223
+byte 1 51
+byte 1 48
+byte 1 0
+align 1
+LABELV $222
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $148
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $131
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $92
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 10
+byte 1 0
@@ -0,0 +1,12099 @@
+code
+proc CG_MachineGunEjectBrass 144 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 92
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CNSTI4 0
+GTI4 $72
+ADDRGP4 $71
+JUMPV
+LABELV $72
+ADDRLP4 96
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 100
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+4
+CNSTF4 1109393408
+CNSTF4 1073741824
+ADDRLP4 100
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 3259498496
+ADDF4
+ASGNF4
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+8
+CNSTF4 1112014848
+CNSTF4 1073741824
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+ADDI4
+CVIF4 4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CNSTI4 4
+DIVI4
+CVIF4 4
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 116
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 15
+BANDI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 52
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 52+4
+CNSTF4 3229614080
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 120
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 120
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 52
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $105
+ADDRLP4 92
+CNSTF4 1036831949
+ASGNF4
+LABELV $105
+ADDRLP4 128
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 40
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 68+8
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 axisDefault
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cgs+152340+180
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1053609165
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 136
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 140
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $71
+endproc CG_MachineGunEjectBrass 144 8
+proc CG_ShotgunEjectBrass 144 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CNSTI4 0
+GTI4 $133
+ADDRGP4 $132
+JUMPV
+LABELV $133
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+LABELV $136
+ADDRLP4 96
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 100
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40
+CNSTF4 1114636288
+CNSTF4 1073741824
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRLP4 92
+INDIRI4
+CNSTI4 0
+NEI4 $140
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1109393408
+ADDF4
+ASGNF4
+ADDRGP4 $141
+JUMPV
+LABELV $140
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 3256877056
+ADDF4
+ASGNF4
+LABELV $141
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40+8
+CNSTF4 1112014848
+CNSTF4 1073741824
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 112
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 3
+ADDRGP4 cg_brassTime+12
+INDIRI4
+MULI4
+ADDI4
+CVIF4 4
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CVIF4 4
+ADDRLP4 112
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 52
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 52+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 52+8
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 120
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 120
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 52
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 52+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 64
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 124
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $173
+ADDRLP4 96
+CNSTF4 1036831949
+ASGNF4
+LABELV $173
+ADDRLP4 128
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 128
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 40
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 68+8
+INDIRF4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 axisDefault
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 64
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 cgs+152340+184
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1050253722
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 136
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 140
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $137
+ADDRLP4 92
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 2
+LTI4 $136
+LABELV $132
+endproc CG_ShotgunEjectBrass 144 8
+export CG_RailTrail
+proc CG_RailTrail 652 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 516
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 516
+INDIRP4
+ADDRLP4 516
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 28
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 528
+CNSTI4 4
+ASGNI4
+ADDRLP4 28+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 528
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 528
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 532
+CNSTI4 8
+ASGNI4
+ADDRLP4 28+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 532
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 532
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 536
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 500
+ADDRLP4 536
+INDIRF4
+ASGNF4
+ADDRLP4 488
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $203
+CNSTI4 12
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 40
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 488
+ARGP4
+CNSTI4 10
+ADDRLP4 4
+INDIRI4
+MULI4
+CVIF4 4
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+LABELV $204
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 36
+LTI4 $203
+ADDRLP4 540
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 540
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+ADDRGP4 cg_railTrailTime+8
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+152340+192
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 556
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 560
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 556
+INDIRF4
+ADDRLP4 560
+INDIRF4
+LTF4 $214
+ADDRLP4 552
+ADDRLP4 556
+INDIRF4
+ADDRLP4 560
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $215
+JUMPV
+LABELV $214
+ADDRLP4 552
+ADDRLP4 556
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $215
+ADDRLP4 24
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 552
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 568
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 572
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 568
+INDIRF4
+ADDRLP4 572
+INDIRF4
+LTF4 $217
+ADDRLP4 564
+ADDRLP4 568
+INDIRF4
+ADDRLP4 572
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $218
+JUMPV
+LABELV $217
+ADDRLP4 564
+ADDRLP4 568
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $218
+ADDRLP4 24
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 564
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 580
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 584
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 580
+INDIRF4
+ADDRLP4 584
+INDIRF4
+LTF4 $220
+ADDRLP4 576
+ADDRLP4 580
+INDIRF4
+ADDRLP4 584
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $221
+JUMPV
+LABELV $220
+ADDRLP4 576
+ADDRLP4 580
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $221
+ADDRLP4 24
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 576
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 24
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 588
+CNSTF4 1101004800
+ASGNF4
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 8+4
+INDIRF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+CNSTF4 1101004800
+ADDRLP4 28+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 504
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 592
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 28
+ADDRLP4 592
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 592
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 1084227584
+ADDRLP4 28+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 cg_oldRail+12
+INDIRI4
+CNSTI4 0
+EQI4 $232
+ADDRLP4 596
+ADDRLP4 24
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 596
+INDIRP4
+ADDRLP4 596
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRLP4 600
+ADDRLP4 24
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 600
+INDIRP4
+ADDRLP4 600
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+ADDRGP4 $200
+JUMPV
+LABELV $232
+ADDRLP4 484
+CNSTI4 -1
+ASGNI4
+ADDRLP4 20
+CNSTI4 18
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $238
+JUMPV
+LABELV $235
+ADDRLP4 4
+INDIRI4
+ADDRLP4 484
+INDIRI4
+EQI4 $239
+ADDRLP4 484
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+ADDI4
+ASGNI4
+ADDRLP4 596
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 596
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+RSHI4
+ADDI4
+CNSTI4 600
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1066192077
+ASGNF4
+ADDRLP4 24
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+152340+188
+INDIRI4
+ASGNI4
+ADDRLP4 612
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 616
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+LTF4 $247
+ADDRLP4 608
+ADDRLP4 612
+INDIRF4
+ADDRLP4 616
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $248
+JUMPV
+LABELV $247
+ADDRLP4 608
+ADDRLP4 612
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $248
+ADDRLP4 24
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 608
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 624
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 628
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+LTF4 $250
+ADDRLP4 620
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $251
+JUMPV
+LABELV $250
+ADDRLP4 620
+ADDRLP4 624
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $251
+ADDRLP4 24
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 620
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 636
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 640
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+LTF4 $253
+ADDRLP4 632
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $254
+JUMPV
+LABELV $253
+ADDRLP4 632
+ADDRLP4 636
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $254
+ADDRLP4 24
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 632
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 24
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1061158912
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 472
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 644
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 648
+CNSTI4 12
+ADDRLP4 20
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 472
+ADDRLP4 472
+INDIRF4
+ADDRLP4 644
+INDIRF4
+ADDRLP4 648
+INDIRI4
+ADDRLP4 40
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 472+4
+ADDRLP4 472+4
+INDIRF4
+ADDRLP4 644
+INDIRF4
+ADDRLP4 648
+INDIRI4
+ADDRLP4 40+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 472+8
+ADDRLP4 472+8
+INDIRF4
+CNSTF4 1082130432
+CNSTI4 12
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRLP4 40+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 472
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1086324736
+CNSTI4 12
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRLP4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 1086324736
+CNSTI4 12
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRLP4 40+4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTF4 1086324736
+CNSTI4 12
+ADDRLP4 20
+INDIRI4
+MULI4
+ADDRLP4 40+8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $239
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 8+4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 36
+GEI4 $271
+ADDRLP4 596
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRLP4 596
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 36
+MODI4
+ASGNI4
+LABELV $272
+ADDRLP4 20
+ADDRLP4 596
+INDIRI4
+ASGNI4
+LABELV $236
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+ADDI4
+ASGNI4
+LABELV $238
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 500
+INDIRF4
+LTF4 $235
+LABELV $200
+endproc CG_RailTrail 652 16
+proc CG_RocketTrail 100 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 cg_noProjectileTrail+12
+INDIRI4
+CNSTI4 0
+EQI4 $274
+ADDRGP4 $273
+JUMPV
+LABELV $274
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 28
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 28+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+CNSTI4 50
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 44
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 44
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 76
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $280
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 $273
+JUMPV
+LABELV $280
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 80
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $291
+ADDRLP4 40
+INDIRI4
+ADDRLP4 60
+INDIRI4
+BANDI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $273
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTF4 1090519040
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $273
+JUMPV
+LABELV $288
+ADDRLP4 24
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 88
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+ADDRLP4 88
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRGP4 cgs+152340+276
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_SmokePuff
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $289
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $291
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+LEI4 $288
+LABELV $273
+endproc CG_RocketTrail 100 48
+proc CG_PlasmaTrail 220 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 92
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRGP4 cg_noProjectileTrail+12
+INDIRI4
+ADDRLP4 124
+INDIRI4
+NEI4 $299
+ADDRGP4 cg_oldPlasma+12
+INDIRI4
+ADDRLP4 124
+INDIRI4
+EQI4 $295
+LABELV $299
+ADDRGP4 $294
+JUMPV
+LABELV $295
+ADDRLP4 108
+CNSTI4 50
+ASGNI4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 116
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 108
+INDIRI4
+ADDRLP4 116
+INDIRI4
+ADDRLP4 108
+INDIRI4
+ADDI4
+ADDRLP4 108
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 112
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 96
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 136
+ADDRGP4 CG_AllocLocalEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44
+CNSTF4 1114636288
+CNSTF4 1123024896
+CNSTF4 1073741824
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44+4
+CNSTF4 1109393408
+CNSTF4 1117782016
+CNSTF4 1073741824
+ADDRLP4 144
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44+8
+CNSTF4 1120403456
+CNSTF4 1128792064
+CNSTF4 1073741824
+ADDRLP4 148
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 600
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 156
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 56
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 56+8
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 160
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 80
+ADDRLP4 160
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+4
+ADDRLP4 160
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80+8
+ADDRLP4 56
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 56+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 56+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 96
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 96+4
+INDIRF4
+ADDRLP4 80+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 96+8
+INDIRF4
+ADDRLP4 80+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+INDIRP4
+CNSTI4 68
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 164
+ADDRGP4 CG_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $331
+ADDRLP4 92
+CNSTF4 1036831949
+ASGNF4
+LABELV $331
+ADDRLP4 168
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 168
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 4+12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 4+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 168
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 4+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 4+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68+8
+ADDRLP4 44
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 4+12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 4+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 68
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 68+4
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 68+8
+INDIRF4
+ADDRLP4 92
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 axisDefault
+ARGP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 AxisCopy
+CALLV
+pop
+ADDRLP4 40
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+152340+188
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1050253722
+ASGNF4
+ADDRLP4 176
+CNSTF4 1115422720
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 180
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+LTF4 $359
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+ADDRLP4 180
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $360
+JUMPV
+LABELV $359
+ADDRLP4 172
+ADDRLP4 176
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $360
+ADDRLP4 40
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 172
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 188
+CNSTF4 1115422720
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 192
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 188
+INDIRF4
+ADDRLP4 192
+INDIRF4
+LTF4 $362
+ADDRLP4 184
+ADDRLP4 188
+INDIRF4
+ADDRLP4 192
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $363
+JUMPV
+LABELV $362
+ADDRLP4 184
+ADDRLP4 188
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $363
+ADDRLP4 40
+INDIRP4
+CNSTI4 117
+ADDP4
+ADDRLP4 184
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 200
+CNSTF4 1115422720
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 204
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 200
+INDIRF4
+ADDRLP4 204
+INDIRF4
+LTF4 $365
+ADDRLP4 196
+ADDRLP4 200
+INDIRF4
+ADDRLP4 204
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $366
+JUMPV
+LABELV $365
+ADDRLP4 196
+ADDRLP4 200
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $366
+ADDRLP4 40
+INDIRP4
+CNSTI4 118
+ADDP4
+ADDRLP4 196
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 40
+INDIRP4
+CNSTI4 119
+ADDP4
+CNSTU1 63
+ASGNU1
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1045220557
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 1045220557
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1045220557
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1048576000
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 208
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 208
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 212
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 212
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 216
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 216
+INDIRI4
+CNSTI4 31
+BANDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $294
+endproc CG_PlasmaTrail 220 12
+export CG_GrappleTrail
+proc CG_GrappleTrail 184 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+CNSTI4 728
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+CNSTI4 728
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+716
+ADDP4
+ARGP4
+ADDRLP4 168
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 140
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 140+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 3233808384
+ADDRLP4 140+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+84
+ADDRLP4 152
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 0+84
+ARGP4
+ADDRLP4 180
+ADDRGP4 Distance
+CALLF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+CNSTF4 1115684864
+GEF4 $389
+ADDRGP4 $368
+JUMPV
+LABELV $389
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRLP4 0+112
+ADDRGP4 cgs+152340+196
+INDIRI4
+ASGNI4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+116+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $368
+endproc CG_GrappleTrail 184 16
+proc CG_GrenadeTrail 0 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 CG_RocketTrail
+CALLV
+pop
+LABELV $404
+endproc CG_GrenadeTrail 0 8
+export CG_RegisterWeapon
+proc CG_RegisterWeapon 308 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 136
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $406
+ADDRGP4 $405
+JUMPV
+LABELV $406
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $408
+ADDRGP4 $405
+JUMPV
+LABELV $408
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 136
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $413
+JUMPV
+LABELV $410
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $415
+ADDRLP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $415
+ADDRLP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $412
+JUMPV
+LABELV $415
+LABELV $411
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $413
+ADDRLP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $410
+LABELV $412
+ADDRLP4 4
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $417
+ADDRGP4 $419
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $417
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 bg_itemlist
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 52
+DIVI4
+ARGI4
+ADDRGP4 CG_RegisterItemVisuals
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRLP4 92
+ARGP4
+ADDRGP4 trap_R_ModelBounds
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $420
+ADDRLP4 112
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 116
+ADDRLP4 112
+INDIRI4
+ADDRLP4 16
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 112
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDP4
+ADDRLP4 116
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 112
+INDIRI4
+ADDRLP4 92
+ADDP4
+INDIRF4
+ADDRLP4 116
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $421
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $420
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $427
+JUMPV
+LABELV $424
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $429
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $429
+ADDRGP4 $426
+JUMPV
+LABELV $429
+LABELV $425
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $427
+ADDRLP4 8
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $424
+LABELV $426
+ADDRLP4 124
+CNSTU4 0
+ASGNU4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+CVPU4 4
+ADDRLP4 124
+INDIRU4
+EQU4 $431
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 124
+INDIRU4
+EQU4 $431
+ADDRLP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+LABELV $431
+ADDRLP4 28
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 $433
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 $434
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRGP4 $435
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $436
+ADDRGP4 $438
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+LABELV $436
+ADDRLP4 12
+INDIRP4
+CNSTI4 132
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $439
+ADDRFP4 0
+INDIRI4
+CNSTI4 10
+GTI4 $439
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $514-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $514
+address $441
+address $465
+address $473
+address $481
+address $475
+address $444
+address $496
+address $487
+address $507
+address $463
+code
+LABELV $441
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $442
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 144
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRGP4 $443
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $444
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $445
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 152
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRGP4 $446
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 156
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRGP4 $447
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 160
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRGP4 $450
+ARGP4
+ADDRLP4 164
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+196
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRGP4 $453
+ARGP4
+ADDRLP4 168
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+444
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRGP4 $456
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 172
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+660
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRGP4 $459
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 176
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+664
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRGP4 $462
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 180
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+668
+ADDRLP4 180
+INDIRI4
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $463
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $464
+ARGP4
+ADDRLP4 184
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_GrappleTrail
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1157234688
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $445
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 188
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 188
+INDIRI4
+ASGNI4
+ADDRGP4 $442
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 192
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $465
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $466
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 196
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRGP4 $467
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 200
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRGP4 $468
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 204
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRGP4 $469
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 208
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 208
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 CG_MachineGunEjectBrass
+ASGNP4
+ADDRGP4 $472
+ARGP4
+ADDRLP4 212
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+456
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $473
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $474
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 216
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 216
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 CG_ShotgunEjectBrass
+ASGNP4
+ADDRGP4 $440
+JUMPV
+LABELV $475
+ADDRGP4 $464
+ARGP4
+ADDRLP4 220
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 220
+INDIRI4
+ASGNI4
+ADDRGP4 $476
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 224
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 224
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_RocketTrail
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1157234688
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 100
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $477
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 228
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRGP4 $480
+ARGP4
+ADDRLP4 232
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+460
+ADDRLP4 232
+INDIRI4
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $481
+ADDRGP4 $482
+ARGP4
+ADDRLP4 236
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_GrenadeTrail
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 120
+ADDP4
+CNSTF4 1143930880
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $483
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 240
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 240
+INDIRI4
+ASGNI4
+ADDRGP4 $486
+ARGP4
+ADDRLP4 244
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+464
+ADDRLP4 244
+INDIRI4
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $487
+ADDRLP4 12
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRGP4 CG_PlasmaTrail
+ASGNP4
+ADDRGP4 $488
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 248
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $489
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 252
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 252
+INDIRI4
+ASGNI4
+ADDRGP4 $492
+ARGP4
+ADDRLP4 256
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+452
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRGP4 $495
+ARGP4
+ADDRLP4 260
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+188
+ADDRLP4 260
+INDIRI4
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $496
+ADDRGP4 $497
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 264
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $498
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 268
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRGP4 $501
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+448
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRGP4 $495
+ARGP4
+ADDRLP4 276
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+188
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRGP4 $506
+ARGP4
+ADDRLP4 280
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+192
+ADDRLP4 280
+INDIRI4
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $507
+ADDRGP4 $508
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 284
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $509
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 288
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 288
+INDIRI4
+ASGNI4
+ADDRGP4 $512
+ARGP4
+ADDRLP4 292
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRGP4 cgs+152340+468
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRGP4 $513
+ARGP4
+ADDRLP4 296
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 296
+INDIRI4
+ASGNI4
+ADDRGP4 $476
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 300
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 300
+INDIRI4
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $439
+ADDRLP4 12
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $477
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 304
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 304
+INDIRI4
+ASGNI4
+LABELV $440
+LABELV $405
+endproc CG_RegisterWeapon 308 12
+export CG_RegisterItemVisuals
+proc CG_RegisterItemVisuals 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $519
+ADDRFP4 0
+INDIRI4
+ADDRGP4 bg_numItems
+INDIRI4
+LTI4 $517
+LABELV $519
+ADDRGP4 $520
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 bg_numItems
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 CG_Error
+CALLV
+pop
+LABELV $517
+ADDRLP4 4
+CNSTI4 24
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_items
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $521
+ADDRGP4 $516
+JUMPV
+LABELV $521
+ADDRLP4 0
+CNSTI4 52
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShader
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $523
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+LABELV $523
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+EQI4 $529
+ADDRLP4 20
+INDIRI4
+CNSTI4 4
+EQI4 $529
+ADDRLP4 20
+INDIRI4
+CNSTI4 3
+EQI4 $529
+ADDRLP4 20
+INDIRI4
+CNSTI4 6
+NEI4 $525
+LABELV $529
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $530
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $530
+LABELV $525
+LABELV $516
+endproc CG_RegisterItemVisuals 28 12
+proc CG_MapTorsoToWeaponFrame 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $533
+ADDRFP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+ADDI4
+GEI4 $533
+ADDRFP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 6
+ADDI4
+RETI4
+ADDRGP4 $532
+JUMPV
+LABELV $533
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $535
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 6
+ADDI4
+GEI4 $535
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+SUBI4
+RETI4
+ADDRGP4 $532
+JUMPV
+LABELV $535
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $537
+ADDRFP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 6
+ADDI4
+GEI4 $537
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+SUBI4
+RETI4
+ADDRGP4 $532
+JUMPV
+LABELV $537
+CNSTI4 0
+RETI4
+LABELV $532
+endproc CG_MapTorsoToWeaponFrame 24 0
+proc CG_CalculateWeaponPosition 40 4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRGP4 cg+109044+24
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg+109412
+INDIRB
+ASGNB 12
+ADDRGP4 cg+124772
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $543
+ADDRLP4 0
+ADDRGP4 cg+124776
+INDIRF4
+NEGF4
+ASGNF4
+ADDRGP4 $544
+JUMPV
+LABELV $543
+ADDRLP4 0
+ADDRGP4 cg+124776
+INDIRF4
+ASGNF4
+LABELV $544
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1000593162
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg+124768
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRGP4 cg+124768
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1000593162
+ADDRGP4 cg+124776
+INDIRF4
+ADDRGP4 cg+124768
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 cg+107604
+INDIRI4
+ADDRGP4 cg+108940
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 150
+GEI4 $554
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+CNSTF4 1048576000
+ADDRGP4 cg+108936
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1125515264
+DIVF4
+ADDF4
+ASGNF4
+ADDRGP4 $555
+JUMPV
+LABELV $554
+ADDRLP4 8
+INDIRI4
+CNSTI4 450
+GEI4 $557
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+CNSTF4 1048576000
+ADDRGP4 cg+108936
+INDIRF4
+MULF4
+CNSTI4 450
+ADDRLP4 8
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1133903872
+DIVF4
+ADDF4
+ASGNF4
+LABELV $557
+LABELV $555
+ADDRLP4 0
+ADDRGP4 cg+124776
+INDIRF4
+CNSTF4 1109393408
+ADDF4
+ASGNF4
+CNSTF4 981668463
+ADDRGP4 cg+107604
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $539
+endproc CG_CalculateWeaponPosition 40 4
+proc CG_LightningBolt 280 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 6
+EQI4 $563
+ADDRGP4 $562
+JUMPV
+LABELV $563
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+NEI4 $565
+ADDRGP4 cg_trueLightning+8
+INDIRF4
+CNSTF4 0
+EQF4 $565
+ADDRLP4 232
+CNSTI4 0
+ASGNI4
+LABELV $570
+ADDRLP4 252
+ADDRLP4 232
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 252
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 252
+INDIRI4
+ADDRGP4 cg+109412
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 248
+INDIRF4
+CNSTF4 1127481344
+LEF4 $575
+ADDRLP4 248
+ADDRLP4 248
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $575
+ADDRLP4 248
+INDIRF4
+CNSTF4 3274964992
+GEF4 $577
+ADDRLP4 248
+ADDRLP4 248
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $577
+ADDRLP4 256
+ADDRLP4 232
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+ADDRLP4 236
+ADDP4
+ADDRLP4 256
+INDIRI4
+ADDRGP4 cg+109412
+ADDP4
+INDIRF4
+ADDRLP4 248
+INDIRF4
+CNSTF4 1065353216
+ADDRGP4 cg_trueLightning+8
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 232
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 236
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $581
+ADDRLP4 260
+ADDRLP4 232
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 236
+ADDP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ADDRLP4 260
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $581
+ADDRLP4 232
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 236
+ADDP4
+INDIRF4
+CNSTF4 1135869952
+LEF4 $583
+ADDRLP4 260
+ADDRLP4 232
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 236
+ADDP4
+ASGNP4
+ADDRLP4 260
+INDIRP4
+ADDRLP4 260
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $583
+LABELV $571
+ADDRLP4 232
+ADDRLP4 232
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 3
+LTI4 $570
+ADDRLP4 236
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 248
+CNSTP4 0
+ASGNP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $566
+JUMPV
+LABELV $565
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ARGP4
+ADDRLP4 152
+ARGP4
+ADDRLP4 232
+CNSTP4 0
+ASGNP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+ADDRLP4 232
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $566
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+ADDRLP4 232
+CNSTF4 1096810496
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 152+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 236
+CNSTF4 1145044992
+ASGNF4
+ADDRLP4 220
+ADDRLP4 140
+INDIRF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 152
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 220+4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 236
+INDIRF4
+ADDRLP4 152+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 220+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 1145044992
+ADDRLP4 152+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 240
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 240
+INDIRP4
+ARGP4
+ADDRLP4 240
+INDIRP4
+ARGP4
+ADDRLP4 220
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRLP4 0+84
+ADDRLP4 164+12
+INDIRB
+ASGNB 12
+ADDRLP4 0+68
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 6
+ASGNI4
+ADDRLP4 0+112
+ADDRGP4 cgs+152340+196
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 164+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $604
+ADDRLP4 244
+ADDRLP4 0+84
+INDIRF4
+ADDRLP4 0+68
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 244+4
+ADDRLP4 0+84+4
+INDIRF4
+ADDRLP4 0+68+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 244+8
+ADDRLP4 0+84+8
+INDIRF4
+ADDRLP4 0+68+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 244
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+8
+ADDRGP4 cgs+152340+444
+INDIRI4
+ASGNI4
+ADDRLP4 0+68
+ADDRLP4 164+12
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 244
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 164+12+4
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 244+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 164+12+8
+INDIRF4
+CNSTF4 3246391296
+ADDRLP4 244+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 268
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 268
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 272
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 256+4
+ADDRLP4 272
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 276
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 256+8
+ADDRLP4 276
+INDIRI4
+CNSTI4 360
+MODI4
+CVIF4 4
+ASGNF4
+ADDRLP4 256
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $604
+LABELV $562
+endproc CG_LightningBolt 280 28
+proc CG_SpawnRailTrail 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 7
+EQI4 $638
+ADDRGP4 $637
+JUMPV
+LABELV $638
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $640
+ADDRGP4 $637
+JUMPV
+LABELV $640
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 1708
+ADDRFP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 608
+ADDP4
+ARGP4
+ADDRGP4 CG_RailTrail
+CALLV
+pop
+LABELV $637
+endproc CG_SpawnRailTrail 8 12
+proc CG_MachinegunSpinAngle 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $645
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRF4
+CNSTF4 1063675494
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $646
+JUMPV
+LABELV $645
+ADDRLP4 0
+INDIRI4
+CNSTI4 1000
+LEI4 $647
+ADDRLP4 0
+CNSTI4 1000
+ASGNI4
+LABELV $647
+ADDRLP4 8
+CNSTF4 1056964608
+CNSTI4 1000
+ADDRLP4 0
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+CNSTF4 1063675494
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $646
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+NEI4 $652
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRGP4 $653
+JUMPV
+LABELV $652
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $653
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $649
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $656
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $657
+JUMPV
+LABELV $656
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $657
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $649
+ADDRLP4 4
+INDIRF4
+RETF4
+LABELV $643
+endproc CG_MachinegunSpinAngle 36 4
+proc CG_AddWeaponWithPowerups 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $659
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+152340+404
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRGP4 $660
+JUMPV
+LABELV $659
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $663
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+152340+416
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $663
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $667
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRGP4 cgs+152340+400
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $667
+LABELV $660
+LABELV $658
+endproc CG_AddWeaponWithPowerups 0 4
+export CG_AddPlayerWeapon
+proc CG_AddPlayerWeapon 504 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 284
+ADDRFP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 280
+CNSTI4 136
+ADDRLP4 284
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 140+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 140+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 140+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $675
+ADDRGP4 cg+107636+144
+INDIRI4
+CNSTI4 7
+NEI4 $677
+ADDRGP4 cg+107636+148
+INDIRI4
+CNSTI4 3
+NEI4 $677
+ADDRLP4 444
+ADDRGP4 cg+107636+44
+INDIRI4
+CVIF4 4
+CNSTF4 1153138688
+DIVF4
+ASGNF4
+ADDRLP4 140+116+1
+CNSTU1 0
+ASGNU1
+ADDRLP4 452
+CNSTF4 1132396544
+CNSTF4 1065353216
+ADDRLP4 444
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 456
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 452
+INDIRF4
+ADDRLP4 456
+INDIRF4
+LTF4 $691
+ADDRLP4 448
+ADDRLP4 452
+INDIRF4
+ADDRLP4 456
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $692
+JUMPV
+LABELV $691
+ADDRLP4 448
+ADDRLP4 452
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $692
+ADDRLP4 460
+ADDRLP4 448
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 140+116+2
+ADDRLP4 460
+INDIRU1
+ASGNU1
+ADDRLP4 140+116
+ADDRLP4 460
+INDIRU1
+ASGNU1
+ADDRGP4 $678
+JUMPV
+LABELV $677
+ADDRLP4 140+116
+CNSTU1 255
+ASGNU1
+ADDRLP4 140+116+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 140+116+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 140+116+3
+CNSTU1 255
+ASGNU1
+LABELV $678
+LABELV $675
+ADDRLP4 140+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 140+8
+INDIRI4
+CNSTI4 0
+NEI4 $701
+ADDRGP4 $671
+JUMPV
+LABELV $701
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $704
+ADDRFP4 8
+INDIRP4
+CNSTI4 604
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 444
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 444
+INDIRI4
+EQI4 $706
+ADDRLP4 280
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ADDRLP4 444
+INDIRI4
+EQI4 $706
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 128
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CNSTI4 604
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $707
+JUMPV
+LABELV $706
+ADDRLP4 280
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $708
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 704
+ADDP4
+ARGP4
+ADDRGP4 vec3_origin
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_AddLoopingSound
+CALLV
+pop
+LABELV $708
+LABELV $707
+LABELV $704
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $710
+ARGP4
+ADDRGP4 CG_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddWeaponWithPowerups
+CALLV
+pop
+ADDRLP4 280
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $711
+ADDRLP4 300
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 300+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 300+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 300+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 300+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 288+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 288
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 448
+ADDRGP4 CG_MachinegunSpinAngle
+CALLF4
+ASGNF4
+ADDRLP4 288+8
+ADDRLP4 448
+INDIRF4
+ASGNF4
+ADDRLP4 288
+ARGP4
+ADDRLP4 300+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 300
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $720
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 300
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddWeaponWithPowerups
+CALLV
+pop
+LABELV $711
+ADDRLP4 448
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+ASGNP4
+ADDRLP4 452
+ADDRGP4 cg_entities
+ASGNP4
+ADDRLP4 440
+CNSTI4 728
+ADDRLP4 448
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 452
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 440
+INDIRP4
+CVPU4 4
+ADDRLP4 452
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 728
+DIVI4
+ADDRLP4 448
+INDIRP4
+INDIRI4
+EQI4 $721
+ADDRLP4 440
+ADDRFP4 8
+INDIRP4
+ASGNP4
+LABELV $721
+ADDRLP4 284
+INDIRI4
+CNSTI4 6
+EQI4 $726
+ADDRLP4 284
+INDIRI4
+CNSTI4 1
+EQI4 $726
+ADDRLP4 284
+INDIRI4
+CNSTI4 10
+NEI4 $723
+LABELV $726
+ADDRLP4 440
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $723
+ADDRGP4 $724
+JUMPV
+LABELV $723
+ADDRGP4 cg+107604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 20
+LEI4 $727
+ADDRFP4 8
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $727
+ADDRGP4 $671
+JUMPV
+LABELV $727
+LABELV $724
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 280
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 0
+NEI4 $734
+ADDRGP4 $671
+JUMPV
+LABELV $734
+ADDRLP4 288+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 288
+CNSTF4 0
+ASGNF4
+ADDRLP4 460
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 288+8
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 460
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 288
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 284
+INDIRI4
+CNSTI4 7
+NEI4 $740
+ADDRLP4 464
+CNSTI4 1708
+ADDRFP4 8
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 472
+CNSTF4 1132396544
+ADDRLP4 464
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 476
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 472
+INDIRF4
+ADDRLP4 476
+INDIRF4
+LTF4 $745
+ADDRLP4 468
+ADDRLP4 472
+INDIRF4
+ADDRLP4 476
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $746
+JUMPV
+LABELV $745
+ADDRLP4 468
+ADDRLP4 472
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $746
+ADDRLP4 0+116
+ADDRLP4 468
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 484
+CNSTF4 1132396544
+ADDRLP4 464
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 488
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 484
+INDIRF4
+ADDRLP4 488
+INDIRF4
+LTF4 $750
+ADDRLP4 480
+ADDRLP4 484
+INDIRF4
+ADDRLP4 488
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $751
+JUMPV
+LABELV $750
+ADDRLP4 480
+ADDRLP4 484
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $751
+ADDRLP4 0+116+1
+ADDRLP4 480
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 496
+CNSTF4 1132396544
+ADDRLP4 464
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 500
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 496
+INDIRF4
+ADDRLP4 500
+INDIRF4
+LTF4 $755
+ADDRLP4 492
+ADDRLP4 496
+INDIRF4
+ADDRLP4 500
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $756
+JUMPV
+LABELV $755
+ADDRLP4 492
+ADDRLP4 496
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $756
+ADDRLP4 0+116+2
+ADDRLP4 492
+INDIRU4
+CVUU1 4
+ASGNU1
+LABELV $740
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ARGP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $757
+ARGP4
+ADDRGP4 CG_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $764
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+NEI4 $764
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 cg+107636+140
+INDIRI4
+EQI4 $758
+LABELV $764
+ADDRLP4 440
+INDIRP4
+ARGP4
+ADDRLP4 0+68
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0+68
+ARGP4
+ADDRGP4 CG_SpawnRailTrail
+CALLV
+pop
+ADDRLP4 468
+CNSTF4 0
+ASGNF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRLP4 468
+INDIRF4
+NEF4 $770
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ADDRLP4 468
+INDIRF4
+NEF4 $770
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ADDRLP4 468
+INDIRF4
+EQF4 $767
+LABELV $770
+ADDRLP4 472
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 472
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 300
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 280
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $767
+LABELV $758
+LABELV $671
+endproc CG_AddPlayerWeapon 504 20
+export CG_AddViewWeapon
+proc CG_AddViewWeapon 184 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $773
+ADDRGP4 $772
+JUMPV
+LABELV $773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $775
+ADDRGP4 $772
+JUMPV
+LABELV $775
+ADDRGP4 cg+107628
+INDIRI4
+CNSTI4 0
+EQI4 $777
+ADDRGP4 $772
+JUMPV
+LABELV $777
+ADDRGP4 cg_drawGun+12
+INDIRI4
+CNSTI4 0
+NEI4 $780
+ADDRGP4 cg+107636+104
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $772
+ADDRLP4 168
+ADDRGP4 cg+109044+24
+INDIRB
+ASGNB 12
+ADDRLP4 180
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 168
+ADDRLP4 168
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDRGP4 cg+109044+36+24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168+4
+ADDRLP4 168+4
+INDIRF4
+ADDRLP4 180
+INDIRF4
+ADDRGP4 cg+109044+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 168+8
+ADDRLP4 168+8
+INDIRF4
+CNSTF4 3238002688
+ADDRGP4 cg+109044+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 728
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ARGP4
+ADDRLP4 168
+ARGP4
+ADDRGP4 CG_LightningBolt
+CALLV
+pop
+ADDRGP4 $772
+JUMPV
+LABELV $780
+ADDRGP4 cg+124988
+INDIRI4
+CNSTI4 0
+EQI4 $804
+ADDRGP4 $772
+JUMPV
+LABELV $804
+ADDRGP4 cg_fov+12
+INDIRI4
+CNSTI4 90
+LEI4 $807
+ADDRLP4 140
+CNSTF4 3192704205
+ADDRGP4 cg_fov+12
+INDIRI4
+CNSTI4 90
+SUBI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRGP4 $808
+JUMPV
+LABELV $807
+ADDRLP4 140
+CNSTF4 0
+ASGNF4
+LABELV $808
+ADDRLP4 144
+ADDRGP4 cg+108104
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 160
+CNSTI4 136
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 CG_CalculateWeaponPosition
+CALLV
+pop
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+109044+36
+INDIRF4
+ADDRGP4 cg_gun_x+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+109044+36+4
+INDIRF4
+ADDRGP4 cg_gun_x+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+109044+36+8
+INDIRF4
+ADDRGP4 cg_gun_x+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+109044+36+12
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+109044+36+12+4
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+109044+36+12+8
+INDIRF4
+ADDRGP4 cg_gun_y+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68
+ADDRLP4 0+68
+INDIRF4
+ADDRGP4 cg+109044+36+24
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+4
+ADDRLP4 0+68+4
+INDIRF4
+ADDRGP4 cg+109044+36+24+4
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+ADDRGP4 cg+109044+36+24+8
+INDIRF4
+ADDRGP4 cg_gun_z+8
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ARGP4
+ADDRLP4 0+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRGP4 cg_gun_frame+12
+INDIRI4
+CNSTI4 0
+EQI4 $883
+ADDRLP4 168
+ADDRGP4 cg_gun_frame+12
+INDIRI4
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0+80
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0+100
+CNSTF4 0
+ASGNF4
+ADDRGP4 $884
+JUMPV
+LABELV $883
+ADDRLP4 164
+CNSTI4 1708
+ADDRLP4 144
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 172
+ADDRGP4 CG_MapTorsoToWeaponFrame
+CALLI4
+ASGNI4
+ADDRLP4 0+80
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 144
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 CG_MapTorsoToWeaponFrame
+CALLI4
+ASGNI4
+ADDRLP4 0+96
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 0+100
+ADDRLP4 144
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $884
+ADDRLP4 0+8
+ADDRLP4 160
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+4
+CNSTI4 13
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 cg+108104
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_AddPlayerWeapon
+CALLV
+pop
+LABELV $772
+endproc CG_AddViewWeapon 184 16
+export CG_DrawWeaponSelect
+proc CG_DrawWeaponSelect 48 20
+ADDRGP4 cg+107636+184
+INDIRI4
+CNSTI4 0
+GTI4 $898
+ADDRGP4 $897
+JUMPV
+LABELV $898
+ADDRGP4 cg+124676
+INDIRI4
+ARGI4
+CNSTI4 1400
+ARGI4
+ADDRLP4 32
+ADDRGP4 CG_FadeColor
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $903
+ADDRGP4 $897
+JUMPV
+LABELV $903
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 cg+124668
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $907
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $911
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $911
+LABELV $908
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $907
+ADDRLP4 4
+CNSTI4 320
+CNSTI4 20
+ADDRLP4 16
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 380
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $913
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $917
+ADDRGP4 $914
+JUMPV
+LABELV $917
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 CG_RegisterWeapon
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 36
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+CNSTI4 136
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cg+108944
+INDIRI4
+NEI4 $920
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+212
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $920
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $925
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRLP4 40
+INDIRF4
+ARGF4
+ADDRGP4 cgs+152340+272
+INDIRI4
+ARGI4
+ADDRGP4 CG_DrawPic
+CALLV
+pop
+LABELV $925
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 40
+ADDI4
+ASGNI4
+LABELV $914
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $913
+CNSTI4 136
+ADDRGP4 cg+108944
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $930
+ADDRLP4 24
+CNSTI4 136
+ADDRGP4 cg+108944
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons+4
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $936
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 CG_DrawStrlen
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 36
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 640
+ADDRLP4 28
+INDIRI4
+SUBI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 22
+SUBI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 CG_DrawBigStringColor
+CALLV
+pop
+LABELV $936
+LABELV $930
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $897
+endproc CG_DrawWeaponSelect 48 20
+proc CG_WeaponSelectable 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 420
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $939
+CNSTI4 0
+RETI4
+ADDRGP4 $938
+JUMPV
+LABELV $939
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRFP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $942
+CNSTI4 0
+RETI4
+ADDRGP4 $938
+JUMPV
+LABELV $942
+CNSTI4 1
+RETI4
+LABELV $938
+endproc CG_WeaponSelectable 0 0
+export CG_NextWeapon_f
+proc CG_NextWeapon_f 16 4
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $946
+ADDRGP4 $945
+JUMPV
+LABELV $946
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $949
+ADDRGP4 $945
+JUMPV
+LABELV $949
+ADDRGP4 cg+124676
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+108944
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $955
+ADDRLP4 8
+ADDRGP4 cg+108944
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 cg+108944
+INDIRI4
+CNSTI4 16
+NEI4 $960
+ADDRGP4 cg+108944
+CNSTI4 0
+ASGNI4
+LABELV $960
+ADDRGP4 cg+108944
+INDIRI4
+CNSTI4 1
+NEI4 $964
+ADDRGP4 $956
+JUMPV
+LABELV $964
+ADDRGP4 cg+108944
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_WeaponSelectable
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $967
+ADDRGP4 $957
+JUMPV
+LABELV $967
+LABELV $956
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $955
+LABELV $957
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+NEI4 $970
+ADDRGP4 cg+108944
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $970
+LABELV $945
+endproc CG_NextWeapon_f 16 4
+export CG_PrevWeapon_f
+proc CG_PrevWeapon_f 16 4
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $974
+ADDRGP4 $973
+JUMPV
+LABELV $974
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $977
+ADDRGP4 $973
+JUMPV
+LABELV $977
+ADDRGP4 cg+124676
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cg+108944
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $983
+ADDRLP4 8
+ADDRGP4 cg+108944
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 cg+108944
+INDIRI4
+CNSTI4 -1
+NEI4 $988
+ADDRGP4 cg+108944
+CNSTI4 15
+ASGNI4
+LABELV $988
+ADDRGP4 cg+108944
+INDIRI4
+CNSTI4 1
+NEI4 $992
+ADDRGP4 $984
+JUMPV
+LABELV $992
+ADDRGP4 cg+108944
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 CG_WeaponSelectable
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $995
+ADDRGP4 $985
+JUMPV
+LABELV $995
+LABELV $984
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $983
+LABELV $985
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+NEI4 $998
+ADDRGP4 cg+108944
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $998
+LABELV $973
+endproc CG_PrevWeapon_f 16 4
+export CG_Weapon_f
+proc CG_Weapon_f 16 4
+ADDRGP4 cg+36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1002
+ADDRGP4 $1001
+JUMPV
+LABELV $1002
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1005
+ADDRGP4 $1001
+JUMPV
+LABELV $1005
+CNSTI4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_Argv
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $1010
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LEI4 $1008
+LABELV $1010
+ADDRGP4 $1001
+JUMPV
+LABELV $1008
+ADDRGP4 cg+124676
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $1013
+ADDRGP4 $1001
+JUMPV
+LABELV $1013
+ADDRGP4 cg+108944
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1001
+endproc CG_Weapon_f 16 4
+export CG_OutOfAmmoChange
+proc CG_OutOfAmmoChange 8 4
+ADDRGP4 cg+124676
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 15
+ASGNI4
+LABELV $1020
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 CG_WeaponSelectable
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1024
+ADDRGP4 cg+108944
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $1022
+JUMPV
+LABELV $1024
+LABELV $1021
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $1020
+LABELV $1022
+LABELV $1017
+endproc CG_OutOfAmmoChange 8 4
+export CG_FireWeapon
+proc CG_FireWeapon 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1028
+ADDRGP4 $1027
+JUMPV
+LABELV $1028
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 11
+LTI4 $1030
+ADDRGP4 $1032
+ARGP4
+ADDRGP4 CG_Error
+CALLV
+pop
+ADDRGP4 $1027
+JUMPV
+LABELV $1030
+ADDRLP4 4
+CNSTI4 136
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 cg_weapons
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ADDRGP4 cg+107604
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $1034
+ADDRFP4 0
+INDIRP4
+CNSTI4 604
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1036
+ADDRGP4 $1027
+JUMPV
+LABELV $1036
+LABELV $1034
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1038
+CNSTP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 cgs+152340+528
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $1038
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1042
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1046
+ADDRGP4 $1044
+JUMPV
+LABELV $1046
+LABELV $1043
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $1042
+LABELV $1044
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $1048
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1050
+CNSTP4 0
+ARGP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $1050
+LABELV $1048
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1052
+ADDRGP4 cg_brassTime+12
+INDIRI4
+CNSTI4 0
+LEI4 $1052
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $1052
+LABELV $1027
+endproc CG_FireWeapon 20 16
+export CG_MissileHitWall
+proc CG_MissileHitWall 128 44
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 16
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 84
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+CNSTI4 600
+ASGNI4
+ADDRLP4 88
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 92
+CNSTI4 2
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 92
+INDIRI4
+LTI4 $1058
+ADDRLP4 88
+INDIRI4
+CNSTI4 9
+GTI4 $1058
+ADDRLP4 88
+INDIRI4
+ADDRLP4 92
+INDIRI4
+LSHI4
+ADDRGP4 $1152-8
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $1152
+address $1135
+address $1128
+address $1073
+address $1082
+address $1060
+address $1101
+address $1110
+address $1119
+code
+LABELV $1058
+LABELV $1060
+ADDRLP4 96
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 96
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+GEI4 $1061
+ADDRLP4 16
+ADDRGP4 cgs+152340+664
+INDIRI4
+ASGNI4
+ADDRGP4 $1062
+JUMPV
+LABELV $1061
+ADDRLP4 52
+INDIRI4
+CNSTI4 2
+NEI4 $1065
+ADDRLP4 16
+ADDRGP4 cgs+152340+660
+INDIRI4
+ASGNI4
+ADDRGP4 $1066
+JUMPV
+LABELV $1065
+ADDRLP4 16
+ADDRGP4 cgs+152340+668
+INDIRI4
+ASGNI4
+LABELV $1066
+LABELV $1062
+ADDRLP4 0
+ADDRGP4 cgs+152340+384
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1094713344
+ASGNF4
+ADDRGP4 $1059
+JUMPV
+LABELV $1073
+ADDRLP4 20
+ADDRGP4 cgs+152340+440
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+152340+464
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cgs+152340+688
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+152340+380
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 44
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1059
+JUMPV
+LABELV $1082
+ADDRLP4 20
+ADDRGP4 cgs+152340+440
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+152340+460
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cgs+152340+688
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+152340+380
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 44
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 48
+CNSTI4 1000
+ASGNI4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 4+4
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 cg_oldRocket+12
+INDIRI4
+CNSTI4 0
+NEI4 $1059
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 104
+CNSTF4 1103101952
+ASGNF4
+ADDRLP4 108
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 100
+INDIRP4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112
+CNSTI4 4
+ASGNI4
+ADDRLP4 56+4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 116
+CNSTI4 8
+ASGNI4
+ADDRLP4 56+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1103101952
+ADDRFP4 12
+INDIRP4
+ADDRLP4 116
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 124
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 120
+INDIRF4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 68+4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 124
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 68+8
+CNSTF4 1115684864
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $1100
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 68
+ARGP4
+CNSTI4 1400
+ARGI4
+CNSTI4 20
+ARGI4
+CNSTI4 30
+ARGI4
+ADDRGP4 CG_ParticleExplosion
+CALLV
+pop
+ADDRGP4 $1059
+JUMPV
+LABELV $1101
+ADDRLP4 20
+ADDRGP4 cgs+152340+436
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+152340+448
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cgs+152340+692
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+152340+388
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1103101952
+ASGNF4
+ADDRGP4 $1059
+JUMPV
+LABELV $1110
+ADDRLP4 20
+ADDRGP4 cgs+152340+436
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+152340+452
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cgs+152340+692
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+152340+388
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 $1059
+JUMPV
+LABELV $1119
+ADDRLP4 20
+ADDRGP4 cgs+152340+440
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+152340+468
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 cgs+152340+688
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+152340+380
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1059
+JUMPV
+LABELV $1128
+ADDRLP4 20
+ADDRGP4 cgs+152340+432
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+152340+456
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+152340+376
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+CNSTF4 1082130432
+ASGNF4
+ADDRGP4 $1059
+JUMPV
+LABELV $1135
+ADDRLP4 20
+ADDRGP4 cgs+152340+432
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 cgs+152340+456
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cgs+152340+376
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 100
+INDIRI4
+CNSTI4 3
+BANDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+NEI4 $1142
+ADDRLP4 16
+ADDRGP4 cgs+152340+672
+INDIRI4
+ASGNI4
+ADDRGP4 $1143
+JUMPV
+LABELV $1142
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+NEI4 $1146
+ADDRLP4 16
+ADDRGP4 cgs+152340+676
+INDIRI4
+ASGNI4
+ADDRGP4 $1147
+JUMPV
+LABELV $1146
+ADDRLP4 16
+ADDRGP4 cgs+152340+680
+INDIRI4
+ASGNI4
+LABELV $1147
+LABELV $1143
+ADDRLP4 24
+CNSTF4 1090519040
+ASGNF4
+LABELV $1059
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $1154
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $1154
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $1156
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 48
+INDIRI4
+ARGI4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 CG_MakeExplosion
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 96
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 40
+INDIRP4
+CNSTI4 132
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $1158
+ADDRLP4 40
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTI4 1708
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+76
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $1158
+LABELV $1156
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cgs+152340+388
+INDIRI4
+NEI4 $1165
+ADDRLP4 96
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1166
+JUMPV
+LABELV $1165
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+LABELV $1166
+ADDRLP4 32
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $1167
+ADDRLP4 100
+CNSTI4 1708
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 cgs+40972+88
+ADDP4
+ASGNP4
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 108
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 108
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 108
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+ADDRGP4 $1168
+JUMPV
+LABELV $1167
+ADDRLP4 100
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+CNSTF4 1135869952
+ADDRLP4 100
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 104
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+ADDRLP4 104
+INDIRF4
+ARGF4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRF4
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 CG_ImpactMark
+CALLV
+pop
+LABELV $1168
+LABELV $1055
+endproc CG_MissileHitWall 128 44
+export CG_MissileHitPlayer
+proc CG_MissileHitPlayer 4 20
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_Bleed
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+EQI4 $1174
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+EQI4 $1174
+ADDRGP4 $1173
+JUMPV
+LABELV $1174
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+LABELV $1173
+LABELV $1171
+endproc CG_MissileHitPlayer 4 20
+proc CG_ShotgunPellet 136 28
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+CNSTP4 0
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 CG_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 68
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $1177
+ADDRLP4 56
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1178
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $1178
+JUMPV
+LABELV $1177
+ADDRLP4 56
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1182
+ADDRLP4 76
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 132
+CNSTP4 0
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76+12
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $1183
+JUMPV
+LABELV $1182
+ADDRLP4 60
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1185
+ADDRLP4 76
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 132
+CNSTP4 0
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+ADDRLP4 132
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 76+12
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+LABELV $1185
+LABELV $1183
+LABELV $1178
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1189
+ADDRGP4 $1175
+JUMPV
+LABELV $1189
+CNSTI4 728
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 cg_entities+4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1192
+CNSTI4 3
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 0+52
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitPlayer
+CALLV
+pop
+ADDRGP4 $1193
+JUMPV
+LABELV $1192
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1199
+ADDRGP4 $1175
+JUMPV
+LABELV $1199
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $1202
+CNSTI4 3
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+ADDRGP4 $1203
+JUMPV
+LABELV $1202
+CNSTI4 3
+ARGI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+LABELV $1203
+LABELV $1193
+LABELV $1175
+endproc CG_ShotgunPellet 136 28
+proc CG_ShotgunPattern 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 32
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $1210
+ADDRFP4 8
+ARGP4
+ADDRLP4 60
+ADDRGP4 Q_crandom
+CALLF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1098907648
+CNSTF4 1143930880
+ADDRLP4 60
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 8
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_crandom
+CALLF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1098907648
+CNSTF4 1143930880
+ADDRLP4 64
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 72
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 20+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1207959552
+ADDRLP4 20+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 32+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 CG_ShotgunPellet
+CALLV
+pop
+LABELV $1211
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 11
+LTI4 $1210
+LABELV $1209
+endproc CG_ShotgunPattern 84 12
+export CG_ShotgunFire
+proc CG_ShotgunFire 56 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 24
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1107296256
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 cgs+20100+11288
+INDIRI4
+CNSTI4 3
+EQI4 $1241
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $1245
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 32
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 32+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 32+8
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRLP4 52
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+CNSTF4 1051260355
+ARGF4
+CNSTF4 1147207680
+ARGF4
+ADDRGP4 cg+107604
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 cgs+152340+284
+INDIRI4
+ARGI4
+ADDRGP4 CG_SmokePuff
+CALLP4
+pop
+LABELV $1245
+LABELV $1241
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 CG_ShotgunPattern
+CALLV
+pop
+LABELV $1230
+endproc CG_ShotgunFire 56 48
+export CG_Tracer
+proc CG_Tracer 236 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 108
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 188
+CNSTI4 4
+ASGNI4
+ADDRLP4 108+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 192
+CNSTI4 8
+ASGNI4
+ADDRLP4 108+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 108
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 196
+INDIRF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 1120403456
+GEF4 $1255
+ADDRGP4 $1252
+JUMPV
+LABELV $1255
+ADDRLP4 200
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 200
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+MULF4
+CNSTF4 1112014848
+ADDF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 160
+INDIRF4
+ADDRGP4 cg_tracerLength+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 164
+INDIRF4
+LEF4 $1258
+ADDRLP4 156
+ADDRLP4 164
+INDIRF4
+ASGNF4
+LABELV $1258
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 120+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 160
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 108+4
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 108+8
+INDIRF4
+ADDRLP4 156
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 224
+ADDRLP4 108
+INDIRF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 224
+INDIRF4
+ADDRGP4 cg+109044+36+12
+INDIRF4
+MULF4
+ADDRLP4 108+4
+INDIRF4
+ADDRGP4 cg+109044+36+12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 108+8
+INDIRF4
+ADDRGP4 cg+109044+36+12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 224
+INDIRF4
+ADDRGP4 cg+109044+36+24
+INDIRF4
+MULF4
+ADDRLP4 108+4
+INDIRF4
+ADDRGP4 cg+109044+36+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 108+8
+INDIRF4
+ADDRGP4 cg+109044+36+24+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+ADDRGP4 cg+109044+36+12
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96+4
+ADDRGP4 cg+109044+36+12+4
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 96+8
+ADDRGP4 cg+109044+36+12+8
+INDIRF4
+ADDRLP4 144+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 144
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg+109044+36+24
+INDIRF4
+ADDRLP4 228
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg+109044+36+24+4
+INDIRF4
+ADDRLP4 228
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96+8
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg+109044+36+24+8
+INDIRF4
+ADDRLP4 144
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+ADDRLP4 132
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 132+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 132+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24
+ADDRLP4 132
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 132+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 132+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+24+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+24+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+24+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48
+ADDRLP4 120
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+4
+ADDRLP4 120+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+8
+ADDRLP4 120+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+48+12
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+12+4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+48+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+48+20+3
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72
+ADDRLP4 120
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+4
+ADDRLP4 120+4
+INDIRF4
+ADDRLP4 96+4
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+8
+ADDRLP4 120+8
+INDIRF4
+ADDRLP4 96+8
+INDIRF4
+ADDRGP4 cg_tracerWidth+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+72+12
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+12+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+72+20
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+1
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+2
+CNSTU1 255
+ASGNU1
+ADDRLP4 0+72+20+3
+CNSTU1 255
+ASGNU1
+ADDRGP4 cgs+152340+220
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddPolyToScene
+CALLV
+pop
+ADDRLP4 232
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 168
+ADDRLP4 232
+INDIRF4
+ADDRLP4 120
+INDIRF4
+ADDRLP4 132
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 168+4
+ADDRLP4 232
+INDIRF4
+ADDRLP4 120+4
+INDIRF4
+ADDRLP4 132+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 168+8
+CNSTF4 1056964608
+ADDRLP4 120+8
+INDIRF4
+ADDRLP4 132+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 168
+ARGP4
+CNSTI4 1022
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 cgs+152340+532
+INDIRI4
+ARGI4
+ADDRGP4 trap_S_StartSound
+CALLV
+pop
+LABELV $1252
+endproc CG_Tracer 236 16
+proc CG_CalcMuzzlePoint 40 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+NEI4 $1440
+ADDRFP4 4
+INDIRP4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRGP4 cg+36
+INDIRP4
+CNSTI4 196
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $1439
+JUMPV
+LABELV $1440
+ADDRLP4 12
+CNSTI4 728
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 cg_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1448
+CNSTI4 0
+RETI4
+ADDRGP4 $1439
+JUMPV
+LABELV $1448
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12
+INDIRP4
+CNSTI4 60
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 13
+EQI4 $1452
+ADDRLP4 16
+INDIRI4
+CNSTI4 23
+NEI4 $1450
+LABELV $1452
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1094713344
+ADDF4
+ASGNF4
+ADDRGP4 $1451
+JUMPV
+LABELV $1450
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1104150528
+ADDF4
+ASGNF4
+LABELV $1451
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $1439
+endproc CG_CalcMuzzlePoint 40 16
+export CG_Bullet
+proc CG_Bullet 96 28
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1456
+ADDRGP4 cg_tracerChance+8
+INDIRF4
+CNSTF4 0
+LEF4 $1456
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 76
+ADDRGP4 CG_CalcMuzzlePoint
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $1459
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 84
+ADDRGP4 trap_CM_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $1461
+ADDRLP4 88
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1461
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $1462
+JUMPV
+LABELV $1461
+ADDRLP4 12
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1463
+ADDRLP4 20
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 92
+CNSTP4 0
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 20+12
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+ADDRGP4 $1464
+JUMPV
+LABELV $1463
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $1466
+ADDRLP4 20
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+CNSTP4 0
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_CM_BoxTrace
+CALLV
+pop
+ADDRLP4 20+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 CG_BubbleTrail
+CALLV
+pop
+LABELV $1466
+LABELV $1464
+LABELV $1462
+ADDRLP4 92
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRGP4 cg_tracerChance+8
+INDIRF4
+GEF4 $1469
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CG_Tracer
+CALLV
+pop
+LABELV $1469
+LABELV $1459
+LABELV $1456
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $1472
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRGP4 CG_Bleed
+CALLV
+pop
+ADDRGP4 $1473
+JUMPV
+LABELV $1472
+CNSTI4 2
+ARGI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 CG_MissileHitWall
+CALLV
+pop
+LABELV $1473
+LABELV $1455
+endproc CG_Bullet 96 28
+import CG_NewParticleArea
+import initparticles
+import CG_ParticleExplosion
+import CG_ParticleMisc
+import CG_ParticleDust
+import CG_ParticleSparks
+import CG_ParticleBulletDebris
+import CG_ParticleSnowFlurry
+import CG_AddParticleShrapnel
+import CG_ParticleSmoke
+import CG_ParticleSnow
+import CG_AddParticles
+import CG_ClearParticles
+import trap_GetEntityToken
+import trap_getCameraInfo
+import trap_startCamera
+import trap_loadCamera
+import trap_SnapVector
+import trap_CIN_SetExtents
+import trap_CIN_DrawCinematic
+import trap_CIN_RunCinematic
+import trap_CIN_StopCinematic
+import trap_CIN_PlayCinematic
+import trap_Key_GetKey
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_IsDown
+import trap_R_RegisterFont
+import trap_MemoryRemaining
+import testPrintFloat
+import testPrintInt
+import trap_SetUserCmdValue
+import trap_GetUserCmd
+import trap_GetCurrentCmdNumber
+import trap_GetServerCommand
+import trap_GetSnapshot
+import trap_GetCurrentSnapshotNumber
+import trap_GetGameState
+import trap_GetGlconfig
+import trap_R_RemapShader
+import trap_R_LerpTag
+import trap_R_ModelBounds
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_LightForPoint
+import trap_R_AddLightToScene
+import trap_R_AddPolysToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterShader
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_R_LoadWorldMap
+import trap_S_StopBackgroundTrack
+import trap_S_StartBackgroundTrack
+import trap_S_RegisterSound
+import trap_S_Respatialize
+import trap_S_UpdateEntityPosition
+import trap_S_AddRealLoopingSound
+import trap_S_AddLoopingSound
+import trap_S_ClearLoopingSounds
+import trap_S_StartLocalSound
+import trap_S_StopLoopingSound
+import trap_S_StartSound
+import trap_CM_MarkFragments
+import trap_CM_TransformedBoxTrace
+import trap_CM_BoxTrace
+import trap_CM_TransformedPointContents
+import trap_CM_PointContents
+import trap_CM_TempBoxModel
+import trap_CM_InlineModel
+import trap_CM_NumInlineModels
+import trap_CM_LoadMap
+import trap_UpdateScreen
+import trap_SendClientCommand
+import trap_AddCommand
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import CG_CheckChangedPredictableEvents
+import CG_TransitionPlayerState
+import CG_Respawn
+import CG_PlayBufferedVoiceChats
+import CG_VoiceChatLocal
+import CG_ShaderStateChanged
+import CG_LoadVoiceChats
+import CG_SetConfigValues
+import CG_ParseServerinfo
+import CG_ExecuteNewServerCommands
+import CG_InitConsoleCommands
+import CG_ConsoleCommand
+import CG_DrawOldTourneyScoreboard
+import CG_DrawOldScoreboard
+import CG_DrawInformation
+import CG_LoadingClient
+import CG_LoadingItem
+import CG_LoadingString
+import CG_ProcessSnapshots
+import CG_MakeExplosion
+import CG_Bleed
+import CG_BigExplode
+import CG_GibPlayer
+import CG_ScorePlum
+import CG_SpawnEffect
+import CG_BubbleTrail
+import CG_SmokePuff
+import CG_AddLocalEntities
+import CG_AllocLocalEntity
+import CG_InitLocalEntities
+import CG_ImpactMark
+import CG_AddMarks
+import CG_InitMarkPolys
+import CG_PositionRotatedEntityOnTag
+import CG_PositionEntityOnTag
+import CG_AdjustPositionForMover
+import CG_Beam
+import CG_AddPacketEntities
+import CG_SetEntitySoundPosition
+import CG_PainEvent
+import CG_EntityEvent
+import CG_PlaceString
+import CG_CheckEvents
+import CG_LoadDeferredPlayers
+import CG_PredictPlayerState
+import CG_Trace
+import CG_PointContents
+import CG_BuildSolidList
+import CG_CustomSound
+import CG_NewClientInfo
+import CG_AddRefEntityWithPowerups
+import CG_ResetPlayerEntity
+import CG_Player
+import CG_StatusHandle
+import CG_OtherTeamHasFlag
+import CG_YourTeamHasFlag
+import CG_GameTypeString
+import CG_CheckOrderPending
+import CG_Text_PaintChar
+import CG_Draw3DModel
+import CG_GetKillerText
+import CG_GetGameStatusText
+import CG_GetTeamColor
+import CG_InitTeamChat
+import CG_SetPrintString
+import CG_ShowResponseHead
+import CG_RunMenuScript
+import CG_OwnerDrawVisible
+import CG_GetValue
+import CG_SelectNextPlayer
+import CG_SelectPrevPlayer
+import CG_Text_Height
+import CG_Text_Width
+import CG_Text_Paint
+import CG_OwnerDraw
+import CG_DrawTeamBackground
+import CG_DrawFlagModel
+import CG_DrawActive
+import CG_DrawHead
+import CG_CenterPrint
+import CG_AddLagometerSnapshotInfo
+import CG_AddLagometerFrameInfo
+import teamChat2
+import teamChat1
+import systemChat
+import drawTeamOverlayModificationCount
+import numSortedTeamPlayers
+import sortedTeamPlayers
+import CG_DrawTopBottom
+import CG_DrawSides
+import CG_DrawRect
+import UI_DrawProportionalString
+import CG_GetColorForHealth
+import CG_ColorForHealth
+import CG_TileClear
+import CG_TeamColor
+import CG_FadeColor
+import CG_DrawStrlen
+import CG_DrawSmallStringColor
+import CG_DrawSmallString
+import CG_DrawBigStringColor
+import CG_DrawBigString
+import CG_DrawStringExt
+import CG_DrawString
+import CG_DrawPic
+import CG_FillRect
+import CG_AdjustFrom640
+import CG_DrawActiveFrame
+import CG_AddBufferedSound
+import CG_ZoomUp_f
+import CG_ZoomDown_f
+import CG_TestModelPrevSkin_f
+import CG_TestModelNextSkin_f
+import CG_TestModelPrevFrame_f
+import CG_TestModelNextFrame_f
+import CG_TestGun_f
+import CG_TestModel_f
+import CG_BuildSpectatorString
+import CG_GetSelectedScore
+import CG_SetScoreSelection
+import CG_RankRunFrame
+import CG_EventHandling
+import CG_MouseEvent
+import CG_KeyEvent
+import CG_LoadMenus
+import CG_LastAttacker
+import CG_CrosshairPlayer
+import CG_UpdateCvars
+import CG_StartMusic
+import CG_Error
+import CG_Printf
+import CG_Argv
+import CG_ConfigString
+import cg_trueLightning
+import cg_oldPlasma
+import cg_oldRocket
+import cg_oldRail
+import cg_noProjectileTrail
+import cg_noTaunt
+import cg_bigFont
+import cg_smallFont
+import cg_cameraMode
+import cg_timescale
+import cg_timescaleFadeSpeed
+import cg_timescaleFadeEnd
+import cg_cameraOrbitDelay
+import cg_cameraOrbit
+import pmove_msec
+import pmove_fixed
+import cg_smoothClients
+import cg_scorePlum
+import cg_noVoiceText
+import cg_noVoiceChats
+import cg_teamChatsOnly
+import cg_drawFriend
+import cg_deferPlayers
+import cg_predictItems
+import cg_blood
+import cg_paused
+import cg_buildScript
+import cg_forceModel
+import cg_stats
+import cg_teamChatHeight
+import cg_teamChatTime
+import cg_synchronousClients
+import cg_drawAttacker
+import cg_lagometer
+import cg_thirdPerson
+import cg_thirdPersonAngle
+import cg_thirdPersonRange
+import cg_zoomFov
+import cg_fov
+import cg_simpleItems
+import cg_ignore
+import cg_autoswitch
+import cg_tracerLength
+import cg_tracerWidth
+import cg_tracerChance
+import cg_viewsize
+import cg_drawGun
+import cg_gun_z
+import cg_gun_y
+import cg_gun_x
+import cg_gun_frame
+import cg_brassTime
+import cg_addMarks
+import cg_footsteps
+import cg_showmiss
+import cg_noPlayerAnims
+import cg_nopredict
+import cg_errorDecay
+import cg_railTrailTime
+import cg_debugEvents
+import cg_debugPosition
+import cg_debugAnim
+import cg_animSpeed
+import cg_draw2D
+import cg_drawStatus
+import cg_crosshairHealth
+import cg_crosshairSize
+import cg_crosshairY
+import cg_crosshairX
+import cg_teamOverlayUserinfo
+import cg_drawTeamOverlay
+import cg_drawRewards
+import cg_drawCrosshairNames
+import cg_drawCrosshair
+import cg_drawAmmoWarning
+import cg_drawIcons
+import cg_draw3dIcons
+import cg_drawSnapshot
+import cg_drawFPS
+import cg_drawTimer
+import cg_gibs
+import cg_shadows
+import cg_swingSpeed
+import cg_bobroll
+import cg_bobpitch
+import cg_bobup
+import cg_runroll
+import cg_runpitch
+import cg_centertime
+import cg_markPolys
+import cg_items
+import cg_weapons
+import cg_entities
+import cg
+import cgs
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1100
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 49
+byte 1 0
+align 1
+LABELV $1032
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 87
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 45
+byte 1 62
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 62
+byte 1 61
+byte 1 32
+byte 1 87
+byte 1 80
+byte 1 95
+byte 1 78
+byte 1 85
+byte 1 77
+byte 1 95
+byte 1 87
+byte 1 69
+byte 1 65
+byte 1 80
+byte 1 79
+byte 1 78
+byte 1 83
+byte 1 0
+align 1
+LABELV $757
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $720
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $710
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $520
+byte 1 67
+byte 1 71
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 86
+byte 1 105
+byte 1 115
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 78
+byte 1 117
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 32
+byte 1 91
+byte 1 48
+byte 1 45
+byte 1 37
+byte 1 100
+byte 1 93
+byte 1 0
+align 1
+LABELV $513
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $512
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $509
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $508
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 47
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $506
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 67
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $501
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $498
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $497
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 114
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $495
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $492
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $489
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 104
+byte 1 121
+byte 1 112
+byte 1 114
+byte 1 98
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $488
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 47
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 102
+byte 1 108
+byte 1 121
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $486
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $483
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 108
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $482
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 103
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 49
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $480
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $477
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 108
+byte 1 102
+byte 1 49
+byte 1 97
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $476
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 102
+byte 1 108
+byte 1 121
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $474
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 49
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $472
+byte 1 98
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 69
+byte 1 120
+byte 1 112
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $469
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 52
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $468
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 51
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $467
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 50
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $466
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 103
+byte 1 102
+byte 1 49
+byte 1 98
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $464
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 111
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $462
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $459
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $456
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $453
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 108
+byte 1 101
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $450
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 66
+byte 1 111
+byte 1 108
+byte 1 116
+byte 1 78
+byte 1 101
+byte 1 119
+byte 1 0
+align 1
+LABELV $447
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $446
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 47
+byte 1 108
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $445
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 115
+byte 1 116
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $443
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 107
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $442
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 101
+byte 1 47
+byte 1 102
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $438
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 50
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 47
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $435
+byte 1 95
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $434
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $433
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $419
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
@@ -0,0 +1,8750 @@
+bss
+align 4
+LABELV $55
+skip 4
+export BotNumActivePlayers
+code
+proc BotNumActivePlayers 1060 12
+ADDRGP4 $55
+INDIRI4
+CNSTI4 0
+NEI4 $56
+ADDRGP4 $58
+ARGP4
+ADDRLP4 1032
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $55
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+LABELV $56
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRGP4 $62
+JUMPV
+LABELV $59
+ADDRLP4 1024
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $66
+ADDRLP4 0
+ARGP4
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $63
+LABELV $66
+ADDRGP4 $60
+JUMPV
+LABELV $63
+ADDRLP4 0
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 3
+NEI4 $67
+ADDRGP4 $60
+JUMPV
+LABELV $67
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $60
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $62
+ADDRLP4 1024
+INDIRI4
+ADDRGP4 $55
+INDIRI4
+GEI4 $70
+ADDRLP4 1024
+INDIRI4
+CNSTI4 64
+LTI4 $59
+LABELV $70
+ADDRLP4 1028
+INDIRI4
+RETI4
+LABELV $54
+endproc BotNumActivePlayers 1060 12
+bss
+align 4
+LABELV $72
+skip 4
+export BotIsFirstInRankings
+code
+proc BotIsFirstInRankings 1524 12
+ADDRGP4 $72
+INDIRI4
+CNSTI4 0
+NEI4 $73
+ADDRGP4 $58
+ARGP4
+ADDRLP4 1500
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $72
+ADDRLP4 1500
+INDIRI4
+ASGNI4
+LABELV $73
+ADDRLP4 1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $78
+JUMPV
+LABELV $75
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1504
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1504
+INDIRI4
+CNSTI4 0
+EQI4 $81
+ADDRLP4 4
+ARGP4
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1508
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1508
+INDIRP4
+ARGP4
+ADDRLP4 1512
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1512
+INDIRI4
+CNSTI4 0
+NEI4 $79
+LABELV $81
+ADDRGP4 $76
+JUMPV
+LABELV $79
+ADDRLP4 4
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 1516
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1516
+INDIRP4
+ARGP4
+ADDRLP4 1520
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1520
+INDIRI4
+CNSTI4 3
+NEI4 $82
+ADDRGP4 $76
+JUMPV
+LABELV $82
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 1496
+INDIRI4
+ADDRLP4 1028+248
+INDIRI4
+GEI4 $84
+CNSTI4 0
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $84
+LABELV $76
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $78
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $72
+INDIRI4
+GEI4 $87
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $75
+LABELV $87
+CNSTI4 1
+RETI4
+LABELV $71
+endproc BotIsFirstInRankings 1524 12
+bss
+align 4
+LABELV $89
+skip 4
+export BotIsLastInRankings
+code
+proc BotIsLastInRankings 1524 12
+ADDRGP4 $89
+INDIRI4
+CNSTI4 0
+NEI4 $90
+ADDRGP4 $58
+ARGP4
+ADDRLP4 1500
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $89
+ADDRLP4 1500
+INDIRI4
+ASGNI4
+LABELV $90
+ADDRLP4 1496
+ADDRFP4 0
+INDIRP4
+CNSTI4 264
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $95
+JUMPV
+LABELV $92
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1504
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1504
+INDIRI4
+CNSTI4 0
+EQI4 $98
+ADDRLP4 4
+ARGP4
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1508
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1508
+INDIRP4
+ARGP4
+ADDRLP4 1512
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1512
+INDIRI4
+CNSTI4 0
+NEI4 $96
+LABELV $98
+ADDRGP4 $93
+JUMPV
+LABELV $96
+ADDRLP4 4
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 1516
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1516
+INDIRP4
+ARGP4
+ADDRLP4 1520
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1520
+INDIRI4
+CNSTI4 3
+NEI4 $99
+ADDRGP4 $93
+JUMPV
+LABELV $99
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 1496
+INDIRI4
+ADDRLP4 1028+248
+INDIRI4
+LEI4 $101
+CNSTI4 0
+RETI4
+ADDRGP4 $88
+JUMPV
+LABELV $101
+LABELV $93
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $95
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $89
+INDIRI4
+GEI4 $104
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $92
+LABELV $104
+CNSTI4 1
+RETI4
+LABELV $88
+endproc BotIsLastInRankings 1524 12
+bss
+align 1
+LABELV $106
+skip 32
+align 4
+LABELV $107
+skip 4
+export BotFirstClientInRankings
+code
+proc BotFirstClientInRankings 1532 12
+ADDRGP4 $107
+INDIRI4
+CNSTI4 0
+NEI4 $108
+ADDRGP4 $58
+ARGP4
+ADDRLP4 1504
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $107
+ADDRLP4 1504
+INDIRI4
+ASGNI4
+LABELV $108
+ADDRLP4 1496
+CNSTI4 -999999
+ASGNI4
+ADDRLP4 1508
+CNSTI4 0
+ASGNI4
+ADDRLP4 1500
+ADDRLP4 1508
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1508
+INDIRI4
+ASGNI4
+ADDRGP4 $113
+JUMPV
+LABELV $110
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1512
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1512
+INDIRI4
+CNSTI4 0
+EQI4 $116
+ADDRLP4 4
+ARGP4
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1516
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1516
+INDIRP4
+ARGP4
+ADDRLP4 1520
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1520
+INDIRI4
+CNSTI4 0
+NEI4 $114
+LABELV $116
+ADDRGP4 $111
+JUMPV
+LABELV $114
+ADDRLP4 4
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 1524
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1524
+INDIRP4
+ARGP4
+ADDRLP4 1528
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1528
+INDIRI4
+CNSTI4 3
+NEI4 $117
+ADDRGP4 $111
+JUMPV
+LABELV $117
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 1028+248
+INDIRI4
+ADDRLP4 1496
+INDIRI4
+LEI4 $119
+ADDRLP4 1496
+ADDRLP4 1028+248
+INDIRI4
+ASGNI4
+ADDRLP4 1500
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $119
+LABELV $111
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $113
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $107
+INDIRI4
+GEI4 $123
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $110
+LABELV $123
+ADDRLP4 1500
+INDIRI4
+ARGI4
+ADDRGP4 $106
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $106
+RETP4
+LABELV $105
+endproc BotFirstClientInRankings 1532 12
+bss
+align 1
+LABELV $125
+skip 32
+align 4
+LABELV $126
+skip 4
+export BotLastClientInRankings
+code
+proc BotLastClientInRankings 1532 12
+ADDRGP4 $126
+INDIRI4
+CNSTI4 0
+NEI4 $127
+ADDRGP4 $58
+ARGP4
+ADDRLP4 1504
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $126
+ADDRLP4 1504
+INDIRI4
+ASGNI4
+LABELV $127
+ADDRLP4 1496
+CNSTI4 999999
+ASGNI4
+ADDRLP4 1508
+CNSTI4 0
+ASGNI4
+ADDRLP4 1500
+ADDRLP4 1508
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1508
+INDIRI4
+ASGNI4
+ADDRGP4 $132
+JUMPV
+LABELV $129
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1512
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1512
+INDIRI4
+CNSTI4 0
+EQI4 $135
+ADDRLP4 4
+ARGP4
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1516
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1516
+INDIRP4
+ARGP4
+ADDRLP4 1520
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1520
+INDIRI4
+CNSTI4 0
+NEI4 $133
+LABELV $135
+ADDRGP4 $130
+JUMPV
+LABELV $133
+ADDRLP4 4
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 1524
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1524
+INDIRP4
+ARGP4
+ADDRLP4 1528
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1528
+INDIRI4
+CNSTI4 3
+NEI4 $136
+ADDRGP4 $130
+JUMPV
+LABELV $136
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 1028+248
+INDIRI4
+ADDRLP4 1496
+INDIRI4
+GEI4 $138
+ADDRLP4 1496
+ADDRLP4 1028+248
+INDIRI4
+ASGNI4
+ADDRLP4 1500
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $138
+LABELV $130
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $132
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $126
+INDIRI4
+GEI4 $142
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $129
+LABELV $142
+ADDRLP4 1500
+INDIRI4
+ARGI4
+ADDRGP4 $125
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $125
+RETP4
+LABELV $124
+endproc BotLastClientInRankings 1532 12
+bss
+align 4
+LABELV $144
+skip 4
+align 1
+LABELV $145
+skip 32
+export BotRandomOpponentName
+code
+proc BotRandomOpponentName 1324 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $144
+INDIRI4
+CNSTI4 0
+NEI4 $146
+ADDRGP4 $58
+ARGP4
+ADDRLP4 1292
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $144
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+LABELV $146
+ADDRLP4 1296
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1296
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1296
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1296
+INDIRI4
+ASGNI4
+ADDRGP4 $151
+JUMPV
+LABELV $148
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $152
+ADDRGP4 $149
+JUMPV
+LABELV $152
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1300
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1300
+INDIRI4
+CNSTI4 0
+EQI4 $156
+ADDRLP4 4
+ARGP4
+ADDRGP4 $65
+ARGP4
+ADDRLP4 1304
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1304
+INDIRP4
+ARGP4
+ADDRLP4 1308
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1308
+INDIRI4
+CNSTI4 0
+NEI4 $154
+LABELV $156
+ADDRGP4 $149
+JUMPV
+LABELV $154
+ADDRLP4 4
+ARGP4
+ADDRGP4 $69
+ARGP4
+ADDRLP4 1312
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1312
+INDIRP4
+ARGP4
+ADDRLP4 1316
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 3
+NEI4 $157
+ADDRGP4 $149
+JUMPV
+LABELV $157
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1320
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+CNSTI4 0
+EQI4 $159
+ADDRGP4 $149
+JUMPV
+LABELV $159
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1036
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $149
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $151
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $144
+INDIRI4
+GEI4 $161
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $148
+LABELV $161
+ADDRLP4 1304
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1304
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 1028
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $165
+JUMPV
+LABELV $162
+ADDRLP4 1032
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+GTI4 $166
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1036
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $145
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $145
+RETP4
+ADDRGP4 $143
+JUMPV
+LABELV $166
+LABELV $163
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $165
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+LTI4 $162
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRGP4 $145
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $145
+RETP4
+LABELV $143
+endproc BotRandomOpponentName 1324 12
+bss
+align 1
+LABELV $169
+skip 128
+export BotMapTitle
+code
+proc BotMapTitle 1028 12
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $169
+ARGP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+CNSTI4 127
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRGP4 $169+127
+CNSTI1 0
+ASGNI1
+ADDRGP4 $169
+RETP4
+LABELV $168
+endproc BotMapTitle 1028 12
+export BotWeaponNameForMeansOfDeath
+proc BotWeaponNameForMeansOfDeath 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $173
+ADDRLP4 0
+INDIRI4
+CNSTI4 23
+GTI4 $173
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $196-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $196
+address $175
+address $177
+address $179
+address $181
+address $181
+address $183
+address $183
+address $185
+address $185
+address $187
+address $189
+address $191
+address $191
+address $173
+address $173
+address $173
+address $173
+address $173
+address $173
+address $173
+address $173
+address $173
+address $193
+code
+LABELV $175
+ADDRGP4 $176
+RETP4
+ADDRGP4 $172
+JUMPV
+LABELV $177
+ADDRGP4 $178
+RETP4
+ADDRGP4 $172
+JUMPV
+LABELV $179
+ADDRGP4 $180
+RETP4
+ADDRGP4 $172
+JUMPV
+LABELV $181
+ADDRGP4 $182
+RETP4
+ADDRGP4 $172
+JUMPV
+LABELV $183
+ADDRGP4 $184
+RETP4
+ADDRGP4 $172
+JUMPV
+LABELV $185
+ADDRGP4 $186
+RETP4
+ADDRGP4 $172
+JUMPV
+LABELV $187
+ADDRGP4 $188
+RETP4
+ADDRGP4 $172
+JUMPV
+LABELV $189
+ADDRGP4 $190
+RETP4
+ADDRGP4 $172
+JUMPV
+LABELV $191
+ADDRGP4 $192
+RETP4
+ADDRGP4 $172
+JUMPV
+LABELV $193
+ADDRGP4 $194
+RETP4
+ADDRGP4 $172
+JUMPV
+LABELV $173
+ADDRGP4 $195
+RETP4
+LABELV $172
+endproc BotWeaponNameForMeansOfDeath 4 0
+export BotRandomWeaponName
+proc BotRandomWeaponName 12 0
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTF4 1091462758
+ADDRLP4 4
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $199
+ADDRLP4 8
+INDIRI4
+CNSTI4 7
+GTI4 $199
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $209
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $209
+address $201
+address $202
+address $203
+address $204
+address $205
+address $206
+address $207
+address $208
+code
+LABELV $201
+ADDRGP4 $178
+RETP4
+ADDRGP4 $198
+JUMPV
+LABELV $202
+ADDRGP4 $176
+RETP4
+ADDRGP4 $198
+JUMPV
+LABELV $203
+ADDRGP4 $180
+RETP4
+ADDRGP4 $198
+JUMPV
+LABELV $204
+ADDRGP4 $182
+RETP4
+ADDRGP4 $198
+JUMPV
+LABELV $205
+ADDRGP4 $184
+RETP4
+ADDRGP4 $198
+JUMPV
+LABELV $206
+ADDRGP4 $186
+RETP4
+ADDRGP4 $198
+JUMPV
+LABELV $207
+ADDRGP4 $188
+RETP4
+ADDRGP4 $198
+JUMPV
+LABELV $208
+ADDRGP4 $190
+RETP4
+ADDRGP4 $198
+JUMPV
+LABELV $199
+ADDRGP4 $192
+RETP4
+LABELV $198
+endproc BotRandomWeaponName 12 0
+export BotVisibleEnemies
+proc BotVisibleEnemies 172 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $211
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $215
+ADDRGP4 $212
+JUMPV
+LABELV $215
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $217
+ADDRGP4 $212
+JUMPV
+LABELV $217
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $222
+ADDRLP4 4+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $219
+LABELV $222
+ADDRGP4 $212
+JUMPV
+LABELV $219
+ADDRLP4 4
+ARGP4
+ADDRLP4 152
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $223
+ADDRLP4 4
+ARGP4
+ADDRLP4 156
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+NEI4 $223
+ADDRGP4 $212
+JUMPV
+LABELV $223
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+EQI4 $225
+ADDRGP4 $212
+JUMPV
+LABELV $225
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 168
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 168
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+LEF4 $227
+CNSTI4 1
+RETI4
+ADDRGP4 $210
+JUMPV
+LABELV $227
+LABELV $212
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $211
+CNSTI4 0
+RETI4
+LABELV $210
+endproc BotVisibleEnemies 172 20
+export BotValidChatPosition
+proc BotValidChatPosition 168 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $230
+CNSTI4 1
+RETI4
+ADDRGP4 $229
+JUMPV
+LABELV $230
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5092
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $237
+ADDRFP4 0
+INDIRP4
+CNSTI4 5100
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $237
+ADDRFP4 0
+INDIRP4
+CNSTI4 5104
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $237
+ADDRFP4 0
+INDIRP4
+CNSTI4 5108
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+NEI4 $237
+ADDRFP4 0
+INDIRP4
+CNSTI4 5112
+ADDP4
+INDIRI4
+ADDRLP4 152
+INDIRI4
+EQI4 $232
+LABELV $237
+CNSTI4 0
+RETI4
+ADDRGP4 $229
+JUMPV
+LABELV $232
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1103101952
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+EQI4 $239
+CNSTI4 0
+RETI4
+ADDRGP4 $229
+JUMPV
+LABELV $239
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $242
+CNSTI4 0
+RETI4
+ADDRGP4 $229
+JUMPV
+LABELV $242
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 164
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ADDRLP4 164
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+ASGNF4
+CNSTI4 4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 60
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 60+80
+INDIRI4
+CNSTI4 1022
+EQI4 $246
+CNSTI4 0
+RETI4
+ADDRGP4 $229
+JUMPV
+LABELV $246
+CNSTI4 1
+RETI4
+LABELV $229
+endproc BotValidChatPosition 168 28
+export BotChat_EnterGame
+proc BotChat_EnterGame 68 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $250
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $253
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $253
+ADDRLP4 36
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $255
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $255
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $257
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 27
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 40
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $259
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 0
+INDIRF4
+LEF4 $262
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $262
+LABELV $259
+ADDRLP4 44
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+GTI4 $264
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $264
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $266
+CNSTI4 0
+RETI4
+ADDRGP4 $249
+JUMPV
+LABELV $266
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 52
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $249
+endproc BotChat_EnterGame 68 32
+export BotChat_ExitGame
+proc BotChat_ExitGame 64 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $271
+CNSTI4 0
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $271
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $274
+CNSTI4 0
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $274
+ADDRLP4 36
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $276
+CNSTI4 0
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $276
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $278
+CNSTI4 0
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $278
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 27
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 40
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $280
+ADDRLP4 44
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 0
+INDIRF4
+LEF4 $283
+CNSTI4 0
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $283
+LABELV $280
+ADDRLP4 44
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+GTI4 $285
+CNSTI4 0
+RETI4
+ADDRGP4 $270
+JUMPV
+LABELV $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 48
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $287
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $270
+endproc BotChat_ExitGame 64 32
+export BotChat_StartLevel
+proc BotChat_StartLevel 56 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $289
+CNSTI4 0
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $289
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $292
+CNSTI4 0
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $292
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $294
+CNSTI4 0
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $294
+ADDRLP4 40
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $296
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $298
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $296
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $299
+CNSTI4 0
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $299
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 26
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 44
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $301
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 0
+INDIRF4
+LEF4 $304
+CNSTI4 0
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $304
+LABELV $301
+ADDRLP4 48
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+GTI4 $306
+CNSTI4 0
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $306
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 52
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $308
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $288
+endproc BotChat_StartLevel 56 16
+export BotChat_EndLevel
+proc BotChat_EndLevel 80 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $310
+CNSTI4 0
+RETI4
+ADDRGP4 $309
+JUMPV
+LABELV $310
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $313
+CNSTI4 0
+RETI4
+ADDRGP4 $309
+JUMPV
+LABELV $313
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $315
+CNSTI4 0
+RETI4
+ADDRGP4 $309
+JUMPV
+LABELV $315
+ADDRLP4 40
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $317
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 BotIsFirstInRankings
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $319
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $298
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+LABELV $319
+CNSTI4 1
+RETI4
+ADDRGP4 $309
+JUMPV
+LABELV $317
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $321
+CNSTI4 0
+RETI4
+ADDRGP4 $309
+JUMPV
+LABELV $321
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 26
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 44
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $323
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 0
+INDIRF4
+LEF4 $326
+CNSTI4 0
+RETI4
+ADDRGP4 $309
+JUMPV
+LABELV $326
+LABELV $323
+ADDRLP4 48
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+GTI4 $328
+CNSTI4 0
+RETI4
+ADDRGP4 $309
+JUMPV
+LABELV $328
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotIsFirstInRankings
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $330
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 56
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 64
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $332
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $331
+JUMPV
+LABELV $330
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotIsLastInRankings
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $333
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 60
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $335
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $334
+JUMPV
+LABELV $333
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 60
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $334
+LABELV $331
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $309
+endproc BotChat_EndLevel 80 32
+export BotChat_Death
+proc BotChat_Death 116 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $338
+CNSTI4 0
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $341
+CNSTI4 0
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $341
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 29
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 36
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $343
+CNSTI4 0
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $343
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $345
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $348
+CNSTI4 0
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $348
+LABELV $345
+ADDRLP4 40
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+GTI4 $350
+CNSTI4 0
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $350
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+LTI4 $352
+ADDRLP4 44
+INDIRI4
+CNSTI4 64
+GEI4 $352
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $353
+JUMPV
+LABELV $352
+ADDRLP4 0
+ARGP4
+ADDRGP4 $354
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $353
+ADDRLP4 48
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+EQI4 $355
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $355
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $357
+CNSTI4 0
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $357
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $359
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $356
+JUMPV
+LABELV $355
+ADDRLP4 60
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $360
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $298
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $337
+JUMPV
+LABELV $360
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 14
+NEI4 $362
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $364
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $363
+JUMPV
+LABELV $362
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 15
+NEI4 $365
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $367
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $366
+JUMPV
+LABELV $365
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 16
+NEI4 $368
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $370
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $369
+JUMPV
+LABELV $368
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 19
+NEI4 $371
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $373
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $372
+JUMPV
+LABELV $371
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6008
+ADDP4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+NEI4 $380
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 17
+EQI4 $380
+ADDRLP4 88
+INDIRI4
+CNSTI4 20
+EQI4 $380
+ADDRLP4 88
+INDIRI4
+CNSTI4 21
+EQI4 $380
+ADDRLP4 88
+INDIRI4
+CNSTI4 22
+EQI4 $380
+ADDRLP4 88
+INDIRI4
+ADDRLP4 84
+INDIRI4
+NEI4 $374
+LABELV $380
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $375
+JUMPV
+LABELV $374
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 18
+NEI4 $382
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $384
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $383
+JUMPV
+LABELV $382
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 96
+INDIRI4
+CNSTI4 2
+EQI4 $389
+ADDRLP4 96
+INDIRI4
+CNSTI4 10
+EQI4 $389
+ADDRLP4 96
+INDIRI4
+CNSTI4 12
+EQI4 $389
+ADDRLP4 96
+INDIRI4
+CNSTI4 13
+NEI4 $385
+LABELV $389
+ADDRLP4 100
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $385
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $390
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $392
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $386
+JUMPV
+LABELV $390
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $393
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $395
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $386
+JUMPV
+LABELV $393
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $396
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $386
+JUMPV
+LABELV $385
+ADDRLP4 104
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 24
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 108
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 104
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 108
+INDIRF4
+GEF4 $397
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $398
+JUMPV
+LABELV $397
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $400
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $398
+LABELV $386
+LABELV $383
+LABELV $375
+LABELV $372
+LABELV $369
+LABELV $366
+LABELV $363
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $356
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $337
+endproc BotChat_Death 116 20
+export BotChat_Kill
+proc BotChat_Kill 80 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $402
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $402
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $405
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $405
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 36
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $407
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $407
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $409
+ADDRLP4 40
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $412
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $412
+LABELV $409
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $414
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $414
+ADDRLP4 44
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+GTI4 $416
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $416
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $418
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $418
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $420
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $420
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $422
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+EQI4 $422
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $424
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRLP4 68
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $425
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $298
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $401
+JUMPV
+LABELV $425
+ADDRFP4 0
+INDIRP4
+CNSTI4 6004
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $427
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $429
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $428
+JUMPV
+LABELV $427
+ADDRFP4 0
+INDIRP4
+CNSTI4 6004
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $430
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $432
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $431
+JUMPV
+LABELV $430
+ADDRFP4 0
+INDIRP4
+CNSTI4 6004
+ADDP4
+INDIRI4
+CNSTI4 18
+NEI4 $433
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $435
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $434
+JUMPV
+LABELV $433
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 24
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 76
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 76
+INDIRF4
+GEF4 $436
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $438
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $437
+JUMPV
+LABELV $436
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $439
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $437
+LABELV $434
+LABELV $431
+LABELV $428
+LABELV $423
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $401
+endproc BotChat_Kill 80 16
+export BotChat_EnemySuicide
+proc BotChat_EnemySuicide 56 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $441
+CNSTI4 0
+RETI4
+ADDRGP4 $440
+JUMPV
+LABELV $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $444
+CNSTI4 0
+RETI4
+ADDRGP4 $440
+JUMPV
+LABELV $444
+ADDRLP4 36
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+GTI4 $446
+CNSTI4 0
+RETI4
+ADDRGP4 $440
+JUMPV
+LABELV $446
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 28
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 40
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $448
+CNSTI4 0
+RETI4
+ADDRGP4 $440
+JUMPV
+LABELV $448
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $450
+CNSTI4 0
+RETI4
+ADDRGP4 $440
+JUMPV
+LABELV $450
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $452
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $455
+CNSTI4 0
+RETI4
+ADDRGP4 $440
+JUMPV
+LABELV $455
+LABELV $452
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $457
+CNSTI4 0
+RETI4
+ADDRGP4 $440
+JUMPV
+LABELV $457
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $459
+CNSTI4 0
+RETI4
+ADDRGP4 $440
+JUMPV
+LABELV $459
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $461
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRGP4 $462
+JUMPV
+LABELV $461
+ADDRLP4 0
+ARGP4
+ADDRGP4 $463
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $462
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $464
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $440
+endproc BotChat_EnemySuicide 56 16
+export BotChat_HitTalking
+proc BotChat_HitTalking 68 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $466
+CNSTI4 0
+RETI4
+ADDRGP4 $465
+JUMPV
+LABELV $466
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $469
+CNSTI4 0
+RETI4
+ADDRGP4 $465
+JUMPV
+LABELV $469
+ADDRLP4 44
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 1
+GTI4 $471
+CNSTI4 0
+RETI4
+ADDRGP4 $465
+JUMPV
+LABELV $471
+ADDRLP4 0
+CNSTI4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $474
+CNSTI4 0
+RETI4
+ADDRGP4 $465
+JUMPV
+LABELV $474
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $476
+CNSTI4 0
+RETI4
+ADDRGP4 $465
+JUMPV
+LABELV $476
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $480
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $478
+LABELV $480
+CNSTI4 0
+RETI4
+ADDRGP4 $465
+JUMPV
+LABELV $478
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 31
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 52
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 56
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $481
+CNSTI4 0
+RETI4
+ADDRGP4 $465
+JUMPV
+LABELV $481
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $483
+CNSTI4 0
+RETI4
+ADDRGP4 $465
+JUMPV
+LABELV $483
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $485
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+ADDRLP4 40
+INDIRF4
+MULF4
+LEF4 $488
+CNSTI4 0
+RETI4
+ADDRGP4 $465
+JUMPV
+LABELV $488
+LABELV $485
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+NEI4 $490
+CNSTI4 0
+RETI4
+ADDRGP4 $465
+JUMPV
+LABELV $490
+CNSTI4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 64
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $494
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $465
+endproc BotChat_HitTalking 68 20
+export BotChat_HitNoDeath
+proc BotChat_HitNoDeath 216 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $497
+CNSTI4 0
+RETI4
+ADDRGP4 $495
+JUMPV
+LABELV $497
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $499
+CNSTI4 0
+RETI4
+ADDRGP4 $495
+JUMPV
+LABELV $499
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $503
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $501
+LABELV $503
+CNSTI4 0
+RETI4
+ADDRGP4 $495
+JUMPV
+LABELV $501
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $504
+CNSTI4 0
+RETI4
+ADDRGP4 $495
+JUMPV
+LABELV $504
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $507
+CNSTI4 0
+RETI4
+ADDRGP4 $495
+JUMPV
+LABELV $507
+ADDRLP4 188
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 1
+GTI4 $509
+CNSTI4 0
+RETI4
+ADDRGP4 $495
+JUMPV
+LABELV $509
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 192
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 180
+ADDRLP4 192
+INDIRF4
+ASGNF4
+ADDRLP4 196
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $511
+CNSTI4 0
+RETI4
+ADDRGP4 $495
+JUMPV
+LABELV $511
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $513
+CNSTI4 0
+RETI4
+ADDRGP4 $495
+JUMPV
+LABELV $513
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $515
+ADDRLP4 200
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+ADDRLP4 180
+INDIRF4
+MULF4
+LEF4 $518
+CNSTI4 0
+RETI4
+ADDRGP4 $495
+JUMPV
+LABELV $518
+LABELV $515
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+NEI4 $520
+CNSTI4 0
+RETI4
+ADDRGP4 $495
+JUMPV
+LABELV $520
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 204
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $522
+CNSTI4 0
+RETI4
+ADDRGP4 $495
+JUMPV
+LABELV $522
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 40
+ARGP4
+ADDRLP4 208
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $524
+CNSTI4 0
+RETI4
+ADDRGP4 $495
+JUMPV
+LABELV $524
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 212
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 212
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $527
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $495
+endproc BotChat_HitNoDeath 216 20
+export BotChat_HitNoKill
+proc BotChat_HitNoKill 208 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $529
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $529
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $532
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $532
+ADDRLP4 180
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 1
+GTI4 $534
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $534
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 33
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 184
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 184
+INDIRF4
+ASGNF4
+ADDRLP4 188
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $536
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $536
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $538
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $538
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $540
+ADDRLP4 192
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+ADDRLP4 176
+INDIRF4
+MULF4
+LEF4 $543
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $543
+LABELV $540
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $545
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $545
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $547
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $547
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 36
+ARGP4
+ADDRLP4 200
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $549
+CNSTI4 0
+RETI4
+ADDRGP4 $528
+JUMPV
+LABELV $549
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 728
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 204
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRLP4 32
+ADDRLP4 204
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $552
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $528
+endproc BotChat_HitNoKill 208 20
+export BotChat_Random
+proc BotChat_Random 96 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+EQI4 $554
+CNSTI4 0
+RETI4
+ADDRGP4 $553
+JUMPV
+LABELV $554
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $557
+CNSTI4 0
+RETI4
+ADDRGP4 $553
+JUMPV
+LABELV $557
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1103626240
+SUBF4
+LEF4 $559
+CNSTI4 0
+RETI4
+ADDRGP4 $553
+JUMPV
+LABELV $559
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+NEI4 $561
+CNSTI4 0
+RETI4
+ADDRGP4 $553
+JUMPV
+LABELV $561
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+EQI4 $566
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+EQI4 $566
+ADDRLP4 40
+INDIRI4
+CNSTI4 5
+NEI4 $563
+LABELV $566
+CNSTI4 0
+RETI4
+ADDRGP4 $553
+JUMPV
+LABELV $563
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 34
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 44
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1036831949
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+LEF4 $567
+CNSTI4 0
+RETI4
+ADDRGP4 $553
+JUMPV
+LABELV $567
+ADDRGP4 bot_fastchat+12
+INDIRI4
+CNSTI4 0
+NEI4 $569
+ADDRLP4 52
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 32
+INDIRF4
+LEF4 $572
+CNSTI4 0
+RETI4
+ADDRGP4 $553
+JUMPV
+LABELV $572
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1048576000
+LEF4 $574
+CNSTI4 0
+RETI4
+ADDRGP4 $553
+JUMPV
+LABELV $574
+LABELV $569
+ADDRLP4 52
+ADDRGP4 BotNumActivePlayers
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+GTI4 $576
+CNSTI4 0
+RETI4
+ADDRGP4 $553
+JUMPV
+LABELV $576
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $578
+CNSTI4 0
+RETI4
+ADDRGP4 $553
+JUMPV
+LABELV $578
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotVisibleEnemies
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $580
+CNSTI4 0
+RETI4
+ADDRGP4 $553
+JUMPV
+LABELV $580
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $582
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $583
+JUMPV
+LABELV $582
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+LABELV $583
+ADDRLP4 68
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $584
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $298
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $553
+JUMPV
+LABELV $584
+ADDRLP4 72
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 25
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 76
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 72
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 76
+INDIRF4
+GEF4 $586
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRLP4 88
+ADDRGP4 BotRandomWeaponName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $588
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 92
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $587
+JUMPV
+LABELV $586
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRLP4 88
+ADDRGP4 BotRandomWeaponName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $589
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 92
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $587
+ADDRFP4 0
+INDIRP4
+CNSTI4 6100
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $553
+endproc BotChat_Random 96 36
+export BotChatTime
+proc BotChatTime 8 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 23
+ARGI4
+CNSTI4 1
+ARGI4
+CNSTI4 4000
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_Characteristic_BInteger
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTF4 1073741824
+RETF4
+LABELV $590
+endproc BotChatTime 8 16
+export BotChatTest
+proc BotChatTest 184 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $595
+JUMPV
+LABELV $592
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 48
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRLP4 64
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $593
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $595
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $592
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $287
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $599
+JUMPV
+LABELV $596
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 52
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $287
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $597
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $599
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $596
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $308
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $603
+JUMPV
+LABELV $600
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 56
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $308
+ARGP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $601
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $603
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $600
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $332
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $607
+JUMPV
+LABELV $604
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 60
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 68
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $332
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $605
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $607
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $604
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $335
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $608
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 64
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $335
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $609
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $611
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $608
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $615
+JUMPV
+LABELV $612
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 68
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 76
+ADDRGP4 BotFirstClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 80
+ADDRGP4 BotLastClientInRankings
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $336
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $613
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $615
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $612
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $364
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $619
+JUMPV
+LABELV $616
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $364
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $617
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $619
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $616
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $367
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $623
+JUMPV
+LABELV $620
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $367
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRLP4 76
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $621
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $623
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $620
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $370
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $627
+JUMPV
+LABELV $624
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $370
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRLP4 80
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $625
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $627
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $624
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $373
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $631
+JUMPV
+LABELV $628
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $373
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 84
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRLP4 84
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $629
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $631
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $628
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 84
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $635
+JUMPV
+LABELV $632
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRLP4 88
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $633
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $635
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $632
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $384
+ARGP4
+ADDRLP4 88
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $639
+JUMPV
+LABELV $636
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $384
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRLP4 92
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $637
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $639
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $636
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $392
+ARGP4
+ADDRLP4 92
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $643
+JUMPV
+LABELV $640
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $392
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $641
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $643
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $640
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $395
+ARGP4
+ADDRLP4 96
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $647
+JUMPV
+LABELV $644
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 100
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $395
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+CNSTI4 0
+ASGNI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRLP4 104
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $645
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $647
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $644
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $396
+ARGP4
+ADDRLP4 100
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $651
+JUMPV
+LABELV $648
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $396
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+CNSTI4 0
+ASGNI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRLP4 108
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $649
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $651
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $648
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $399
+ARGP4
+ADDRLP4 104
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $655
+JUMPV
+LABELV $652
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $399
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRLP4 112
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $653
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $655
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $652
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $400
+ARGP4
+ADDRLP4 108
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $659
+JUMPV
+LABELV $656
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 112
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $400
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 112
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $657
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $659
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $656
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $429
+ARGP4
+ADDRLP4 112
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $663
+JUMPV
+LABELV $660
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $429
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $661
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $663
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $660
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $432
+ARGP4
+ADDRLP4 116
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $667
+JUMPV
+LABELV $664
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $432
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 120
+CNSTI4 0
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $665
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $667
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $664
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $435
+ARGP4
+ADDRLP4 120
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $671
+JUMPV
+LABELV $668
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $435
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $669
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $671
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $668
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $438
+ARGP4
+ADDRLP4 124
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 124
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $675
+JUMPV
+LABELV $672
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $438
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRLP4 128
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $673
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $675
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $672
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $439
+ARGP4
+ADDRLP4 128
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $679
+JUMPV
+LABELV $676
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $439
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $677
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $679
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $676
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $464
+ARGP4
+ADDRLP4 132
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $683
+JUMPV
+LABELV $680
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $464
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRLP4 136
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $681
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $683
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $680
+CNSTI4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 808
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 724
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ADDRGP4 BotWeaponNameForMeansOfDeath
+CALLP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 136
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $494
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $689
+JUMPV
+LABELV $686
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $494
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $687
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $689
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $686
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $527
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $693
+JUMPV
+LABELV $690
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $527
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRLP4 148
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $691
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $693
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $690
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $552
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $697
+JUMPV
+LABELV $694
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $552
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $695
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $697
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $694
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $698
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $699
+JUMPV
+LABELV $698
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+LABELV $699
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $588
+ARGP4
+ADDRLP4 156
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $703
+JUMPV
+LABELV $700
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 164
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRLP4 168
+ADDRGP4 BotRandomWeaponName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $588
+ARGP4
+ADDRLP4 160
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 172
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+CNSTI4 0
+ASGNI4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRLP4 176
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $701
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $703
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $700
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $589
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_BotNumInitialChats
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $707
+JUMPV
+LABELV $704
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotRandomOpponentName
+CALLP4
+ASGNP4
+ADDRLP4 168
+ADDRGP4 BotMapTitle
+CALLP4
+ASGNP4
+ADDRLP4 172
+ADDRGP4 BotRandomWeaponName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $589
+ARGP4
+ADDRLP4 164
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 176
+ADDRGP4 $269
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 176
+INDIRP4
+ARGP4
+ADDRLP4 168
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 180
+CNSTI4 0
+ASGNI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRLP4 180
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $705
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $707
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $704
+LABELV $591
+endproc BotChatTest 184 36
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import DeathmatchScoreboardMessage
+import G_SetStats
+import MoveClientToIntermission
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import G_RunMissile
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $589
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $588
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 0
+align 1
+LABELV $552
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $527
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $494
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $464
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $463
+byte 1 0
+align 1
+LABELV $439
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $438
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $435
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $432
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $429
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $424
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $400
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $399
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $396
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 98
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $395
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 0
+align 1
+LABELV $392
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $384
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $381
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 105
+byte 1 99
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $373
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 99
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $370
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 108
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 0
+align 1
+LABELV $367
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $364
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $359
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $354
+byte 1 91
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 93
+byte 1 0
+align 1
+LABELV $336
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $335
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $332
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 0
+align 1
+LABELV $308
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $298
+byte 1 118
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $287
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 101
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $269
+byte 1 91
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 93
+byte 1 0
+align 1
+LABELV $268
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $195
+byte 1 91
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 93
+byte 1 0
+align 1
+LABELV $194
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $192
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 49
+byte 1 48
+byte 1 75
+byte 1 0
+align 1
+LABELV $190
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $188
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $186
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $184
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $182
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $180
+byte 1 77
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $178
+byte 1 71
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $176
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $170
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $69
+byte 1 116
+byte 1 0
+align 1
+LABELV $65
+byte 1 110
+byte 1 0
+align 1
+LABELV $58
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
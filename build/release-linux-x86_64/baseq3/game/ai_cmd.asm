@@ -0,0 +1,8877 @@
+export BotGetItemTeamGoal
+code
+proc BotGetItemTeamGoal 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $55
+CNSTI4 0
+RETI4
+ADDRGP4 $54
+JUMPV
+LABELV $55
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+LABELV $57
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $60
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $62
+ADDRGP4 $58
+JUMPV
+LABELV $62
+CNSTI4 1
+RETI4
+ADDRGP4 $54
+JUMPV
+LABELV $60
+LABELV $58
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $57
+CNSTI4 0
+RETI4
+LABELV $54
+endproc BotGetItemTeamGoal 12 12
+export BotGetMessageTeamGoal
+proc BotGetMessageTeamGoal 12 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotGetItemTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $65
+CNSTI4 1
+RETI4
+ADDRGP4 $64
+JUMPV
+LABELV $65
+ADDRFP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotFindWayPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $67
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $64
+JUMPV
+LABELV $67
+CNSTI4 0
+RETI4
+LABELV $64
+endproc BotGetMessageTeamGoal 12 12
+export BotGetTime
+proc BotGetTime 600 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $70
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 256
+ARGP4
+CNSTU4 8
+ARGU4
+ADDRLP4 588
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 588
+INDIRI4
+CNSTI4 0
+EQI4 $72
+ADDRLP4 256+256
+INDIRI4
+CNSTI4 107
+NEI4 $74
+ADDRLP4 584
+CNSTF4 1287568416
+ASGNF4
+ADDRGP4 $75
+JUMPV
+LABELV $74
+ADDRLP4 256+256
+INDIRI4
+CNSTI4 109
+NEI4 $77
+ADDRLP4 584
+CNSTF4 1142292480
+ASGNF4
+ADDRGP4 $78
+JUMPV
+LABELV $77
+ADDRLP4 256+256
+INDIRI4
+CNSTI4 108
+NEI4 $80
+ADDRLP4 584
+CNSTF4 1155596288
+ASGNF4
+ADDRGP4 $81
+JUMPV
+LABELV $80
+ADDRLP4 256
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 256+256
+INDIRI4
+CNSTI4 105
+NEI4 $83
+ADDRLP4 0
+ARGP4
+ADDRLP4 592
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 584
+CNSTF4 1114636288
+ADDRLP4 592
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $84
+JUMPV
+LABELV $83
+ADDRLP4 256+256
+INDIRI4
+CNSTI4 106
+NEI4 $86
+ADDRLP4 0
+ARGP4
+ADDRLP4 596
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 584
+ADDRLP4 596
+INDIRF4
+ASGNF4
+ADDRGP4 $87
+JUMPV
+LABELV $86
+ADDRLP4 584
+CNSTF4 0
+ASGNF4
+LABELV $87
+LABELV $84
+LABELV $81
+LABELV $78
+LABELV $75
+ADDRLP4 584
+INDIRF4
+CNSTF4 0
+LEF4 $89
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 584
+INDIRF4
+ADDF4
+RETF4
+ADDRGP4 $69
+JUMPV
+LABELV $89
+LABELV $72
+LABELV $70
+CNSTF4 0
+RETF4
+LABELV $69
+endproc BotGetTime 600 16
+bss
+align 4
+LABELV $92
+skip 4
+export FindClientByName
+code
+proc FindClientByName 1040 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $92
+INDIRI4
+CNSTI4 0
+NEI4 $93
+ADDRGP4 $95
+ARGP4
+ADDRLP4 1028
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $92
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+LABELV $93
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $99
+JUMPV
+LABELV $96
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $100
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $91
+JUMPV
+LABELV $100
+LABELV $97
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $99
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $92
+INDIRI4
+GEI4 $102
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $96
+LABELV $102
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $103
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $107
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $91
+JUMPV
+LABELV $107
+LABELV $104
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $106
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $92
+INDIRI4
+GEI4 $109
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $103
+LABELV $109
+CNSTI4 -1
+RETI4
+LABELV $91
+endproc FindClientByName 1040 12
+bss
+align 4
+LABELV $111
+skip 4
+export FindEnemyByName
+code
+proc FindEnemyByName 1044 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $111
+INDIRI4
+CNSTI4 0
+NEI4 $112
+ADDRGP4 $95
+ARGP4
+ADDRLP4 1028
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $111
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+LABELV $112
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $117
+JUMPV
+LABELV $114
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1032
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+EQI4 $118
+ADDRGP4 $115
+JUMPV
+LABELV $118
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $120
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $110
+JUMPV
+LABELV $120
+LABELV $115
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $117
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $111
+INDIRI4
+GEI4 $122
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $114
+LABELV $122
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $126
+JUMPV
+LABELV $123
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1036
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+EQI4 $127
+ADDRGP4 $124
+JUMPV
+LABELV $127
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $129
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $110
+JUMPV
+LABELV $129
+LABELV $124
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $126
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $111
+INDIRI4
+GEI4 $131
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $123
+LABELV $131
+CNSTI4 -1
+RETI4
+LABELV $110
+endproc FindEnemyByName 1044 12
+bss
+align 4
+LABELV $133
+skip 4
+export NumPlayersOnSameTeam
+code
+proc NumPlayersOnSameTeam 1048 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $133
+INDIRI4
+CNSTI4 0
+NEI4 $134
+ADDRGP4 $95
+ARGP4
+ADDRLP4 1032
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $133
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+LABELV $134
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRGP4 $139
+JUMPV
+LABELV $136
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $140
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1044
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $142
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $142
+LABELV $140
+LABELV $137
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $139
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $133
+INDIRI4
+GEI4 $144
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $136
+LABELV $144
+ADDRLP4 1028
+INDIRI4
+RETI4
+LABELV $132
+endproc NumPlayersOnSameTeam 1048 12
+export BotGetPatrolWaypoints
+proc BotGetPatrolWaypoints 680 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 592
+CNSTP4 0
+ASGNP4
+ADDRLP4 652
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRGP4 $147
+JUMPV
+LABELV $146
+ADDRLP4 8
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTU4 64
+ARGU4
+ADDRLP4 656
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+NEI4 $149
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $151
+ARGP4
+ADDRGP4 trap_EA_SayTeam
+CALLV
+pop
+ADDRLP4 592
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 9076
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 0
+RETI4
+ADDRGP4 $145
+JUMPV
+LABELV $149
+ADDRLP4 264
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 596
+ARGP4
+ADDRLP4 660
+ADDRGP4 BotGetMessageTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 0
+NEI4 $152
+ADDRLP4 592
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 9076
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 0
+RETI4
+ADDRGP4 $145
+JUMPV
+LABELV $152
+ADDRLP4 8
+ARGP4
+ADDRLP4 596
+ARGP4
+ADDRLP4 596+12
+INDIRI4
+ARGI4
+ADDRLP4 664
+ADDRGP4 BotCreateWayPoint
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 664
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $155
+ADDRGP4 $148
+JUMPV
+LABELV $155
+ADDRLP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRLP4 592
+INDIRP4
+ASGNP4
+ADDRGP4 $160
+JUMPV
+LABELV $157
+LABELV $158
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $160
+ADDRLP4 672
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 672
+INDIRU4
+EQU4 $161
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 672
+INDIRU4
+NEU4 $157
+LABELV $161
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $162
+ADDRLP4 592
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $163
+JUMPV
+LABELV $162
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $163
+ADDRLP4 264+260
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $164
+ADDRLP4 652
+CNSTI4 1
+ASGNI4
+ADDRGP4 $148
+JUMPV
+LABELV $164
+ADDRLP4 264+260
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $167
+ADDRLP4 652
+CNSTI4 2
+ASGNI4
+ADDRGP4 $148
+JUMPV
+LABELV $167
+ADDRLP4 264+260
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $148
+ADDRLP4 264
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+LABELV $171
+LABELV $147
+ADDRGP4 $146
+JUMPV
+LABELV $148
+ADDRLP4 660
+CNSTU4 0
+ASGNU4
+ADDRLP4 592
+INDIRP4
+CVPU4 4
+ADDRLP4 660
+INDIRU4
+EQU4 $175
+ADDRLP4 592
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 660
+INDIRU4
+NEU4 $173
+LABELV $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $176
+ARGP4
+ADDRGP4 trap_EA_SayTeam
+CALLV
+pop
+ADDRLP4 592
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRLP4 592
+CNSTP4 0
+ASGNP4
+CNSTI4 0
+RETI4
+ADDRGP4 $145
+JUMPV
+LABELV $173
+ADDRFP4 0
+INDIRP4
+CNSTI4 9076
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 9076
+ADDP4
+ADDRLP4 592
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9076
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9084
+ADDP4
+ADDRLP4 652
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $145
+endproc BotGetPatrolWaypoints 680 16
+export BotAddressedToBot
+proc BotAddressedToBot 1572 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 840
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 840
+ARGP4
+ADDRLP4 1228
+ADDRGP4 ClientOnSameTeamFromName
+CALLI4
+ASGNI4
+ADDRLP4 1096
+ADDRLP4 1228
+INDIRI4
+ASGNI4
+ADDRLP4 1096
+INDIRI4
+CNSTI4 0
+GEI4 $178
+CNSTI4 0
+RETI4
+ADDRGP4 $177
+JUMPV
+LABELV $178
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $180
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 584
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1100
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 $183
+JUMPV
+LABELV $182
+ADDRLP4 0+256
+INDIRI4
+CNSTI4 101
+NEI4 $185
+CNSTI4 1
+RETI4
+ADDRGP4 $177
+JUMPV
+LABELV $185
+ADDRLP4 0+256
+INDIRI4
+CNSTI4 102
+NEI4 $188
+ADDRLP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 328
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 328
+ARGP4
+ADDRLP4 1232
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+EQI4 $191
+ADDRLP4 1100
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRLP4 1236
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1236
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $193
+CNSTI4 1
+RETI4
+ADDRGP4 $177
+JUMPV
+LABELV $193
+ADDRFP4 0
+INDIRP4
+CNSTI4 6980
+ADDP4
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRLP4 1240
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1240
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $195
+CNSTI4 1
+RETI4
+ADDRGP4 $177
+JUMPV
+LABELV $195
+LABELV $191
+ADDRLP4 0
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 584
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRLP4 0
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 328
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 328
+ARGP4
+ADDRLP4 1232
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+EQI4 $184
+ADDRLP4 1100
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRLP4 1236
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1236
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $199
+CNSTI4 1
+RETI4
+ADDRGP4 $177
+JUMPV
+LABELV $199
+ADDRFP4 0
+INDIRP4
+CNSTI4 6980
+ADDP4
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRLP4 1240
+ADDRGP4 stristr
+CALLP4
+ASGNP4
+ADDRLP4 1240
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $184
+CNSTI4 1
+RETI4
+ADDRGP4 $177
+JUMPV
+LABELV $189
+LABELV $183
+ADDRLP4 584
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 32
+ARGU4
+ADDRLP4 1232
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 1232
+INDIRI4
+CNSTI4 0
+NEI4 $182
+LABELV $184
+CNSTI4 0
+RETI4
+ADDRGP4 $177
+JUMPV
+LABELV $180
+ADDRLP4 1232+256
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1232
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 1560
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 1560
+INDIRI4
+CNSTI4 0
+EQI4 $207
+ADDRLP4 1232+256
+INDIRI4
+CNSTI4 202
+EQI4 $204
+LABELV $207
+ADDRLP4 1564
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1568
+ADDRGP4 NumPlayersOnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1564
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1065353216
+ADDRLP4 1568
+INDIRI4
+CNSTI4 1
+SUBI4
+CVIF4 4
+DIVF4
+LEF4 $208
+CNSTI4 0
+RETI4
+ADDRGP4 $177
+JUMPV
+LABELV $208
+LABELV $204
+CNSTI4 1
+RETI4
+LABELV $177
+endproc BotAddressedToBot 1572 16
+export BotGPSToPosition
+proc BotGPSToPosition 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $211
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $216
+JUMPV
+LABELV $215
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $216
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $215
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $218
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $221
+JUMPV
+LABELV $218
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRGP4 $221
+JUMPV
+LABELV $220
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+LTI4 $223
+ADDRLP4 16
+INDIRI4
+CNSTI4 57
+GTI4 $223
+ADDRLP4 4
+CNSTI4 10
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDI4
+CNSTI4 48
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $224
+JUMPV
+LABELV $223
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $222
+JUMPV
+LABELV $224
+LABELV $221
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $220
+LABELV $222
+CNSTI4 1
+ARGI4
+ADDRGP4 $225
+ARGP4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+LABELV $212
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LTI4 $211
+CNSTI4 1
+RETI4
+LABELV $210
+endproc BotGPSToPosition 24 12
+export BotMatch_HelpAccompany
+proc BotMatch_HelpAccompany 1272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 1248
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 1248
+INDIRI4
+CNSTI4 0
+NEI4 $227
+ADDRGP4 $226
+JUMPV
+LABELV $227
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1252
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 1252
+INDIRI4
+CNSTI4 0
+NEI4 $229
+ADDRGP4 $226
+JUMPV
+LABELV $229
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 260
+ARGP4
+ADDRLP4 656
+ARGP4
+CNSTU4 16
+ARGU4
+ADDRLP4 1256
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 1256
+INDIRI4
+CNSTI4 0
+EQI4 $231
+ADDRLP4 656+256
+INDIRI4
+CNSTI4 100
+NEI4 $231
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1260
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRLP4 984
+CNSTI4 0
+ASGNI4
+ADDRGP4 $232
+JUMPV
+LABELV $231
+ADDRLP4 260
+ARGP4
+ADDRLP4 1260
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $234
+ADDRLP4 984
+CNSTI4 0
+ASGNI4
+ADDRGP4 $235
+JUMPV
+LABELV $234
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1264
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1264
+INDIRI4
+CNSTI4 0
+NEI4 $236
+ADDRGP4 $226
+JUMPV
+LABELV $236
+ADDRLP4 984
+CNSTI4 1
+ASGNI4
+LABELV $235
+LABELV $232
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $238
+ADDRLP4 984
+INDIRI4
+CNSTI4 0
+EQI4 $240
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $242
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $241
+JUMPV
+LABELV $240
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $242
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $241
+ADDRLP4 4
+ARGP4
+ADDRLP4 1260
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $226
+JUMPV
+LABELV $238
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $243
+ADDRGP4 $226
+JUMPV
+LABELV $243
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 516
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+EQI4 $245
+ADDRLP4 516+24
+ARGP4
+ADDRLP4 1260
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 988
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRLP4 988
+INDIRI4
+CNSTI4 0
+EQI4 $248
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRLP4 988
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ADDRLP4 516+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $248
+LABELV $245
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $251
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $253
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 992
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 992
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRLP4 1264
+ADDRGP4 BotGetMessageTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 1264
+INDIRI4
+CNSTI4 0
+NEI4 $255
+ADDRGP4 $226
+JUMPV
+LABELV $255
+LABELV $253
+LABELV $251
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $257
+ADDRLP4 984
+INDIRI4
+CNSTI4 0
+EQI4 $259
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $261
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $260
+JUMPV
+LABELV $259
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $262
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $260
+ADDRLP4 4
+ARGP4
+ADDRLP4 1260
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $226
+JUMPV
+LABELV $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1260
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1260
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 1264
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 1264
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1268
+ADDRGP4 BotGetTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRLP4 1268
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $263
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $264
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRGP4 $264
+JUMPV
+LABELV $263
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $267
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+LABELV $267
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+CNSTF4 1121976320
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $264
+LABELV $226
+endproc BotMatch_HelpAccompany 1272 16
+export BotMatch_DefendKeyArea
+proc BotMatch_DefendKeyArea 544 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 516
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $270
+ADDRGP4 $269
+JUMPV
+LABELV $270
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $272
+ADDRGP4 $269
+JUMPV
+LABELV $272
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRLP4 528
+ADDRGP4 BotGetMessageTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $274
+ADDRGP4 $269
+JUMPV
+LABELV $274
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 256
+ARGP4
+ADDRLP4 532
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 512
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 536
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 536
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 540
+ADDRGP4 BotGetTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRLP4 540
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $276
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+LABELV $276
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $269
+endproc BotMatch_DefendKeyArea 544 16
+export BotMatch_GetItem
+proc BotMatch_GetItem 540 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 516
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $279
+ADDRGP4 $278
+JUMPV
+LABELV $279
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $281
+ADDRGP4 $278
+JUMPV
+LABELV $281
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRLP4 528
+ADDRGP4 BotGetMessageTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 528
+INDIRI4
+CNSTI4 0
+NEI4 $283
+ADDRGP4 $278
+JUMPV
+LABELV $283
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 532
+ADDRGP4 ClientOnSameTeamFromName
+CALLI4
+ASGNI4
+ADDRLP4 512
+ADDRLP4 532
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 512
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 536
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 536
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $278
+endproc BotMatch_GetItem 540 16
+export BotMatch_Camp
+proc BotMatch_Camp 688 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 660
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 0
+NEI4 $286
+ADDRGP4 $285
+JUMPV
+LABELV $286
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 664
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 664
+INDIRI4
+CNSTI4 0
+NEI4 $288
+ADDRGP4 $285
+JUMPV
+LABELV $288
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 668
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 668
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $290
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $242
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $285
+JUMPV
+LABELV $290
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $292
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRGP4 $293
+JUMPV
+LABELV $292
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $294
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $296
+ADDRGP4 $285
+JUMPV
+LABELV $296
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 516
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+EQI4 $298
+ADDRLP4 516+24
+ARGP4
+ADDRLP4 672
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 656
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+EQI4 $301
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRLP4 656
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ADDRLP4 516+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $301
+LABELV $298
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $295
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $262
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 672
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $285
+JUMPV
+LABELV $294
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRLP4 676
+ADDRGP4 BotGetMessageTeamGoal
+CALLI4
+ASGNI4
+ADDRLP4 676
+INDIRI4
+CNSTI4 0
+NEI4 $306
+ADDRGP4 $285
+JUMPV
+LABELV $306
+LABELV $295
+LABELV $293
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 680
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 680
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 684
+ADDRGP4 BotGetTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRLP4 684
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+LABELV $308
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $285
+endproc BotMatch_Camp 688 16
+export BotMatch_Patrol
+proc BotMatch_Patrol 284 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $311
+ADDRGP4 $310
+JUMPV
+LABELV $311
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $313
+ADDRGP4 $310
+JUMPV
+LABELV $313
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotGetPatrolWaypoints
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+NEI4 $315
+ADDRGP4 $310
+JUMPV
+LABELV $315
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 272
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 276
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 276
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotGetTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $317
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+LABELV $317
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $310
+endproc BotMatch_Patrol 284 16
+export BotMatch_GetFlag
+proc BotMatch_GetFlag 276 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $319
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 260
+INDIRI4
+EQI4 $326
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 260
+INDIRI4
+NEI4 $321
+LABELV $326
+ADDRGP4 $319
+JUMPV
+LABELV $321
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $327
+ADDRGP4 $319
+JUMPV
+LABELV $327
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 268
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 268
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $329
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+LABELV $329
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $319
+endproc BotMatch_GetFlag 276 16
+export BotMatch_AttackEnemyBase
+proc BotMatch_AttackEnemyBase 272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $331
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotMatch_GetFlag
+CALLV
+pop
+LABELV $333
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $334
+ADDRGP4 $331
+JUMPV
+LABELV $334
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 268
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 268
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 13
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6156
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRememberLastOrderedTask
+CALLV
+pop
+LABELV $331
+endproc BotMatch_AttackEnemyBase 272 16
+export BotMatch_RushBase
+proc BotMatch_RushBase 272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $336
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 260
+INDIRI4
+EQI4 $343
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 260
+INDIRI4
+NEI4 $338
+LABELV $343
+ADDRGP4 $336
+JUMPV
+LABELV $338
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $344
+ADDRGP4 $336
+JUMPV
+LABELV $344
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 268
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 268
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $336
+endproc BotMatch_RushBase 272 16
+export BotMatch_TaskPreference
+proc BotMatch_TaskPreference 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $347
+ADDRGP4 $346
+JUMPV
+LABELV $347
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 304
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 304
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $349
+ADDRGP4 $346
+JUMPV
+LABELV $349
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotGetTeamMateTaskPreference
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 312
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 1
+EQI4 $354
+ADDRLP4 312
+INDIRI4
+CNSTI4 2
+EQI4 $355
+ADDRLP4 312
+INDIRI4
+CNSTI4 4
+EQI4 $356
+ADDRGP4 $351
+JUMPV
+LABELV $354
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $352
+JUMPV
+LABELV $355
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 $352
+JUMPV
+LABELV $356
+ADDRLP4 296
+ADDRLP4 296
+INDIRI4
+CNSTI4 -4
+BANDI4
+ASGNI4
+LABELV $351
+LABELV $352
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSetTeamMateTaskPreference
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $357
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $358
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+LABELV $346
+endproc BotMatch_TaskPreference 320 16
+export BotMatch_ReturnFlag
+proc BotMatch_ReturnFlag 272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+EQI4 $360
+ADDRGP4 $359
+JUMPV
+LABELV $360
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $362
+ADDRGP4 $359
+JUMPV
+LABELV $362
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 268
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 268
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $359
+endproc BotMatch_ReturnFlag 272 16
+export BotMatch_JoinSubteam
+proc BotMatch_JoinSubteam 528 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 516
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $365
+ADDRGP4 $364
+JUMPV
+LABELV $365
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $367
+ADDRGP4 $364
+JUMPV
+LABELV $367
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6980
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7011
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $369
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRLP4 256
+ARGP4
+ADDRLP4 524
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 512
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 512
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $364
+endproc BotMatch_JoinSubteam 528 16
+export BotMatch_LeaveSubteam
+proc BotMatch_LeaveSubteam 280 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $371
+ADDRGP4 $370
+JUMPV
+LABELV $371
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $373
+ADDRGP4 $370
+JUMPV
+LABELV $373
+ADDRFP4 0
+INDIRP4
+CNSTI4 6980
+ADDP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $375
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $377
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6980
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 276
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $375
+ADDRFP4 0
+INDIRP4
+CNSTI4 6980
+ADDP4
+ARGP4
+ADDRGP4 $378
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $370
+endproc BotMatch_LeaveSubteam 280 16
+export BotMatch_WhichTeam
+proc BotMatch_WhichTeam 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $380
+ADDRGP4 $379
+JUMPV
+LABELV $380
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $382
+ADDRGP4 $379
+JUMPV
+LABELV $382
+ADDRFP4 0
+INDIRP4
+CNSTI4 6980
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $384
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $386
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6980
+ADDP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $385
+JUMPV
+LABELV $384
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $387
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $385
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $379
+endproc BotMatch_WhichTeam 16 16
+export BotMatch_CheckPoint
+proc BotMatch_CheckPoint 572 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 536
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 536
+INDIRI4
+CNSTI4 0
+NEI4 $389
+ADDRGP4 $388
+JUMPV
+LABELV $389
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 540
+CNSTF4 0
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 540
+INDIRF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 540
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 540
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 276
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 276
+ARGP4
+ADDRLP4 544
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 532
+ADDRLP4 544
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 $393
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 4+4
+ARGP4
+ADDRLP4 4+8
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 548
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 548
+INDIRI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+NEI4 $397
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 552
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 552
+INDIRI4
+CNSTI4 0
+EQI4 $388
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $401
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 532
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $388
+JUMPV
+LABELV $397
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 552
+ADDRGP4 BotFindWayPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 552
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $402
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $404
+ADDRLP4 560
+CNSTI4 96
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ADDRLP4 560
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 560
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $404
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $406
+ADDRLP4 568
+CNSTI4 92
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+ADDRLP4 568
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 568
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $407
+JUMPV
+LABELV $406
+ADDRFP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $407
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $402
+ADDRLP4 16
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 272
+INDIRI4
+ARGI4
+ADDRLP4 556
+ADDRGP4 BotCreateWayPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 556
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+INDIRP4
+CNSTI4 96
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 560
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 560
+INDIRI4
+CNSTI4 0
+EQI4 $410
+ADDRLP4 16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $412
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $413
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 532
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $410
+LABELV $388
+endproc BotMatch_CheckPoint 572 24
+export BotMatch_FormationSpace
+proc BotMatch_FormationSpace 280 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $415
+ADDRGP4 $414
+JUMPV
+LABELV $415
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $417
+ADDRGP4 $414
+JUMPV
+LABELV $417
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $419
+ADDRLP4 4
+ARGP4
+ADDRLP4 268
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1092357823
+ADDRLP4 268
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $420
+JUMPV
+LABELV $419
+ADDRLP4 4
+ARGP4
+ADDRLP4 272
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1107296256
+ADDRLP4 272
+INDIRF4
+MULF4
+ASGNF4
+LABELV $420
+ADDRLP4 0
+INDIRF4
+CNSTF4 1111490560
+LTF4 $423
+ADDRLP4 0
+INDIRF4
+CNSTF4 1140457472
+LEF4 $421
+LABELV $423
+ADDRLP4 0
+CNSTF4 1120403456
+ASGNF4
+LABELV $421
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+LABELV $414
+endproc BotMatch_FormationSpace 280 16
+export BotMatch_Dismiss
+proc BotMatch_Dismiss 272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $425
+ADDRGP4 $424
+JUMPV
+LABELV $425
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $427
+ADDRGP4 $424
+JUMPV
+LABELV $427
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRLP4 256
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6884
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $429
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $424
+endproc BotMatch_Dismiss 272 16
+export BotMatch_Suicide
+proc BotMatch_Suicide 272 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $431
+ADDRGP4 $430
+JUMPV
+LABELV $431
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+CNSTI4 0
+NEI4 $433
+ADDRGP4 $430
+JUMPV
+LABELV $433
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $435
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 268
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+ARGI4
+ADDRGP4 $436
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+LABELV $430
+endproc BotMatch_Suicide 272 16
+export BotMatch_StartTeamLeaderShip
+proc BotMatch_StartTeamLeaderShip 268 16
+ADDRLP4 260
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $438
+ADDRGP4 $437
+JUMPV
+LABELV $438
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $440
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+CNSTU4 31
+ADDI4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 264
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+LTI4 $442
+ADDRLP4 256
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+LABELV $442
+LABELV $441
+LABELV $437
+endproc BotMatch_StartTeamLeaderShip 268 16
+export BotMatch_StopTeamLeaderShip
+proc BotMatch_StopTeamLeaderShip 528 16
+ADDRLP4 516
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $445
+ADDRGP4 $444
+JUMPV
+LABELV $445
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $447
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 260
+ARGP4
+ADDRLP4 520
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 $448
+JUMPV
+LABELV $447
+ADDRLP4 4
+ARGP4
+ADDRLP4 520
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 520
+INDIRI4
+ASGNI4
+LABELV $448
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $449
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 520
+ADDRGP4 ClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 520
+INDIRP4
+ARGP4
+ADDRLP4 524
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+NEI4 $451
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 notleader
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $451
+LABELV $449
+LABELV $444
+endproc BotMatch_StopTeamLeaderShip 528 16
+export BotMatch_WhoIsTeamLeader
+proc BotMatch_WhoIsTeamLeader 264 12
+ADDRLP4 256
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+NEI4 $454
+ADDRGP4 $453
+JUMPV
+LABELV $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+NEI4 $456
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $458
+ARGP4
+ADDRGP4 trap_EA_SayTeam
+CALLV
+pop
+LABELV $456
+LABELV $453
+endproc BotMatch_WhoIsTeamLeader 264 12
+export BotMatch_WhatAreYouDoing
+proc BotMatch_WhatAreYouDoing 532 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 516
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $460
+ADDRGP4 $459
+JUMPV
+LABELV $460
+ADDRLP4 520
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 1
+LTI4 $462
+ADDRLP4 520
+INDIRI4
+CNSTI4 11
+GTI4 $462
+ADDRLP4 520
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $486-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $486
+address $465
+address $467
+address $469
+address $479
+address $481
+address $483
+address $475
+address $475
+address $477
+address $471
+address $473
+code
+LABELV $465
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $466
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $463
+JUMPV
+LABELV $467
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $468
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $463
+JUMPV
+LABELV $469
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $470
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $463
+JUMPV
+LABELV $471
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $463
+JUMPV
+LABELV $473
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $474
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $463
+JUMPV
+LABELV $475
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $476
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $463
+JUMPV
+LABELV $477
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $478
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $463
+JUMPV
+LABELV $479
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $480
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $463
+JUMPV
+LABELV $481
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $482
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $463
+JUMPV
+LABELV $483
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $484
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $463
+JUMPV
+LABELV $462
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $485
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $463
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 528
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 256
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $459
+endproc BotMatch_WhatAreYouDoing 532 16
+export BotMatch_WhatIsMyCommand
+proc BotMatch_WhatIsMyCommand 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRGP4 $488
+JUMPV
+LABELV $489
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $488
+endproc BotMatch_WhatIsMyCommand 40 12
+export BotNearestVisibleItem
+proc BotNearestVisibleItem 252 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 140
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 68
+CNSTI4 -1
+ASGNI4
+LABELV $492
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 228
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 228
+INDIRI4
+ASGNI4
+ADDRLP4 0+44
+INDIRI4
+ARGI4
+ADDRLP4 72
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 232
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+EQI4 $496
+ADDRGP4 $493
+JUMPV
+LABELV $496
+ADDRLP4 56
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 240
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 240
+INDIRF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ADDRLP4 140
+INDIRF4
+GEF4 $502
+ADDRLP4 144
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 248
+CNSTP4 0
+ASGNP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 248
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 144+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $504
+ADDRLP4 140
+ADDRLP4 136
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $504
+LABELV $502
+LABELV $493
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+GTI4 $492
+ADDRLP4 140
+INDIRF4
+RETF4
+LABELV $491
+endproc BotNearestVisibleItem 252 28
+lit
+align 4
+LABELV $508
+address $509
+address $510
+address $511
+address $512
+address $513
+address $514
+address $515
+address $516
+address $517
+address $518
+address $519
+address $520
+address $521
+address $522
+address $523
+address $524
+address $525
+byte 4 0
+export BotMatch_WhereAreYou
+code
+proc BotMatch_WhereAreYou 444 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRGP4 $508
+INDIRB
+ASGNB 72
+ADDRLP4 412
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 412
+INDIRI4
+CNSTI4 0
+NEI4 $526
+ADDRGP4 $507
+JUMPV
+LABELV $526
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 416
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+CNSTI4 0
+NEI4 $528
+ADDRGP4 $507
+JUMPV
+LABELV $528
+ADDRLP4 140
+CNSTI4 -1
+ASGNI4
+ADDRLP4 80
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $533
+JUMPV
+LABELV $530
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 420
+ADDRGP4 BotNearestVisibleItem
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 420
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+GEF4 $534
+ADDRLP4 80
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $534
+LABELV $531
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $533
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $530
+ADDRLP4 140
+INDIRI4
+CNSTI4 -1
+EQI4 $536
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $538
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 424
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 404
+ADDRLP4 424
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 432
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 408
+ADDRLP4 432
+INDIRI4
+ASGNI4
+ADDRLP4 436
+ADDRLP4 404
+INDIRI4
+ASGNI4
+ADDRLP4 436
+INDIRI4
+CVIF4 4
+CNSTF4 1053609165
+ADDRLP4 436
+INDIRI4
+ADDRLP4 408
+INDIRI4
+ADDI4
+CVIF4 4
+MULF4
+GEF4 $542
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $544
+ARGP4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $545
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $542
+ADDRLP4 440
+ADDRLP4 408
+INDIRI4
+ASGNI4
+ADDRLP4 440
+INDIRI4
+CVIF4 4
+CNSTF4 1053609165
+ADDRLP4 404
+INDIRI4
+ADDRLP4 440
+INDIRI4
+ADDI4
+CVIF4 4
+MULF4
+GEF4 $546
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $544
+ARGP4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $548
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $546
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $549
+ARGP4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $539
+JUMPV
+LABELV $538
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $549
+ARGP4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $539
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 144
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 144
+ARGP4
+ADDRLP4 420
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 400
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 400
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $536
+LABELV $507
+endproc BotMatch_WhereAreYou 444 20
+export BotMatch_LeadTheWay
+proc BotMatch_LeadTheWay 680 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 664
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 664
+INDIRI4
+CNSTI4 0
+NEI4 $551
+ADDRGP4 $550
+JUMPV
+LABELV $551
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 668
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 668
+INDIRI4
+CNSTI4 0
+NEI4 $553
+ADDRGP4 $550
+JUMPV
+LABELV $553
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $555
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 400
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 400
+ARGP4
+ADDRLP4 672
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $557
+ADDRLP4 656
+CNSTI4 0
+ASGNI4
+ADDRGP4 $556
+JUMPV
+LABELV $557
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 676
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 676
+INDIRI4
+CNSTI4 0
+NEI4 $559
+ADDRGP4 $550
+JUMPV
+LABELV $559
+ADDRLP4 656
+CNSTI4 1
+ASGNI4
+ADDRGP4 $556
+JUMPV
+LABELV $555
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 144
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 144
+ARGP4
+ADDRLP4 672
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRLP4 656
+CNSTI4 0
+ASGNI4
+LABELV $556
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $561
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $242
+ARGP4
+ADDRLP4 144
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $550
+JUMPV
+LABELV $561
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $563
+ADDRLP4 4+24
+ARGP4
+ADDRLP4 672
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 660
+ADDRLP4 672
+INDIRI4
+ASGNI4
+ADDRLP4 660
+INDIRI4
+CNSTI4 0
+EQI4 $566
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6840
+ADDP4
+ADDRLP4 660
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6828
+ADDP4
+ADDRLP4 4+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6856
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6864
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $566
+LABELV $563
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $569
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+EQI4 $571
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $261
+ARGP4
+ADDRLP4 400
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $572
+JUMPV
+LABELV $571
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $262
+ARGP4
+ADDRLP4 144
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $572
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $550
+JUMPV
+LABELV $569
+ADDRFP4 0
+INDIRP4
+CNSTI4 6824
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6884
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6888
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 672
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6892
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 672
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+NEGF4
+ASGNF4
+LABELV $550
+endproc BotMatch_LeadTheWay 680 16
+export BotMatch_Kill
+proc BotMatch_Kill 532 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 516
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $574
+ADDRGP4 $573
+JUMPV
+LABELV $574
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 520
+ADDRGP4 BotAddressedToBot
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $576
+ADDRGP4 $573
+JUMPV
+LABELV $576
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 524
+ADDRGP4 FindEnemyByName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 524
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $578
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $242
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 260
+ARGP4
+ADDRLP4 528
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 528
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRGP4 $573
+JUMPV
+LABELV $578
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 528
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 528
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $573
+endproc BotMatch_Kill 532 16
+export BotMatch_CTF
+proc BotMatch_CTF 176 16
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $581
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $583
+ADDRLP4 0
+ARGP4
+ADDRGP4 $545
+ARGP4
+ADDRLP4 164
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $585
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 2
+NEI4 $586
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 128
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 128
+ARGP4
+ADDRLP4 172
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+ADDRGP4 $586
+JUMPV
+LABELV $585
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 1
+NEI4 $589
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 128
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 128
+ARGP4
+ADDRLP4 172
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+ADDRLP4 172
+INDIRI4
+ASGNI4
+LABELV $589
+LABELV $586
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $584
+JUMPV
+LABELV $583
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $591
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $592
+JUMPV
+LABELV $591
+ADDRFP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $593
+ADDRLP4 0
+ARGP4
+ADDRGP4 $545
+ARGP4
+ADDRLP4 164
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+NEI4 $595
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $596
+JUMPV
+LABELV $595
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $596
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $593
+LABELV $592
+LABELV $584
+LABELV $581
+LABELV $580
+endproc BotMatch_CTF 176 16
+export BotMatch_EnterGame
+proc BotMatch_EnterGame 44 16
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $598
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 notleader
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $598
+LABELV $597
+endproc BotMatch_EnterGame 44 16
+export BotMatch_NewLeader
+proc BotMatch_NewLeader 48 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 FindClientByName
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $601
+ADDRGP4 $600
+JUMPV
+LABELV $601
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $600
+endproc BotMatch_NewLeader 48 16
+export BotMatchMessage
+proc BotMatchMessage 336 12
+ADDRLP4 0+256
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTU4 262
+ARGU4
+ADDRLP4 328
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+NEI4 $605
+CNSTI4 0
+RETI4
+ADDRGP4 $603
+JUMPV
+LABELV $605
+ADDRLP4 332
+ADDRLP4 0+256
+INDIRI4
+ASGNI4
+ADDRLP4 332
+INDIRI4
+CNSTI4 1
+LTI4 $607
+ADDRLP4 332
+INDIRI4
+CNSTI4 33
+GTI4 $643
+ADDRLP4 332
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $644-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $644
+address $639
+address $638
+address $610
+address $610
+address $611
+address $615
+address $614
+address $630
+address $631
+address $632
+address $608
+address $633
+address $620
+address $621
+address $624
+address $626
+address $627
+address $608
+address $629
+address $612
+address $623
+address $613
+address $636
+address $619
+address $637
+address $635
+address $616
+address $634
+address $622
+address $617
+address $607
+address $607
+address $641
+code
+LABELV $643
+ADDRLP4 0+256
+INDIRI4
+CNSTI4 300
+EQI4 $618
+ADDRGP4 $607
+JUMPV
+LABELV $610
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_HelpAccompany
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $611
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_DefendKeyArea
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $612
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_Camp
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $613
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_Patrol
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $614
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_GetFlag
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $615
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_RushBase
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $616
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_ReturnFlag
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $617
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_TaskPreference
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $618
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_CTF
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $619
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_GetItem
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $620
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_JoinSubteam
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $621
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_LeaveSubteam
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $622
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_WhichTeam
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $623
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_CheckPoint
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $624
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $625
+ARGP4
+ADDRGP4 trap_EA_SayTeam
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $626
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $625
+ARGP4
+ADDRGP4 trap_EA_SayTeam
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $627
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_FormationSpace
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $629
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_Dismiss
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $630
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_StartTeamLeaderShip
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $631
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_StopTeamLeaderShip
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $632
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_WhoIsTeamLeader
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $633
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_WhatAreYouDoing
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $634
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_WhatIsMyCommand
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $635
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_WhereAreYou
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $636
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_LeadTheWay
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $637
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_Kill
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $638
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_EnterGame
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $639
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_NewLeader
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $641
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotMatch_Suicide
+CALLV
+pop
+ADDRGP4 $608
+JUMPV
+LABELV $607
+CNSTI4 1
+ARGI4
+ADDRGP4 $642
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $608
+CNSTI4 1
+RETI4
+LABELV $603
+endproc BotMatchMessage 336 12
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+bss
+export notleader
+align 4
+LABELV notleader
+skip 256
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import DeathmatchScoreboardMessage
+import G_SetStats
+import MoveClientToIntermission
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import G_RunMissile
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $642
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $625
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $549
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $548
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $545
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $544
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $525
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $524
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $523
+byte 1 72
+byte 1 101
+byte 1 97
+byte 1 118
+byte 1 121
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $522
+byte 1 65
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $521
+byte 1 70
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $520
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $519
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $518
+byte 1 66
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $517
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $516
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $515
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 49
+byte 1 48
+byte 1 75
+byte 1 0
+align 1
+LABELV $514
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 71
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $513
+byte 1 82
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $512
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $511
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $510
+byte 1 71
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $509
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 103
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $485
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $484
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $482
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $480
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $478
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $476
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $474
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $472
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 0
+align 1
+LABELV $470
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $468
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $466
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $458
+byte 1 73
+byte 1 39
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $436
+byte 1 116
+byte 1 97
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $435
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $429
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $413
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 0
+align 1
+LABELV $412
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 48
+byte 1 102
+byte 1 0
+align 1
+LABELV $401
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $393
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $387
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $386
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $378
+byte 1 0
+align 1
+LABELV $377
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $369
+byte 1 106
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $358
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $357
+byte 1 107
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $262
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 0
+align 1
+LABELV $261
+byte 1 119
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 105
+byte 1 115
+byte 1 0
+align 1
+LABELV $242
+byte 1 119
+byte 1 104
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 0
+align 1
+LABELV $225
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $176
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $151
+byte 1 119
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 111
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 63
+byte 1 0
+align 1
+LABELV $95
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
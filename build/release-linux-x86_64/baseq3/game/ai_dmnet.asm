@@ -0,0 +1,15840 @@
+export BotResetNodeSwitches
+code
+proc BotResetNodeSwitches 0 0
+ADDRGP4 numnodeswitches
+CNSTI4 0
+ASGNI4
+LABELV $54
+endproc BotResetNodeSwitches 0 0
+export BotDumpNodeSwitches
+proc BotDumpNodeSwitches 40 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $56
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+CNSTI4 50
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $60
+JUMPV
+LABELV $57
+CNSTI4 1
+ARGI4
+ADDRGP4 $61
+ARGP4
+CNSTI4 144
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $58
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $60
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numnodeswitches
+INDIRI4
+LTI4 $57
+CNSTI4 4
+ARGI4
+ADDRGP4 $62
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $55
+endproc BotDumpNodeSwitches 40 20
+export BotRecordNodeSwitch
+proc BotRecordNodeSwitch 44 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 36
+CNSTI4 144
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 numnodeswitches
+INDIRI4
+MULI4
+ADDRGP4 nodeswitch
+ADDP4
+ARGP4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 $64
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 40
+ADDRGP4 numnodeswitches
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $63
+endproc BotRecordNodeSwitch 44 32
+lit
+align 4
+LABELV $66
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3221225472
+align 4
+LABELV $67
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1073741824
+export BotGetAirGoal
+code
+proc BotGetAirGoal 140 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ADDRGP4 $66
+INDIRB
+ASGNB 12
+ADDRLP4 108
+ADDRGP4 $67
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 0
+LEF4 $70
+ADDRLP4 12+12
+ARGP4
+ADDRLP4 132
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 132
+INDIRI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+CNSTI4 0
+EQI4 $74
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12+12
+INDIRB
+ASGNB 12
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 128
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $65
+JUMPV
+LABELV $74
+LABELV $70
+CNSTI4 0
+RETI4
+LABELV $65
+endproc BotGetAirGoal 140 28
+export BotGoForAir
+proc BotGoForAir 68 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6176
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+GEF4 $78
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotGetAirGoal
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $83
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotPushGoal
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $82
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $85
+CNSTI4 1
+RETI4
+ADDRGP4 $77
+JUMPV
+LABELV $85
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+LABELV $83
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 trap_BotChooseNBGItem
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $82
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+LABELV $78
+CNSTI4 0
+RETI4
+LABELV $77
+endproc BotGoForAir 68 24
+export BotNearbyGoal
+proc BotNearbyGoal 20 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 BotGoForAir
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $88
+CNSTI4 1
+RETI4
+ADDRGP4 $87
+JUMPV
+LABELV $88
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $90
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 16
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 300
+GEI4 $92
+ADDRFP4 12
+CNSTF4 1112014848
+ASGNF4
+LABELV $92
+LABELV $90
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 trap_BotChooseNBGItem
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $87
+endproc BotNearbyGoal 20 24
+export BotReachedGoal
+proc BotReachedGoal 40 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $95
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $97
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+NEI4 $99
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 3212836864
+ARGF4
+ADDRGP4 trap_BotSetAvoidGoalTime
+CALLV
+pop
+LABELV $99
+CNSTI4 1
+RETI4
+ADDRGP4 $94
+JUMPV
+LABELV $97
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_BotItemGoalInVisButNotVisible
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $101
+CNSTI4 1
+RETI4
+ADDRGP4 $94
+JUMPV
+LABELV $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $96
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $96
+ADDRLP4 12
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $96
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDF4
+LEF4 $96
+ADDRLP4 24
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDF4
+GEF4 $96
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $96
+CNSTI4 1
+RETI4
+ADDRGP4 $94
+JUMPV
+LABELV $95
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $111
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $113
+CNSTI4 1
+RETI4
+ADDRGP4 $94
+JUMPV
+LABELV $113
+ADDRFP4 0
+INDIRP4
+CNSTI4 6176
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+LEF4 $112
+CNSTI4 1
+RETI4
+ADDRGP4 $94
+JUMPV
+LABELV $111
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $117
+CNSTI4 1
+RETI4
+ADDRGP4 $94
+JUMPV
+LABELV $117
+LABELV $112
+LABELV $96
+CNSTI4 0
+RETI4
+LABELV $94
+endproc BotReachedGoal 40 16
+export BotGetItemLongTermGoal
+proc BotGetItemLongTermGoal 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $120
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $121
+JUMPV
+LABELV $120
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $122
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $122
+LABELV $121
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $124
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 trap_BotChooseLTGItem
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $126
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+ADDF4
+ASGNF4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+LABELV $127
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $119
+JUMPV
+LABELV $124
+CNSTI4 1
+RETI4
+LABELV $119
+endproc BotGetItemLongTermGoal 20 16
+export BotGetLongTermGoal
+proc BotGetLongTermGoal 664 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $129
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $129
+ADDRLP4 620
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 620
+INDIRF4
+CNSTF4 0
+EQF4 $131
+ADDRLP4 620
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $131
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 624
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $133
+ARGP4
+ADDRLP4 624
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $134
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $131
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $135
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $135
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $137
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $137
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 272
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 628
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 628
+INDIRF4
+CNSTF4 0
+EQF4 $139
+ADDRLP4 260
+ADDRLP4 272+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 272+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 272+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 636
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 636
+INDIRF4
+CNSTF4 1176256512
+GEF4 $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $139
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $140
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $150
+ADDRLP4 272+24
+ARGP4
+ADDRLP4 632
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 448
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRLP4 636
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 0
+EQI4 $153
+ADDRLP4 636
+INDIRI4
+ARGI4
+ADDRLP4 640
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+EQI4 $153
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ADDRLP4 272+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $153
+LABELV $150
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $129
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $156
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $156
+ADDRLP4 620
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 620
+INDIRF4
+CNSTF4 0
+EQF4 $158
+ADDRLP4 620
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $158
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 624
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $160
+ARGP4
+ADDRLP4 624
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $134
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $158
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $161
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 624
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $163
+ARGP4
+ADDRLP4 624
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $161
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 272
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 628
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 628
+INDIRF4
+CNSTF4 0
+EQF4 $164
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 260
+ADDRLP4 272+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 272+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 272+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 636
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 640
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+ADDRLP4 640
+INDIRF4
+MULF4
+GEF4 $173
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 452
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 452+24+8
+INDIRF4
+ADDRLP4 452+84+8
+INDIRF4
+ADDF4
+ADDRLP4 272+24+8
+INDIRF4
+ADDRLP4 272+72+8
+INDIRF4
+ADDF4
+LEF4 $175
+ADDRLP4 644
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 452+24
+INDIRF4
+ADDRLP4 452+84
+INDIRF4
+ADDF4
+ADDRLP4 272+24
+INDIRF4
+ADDRLP4 272+72
+INDIRF4
+ADDF4
+ADDRLP4 644
+INDIRF4
+SUBF4
+LEF4 $185
+ADDRLP4 452+24
+INDIRF4
+ADDRLP4 452+72
+INDIRF4
+ADDF4
+ADDRLP4 272+24
+INDIRF4
+ADDRLP4 272+84
+INDIRF4
+ADDF4
+ADDRLP4 644
+INDIRF4
+ADDF4
+GEF4 $185
+ADDRLP4 648
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 452+24+4
+INDIRF4
+ADDRLP4 452+84+4
+INDIRF4
+ADDF4
+ADDRLP4 272+24+4
+INDIRF4
+ADDRLP4 272+72+4
+INDIRF4
+ADDF4
+ADDRLP4 648
+INDIRF4
+SUBF4
+LEF4 $195
+ADDRLP4 452+24+4
+INDIRF4
+ADDRLP4 452+72+4
+INDIRF4
+ADDF4
+ADDRLP4 272+24+4
+INDIRF4
+ADDRLP4 272+84+4
+INDIRF4
+ADDF4
+ADDRLP4 648
+INDIRF4
+ADDF4
+GEF4 $195
+ADDRLP4 652
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 452+24+8
+INDIRF4
+ADDRLP4 452+84+8
+INDIRF4
+ADDF4
+ADDRLP4 272+24+8
+INDIRF4
+ADDRLP4 272+72+8
+INDIRF4
+ADDF4
+ADDRLP4 652
+INDIRF4
+SUBF4
+LEF4 $213
+ADDRLP4 452+24+8
+INDIRF4
+ADDRLP4 452+72+8
+INDIRF4
+ADDF4
+ADDRLP4 272+24+8
+INDIRF4
+ADDRLP4 272+84+8
+INDIRF4
+ADDF4
+ADDRLP4 652
+INDIRF4
+ADDF4
+GEF4 $213
+ADDRLP4 272+36
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 656
+CNSTP4 0
+ASGNP4
+ADDRLP4 656
+INDIRP4
+ARGP4
+ADDRLP4 656
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 260+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 608
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRLP4 272+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 608+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRLP4 272+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 608+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 272+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 608
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 260
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDRLP4 260+4
+INDIRF4
+ADDRLP4 608+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 260+8
+INDIRF4
+ADDRLP4 608+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1060320051
+LEF4 $240
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 608
+ARGP4
+CNSTF4 1137180672
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+LABELV $240
+LABELV $213
+LABELV $195
+LABELV $185
+LABELV $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $246
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 644
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 604
+ADDRLP4 644
+INDIRF4
+ASGNF4
+ADDRLP4 648
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+ADDRLP4 604
+INDIRF4
+MULF4
+GEF4 $248
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 604
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $248
+LABELV $246
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 644
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+EQI4 $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $250
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $252
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $254
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 648
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $256
+ARGP4
+ADDRLP4 648
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $255
+JUMPV
+LABELV $254
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $257
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Crouch
+CALLV
+pop
+ADDRGP4 $258
+JUMPV
+LABELV $257
+ADDRLP4 648
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1028443341
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $259
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+LABELV $259
+LABELV $258
+LABELV $255
+LABELV $252
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $261
+ADDRLP4 260
+ADDRLP4 272+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 272+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 272+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 652
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 652
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 652
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $262
+JUMPV
+LABELV $261
+ADDRLP4 648
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $270
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 260
+ADDRLP4 592
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 592+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 592+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 656
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 656
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 656
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $270
+LABELV $262
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 656
+ADDRGP4 BotGoForAir
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 0
+EQI4 $276
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $278
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $276
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $173
+LABELV $164
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $279
+ADDRLP4 272+24
+ARGP4
+ADDRLP4 632
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 448
+ADDRLP4 632
+INDIRI4
+ASGNI4
+ADDRLP4 636
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 0
+EQI4 $282
+ADDRLP4 636
+INDIRI4
+ARGI4
+ADDRLP4 640
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 640
+INDIRI4
+CNSTI4 0
+EQI4 $282
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+ADDRLP4 448
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ADDRLP4 272+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6640
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6644
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6648
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6652
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6656
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6660
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $282
+LABELV $279
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+GEF4 $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 632
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $287
+ARGP4
+ADDRLP4 632
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $285
+CNSTI4 1
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $156
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $288
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6636
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 624
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+INDIRF4
+LEF4 $290
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $290
+LABELV $288
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $292
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $292
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $292
+ADDRLP4 624
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 624
+INDIRF4
+CNSTF4 0
+EQF4 $294
+ADDRLP4 624
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $294
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $296
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $297
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $294
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $298
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $300
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $298
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 636
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 636
+INDIRF4
+CNSTF4 1167663104
+GEF4 $303
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 640
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 644
+CNSTF4 1077936128
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 644
+INDIRF4
+ADDF4
+ADDRLP4 644
+INDIRF4
+ADDRLP4 640
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 BotHasPersistantPowerupAndWeapon
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 0
+EQI4 $305
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRFP4 0
+INDIRP4
+CNSTI4 6148
+ADDP4
+CNSTF4 1135542272
+ASGNF4
+LABELV $306
+LABELV $303
+CNSTI4 1
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $292
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 11
+NEI4 $307
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $307
+ADDRLP4 624
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 624
+INDIRF4
+CNSTF4 0
+EQF4 $309
+ADDRLP4 624
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $309
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $311
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $309
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+NEI4 $312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $314
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $315
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $315
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 632
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $307
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $317
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $317
+ADDRLP4 624
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 624
+INDIRF4
+CNSTF4 0
+EQF4 $319
+ADDRLP4 624
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $319
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $321
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $134
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $319
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $322
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $322
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 632
+ADDRGP4 trap_BotItemGoalInVisButNotVisible
+CALLI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 0
+EQI4 $324
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $326
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $325
+JUMPV
+LABELV $324
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 636
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 0
+EQI4 $327
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $327
+LABELV $325
+CNSTI4 1
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $317
+ADDRLP4 624
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 624
+INDIRI4
+CNSTI4 7
+EQI4 $332
+ADDRLP4 624
+INDIRI4
+CNSTI4 8
+NEI4 $330
+LABELV $332
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $330
+ADDRLP4 628
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 628
+INDIRF4
+CNSTF4 0
+EQF4 $333
+ADDRLP4 628
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $333
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $335
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 632
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $337
+ARGP4
+ADDRLP4 632
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $134
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+LABELV $335
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $333
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $338
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $340
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $342
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $340
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $338
+ADDRLP4 260
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRLP4 640
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 640
+INDIRF4
+CNSTF4 1163984896
+GEF4 $345
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $347
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $349
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 412
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRLP4 644
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $351
+ARGP4
+ADDRLP4 644
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $352
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+LABELV $349
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $347
+ADDRLP4 644
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $353
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 260
+ADDRLP4 592
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+4
+ADDRLP4 592+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260+8
+ADDRLP4 592+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 260
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 652
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 652
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 652
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $353
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $359
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 648
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 604
+ADDRLP4 648
+INDIRF4
+ASGNF4
+ADDRLP4 652
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 652
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+ADDRLP4 604
+INDIRF4
+MULF4
+GEF4 $361
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 604
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $361
+LABELV $359
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $363
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Crouch
+CALLV
+pop
+LABELV $363
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 trap_AAS_Swimming
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 0
+EQI4 $365
+ADDRFP4 0
+INDIRP4
+CNSTI4 6120
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $365
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 656
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 656
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $367
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $369
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $342
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $371
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $371
+LABELV $369
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $367
+ADDRFP4 0
+INDIRP4
+CNSTI4 6188
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $373
+LABELV $373
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $345
+CNSTI4 1
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $330
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $375
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $375
+ADDRLP4 628
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 628
+INDIRF4
+CNSTF4 0
+EQF4 $377
+ADDRLP4 628
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $377
+ADDRLP4 4
+ARGP4
+ADDRGP4 $62
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 9076
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $382
+JUMPV
+LABELV $379
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $383
+ADDRLP4 4
+ARGP4
+ADDRGP4 $385
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $383
+LABELV $380
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $382
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $379
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $386
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $134
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1048576
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $377
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $387
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $387
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+ADDRLP4 636
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 0
+EQI4 $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 9084
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $393
+ADDRLP4 640
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+ASGNP4
+ADDRLP4 640
+INDIRP4
+ADDRLP4 640
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $392
+JUMPV
+LABELV $393
+ADDRLP4 640
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+ASGNP4
+ADDRLP4 640
+INDIRP4
+ADDRLP4 640
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 644
+ADDRFP4 0
+INDIRP4
+CNSTI4 9084
+ADDP4
+ASGNP4
+ADDRLP4 644
+INDIRP4
+ADDRLP4 644
+INDIRP4
+INDIRI4
+CNSTI4 -5
+BANDI4
+ASGNI4
+ADDRGP4 $392
+JUMPV
+LABELV $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $395
+ADDRLP4 640
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+ASGNP4
+ADDRLP4 640
+INDIRP4
+ADDRLP4 640
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $396
+JUMPV
+LABELV $395
+ADDRLP4 640
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+ASGNP4
+ADDRLP4 640
+INDIRP4
+ADDRLP4 640
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 644
+ADDRFP4 0
+INDIRP4
+CNSTI4 9084
+ADDP4
+ASGNP4
+ADDRLP4 644
+INDIRP4
+ADDRLP4 644
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $396
+LABELV $392
+LABELV $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $397
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $399
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $397
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $400
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $400
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9080
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $375
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $402
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $404
+ADDRLP4 628
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 628
+INDIRF4
+CNSTF4 0
+EQF4 $406
+ADDRLP4 628
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $406
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $408
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $409
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $406
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 636
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 632
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 1
+EQI4 $413
+ADDRLP4 632
+INDIRI4
+CNSTI4 2
+EQI4 $414
+ADDRGP4 $410
+JUMPV
+LABELV $413
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $411
+JUMPV
+LABELV $414
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $411
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 644
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+EQI4 $415
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 652
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 648
+ADDRLP4 652
+INDIRI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 1
+EQI4 $420
+ADDRLP4 648
+INDIRI4
+CNSTI4 2
+EQI4 $421
+ADDRGP4 $417
+JUMPV
+LABELV $420
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $418
+JUMPV
+LABELV $421
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $417
+LABELV $418
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $415
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $422
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $422
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $404
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 5
+NEI4 $424
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $424
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 636
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 632
+ADDRLP4 636
+INDIRI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+CNSTI4 1
+EQI4 $429
+ADDRLP4 632
+INDIRI4
+CNSTI4 2
+EQI4 $430
+ADDRGP4 $426
+JUMPV
+LABELV $429
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $427
+JUMPV
+LABELV $430
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $427
+JUMPV
+LABELV $426
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $427
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 644
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 644
+INDIRI4
+CNSTI4 0
+NEI4 $431
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $431
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $433
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $433
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 0
+EQI4 $435
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 652
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 652
+INDIRI4
+CNSTI4 0
+EQI4 $437
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRLP4 656
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 656
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $438
+JUMPV
+LABELV $437
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $438
+LABELV $435
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $424
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $439
+ADDRLP4 632
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 632
+INDIRF4
+CNSTF4 0
+EQF4 $441
+ADDRLP4 632
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $441
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $443
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $444
+ARGP4
+ADDRGP4 BotVoiceChatOnly
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $441
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 640
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 636
+ADDRLP4 640
+INDIRI4
+ASGNI4
+ADDRLP4 636
+INDIRI4
+CNSTI4 1
+EQI4 $448
+ADDRLP4 636
+INDIRI4
+CNSTI4 2
+EQI4 $449
+ADDRGP4 $445
+JUMPV
+LABELV $448
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $446
+JUMPV
+LABELV $449
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $446
+JUMPV
+LABELV $445
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $446
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 648
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 648
+INDIRI4
+CNSTI4 0
+EQI4 $450
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $450
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $452
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $452
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 BotAlternateRoute
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $128
+JUMPV
+LABELV $439
+LABELV $402
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 628
+ADDRGP4 BotGetItemLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 628
+INDIRI4
+RETI4
+LABELV $128
+endproc BotGetLongTermGoal 664 20
+export BotLongTermGoal
+proc BotLongTermGoal 448 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6884
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $455
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $455
+ADDRFP4 0
+INDIRP4
+CNSTI4 6884
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $457
+ADDRFP4 0
+INDIRP4
+CNSTI4 6824
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 416
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $459
+ARGP4
+ADDRLP4 416
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6884
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 424
+ADDRGP4 BotGetLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 424
+INDIRI4
+RETI4
+ADDRGP4 $454
+JUMPV
+LABELV $457
+ADDRLP4 416
+ADDRFP4 0
+INDIRP4
+CNSTI4 6892
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 416
+INDIRF4
+CNSTF4 0
+GEF4 $460
+ADDRLP4 416
+INDIRF4
+NEGF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $460
+ADDRFP4 0
+INDIRP4
+CNSTI4 6824
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 420
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $462
+ARGP4
+ADDRLP4 420
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6892
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $460
+ADDRFP4 0
+INDIRP4
+CNSTI4 6824
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $463
+ADDRLP4 12+24
+ARGP4
+ADDRLP4 420
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 412
+ADDRLP4 420
+INDIRI4
+ASGNI4
+ADDRLP4 424
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRLP4 424
+INDIRI4
+CNSTI4 0
+EQI4 $466
+ADDRLP4 424
+INDIRI4
+ARGI4
+ADDRLP4 428
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 428
+INDIRI4
+CNSTI4 0
+EQI4 $466
+ADDRFP4 0
+INDIRP4
+CNSTI4 6868
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6824
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6840
+ADDP4
+ADDRLP4 412
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6828
+ADDP4
+ADDRLP4 12+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6844
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6848
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6852
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6856
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6860
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6864
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+LABELV $466
+LABELV $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6824
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 424
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 424
+INDIRF4
+CNSTF4 0
+EQF4 $469
+ADDRFP4 0
+INDIRP4
+CNSTI4 6888
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $469
+ADDRFP4 0
+INDIRP4
+CNSTI4 6888
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $471
+ADDRFP4 0
+INDIRP4
+CNSTI4 6896
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+LABELV $471
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6828
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6832
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6836
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 436
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 408
+ADDRLP4 436
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6896
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $475
+ADDRFP4 0
+INDIRP4
+CNSTI4 6892
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+GEF4 $477
+ADDRFP4 0
+INDIRP4
+CNSTI4 6824
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 440
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $462
+ARGP4
+ADDRLP4 440
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6892
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $477
+ADDRLP4 408
+INDIRF4
+CNSTF4 1176256512
+GEF4 $479
+ADDRFP4 0
+INDIRP4
+CNSTI4 6896
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $479
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6828
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $454
+JUMPV
+LABELV $475
+ADDRLP4 408
+INDIRF4
+CNSTF4 1215570944
+LEF4 $481
+ADDRFP4 0
+INDIRP4
+CNSTI4 6892
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+GEF4 $483
+ADDRFP4 0
+INDIRP4
+CNSTI4 6824
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 440
+ADDRGP4 EasyClientName
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $462
+ARGP4
+ADDRLP4 440
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6892
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $483
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 444
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 444
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 444
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $454
+JUMPV
+LABELV $481
+LABELV $455
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 416
+ADDRGP4 BotGetLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+RETI4
+LABELV $454
+endproc BotLongTermGoal 448 20
+export AIEnter_Intermission
+proc AIEnter_Intermission 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $493
+ARGP4
+ADDRGP4 $62
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotChat_EndLevel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $494
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $494
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Intermission
+ASGNP4
+LABELV $492
+endproc AIEnter_Intermission 8 16
+export AINode_Intermission
+proc AINode_Intermission 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $497
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotChat_StartLevel
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $499
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $500
+JUMPV
+LABELV $499
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+LABELV $500
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $501
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $497
+CNSTI4 1
+RETI4
+LABELV $496
+endproc AINode_Intermission 16 8
+export AIEnter_Observer
+proc AIEnter_Observer 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $503
+ARGP4
+ADDRGP4 $62
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Observer
+ASGNP4
+LABELV $502
+endproc AIEnter_Observer 0 16
+export AINode_Observer
+proc AINode_Observer 4 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $505
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $505
+CNSTI4 1
+RETI4
+LABELV $504
+endproc AINode_Observer 4 8
+export AIEnter_Stand
+proc AIEnter_Stand 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $509
+ARGP4
+ADDRGP4 $62
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6112
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Stand
+ASGNP4
+LABELV $508
+endproc AIEnter_Stand 0 16
+export AINode_Stand
+proc AINode_Stand 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+LEI4 $511
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotChat_HitTalking
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $513
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6112
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+CNSTF4 1036831949
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 20
+INDIRF4
+ADDF4
+CNSTF4 1036831949
+ADDF4
+ASGNF4
+LABELV $513
+LABELV $511
+ADDRFP4 0
+INDIRP4
+CNSTI4 6112
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $515
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $517
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $519
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $510
+JUMPV
+LABELV $517
+ADDRFP4 0
+INDIRP4
+CNSTI4 6112
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $515
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Talk
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $520
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $522
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $510
+JUMPV
+LABELV $520
+CNSTI4 1
+RETI4
+LABELV $510
+endproc AINode_Stand 24 12
+export AIEnter_Respawn
+proc AIEnter_Respawn 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $524
+ARGP4
+ADDRGP4 $62
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetMoveState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetGoalState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotChat_Death
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $525
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6076
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $526
+JUMPV
+LABELV $525
+ADDRLP4 4
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6076
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $526
+ADDRFP4 0
+INDIRP4
+CNSTI4 5984
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Respawn
+ASGNP4
+LABELV $523
+endproc AIEnter_Respawn 12 16
+export AINode_Respawn
+proc AINode_Respawn 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5984
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $528
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $530
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $532
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+ADDRGP4 $529
+JUMPV
+LABELV $530
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Respawn
+CALLV
+pop
+ADDRGP4 $529
+JUMPV
+LABELV $528
+ADDRFP4 0
+INDIRP4
+CNSTI4 6076
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $533
+ADDRFP4 0
+INDIRP4
+CNSTI4 5984
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Respawn
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $535
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6052
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $535
+LABELV $533
+LABELV $529
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6080
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $537
+ADDRLP4 0
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+GEF4 $537
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Talk
+CALLV
+pop
+LABELV $537
+CNSTI4 1
+RETI4
+LABELV $527
+endproc AINode_Respawn 4 12
+export BotSelectActivateWeapon
+proc BotSelectActivateWeapon 56 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4976
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $540
+ADDRFP4 0
+INDIRP4
+CNSTI4 5028
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LEI4 $540
+CNSTI4 2
+RETI4
+ADDRGP4 $539
+JUMPV
+LABELV $540
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4972
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $542
+ADDRFP4 0
+INDIRP4
+CNSTI4 5024
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LEI4 $542
+CNSTI4 3
+RETI4
+ADDRGP4 $539
+JUMPV
+LABELV $542
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $544
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LEI4 $544
+CNSTI4 8
+RETI4
+ADDRGP4 $539
+JUMPV
+LABELV $544
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $546
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $546
+CNSTI4 6
+RETI4
+ADDRGP4 $539
+JUMPV
+LABELV $546
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LEI4 $548
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+LEI4 $548
+CNSTI4 7
+RETI4
+ADDRGP4 $539
+JUMPV
+LABELV $548
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $550
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LEI4 $550
+CNSTI4 5
+RETI4
+ADDRGP4 $539
+JUMPV
+LABELV $550
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $552
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $552
+CNSTI4 9
+RETI4
+ADDRGP4 $539
+JUMPV
+LABELV $552
+CNSTI4 -1
+RETI4
+LABELV $539
+endproc BotSelectActivateWeapon 56 0
+export BotClearPath
+proc BotClearPath 376 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6256
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $555
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 17
+BANDI4
+CNSTI4 0
+NEI4 $557
+ADDRFP4 0
+INDIRP4
+CNSTI4 6256
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 236
+ADDRLP4 12+12+12
+INDIRB
+ASGNB 12
+ADDRLP4 236+8
+ADDRLP4 236+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 236
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 236+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 236+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotSelectActivateWeapon
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $566
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $566
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $568
+ADDRLP4 340
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ADDRLP4 340
+INDIRP4
+INDIRI4
+CNSTI4 17
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+NEI4 $570
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $572
+ADDRLP4 248
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 352
+CNSTP4 0
+ASGNP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 352
+INDIRP4
+ARGP4
+ADDRLP4 236
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 248+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $578
+ADDRLP4 248+80
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $574
+LABELV $578
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $574
+LABELV $572
+LABELV $570
+LABELV $568
+LABELV $557
+LABELV $555
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $579
+ADDRFP4 0
+INDIRP4
+CNSTI4 6208
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $579
+ADDRFP4 0
+INDIRP4
+CNSTI4 6208
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $581
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 17
+BANDI4
+CNSTI4 0
+NEI4 $581
+ADDRLP4 228
+CNSTF4 1133903872
+ASGNF4
+ADDRLP4 232
+CNSTI4 -1
+ASGNI4
+ADDRLP4 220
+CNSTI4 0
+ASGNI4
+ADDRGP4 $586
+JUMPV
+LABELV $583
+ADDRLP4 220
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0
+ADDRLP4 12+12+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+12+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+12+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 336
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 224
+ADDRLP4 336
+INDIRF4
+ASGNF4
+ADDRLP4 224
+INDIRF4
+ADDRLP4 228
+INDIRF4
+GEF4 $597
+ADDRLP4 228
+ADDRLP4 224
+INDIRF4
+ASGNF4
+ADDRLP4 232
+ADDRLP4 220
+INDIRI4
+ASGNI4
+LABELV $597
+LABELV $584
+ADDRLP4 220
+ADDRLP4 220
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $586
+ADDRLP4 220
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+INDIRI4
+LTI4 $583
+ADDRLP4 232
+INDIRI4
+CNSTI4 -1
+EQI4 $599
+ADDRLP4 232
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6260
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 236
+ADDRLP4 12+12+12
+INDIRB
+ASGNB 12
+ADDRLP4 236+8
+ADDRLP4 236+8
+INDIRF4
+CNSTF4 1073741824
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 236
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 236+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 236+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 340
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+INDIRI4
+ADDRLP4 340
+INDIRI4
+LEI4 $608
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+INDIRI4
+ADDRLP4 340
+INDIRI4
+LEI4 $608
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $608
+ADDRLP4 348
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+ADDRLP4 348
+INDIRI4
+LEI4 $610
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+ADDRLP4 348
+INDIRI4
+LEI4 $610
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $610
+ADDRLP4 356
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+INDIRI4
+ADDRLP4 356
+INDIRI4
+LEI4 $612
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+INDIRI4
+ADDRLP4 356
+INDIRI4
+LEI4 $612
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 9
+ASGNI4
+ADDRGP4 $613
+JUMPV
+LABELV $612
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $613
+LABELV $611
+LABELV $609
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $614
+ADDRLP4 360
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ADDRLP4 360
+INDIRP4
+INDIRI4
+CNSTI4 17
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+NEI4 $616
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ARGP4
+ADDRLP4 364
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+EQI4 $618
+ADDRLP4 248
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 372
+CNSTP4 0
+ASGNP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+ADDRLP4 372
+INDIRP4
+ARGP4
+ADDRLP4 236
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 248+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $624
+ADDRLP4 248+80
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $620
+LABELV $624
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $620
+LABELV $618
+LABELV $616
+LABELV $614
+LABELV $599
+LABELV $581
+LABELV $554
+endproc BotClearPath 376 28
+export AIEnter_Seek_ActivateEntity
+proc AIEnter_Seek_ActivateEntity 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $626
+ARGP4
+ADDRGP4 $62
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Seek_ActivateEntity
+ASGNP4
+LABELV $625
+endproc AIEnter_Seek_ActivateEntity 0 16
+export AINode_Seek_ActivateEntity
+proc AINode_Seek_ActivateEntity 380 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+EQI4 $628
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $630
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $627
+JUMPV
+LABELV $628
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $631
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $633
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $627
+JUMPV
+LABELV $631
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 328
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $634
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $636
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $627
+JUMPV
+LABELV $634
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $637
+ADDRLP4 332
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 332
+INDIRP4
+ADDRLP4 332
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $637
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $640
+ADDRLP4 340
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 340
+INDIRP4
+ADDRLP4 340
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $640
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $642
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $644
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $627
+JUMPV
+LABELV $642
+ADDRLP4 344
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 344
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 348
+CNSTI4 0
+ASGNI4
+ADDRLP4 68
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRLP4 344
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 348
+INDIRI4
+EQI4 $645
+ADDRLP4 72
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 356
+CNSTP4 0
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ARGP4
+ADDRLP4 356
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 80
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 72+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $651
+ADDRLP4 72+80
+INDIRI4
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $647
+LABELV $651
+ADDRLP4 68
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+NEI4 $652
+ADDRLP4 368
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 368
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 368
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 308
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 308
+ARGP4
+ADDRLP4 376
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 376
+INDIRI4
+CNSTI4 0
+EQI4 $656
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $656
+LABELV $652
+LABELV $647
+LABELV $645
+ADDRLP4 68
+INDIRI4
+CNSTI4 0
+EQI4 $658
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 156
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 156+24
+ARGP4
+ADDRLP4 352
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+NEI4 $660
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $660
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $663
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $665
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $627
+JUMPV
+LABELV $665
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $667
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $627
+JUMPV
+LABELV $663
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 52
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $659
+JUMPV
+LABELV $658
+ADDRLP4 52
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $668
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $669
+JUMPV
+LABELV $668
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $670
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $672
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $672
+LABELV $670
+LABELV $669
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $674
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $676
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $627
+JUMPV
+LABELV $676
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $678
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $627
+JUMPV
+LABELV $674
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 352
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $679
+CNSTI4 0
+RETI4
+ADDRGP4 $627
+JUMPV
+LABELV $679
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $681
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $681
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+LABELV $659
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $683
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $685
+ADDRLP4 356
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 356
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 356
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRLP4 0+40
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $685
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $692
+ADDRLP4 0+20
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 356
+ADDRGP4 BotSelectActivateWeapon
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRLP4 356
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 -1
+NEI4 $696
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $696
+ADDRLP4 0+24
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $692
+LABELV $683
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $699
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $700
+JUMPV
+LABELV $699
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $703
+ADDRLP4 352
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $704
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 56
+ADDRLP4 296
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 296+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 296+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 360
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 360
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $704
+JUMPV
+LABELV $703
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $712
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 296
+ARGP4
+ADDRLP4 356
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $714
+ADDRLP4 56
+ADDRLP4 296
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 296+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56+8
+ADDRLP4 296+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $715
+JUMPV
+LABELV $714
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $715
+ADDRLP4 360
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 360
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 360
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $712
+LABELV $704
+LABELV $700
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $721
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $721
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 352
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 0
+EQI4 $725
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 356
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $727
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $729
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+ADDRGP4 $728
+JUMPV
+LABELV $727
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $729
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $728
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+LABELV $725
+CNSTI4 1
+RETI4
+LABELV $627
+endproc AINode_Seek_ActivateEntity 380 28
+export AIEnter_Seek_NBG
+proc AIEnter_Seek_NBG 204 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $731
+ADDRLP4 0+44
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $734
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $732
+JUMPV
+LABELV $731
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $734
+ARGP4
+ADDRGP4 $735
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $732
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Seek_NBG
+ASGNP4
+LABELV $730
+endproc AIEnter_Seek_NBG 204 16
+export AINode_Seek_NBG
+proc AINode_Seek_NBG 192 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 132
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+EQI4 $737
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $739
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $736
+JUMPV
+LABELV $737
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $740
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $742
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $736
+JUMPV
+LABELV $740
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $743
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $745
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $736
+JUMPV
+LABELV $743
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $746
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 144
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $746
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $749
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $749
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $751
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $751
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $753
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $754
+JUMPV
+LABELV $753
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $755
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $755
+LABELV $754
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $757
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1028443341
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $759
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $736
+JUMPV
+LABELV $757
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 168
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $760
+CNSTI4 0
+RETI4
+ADDRGP4 $736
+JUMPV
+LABELV $760
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $762
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $762
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $764
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $765
+JUMPV
+LABELV $764
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $768
+ADDRLP4 176
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $769
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 120
+ADDRLP4 108
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 108+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 184
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 184
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 184
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $769
+JUMPV
+LABELV $768
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $777
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 176
+ADDRGP4 trap_BotGetSecondGoal
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $779
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+LABELV $779
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 108
+ARGP4
+ADDRLP4 184
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $781
+ADDRLP4 120
+ADDRLP4 108
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 108+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 108+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $782
+JUMPV
+LABELV $781
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $782
+ADDRLP4 188
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 188
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 188
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $777
+LABELV $769
+LABELV $765
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $788
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $788
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 176
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $792
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $794
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $796
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+ADDRGP4 $795
+JUMPV
+LABELV $794
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $796
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $795
+LABELV $792
+CNSTI4 1
+RETI4
+LABELV $736
+endproc AINode_Seek_NBG 192 20
+export AIEnter_Seek_LTG
+proc AIEnter_Seek_LTG 204 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $798
+ADDRLP4 0+44
+INDIRI4
+ARGI4
+ADDRLP4 56
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $801
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRGP4 $799
+JUMPV
+LABELV $798
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $801
+ARGP4
+ADDRGP4 $735
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+LABELV $799
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Seek_LTG
+ASGNP4
+LABELV $797
+endproc AIEnter_Seek_LTG 204 16
+export AINode_Seek_LTG
+proc AINode_Seek_LTG 212 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $803
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $805
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $802
+JUMPV
+LABELV $803
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $806
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $808
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $802
+JUMPV
+LABELV $806
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $809
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $811
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $802
+JUMPV
+LABELV $809
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 BotChat_Random
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $812
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 156
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $814
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $802
+JUMPV
+LABELV $812
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $815
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $815
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $818
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $818
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $820
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $820
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6168
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $822
+ADDRLP4 168
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1065353216
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $824
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Gesture
+CALLV
+pop
+LABELV $824
+LABELV $822
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 168
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $826
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $828
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $830
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $802
+JUMPV
+LABELV $828
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $830
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $802
+JUMPV
+LABELV $826
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotTeamGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+NEI4 $831
+CNSTI4 1
+RETI4
+ADDRGP4 $802
+JUMPV
+LABELV $831
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $833
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotWantsToCamp
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $835
+ADDRLP4 108
+CNSTI4 400
+ASGNI4
+ADDRGP4 $836
+JUMPV
+LABELV $835
+ADDRLP4 108
+CNSTI4 150
+ASGNI4
+LABELV $836
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $837
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $839
+ADDRLP4 108
+CNSTI4 50
+ASGNI4
+LABELV $839
+LABELV $837
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 184
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $841
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+CNSTF4 1008981770
+ADDRLP4 108
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $843
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $802
+JUMPV
+LABELV $841
+LABELV $833
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotAIPredictObstacles
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $844
+CNSTI4 0
+RETI4
+ADDRGP4 $802
+JUMPV
+LABELV $844
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $846
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $846
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotClearPath
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $848
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $849
+JUMPV
+LABELV $848
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $852
+ADDRLP4 188
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $853
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 196
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $853
+JUMPV
+LABELV $852
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $861
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 112
+ARGP4
+ADDRLP4 192
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $863
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $864
+JUMPV
+LABELV $863
+ADDRLP4 0+28
+ARGP4
+ADDRLP4 196
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 196
+INDIRF4
+CNSTF4 0
+EQF4 $869
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $870
+JUMPV
+LABELV $869
+ADDRLP4 200
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1061997773
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+MULF4
+GEF4 $873
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRGP4 BotRoamGoal
+CALLV
+pop
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 208
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 208
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $873
+LABELV $870
+LABELV $864
+ADDRLP4 204
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 204
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $861
+LABELV $853
+LABELV $849
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $879
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $879
+CNSTI4 1
+RETI4
+LABELV $802
+endproc AINode_Seek_LTG 212 20
+export AIEnter_Battle_Fight
+proc AIEnter_Battle_Fight 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $884
+ARGP4
+ADDRGP4 $62
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Battle_Fight
+ASGNP4
+LABELV $883
+endproc AIEnter_Battle_Fight 0 16
+export AIEnter_Battle_SuicidalFight
+proc AIEnter_Battle_SuicidalFight 4 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $884
+ARGP4
+ADDRGP4 $62
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Battle_Fight
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $885
+endproc AIEnter_Battle_SuicidalFight 4 16
+export AINode_Battle_Fight
+proc AINode_Battle_Fight 292 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $887
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $889
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $887
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+EQI4 $890
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $892
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $890
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+EQI4 $893
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $895
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $893
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 224
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+EQI4 $896
+LABELV $896
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $898
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $900
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $898
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $901
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $902
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6012
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $905
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChat_EnemySuicide
+CALLI4
+pop
+LABELV $905
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+NEI4 $907
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 BotChat_Kill
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+EQI4 $907
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 240
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $909
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+ADDRGP4 $908
+JUMPV
+LABELV $907
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $909
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+LABELV $908
+CNSTI4 0
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $901
+ADDRLP4 0
+ARGP4
+ADDRLP4 228
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+EQI4 $910
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $910
+LABELV $902
+ADDRLP4 0
+ARGP4
+ADDRLP4 228
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 228
+INDIRI4
+CNSTI4 0
+EQI4 $912
+ADDRLP4 0
+ARGP4
+ADDRLP4 232
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 232
+INDIRI4
+CNSTI4 0
+NEI4 $912
+ADDRLP4 236
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1045220557
+GEF4 $914
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $916
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $914
+LABELV $912
+ADDRLP4 196
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $918
+LABELV $918
+ADDRLP4 196
+ARGP4
+ADDRLP4 236
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 192
+ADDRLP4 236
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $920
+ADDRLP4 192
+INDIRI4
+ARGI4
+ADDRLP4 244
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 244
+INDIRI4
+CNSTI4 0
+EQI4 $920
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+ADDRLP4 196
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRLP4 192
+INDIRI4
+ASGNI4
+LABELV $920
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+LEI4 $922
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+ADDRGP4 BotChat_HitNoDeath
+CALLI4
+ASGNI4
+ADDRLP4 256
+INDIRI4
+CNSTI4 0
+EQI4 $924
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 264
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 264
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $926
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $924
+LABELV $922
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+INDIRI4
+LEI4 $927
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 BotChat_HitNoKill
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $929
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 268
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $931
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $929
+LABELV $927
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 264
+INDIRF4
+CNSTF4 0
+NEF4 $932
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+ADDRGP4 BotWantsToChase
+CALLI4
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 0
+EQI4 $934
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $936
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $934
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $936
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $932
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotBattleUseItems
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $937
+ADDRLP4 268
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 268
+INDIRP4
+ADDRLP4 268
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $937
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 272
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $940
+ADDRLP4 276
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $940
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $942
+ADDRLP4 284
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 284
+INDIRP4
+ADDRLP4 284
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $942
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAttackMove
+CALLV
+pop
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $944
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $944
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $946
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $948
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $950
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $886
+JUMPV
+LABELV $948
+LABELV $946
+CNSTI4 1
+RETI4
+LABELV $886
+endproc AINode_Battle_Fight 292 20
+export AIEnter_Battle_Chase
+proc AIEnter_Battle_Chase 0 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $952
+ARGP4
+ADDRGP4 $62
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Battle_Chase
+ASGNP4
+LABELV $951
+endproc AIEnter_Battle_Chase 0 16
+export AINode_Battle_Chase
+proc AINode_Battle_Chase 204 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $954
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $956
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $953
+JUMPV
+LABELV $954
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $957
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $959
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $953
+JUMPV
+LABELV $957
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $960
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $962
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $953
+JUMPV
+LABELV $960
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $963
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $965
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $953
+JUMPV
+LABELV $963
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 152
+INDIRF4
+CNSTF4 0
+EQF4 $966
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $952
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $953
+JUMPV
+LABELV $966
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 156
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $968
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $970
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $953
+JUMPV
+LABELV $968
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $971
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $973
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $953
+JUMPV
+LABELV $971
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $974
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $974
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 164
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $977
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $977
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $979
+ADDRLP4 176
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 176
+INDIRP4
+ADDRLP4 176
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $979
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRLP4 0+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 176
+ADDRGP4 trap_BotTouchingGoal
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $993
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $993
+ADDRLP4 180
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 180
+INDIRF4
+CNSTF4 0
+EQF4 $997
+ADDRLP4 180
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+GEF4 $995
+LABELV $997
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $998
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $953
+JUMPV
+LABELV $995
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $999
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 108
+CNSTF4 1125515264
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 108
+INDIRF4
+ARGF4
+ADDRLP4 188
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $1001
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+ADDRLP4 108
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1003
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $953
+JUMPV
+LABELV $1001
+LABELV $999
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 56
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $1004
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1004
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRLP4 56+20
+INDIRI4
+CNSTI4 11
+BANDI4
+CNSTI4 0
+EQI4 $1006
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDRLP4 56+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1007
+JUMPV
+LABELV $1006
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $1010
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $1012
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1013
+JUMPV
+LABELV $1012
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 112
+ARGP4
+ADDRLP4 196
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $1014
+ADDRLP4 124
+ADDRLP4 112
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 112+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 112+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 124
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1015
+JUMPV
+LABELV $1014
+ADDRLP4 56+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $1015
+LABELV $1013
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 192
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1010
+LABELV $1007
+ADDRLP4 56+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1021
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRLP4 56+24
+INDIRI4
+ASGNI4
+LABELV $1021
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRI4
+NEI4 $1025
+ADDRFP4 0
+INDIRP4
+CNSTI4 6084
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1025
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $1027
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1029
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $953
+JUMPV
+LABELV $1027
+CNSTI4 1
+RETI4
+LABELV $953
+endproc AINode_Battle_Chase 204 20
+export AIEnter_Battle_Retreat
+proc AIEnter_Battle_Retreat 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1031
+ARGP4
+ADDRGP4 $62
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Battle_Retreat
+ASGNP4
+LABELV $1030
+endproc AIEnter_Battle_Retreat 0 16
+export AINode_Battle_Retreat
+proc AINode_Battle_Retreat 368 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1033
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1035
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1032
+JUMPV
+LABELV $1033
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $1036
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1038
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1032
+JUMPV
+LABELV $1036
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 292
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1039
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1041
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1032
+JUMPV
+LABELV $1039
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1042
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1044
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1032
+JUMPV
+LABELV $1042
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 108
+ARGP4
+ADDRLP4 296
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $1045
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1047
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1032
+JUMPV
+LABELV $1045
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 304
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $1048
+LABELV $1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $1050
+ADDRLP4 308
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 308
+INDIRP4
+ADDRLP4 308
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $1050
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $1053
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $1053
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotWantsToChase
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1055
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotEmptyGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1057
+ARGP4
+ADDRGP4 AIEnter_Battle_Chase
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1032
+JUMPV
+LABELV $1055
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 332
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 332
+INDIRF4
+CNSTF4 0
+EQF4 $1058
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 108+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1061
+LABELV $1061
+ADDRLP4 252
+ARGP4
+ADDRLP4 336
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 336
+INDIRI4
+ASGNI4
+ADDRLP4 340
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+EQI4 $1063
+ADDRLP4 340
+INDIRI4
+ARGI4
+ADDRLP4 344
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1063
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+ADDRLP4 252
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRLP4 248
+INDIRI4
+ASGNI4
+LABELV $1063
+LABELV $1058
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1082130432
+SUBF4
+GEF4 $1065
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1067
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1032
+JUMPV
+LABELV $1065
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1068
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 336
+ADDRGP4 BotFindEnemy
+CALLI4
+ASGNI4
+ADDRLP4 336
+INDIRI4
+CNSTI4 0
+EQI4 $1070
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1072
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1032
+JUMPV
+LABELV $1070
+LABELV $1068
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotTeamGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotBattleUseItems
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 340
+ADDRGP4 BotLongTermGoal
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+NEI4 $1073
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1075
+ARGP4
+ADDRGP4 AIEnter_Battle_SuicidalFight
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1032
+JUMPV
+LABELV $1073
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1076
+ADDRFP4 0
+INDIRP4
+CNSTI4 6092
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 264
+CNSTF4 1125515264
+ASGNF4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $1078
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 344
+INDIRI4
+CNSTI4 0
+EQI4 $1080
+ADDRLP4 264
+CNSTF4 1112014848
+ASGNF4
+LABELV $1080
+LABELV $1078
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 264
+INDIRF4
+ARGF4
+ADDRLP4 348
+ADDRGP4 BotNearbyGoal
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $1082
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetLastAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 264
+INDIRF4
+CNSTF4 1120403456
+DIVF4
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1084
+ARGP4
+ADDRGP4 AIEnter_Battle_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1032
+JUMPV
+LABELV $1082
+LABELV $1076
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1085
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1085
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $1087
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1088
+JUMPV
+LABELV $1087
+ADDRLP4 348
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 348
+INDIRI4
+NEI4 $1091
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 348
+INDIRI4
+NEI4 $1091
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 352
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 268
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 268
+INDIRF4
+CNSTF4 1050253722
+LEF4 $1094
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1095
+JUMPV
+LABELV $1094
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 252
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 360
+INDIRI4
+CNSTI4 0
+EQI4 $1096
+ADDRLP4 272
+ADDRLP4 252
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 272+4
+ADDRLP4 252+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 272+8
+ADDRLP4 252+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 272
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1097
+JUMPV
+LABELV $1096
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $1097
+ADDRLP4 364
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 364
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 364
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1095
+LABELV $1091
+LABELV $1088
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1103
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1103
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1032
+endproc AINode_Battle_Retreat 368 20
+export AIEnter_Battle_NBG
+proc AIEnter_Battle_NBG 0 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1108
+ARGP4
+ADDRGP4 $62
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRecordNodeSwitch
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+ADDRGP4 AINode_Battle_NBG
+ASGNP4
+LABELV $1107
+endproc AIEnter_Battle_NBG 0 16
+export AINode_Battle_NBG
+proc AINode_Battle_NBG 356 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 280
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 280
+INDIRI4
+CNSTI4 0
+EQI4 $1110
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1112
+ARGP4
+ADDRGP4 AIEnter_Observer
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1110
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 284
+INDIRI4
+CNSTI4 0
+EQI4 $1113
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1115
+ARGP4
+ADDRGP4 AIEnter_Intermission
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1113
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+ADDRGP4 BotIsDead
+CALLI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+EQI4 $1116
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1118
+ARGP4
+ADDRGP4 AIEnter_Respawn
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1116
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1119
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1121
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1119
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 108
+ARGP4
+ADDRLP4 292
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 292
+INDIRI4
+CNSTI4 0
+EQI4 $1122
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1124
+ARGP4
+ADDRGP4 AIEnter_Seek_NBG
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1122
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+CNSTI4 18616254
+ASGNI4
+ADDRGP4 bot_grapple+12
+INDIRI4
+CNSTI4 0
+EQI4 $1125
+ADDRLP4 296
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 296
+INDIRP4
+ADDRLP4 296
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $1125
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 300
+ADDRGP4 BotInLavaOrSlime
+CALLI4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 0
+EQI4 $1128
+ADDRLP4 304
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ADDRLP4 304
+INDIRP4
+INDIRI4
+CNSTI4 6291456
+BORI4
+ASGNI4
+LABELV $1128
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotCanAndWantsToRocketJump
+CALLI4
+ASGNI4
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $1130
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 312
+INDIRP4
+ADDRLP4 312
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+LABELV $1130
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotMapScripts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 316
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 316
+INDIRF4
+CNSTF4 0
+EQF4 $1132
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 108+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1135
+LABELV $1135
+ADDRLP4 252
+ARGP4
+ADDRLP4 320
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 248
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRLP4 324
+ADDRLP4 248
+INDIRI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1137
+ADDRLP4 324
+INDIRI4
+ARGI4
+ADDRLP4 328
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $1137
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+ADDRLP4 252
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+ADDRLP4 248
+INDIRI4
+ASGNI4
+LABELV $1137
+LABELV $1132
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 320
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+NEI4 $1139
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1140
+JUMPV
+LABELV $1139
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 324
+ADDRGP4 BotReachedGoal
+CALLI4
+ASGNI4
+ADDRLP4 324
+INDIRI4
+CNSTI4 0
+EQI4 $1141
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1141
+LABELV $1140
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1143
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotPopGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRLP4 328
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+ASGNI4
+ADDRLP4 328
+INDIRI4
+CNSTI4 0
+EQI4 $1145
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1147
+ARGP4
+ADDRGP4 AIEnter_Battle_Retreat
+CALLV
+pop
+ADDRGP4 $1146
+JUMPV
+LABELV $1145
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1147
+ARGP4
+ADDRGP4 AIEnter_Battle_Fight
+CALLV
+pop
+LABELV $1146
+CNSTI4 0
+RETI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1143
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1148
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1148
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIBlocked
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChooseWeapon
+CALLV
+pop
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $1150
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDRLP4 0+40
+INDIRB
+ASGNB 12
+ADDRGP4 $1151
+JUMPV
+LABELV $1150
+ADDRLP4 336
+CNSTI4 0
+ASGNI4
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 336
+INDIRI4
+NEI4 $1154
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+ADDRLP4 336
+INDIRI4
+NEI4 $1154
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 340
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 264
+ADDRLP4 340
+INDIRF4
+ASGNF4
+ADDRLP4 264
+INDIRF4
+CNSTF4 1050253722
+LEF4 $1157
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotAimAtEnemy
+CALLV
+pop
+ADDRGP4 $1158
+JUMPV
+LABELV $1157
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1133903872
+ARGF4
+ADDRLP4 252
+ARGP4
+ADDRLP4 348
+ADDRGP4 trap_BotMovementViewTarget
+CALLI4
+ASGNI4
+ADDRLP4 348
+INDIRI4
+CNSTI4 0
+EQI4 $1159
+ADDRLP4 268
+ADDRLP4 252
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268+4
+ADDRLP4 252+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268+8
+ADDRLP4 252+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 268
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRGP4 $1160
+JUMPV
+LABELV $1159
+ADDRLP4 0+28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $1160
+ADDRLP4 352
+ADDRFP4 0
+INDIRP4
+CNSTI4 6584
+ADDP4
+ASGNP4
+ADDRLP4 352
+INDIRP4
+CNSTF4 1056964608
+ADDRLP4 352
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1158
+LABELV $1154
+LABELV $1151
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $1166
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRLP4 0+24
+INDIRI4
+ASGNI4
+LABELV $1166
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAttack
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $1109
+endproc AINode_Battle_NBG 356 20
+bss
+export nodeswitch
+align 1
+LABELV nodeswitch
+skip 7344
+export numnodeswitches
+align 4
+LABELV numnodeswitches
+skip 4
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import AIEnter_Seek_Camp
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import DeathmatchScoreboardMessage
+import G_SetStats
+import MoveClientToIntermission
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import G_RunMissile
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1147
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $1124
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1121
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1118
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1115
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1112
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1108
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 0
+align 1
+LABELV $1084
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $1075
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $1072
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1067
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1057
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $1047
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1044
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $1041
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $1038
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1035
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1031
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1029
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1003
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $998
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $973
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $970
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $965
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $962
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $959
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $956
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $952
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $950
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $936
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $931
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $926
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $916
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $909
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $900
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $895
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $892
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $889
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $884
+byte 1 98
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $843
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 0
+align 1
+LABELV $830
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $814
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $811
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $808
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $805
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 108
+byte 1 116
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $801
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 76
+byte 1 84
+byte 1 71
+byte 1 0
+align 1
+LABELV $796
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $759
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $745
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $742
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $739
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 110
+byte 1 98
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $735
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $734
+byte 1 115
+byte 1 101
+byte 1 101
+byte 1 107
+byte 1 32
+byte 1 78
+byte 1 66
+byte 1 71
+byte 1 0
+align 1
+LABELV $729
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $678
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $667
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $644
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $636
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $633
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $630
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $626
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $532
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $524
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $522
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 0
+align 1
+LABELV $519
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 0
+align 1
+LABELV $509
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $507
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 102
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $503
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $501
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $493
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $462
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $459
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $444
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $443
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $409
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $408
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $399
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $386
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $385
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 0
+align 1
+LABELV $352
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 111
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $351
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $342
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $337
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $329
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $326
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $321
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $314
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $311
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $300
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $297
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $296
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $287
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $278
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 76
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 84
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $256
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $163
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $160
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $134
+byte 1 121
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $133
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $64
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 50
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $62
+byte 1 0
+align 1
+LABELV $61
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $56
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
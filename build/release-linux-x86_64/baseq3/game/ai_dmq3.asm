@@ -0,0 +1,23286 @@
+export BotSetUserInfo
+code
+proc BotSetUserInfo 1024 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $54
+endproc BotSetUserInfo 1024 12
+export BotCTFCarryingFlag
+proc BotCTFCarryingFlag 0 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+EQI4 $56
+CNSTI4 0
+RETI4
+ADDRGP4 $55
+JUMPV
+LABELV $56
+ADDRFP4 0
+INDIRP4
+CNSTI4 5132
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $58
+CNSTI4 1
+RETI4
+ADDRGP4 $55
+JUMPV
+LABELV $58
+ADDRFP4 0
+INDIRP4
+CNSTI4 5136
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $60
+CNSTI4 2
+RETI4
+ADDRGP4 $55
+JUMPV
+LABELV $60
+CNSTI4 0
+RETI4
+LABELV $55
+endproc BotCTFCarryingFlag 0 0
+export BotTeam
+proc BotTeam 1044 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+LTI4 $65
+ADDRLP4 1024
+INDIRI4
+CNSTI4 64
+LTI4 $63
+LABELV $65
+CNSTI4 0
+RETI4
+ADDRGP4 $62
+JUMPV
+LABELV $63
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $68
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 1
+NEI4 $66
+CNSTI4 1
+RETI4
+ADDRGP4 $62
+JUMPV
+LABELV $66
+ADDRLP4 0
+ARGP4
+ADDRGP4 $68
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 2
+NEI4 $69
+CNSTI4 2
+RETI4
+ADDRGP4 $62
+JUMPV
+LABELV $69
+CNSTI4 0
+RETI4
+LABELV $62
+endproc BotTeam 1044 12
+export BotOppositeTeam
+proc BotOppositeTeam 12 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $75
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $76
+ADDRGP4 $72
+JUMPV
+LABELV $75
+CNSTI4 2
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $76
+CNSTI4 1
+RETI4
+ADDRGP4 $71
+JUMPV
+LABELV $72
+CNSTI4 0
+RETI4
+LABELV $71
+endproc BotOppositeTeam 12 4
+export BotEnemyFlag
+proc BotEnemyFlag 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $78
+ADDRGP4 ctf_blueflag
+RETP4
+ADDRGP4 $77
+JUMPV
+LABELV $78
+ADDRGP4 ctf_redflag
+RETP4
+LABELV $77
+endproc BotEnemyFlag 4 4
+export BotTeamFlag
+proc BotTeamFlag 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $81
+ADDRGP4 ctf_redflag
+RETP4
+ADDRGP4 $80
+JUMPV
+LABELV $81
+ADDRGP4 ctf_blueflag
+RETP4
+LABELV $80
+endproc BotTeamFlag 4 4
+export EntityIsDead
+proc EntityIsDead 472 8
+ADDRLP4 468
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+LTI4 $84
+ADDRLP4 468
+INDIRI4
+CNSTI4 64
+GEI4 $84
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+EQI4 $86
+CNSTI4 1
+RETI4
+ADDRGP4 $83
+JUMPV
+LABELV $86
+LABELV $84
+CNSTI4 0
+RETI4
+LABELV $83
+endproc EntityIsDead 472 8
+export EntityCarriesFlag
+proc EntityCarriesFlag 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $90
+CNSTI4 1
+RETI4
+ADDRGP4 $89
+JUMPV
+LABELV $90
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $92
+CNSTI4 1
+RETI4
+ADDRGP4 $89
+JUMPV
+LABELV $92
+CNSTI4 0
+RETI4
+LABELV $89
+endproc EntityCarriesFlag 0 0
+export EntityIsInvisible
+proc EntityIsInvisible 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $95
+CNSTI4 0
+RETI4
+ADDRGP4 $94
+JUMPV
+LABELV $95
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $97
+CNSTI4 1
+RETI4
+ADDRGP4 $94
+JUMPV
+LABELV $97
+CNSTI4 0
+RETI4
+LABELV $94
+endproc EntityIsInvisible 4 4
+export EntityIsShooting
+proc EntityIsShooting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $100
+CNSTI4 1
+RETI4
+ADDRGP4 $99
+JUMPV
+LABELV $100
+CNSTI4 0
+RETI4
+LABELV $99
+endproc EntityIsShooting 0 0
+export EntityIsChatting
+proc EntityIsChatting 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $103
+CNSTI4 1
+RETI4
+ADDRGP4 $102
+JUMPV
+LABELV $103
+CNSTI4 0
+RETI4
+LABELV $102
+endproc EntityIsChatting 0 0
+export EntityHasQuad
+proc EntityHasQuad 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $106
+CNSTI4 1
+RETI4
+ADDRGP4 $105
+JUMPV
+LABELV $106
+CNSTI4 0
+RETI4
+LABELV $105
+endproc EntityHasQuad 0 0
+export BotRememberLastOrderedTask
+proc BotRememberLastOrderedTask 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $109
+ADDRGP4 $108
+JUMPV
+LABELV $109
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6768
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6764
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $108
+endproc BotRememberLastOrderedTask 16 12
+export BotSetTeamStatus
+proc BotSetTeamStatus 0 0
+LABELV $111
+endproc BotSetTeamStatus 0 0
+export BotSetLastOrderedTask
+proc BotSetLastOrderedTask 60 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $113
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $115
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $117
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $118
+JUMPV
+LABELV $117
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $121
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $121
+LABELV $118
+LABELV $115
+LABELV $113
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $123
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6768
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6764
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1133903872
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $125
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $127
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 BotTeamFlag
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 BotEnemyFlag
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 52
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LEI4 $129
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+LABELV $129
+LABELV $127
+LABELV $125
+CNSTI4 1
+RETI4
+ADDRGP4 $112
+JUMPV
+LABELV $123
+CNSTI4 0
+RETI4
+LABELV $112
+endproc BotSetLastOrderedTask 60 16
+export BotRefuseOrder
+proc BotRefuseOrder 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $132
+ADDRGP4 $131
+JUMPV
+LABELV $132
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $134
+ADDRLP4 0
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+LEF4 $134
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2097152
+ARGI4
+ADDRGP4 trap_EA_Action
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $136
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $134
+LABELV $131
+endproc BotRefuseOrder 8 12
+export BotCTFSeekGoals
+proc BotCTFSeekGoals 240 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $138
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $140
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 180
+ADDRLP4 184
+INDIRI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 1
+EQI4 $145
+ADDRLP4 180
+INDIRI4
+CNSTI4 2
+EQI4 $150
+ADDRGP4 $142
+JUMPV
+LABELV $145
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRGP4 ctf_blueflag+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $143
+JUMPV
+LABELV $150
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRGP4 ctf_redflag+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $143
+JUMPV
+LABELV $142
+ADDRLP4 200
+CNSTF4 1148829696
+ASGNF4
+ADDRLP4 160
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 160+4
+ADDRLP4 200
+INDIRF4
+ASGNF4
+ADDRLP4 160+8
+CNSTF4 1148829696
+ASGNF4
+LABELV $143
+ADDRLP4 160
+ARGP4
+ADDRLP4 192
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 192
+INDIRF4
+CNSTF4 1124073472
+GEF4 $157
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRGP4 $158
+JUMPV
+LABELV $157
+ADDRFP4 0
+INDIRP4
+CNSTI4 6692
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $158
+ADDRGP4 $160
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 196
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $159
+ARGP4
+ADDRLP4 196
+INDIRP4
+ARGP4
+ADDRGP4 BotSetUserInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $161
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRGP4 $137
+JUMPV
+LABELV $140
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $137
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 1
+NEI4 $164
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $165
+JUMPV
+LABELV $164
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $165
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $137
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $137
+JUMPV
+LABELV $138
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $168
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 180
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+NEI4 $170
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $170
+LABELV $168
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 180
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 1
+NEI4 $172
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $173
+JUMPV
+LABELV $172
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $173
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $174
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $137
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $182
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+ADDRGP4 ctf_redflag+44
+INDIRI4
+EQI4 $137
+ADDRLP4 196
+INDIRI4
+ADDRGP4 ctf_blueflag+44
+INDIRI4
+EQI4 $137
+LABELV $182
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 200
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRLP4 204
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+LTI4 $137
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $185
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ADDRLP4 204
+INDIRI4
+EQI4 $137
+LABELV $185
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $186
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+CNSTF4 1121976320
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $137
+JUMPV
+LABELV $174
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $187
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $137
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotEnemyFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 192
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+LTI4 $191
+LABELV $191
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 4
+EQI4 $137
+ADDRLP4 196
+INDIRI4
+CNSTI4 6
+EQI4 $137
+ADDRLP4 196
+INDIRI4
+CNSTI4 1
+EQI4 $137
+ADDRLP4 196
+INDIRI4
+CNSTI4 2
+EQI4 $137
+ADDRLP4 196
+INDIRI4
+CNSTI4 8
+EQI4 $137
+ADDRLP4 196
+INDIRI4
+CNSTI4 9
+EQI4 $137
+ADDRLP4 196
+INDIRI4
+CNSTI4 10
+EQI4 $137
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 204
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $195
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 6
+ASGNI4
+LABELV $196
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $137
+JUMPV
+LABELV $187
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $197
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $137
+ADDRLP4 192
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 6
+EQI4 $137
+ADDRLP4 192
+INDIRI4
+CNSTI4 2
+EQI4 $137
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 196
+ADDRGP4 BotTeamFlagCarrierVisible
+CALLI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 196
+INDIRI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+LTI4 $203
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6748
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $186
+ARGP4
+ADDRGP4 BotVoiceChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7012
+ADDP4
+CNSTF4 1121976320
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $137
+JUMPV
+LABELV $203
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 204
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 204
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1127481344
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $137
+JUMPV
+LABELV $197
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 BotTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+EQI4 $205
+ADDRGP4 $137
+JUMPV
+LABELV $205
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $207
+ADDRLP4 196
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+LABELV $207
+ADDRLP4 200
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+INDIRI4
+ADDRLP4 200
+INDIRI4
+NEI4 $209
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+ADDRLP4 200
+INDIRI4
+EQI4 $209
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $209
+ADDRLP4 204
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 1
+EQI4 $222
+ADDRLP4 204
+INDIRI4
+CNSTI4 2
+EQI4 $222
+ADDRLP4 204
+INDIRI4
+CNSTI4 3
+EQI4 $222
+ADDRLP4 204
+INDIRI4
+CNSTI4 4
+EQI4 $222
+ADDRLP4 204
+INDIRI4
+CNSTI4 5
+EQI4 $222
+ADDRLP4 204
+INDIRI4
+CNSTI4 6
+EQI4 $222
+ADDRLP4 204
+INDIRI4
+CNSTI4 8
+EQI4 $222
+ADDRLP4 204
+INDIRI4
+CNSTI4 9
+EQI4 $222
+ADDRLP4 204
+INDIRI4
+CNSTI4 10
+EQI4 $222
+ADDRLP4 204
+INDIRI4
+CNSTI4 14
+EQI4 $222
+ADDRLP4 204
+INDIRI4
+CNSTI4 15
+NEI4 $211
+LABELV $222
+ADDRGP4 $137
+JUMPV
+LABELV $211
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 208
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+CNSTI4 0
+EQI4 $223
+ADDRGP4 $137
+JUMPV
+LABELV $223
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $225
+ADDRGP4 $137
+JUMPV
+LABELV $225
+ADDRFP4 0
+INDIRP4
+CNSTI4 6164
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $227
+ADDRGP4 $137
+JUMPV
+LABELV $227
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 212
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 212
+INDIRF4
+CNSTF4 1112014848
+GEF4 $229
+ADDRGP4 $137
+JUMPV
+LABELV $229
+ADDRLP4 216
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 216
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 0
+EQI4 $231
+ADDRFP4 0
+INDIRP4
+CNSTI4 6752
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $233
+ADDRLP4 8
+CNSTF4 1060320051
+ASGNF4
+ADDRGP4 $234
+JUMPV
+LABELV $233
+ADDRLP4 8
+CNSTF4 1045220557
+ASGNF4
+LABELV $234
+ADDRLP4 12
+CNSTF4 1063675494
+ASGNF4
+ADDRGP4 $232
+JUMPV
+LABELV $231
+ADDRLP4 8
+CNSTF4 1053609165
+ASGNF4
+ADDRLP4 12
+CNSTF4 1060320051
+ASGNF4
+LABELV $232
+ADDRLP4 220
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 220
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+GEF4 $235
+ADDRLP4 224
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 224
+INDIRI4
+EQI4 $235
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 224
+INDIRI4
+EQI4 $235
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 232
+ADDRGP4 BotOppositeTeam
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 232
+INDIRI4
+ARGI4
+ADDRGP4 BotGetAlternateRouteGoal
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $236
+JUMPV
+LABELV $235
+ADDRLP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $239
+ADDRLP4 228
+CNSTI4 0
+ASGNI4
+ADDRGP4 ctf_redflag+12
+INDIRI4
+ADDRLP4 228
+INDIRI4
+EQI4 $239
+ADDRGP4 ctf_blueflag+12
+INDIRI4
+ADDRLP4 228
+INDIRI4
+EQI4 $239
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 236
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 236
+INDIRI4
+CNSTI4 1
+NEI4 $243
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRGP4 $244
+JUMPV
+LABELV $243
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $244
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1142292480
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6144
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+ADDRGP4 $240
+JUMPV
+LABELV $239
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6164
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $240
+LABELV $236
+ADDRFP4 0
+INDIRP4
+CNSTI4 6620
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CVFI4 4
+ASGNI4
+LABELV $137
+endproc BotCTFSeekGoals 240 12
+export BotCTFRetreatGoals
+proc BotCTFRetreatGoals 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $246
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $248
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotRefuseOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6152
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeamStatus
+CALLV
+pop
+LABELV $248
+LABELV $246
+LABELV $245
+endproc BotCTFRetreatGoals 8 4
+export BotTeamGoals
+proc BotTeamGoals 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $251
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $252
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFRetreatGoals
+CALLV
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $255
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFSeekGoals
+CALLV
+pop
+LABELV $255
+LABELV $252
+ADDRFP4 0
+INDIRP4
+CNSTI4 6616
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $250
+endproc BotTeamGoals 0 4
+export BotPointAreaNum
+proc BotPointAreaNum 68 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_AAS_PointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $258
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $258
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 64
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LEI4 $261
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $261
+CNSTI4 0
+RETI4
+LABELV $257
+endproc BotPointAreaNum 68 20
+export ClientName
+proc ClientName 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $266
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $264
+LABELV $266
+CNSTI4 3
+ARGI4
+ADDRGP4 $267
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $268
+RETP4
+ADDRGP4 $263
+JUMPV
+LABELV $264
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $263
+endproc ClientName 1032 12
+export ClientSkin
+proc ClientSkin 1032 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $273
+ADDRFP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $271
+LABELV $273
+CNSTI4 3
+ARGI4
+ADDRGP4 $274
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $268
+RETP4
+ADDRGP4 $270
+JUMPV
+LABELV $271
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $270
+endproc ClientSkin 1032 12
+bss
+align 4
+LABELV $277
+skip 4
+export ClientFromName
+code
+proc ClientFromName 1040 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $277
+INDIRI4
+CNSTI4 0
+NEI4 $278
+ADDRGP4 $280
+ARGP4
+ADDRLP4 1028
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $277
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+LABELV $278
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $284
+JUMPV
+LABELV $281
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $285
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $276
+JUMPV
+LABELV $285
+LABELV $282
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $284
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $277
+INDIRI4
+GEI4 $287
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $281
+LABELV $287
+CNSTI4 -1
+RETI4
+LABELV $276
+endproc ClientFromName 1040 12
+bss
+align 4
+LABELV $289
+skip 4
+export ClientOnSameTeamFromName
+code
+proc ClientOnSameTeamFromName 1044 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $289
+INDIRI4
+CNSTI4 0
+NEI4 $290
+ADDRGP4 $280
+ARGP4
+ADDRLP4 1028
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $289
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+LABELV $290
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $295
+JUMPV
+LABELV $292
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1032
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $296
+ADDRGP4 $293
+JUMPV
+LABELV $296
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $269
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $298
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $298
+LABELV $293
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $295
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $289
+INDIRI4
+GEI4 $300
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $292
+LABELV $300
+CNSTI4 -1
+RETI4
+LABELV $288
+endproc ClientOnSameTeamFromName 1044 12
+export stristr
+proc stristr 12 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $303
+JUMPV
+LABELV $302
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $308
+JUMPV
+LABELV $305
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 4
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $309
+ADDRGP4 $307
+JUMPV
+LABELV $309
+LABELV $306
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $308
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+EQI4 $311
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 8
+INDIRI4
+NEI4 $305
+LABELV $311
+LABELV $307
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $312
+ADDRFP4 0
+INDIRP4
+RETP4
+ADDRGP4 $301
+JUMPV
+LABELV $312
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $303
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $302
+CNSTP4 0
+RETP4
+LABELV $301
+endproc stristr 12 4
+export EasyClientName
+proc EasyClientName 204 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 5
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 148
+ADDRGP4 ClientName
+CALLP4
+ASGNP4
+ADDRLP4 5
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $318
+JUMPV
+LABELV $315
+ADDRLP4 152
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+BANDI4
+CVII1 4
+ASGNI1
+LABELV $316
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $318
+ADDRLP4 136
+INDIRI4
+ADDRLP4 5
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $315
+ADDRLP4 5
+ARGP4
+ADDRGP4 $323
+ARGP4
+ADDRLP4 156
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 156
+INDIRP4
+ASGNP4
+ADDRGP4 $322
+JUMPV
+LABELV $319
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 160
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 168
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 168
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 160
+INDIRI4
+ADDRLP4 168
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $320
+ADDRLP4 5
+ARGP4
+ADDRGP4 $323
+ARGP4
+ADDRLP4 160
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 160
+INDIRP4
+ASGNP4
+LABELV $322
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $319
+ADDRLP4 5
+ARGP4
+ADDRGP4 $324
+ARGP4
+ADDRLP4 164
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 140
+ADDRLP4 164
+INDIRP4
+ASGNP4
+ADDRLP4 5
+ARGP4
+ADDRGP4 $325
+ARGP4
+ADDRLP4 168
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 144
+ADDRLP4 168
+INDIRP4
+ASGNP4
+ADDRLP4 172
+CNSTU4 0
+ASGNU4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+ADDRLP4 172
+INDIRU4
+EQU4 $326
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 172
+INDIRU4
+EQU4 $326
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+ADDRLP4 140
+INDIRP4
+CVPU4 4
+LEU4 $328
+ADDRLP4 144
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRP4
+ARGP4
+ADDRLP4 180
+CNSTI4 1
+ASGNI4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 180
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 176
+INDIRI4
+ADDRLP4 180
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $329
+JUMPV
+LABELV $328
+ADDRLP4 140
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRP4
+ARGP4
+ADDRLP4 188
+CNSTI4 1
+ASGNI4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 184
+INDIRI4
+ADDRLP4 188
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $329
+LABELV $326
+ADDRLP4 176
+ADDRLP4 5
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 109
+EQI4 $334
+ADDRLP4 176
+INDIRI4
+CNSTI4 77
+NEI4 $330
+LABELV $334
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 114
+EQI4 $335
+ADDRLP4 5+1
+INDIRI1
+CVII4 1
+CNSTI4 82
+NEI4 $330
+LABELV $335
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 180
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 5
+ARGP4
+ADDRLP4 5+2
+ARGP4
+ADDRLP4 180
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $330
+ADDRLP4 0
+ADDRLP4 5
+ASGNP4
+ADDRGP4 $339
+JUMPV
+LABELV $338
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 180
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 97
+LTI4 $344
+ADDRLP4 180
+INDIRI4
+CNSTI4 122
+LEI4 $345
+LABELV $344
+ADDRLP4 184
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 48
+LTI4 $346
+ADDRLP4 184
+INDIRI4
+CNSTI4 57
+LEI4 $345
+LABELV $346
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 95
+NEI4 $341
+LABELV $345
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $342
+JUMPV
+LABELV $341
+ADDRLP4 188
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 65
+LTI4 $347
+ADDRLP4 188
+INDIRI4
+CNSTI4 90
+GTI4 $347
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+ADDI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $348
+JUMPV
+LABELV $347
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 192
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 200
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 200
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 192
+INDIRI4
+ADDRLP4 200
+INDIRI4
+ADDI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+LABELV $348
+LABELV $342
+LABELV $339
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $338
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 5
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $314
+endproc EasyClientName 204 12
+export BotSynonymContext
+proc BotSynonymContext 8 4
+ADDRLP4 0
+CNSTI4 1027
+ASGNI4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $350
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $352
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $353
+JUMPV
+LABELV $352
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $353
+LABELV $350
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $349
+endproc BotSynonymContext 8 4
+export BotChooseWeapon
+proc BotChooseWeapon 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $357
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $355
+LABELV $357
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+ADDRGP4 $356
+JUMPV
+LABELV $355
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_BotChooseBestFightWeapon
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $358
+ADDRFP4 0
+INDIRP4
+CNSTI4 6192
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $358
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+LABELV $356
+LABELV $354
+endproc BotChooseWeapon 20 8
+export BotSetupForMovement
+proc BotSetupForMovement 92 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 68
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 72
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 0+24+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+36
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+44
+ADDRFP4 0
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 1023
+EQI4 $372
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $372
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 80
+INDIRI4
+EQI4 $375
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+LEI4 $375
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $375
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+ADDRLP4 88
+INDIRI4
+EQI4 $378
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LEI4 $378
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $378
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 0+48
+CNSTI4 4
+ASGNI4
+ADDRGP4 $382
+JUMPV
+LABELV $381
+ADDRLP4 0+48
+CNSTI4 2
+ASGNI4
+LABELV $382
+ADDRFP4 0
+INDIRP4
+CNSTI4 6056
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+LEF4 $385
+ADDRLP4 0+64
+ADDRLP4 0+64
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $385
+ADDRLP4 0+52
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotInitMoveState
+CALLV
+pop
+LABELV $360
+endproc BotSetupForMovement 92 12
+export BotCheckItemPickup
+proc BotCheckItemPickup 0 0
+LABELV $389
+endproc BotCheckItemPickup 0 0
+export BotUpdateInventory
+proc BotUpdateInventory 1224 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $392
+ADDRLP4 1028
+CNSTI4 1
+ASGNI4
+ADDRGP4 $393
+JUMPV
+LABELV $392
+ADDRLP4 1028
+CNSTI4 0
+ASGNI4
+LABELV $393
+ADDRFP4 0
+INDIRP4
+CNSTI4 4968
+ADDP4
+ADDRLP4 1028
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $395
+ADDRLP4 1036
+CNSTI4 1
+ASGNI4
+ADDRGP4 $396
+JUMPV
+LABELV $395
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+LABELV $396
+ADDRFP4 0
+INDIRP4
+CNSTI4 4972
+ADDP4
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $398
+ADDRLP4 1044
+CNSTI4 1
+ASGNI4
+ADDRGP4 $399
+JUMPV
+LABELV $398
+ADDRLP4 1044
+CNSTI4 0
+ASGNI4
+LABELV $399
+ADDRFP4 0
+INDIRP4
+CNSTI4 4976
+ADDP4
+ADDRLP4 1044
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $401
+ADDRLP4 1052
+CNSTI4 1
+ASGNI4
+ADDRGP4 $402
+JUMPV
+LABELV $401
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+LABELV $402
+ADDRFP4 0
+INDIRP4
+CNSTI4 4980
+ADDP4
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+EQI4 $404
+ADDRLP4 1060
+CNSTI4 1
+ASGNI4
+ADDRGP4 $405
+JUMPV
+LABELV $404
+ADDRLP4 1060
+CNSTI4 0
+ASGNI4
+LABELV $405
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+ADDRLP4 1060
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+EQI4 $407
+ADDRLP4 1068
+CNSTI4 1
+ASGNI4
+ADDRGP4 $408
+JUMPV
+LABELV $407
+ADDRLP4 1068
+CNSTI4 0
+ASGNI4
+LABELV $408
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $410
+ADDRLP4 1076
+CNSTI4 1
+ASGNI4
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRLP4 1076
+CNSTI4 0
+ASGNI4
+LABELV $411
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $413
+ADDRLP4 1084
+CNSTI4 1
+ASGNI4
+ADDRGP4 $414
+JUMPV
+LABELV $413
+ADDRLP4 1084
+CNSTI4 0
+ASGNI4
+LABELV $414
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+ADDRLP4 1084
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $416
+ADDRLP4 1092
+CNSTI4 1
+ASGNI4
+ADDRGP4 $417
+JUMPV
+LABELV $416
+ADDRLP4 1092
+CNSTI4 0
+ASGNI4
+LABELV $417
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+ADDRLP4 1092
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $419
+ADDRLP4 1100
+CNSTI4 1
+ASGNI4
+ADDRGP4 $420
+JUMPV
+LABELV $419
+ADDRLP4 1100
+CNSTI4 0
+ASGNI4
+LABELV $420
+ADDRFP4 0
+INDIRP4
+CNSTI4 5008
+ADDP4
+ADDRLP4 1100
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5024
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 404
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5028
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 400
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5032
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 408
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 412
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 420
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 26
+NEI4 $422
+ADDRLP4 1144
+CNSTI4 1
+ASGNI4
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRLP4 1144
+CNSTI4 0
+ASGNI4
+LABELV $423
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+ADDRLP4 1144
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+INDIRI4
+CNSTI4 27
+NEI4 $425
+ADDRLP4 1152
+CNSTI4 1
+ASGNI4
+ADDRGP4 $426
+JUMPV
+LABELV $425
+ADDRLP4 1152
+CNSTI4 0
+ASGNI4
+LABELV $426
+ADDRFP4 0
+INDIRP4
+CNSTI4 5076
+ADDP4
+ADDRLP4 1152
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $428
+ADDRLP4 1160
+CNSTI4 1
+ASGNI4
+ADDRGP4 $429
+JUMPV
+LABELV $428
+ADDRLP4 1160
+CNSTI4 0
+ASGNI4
+LABELV $429
+ADDRFP4 0
+INDIRP4
+CNSTI4 5092
+ADDP4
+ADDRLP4 1160
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $431
+ADDRLP4 1168
+CNSTI4 1
+ASGNI4
+ADDRGP4 $432
+JUMPV
+LABELV $431
+ADDRLP4 1168
+CNSTI4 0
+ASGNI4
+LABELV $432
+ADDRFP4 0
+INDIRP4
+CNSTI4 5096
+ADDP4
+ADDRLP4 1168
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $434
+ADDRLP4 1176
+CNSTI4 1
+ASGNI4
+ADDRGP4 $435
+JUMPV
+LABELV $434
+ADDRLP4 1176
+CNSTI4 0
+ASGNI4
+LABELV $435
+ADDRFP4 0
+INDIRP4
+CNSTI4 5100
+ADDP4
+ADDRLP4 1176
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $437
+ADDRLP4 1184
+CNSTI4 1
+ASGNI4
+ADDRGP4 $438
+JUMPV
+LABELV $437
+ADDRLP4 1184
+CNSTI4 0
+ASGNI4
+LABELV $438
+ADDRFP4 0
+INDIRP4
+CNSTI4 5104
+ADDP4
+ADDRLP4 1184
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $440
+ADDRLP4 1192
+CNSTI4 1
+ASGNI4
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRLP4 1192
+CNSTI4 0
+ASGNI4
+LABELV $441
+ADDRFP4 0
+INDIRP4
+CNSTI4 5108
+ADDP4
+ADDRLP4 1192
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 352
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $443
+ADDRLP4 1200
+CNSTI4 1
+ASGNI4
+ADDRGP4 $444
+JUMPV
+LABELV $443
+ADDRLP4 1200
+CNSTI4 0
+ASGNI4
+LABELV $444
+ADDRFP4 0
+INDIRP4
+CNSTI4 5112
+ADDP4
+ADDRLP4 1200
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 356
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $446
+ADDRLP4 1208
+CNSTI4 1
+ASGNI4
+ADDRGP4 $447
+JUMPV
+LABELV $446
+ADDRLP4 1208
+CNSTI4 0
+ASGNI4
+LABELV $447
+ADDRFP4 0
+INDIRP4
+CNSTI4 5132
+ADDP4
+ADDRLP4 1208
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 360
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $449
+ADDRLP4 1216
+CNSTI4 1
+ASGNI4
+ADDRGP4 $450
+JUMPV
+LABELV $449
+ADDRLP4 1216
+CNSTI4 0
+ASGNI4
+LABELV $450
+ADDRFP4 0
+INDIRP4
+CNSTI4 5136
+ADDP4
+ADDRLP4 1216
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckItemPickup
+CALLV
+pop
+LABELV $390
+endproc BotUpdateInventory 1224 12
+export BotUpdateBattleInventory
+proc BotUpdateBattleInventory 160 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5756
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5752
+ADDP4
+ADDRLP4 156
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $451
+endproc BotUpdateBattleInventory 160 8
+export BotBattleUseItems
+proc BotBattleUseItems 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $462
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $464
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $466
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $466
+LABELV $464
+LABELV $462
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $468
+ADDRFP4 0
+INDIRP4
+CNSTI4 5076
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $470
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $470
+LABELV $468
+LABELV $461
+endproc BotBattleUseItems 4 4
+export BotSetTeleportTime
+proc BotSetTeleportTime 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRI4
+BXORI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $473
+ADDRFP4 0
+INDIRP4
+CNSTI4 6180
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $473
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $472
+endproc BotSetTeleportTime 8 0
+export BotIsDead
+proc BotIsDead 4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $477
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $478
+JUMPV
+LABELV $477
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $478
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $475
+endproc BotIsDead 4 0
+export BotIsObserver
+proc BotIsObserver 1032 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $480
+CNSTI4 1
+RETI4
+ADDRGP4 $479
+JUMPV
+LABELV $480
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $68
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 3
+NEI4 $482
+CNSTI4 1
+RETI4
+ADDRGP4 $479
+JUMPV
+LABELV $482
+CNSTI4 0
+RETI4
+LABELV $479
+endproc BotIsObserver 1032 12
+export BotIntermission
+proc BotIntermission 8 0
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $485
+CNSTI4 1
+RETI4
+ADDRGP4 $484
+JUMPV
+LABELV $485
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+EQI4 $491
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+NEI4 $489
+LABELV $491
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $490
+JUMPV
+LABELV $489
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $490
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $484
+endproc BotIntermission 8 0
+export BotInLavaOrSlime
+proc BotInLavaOrSlime 16 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1102577664
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 24
+BANDI4
+RETI4
+LABELV $492
+endproc BotInLavaOrSlime 16 4
+lit
+align 4
+LABELV $495
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $496
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotCreateWayPoint
+code
+proc BotCreateWayPoint 32 12
+ADDRLP4 4
+ADDRGP4 $495
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRGP4 $496
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $497
+CNSTI4 2
+ARGI4
+ADDRGP4 $499
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $494
+JUMPV
+LABELV $497
+ADDRLP4 28
+ADDRGP4 botai_freewaypoints
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $494
+endproc BotCreateWayPoint 32 12
+export BotFindWayPoint
+proc BotFindWayPoint 8 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $504
+JUMPV
+LABELV $501
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $505
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $500
+JUMPV
+LABELV $505
+LABELV $502
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $504
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $501
+CNSTP4 0
+RETP4
+LABELV $500
+endproc BotFindWayPoint 8 8
+export BotFreeWaypoints
+proc BotFreeWaypoints 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $511
+JUMPV
+LABELV $508
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRGP4 botai_freewaypoints
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $509
+ADDRFP4 0
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $511
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $508
+LABELV $507
+endproc BotFreeWaypoints 8 0
+export BotInitWaypoints
+proc BotInitWaypoints 4 0
+ADDRGP4 botai_freewaypoints
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $513
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botai_waypoints+92
+ADDP4
+ADDRGP4 botai_freewaypoints
+INDIRP4
+ASGNP4
+ADDRGP4 botai_freewaypoints
+CNSTI4 100
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botai_waypoints
+ADDP4
+ASGNP4
+LABELV $514
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $513
+LABELV $512
+endproc BotInitWaypoints 4 0
+export TeamPlayIsOn
+proc TeamPlayIsOn 4 0
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+LTI4 $520
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $520
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $521
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $518
+endproc TeamPlayIsOn 4 0
+export BotAggression
+proc BotAggression 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5092
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $523
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $527
+ADDRFP4 0
+INDIRP4
+CNSTI4 5752
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $525
+LABELV $527
+CNSTF4 1116471296
+RETF4
+ADDRGP4 $522
+JUMPV
+LABELV $525
+LABELV $523
+ADDRFP4 0
+INDIRP4
+CNSTI4 5756
+ADDP4
+INDIRI4
+CNSTI4 200
+LEI4 $528
+CNSTF4 0
+RETF4
+ADDRGP4 $522
+JUMPV
+LABELV $528
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $530
+CNSTF4 0
+RETF4
+ADDRGP4 $522
+JUMPV
+LABELV $530
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $532
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $534
+CNSTF4 0
+RETF4
+ADDRGP4 $522
+JUMPV
+LABELV $534
+LABELV $532
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $536
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $536
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $522
+JUMPV
+LABELV $536
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $538
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $538
+CNSTF4 1119748096
+RETF4
+ADDRGP4 $522
+JUMPV
+LABELV $538
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $540
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $540
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $522
+JUMPV
+LABELV $540
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $542
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $542
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $522
+JUMPV
+LABELV $542
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $544
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $544
+CNSTF4 1118437376
+RETF4
+ADDRGP4 $522
+JUMPV
+LABELV $544
+ADDRFP4 0
+INDIRP4
+CNSTI4 4980
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $546
+ADDRFP4 0
+INDIRP4
+CNSTI4 5032
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $546
+CNSTF4 1117782016
+RETF4
+ADDRGP4 $522
+JUMPV
+LABELV $546
+ADDRFP4 0
+INDIRP4
+CNSTI4 4972
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $548
+ADDRFP4 0
+INDIRP4
+CNSTI4 5024
+ADDP4
+INDIRI4
+CNSTI4 10
+LEI4 $548
+CNSTF4 1112014848
+RETF4
+ADDRGP4 $522
+JUMPV
+LABELV $548
+CNSTF4 0
+RETF4
+LABELV $522
+endproc BotAggression 28 0
+export BotFeelingBad
+proc BotFeelingBad 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $551
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $550
+JUMPV
+LABELV $551
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $553
+CNSTF4 1120403456
+RETF4
+ADDRGP4 $550
+JUMPV
+LABELV $553
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $555
+CNSTF4 1119092736
+RETF4
+ADDRGP4 $550
+JUMPV
+LABELV $555
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $557
+CNSTF4 1117782016
+RETF4
+ADDRGP4 $550
+JUMPV
+LABELV $557
+CNSTF4 0
+RETF4
+LABELV $550
+endproc BotFeelingBad 0 0
+export BotWantsToRetreat
+proc BotWantsToRetreat 144 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $560
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $562
+CNSTI4 1
+RETI4
+ADDRGP4 $559
+JUMPV
+LABELV $562
+LABELV $560
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $564
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 140
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $566
+CNSTI4 0
+RETI4
+ADDRGP4 $559
+JUMPV
+LABELV $566
+LABELV $564
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $568
+CNSTI4 1
+RETI4
+ADDRGP4 $559
+JUMPV
+LABELV $568
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1112014848
+GEF4 $570
+CNSTI4 1
+RETI4
+ADDRGP4 $559
+JUMPV
+LABELV $570
+CNSTI4 0
+RETI4
+LABELV $559
+endproc BotWantsToRetreat 144 8
+export BotWantsToChase
+proc BotWantsToChase 148 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $573
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $575
+CNSTI4 0
+RETI4
+ADDRGP4 $572
+JUMPV
+LABELV $575
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $577
+CNSTI4 1
+RETI4
+ADDRGP4 $572
+JUMPV
+LABELV $577
+LABELV $573
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+CNSTI4 4
+NEI4 $579
+CNSTI4 0
+RETI4
+ADDRGP4 $572
+JUMPV
+LABELV $579
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1112014848
+LEF4 $581
+CNSTI4 1
+RETI4
+ADDRGP4 $572
+JUMPV
+LABELV $581
+CNSTI4 0
+RETI4
+LABELV $572
+endproc BotWantsToChase 148 8
+export BotWantsToHelp
+proc BotWantsToHelp 0 0
+CNSTI4 1
+RETI4
+LABELV $583
+endproc BotWantsToHelp 0 0
+export BotCanAndWantsToRocketJump
+proc BotCanAndWantsToRocketJump 8 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 bot_rocketjump+12
+INDIRI4
+CNSTI4 0
+NEI4 $585
+CNSTI4 0
+RETI4
+ADDRGP4 $584
+JUMPV
+LABELV $585
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $588
+CNSTI4 0
+RETI4
+ADDRGP4 $584
+JUMPV
+LABELV $588
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+CNSTI4 3
+GEI4 $590
+CNSTI4 0
+RETI4
+ADDRGP4 $584
+JUMPV
+LABELV $590
+ADDRFP4 0
+INDIRP4
+CNSTI4 5092
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $592
+CNSTI4 0
+RETI4
+ADDRGP4 $584
+JUMPV
+LABELV $592
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $594
+CNSTI4 0
+RETI4
+ADDRGP4 $584
+JUMPV
+LABELV $594
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 90
+GEI4 $596
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $598
+CNSTI4 0
+RETI4
+ADDRGP4 $584
+JUMPV
+LABELV $598
+LABELV $596
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 38
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 4
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1056964608
+GEF4 $600
+CNSTI4 0
+RETI4
+ADDRGP4 $584
+JUMPV
+LABELV $600
+CNSTI4 1
+RETI4
+LABELV $584
+endproc BotCanAndWantsToRocketJump 8 16
+export BotHasPersistantPowerupAndWeapon
+proc BotHasPersistantPowerupAndWeapon 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 60
+GEI4 $603
+CNSTI4 0
+RETI4
+ADDRGP4 $602
+JUMPV
+LABELV $603
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+CNSTI4 80
+GEI4 $605
+ADDRFP4 0
+INDIRP4
+CNSTI4 4956
+ADDP4
+INDIRI4
+CNSTI4 40
+GEI4 $607
+CNSTI4 0
+RETI4
+ADDRGP4 $602
+JUMPV
+LABELV $607
+LABELV $605
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $609
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $609
+CNSTI4 1
+RETI4
+ADDRGP4 $602
+JUMPV
+LABELV $609
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $611
+CNSTI4 1
+RETI4
+ADDRGP4 $602
+JUMPV
+LABELV $611
+ADDRFP4 0
+INDIRP4
+CNSTI4 4988
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $613
+ADDRFP4 0
+INDIRP4
+CNSTI4 5040
+ADDP4
+INDIRI4
+CNSTI4 50
+LEI4 $613
+CNSTI4 1
+RETI4
+ADDRGP4 $602
+JUMPV
+LABELV $613
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $615
+ADDRFP4 0
+INDIRP4
+CNSTI4 5044
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $615
+CNSTI4 1
+RETI4
+ADDRGP4 $602
+JUMPV
+LABELV $615
+ADDRFP4 0
+INDIRP4
+CNSTI4 5012
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $617
+ADDRFP4 0
+INDIRP4
+CNSTI4 5056
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $617
+CNSTI4 1
+RETI4
+ADDRGP4 $602
+JUMPV
+LABELV $617
+ADDRFP4 0
+INDIRP4
+CNSTI4 5016
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $619
+ADDRFP4 0
+INDIRP4
+CNSTI4 5060
+ADDP4
+INDIRI4
+CNSTI4 5
+LEI4 $619
+CNSTI4 1
+RETI4
+ADDRGP4 $602
+JUMPV
+LABELV $619
+ADDRFP4 0
+INDIRP4
+CNSTI4 5020
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $621
+ADDRFP4 0
+INDIRP4
+CNSTI4 5064
+ADDP4
+INDIRI4
+CNSTI4 40
+LEI4 $621
+CNSTI4 1
+RETI4
+ADDRGP4 $602
+JUMPV
+LABELV $621
+ADDRFP4 0
+INDIRP4
+CNSTI4 4996
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $623
+ADDRFP4 0
+INDIRP4
+CNSTI4 5036
+ADDP4
+INDIRI4
+CNSTI4 20
+LEI4 $623
+CNSTI4 1
+RETI4
+ADDRGP4 $602
+JUMPV
+LABELV $623
+CNSTI4 0
+RETI4
+LABELV $602
+endproc BotHasPersistantPowerupAndWeapon 32 0
+export BotGoCamp
+proc BotGoCamp 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6608
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6740
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6624
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 44
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065185444
+LEF4 $626
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1203982208
+ADDF4
+ASGNF4
+ADDRGP4 $627
+JUMPV
+LABELV $626
+ADDRLP4 12
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6744
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+CNSTF4 1127481344
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1097859072
+ADDRLP4 12
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $627
+ADDRFP4 0
+INDIRP4
+CNSTI4 6184
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6172
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $625
+endproc BotGoCamp 16 16
+export BotWantsToCamp
+proc BotWantsToCamp 176 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 44
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 128
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 128
+INDIRF4
+ASGNF4
+ADDRLP4 124
+INDIRF4
+CNSTF4 1036831949
+GEF4 $629
+CNSTI4 0
+RETI4
+ADDRGP4 $628
+JUMPV
+LABELV $629
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+EQI4 $639
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+EQI4 $639
+ADDRLP4 132
+INDIRI4
+CNSTI4 3
+EQI4 $639
+ADDRLP4 132
+INDIRI4
+CNSTI4 4
+EQI4 $639
+ADDRLP4 132
+INDIRI4
+CNSTI4 5
+EQI4 $639
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+EQI4 $639
+ADDRLP4 132
+INDIRI4
+CNSTI4 8
+EQI4 $639
+ADDRLP4 132
+INDIRI4
+CNSTI4 9
+NEI4 $631
+LABELV $639
+CNSTI4 0
+RETI4
+ADDRGP4 $628
+JUMPV
+LABELV $631
+ADDRFP4 0
+INDIRP4
+CNSTI4 6184
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1114636288
+SUBF4
+CNSTF4 1133903872
+CNSTF4 1065353216
+ADDRLP4 124
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+LEF4 $640
+CNSTI4 0
+RETI4
+ADDRGP4 $628
+JUMPV
+LABELV $640
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 124
+INDIRF4
+LEF4 $642
+ADDRFP4 0
+INDIRP4
+CNSTI4 6184
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 0
+RETI4
+ADDRGP4 $628
+JUMPV
+LABELV $642
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotAggression
+CALLF4
+ASGNF4
+ADDRLP4 140
+INDIRF4
+CNSTF4 1112014848
+GEF4 $644
+CNSTI4 0
+RETI4
+ADDRGP4 $628
+JUMPV
+LABELV $644
+ADDRLP4 148
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4984
+ADDP4
+INDIRI4
+ADDRLP4 148
+INDIRI4
+LEI4 $648
+ADDRFP4 0
+INDIRP4
+CNSTI4 4952
+ADDP4
+INDIRI4
+ADDRLP4 148
+INDIRI4
+EQI4 $646
+LABELV $648
+ADDRFP4 0
+INDIRP4
+CNSTI4 4992
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $649
+ADDRFP4 0
+INDIRP4
+CNSTI4 5048
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $646
+LABELV $649
+ADDRFP4 0
+INDIRP4
+CNSTI4 5004
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $650
+ADDRFP4 0
+INDIRP4
+CNSTI4 5052
+ADDP4
+INDIRI4
+CNSTI4 10
+GEI4 $646
+LABELV $650
+CNSTI4 0
+RETI4
+ADDRGP4 $628
+JUMPV
+LABELV $646
+ADDRLP4 64
+CNSTI4 99999
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 160
+ADDRGP4 trap_BotGetNextCampSpotGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRGP4 $654
+JUMPV
+LABELV $651
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 8+12
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 168
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 168
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $656
+ADDRLP4 0
+INDIRI4
+ADDRLP4 64
+INDIRI4
+GEI4 $656
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $656
+LABELV $652
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 164
+ADDRGP4 trap_BotGetNextCampSpotGoal
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 164
+INDIRI4
+ASGNI4
+LABELV $654
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $651
+ADDRLP4 64
+INDIRI4
+CNSTI4 150
+LEI4 $658
+CNSTI4 0
+RETI4
+ADDRGP4 $628
+JUMPV
+LABELV $658
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRGP4 BotGoCamp
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6612
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $628
+endproc BotWantsToCamp 176 16
+export BotDontAvoid
+proc BotDontAvoid 68 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $662
+JUMPV
+LABELV $661
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4+44
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveFromAvoidGoals
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $662
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $661
+LABELV $660
+endproc BotDontAvoid 68 12
+export BotGoForPowerups
+proc BotGoForPowerups 0 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $666
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $667
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $668
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $669
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $670
+ARGP4
+ADDRGP4 BotDontAvoid
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $665
+endproc BotGoForPowerups 0 8
+export BotRoamGoal
+proc BotRoamGoal 180 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+LABELV $672
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 136
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 112
+ADDRLP4 136
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ASGNF4
+ADDRLP4 112
+INDIRF4
+CNSTF4 1048576000
+LEF4 $676
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $678
+ADDRLP4 144
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 144
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $679
+JUMPV
+LABELV $678
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 148
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $679
+LABELV $676
+ADDRLP4 112
+INDIRF4
+CNSTF4 1061158912
+GEF4 $680
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+GEF4 $682
+ADDRLP4 144
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 144
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+SUBF4
+ASGNF4
+ADDRGP4 $683
+JUMPV
+LABELV $682
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1145569280
+ADDRLP4 148
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+CNSTF4 1120403456
+ADDF4
+ADDF4
+ASGNF4
+LABELV $683
+LABELV $680
+ADDRLP4 140
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1119879168
+CNSTF4 1073741824
+ADDRLP4 140
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 148
+CNSTP4 0
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 148
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 24+12
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24+12+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24+12+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 108
+ADDRLP4 156
+INDIRF4
+ASGNF4
+ADDRLP4 108
+INDIRF4
+CNSTF4 1128792064
+LEF4 $694
+ADDRLP4 164
+CNSTF4 1109393408
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+ADDRLP4 164
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 108
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+MULF4
+CNSTF4 1109393408
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 120
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 120+4
+ADDRLP4 12+4
+INDIRF4
+ASGNF4
+ADDRLP4 120+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1145569280
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 172
+CNSTP4 0
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 172
+INDIRP4
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 24+4
+INDIRI4
+CNSTI4 0
+NEI4 $711
+ADDRLP4 24+12+8
+ADDRLP4 24+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 24+12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 176
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 176
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 24
+BANDI4
+CNSTI4 0
+NEI4 $717
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRGP4 $671
+JUMPV
+LABELV $717
+LABELV $711
+LABELV $694
+LABELV $673
+ADDRLP4 116
+ADDRLP4 116
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 10
+LTI4 $672
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $671
+endproc BotRoamGoal 180 28
+lit
+align 4
+LABELV $721
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotAttackMove
+code
+proc BotAttackMove 400 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRGP4 $721
+INDIRB
+ASGNB 12
+ADDRLP4 332
+ADDRFP4 4
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6124
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $722
+ADDRLP4 136+40
+ADDRLP4 332
+INDIRI4
+ASGNI4
+ADDRLP4 136+12
+ADDRFP4 4
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+CNSTI4 6548
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 136+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 136+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 136+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 136+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 80
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveToGoal
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $719
+JUMPV
+LABELV $722
+ADDRLP4 80
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 52
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 352
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 37
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 356
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 340
+ADDRLP4 356
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 36
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 360
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 344
+ADDRLP4 360
+INDIRF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1045220557
+GEF4 $736
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $719
+JUMPV
+LABELV $736
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetupForMovement
+CALLV
+pop
+ADDRLP4 332
+INDIRI4
+ARGI4
+ADDRLP4 192
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 24
+ADDRLP4 192+24
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 192+24+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 192+24+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 368
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 368
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+4
+ADDRLP4 24+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 36+8
+ADDRLP4 24+8
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $749
+ADDRLP4 372
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 340
+INDIRF4
+GEF4 $751
+ADDRLP4 52
+CNSTI4 4
+ASGNI4
+ADDRGP4 $752
+JUMPV
+LABELV $751
+ADDRFP4 4
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $753
+ADDRLP4 376
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 376
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 344
+INDIRF4
+GEF4 $753
+ADDRFP4 4
+INDIRP4
+CNSTI4 6120
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 344
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $753
+LABELV $752
+LABELV $749
+ADDRFP4 4
+INDIRP4
+CNSTI4 6120
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $755
+ADDRLP4 52
+CNSTI4 2
+ASGNI4
+LABELV $755
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+NEI4 $757
+ADDRFP4 4
+INDIRP4
+CNSTI4 6128
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $759
+ADDRLP4 52
+CNSTI4 1
+ASGNI4
+ADDRGP4 $760
+JUMPV
+LABELV $759
+ADDRFP4 4
+INDIRP4
+CNSTI4 6128
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $760
+LABELV $757
+ADDRFP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $761
+ADDRLP4 372
+CNSTF4 0
+ASGNF4
+ADDRLP4 72
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRGP4 $762
+JUMPV
+LABELV $761
+ADDRLP4 72
+CNSTF4 1124859904
+ASGNF4
+ADDRLP4 76
+CNSTF4 1109393408
+ASGNF4
+LABELV $762
+ADDRLP4 132
+INDIRF4
+CNSTF4 1053609165
+GTF4 $763
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+LEF4 $765
+ADDRFP4 4
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+EQI4 $767
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $719
+JUMPV
+LABELV $767
+LABELV $765
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+GEF4 $769
+ADDRFP4 4
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 372
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 372
+INDIRI4
+CNSTI4 0
+EQI4 $771
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $719
+JUMPV
+LABELV $771
+LABELV $769
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $719
+JUMPV
+LABELV $763
+ADDRLP4 376
+ADDRFP4 4
+INDIRP4
+CNSTI4 6116
+ADDP4
+ASGNP4
+ADDRLP4 376
+INDIRP4
+ADDRLP4 376
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4904
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 336
+CNSTF4 1045220557
+CNSTF4 1065353216
+ADDRLP4 132
+INDIRF4
+SUBF4
+MULF4
+CNSTF4 1053609165
+ADDF4
+ASGNF4
+ADDRLP4 132
+INDIRF4
+CNSTF4 1060320051
+LEF4 $773
+ADDRLP4 384
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 336
+ADDRLP4 336
+INDIRF4
+CNSTF4 1045220557
+CNSTF4 1073741824
+ADDRLP4 384
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $773
+ADDRFP4 4
+INDIRP4
+CNSTI4 6116
+ADDP4
+INDIRF4
+ADDRLP4 336
+INDIRF4
+LEF4 $775
+ADDRLP4 388
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1064262697
+LEF4 $777
+ADDRLP4 392
+ADDRFP4 4
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 392
+INDIRP4
+ADDRLP4 392
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6116
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $777
+LABELV $775
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+LABELV $779
+ADDRLP4 12
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 24+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $786
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $786
+ADDRLP4 388
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1063675494
+LEF4 $792
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $793
+JUMPV
+LABELV $792
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+ADDF4
+LEF4 $800
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $801
+JUMPV
+LABELV $800
+ADDRLP4 68
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 76
+INDIRF4
+SUBF4
+GEF4 $808
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $808
+LABELV $801
+LABELV $793
+ADDRFP4 4
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 392
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 392
+INDIRI4
+CNSTI4 0
+EQI4 $816
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+ADDRGP4 $719
+JUMPV
+LABELV $816
+ADDRLP4 396
+ADDRFP4 4
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 396
+INDIRP4
+ADDRLP4 396
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 6116
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $780
+ADDRLP4 48
+ADDRLP4 48
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LTI4 $779
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRB
+ASGNB 52
+LABELV $719
+endproc BotAttackMove 400 16
+export BotSameTeam
+proc BotSameTeam 2072 12
+ADDRLP4 2048
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 2048
+INDIRI4
+CNSTI4 0
+LTI4 $821
+ADDRLP4 2048
+INDIRI4
+CNSTI4 64
+LTI4 $819
+LABELV $821
+CNSTI4 0
+RETI4
+ADDRGP4 $818
+JUMPV
+LABELV $819
+ADDRLP4 2052
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 0
+LTI4 $824
+ADDRLP4 2052
+INDIRI4
+CNSTI4 64
+LTI4 $822
+LABELV $824
+CNSTI4 0
+RETI4
+ADDRGP4 $818
+JUMPV
+LABELV $822
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+LTI4 $825
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $68
+ARGP4
+ADDRLP4 2056
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2056
+INDIRP4
+ARGP4
+ADDRLP4 2060
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1024
+ARGP4
+ADDRGP4 $68
+ARGP4
+ADDRLP4 2064
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2064
+INDIRP4
+ARGP4
+ADDRLP4 2068
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+ADDRLP4 2068
+INDIRI4
+NEI4 $827
+CNSTI4 1
+RETI4
+ADDRGP4 $818
+JUMPV
+LABELV $827
+LABELV $825
+CNSTI4 0
+RETI4
+LABELV $818
+endproc BotSameTeam 2072 12
+export InFieldOfVision
+proc InFieldOfVision 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $830
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $834
+ADDRLP4 4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $835
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $835
+JUMPV
+LABELV $834
+ADDRLP4 4
+INDIRF4
+CNSTF4 3274964992
+GEF4 $838
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $838
+LABELV $835
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+LEF4 $840
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+LEF4 $841
+CNSTI4 0
+RETI4
+ADDRGP4 $829
+JUMPV
+LABELV $840
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+NEGF4
+MULF4
+GEF4 $844
+CNSTI4 0
+RETI4
+ADDRGP4 $829
+JUMPV
+LABELV $844
+LABELV $841
+LABELV $831
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $830
+CNSTI4 1
+RETI4
+LABELV $829
+endproc InFieldOfVision 32 4
+export BotEntityVisible
+proc BotEntityVisible 380 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 148
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 84
+ADDRLP4 148+72
+INDIRF4
+ADDRLP4 148+84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 148+72+4
+INDIRF4
+ADDRLP4 148+84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 148+72+8
+INDIRF4
+ADDRLP4 148+84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 332
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 84
+ADDRLP4 332
+INDIRF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 332
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84+8
+CNSTF4 1056964608
+ADDRLP4 84+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 148+24
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+4
+ADDRLP4 148+24+4
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84+8
+ADDRLP4 148+24+8
+INDIRF4
+ADDRLP4 84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 84
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRLP4 84+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRLP4 84+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 320
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRF4
+ARGF4
+ADDRLP4 320
+ARGP4
+ADDRLP4 340
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+CNSTI4 0
+NEI4 $876
+CNSTF4 0
+RETF4
+ADDRGP4 $846
+JUMPV
+LABELV $876
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 344
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 316
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRLP4 312
+ADDRLP4 316
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 308
+ADDRLP4 316
+INDIRI4
+CNSTI4 56
+BANDI4
+ASGNI4
+ADDRLP4 296
+CNSTF4 0
+ASGNF4
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+LABELV $878
+ADDRLP4 96
+CNSTI4 65537
+ASGNI4
+ADDRLP4 116
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 104
+ADDRLP4 84
+INDIRB
+ASGNB 12
+ADDRLP4 84
+ARGP4
+ADDRLP4 352
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $882
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 56
+BORI4
+ASGNI4
+LABELV $882
+ADDRLP4 308
+INDIRI4
+CNSTI4 0
+EQI4 $884
+ADDRLP4 96
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+NEI4 $886
+ADDRLP4 116
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 84
+INDIRB
+ASGNB 12
+ADDRLP4 104
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+LABELV $886
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 56
+BXORI4
+ASGNI4
+LABELV $884
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRLP4 356
+CNSTP4 0
+ASGNP4
+ADDRLP4 356
+INDIRP4
+ARGP4
+ADDRLP4 356
+INDIRP4
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 288
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 0+76
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $888
+ADDRLP4 96
+ADDRLP4 96
+INDIRI4
+CNSTI4 -57
+BANDI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 360
+CNSTP4 0
+ASGNP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+ADDRLP4 360
+INDIRP4
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 116
+INDIRI4
+ARGI4
+ADDRLP4 96
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 288
+CNSTF4 1056964608
+ASGNF4
+LABELV $891
+LABELV $888
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $898
+ADDRLP4 0+80
+INDIRI4
+ADDRLP4 132
+INDIRI4
+NEI4 $894
+LABELV $898
+ADDRLP4 84
+ARGP4
+ADDRLP4 360
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 304
+ADDRLP4 360
+INDIRI4
+CNSTI4 64
+BANDI4
+ASGNI4
+ADDRLP4 364
+CNSTI4 0
+ASGNI4
+ADDRLP4 312
+INDIRI4
+ADDRLP4 364
+INDIRI4
+EQI4 $899
+ADDRLP4 304
+INDIRI4
+ADDRLP4 364
+INDIRI4
+EQI4 $899
+ADDRLP4 136
+ADDRLP4 0+12
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRLP4 0+12+4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRLP4 0+12+8
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 372
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 300
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRGP4 $900
+JUMPV
+LABELV $899
+ADDRLP4 312
+INDIRI4
+CNSTI4 0
+EQI4 $908
+ADDRLP4 120
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRLP4 120
+ARGP4
+ADDRLP4 368
+CNSTP4 0
+ASGNP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 376
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 300
+ADDRLP4 376
+INDIRF4
+ASGNF4
+ADDRGP4 $909
+JUMPV
+LABELV $908
+ADDRLP4 304
+INDIRI4
+CNSTI4 0
+EQI4 $918
+ADDRLP4 104
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 368
+CNSTP4 0
+ASGNP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+ADDRLP4 368
+INDIRP4
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 136
+ADDRLP4 104
+INDIRF4
+ADDRLP4 0+12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+4
+ADDRLP4 104+4
+INDIRF4
+ADDRLP4 0+12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136+8
+ADDRLP4 104+8
+INDIRF4
+ADDRLP4 0+12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+ARGP4
+ADDRLP4 372
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 300
+ADDRLP4 372
+INDIRF4
+ASGNF4
+ADDRGP4 $919
+JUMPV
+LABELV $918
+ADDRLP4 300
+CNSTF4 0
+ASGNF4
+LABELV $919
+LABELV $909
+LABELV $900
+ADDRLP4 372
+CNSTF4 1065353216
+ASGNF4
+CNSTF4 981668463
+ADDRLP4 300
+INDIRF4
+MULF4
+ADDRLP4 372
+INDIRF4
+GEF4 $931
+ADDRLP4 368
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $932
+JUMPV
+LABELV $931
+ADDRLP4 368
+CNSTF4 981668463
+ADDRLP4 300
+INDIRF4
+MULF4
+ASGNF4
+LABELV $932
+ADDRLP4 292
+ADDRLP4 372
+INDIRF4
+ADDRLP4 368
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 292
+INDIRF4
+ADDRLP4 288
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 292
+INDIRF4
+ADDRLP4 296
+INDIRF4
+LEF4 $933
+ADDRLP4 296
+ADDRLP4 292
+INDIRF4
+ASGNF4
+LABELV $933
+ADDRLP4 296
+INDIRF4
+CNSTF4 1064514355
+LTF4 $935
+ADDRLP4 296
+INDIRF4
+RETF4
+ADDRGP4 $846
+JUMPV
+LABELV $935
+LABELV $894
+ADDRLP4 100
+INDIRI4
+CNSTI4 0
+NEI4 $937
+ADDRLP4 84+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 148+72+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $938
+JUMPV
+LABELV $937
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+NEI4 $942
+ADDRLP4 84+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 148+84+8
+INDIRF4
+ADDRLP4 148+72+8
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+LABELV $942
+LABELV $938
+LABELV $879
+ADDRLP4 100
+ADDRLP4 100
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+CNSTI4 3
+LTI4 $878
+ADDRLP4 296
+INDIRF4
+RETF4
+LABELV $846
+endproc BotEntityVisible 380 28
+export BotFindEnemy
+proc BotFindEnemy 432 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 46
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 336
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 164
+ADDRLP4 336
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 45
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 340
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 176
+ADDRLP4 340
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5988
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+LEI4 $951
+ADDRLP4 344
+CNSTI4 1
+ASGNI4
+ADDRGP4 $952
+JUMPV
+LABELV $951
+ADDRLP4 344
+CNSTI4 0
+ASGNI4
+LABELV $952
+ADDRLP4 160
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5988
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $953
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 196
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 196
+ARGP4
+ADDRLP4 356
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+EQI4 $955
+CNSTI4 0
+RETI4
+ADDRGP4 $949
+JUMPV
+LABELV $955
+ADDRLP4 144
+ADDRLP4 196+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 196+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 196+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 364
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 192
+ADDRLP4 364
+INDIRF4
+ASGNF4
+ADDRGP4 $954
+JUMPV
+LABELV $953
+ADDRLP4 192
+CNSTF4 0
+ASGNF4
+LABELV $954
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 $967
+JUMPV
+LABELV $964
+ADDRLP4 140
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $968
+ADDRGP4 $965
+JUMPV
+LABELV $968
+ADDRLP4 140
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $970
+ADDRGP4 $965
+JUMPV
+LABELV $970
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $972
+ADDRGP4 $965
+JUMPV
+LABELV $972
+ADDRLP4 0
+ARGP4
+ADDRLP4 356
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 356
+INDIRI4
+CNSTI4 0
+NEI4 $977
+ADDRLP4 0+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $974
+LABELV $977
+ADDRGP4 $965
+JUMPV
+LABELV $974
+ADDRLP4 0
+ARGP4
+ADDRLP4 360
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 360
+INDIRI4
+CNSTI4 0
+EQI4 $978
+ADDRLP4 0
+ARGP4
+ADDRLP4 364
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 364
+INDIRI4
+CNSTI4 0
+NEI4 $978
+ADDRGP4 $965
+JUMPV
+LABELV $978
+ADDRLP4 176
+INDIRF4
+CNSTF4 1056964608
+GEF4 $980
+ADDRLP4 0
+ARGP4
+ADDRLP4 368
+ADDRGP4 EntityIsChatting
+CALLI4
+ASGNI4
+ADDRLP4 368
+INDIRI4
+CNSTI4 0
+EQI4 $980
+ADDRGP4 $965
+JUMPV
+LABELV $980
+ADDRGP4 lastteleport_time
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+LEF4 $982
+ADDRLP4 144
+ADDRLP4 0+24
+INDIRF4
+ADDRGP4 lastteleport_origin
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRGP4 lastteleport_origin+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRGP4 lastteleport_origin+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 372
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 372
+INDIRF4
+CNSTF4 1167663104
+GEF4 $993
+ADDRGP4 $965
+JUMPV
+LABELV $993
+LABELV $982
+ADDRLP4 144
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 376
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 376
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 380
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 380
+INDIRI4
+CNSTI4 0
+NEI4 $1002
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1004
+ADDRLP4 156
+INDIRF4
+ADDRLP4 192
+INDIRF4
+LEF4 $1004
+ADDRGP4 $965
+JUMPV
+LABELV $1004
+LABELV $1002
+ADDRLP4 384
+CNSTF4 1165623296
+ADDRLP4 164
+INDIRF4
+MULF4
+CNSTF4 1147207680
+ADDF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+ADDRLP4 384
+INDIRF4
+ADDRLP4 384
+INDIRF4
+MULF4
+LEF4 $1006
+ADDRGP4 $965
+JUMPV
+LABELV $1006
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 388
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 388
+INDIRI4
+CNSTI4 0
+EQI4 $1008
+ADDRGP4 $965
+JUMPV
+LABELV $1008
+ADDRLP4 392
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 392
+INDIRI4
+GEI4 $1010
+ADDRLP4 160
+INDIRI4
+ADDRLP4 392
+INDIRI4
+NEI4 $1012
+ADDRLP4 0
+ARGP4
+ADDRLP4 396
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 396
+INDIRI4
+CNSTI4 0
+EQI4 $1010
+LABELV $1012
+ADDRLP4 168
+CNSTF4 1135869952
+ASGNF4
+ADDRGP4 $1011
+JUMPV
+LABELV $1010
+ADDRLP4 156
+INDIRF4
+CNSTF4 1226845760
+LEF4 $1014
+ADDRLP4 400
+CNSTF4 1226845760
+ASGNF4
+ADDRGP4 $1015
+JUMPV
+LABELV $1014
+ADDRLP4 400
+ADDRLP4 156
+INDIRF4
+ASGNF4
+LABELV $1015
+ADDRLP4 168
+CNSTF4 1127481344
+CNSTF4 1119092736
+ADDRLP4 400
+INDIRF4
+CNSTF4 1172557824
+DIVF4
+SUBF4
+SUBF4
+ASGNF4
+LABELV $1011
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+ADDRLP4 168
+INDIRF4
+ARGF4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 408
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 172
+ADDRLP4 408
+INDIRF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+CNSTF4 0
+GTF4 $1016
+ADDRGP4 $965
+JUMPV
+LABELV $1016
+ADDRLP4 412
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 412
+INDIRI4
+GEI4 $1018
+ADDRLP4 156
+INDIRF4
+CNSTF4 1176256512
+LEF4 $1018
+ADDRLP4 160
+INDIRI4
+ADDRLP4 412
+INDIRI4
+NEI4 $1018
+ADDRLP4 0
+ARGP4
+ADDRLP4 416
+ADDRGP4 EntityIsShooting
+CALLI4
+ASGNI4
+ADDRLP4 416
+INDIRI4
+CNSTI4 0
+NEI4 $1018
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 180
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0+36
+ARGP4
+CNSTF4 1119092736
+ARGF4
+ADDRLP4 180
+ARGP4
+ADDRLP4 424
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 424
+INDIRI4
+CNSTI4 0
+NEI4 $1027
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateBattleInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 428
+ADDRGP4 BotWantsToRetreat
+CALLI4
+ASGNI4
+ADDRLP4 428
+INDIRI4
+CNSTI4 0
+EQI4 $1030
+ADDRGP4 $965
+JUMPV
+LABELV $1030
+LABELV $1027
+LABELV $1018
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+ADDRLP4 0+20
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $1033
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+ASGNF4
+ADDRGP4 $1034
+JUMPV
+LABELV $1033
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $1034
+ADDRFP4 0
+INDIRP4
+CNSTI4 6012
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6136
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6088
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $949
+JUMPV
+LABELV $965
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $967
+ADDRLP4 140
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1035
+ADDRLP4 140
+INDIRI4
+CNSTI4 64
+LTI4 $964
+LABELV $1035
+CNSTI4 0
+RETI4
+LABELV $949
+endproc BotFindEnemy 432 20
+export BotTeamFlagCarrierVisible
+proc BotTeamFlagCarrierVisible 164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1040
+JUMPV
+LABELV $1037
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1041
+ADDRGP4 $1038
+JUMPV
+LABELV $1041
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1043
+ADDRGP4 $1038
+JUMPV
+LABELV $1043
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1045
+ADDRGP4 $1038
+JUMPV
+LABELV $1045
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $1047
+ADDRGP4 $1038
+JUMPV
+LABELV $1047
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+GTF4 $1049
+ADDRGP4 $1038
+JUMPV
+LABELV $1049
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1036
+JUMPV
+LABELV $1038
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1040
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1051
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1037
+LABELV $1051
+CNSTI4 -1
+RETI4
+LABELV $1036
+endproc BotTeamFlagCarrierVisible 164 20
+export BotTeamFlagCarrier
+proc BotTeamFlagCarrier 152 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1056
+JUMPV
+LABELV $1053
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1057
+ADDRGP4 $1054
+JUMPV
+LABELV $1057
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1059
+ADDRGP4 $1054
+JUMPV
+LABELV $1059
+ADDRLP4 4
+ARGP4
+ADDRLP4 144
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $1061
+ADDRGP4 $1054
+JUMPV
+LABELV $1061
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1063
+ADDRGP4 $1054
+JUMPV
+LABELV $1063
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1052
+JUMPV
+LABELV $1054
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1056
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1065
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1053
+LABELV $1065
+CNSTI4 -1
+RETI4
+LABELV $1052
+endproc BotTeamFlagCarrier 152 8
+export BotEnemyFlagCarrierVisible
+proc BotEnemyFlagCarrierVisible 164 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1070
+JUMPV
+LABELV $1067
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1071
+ADDRGP4 $1068
+JUMPV
+LABELV $1071
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1073
+ADDRGP4 $1068
+JUMPV
+LABELV $1073
+ADDRLP4 4
+ARGP4
+ADDRLP4 148
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $1075
+ADDRGP4 $1068
+JUMPV
+LABELV $1075
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $1077
+ADDRGP4 $1068
+JUMPV
+LABELV $1077
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 160
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+CNSTF4 0
+GTF4 $1079
+ADDRGP4 $1068
+JUMPV
+LABELV $1079
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1066
+JUMPV
+LABELV $1068
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1070
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1081
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1067
+LABELV $1081
+CNSTI4 -1
+RETI4
+LABELV $1066
+endproc BotEnemyFlagCarrierVisible 164 20
+export BotVisibleTeamMatesAndEnemies
+proc BotVisibleTeamMatesAndEnemies 192 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1083
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1083
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1085
+ADDRFP4 8
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $1085
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1090
+JUMPV
+LABELV $1087
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1091
+ADDRGP4 $1088
+JUMPV
+LABELV $1091
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1093
+ADDRGP4 $1088
+JUMPV
+LABELV $1093
+ADDRLP4 4
+ARGP4
+ADDRLP4 160
+ADDRGP4 EntityCarriesFlag
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $1095
+ADDRGP4 $1088
+JUMPV
+LABELV $1095
+ADDRLP4 144
+ADDRLP4 4+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+4
+ADDRLP4 4+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144+8
+ADDRLP4 4+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 144
+ARGP4
+ADDRLP4 168
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 168
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+LEF4 $1104
+ADDRGP4 $1088
+JUMPV
+LABELV $1104
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 180
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 180
+INDIRF4
+ASGNF4
+ADDRLP4 156
+INDIRF4
+CNSTF4 0
+GTF4 $1106
+ADDRGP4 $1088
+JUMPV
+LABELV $1106
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 184
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $1108
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1109
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $1109
+JUMPV
+LABELV $1108
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1112
+ADDRFP4 8
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1112
+LABELV $1109
+LABELV $1088
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1090
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1114
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $1087
+LABELV $1114
+LABELV $1082
+endproc BotVisibleTeamMatesAndEnemies 192 20
+lit
+align 4
+LABELV $1116
+byte 4 3229614080
+byte 4 3229614080
+byte 4 3229614080
+align 4
+LABELV $1117
+byte 4 1082130432
+byte 4 1082130432
+byte 4 1082130432
+export BotAimAtEnemy
+code
+proc BotAimAtEnemy 1148 52
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 860
+ADDRGP4 $1116
+INDIRB
+ASGNB 12
+ADDRLP4 872
+ADDRGP4 $1117
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $1118
+ADDRGP4 $1115
+JUMPV
+LABELV $1118
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $1120
+ADDRLP4 828
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 140
+ADDRLP4 828
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 828+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 828+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+ADDRLP4 828
+INDIRB
+ASGNB 12
+ADDRGP4 $1115
+JUMPV
+LABELV $1120
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 984
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 984
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 988
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 988
+INDIRF4
+ASGNF4
+ADDRLP4 736
+INDIRF4
+CNSTF4 1064514355
+LEF4 $1127
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 992
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 856
+CNSTF4 1056964608
+ADDRLP4 992
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 856
+INDIRF4
+SUBF4
+LEF4 $1129
+ADDRGP4 $1115
+JUMPV
+LABELV $1129
+ADDRFP4 0
+INDIRP4
+CNSTI4 6180
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 856
+INDIRF4
+SUBF4
+LEF4 $1131
+ADDRGP4 $1115
+JUMPV
+LABELV $1131
+LABELV $1127
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 160
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 2
+NEI4 $1133
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 8
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRGP4 $1134
+JUMPV
+LABELV $1133
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 3
+NEI4 $1136
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 9
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRGP4 $1137
+JUMPV
+LABELV $1136
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 4
+NEI4 $1139
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 11
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+ADDRGP4 $1140
+JUMPV
+LABELV $1139
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 5
+NEI4 $1142
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 10
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 17
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+ADDRGP4 $1143
+JUMPV
+LABELV $1142
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 6
+NEI4 $1145
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 12
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRGP4 $1146
+JUMPV
+LABELV $1145
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 7
+NEI4 $1148
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 14
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRGP4 $1149
+JUMPV
+LABELV $1148
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 8
+NEI4 $1151
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 19
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+ADDRGP4 $1152
+JUMPV
+LABELV $1151
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 9
+NEI4 $1154
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 15
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 996
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 996
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 20
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1000
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 736
+ADDRLP4 1000
+INDIRF4
+ASGNF4
+LABELV $1154
+LABELV $1152
+LABELV $1149
+LABELV $1146
+LABELV $1143
+LABELV $1140
+LABELV $1137
+LABELV $1134
+ADDRLP4 156
+INDIRF4
+CNSTF4 0
+GTF4 $1157
+ADDRLP4 156
+CNSTF4 953267991
+ASGNF4
+LABELV $1157
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 996
+ADDRGP4 EntityIsInvisible
+CALLI4
+ASGNI4
+ADDRLP4 996
+INDIRI4
+CNSTI4 0
+EQI4 $1159
+ADDRLP4 1000
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1000
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1036831949
+LEF4 $1161
+ADDRLP4 156
+CNSTF4 1053609165
+ADDRLP4 156
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1161
+LABELV $1159
+ADDRLP4 712
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 712+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 712+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1000
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 712
+ADDRLP4 712
+INDIRF4
+ADDRLP4 1000
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 712+4
+ADDRLP4 712+4
+INDIRF4
+ADDRLP4 1000
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 712+8
+ADDRLP4 712+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6140
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1182
+ADDRFP4 0
+INDIRP4
+CNSTI4 6140
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+ADDRLP4 712
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6244
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+LABELV $1182
+ADDRLP4 736
+INDIRF4
+CNSTF4 1063675494
+GEF4 $1185
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6244
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6248
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6252
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1008
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1008
+INDIRF4
+CNSTF4 1158676480
+LEF4 $1194
+ADDRFP4 0
+INDIRP4
+CNSTI4 6232
+ADDP4
+INDIRF4
+ADDRLP4 712
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6236
+ADDP4
+INDIRF4
+ADDRLP4 712+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6240
+ADDP4
+INDIRF4
+ADDRLP4 712+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $1196
+ADDRLP4 156
+CNSTF4 1060320051
+ADDRLP4 156
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1196
+LABELV $1194
+LABELV $1185
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1135869952
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1008
+ADDRGP4 BotEntityVisible
+CALLF4
+ASGNF4
+ADDRLP4 824
+ADDRLP4 1008
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 824
+INDIRI4
+CNSTI4 0
+EQI4 $1200
+ADDRLP4 724
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 844
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 844+8
+ADDRLP4 844+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 844+8
+ADDRLP4 844+8
+INDIRF4
+ADDRLP4 160+292+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 844
+ARGP4
+ADDRLP4 860
+ARGP4
+ADDRLP4 872
+ARGP4
+ADDRLP4 724
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 740+8
+INDIRF4
+CNSTF4 1065353216
+GTF4 $1208
+ADDRLP4 740+80
+INDIRI4
+ADDRLP4 0+20
+INDIRI4
+EQI4 $1208
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+LABELV $1208
+ADDRLP4 160+272
+INDIRF4
+CNSTF4 0
+EQF4 $1214
+ADDRLP4 140
+ADDRLP4 724
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 724+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 724+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1020
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1020
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6244
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6248
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6252
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 840
+INDIRF4
+CNSTF4 1120403456
+LEF4 $1230
+ADDRLP4 140
+ARGP4
+ADDRLP4 1028
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRF4
+CNSTF4 1149239296
+LTF4 $1228
+LABELV $1230
+ADDRLP4 736
+INDIRF4
+CNSTF4 1061997773
+LEF4 $1231
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1231
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1132
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1132
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1136
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 140
+ADDRLP4 140
+INDIRF4
+ADDRLP4 1136
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 1136
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 140+8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 1032
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 1032+8
+ADDRLP4 1032+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 1140
+CNSTF4 0
+ASGNF4
+ADDRLP4 968+8
+ADDRLP4 1140
+INDIRF4
+ASGNF4
+ADDRLP4 968+4
+ADDRLP4 1140
+INDIRF4
+ASGNF4
+ADDRLP4 968
+ADDRLP4 1140
+INDIRF4
+ASGNF4
+ADDRLP4 1044
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1032
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRLP4 1144
+CNSTI4 0
+ASGNI4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRLP4 140
+ARGP4
+ADDRLP4 968
+ARGP4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+CNSTF4 1092616192
+ADDRLP4 840
+INDIRF4
+MULF4
+ADDRLP4 160+272
+INDIRF4
+DIVF4
+CVFI4 4
+ARGI4
+CNSTF4 1036831949
+ARGF4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRLP4 1144
+INDIRI4
+ARGI4
+ADDRGP4 trap_AAS_PredictClientMovement
+CALLI4
+pop
+ADDRLP4 724
+ADDRLP4 1044
+INDIRB
+ASGNB 12
+ADDRGP4 $1232
+JUMPV
+LABELV $1231
+ADDRLP4 736
+INDIRF4
+CNSTF4 1053609165
+LEF4 $1264
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1036
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1036
+INDIRF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 0+60
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 0+60+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 0+60+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1040
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 980
+ADDRLP4 1040
+INDIRF4
+ADDRLP4 0+16
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 1044
+ADDRLP4 840
+INDIRF4
+ASGNF4
+ADDRLP4 1048
+ADDRLP4 980
+INDIRF4
+ASGNF4
+ADDRLP4 724
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 140
+INDIRF4
+ADDRLP4 1044
+INDIRF4
+ADDRLP4 160+272
+INDIRF4
+DIVF4
+ADDRLP4 1048
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 724+4
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 140+4
+INDIRF4
+ADDRLP4 1044
+INDIRF4
+ADDRLP4 160+272
+INDIRF4
+DIVF4
+ADDRLP4 1048
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 724+8
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 140+8
+INDIRF4
+ADDRLP4 840
+INDIRF4
+ADDRLP4 160+272
+INDIRF4
+DIVF4
+ADDRLP4 980
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1264
+LABELV $1232
+LABELV $1228
+LABELV $1214
+ADDRLP4 736
+INDIRF4
+CNSTF4 1058642330
+LEF4 $1299
+ADDRLP4 160+344+180
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1299
+ADDRLP4 0+24+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+GEF4 $1303
+ADDRLP4 956
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRLP4 956+8
+ADDRLP4 956+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 1016
+CNSTP4 0
+ASGNP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+ADDRLP4 956
+ARGP4
+ADDRLP4 0+20
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 944
+ADDRLP4 724
+INDIRB
+ASGNB 12
+ADDRLP4 740+4
+INDIRI4
+CNSTI4 0
+EQI4 $1311
+ADDRLP4 944+8
+ADDRLP4 0+24+8
+INDIRF4
+CNSTF4 1098907648
+SUBF4
+ASGNF4
+ADDRGP4 $1312
+JUMPV
+LABELV $1311
+ADDRLP4 944+8
+ADDRLP4 740+12+8
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+ASGNF4
+LABELV $1312
+ADDRLP4 740
+ARGP4
+ADDRLP4 844
+ARGP4
+ADDRLP4 1020
+CNSTP4 0
+ASGNP4
+ADDRLP4 1020
+INDIRP4
+ARGP4
+ADDRLP4 1020
+INDIRP4
+ARGP4
+ADDRLP4 944
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 740+12+8
+INDIRF4
+ADDRLP4 944+8
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 1024
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 1024
+INDIRF4
+CNSTF4 1112014848
+GEF4 $1320
+ADDRLP4 140
+ADDRLP4 740+12
+INDIRF4
+ADDRLP4 944
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 740+12+4
+INDIRF4
+ADDRLP4 944+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 740+12+8
+INDIRF4
+ADDRLP4 944+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1028
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1028
+INDIRF4
+CNSTF4 1163984896
+GEF4 $1334
+ADDRLP4 140
+ADDRLP4 740+12
+INDIRF4
+ADDRLP4 844
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 740+12+4
+INDIRF4
+ADDRLP4 844+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 740+12+8
+INDIRF4
+ADDRLP4 844+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1032
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1032
+INDIRF4
+CNSTF4 1176256512
+LEF4 $1345
+ADDRLP4 740+12+8
+ADDRLP4 740+12+8
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 740
+ARGP4
+ADDRLP4 740+12
+ARGP4
+ADDRLP4 1036
+CNSTP4 0
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 0+20
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 740+8
+INDIRF4
+CNSTF4 1065353216
+LTF4 $1352
+ADDRLP4 724
+ADDRLP4 944
+INDIRB
+ASGNB 12
+LABELV $1352
+LABELV $1345
+LABELV $1334
+LABELV $1320
+LABELV $1303
+LABELV $1299
+ADDRLP4 1016
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 724
+ADDRLP4 724
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 1016
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1020
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 724+4
+ADDRLP4 724+4
+INDIRF4
+CNSTF4 1101004800
+CNSTF4 1073741824
+ADDRLP4 1020
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1024
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1092616192
+CNSTF4 1073741824
+ADDRLP4 1024
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1201
+JUMPV
+LABELV $1200
+ADDRLP4 724
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 736
+INDIRF4
+CNSTF4 1056964608
+LEF4 $1358
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 9
+EQI4 $1366
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 5
+EQI4 $1366
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 4
+NEI4 $1360
+LABELV $1366
+ADDRLP4 884+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 884+12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 884
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 884+16
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 884+16+4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 884+16+8
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 884+28
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 884+28+4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 884+28+8
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6548
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6544
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 884
+ARGP4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 828
+ARGP4
+ADDRLP4 1016
+ADDRGP4 trap_BotPredictVisiblePosition
+CALLI4
+ASGNI4
+ADDRLP4 1016
+INDIRI4
+CNSTI4 0
+EQI4 $1379
+ADDRLP4 140
+ADDRLP4 828
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 828+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 828+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+ARGP4
+ADDRLP4 1024
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 1024
+INDIRF4
+CNSTF4 1170735104
+LEF4 $1385
+ADDRLP4 724
+ADDRLP4 828
+INDIRB
+ASGNB 12
+ADDRLP4 724+8
+ADDRLP4 724+8
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+LABELV $1385
+LABELV $1379
+ADDRLP4 156
+CNSTF4 1065353216
+ASGNF4
+LABELV $1360
+LABELV $1358
+LABELV $1201
+ADDRLP4 824
+INDIRI4
+CNSTI4 0
+EQI4 $1388
+ADDRLP4 740
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 1016
+CNSTP4 0
+ASGNP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+ADDRLP4 1016
+INDIRP4
+ARGP4
+ADDRLP4 724
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+ADDRLP4 740+12
+INDIRB
+ASGNB 12
+ADDRGP4 $1389
+JUMPV
+LABELV $1388
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+ADDRLP4 724
+INDIRB
+ASGNB 12
+LABELV $1389
+ADDRLP4 140
+ADDRLP4 724
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+4
+ADDRLP4 724+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140+8
+ADDRLP4 724+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 2
+EQI4 $1403
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 3
+EQI4 $1403
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 6
+EQI4 $1403
+ADDRLP4 160+4
+INDIRI4
+CNSTI4 7
+NEI4 $1395
+LABELV $1403
+ADDRLP4 140
+ARGP4
+ADDRLP4 1016
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 840
+ADDRLP4 1016
+INDIRF4
+ASGNF4
+ADDRLP4 840
+INDIRF4
+CNSTF4 1125515264
+LEF4 $1404
+ADDRLP4 840
+CNSTF4 1125515264
+ASGNF4
+LABELV $1404
+ADDRLP4 940
+CNSTF4 1053609165
+ADDRLP4 840
+INDIRF4
+CNSTF4 1125515264
+DIVF4
+MULF4
+CNSTF4 1058642330
+ADDF4
+ASGNF4
+ADDRLP4 156
+ADDRLP4 156
+INDIRF4
+ADDRLP4 940
+INDIRF4
+MULF4
+ASGNF4
+LABELV $1395
+ADDRLP4 156
+INDIRF4
+CNSTF4 1061997773
+GEF4 $1406
+ADDRLP4 140
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 152
+CNSTI4 0
+ASGNI4
+LABELV $1408
+ADDRLP4 1016
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1020
+ADDRLP4 152
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 140
+ADDP4
+ASGNP4
+ADDRLP4 1020
+INDIRP4
+ADDRLP4 1020
+INDIRP4
+INDIRF4
+CNSTF4 1050253722
+CNSTF4 1073741824
+ADDRLP4 1016
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1409
+ADDRLP4 152
+ADDRLP4 152
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 3
+LTI4 $1408
+LABELV $1406
+ADDRLP4 140
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 1016
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1020
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ASGNP4
+ADDRLP4 1020
+INDIRP4
+ADDRLP4 1020
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 160+268
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 1016
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1024
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1028
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1024
+INDIRP4
+ADDRLP4 1028
+INDIRF4
+ASGNF4
+ADDRLP4 1032
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRFP4 0
+INDIRP4
+CNSTI4 6580
+ADDP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ADDRLP4 1036
+INDIRP4
+INDIRF4
+CNSTF4 1086324736
+ADDRLP4 160+264
+INDIRF4
+MULF4
+CNSTF4 1073741824
+ADDRLP4 1032
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 156
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CNSTI4 6580
+ADDP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1044
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1040
+INDIRP4
+ADDRLP4 1044
+INDIRF4
+ASGNF4
+ADDRGP4 bot_challenge+12
+INDIRI4
+CNSTI4 0
+EQI4 $1414
+ADDRLP4 156
+INDIRF4
+CNSTF4 1063675494
+LEF4 $1417
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+GEF4 $1417
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $1419
+ADDRLP4 1048
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ADDRLP4 1048
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $1419
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+ADDRGP4 trap_EA_View
+CALLV
+pop
+LABELV $1417
+LABELV $1414
+LABELV $1115
+endproc BotAimAtEnemy 1148 52
+lit
+align 4
+LABELV $1422
+byte 4 3238002688
+byte 4 3238002688
+byte 4 3238002688
+align 4
+LABELV $1423
+byte 4 1090519040
+byte 4 1090519040
+byte 4 1090519040
+export BotCheckAttack
+code
+proc BotCheckAttack 1032 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 808
+ADDRGP4 $1422
+INDIRB
+ASGNB 12
+ADDRLP4 820
+ADDRGP4 $1423
+INDIRB
+ASGNB 12
+ADDRLP4 576
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 576
+INDIRI4
+ARGI4
+ADDRLP4 832
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 576
+INDIRI4
+CNSTI4 64
+LTI4 $1424
+LABELV $1424
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 976
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 700
+ADDRLP4 976
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6132
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 700
+INDIRF4
+SUBF4
+LEF4 $1426
+ADDRGP4 $1421
+JUMPV
+LABELV $1426
+ADDRFP4 0
+INDIRP4
+CNSTI4 6180
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 700
+INDIRF4
+SUBF4
+LEF4 $1428
+ADDRGP4 $1421
+JUMPV
+LABELV $1428
+ADDRFP4 0
+INDIRP4
+CNSTI4 6192
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1036831949
+SUBF4
+LEF4 $1430
+ADDRGP4 $1421
+JUMPV
+LABELV $1430
+ADDRFP4 0
+INDIRP4
+CNSTI4 6196
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $1432
+ADDRGP4 $1421
+JUMPV
+LABELV $1432
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 47
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 980
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 792
+ADDRLP4 980
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6200
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1434
+ADDRLP4 984
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 792
+INDIRF4
+LEF4 $1436
+ADDRFP4 0
+INDIRP4
+CNSTI4 6196
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 792
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6200
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $1437
+JUMPV
+LABELV $1436
+ADDRFP4 0
+INDIRP4
+CNSTI4 6200
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ADDRLP4 792
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6196
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $1437
+LABELV $1434
+ADDRLP4 580
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 580+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6224
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 580+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 6228
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $1440
+ADDRLP4 580
+ARGP4
+ADDRLP4 992
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 992
+INDIRF4
+CNSTF4 1163984896
+LEF4 $1442
+ADDRGP4 $1421
+JUMPV
+LABELV $1442
+LABELV $1440
+ADDRLP4 580
+ARGP4
+ADDRLP4 992
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 992
+INDIRF4
+CNSTF4 1176256512
+GEF4 $1444
+ADDRLP4 788
+CNSTF4 1123024896
+ASGNF4
+ADDRGP4 $1445
+JUMPV
+LABELV $1444
+ADDRLP4 788
+CNSTF4 1112014848
+ASGNF4
+LABELV $1445
+ADDRLP4 580
+ARGP4
+ADDRLP4 796
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+ADDRLP4 788
+INDIRF4
+ARGF4
+ADDRLP4 796
+ARGP4
+ADDRLP4 996
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 996
+INDIRI4
+CNSTI4 0
+NEI4 $1446
+ADDRGP4 $1421
+JUMPV
+LABELV $1446
+ADDRLP4 704
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 1004
+CNSTP4 0
+ASGNP4
+ADDRLP4 1004
+INDIRP4
+ARGP4
+ADDRLP4 1004
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6220
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 65537
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 704+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1448
+ADDRLP4 704+80
+INDIRI4
+ADDRLP4 576
+INDIRI4
+EQI4 $1448
+ADDRGP4 $1421
+JUMPV
+LABELV $1448
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_BotGetWeaponInfo
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 676
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 676
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 676+4
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 24+292
+INDIRF4
+MULF4
+ADDRLP4 676+8
+INDIRF4
+ADDRLP4 24+292+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 24+292+8
+INDIRF4
+ADDF4
+ADDF4
+ASGNF4
+ADDRLP4 1016
+CNSTF4 1148846080
+ASGNF4
+ADDRLP4 688
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1016
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 688+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 1016
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 688+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1148846080
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1020
+CNSTF4 3242196992
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 1020
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 1020
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 3242196992
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 592
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 808
+ARGP4
+ADDRLP4 820
+ARGP4
+ADDRLP4 688
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 592+80
+INDIRI4
+CNSTI4 0
+LEI4 $1482
+ADDRLP4 592+80
+INDIRI4
+CNSTI4 64
+GTI4 $1482
+ADDRLP4 592+80
+INDIRI4
+ADDRLP4 576
+INDIRI4
+EQI4 $1486
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 592+80
+INDIRI4
+ARGI4
+ADDRLP4 1024
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+EQI4 $1489
+ADDRGP4 $1421
+JUMPV
+LABELV $1489
+LABELV $1486
+LABELV $1482
+ADDRLP4 592+80
+INDIRI4
+ADDRLP4 576
+INDIRI4
+NEI4 $1495
+ADDRLP4 576
+INDIRI4
+CNSTI4 64
+LTI4 $1492
+LABELV $1495
+ADDRLP4 24+344+180
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1496
+CNSTF4 1148846080
+ADDRLP4 592+8
+INDIRF4
+MULF4
+ADDRLP4 24+344+172
+INDIRF4
+GEF4 $1500
+ADDRLP4 1028
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 972
+ADDRLP4 1028
+INDIRF4
+ADDRLP4 24+344+168
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRLP4 1028
+INDIRF4
+ADDRLP4 592+8
+INDIRF4
+MULF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 972
+INDIRF4
+CNSTF4 0
+LEF4 $1508
+ADDRGP4 $1421
+JUMPV
+LABELV $1508
+LABELV $1500
+LABELV $1496
+LABELV $1492
+ADDRLP4 24+176
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1510
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $1511
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+ADDRGP4 $1511
+JUMPV
+LABELV $1510
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+LABELV $1511
+ADDRLP4 1028
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ADDRLP4 1028
+INDIRP4
+INDIRI4
+CNSTI4 2
+BXORI4
+ASGNI4
+LABELV $1421
+endproc BotCheckAttack 1032 28
+lit
+align 4
+LABELV $1521
+byte 4 1143930880
+byte 4 1129054208
+byte 4 1143472128
+align 4
+LABELV $1522
+byte 4 1148256256
+byte 4 1139408896
+byte 4 1143603200
+align 4
+LABELV $1523
+byte 4 1134034944
+byte 4 1135607808
+byte 4 1147535360
+export BotMapScripts
+code
+proc BotMapScripts 1428 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 272
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 272
+ARGP4
+ADDRGP4 $1516
+ARGP4
+ADDRLP4 1316
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 144
+ARGP4
+ADDRLP4 1316
+INDIRP4
+ARGP4
+CNSTI4 127
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 144+127
+CNSTI1 0
+ASGNI1
+ADDRLP4 144
+ARGP4
+ADDRGP4 $1520
+ARGP4
+ADDRLP4 1320
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1320
+INDIRI4
+CNSTI4 0
+NEI4 $1518
+ADDRLP4 1324
+ADDRGP4 $1521
+INDIRB
+ASGNB 12
+ADDRLP4 1336
+ADDRGP4 $1522
+INDIRB
+ASGNB 12
+ADDRLP4 1348
+ADDRGP4 $1523
+INDIRB
+ASGNB 12
+ADDRLP4 1360
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 1360
+INDIRP4
+ADDRLP4 1360
+INDIRP4
+INDIRI4
+CNSTI4 -16777217
+BANDI4
+ASGNI4
+ADDRLP4 1364
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1364
+INDIRF4
+ADDRLP4 1324
+INDIRF4
+LEF4 $1524
+ADDRLP4 1364
+INDIRF4
+ADDRLP4 1336
+INDIRF4
+GEF4 $1524
+ADDRLP4 1368
+ADDRFP4 0
+INDIRP4
+CNSTI4 4912
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 1368
+INDIRF4
+ADDRLP4 1324+4
+INDIRF4
+LEF4 $1526
+ADDRLP4 1368
+INDIRF4
+ADDRLP4 1336+4
+INDIRF4
+GEF4 $1526
+ADDRFP4 0
+INDIRP4
+CNSTI4 4916
+ADDP4
+INDIRF4
+ADDRLP4 1324+8
+INDIRF4
+GEF4 $1530
+ADDRGP4 $1515
+JUMPV
+LABELV $1530
+LABELV $1526
+LABELV $1524
+ADDRLP4 1368
+CNSTI4 0
+ASGNI4
+ADDRLP4 1296
+ADDRLP4 1368
+INDIRI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1368
+INDIRI4
+ASGNI4
+ADDRGP4 $1536
+JUMPV
+LABELV $1533
+ADDRLP4 140
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $1537
+ADDRGP4 $1534
+JUMPV
+LABELV $1537
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1539
+ADDRGP4 $1534
+JUMPV
+LABELV $1539
+ADDRLP4 0
+ARGP4
+ADDRLP4 1372
+ADDRGP4 EntityIsDead
+CALLI4
+ASGNI4
+ADDRLP4 1372
+INDIRI4
+CNSTI4 0
+NEI4 $1544
+ADDRLP4 0+20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $1541
+LABELV $1544
+ADDRGP4 $1534
+JUMPV
+LABELV $1541
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 1324
+INDIRF4
+LEF4 $1545
+ADDRLP4 0+24
+INDIRF4
+ADDRLP4 1336
+INDIRF4
+GEF4 $1545
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 1324+4
+INDIRF4
+LEF4 $1549
+ADDRLP4 0+24+4
+INDIRF4
+ADDRLP4 1336+4
+INDIRF4
+GEF4 $1549
+ADDRLP4 0+24+8
+INDIRF4
+ADDRLP4 1324+8
+INDIRF4
+GEF4 $1557
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 140
+INDIRI4
+ARGI4
+ADDRLP4 1376
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1376
+INDIRI4
+CNSTI4 0
+EQI4 $1562
+ADDRLP4 1296
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1535
+JUMPV
+LABELV $1562
+ADDRLP4 1296
+CNSTI4 1
+ASGNI4
+LABELV $1557
+LABELV $1549
+LABELV $1545
+LABELV $1534
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1536
+ADDRLP4 140
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $1564
+ADDRLP4 140
+INDIRI4
+CNSTI4 64
+LTI4 $1533
+LABELV $1564
+LABELV $1535
+ADDRLP4 1296
+INDIRI4
+CNSTI4 0
+EQI4 $1519
+ADDRLP4 1376
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 1376
+INDIRP4
+ADDRLP4 1376
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRLP4 1300
+ADDRLP4 1348
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1300+4
+ADDRLP4 1348+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4940
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1300+8
+ADDRLP4 1348+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4944
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 1300
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1384
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 1312
+ADDRLP4 1384
+INDIRF4
+ASGNF4
+ADDRLP4 1388
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1392
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ASGNP4
+ADDRLP4 1392
+INDIRP4
+ADDRLP4 1392
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1073741824
+ADDRLP4 1388
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 1312
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1396
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ASGNP4
+ADDRLP4 1396
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1400
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1396
+INDIRP4
+ADDRLP4 1400
+INDIRF4
+ASGNF4
+ADDRLP4 1404
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1408
+ADDRFP4 0
+INDIRP4
+CNSTI4 6580
+ADDP4
+ASGNP4
+ADDRLP4 1408
+INDIRP4
+ADDRLP4 1408
+INDIRP4
+INDIRF4
+CNSTF4 1090519040
+CNSTF4 1073741824
+ADDRLP4 1404
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+CNSTF4 1065353216
+ADDRLP4 1312
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 1412
+ADDRFP4 0
+INDIRP4
+CNSTI4 6580
+ADDP4
+ASGNP4
+ADDRLP4 1412
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 1416
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1412
+INDIRP4
+ADDRLP4 1416
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ARGP4
+ADDRLP4 1424
+ADDRGP4 InFieldOfVision
+CALLI4
+ASGNI4
+ADDRLP4 1424
+INDIRI4
+CNSTI4 0
+EQI4 $1519
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Attack
+CALLV
+pop
+ADDRGP4 $1519
+JUMPV
+LABELV $1518
+ADDRLP4 144
+ARGP4
+ADDRGP4 $1575
+ARGP4
+ADDRLP4 1324
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 0
+NEI4 $1573
+ADDRLP4 1328
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+ASGNP4
+ADDRLP4 1328
+INDIRP4
+ADDRLP4 1328
+INDIRP4
+INDIRI4
+CNSTI4 -16777217
+BANDI4
+ASGNI4
+LABELV $1573
+LABELV $1519
+LABELV $1515
+endproc BotMapScripts 1428 16
+data
+align 4
+LABELV VEC_UP
+byte 4 0
+byte 4 3212836864
+byte 4 0
+align 4
+LABELV MOVEDIR_UP
+byte 4 0
+byte 4 0
+byte 4 1065353216
+align 4
+LABELV VEC_DOWN
+byte 4 0
+byte 4 3221225472
+byte 4 0
+align 4
+LABELV MOVEDIR_DOWN
+byte 4 0
+byte 4 0
+byte 4 3212836864
+export BotSetMovedir
+code
+proc BotSetMovedir 12 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VEC_UP
+ARGP4
+ADDRLP4 0
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1577
+ADDRFP4 4
+INDIRP4
+ADDRGP4 MOVEDIR_UP
+INDIRB
+ASGNB 12
+ADDRGP4 $1578
+JUMPV
+LABELV $1577
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VEC_DOWN
+ARGP4
+ADDRLP4 4
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1579
+ADDRFP4 4
+INDIRP4
+ADDRGP4 MOVEDIR_DOWN
+INDIRB
+ASGNB 12
+ADDRGP4 $1580
+JUMPV
+LABELV $1579
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $1580
+LABELV $1578
+LABELV $1576
+endproc BotSetMovedir 12 16
+export BotModelMinsMaxs
+proc BotModelMinsMaxs 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1585
+JUMPV
+LABELV $1582
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1587
+ADDRGP4 $1583
+JUMPV
+LABELV $1587
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $1589
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $1589
+ADDRGP4 $1583
+JUMPV
+LABELV $1589
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $1591
+ADDRLP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+EQI4 $1591
+ADDRGP4 $1583
+JUMPV
+LABELV $1591
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $1593
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1595
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1595
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1597
+ADDRFP4 16
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $1597
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $1581
+JUMPV
+LABELV $1593
+LABELV $1583
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ASGNP4
+LABELV $1585
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $1582
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1599
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $1599
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1601
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 20
+INDIRF4
+ASGNF4
+LABELV $1601
+CNSTI4 0
+RETI4
+LABELV $1581
+endproc BotModelMinsMaxs 40 0
+lit
+align 4
+LABELV $1604
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+align 4
+LABELV $1605
+byte 4 3212836864
+byte 4 3212836864
+byte 4 3212836864
+export BotFuncButtonActivateGoal
+code
+proc BotFuncButtonActivateGoal 648 28
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 304
+ADDRGP4 $1604
+INDIRB
+ASGNB 12
+ADDRLP4 316
+ADDRGP4 $1605
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 564
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 564
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 160
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 160
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1606
+CNSTI4 0
+RETI4
+ADDRGP4 $1603
+JUMPV
+LABELV $1606
+ADDRLP4 160+1
+ARGP4
+ADDRLP4 568
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 288
+ADDRLP4 568
+INDIRI4
+ASGNI4
+ADDRLP4 288
+INDIRI4
+CNSTI4 0
+NEI4 $1609
+CNSTI4 0
+RETI4
+ADDRGP4 $1603
+JUMPV
+LABELV $1609
+ADDRLP4 572
+CNSTF4 0
+ASGNF4
+ADDRLP4 96+8
+ADDRLP4 572
+INDIRF4
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 572
+INDIRF4
+ASGNF4
+ADDRLP4 96
+ADDRLP4 572
+INDIRF4
+ASGNF4
+ADDRLP4 288
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRLP4 84
+ARGP4
+ADDRLP4 576
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 344
+ADDRLP4 576
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1613
+ARGP4
+ADDRLP4 328
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 328
+INDIRF4
+CNSTF4 0
+NEF4 $1614
+ADDRLP4 328
+CNSTF4 1082130432
+ASGNF4
+LABELV $1614
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1616
+ARGP4
+ADDRLP4 352
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 96
+CNSTF4 0
+ASGNF4
+ADDRLP4 96+4
+ADDRLP4 352
+INDIRF4
+ASGNF4
+ADDRLP4 96+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 96
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 BotSetMovedir
+CALLV
+pop
+ADDRLP4 112
+ADDRLP4 84
+INDIRF4
+ADDRLP4 72
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 112+4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 72
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 84+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 84+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 580
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 16
+ADDRLP4 580
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 580
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1056964608
+ADDRLP4 16+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 584
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+4
+INDIRF4
+ARGF4
+ADDRLP4 588
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4+8
+INDIRF4
+ARGF4
+ADDRLP4 592
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 584
+INDIRF4
+ADDRLP4 112
+INDIRF4
+MULF4
+ADDRLP4 588
+INDIRF4
+ADDRLP4 112+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 592
+INDIRF4
+ADDRLP4 112+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 1056964608
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $1639
+ARGP4
+ADDRLP4 348
+ARGP4
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 348
+INDIRF4
+CNSTF4 0
+EQF4 $1640
+ADDRLP4 596
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 356
+ARGP4
+ADDRLP4 600
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 600
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 604
+CNSTP4 0
+ASGNP4
+ADDRLP4 604
+INDIRP4
+ARGP4
+ADDRLP4 604
+INDIRP4
+ARGP4
+ADDRLP4 124
+ARGP4
+ADDRLP4 600
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 BotAI_Trace
+CALLV
+pop
+ADDRLP4 356+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $1652
+ADDRLP4 356+80
+INDIRI4
+ADDRLP4 344
+INDIRI4
+NEI4 $1648
+LABELV $1652
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $1603
+JUMPV
+LABELV $1648
+CNSTI4 4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1653
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $1657
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 608
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 612
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1658
+JUMPV
+LABELV $1657
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 616
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 620
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 616
+INDIRF4
+ADDRLP4 620
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1658
+LABELV $1654
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1653
+ADDRLP4 608
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRLP4 292+8
+ADDRLP4 292+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 292
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1140850688
+SUBF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 440
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 612
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 612
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1670
+JUMPV
+LABELV $1667
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+CNSTI4 0
+EQI4 $1671
+ADDRGP4 $1669
+JUMPV
+LABELV $1671
+LABELV $1668
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1670
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1667
+LABELV $1669
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $1673
+LABELV $1673
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $1675
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 440
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1677
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $1681
+ADDRLP4 616
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 616
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 620
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 316
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 624
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 628
+ADDRLP4 616
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 628
+INDIRP4
+ADDRLP4 628
+INDIRP4
+INDIRF4
+ADDRLP4 620
+INDIRF4
+ADDRLP4 624
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1682
+JUMPV
+LABELV $1681
+ADDRLP4 632
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 632
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 636
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 304
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 640
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 644
+ADDRLP4 632
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 644
+INDIRP4
+ADDRLP4 644
+INDIRP4
+INDIRF4
+ADDRLP4 636
+INDIRF4
+ADDRLP4 640
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1682
+LABELV $1678
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1677
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1603
+JUMPV
+LABELV $1675
+CNSTI4 0
+RETI4
+ADDRGP4 $1603
+JUMPV
+LABELV $1640
+CNSTI4 4
+ARGI4
+ADDRLP4 136
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 trap_AAS_PresenceTypeBoundingBox
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1683
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $1687
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 596
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 148
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 600
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 596
+INDIRF4
+ADDRLP4 600
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1688
+JUMPV
+LABELV $1687
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 604
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 136
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 608
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 604
+INDIRF4
+ADDRLP4 608
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1688
+LABELV $1684
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1683
+ADDRLP4 596
+ADDRLP4 28
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 124
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+4
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 596
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 124+8
+ADDRLP4 16+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 292
+ADDRLP4 124
+INDIRB
+ASGNB 12
+ADDRLP4 292+8
+ADDRLP4 292+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 332
+ADDRLP4 292
+INDIRB
+ASGNB 12
+ADDRLP4 332+8
+ADDRLP4 332+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRLP4 332
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 600
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 600
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1700
+JUMPV
+LABELV $1697
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 604
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 604
+INDIRI4
+CNSTI4 0
+EQI4 $1701
+ADDRGP4 $1699
+JUMPV
+LABELV $1701
+LABELV $1698
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1700
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+LTI4 $1697
+LABELV $1699
+ADDRLP4 0
+INDIRI4
+ADDRLP4 108
+INDIRI4
+GEI4 $1703
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 32
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 84+4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 84+8
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1713
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $1717
+ADDRLP4 604
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 604
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 608
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 316
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 612
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 616
+ADDRLP4 604
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 616
+INDIRP4
+ADDRLP4 616
+INDIRP4
+INDIRF4
+ADDRLP4 608
+INDIRF4
+ADDRLP4 612
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $1718
+JUMPV
+LABELV $1717
+ADDRLP4 620
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 620
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 624
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 304
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 628
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 632
+ADDRLP4 620
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 632
+INDIRP4
+ADDRLP4 632
+INDIRP4
+INDIRF4
+ADDRLP4 624
+INDIRF4
+ADDRLP4 628
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $1718
+LABELV $1714
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $1713
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 344
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1603
+JUMPV
+LABELV $1703
+CNSTI4 0
+RETI4
+LABELV $1603
+endproc BotFuncButtonActivateGoal 648 28
+export BotFuncDoorActivateGoal
+proc BotFuncDoorActivateGoal 1096 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1720
+CNSTI4 0
+RETI4
+ADDRGP4 $1719
+JUMPV
+LABELV $1720
+ADDRLP4 12+1
+ARGP4
+ADDRLP4 1080
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1060
+ADDRLP4 1080
+INDIRI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $1723
+CNSTI4 0
+RETI4
+ADDRGP4 $1719
+JUMPV
+LABELV $1723
+ADDRLP4 1084
+CNSTF4 0
+ASGNF4
+ADDRLP4 1064+8
+ADDRLP4 1084
+INDIRF4
+ASGNF4
+ADDRLP4 1064+4
+ADDRLP4 1084
+INDIRF4
+ASGNF4
+ADDRLP4 1064
+ADDRLP4 1084
+INDIRF4
+ASGNF4
+ADDRLP4 1060
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1048
+ARGP4
+ADDRLP4 1088
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 1076
+ADDRLP4 1088
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRF4
+ADDRLP4 1048
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1036+4
+INDIRF4
+ADDRLP4 1048+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 1036+8
+INDIRF4
+ADDRLP4 1048+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 1092
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1092
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 1092
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1056964608
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $1719
+endproc BotFuncDoorActivateGoal 1096 20
+export BotTriggerMultipleActivateGoal
+proc BotTriggerMultipleActivateGoal 300 20
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 272
+CNSTF4 0
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 88
+ADDP4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 272
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 84
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 84
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1738
+CNSTI4 0
+RETI4
+ADDRGP4 $1737
+JUMPV
+LABELV $1738
+ADDRLP4 84+1
+ARGP4
+ADDRLP4 276
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 224
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 224
+INDIRI4
+CNSTI4 0
+NEI4 $1741
+CNSTI4 0
+RETI4
+ADDRGP4 $1737
+JUMPV
+LABELV $1741
+ADDRLP4 280
+CNSTF4 0
+ASGNF4
+ADDRLP4 240+8
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 240+4
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 240
+ADDRLP4 280
+INDIRF4
+ASGNF4
+ADDRLP4 224
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1073741824
+ARGI4
+ADDRLP4 60
+ARGP4
+ADDRLP4 72
+ARGP4
+ADDRLP4 284
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 284
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 72+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 72+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 288
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 4
+ADDRLP4 288
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 288
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+CNSTF4 1056964608
+ADDRLP4 4+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 252
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 212
+ADDRLP4 252
+INDIRB
+ASGNB 12
+ADDRLP4 212+8
+ADDRLP4 212+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 228
+ADDRLP4 212
+INDIRB
+ASGNB 12
+ADDRLP4 228+8
+ADDRLP4 228+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 212
+ARGP4
+ADDRLP4 228
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 292
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 292
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1760
+JUMPV
+LABELV $1757
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 296
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 296
+INDIRI4
+CNSTI4 0
+EQI4 $1761
+ADDRGP4 $1759
+JUMPV
+LABELV $1761
+LABELV $1758
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1760
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $1757
+LABELV $1759
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GEI4 $1763
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 60+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 60+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 72+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 72+8
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $1737
+JUMPV
+LABELV $1763
+CNSTI4 0
+RETI4
+LABELV $1737
+endproc BotTriggerMultipleActivateGoal 300 20
+export BotPopFromActivateGoalStack
+proc BotPopFromActivateGoalStack 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1774
+CNSTI4 0
+RETI4
+ADDRGP4 $1773
+JUMPV
+LABELV $1774
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 1
+RETI4
+LABELV $1773
+endproc BotPopFromActivateGoalStack 4 8
+export BotPushOntoActivateGoalStack
+proc BotPushOntoActivateGoalStack 24 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1176255488
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1777
+CNSTI4 244
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1781
+CNSTI4 244
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $1783
+ADDRLP4 4
+CNSTI4 244
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1783
+LABELV $1781
+LABELV $1778
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $1777
+ADDRLP4 8
+INDIRI4
+CNSTI4 -1
+EQI4 $1785
+ADDRLP4 12
+CNSTI4 244
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+CNSTI4 1
+ASGNI4
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+CNSTI4 240
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+CNSTI4 244
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $1776
+JUMPV
+LABELV $1785
+CNSTI4 0
+RETI4
+LABELV $1776
+endproc BotPushOntoActivateGoalStack 24 12
+export BotClearActivateGoalStack
+proc BotClearActivateGoalStack 0 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $1789
+JUMPV
+LABELV $1788
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotPopFromActivateGoalStack
+CALLI4
+pop
+LABELV $1789
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1788
+LABELV $1787
+endproc BotClearActivateGoalStack 0 4
+export BotEnableActivateGoalAreas
+proc BotEnableActivateGoalAreas 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1795
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1796
+JUMPV
+LABELV $1795
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1796
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $1792
+ADDRGP4 $1791
+JUMPV
+LABELV $1792
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1800
+JUMPV
+LABELV $1797
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_AAS_EnableRoutingArea
+CALLI4
+pop
+LABELV $1798
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1800
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+LTI4 $1797
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $1802
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $1803
+JUMPV
+LABELV $1802
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $1803
+ADDRFP4 0
+INDIRP4
+CNSTI4 236
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $1791
+endproc BotEnableActivateGoalAreas 12 8
+export BotIsGoingToActivateEntity
+proc BotIsGoingToActivateEntity 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $1808
+JUMPV
+LABELV $1805
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $1809
+ADDRGP4 $1806
+JUMPV
+LABELV $1809
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1811
+CNSTI4 1
+RETI4
+ADDRGP4 $1804
+JUMPV
+LABELV $1811
+LABELV $1806
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 240
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $1808
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $1805
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1813
+CNSTI4 244
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1817
+ADDRGP4 $1814
+JUMPV
+LABELV $1817
+CNSTI4 244
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $1819
+CNSTI4 244
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 7120
+ADDP4
+ADDP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+LEF4 $1821
+CNSTI4 1
+RETI4
+ADDRGP4 $1804
+JUMPV
+LABELV $1821
+LABELV $1819
+LABELV $1814
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $1813
+CNSTI4 0
+RETI4
+LABELV $1804
+endproc BotIsGoingToActivateEntity 8 0
+export BotGetActivateGoal
+proc BotGetActivateGoal 3320 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 244
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 3052
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $1824
+ARGP4
+ADDRLP4 3052+104
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 3252
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3252
+INDIRI4
+ASGNI4
+ADDRGP4 $1829
+JUMPV
+LABELV $1826
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 1584
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3256
+INDIRI4
+CNSTI4 0
+NEI4 $1830
+ADDRGP4 $1827
+JUMPV
+LABELV $1830
+ADDRLP4 1712
+ARGP4
+ADDRLP4 1584
+ARGP4
+ADDRLP4 3260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $1832
+ADDRGP4 $1828
+JUMPV
+LABELV $1832
+LABELV $1827
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3256
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3256
+INDIRI4
+ASGNI4
+LABELV $1829
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1826
+LABELV $1828
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1834
+CNSTI4 3
+ARGI4
+ADDRGP4 $1836
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1823
+JUMPV
+LABELV $1834
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1837
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1456
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $1838
+CNSTI4 3
+ARGI4
+ADDRGP4 $1840
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $1823
+JUMPV
+LABELV $1838
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1843
+ARGP4
+ADDRLP4 3260
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3260
+INDIRI4
+CNSTI4 0
+NEI4 $1841
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1639
+ARGP4
+ADDRLP4 3208
+ARGP4
+ADDRLP4 3264
+ADDRGP4 trap_AAS_FloatForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+EQI4 $1844
+ADDRLP4 3208
+INDIRF4
+CNSTF4 0
+EQF4 $1846
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotFuncDoorActivateGoal
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1823
+JUMPV
+LABELV $1846
+LABELV $1844
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1848
+ARGP4
+ADDRLP4 3204
+ARGP4
+ADDRGP4 trap_AAS_IntForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 3204
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $1849
+CNSTI4 0
+RETI4
+ADDRGP4 $1823
+JUMPV
+LABELV $1849
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1853
+ARGP4
+ADDRLP4 3192
+ARGP4
+ADDRLP4 3268
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $1851
+ADDRLP4 3272
+CNSTF4 0
+ASGNF4
+ADDRLP4 3192+8
+ADDRLP4 3272
+INDIRF4
+ASGNF4
+ADDRLP4 3192+4
+ADDRLP4 3272
+INDIRF4
+ASGNF4
+ADDRLP4 3192
+ADDRLP4 3272
+INDIRF4
+ASGNF4
+LABELV $1851
+ADDRLP4 3192
+ARGP4
+ADDRLP4 3052+24
+ARGP4
+ADDRLP4 3272
+ADDRGP4 VectorCompare
+CALLI4
+ASGNI4
+ADDRLP4 3272
+INDIRI4
+CNSTI4 0
+NEI4 $1856
+CNSTI4 0
+RETI4
+ADDRGP4 $1823
+JUMPV
+LABELV $1856
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 1712
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRLP4 1712
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $1859
+ADDRLP4 1712+1
+ARGP4
+ADDRLP4 3276
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 3212
+ADDRLP4 3276
+INDIRI4
+ASGNI4
+ADDRLP4 3212
+INDIRI4
+CNSTI4 0
+EQI4 $1862
+ADDRLP4 3280
+CNSTF4 0
+ASGNF4
+ADDRLP4 3216+8
+ADDRLP4 3280
+INDIRF4
+ASGNF4
+ADDRLP4 3216+4
+ADDRLP4 3280
+INDIRF4
+ASGNF4
+ADDRLP4 3216
+ADDRLP4 3280
+INDIRF4
+ASGNF4
+ADDRLP4 3212
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3228
+ARGP4
+ADDRLP4 3240
+ARGP4
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+pop
+ADDRLP4 3228
+ARGP4
+ADDRLP4 3240
+ARGP4
+ADDRLP4 2740
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 3284
+ADDRGP4 trap_AAS_BBoxAreas
+CALLI4
+ASGNI4
+ADDRLP4 3048
+ADDRLP4 3284
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1869
+JUMPV
+LABELV $1866
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $1870
+ADDRGP4 $1868
+JUMPV
+LABELV $1870
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3288
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+NEI4 $1872
+ADDRGP4 $1867
+JUMPV
+LABELV $1872
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1874
+ADDRLP4 3296
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3292
+ADDRLP4 3296
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3296
+INDIRP4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3300
+CNSTI4 2
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+ADDRLP4 3300
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3300
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1874
+LABELV $1867
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1869
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3048
+INDIRI4
+LTI4 $1866
+LABELV $1868
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1879
+JUMPV
+LABELV $1876
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+INDIRI4
+CNSTI4 32
+LTI4 $1880
+ADDRGP4 $1878
+JUMPV
+LABELV $1880
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3288
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+EQI4 $1882
+ADDRGP4 $1877
+JUMPV
+LABELV $1882
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2996
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+ADDRLP4 2996
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $1884
+ADDRLP4 3296
+ADDRFP4 8
+INDIRP4
+CNSTI4 232
+ADDP4
+ASGNP4
+ADDRLP4 3292
+ADDRLP4 3296
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 3296
+INDIRP4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 3300
+CNSTI4 2
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+ADDRLP4 3300
+INDIRI4
+LSHI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDP4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3300
+INDIRI4
+LSHI4
+ADDRLP4 2740
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $1884
+LABELV $1877
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1879
+ADDRLP4 132
+INDIRI4
+ADDRLP4 3048
+INDIRI4
+LTI4 $1876
+LABELV $1878
+LABELV $1862
+LABELV $1859
+LABELV $1841
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1888
+ARGP4
+ADDRLP4 3264
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3264
+INDIRI4
+CNSTI4 0
+NEI4 $1886
+CNSTI4 0
+RETI4
+ADDRGP4 $1823
+JUMPV
+LABELV $1886
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1891
+ARGP4
+ADDRLP4 136
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3268
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3268
+INDIRI4
+CNSTI4 0
+NEI4 $1889
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $1892
+CNSTI4 3
+ARGI4
+ADDRGP4 $1895
+ARGP4
+ADDRLP4 1712
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1892
+CNSTI4 0
+RETI4
+ADDRGP4 $1823
+JUMPV
+LABELV $1889
+CNSTI4 0
+ARGI4
+ADDRLP4 3272
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 1416
+ADDRLP4 3272
+INDIRI4
+ASGNI4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1899
+JUMPV
+LABELV $1896
+ADDRLP4 0
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $1903
+JUMPV
+LABELV $1900
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1906
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3276
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3276
+INDIRI4
+CNSTI4 0
+NEI4 $1904
+ADDRGP4 $1901
+JUMPV
+LABELV $1904
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 3280
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+NEI4 $1907
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3284
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3284
+INDIRI4
+ASGNI4
+ADDRGP4 $1902
+JUMPV
+LABELV $1907
+LABELV $1901
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 3276
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 3276
+INDIRI4
+ASGNI4
+LABELV $1903
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1900
+LABELV $1902
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $1909
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $1911
+CNSTI4 3
+ARGI4
+ADDRGP4 $1914
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $1911
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $1897
+JUMPV
+LABELV $1909
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1837
+ARGP4
+ADDRLP4 1456
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3280
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3280
+INDIRI4
+CNSTI4 0
+NEI4 $1915
+ADDRGP4 bot_developer+12
+INDIRI4
+CNSTI4 0
+EQI4 $1897
+CNSTI4 3
+ARGI4
+ADDRGP4 $1920
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136
+ADDP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $1897
+JUMPV
+LABELV $1915
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1888
+ARGP4
+ADDRLP4 3284
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3284
+INDIRI4
+CNSTI4 0
+NEI4 $1921
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3288
+ADDRGP4 BotFuncButtonActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+NEI4 $1923
+ADDRGP4 $1897
+JUMPV
+LABELV $1923
+ADDRLP4 3292
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3292
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1925
+ADDRLP4 3292
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1925
+ADDRLP4 3296
+CNSTI4 44
+ASGNI4
+ADDRLP4 3292
+INDIRP4
+ADDRLP4 3296
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3296
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $1925
+ADDRLP4 3300
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3292
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3300
+INDIRF4
+LEF4 $1925
+ADDRLP4 3292
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3300
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $1925
+ADDRGP4 $1897
+JUMPV
+LABELV $1925
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3304
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3304
+INDIRI4
+CNSTI4 0
+EQI4 $1927
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3312
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3312
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $1929
+ADDRGP4 $1897
+JUMPV
+LABELV $1929
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $1927
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1823
+JUMPV
+LABELV $1921
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1933
+ARGP4
+ADDRLP4 3288
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3288
+INDIRI4
+CNSTI4 0
+NEI4 $1931
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 3292
+ADDRGP4 BotTriggerMultipleActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 0
+NEI4 $1934
+ADDRGP4 $1897
+JUMPV
+LABELV $1934
+ADDRLP4 3296
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 3296
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1936
+ADDRLP4 3296
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $1936
+ADDRLP4 3300
+CNSTI4 44
+ASGNI4
+ADDRLP4 3296
+INDIRP4
+ADDRLP4 3300
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 3300
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $1936
+ADDRLP4 3304
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 3296
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ADDRLP4 3304
+INDIRF4
+LEF4 $1936
+ADDRLP4 3296
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 3304
+INDIRF4
+CNSTF4 1073741824
+SUBF4
+GEF4 $1936
+ADDRGP4 $1897
+JUMPV
+LABELV $1936
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3308
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 3308
+INDIRI4
+CNSTI4 0
+EQI4 $1938
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 3316
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 2736
+ADDRLP4 3316
+INDIRI4
+ASGNI4
+ADDRLP4 2736
+INDIRI4
+CNSTI4 0
+NEI4 $1940
+ADDRGP4 $1897
+JUMPV
+LABELV $1940
+ADDRFP4 8
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1008981770
+ADDRLP4 2736
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CNSTF4 1084227584
+ADDF4
+ASGNF4
+LABELV $1938
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $1823
+JUMPV
+LABELV $1931
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1944
+ARGP4
+ADDRLP4 3292
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3292
+INDIRI4
+CNSTI4 0
+NEI4 $1942
+ADDRGP4 $1897
+JUMPV
+LABELV $1942
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1947
+ARGP4
+ADDRLP4 3296
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3296
+INDIRI4
+CNSTI4 0
+EQI4 $1949
+ADDRLP4 1456
+ARGP4
+ADDRGP4 $1948
+ARGP4
+ADDRLP4 3300
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 3300
+INDIRI4
+CNSTI4 0
+NEI4 $1945
+LABELV $1949
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1891
+ARGP4
+ADDRLP4 132
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRLP4 136+128
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 3304
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 3304
+INDIRI4
+CNSTI4 0
+EQI4 $1950
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 3308
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1416
+ADDP4
+ADDRLP4 3308
+INDIRI4
+ASGNI4
+LABELV $1950
+LABELV $1945
+LABELV $1897
+LABELV $1899
+ADDRLP4 132
+INDIRI4
+CNSTI4 0
+LTI4 $1953
+ADDRLP4 132
+INDIRI4
+CNSTI4 10
+LTI4 $1896
+LABELV $1953
+CNSTI4 0
+RETI4
+LABELV $1823
+endproc BotGetActivateGoal 3320 20
+export BotGoForActivateGoal
+proc BotGoForActivateGoal 144 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $1955
+ADDRFP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+LABELV $1955
+ADDRFP4 4
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 140
+ADDRGP4 BotPushOntoActivateGoalStack
+CALLI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 0
+EQI4 $1958
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1960
+ARGP4
+ADDRGP4 AIEnter_Seek_ActivateEntity
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $1954
+JUMPV
+LABELV $1958
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $1954
+endproc BotGoForActivateGoal 144 8
+export BotPrintActivateGoalInfo
+proc BotPrintActivateGoalInfo 296 36
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $1837
+ARGP4
+ADDRLP4 36
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1962
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $1964
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $1963
+JUMPV
+LABELV $1962
+ADDRLP4 164
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $1965
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $1963
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 164
+ARGP4
+ADDRGP4 trap_EA_Say
+CALLV
+pop
+LABELV $1961
+endproc BotPrintActivateGoalInfo 296 36
+export BotRandomMove
+proc BotRandomMove 32 16
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+CNSTF4 1135869952
+ADDRLP4 24
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1137180672
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 12
+INDIRB
+ASGNB 12
+LABELV $1966
+endproc BotRandomMove 32 16
+lit
+align 4
+LABELV $1970
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export BotAIBlocked
+code
+proc BotAIBlocked 532 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 228
+ADDRGP4 $1970
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $1971
+ADDRFP4 0
+INDIRP4
+CNSTI4 6204
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $1969
+JUMPV
+LABELV $1971
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $1973
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotRandomMove
+CALLV
+pop
+ADDRGP4 $1969
+JUMPV
+LABELV $1973
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 BotEntityInfo
+CALLV
+pop
+ADDRLP4 488
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 488
+INDIRI4
+EQI4 $1975
+ADDRLP4 40+104
+INDIRI4
+ADDRLP4 488
+INDIRI4
+LEI4 $1975
+ADDRLP4 40+104
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+GTI4 $1975
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40+20
+INDIRI4
+ARGI4
+ADDRLP4 240
+ARGP4
+ADDRLP4 492
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 484
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 0
+EQI4 $1980
+ADDRLP4 496
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 496
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1982
+ADDRLP4 496
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $1982
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $1982
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240+4+40
+INDIRI4
+ARGI4
+ADDRLP4 500
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 500
+INDIRI4
+CNSTI4 0
+NEI4 $1984
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+LABELV $1984
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+NEI4 $1981
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 504
+ADDRGP4 trap_AAS_AreaReachability
+CALLI4
+ASGNI4
+ADDRLP4 504
+INDIRI4
+CNSTI4 0
+EQI4 $1981
+ADDRGP4 $1969
+JUMPV
+LABELV $1980
+ADDRLP4 240
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+LABELV $1981
+LABELV $1975
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 496
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 496
+INDIRF4
+CNSTF4 1036831949
+GEF4 $1992
+ADDRLP4 216
+CNSTF4 0
+ASGNF4
+ADDRLP4 500
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 216+4
+CNSTF4 1135869952
+ADDRLP4 500
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 216+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 216
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 504
+CNSTP4 0
+ASGNP4
+ADDRLP4 504
+INDIRP4
+ARGP4
+ADDRLP4 504
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+LABELV $1992
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 24+8
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1099956224
+ADDF4
+ASGNF4
+ADDRLP4 500
+CNSTF4 1084227584
+ASGNF4
+ADDRLP4 180
+ADDRLP4 24
+INDIRF4
+ADDRLP4 500
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 180+4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 500
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 180+8
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1084227584
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 504
+CNSTF4 3246391296
+ASGNF4
+ADDRLP4 192
+ADDRLP4 504
+INDIRF4
+ASGNF4
+ADDRLP4 192+4
+ADDRLP4 504
+INDIRF4
+ASGNF4
+ADDRLP4 192+8
+CNSTF4 3250585600
+ASGNF4
+ADDRLP4 508
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 204
+ADDRLP4 508
+INDIRF4
+ASGNF4
+ADDRLP4 204+4
+ADDRLP4 508
+INDIRF4
+ASGNF4
+ADDRLP4 204+8
+CNSTF4 1082130432
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 228
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $2007
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $2007
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+NEI4 $2015
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 516
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 516
+INDIRI4
+CNSTI4 0
+NEI4 $2013
+LABELV $2015
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRLP4 520
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $2016
+ADDRLP4 524
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 524
+INDIRP4
+ADDRLP4 524
+INDIRP4
+INDIRI4
+CNSTI4 16
+BXORI4
+ASGNI4
+ADDRLP4 528
+CNSTF4 3212836864
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 528
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 528
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 3212836864
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTF4 1137180672
+ARGF4
+ADDRLP4 36
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotMoveInDirection
+CALLI4
+pop
+LABELV $2016
+LABELV $2013
+ADDRFP4 0
+INDIRP4
+CNSTI4 6204
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1053609165
+SUBF4
+GEF4 $2024
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_NBG
+CVPU4 4
+NEU4 $2026
+ADDRFP4 0
+INDIRP4
+CNSTI4 6072
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $2027
+JUMPV
+LABELV $2026
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Seek_LTG
+CVPU4 4
+NEU4 $2028
+ADDRFP4 0
+INDIRP4
+CNSTI4 6068
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $2028
+LABELV $2027
+LABELV $2024
+LABELV $1969
+endproc BotAIBlocked 532 16
+export BotAIPredictObstacles
+proc BotAIPredictObstacles 324 44
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 bot_predictobstacles+12
+INDIRI4
+CNSTI4 0
+NEI4 $2031
+CNSTI4 0
+RETI4
+ADDRGP4 $2030
+JUMPV
+LABELV $2031
+ADDRFP4 0
+INDIRP4
+CNSTI4 6216
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+NEI4 $2034
+ADDRFP4 0
+INDIRP4
+CNSTI4 6212
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1086324736
+SUBF4
+LEF4 $2034
+CNSTI4 0
+RETI4
+ADDRGP4 $2030
+JUMPV
+LABELV $2034
+ADDRFP4 0
+INDIRP4
+CNSTI4 6216
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6212
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 100
+ARGI4
+CNSTI4 1000
+ARGI4
+CNSTI4 6
+ARGI4
+CNSTI4 1024
+ARGI4
+CNSTI4 67108864
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_AAS_PredictRoute
+CALLI4
+pop
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $2036
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $2037
+ADDRLP4 300
+CNSTI4 24
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0+20
+INDIRI4
+CNSTI4 255
+ADDRLP4 300
+INDIRI4
+LSHI4
+BANDI4
+ADDRLP4 300
+INDIRI4
+RSHI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $2037
+ADDRLP4 36
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 304
+CNSTP4 0
+ASGNP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 304
+INDIRP4
+ARGP4
+ADDRLP4 308
+ADDRGP4 BotModelMinsMaxs
+CALLI4
+ASGNI4
+ADDRLP4 40
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $2037
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRI4
+ARGI4
+ADDRLP4 48
+ARGP4
+ADDRLP4 312
+ADDRGP4 BotGetActivateGoal
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 312
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $2037
+ADDRLP4 316
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 316
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $2049
+ADDRLP4 316
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2049
+ADDRFP4 0
+INDIRP4
+CNSTI4 7116
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $2049
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48+4+40
+INDIRI4
+ARGI4
+ADDRLP4 320
+ADDRGP4 BotIsGoingToActivateEntity
+CALLI4
+ASGNI4
+ADDRLP4 320
+INDIRI4
+CNSTI4 0
+NEI4 $2051
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 BotGoForActivateGoal
+CALLI4
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $2030
+JUMPV
+LABELV $2051
+ADDRLP4 48
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BotEnableActivateGoalAreas
+CALLV
+pop
+ADDRGP4 $2037
+JUMPV
+LABELV $2036
+ADDRLP4 0+16
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $2055
+ADDRLP4 0+24
+INDIRI4
+CNSTI4 67108864
+BANDI4
+CNSTI4 0
+EQI4 $2058
+LABELV $2058
+LABELV $2055
+LABELV $2037
+CNSTI4 0
+RETI4
+LABELV $2030
+endproc BotAIPredictObstacles 324 44
+export BotCheckConsoleMessages
+proc BotCheckConsoleMessages 1012 48
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 908
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRGP4 $2063
+JUMPV
+LABELV $2062
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 948
+ADDRGP4 trap_BotNumConsoleMessages
+CALLI4
+ASGNI4
+ADDRLP4 948
+INDIRI4
+CNSTI4 10
+GEI4 $2065
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2067
+ADDRLP4 952
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 952
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1065353216
+ADDF4
+SUBF4
+LEF4 $2067
+ADDRGP4 $2064
+JUMPV
+LABELV $2067
+LABELV $2065
+ADDRLP4 276
+ADDRLP4 0+12
+ASGNP4
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2072
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 288
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 952
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 952
+INDIRI4
+CNSTI4 0
+EQI4 $2075
+ADDRLP4 276
+ADDRLP4 288+264+16
+INDIRI1
+CVII4 1
+ADDRLP4 0+12
+ADDP4
+ASGNP4
+LABELV $2075
+LABELV $2072
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnifyWhiteSpaces
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 952
+ADDRGP4 BotSynonymContext
+CALLI4
+ASGNI4
+ADDRLP4 284
+ADDRLP4 952
+INDIRI4
+ASGNI4
+ADDRLP4 276
+INDIRP4
+ARGP4
+ADDRLP4 284
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 trap_BotReplaceSynonyms
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 956
+ADDRGP4 BotMatchMessage
+CALLI4
+ASGNI4
+ADDRLP4 956
+INDIRI4
+CNSTI4 0
+NEI4 $2081
+ADDRLP4 0+8
+INDIRI4
+CNSTI4 1
+NEI4 $2084
+ADDRGP4 bot_nochat+12
+INDIRI4
+CNSTI4 0
+NEI4 $2084
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 288
+ARGP4
+CNSTU4 128
+ARGU4
+ADDRLP4 960
+ADDRGP4 trap_BotFindMatch
+CALLI4
+ASGNI4
+ADDRLP4 960
+INDIRI4
+CNSTI4 0
+NEI4 $2088
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2063
+JUMPV
+LABELV $2088
+ADDRLP4 288+260
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $2091
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2063
+JUMPV
+LABELV $2091
+ADDRLP4 288
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 872
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 288
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRLP4 616
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotMatchVariable
+CALLV
+pop
+ADDRLP4 872
+ARGP4
+ADDRLP4 964
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 964
+INDIRI4
+NEI4 $2094
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRGP4 $2063
+JUMPV
+LABELV $2094
+ADDRLP4 616
+ARGP4
+ADDRGP4 trap_UnifyWhiteSpaces
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testrchat+12
+INDIRI4
+CNSTI4 0
+EQI4 $2096
+ADDRGP4 $2099
+ARGP4
+ADDRGP4 $2100
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 968
+CNSTP4 0
+ASGNP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 968
+INDIRP4
+ARGP4
+ADDRLP4 908
+ARGP4
+ADDRLP4 872
+ARGP4
+ADDRLP4 972
+ADDRGP4 trap_BotReplyChat
+CALLI4
+ASGNI4
+ADDRLP4 972
+INDIRI4
+CNSTI4 0
+EQI4 $2101
+CNSTI4 1
+ARGI4
+ADDRGP4 $2103
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2097
+JUMPV
+LABELV $2101
+CNSTI4 1
+ARGI4
+ADDRGP4 $2104
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2097
+JUMPV
+LABELV $2096
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 AINode_Stand
+CVPU4 4
+EQU4 $2105
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 972
+ADDRGP4 BotValidChatPosition
+CALLI4
+ASGNI4
+ADDRLP4 972
+INDIRI4
+CNSTI4 0
+EQI4 $2105
+ADDRLP4 976
+ADDRGP4 TeamPlayIsOn
+CALLI4
+ASGNI4
+ADDRLP4 976
+INDIRI4
+CNSTI4 0
+NEI4 $2105
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 35
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 980
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 944
+ADDRLP4 980
+INDIRF4
+ASGNF4
+ADDRLP4 984
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 988
+ADDRGP4 NumBots
+CALLI4
+ASGNI4
+ADDRLP4 984
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1069547520
+ADDRLP4 988
+INDIRI4
+CNSTI4 1
+ADDI4
+CVIF4 4
+DIVF4
+GEF4 $2107
+ADDRLP4 992
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 992
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 944
+INDIRF4
+GEF4 $2107
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 616
+ARGP4
+ADDRLP4 284
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRLP4 996
+CNSTP4 0
+ASGNP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 996
+INDIRP4
+ARGP4
+ADDRLP4 908
+ARGP4
+ADDRLP4 872
+ARGP4
+ADDRLP4 1000
+ADDRGP4 trap_BotReplyChat
+CALLI4
+ASGNI4
+ADDRLP4 1000
+INDIRI4
+CNSTI4 0
+EQI4 $2109
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1008
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 1008
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2111
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+ADDRGP4 $2064
+JUMPV
+LABELV $2109
+LABELV $2107
+LABELV $2105
+LABELV $2097
+LABELV $2084
+LABELV $2081
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 280
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotRemoveConsoleMessage
+CALLV
+pop
+LABELV $2063
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 948
+ADDRGP4 trap_BotNextConsoleMessage
+CALLI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 948
+INDIRI4
+ASGNI4
+ADDRLP4 948
+INDIRI4
+CNSTI4 0
+NEI4 $2062
+LABELV $2064
+LABELV $2061
+endproc BotCheckConsoleMessages 1012 48
+export BotCheckForGrenades
+proc BotCheckForGrenades 8 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $2115
+ADDRFP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $2113
+LABELV $2115
+ADDRGP4 $2112
+JUMPV
+LABELV $2113
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTF4 1126170624
+ARGF4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+LABELV $2112
+endproc BotCheckForGrenades 8 16
+export BotCheckEvents
+proc BotCheckEvents 168 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 132
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 808
+ADDRLP4 132
+INDIRI4
+MULI4
+ADDRGP4 g_entities+552
+ADDP4
+INDIRI4
+NEI4 $2117
+ADDRGP4 $2116
+JUMPV
+LABELV $2117
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDP4
+CNSTI4 808
+ADDRLP4 136
+INDIRI4
+MULI4
+ADDRGP4 g_entities+552
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+LEI4 $2121
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+SUBI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+ADDRGP4 $2122
+JUMPV
+LABELV $2121
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 -769
+BANDI4
+ASGNI4
+LABELV $2122
+ADDRLP4 140
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 1
+LTI4 $2123
+ADDRLP4 140
+INDIRI4
+CNSTI4 76
+GTI4 $2123
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2172-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2172
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2124
+address $2123
+address $2123
+address $2123
+address $2157
+address $2123
+address $2123
+address $2158
+address $2136
+address $2144
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2125
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2123
+address $2124
+code
+LABELV $2125
+ADDRLP4 144
+ADDRFP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 148
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 152
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2126
+ADDRFP4 0
+INDIRP4
+CNSTI4 6000
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5996
+ADDP4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ADDRLP4 148
+INDIRI4
+EQI4 $2131
+ADDRLP4 160
+INDIRI4
+CNSTI4 1023
+EQI4 $2131
+ADDRLP4 160
+INDIRI4
+CNSTI4 1022
+NEI4 $2128
+LABELV $2131
+ADDRFP4 0
+INDIRP4
+CNSTI4 6008
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2129
+JUMPV
+LABELV $2128
+ADDRFP4 0
+INDIRP4
+CNSTI4 6008
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $2129
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 6028
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2124
+JUMPV
+LABELV $2126
+ADDRLP4 148
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2132
+ADDRFP4 0
+INDIRP4
+CNSTI4 6004
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5992
+ADDP4
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6168
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 6032
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $2124
+JUMPV
+LABELV $2132
+ADDRLP4 160
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+NEI4 $2124
+ADDRLP4 144
+INDIRI4
+ADDRLP4 160
+INDIRI4
+NEI4 $2124
+ADDRFP4 0
+INDIRP4
+CNSTI4 6012
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2124
+JUMPV
+LABELV $2136
+ADDRLP4 144
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $2139
+ADDRLP4 144
+INDIRI4
+CNSTI4 256
+LEI4 $2137
+LABELV $2139
+CNSTI4 3
+ARGI4
+ADDRGP4 $2140
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2124
+JUMPV
+LABELV $2137
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $2143
+ARGP4
+ADDRLP4 148
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $2124
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotGoForPowerups
+CALLV
+pop
+ADDRGP4 $2124
+JUMPV
+LABELV $2144
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $2124
+ADDRLP4 144
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $2124
+ADDRLP4 144
+INDIRI4
+CNSTI4 5
+GTI4 $2124
+ADDRLP4 144
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $2156
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $2156
+address $2150
+address $2151
+address $2152
+address $2153
+address $2154
+address $2155
+code
+LABELV $2150
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2124
+JUMPV
+LABELV $2151
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2124
+JUMPV
+LABELV $2152
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2124
+JUMPV
+LABELV $2153
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2124
+JUMPV
+LABELV $2154
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2124
+JUMPV
+LABELV $2155
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $2124
+JUMPV
+LABELV $2157
+ADDRGP4 lastteleport_origin
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 lastteleport_time
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRGP4 $2124
+JUMPV
+LABELV $2158
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $2124
+ADDRLP4 144
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+LTI4 $2163
+ADDRLP4 144
+INDIRI4
+CNSTI4 256
+LEI4 $2161
+LABELV $2163
+CNSTI4 3
+ARGI4
+ADDRGP4 $2164
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $2124
+JUMPV
+LABELV $2161
+ADDRFP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 288
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $2167
+ARGP4
+ADDRLP4 148
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $2124
+ADDRFP4 0
+INDIRP4
+CNSTI4 5072
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2124
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_Use
+CALLV
+pop
+LABELV $2123
+LABELV $2124
+LABELV $2116
+endproc BotCheckEvents 168 12
+export BotCheckSnapshot
+proc BotCheckSnapshot 216 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 vec3_origin
+ARGP4
+CNSTF4 0
+ARGF4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotAddAvoidSpot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6256
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6516
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 208
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2176
+JUMPV
+LABELV $2175
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckForGrenades
+CALLV
+pop
+LABELV $2176
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 208
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 212
+ADDRGP4 BotAI_GetSnapshotEntity
+CALLI4
+ASGNI4
+ADDRLP4 208
+ADDRLP4 212
+INDIRI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 -1
+NEI4 $2175
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRLP4 0+180
+ADDRFP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+184
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotCheckEvents
+CALLV
+pop
+LABELV $2174
+endproc BotCheckSnapshot 216 16
+export BotCheckAir
+proc BotCheckAir 4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5096
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $2181
+ADDRFP4 0
+INDIRP4
+CNSTI4 4936
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_AAS_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $2183
+ADDRGP4 $2180
+JUMPV
+LABELV $2183
+LABELV $2181
+ADDRFP4 0
+INDIRP4
+CNSTI4 6176
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $2180
+endproc BotCheckAir 4 4
+export BotAlternateRoute
+proc BotAlternateRoute 16 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6692
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $2186
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $2188
+ADDRFP4 4
+INDIRP4
+RETP4
+ADDRGP4 $2185
+JUMPV
+LABELV $2188
+ADDRFP4 0
+INDIRP4
+CNSTI4 4948
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6692
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5976
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $2190
+ADDRLP4 12
+INDIRI4
+CNSTI4 20
+GEI4 $2190
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $2190
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6680
+ADDP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6680
+ADDP4
+RETP4
+ADDRGP4 $2185
+JUMPV
+LABELV $2186
+ADDRFP4 4
+INDIRP4
+RETP4
+LABELV $2185
+endproc BotAlternateRoute 16 16
+export BotGetAlternateRouteGoal
+proc BotGetAlternateRouteGoal 28 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $2193
+ADDRLP4 12
+ADDRGP4 red_altroutegoals
+ASGNP4
+ADDRLP4 4
+ADDRGP4 red_numaltroutegoals
+INDIRI4
+ASGNI4
+ADDRGP4 $2194
+JUMPV
+LABELV $2193
+ADDRLP4 12
+ADDRGP4 blue_altroutegoals
+ASGNP4
+ADDRLP4 4
+ADDRGP4 blue_numaltroutegoals
+INDIRI4
+ASGNI4
+LABELV $2194
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $2195
+CNSTI4 0
+RETI4
+ADDRGP4 $2192
+JUMPV
+LABELV $2195
+ADDRLP4 16
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $2197
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $2197
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6680
+ADDP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1090519040
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6736
+ADDP4
+CNSTF4 0
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $2192
+endproc BotGetAlternateRouteGoal 28 0
+export BotSetupAlternativeRouteGoals
+proc BotSetupAlternativeRouteGoals 0 0
+ADDRGP4 altroutegoals_setup
+INDIRI4
+CNSTI4 0
+EQI4 $2200
+ADDRGP4 $2199
+JUMPV
+LABELV $2200
+ADDRGP4 altroutegoals_setup
+CNSTI4 1
+ASGNI4
+LABELV $2199
+endproc BotSetupAlternativeRouteGoals 0 0
+export BotDeathmatchAI
+proc BotDeathmatchAI 1492 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2203
+ADDRLP4 1460
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+ASGNP4
+ADDRLP4 1460
+INDIRP4
+ADDRLP4 1460
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $2205
+ADDRGP4 $2202
+JUMPV
+LABELV $2205
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 148
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 292
+ARGP4
+ADDRGP4 $2207
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6020
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2208
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+EQI4 $2208
+ADDRLP4 1316
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 $2211
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4756
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1316
+ARGP4
+ADDRGP4 trap_EA_Command
+CALLV
+pop
+LABELV $2208
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 109
+NEI4 $2212
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $2213
+JUMPV
+LABELV $2212
+ADDRLP4 148
+INDIRI1
+CVII4 1
+CNSTI4 102
+NEI4 $2214
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $2215
+JUMPV
+LABELV $2214
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+LABELV $2215
+LABELV $2213
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotSetChatName
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 BotSetupAlternativeRouteGoals
+CALLV
+pop
+LABELV $2203
+ADDRLP4 1460
+ADDRFP4 0
+INDIRP4
+CNSTI4 5980
+ADDP4
+ASGNP4
+ADDRLP4 1460
+INDIRP4
+ADDRLP4 1460
+INDIRP4
+INDIRI4
+CNSTI4 -33
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1464
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 1464
+INDIRI4
+CNSTI4 0
+NEI4 $2216
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotSetTeleportTime
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotUpdateInventory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckSnapshot
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckAir
+CALLV
+pop
+LABELV $2216
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCheckConsoleMessages
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1468
+ADDRGP4 BotIntermission
+CALLI4
+ASGNI4
+ADDRLP4 1468
+INDIRI4
+CNSTI4 0
+NEI4 $2218
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1472
+ADDRGP4 BotIsObserver
+CALLI4
+ASGNI4
+ADDRLP4 1472
+INDIRI4
+CNSTI4 0
+NEI4 $2218
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotTeamAI
+CALLV
+pop
+LABELV $2218
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $2220
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2222
+ARGP4
+ADDRGP4 AIEnter_Seek_LTG
+CALLV
+pop
+LABELV $2220
+ADDRFP4 0
+INDIRP4
+CNSTI4 6024
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2223
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+SUBF4
+LEF4 $2223
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1480
+ADDRGP4 BotChat_EnterGame
+CALLI4
+ASGNI4
+ADDRLP4 1480
+INDIRI4
+CNSTI4 0
+EQI4 $2225
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1488
+ADDRGP4 BotChatTime
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6096
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ADDRLP4 1488
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $2227
+ARGP4
+ADDRGP4 AIEnter_Stand
+CALLV
+pop
+LABELV $2225
+ADDRFP4 0
+INDIRP4
+CNSTI4 6024
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $2223
+ADDRGP4 BotResetNodeSwitches
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $2228
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1484
+ADDRFP4 0
+INDIRP4
+CNSTI4 4900
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 1484
+INDIRI4
+CNSTI4 0
+EQI4 $2232
+ADDRGP4 $2230
+JUMPV
+LABELV $2232
+LABELV $2229
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $2228
+LABELV $2230
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $2234
+ADDRGP4 $2202
+JUMPV
+LABELV $2234
+ADDRLP4 0
+INDIRI4
+CNSTI4 50
+LTI4 $2236
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotDumpGoalStack
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotDumpAvoidGoals
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotDumpNodeSwitches
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 3
+ARGI4
+ADDRGP4 $2238
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 floattime
+INDIRF4
+ARGF4
+CNSTI4 50
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2236
+ADDRFP4 0
+INDIRP4
+CNSTI4 6044
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 5068
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6048
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 268
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $2202
+endproc BotDeathmatchAI 1492 20
+export BotSetEntityNumForGoalWithModel
+proc BotSetEntityNumForGoalWithModel 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 G_ModelIndex
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2243
+JUMPV
+LABELV $2240
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2245
+ADDRGP4 $2241
+JUMPV
+LABELV $2245
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $2247
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $2247
+ADDRGP4 $2241
+JUMPV
+LABELV $2247
+ADDRLP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $2249
+ADDRGP4 $2241
+JUMPV
+LABELV $2249
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1120403456
+GEF4 $2253
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2239
+JUMPV
+LABELV $2253
+LABELV $2241
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ASGNP4
+LABELV $2243
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $2240
+LABELV $2239
+endproc BotSetEntityNumForGoalWithModel 44 4
+export BotSetEntityNumForGoal
+proc BotSetEntityNumForGoal 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 $2259
+JUMPV
+LABELV $2256
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $2261
+ADDRGP4 $2257
+JUMPV
+LABELV $2261
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $2263
+ADDRGP4 $2257
+JUMPV
+LABELV $2263
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLengthSquared
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1120403456
+GEF4 $2267
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $2255
+JUMPV
+LABELV $2267
+LABELV $2257
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ASGNP4
+LABELV $2259
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $2256
+LABELV $2255
+endproc BotSetEntityNumForGoal 36 8
+export BotGoalForBSPEntity
+proc BotGoalForBSPEntity 1128 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 0
+ARGI4
+ADDRLP4 1108
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRGP4 $2273
+JUMPV
+LABELV $2270
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1837
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 1112
+INDIRI4
+CNSTI4 0
+NEI4 $2274
+ADDRGP4 $2271
+JUMPV
+LABELV $2274
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1116
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 0
+NEI4 $2276
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $1853
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 1120
+ADDRGP4 trap_AAS_VectorForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 1120
+INDIRI4
+CNSTI4 0
+NEI4 $2278
+CNSTI4 0
+RETI4
+ADDRGP4 $2269
+JUMPV
+LABELV $2278
+ADDRFP4 4
+INDIRP4
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1040
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1040+8
+ADDRLP4 1040+8
+INDIRF4
+CNSTF4 1107296256
+SUBF4
+ASGNF4
+ADDRLP4 1052
+ADDRLP4 1028
+INDIRB
+ASGNB 12
+ADDRLP4 1052+8
+ADDRLP4 1052+8
+INDIRF4
+CNSTF4 1107296256
+ADDF4
+ASGNF4
+ADDRLP4 1040
+ARGP4
+ADDRLP4 1052
+ARGP4
+ADDRLP4 1068
+ARGP4
+CNSTP4 0
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRLP4 1124
+ADDRGP4 trap_AAS_TraceAreas
+CALLI4
+ASGNI4
+ADDRLP4 1064
+ADDRLP4 1124
+INDIRI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $2282
+CNSTI4 0
+RETI4
+ADDRGP4 $2269
+JUMPV
+LABELV $2282
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+CNSTI4 1
+RETI4
+ADDRGP4 $2269
+JUMPV
+LABELV $2276
+LABELV $2271
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1112
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1112
+INDIRI4
+ASGNI4
+LABELV $2273
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2270
+CNSTI4 0
+RETI4
+LABELV $2269
+endproc BotGoalForBSPEntity 1128 20
+export BotSetupDeathmatchAI
+proc BotSetupDeathmatchAI 160 16
+ADDRGP4 $2285
+ARGP4
+ADDRLP4 136
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 gametype
+ADDRLP4 136
+INDIRI4
+ASGNI4
+ADDRGP4 $280
+ARGP4
+ADDRLP4 140
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 maxclients
+ADDRLP4 140
+INDIRI4
+ASGNI4
+ADDRGP4 bot_rocketjump
+ARGP4
+ADDRGP4 $2286
+ARGP4
+ADDRGP4 $2100
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_grapple
+ARGP4
+ADDRGP4 $2287
+ARGP4
+ADDRGP4 $2288
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_fastchat
+ARGP4
+ADDRGP4 $2289
+ARGP4
+ADDRGP4 $2288
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_nochat
+ARGP4
+ADDRGP4 $2290
+ARGP4
+ADDRGP4 $2288
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 $2099
+ARGP4
+ADDRGP4 $2288
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_challenge
+ARGP4
+ADDRGP4 $2291
+ARGP4
+ADDRGP4 $2288
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_predictobstacles
+ARGP4
+ADDRGP4 $2292
+ARGP4
+ADDRGP4 $2100
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 g_spSkill
+ARGP4
+ADDRGP4 $2293
+ARGP4
+ADDRGP4 $2294
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $2295
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2299
+ARGP4
+ADDRGP4 ctf_redflag
+ARGP4
+ADDRLP4 144
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+GEI4 $2297
+CNSTI4 2
+ARGI4
+ADDRGP4 $2300
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2297
+CNSTI4 -1
+ARGI4
+ADDRGP4 $2303
+ARGP4
+ADDRGP4 ctf_blueflag
+ARGP4
+ADDRLP4 148
+ADDRGP4 trap_BotGetLevelItemGoal
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+GEI4 $2301
+CNSTI4 2
+ARGI4
+ADDRGP4 $2304
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $2301
+LABELV $2295
+ADDRLP4 144
+CNSTI4 0
+ASGNI4
+ADDRGP4 max_bspmodelindex
+ADDRLP4 144
+INDIRI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+ARGI4
+ADDRLP4 148
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRGP4 $2308
+JUMPV
+LABELV $2305
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRLP4 152
+ADDRGP4 trap_AAS_ValueForBSPEpairKey
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+NEI4 $2309
+ADDRGP4 $2306
+JUMPV
+LABELV $2309
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $2311
+ADDRLP4 4+1
+ARGP4
+ADDRLP4 156
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRGP4 max_bspmodelindex
+INDIRI4
+LEI4 $2314
+ADDRGP4 max_bspmodelindex
+ADDRLP4 132
+INDIRI4
+ASGNI4
+LABELV $2314
+LABELV $2311
+LABELV $2306
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 152
+ADDRGP4 trap_AAS_NextBSPEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 152
+INDIRI4
+ASGNI4
+LABELV $2308
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $2305
+ADDRGP4 BotInitWaypoints
+CALLV
+pop
+LABELV $2284
+endproc BotSetupDeathmatchAI 160 16
+export BotShutdownDeathmatchAI
+proc BotShutdownDeathmatchAI 0 0
+ADDRGP4 altroutegoals_setup
+CNSTI4 0
+ASGNI4
+LABELV $2316
+endproc BotShutdownDeathmatchAI 0 0
+bss
+export blue_numaltroutegoals
+align 4
+LABELV blue_numaltroutegoals
+skip 4
+export blue_altroutegoals
+align 4
+LABELV blue_altroutegoals
+skip 768
+export red_numaltroutegoals
+align 4
+LABELV red_numaltroutegoals
+skip 4
+export red_altroutegoals
+align 4
+LABELV red_altroutegoals
+skip 768
+export altroutegoals_setup
+align 4
+LABELV altroutegoals_setup
+skip 4
+export max_bspmodelindex
+align 4
+LABELV max_bspmodelindex
+skip 4
+export lastteleport_time
+align 4
+LABELV lastteleport_time
+skip 4
+export lastteleport_origin
+align 4
+LABELV lastteleport_origin
+skip 12
+import bot_developer
+export g_spSkill
+align 4
+LABELV g_spSkill
+skip 272
+export bot_predictobstacles
+align 4
+LABELV bot_predictobstacles
+skip 272
+export botai_freewaypoints
+align 4
+LABELV botai_freewaypoints
+skip 4
+export botai_waypoints
+align 4
+LABELV botai_waypoints
+skip 12800
+import BotVoiceChatOnly
+import BotVoiceChat
+import BotSetTeamMateTaskPreference
+import BotGetTeamMateTaskPreference
+import BotTeamAI
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+export ctf_blueflag
+align 4
+LABELV ctf_blueflag
+skip 56
+export ctf_redflag
+align 4
+LABELV ctf_redflag
+skip 56
+export bot_challenge
+align 4
+LABELV bot_challenge
+skip 272
+export bot_testrchat
+align 4
+LABELV bot_testrchat
+skip 272
+export bot_nochat
+align 4
+LABELV bot_nochat
+skip 272
+export bot_fastchat
+align 4
+LABELV bot_fastchat
+skip 272
+export bot_rocketjump
+align 4
+LABELV bot_rocketjump
+skip 272
+export bot_grapple
+align 4
+LABELV bot_grapple
+skip 272
+export maxclients
+align 4
+LABELV maxclients
+skip 4
+export gametype
+align 4
+LABELV gametype
+skip 4
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import DeathmatchScoreboardMessage
+import G_SetStats
+import MoveClientToIntermission
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import G_RunMissile
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $2304
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $2303
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $2300
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $2299
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $2294
+byte 1 50
+byte 1 0
+align 1
+LABELV $2293
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $2292
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 98
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $2291
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $2290
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2289
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2288
+byte 1 48
+byte 1 0
+align 1
+LABELV $2287
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $2286
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $2285
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $2238
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 73
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $2227
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $2222
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $2211
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $2207
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $2167
+byte 1 42
+byte 1 102
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2164
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2143
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 117
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $2140
+byte 1 69
+byte 1 86
+byte 1 95
+byte 1 71
+byte 1 76
+byte 1 79
+byte 1 66
+byte 1 65
+byte 1 76
+byte 1 95
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 80
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 32
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 41
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $2111
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $2104
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 42
+byte 1 10
+byte 1 0
+align 1
+LABELV $2103
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $2100
+byte 1 49
+byte 1 0
+align 1
+LABELV $2099
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $1965
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1964
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 73
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 49
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $1960
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 111
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $1948
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1947
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $1944
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $1933
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1920
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1914
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 10
+byte 1 0
+align 1
+LABELV $1906
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $1895
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1891
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1888
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $1853
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $1848
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $1843
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $1840
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $1837
+byte 1 99
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $1836
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 71
+byte 1 101
+byte 1 116
+byte 1 65
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 71
+byte 1 111
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $1824
+byte 1 42
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $1639
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $1616
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $1613
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $1575
+byte 1 109
+byte 1 112
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 0
+align 1
+LABELV $1520
+byte 1 113
+byte 1 51
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 54
+byte 1 0
+align 1
+LABELV $1516
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $670
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $669
+byte 1 83
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $668
+byte 1 66
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 117
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $667
+byte 1 82
+byte 1 101
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $666
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $499
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 87
+byte 1 97
+byte 1 121
+byte 1 80
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 79
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 121
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $325
+byte 1 93
+byte 1 0
+align 1
+LABELV $324
+byte 1 91
+byte 1 0
+align 1
+LABELV $323
+byte 1 32
+byte 1 0
+align 1
+LABELV $280
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $275
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $274
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $269
+byte 1 110
+byte 1 0
+align 1
+LABELV $268
+byte 1 91
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 93
+byte 1 0
+align 1
+LABELV $267
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $186
+byte 1 111
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $161
+byte 1 105
+byte 1 104
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $160
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $159
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $136
+byte 1 110
+byte 1 111
+byte 1 0
+align 1
+LABELV $68
+byte 1 116
+byte 1 0
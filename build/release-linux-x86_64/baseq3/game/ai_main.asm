@@ -0,0 +1,10814 @@
+export BotAI_Print
+code
+proc BotAI_Print 2056 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 2052
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 1
+LTI4 $56
+ADDRLP4 2052
+INDIRI4
+CNSTI4 5
+GTI4 $56
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $69-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $69
+address $58
+address $60
+address $62
+address $64
+address $66
+code
+LABELV $58
+ADDRGP4 $59
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $57
+JUMPV
+LABELV $60
+ADDRGP4 $61
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $57
+JUMPV
+LABELV $62
+ADDRGP4 $63
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $57
+JUMPV
+LABELV $64
+ADDRGP4 $65
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $57
+JUMPV
+LABELV $66
+ADDRGP4 $67
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+ADDRGP4 $57
+JUMPV
+LABELV $56
+ADDRGP4 $68
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $57
+LABELV $54
+endproc BotAI_Print 2056 16
+export BotAI_Trace
+proc BotAI_Trace 56 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0+4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 0+12
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 0+24+12
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0+24
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 41
+ADDP4
+ADDRLP4 0+24+17
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0+24+16
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 0+44
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 0+52
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $71
+endproc BotAI_Trace 56 28
+export BotAI_GetClientState
+proc BotAI_GetClientState 4 12
+ADDRLP4 0
+CNSTI4 808
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $85
+CNSTI4 0
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $85
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $87
+CNSTI4 0
+RETI4
+ADDRGP4 $84
+JUMPV
+LABELV $87
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 468
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+LABELV $84
+endproc BotAI_GetClientState 4 12
+export BotAI_GetEntityState
+proc BotAI_GetEntityState 4 12
+ADDRLP4 0
+CNSTI4 808
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 208
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $90
+CNSTI4 0
+RETI4
+ADDRGP4 $89
+JUMPV
+LABELV $90
+ADDRLP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $92
+CNSTI4 0
+RETI4
+ADDRGP4 $89
+JUMPV
+LABELV $92
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $94
+CNSTI4 0
+RETI4
+ADDRGP4 $89
+JUMPV
+LABELV $94
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 208
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+CNSTI4 1
+RETI4
+LABELV $89
+endproc BotAI_GetEntityState 4 12
+export BotAI_GetSnapshotEntity
+proc BotAI_GetSnapshotEntity 8 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 trap_BotGetSnapshotEntity
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $97
+ADDRFP4 8
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 208
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+CNSTI4 -1
+RETI4
+ADDRGP4 $96
+JUMPV
+LABELV $97
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_GetEntityState
+CALLI4
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+RETI4
+LABELV $96
+endproc BotAI_GetSnapshotEntity 8 12
+export BotAI_BotInitialChat
+proc BotAI_BotInitialChat 56 44
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 40
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 40
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 48
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $101
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $105
+ADDRGP4 $103
+JUMPV
+LABELV $105
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 40
+INDIRP4
+CNSTU4 4
+ADDP4
+ASGNP4
+ADDRLP4 40
+ADDRLP4 52
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 52
+INDIRP4
+CNSTI4 -4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $102
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LTI4 $101
+LABELV $103
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 BotSynonymContext
+CALLI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8+4
+INDIRP4
+ARGP4
+ADDRLP4 8+8
+INDIRP4
+ARGP4
+ADDRLP4 8+12
+INDIRP4
+ARGP4
+ADDRLP4 8+16
+INDIRP4
+ARGP4
+ADDRLP4 8+20
+INDIRP4
+ARGP4
+ADDRLP4 8+24
+INDIRP4
+ARGP4
+ADDRLP4 8+28
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotInitialChat
+CALLV
+pop
+LABELV $99
+endproc BotAI_BotInitialChat 56 44
+export BotTestAAS
+proc BotTestAAS 64 16
+ADDRGP4 bot_testsolid
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testclusters
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testsolid+12
+INDIRI4
+CNSTI4 0
+EQI4 $115
+ADDRLP4 56
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $118
+ADDRGP4 $114
+JUMPV
+LABELV $118
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $120
+CNSTI4 1
+ARGI4
+ADDRGP4 $122
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $116
+JUMPV
+LABELV $120
+CNSTI4 1
+ARGI4
+ADDRGP4 $123
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $116
+JUMPV
+LABELV $115
+ADDRGP4 bot_testclusters+12
+INDIRI4
+CNSTI4 0
+EQI4 $124
+ADDRLP4 56
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+NEI4 $127
+ADDRGP4 $114
+JUMPV
+LABELV $127
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $129
+CNSTI4 1
+ARGI4
+ADDRGP4 $131
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $130
+JUMPV
+LABELV $129
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_AAS_AreaInfo
+CALLI4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $132
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4+12
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $130
+LABELV $124
+LABELV $116
+LABELV $114
+endproc BotTestAAS 64 16
+export BotReportStatus
+proc BotReportStatus 560 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 548
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 548
+INDIRI4
+CNSTI4 0
+NEI4 $135
+ADDRLP4 288
+ADDRGP4 $137
+ASGNP4
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRLP4 288
+ADDRGP4 $138
+ASGNP4
+LABELV $136
+ADDRLP4 256
+ARGP4
+ADDRGP4 $139
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $140
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 552
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 552
+INDIRI4
+CNSTI4 0
+EQI4 $142
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 556
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 556
+INDIRI4
+CNSTI4 1
+NEI4 $144
+ADDRLP4 256
+ARGP4
+ADDRGP4 $146
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $145
+JUMPV
+LABELV $144
+ADDRLP4 256
+ARGP4
+ADDRGP4 $147
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $145
+LABELV $142
+LABELV $140
+ADDRLP4 552
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 552
+INDIRI4
+CNSTI4 1
+LTI4 $148
+ADDRLP4 552
+INDIRI4
+CNSTI4 13
+GTI4 $148
+ADDRLP4 552
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $176-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $176
+address $151
+address $153
+address $155
+address $165
+address $167
+address $169
+address $161
+address $161
+address $163
+address $157
+address $159
+address $173
+address $171
+code
+LABELV $151
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 292
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $153
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $154
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 292
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $155
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $156
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 292
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $157
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 292
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $159
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 $160
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRLP4 292
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $161
+CNSTI4 1
+ARGI4
+ADDRGP4 $162
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $163
+CNSTI4 1
+ARGI4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $165
+CNSTI4 1
+ARGI4
+ADDRGP4 $166
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $167
+CNSTI4 1
+ARGI4
+ADDRGP4 $168
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $169
+CNSTI4 1
+ARGI4
+ADDRGP4 $170
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $171
+CNSTI4 1
+ARGI4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $173
+CNSTI4 1
+ARGI4
+ADDRGP4 $174
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRGP4 $149
+JUMPV
+LABELV $148
+CNSTI4 1
+ARGI4
+ADDRGP4 $175
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+LABELV $149
+LABELV $134
+endproc BotReportStatus 560 24
+export BotTeamplayReport
+proc BotTeamplayReport 1056 12
+CNSTI4 1
+ARGI4
+ADDRGP4 $179
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $183
+JUMPV
+LABELV $180
+ADDRLP4 1028
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $186
+ADDRLP4 1028
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $184
+LABELV $186
+ADDRGP4 $181
+JUMPV
+LABELV $184
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+EQI4 $190
+ADDRLP4 4
+ARGP4
+ADDRGP4 $189
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $187
+LABELV $190
+ADDRGP4 $181
+JUMPV
+LABELV $187
+ADDRLP4 4
+ARGP4
+ADDRGP4 $193
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 1
+NEI4 $191
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotReportStatus
+CALLV
+pop
+LABELV $191
+LABELV $181
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $183
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $194
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $180
+LABELV $194
+CNSTI4 1
+ARGI4
+ADDRGP4 $195
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $199
+JUMPV
+LABELV $196
+ADDRLP4 1032
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $202
+ADDRLP4 1032
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $200
+LABELV $202
+ADDRGP4 $197
+JUMPV
+LABELV $200
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+EQI4 $205
+ADDRLP4 4
+ARGP4
+ADDRGP4 $189
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $203
+LABELV $205
+ADDRGP4 $197
+JUMPV
+LABELV $203
+ADDRLP4 4
+ARGP4
+ADDRGP4 $193
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 2
+NEI4 $206
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotReportStatus
+CALLV
+pop
+LABELV $206
+LABELV $197
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $199
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $208
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $196
+LABELV $208
+LABELV $178
+endproc BotTeamplayReport 1056 12
+export BotSetInfoConfigString
+proc BotSetInfoConfigString 880 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 256
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 864
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 864
+INDIRI4
+CNSTI4 0
+NEI4 $210
+ADDRLP4 544
+ADDRGP4 $137
+ASGNP4
+ADDRGP4 $211
+JUMPV
+LABELV $210
+ADDRLP4 544
+ADDRGP4 $138
+ASGNP4
+LABELV $211
+ADDRLP4 512
+ARGP4
+ADDRGP4 $139
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 4
+NEI4 $212
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 868
+ADDRGP4 BotCTFCarryingFlag
+CALLI4
+ASGNI4
+ADDRLP4 868
+INDIRI4
+CNSTI4 0
+EQI4 $214
+ADDRLP4 512
+ARGP4
+ADDRGP4 $216
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $214
+LABELV $212
+ADDRLP4 868
+ADDRFP4 0
+INDIRP4
+CNSTI4 6600
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 868
+INDIRI4
+CNSTI4 1
+LTI4 $217
+ADDRLP4 868
+INDIRI4
+CNSTI4 13
+GTI4 $217
+ADDRLP4 868
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $246-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $246
+address $220
+address $222
+address $224
+address $234
+address $236
+address $238
+address $230
+address $230
+address $232
+address $226
+address $228
+address $242
+address $240
+code
+LABELV $220
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $221
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $218
+JUMPV
+LABELV $222
+ADDRFP4 0
+INDIRP4
+CNSTI4 6604
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 EasyClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $223
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $218
+JUMPV
+LABELV $224
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $225
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $218
+JUMPV
+LABELV $226
+ADDRFP4 0
+INDIRP4
+CNSTI4 6668
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $227
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $218
+JUMPV
+LABELV $228
+ADDRFP4 0
+INDIRP4
+CNSTI4 6664
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $229
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $218
+JUMPV
+LABELV $230
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $231
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $218
+JUMPV
+LABELV $232
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $233
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $218
+JUMPV
+LABELV $234
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $235
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $218
+JUMPV
+LABELV $236
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $237
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $218
+JUMPV
+LABELV $238
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $239
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $218
+JUMPV
+LABELV $240
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $241
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $218
+JUMPV
+LABELV $242
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $243
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $218
+JUMPV
+LABELV $217
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 808
+ARGP4
+ADDRGP4 trap_BotGetTopGoal
+CALLI4
+pop
+ADDRLP4 808+44
+INDIRI4
+ARGI4
+ADDRLP4 552
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGoalName
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $245
+ARGP4
+ADDRLP4 552
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $218
+ADDRGP4 $248
+ARGP4
+ADDRLP4 544
+INDIRP4
+ARGP4
+ADDRLP4 512
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 876
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 548
+ADDRLP4 876
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 25
+ADDI4
+ARGI4
+ADDRLP4 548
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $209
+endproc BotSetInfoConfigString 880 16
+export BotUpdateInfoConfigStrings
+proc BotUpdateInfoConfigStrings 1044 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $253
+JUMPV
+LABELV $250
+ADDRLP4 1028
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $256
+ADDRLP4 1028
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $254
+LABELV $256
+ADDRGP4 $251
+JUMPV
+LABELV $254
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+EQI4 $259
+ADDRLP4 4
+ARGP4
+ADDRGP4 $189
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $257
+LABELV $259
+ADDRGP4 $251
+JUMPV
+LABELV $257
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotSetInfoConfigString
+CALLV
+pop
+LABELV $251
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $253
+ADDRLP4 0
+INDIRI4
+ADDRGP4 maxclients
+INDIRI4
+GEI4 $260
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $250
+LABELV $260
+LABELV $249
+endproc BotUpdateInfoConfigStrings 1044 12
+export BotInterbreedBots
+proc BotInterbreedBots 288 20
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $262
+ADDRLP4 272
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $266
+ADDRLP4 272
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $266
+ADDRLP4 276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 280
+ADDRLP4 276
+INDIRI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 276
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 280
+INDIRP4
+CNSTI4 6032
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 280
+INDIRP4
+CNSTI4 6028
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+LABELV $267
+LABELV $263
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $262
+CNSTI4 64
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 268
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 272
+ADDRGP4 trap_GeneticParentsAndChildSelection
+CALLI4
+ASGNI4
+ADDRLP4 272
+INDIRI4
+CNSTI4 0
+EQI4 $268
+ADDRLP4 276
+CNSTI4 2
+ASGNI4
+ADDRLP4 280
+ADDRGP4 botstates
+ASGNP4
+ADDRLP4 284
+CNSTI4 6528
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRLP4 276
+INDIRI4
+LSHI4
+ADDRLP4 280
+INDIRP4
+ADDP4
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 268
+INDIRI4
+ADDRLP4 276
+INDIRI4
+LSHI4
+ADDRLP4 280
+INDIRP4
+ADDP4
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 276
+INDIRI4
+LSHI4
+ADDRLP4 280
+INDIRP4
+ADDP4
+INDIRP4
+ADDRLP4 284
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotInterbreedGoalFuzzyLogic
+CALLV
+pop
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_BotMutateGoalFuzzyLogic
+CALLV
+pop
+LABELV $268
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $270
+ADDRLP4 276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $274
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $274
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6032
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6028
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $274
+LABELV $271
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $270
+LABELV $261
+endproc BotInterbreedBots 288 20
+export BotWriteInterbreeded
+proc BotWriteInterbreeded 24 8
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $277
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $281
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $281
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+CNSTI4 6032
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 6028
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRGP4 $282
+JUMPV
+LABELV $281
+ADDRLP4 4
+CNSTF4 3212836864
+ASGNF4
+LABELV $282
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $283
+ADDRLP4 8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $283
+LABELV $278
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $277
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $285
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotSaveGoalFuzzyLogic
+CALLV
+pop
+LABELV $285
+LABELV $276
+endproc BotWriteInterbreeded 24 8
+export BotInterbreedEndMatch
+proc BotInterbreedEndMatch 8 8
+ADDRGP4 bot_interbreed
+INDIRI4
+CNSTI4 0
+NEI4 $288
+ADDRGP4 $287
+JUMPV
+LABELV $288
+ADDRLP4 0
+ADDRGP4 bot_interbreedmatchcount
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 bot_interbreedcycle+12
+INDIRI4
+LTI4 $290
+ADDRGP4 bot_interbreedmatchcount
+CNSTI4 0
+ASGNI4
+ADDRGP4 bot_interbreedwrite
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_interbreedwrite+16
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $293
+ADDRGP4 bot_interbreedwrite+16
+ARGP4
+ADDRGP4 BotWriteInterbreeded
+CALLV
+pop
+ADDRGP4 $297
+ARGP4
+ADDRGP4 $298
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $293
+ADDRGP4 BotInterbreedBots
+CALLV
+pop
+LABELV $290
+LABELV $287
+endproc BotInterbreedEndMatch 8 8
+export BotInterbreeding
+proc BotInterbreeding 16 20
+ADDRGP4 bot_interbreedchar
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_interbreedchar+16
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $300
+ADDRGP4 $299
+JUMPV
+LABELV $300
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 1
+EQI4 $303
+ADDRGP4 $306
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRGP4 $305
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 ExitLevel
+CALLV
+pop
+ADDRGP4 $299
+JUMPV
+LABELV $303
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $307
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $311
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $311
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIShutdownClient
+CALLI4
+pop
+LABELV $311
+LABELV $308
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $307
+ADDRGP4 $313
+ARGP4
+ADDRGP4 $314
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $318
+JUMPV
+LABELV $315
+ADDRGP4 $320
+ARGP4
+ADDRGP4 bot_interbreedchar+16
+ARGP4
+CNSTI4 50
+ADDRLP4 0
+INDIRI4
+MULI4
+ARGI4
+ADDRGP4 bot_interbreedchar+16
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $316
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $318
+ADDRLP4 0
+INDIRI4
+ADDRGP4 bot_interbreedbots+12
+INDIRI4
+LTI4 $315
+ADDRGP4 $323
+ARGP4
+ADDRGP4 $298
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 bot_interbreed
+CNSTI4 1
+ASGNI4
+LABELV $299
+endproc BotInterbreeding 16 20
+export BotEntityInfo
+proc BotEntityInfo 0 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_AAS_EntityInfo
+CALLV
+pop
+LABELV $324
+endproc BotEntityInfo 0 8
+export NumBots
+proc NumBots 0 0
+ADDRGP4 numbots
+INDIRI4
+RETI4
+LABELV $325
+endproc NumBots 0 0
+export BotTeamLeader
+proc BotTeamLeader 12 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $327
+CNSTI4 0
+RETI4
+ADDRGP4 $326
+JUMPV
+LABELV $327
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $331
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $329
+LABELV $331
+CNSTI4 0
+RETI4
+ADDRGP4 $326
+JUMPV
+LABELV $329
+CNSTI4 1
+RETI4
+LABELV $326
+endproc BotTeamLeader 12 4
+export AngleDifference
+proc AngleDifference 12 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $333
+ADDRLP4 0
+INDIRF4
+CNSTF4 1127481344
+LEF4 $334
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $334
+JUMPV
+LABELV $333
+ADDRLP4 0
+INDIRF4
+CNSTF4 3274964992
+GEF4 $337
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $337
+LABELV $334
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $332
+endproc AngleDifference 12 0
+export BotChangeViewAngle
+proc BotChangeViewAngle 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 4
+INDIRF4
+NEF4 $340
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $339
+JUMPV
+LABELV $340
+ADDRLP4 0
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+LEF4 $342
+ADDRLP4 0
+INDIRF4
+CNSTF4 1127481344
+LEF4 $343
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRLP4 0
+INDIRF4
+CNSTF4 3274964992
+GEF4 $346
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $346
+LABELV $343
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LEF4 $348
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LEF4 $349
+ADDRLP4 0
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+GEF4 $352
+ADDRLP4 0
+ADDRFP4 8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $352
+LABELV $349
+ADDRFP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+RETF4
+LABELV $339
+endproc BotChangeViewAngle 24 4
+export BotChangeViewAngles
+proc BotChangeViewAngles 80 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $355
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $355
+ADDRFP4 0
+INDIRP4
+CNSTI4 6540
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $357
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+CNSTF4 1008981770
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 28
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 5
+ARGI4
+CNSTF4 1065353216
+ARGF4
+CNSTF4 1155596288
+ARGF4
+ADDRLP4 32
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRGP4 $358
+JUMPV
+LABELV $357
+ADDRLP4 16
+CNSTF4 1028443341
+ASGNF4
+ADDRLP4 8
+CNSTF4 1135869952
+ASGNF4
+LABELV $358
+ADDRLP4 8
+INDIRF4
+CNSTF4 1131413504
+GEF4 $359
+ADDRLP4 8
+CNSTF4 1131413504
+ASGNF4
+LABELV $359
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $361
+ADDRGP4 bot_challenge+12
+INDIRI4
+CNSTI4 0
+EQI4 $365
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 40
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $368
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $368
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 BotChangeViewAngle
+CALLF4
+ASGNF4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRGP4 $366
+JUMPV
+LABELV $365
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6576
+ADDP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 AngleDifference
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 56
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 20
+INDIRF4
+SUBF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $370
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $370
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 3274964992
+GEF4 $372
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDP4
+ADDRLP4 8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $372
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $374
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $374
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+NEGF4
+GEF4 $376
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $376
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6588
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTF4 1055286886
+CNSTF4 1065353216
+ADDRLP4 16
+INDIRF4
+SUBF4
+MULF4
+MULF4
+ASGNF4
+LABELV $366
+LABELV $362
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $361
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+INDIRF4
+CNSTF4 1127481344
+LEF4 $378
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $378
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ARGP4
+ADDRGP4 trap_EA_View
+CALLV
+pop
+LABELV $354
+endproc BotChangeViewAngles 80 16
+export BotInputToUserCommand
+proc BotInputToUserCommand 136 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 24
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 -32769
+BANDI4
+ASGNI4
+LABELV $381
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $383
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $383
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $385
+ADDRLP4 44
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $385
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 65536
+BANDI4
+CNSTI4 0
+EQI4 $387
+ADDRLP4 48
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $387
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 131072
+BANDI4
+CNSTI4 0
+EQI4 $389
+ADDRLP4 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $389
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $391
+ADDRLP4 56
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $391
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 524288
+BANDI4
+CNSTI4 0
+EQI4 $393
+ADDRLP4 60
+CNSTI4 16
+ASGNI4
+ADDRLP4 64
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+BORI4
+ASGNI4
+LABELV $393
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 1048576
+BANDI4
+CNSTI4 0
+EQI4 $395
+ADDRLP4 68
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $395
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 2097152
+BANDI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 72
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $397
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8388608
+BANDI4
+CNSTI4 0
+EQI4 $399
+ADDRLP4 76
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 128
+BORI4
+ASGNI4
+LABELV $399
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 16777216
+BANDI4
+CNSTI4 0
+EQI4 $401
+ADDRLP4 80
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+LABELV $401
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 33554432
+BANDI4
+CNSTI4 0
+EQI4 $403
+ADDRLP4 84
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+LABELV $403
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 134217728
+BANDI4
+CNSTI4 0
+EQI4 $405
+ADDRLP4 88
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+LABELV $405
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 1199570944
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 1199570944
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1199570944
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $407
+ADDRLP4 92
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 96
+ADDRLP4 92
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 96
+INDIRP4
+INDIRI4
+ADDRLP4 92
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRI4
+SUBI4
+CVII2 4
+ASGNI2
+ADDRLP4 96
+INDIRP4
+ADDRLP4 4
+INDIRI2
+CVII4 2
+ASGNI4
+LABELV $408
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $407
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $411
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $412
+JUMPV
+LABELV $411
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+LABELV $412
+ADDRLP4 20+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 32
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+CNSTF4 1123942400
+ADDRLP4 92
+INDIRP4
+INDIRF4
+MULF4
+CNSTF4 1137180672
+DIVF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 21
+ADDP4
+ADDRLP4 8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 8+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 8+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+CVFI4 4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+INDIRP4
+CNSTI4 22
+ADDP4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 32+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 32+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+CVFI4 4
+CVII1 4
+ASGNI1
+ADDRLP4 8+8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 104
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 23
+ADDP4
+ADDRLP4 104
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+CVFI4 4
+CVII1 4
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $420
+ADDRLP4 112
+ADDRFP4 4
+INDIRP4
+CNSTI4 21
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+ADDI4
+CVII1 4
+ASGNI1
+LABELV $420
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $422
+ADDRLP4 116
+ADDRFP4 4
+INDIRP4
+CNSTI4 21
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+SUBI4
+CVII1 4
+ASGNI1
+LABELV $422
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $424
+ADDRLP4 120
+ADDRFP4 4
+INDIRP4
+CNSTI4 22
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+SUBI4
+CVII1 4
+ASGNI1
+LABELV $424
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $426
+ADDRLP4 124
+ADDRFP4 4
+INDIRP4
+CNSTI4 22
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+ADDI4
+CVII1 4
+ASGNI1
+LABELV $426
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $428
+ADDRLP4 128
+ADDRFP4 4
+INDIRP4
+CNSTI4 23
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+ADDI4
+CVII1 4
+ASGNI1
+LABELV $428
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $430
+ADDRLP4 132
+ADDRFP4 4
+INDIRP4
+CNSTI4 23
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 127
+SUBI4
+CVII1 4
+ASGNI1
+LABELV $430
+LABELV $380
+endproc BotInputToUserCommand 136 16
+export BotUpdateInput
+proc BotUpdateInput 64 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $433
+ADDRLP4 44
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 44
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+LABELV $434
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $433
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRGP4 BotChangeViewAngles
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_EA_GetInput
+CALLV
+pop
+ADDRLP4 4+32
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $437
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $440
+ADDRLP4 4+32
+ADDRLP4 4+32
+INDIRI4
+CNSTI4 -10
+BANDI4
+ASGNI4
+LABELV $440
+LABELV $437
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotInputToUserCommand
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $443
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 48
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 48
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 60
+INDIRF4
+ASGNF4
+LABELV $444
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $443
+LABELV $432
+endproc BotUpdateInput 64 16
+export BotAIRegularUpdate
+proc BotAIRegularUpdate 0 0
+ADDRGP4 regularupdate_time
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $448
+ADDRGP4 trap_BotUpdateEntityItems
+CALLV
+pop
+ADDRGP4 regularupdate_time
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1050253722
+ADDF4
+ASGNF4
+LABELV $448
+LABELV $447
+endproc BotAIRegularUpdate 0 0
+export RemoveColorEscapeSequences
+proc RemoveColorEscapeSequences 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $454
+JUMPV
+LABELV $451
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $455
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $455
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $455
+ADDRLP4 16
+INDIRI4
+CNSTI4 65
+LTI4 $458
+ADDRLP4 16
+INDIRI4
+CNSTI4 90
+LEI4 $457
+LABELV $458
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 97
+LTI4 $459
+ADDRLP4 20
+INDIRI4
+CNSTI4 122
+LEI4 $457
+LABELV $459
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 48
+LTI4 $455
+ADDRLP4 24
+INDIRI4
+CNSTI4 57
+GTI4 $455
+LABELV $457
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $452
+JUMPV
+LABELV $455
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 126
+LEI4 $460
+ADDRGP4 $452
+JUMPV
+LABELV $460
+ADDRLP4 28
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+LABELV $452
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $454
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $451
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $450
+endproc RemoveColorEscapeSequences 36 0
+export BotAI
+proc BotAI 1092 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_ResetInput
+CALLV
+pop
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $465
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $463
+LABELV $465
+CNSTI4 4
+ARGI4
+ADDRGP4 $466
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $462
+JUMPV
+LABELV $463
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRGP4 $468
+JUMPV
+LABELV $467
+ADDRLP4 12
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 1040
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $470
+ADDRGP4 $468
+JUMPV
+LABELV $470
+ADDRLP4 1044
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1044
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 RemoveColorEscapeSequences
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 $474
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $472
+ADDRGP4 $473
+JUMPV
+LABELV $472
+ADDRLP4 12
+ARGP4
+ADDRGP4 $477
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $475
+ADDRGP4 $476
+JUMPV
+LABELV $475
+ADDRLP4 12
+ARGP4
+ADDRGP4 $480
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $478
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 1060
+INDIRI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotQueueConsoleMessage
+CALLV
+pop
+ADDRGP4 $479
+JUMPV
+LABELV $478
+ADDRLP4 12
+ARGP4
+ADDRGP4 $483
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $481
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1072
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotQueueConsoleMessage
+CALLV
+pop
+ADDRGP4 $482
+JUMPV
+LABELV $481
+ADDRLP4 12
+ARGP4
+ADDRGP4 $486
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $484
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+ADDRLP4 1068
+INDIRI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1076
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1076
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_BotQueueConsoleMessage
+CALLV
+pop
+ADDRGP4 $485
+JUMPV
+LABELV $484
+ADDRLP4 12
+ARGP4
+ADDRGP4 $489
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1068
+INDIRI4
+CNSTI4 0
+NEI4 $487
+ADDRGP4 $488
+JUMPV
+LABELV $487
+ADDRLP4 12
+ARGP4
+ADDRGP4 $492
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1072
+INDIRI4
+CNSTI4 0
+NEI4 $490
+LABELV $490
+LABELV $488
+LABELV $485
+LABELV $482
+LABELV $479
+LABELV $476
+LABELV $473
+LABELV $468
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1040
+ADDRGP4 trap_BotGetServerCommand
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $467
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $493
+ADDRLP4 1044
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 1056
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1052
+INDIRP4
+ADDRLP4 1056
+INDIRF4
+ASGNF4
+LABELV $494
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $493
+ADDRLP4 1044
+ADDRLP4 4
+INDIRP4
+CNSTI4 6060
+ADDP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ADDRLP4 1044
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4904
+ADDP4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4908
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 4936
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 1060
+ADDRLP4 4
+INDIRP4
+CNSTI4 4944
+ADDP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ADDRLP4 1060
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4908
+ADDP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 4948
+ADDP4
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 BotDeathmatchAI
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 6560
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_EA_SelectWeapon
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $497
+ADDRLP4 1076
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1084
+ADDRLP4 1076
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 6564
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 1084
+INDIRP4
+INDIRF4
+CNSTF4 1001652224
+ADDRLP4 1076
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+SUBF4
+ARGF4
+ADDRLP4 1088
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 1084
+INDIRP4
+ADDRLP4 1088
+INDIRF4
+ASGNF4
+LABELV $498
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $497
+CNSTI4 1
+RETI4
+LABELV $462
+endproc BotAI 1092 12
+export BotScheduleBotThink
+proc BotScheduleBotThink 16 0
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $502
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $508
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $506
+LABELV $508
+ADDRGP4 $503
+JUMPV
+LABELV $506
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 bot_thinktime+12
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 numbots
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $503
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $502
+LABELV $501
+endproc BotScheduleBotThink 16 0
+export BotWriteSessionData
+proc BotWriteSessionData 20 72
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $511
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6764
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6780
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6808
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6816
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6820
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6812
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6768
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6772
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6776
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6784
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6788
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6796
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6800
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6804
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRGP4 $512
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $510
+endproc BotWriteSessionData 20 72
+export BotReadSessionData
+proc BotReadSessionData 1036 76
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $512
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1028
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1024
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $511
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6756
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6760
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6764
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6780
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6808
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6816
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6820
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6812
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6768
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6772
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6776
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6784
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6788
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6792
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6796
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6800
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6804
+ADDP4
+ARGP4
+ADDRGP4 sscanf
+CALLI4
+pop
+LABELV $513
+endproc BotReadSessionData 1036 76
+export BotAISetupClient
+proc BotAISetupClient 512 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $515
+CNSTI4 9088
+ARGI4
+ADDRLP4 440
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+ADDRLP4 440
+INDIRP4
+ASGNP4
+LABELV $515
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $517
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $517
+CNSTI4 4
+ARGI4
+ADDRGP4 $519
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $514
+JUMPV
+LABELV $517
+ADDRLP4 448
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 448
+INDIRI4
+CNSTI4 0
+NEI4 $520
+CNSTI4 4
+ARGI4
+ADDRGP4 $522
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $514
+JUMPV
+LABELV $520
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 456
+ADDRGP4 trap_BotLoadCharacter
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+ADDRLP4 456
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $523
+CNSTI4 4
+ARGI4
+ADDRGP4 $525
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BotAI_Print
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $514
+JUMPV
+LABELV $523
+ADDRLP4 0
+INDIRP4
+CNSTI4 4608
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 292
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 460
+ADDRGP4 trap_BotAllocGoalState
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+ADDRLP4 460
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 40
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 464
+ADDRGP4 trap_BotLoadItemWeights
+CALLI4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 464
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $526
+ADDRLP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeGoalState
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $514
+JUMPV
+LABELV $526
+ADDRLP4 468
+ADDRGP4 trap_BotAllocWeaponState
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+ADDRLP4 468
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 472
+ADDRGP4 trap_BotLoadWeaponWeights
+CALLI4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $528
+ADDRLP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeGoalState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeWeaponState
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $514
+JUMPV
+LABELV $528
+ADDRLP4 476
+ADDRGP4 trap_BotAllocChatState
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+ADDRLP4 476
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 21
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 22
+ARGI4
+ADDRLP4 296
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 296
+ARGP4
+ADDRLP4 480
+ADDRGP4 trap_BotLoadChatFile
+CALLI4
+ASGNI4
+ADDRLP4 148
+ADDRLP4 480
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $530
+ADDRLP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeChatState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeGoalState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeWeaponState
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $514
+JUMPV
+LABELV $530
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 152
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Characteristic_String
+CALLV
+pop
+ADDRLP4 484
+ADDRLP4 152
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 484
+INDIRI4
+CNSTI4 102
+EQI4 $534
+ADDRLP4 484
+INDIRI4
+CNSTI4 70
+NEI4 $532
+LABELV $534
+ADDRLP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $533
+JUMPV
+LABELV $532
+ADDRLP4 488
+ADDRLP4 152
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 488
+INDIRI4
+CNSTI4 109
+EQI4 $537
+ADDRLP4 488
+INDIRI4
+CNSTI4 77
+NEI4 $535
+LABELV $537
+ADDRLP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+ADDRGP4 $536
+JUMPV
+LABELV $535
+ADDRLP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotSetChatGender
+CALLV
+pop
+LABELV $536
+LABELV $533
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6016
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 492
+ADDRGP4 trap_BotAllocMoveState
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+ADDRLP4 492
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 48
+ARGI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 500
+ADDRGP4 trap_Characteristic_BFloat
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 6056
+ADDP4
+ADDRLP4 500
+INDIRF4
+ASGNF4
+ADDRLP4 504
+ADDRGP4 numbots
+ASGNP4
+ADDRLP4 504
+INDIRP4
+ADDRLP4 504
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $540
+ARGP4
+ADDRLP4 508
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 508
+INDIRI4
+CNSTI4 0
+EQI4 $538
+ADDRGP4 $540
+ARGP4
+ADDRGP4 $314
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotChatTest
+CALLV
+pop
+LABELV $538
+ADDRGP4 BotScheduleBotThink
+CALLV
+pop
+ADDRGP4 bot_interbreed
+INDIRI4
+CNSTI4 0
+EQI4 $541
+ADDRLP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_BotMutateGoalFuzzyLogic
+CALLV
+pop
+LABELV $541
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $543
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotReadSessionData
+CALLV
+pop
+LABELV $543
+CNSTI4 1
+RETI4
+LABELV $514
+endproc BotAISetupClient 512 16
+export BotAIShutdownClient
+proc BotAIShutdownClient 20 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $548
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $546
+LABELV $548
+CNSTI4 0
+RETI4
+ADDRGP4 $545
+JUMPV
+LABELV $546
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $549
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotWriteSessionData
+CALLV
+pop
+LABELV $549
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotChat_ExitGame
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $551
+ADDRLP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $551
+ADDRLP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeMoveState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeGoalState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeChatState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeWeaponState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotFreeCharacter
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 9076
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotClearActivateGoalStack
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 9088
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRGP4 numbots
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $545
+endproc BotAIShutdownClient 20 12
+export BotResetState
+proc BotResetState 800 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4608
+ADDP4
+ARGP4
+CNSTI4 292
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 324
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+CNSTI4 468
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 320
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 792
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 9072
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 9076
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotFreeWaypoints
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 9088
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 324
+ARGP4
+CNSTI4 468
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 4608
+ADDP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 292
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6520
+ADDP4
+ADDRLP4 320
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+ADDRLP4 792
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $554
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetMoveState
+CALLV
+pop
+LABELV $554
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $556
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetGoalState
+CALLV
+pop
+LABELV $556
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $558
+ADDRFP4 0
+INDIRP4
+CNSTI4 6536
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetWeaponState
+CALLV
+pop
+LABELV $558
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $560
+ADDRFP4 0
+INDIRP4
+CNSTI4 6528
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidGoals
+CALLV
+pop
+LABELV $560
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $562
+ADDRFP4 0
+INDIRP4
+CNSTI4 6524
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_BotResetAvoidReach
+CALLV
+pop
+LABELV $562
+LABELV $553
+endproc BotResetState 800 12
+export BotAILoadMap
+proc BotAILoadMap 280 16
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $565
+ADDRLP4 4
+ARGP4
+ADDRGP4 $567
+ARGP4
+ADDRGP4 $298
+ARGP4
+CNSTI4 68
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 4+16
+ARGP4
+ADDRGP4 trap_BotLibLoadMap
+CALLI4
+pop
+LABELV $565
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $569
+ADDRLP4 276
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $573
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $573
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 BotResetState
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 6016
+ADDP4
+CNSTI4 4
+ASGNI4
+LABELV $573
+LABELV $570
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $569
+ADDRGP4 BotSetupDeathmatchAI
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $564
+endproc BotAILoadMap 280 16
+bss
+align 4
+LABELV $576
+skip 4
+align 4
+LABELV $577
+skip 4
+align 4
+LABELV $578
+skip 4
+export BotAIStartFrame
+code
+proc BotAIStartFrame 164 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 G_CheckBotSpawn
+CALLV
+pop
+ADDRGP4 bot_rocketjump
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_grapple
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_fastchat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_nochat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_testrchat
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_thinktime
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_memorydump
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_saveroutingcache
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_pause
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_report
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRGP4 bot_report+12
+INDIRI4
+CNSTI4 0
+EQI4 $579
+ADDRGP4 BotUpdateInfoConfigStrings
+CALLV
+pop
+LABELV $579
+ADDRGP4 bot_pause+12
+INDIRI4
+CNSTI4 0
+EQI4 $582
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $585
+ADDRLP4 128
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $591
+ADDRLP4 128
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $589
+LABELV $591
+ADDRGP4 $586
+JUMPV
+LABELV $589
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $592
+ADDRGP4 $586
+JUMPV
+LABELV $592
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 509
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 510
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 511
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 132
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 132
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRGP4 trap_BotUserCommand
+CALLV
+pop
+LABELV $586
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $585
+CNSTI4 1
+RETI4
+ADDRGP4 $575
+JUMPV
+LABELV $582
+ADDRGP4 bot_memorydump+12
+INDIRI4
+CNSTI4 0
+EQI4 $595
+ADDRGP4 $598
+ARGP4
+ADDRGP4 $314
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $599
+ARGP4
+ADDRGP4 $600
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $595
+ADDRGP4 bot_saveroutingcache+12
+INDIRI4
+CNSTI4 0
+EQI4 $601
+ADDRGP4 $604
+ARGP4
+ADDRGP4 $314
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $605
+ARGP4
+ADDRGP4 $600
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $601
+ADDRGP4 BotInterbreeding
+CALLV
+pop
+ADDRGP4 bot_thinktime+12
+INDIRI4
+CNSTI4 200
+LEI4 $606
+ADDRGP4 $609
+ARGP4
+ADDRGP4 $610
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $606
+ADDRGP4 bot_thinktime+12
+INDIRI4
+ADDRGP4 $578
+INDIRI4
+EQI4 $611
+ADDRGP4 $578
+ADDRGP4 bot_thinktime+12
+INDIRI4
+ASGNI4
+ADDRGP4 BotScheduleBotThink
+CALLV
+pop
+LABELV $611
+ADDRLP4 132
+ADDRGP4 $576
+ASGNP4
+ADDRLP4 120
+ADDRFP4 0
+INDIRI4
+ADDRLP4 132
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 132
+INDIRP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 136
+ADDRGP4 $577
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 120
+INDIRI4
+ADDRGP4 bot_thinktime+12
+INDIRI4
+LEI4 $615
+ADDRLP4 124
+ADDRLP4 120
+INDIRI4
+ASGNI4
+ADDRGP4 $616
+JUMPV
+LABELV $615
+ADDRLP4 124
+ADDRGP4 bot_thinktime+12
+INDIRI4
+ASGNI4
+LABELV $616
+ADDRGP4 $577
+INDIRI4
+ADDRLP4 124
+INDIRI4
+LTI4 $619
+ADDRLP4 144
+ADDRGP4 $577
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 144
+INDIRP4
+INDIRI4
+ADDRLP4 124
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRGP4 trap_BotLibStartFrame
+CALLI4
+pop
+ADDRLP4 148
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+NEI4 $621
+CNSTI4 0
+RETI4
+ADDRGP4 $575
+JUMPV
+LABELV $621
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $623
+ADDRLP4 4
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $627
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $624
+JUMPV
+LABELV $627
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $629
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $624
+JUMPV
+LABELV $629
+ADDRLP4 4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $631
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $624
+JUMPV
+LABELV $631
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $633
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 10
+EQI4 $633
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $624
+JUMPV
+LABELV $633
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 13
+LEI4 $635
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+ADDRGP4 $624
+JUMPV
+LABELV $635
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 112
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 8+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GEI4 $638
+ADDRLP4 8+20
+ADDRLP4 4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $639
+JUMPV
+LABELV $638
+ADDRLP4 8+20
+ADDRLP4 4
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $639
+ADDRLP4 8+32
+ADDRLP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8+44
+ADDRLP4 4
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8+56
+ADDRLP4 4
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+4
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 432
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $646
+ADDRLP4 8+72
+CNSTI4 3
+ASGNI4
+ADDRGP4 $647
+JUMPV
+LABELV $646
+ADDRLP4 8+72
+CNSTI4 2
+ASGNI4
+LABELV $647
+ADDRLP4 8+68
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+76
+ADDRLP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+80
+ADDRLP4 4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+84
+ADDRLP4 4
+INDIRP4
+CNSTI4 172
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+88
+ADDRLP4 4
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+92
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+96
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+104
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+108
+ADDRLP4 4
+INDIRP4
+CNSTI4 200
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8+100
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_BotLibUpdateEntity
+CALLI4
+pop
+LABELV $624
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1024
+LTI4 $623
+ADDRGP4 BotAIRegularUpdate
+CALLV
+pop
+LABELV $619
+ADDRLP4 144
+ADDRGP4 trap_AAS_Time
+CALLF4
+ASGNF4
+ADDRGP4 floattime
+ADDRLP4 144
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $660
+ADDRLP4 148
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $666
+ADDRLP4 148
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $664
+LABELV $666
+ADDRGP4 $661
+JUMPV
+LABELV $664
+ADDRLP4 152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRI4
+ADDRLP4 120
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 124
+INDIRI4
+LTI4 $667
+ADDRLP4 156
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRI4
+ADDRLP4 124
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 160
+ADDRGP4 trap_AAS_Initialized
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $669
+CNSTI4 0
+RETI4
+ADDRGP4 $575
+JUMPV
+LABELV $669
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $671
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 124
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRGP4 BotAI
+CALLI4
+pop
+LABELV $671
+LABELV $667
+LABELV $661
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $660
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $674
+ADDRLP4 148
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $680
+ADDRLP4 148
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $678
+LABELV $680
+ADDRGP4 $675
+JUMPV
+LABELV $678
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $681
+ADDRGP4 $675
+JUMPV
+LABELV $681
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 120
+INDIRI4
+ARGI4
+ADDRGP4 BotUpdateInput
+CALLV
+pop
+ADDRLP4 152
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 152
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRGP4 trap_BotUserCommand
+CALLV
+pop
+LABELV $675
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $674
+CNSTI4 1
+RETI4
+LABELV $575
+endproc BotAIStartFrame 164 12
+export BotInitLibrary
+proc BotInitLibrary 212 16
+ADDRGP4 $685
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 144
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+NEI4 $686
+ADDRLP4 0
+ARGP4
+ADDRGP4 $688
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $686
+ADDRGP4 $689
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 $306
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $690
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $691
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 148
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 0
+EQI4 $692
+ADDRGP4 $691
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $692
+ADDRGP4 $694
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 152
+INDIRI4
+CNSTI4 0
+EQI4 $695
+ADDRGP4 $694
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $695
+ADDRGP4 $697
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 156
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 156
+INDIRI4
+CNSTI4 0
+EQI4 $698
+ADDRGP4 $697
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $698
+ADDRGP4 $305
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 160
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 160
+INDIRI4
+CNSTI4 0
+NEI4 $700
+ADDRLP4 0
+ARGP4
+ADDRGP4 $600
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $700
+ADDRGP4 $305
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $702
+ARGP4
+ADDRGP4 bot_developer+16
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $704
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $705
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $706
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 164
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 164
+INDIRI4
+CNSTI4 0
+EQI4 $707
+ADDRGP4 $709
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $707
+ADDRGP4 $710
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 168
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 168
+INDIRI4
+CNSTI4 0
+EQI4 $711
+ADDRGP4 $710
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $711
+ADDRGP4 $713
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 172
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+EQI4 $714
+ADDRGP4 $716
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $714
+ADDRGP4 $717
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 176
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 176
+INDIRI4
+CNSTI4 0
+EQI4 $718
+ADDRGP4 $720
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $718
+ADDRGP4 $721
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 180
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 180
+INDIRI4
+CNSTI4 0
+EQI4 $722
+ADDRGP4 $724
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $722
+ADDRGP4 $725
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 184
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $726
+ADDRGP4 $728
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $726
+ADDRGP4 $605
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 188
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 188
+INDIRI4
+CNSTI4 0
+EQI4 $729
+ADDRGP4 $604
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $729
+ADDRGP4 $313
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 192
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 192
+INDIRI4
+CNSTI4 0
+NEI4 $731
+ADDRLP4 0
+ARGP4
+ADDRGP4 $600
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $731
+ADDRGP4 $313
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+ADDRGP4 $733
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 196
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 196
+INDIRI4
+CNSTI4 0
+EQI4 $734
+ADDRGP4 $736
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $734
+ADDRGP4 $737
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 200
+INDIRI4
+CNSTI4 0
+EQI4 $738
+ADDRGP4 $740
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $738
+ADDRGP4 $741
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 204
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 204
+INDIRI4
+CNSTI4 0
+EQI4 $742
+ADDRGP4 $744
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotLibVarSet
+CALLI4
+pop
+LABELV $742
+ADDRLP4 208
+ADDRGP4 trap_BotLibSetup
+CALLI4
+ASGNI4
+ADDRLP4 208
+INDIRI4
+RETI4
+LABELV $684
+endproc BotInitLibrary 212 16
+export BotAISetup
+proc BotAISetup 8 16
+ADDRGP4 bot_thinktime
+ARGP4
+ADDRGP4 $609
+ARGP4
+ADDRGP4 $746
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_memorydump
+ARGP4
+ADDRGP4 $599
+ARGP4
+ADDRGP4 $600
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_saveroutingcache
+ARGP4
+ADDRGP4 $605
+ARGP4
+ADDRGP4 $600
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_pause
+ARGP4
+ADDRGP4 $747
+ARGP4
+ADDRGP4 $600
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_report
+ARGP4
+ADDRGP4 $748
+ARGP4
+ADDRGP4 $600
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testsolid
+ARGP4
+ADDRGP4 $749
+ARGP4
+ADDRGP4 $600
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_testclusters
+ARGP4
+ADDRGP4 $750
+ARGP4
+ADDRGP4 $600
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_developer
+ARGP4
+ADDRGP4 $702
+ARGP4
+ADDRGP4 $600
+ARGP4
+CNSTI4 512
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_interbreedchar
+ARGP4
+ADDRGP4 $323
+ARGP4
+ADDRGP4 $298
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_interbreedbots
+ARGP4
+ADDRGP4 $751
+ARGP4
+ADDRGP4 $752
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_interbreedcycle
+ARGP4
+ADDRGP4 $753
+ARGP4
+ADDRGP4 $754
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 bot_interbreedwrite
+ARGP4
+ADDRGP4 $297
+ARGP4
+ADDRGP4 $298
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $755
+CNSTI4 1
+RETI4
+ADDRGP4 $745
+JUMPV
+LABELV $755
+ADDRGP4 botstates
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 256
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+ADDRGP4 BotInitLibrary
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $757
+CNSTI4 0
+RETI4
+ADDRGP4 $745
+JUMPV
+LABELV $757
+CNSTI4 1
+RETI4
+LABELV $745
+endproc BotAISetup 8 16
+export BotAIShutdown
+proc BotAIShutdown 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $760
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $762
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $766
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 0
+EQI4 $766
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botstates
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAIShutdownClient
+CALLI4
+pop
+LABELV $766
+LABELV $763
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $762
+ADDRGP4 $761
+JUMPV
+LABELV $760
+ADDRGP4 trap_BotLibShutdown
+CALLI4
+pop
+LABELV $761
+CNSTI4 1
+RETI4
+LABELV $759
+endproc BotAIShutdown 8 8
+import ExitLevel
+bss
+export bot_interbreedwrite
+align 4
+LABELV bot_interbreedwrite
+skip 272
+export bot_interbreedcycle
+align 4
+LABELV bot_interbreedcycle
+skip 272
+export bot_interbreedbots
+align 4
+LABELV bot_interbreedbots
+skip 272
+export bot_interbreedchar
+align 4
+LABELV bot_interbreedchar
+skip 272
+export bot_developer
+align 4
+LABELV bot_developer
+skip 272
+export bot_testclusters
+align 4
+LABELV bot_testclusters
+skip 272
+export bot_testsolid
+align 4
+LABELV bot_testsolid
+skip 272
+export bot_report
+align 4
+LABELV bot_report
+skip 272
+export bot_pause
+align 4
+LABELV bot_pause
+skip 272
+export bot_saveroutingcache
+align 4
+LABELV bot_saveroutingcache
+skip 272
+export bot_memorydump
+align 4
+LABELV bot_memorydump
+skip 272
+export bot_thinktime
+align 4
+LABELV bot_thinktime
+skip 272
+export bot_interbreedmatchcount
+align 4
+LABELV bot_interbreedmatchcount
+skip 4
+export bot_interbreed
+align 4
+LABELV bot_interbreed
+skip 4
+export regularupdate_time
+align 4
+LABELV regularupdate_time
+skip 4
+export numbots
+align 4
+LABELV numbots
+skip 4
+export botstates
+align 4
+LABELV botstates
+skip 256
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+export floattime
+align 4
+LABELV floattime
+skip 4
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import DeathmatchScoreboardMessage
+import G_SetStats
+import MoveClientToIntermission
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import G_RunMissile
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $754
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $753
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 99
+byte 1 121
+byte 1 99
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $752
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $751
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $750
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $749
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 0
+align 1
+LABELV $748
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 0
+align 1
+LABELV $747
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $746
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $744
+byte 1 104
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $741
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $740
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $737
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $736
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $733
+byte 1 102
+byte 1 115
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $728
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $725
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 111
+byte 1 112
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 0
+align 1
+LABELV $724
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $721
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $720
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $717
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 98
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $716
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $713
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $710
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 106
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 112
+byte 1 97
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $709
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $706
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $705
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $704
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $702
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $697
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 95
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $694
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 95
+byte 1 97
+byte 1 97
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $691
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 67
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 115
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $690
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $689
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $688
+byte 1 56
+byte 1 0
+align 1
+LABELV $685
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $610
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $609
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $605
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $604
+byte 1 115
+byte 1 97
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $600
+byte 1 48
+byte 1 0
+align 1
+LABELV $599
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $598
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 100
+byte 1 117
+byte 1 109
+byte 1 112
+byte 1 0
+align 1
+LABELV $567
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $540
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $525
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $522
+byte 1 65
+byte 1 65
+byte 1 83
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $519
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 73
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $512
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $511
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 0
+align 1
+LABELV $492
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 76
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $489
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $486
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $483
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 0
+align 1
+LABELV $480
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $477
+byte 1 99
+byte 1 115
+byte 1 0
+align 1
+LABELV $474
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 0
+align 1
+LABELV $466
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 73
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $323
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $320
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 52
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $314
+byte 1 49
+byte 1 0
+align 1
+LABELV $313
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $306
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $305
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $298
+byte 1 0
+align 1
+LABELV $297
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 119
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $248
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 97
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $245
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $243
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $241
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $239
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $237
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $235
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $233
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $231
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $229
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $227
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $225
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $223
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $221
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $216
+byte 1 70
+byte 1 32
+byte 1 0
+align 1
+LABELV $195
+byte 1 94
+byte 1 52
+byte 1 66
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 10
+byte 1 0
+align 1
+LABELV $193
+byte 1 116
+byte 1 0
+align 1
+LABELV $189
+byte 1 110
+byte 1 0
+align 1
+LABELV $179
+byte 1 94
+byte 1 49
+byte 1 82
+byte 1 69
+byte 1 68
+byte 1 10
+byte 1 0
+align 1
+LABELV $175
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 111
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $174
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $172
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 116
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 101
+byte 1 109
+byte 1 121
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $170
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $168
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 114
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $166
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $164
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 114
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $162
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 109
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $160
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $158
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $156
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $154
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $152
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 108
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $147
+byte 1 94
+byte 1 52
+byte 1 70
+byte 1 32
+byte 1 0
+align 1
+LABELV $146
+byte 1 94
+byte 1 49
+byte 1 70
+byte 1 32
+byte 1 0
+align 1
+LABELV $139
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $138
+byte 1 32
+byte 1 0
+align 1
+LABELV $137
+byte 1 76
+byte 1 0
+align 1
+LABELV $132
+byte 1 13
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 44
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $131
+byte 1 13
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 33
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $123
+byte 1 13
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 79
+byte 1 76
+byte 1 73
+byte 1 68
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $122
+byte 1 13
+byte 1 101
+byte 1 109
+byte 1 116
+byte 1 112
+byte 1 121
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 0
+align 1
+LABELV $68
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $67
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $65
+byte 1 94
+byte 1 49
+byte 1 70
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $63
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $61
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $59
+byte 1 37
+byte 1 115
+byte 1 0
@@ -0,0 +1,6526 @@
+export BotValidTeamLeader
+code
+proc BotValidTeamLeader 8 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $55
+CNSTI4 0
+RETI4
+ADDRGP4 $54
+JUMPV
+LABELV $55
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 ClientFromName
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $57
+CNSTI4 0
+RETI4
+ADDRGP4 $54
+JUMPV
+LABELV $57
+CNSTI4 1
+RETI4
+LABELV $54
+endproc BotValidTeamLeader 8 4
+bss
+align 4
+LABELV $60
+skip 4
+export BotNumTeamMates
+code
+proc BotNumTeamMates 1064 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $60
+INDIRI4
+CNSTI4 0
+NEI4 $61
+ADDRGP4 $63
+ARGP4
+ADDRLP4 1032
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $60
+ADDRLP4 1032
+INDIRI4
+ASGNI4
+LABELV $61
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRI4
+ASGNI4
+ADDRGP4 $67
+JUMPV
+LABELV $64
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $71
+ADDRLP4 4
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $68
+LABELV $71
+ADDRGP4 $65
+JUMPV
+LABELV $68
+ADDRLP4 4
+ARGP4
+ADDRGP4 $74
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 3
+NEI4 $72
+ADDRGP4 $65
+JUMPV
+LABELV $72
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1060
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $75
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $75
+LABELV $65
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $67
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $60
+INDIRI4
+GEI4 $77
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $64
+LABELV $77
+ADDRLP4 1028
+INDIRI4
+RETI4
+LABELV $59
+endproc BotNumTeamMates 1064 12
+export BotClientTravelTimeToGoal
+proc BotClientTravelTimeToGoal 480 16
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 BotAI_GetClientState
+CALLI4
+pop
+ADDRLP4 0+20
+ARGP4
+ADDRLP4 472
+ADDRGP4 BotPointAreaNum
+CALLI4
+ASGNI4
+ADDRLP4 468
+ADDRLP4 472
+INDIRI4
+ASGNI4
+ADDRLP4 468
+INDIRI4
+CNSTI4 0
+NEI4 $80
+CNSTI4 1
+RETI4
+ADDRGP4 $78
+JUMPV
+LABELV $80
+ADDRLP4 468
+INDIRI4
+ARGI4
+ADDRLP4 0+20
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 18616254
+ARGI4
+ADDRLP4 476
+ADDRGP4 trap_AAS_AreaTravelTimeToGoalArea
+CALLI4
+ASGNI4
+ADDRLP4 476
+INDIRI4
+RETI4
+LABELV $78
+endproc BotClientTravelTimeToGoal 480 16
+bss
+align 4
+LABELV $84
+skip 4
+export BotSortTeamMatesByBaseTravelTime
+code
+proc BotSortTeamMatesByBaseTravelTime 1356 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 1300
+CNSTP4 0
+ASGNP4
+ADDRLP4 1304
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 1304
+INDIRI4
+CNSTI4 4
+EQI4 $87
+ADDRLP4 1304
+INDIRI4
+CNSTI4 5
+NEI4 $85
+LABELV $87
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1308
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 1308
+INDIRI4
+CNSTI4 1
+NEI4 $88
+ADDRLP4 1300
+ADDRGP4 ctf_redflag
+ASGNP4
+ADDRGP4 $89
+JUMPV
+LABELV $88
+ADDRLP4 1300
+ADDRGP4 ctf_blueflag
+ASGNP4
+LABELV $89
+LABELV $85
+ADDRGP4 $84
+INDIRI4
+CNSTI4 0
+NEI4 $90
+ADDRGP4 $63
+ARGP4
+ADDRLP4 1308
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $84
+ADDRLP4 1308
+INDIRI4
+ASGNI4
+LABELV $90
+ADDRLP4 1312
+CNSTI4 0
+ASGNI4
+ADDRLP4 264
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+ADDRGP4 $95
+JUMPV
+LABELV $92
+ADDRLP4 268
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 276
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 276
+ARGP4
+ADDRLP4 1316
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 0
+EQI4 $98
+ADDRLP4 276
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 1320
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1320
+INDIRP4
+ARGP4
+ADDRLP4 1324
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1324
+INDIRI4
+CNSTI4 0
+NEI4 $96
+LABELV $98
+ADDRGP4 $93
+JUMPV
+LABELV $96
+ADDRLP4 276
+ARGP4
+ADDRGP4 $74
+ARGP4
+ADDRLP4 1328
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1328
+INDIRP4
+ARGP4
+ADDRLP4 1332
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 3
+NEI4 $99
+ADDRGP4 $93
+JUMPV
+LABELV $99
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 268
+INDIRI4
+ARGI4
+ADDRLP4 1336
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1336
+INDIRI4
+CNSTI4 0
+EQI4 $101
+ADDRLP4 268
+INDIRI4
+ARGI4
+ADDRLP4 1300
+INDIRP4
+ARGP4
+ADDRLP4 1340
+ADDRGP4 BotClientTravelTimeToGoal
+CALLI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 1340
+INDIRI4
+ASGNI4
+ADDRLP4 260
+CNSTI4 0
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $103
+ADDRLP4 272
+INDIRI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+GEI4 $107
+ADDRLP4 0
+ADDRLP4 264
+INDIRI4
+ASGNI4
+ADDRGP4 $112
+JUMPV
+LABELV $109
+ADDRLP4 1344
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1344
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 1344
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1348
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1348
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 1348
+INDIRI4
+CNSTI4 4
+SUBI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $110
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $112
+ADDRLP4 0
+INDIRI4
+ADDRLP4 260
+INDIRI4
+GTI4 $109
+ADDRGP4 $105
+JUMPV
+LABELV $107
+LABELV $104
+ADDRLP4 260
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $106
+ADDRLP4 260
+INDIRI4
+ADDRLP4 264
+INDIRI4
+LTI4 $103
+LABELV $105
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 264
+ADDRLP4 264
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 264
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $114
+ADDRGP4 $94
+JUMPV
+LABELV $114
+LABELV $101
+LABELV $93
+ADDRLP4 268
+ADDRLP4 268
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $95
+ADDRLP4 268
+INDIRI4
+ADDRGP4 $84
+INDIRI4
+GEI4 $116
+ADDRLP4 268
+INDIRI4
+CNSTI4 64
+LTI4 $92
+LABELV $116
+LABELV $94
+ADDRLP4 264
+INDIRI4
+RETI4
+LABELV $83
+endproc BotSortTeamMatesByBaseTravelTime 1356 12
+export BotSetTeamMateTaskPreference
+proc BotSetTeamMateTaskPreference 36 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences+36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $117
+endproc BotSetTeamMateTaskPreference 36 12
+export BotGetTeamMateTaskPreference
+proc BotGetTeamMateTaskPreference 40 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences+36
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $120
+CNSTI4 0
+RETI4
+ADDRGP4 $119
+JUMPV
+LABELV $120
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+EQI4 $123
+CNSTI4 0
+RETI4
+ADDRGP4 $119
+JUMPV
+LABELV $123
+CNSTI4 40
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 ctftaskpreferences+36
+ADDP4
+INDIRI4
+RETI4
+LABELV $119
+endproc BotGetTeamMateTaskPreference 40 12
+export BotSortTeamMatesByTaskPreference
+proc BotSortTeamMatesByTaskPreference 804 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 788
+CNSTI4 0
+ASGNI4
+ADDRLP4 272
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 788
+INDIRI4
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $127
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 792
+ADDRGP4 BotGetTeamMateTaskPreference
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 792
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $131
+ADDRLP4 796
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 796
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRLP4 796
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $132
+JUMPV
+LABELV $131
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $133
+ADDRLP4 796
+ADDRLP4 268
+INDIRI4
+ASGNI4
+ADDRLP4 268
+ADDRLP4 796
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRLP4 796
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRLP4 276
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $134
+JUMPV
+LABELV $133
+ADDRLP4 796
+ADDRLP4 272
+INDIRI4
+ASGNI4
+ADDRLP4 272
+ADDRLP4 796
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRLP4 796
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRLP4 532
+ADDP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $134
+LABELV $132
+LABELV $128
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $130
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $127
+ADDRFP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 792
+CNSTI4 2
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 792
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRI4
+CVIU4 4
+ADDRLP4 792
+INDIRI4
+LSHU4
+CVUI4 4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 796
+CNSTI4 2
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 796
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 532
+ARGP4
+ADDRLP4 272
+INDIRI4
+CVIU4 4
+ADDRLP4 796
+INDIRI4
+LSHU4
+CVUI4 4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ADDRLP4 272
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 800
+CNSTI4 2
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 800
+INDIRI4
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ARGP4
+ADDRLP4 276
+ARGP4
+ADDRLP4 268
+INDIRI4
+CVIU4 4
+ADDRLP4 800
+INDIRI4
+LSHU4
+CVUI4 4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ADDRLP4 268
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+RETI4
+LABELV $126
+endproc BotSortTeamMatesByTaskPreference 804 12
+export BotSayTeamOrderAlways
+proc BotSayTeamOrderAlways 548 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $136
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 256
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 trap_BotGetChatMessage
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 512
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 $138
+ARGP4
+ADDRLP4 512
+ARGP4
+ADDRLP4 256
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_BotQueueConsoleMessage
+CALLV
+pop
+ADDRGP4 $137
+JUMPV
+LABELV $136
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+LABELV $137
+LABELV $135
+endproc BotSayTeamOrderAlways 548 20
+export BotSayTeamOrder
+proc BotSayTeamOrder 0 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrderAlways
+CALLV
+pop
+LABELV $139
+endproc BotSayTeamOrder 0 8
+export BotVoiceChat
+proc BotVoiceChat 0 0
+LABELV $140
+endproc BotVoiceChat 0 0
+export BotVoiceChatOnly
+proc BotVoiceChatOnly 0 0
+LABELV $141
+endproc BotVoiceChatOnly 0 0
+export BotSayVoiceTeamOrder
+proc BotSayVoiceTeamOrder 0 0
+LABELV $142
+endproc BotSayVoiceTeamOrder 0 0
+export BotCTFOrders_BothFlagsNotAtBase
+proc BotCTFOrders_BothFlagsNotAtBase 368 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRLP4 352
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 352
+INDIRI4
+CNSTI4 1
+EQI4 $145
+ADDRLP4 352
+INDIRI4
+CNSTI4 2
+EQI4 $148
+ADDRLP4 352
+INDIRI4
+CNSTI4 3
+EQI4 $154
+ADDRGP4 $144
+JUMPV
+LABELV $148
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $149
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $150
+JUMPV
+LABELV $149
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $150
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $145
+JUMPV
+LABELV $154
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $155
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $156
+JUMPV
+LABELV $155
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $156
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $158
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $160
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $162
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $163
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $159
+JUMPV
+LABELV $160
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $165
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $159
+JUMPV
+LABELV $158
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $159
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $166
+ADDRLP4 308
+ADDRLP4 4+8
+INDIRI4
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $166
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $167
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $171
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $145
+JUMPV
+LABELV $144
+ADDRLP4 300
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 4
+LEI4 $172
+ADDRLP4 300
+CNSTI4 4
+ASGNI4
+LABELV $172
+ADDRLP4 360
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 304
+ADDRLP4 360
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 360
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 5
+LEI4 $174
+ADDRLP4 304
+CNSTI4 5
+ASGNI4
+LABELV $174
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $176
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $181
+JUMPV
+LABELV $178
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $182
+ADDRGP4 $179
+JUMPV
+LABELV $182
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $184
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $162
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $163
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $185
+JUMPV
+LABELV $184
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 260
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $165
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $185
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $179
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $181
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $178
+ADDRGP4 $177
+JUMPV
+LABELV $176
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $189
+JUMPV
+LABELV $186
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $190
+ADDRGP4 $187
+JUMPV
+LABELV $190
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $187
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $189
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $186
+LABELV $177
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $195
+JUMPV
+LABELV $192
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $196
+ADDRGP4 $193
+JUMPV
+LABELV $196
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $171
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $193
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $195
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $192
+LABELV $145
+LABELV $143
+endproc BotCTFOrders_BothFlagsNotAtBase 368 20
+export BotCTFOrders_FlagNotAtBase
+proc BotCTFOrders_FlagNotAtBase 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $203
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 1
+EQI4 $204
+ADDRLP4 312
+INDIRI4
+CNSTI4 2
+EQI4 $209
+ADDRLP4 312
+INDIRI4
+CNSTI4 3
+EQI4 $214
+ADDRGP4 $205
+JUMPV
+LABELV $209
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $204
+JUMPV
+LABELV $214
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $204
+JUMPV
+LABELV $205
+ADDRLP4 300
+CNSTF4 1050253722
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 3
+LEI4 $222
+ADDRLP4 300
+CNSTI4 3
+ASGNI4
+LABELV $222
+ADDRLP4 304
+CNSTF4 1060320051
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 6
+LEI4 $224
+ADDRLP4 304
+CNSTI4 6
+ASGNI4
+LABELV $224
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $226
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $227
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $229
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $226
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $233
+JUMPV
+LABELV $230
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $231
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $233
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $230
+ADDRGP4 $204
+JUMPV
+LABELV $203
+ADDRLP4 312
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 312
+INDIRI4
+CNSTI4 1
+EQI4 $237
+ADDRLP4 312
+INDIRI4
+CNSTI4 2
+EQI4 $240
+ADDRLP4 312
+INDIRI4
+CNSTI4 3
+EQI4 $244
+ADDRGP4 $236
+JUMPV
+LABELV $240
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $237
+JUMPV
+LABELV $244
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $237
+JUMPV
+LABELV $236
+ADDRLP4 300
+CNSTF4 1045220557
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 2
+LEI4 $251
+ADDRLP4 300
+CNSTI4 2
+ASGNI4
+LABELV $251
+ADDRLP4 304
+CNSTF4 1060320051
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 7
+LEI4 $253
+ADDRLP4 304
+CNSTI4 7
+ASGNI4
+LABELV $253
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $258
+JUMPV
+LABELV $255
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $256
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $258
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $255
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $262
+JUMPV
+LABELV $259
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $260
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $262
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $259
+LABELV $237
+LABELV $204
+LABELV $202
+endproc BotCTFOrders_FlagNotAtBase 320 16
+export BotCTFOrders_EnemyFlagNotAtBase
+proc BotCTFOrders_EnemyFlagNotAtBase 360 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 348
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 260
+ADDRLP4 348
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRLP4 260
+INDIRI4
+CNSTI4 1
+EQI4 $268
+ADDRLP4 260
+INDIRI4
+CNSTI4 2
+EQI4 $270
+ADDRLP4 260
+INDIRI4
+CNSTI4 3
+EQI4 $274
+ADDRGP4 $267
+JUMPV
+LABELV $270
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $271
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $272
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $268
+JUMPV
+LABELV $274
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $275
+ADDRLP4 308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $276
+JUMPV
+LABELV $275
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $276
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 4+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+EQI4 $278
+ADDRLP4 308
+ADDRLP4 4+8
+INDIRI4
+ASGNI4
+ADDRGP4 $279
+JUMPV
+LABELV $278
+ADDRLP4 308
+ADDRLP4 4+4
+INDIRI4
+ASGNI4
+LABELV $279
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 308
+INDIRI4
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $268
+JUMPV
+LABELV $267
+ADDRLP4 300
+CNSTF4 1058642330
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 6
+LEI4 $283
+ADDRLP4 300
+CNSTI4 6
+ASGNI4
+LABELV $283
+ADDRLP4 304
+CNSTF4 1050253722
+ADDRLP4 260
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 3
+LEI4 $285
+ADDRLP4 304
+CNSTI4 3
+ASGNI4
+LABELV $285
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $290
+JUMPV
+LABELV $287
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $291
+ADDRGP4 $288
+JUMPV
+LABELV $291
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $288
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $290
+ADDRLP4 0
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $287
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $293
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 312
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $298
+JUMPV
+LABELV $295
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $299
+ADDRGP4 $296
+JUMPV
+LABELV $299
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $303
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $162
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $163
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $304
+JUMPV
+LABELV $303
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 264
+ARGP4
+ADDRLP4 312
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $165
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $304
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $296
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $298
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $295
+ADDRGP4 $268
+JUMPV
+LABELV $293
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $311
+JUMPV
+LABELV $308
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6972
+ADDP4
+INDIRI4
+NEI4 $312
+ADDRGP4 $309
+JUMPV
+LABELV $312
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 264
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 264
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 260
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+LABELV $309
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $311
+ADDRLP4 0
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $308
+LABELV $268
+LABELV $266
+endproc BotCTFOrders_EnemyFlagNotAtBase 360 20
+export BotCTFOrders_BothFlagsAtBase
+proc BotCTFOrders_BothFlagsAtBase 320 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 308
+ADDRGP4 BotSortTeamMatesByBaseTravelTime
+CALLI4
+ASGNI4
+ADDRLP4 296
+ADDRLP4 308
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 296
+INDIRI4
+ARGI4
+ADDRGP4 BotSortTeamMatesByTaskPreference
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $319
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $320
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $324
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $328
+ADDRGP4 $321
+JUMPV
+LABELV $324
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $320
+JUMPV
+LABELV $328
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $320
+JUMPV
+LABELV $321
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 300
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 5
+LEI4 $335
+ADDRLP4 300
+CNSTI4 5
+ASGNI4
+LABELV $335
+ADDRLP4 304
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 4
+LEI4 $337
+ADDRLP4 304
+CNSTI4 4
+ASGNI4
+LABELV $337
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $342
+JUMPV
+LABELV $339
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $340
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $342
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $339
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $346
+JUMPV
+LABELV $343
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $344
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $346
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $343
+ADDRGP4 $320
+JUMPV
+LABELV $319
+ADDRLP4 296
+INDIRI4
+CNSTI4 1
+EQI4 $351
+ADDRLP4 296
+INDIRI4
+CNSTI4 2
+EQI4 $353
+ADDRLP4 296
+INDIRI4
+CNSTI4 3
+EQI4 $357
+ADDRGP4 $350
+JUMPV
+LABELV $353
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $351
+JUMPV
+LABELV $357
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+4
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0+8
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRLP4 300
+CNSTF4 1053609165
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 300
+INDIRI4
+CNSTI4 4
+LEI4 $364
+ADDRLP4 300
+CNSTI4 4
+ASGNI4
+LABELV $364
+ADDRLP4 316
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 304
+ADDRLP4 316
+INDIRF4
+ADDRLP4 296
+INDIRI4
+CVIF4 4
+CVFI4 4
+CVIF4 4
+MULF4
+ADDRLP4 316
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRLP4 304
+INDIRI4
+CNSTI4 5
+LEI4 $366
+ADDRLP4 304
+CNSTI4 5
+ASGNI4
+LABELV $366
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $371
+JUMPV
+LABELV $368
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $210
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 256
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $215
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $369
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $371
+ADDRLP4 256
+INDIRI4
+ADDRLP4 300
+INDIRI4
+LTI4 $368
+ADDRLP4 256
+CNSTI4 0
+ASGNI4
+ADDRGP4 $375
+JUMPV
+LABELV $372
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 260
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $152
+ARGP4
+ADDRLP4 260
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 296
+INDIRI4
+ADDRLP4 256
+INDIRI4
+SUBI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $153
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+LABELV $373
+ADDRLP4 256
+ADDRLP4 256
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $375
+ADDRLP4 256
+INDIRI4
+ADDRLP4 304
+INDIRI4
+LTI4 $372
+LABELV $351
+LABELV $320
+LABELV $318
+endproc BotCTFOrders_BothFlagsAtBase 320 16
+export BotCTFOrders
+proc BotCTFOrders 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 BotTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $380
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $380
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 6956
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6952
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $381
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $382
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+GTI4 $382
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $388
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $388
+address $384
+address $385
+address $386
+address $387
+code
+LABELV $384
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_BothFlagsAtBase
+CALLV
+pop
+ADDRGP4 $383
+JUMPV
+LABELV $385
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_EnemyFlagNotAtBase
+CALLV
+pop
+ADDRGP4 $383
+JUMPV
+LABELV $386
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_FlagNotAtBase
+CALLV
+pop
+ADDRGP4 $383
+JUMPV
+LABELV $387
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders_BothFlagsNotAtBase
+CALLV
+pop
+LABELV $382
+LABELV $383
+LABELV $379
+endproc BotCTFOrders 20 4
+export BotCreateGroup
+proc BotCreateGroup 76 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $393
+JUMPV
+LABELV $390
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+NEI4 $394
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $162
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRGP4 $395
+JUMPV
+LABELV $394
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $164
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+LABELV $395
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 BotSayTeamOrderAlways
+CALLV
+pop
+LABELV $391
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $393
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+LTI4 $390
+LABELV $389
+endproc BotCreateGroup 76 20
+bss
+align 4
+LABELV $397
+skip 4
+export BotTeamOrders
+code
+proc BotTeamOrders 1320 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $397
+INDIRI4
+CNSTI4 0
+NEI4 $398
+ADDRGP4 $63
+ARGP4
+ADDRLP4 1288
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRGP4 $397
+ADDRLP4 1288
+INDIRI4
+ASGNI4
+LABELV $398
+ADDRLP4 1292
+CNSTI4 0
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1292
+INDIRI4
+ASGNI4
+ADDRGP4 $403
+JUMPV
+LABELV $400
+ADDRLP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetConfigstring
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1296
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1296
+INDIRI4
+CNSTI4 0
+EQI4 $406
+ADDRLP4 4
+ARGP4
+ADDRGP4 $70
+ARGP4
+ADDRLP4 1300
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1300
+INDIRP4
+ARGP4
+ADDRLP4 1304
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1304
+INDIRI4
+CNSTI4 0
+NEI4 $404
+LABELV $406
+ADDRGP4 $401
+JUMPV
+LABELV $404
+ADDRLP4 4
+ARGP4
+ADDRGP4 $74
+ARGP4
+ADDRLP4 1308
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1308
+INDIRP4
+ARGP4
+ADDRLP4 1312
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1312
+INDIRI4
+CNSTI4 3
+NEI4 $407
+ADDRGP4 $401
+JUMPV
+LABELV $407
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1316
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 1316
+INDIRI4
+CNSTI4 0
+EQI4 $409
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 1032
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1028
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $409
+LABELV $401
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $403
+ADDRLP4 0
+INDIRI4
+ADDRGP4 $397
+INDIRI4
+GEI4 $411
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $400
+LABELV $411
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1
+LTI4 $412
+ADDRLP4 1028
+INDIRI4
+CNSTI4 5
+GTI4 $412
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $427-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $427
+address $413
+address $413
+address $416
+address $417
+address $419
+code
+LABELV $416
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRGP4 $413
+JUMPV
+LABELV $417
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032+8
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRGP4 $413
+JUMPV
+LABELV $419
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1032+8
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRLP4 1028
+INDIRI4
+CNSTI4 10
+GTI4 $413
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $426
+JUMPV
+LABELV $423
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1304
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 1304
+INDIRI4
+LSHI4
+ADDRLP4 1032
+ADDP4
+ARGP4
+ADDRLP4 1304
+INDIRI4
+ARGI4
+ADDRGP4 BotCreateGroup
+CALLV
+pop
+LABELV $424
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $426
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $423
+LABELV $413
+LABELV $396
+endproc BotTeamOrders 1320 12
+export FindHumanTeamLeader
+proc FindHumanTeamLeader 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $430
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $434
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $437
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 notleader
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $441
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 BotSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $443
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 BotSetLastOrderedTask
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $445
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 BotVoiceChat_Defend
+CALLV
+pop
+LABELV $445
+CNSTI4 1
+RETI4
+ADDRGP4 $429
+JUMPV
+LABELV $443
+LABELV $441
+LABELV $437
+LABELV $434
+LABELV $431
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+LTI4 $430
+CNSTI4 0
+RETI4
+LABELV $429
+endproc FindHumanTeamLeader 12 12
+export BotTeamAI
+proc BotTeamAI 72 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 gametype
+INDIRI4
+CNSTI4 3
+GEI4 $448
+ADDRGP4 $447
+JUMPV
+LABELV $448
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 BotValidTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $450
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 FindHumanTeamLeader
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $452
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+NEF4 $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+NEF4 $454
+ADDRFP4 0
+INDIRP4
+CNSTI4 6064
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ADDRGP4 floattime
+INDIRF4
+LEF4 $456
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $457
+JUMPV
+LABELV $456
+ADDRLP4 56
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 56
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $457
+LABELV $454
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 0
+EQF4 $458
+ADDRLP4 56
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $458
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $460
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 60
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1090519040
+ADDF4
+CNSTF4 1092616192
+ADDRLP4 60
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $458
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+EQF4 $447
+ADDRLP4 60
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+GEF4 $447
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $463
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 BotAI_BotInitialChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6532
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_BotEnterChat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 $464
+ARGP4
+ADDRGP4 BotSayVoiceTeamOrder
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+CNSTU4 31
+ADDI4
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $447
+JUMPV
+LABELV $452
+LABELV $450
+ADDRFP4 0
+INDIRP4
+CNSTI4 6932
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6936
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientName
+CALLP4
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6900
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $465
+ADDRGP4 $447
+JUMPV
+LABELV $465
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 BotNumTeamMates
+CALLI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 gametype
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 3
+EQI4 $469
+ADDRLP4 52
+INDIRI4
+CNSTI4 4
+EQI4 $475
+ADDRGP4 $467
+JUMPV
+LABELV $469
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $472
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $470
+LABELV $472
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $470
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 60
+INDIRF4
+CNSTF4 0
+EQF4 $468
+ADDRLP4 60
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1084227584
+SUBF4
+GEF4 $468
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotTeamOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRGP4 $468
+JUMPV
+LABELV $475
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+NEI4 $479
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+NEI4 $479
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $476
+LABELV $479
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6948
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6964
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6968
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $476
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1131413504
+SUBF4
+GEF4 $480
+ADDRFP4 0
+INDIRP4
+CNSTI4 6944
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+ADDRLP4 64
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1053609165
+GEF4 $482
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 6976
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+ADDRGP4 floattime
+INDIRF4
+ASGNF4
+LABELV $482
+LABELV $480
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 64
+INDIRF4
+CNSTF4 0
+EQF4 $468
+ADDRLP4 64
+INDIRF4
+ADDRGP4 floattime
+INDIRF4
+CNSTF4 1077936128
+SUBF4
+GEF4 $468
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BotCTFOrders
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 6940
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $467
+LABELV $468
+LABELV $447
+endproc BotTeamAI 72 12
+bss
+export ctftaskpreferences
+align 4
+LABELV ctftaskpreferences
+skip 2560
+import BotVoiceChat_Defend
+import BotVoiceChatCommand
+import BotDumpNodeSwitches
+import BotResetNodeSwitches
+import AINode_Battle_NBG
+import AINode_Battle_Retreat
+import AINode_Battle_Chase
+import AINode_Battle_Fight
+import AINode_Seek_LTG
+import AINode_Seek_NBG
+import AINode_Seek_ActivateEntity
+import AINode_Stand
+import AINode_Respawn
+import AINode_Observer
+import AINode_Intermission
+import AIEnter_Battle_NBG
+import AIEnter_Battle_Retreat
+import AIEnter_Battle_Chase
+import AIEnter_Battle_Fight
+import AIEnter_Seek_Camp
+import AIEnter_Seek_LTG
+import AIEnter_Seek_NBG
+import AIEnter_Seek_ActivateEntity
+import AIEnter_Stand
+import AIEnter_Respawn
+import AIEnter_Observer
+import AIEnter_Intermission
+import BotPrintTeamGoal
+import BotMatchMessage
+import notleader
+import BotChatTest
+import BotValidChatPosition
+import BotChatTime
+import BotChat_Random
+import BotChat_EnemySuicide
+import BotChat_Kill
+import BotChat_Death
+import BotChat_HitNoKill
+import BotChat_HitNoDeath
+import BotChat_HitTalking
+import BotChat_EndLevel
+import BotChat_StartLevel
+import BotChat_ExitGame
+import BotChat_EnterGame
+import ctf_blueflag
+import ctf_redflag
+import bot_challenge
+import bot_testrchat
+import bot_nochat
+import bot_fastchat
+import bot_rocketjump
+import bot_grapple
+import maxclients
+import gametype
+import BotMapScripts
+import BotPointAreaNum
+import ClientOnSameTeamFromName
+import ClientFromName
+import stristr
+import BotFindWayPoint
+import BotCreateWayPoint
+import BotAlternateRoute
+import BotGetAlternateRouteGoal
+import BotCTFRetreatGoals
+import BotCTFSeekGoals
+import BotRememberLastOrderedTask
+import BotCTFCarryingFlag
+import BotOppositeTeam
+import BotTeam
+import BotClearActivateGoalStack
+import BotPopFromActivateGoalStack
+import BotEnableActivateGoalAreas
+import BotAIPredictObstacles
+import BotAIBlocked
+import BotCheckAttack
+import BotAimAtEnemy
+import BotEntityVisible
+import BotRoamGoal
+import BotFindEnemy
+import InFieldOfVision
+import BotVisibleTeamMatesAndEnemies
+import BotEnemyFlagCarrierVisible
+import BotTeamFlagCarrierVisible
+import BotTeamFlagCarrier
+import TeamPlayIsOn
+import BotSameTeam
+import BotAttackMove
+import BotWantsToCamp
+import BotHasPersistantPowerupAndWeapon
+import BotCanAndWantsToRocketJump
+import BotWantsToHelp
+import BotWantsToChase
+import BotWantsToRetreat
+import BotFeelingBad
+import BotAggression
+import BotTeamGoals
+import BotSetLastOrderedTask
+import BotSynonymContext
+import ClientSkin
+import EasyClientName
+import ClientName
+import BotSetTeamStatus
+import BotSetUserInfo
+import EntityIsShooting
+import EntityIsInvisible
+import EntityIsDead
+import BotInLavaOrSlime
+import BotIntermission
+import BotIsObserver
+import BotIsDead
+import BotBattleUseItems
+import BotUpdateBattleInventory
+import BotUpdateInventory
+import BotSetupForMovement
+import BotChooseWeapon
+import BotFreeWaypoints
+import BotDeathmatchAI
+import BotShutdownDeathmatchAI
+import BotSetupDeathmatchAI
+import BotTeamLeader
+import BotAI_GetSnapshotEntity
+import BotAI_GetEntityState
+import BotAI_GetClientState
+import BotAI_Trace
+import BotAI_BotInitialChat
+import BotAI_Print
+import floattime
+import BotEntityInfo
+import NumBots
+import BotResetState
+import BotResetWeaponState
+import BotFreeWeaponState
+import BotAllocWeaponState
+import BotLoadWeaponWeights
+import BotGetWeaponInfo
+import BotChooseBestFightWeapon
+import BotShutdownWeaponAI
+import BotSetupWeaponAI
+import BotShutdownMoveAI
+import BotSetupMoveAI
+import BotSetBrushModelTypes
+import BotAddAvoidSpot
+import BotInitMoveState
+import BotFreeMoveState
+import BotAllocMoveState
+import BotPredictVisiblePosition
+import BotMovementViewTarget
+import BotReachabilityArea
+import BotResetLastAvoidReach
+import BotResetAvoidReach
+import BotMoveInDirection
+import BotMoveToGoal
+import BotResetMoveState
+import BotShutdownGoalAI
+import BotSetupGoalAI
+import BotFreeGoalState
+import BotAllocGoalState
+import BotFreeItemWeights
+import BotLoadItemWeights
+import BotMutateGoalFuzzyLogic
+import BotSaveGoalFuzzyLogic
+import BotInterbreedGoalFuzzyLogic
+import BotUpdateEntityItems
+import BotInitLevelItems
+import BotSetAvoidGoalTime
+import BotAvoidGoalTime
+import BotGetMapLocationGoal
+import BotGetNextCampSpotGoal
+import BotGetLevelItemGoal
+import BotItemGoalInVisButNotVisible
+import BotTouchingGoal
+import BotChooseNBGItem
+import BotChooseLTGItem
+import BotGetSecondGoal
+import BotGetTopGoal
+import BotGoalName
+import BotDumpGoalStack
+import BotDumpAvoidGoals
+import BotEmptyGoalStack
+import BotPopGoal
+import BotPushGoal
+import BotRemoveFromAvoidGoals
+import BotResetAvoidGoals
+import BotResetGoalState
+import GeneticParentsAndChildSelection
+import BotSetChatName
+import BotSetChatGender
+import BotLoadChatFile
+import BotReplaceSynonyms
+import UnifyWhiteSpaces
+import BotMatchVariable
+import BotFindMatch
+import StringContains
+import BotGetChatMessage
+import BotEnterChat
+import BotChatLength
+import BotReplyChat
+import BotNumInitialChats
+import BotInitialChat
+import BotNumConsoleMessages
+import BotNextConsoleMessage
+import BotRemoveConsoleMessage
+import BotQueueConsoleMessage
+import BotFreeChatState
+import BotAllocChatState
+import BotShutdownChatAI
+import BotSetupChatAI
+import BotShutdownCharacters
+import Characteristic_String
+import Characteristic_BInteger
+import Characteristic_Integer
+import Characteristic_BFloat
+import Characteristic_Float
+import BotFreeCharacter
+import BotLoadCharacter
+import EA_Shutdown
+import EA_Setup
+import EA_ResetInput
+import EA_GetInput
+import EA_EndRegular
+import EA_View
+import EA_Move
+import EA_DelayedJump
+import EA_Jump
+import EA_SelectWeapon
+import EA_Use
+import EA_Gesture
+import EA_Talk
+import EA_Respawn
+import EA_Attack
+import EA_MoveRight
+import EA_MoveLeft
+import EA_MoveBack
+import EA_MoveForward
+import EA_MoveDown
+import EA_MoveUp
+import EA_Walk
+import EA_Crouch
+import EA_Action
+import EA_Command
+import EA_SayTeam
+import EA_Say
+import GetBotLibAPI
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import DeathmatchScoreboardMessage
+import G_SetStats
+import MoveClientToIntermission
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import G_RunMissile
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $464
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $463
+byte 1 105
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $460
+byte 1 119
+byte 1 104
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $215
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 0
+align 1
+LABELV $210
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $171
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $165
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $164
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 0
+align 1
+LABELV $163
+byte 1 102
+byte 1 111
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $162
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $153
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $152
+byte 1 99
+byte 1 109
+byte 1 100
+byte 1 95
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $138
+byte 1 25
+byte 1 40
+byte 1 37
+byte 1 115
+byte 1 25
+byte 1 41
+byte 1 25
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $74
+byte 1 116
+byte 1 0
+align 1
+LABELV $70
+byte 1 110
+byte 1 0
+align 1
+LABELV $63
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
@@ -0,0 +1,8118 @@
+data
+export pm_stopspeed
+align 4
+LABELV pm_stopspeed
+byte 4 1120403456
+export pm_duckScale
+align 4
+LABELV pm_duckScale
+byte 4 1048576000
+export pm_swimScale
+align 4
+LABELV pm_swimScale
+byte 4 1056964608
+export pm_wadeScale
+align 4
+LABELV pm_wadeScale
+byte 4 1060320051
+export pm_accelerate
+align 4
+LABELV pm_accelerate
+byte 4 1092616192
+export pm_airaccelerate
+align 4
+LABELV pm_airaccelerate
+byte 4 1065353216
+export pm_wateraccelerate
+align 4
+LABELV pm_wateraccelerate
+byte 4 1082130432
+export pm_flyaccelerate
+align 4
+LABELV pm_flyaccelerate
+byte 4 1090519040
+export pm_friction
+align 4
+LABELV pm_friction
+byte 4 1086324736
+export pm_waterfriction
+align 4
+LABELV pm_waterfriction
+byte 4 1065353216
+export pm_flightfriction
+align 4
+LABELV pm_flightfriction
+byte 4 1077936128
+export pm_spectatorfriction
+align 4
+LABELV pm_spectatorfriction
+byte 4 1084227584
+export c_pmove
+align 4
+LABELV c_pmove
+byte 4 0
+export PM_AddEvent
+code
+proc PM_AddEvent 0 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 BG_AddPredictableEventToPlayerstate
+CALLV
+pop
+LABELV $42
+endproc PM_AddEvent 0 12
+export PM_AddTouchEnt
+proc PM_AddTouchEnt 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1022
+NEI4 $44
+ADDRGP4 $43
+JUMPV
+LABELV $44
+ADDRGP4 pm
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 32
+NEI4 $46
+ADDRGP4 $43
+JUMPV
+LABELV $46
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $51
+JUMPV
+LABELV $48
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $52
+ADDRGP4 $43
+JUMPV
+LABELV $52
+LABELV $49
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $51
+ADDRLP4 0
+INDIRI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+LTI4 $48
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+CNSTI4 48
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $43
+endproc PM_AddTouchEnt 12 0
+proc PM_StartTorsoAnim 8 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $55
+ADDRGP4 $54
+JUMPV
+LABELV $55
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+BXORI4
+ADDRFP4 0
+INDIRI4
+BORI4
+ASGNI4
+LABELV $54
+endproc PM_StartTorsoAnim 8 0
+proc PM_StartLegsAnim 8 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $58
+ADDRGP4 $57
+JUMPV
+LABELV $58
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $60
+ADDRGP4 $57
+JUMPV
+LABELV $60
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+BXORI4
+ADDRFP4 0
+INDIRI4
+BORI4
+ASGNI4
+LABELV $57
+endproc PM_StartLegsAnim 8 0
+proc PM_ContinueLegsAnim 0 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ADDRFP4 0
+INDIRI4
+NEI4 $63
+ADDRGP4 $62
+JUMPV
+LABELV $63
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $65
+ADDRGP4 $62
+JUMPV
+LABELV $65
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 PM_StartLegsAnim
+CALLV
+pop
+LABELV $62
+endproc PM_ContinueLegsAnim 0 4
+proc PM_ContinueTorsoAnim 0 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ADDRFP4 0
+INDIRI4
+NEI4 $68
+ADDRGP4 $67
+JUMPV
+LABELV $68
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $70
+ADDRGP4 $67
+JUMPV
+LABELV $70
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+LABELV $67
+endproc PM_ContinueTorsoAnim 0 4
+proc PM_ForceLegsAnim 0 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 PM_StartLegsAnim
+CALLV
+pop
+LABELV $72
+endproc PM_ForceLegsAnim 0 4
+export PM_ClipVelocity
+proc PM_ClipVelocity 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $74
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $75
+JUMPV
+LABELV $74
+ADDRLP4 8
+ADDRLP4 8
+INDIRF4
+ADDRFP4 12
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $75
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $76
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $77
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $76
+LABELV $73
+endproc PM_ClipVelocity 32 0
+proc PM_Friction 48 4
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRGP4 pml+44
+INDIRI4
+CNSTI4 0
+EQI4 $81
+ADDRLP4 16+8
+CNSTF4 0
+ASGNF4
+LABELV $81
+ADDRLP4 16
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $85
+ADDRLP4 0
+INDIRP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $80
+JUMPV
+LABELV $85
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+GTI4 $87
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+INDIRI4
+ADDRLP4 36
+INDIRI4
+EQI4 $89
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 36
+INDIRI4
+NEI4 $89
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+CNSTI4 0
+NEI4 $94
+ADDRLP4 8
+INDIRF4
+ADDRGP4 pm_stopspeed
+INDIRF4
+GEF4 $97
+ADDRLP4 40
+ADDRGP4 pm_stopspeed
+INDIRF4
+ASGNF4
+ADDRGP4 $98
+JUMPV
+LABELV $97
+ADDRLP4 40
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $98
+ADDRLP4 28
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRGP4 pm_friction
+INDIRF4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $94
+LABELV $89
+LABELV $87
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $100
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRGP4 pm_waterfriction
+INDIRF4
+MULF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $100
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $103
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRGP4 pm_flightfriction
+INDIRF4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $103
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $106
+ADDRLP4 12
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRGP4 pm_spectatorfriction
+INDIRF4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $106
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $109
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+LABELV $109
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $80
+endproc PM_Friction 48 4
+proc PM_Accelerate 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GTF4 $112
+ADDRGP4 $111
+JUMPV
+LABELV $112
+ADDRLP4 4
+ADDRFP4 8
+INDIRF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $115
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $115
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $117
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 24
+INDIRI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $118
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $117
+LABELV $111
+endproc PM_Accelerate 32 0
+proc PM_CmdScale 44 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 21
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 22
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $122
+ADDRFP4 0
+INDIRP4
+CNSTI4 22
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $122
+ADDRFP4 0
+INDIRP4
+CNSTI4 23
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $124
+ADDRFP4 0
+INDIRP4
+CNSTI4 23
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+LABELV $124
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $126
+CNSTF4 0
+RETF4
+ADDRGP4 $121
+JUMPV
+LABELV $126
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 21
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 22
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 23
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 28
+INDIRI4
+MULI4
+ADDRLP4 32
+INDIRI4
+ADDRLP4 32
+INDIRI4
+MULI4
+ADDI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 36
+INDIRI4
+MULI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+MULF4
+CNSTF4 1123942400
+ADDRLP4 4
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+RETF4
+LABELV $121
+endproc PM_CmdScale 44 4
+proc PM_SetMovementDir 72 0
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $131
+ADDRLP4 0
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+EQI4 $129
+LABELV $131
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+NEI4 $132
+ADDRLP4 8
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 12
+INDIRI4
+LEI4 $132
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $132
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+GEI4 $134
+ADDRLP4 16
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 20
+INDIRI4
+LEI4 $134
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $134
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+GEI4 $136
+ADDRLP4 24
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 28
+INDIRI4
+NEI4 $136
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $136
+ADDRLP4 32
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+GEI4 $138
+ADDRLP4 32
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+GEI4 $138
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $138
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 44
+CNSTI4 0
+ASGNI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+NEI4 $140
+ADDRLP4 40
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 44
+INDIRI4
+GEI4 $140
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $140
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 52
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 52
+INDIRI4
+LEI4 $142
+ADDRLP4 48
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 52
+INDIRI4
+GEI4 $142
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $142
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 60
+INDIRI4
+LEI4 $144
+ADDRLP4 56
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 60
+INDIRI4
+NEI4 $144
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 6
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $144
+ADDRLP4 64
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRLP4 64
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 68
+INDIRI4
+LEI4 $130
+ADDRLP4 64
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 68
+INDIRI4
+LEI4 $130
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 7
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $129
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $148
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $149
+JUMPV
+LABELV $148
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 6
+NEI4 $150
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $150
+LABELV $149
+LABELV $130
+LABELV $128
+endproc PM_SetMovementDir 72 0
+proc PM_CheckJump 8 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $153
+CNSTI4 0
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $153
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+GEI4 $155
+CNSTI4 0
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $155
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $157
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 0
+ASGNI1
+CNSTI4 0
+RETI4
+ADDRGP4 $152
+JUMPV
+LABELV $157
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1132920832
+ASGNF4
+CNSTI4 14
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+LTI4 $161
+CNSTI4 18
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+ADDRGP4 $162
+JUMPV
+LABELV $161
+CNSTI4 20
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $162
+CNSTI4 1
+RETI4
+LABELV $152
+endproc PM_CheckJump 8 4
+proc PM_CheckWaterJump 56 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $164
+CNSTI4 0
+RETI4
+ADDRGP4 $163
+JUMPV
+LABELV $164
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $166
+CNSTI4 0
+RETI4
+ADDRGP4 $163
+JUMPV
+LABELV $166
+ADDRLP4 12
+ADDRGP4 pml
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRGP4 pml+4
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTF4 1106247680
+ASGNF4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 1106247680
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1082130432
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 40
+ADDRLP4 36
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $176
+CNSTI4 0
+RETI4
+ADDRGP4 $163
+JUMPV
+LABELV $176
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1098907648
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRLP4 44
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $179
+CNSTI4 0
+RETI4
+ADDRGP4 $163
+JUMPV
+LABELV $179
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1128792064
+ADDRGP4 pml
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+CNSTF4 1128792064
+ADDRGP4 pml+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1128792064
+ADDRGP4 pml+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+CNSTF4 1135542272
+ASGNF4
+ADDRLP4 52
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 2000
+ASGNI4
+CNSTI4 1
+RETI4
+LABELV $163
+endproc PM_CheckWaterJump 56 8
+proc PM_WaterJumpMove 12 4
+CNSTI4 1
+ARGI4
+ADDRGP4 PM_StepSlideMove
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $185
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -353
+BANDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $185
+LABELV $183
+endproc PM_WaterJumpMove 12 4
+proc PM_WaterMove 76 16
+ADDRLP4 40
+ADDRGP4 PM_CheckWaterJump
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $188
+ADDRGP4 PM_WaterJumpMove
+CALLV
+pop
+ADDRGP4 $187
+JUMPV
+LABELV $188
+ADDRGP4 PM_Friction
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $190
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 3262119936
+ASGNF4
+ADDRGP4 $191
+JUMPV
+LABELV $190
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $194
+ADDRLP4 48
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $195
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $194
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $191
+ADDRLP4 24
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ARGP4
+ADDRLP4 48
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pm_swimScale
+INDIRF4
+MULF4
+LEF4 $200
+ADDRLP4 20
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pm_swimScale
+INDIRF4
+MULF4
+ASGNF4
+LABELV $200
+ADDRLP4 24
+ARGP4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRGP4 pm_wateraccelerate
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+ADDRGP4 pml+48
+INDIRI4
+CNSTI4 0
+EQI4 $202
+ADDRLP4 52
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRGP4 pml+52+24
+INDIRF4
+MULF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRGP4 pml+52+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 52
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRGP4 pml+52+24+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+GEF4 $202
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRLP4 60
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 64
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ASGNF4
+LABELV $202
+CNSTI4 0
+ARGI4
+ADDRGP4 PM_SlideMove
+CALLI4
+pop
+LABELV $187
+endproc PM_WaterMove 76 16
+proc PM_FlyMove 52 12
+ADDRGP4 PM_Friction
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $216
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 8+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 $217
+JUMPV
+LABELV $216
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $220
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+MULF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $221
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $220
+ADDRLP4 8+8
+ADDRLP4 8+8
+INDIRF4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+LABELV $217
+ADDRLP4 20
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRGP4 pm_flyaccelerate
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+CNSTI4 0
+ARGI4
+ADDRGP4 PM_StepSlideMove
+CALLV
+pop
+LABELV $215
+endproc PM_FlyMove 52 12
+proc PM_AirMove 84 16
+ADDRGP4 PM_Friction
+CALLV
+pop
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 68
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 68
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 68
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 24
+ADDRLP4 44
+ARGP4
+ADDRLP4 72
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRGP4 PM_SetMovementDir
+CALLV
+pop
+ADDRGP4 pml+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 pml+12+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 pml
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 pml+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $231
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $232
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LTI4 $231
+ADDRLP4 4+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 24
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ARGP4
+ADDRLP4 76
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 36
+INDIRF4
+ADDRLP4 40
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRGP4 pm_airaccelerate
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+ADDRGP4 pml+48
+INDIRI4
+CNSTI4 0
+EQI4 $237
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+LABELV $237
+CNSTI4 1
+ARGI4
+ADDRGP4 PM_StepSlideMove
+CALLV
+pop
+LABELV $226
+endproc PM_AirMove 84 16
+proc PM_GrappleMove 52 4
+ADDRLP4 28
+CNSTF4 3246391296
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+ADDRGP4 pml
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 28
+INDIRF4
+ADDRGP4 pml+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 3246391296
+ADDRGP4 pml+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 32
+INDIRP4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 12+8
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 24
+INDIRF4
+CNSTF4 1120403456
+GTF4 $255
+ADDRLP4 44
+CNSTF4 1092616192
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1092616192
+ADDRLP4 24
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRGP4 $256
+JUMPV
+LABELV $255
+ADDRLP4 48
+CNSTF4 1145569280
+ASGNF4
+ADDRLP4 0
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0+8
+CNSTF4 1145569280
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ASGNF4
+LABELV $256
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 0
+INDIRB
+ASGNB 12
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+LABELV $242
+endproc PM_GrappleMove 52 4
+proc PM_WalkMove 132 16
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 2
+LEI4 $267
+ADDRGP4 pml
+INDIRF4
+ADDRGP4 pml+52+24
+INDIRF4
+MULF4
+ADDRGP4 pml+4
+INDIRF4
+ADDRGP4 pml+52+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRGP4 pml+8
+INDIRF4
+ADDRGP4 pml+52+24+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 0
+LEF4 $267
+ADDRGP4 PM_WaterMove
+CALLV
+pop
+ADDRGP4 $266
+JUMPV
+LABELV $267
+ADDRLP4 76
+ADDRGP4 PM_CheckJump
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $279
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $281
+ADDRGP4 PM_WaterMove
+CALLV
+pop
+ADDRGP4 $266
+JUMPV
+LABELV $281
+ADDRGP4 PM_AirMove
+CALLV
+pop
+ADDRGP4 $266
+JUMPV
+LABELV $279
+ADDRGP4 PM_Friction
+CALLV
+pop
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 80
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 80
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 80
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 24
+ADDRLP4 48
+ARGP4
+ADDRLP4 84
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 84
+INDIRF4
+ASGNF4
+ADDRGP4 PM_SetMovementDir
+CALLV
+pop
+ADDRGP4 pml+8
+CNSTF4 0
+ASGNF4
+ADDRGP4 pml+12+8
+CNSTF4 0
+ASGNF4
+ADDRLP4 88
+ADDRGP4 pml
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRGP4 pml+12
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRGP4 pml+12
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRGP4 pml
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRGP4 pml+12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $293
+ADDRLP4 92
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 92
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 92
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $294
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $293
+ADDRLP4 32
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+ARGP4
+ADDRLP4 92
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 92
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 24
+INDIRF4
+ADDRLP4 44
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $298
+ADDRLP4 24
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pm_duckScale
+INDIRF4
+MULF4
+LEF4 $300
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pm_duckScale
+INDIRF4
+MULF4
+ASGNF4
+LABELV $300
+LABELV $298
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $302
+ADDRLP4 100
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 100
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1077936128
+DIVF4
+ASGNF4
+ADDRLP4 104
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 96
+ADDRLP4 104
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDRGP4 pm_swimScale
+INDIRF4
+SUBF4
+ADDRLP4 96
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 100
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 96
+INDIRF4
+MULF4
+LEF4 $304
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 96
+INDIRF4
+MULF4
+ASGNF4
+LABELV $304
+LABELV $302
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 96
+INDIRI4
+NEI4 $310
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 96
+INDIRI4
+EQI4 $306
+LABELV $310
+ADDRLP4 72
+ADDRGP4 pm_airaccelerate
+INDIRF4
+ASGNF4
+ADDRGP4 $307
+JUMPV
+LABELV $306
+ADDRLP4 72
+ADDRGP4 pm_accelerate
+INDIRF4
+ASGNF4
+LABELV $307
+ADDRLP4 32
+ARGP4
+ADDRLP4 24
+INDIRF4
+ARGF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+ADDRLP4 100
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 100
+INDIRI4
+NEI4 $315
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 64
+BANDI4
+ADDRLP4 100
+INDIRI4
+EQI4 $311
+LABELV $315
+ADDRLP4 104
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 108
+ADDRLP4 104
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+ADDRLP4 104
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $311
+LABELV $312
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 104
+INDIRF4
+ASGNF4
+ADDRLP4 108
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRGP4 pml+52+24
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+CNSTF4 1065361605
+ARGF4
+ADDRGP4 PM_ClipVelocity
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 112
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 116
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 120
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 124
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 128
+CNSTF4 0
+ASGNF4
+ADDRLP4 124
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+NEF4 $319
+ADDRLP4 124
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 128
+INDIRF4
+NEF4 $319
+ADDRGP4 $266
+JUMPV
+LABELV $319
+CNSTI4 0
+ARGI4
+ADDRGP4 PM_StepSlideMove
+CALLV
+pop
+LABELV $266
+endproc PM_WalkMove 132 16
+proc PM_DeadMove 20 4
+ADDRGP4 pml+44
+INDIRI4
+CNSTI4 0
+NEI4 $322
+ADDRGP4 $321
+JUMPV
+LABELV $322
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1101004800
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GTF4 $325
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 $326
+JUMPV
+LABELV $325
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $326
+LABELV $321
+endproc PM_DeadMove 20 4
+proc PM_NoclipMove 108 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 26
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 1065353216
+GEF4 $328
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRGP4 vec3_origin
+INDIRB
+ASGNB 12
+ADDRGP4 $329
+JUMPV
+LABELV $328
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 56
+CNSTF4 1069547520
+ADDRGP4 pm_friction
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRGP4 pm_stopspeed
+INDIRF4
+GEF4 $331
+ADDRLP4 68
+ADDRGP4 pm_stopspeed
+INDIRF4
+ASGNF4
+ADDRGP4 $332
+JUMPV
+LABELV $331
+ADDRLP4 68
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $332
+ADDRLP4 60
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRLP4 52
+INDIRF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 24
+INDIRF4
+ADDRLP4 52
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+CNSTF4 0
+GEF4 $334
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+LABELV $334
+ADDRLP4 28
+ADDRLP4 28
+INDIRF4
+ADDRLP4 24
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 76
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ASGNF4
+LABELV $329
+ADDRGP4 pm
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 PM_CmdScale
+CALLF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 72
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 72
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $336
+ADDRLP4 76
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 pml
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 76
+INDIRI4
+ADDRGP4 pml+12
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $337
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $336
+ADDRLP4 4+8
+ADDRLP4 4+8
+INDIRF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+ARGP4
+ADDRLP4 80
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRGP4 pm_accelerate
+INDIRF4
+ARGF4
+ADDRGP4 PM_Accelerate
+CALLV
+pop
+ADDRLP4 84
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 88
+ADDRLP4 84
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRF4
+ADDRLP4 84
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 92
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 92
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+ADDRLP4 92
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 100
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 104
+ADDRLP4 100
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+ADDRLP4 100
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ADDRGP4 pml+36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $327
+endproc PM_NoclipMove 108 12
+proc PM_FootstepForSurface 0 0
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 8192
+BANDI4
+CNSTI4 0
+EQI4 $346
+CNSTI4 0
+RETI4
+ADDRGP4 $345
+JUMPV
+LABELV $346
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $350
+CNSTI4 2
+RETI4
+ADDRGP4 $345
+JUMPV
+LABELV $350
+CNSTI4 1
+RETI4
+LABELV $345
+endproc PM_FootstepForSurface 0 0
+proc PM_CrashLand 56 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $355
+CNSTI4 21
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRGP4 $356
+JUMPV
+LABELV $355
+CNSTI4 19
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+LABELV $356
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 130
+ASGNI4
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 pml+112+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 pml+124+8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+NEGI4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 12
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRLP4 24
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1082130432
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+CNSTF4 0
+GEF4 $361
+ADDRGP4 $354
+JUMPV
+LABELV $361
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 4
+INDIRF4
+NEGF4
+ADDRLP4 44
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+ADDRLP4 16
+INDIRF4
+MULF4
+DIVF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 8
+INDIRF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 953267991
+ADDRLP4 0
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $363
+ADDRLP4 0
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $363
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $365
+ADDRGP4 $354
+JUMPV
+LABELV $365
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $367
+ADDRLP4 0
+CNSTF4 1048576000
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $367
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $369
+ADDRLP4 0
+CNSTF4 1056964608
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $369
+ADDRLP4 0
+INDIRF4
+CNSTF4 1065353216
+GEF4 $371
+ADDRGP4 $354
+JUMPV
+LABELV $371
+ADDRGP4 pml+52+44
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $373
+ADDRLP4 0
+INDIRF4
+CNSTF4 1114636288
+LEF4 $377
+CNSTI4 12
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $378
+JUMPV
+LABELV $377
+ADDRLP4 0
+INDIRF4
+CNSTF4 1109393408
+LEF4 $379
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $380
+CNSTI4 11
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $380
+JUMPV
+LABELV $379
+ADDRLP4 0
+INDIRF4
+CNSTF4 1088421888
+LEF4 $383
+CNSTI4 10
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $384
+JUMPV
+LABELV $383
+ADDRLP4 52
+ADDRGP4 PM_FootstepForSurface
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $384
+LABELV $380
+LABELV $378
+LABELV $373
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $354
+endproc PM_CrashLand 56 4
+proc PM_CorrectAllSolid 40 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $386
+ADDRGP4 $388
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $386
+ADDRLP4 20
+CNSTI4 -1
+ASGNI4
+LABELV $389
+ADDRLP4 16
+CNSTI4 -1
+ASGNI4
+LABELV $393
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+LABELV $397
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $403
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 1048576000
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 32
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 pml+52
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 56
+CNSTI4 1
+RETI4
+ADDRGP4 $385
+JUMPV
+LABELV $403
+LABELV $398
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+LEI4 $397
+LABELV $394
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LEI4 $393
+LABELV $390
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+LEI4 $389
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+CNSTI4 0
+RETI4
+LABELV $385
+endproc PM_CorrectAllSolid 40 28
+proc PM_GroundTraceMissed 80 28
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1023
+EQI4 $411
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $413
+ADDRGP4 $415
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $413
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1115684864
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 68
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 68
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 12+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $417
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+LTI4 $420
+CNSTI4 18
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 76
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+ADDRGP4 $421
+JUMPV
+LABELV $420
+CNSTI4 20
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 76
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $421
+LABELV $417
+LABELV $411
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+LABELV $410
+endproc PM_GroundTraceMissed 80 28
+proc PM_GroundTrace 92 28
+ADDRLP4 68
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 56
+ADDRLP4 68
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56+4
+ADDRLP4 68
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 56+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 1048576000
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 72
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 56
+ARGP4
+ADDRLP4 76
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 pml+52
+ADDRLP4 0
+INDIRB
+ASGNB 56
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $428
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+ADDRGP4 PM_CorrectAllSolid
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $430
+ADDRGP4 $424
+JUMPV
+LABELV $430
+LABELV $428
+ADDRLP4 0+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $432
+ADDRGP4 PM_GroundTraceMissed
+CALLV
+pop
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $424
+JUMPV
+LABELV $432
+ADDRLP4 80
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 80
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+CNSTF4 0
+LEF4 $437
+ADDRLP4 80
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+24
+INDIRF4
+MULF4
+ADDRLP4 80
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ADDRLP4 0+24+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 84
+INDIRF4
+ADDRLP4 0+24+8
+INDIRF4
+MULF4
+ADDF4
+CNSTF4 1092616192
+LEF4 $437
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $444
+ADDRGP4 $446
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $444
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+LTI4 $447
+CNSTI4 18
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 -9
+BANDI4
+ASGNI4
+ADDRGP4 $448
+JUMPV
+LABELV $447
+CNSTI4 20
+ARGI4
+ADDRGP4 PM_ForceLegsAnim
+CALLV
+pop
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $448
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pml+48
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $424
+JUMPV
+LABELV $437
+ADDRLP4 0+24+8
+INDIRF4
+CNSTF4 1060320051
+GEF4 $451
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $455
+ADDRGP4 $457
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $455
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRGP4 pml+48
+CNSTI4 1
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 0
+ASGNI4
+ADDRGP4 $424
+JUMPV
+LABELV $451
+ADDRGP4 pml+48
+CNSTI4 1
+ASGNI4
+ADDRGP4 pml+44
+CNSTI4 1
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $462
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 -289
+BANDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $462
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1023
+NEI4 $464
+ADDRGP4 pm
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $466
+ADDRGP4 $468
+ARGP4
+ADDRGP4 c_pmove
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $466
+ADDRGP4 PM_CrashLand
+CALLV
+pop
+ADDRGP4 pml+124+8
+INDIRF4
+CNSTF4 3276275712
+GEF4 $469
+ADDRLP4 88
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 250
+ASGNI4
+LABELV $469
+LABELV $464
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 0+52
+INDIRI4
+ASGNI4
+ADDRLP4 0+52
+INDIRI4
+ARGI4
+ADDRGP4 PM_AddTouchEnt
+CALLV
+pop
+LABELV $424
+endproc PM_GroundTrace 92 28
+proc PM_SetWaterLevel 56 8
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRLP4 28
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $478
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CNSTI4 -24
+SUBI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRLP4 40
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $481
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CNSTF4 3250585600
+ADDF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 48
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRLP4 48
+INDIRP4
+CNSTI4 228
+ADDP4
+INDIRP4
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 56
+BANDI4
+CNSTI4 0
+EQI4 $484
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $484
+LABELV $481
+LABELV $478
+LABELV $475
+endproc PM_SetWaterLevel 56 8
+proc PM_CheckDuck 76 28
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 368
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $487
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $489
+ADDRGP4 pm
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTF4 3257401344
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTF4 3257401344
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTF4 3257401344
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTF4 1109917696
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 1109917696
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 1109917696
+ASGNF4
+ADDRGP4 $490
+JUMPV
+LABELV $489
+ADDRGP4 pm
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTF4 3250585600
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+LABELV $490
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 $486
+JUMPV
+LABELV $487
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 -16385
+BANDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTF4 3245342720
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 196
+ADDP4
+CNSTF4 1097859072
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTF4 3250585600
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $491
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 -16
+ASGNI4
+ADDRGP4 $486
+JUMPV
+LABELV $491
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+GEI4 $493
+ADDRLP4 60
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $494
+JUMPV
+LABELV $493
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $495
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 60
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 60
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+ADDRLP4 64
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 180
+ADDP4
+ARGP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 192
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 60
+INDIRP4
+CNSTI4 224
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $497
+ADDRLP4 72
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 -2
+BANDI4
+ASGNI4
+LABELV $497
+LABELV $495
+LABELV $494
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $499
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 1098907648
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 $500
+JUMPV
+LABELV $499
+ADDRGP4 pm
+INDIRP4
+CNSTI4 200
+ADDP4
+CNSTF4 1107296256
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 164
+ADDP4
+CNSTI4 26
+ASGNI4
+LABELV $500
+LABELV $486
+endproc PM_CheckDuck 76 28
+proc PM_Footsteps 64 4
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 16
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 12
+INDIRP4
+CNSTI4 212
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1023
+NEI4 $502
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 368
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $504
+CNSTI4 23
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+LABELV $504
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $501
+CNSTI4 17
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $501
+JUMPV
+LABELV $502
+ADDRLP4 32
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+NEI4 $508
+ADDRLP4 32
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 36
+INDIRI4
+NEI4 $508
+ADDRGP4 pm
+INDIRP4
+CNSTI4 212
+ADDP4
+INDIRF4
+CNSTF4 1084227584
+GEF4 $501
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $512
+CNSTI4 23
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $501
+JUMPV
+LABELV $512
+CNSTI4 22
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $501
+JUMPV
+LABELV $508
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 40
+INDIRI4
+EQI4 $514
+ADDRLP4 4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $516
+CNSTI4 32
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $515
+JUMPV
+LABELV $516
+CNSTI4 13
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $515
+JUMPV
+LABELV $514
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $518
+ADDRLP4 4
+CNSTF4 1053609165
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $520
+CNSTI4 16
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $521
+JUMPV
+LABELV $520
+CNSTI4 15
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+LABELV $521
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $519
+JUMPV
+LABELV $518
+ADDRLP4 4
+CNSTF4 1050253722
+ASGNF4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $522
+CNSTI4 33
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+ADDRGP4 $523
+JUMPV
+LABELV $522
+CNSTI4 14
+ARGI4
+ADDRGP4 PM_ContinueLegsAnim
+CALLV
+pop
+LABELV $523
+LABELV $519
+LABELV $515
+ADDRLP4 44
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 48
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+ADDRLP4 44
+INDIRP4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRP4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+ADDRGP4 pml+40
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+CVFI4 4
+CNSTI4 255
+BANDI4
+ASGNI4
+ADDRLP4 52
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDI4
+BXORI4
+CNSTI4 128
+BANDI4
+CNSTI4 0
+EQI4 $525
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $527
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $528
+ADDRGP4 pm
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $528
+ADDRLP4 60
+ADDRGP4 PM_FootstepForSurface
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $528
+JUMPV
+LABELV $527
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $531
+CNSTI4 3
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $532
+JUMPV
+LABELV $531
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $533
+CNSTI4 5
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 $534
+JUMPV
+LABELV $533
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $535
+LABELV $535
+LABELV $534
+LABELV $532
+LABELV $528
+LABELV $525
+LABELV $501
+endproc PM_Footsteps 64 4
+proc PM_WaterEvents 16 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+136
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $538
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $538
+CNSTI4 15
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $538
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pml+136
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $541
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $541
+CNSTI4 16
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $541
+ADDRLP4 8
+CNSTI4 3
+ASGNI4
+ADDRGP4 pml+136
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $544
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $544
+CNSTI4 17
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $544
+ADDRLP4 12
+CNSTI4 3
+ASGNI4
+ADDRGP4 pml+136
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $547
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $547
+CNSTI4 18
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $547
+LABELV $537
+endproc PM_WaterEvents 16 4
+proc PM_BeginWeaponChange 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $553
+ADDRFP4 0
+INDIRI4
+CNSTI4 11
+LTI4 $551
+LABELV $553
+ADDRGP4 $550
+JUMPV
+LABELV $551
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRFP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $554
+ADDRGP4 $550
+JUMPV
+LABELV $554
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $556
+ADDRGP4 $550
+JUMPV
+LABELV $556
+CNSTI4 22
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+CNSTI4 9
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+LABELV $550
+endproc PM_BeginWeaponChange 8 4
+proc PM_FinishWeaponChange 12 4
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $561
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+LTI4 $559
+LABELV $561
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $559
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $562
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $562
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 250
+ADDI4
+ASGNI4
+CNSTI4 10
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+LABELV $558
+endproc PM_FinishWeaponChange 12 4
+proc PM_TorsoAnimation 0 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $565
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $567
+CNSTI4 12
+ARGI4
+ADDRGP4 PM_ContinueTorsoAnim
+CALLV
+pop
+ADDRGP4 $564
+JUMPV
+LABELV $567
+CNSTI4 11
+ARGI4
+ADDRGP4 PM_ContinueTorsoAnim
+CALLV
+pop
+LABELV $565
+LABELV $564
+endproc PM_TorsoAnimation 0 4
+proc PM_Weapon 28 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $570
+ADDRGP4 $569
+JUMPV
+LABELV $570
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $572
+ADDRGP4 $569
+JUMPV
+LABELV $572
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $574
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $569
+JUMPV
+LABELV $574
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $576
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+NEI4 $577
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+CNSTI4 52
+ADDRLP4 4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $580
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 25
+ADDI4
+LTI4 $580
+ADDRGP4 $569
+JUMPV
+LABELV $580
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+CNSTI4 52
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 bg_itemlist+40
+ADDP4
+INDIRI4
+CNSTI4 24
+ADDI4
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $569
+JUMPV
+LABELV $576
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -1025
+BANDI4
+ASGNI4
+LABELV $577
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $584
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $584
+ADDRLP4 4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $589
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $587
+LABELV $589
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU1
+CVUI4 1
+EQI4 $590
+ADDRGP4 pm
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRGP4 PM_BeginWeaponChange
+CALLV
+pop
+LABELV $590
+LABELV $587
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $592
+ADDRGP4 $569
+JUMPV
+LABELV $592
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $594
+ADDRGP4 PM_FinishWeaponChange
+CALLV
+pop
+ADDRGP4 $569
+JUMPV
+LABELV $594
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $596
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $598
+CNSTI4 12
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 $569
+JUMPV
+LABELV $598
+CNSTI4 11
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 $569
+JUMPV
+LABELV $596
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $600
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $569
+JUMPV
+LABELV $600
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $602
+ADDRGP4 pm
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $604
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $569
+JUMPV
+LABELV $604
+CNSTI4 8
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 $603
+JUMPV
+LABELV $602
+CNSTI4 7
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+LABELV $603
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $606
+CNSTI4 21
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 500
+ADDI4
+ASGNI4
+ADDRGP4 $569
+JUMPV
+LABELV $606
+ADDRLP4 12
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $608
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $608
+CNSTI4 23
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $610
+ADDRLP4 16
+INDIRI4
+CNSTI4 10
+GTI4 $610
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $623-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $623
+address $613
+address $616
+address $615
+address $617
+address $618
+address $614
+address $620
+address $619
+address $621
+address $622
+code
+LABELV $610
+LABELV $613
+ADDRLP4 0
+CNSTI4 400
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $614
+ADDRLP4 0
+CNSTI4 50
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $615
+ADDRLP4 0
+CNSTI4 1000
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $616
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $617
+ADDRLP4 0
+CNSTI4 800
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $618
+ADDRLP4 0
+CNSTI4 800
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $619
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $620
+ADDRLP4 0
+CNSTI4 1500
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $621
+ADDRLP4 0
+CNSTI4 200
+ASGNI4
+ADDRGP4 $611
+JUMPV
+LABELV $622
+ADDRLP4 0
+CNSTI4 400
+ASGNI4
+LABELV $611
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 324
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $625
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CVIF4 4
+CNSTF4 1067869798
+DIVF4
+CVFI4 4
+ASGNI4
+LABELV $625
+ADDRLP4 24
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $569
+endproc PM_Weapon 28 4
+proc PM_Animate 0 4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $628
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $630
+CNSTI4 6
+ARGI4
+ADDRGP4 PM_StartTorsoAnim
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 2294
+ASGNI4
+CNSTI4 76
+ARGI4
+ADDRGP4 PM_AddEvent
+CALLV
+pop
+LABELV $630
+LABELV $628
+LABELV $627
+endproc PM_Animate 0 4
+proc PM_DropTimers 4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $633
+ADDRGP4 pml+40
+INDIRI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+LTI4 $635
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -353
+BANDI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $636
+JUMPV
+LABELV $635
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $636
+LABELV $633
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $639
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $642
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $642
+LABELV $639
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $644
+ADDRLP4 0
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 pml+40
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $647
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 80
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $647
+LABELV $644
+LABELV $632
+endproc PM_DropTimers 4 0
+export PM_UpdateViewAngles
+proc PM_UpdateViewAngles 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 5
+EQI4 $652
+ADDRLP4 8
+INDIRI4
+CNSTI4 6
+NEI4 $650
+LABELV $652
+ADDRGP4 $649
+JUMPV
+LABELV $650
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $653
+ADDRFP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $653
+ADDRGP4 $649
+JUMPV
+LABELV $653
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $655
+ADDRLP4 20
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+INDIRI4
+ADDI4
+CVII2 4
+ASGNI2
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $659
+ADDRLP4 4
+INDIRI2
+CVII4 2
+CNSTI4 16000
+LEI4 $661
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+CNSTI4 16000
+ADDRLP4 24
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI2 16000
+ASGNI2
+ADDRGP4 $662
+JUMPV
+LABELV $661
+ADDRLP4 4
+INDIRI2
+CVII4 2
+CNSTI4 -16000
+GEI4 $663
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+CNSTI4 -16000
+ADDRLP4 24
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI2 -16000
+ASGNI2
+LABELV $663
+LABELV $662
+LABELV $659
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDP4
+CNSTF4 1001652224
+ADDRLP4 4
+INDIRI2
+CVII4 2
+CVIF4 4
+MULF4
+ASGNF4
+LABELV $656
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $655
+LABELV $649
+endproc PM_UpdateViewAngles 28 0
+export PmoveSingle
+proc PmoveSingle 60 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 pm
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 c_pmove
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 204
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $666
+ADDRLP4 8
+ADDRGP4 pm
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -33554433
+BANDI4
+ASGNI4
+LABELV $666
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+GTI4 $670
+ADDRGP4 pm
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 abs
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 64
+LEI4 $668
+LABELV $670
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+LABELV $668
+ADDRGP4 pm
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $671
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRGP4 $672
+JUMPV
+LABELV $671
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 -4097
+BANDI4
+ASGNI4
+LABELV $672
+ADDRLP4 16
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 16
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+ADDRLP4 24
+INDIRI4
+NEI4 $673
+ADDRLP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 5
+EQI4 $673
+ADDRLP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 24
+INDIRI4
+EQI4 $673
+ADDRLP4 20
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $673
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+ADDRGP4 $674
+JUMPV
+LABELV $673
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+LABELV $674
+ADDRLP4 28
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+LEI4 $675
+ADDRLP4 28
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 5
+BANDI4
+ADDRLP4 32
+INDIRI4
+NEI4 $675
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 -513
+BANDI4
+ASGNI4
+LABELV $675
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $677
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 25
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 26
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $677
+ADDRGP4 pml
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 pml+40
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 pml+40
+INDIRI4
+CNSTI4 1
+GEI4 $680
+ADDRGP4 pml+40
+CNSTI4 1
+ASGNI4
+ADDRGP4 $681
+JUMPV
+LABELV $680
+ADDRGP4 pml+40
+INDIRI4
+CNSTI4 200
+LEI4 $684
+ADDRGP4 pml+40
+CNSTI4 200
+ASGNI4
+LABELV $684
+LABELV $681
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 pml+112
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 pml+124
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 pml+36
+CNSTF4 981668463
+ADDRGP4 pml+40
+INDIRI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+CNSTI4 4
+ADDP4
+ARGP4
+ADDRGP4 PM_UpdateViewAngles
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 pml
+ARGP4
+ADDRGP4 pml+12
+ARGP4
+ADDRGP4 pml+24
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 10
+GEI4 $694
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 -3
+BANDI4
+ASGNI4
+LABELV $694
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+GEI4 $696
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRGP4 $697
+JUMPV
+LABELV $696
+ADDRLP4 40
+ADDRGP4 pm
+INDIRP4
+ASGNP4
+ADDRLP4 44
+ADDRLP4 40
+INDIRP4
+CNSTI4 25
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 48
+INDIRI4
+GTI4 $700
+ADDRLP4 44
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEI4 $698
+ADDRLP4 40
+INDIRP4
+CNSTI4 26
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 48
+INDIRI4
+EQI4 $698
+LABELV $700
+ADDRLP4 52
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 -17
+BANDI4
+ASGNI4
+LABELV $698
+LABELV $697
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+LTI4 $701
+ADDRGP4 pm
+INDIRP4
+CNSTI4 25
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 pm
+INDIRP4
+CNSTI4 26
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 pm
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $701
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $703
+ADDRGP4 PM_CheckDuck
+CALLV
+pop
+ADDRGP4 PM_FlyMove
+CALLV
+pop
+ADDRGP4 PM_DropTimers
+CALLV
+pop
+ADDRGP4 $665
+JUMPV
+LABELV $703
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $705
+ADDRGP4 PM_NoclipMove
+CALLV
+pop
+ADDRGP4 PM_DropTimers
+CALLV
+pop
+ADDRGP4 $665
+JUMPV
+LABELV $705
+ADDRLP4 52
+CNSTI4 4
+ASGNI4
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+NEI4 $707
+ADDRGP4 $665
+JUMPV
+LABELV $707
+ADDRLP4 56
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 5
+EQI4 $711
+ADDRLP4 56
+INDIRI4
+CNSTI4 6
+NEI4 $709
+LABELV $711
+ADDRGP4 $665
+JUMPV
+LABELV $709
+ADDRGP4 PM_SetWaterLevel
+CALLV
+pop
+ADDRGP4 pml+136
+ADDRFP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 PM_CheckDuck
+CALLV
+pop
+ADDRGP4 PM_GroundTrace
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $713
+ADDRGP4 PM_DeadMove
+CALLV
+pop
+LABELV $713
+ADDRGP4 PM_DropTimers
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 336
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $715
+ADDRGP4 PM_FlyMove
+CALLV
+pop
+ADDRGP4 $716
+JUMPV
+LABELV $715
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $717
+ADDRGP4 PM_GrappleMove
+CALLV
+pop
+ADDRGP4 PM_AirMove
+CALLV
+pop
+ADDRGP4 $718
+JUMPV
+LABELV $717
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+EQI4 $719
+ADDRGP4 PM_WaterJumpMove
+CALLV
+pop
+ADDRGP4 $720
+JUMPV
+LABELV $719
+ADDRGP4 pm
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $721
+ADDRGP4 PM_WaterMove
+CALLV
+pop
+ADDRGP4 $722
+JUMPV
+LABELV $721
+ADDRGP4 pml+44
+INDIRI4
+CNSTI4 0
+EQI4 $723
+ADDRGP4 PM_WalkMove
+CALLV
+pop
+ADDRGP4 $724
+JUMPV
+LABELV $723
+ADDRGP4 PM_AirMove
+CALLV
+pop
+LABELV $724
+LABELV $722
+LABELV $720
+LABELV $718
+LABELV $716
+ADDRGP4 PM_Animate
+CALLV
+pop
+ADDRGP4 PM_GroundTrace
+CALLV
+pop
+ADDRGP4 PM_SetWaterLevel
+CALLV
+pop
+ADDRGP4 PM_Weapon
+CALLV
+pop
+ADDRGP4 PM_TorsoAnimation
+CALLV
+pop
+ADDRGP4 PM_Footsteps
+CALLV
+pop
+ADDRGP4 PM_WaterEvents
+CALLV
+pop
+ADDRGP4 pm
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 trap_SnapVector
+CALLV
+pop
+LABELV $665
+endproc PmoveSingle 60 16
+export Pmove
+proc Pmove 24 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+GEI4 $727
+ADDRGP4 $726
+JUMPV
+LABELV $727
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+CNSTI4 1000
+ADDI4
+LEI4 $729
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1000
+SUBI4
+ASGNI4
+LABELV $729
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CNSTI4 456
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 63
+BANDI4
+ASGNI4
+ADDRGP4 $732
+JUMPV
+LABELV $731
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 216
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $734
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+LEI4 $735
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 220
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $735
+JUMPV
+LABELV $734
+ADDRLP4 12
+INDIRI4
+CNSTI4 66
+LEI4 $738
+ADDRLP4 12
+CNSTI4 66
+ASGNI4
+LABELV $738
+LABELV $735
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 PmoveSingle
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $740
+ADDRFP4 0
+INDIRP4
+CNSTI4 27
+ADDP4
+CNSTI1 20
+ASGNI1
+LABELV $740
+LABELV $732
+ADDRFP4 0
+INDIRP4
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $731
+LABELV $726
+endproc Pmove 24 4
+import trap_SnapVector
+import PM_StepSlideMove
+import PM_SlideMove
+bss
+export pml
+align 4
+LABELV pml
+skip 140
+export pm
+align 4
+LABELV pm
+skip 4
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $468
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 76
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $457
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 101
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $446
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 10
+byte 1 0
+align 1
+LABELV $415
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 108
+byte 1 105
+byte 1 102
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $388
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 111
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 10
+byte 1 0
@@ -0,0 +1,4767 @@
+export P_DamageFeedback
+code
+proc P_DamageFeedback 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $54
+ADDRGP4 $53
+JUMPV
+LABELV $54
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+INDIRI4
+ADDI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+NEF4 $56
+ADDRGP4 $53
+JUMPV
+LABELV $56
+ADDRLP4 4
+INDIRF4
+CNSTF4 1132396544
+LEF4 $58
+ADDRLP4 4
+CNSTF4 1132396544
+ASGNF4
+LABELV $58
+ADDRLP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $60
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $61
+JUMPV
+LABELV $60
+ADDRLP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 176
+ADDP4
+CNSTF4 1132462080
+ADDRLP4 8
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 172
+ADDP4
+CNSTF4 1132462080
+ADDRLP4 8+4
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $61
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRI4
+LEI4 $63
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $63
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 700
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 56
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 168
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $63
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $53
+endproc P_DamageFeedback 36 12
+export P_WorldEffects
+proc P_WorldEffects 44 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $68
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 748
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 12000
+ADDI4
+ASGNI4
+ADDRGP4 $67
+JUMPV
+LABELV $68
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 320
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $73
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $74
+JUMPV
+LABELV $73
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $74
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $75
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $77
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 748
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+LABELV $77
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 748
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+GEI4 $76
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 748
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $76
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+CNSTI4 15
+LEI4 $85
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+CNSTI4 15
+ASGNI4
+LABELV $85
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+GTI4 $87
+ADDRGP4 $89
+ARGP4
+ADDRLP4 28
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRGP4 G_Sound
+CALLV
+pop
+ADDRGP4 $88
+JUMPV
+LABELV $87
+ADDRLP4 28
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $90
+ADDRGP4 $92
+ARGP4
+ADDRLP4 32
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 G_Sound
+CALLV
+pop
+ADDRGP4 $91
+JUMPV
+LABELV $90
+ADDRGP4 $93
+ARGP4
+ADDRLP4 32
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 32
+INDIRI4
+ARGI4
+ADDRGP4 G_Sound
+CALLV
+pop
+LABELV $91
+LABELV $88
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+CNSTP4 0
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+CNSTP4 0
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+CNSTI4 14
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRGP4 $76
+JUMPV
+LABELV $75
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 748
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 12000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $76
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $96
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 24
+BANDI4
+ADDRLP4 16
+INDIRI4
+EQI4 $96
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $98
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+GTI4 $98
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $101
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 62
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $102
+JUMPV
+LABELV $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $103
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 30
+ADDRLP4 0
+INDIRI4
+MULI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $103
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $105
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+ADDRLP4 28
+INDIRP4
+ARGP4
+CNSTI4 10
+ADDRLP4 0
+INDIRI4
+MULI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 15
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $105
+LABELV $102
+LABELV $98
+LABELV $96
+LABELV $67
+endproc P_WorldEffects 44 32
+export G_SetClientSound
+proc G_SetClientSound 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $108
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+INDIRI4
+CNSTI4 24
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $108
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 444
+ADDP4
+ADDRGP4 level+348
+INDIRI4
+ASGNI4
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 444
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $109
+LABELV $107
+endproc G_SetClientSound 8 0
+export ClientImpacts
+proc ClientImpacts 76 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $115
+JUMPV
+LABELV $112
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $119
+JUMPV
+LABELV $116
+ADDRLP4 68
+CNSTI4 2
+ASGNI4
+ADDRLP4 72
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRLP4 72
+INDIRP4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LSHI4
+ADDRLP4 72
+INDIRP4
+ADDP4
+INDIRI4
+NEI4 $120
+ADDRGP4 $118
+JUMPV
+LABELV $120
+LABELV $117
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $119
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $116
+LABELV $118
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $122
+ADDRGP4 $113
+JUMPV
+LABELV $122
+ADDRLP4 8
+CNSTI4 808
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $124
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $124
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $124
+ADDRLP4 8
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $126
+ADDRGP4 $113
+JUMPV
+LABELV $126
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $113
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $115
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+LTI4 $112
+LABELV $111
+endproc ClientImpacts 76 12
+data
+align 4
+LABELV $129
+byte 4 1109393408
+byte 4 1109393408
+byte 4 1112539136
+export G_TouchTriggers
+code
+proc G_TouchTriggers 4240 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $130
+ADDRGP4 $128
+JUMPV
+LABELV $130
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $132
+ADDRGP4 $128
+JUMPV
+LABELV $132
+ADDRLP4 4188
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 4188
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRGP4 $129
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 4188
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRGP4 $129+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 $129+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4192
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 4192
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRGP4 $129
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 4192
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRGP4 $129+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRGP4 $129+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 92
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4196
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 4196
+INDIRI4
+ASGNI4
+ADDRLP4 4204
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 64
+ADDRLP4 4204
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 4204
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4216
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 76
+ADDRLP4 4216
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 4216
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 76+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $149
+JUMPV
+LABELV $146
+ADDRLP4 0
+CNSTI4 808
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 92
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4224
+CNSTI4 704
+ASGNI4
+ADDRLP4 4228
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 4224
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4228
+INDIRU4
+NEU4 $150
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4224
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4228
+INDIRU4
+NEU4 $150
+ADDRGP4 $147
+JUMPV
+LABELV $150
+ADDRLP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRI4
+CNSTI4 1073741824
+BANDI4
+CNSTI4 0
+NEI4 $152
+ADDRGP4 $147
+JUMPV
+LABELV $152
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $154
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 9
+EQI4 $156
+ADDRLP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 Touch_DoorTrigger
+CVPU4 4
+EQU4 $156
+ADDRGP4 $147
+JUMPV
+LABELV $156
+LABELV $154
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $158
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRLP4 4232
+ADDRGP4 BG_PlayerTouchesItem
+CALLI4
+ASGNI4
+ADDRLP4 4232
+INDIRI4
+CNSTI4 0
+NEI4 $159
+ADDRGP4 $147
+JUMPV
+LABELV $158
+ADDRLP4 64
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4232
+ADDRGP4 trap_EntityContact
+CALLI4
+ASGNI4
+ADDRLP4 4232
+INDIRI4
+CNSTI4 0
+NEI4 $163
+ADDRGP4 $147
+JUMPV
+LABELV $163
+LABELV $159
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 56
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $165
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $165
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $167
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $167
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $167
+LABELV $147
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $149
+ADDRLP4 4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+LTI4 $146
+ADDRLP4 4224
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4224
+INDIRP4
+CNSTI4 460
+ADDP4
+INDIRI4
+ADDRLP4 4224
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRI4
+EQI4 $169
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 448
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $169
+LABELV $128
+endproc G_TouchTriggers 4240 16
+export SpectatorThink
+proc SpectatorThink 252 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $172
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+CNSTI4 400
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 232
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4+4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 24
+ADDRLP4 4+28
+CNSTI4 65537
+ASGNI4
+ADDRLP4 4+224
+ADDRGP4 trap_Trace
+ASGNP4
+ADDRLP4 4+228
+ADDRGP4 trap_PointContents
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Pmove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_TouchTriggers
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+LABELV $172
+ADDRLP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 244
+CNSTI4 1
+ASGNI4
+ADDRLP4 248
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRLP4 244
+INDIRI4
+BANDI4
+ADDRLP4 248
+INDIRI4
+EQI4 $178
+ADDRLP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRI4
+ADDRLP4 244
+INDIRI4
+BANDI4
+ADDRLP4 248
+INDIRI4
+NEI4 $178
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Cmd_FollowCycle_f
+CALLV
+pop
+LABELV $178
+LABELV $171
+endproc SpectatorThink 252 12
+export ClientInactivityTimer
+proc ClientInactivityTimer 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 g_inactivity+12
+INDIRI4
+CNSTI4 0
+NEI4 $181
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 60000
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $182
+JUMPV
+LABELV $181
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 493
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $189
+ADDRFP4 0
+INDIRP4
+CNSTI4 494
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $189
+ADDRFP4 0
+INDIRP4
+CNSTI4 495
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI4
+NEI4 $189
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 4
+INDIRI4
+EQI4 $185
+LABELV $189
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_inactivity+12
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $186
+JUMPV
+LABELV $185
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $192
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRI4
+LEI4 $194
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 776
+DIVI4
+ARGI4
+ADDRGP4 $197
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $180
+JUMPV
+LABELV $194
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRI4
+CNSTI4 10000
+SUBI4
+LEI4 $198
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $198
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 776
+DIVI4
+ARGI4
+ADDRGP4 $201
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $198
+LABELV $192
+LABELV $186
+LABELV $182
+CNSTI4 1
+RETI4
+LABELV $180
+endproc ClientInactivityTimer 12 8
+export ClientTimerActions
+proc ClientTimerActions 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $204
+JUMPV
+LABELV $203
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1000
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 332
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $206
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+GEI4 $208
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 15
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CVIF4 4
+CNSTF4 1066192077
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+LEF4 $210
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+CNSTF4 1066192077
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $210
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 63
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $207
+JUMPV
+LABELV $208
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+GEI4 $207
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 5
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+LEI4 $214
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+LABELV $214
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 63
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $207
+JUMPV
+LABELV $206
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+LEI4 $216
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $216
+LABELV $207
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+LEI4 $218
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $218
+LABELV $204
+ADDRLP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRI4
+CNSTI4 1000
+GEI4 $203
+LABELV $202
+endproc ClientTimerActions 20 12
+export ClientIntermissionThink
+proc ClientIntermissionThink 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -4097
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -257
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 5
+BANDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+BXORI4
+BANDI4
+CNSTI4 0
+EQI4 $221
+ADDRFP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $221
+LABELV $220
+endproc ClientIntermissionThink 24 0
+export ClientEvents
+proc ClientEvents 96 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+GEI4 $224
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+LABELV $224
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $226
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 11
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $232
+ADDRLP4 4
+INDIRI4
+CNSTI4 12
+EQI4 $232
+ADDRLP4 4
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $231
+LABELV $257
+ADDRLP4 4
+INDIRI4
+CNSTI4 23
+EQI4 $243
+ADDRLP4 4
+INDIRI4
+CNSTI4 25
+EQI4 $244
+ADDRLP4 4
+INDIRI4
+CNSTI4 26
+EQI4 $256
+ADDRGP4 $231
+JUMPV
+LABELV $232
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $233
+ADDRGP4 $231
+JUMPV
+LABELV $233
+ADDRGP4 g_dmflags+12
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $235
+ADDRGP4 $231
+JUMPV
+LABELV $235
+ADDRLP4 4
+INDIRI4
+CNSTI4 12
+NEI4 $238
+ADDRLP4 32
+CNSTI4 10
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $238
+ADDRLP4 32
+CNSTI4 5
+ASGNI4
+LABELV $239
+ADDRLP4 76
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRLP4 16+8
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 720
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 80
+CNSTP4 0
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRLP4 84
+CNSTP4 0
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 19
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRGP4 $231
+JUMPV
+LABELV $243
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 FireWeapon
+CALLV
+pop
+ADDRGP4 $231
+JUMPV
+LABELV $244
+ADDRLP4 12
+CNSTP4 0
+ASGNP4
+ADDRLP4 88
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+ADDRLP4 88
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+EQI4 $245
+CNSTI4 7
+ARGI4
+ADDRLP4 92
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 7
+ASGNI4
+ADDRGP4 $246
+JUMPV
+LABELV $245
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $247
+CNSTI4 8
+ARGI4
+ADDRLP4 92
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRGP4 $248
+JUMPV
+LABELV $247
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $249
+CNSTI4 9
+ARGI4
+ADDRLP4 92
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 9
+ASGNI4
+LABELV $249
+LABELV $248
+LABELV $246
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $251
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRLP4 92
+ADDRGP4 Drop_Item
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 60
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRI4
+CNSTI4 1
+GEI4 $254
+ADDRLP4 60
+INDIRP4
+CNSTI4 760
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $254
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $251
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 SelectSpawnPoint
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRGP4 TeleportPlayer
+CALLV
+pop
+ADDRGP4 $231
+JUMPV
+LABELV $256
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 25
+ADDI4
+ASGNI4
+LABELV $231
+LABELV $227
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $229
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+LTI4 $226
+LABELV $223
+endproc ClientEvents 96 32
+export SendPendingPredictableEvents
+proc SendPendingPredictableEvents 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+GEI4 $259
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+BANDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 3
+BANDI4
+CNSTI4 8
+LSHI4
+BORI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 140
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 128
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+LABELV $259
+LABELV $258
+endproc SendPendingPredictableEvents 56 12
+export ClientThink_real
+proc ClientThink_real 304 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $262
+ADDRGP4 $261
+JUMPV
+LABELV $262
+ADDRLP4 236
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 472
+ADDP4
+ASGNP4
+ADDRLP4 236
+INDIRP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 200
+ADDI4
+LEI4 $264
+ADDRLP4 236
+INDIRP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 200
+ADDI4
+ASGNI4
+LABELV $264
+ADDRLP4 236
+INDIRP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+SUBI4
+GEI4 $268
+ADDRLP4 236
+INDIRP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+SUBI4
+ASGNI4
+LABELV $268
+ADDRLP4 240
+ADDRLP4 236
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 240
+INDIRI4
+CNSTI4 1
+GEI4 $272
+ADDRLP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $272
+ADDRGP4 $261
+JUMPV
+LABELV $272
+ADDRLP4 240
+INDIRI4
+CNSTI4 200
+LEI4 $274
+ADDRLP4 240
+CNSTI4 200
+ASGNI4
+LABELV $274
+ADDRGP4 pmove_msec+12
+INDIRI4
+CNSTI4 8
+GEI4 $276
+ADDRGP4 $279
+ARGP4
+ADDRGP4 $280
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $276
+ADDRGP4 pmove_msec+12
+INDIRI4
+CNSTI4 33
+LEI4 $281
+ADDRGP4 $279
+ARGP4
+ADDRGP4 $284
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $281
+LABELV $277
+ADDRLP4 248
+CNSTI4 0
+ASGNI4
+ADDRGP4 pmove_fixed+12
+INDIRI4
+ADDRLP4 248
+INDIRI4
+NEI4 $288
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+ADDRLP4 248
+INDIRI4
+EQI4 $285
+LABELV $288
+ADDRLP4 236
+INDIRP4
+ADDRLP4 236
+INDIRP4
+INDIRI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+DIVI4
+ADDRGP4 pmove_msec+12
+INDIRI4
+MULI4
+ASGNI4
+LABELV $285
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $292
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientIntermissionThink
+CALLV
+pop
+ADDRGP4 $261
+JUMPV
+LABELV $292
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $295
+ADDRLP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $297
+ADDRGP4 $261
+JUMPV
+LABELV $297
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 236
+INDIRP4
+ARGP4
+ADDRGP4 SpectatorThink
+CALLV
+pop
+ADDRGP4 $261
+JUMPV
+LABELV $295
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 252
+ADDRGP4 ClientInactivityTimer
+CALLI4
+ASGNI4
+ADDRLP4 252
+INDIRI4
+CNSTI4 0
+NEI4 $299
+ADDRGP4 $261
+JUMPV
+LABELV $299
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+INDIRI4
+LEI4 $301
+ADDRLP4 256
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 256
+INDIRP4
+ADDRLP4 256
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+LABELV $301
+ADDRLP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $304
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $305
+JUMPV
+LABELV $304
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $306
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $307
+JUMPV
+LABELV $306
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $307
+LABELV $305
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ADDRGP4 g_gravity+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRGP4 g_speed+8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 324
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $310
+ADDRLP4 256
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 256
+INDIRP4
+CNSTF4 1067869798
+ADDRLP4 256
+INDIRP4
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $310
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+CNSTI4 10
+NEI4 $312
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $312
+ADDRLP4 236
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $312
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_HookFree
+CALLV
+pop
+LABELV $312
+ADDRLP4 244
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 232
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 264
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ADDRLP4 264
+INDIRI4
+NEI4 $314
+ADDRLP4 268
+ADDRLP4 236
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 272
+CNSTI4 0
+ASGNI4
+ADDRLP4 268
+INDIRI4
+CNSTI4 2
+BANDI4
+ADDRLP4 272
+INDIRI4
+NEI4 $314
+ADDRLP4 268
+INDIRI4
+ADDRLP4 264
+INDIRI4
+BANDI4
+ADDRLP4 272
+INDIRI4
+EQI4 $314
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ADDRLP4 272
+INDIRI4
+GTI4 $314
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 276
+ADDRGP4 CheckGauntletAttack
+CALLI4
+ASGNI4
+ADDRLP4 4+40
+ADDRLP4 276
+INDIRI4
+ASGNI4
+LABELV $314
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 32768
+BANDI4
+CNSTI4 0
+EQI4 $317
+ADDRLP4 276
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 -32769
+BANDI4
+ASGNI4
+ADDRLP4 280
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 488
+ADDP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ADDRLP4 280
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+LABELV $317
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4+4
+ADDRLP4 236
+INDIRP4
+INDIRB
+ASGNB 24
+ADDRLP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $320
+ADDRLP4 4+28
+CNSTI4 65537
+ASGNI4
+ADDRGP4 $321
+JUMPV
+LABELV $320
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $323
+ADDRLP4 4+28
+CNSTI4 37814273
+ASGNI4
+ADDRGP4 $324
+JUMPV
+LABELV $323
+ADDRLP4 4+28
+CNSTI4 33619969
+ASGNI4
+LABELV $324
+LABELV $321
+ADDRLP4 4+224
+ADDRGP4 trap_Trace
+ASGNP4
+ADDRLP4 4+228
+ADDRGP4 trap_PointContents
+ASGNP4
+ADDRLP4 4+32
+ADDRGP4 g_debugMove+12
+INDIRI4
+ASGNI4
+ADDRGP4 g_dmflags+12
+INDIRI4
+CNSTI4 32
+BANDI4
+CNSTI4 0
+LEI4 $334
+ADDRLP4 276
+CNSTI4 1
+ASGNI4
+ADDRGP4 $335
+JUMPV
+LABELV $334
+ADDRLP4 276
+CNSTI4 0
+ASGNI4
+LABELV $335
+ADDRLP4 4+36
+ADDRLP4 276
+INDIRI4
+ASGNI4
+ADDRLP4 4+216
+ADDRGP4 pmove_fixed+12
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 4+220
+ADDRGP4 pmove_msec+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 668
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+ARGP4
+ADDRGP4 Pmove
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ADDRLP4 244
+INDIRI4
+EQI4 $340
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $340
+ADDRGP4 g_smoothClients+12
+INDIRI4
+CNSTI4 0
+EQI4 $343
+ADDRLP4 288
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 288
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 288
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityStateExtraPolate
+CALLV
+pop
+ADDRGP4 $344
+JUMPV
+LABELV $343
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+LABELV $344
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 SendPendingPredictableEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 256
+BANDI4
+CNSTI4 0
+NEI4 $346
+ADDRLP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $346
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRLP4 4+180
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ADDRLP4 4+192
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+ADDRLP4 4+208
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+ADDRLP4 4+204
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 244
+INDIRI4
+ARGI4
+ADDRGP4 ClientEvents
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $352
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_TouchTriggers
+CALLV
+pop
+LABELV $352
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRGP4 BotTestAAS
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 ClientImpacts
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ADDRLP4 244
+INDIRI4
+EQI4 $354
+ADDRFP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $354
+ADDRLP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+ADDRLP4 236
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 300
+ADDRLP4 0
+INDIRP4
+CNSTI4 664
+ADDP4
+ASGNP4
+ADDRLP4 300
+INDIRP4
+ADDRLP4 300
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 660
+ADDP4
+INDIRI4
+BCOMI4
+BANDI4
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $357
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+LEI4 $261
+ADDRGP4 g_forcerespawn+12
+INDIRI4
+CNSTI4 0
+LEI4 $362
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1000
+ADDRGP4 g_forcerespawn+12
+INDIRI4
+MULI4
+LEI4 $362
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 respawn
+CALLV
+pop
+ADDRGP4 $261
+JUMPV
+LABELV $362
+ADDRLP4 236
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 5
+BANDI4
+CNSTI4 0
+EQI4 $261
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 respawn
+CALLV
+pop
+ADDRGP4 $261
+JUMPV
+LABELV $357
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 240
+INDIRI4
+ARGI4
+ADDRGP4 ClientTimerActions
+CALLV
+pop
+LABELV $261
+endproc ClientThink_real 304 16
+export ClientThink
+proc ClientThink 12 8
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 808
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 472
+ADDP4
+ARGP4
+ADDRGP4 trap_GetUsercmd
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 652
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 8
+INDIRI4
+NEI4 $371
+ADDRGP4 g_synchronousClients+12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $371
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientThink_real
+CALLV
+pop
+LABELV $371
+LABELV $369
+endproc ClientThink 12 8
+export G_RunClient
+proc G_RunClient 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 0
+INDIRI4
+NEI4 $375
+ADDRGP4 g_synchronousClients+12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $375
+ADDRGP4 $374
+JUMPV
+LABELV $375
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 472
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientThink_real
+CALLV
+pop
+LABELV $374
+endproc G_RunClient 4 4
+export SpectatorClientEndFrame
+proc SpectatorClientEndFrame 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $380
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $382
+ADDRLP4 4
+ADDRGP4 level+340
+INDIRI4
+ASGNI4
+ADDRGP4 $383
+JUMPV
+LABELV $382
+ADDRLP4 4
+INDIRI4
+CNSTI4 -2
+NEI4 $385
+ADDRLP4 4
+ADDRGP4 level+344
+INDIRI4
+ASGNI4
+LABELV $385
+LABELV $383
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $388
+ADDRLP4 0
+CNSTI4 776
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $390
+ADDRLP4 12
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $390
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 104
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 -540673
+BANDI4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+CNSTI4 540672
+BANDI4
+BORI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRB
+ASGNB 468
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $379
+JUMPV
+LABELV $390
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 0
+LTI4 $392
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 624
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 776
+DIVI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+LABELV $392
+LABELV $388
+LABELV $380
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $394
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRGP4 $395
+JUMPV
+LABELV $394
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 -8193
+BANDI4
+ASGNI4
+LABELV $395
+LABELV $379
+endproc SpectatorClientEndFrame 32 4
+export ClientEndFrame
+proc ClientEndFrame 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $397
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SpectatorClientEndFrame
+CALLV
+pop
+ADDRGP4 $396
+JUMPV
+LABELV $397
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $399
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+GEI4 $403
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $403
+LABELV $400
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $399
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $406
+ADDRGP4 $396
+JUMPV
+LABELV $406
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 P_WorldEffects
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 P_DamageFeedback
+CALLV
+pop
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 1000
+LEI4 $409
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+ADDRGP4 $410
+JUMPV
+LABELV $409
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 -8193
+BANDI4
+ASGNI4
+LABELV $410
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_SetClientSound
+CALLV
+pop
+ADDRGP4 g_smoothClients+12
+INDIRI4
+CNSTI4 0
+EQI4 $412
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityStateExtraPolate
+CALLV
+pop
+ADDRGP4 $413
+JUMPV
+LABELV $412
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+LABELV $413
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 SendPendingPredictableEvents
+CALLV
+pop
+LABELV $396
+endproc ClientEndFrame 20 16
+import BotTestSolid
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import DeathmatchScoreboardMessage
+import G_SetStats
+import MoveClientToIntermission
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import G_RunMissile
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $284
+byte 1 51
+byte 1 51
+byte 1 0
+align 1
+LABELV $280
+byte 1 56
+byte 1 0
+align 1
+LABELV $279
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $201
+byte 1 99
+byte 1 112
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 100
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 108
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 32
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 33
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $197
+byte 1 68
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 100
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $93
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $92
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $89
+byte 1 42
+byte 1 100
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
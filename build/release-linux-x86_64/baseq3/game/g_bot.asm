@@ -0,0 +1,5892 @@
+export trap_Cvar_VariableValue
+code
+proc trap_Cvar_VariableValue 132 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 128
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+RETF4
+LABELV $54
+endproc trap_Cvar_VariableValue 132 12
+export G_ParseInfos
+proc G_ParseInfos 2084 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+CNSTI4 0
+ASGNI4
+ADDRGP4 $57
+JUMPV
+LABELV $56
+ADDRFP4 0
+ARGP4
+ADDRLP4 2056
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2056
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $59
+ADDRGP4 $58
+JUMPV
+LABELV $59
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $63
+ARGP4
+ADDRLP4 2060
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+CNSTI4 0
+EQI4 $61
+ADDRGP4 $64
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $58
+JUMPV
+LABELV $61
+ADDRLP4 2052
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $65
+ADDRGP4 $67
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $58
+JUMPV
+LABELV $65
+ADDRLP4 1028
+CNSTI1 0
+ASGNI1
+ADDRGP4 $69
+JUMPV
+LABELV $68
+ADDRFP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 2064
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2064
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $71
+ADDRGP4 $73
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $70
+JUMPV
+LABELV $71
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $76
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $74
+ADDRGP4 $70
+JUMPV
+LABELV $74
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 2072
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2072
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $77
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $79
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $77
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $69
+ADDRGP4 $68
+JUMPV
+LABELV $70
+ADDRLP4 1028
+ARGP4
+ADDRLP4 2064
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 $80
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 $81
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2072
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2072
+INDIRP4
+ARGP4
+ADDRLP4 2076
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 2064
+INDIRI4
+ADDRLP4 2068
+INDIRI4
+ADDI4
+ADDRLP4 2076
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 2080
+ADDRGP4 G_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 2080
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $82
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 2052
+ADDRLP4 2052
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $82
+LABELV $57
+ADDRGP4 $56
+JUMPV
+LABELV $58
+ADDRLP4 2052
+INDIRI4
+RETI4
+LABELV $55
+endproc G_ParseInfos 2084 12
+proc G_LoadArenasFromFile 8216 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8200
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8200
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $85
+ADDRGP4 $87
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRGP4 $84
+JUMPV
+LABELV $85
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+LTI4 $88
+ADDRGP4 $90
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 8192
+ARGI4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $84
+JUMPV
+LABELV $88
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 8204
+ADDRGP4 g_numArenas
+ASGNP4
+ADDRLP4 8208
+ADDRLP4 8204
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 1024
+ADDRLP4 8208
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8208
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaInfos
+ADDP4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 G_ParseInfos
+CALLI4
+ASGNI4
+ADDRLP4 8204
+INDIRP4
+ADDRLP4 8208
+INDIRI4
+ADDRLP4 8212
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $84
+endproc G_LoadArenasFromFile 8216 16
+proc G_LoadArenas 1460 16
+ADDRGP4 g_numArenas
+CNSTI4 0
+ASGNI4
+ADDRLP4 148
+ARGP4
+ADDRGP4 $92
+ARGP4
+ADDRGP4 $93
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 148+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $94
+ADDRLP4 148+16
+ARGP4
+ADDRGP4 G_LoadArenasFromFile
+CALLV
+pop
+ADDRGP4 $95
+JUMPV
+LABELV $94
+ADDRGP4 $98
+ARGP4
+ADDRGP4 G_LoadArenasFromFile
+CALLV
+pop
+LABELV $95
+ADDRGP4 $99
+ARGP4
+ADDRGP4 $100
+ARGP4
+ADDRLP4 420
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1444
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 1444
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 420
+ASGNP4
+ADDRLP4 136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $104
+JUMPV
+LABELV $101
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1448
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1448
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 $105
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 G_LoadArenasFromFile
+CALLV
+pop
+LABELV $102
+ADDRLP4 1448
+CNSTI4 1
+ASGNI4
+ADDRLP4 136
+ADDRLP4 136
+INDIRI4
+ADDRLP4 1448
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 140
+INDIRI4
+ADDRLP4 1448
+INDIRI4
+ADDI4
+ADDRLP4 4
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $104
+ADDRLP4 136
+INDIRI4
+ADDRLP4 144
+INDIRI4
+LTI4 $101
+ADDRGP4 $106
+ARGP4
+ADDRGP4 g_numArenas
+INDIRI4
+ARGI4
+ADDRLP4 1452
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1452
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $110
+JUMPV
+LABELV $107
+ADDRGP4 $112
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1456
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $111
+ARGP4
+ADDRLP4 1456
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $108
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $110
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numArenas
+INDIRI4
+LTI4 $107
+LABELV $91
+endproc G_LoadArenas 1460 16
+export G_GetArenaInfoByMap
+proc G_GetArenaInfoByMap 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $117
+JUMPV
+LABELV $114
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $120
+ARGP4
+ADDRLP4 4
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $118
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $113
+JUMPV
+LABELV $118
+LABELV $115
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $117
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numArenas
+INDIRI4
+LTI4 $114
+CNSTP4 0
+RETP4
+LABELV $113
+endproc G_GetArenaInfoByMap 12 8
+proc PlayerIntroSound 80 12
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 68
+ADDRGP4 Q_strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $122
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $123
+JUMPV
+LABELV $122
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+LABELV $123
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $126
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $124
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+LABELV $124
+ADDRGP4 $127
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $121
+endproc PlayerIntroSound 80 12
+export G_AddRandomBot
+proc G_AddRandomBot 84 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRGP4 $132
+JUMPV
+LABELV $129
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $133
+ARGP4
+ADDRLP4 68
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $137
+JUMPV
+LABELV $134
+ADDRLP4 0
+CNSTI4 776
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $139
+ADDRGP4 $135
+JUMPV
+LABELV $139
+CNSTI4 808
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $141
+ADDRGP4 $135
+JUMPV
+LABELV $141
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $145
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $145
+ADDRGP4 $135
+JUMPV
+LABELV $145
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $147
+ADDRGP4 $136
+JUMPV
+LABELV $147
+LABELV $135
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $137
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $134
+LABELV $136
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $149
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $149
+LABELV $130
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $132
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $129
+ADDRLP4 68
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 68
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $155
+JUMPV
+LABELV $152
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $133
+ARGP4
+ADDRLP4 72
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $159
+JUMPV
+LABELV $156
+ADDRLP4 0
+CNSTI4 776
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $161
+ADDRGP4 $157
+JUMPV
+LABELV $161
+CNSTI4 808
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $163
+ADDRGP4 $157
+JUMPV
+LABELV $163
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $167
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $167
+ADDRGP4 $157
+JUMPV
+LABELV $167
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+NEI4 $169
+ADDRGP4 $158
+JUMPV
+LABELV $169
+LABELV $157
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $159
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $156
+LABELV $158
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $171
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+GTI4 $174
+ADDRGP4 $176
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 76
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $177
+ADDRLP4 60
+ADDRGP4 $179
+ASGNP4
+ADDRGP4 $178
+JUMPV
+LABELV $177
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $180
+ADDRLP4 60
+ADDRGP4 $182
+ASGNP4
+ADDRGP4 $181
+JUMPV
+LABELV $180
+ADDRLP4 60
+ADDRGP4 $93
+ASGNP4
+LABELV $181
+LABELV $178
+ADDRLP4 20
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 35
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRLP4 20+35
+CNSTI1 0
+ASGNI1
+ADDRLP4 20
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 $184
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 56
+INDIRF4
+ARGF4
+ADDRLP4 60
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $128
+JUMPV
+LABELV $174
+LABELV $171
+LABELV $153
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $155
+ADDRLP4 12
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $152
+LABELV $128
+endproc G_AddRandomBot 84 20
+export G_RemoveRandomBot
+proc G_RemoveRandomBot 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $189
+JUMPV
+LABELV $186
+ADDRLP4 0
+CNSTI4 776
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $191
+ADDRGP4 $187
+JUMPV
+LABELV $191
+CNSTI4 808
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $193
+ADDRGP4 $187
+JUMPV
+LABELV $193
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $197
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $197
+ADDRGP4 $187
+JUMPV
+LABELV $197
+ADDRGP4 $199
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $185
+JUMPV
+LABELV $187
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $189
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $186
+CNSTI4 0
+RETI4
+LABELV $185
+endproc G_RemoveRandomBot 16 8
+export G_CountHumanPlayers
+proc G_CountHumanPlayers 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $204
+JUMPV
+LABELV $201
+ADDRLP4 0
+CNSTI4 776
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $206
+ADDRGP4 $202
+JUMPV
+LABELV $206
+CNSTI4 808
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $208
+ADDRGP4 $202
+JUMPV
+LABELV $208
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $212
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $212
+ADDRGP4 $202
+JUMPV
+LABELV $212
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $202
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $204
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $201
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $200
+endproc G_CountHumanPlayers 20 0
+export G_CountBotPlayers
+proc G_CountBotPlayers 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $218
+JUMPV
+LABELV $215
+ADDRLP4 4
+CNSTI4 776
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $220
+ADDRGP4 $216
+JUMPV
+LABELV $220
+CNSTI4 808
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $222
+ADDRGP4 $216
+JUMPV
+LABELV $222
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $226
+ADDRLP4 4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $226
+ADDRGP4 $216
+JUMPV
+LABELV $226
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $216
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $218
+ADDRLP4 8
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $215
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $228
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $232
+ADDRGP4 $229
+JUMPV
+LABELV $232
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $235
+ADDRGP4 $229
+JUMPV
+LABELV $235
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $229
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $228
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $214
+endproc G_CountBotPlayers 24 0
+bss
+align 4
+LABELV $240
+skip 4
+export G_CheckMinimumPlayers
+code
+proc G_CheckMinimumPlayers 36 4
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $241
+ADDRGP4 $239
+JUMPV
+LABELV $241
+ADDRGP4 $240
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 10000
+SUBI4
+LEI4 $244
+ADDRGP4 $239
+JUMPV
+LABELV $244
+ADDRGP4 $240
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 bot_minplayers
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 bot_minplayers+12
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $249
+ADDRGP4 $239
+JUMPV
+LABELV $249
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $251
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $254
+ADDRLP4 0
+ADDRGP4 g_maxclients+12
+INDIRI4
+CNSTI4 2
+DIVI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $254
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ADDRGP4 G_CountHumanPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 1
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_CountBotPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+GEI4 $258
+CNSTI4 1
+ARGI4
+ADDRGP4 G_AddRandomBot
+CALLV
+pop
+ADDRGP4 $259
+JUMPV
+LABELV $258
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+LEI4 $260
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $260
+CNSTI4 1
+ARGI4
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+pop
+LABELV $260
+LABELV $259
+CNSTI4 2
+ARGI4
+ADDRLP4 24
+ADDRGP4 G_CountHumanPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 2
+ARGI4
+ADDRLP4 28
+ADDRGP4 G_CountBotPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+GEI4 $262
+CNSTI4 2
+ARGI4
+ADDRGP4 G_AddRandomBot
+CALLV
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $262
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+LEI4 $252
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $252
+CNSTI4 2
+ARGI4
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+pop
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $266
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $269
+ADDRLP4 0
+ADDRGP4 g_maxclients+12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $269
+CNSTI4 -1
+ARGI4
+ADDRLP4 12
+ADDRGP4 G_CountHumanPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 -1
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_CountBotPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+GEI4 $273
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddRandomBot
+CALLV
+pop
+ADDRGP4 $267
+JUMPV
+LABELV $273
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+LEI4 $267
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $267
+CNSTI4 3
+ARGI4
+ADDRLP4 24
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $267
+CNSTI4 -1
+ARGI4
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+pop
+ADDRGP4 $267
+JUMPV
+LABELV $266
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 0
+NEI4 $279
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $282
+ADDRLP4 0
+ADDRGP4 g_maxclients+12
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $282
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 G_CountHumanPlayers
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_CountBotPlayers
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+GEI4 $286
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddRandomBot
+CALLV
+pop
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRI4
+LEI4 $288
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $288
+CNSTI4 0
+ARGI4
+ADDRGP4 G_RemoveRandomBot
+CALLI4
+pop
+LABELV $288
+LABELV $287
+LABELV $279
+LABELV $267
+LABELV $252
+LABELV $239
+endproc G_CheckMinimumPlayers 36 4
+export G_CheckBotSpawn
+proc G_CheckBotSpawn 1032 12
+ADDRGP4 G_CheckMinimumPlayers
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $291
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $295
+ADDRGP4 $292
+JUMPV
+LABELV $295
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $298
+ADDRGP4 $292
+JUMPV
+LABELV $298
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $303
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $306
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 PlayerIntroSound
+CALLV
+pop
+LABELV $303
+LABELV $292
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $291
+LABELV $290
+endproc G_CheckBotSpawn 1032 12
+proc AddBotToSpawnQueue 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $308
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $312
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue
+ADDP4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $307
+JUMPV
+LABELV $312
+LABELV $309
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $308
+ADDRGP4 $317
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+LABELV $307
+endproc AddBotToSpawnQueue 4 4
+export G_RemoveQueuedBotBegin
+proc G_RemoveQueuedBotBegin 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $319
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $323
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 botSpawnQueue+4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $318
+JUMPV
+LABELV $323
+LABELV $320
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $319
+LABELV $318
+endproc G_RemoveQueuedBotBegin 4 0
+export G_BotConnect
+proc G_BotConnect 1336 12
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 292
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 292
+ARGP4
+ADDRGP4 $327
+ARGP4
+ADDRLP4 1316
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1316
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 292
+ARGP4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 1320
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1320
+INDIRP4
+ARGP4
+ADDRLP4 1324
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0+144
+ADDRLP4 1324
+INDIRF4
+ASGNF4
+ADDRLP4 292
+ARGP4
+ADDRGP4 $331
+ARGP4
+ADDRLP4 1328
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0+148
+ARGP4
+ADDRLP4 1328
+INDIRP4
+ARGP4
+CNSTI4 144
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1332
+ADDRGP4 BotAISetupClient
+CALLI4
+ASGNI4
+ADDRLP4 1332
+INDIRI4
+CNSTI4 0
+NEI4 $333
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 $335
+ARGP4
+ADDRGP4 trap_DropClient
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $326
+JUMPV
+LABELV $333
+CNSTI4 1
+RETI4
+LABELV $326
+endproc G_BotConnect 1336 12
+proc G_AddBot 1136 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 G_GetBotInfoByName
+CALLP4
+ASGNP4
+ADDRLP4 1032
+ADDRLP4 1056
+INDIRP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $337
+ADDRGP4 $339
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $337
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $340
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1060
+INDIRP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $341
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $133
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1048
+ADDRLP4 1064
+INDIRP4
+ASGNP4
+LABELV $341
+ADDRLP4 1064
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $343
+ADDRLP4 1064
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $343
+ADDRLP4 1048
+ADDRFP4 16
+INDIRP4
+ASGNP4
+LABELV $343
+ADDRLP4 4
+ARGP4
+ADDRGP4 $133
+ARGP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $345
+ARGP4
+ADDRGP4 $346
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $347
+ARGP4
+ADDRGP4 $348
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $349
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 1068
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+CNSTF4 1065353216
+LTF4 $350
+ADDRFP4 4
+INDIRF4
+CNSTF4 1073741824
+GEF4 $350
+ADDRLP4 4
+ARGP4
+ADDRGP4 $352
+ARGP4
+ADDRGP4 $353
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $351
+JUMPV
+LABELV $350
+ADDRFP4 4
+INDIRF4
+CNSTF4 1073741824
+LTF4 $354
+ADDRFP4 4
+INDIRF4
+CNSTF4 1077936128
+GEF4 $354
+ADDRLP4 4
+ARGP4
+ADDRGP4 $352
+ARGP4
+ADDRGP4 $356
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $355
+JUMPV
+LABELV $354
+ADDRFP4 4
+INDIRF4
+CNSTF4 1077936128
+LTF4 $357
+ADDRFP4 4
+INDIRF4
+CNSTF4 1082130432
+GEF4 $357
+ADDRLP4 4
+ARGP4
+ADDRGP4 $352
+ARGP4
+ADDRGP4 $359
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $357
+LABELV $355
+LABELV $351
+ADDRLP4 0
+ADDRGP4 $306
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1084
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+ADDRLP4 1084
+INDIRP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $360
+ADDRLP4 1040
+ADDRGP4 $362
+ASGNP4
+LABELV $360
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $363
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $364
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1088
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+ADDRLP4 1088
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $365
+ADDRLP4 1044
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+LABELV $365
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $367
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $368
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1092
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1092
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $369
+ADDRLP4 1028
+ADDRGP4 $371
+ASGNP4
+LABELV $369
+ADDRLP4 4
+ARGP4
+ADDRGP4 $372
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $373
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1096
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1096
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $374
+ADDRLP4 1028
+ADDRGP4 $376
+ASGNP4
+LABELV $374
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 $377
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1100
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $378
+ADDRLP4 1028
+ADDRGP4 $380
+ASGNP4
+LABELV $378
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 1104
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 1104
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $382
+ADDRGP4 $384
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $382
+ADDRLP4 1108
+ADDRGP4 trap_BotAllocateClient
+CALLI4
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 -1
+NEI4 $385
+ADDRGP4 $387
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $388
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $385
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $391
+ADDRFP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $389
+LABELV $391
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $392
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1116
+ADDRGP4 PickTeam
+CALLI4
+ASGNI4
+ADDRLP4 1116
+INDIRI4
+CNSTI4 1
+NEI4 $395
+ADDRFP4 8
+ADDRGP4 $179
+ASGNP4
+ADDRGP4 $393
+JUMPV
+LABELV $395
+ADDRFP4 8
+ADDRGP4 $182
+ASGNP4
+ADDRGP4 $393
+JUMPV
+LABELV $392
+ADDRFP4 8
+ADDRGP4 $179
+ASGNP4
+LABELV $393
+LABELV $389
+ADDRLP4 1032
+INDIRP4
+ARGP4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $327
+ARGP4
+ADDRLP4 1116
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $397
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRLP4 1120
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $329
+ARGP4
+ADDRLP4 1120
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $331
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 1052
+CNSTI4 808
+ADDRLP4 1036
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 1124
+ADDRLP4 1052
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 1124
+INDIRP4
+ADDRLP4 1124
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 1052
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_SetUserinfo
+CALLV
+pop
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1128
+CNSTI4 1
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+ARGI4
+ADDRLP4 1128
+INDIRI4
+ARGI4
+ADDRLP4 1132
+ADDRGP4 ClientConnect
+CALLP4
+ASGNP4
+ADDRLP4 1132
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $398
+ADDRGP4 $336
+JUMPV
+LABELV $398
+ADDRFP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $400
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+ADDRGP4 $336
+JUMPV
+LABELV $400
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 AddBotToSpawnQueue
+CALLV
+pop
+LABELV $336
+endproc G_AddBot 1136 12
+export Svcmd_AddBot_f
+proc Svcmd_AddBot_f 4112 20
+ADDRGP4 $405
+ARGP4
+ADDRLP4 4104
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 4104
+INDIRI4
+CNSTI4 0
+NEI4 $403
+ADDRGP4 $402
+JUMPV
+LABELV $403
+CNSTI4 1
+ARGI4
+ADDRLP4 1024
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1024
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $406
+ADDRGP4 $408
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRGP4 $402
+JUMPV
+LABELV $406
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $409
+ADDRLP4 4096
+CNSTF4 1082130432
+ASGNF4
+ADDRGP4 $410
+JUMPV
+LABELV $409
+ADDRLP4 0
+ARGP4
+ADDRLP4 4108
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 4096
+ADDRLP4 4108
+INDIRF4
+ASGNF4
+LABELV $410
+CNSTI4 3
+ARGI4
+ADDRLP4 3072
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+CNSTI4 4
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $411
+ADDRLP4 4100
+CNSTI4 0
+ASGNI4
+ADDRGP4 $412
+JUMPV
+LABELV $411
+ADDRLP4 0
+ARGP4
+ADDRLP4 4108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4100
+ADDRLP4 4108
+INDIRI4
+ASGNI4
+LABELV $412
+CNSTI4 5
+ARGI4
+ADDRLP4 2048
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+ADDRLP4 4096
+INDIRF4
+ARGF4
+ADDRLP4 3072
+ARGP4
+ADDRLP4 4100
+INDIRI4
+ARGI4
+ADDRLP4 2048
+ARGP4
+ADDRGP4 G_AddBot
+CALLV
+pop
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+SUBI4
+CNSTI4 1000
+LEI4 $413
+ADDRGP4 $417
+ARGP4
+ADDRLP4 4108
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 4108
+INDIRI4
+CNSTI4 0
+EQI4 $413
+CNSTI4 -1
+ARGI4
+ADDRGP4 $418
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $413
+LABELV $402
+endproc Svcmd_AddBot_f 4112 20
+export Svcmd_BotList_f
+proc Svcmd_BotList_f 4120 20
+ADDRGP4 $420
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $424
+JUMPV
+LABELV $421
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $133
+ARGP4
+ADDRLP4 4100
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 4100
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $425
+ADDRLP4 4
+ARGP4
+ADDRGP4 $427
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $425
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $340
+ARGP4
+ADDRLP4 4104
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4104
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 1028
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $428
+ADDRLP4 1028
+ARGP4
+ADDRGP4 $93
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $428
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $306
+ARGP4
+ADDRLP4 4108
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2052
+ARGP4
+ADDRLP4 4108
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 2052
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $430
+ADDRLP4 2052
+ARGP4
+ADDRGP4 $362
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $430
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 4112
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 3076
+ARGP4
+ADDRLP4 4112
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 3076
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $432
+ADDRLP4 3076
+ARGP4
+ADDRGP4 $434
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $432
+ADDRGP4 $435
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2052
+ARGP4
+ADDRLP4 3076
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4116
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4116
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+LABELV $422
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $424
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $421
+LABELV $419
+endproc Svcmd_BotList_f 4120 20
+proc G_SpawnBots 1060 16
+ADDRLP4 1040
+CNSTP4 0
+ASGNP4
+ADDRGP4 podium1
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRGP4 podium2
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRGP4 podium3
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRGP4 $176
+ARGP4
+ADDRLP4 1044
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 1044
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1065353216
+GEF4 $437
+ADDRGP4 $176
+ARGP4
+ADDRGP4 $439
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $438
+JUMPV
+LABELV $437
+ADDRLP4 12
+INDIRF4
+CNSTF4 1084227584
+LEF4 $440
+ADDRGP4 $176
+ARGP4
+ADDRGP4 $380
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 12
+CNSTF4 1084227584
+ASGNF4
+LABELV $440
+LABELV $438
+ADDRLP4 16
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 16
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $443
+JUMPV
+LABELV $445
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $446
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $448
+ADDRLP4 1048
+INDIRI4
+CNSTI4 32
+EQI4 $445
+LABELV $448
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $449
+ADDRGP4 $444
+JUMPV
+LABELV $449
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $452
+JUMPV
+LABELV $451
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $452
+ADDRLP4 1052
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+EQI4 $454
+ADDRLP4 1052
+INDIRI4
+CNSTI4 32
+NEI4 $451
+LABELV $454
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $455
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1056
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $455
+ADDRGP4 $457
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1056
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 1
+ARGI4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1500
+ADDI4
+ASGNI4
+LABELV $443
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $446
+LABELV $444
+LABELV $436
+endproc G_SpawnBots 1060 16
+proc G_LoadBotsFromFile 8216 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8200
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8200
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $459
+ADDRGP4 $87
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRGP4 $458
+JUMPV
+LABELV $459
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+LTI4 $461
+ADDRGP4 $90
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 8192
+ARGI4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $458
+JUMPV
+LABELV $461
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 8204
+ADDRGP4 g_numBots
+ASGNP4
+ADDRLP4 8208
+ADDRLP4 8204
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 1024
+ADDRLP4 8208
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8208
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 G_ParseInfos
+CALLI4
+ASGNI4
+ADDRLP4 8204
+INDIRP4
+ADDRLP4 8208
+INDIRI4
+ADDRLP4 8212
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $458
+endproc G_LoadBotsFromFile 8216 16
+proc G_LoadBots 1456 16
+ADDRGP4 $405
+ARGP4
+ADDRLP4 1440
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 1440
+INDIRI4
+CNSTI4 0
+NEI4 $464
+ADDRGP4 $463
+JUMPV
+LABELV $464
+ADDRGP4 g_numBots
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+ARGP4
+ADDRGP4 $466
+ARGP4
+ADDRGP4 $93
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 144+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $467
+ADDRLP4 144+16
+ARGP4
+ADDRGP4 G_LoadBotsFromFile
+CALLV
+pop
+ADDRGP4 $468
+JUMPV
+LABELV $467
+ADDRGP4 $471
+ARGP4
+ADDRGP4 G_LoadBotsFromFile
+CALLV
+pop
+LABELV $468
+ADDRGP4 $99
+ARGP4
+ADDRGP4 $472
+ARGP4
+ADDRLP4 416
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1444
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1444
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 416
+ASGNP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $476
+JUMPV
+LABELV $473
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1448
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 1448
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $105
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_LoadBotsFromFile
+CALLV
+pop
+LABELV $474
+ADDRLP4 1448
+CNSTI4 1
+ASGNI4
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+ADDRLP4 1448
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+ADDRLP4 1448
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $476
+ADDRLP4 132
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $473
+ADDRGP4 $477
+ARGP4
+ADDRGP4 g_numBots
+INDIRI4
+ARGI4
+ADDRLP4 1452
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1452
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+LABELV $463
+endproc G_LoadBots 1456 16
+export G_GetBotInfoByNumber
+proc G_GetBotInfoByNumber 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $481
+ADDRFP4 0
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $479
+LABELV $481
+ADDRGP4 $482
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $478
+JUMPV
+LABELV $479
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+RETP4
+LABELV $478
+endproc G_GetBotInfoByNumber 8 8
+export G_GetBotInfoByName
+proc G_GetBotInfoByName 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $487
+JUMPV
+LABELV $484
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $133
+ARGP4
+ADDRLP4 8
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $488
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_botInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $483
+JUMPV
+LABELV $488
+LABELV $485
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $487
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numBots
+INDIRI4
+LTI4 $484
+CNSTP4 0
+RETP4
+LABELV $483
+endproc G_GetBotInfoByName 16 8
+export G_InitBots
+proc G_InitBots 1148 16
+ADDRGP4 G_LoadBots
+CALLV
+pop
+ADDRGP4 G_LoadArenas
+CALLV
+pop
+ADDRGP4 bot_minplayers
+ARGP4
+ADDRGP4 $491
+ARGP4
+ADDRGP4 $492
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $493
+ADDRLP4 80
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRLP4 80
+ARGP4
+ADDRGP4 $496
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 1108
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 1112
+ADDRGP4 G_GetArenaInfoByMap
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1112
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $497
+ADDRGP4 $490
+JUMPV
+LABELV $497
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $499
+ARGP4
+ADDRLP4 1116
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1116
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1120
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1120
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $500
+ADDRGP4 $499
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $501
+JUMPV
+LABELV $500
+ADDRGP4 $499
+ARGP4
+ADDRGP4 $492
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $501
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $502
+ARGP4
+ADDRLP4 1124
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1124
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1128
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 1128
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $503
+ADDRGP4 $502
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $504
+JUMPV
+LABELV $503
+ADDRGP4 $502
+ARGP4
+ADDRGP4 $492
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $504
+ADDRLP4 1132
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1132
+INDIRI4
+NEI4 $505
+ADDRLP4 12
+INDIRI4
+ADDRLP4 1132
+INDIRI4
+NEI4 $505
+ADDRGP4 $499
+ARGP4
+ADDRGP4 $507
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $502
+ARGP4
+ADDRGP4 $492
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $505
+ADDRLP4 1104
+CNSTI4 2000
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $508
+ARGP4
+ADDRLP4 1136
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1136
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $511
+ARGP4
+ADDRLP4 1140
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1140
+INDIRI4
+CNSTI4 0
+NEI4 $509
+ADDRLP4 1104
+ADDRLP4 1104
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+LABELV $509
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $512
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $514
+ARGP4
+ADDRLP4 1144
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+ADDRLP4 1104
+INDIRI4
+ARGI4
+ADDRGP4 G_SpawnBots
+CALLV
+pop
+LABELV $512
+LABELV $493
+LABELV $490
+endproc G_InitBots 1148 16
+import podium3
+import podium2
+import podium1
+bss
+export bot_minplayers
+align 4
+LABELV bot_minplayers
+skip 272
+align 4
+LABELV botSpawnQueue
+skip 128
+align 4
+LABELV g_arenaInfos
+skip 4096
+export g_numArenas
+align 4
+LABELV g_numArenas
+skip 4
+align 4
+LABELV g_botInfos
+skip 4096
+align 4
+LABELV g_numBots
+skip 4
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import DeathmatchScoreboardMessage
+import G_SetStats
+import MoveClientToIntermission
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import G_RunMissile
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $514
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $511
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $508
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $507
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $502
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $499
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $496
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $492
+byte 1 48
+byte 1 0
+align 1
+LABELV $491
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $482
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $477
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $472
+byte 1 46
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $471
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $466
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $457
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $439
+byte 1 49
+byte 1 0
+align 1
+LABELV $435
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 54
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 54
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $434
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 95
+byte 1 99
+byte 1 46
+byte 1 99
+byte 1 0
+align 1
+LABELV $427
+byte 1 85
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $420
+byte 1 94
+byte 1 49
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $418
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $417
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $408
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 60
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 62
+byte 1 32
+byte 1 91
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 49
+byte 1 45
+byte 1 53
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 93
+byte 1 32
+byte 1 91
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 93
+byte 1 10
+byte 1 0
+align 1
+LABELV $405
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $397
+byte 1 37
+byte 1 53
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 0
+align 1
+LABELV $388
+byte 1 94
+byte 1 49
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 39
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 39
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 40
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 41
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $387
+byte 1 94
+byte 1 49
+byte 1 85
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 46
+byte 1 32
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $384
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 97
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $381
+byte 1 97
+byte 1 105
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $380
+byte 1 53
+byte 1 0
+align 1
+LABELV $377
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $376
+byte 1 52
+byte 1 0
+align 1
+LABELV $373
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $372
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $371
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $368
+byte 1 103
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $367
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $364
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $363
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $362
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $359
+byte 1 57
+byte 1 48
+byte 1 0
+align 1
+LABELV $356
+byte 1 55
+byte 1 48
+byte 1 0
+align 1
+LABELV $353
+byte 1 53
+byte 1 48
+byte 1 0
+align 1
+LABELV $352
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $349
+byte 1 37
+byte 1 49
+byte 1 46
+byte 1 50
+byte 1 102
+byte 1 0
+align 1
+LABELV $348
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $347
+byte 1 115
+byte 1 110
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $346
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $345
+byte 1 114
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $340
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $339
+byte 1 94
+byte 1 49
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $335
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 65
+byte 1 73
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 112
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $331
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $329
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $327
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $317
+byte 1 94
+byte 1 51
+byte 1 85
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 10
+byte 1 0
+align 1
+LABELV $306
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $199
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 107
+byte 1 105
+byte 1 99
+byte 1 107
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $184
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $182
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $179
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $176
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $133
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $127
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 32
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 10
+byte 1 0
+align 1
+LABELV $126
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $120
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $112
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $111
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $106
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $105
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $100
+byte 1 46
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $99
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $98
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $93
+byte 1 0
+align 1
+LABELV $92
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $90
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $87
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $81
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $80
+byte 1 92
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 92
+byte 1 0
+align 1
+LABELV $79
+byte 1 60
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 62
+byte 1 0
+align 1
+LABELV $76
+byte 1 125
+byte 1 0
+align 1
+LABELV $73
+byte 1 85
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $67
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $64
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 123
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $63
+byte 1 123
+byte 1 0
@@ -0,0 +1,6159 @@
+data
+align 4
+LABELV playerMins
+byte 4 3245342720
+byte 4 3245342720
+byte 4 3250585600
+align 4
+LABELV playerMaxs
+byte 4 1097859072
+byte 4 1097859072
+byte 4 1107296256
+export SP_info_player_deathmatch
+code
+proc SP_info_player_deathmatch 8 12
+ADDRGP4 $54
+ARGP4
+ADDRGP4 $55
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $56
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+LABELV $56
+ADDRGP4 $58
+ARGP4
+ADDRGP4 $55
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $59
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $59
+LABELV $53
+endproc SP_info_player_deathmatch 8 12
+export SP_info_player_start
+proc SP_info_player_start 0 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $62
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SP_info_player_deathmatch
+CALLV
+pop
+LABELV $61
+endproc SP_info_player_start 0 4
+export SP_info_player_intermission
+proc SP_info_player_intermission 0 0
+LABELV $63
+endproc SP_info_player_intermission 0 0
+export SpotWouldTelefrag
+proc SpotWouldTelefrag 4144 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4108
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRGP4 playerMins
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRGP4 playerMins+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRGP4 playerMins+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4120
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRGP4 playerMaxs
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4120+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRGP4 playerMaxs+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4120+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRGP4 playerMaxs+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4108
+ARGP4
+ADDRLP4 4120
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4140
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 4140
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $76
+JUMPV
+LABELV $73
+ADDRLP4 4
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $77
+CNSTI4 1
+RETI4
+ADDRGP4 $64
+JUMPV
+LABELV $77
+LABELV $74
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $76
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $73
+CNSTI4 0
+RETI4
+LABELV $64
+endproc SpotWouldTelefrag 4144 16
+export SelectNearestDeathmatchSpawnPoint
+proc SelectNearestDeathmatchSpawnPoint 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTF4 1232348144
+ASGNF4
+ADDRLP4 28
+CNSTP4 0
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRGP4 $81
+JUMPV
+LABELV $80
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 40
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GEF4 $85
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $85
+LABELV $81
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $62
+ARGP4
+ADDRLP4 32
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $80
+ADDRLP4 24
+INDIRP4
+RETP4
+LABELV $79
+endproc SelectNearestDeathmatchSpawnPoint 44 12
+export SelectRandomDeathmatchSpawnPoint
+proc SelectRandomDeathmatchSpawnPoint 532 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $89
+JUMPV
+LABELV $88
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 524
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 524
+INDIRI4
+CNSTI4 0
+EQI4 $91
+ADDRGP4 $89
+JUMPV
+LABELV $91
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $89
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $62
+ARGP4
+ADDRLP4 524
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 524
+INDIRP4
+ASGNP4
+ADDRLP4 524
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $88
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $93
+CNSTP4 0
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $62
+ARGP4
+ADDRLP4 528
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 528
+INDIRP4
+RETP4
+ADDRGP4 $87
+JUMPV
+LABELV $93
+ADDRLP4 528
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 520
+ADDRLP4 528
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+INDIRP4
+RETP4
+LABELV $87
+endproc SelectRandomDeathmatchSpawnPoint 532 12
+export SelectRandomFurthestSpawnPoint
+proc SelectRandomFurthestSpawnPoint 572 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 520
+CNSTI4 0
+ASGNI4
+ADDRLP4 528
+CNSTP4 0
+ASGNP4
+ADDRGP4 $97
+JUMPV
+LABELV $96
+ADDRLP4 528
+INDIRP4
+ARGP4
+ADDRLP4 548
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 548
+INDIRI4
+CNSTI4 0
+EQI4 $99
+ADDRGP4 $97
+JUMPV
+LABELV $99
+ADDRLP4 532
+ADDRLP4 528
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 532+4
+ADDRLP4 528
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 532+8
+ADDRLP4 528
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 532
+ARGP4
+ADDRLP4 560
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 524
+ADDRLP4 560
+INDIRF4
+ASGNF4
+ADDRLP4 516
+CNSTI4 0
+ASGNI4
+ADDRGP4 $106
+JUMPV
+LABELV $103
+ADDRLP4 524
+INDIRF4
+ADDRLP4 516
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+LEF4 $107
+ADDRLP4 520
+INDIRI4
+CNSTI4 64
+LTI4 $109
+ADDRLP4 520
+CNSTI4 63
+ASGNI4
+LABELV $109
+ADDRLP4 0
+ADDRLP4 520
+INDIRI4
+ASGNI4
+ADDRGP4 $114
+JUMPV
+LABELV $111
+ADDRLP4 564
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 564
+INDIRI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 564
+INDIRI4
+ADDRLP4 4-4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 568
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 568
+INDIRI4
+ADDRLP4 260
+ADDP4
+ADDRLP4 568
+INDIRI4
+ADDRLP4 260-4
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $112
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $114
+ADDRLP4 0
+INDIRI4
+ADDRLP4 516
+INDIRI4
+GTI4 $111
+ADDRLP4 516
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 524
+INDIRF4
+ASGNF4
+ADDRLP4 516
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 260
+ADDP4
+ADDRLP4 528
+INDIRP4
+ASGNP4
+ADDRLP4 520
+ADDRLP4 520
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 520
+INDIRI4
+CNSTI4 64
+LEI4 $105
+ADDRLP4 520
+CNSTI4 64
+ASGNI4
+ADDRGP4 $105
+JUMPV
+LABELV $107
+LABELV $104
+ADDRLP4 516
+ADDRLP4 516
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $106
+ADDRLP4 516
+INDIRI4
+ADDRLP4 520
+INDIRI4
+LTI4 $103
+LABELV $105
+ADDRLP4 516
+INDIRI4
+ADDRLP4 520
+INDIRI4
+LTI4 $119
+ADDRLP4 520
+INDIRI4
+CNSTI4 64
+GEI4 $119
+ADDRLP4 520
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+ADDRLP4 524
+INDIRF4
+ASGNF4
+ADDRLP4 520
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 260
+ADDP4
+ADDRLP4 528
+INDIRP4
+ASGNP4
+ADDRLP4 520
+ADDRLP4 520
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $119
+LABELV $97
+ADDRLP4 528
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $62
+ARGP4
+ADDRLP4 548
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 528
+ADDRLP4 548
+INDIRP4
+ASGNP4
+ADDRLP4 548
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $96
+ADDRLP4 520
+INDIRI4
+CNSTI4 0
+NEI4 $121
+CNSTP4 0
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $62
+ARGP4
+ADDRLP4 552
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 528
+ADDRLP4 552
+INDIRP4
+ASGNP4
+ADDRLP4 528
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $123
+ADDRGP4 $125
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $123
+ADDRFP4 4
+INDIRP4
+ADDRLP4 528
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 556
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 556
+INDIRP4
+ADDRLP4 556
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 528
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 528
+INDIRP4
+RETP4
+ADDRGP4 $95
+JUMPV
+LABELV $121
+ADDRLP4 552
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 556
+CNSTI4 2
+ASGNI4
+ADDRLP4 544
+ADDRLP4 552
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+ADDRLP4 520
+INDIRI4
+ADDRLP4 556
+INDIRI4
+DIVI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 544
+INDIRI4
+ADDRLP4 556
+INDIRI4
+LSHI4
+ADDRLP4 260
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 560
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 560
+INDIRP4
+ADDRLP4 560
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 544
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 260
+ADDP4
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 544
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 260
+ADDP4
+INDIRP4
+RETP4
+LABELV $95
+endproc SelectRandomFurthestSpawnPoint 572 12
+export SelectSpawnPoint
+proc SelectSpawnPoint 4 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 SelectRandomFurthestSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $126
+endproc SelectSpawnPoint 4 12
+export SelectInitialSpawnPoint
+proc SelectInitialSpawnPoint 20 12
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $129
+JUMPV
+LABELV $128
+ADDRLP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $131
+ADDRGP4 $130
+JUMPV
+LABELV $131
+LABELV $129
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $62
+ARGP4
+ADDRLP4 4
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $128
+LABELV $130
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $135
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $133
+LABELV $135
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 SelectSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+RETP4
+ADDRGP4 $127
+JUMPV
+LABELV $133
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $127
+endproc SelectInitialSpawnPoint 20 12
+export SelectSpectatorSpawnPoint
+proc SelectSpectatorSpawnPoint 0 0
+ADDRGP4 FindIntermissionPoint
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ADDRGP4 level+9144
+INDIRB
+ASGNB 12
+ADDRFP4 4
+INDIRP4
+ADDRGP4 level+9156
+INDIRB
+ASGNB 12
+CNSTP4 0
+RETP4
+LABELV $136
+endproc SelectSpectatorSpawnPoint 0 0
+export InitBodyQue
+proc InitBodyQue 12 0
+ADDRGP4 level+9176
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $141
+ADDRLP4 8
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $145
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9180
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $142
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $141
+LABELV $139
+endproc InitBodyQue 12 0
+export BodySink
+proc BodySink 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 6500
+LEI4 $148
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $147
+JUMPV
+LABELV $148
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+LABELV $147
+endproc BodySink 4 4
+export CopyToBodyQue
+proc CopyToBodyQue 48 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+EQU4 $153
+ADDRGP4 $152
+JUMPV
+LABELV $153
+ADDRLP4 0
+ADDRGP4 level+9176
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+9180
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 level+9176
+ADDRGP4 level+9176
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 8
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 208
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 808
+DIVI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 568
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 1023
+NEI4 $160
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $161
+JUMPV
+LABELV $160
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $161
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $163
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+GTI4 $163
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $169
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $169
+address $166
+address $166
+address $167
+address $167
+address $168
+address $168
+code
+LABELV $166
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $164
+JUMPV
+LABELV $167
+ADDRLP4 36
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $164
+JUMPV
+LABELV $168
+LABELV $163
+ADDRLP4 44
+CNSTI4 5
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $164
+ADDRLP4 24
+CNSTI4 424
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 436
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+CNSTI4 448
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 36
+CNSTI4 464
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 40
+CNSTI4 476
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+CNSTI4 65537
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 67108864
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRGP4 BodySink
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRGP4 body_die
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 -40
+GTI4 $171
+ADDRLP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $172
+JUMPV
+LABELV $171
+ADDRLP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $172
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $152
+endproc CopyToBodyQue 48 8
+export SetClientViewAngle
+proc SetClientViewAngle 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $174
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+CNSTF4 1199570944
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+CNSTI4 476
+ADDP4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $175
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $174
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $173
+endproc SetClientViewAngle 16 0
+export respawn
+proc respawn 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CopyToBodyQue
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientSpawn
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTI4 42
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 168
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $178
+endproc respawn 12 8
+export TeamCount
+proc TeamCount 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $183
+JUMPV
+LABELV $180
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $185
+ADDRGP4 $181
+JUMPV
+LABELV $185
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $187
+ADDRGP4 $181
+JUMPV
+LABELV $187
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $189
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $189
+LABELV $181
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $183
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $180
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $179
+endproc TeamCount 8 0
+export TeamLeader
+proc TeamLeader 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $195
+JUMPV
+LABELV $192
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $197
+ADDRGP4 $193
+JUMPV
+LABELV $197
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $199
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 640
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $201
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $191
+JUMPV
+LABELV $201
+LABELV $199
+LABELV $193
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $195
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $192
+CNSTI4 -1
+RETI4
+LABELV $191
+endproc TeamLeader 4 0
+export PickTeam
+proc PickTeam 24 8
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 0+8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0+8
+INDIRI4
+ADDRLP4 0+4
+INDIRI4
+LEI4 $206
+CNSTI4 1
+RETI4
+ADDRGP4 $203
+JUMPV
+LABELV $206
+ADDRLP4 0+4
+INDIRI4
+ADDRLP4 0+8
+INDIRI4
+LEI4 $210
+CNSTI4 2
+RETI4
+ADDRGP4 $203
+JUMPV
+LABELV $210
+ADDRGP4 level+44+8
+INDIRI4
+ADDRGP4 level+44+4
+INDIRI4
+LEI4 $214
+CNSTI4 1
+RETI4
+ADDRGP4 $203
+JUMPV
+LABELV $214
+CNSTI4 2
+RETI4
+LABELV $203
+endproc PickTeam 24 8
+proc ClientCleanName 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $222
+JUMPV
+LABELV $221
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $224
+ADDRGP4 $223
+JUMPV
+LABELV $224
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $226
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $226
+ADDRGP4 $222
+JUMPV
+LABELV $226
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $228
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $230
+ADDRGP4 $223
+JUMPV
+LABELV $230
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CNSTI4 7
+BANDI4
+CNSTI4 0
+NEI4 $232
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $222
+JUMPV
+LABELV $232
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+SUBI4
+LEI4 $234
+ADDRGP4 $223
+JUMPV
+LABELV $234
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 0
+INDIRI1
+ASGNI1
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 36
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+ASGNI4
+ADDRGP4 $222
+JUMPV
+LABELV $228
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 32
+NEI4 $236
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+LEI4 $238
+ADDRGP4 $222
+JUMPV
+LABELV $238
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 0
+INDIRI1
+ASGNI1
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $222
+JUMPV
+LABELV $236
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+LEI4 $240
+ADDRGP4 $223
+JUMPV
+LABELV $240
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 28
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 0
+INDIRI1
+ASGNI1
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $222
+ADDRGP4 $221
+JUMPV
+LABELV $223
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+EQI4 $244
+ADDRLP4 8
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $242
+LABELV $244
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $245
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $242
+LABELV $220
+endproc ClientCleanName 44 12
+export ClientUserinfoChanged
+proc ClientUserinfoChanged 6392 56
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+CNSTI4 808
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 6304
+ADDRGP4 Info_Validate
+CALLI4
+ASGNI4
+ADDRLP4 6304
+INDIRI4
+CNSTI4 0
+NEI4 $247
+ADDRLP4 4
+ARGP4
+ADDRGP4 $249
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $247
+ADDRLP4 4
+ARGP4
+ADDRGP4 $250
+ARGP4
+ADDRLP4 6308
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 6308
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 6312
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 6312
+INDIRI4
+CNSTI4 0
+NEI4 $251
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $251
+ADDRLP4 4
+ARGP4
+ADDRGP4 $254
+ARGP4
+ADDRLP4 6316
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 6316
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 6320
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 6320
+INDIRI4
+CNSTI4 0
+NEI4 $255
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $256
+JUMPV
+LABELV $255
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $256
+ADDRLP4 1164
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $257
+ARGP4
+ADDRLP4 6324
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 6324
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 ClientCleanName
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $258
+ADDRLP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $260
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 $262
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $260
+LABELV $258
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $263
+ADDRLP4 1164
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 6328
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 6328
+INDIRI4
+CNSTI4 0
+EQI4 $265
+ADDRGP4 $267
+ARGP4
+ADDRLP4 1164
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 6332
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 6332
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $265
+LABELV $263
+ADDRLP4 4
+ARGP4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 6328
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 6328
+INDIRP4
+ARGP4
+ADDRLP4 6332
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 2196
+ADDRLP4 6332
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRLP4 2196
+INDIRI4
+ASGNI4
+ADDRLP4 6336
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 6336
+INDIRI4
+CNSTI4 1
+LTI4 $271
+ADDRLP4 6336
+INDIRI4
+CNSTI4 100
+LEI4 $269
+LABELV $271
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+CNSTI4 100
+ASGNI4
+LABELV $269
+ADDRLP4 0
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $272
+ADDRLP4 4
+ARGP4
+ADDRGP4 $275
+ARGP4
+ADDRLP4 6344
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 6344
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $276
+ARGP4
+ADDRLP4 6348
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1100
+ARGP4
+ADDRLP4 6348
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $273
+JUMPV
+LABELV $272
+ADDRLP4 4
+ARGP4
+ADDRGP4 $277
+ARGP4
+ADDRLP4 6344
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 6344
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $278
+ARGP4
+ADDRLP4 6348
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1100
+ARGP4
+ADDRLP4 6348
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $273
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $279
+CNSTI4 808
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $279
+ADDRLP4 4
+ARGP4
+ADDRGP4 $284
+ARGP4
+ADDRLP4 6344
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 6344
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 $287
+ARGP4
+ADDRLP4 6348
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 6348
+INDIRI4
+CNSTI4 0
+EQI4 $289
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 $288
+ARGP4
+ADDRLP4 6352
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 6352
+INDIRI4
+CNSTI4 0
+NEI4 $285
+LABELV $289
+ADDRLP4 4248
+CNSTI4 1
+ASGNI4
+ADDRGP4 $280
+JUMPV
+LABELV $285
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 $292
+ARGP4
+ADDRLP4 6356
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 6356
+INDIRI4
+CNSTI4 0
+EQI4 $294
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 $293
+ARGP4
+ADDRLP4 6360
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 6360
+INDIRI4
+CNSTI4 0
+NEI4 $290
+LABELV $294
+ADDRLP4 4248
+CNSTI4 2
+ASGNI4
+ADDRGP4 $280
+JUMPV
+LABELV $290
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 6364
+ADDRGP4 PickTeam
+CALLI4
+ASGNI4
+ADDRLP4 4248
+ADDRLP4 6364
+INDIRI4
+ASGNI4
+ADDRGP4 $280
+JUMPV
+LABELV $279
+ADDRLP4 4248
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $280
+ADDRLP4 4
+ARGP4
+ADDRGP4 $295
+ARGP4
+ADDRLP4 6344
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 6344
+INDIRP4
+ASGNP4
+ADDRLP4 1028
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $298
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 6352
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 6352
+INDIRI4
+CNSTI4 0
+EQI4 $296
+LABELV $298
+ADDRLP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $297
+JUMPV
+LABELV $296
+ADDRLP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $297
+ADDRLP4 4
+ARGP4
+ADDRGP4 $299
+ARGP4
+ADDRLP4 6356
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 6356
+INDIRP4
+ARGP4
+ADDRLP4 6360
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 2188
+ADDRLP4 6360
+INDIRI4
+ASGNI4
+ADDRLP4 2192
+ADDRLP4 0
+INDIRP4
+CNSTI4 640
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $300
+ARGP4
+ADDRLP4 6364
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 2200
+ARGP4
+ADDRLP4 6364
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $301
+ARGP4
+ADDRLP4 6368
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 3224
+ARGP4
+ADDRLP4 6368
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $302
+ARGP4
+ADDRLP4 6372
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4252
+ARGP4
+ADDRLP4 6372
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $303
+ARGP4
+ADDRLP4 6376
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 5276
+ARGP4
+ADDRLP4 6376
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 1032
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $304
+ADDRLP4 4
+ARGP4
+ADDRGP4 $307
+ARGP4
+ADDRLP4 6380
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 $306
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4248
+INDIRI4
+ARGI4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1100
+ARGP4
+ADDRLP4 2200
+ARGP4
+ADDRLP4 3224
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 6380
+INDIRP4
+ARGP4
+ADDRLP4 2188
+INDIRI4
+ARGI4
+ADDRLP4 2192
+INDIRI4
+ARGI4
+ADDRLP4 6388
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 6388
+INDIRP4
+ASGNP4
+ADDRGP4 $305
+JUMPV
+LABELV $304
+ADDRGP4 $308
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1036
+ARGP4
+ADDRLP4 1100
+ARGP4
+ADDRLP4 4252
+ARGP4
+ADDRLP4 5276
+ARGP4
+ADDRLP4 2200
+ARGP4
+ADDRLP4 3224
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 2188
+INDIRI4
+ARGI4
+ADDRLP4 2192
+INDIRI4
+ARGI4
+ADDRLP4 6384
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1028
+ADDRLP4 6384
+INDIRP4
+ASGNP4
+LABELV $305
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $309
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $246
+endproc ClientUserinfoChanged 6392 56
+export ClientConnect
+proc ClientConnect 1068 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1032
+CNSTI4 808
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 $250
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1040
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 G_FilterPacket
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $311
+ADDRGP4 $313
+RETP4
+ADDRGP4 $310
+JUMPV
+LABELV $311
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $314
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+EQI4 $314
+ADDRLP4 8
+ARGP4
+ADDRGP4 $316
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1052
+INDIRP4
+ASGNP4
+ADDRGP4 g_password+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $317
+ADDRGP4 g_password+16
+ARGP4
+ADDRGP4 $321
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $317
+ADDRGP4 g_password+16
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1060
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $317
+ADDRGP4 $323
+RETP4
+ADDRGP4 $310
+JUMPV
+LABELV $317
+LABELV $314
+ADDRLP4 1032
+INDIRP4
+CNSTI4 516
+ADDP4
+CNSTI4 776
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1032
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 776
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 1052
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+NEI4 $327
+ADDRGP4 level+64
+INDIRI4
+ADDRLP4 1052
+INDIRI4
+EQI4 $324
+LABELV $327
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 G_InitSessionData
+CALLV
+pop
+LABELV $324
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_ReadSessionData
+CALLV
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $328
+ADDRLP4 1056
+ADDRLP4 1032
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 1056
+INDIRP4
+ADDRLP4 1056
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRLP4 1032
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $333
+ADDRLP4 1060
+CNSTI4 1
+ASGNI4
+ADDRGP4 $334
+JUMPV
+LABELV $333
+ADDRLP4 1060
+CNSTI4 0
+ASGNI4
+LABELV $334
+ADDRLP4 1060
+INDIRI4
+ARGI4
+ADDRLP4 1064
+ADDRGP4 G_BotConnect
+CALLI4
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+CNSTI4 0
+NEI4 $330
+ADDRGP4 $335
+RETP4
+ADDRGP4 $310
+JUMPV
+LABELV $330
+LABELV $328
+ADDRGP4 $336
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $337
+ADDRGP4 $339
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1056
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $337
+ADDRLP4 1056
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+LTI4 $340
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+EQI4 $340
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 BroadcastTeamChange
+CALLV
+pop
+LABELV $340
+ADDRGP4 CalculateRanks
+CALLV
+pop
+CNSTP4 0
+RETP4
+LABELV $310
+endproc ClientConnect 1068 12
+export ClientBegin
+proc ClientBegin 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 808
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 776
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $344
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+LABELV $344
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_InitGentity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 704
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 712
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 468
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 ClientSpawn
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $347
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTI4 42
+ARGI4
+ADDRLP4 24
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 168
+ASGNI4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+EQI4 $349
+ADDRGP4 $352
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $349
+LABELV $347
+ADDRGP4 $353
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 CalculateRanks
+CALLV
+pop
+LABELV $343
+endproc ClientBegin 36 12
+export ClientSpawn
+proc ClientSpawn 1388 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 100
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 808
+DIVI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $355
+ADDRLP4 76
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 1328
+ADDRGP4 SelectSpectatorSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 1328
+INDIRP4
+ASGNP4
+ADDRGP4 $356
+JUMPV
+LABELV $355
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+LTI4 $357
+ADDRLP4 4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 1332
+ADDRGP4 SelectCTFSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 1332
+INDIRP4
+ASGNP4
+ADDRGP4 $358
+JUMPV
+LABELV $357
+LABELV $360
+ADDRLP4 1332
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRI4
+ADDRLP4 1332
+INDIRI4
+NEI4 $363
+ADDRLP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRI4
+ADDRLP4 1332
+INDIRI4
+EQI4 $363
+ADDRLP4 4
+INDIRP4
+CNSTI4 500
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 76
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 1336
+ADDRGP4 SelectInitialSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 1336
+INDIRP4
+ASGNP4
+ADDRGP4 $364
+JUMPV
+LABELV $363
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 1336
+ADDRGP4 SelectSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 1336
+INDIRP4
+ASGNP4
+LABELV $364
+ADDRLP4 1336
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 8192
+BANDI4
+ADDRLP4 1336
+INDIRI4
+EQI4 $365
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 1336
+INDIRI4
+EQI4 $365
+ADDRGP4 $361
+JUMPV
+LABELV $365
+ADDRLP4 1340
+CNSTI4 0
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 16384
+BANDI4
+ADDRLP4 1340
+INDIRI4
+EQI4 $362
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+ADDRLP4 1340
+INDIRI4
+NEI4 $362
+LABELV $361
+ADDRGP4 $360
+JUMPV
+LABELV $362
+LABELV $358
+LABELV $356
+ADDRLP4 4
+INDIRP4
+CNSTI4 556
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 1328
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 1328
+INDIRP4
+ADDRLP4 1328
+INDIRP4
+INDIRI4
+CNSTI4 -513
+BANDI4
+ASGNI4
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+INDIRI4
+CNSTI4 540676
+BANDI4
+ASGNI4
+ADDRLP4 104
+ADDRLP4 104
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+ADDRLP4 1132
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRB
+ASGNB 148
+ADDRLP4 1280
+ADDRLP4 4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRB
+ASGNB 28
+ADDRLP4 1308
+ADDRLP4 4
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1312
+ADDRLP4 4
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1316
+ADDRLP4 4
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $369
+ADDRLP4 1336
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1336
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 1336
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $370
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $369
+ADDRLP4 1320
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 776
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+ADDRLP4 1132
+INDIRB
+ASGNB 148
+ADDRLP4 4
+INDIRP4
+CNSTI4 616
+ADDP4
+ADDRLP4 1280
+INDIRB
+ASGNB 28
+ADDRLP4 4
+INDIRP4
+CNSTI4 452
+ADDP4
+ADDRLP4 1308
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRLP4 1312
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 712
+ADDP4
+ADDRLP4 1316
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 720
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $373
+ADDRLP4 1340
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 1340
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+ADDP4
+ADDRLP4 1340
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $374
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $373
+ADDRLP4 4
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRLP4 1320
+INDIRI4
+ASGNI4
+ADDRLP4 1340
+ADDRLP4 4
+INDIRP4
+CNSTI4 264
+ADDP4
+ASGNP4
+ADDRLP4 1340
+INDIRP4
+ADDRLP4 1340
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 260
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 748
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 12000
+ADDI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+ARGI4
+ADDRLP4 108
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetUserinfo
+CALLV
+pop
+ADDRLP4 108
+ARGP4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 1348
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1348
+INDIRP4
+ARGP4
+ADDRLP4 1352
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 548
+ADDP4
+ADDRLP4 1352
+INDIRI4
+ASGNI4
+ADDRLP4 1356
+ADDRLP4 4
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1356
+INDIRI4
+CNSTI4 1
+LTI4 $380
+ADDRLP4 1356
+INDIRI4
+CNSTI4 100
+LEI4 $378
+LABELV $380
+ADDRLP4 4
+INDIRP4
+CNSTI4 548
+ADDP4
+CNSTI4 100
+ASGNI4
+LABELV $378
+ADDRLP4 4
+INDIRP4
+CNSTI4 208
+ADDP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 548
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 1023
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+CNSTI4 776
+ADDRLP4 100
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $381
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 33554432
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+CNSTI4 33619969
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRGP4 player_die
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 788
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 784
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRGP4 playerMins
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ADDRGP4 playerMaxs
+INDIRB
+ASGNB 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+NEI4 $382
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 50
+ASGNI4
+ADDRGP4 $383
+JUMPV
+LABELV $382
+ADDRLP4 4
+INDIRP4
+CNSTI4 384
+ADDP4
+CNSTI4 100
+ASGNI4
+LABELV $383
+ADDRLP4 1364
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+ASGNP4
+ADDRLP4 1364
+INDIRP4
+ADDRLP4 1364
+INDIRP4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 380
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 416
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 1372
+ADDRLP4 4
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+CNSTI4 25
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 1372
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRLP4 1372
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 G_SetOrigin
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 76
+INDIRB
+ASGNB 12
+ADDRLP4 1376
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 1376
+INDIRP4
+ADDRLP4 1376
+INDIRP4
+INDIRI4
+CNSTI4 512
+BORI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 776
+DIVI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 472
+ADDP4
+ARGP4
+ADDRGP4 trap_GetUsercmd
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRGP4 SetClientViewAngle
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $385
+ADDRGP4 $386
+JUMPV
+LABELV $385
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_KillBox
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $386
+ADDRLP4 1380
+ADDRLP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 1380
+INDIRP4
+ADDRLP4 1380
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTI4 100
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 736
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+ADDRGP4 g_inactivity+12
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 664
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 84
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 76
+ADDP4
+CNSTI4 22
+ASGNI4
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $390
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 MoveClientToIntermission
+CALLV
+pop
+ADDRGP4 $391
+JUMPV
+LABELV $390
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_UseTargets
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+CNSTI4 10
+ASGNI4
+LABELV $393
+ADDRLP4 4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+EQI4 $397
+ADDRLP4 4
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $395
+JUMPV
+LABELV $397
+LABELV $394
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $393
+LABELV $395
+LABELV $391
+ADDRLP4 4
+INDIRP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 100
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 472
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 808
+DIVI4
+ARGI4
+ADDRGP4 ClientThink
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $401
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $401
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientEndFrame
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 BG_PlayerStateToEntityState
+CALLV
+pop
+LABELV $354
+endproc ClientSpawn 1388 16
+export ClientDisconnect
+proc ClientDisconnect 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_RemoveQueuedBotBegin
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 808
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $404
+ADDRGP4 $403
+JUMPV
+LABELV $404
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $409
+JUMPV
+LABELV $406
+ADDRLP4 12
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $411
+ADDRLP4 12
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $411
+ADDRLP4 12
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $411
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 StopFollowing
+CALLV
+pop
+LABELV $411
+LABELV $407
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $409
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $406
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $413
+ADDRLP4 12
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $413
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ARGP4
+CNSTI4 43
+ARGI4
+ADDRLP4 16
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 168
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 TossClientItems
+CALLV
+pop
+LABELV $413
+ADDRGP4 $415
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $416
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+9128
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $416
+ADDRGP4 level+16
+INDIRI4
+ADDRLP4 16
+INDIRI4
+NEI4 $416
+ADDRGP4 level+84+4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $416
+ADDRLP4 20
+CNSTI4 776
+ADDRGP4 level+84
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 632
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 level+84
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $416
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $425
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $425
+ADDRGP4 level+9128
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $425
+CNSTI4 2
+ARGI4
+ADDRGP4 $429
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9132
+CNSTP4 0
+ASGNP4
+ADDRGP4 level+9128
+CNSTI4 0
+ASGNI4
+LABELV $425
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $433
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 260
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 544
+ADDI4
+ARGI4
+ADDRGP4 $434
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 CalculateRanks
+CALLV
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $435
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 BotAIShutdownClient
+CALLI4
+pop
+LABELV $435
+LABELV $403
+endproc ClientDisconnect 24 8
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import DeathmatchScoreboardMessage
+import G_SetStats
+import MoveClientToIntermission
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import CalculateRanks
+import AddScore
+import player_die
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import G_RunMissile
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $434
+byte 1 0
+align 1
+LABELV $433
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $429
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $415
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $381
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $353
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 66
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $352
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $339
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $336
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $335
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 67
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $323
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $321
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $316
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $313
+byte 1 89
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $309
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 67
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $308
+byte 1 110
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 116
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 49
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 50
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 104
+byte 1 99
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 119
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 116
+byte 1 116
+byte 1 92
+byte 1 37
+byte 1 100
+byte 1 92
+byte 1 116
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $307
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $306
+byte 1 110
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 116
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 49
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 99
+byte 1 50
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 104
+byte 1 99
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 119
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 105
+byte 1 92
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 116
+byte 1 116
+byte 1 92
+byte 1 37
+byte 1 100
+byte 1 92
+byte 1 116
+byte 1 108
+byte 1 92
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $303
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $302
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $301
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $300
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $299
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 116
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $295
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $293
+byte 1 98
+byte 1 0
+align 1
+LABELV $292
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $288
+byte 1 114
+byte 1 0
+align 1
+LABELV $287
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $284
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $278
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $277
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $276
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $275
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $268
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $267
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $262
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 111
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $257
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $254
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 116
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $253
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $250
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $249
+byte 1 92
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 92
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $245
+byte 1 85
+byte 1 110
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $145
+byte 1 98
+byte 1 111
+byte 1 100
+byte 1 121
+byte 1 113
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $125
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $62
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $58
+byte 1 110
+byte 1 111
+byte 1 104
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $55
+byte 1 48
+byte 1 0
+align 1
+LABELV $54
+byte 1 110
+byte 1 111
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
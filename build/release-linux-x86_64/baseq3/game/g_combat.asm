@@ -0,0 +1,5706 @@
+export ScorePlum
+code
+proc ScorePlum 12 8
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 65
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 256
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 428
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $53
+endproc ScorePlum 12 8
+export AddScore
+proc AddScore 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $55
+ADDRGP4 $54
+JUMPV
+LABELV $55
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+EQI4 $57
+ADDRGP4 $54
+JUMPV
+LABELV $57
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 ScorePlum
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+NEI4 $60
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 260
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $60
+ADDRGP4 CalculateRanks
+CALLV
+pop
+LABELV $54
+endproc AddScore 8 12
+export TossClientItems
+proc TossClientItems 40 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $67
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+NEI4 $65
+LABELV $67
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $68
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRU1
+CVUI4 1
+ASGNI4
+LABELV $68
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+CNSTI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+BANDI4
+CNSTI4 0
+NEI4 $70
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $70
+LABELV $65
+ADDRLP4 28
+CNSTI4 2
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LEI4 $72
+ADDRLP4 12
+INDIRI4
+CNSTI4 10
+EQI4 $72
+ADDRLP4 12
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 376
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $72
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 BG_FindItemForWeapon
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 Drop_Item
+CALLP4
+pop
+LABELV $72
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+EQI4 $74
+ADDRLP4 16
+CNSTF4 1110704128
+ASGNF4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $77
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+LEI4 $81
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 BG_FindItemForPowerup
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $84
+ADDRGP4 $78
+JUMPV
+LABELV $84
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Drop_Item
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+SUBI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRI4
+CNSTI4 1
+GEI4 $87
+ADDRLP4 4
+INDIRP4
+CNSTI4 760
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $87
+ADDRLP4 16
+ADDRLP4 16
+INDIRF4
+CNSTF4 1110704128
+ADDF4
+ASGNF4
+LABELV $81
+LABELV $78
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $77
+LABELV $74
+LABELV $64
+endproc TossClientItems 40 12
+export LookAtKiller
+proc LookAtKiller 52 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 24
+INDIRU4
+CNSTU4 0
+EQU4 $90
+ADDRLP4 24
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $90
+ADDRLP4 32
+CNSTI4 24
+ASGNI4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 28
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 32
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $91
+JUMPV
+LABELV $90
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 28
+INDIRU4
+CNSTU4 0
+EQU4 $94
+ADDRLP4 28
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $94
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 24
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 28
+ASGNI4
+ADDRLP4 0+4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 32
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $95
+JUMPV
+LABELV $94
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $89
+JUMPV
+LABELV $95
+LABELV $91
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+ADDRGP4 vectoyaw
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 200
+ADDP4
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 vectoyaw
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+ADDRLP4 40
+INDIRF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 40
+INDIRF4
+ASGNF4
+LABELV $89
+endproc LookAtKiller 52 4
+export GibEntity
+proc GibEntity 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 512
+BANDI4
+CNSTI4 0
+EQI4 $101
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $103
+ADDRLP4 0
+CNSTI4 808
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $107
+ADDRGP4 $104
+JUMPV
+LABELV $107
+ADDRLP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $109
+ADDRGP4 $104
+JUMPV
+LABELV $109
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $113
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $111
+ADDRGP4 $104
+JUMPV
+LABELV $111
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $105
+JUMPV
+LABELV $104
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+LTI4 $103
+LABELV $105
+LABELV $101
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $100
+endproc GibEntity 12 12
+export body_die
+proc body_die 0 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 -40
+LEI4 $115
+ADDRGP4 $114
+JUMPV
+LABELV $115
+ADDRGP4 g_blood+12
+INDIRI4
+CNSTI4 0
+NEI4 $117
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+CNSTI4 -39
+ASGNI4
+ADDRGP4 $114
+JUMPV
+LABELV $117
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 GibEntity
+CALLV
+pop
+LABELV $114
+endproc body_die 0 8
+data
+export modNames
+align 4
+LABELV modNames
+address $120
+address $121
+address $122
+address $123
+address $124
+address $125
+address $126
+address $127
+address $128
+address $129
+address $130
+address $131
+address $132
+address $133
+address $134
+address $135
+address $136
+address $137
+address $138
+address $139
+address $140
+address $141
+address $142
+address $143
+export CheckAlmostCapture
+code
+proc CheckAlmostCapture 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $148
+ADDRLP4 20
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $148
+ADDRLP4 20
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $145
+LABELV $148
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $149
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $152
+ADDRLP4 4
+ADDRGP4 $154
+ASGNP4
+ADDRGP4 $150
+JUMPV
+LABELV $152
+ADDRLP4 4
+ADDRGP4 $155
+ASGNP4
+ADDRGP4 $150
+JUMPV
+LABELV $149
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $156
+ADDRLP4 4
+ADDRGP4 $155
+ASGNP4
+ADDRGP4 $157
+JUMPV
+LABELV $156
+ADDRLP4 4
+ADDRGP4 $154
+ASGNP4
+LABELV $157
+LABELV $150
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+LABELV $158
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+LABELV $159
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $161
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $158
+LABELV $161
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $162
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $162
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 36
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRLP4 44
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 44
+INDIRF4
+CNSTF4 1128792064
+GEF4 $166
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $168
+ADDRLP4 52
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+LABELV $168
+LABELV $166
+LABELV $162
+LABELV $145
+LABELV $144
+endproc CheckAlmostCapture 56 12
+export CheckAlmostScored
+proc CheckAlmostScored 44 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $171
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $173
+ADDRLP4 16
+ADDRGP4 $175
+ASGNP4
+ADDRGP4 $174
+JUMPV
+LABELV $173
+ADDRLP4 16
+ADDRGP4 $176
+ASGNP4
+LABELV $174
+CNSTP4 0
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $177
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 24
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 32
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+CNSTF4 1128792064
+GEF4 $181
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $183
+ADDRLP4 40
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 4
+BXORI4
+ASGNI4
+LABELV $183
+LABELV $181
+LABELV $177
+LABELV $171
+LABELV $170
+endproc CheckAlmostScored 44 12
+bss
+align 4
+LABELV $254
+skip 4
+export player_die
+code
+proc player_die 96 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $186
+ADDRGP4 $185
+JUMPV
+LABELV $186
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $188
+ADDRGP4 $185
+JUMPV
+LABELV $188
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CheckAlmostCapture
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CheckAlmostScored
+CALLV
+pop
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTU4 0
+ASGNU4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $191
+ADDRLP4 28
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $191
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_HookFree
+CALLV
+pop
+LABELV $191
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $193
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $195
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ASGNP4
+ADDRGP4 $194
+JUMPV
+LABELV $195
+ADDRLP4 16
+ADDRGP4 $197
+ASGNP4
+ADDRGP4 $194
+JUMPV
+LABELV $193
+ADDRLP4 4
+CNSTI4 1022
+ASGNI4
+ADDRLP4 16
+ADDRGP4 $198
+ASGNP4
+LABELV $194
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $201
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $199
+LABELV $201
+ADDRLP4 4
+CNSTI4 1022
+ASGNI4
+ADDRLP4 16
+ADDRGP4 $198
+ASGNP4
+LABELV $199
+ADDRFP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $204
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+CNSTU4 24
+LTU4 $202
+LABELV $204
+ADDRLP4 20
+ADDRGP4 $205
+ASGNP4
+ADDRGP4 $203
+JUMPV
+LABELV $202
+ADDRLP4 20
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 modNames
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $203
+ADDRGP4 $206
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 16
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 60
+ARGI4
+ADDRLP4 48
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 424
+ADDP4
+CNSTI4 32
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 280
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+CNSTU4 0
+ASGNU4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 60
+INDIRU4
+EQU4 $207
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 60
+INDIRU4
+EQU4 $207
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 720
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $211
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $209
+LABELV $211
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRGP4 $208
+JUMPV
+LABELV $209
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRFP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $212
+ADDRLP4 76
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 300
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 80
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 268
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+CNSTI4 2
+BXORI4
+ASGNI4
+LABELV $212
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 752
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 3000
+GEI4 $215
+ADDRLP4 76
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 288
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 80
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $215
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 752
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 $208
+JUMPV
+LABELV $207
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+LABELV $208
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Team_FragBonuses
+CALLV
+pop
+ADDRFP4 16
+INDIRI4
+CNSTI4 20
+NEI4 $220
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $222
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 348
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $223
+JUMPV
+LABELV $222
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $224
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 340
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $225
+JUMPV
+LABELV $224
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $226
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $226
+LABELV $225
+LABELV $223
+LABELV $220
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 64
+ADDRGP4 trap_PointContents
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+NEU4 $228
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 TossClientItems
+CALLV
+pop
+ADDRGP4 $229
+JUMPV
+LABELV $228
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 348
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $230
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRGP4 $231
+JUMPV
+LABELV $230
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 340
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $232
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRGP4 $233
+JUMPV
+LABELV $232
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 344
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $234
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+LABELV $234
+LABELV $233
+LABELV $231
+LABELV $229
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Cmd_Score_f
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $239
+JUMPV
+LABELV $236
+ADDRLP4 68
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $241
+ADDRGP4 $237
+JUMPV
+LABELV $241
+ADDRLP4 68
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $243
+ADDRGP4 $237
+JUMPV
+LABELV $243
+ADDRLP4 68
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+NEI4 $245
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 Cmd_Score_f
+CALLV
+pop
+LABELV $245
+LABELV $237
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $239
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $236
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 67108864
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 LookAtKiller
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+CNSTF4 3238002688
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 732
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1700
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 -40
+GTI4 $253
+ADDRLP4 12
+INDIRI4
+CVIU4 4
+CNSTU4 2147483648
+BANDU4
+CNSTU4 0
+NEU4 $253
+ADDRGP4 g_blood+12
+INDIRI4
+CNSTI4 0
+NEI4 $251
+LABELV $253
+ADDRFP4 16
+INDIRI4
+CNSTI4 20
+NEI4 $248
+LABELV $251
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 GibEntity
+CALLV
+pop
+ADDRGP4 $249
+JUMPV
+LABELV $248
+ADDRLP4 72
+ADDRGP4 $254
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $257
+ADDRLP4 72
+INDIRI4
+CNSTI4 1
+EQI4 $258
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+EQI4 $259
+ADDRGP4 $255
+JUMPV
+LABELV $257
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRGP4 $256
+JUMPV
+LABELV $258
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRGP4 $256
+JUMPV
+LABELV $259
+LABELV $255
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+LABELV $256
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 -40
+GTI4 $260
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+CNSTI4 -39
+ASGNI4
+LABELV $260
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 80
+CNSTI4 128
+ASGNI4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+BANDI4
+ADDRLP4 80
+INDIRI4
+BXORI4
+ADDRLP4 24
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 84
+ADDP4
+ASGNP4
+ADDRLP4 88
+CNSTI4 128
+ASGNI4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+ADDRLP4 88
+INDIRI4
+BANDI4
+ADDRLP4 88
+INDIRI4
+BXORI4
+ADDRLP4 24
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $254
+INDIRI4
+CNSTI4 57
+ADDI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+ADDRGP4 body_die
+ASGNP4
+ADDRLP4 92
+ADDRGP4 $254
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+CNSTI4 3
+MODI4
+ASGNI4
+LABELV $249
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $185
+endproc player_die 96 28
+export CheckArmor
+proc CheckArmor 20 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $263
+CNSTI4 0
+RETI4
+ADDRGP4 $262
+JUMPV
+LABELV $263
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $265
+CNSTI4 0
+RETI4
+ADDRGP4 $262
+JUMPV
+LABELV $265
+ADDRFP4 8
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $267
+CNSTI4 0
+RETI4
+ADDRGP4 $262
+JUMPV
+LABELV $267
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+CNSTF4 1059648963
+ADDRFP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 ceil
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $269
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $269
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $271
+CNSTI4 0
+RETI4
+ADDRGP4 $262
+JUMPV
+LABELV $271
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+CNSTI4 196
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $262
+endproc CheckArmor 20 4
+export RaySphereIntersections
+proc RaySphereIntersections 96 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 40
+CNSTI4 8
+ASGNI4
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 1073741824
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 60
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 52
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 60
+INDIRF4
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 64
+INDIRF4
+ADDRLP4 64
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+CNSTF4 1082130432
+ADDRLP4 12
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+LEF4 $274
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+NEGF4
+ADDRLP4 72
+INDIRF4
+ADDF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+CNSTI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+CNSTI4 8
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 84
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+NEGF4
+ADDRLP4 84
+INDIRF4
+SUBF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+CNSTI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 92
+CNSTI4 8
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 2
+RETI4
+ADDRGP4 $273
+JUMPV
+LABELV $274
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+NEF4 $276
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+NEGF4
+CNSTF4 1073741824
+DIVF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 72
+CNSTI4 4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+CNSTI4 8
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 76
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+ADDRGP4 $273
+JUMPV
+LABELV $276
+CNSTI4 0
+RETI4
+LABELV $273
+endproc RaySphereIntersections 96 4
+export G_Damage
+proc G_Damage 80 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $279
+ADDRGP4 $278
+JUMPV
+LABELV $279
+ADDRGP4 level+9124
+INDIRI4
+CNSTI4 0
+EQI4 $281
+ADDRGP4 $278
+JUMPV
+LABELV $281
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $284
+ADDRFP4 4
+ADDRGP4 g_entities+825776
+ASGNP4
+LABELV $284
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $287
+ADDRFP4 8
+ADDRGP4 g_entities+825776
+ASGNP4
+LABELV $287
+ADDRLP4 24
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $290
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $278
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $278
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $278
+JUMPV
+LABELV $290
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $294
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $294
+ADDRLP4 20
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 208
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MULI4
+CNSTI4 100
+DIVI4
+ASGNI4
+LABELV $294
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $296
+ADDRLP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $298
+ADDRGP4 $278
+JUMPV
+LABELV $298
+LABELV $296
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $300
+ADDRFP4 24
+ADDRFP4 24
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $301
+JUMPV
+LABELV $300
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $301
+ADDRLP4 4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 200
+LEI4 $302
+ADDRLP4 4
+CNSTI4 200
+ASGNI4
+LABELV $302
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 2048
+BANDI4
+CNSTI4 0
+EQI4 $304
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $304
+ADDRFP4 24
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $306
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $306
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $308
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $308
+ADDRLP4 44
+CNSTF4 1128792064
+ASGNF4
+ADDRLP4 52
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRGP4 g_knockback+8
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 32+4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRGP4 g_knockback+8
+INDIRF4
+ADDRLP4 52
+INDIRF4
+MULF4
+ADDRLP4 56
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 32+8
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRGP4 g_knockback+8
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ADDRLP4 44
+INDIRF4
+DIVF4
+MULF4
+ASGNF4
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+ADDRLP4 32+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $317
+ADDRLP4 72
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+LSHI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 50
+GEI4 $319
+ADDRLP4 72
+CNSTI4 50
+ASGNI4
+LABELV $319
+ADDRLP4 72
+INDIRI4
+CNSTI4 200
+LEI4 $321
+ADDRLP4 72
+CNSTI4 200
+ASGNI4
+LABELV $321
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 64
+BORI4
+ASGNI4
+LABELV $317
+LABELV $308
+ADDRFP4 24
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $323
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $325
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+EQI4 $325
+ADDRGP4 g_friendlyFire+12
+INDIRI4
+CNSTI4 0
+NEI4 $327
+ADDRGP4 $278
+JUMPV
+LABELV $327
+LABELV $325
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $330
+ADDRGP4 $278
+JUMPV
+LABELV $330
+LABELV $323
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $332
+ADDRLP4 0
+INDIRP4
+CNSTI4 320
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $332
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 62
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRFP4 24
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+NEI4 $336
+ADDRFP4 28
+INDIRI4
+CNSTI4 19
+NEI4 $334
+LABELV $336
+ADDRGP4 $278
+JUMPV
+LABELV $334
+ADDRFP4 20
+CNSTF4 1056964608
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $332
+ADDRLP4 40
+CNSTU4 0
+ASGNU4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 40
+INDIRU4
+EQU4 $337
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 40
+INDIRU4
+EQU4 $337
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $337
+ADDRLP4 48
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LEI4 $337
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 3
+EQI4 $337
+ADDRLP4 52
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $337
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $339
+ADDRLP4 60
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 252
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $340
+JUMPV
+LABELV $339
+ADDRLP4 60
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 252
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $340
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 276
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 8
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+BORI4
+ASGNI4
+LABELV $337
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+NEU4 $341
+ADDRFP4 20
+CNSTF4 1056964608
+ADDRFP4 20
+INDIRI4
+CVIF4 4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $341
+ADDRFP4 20
+INDIRI4
+CNSTI4 1
+GEI4 $343
+ADDRFP4 20
+CNSTI4 1
+ASGNI4
+LABELV $343
+ADDRLP4 8
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 24
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 CheckArmor
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 g_debugDamage+12
+INDIRI4
+CNSTI4 0
+EQI4 $345
+ADDRGP4 $348
+ARGP4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $345
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $350
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $352
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 $353
+JUMPV
+LABELV $352
+ADDRLP4 0
+INDIRP4
+CNSTI4 272
+ADDP4
+CNSTI4 1022
+ASGNI4
+LABELV $353
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $354
+ADDRLP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $355
+JUMPV
+LABELV $354
+ADDRLP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $355
+LABELV $350
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $356
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Team_CheckHurtCarrier
+CALLV
+pop
+LABELV $356
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $359
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 724
+ADDP4
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 728
+ADDP4
+ADDRFP4 28
+INDIRI4
+ASGNI4
+LABELV $359
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $361
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $363
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $363
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $365
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $367
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+LABELV $367
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 -999
+GEI4 $369
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+CNSTI4 -999
+ASGNI4
+LABELV $369
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 28
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 716
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $278
+JUMPV
+LABELV $365
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $371
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 712
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $371
+LABELV $361
+LABELV $278
+endproc G_Damage 80 24
+export CanDamage
+proc CanDamage 128 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 12
+ADDRLP4 88
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 88
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12+8
+CNSTF4 1056964608
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1065353216
+EQF4 $384
+ADDRLP4 24+52
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+NEI4 $380
+LABELV $384
+CNSTI4 1
+RETI4
+ADDRGP4 $373
+JUMPV
+LABELV $380
+ADDRLP4 0
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 96
+CNSTF4 1097859072
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 100
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $386
+CNSTI4 1
+RETI4
+ADDRGP4 $373
+JUMPV
+LABELV $386
+ADDRLP4 0
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 104
+CNSTF4 1097859072
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 104
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 104
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 108
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $390
+CNSTI4 1
+RETI4
+ADDRGP4 $373
+JUMPV
+LABELV $390
+ADDRLP4 0
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 112
+CNSTF4 1097859072
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 112
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 116
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $394
+CNSTI4 1
+RETI4
+ADDRGP4 $373
+JUMPV
+LABELV $394
+ADDRLP4 0
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 120
+CNSTF4 1097859072
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 120
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 120
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 vec3_origin
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1023
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1065353216
+NEF4 $398
+CNSTI4 1
+RETI4
+ADDRGP4 $373
+JUMPV
+LABELV $398
+CNSTI4 0
+RETI4
+LABELV $373
+endproc CanDamage 128 28
+export G_RadiusDamage
+proc G_RadiusDamage 4196 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 4168
+CNSTI4 0
+ASGNI4
+ADDRFP4 12
+INDIRF4
+CNSTF4 1065353216
+GEF4 $402
+ADDRFP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $402
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $404
+ADDRLP4 4172
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4172
+INDIRI4
+ADDRLP4 4144
+ADDP4
+ADDRLP4 4172
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 4156
+ADDP4
+ADDRLP4 4176
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $405
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $404
+ADDRLP4 4144
+ARGP4
+ADDRLP4 4156
+ARGP4
+ADDRLP4 44
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4172
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 4140
+ADDRLP4 4172
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $411
+JUMPV
+LABELV $408
+ADDRLP4 4
+CNSTI4 808
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 44
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRFP4 16
+INDIRP4
+CVPU4 4
+NEU4 $412
+ADDRGP4 $409
+JUMPV
+LABELV $412
+ADDRLP4 4
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $414
+ADDRGP4 $409
+JUMPV
+LABELV $414
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $416
+ADDRLP4 4176
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4176
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDP4
+INDIRF4
+GEF4 $420
+ADDRLP4 4180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4180
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $421
+JUMPV
+LABELV $420
+ADDRLP4 4180
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4180
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 476
+ADDP4
+ADDP4
+INDIRF4
+LEF4 $422
+ADDRLP4 4184
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4184
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 4184
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4184
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 476
+ADDP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $423
+JUMPV
+LABELV $422
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $423
+LABELV $421
+LABELV $417
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $416
+ADDRLP4 8
+ARGP4
+ADDRLP4 4176
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 4176
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 12
+INDIRF4
+LTF4 $424
+ADDRGP4 $409
+JUMPV
+LABELV $424
+ADDRLP4 40
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+ADDRLP4 24
+INDIRF4
+ADDRFP4 12
+INDIRF4
+DIVF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4180
+ADDRGP4 CanDamage
+CALLI4
+ASGNI4
+ADDRLP4 4180
+INDIRI4
+CNSTI4 0
+EQI4 $426
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4184
+ADDRGP4 LogAccuracyHit
+CALLI4
+ASGNI4
+ADDRLP4 4184
+INDIRI4
+CNSTI4 0
+EQI4 $428
+ADDRLP4 4168
+CNSTI4 1
+ASGNI4
+LABELV $428
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28+4
+ADDRLP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28+8
+ADDRLP4 28+8
+INDIRF4
+CNSTF4 1103101952
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRFP4 20
+INDIRI4
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $426
+LABELV $409
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $411
+ADDRLP4 20
+INDIRI4
+ADDRLP4 4140
+INDIRI4
+LTI4 $408
+ADDRLP4 4168
+INDIRI4
+RETI4
+LABELV $401
+endproc G_RadiusDamage 4196 32
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import DeathmatchScoreboardMessage
+import G_SetStats
+import MoveClientToIntermission
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import G_RunMissile
+import TossClientCubes
+import G_InvulnerabilityEffect
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $348
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 100
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $206
+byte 1 75
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $205
+byte 1 60
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 117
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 62
+byte 1 0
+align 1
+LABELV $198
+byte 1 60
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 62
+byte 1 0
+align 1
+LABELV $197
+byte 1 60
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 45
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 62
+byte 1 0
+align 1
+LABELV $176
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $175
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 111
+byte 1 98
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 0
+align 1
+LABELV $155
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $154
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $143
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 80
+byte 1 80
+byte 1 76
+byte 1 69
+byte 1 0
+align 1
+LABELV $142
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 95
+byte 1 72
+byte 1 85
+byte 1 82
+byte 1 84
+byte 1 0
+align 1
+LABELV $141
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 84
+byte 1 65
+byte 1 82
+byte 1 71
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $140
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 83
+byte 1 85
+byte 1 73
+byte 1 67
+byte 1 73
+byte 1 68
+byte 1 69
+byte 1 0
+align 1
+LABELV $139
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 70
+byte 1 65
+byte 1 76
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $138
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 70
+byte 1 82
+byte 1 65
+byte 1 71
+byte 1 0
+align 1
+LABELV $137
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 67
+byte 1 82
+byte 1 85
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $136
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 76
+byte 1 65
+byte 1 86
+byte 1 65
+byte 1 0
+align 1
+LABELV $135
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 83
+byte 1 76
+byte 1 73
+byte 1 77
+byte 1 69
+byte 1 0
+align 1
+LABELV $134
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 87
+byte 1 65
+byte 1 84
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $133
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $132
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 66
+byte 1 70
+byte 1 71
+byte 1 0
+align 1
+LABELV $131
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 71
+byte 1 72
+byte 1 84
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 0
+align 1
+LABELV $130
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 82
+byte 1 65
+byte 1 73
+byte 1 76
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 0
+align 1
+LABELV $129
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 77
+byte 1 65
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $128
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 77
+byte 1 65
+byte 1 0
+align 1
+LABELV $127
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 82
+byte 1 79
+byte 1 67
+byte 1 75
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $126
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 82
+byte 1 79
+byte 1 67
+byte 1 75
+byte 1 69
+byte 1 84
+byte 1 0
+align 1
+LABELV $125
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 83
+byte 1 72
+byte 1 0
+align 1
+LABELV $124
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 68
+byte 1 69
+byte 1 0
+align 1
+LABELV $123
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 77
+byte 1 65
+byte 1 67
+byte 1 72
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 0
+align 1
+LABELV $122
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 71
+byte 1 65
+byte 1 85
+byte 1 78
+byte 1 84
+byte 1 76
+byte 1 69
+byte 1 84
+byte 1 0
+align 1
+LABELV $121
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 83
+byte 1 72
+byte 1 79
+byte 1 84
+byte 1 71
+byte 1 85
+byte 1 78
+byte 1 0
+align 1
+LABELV $120
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 95
+byte 1 85
+byte 1 78
+byte 1 75
+byte 1 78
+byte 1 79
+byte 1 87
+byte 1 78
+byte 1 0
+align 1
+LABELV $113
+byte 1 107
+byte 1 97
+byte 1 109
+byte 1 105
+byte 1 107
+byte 1 97
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 114
+byte 1 0
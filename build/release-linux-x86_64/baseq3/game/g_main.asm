@@ -0,0 +1,8619 @@
+data
+align 4
+LABELV gameCvarTable
+address g_cheats
+address $54
+address $55
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+byte 4 0
+address $56
+address $57
+byte 4 68
+byte 4 0
+byte 4 0
+skip 4
+byte 4 0
+address $58
+address $59
+byte 4 64
+byte 4 0
+byte 4 0
+skip 4
+address g_restarted
+address $60
+address $61
+byte 4 64
+byte 4 0
+byte 4 0
+skip 4
+byte 4 0
+address $62
+address $55
+byte 4 68
+byte 4 0
+byte 4 0
+skip 4
+address g_gametype
+address $63
+address $61
+byte 4 38
+byte 4 0
+byte 4 0
+skip 4
+address g_maxclients
+address $64
+address $65
+byte 4 37
+byte 4 0
+byte 4 0
+skip 4
+address g_maxGameClients
+address $66
+address $61
+byte 4 37
+byte 4 0
+byte 4 0
+skip 4
+address g_dmflags
+address $67
+address $61
+byte 4 5
+byte 4 0
+byte 4 1
+skip 4
+address g_fraglimit
+address $68
+address $69
+byte 4 1029
+byte 4 0
+byte 4 1
+skip 4
+address g_timelimit
+address $70
+address $61
+byte 4 1029
+byte 4 0
+byte 4 1
+skip 4
+address g_capturelimit
+address $71
+address $65
+byte 4 1029
+byte 4 0
+byte 4 1
+skip 4
+address g_synchronousClients
+address $72
+address $61
+byte 4 8
+byte 4 0
+byte 4 0
+skip 4
+address g_friendlyFire
+address $73
+address $61
+byte 4 1
+byte 4 0
+byte 4 1
+skip 4
+address g_teamAutoJoin
+address $74
+address $61
+byte 4 1
+skip 12
+address g_teamForceBalance
+address $75
+address $61
+byte 4 1
+skip 12
+address g_warmup
+address $76
+address $69
+byte 4 1
+byte 4 0
+byte 4 1
+skip 4
+address g_doWarmup
+address $77
+address $61
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_logfile
+address $78
+address $79
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_logfileSync
+address $80
+address $61
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_password
+address $81
+address $55
+byte 4 2
+byte 4 0
+byte 4 0
+skip 4
+address g_banIPs
+address $82
+address $55
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_filterBan
+address $83
+address $84
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_needpass
+address $85
+address $61
+byte 4 68
+byte 4 0
+byte 4 0
+skip 4
+address g_dedicated
+address $86
+address $61
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_speed
+address $87
+address $88
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_gravity
+address $89
+address $90
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_knockback
+address $91
+address $92
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_quadfactor
+address $93
+address $94
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_weaponRespawn
+address $95
+address $96
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_weaponTeamRespawn
+address $97
+address $98
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_forcerespawn
+address $99
+address $69
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_inactivity
+address $100
+address $61
+byte 4 0
+byte 4 0
+byte 4 1
+skip 4
+address g_debugMove
+address $101
+address $61
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_debugDamage
+address $102
+address $61
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_debugAlloc
+address $103
+address $61
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_motd
+address $104
+address $55
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_blood
+address $105
+address $84
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_podiumDist
+address $106
+address $107
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_podiumDrop
+address $108
+address $109
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_allowVote
+address $110
+address $84
+byte 4 1
+byte 4 0
+byte 4 0
+skip 4
+address g_listEntity
+address $111
+address $61
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address g_smoothClients
+address $112
+address $84
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+address pmove_fixed
+address $113
+address $61
+byte 4 8
+byte 4 0
+byte 4 0
+skip 4
+address pmove_msec
+address $114
+address $65
+byte 4 8
+byte 4 0
+byte 4 0
+skip 4
+address g_rankings
+address $115
+address $61
+byte 4 0
+byte 4 0
+byte 4 0
+skip 4
+align 4
+LABELV gameCvarTableSize
+byte 4 46
+export vmMain
+code
+proc vmMain 16 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $117
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+GTI4 $117
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $130
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $130
+address $119
+address $120
+address $121
+address $125
+address $123
+address $124
+address $126
+address $122
+address $127
+address $128
+address $129
+code
+LABELV $119
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRGP4 G_InitGame
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $120
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_ShutdownGame
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $121
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 ClientConnect
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CVUI4 4
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $122
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientThink
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $123
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $124
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientDisconnect
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $125
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientBegin
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $126
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientCommand
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $127
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_RunFrame
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $128
+ADDRLP4 8
+ADDRGP4 ConsoleCommand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $129
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 BotAIStartFrame
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $116
+JUMPV
+LABELV $117
+CNSTI4 -1
+RETI4
+LABELV $116
+endproc vmMain 16 12
+export G_Printf
+proc G_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Printf
+CALLV
+pop
+LABELV $131
+endproc G_Printf 1028 16
+export G_Error
+proc G_Error 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $133
+endproc G_Error 1028 16
+export G_FindTeams
+proc G_FindTeams 56 12
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+CNSTI4 808
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRGP4 $139
+JUMPV
+LABELV $136
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $141
+ADDRGP4 $137
+JUMPV
+LABELV $141
+ADDRLP4 4
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $143
+ADDRGP4 $137
+JUMPV
+LABELV $143
+ADDRLP4 4
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $145
+ADDRGP4 $137
+JUMPV
+LABELV $145
+ADDRLP4 4
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 808
+ADDP4
+ASGNP4
+ADDRGP4 $150
+JUMPV
+LABELV $147
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $152
+ADDRGP4 $148
+JUMPV
+LABELV $152
+ADDRLP4 0
+INDIRP4
+CNSTI4 656
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $154
+ADDRGP4 $148
+JUMPV
+LABELV $154
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $156
+ADDRGP4 $148
+JUMPV
+LABELV $156
+ADDRLP4 36
+CNSTI4 656
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+NEI4 $158
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 776
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 776
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1024
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $160
+ADDRLP4 52
+CNSTI4 652
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+CNSTP4 0
+ASGNP4
+LABELV $160
+LABELV $158
+LABELV $148
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ASGNP4
+LABELV $150
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $147
+LABELV $137
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 808
+ADDP4
+ASGNP4
+LABELV $139
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $136
+ADDRGP4 $162
+ARGP4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $135
+endproc G_FindTeams 56 12
+export G_RemapTeamShaders
+proc G_RemapTeamShaders 0 0
+LABELV $163
+endproc G_RemapTeamShaders 0 0
+export G_RegisterCvars
+proc G_RegisterCvars 20 16
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 gameCvarTable
+ASGNP4
+ADDRGP4 $168
+JUMPV
+LABELV $165
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $169
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $169
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $171
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $171
+LABELV $166
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+LABELV $168
+ADDRLP4 4
+INDIRI4
+ADDRGP4 gameCvarTableSize
+INDIRI4
+LTI4 $165
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $173
+ADDRGP4 G_RemapTeamShaders
+CALLV
+pop
+LABELV $173
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 0
+LTI4 $179
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 8
+LTI4 $175
+LABELV $179
+ADDRGP4 $180
+ARGP4
+ADDRGP4 g_gametype+12
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $63
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $175
+ADDRGP4 level+352
+ADDRGP4 g_warmup+4
+INDIRI4
+ASGNI4
+LABELV $164
+endproc G_RegisterCvars 20 16
+export G_UpdateCvars
+proc G_UpdateCvars 28 12
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 gameCvarTable
+ASGNP4
+ADDRGP4 $188
+JUMPV
+LABELV $185
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $189
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+EQI4 $191
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $193
+ADDRGP4 $195
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 16
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $193
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $196
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+LABELV $196
+LABELV $191
+LABELV $189
+LABELV $186
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+LABELV $188
+ADDRLP4 4
+INDIRI4
+ADDRGP4 gameCvarTableSize
+INDIRI4
+LTI4 $185
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $198
+ADDRGP4 G_RemapTeamShaders
+CALLV
+pop
+LABELV $198
+LABELV $184
+endproc G_UpdateCvars 28 12
+export G_InitGame
+proc G_InitGame 1032 20
+ADDRGP4 $201
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $202
+ARGP4
+ADDRGP4 $57
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $203
+ARGP4
+ADDRGP4 $59
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+ARGU4
+ADDRGP4 srand
+CALLV
+pop
+ADDRGP4 G_RegisterCvars
+CALLV
+pop
+ADDRGP4 G_ProcessIPBans
+CALLV
+pop
+ADDRGP4 G_InitMemory
+CALLV
+pop
+ADDRGP4 level
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 9212
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 level+32
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 level+40
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $207
+ARGP4
+ADDRLP4 4
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRGP4 level+348
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+EQI4 $208
+ADDRGP4 g_logfile+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $208
+ADDRGP4 g_logfileSync+12
+INDIRI4
+CNSTI4 0
+EQI4 $212
+ADDRGP4 g_logfile+16
+ARGP4
+ADDRGP4 level+20
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRGP4 g_logfile+16
+ARGP4
+ADDRGP4 level+20
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+pop
+LABELV $213
+ADDRGP4 level+20
+INDIRI4
+CNSTI4 0
+NEI4 $219
+ADDRGP4 $222
+ARGP4
+ADDRGP4 g_logfile+16
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $209
+JUMPV
+LABELV $219
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_GetServerinfo
+CALLV
+pop
+ADDRGP4 $224
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $225
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRGP4 $226
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $209
+ADDRGP4 G_InitWorldSession
+CALLV
+pop
+ADDRGP4 g_entities
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 827392
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 level+4
+ADDRGP4 g_entities
+ASGNP4
+ADDRGP4 level+24
+ADDRGP4 g_maxclients+12
+INDIRI4
+ASGNI4
+ADDRGP4 g_clients
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 49664
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 level
+ADDRGP4 g_clients
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $233
+JUMPV
+LABELV $230
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+516
+ADDP4
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $231
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $233
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $230
+ADDRGP4 level+12
+CNSTI4 64
+ASGNI4
+ADDRGP4 level+4
+INDIRP4
+ARGP4
+ADDRGP4 level+12
+INDIRI4
+ARGI4
+CNSTI4 808
+ARGI4
+ADDRGP4 level
+INDIRP4
+ARGP4
+CNSTI4 776
+ARGI4
+ADDRGP4 trap_LocateGameData
+CALLV
+pop
+ADDRGP4 InitBodyQue
+CALLV
+pop
+ADDRGP4 ClearRegisteredItems
+CALLV
+pop
+ADDRGP4 G_SpawnEntitiesFromString
+CALLV
+pop
+ADDRGP4 G_FindTeams
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $239
+ADDRGP4 G_CheckTeamItems
+CALLV
+pop
+LABELV $239
+ADDRGP4 SaveRegisteredItems
+CALLV
+pop
+ADDRGP4 $242
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+EQI4 $247
+ADDRGP4 $246
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $243
+LABELV $247
+ADDRGP4 $248
+ARGP4
+ADDRGP4 G_ModelIndex
+CALLI4
+pop
+ADDRGP4 $249
+ARGP4
+ADDRGP4 G_SoundIndex
+CALLI4
+pop
+ADDRGP4 $250
+ARGP4
+ADDRGP4 G_SoundIndex
+CALLI4
+pop
+LABELV $243
+ADDRGP4 $253
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $251
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotAISetup
+CALLI4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 BotAILoadMap
+CALLI4
+pop
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 G_InitBots
+CALLV
+pop
+LABELV $251
+ADDRGP4 G_RemapTeamShaders
+CALLV
+pop
+LABELV $200
+endproc G_InitGame 1032 20
+export G_ShutdownGame
+proc G_ShutdownGame 4 4
+ADDRGP4 $255
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 level+20
+INDIRI4
+CNSTI4 0
+EQI4 $256
+ADDRGP4 $259
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $224
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 level+20
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+LABELV $256
+ADDRGP4 G_WriteSessionData
+CALLV
+pop
+ADDRGP4 $253
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableIntegerValue
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $261
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 BotAIShutdown
+CALLI4
+pop
+LABELV $261
+LABELV $254
+endproc G_ShutdownGame 4 4
+export Com_Error
+proc Com_Error 1028 16
+ADDRLP4 0
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $265
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $263
+endproc Com_Error 1028 16
+export Com_Printf
+proc Com_Printf 1028 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $265
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $266
+endproc Com_Printf 1028 16
+export AddTournamentPlayer
+proc AddTournamentPlayer 24 8
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+LTI4 $269
+ADDRGP4 $268
+JUMPV
+LABELV $269
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $272
+ADDRGP4 $268
+JUMPV
+LABELV $272
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $278
+JUMPV
+LABELV $275
+ADDRLP4 0
+CNSTI4 776
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $280
+ADDRGP4 $276
+JUMPV
+LABELV $280
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $282
+ADDRGP4 $276
+JUMPV
+LABELV $282
+ADDRLP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $286
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $284
+LABELV $286
+ADDRGP4 $276
+JUMPV
+LABELV $284
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $289
+ADDRLP4 20
+CNSTI4 620
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $287
+LABELV $289
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $287
+LABELV $276
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $278
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $275
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $290
+ADDRGP4 $268
+JUMPV
+LABELV $290
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+CNSTI4 808
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 776
+DIVI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 $293
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $268
+endproc AddTournamentPlayer 24 8
+export RemoveTournamentLoser
+proc RemoveTournamentLoser 4 8
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+EQI4 $295
+ADDRGP4 $294
+JUMPV
+LABELV $295
+ADDRLP4 0
+ADDRGP4 level+84+4
+INDIRI4
+ASGNI4
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $300
+ADDRGP4 $294
+JUMPV
+LABELV $300
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 $302
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $294
+endproc RemoveTournamentLoser 4 8
+export RemoveTournamentWinner
+proc RemoveTournamentWinner 4 8
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+EQI4 $304
+ADDRGP4 $303
+JUMPV
+LABELV $304
+ADDRLP4 0
+ADDRGP4 level+84
+INDIRI4
+ASGNI4
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $308
+ADDRGP4 $303
+JUMPV
+LABELV $308
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 $302
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $303
+endproc RemoveTournamentWinner 4 8
+export AdjustTournamentScores
+proc AdjustTournamentScores 8 4
+ADDRLP4 0
+ADDRGP4 level+84
+INDIRI4
+ASGNI4
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $312
+ADDRLP4 4
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 632
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $312
+ADDRLP4 0
+ADDRGP4 level+84+4
+INDIRI4
+ASGNI4
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $316
+ADDRLP4 4
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 636
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $316
+LABELV $310
+endproc AdjustTournamentScores 8 4
+export SortRanks
+proc SortRanks 40 0
+ADDRLP4 8
+CNSTI4 776
+ASGNI4
+ADDRLP4 12
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+MULI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $321
+ADDRLP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $319
+LABELV $321
+CNSTI4 1
+RETI4
+ADDRGP4 $318
+JUMPV
+LABELV $319
+ADDRLP4 4
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $324
+ADDRLP4 4
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $322
+LABELV $324
+CNSTI4 -1
+RETI4
+ADDRGP4 $318
+JUMPV
+LABELV $322
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $325
+CNSTI4 1
+RETI4
+ADDRGP4 $318
+JUMPV
+LABELV $325
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $327
+CNSTI4 -1
+RETI4
+ADDRGP4 $318
+JUMPV
+LABELV $327
+ADDRLP4 24
+CNSTI4 616
+ASGNI4
+ADDRLP4 28
+CNSTI4 3
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $329
+ADDRLP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $329
+ADDRLP4 32
+CNSTI4 620
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $331
+CNSTI4 -1
+RETI4
+ADDRGP4 $318
+JUMPV
+LABELV $331
+ADDRLP4 36
+CNSTI4 620
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $333
+CNSTI4 1
+RETI4
+ADDRGP4 $318
+JUMPV
+LABELV $333
+CNSTI4 0
+RETI4
+ADDRGP4 $318
+JUMPV
+LABELV $329
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $335
+CNSTI4 1
+RETI4
+ADDRGP4 $318
+JUMPV
+LABELV $335
+ADDRLP4 4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $337
+CNSTI4 -1
+RETI4
+ADDRGP4 $318
+JUMPV
+LABELV $337
+ADDRLP4 32
+CNSTI4 248
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $339
+CNSTI4 -1
+RETI4
+ADDRGP4 $318
+JUMPV
+LABELV $339
+ADDRLP4 36
+CNSTI4 248
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $341
+CNSTI4 1
+RETI4
+ADDRGP4 $318
+JUMPV
+LABELV $341
+CNSTI4 0
+RETI4
+LABELV $318
+endproc SortRanks 40 0
+export CalculateRanks
+proc CalculateRanks 44 16
+ADDRGP4 level+340
+CNSTI4 -1
+ASGNI4
+ADDRGP4 level+344
+CNSTI4 -1
+ASGNI4
+ADDRGP4 level+72
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+76
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+80
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+2420
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $350
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4496
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $351
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $350
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $358
+JUMPV
+LABELV $355
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $360
+ADDRGP4 level+72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 level+72
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $365
+ADDRLP4 24
+ADDRGP4 level+76
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $368
+ADDRLP4 28
+ADDRGP4 level+80
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $371
+ADDRLP4 32
+ADDRGP4 level+2420
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $376
+ADDRLP4 36
+ADDRGP4 level+4496
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $377
+JUMPV
+LABELV $376
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $379
+ADDRLP4 40
+ADDRGP4 level+4496+4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $379
+LABELV $377
+LABELV $371
+ADDRGP4 level+340
+INDIRI4
+CNSTI4 -1
+NEI4 $383
+ADDRGP4 level+340
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $384
+JUMPV
+LABELV $383
+ADDRGP4 level+344
+INDIRI4
+CNSTI4 -1
+NEI4 $387
+ADDRGP4 level+344
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $387
+LABELV $384
+LABELV $368
+LABELV $365
+LABELV $360
+LABELV $356
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $358
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $355
+ADDRGP4 level+84
+ARGP4
+ADDRGP4 level+72
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 SortRanks
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $394
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $400
+JUMPV
+LABELV $397
+ADDRLP4 4
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+NEI4 $403
+ADDRLP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $404
+JUMPV
+LABELV $403
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+LEI4 $409
+ADDRLP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $410
+JUMPV
+LABELV $409
+ADDRLP4 4
+INDIRP4
+CNSTI4 256
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $410
+LABELV $404
+LABELV $398
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $400
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+72
+INDIRI4
+LTI4 $397
+ADDRGP4 $395
+JUMPV
+LABELV $394
+ADDRLP4 12
+CNSTI4 -1
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $418
+JUMPV
+LABELV $415
+ADDRLP4 4
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $423
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $421
+LABELV $423
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 256
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $422
+JUMPV
+LABELV $421
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84-4
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 256
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 256
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $422
+ADDRLP4 16
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $428
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 1
+NEI4 $428
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 256
+ADDP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+LABELV $428
+LABELV $416
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $418
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+80
+INDIRI4
+LTI4 $415
+LABELV $395
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $433
+ADDRGP4 $436
+ARGP4
+ADDRGP4 level+44+4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $436
+ARGP4
+ADDRGP4 level+44+8
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $434
+JUMPV
+LABELV $433
+ADDRGP4 level+72
+INDIRI4
+CNSTI4 0
+NEI4 $441
+ADDRGP4 $436
+ARGP4
+CNSTI4 -9999
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $436
+ARGP4
+CNSTI4 -9999
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $442
+JUMPV
+LABELV $441
+ADDRGP4 level+72
+INDIRI4
+CNSTI4 1
+NEI4 $444
+ADDRGP4 $436
+ARGP4
+CNSTI4 776
+ADDRGP4 level+84
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $436
+ARGP4
+CNSTI4 -9999
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $445
+JUMPV
+LABELV $444
+ADDRGP4 $436
+ARGP4
+CNSTI4 776
+ADDRGP4 level+84
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 6
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $436
+ARGP4
+CNSTI4 776
+ADDRGP4 level+84+4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 7
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $445
+LABELV $442
+LABELV $434
+ADDRGP4 CheckExitRules
+CALLV
+pop
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $451
+ADDRGP4 SendScoreboardMessageToAllClients
+CALLV
+pop
+LABELV $451
+LABELV $343
+endproc CalculateRanks 44 16
+export SendScoreboardMessageToAllClients
+proc SendScoreboardMessageToAllClients 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $458
+JUMPV
+LABELV $455
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $460
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRGP4 DeathmatchScoreboardMessage
+CALLV
+pop
+LABELV $460
+LABELV $456
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $458
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $455
+LABELV $454
+endproc SendScoreboardMessageToAllClients 4 4
+export MoveClientToIntermission
+proc MoveClientToIntermission 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $463
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 StopFollowing
+CALLV
+pop
+LABELV $463
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRGP4 level+9144
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 level+9144
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRGP4 level+9156
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 5
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 160
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $462
+endproc MoveClientToIntermission 0 12
+export FindIntermissionPoint
+proc FindIntermissionPoint 32 12
+CNSTP4 0
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRGP4 $469
+ARGP4
+ADDRLP4 20
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $470
+ADDRGP4 vec3_origin
+ARGP4
+ADDRGP4 level+9144
+ARGP4
+ADDRGP4 level+9156
+ARGP4
+ADDRGP4 SelectSpawnPoint
+CALLP4
+pop
+ADDRGP4 $471
+JUMPV
+LABELV $470
+ADDRGP4 level+9144
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 level+9156
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $476
+ADDRLP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 G_PickTarget
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $478
+ADDRLP4 28
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ADDRGP4 level+9144
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+4
+ADDRLP4 28
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRF4
+ADDRGP4 level+9144+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8+8
+ADDRLP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+ADDRGP4 level+9144+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 8
+ARGP4
+ADDRGP4 level+9156
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+LABELV $478
+LABELV $476
+LABELV $471
+LABELV $468
+endproc FindIntermissionPoint 32 12
+export BeginIntermission
+proc BeginIntermission 8 4
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $489
+ADDRGP4 $488
+JUMPV
+LABELV $489
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $492
+ADDRGP4 AdjustTournamentScores
+CALLV
+pop
+LABELV $492
+ADDRGP4 level+9128
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 FindIntermissionPoint
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $497
+ADDRGP4 UpdateTournamentInfo
+CALLV
+pop
+ADDRGP4 SpawnModelsOnVictoryPads
+CALLV
+pop
+LABELV $497
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $503
+JUMPV
+LABELV $500
+ADDRLP4 0
+CNSTI4 808
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $505
+ADDRGP4 $501
+JUMPV
+LABELV $505
+ADDRLP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $507
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 respawn
+CALLV
+pop
+LABELV $507
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 MoveClientToIntermission
+CALLV
+pop
+LABELV $501
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $503
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $500
+ADDRGP4 SendScoreboardMessageToAllClients
+CALLV
+pop
+LABELV $488
+endproc BeginIntermission 8 4
+export ExitLevel
+proc ExitLevel 2064 12
+ADDRGP4 BotInterbreedEndMatch
+CALLV
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $510
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 0
+NEI4 $509
+ADDRGP4 RemoveTournamentLoser
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $516
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9132
+CNSTP4 0
+ASGNP4
+ADDRGP4 level+9128
+CNSTI4 0
+ASGNI4
+ADDRGP4 $509
+JUMPV
+LABELV $510
+ADDRGP4 $520
+ARGP4
+ADDRLP4 8
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 $521
+ARGP4
+ADDRLP4 1032
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 $524
+ARGP4
+ADDRLP4 2056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2056
+INDIRI4
+CNSTI4 0
+NEI4 $522
+ADDRLP4 1032
+ARGP4
+ADDRGP4 $55
+ARGP4
+ADDRLP4 2060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+CNSTI4 0
+EQI4 $522
+ADDRGP4 $520
+ARGP4
+ADDRGP4 $525
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $526
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $523
+JUMPV
+LABELV $522
+CNSTI4 2
+ARGI4
+ADDRGP4 $527
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $523
+ADDRGP4 level+9132
+CNSTP4 0
+ASGNP4
+ADDRGP4 level+9128
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+44+4
+CNSTI4 0
+ASGNI4
+ADDRGP4 level+44+8
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $537
+JUMPV
+LABELV $534
+ADDRLP4 4
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $539
+ADDRGP4 $535
+JUMPV
+LABELV $539
+ADDRLP4 4
+INDIRP4
+CNSTI4 248
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $535
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $537
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $534
+ADDRGP4 G_WriteSessionData
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $544
+JUMPV
+LABELV $541
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $546
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $546
+LABELV $542
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $544
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $541
+LABELV $509
+endproc ExitLevel 2064 12
+export G_LogPrintf
+proc G_LogPrintf 1068 24
+ADDRLP4 1024
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+DIVI4
+ASGNI4
+ADDRLP4 1044
+CNSTI4 60
+ASGNI4
+ADDRLP4 1032
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 1032
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 1056
+CNSTI4 10
+ASGNI4
+ADDRLP4 1036
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 1024
+ADDRLP4 1024
+INDIRI4
+ADDRLP4 1056
+INDIRI4
+ADDRLP4 1036
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $550
+ARGP4
+ADDRLP4 1032
+INDIRI4
+ARGI4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1024
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 1028
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 0+7
+ARGP4
+CNSTI4 1017
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRGP4 g_dedicated+12
+INDIRI4
+CNSTI4 0
+EQI4 $553
+ADDRGP4 $265
+ARGP4
+ADDRLP4 0+7
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $553
+ADDRGP4 level+20
+INDIRI4
+CNSTI4 0
+NEI4 $557
+ADDRGP4 $548
+JUMPV
+LABELV $557
+ADDRLP4 0
+ARGP4
+ADDRLP4 1064
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRGP4 level+20
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Write
+CALLV
+pop
+LABELV $548
+endproc G_LogPrintf 1068 24
+export LogExit
+proc LogExit 24 20
+ADDRGP4 $562
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 level+9124
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+CNSTI4 22
+ARGI4
+ADDRGP4 $84
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRLP4 8
+ADDRGP4 level+72
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LEI4 $566
+ADDRLP4 8
+CNSTI4 32
+ASGNI4
+LABELV $566
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $568
+ADDRGP4 $571
+ARGP4
+ADDRGP4 level+44+4
+INDIRI4
+ARGI4
+ADDRGP4 level+44+8
+INDIRI4
+ARGI4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $568
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $579
+JUMPV
+LABELV $576
+ADDRLP4 0
+CNSTI4 776
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $581
+ADDRGP4 $577
+JUMPV
+LABELV $581
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $583
+ADDRGP4 $577
+JUMPV
+LABELV $583
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+CNSTI4 999
+GEI4 $586
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $587
+JUMPV
+LABELV $586
+ADDRLP4 16
+CNSTI4 999
+ASGNI4
+LABELV $587
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $588
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+LABELV $577
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $579
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LTI4 $576
+LABELV $561
+endproc LogExit 24 20
+export CheckIntermissionExit
+proc CheckIntermissionExit 28 0
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+NEI4 $591
+ADDRGP4 $590
+JUMPV
+LABELV $591
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $597
+JUMPV
+LABELV $594
+ADDRLP4 0
+CNSTI4 776
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $599
+ADDRGP4 $595
+JUMPV
+LABELV $599
+CNSTI4 808
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $601
+ADDRGP4 $595
+JUMPV
+LABELV $601
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 644
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $605
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+GEI4 $606
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDRLP4 4
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+ADDRGP4 $606
+JUMPV
+LABELV $605
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $606
+LABELV $595
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $597
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $594
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $612
+JUMPV
+LABELV $609
+ADDRLP4 0
+CNSTI4 776
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $614
+ADDRGP4 $610
+JUMPV
+LABELV $614
+ADDRLP4 0
+INDIRP4
+CNSTI4 204
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $610
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $612
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $609
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 5000
+ADDI4
+GEI4 $616
+ADDRGP4 $590
+JUMPV
+LABELV $616
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $620
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $622
+ADDRGP4 level+9136
+CNSTI4 0
+ASGNI4
+ADDRGP4 $590
+JUMPV
+LABELV $622
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $625
+ADDRGP4 ExitLevel
+CALLV
+pop
+ADDRGP4 $590
+JUMPV
+LABELV $625
+LABELV $620
+ADDRGP4 level+9136
+INDIRI4
+CNSTI4 0
+NEI4 $627
+ADDRGP4 level+9136
+CNSTI4 1
+ASGNI4
+ADDRGP4 level+9140
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $627
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9140
+INDIRI4
+CNSTI4 10000
+ADDI4
+GEI4 $633
+ADDRGP4 $590
+JUMPV
+LABELV $633
+ADDRGP4 ExitLevel
+CALLV
+pop
+LABELV $590
+endproc CheckIntermissionExit 28 0
+export ScoreIsTied
+proc ScoreIsTied 24 0
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+GEI4 $638
+CNSTI4 0
+RETI4
+ADDRGP4 $637
+JUMPV
+LABELV $638
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LTI4 $641
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+NEI4 $649
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $650
+JUMPV
+LABELV $649
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $650
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $637
+JUMPV
+LABELV $641
+ADDRLP4 12
+CNSTI4 776
+ASGNI4
+ADDRLP4 16
+ADDRGP4 level
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 248
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ADDRGP4 level+84
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 level+84+4
+INDIRI4
+MULI4
+ADDRLP4 16
+INDIRP4
+ADDP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $655
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $656
+JUMPV
+LABELV $655
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $656
+ADDRLP4 8
+INDIRI4
+RETI4
+LABELV $637
+endproc ScoreIsTied 24 0
+export CheckExitRules
+proc CheckExitRules 20 8
+ADDRGP4 level+9128
+INDIRI4
+CNSTI4 0
+EQI4 $658
+ADDRGP4 CheckIntermissionExit
+CALLV
+pop
+ADDRGP4 $657
+JUMPV
+LABELV $658
+ADDRGP4 level+9124
+INDIRI4
+CNSTI4 0
+EQI4 $661
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+9124
+INDIRI4
+SUBI4
+CNSTI4 1000
+LTI4 $657
+ADDRGP4 level+9124
+CNSTI4 0
+ASGNI4
+ADDRGP4 BeginIntermission
+CALLV
+pop
+ADDRGP4 $657
+JUMPV
+LABELV $661
+ADDRLP4 8
+ADDRGP4 ScoreIsTied
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $669
+ADDRGP4 $657
+JUMPV
+LABELV $669
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_timelimit+12
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $671
+ADDRGP4 level+16
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $671
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+40
+INDIRI4
+SUBI4
+CNSTI4 60000
+ADDRGP4 g_timelimit+12
+INDIRI4
+MULI4
+LTI4 $675
+CNSTI4 -1
+ARGI4
+ADDRGP4 $680
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $681
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $657
+JUMPV
+LABELV $675
+LABELV $671
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+GEI4 $682
+ADDRGP4 $657
+JUMPV
+LABELV $682
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+GEI4 $685
+ADDRGP4 g_fraglimit+12
+INDIRI4
+CNSTI4 0
+EQI4 $685
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 g_fraglimit+12
+INDIRI4
+LTI4 $689
+CNSTI4 -1
+ARGI4
+ADDRGP4 $694
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $695
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $657
+JUMPV
+LABELV $689
+ADDRGP4 level+44+8
+INDIRI4
+ADDRGP4 g_fraglimit+12
+INDIRI4
+LTI4 $696
+CNSTI4 -1
+ARGI4
+ADDRGP4 $701
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $695
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $657
+JUMPV
+LABELV $696
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $705
+JUMPV
+LABELV $702
+ADDRLP4 0
+CNSTI4 776
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $707
+ADDRGP4 $703
+JUMPV
+LABELV $707
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $709
+ADDRGP4 $703
+JUMPV
+LABELV $709
+ADDRLP4 0
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ADDRGP4 g_fraglimit+12
+INDIRI4
+LTI4 $711
+ADDRGP4 $695
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $714
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $657
+JUMPV
+LABELV $711
+LABELV $703
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $705
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $702
+LABELV $685
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+LTI4 $715
+ADDRGP4 g_capturelimit+12
+INDIRI4
+CNSTI4 0
+EQI4 $715
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 g_capturelimit+12
+INDIRI4
+LTI4 $719
+CNSTI4 -1
+ARGI4
+ADDRGP4 $724
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $725
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+ADDRGP4 $657
+JUMPV
+LABELV $719
+ADDRGP4 level+44+8
+INDIRI4
+ADDRGP4 g_capturelimit+12
+INDIRI4
+LTI4 $726
+CNSTI4 -1
+ARGI4
+ADDRGP4 $731
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $725
+ARGP4
+ADDRGP4 LogExit
+CALLV
+pop
+LABELV $726
+LABELV $715
+LABELV $657
+endproc CheckExitRules 20 8
+export CheckTournament
+proc CheckTournament 32 8
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 0
+NEI4 $733
+ADDRGP4 $732
+JUMPV
+LABELV $733
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 1
+NEI4 $736
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+GEI4 $739
+ADDRGP4 AddTournamentPlayer
+CALLV
+pop
+LABELV $739
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+EQI4 $742
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 -1
+EQI4 $732
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $436
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $750
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $732
+JUMPV
+LABELV $742
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+NEI4 $751
+ADDRGP4 $732
+JUMPV
+LABELV $751
+ADDRGP4 g_warmup+4
+INDIRI4
+ADDRGP4 level+352
+INDIRI4
+EQI4 $754
+ADDRGP4 level+352
+ADDRGP4 g_warmup+4
+INDIRI4
+ASGNI4
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+LABELV $754
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+GEI4 $761
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+NEI4 $732
+ADDRGP4 g_warmup+12
+INDIRI4
+CNSTI4 1
+LEI4 $767
+ADDRLP4 0
+CNSTI4 1000
+ASGNI4
+ADDRGP4 level+16
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_warmup+12
+INDIRI4
+MULI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $768
+JUMPV
+LABELV $767
+ADDRGP4 level+16
+CNSTI4 0
+ASGNI4
+LABELV $768
+ADDRGP4 $436
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $732
+JUMPV
+LABELV $761
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+16
+INDIRI4
+LEI4 $737
+ADDRLP4 0
+ADDRGP4 level+16
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+ADDRGP4 $60
+ARGP4
+ADDRGP4 $84
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $516
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+68
+CNSTI4 1
+ASGNI4
+ADDRGP4 $732
+JUMPV
+LABELV $736
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 2
+EQI4 $781
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+EQI4 $781
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+LEI4 $785
+CNSTI4 -1
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRLP4 20
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 4+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+CNSTI4 -1
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRLP4 24
+ADDRGP4 TeamCount
+CALLI4
+ASGNI4
+ADDRLP4 4+4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRLP4 4+4
+INDIRI4
+ADDRLP4 28
+INDIRI4
+LTI4 $794
+ADDRLP4 4+8
+INDIRI4
+ADDRLP4 28
+INDIRI4
+GEI4 $786
+LABELV $794
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $786
+JUMPV
+LABELV $785
+ADDRGP4 level+80
+INDIRI4
+CNSTI4 2
+GEI4 $795
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $795
+LABELV $786
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $798
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 -1
+EQI4 $732
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $436
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $750
+ARGP4
+ADDRGP4 G_LogPrintf
+CALLV
+pop
+ADDRGP4 $732
+JUMPV
+LABELV $798
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+NEI4 $805
+ADDRGP4 $732
+JUMPV
+LABELV $805
+ADDRGP4 g_warmup+4
+INDIRI4
+ADDRGP4 level+352
+INDIRI4
+EQI4 $808
+ADDRGP4 level+352
+ADDRGP4 g_warmup+4
+INDIRI4
+ASGNI4
+ADDRGP4 level+16
+CNSTI4 -1
+ASGNI4
+LABELV $808
+ADDRGP4 level+16
+INDIRI4
+CNSTI4 0
+GEI4 $815
+ADDRLP4 20
+CNSTI4 1000
+ASGNI4
+ADDRGP4 level+16
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDRGP4 g_warmup+12
+INDIRI4
+MULI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $436
+ARGP4
+ADDRGP4 level+16
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 5
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+ADDRGP4 $732
+JUMPV
+LABELV $815
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+16
+INDIRI4
+LEI4 $822
+ADDRLP4 20
+ADDRGP4 level+16
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 10000
+ADDI4
+ASGNI4
+ADDRGP4 $60
+ARGP4
+ADDRGP4 $84
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $516
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 level+68
+CNSTI4 1
+ASGNI4
+LABELV $822
+LABELV $781
+LABELV $737
+LABELV $732
+endproc CheckTournament 32 8
+export CheckVote
+proc CheckVote 4 8
+ADDRGP4 level+2408
+INDIRI4
+CNSTI4 0
+EQI4 $829
+ADDRGP4 level+2408
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+GEI4 $829
+ADDRGP4 level+2408
+CNSTI4 0
+ASGNI4
+ADDRGP4 $835
+ARGP4
+ADDRGP4 level+356
+ARGP4
+ADDRLP4 0
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+LABELV $829
+ADDRGP4 level+2404
+INDIRI4
+CNSTI4 0
+NEI4 $837
+ADDRGP4 $828
+JUMPV
+LABELV $837
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+2404
+INDIRI4
+SUBI4
+CNSTI4 30000
+LTI4 $840
+CNSTI4 -1
+ARGI4
+ADDRGP4 $844
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $841
+JUMPV
+LABELV $840
+ADDRGP4 level+2412
+INDIRI4
+ADDRGP4 level+2420
+INDIRI4
+CNSTI4 2
+DIVI4
+LEI4 $845
+CNSTI4 -1
+ARGI4
+ADDRGP4 $849
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 level+2408
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 3000
+ADDI4
+ASGNI4
+ADDRGP4 $846
+JUMPV
+LABELV $845
+ADDRGP4 level+2416
+INDIRI4
+ADDRGP4 level+2420
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $828
+CNSTI4 -1
+ARGI4
+ADDRGP4 $844
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $853
+LABELV $846
+LABELV $841
+ADDRGP4 level+2404
+CNSTI4 0
+ASGNI4
+CNSTI4 8
+ARGI4
+ADDRGP4 $55
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $828
+endproc CheckVote 4 8
+export PrintTeam
+proc PrintTeam 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $861
+JUMPV
+LABELV $858
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $863
+ADDRGP4 $859
+JUMPV
+LABELV $863
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $859
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $861
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $858
+LABELV $857
+endproc PrintTeam 4 8
+export SetLeader
+proc SetLeader 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+CNSTI4 776
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $866
+ADDRGP4 $868
+ARGP4
+CNSTI4 776
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintTeam
+CALLV
+pop
+ADDRGP4 $865
+JUMPV
+LABELV $866
+CNSTI4 776
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $869
+ADDRGP4 $871
+ARGP4
+CNSTI4 776
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintTeam
+CALLV
+pop
+ADDRGP4 $865
+JUMPV
+LABELV $869
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $875
+JUMPV
+LABELV $872
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $877
+ADDRGP4 $873
+JUMPV
+LABELV $877
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 640
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $879
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 640
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+LABELV $879
+LABELV $873
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $875
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $872
+CNSTI4 776
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 640
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 ClientUserinfoChanged
+CALLV
+pop
+ADDRGP4 $881
+ARGP4
+CNSTI4 776
+ADDRFP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintTeam
+CALLV
+pop
+LABELV $865
+endproc SetLeader 8 8
+export CheckTeamLeader
+proc CheckTeamLeader 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $886
+JUMPV
+LABELV $883
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $888
+ADDRGP4 $884
+JUMPV
+LABELV $888
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 640
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $890
+ADDRGP4 $885
+JUMPV
+LABELV $890
+LABELV $884
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $886
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $883
+LABELV $885
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $892
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $898
+JUMPV
+LABELV $895
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $900
+ADDRGP4 $896
+JUMPV
+LABELV $900
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities+208+216
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+NEI4 $902
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 640
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $897
+JUMPV
+LABELV $902
+LABELV $896
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $898
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $895
+LABELV $897
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $909
+JUMPV
+LABELV $906
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $911
+ADDRGP4 $907
+JUMPV
+LABELV $911
+CNSTI4 776
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+CNSTI4 640
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $908
+JUMPV
+LABELV $907
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $909
+ADDRLP4 0
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $906
+LABELV $908
+LABELV $892
+LABELV $882
+endproc CheckTeamLeader 4 0
+export CheckTeamVote
+proc CheckTeamVote 20 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $914
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $915
+JUMPV
+LABELV $914
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $913
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $917
+LABELV $915
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4472
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $918
+ADDRGP4 $913
+JUMPV
+LABELV $918
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4472
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 30000
+LTI4 $921
+CNSTI4 -1
+ARGI4
+ADDRGP4 $925
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $922
+JUMPV
+LABELV $921
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+4480
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDRGP4 level+4496
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+DIVI4
+LEI4 $926
+CNSTI4 -1
+ARGI4
+ADDRGP4 $930
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+ADDRGP4 $933
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 level+2424
+ADDP4
+ARGP4
+CNSTI4 6
+ARGI4
+ADDRLP4 12
+ADDRGP4 Q_strncmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $931
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 level+2424+7
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 SetLeader
+CALLV
+pop
+ADDRGP4 $927
+JUMPV
+LABELV $931
+ADDRGP4 $835
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LSHI4
+ADDRGP4 level+2424
+ADDP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+ADDRGP4 $927
+JUMPV
+LABELV $926
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+4488
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 level+4496
+ADDP4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+DIVI4
+LTI4 $913
+CNSTI4 -1
+ARGI4
+ADDRGP4 $925
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $939
+LABELV $927
+LABELV $922
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+4472
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+ADDI4
+ARGI4
+ADDRGP4 $55
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $913
+endproc CheckTeamVote 20 12
+data
+align 4
+LABELV $944
+byte 4 -1
+export CheckCvars
+code
+proc CheckCvars 4 8
+ADDRGP4 g_password+4
+INDIRI4
+ADDRGP4 $944
+INDIRI4
+EQI4 $945
+ADDRGP4 $944
+ADDRGP4 g_password+4
+INDIRI4
+ASGNI4
+ADDRGP4 g_password+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $949
+ADDRGP4 g_password+16
+ARGP4
+ADDRGP4 $953
+ARGP4
+ADDRLP4 0
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $949
+ADDRGP4 $85
+ARGP4
+ADDRGP4 $84
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $950
+JUMPV
+LABELV $949
+ADDRGP4 $85
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $950
+LABELV $945
+LABELV $943
+endproc CheckCvars 4 8
+export G_RunThink
+proc G_RunThink 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GTF4 $955
+ADDRGP4 $954
+JUMPV
+LABELV $955
+ADDRLP4 0
+INDIRF4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+LEF4 $957
+ADDRGP4 $954
+JUMPV
+LABELV $957
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $960
+ADDRGP4 $962
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $960
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $954
+endproc G_RunThink 8 4
+export G_RunFrame
+proc G_RunFrame 44 12
+ADDRGP4 level+68
+INDIRI4
+CNSTI4 0
+EQI4 $964
+ADDRGP4 $963
+JUMPV
+LABELV $964
+ADDRLP4 20
+ADDRGP4 level+28
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 level+36
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 level+32
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+36
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 G_UpdateCvars
+CALLV
+pop
+ADDRLP4 24
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $976
+JUMPV
+LABELV $973
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $978
+ADDRGP4 $974
+JUMPV
+LABELV $978
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 552
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 300
+LEI4 $980
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $983
+ADDRLP4 0
+INDIRP4
+CNSTI4 180
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $985
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 128
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $985
+LABELV $983
+ADDRLP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $987
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $974
+JUMPV
+LABELV $987
+ADDRLP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $989
+ADDRLP4 0
+INDIRP4
+CNSTI4 560
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+LABELV $989
+LABELV $980
+ADDRLP4 0
+INDIRP4
+CNSTI4 556
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $991
+ADDRGP4 $974
+JUMPV
+LABELV $991
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 416
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $993
+ADDRLP4 0
+INDIRP4
+CNSTI4 532
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+EQI4 $993
+ADDRGP4 $974
+JUMPV
+LABELV $993
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $995
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunMissile
+CALLV
+pop
+ADDRGP4 $974
+JUMPV
+LABELV $995
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $999
+ADDRLP4 0
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $997
+LABELV $999
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunItem
+CALLV
+pop
+ADDRGP4 $974
+JUMPV
+LABELV $997
+ADDRLP4 40
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $1000
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunMover
+CALLV
+pop
+ADDRGP4 $974
+JUMPV
+LABELV $1000
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+GEI4 $1002
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunClient
+CALLV
+pop
+ADDRGP4 $974
+JUMPV
+LABELV $1002
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunThink
+CALLV
+pop
+LABELV $974
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ASGNP4
+LABELV $976
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $973
+ADDRLP4 28
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 g_entities
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1007
+JUMPV
+LABELV $1004
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $1009
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ClientEndFrame
+CALLV
+pop
+LABELV $1009
+LABELV $1005
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ASGNP4
+LABELV $1007
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $1004
+ADDRLP4 36
+ADDRGP4 trap_Milliseconds
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 CheckTournament
+CALLV
+pop
+ADDRGP4 CheckExitRules
+CALLV
+pop
+ADDRGP4 CheckTeamStatus
+CALLV
+pop
+ADDRGP4 CheckVote
+CALLV
+pop
+CNSTI4 1
+ARGI4
+ADDRGP4 CheckTeamVote
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 CheckTeamVote
+CALLV
+pop
+ADDRGP4 CheckCvars
+CALLV
+pop
+ADDRGP4 g_listEntity+12
+INDIRI4
+CNSTI4 0
+EQI4 $1011
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $1014
+ADDRGP4 $1018
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 808
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities+524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $1015
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1024
+LTI4 $1014
+ADDRGP4 $111
+ARGP4
+ADDRGP4 $61
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $1011
+LABELV $963
+endproc G_RunFrame 44 12
+bss
+export g_listEntity
+align 4
+LABELV g_listEntity
+skip 272
+export g_podiumDrop
+align 4
+LABELV g_podiumDrop
+skip 272
+export g_podiumDist
+align 4
+LABELV g_podiumDist
+skip 272
+export g_logfileSync
+align 4
+LABELV g_logfileSync
+skip 272
+export g_logfile
+align 4
+LABELV g_logfile
+skip 272
+export g_clients
+align 4
+LABELV g_clients
+skip 49664
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+export g_rankings
+align 4
+LABELV g_rankings
+skip 272
+export pmove_msec
+align 4
+LABELV pmove_msec
+skip 272
+export pmove_fixed
+align 4
+LABELV pmove_fixed
+skip 272
+export g_smoothClients
+align 4
+LABELV g_smoothClients
+skip 272
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+export g_filterBan
+align 4
+LABELV g_filterBan
+skip 272
+export g_banIPs
+align 4
+LABELV g_banIPs
+skip 272
+export g_teamForceBalance
+align 4
+LABELV g_teamForceBalance
+skip 272
+export g_teamAutoJoin
+align 4
+LABELV g_teamAutoJoin
+skip 272
+export g_allowVote
+align 4
+LABELV g_allowVote
+skip 272
+export g_blood
+align 4
+LABELV g_blood
+skip 272
+export g_doWarmup
+align 4
+LABELV g_doWarmup
+skip 272
+export g_warmup
+align 4
+LABELV g_warmup
+skip 272
+export g_motd
+align 4
+LABELV g_motd
+skip 272
+export g_synchronousClients
+align 4
+LABELV g_synchronousClients
+skip 272
+export g_weaponTeamRespawn
+align 4
+LABELV g_weaponTeamRespawn
+skip 272
+export g_weaponRespawn
+align 4
+LABELV g_weaponRespawn
+skip 272
+export g_debugDamage
+align 4
+LABELV g_debugDamage
+skip 272
+export g_debugAlloc
+align 4
+LABELV g_debugAlloc
+skip 272
+export g_debugMove
+align 4
+LABELV g_debugMove
+skip 272
+export g_inactivity
+align 4
+LABELV g_inactivity
+skip 272
+export g_forcerespawn
+align 4
+LABELV g_forcerespawn
+skip 272
+export g_quadfactor
+align 4
+LABELV g_quadfactor
+skip 272
+export g_knockback
+align 4
+LABELV g_knockback
+skip 272
+export g_speed
+align 4
+LABELV g_speed
+skip 272
+export g_gravity
+align 4
+LABELV g_gravity
+skip 272
+export g_needpass
+align 4
+LABELV g_needpass
+skip 272
+export g_password
+align 4
+LABELV g_password
+skip 272
+export g_friendlyFire
+align 4
+LABELV g_friendlyFire
+skip 272
+export g_capturelimit
+align 4
+LABELV g_capturelimit
+skip 272
+export g_timelimit
+align 4
+LABELV g_timelimit
+skip 272
+export g_fraglimit
+align 4
+LABELV g_fraglimit
+skip 272
+export g_dmflags
+align 4
+LABELV g_dmflags
+skip 272
+export g_restarted
+align 4
+LABELV g_restarted
+skip 272
+export g_maxGameClients
+align 4
+LABELV g_maxGameClients
+skip 272
+export g_maxclients
+align 4
+LABELV g_maxclients
+skip 272
+export g_cheats
+align 4
+LABELV g_cheats
+skip 272
+export g_dedicated
+align 4
+LABELV g_dedicated
+skip 272
+export g_gametype
+align 4
+LABELV g_gametype
+skip 272
+export g_entities
+align 4
+LABELV g_entities
+skip 827392
+export level
+align 4
+LABELV level
+skip 9212
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import DeathmatchScoreboardMessage
+import G_SetStats
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import G_RunMissile
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1018
+byte 1 37
+byte 1 52
+byte 1 105
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $962
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 45
+byte 1 62
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 110
+byte 1 107
+byte 1 0
+align 1
+LABELV $953
+byte 1 110
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 0
+align 1
+LABELV $933
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $930
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $925
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 118
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $881
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 119
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $871
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 121
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $868
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $849
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $844
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $835
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $750
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $731
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $725
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $724
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $714
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $701
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $695
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $694
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $681
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 0
+align 1
+LABELV $680
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 46
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $588
+byte 1 115
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $571
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $562
+byte 1 69
+byte 1 120
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $550
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 58
+byte 1 37
+byte 1 105
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 0
+align 1
+LABELV $527
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 10
+byte 1 0
+align 1
+LABELV $526
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $525
+byte 1 118
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 32
+byte 1 100
+byte 1 50
+byte 1 0
+align 1
+LABELV $524
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 48
+byte 1 0
+align 1
+LABELV $521
+byte 1 100
+byte 1 49
+byte 1 0
+align 1
+LABELV $520
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $516
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $469
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $436
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $302
+byte 1 115
+byte 1 0
+align 1
+LABELV $293
+byte 1 102
+byte 1 0
+align 1
+LABELV $265
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $259
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 10
+byte 1 0
+align 1
+LABELV $255
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 32
+byte 1 83
+byte 1 104
+byte 1 117
+byte 1 116
+byte 1 100
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 61
+byte 1 10
+byte 1 0
+align 1
+LABELV $253
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $250
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $249
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 103
+byte 1 117
+byte 1 114
+byte 1 112
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $248
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 98
+byte 1 106
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 47
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 52
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $246
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 83
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $242
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $226
+byte 1 78
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 107
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $225
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $224
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $222
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 117
+byte 1 108
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $207
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 121
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $203
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $202
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $201
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 32
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 122
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 10
+byte 1 0
+align 1
+LABELV $195
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 34
+byte 1 0
+align 1
+LABELV $180
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 44
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $162
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $115
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 97
+byte 1 110
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $114
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 115
+byte 1 101
+byte 1 99
+byte 1 0
+align 1
+LABELV $113
+byte 1 112
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 120
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $112
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 109
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 104
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $111
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 69
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $110
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 86
+byte 1 111
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $109
+byte 1 55
+byte 1 48
+byte 1 0
+align 1
+LABELV $108
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 68
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $107
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $106
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $105
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 0
+align 1
+LABELV $104
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 116
+byte 1 100
+byte 1 0
+align 1
+LABELV $103
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 0
+align 1
+LABELV $102
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 68
+byte 1 97
+byte 1 109
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $101
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 0
+align 1
+LABELV $100
+byte 1 103
+byte 1 95
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $99
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $98
+byte 1 51
+byte 1 48
+byte 1 0
+align 1
+LABELV $97
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $96
+byte 1 53
+byte 1 0
+align 1
+LABELV $95
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $94
+byte 1 51
+byte 1 0
+align 1
+LABELV $93
+byte 1 103
+byte 1 95
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 100
+byte 1 102
+byte 1 97
+byte 1 99
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $92
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $91
+byte 1 103
+byte 1 95
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $90
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $89
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 114
+byte 1 97
+byte 1 118
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $88
+byte 1 51
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $87
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $86
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $85
+byte 1 103
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 0
+align 1
+LABELV $84
+byte 1 49
+byte 1 0
+align 1
+LABELV $83
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 66
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $82
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 80
+byte 1 115
+byte 1 0
+align 1
+LABELV $81
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 100
+byte 1 0
+align 1
+LABELV $80
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 0
+align 1
+LABELV $79
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $78
+byte 1 103
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 0
+align 1
+LABELV $77
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 111
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $76
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 109
+byte 1 117
+byte 1 112
+byte 1 0
+align 1
+LABELV $75
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 66
+byte 1 97
+byte 1 108
+byte 1 97
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 0
+align 1
+LABELV $74
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 65
+byte 1 117
+byte 1 116
+byte 1 111
+byte 1 74
+byte 1 111
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $73
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $72
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 121
+byte 1 110
+byte 1 99
+byte 1 104
+byte 1 114
+byte 1 111
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 115
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $71
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $70
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $69
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $68
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $67
+byte 1 100
+byte 1 109
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 115
+byte 1 0
+align 1
+LABELV $66
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $65
+byte 1 56
+byte 1 0
+align 1
+LABELV $64
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $63
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $62
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $61
+byte 1 48
+byte 1 0
+align 1
+LABELV $60
+byte 1 103
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $59
+byte 1 79
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 49
+byte 1 56
+byte 1 32
+byte 1 50
+byte 1 48
+byte 1 50
+byte 1 54
+byte 1 0
+align 1
+LABELV $58
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $57
+byte 1 98
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 113
+byte 1 51
+byte 1 0
+align 1
+LABELV $56
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $55
+byte 1 0
+align 1
+LABELV $54
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 0
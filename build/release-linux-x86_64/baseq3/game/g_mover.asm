@@ -0,0 +1,8386 @@
+export G_TestEntityPosition
+code
+proc G_TestEntityPosition 68 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $55
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 572
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $56
+JUMPV
+LABELV $55
+ADDRLP4 56
+CNSTI4 1
+ASGNI4
+LABELV $56
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $57
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRGP4 $58
+JUMPV
+LABELV $57
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 56
+INDIRI4
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+LABELV $58
+ADDRLP4 0+4
+INDIRI4
+CNSTI4 0
+EQI4 $59
+CNSTI4 808
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+RETP4
+ADDRGP4 $54
+JUMPV
+LABELV $59
+CNSTP4 0
+RETP4
+LABELV $54
+endproc G_TestEntityPosition 68 28
+export G_CreateRotationMatrix
+proc G_CreateRotationMatrix 4 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 VectorInverse
+CALLV
+pop
+LABELV $63
+endproc G_CreateRotationMatrix 4 16
+export G_TransposeMatrix
+proc G_TransposeMatrix 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $65
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $69
+ADDRLP4 12
+CNSTI4 2
+ASGNI4
+ADDRLP4 16
+CNSTI4 12
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $70
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $69
+LABELV $66
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $65
+LABELV $64
+endproc G_TransposeMatrix 24 0
+export G_RotatePoint
+proc G_RotatePoint 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $73
+endproc G_RotatePoint 28 0
+export G_TryPushingEntity
+proc G_TryPushingEntity 172 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $81
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+EQI4 $81
+CNSTI4 0
+RETI4
+ADDRGP4 $80
+JUMPV
+LABELV $81
+ADDRGP4 pushed_p
+INDIRP4
+CVPU4 4
+ADDRGP4 pushed+32768
+CVPU4 4
+LEU4 $83
+ADDRGP4 $86
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $83
+ADDRGP4 pushed_p
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 pushed_p
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 pushed_p
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $87
+ADDRGP4 pushed_p
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 pushed_p
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $87
+ADDRLP4 116
+ADDRGP4 pushed_p
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRGP4 G_CreateRotationMatrix
+CALLV
+pop
+ADDRLP4 76
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRGP4 G_TransposeMatrix
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $89
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 120
+INDIRP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 120
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $90
+JUMPV
+LABELV $89
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $90
+ADDRLP4 24
+ADDRLP4 12
+INDIRB
+ASGNB 12
+ADDRLP4 24
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRGP4 G_RotatePoint
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ADDRLP4 12
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 24+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 120
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 124
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 128
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 132
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 136
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $103
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 144
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTF4 1199570944
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+CNSTF4 1135869952
+DIVF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+ADDI4
+ASGNI4
+LABELV $103
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+EQI4 $107
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 -1
+ASGNI4
+LABELV $107
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 G_TestEntityPosition
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $109
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $111
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRB
+ASGNB 12
+ADDRGP4 $112
+JUMPV
+LABELV $111
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $112
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $80
+JUMPV
+LABELV $109
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRGP4 pushed_p
+INDIRP4
+CNSTI4 -28
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $113
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 pushed_p
+INDIRP4
+CNSTI4 -28
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $113
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRGP4 pushed_p
+INDIRP4
+CNSTI4 -16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 G_TestEntityPosition
+CALLP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 148
+INDIRP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $115
+ADDRFP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRLP4 152
+ADDRGP4 pushed_p
+ASGNP4
+ADDRLP4 152
+INDIRP4
+ADDRLP4 152
+INDIRP4
+INDIRP4
+CNSTI4 -32
+ADDP4
+ASGNP4
+CNSTI4 1
+RETI4
+ADDRGP4 $80
+JUMPV
+LABELV $115
+CNSTI4 0
+RETI4
+LABELV $80
+endproc G_TryPushingEntity 172 8
+export G_CheckProxMinePosition
+proc G_CheckProxMinePosition 108 28
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 84
+CNSTF4 1040187392
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 1040187392
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 96
+CNSTF4 1073741824
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRLP4 96
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+CNSTF4 1073741824
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 104
+CNSTP4 0
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 24+4
+INDIRI4
+CNSTI4 0
+NEI4 $126
+ADDRLP4 24+8
+INDIRF4
+CNSTF4 1065353216
+GEF4 $122
+LABELV $126
+CNSTI4 0
+RETI4
+ADDRGP4 $117
+JUMPV
+LABELV $122
+CNSTI4 1
+RETI4
+LABELV $117
+endproc G_CheckProxMinePosition 108 28
+export G_TryPushingProxMine
+proc G_TryPushingProxMine 124 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 100
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 100
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 36+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 36+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 100
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 48+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 48+8
+INDIRF4
+MULF4
+ADDF4
+NEGF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 0
+INDIRF4
+ADDRLP4 60
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 60+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 60+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 12
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 12+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+ADDRLP4 24+4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+ADDRLP4 24+8
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 116
+ADDRGP4 G_CheckProxMinePosition
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $156
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $156
+ADDRLP4 72
+INDIRI4
+RETI4
+LABELV $127
+endproc G_TryPushingProxMine 124 16
+export G_MoverPush
+proc G_MoverPush 4240 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4168
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+ADDRLP4 4168
+INDIRF4
+NEF4 $165
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+ADDRLP4 4168
+INDIRF4
+NEF4 $165
+ADDRFP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRF4
+ADDRLP4 4168
+INDIRF4
+NEF4 $165
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 4168
+INDIRF4
+NEF4 $165
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 4168
+INDIRF4
+NEF4 $165
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 4168
+INDIRF4
+EQF4 $159
+LABELV $165
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ARGP4
+ADDRLP4 4184
+ADDRGP4 RadiusFromBounds
+CALLF4
+ASGNF4
+ADDRLP4 4176
+ADDRLP4 4184
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $166
+ADDRLP4 4188
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4188
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 4188
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4188
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 4176
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4192
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4192
+INDIRI4
+ADDRLP4 28
+ADDP4
+ADDRLP4 4192
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4192
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 4176
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4196
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4196
+INDIRI4
+ADDRLP4 4140
+ADDP4
+ADDRLP4 4196
+INDIRI4
+ADDRLP4 16
+ADDP4
+INDIRF4
+ADDRLP4 4196
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4200
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4200
+INDIRI4
+ADDRLP4 4152
+ADDP4
+ADDRLP4 4200
+INDIRI4
+ADDRLP4 28
+ADDP4
+INDIRF4
+ADDRLP4 4200
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $167
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $166
+ADDRGP4 $160
+JUMPV
+LABELV $159
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $170
+ADDRLP4 4176
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4176
+INDIRI4
+ADDRLP4 16
+ADDP4
+ADDRLP4 4176
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4176
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4180
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 28
+ADDP4
+ADDRLP4 4180
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 4180
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $171
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $170
+ADDRLP4 4140
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4152
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $174
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $178
+ADDRLP4 4180
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4184
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 4152
+ADDP4
+ASGNP4
+ADDRLP4 4184
+INDIRP4
+ADDRLP4 4184
+INDIRP4
+INDIRF4
+ADDRLP4 4180
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRGP4 $179
+JUMPV
+LABELV $178
+ADDRLP4 4180
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4184
+ADDRLP4 4180
+INDIRI4
+ADDRLP4 4140
+ADDP4
+ASGNP4
+ADDRLP4 4184
+INDIRP4
+ADDRLP4 4184
+INDIRP4
+INDIRF4
+ADDRLP4 4180
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $179
+LABELV $175
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $174
+LABELV $160
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRLP4 4140
+ARGP4
+ADDRLP4 4152
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 4176
+ADDRGP4 trap_EntitiesInBox
+CALLI4
+ASGNI4
+ADDRLP4 4136
+ADDRLP4 4176
+INDIRI4
+ASGNI4
+ADDRLP4 4180
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ASGNP4
+ADDRLP4 4180
+INDIRP4
+ADDRLP4 4180
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4184
+ADDRFP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+ASGNP4
+ADDRLP4 4184
+INDIRP4
+ADDRLP4 4184
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4188
+ADDRFP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+ASGNP4
+ADDRLP4 4188
+INDIRP4
+ADDRLP4 4188
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4192
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+ASGNP4
+ADDRLP4 4192
+INDIRP4
+ADDRLP4 4192
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4196
+ADDRFP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+ASGNP4
+ADDRLP4 4196
+INDIRP4
+ADDRLP4 4196
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4200
+ADDRFP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+ASGNP4
+ADDRLP4 4200
+INDIRP4
+ADDRLP4 4200
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRGP4 $183
+JUMPV
+LABELV $180
+ADDRLP4 8
+CNSTI4 808
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 40
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 4208
+ADDRLP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4208
+INDIRI4
+CNSTI4 2
+EQI4 $184
+ADDRLP4 4208
+INDIRI4
+CNSTI4 1
+EQI4 $184
+ADDRLP4 8
+INDIRP4
+CNSTI4 564
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $184
+ADDRGP4 $181
+JUMPV
+LABELV $184
+ADDRLP4 8
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+EQI4 $186
+ADDRLP4 8
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRF4
+ADDRLP4 28
+INDIRF4
+GEF4 $198
+ADDRLP4 8
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRF4
+ADDRLP4 28+4
+INDIRF4
+GEF4 $198
+ADDRLP4 8
+INDIRP4
+CNSTI4 472
+ADDP4
+INDIRF4
+ADDRLP4 28+8
+INDIRF4
+GEF4 $198
+ADDRLP4 8
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LEF4 $198
+ADDRLP4 8
+INDIRP4
+CNSTI4 480
+ADDP4
+INDIRF4
+ADDRLP4 16+4
+INDIRF4
+LEF4 $198
+ADDRLP4 8
+INDIRP4
+CNSTI4 484
+ADDP4
+INDIRF4
+ADDRLP4 16+8
+INDIRF4
+GTF4 $188
+LABELV $198
+ADDRGP4 $181
+JUMPV
+LABELV $188
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4216
+ADDRGP4 G_TestEntityPosition
+CALLP4
+ASGNP4
+ADDRLP4 4216
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $199
+ADDRGP4 $181
+JUMPV
+LABELV $199
+LABELV $186
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4212
+ADDRGP4 G_TryPushingEntity
+CALLI4
+ASGNI4
+ADDRLP4 4212
+INDIRI4
+CNSTI4 0
+EQI4 $201
+ADDRGP4 $181
+JUMPV
+LABELV $201
+ADDRLP4 4220
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4220
+INDIRI4
+EQI4 $205
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ADDRLP4 4220
+INDIRI4
+NEI4 $203
+LABELV $205
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4228
+CNSTP4 0
+ASGNP4
+ADDRLP4 4228
+INDIRP4
+ARGP4
+ADDRLP4 4228
+INDIRP4
+ARGP4
+CNSTI4 99999
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 17
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRGP4 $181
+JUMPV
+LABELV $203
+ADDRFP4 12
+INDIRP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 pushed_p
+INDIRP4
+CNSTI4 -32
+ADDP4
+ASGNP4
+ADDRGP4 $209
+JUMPV
+LABELV $206
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $210
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $210
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $207
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -32
+ADDP4
+ASGNP4
+LABELV $209
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 pushed
+CVPU4 4
+GEU4 $206
+CNSTI4 0
+RETI4
+ADDRGP4 $158
+JUMPV
+LABELV $181
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $183
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4136
+INDIRI4
+LTI4 $180
+CNSTI4 1
+RETI4
+LABELV $158
+endproc G_MoverPush 4240 32
+export G_MoverTeam
+proc G_MoverTeam 72 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 52
+CNSTP4 0
+ASGNP4
+ADDRGP4 pushed_p
+ADDRGP4 pushed
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $216
+JUMPV
+LABELV $213
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRLP4 28
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRLP4 40
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 28+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRLP4 28+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 40
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 40+4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 504
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+ADDRLP4 40+8
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 508
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRLP4 64
+ADDRGP4 G_MoverPush
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 0
+NEI4 $227
+ADDRGP4 $215
+JUMPV
+LABELV $227
+LABELV $214
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $216
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $213
+LABELV $215
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $229
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $234
+JUMPV
+LABELV $231
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+36
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+36
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+ARGP4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $232
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $234
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $231
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $212
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $212
+JUMPV
+LABELV $229
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $246
+JUMPV
+LABELV $243
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $247
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ADDI4
+LTI4 $249
+ADDRLP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $252
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $252
+LABELV $249
+LABELV $247
+LABELV $244
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $246
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $243
+LABELV $212
+endproc G_MoverTeam 72 16
+export G_RunMover
+proc G_RunMover 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $255
+ADDRGP4 $254
+JUMPV
+LABELV $255
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $259
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $257
+LABELV $259
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_MoverTeam
+CALLV
+pop
+LABELV $257
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_RunThink
+CALLV
+pop
+LABELV $254
+endproc G_RunMover 8 4
+export SetMoverState
+proc SetMoverState 64 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $261
+ADDRLP4 16
+INDIRI4
+CNSTI4 3
+GTI4 $261
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $276
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $276
+address $264
+address $265
+address $266
+address $271
+code
+LABELV $264
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $262
+JUMPV
+LABELV $265
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $262
+JUMPV
+LABELV $266
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1148846080
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 3
+ASGNI4
+ADDRGP4 $262
+JUMPV
+LABELV $271
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1148846080
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $261
+LABELV $262
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRGP4 BG_EvaluateTrajectory
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $260
+endproc SetMoverState 64 12
+export MatchTeam
+proc MatchTeam 4 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $282
+JUMPV
+LABELV $279
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 SetMoverState
+CALLV
+pop
+LABELV $280
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $282
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $279
+LABELV $278
+endproc MatchTeam 4 12
+export ReturnToPos1
+proc ReturnToPos1 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRGP4 MatchTeam
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $285
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 45
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+LABELV $285
+LABELV $283
+endproc ReturnToPos1 8 12
+export Reached_BinaryMover
+proc Reached_BinaryMover 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $288
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRGP4 SetMoverState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $291
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 45
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+LABELV $291
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRGP4 ReturnToPos1
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $294
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+LABELV $294
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_UseTargets
+CALLV
+pop
+ADDRGP4 $289
+JUMPV
+LABELV $288
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $296
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRGP4 SetMoverState
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $299
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 45
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+LABELV $299
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 8
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $303
+ADDRLP4 8
+INDIRU4
+CNSTU4 0
+NEU4 $297
+LABELV $303
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_AdjustAreaPortalState
+CALLV
+pop
+ADDRGP4 $297
+JUMPV
+LABELV $296
+ADDRGP4 $304
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $297
+LABELV $289
+LABELV $287
+endproc Reached_BinaryMover 12 12
+export Use_BinaryMover
+proc Use_BinaryMover 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+EQI4 $306
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Use_BinaryMover
+CALLV
+pop
+ADDRGP4 $305
+JUMPV
+LABELV $306
+ADDRFP4 0
+INDIRP4
+CNSTI4 772
+ADDP4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $308
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 50
+ADDI4
+ARGI4
+ADDRGP4 MatchTeam
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $311
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 45
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+LABELV $311
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 780
+ADDP4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 16
+INDIRU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+EQU4 $315
+ADDRLP4 16
+INDIRU4
+CNSTU4 0
+NEU4 $305
+LABELV $315
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_AdjustAreaPortalState
+CALLV
+pop
+ADDRGP4 $305
+JUMPV
+LABELV $308
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $316
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $305
+JUMPV
+LABELV $316
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $319
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $322
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $322
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+SUBI4
+ARGI4
+ADDRGP4 MatchTeam
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $305
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 45
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 $305
+JUMPV
+LABELV $319
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $327
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRGP4 level+32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+LEI4 $330
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $330
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+SUBI4
+ARGI4
+ADDRGP4 MatchTeam
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $305
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 45
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+LABELV $327
+LABELV $305
+endproc Use_BinaryMover 20 12
+export InitMover
+proc InitMover 100 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $336
+ADDRFP4 0
+INDIRP4
+CNSTI4 544
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 G_ModelIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 164
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $336
+ADDRGP4 $340
+ARGP4
+ADDRGP4 $341
+ARGP4
+ADDRLP4 40
+ARGP4
+ADDRLP4 44
+ADDRGP4 G_SpawnString
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+EQI4 $338
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+LABELV $338
+ADDRGP4 $342
+ARGP4
+ADDRGP4 $341
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 48
+ADDRGP4 G_SpawnFloat
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $343
+ARGP4
+ADDRGP4 $344
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 52
+ADDRGP4 G_SpawnVector
+CALLI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $347
+ADDRLP4 32
+INDIRI4
+ADDRLP4 56
+INDIRI4
+EQI4 $345
+LABELV $347
+ADDRLP4 60
+CNSTF4 1132396544
+ADDRLP4 12
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 255
+LEI4 $348
+ADDRLP4 60
+CNSTI4 255
+ASGNI4
+LABELV $348
+ADDRLP4 64
+CNSTF4 1132396544
+ADDRLP4 12+4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 255
+LEI4 $351
+ADDRLP4 64
+CNSTI4 255
+ASGNI4
+LABELV $351
+ADDRLP4 68
+CNSTF4 1132396544
+ADDRLP4 12+8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 255
+LEI4 $354
+ADDRLP4 68
+CNSTI4 255
+ASGNI4
+LABELV $354
+ADDRLP4 72
+ADDRLP4 36
+INDIRF4
+CNSTF4 1082130432
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 255
+LEI4 $356
+ADDRLP4 72
+CNSTI4 255
+ASGNI4
+LABELV $356
+ADDRFP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ADDRLP4 60
+INDIRI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 8
+LSHI4
+BORI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 16
+LSHI4
+BORI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 24
+LSHI4
+BORI4
+ASGNI4
+LABELV $345
+ADDRFP4 0
+INDIRP4
+CNSTI4 708
+ADDP4
+ADDRGP4 Use_BinaryMover
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+ADDRGP4 Reached_BinaryMover
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+CNSTI4 128
+ASGNI4
+ADDRLP4 60
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 80
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 80
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $360
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+LABELV $360
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0+4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $364
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $364
+LABELV $335
+endproc InitMover 100 12
+export Blocked_Door
+proc Blocked_Door 8 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $367
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $369
+ADDRFP4 4
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $369
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Team_DroppedFlagThink
+CALLV
+pop
+ADDRGP4 $366
+JUMPV
+LABELV $369
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+CNSTI4 41
+ARGI4
+ADDRGP4 G_TempEntity
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $366
+JUMPV
+LABELV $367
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $371
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 17
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $371
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $373
+ADDRGP4 $366
+JUMPV
+LABELV $373
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Use_BinaryMover
+CALLV
+pop
+LABELV $366
+endproc Blocked_Door 8 32
+proc Touch_DoorTriggerSpectator 72 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 20+8
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 48
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 56
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+ADDRLP4 60
+INDIRF4
+GEF4 $378
+ADDRLP4 64
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+SUBF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+CNSTF4 3212836864
+ASGNF4
+ADDRGP4 $379
+JUMPV
+LABELV $378
+ADDRLP4 64
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 8
+ADDP4
+ADDRLP4 64
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+ADDP4
+INDIRF4
+CNSTF4 1092616192
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $379
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $380
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+NEI4 $384
+ADDRGP4 $381
+JUMPV
+LABELV $384
+ADDRLP4 64
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTF4 1056964608
+ADDRLP4 64
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 64
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+LABELV $381
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $380
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 vectoangles
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRGP4 TeleportPlayer
+CALLV
+pop
+LABELV $375
+endproc Touch_DoorTriggerSpectator 72 12
+export Touch_DoorTrigger
+proc Touch_DoorTrigger 8 12
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $387
+ADDRLP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 3
+NEI4 $387
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $388
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $388
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Touch_DoorTriggerSpectator
+CALLV
+pop
+ADDRGP4 $388
+JUMPV
+LABELV $387
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $391
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Use_BinaryMover
+CALLV
+pop
+LABELV $391
+LABELV $388
+LABELV $386
+endproc Touch_DoorTrigger 8 12
+export Think_SpawnNewDoorTrigger
+proc Think_SpawnNewDoorTrigger 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $397
+JUMPV
+LABELV $394
+ADDRLP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $395
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $397
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $394
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $401
+JUMPV
+LABELV $398
+ADDRLP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 AddPointToBounds
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 476
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 AddPointToBounds
+CALLV
+pop
+LABELV $399
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 776
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $401
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $398
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $402
+ADDRLP4 40
+CNSTI4 2
+ASGNI4
+ADDRLP4 44
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 48
+ADDRLP4 32
+INDIRI4
+ADDRLP4 40
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 20
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 20
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRF4
+SUBF4
+GEF4 $406
+ADDRLP4 32
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $406
+LABELV $403
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $402
+ADDRLP4 40
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 20
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+CNSTF4 1123024896
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 32
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+CNSTF4 1123024896
+SUBF4
+ASGNF4
+ADDRLP4 48
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 48
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $408
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRLP4 8
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ADDRLP4 20
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 1073741824
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ADDRGP4 Touch_DoorTrigger
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRGP4 MatchTeam
+CALLV
+pop
+LABELV $393
+endproc Think_SpawnNewDoorTrigger 56 12
+export Think_MatchTeam
+proc Think_MatchTeam 4 12
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRGP4 MatchTeam
+CALLV
+pop
+LABELV $410
+endproc Think_MatchTeam 4 12
+export SP_func_door
+proc SP_func_door 116 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $413
+ARGP4
+ADDRLP4 32
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $414
+ARGP4
+ADDRLP4 40
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 Blocked_Door
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $415
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+CNSTF4 1137180672
+ASGNF4
+LABELV $415
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $417
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+CNSTF4 1073741824
+ASGNF4
+LABELV $417
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CNSTF4 1148846080
+ADDRLP4 48
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $419
+ARGP4
+ADDRGP4 $420
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRGP4 $421
+ARGP4
+ADDRGP4 $422
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+ARGP4
+ADDRGP4 G_SetMovedir
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 68
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 68
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 72
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $431
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+ASGNP4
+ADDRLP4 96
+ADDRLP4 112
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 112
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+ADDRLP4 96
+INDIRB
+ASGNB 12
+LABELV $431
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 1024
+BANDI4
+CNSTI4 0
+NEI4 $434
+ADDRGP4 $436
+ARGP4
+ADDRGP4 $437
+ARGP4
+ADDRLP4 96
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $438
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $438
+ADDRFP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $442
+ADDRLP4 96
+INDIRI4
+CNSTI4 0
+EQI4 $440
+LABELV $442
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRGP4 Think_MatchTeam
+ASGNP4
+ADDRGP4 $441
+JUMPV
+LABELV $440
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRGP4 Think_SpawnNewDoorTrigger
+ASGNP4
+LABELV $441
+LABELV $434
+LABELV $412
+endproc SP_func_door 116 12
+export Touch_Plat
+proc Touch_Plat 4 0
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $446
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $444
+LABELV $446
+ADDRGP4 $443
+JUMPV
+LABELV $444
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $447
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 1000
+ADDI4
+ASGNI4
+LABELV $447
+LABELV $443
+endproc Touch_Plat 4 0
+export Touch_PlatCenterTrigger
+proc Touch_PlatCenterTrigger 4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $451
+ADDRGP4 $450
+JUMPV
+LABELV $451
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $453
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Use_BinaryMover
+CALLV
+pop
+LABELV $453
+LABELV $450
+endproc Touch_PlatCenterTrigger 4 12
+export SpawnPlatTrigger
+proc SpawnPlatTrigger 60 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 28
+ADDRGP4 G_Spawn
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+ADDRGP4 $456
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ADDRGP4 Touch_PlatCenterTrigger
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 460
+ADDP4
+CNSTI4 1073741824
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 36
+CNSTF4 1107558400
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1107558400
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 16+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+ADDF4
+CNSTF4 1090519040
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GTF4 $461
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $461
+ADDRLP4 16+4
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+GTF4 $463
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16+4
+ADDRLP4 4+4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+LABELV $463
+ADDRLP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+ADDRLP4 4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+ADDRLP4 16
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $455
+endproc SpawnPlatTrigger 60 4
+export SP_func_plat
+proc SP_func_plat 56 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $471
+ARGP4
+ADDRLP4 8
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 588
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $472
+ARGP4
+ADDRLP4 16
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 592
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 580
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 $473
+ARGP4
+ADDRGP4 $474
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRGP4 $421
+ARGP4
+ADDRGP4 $422
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRGP4 $475
+ARGP4
+ADDRGP4 $476
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRGP4 $419
+ARGP4
+ADDRGP4 $420
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+CNSTF4 1148846080
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRGP4 $479
+ARGP4
+ADDRGP4 $437
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 36
+ADDRGP4 G_SpawnFloat
+CALLI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+NEI4 $477
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+SUBF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $477
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ADDRGP4 Touch_Plat
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 700
+ADDP4
+ADDRGP4 Blocked_Door
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $480
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SpawnPlatTrigger
+CALLV
+pop
+LABELV $480
+LABELV $470
+endproc SP_func_plat 56 12
+export Touch_Button
+proc Touch_Button 4 12
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $483
+ADDRGP4 $482
+JUMPV
+LABELV $483
+ADDRFP4 0
+INDIRP4
+CNSTI4 576
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $485
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Use_BinaryMover
+CALLV
+pop
+LABELV $485
+LABELV $482
+endproc Touch_Button 4 12
+export SP_func_button
+proc SP_func_button 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $488
+ARGP4
+ADDRLP4 32
+ADDRGP4 G_SoundIndex
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 584
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $489
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+CNSTF4 1109393408
+ASGNF4
+LABELV $489
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $491
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $491
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTF4 1148846080
+ADDRLP4 36
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRGP4 $419
+ARGP4
+ADDRGP4 $493
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+ARGP4
+ADDRGP4 G_SetMovedir
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 56
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 60
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 60
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 28
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 676
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 680
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 684
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $502
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $503
+JUMPV
+LABELV $502
+ADDRFP4 0
+INDIRP4
+CNSTI4 704
+ADDP4
+ADDRGP4 Touch_Button
+ASGNP4
+LABELV $503
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+LABELV $487
+endproc SP_func_button 84 12
+export Think_BeginMoving
+proc Think_BeginMoving 0 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $504
+endproc Think_BeginMoving 0 0
+export Reached_Train
+proc Reached_Train 48 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 604
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 28
+INDIRU4
+EQU4 $509
+ADDRLP4 0
+INDIRP4
+CNSTI4 604
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 28
+INDIRU4
+NEU4 $507
+LABELV $509
+ADDRGP4 $506
+JUMPV
+LABELV $507
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTP4 0
+ARGP4
+ADDRGP4 G_UseTargets
+CALLV
+pop
+ADDRLP4 32
+CNSTI4 604
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 604
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $510
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $511
+JUMPV
+LABELV $510
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $511
+ADDRLP4 16
+INDIRF4
+CNSTF4 1065353216
+GEF4 $512
+ADDRLP4 16
+CNSTF4 1065353216
+ASGNF4
+LABELV $512
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 624
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 628
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 632
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 620
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRLP4 44
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 20
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 156
+ADDP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 level+32
+INDIRI4
+ARGI4
+ADDRGP4 SetMoverState
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRF4
+CNSTF4 0
+EQF4 $517
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+CNSTF4 1148846080
+ADDRLP4 0
+INDIRP4
+CNSTI4 796
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRGP4 Think_BeginMoving
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $517
+LABELV $506
+endproc Reached_Train 48 12
+export Think_SetupTrainTargets
+proc Think_SetupTrainTargets 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+CNSTP4 0
+ARGP4
+CNSTI4 652
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 604
+ADDP4
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 604
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $521
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 vtos
+CALLP4
+ASGNP4
+ADDRGP4 $523
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $520
+JUMPV
+LABELV $521
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 604
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $527
+JUMPV
+LABELV $524
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $528
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $528
+ADDRLP4 4
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $530
+ADDRLP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 vtos
+CALLP4
+ASGNP4
+ADDRGP4 $532
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $520
+JUMPV
+LABELV $530
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+LABELV $533
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 652
+ARGI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $536
+ADDRLP4 4
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 vtos
+CALLP4
+ASGNP4
+ADDRGP4 $538
+ARGP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $520
+JUMPV
+LABELV $536
+LABELV $534
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $539
+ARGP4
+ADDRLP4 20
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $533
+ADDRLP4 4
+INDIRP4
+CNSTI4 604
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $525
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $527
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+NEU4 $524
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Reached_Train
+CALLV
+pop
+LABELV $520
+endproc Think_SetupTrainTargets 28 12
+export SP_path_corner
+proc SP_path_corner 4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 652
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $541
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 vtos
+CALLP4
+ASGNP4
+ADDRGP4 $543
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+LABELV $541
+LABELV $540
+endproc SP_path_corner 4 8
+export SP_func_train
+proc SP_func_train 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $545
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $546
+JUMPV
+LABELV $545
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $547
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $547
+LABELV $546
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $549
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+LABELV $549
+ADDRFP4 0
+INDIRP4
+CNSTI4 648
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $551
+ADDRFP4 0
+INDIRP4
+CNSTI4 464
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 vtos
+CALLP4
+ASGNP4
+ADDRGP4 $553
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $544
+JUMPV
+LABELV $551
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 696
+ADDP4
+ADDRGP4 Reached_Train
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 688
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 100
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 692
+ADDP4
+ADDRGP4 Think_SetupTrainTargets
+ASGNP4
+LABELV $544
+endproc SP_func_train 12 8
+export SP_func_static
+proc SP_func_static 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $555
+endproc SP_func_static 12 8
+export SP_func_rotating
+proc SP_func_rotating 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+CNSTF4 0
+NEF4 $557
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+CNSTF4 1120403456
+ASGNF4
+LABELV $557
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 4
+BANDI4
+CNSTI4 0
+EQI4 $559
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $560
+JUMPV
+LABELV $559
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 8
+BANDI4
+CNSTI4 0
+EQI4 $561
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $562
+JUMPV
+LABELV $561
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $562
+LABELV $560
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $563
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $563
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 500
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $556
+endproc SP_func_rotating 16 8
+export SP_func_bobbing
+proc SP_func_bobbing 28 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $473
+ARGP4
+ADDRGP4 $493
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRGP4 $479
+ARGP4
+ADDRGP4 $566
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRGP4 $421
+ARGP4
+ADDRGP4 $422
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRGP4 $567
+ARGP4
+ADDRGP4 $437
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1148846080
+ADDRFP4 0
+INDIRP4
+CNSTI4 672
+ADDP4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $568
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 $569
+JUMPV
+LABELV $568
+ADDRFP4 0
+INDIRP4
+CNSTI4 528
+ADDP4
+INDIRI4
+CNSTI4 2
+BANDI4
+CNSTI4 0
+EQI4 $570
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRGP4 $571
+JUMPV
+LABELV $570
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+LABELV $571
+LABELV $569
+LABELV $565
+endproc SP_func_bobbing 28 12
+export SP_func_pendulum
+proc SP_func_pendulum 44 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $473
+ARGP4
+ADDRGP4 $573
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRGP4 $421
+ARGP4
+ADDRGP4 $422
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ARGP4
+ADDRGP4 G_SpawnInt
+CALLI4
+pop
+ADDRGP4 $567
+ARGP4
+ADDRGP4 $437
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 G_SpawnFloat
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 540
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_SetBrushModel
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 1090519040
+GEF4 $574
+ADDRLP4 0
+CNSTF4 1090519040
+ASGNF4
+LABELV $574
+ADDRGP4 g_gravity+8
+INDIRF4
+CNSTF4 1077936128
+ADDRLP4 0
+INDIRF4
+MULF4
+DIVF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1042479491
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 4
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 InitMover
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 4
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRLP4 8
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $572
+endproc SP_func_pendulum 44 12
+import G_ExplodeMissile
+bss
+export pushed_p
+align 4
+LABELV pushed_p
+skip 4
+export pushed
+align 4
+LABELV pushed
+skip 32768
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import DeathmatchScoreboardMessage
+import G_SetStats
+import MoveClientToIntermission
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import G_RunMissile
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $573
+byte 1 51
+byte 1 48
+byte 1 0
+align 1
+LABELV $567
+byte 1 112
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $566
+byte 1 51
+byte 1 50
+byte 1 0
+align 1
+LABELV $553
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $543
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $539
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $538
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $532
+byte 1 84
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 111
+byte 1 117
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $523
+byte 1 102
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $493
+byte 1 52
+byte 1 0
+align 1
+LABELV $488
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 110
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $479
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $476
+byte 1 49
+byte 1 0
+align 1
+LABELV $475
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $474
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $473
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $472
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $471
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $456
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $437
+byte 1 48
+byte 1 0
+align 1
+LABELV $436
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 108
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $422
+byte 1 50
+byte 1 0
+align 1
+LABELV $421
+byte 1 100
+byte 1 109
+byte 1 103
+byte 1 0
+align 1
+LABELV $420
+byte 1 56
+byte 1 0
+align 1
+LABELV $419
+byte 1 108
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $414
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 114
+byte 1 49
+byte 1 95
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $413
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 100
+byte 1 114
+byte 1 49
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 116
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $408
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $344
+byte 1 49
+byte 1 32
+byte 1 49
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $343
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $342
+byte 1 108
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $341
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $340
+byte 1 110
+byte 1 111
+byte 1 105
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $304
+byte 1 82
+byte 1 101
+byte 1 97
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 66
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 121
+byte 1 77
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 98
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 116
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $86
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 95
+byte 1 112
+byte 1 32
+byte 1 62
+byte 1 32
+byte 1 38
+byte 1 112
+byte 1 117
+byte 1 115
+byte 1 104
+byte 1 101
+byte 1 100
+byte 1 91
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 84
+byte 1 73
+byte 1 84
+byte 1 73
+byte 1 69
+byte 1 83
+byte 1 93
+byte 1 0
@@ -0,0 +1,2995 @@
+code
+proc StringToFilter 160 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+LABELV $54
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRLP4 132
+INDIRI4
+ADDRLP4 140
+ADDP4
+CNSTU1 0
+ASGNU1
+LABELV $55
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 4
+LTI4 $54
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+LABELV $58
+ADDRLP4 144
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 48
+LTI4 $64
+ADDRLP4 144
+INDIRI4
+CNSTI4 57
+LEI4 $62
+LABELV $64
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $65
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $67
+ADDRGP4 $60
+JUMPV
+LABELV $67
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $59
+JUMPV
+LABELV $65
+ADDRGP4 $69
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $53
+JUMPV
+LABELV $62
+ADDRLP4 128
+CNSTI4 0
+ASGNI4
+ADDRGP4 $71
+JUMPV
+LABELV $70
+ADDRLP4 148
+ADDRLP4 128
+INDIRI4
+ASGNI4
+ADDRLP4 156
+CNSTI4 1
+ASGNI4
+ADDRLP4 128
+ADDRLP4 148
+INDIRI4
+ADDRLP4 156
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 152
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 152
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRI4
+ADDRLP4 0
+ADDP4
+ADDRLP4 152
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $71
+ADDRLP4 148
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 48
+LTI4 $73
+ADDRLP4 148
+INDIRI4
+CNSTI4 57
+LEI4 $70
+LABELV $73
+ADDRLP4 128
+INDIRI4
+ADDRLP4 0
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ARGP4
+ADDRLP4 152
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+ADDRLP4 136
+ADDP4
+ADDRLP4 152
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 132
+INDIRI4
+ADDRLP4 140
+ADDP4
+CNSTU1 255
+ASGNU1
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $74
+ADDRGP4 $60
+JUMPV
+LABELV $74
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $59
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 132
+INDIRI4
+CNSTI4 4
+LTI4 $58
+LABELV $60
+ADDRFP4 4
+INDIRP4
+ADDRLP4 140
+INDIRU4
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 136
+INDIRU4
+ASGNU4
+CNSTI4 1
+RETI4
+LABELV $53
+endproc StringToFilter 160 8
+proc UpdateIPBans 348 12
+ADDRLP4 80
+CNSTI1 0
+ASGNI1
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+ADDRGP4 $80
+JUMPV
+LABELV $77
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+CNSTU4 4294967295
+NEU4 $81
+ADDRGP4 $78
+JUMPV
+LABELV $81
+ADDRLP4 336
+ADDRLP4 76
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 336
+INDIRI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 68
+ADDRLP4 336
+INDIRI4
+ADDRGP4 ipFilters
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $85
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 255
+EQI4 $89
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $91
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $90
+JUMPV
+LABELV $89
+ADDRGP4 $92
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 72
+ADDP4
+INDIRU1
+CVUI4 1
+ARGI4
+ADDRLP4 340
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 340
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $90
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+GEI4 $96
+ADDRLP4 344
+ADDRGP4 $93
+ASGNP4
+ADDRGP4 $97
+JUMPV
+LABELV $96
+ADDRLP4 344
+ADDRGP4 $94
+ASGNP4
+LABELV $97
+ADDRLP4 344
+INDIRP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $86
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $85
+ADDRLP4 80
+ARGP4
+ADDRLP4 340
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 344
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 340
+INDIRI4
+ADDRLP4 344
+INDIRI4
+ADDI4
+CNSTI4 256
+GEI4 $98
+ADDRLP4 80
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRGP4 $99
+JUMPV
+LABELV $98
+ADDRGP4 $100
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $79
+JUMPV
+LABELV $99
+LABELV $78
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $80
+ADDRLP4 76
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+LTI4 $77
+LABELV $79
+ADDRGP4 $101
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $76
+endproc UpdateIPBans 348 12
+export G_FilterPacket
+proc G_FilterPacket 28 0
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $104
+JUMPV
+LABELV $103
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTU1 0
+ASGNU1
+ADDRGP4 $107
+JUMPV
+LABELV $106
+ADDRLP4 16
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CNSTI4 10
+ADDRLP4 16
+INDIRP4
+INDIRU1
+CVUI4 1
+MULI4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+ADDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $107
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 48
+LTI4 $109
+ADDRLP4 16
+INDIRI4
+CNSTI4 57
+LEI4 $106
+LABELV $109
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $112
+ADDRLP4 20
+INDIRI4
+CNSTI4 58
+NEI4 $110
+LABELV $112
+ADDRGP4 $105
+JUMPV
+LABELV $110
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $104
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $113
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $103
+LABELV $113
+LABELV $105
+ADDRLP4 12
+ADDRLP4 8
+INDIRU4
+ASGNU4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $117
+JUMPV
+LABELV $114
+ADDRLP4 16
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 12
+INDIRU4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 ipFilters
+ADDP4
+INDIRU4
+BANDU4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+NEU4 $118
+ADDRGP4 g_filterBan+12
+INDIRI4
+CNSTI4 0
+EQI4 $123
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $124
+JUMPV
+LABELV $123
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $124
+ADDRLP4 20
+INDIRI4
+RETI4
+ADDRGP4 $102
+JUMPV
+LABELV $118
+LABELV $115
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $117
+ADDRLP4 4
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+LTI4 $114
+ADDRGP4 g_filterBan+12
+INDIRI4
+CNSTI4 0
+NEI4 $127
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $128
+JUMPV
+LABELV $127
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $128
+ADDRLP4 24
+INDIRI4
+RETI4
+LABELV $102
+endproc G_FilterPacket 28 0
+proc AddIP 8 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $133
+JUMPV
+LABELV $130
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+CNSTU4 4294967295
+NEU4 $134
+ADDRGP4 $132
+JUMPV
+LABELV $134
+LABELV $131
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $133
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+LTI4 $130
+LABELV $132
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+NEI4 $137
+ADDRGP4 numIPFilters
+INDIRI4
+CNSTI4 1024
+NEI4 $139
+ADDRGP4 $141
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $129
+JUMPV
+LABELV $139
+ADDRLP4 4
+ADDRGP4 numIPFilters
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $137
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters
+ADDP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 StringToFilter
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $142
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters+4
+ADDP4
+CNSTU4 4294967295
+ASGNU4
+LABELV $142
+ADDRGP4 UpdateIPBans
+CALLV
+pop
+LABELV $129
+endproc AddIP 8 8
+export G_ProcessIPBans
+proc G_ProcessIPBans 276 12
+ADDRLP4 8
+ARGP4
+ADDRGP4 g_banIPs+16
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 264
+ADDRGP4 g_banIPs+16
+ASGNP4
+ADDRLP4 0
+ADDRLP4 264
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 264
+INDIRP4
+ASGNP4
+ADDRGP4 $150
+JUMPV
+LABELV $147
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 268
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 268
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $155
+ADDRGP4 $149
+JUMPV
+LABELV $154
+ADDRLP4 272
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 272
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $155
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 32
+EQI4 $154
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $157
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AddIP
+CALLV
+pop
+LABELV $157
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $148
+LABELV $150
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $147
+LABELV $149
+LABELV $145
+endproc G_ProcessIPBans 276 12
+export Svcmd_AddIP_f
+proc Svcmd_AddIP_f 1028 12
+ADDRLP4 1024
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 2
+GEI4 $160
+ADDRGP4 $162
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $159
+JUMPV
+LABELV $160
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 AddIP
+CALLV
+pop
+LABELV $159
+endproc Svcmd_AddIP_f 1028 12
+export Svcmd_RemoveIP_f
+proc Svcmd_RemoveIP_f 1048 12
+ADDRLP4 1036
+ADDRGP4 trap_Argc
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 2
+GEI4 $164
+ADDRGP4 $166
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $163
+JUMPV
+LABELV $164
+CNSTI4 1
+ARGI4
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 StringToFilter
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $167
+ADDRGP4 $163
+JUMPV
+LABELV $167
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $172
+JUMPV
+LABELV $169
+ADDRLP4 1044
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+ADDRGP4 ipFilters
+ADDP4
+INDIRU4
+ADDRLP4 4
+INDIRU4
+NEU4 $173
+ADDRLP4 1044
+INDIRI4
+ADDRGP4 ipFilters+4
+ADDP4
+INDIRU4
+ADDRLP4 4+4
+INDIRU4
+NEU4 $173
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+ADDRGP4 ipFilters+4
+ADDP4
+CNSTU4 4294967295
+ASGNU4
+ADDRGP4 $178
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 UpdateIPBans
+CALLV
+pop
+ADDRGP4 $163
+JUMPV
+LABELV $173
+LABELV $170
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $172
+ADDRLP4 0
+INDIRI4
+ADDRGP4 numIPFilters
+INDIRI4
+LTI4 $169
+ADDRGP4 $179
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $163
+endproc Svcmd_RemoveIP_f 1048 12
+export Svcmd_EntityList_f
+proc Svcmd_EntityList_f 16 8
+ADDRLP4 0
+ADDRGP4 g_entities+808
+ASGNP4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $185
+JUMPV
+LABELV $182
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $187
+ADDRGP4 $183
+JUMPV
+LABELV $187
+ADDRGP4 $189
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $190
+ADDRLP4 8
+INDIRI4
+CNSTI4 11
+GTI4 $190
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $218
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $218
+address $193
+address $195
+address $197
+address $199
+address $201
+address $203
+address $205
+address $207
+address $209
+address $211
+address $213
+address $215
+code
+LABELV $193
+ADDRGP4 $194
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $195
+ADDRGP4 $196
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $197
+ADDRGP4 $198
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $199
+ADDRGP4 $200
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $201
+ADDRGP4 $202
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $203
+ADDRGP4 $204
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $205
+ADDRGP4 $206
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $207
+ADDRGP4 $208
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $209
+ADDRGP4 $210
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $211
+ADDRGP4 $212
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $213
+ADDRGP4 $214
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $215
+ADDRGP4 $216
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $190
+ADDRGP4 $217
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $191
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $219
+ADDRGP4 $221
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $219
+ADDRGP4 $222
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+LABELV $183
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 808
+ADDP4
+ASGNP4
+LABELV $185
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+12
+INDIRI4
+LTI4 $182
+LABELV $180
+endproc Svcmd_EntityList_f 16 8
+export ClientForString
+proc ClientForString 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 48
+LTI4 $224
+ADDRLP4 12
+INDIRI4
+CNSTI4 57
+GTI4 $224
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $229
+ADDRLP4 20
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $226
+LABELV $229
+ADDRGP4 $230
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $223
+JUMPV
+LABELV $226
+ADDRLP4 0
+CNSTI4 776
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $231
+ADDRGP4 $233
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $223
+JUMPV
+LABELV $231
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $223
+JUMPV
+LABELV $224
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $237
+JUMPV
+LABELV $234
+ADDRLP4 0
+CNSTI4 776
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 level
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $239
+ADDRGP4 $235
+JUMPV
+LABELV $239
+ADDRLP4 0
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $241
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $223
+JUMPV
+LABELV $241
+LABELV $235
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $237
+ADDRLP4 4
+INDIRI4
+ADDRGP4 level+24
+INDIRI4
+LTI4 $234
+ADDRGP4 $243
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+CNSTP4 0
+RETP4
+LABELV $223
+endproc ClientForString 24 8
+export Svcmd_ForceTeam_f
+proc Svcmd_ForceTeam_f 1032 12
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1028
+ADDRGP4 ClientForString
+CALLP4
+ASGNP4
+ADDRLP4 1024
+ADDRLP4 1028
+INDIRP4
+ASGNP4
+ADDRLP4 1024
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $245
+ADDRGP4 $244
+JUMPV
+LABELV $245
+CNSTI4 2
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+CNSTI4 808
+ADDRLP4 1024
+INDIRP4
+CVPU4 4
+ADDRGP4 level
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 776
+DIVI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 SetTeam
+CALLV
+pop
+LABELV $244
+endproc Svcmd_ForceTeam_f 1032 12
+export ConsoleCommand
+proc ConsoleCommand 1072 12
+CNSTI4 0
+ARGI4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Argv
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $250
+ARGP4
+ADDRLP4 1024
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1024
+INDIRI4
+CNSTI4 0
+NEI4 $248
+ADDRGP4 Svcmd_EntityList_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $247
+JUMPV
+LABELV $248
+ADDRLP4 0
+ARGP4
+ADDRGP4 $253
+ARGP4
+ADDRLP4 1028
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 0
+NEI4 $251
+ADDRGP4 Svcmd_ForceTeam_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $247
+JUMPV
+LABELV $251
+ADDRLP4 0
+ARGP4
+ADDRGP4 $256
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $254
+ADDRGP4 Svcmd_GameMem_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $247
+JUMPV
+LABELV $254
+ADDRLP4 0
+ARGP4
+ADDRGP4 $259
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $257
+ADDRGP4 Svcmd_AddBot_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $247
+JUMPV
+LABELV $257
+ADDRLP4 0
+ARGP4
+ADDRGP4 $262
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+NEI4 $260
+ADDRGP4 Svcmd_BotList_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $247
+JUMPV
+LABELV $260
+ADDRLP4 0
+ARGP4
+ADDRGP4 $265
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+NEI4 $263
+ADDRGP4 Svcmd_AbortPodium_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $247
+JUMPV
+LABELV $263
+ADDRLP4 0
+ARGP4
+ADDRGP4 $268
+ARGP4
+ADDRLP4 1048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1048
+INDIRI4
+CNSTI4 0
+NEI4 $266
+ADDRGP4 Svcmd_AddIP_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $247
+JUMPV
+LABELV $266
+ADDRLP4 0
+ARGP4
+ADDRGP4 $271
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $269
+ADDRGP4 Svcmd_RemoveIP_f
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $247
+JUMPV
+LABELV $269
+ADDRLP4 0
+ARGP4
+ADDRGP4 $274
+ARGP4
+ADDRLP4 1056
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+NEI4 $272
+CNSTI4 0
+ARGI4
+ADDRGP4 $275
+ARGP4
+ADDRGP4 trap_SendConsoleCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $247
+JUMPV
+LABELV $272
+ADDRGP4 g_dedicated+12
+INDIRI4
+CNSTI4 0
+EQI4 $276
+ADDRLP4 0
+ARGP4
+ADDRGP4 $281
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+NEI4 $279
+CNSTI4 1
+ARGI4
+ADDRLP4 1064
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRGP4 $282
+ARGP4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $247
+JUMPV
+LABELV $279
+CNSTI4 0
+ARGI4
+ADDRLP4 1064
+ADDRGP4 ConcatArgs
+CALLP4
+ASGNP4
+ADDRGP4 $282
+ARGP4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 -1
+ARGI4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+CNSTI4 1
+RETI4
+ADDRGP4 $247
+JUMPV
+LABELV $276
+CNSTI4 0
+RETI4
+LABELV $247
+endproc ConsoleCommand 1072 12
+import ConcatArgs
+bss
+align 4
+LABELV numIPFilters
+skip 4
+align 4
+LABELV ipFilters
+skip 8192
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import DeathmatchScoreboardMessage
+import G_SetStats
+import MoveClientToIntermission
+import FireWeapon
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import G_RunMissile
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $282
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $281
+byte 1 115
+byte 1 97
+byte 1 121
+byte 1 0
+align 1
+LABELV $275
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 80
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $274
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $271
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $268
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $265
+byte 1 97
+byte 1 98
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $262
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $259
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $256
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 95
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 0
+align 1
+LABELV $253
+byte 1 102
+byte 1 111
+byte 1 114
+byte 1 99
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $250
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $243
+byte 1 85
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 10
+byte 1 0
+align 1
+LABELV $233
+byte 1 67
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $230
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 108
+byte 1 111
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $222
+byte 1 10
+byte 1 0
+align 1
+LABELV $221
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $217
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $216
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 80
+byte 1 80
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $214
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 78
+byte 1 86
+byte 1 73
+byte 1 83
+byte 1 73
+byte 1 66
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $212
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 84
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 0
+align 1
+LABELV $210
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 85
+byte 1 83
+byte 1 72
+byte 1 95
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 71
+byte 1 71
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $208
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 65
+byte 1 75
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $206
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 79
+byte 1 82
+byte 1 84
+byte 1 65
+byte 1 76
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $204
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 66
+byte 1 69
+byte 1 65
+byte 1 77
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $202
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 77
+byte 1 79
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $200
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 83
+byte 1 83
+byte 1 73
+byte 1 76
+byte 1 69
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $198
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 73
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $196
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $194
+byte 1 69
+byte 1 84
+byte 1 95
+byte 1 71
+byte 1 69
+byte 1 78
+byte 1 69
+byte 1 82
+byte 1 65
+byte 1 76
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $189
+byte 1 37
+byte 1 51
+byte 1 105
+byte 1 58
+byte 1 0
+align 1
+LABELV $179
+byte 1 68
+byte 1 105
+byte 1 100
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $178
+byte 1 82
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $166
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 115
+byte 1 118
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 60
+byte 1 105
+byte 1 112
+byte 1 45
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $162
+byte 1 85
+byte 1 115
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 105
+byte 1 112
+byte 1 32
+byte 1 60
+byte 1 105
+byte 1 112
+byte 1 45
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 107
+byte 1 62
+byte 1 10
+byte 1 0
+align 1
+LABELV $141
+byte 1 73
+byte 1 80
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 115
+byte 1 116
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 10
+byte 1 0
+align 1
+LABELV $101
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 80
+byte 1 115
+byte 1 0
+align 1
+LABELV $100
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 73
+byte 1 80
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 88
+byte 1 95
+byte 1 67
+byte 1 86
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 86
+byte 1 65
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 95
+byte 1 83
+byte 1 84
+byte 1 82
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 10
+byte 1 0
+align 1
+LABELV $94
+byte 1 32
+byte 1 0
+align 1
+LABELV $93
+byte 1 46
+byte 1 0
+align 1
+LABELV $92
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $91
+byte 1 42
+byte 1 0
+align 1
+LABELV $69
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
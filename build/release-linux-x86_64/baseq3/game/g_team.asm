@@ -0,0 +1,6202 @@
+export Team_InitGame
+code
+proc Team_InitGame 0 12
+ADDRGP4 teamgame
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 36
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+EQI4 $57
+ADDRGP4 $55
+JUMPV
+LABELV $57
+ADDRGP4 teamgame+8
+CNSTI4 -1
+ASGNI4
+CNSTI4 1
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRGP4 teamgame+12
+CNSTI4 -1
+ASGNI4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+LABELV $55
+LABELV $53
+endproc Team_InitGame 0 12
+export OtherTeam
+proc OtherTeam 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $61
+CNSTI4 2
+RETI4
+ADDRGP4 $60
+JUMPV
+LABELV $61
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $63
+CNSTI4 1
+RETI4
+ADDRGP4 $60
+JUMPV
+LABELV $63
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $60
+endproc OtherTeam 0 0
+export TeamName
+proc TeamName 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $66
+ADDRGP4 $68
+RETP4
+ADDRGP4 $65
+JUMPV
+LABELV $66
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $69
+ADDRGP4 $71
+RETP4
+ADDRGP4 $65
+JUMPV
+LABELV $69
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $72
+ADDRGP4 $74
+RETP4
+ADDRGP4 $65
+JUMPV
+LABELV $72
+ADDRGP4 $75
+RETP4
+LABELV $65
+endproc TeamName 0 0
+export OtherTeamName
+proc OtherTeamName 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $77
+ADDRGP4 $71
+RETP4
+ADDRGP4 $76
+JUMPV
+LABELV $77
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $79
+ADDRGP4 $68
+RETP4
+ADDRGP4 $76
+JUMPV
+LABELV $79
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $81
+ADDRGP4 $74
+RETP4
+ADDRGP4 $76
+JUMPV
+LABELV $81
+ADDRGP4 $75
+RETP4
+LABELV $76
+endproc OtherTeamName 0 0
+export TeamColorString
+proc TeamColorString 0 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+NEI4 $84
+ADDRGP4 $86
+RETP4
+ADDRGP4 $83
+JUMPV
+LABELV $84
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+NEI4 $87
+ADDRGP4 $89
+RETP4
+ADDRGP4 $83
+JUMPV
+LABELV $87
+ADDRFP4 0
+INDIRI4
+CNSTI4 3
+NEI4 $90
+ADDRGP4 $92
+RETP4
+ADDRGP4 $83
+JUMPV
+LABELV $90
+ADDRGP4 $93
+RETP4
+LABELV $83
+endproc TeamColorString 0 0
+export PrintMsg
+proc PrintMsg 1048 16
+ADDRLP4 1028
+ADDRFP4 4+4
+ASGNP4
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_vsnprintf
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CVIU4 4
+CNSTU4 1024
+LEU4 $96
+ADDRGP4 $98
+ARGP4
+ADDRGP4 G_Error
+CALLV
+pop
+LABELV $96
+ADDRLP4 1028
+CNSTP4 0
+ASGNP4
+ADDRGP4 $100
+JUMPV
+LABELV $99
+ADDRLP4 0
+INDIRP4
+CNSTI1 39
+ASGNI1
+LABELV $100
+ADDRLP4 4
+ARGP4
+CNSTI4 34
+ARGI4
+ADDRLP4 1036
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1036
+INDIRP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $99
+ADDRGP4 $103
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $104
+ADDRLP4 1040
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $105
+JUMPV
+LABELV $104
+ADDRLP4 1040
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 808
+DIVI4
+ASGNI4
+LABELV $105
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $94
+endproc PrintMsg 1048 16
+export AddTeamScore
+proc AddTeamScore 16 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $107
+ADDRGP4 level+44+4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ADDRGP4 level+44+8
+INDIRI4
+NEI4 $109
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 $108
+JUMPV
+LABELV $109
+ADDRGP4 level+44+4
+INDIRI4
+ADDRGP4 level+44+8
+INDIRI4
+GTI4 $115
+ADDRGP4 level+44+4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ADDRGP4 level+44+8
+INDIRI4
+LEI4 $115
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 10
+ASGNI4
+ADDRGP4 $108
+JUMPV
+LABELV $115
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 8
+ASGNI4
+ADDRGP4 $108
+JUMPV
+LABELV $107
+ADDRGP4 level+44+8
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ADDRGP4 level+44+4
+INDIRI4
+NEI4 $125
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 12
+ASGNI4
+ADDRGP4 $126
+JUMPV
+LABELV $125
+ADDRGP4 level+44+8
+INDIRI4
+ADDRGP4 level+44+4
+INDIRI4
+GTI4 $131
+ADDRGP4 level+44+8
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ADDRGP4 level+44+4
+INDIRI4
+LEI4 $131
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 11
+ASGNI4
+ADDRGP4 $132
+JUMPV
+LABELV $131
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 9
+ASGNI4
+LABELV $132
+LABELV $126
+LABELV $108
+ADDRLP4 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $106
+endproc AddTeamScore 16 8
+export OnSameTeam
+proc OnSameTeam 16 0
+ADDRLP4 0
+CNSTI4 516
+ASGNI4
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $145
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+NEU4 $143
+LABELV $145
+CNSTI4 0
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $143
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+GEI4 $146
+CNSTI4 0
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $146
+ADDRLP4 8
+CNSTI4 516
+ASGNI4
+ADDRLP4 12
+CNSTI4 616
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $149
+CNSTI4 1
+RETI4
+ADDRGP4 $142
+JUMPV
+LABELV $149
+CNSTI4 0
+RETI4
+LABELV $142
+endproc OnSameTeam 16 0
+data
+align 1
+LABELV ctfFlagStatusRemap
+byte 1 48
+byte 1 49
+byte 1 42
+byte 1 42
+byte 1 50
+align 1
+LABELV oneFlagStatusRemap
+byte 1 48
+byte 1 49
+byte 1 50
+byte 1 51
+byte 1 52
+export Team_SetFlagStatus
+code
+proc Team_SetFlagStatus 16 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $164
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $154
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $159
+ADDRGP4 $152
+JUMPV
+LABELV $154
+ADDRGP4 teamgame+8
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $153
+ADDRGP4 teamgame+8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $159
+ADDRGP4 teamgame+12
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $153
+ADDRGP4 teamgame+12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $153
+JUMPV
+LABELV $164
+ADDRGP4 teamgame+16
+INDIRI4
+ADDRFP4 4
+INDIRI4
+EQI4 $153
+ADDRGP4 teamgame+16
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $152
+LABELV $153
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $169
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $171
+ADDRLP4 12
+ADDRGP4 ctfFlagStatusRemap
+ASGNP4
+ADDRLP4 8
+ADDRGP4 teamgame+8
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8+1
+ADDRGP4 teamgame+12
+INDIRI4
+ADDRLP4 12
+INDIRP4
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8+2
+CNSTI1 0
+ASGNI1
+ADDRGP4 $172
+JUMPV
+LABELV $171
+ADDRLP4 8
+ADDRGP4 teamgame+16
+INDIRI4
+ADDRGP4 oneFlagStatusRemap
+ADDP4
+INDIRI1
+ASGNI1
+ADDRLP4 8+1
+CNSTI1 0
+ASGNI1
+LABELV $172
+CNSTI4 23
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_SetConfigstring
+CALLV
+pop
+LABELV $169
+LABELV $151
+endproc Team_SetFlagStatus 16 8
+export Team_CheckDroppedItem
+proc Team_CheckDroppedItem 0 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $181
+CNSTI4 1
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRGP4 $182
+JUMPV
+LABELV $181
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $183
+CNSTI4 2
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRGP4 $184
+JUMPV
+LABELV $183
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $185
+CNSTI4 0
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+LABELV $185
+LABELV $184
+LABELV $182
+LABELV $180
+endproc Team_CheckDroppedItem 0 8
+export Team_ForceGesture
+proc Team_ForceGesture 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $188
+ADDRLP4 0
+CNSTI4 808
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $192
+ADDRGP4 $189
+JUMPV
+LABELV $192
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $194
+ADDRGP4 $189
+JUMPV
+LABELV $194
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRI4
+EQI4 $196
+ADDRGP4 $189
+JUMPV
+LABELV $196
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32768
+BORI4
+ASGNI4
+LABELV $189
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+LTI4 $188
+LABELV $187
+endproc Team_ForceGesture 12 0
+export Team_FragBonuses
+proc Team_FragBonuses 288 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+ADDRLP4 68
+CNSTI4 516
+ASGNI4
+ADDRLP4 72
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRU4
+EQU4 $203
+ADDRFP4 8
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 72
+INDIRU4
+EQU4 $203
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $203
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 80
+INDIRI4
+CNSTI4 0
+EQI4 $199
+LABELV $203
+ADDRGP4 $198
+JUMPV
+LABELV $199
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 88
+CNSTI4 616
+ASGNI4
+ADDRLP4 52
+ADDRLP4 84
+INDIRP4
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRP4
+INDIRP4
+ADDRLP4 88
+INDIRI4
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 92
+ADDRGP4 OtherTeam
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 92
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+GEI4 $204
+ADDRGP4 $198
+JUMPV
+LABELV $204
+ADDRLP4 52
+INDIRI4
+CNSTI4 1
+NEI4 $206
+ADDRLP4 16
+CNSTI4 7
+ASGNI4
+ADDRLP4 60
+CNSTI4 8
+ASGNI4
+ADDRGP4 $207
+JUMPV
+LABELV $206
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 60
+CNSTI4 7
+ASGNI4
+LABELV $207
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 5
+NEI4 $208
+ADDRLP4 60
+CNSTI4 9
+ASGNI4
+LABELV $208
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 56
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $211
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 600
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 580
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 104
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $214
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 104
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $218
+JUMPV
+LABELV $215
+ADDRLP4 12
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $220
+ADDRLP4 12
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $220
+ADDRLP4 12
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $220
+LABELV $216
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $218
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $215
+ADDRGP4 $198
+JUMPV
+LABELV $211
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $222
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 600
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+LSHI4
+ADDRLP4 56
+INDIRI4
+MULI4
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 104
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 580
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+ARGI4
+ADDRLP4 108
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $225
+ARGP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 108
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $226
+ADDRLP4 12
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $231
+ADDRLP4 12
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $231
+ADDRLP4 12
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $231
+LABELV $227
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $229
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $226
+ADDRGP4 $198
+JUMPV
+LABELV $222
+ADDRLP4 100
+CNSTI4 516
+ASGNI4
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 104
+INDIRF4
+CNSTF4 0
+EQF4 $233
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ADDRLP4 104
+INDIRF4
+SUBF4
+CNSTF4 1174011904
+GEF4 $233
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $233
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 108
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 112
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 292
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 116
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 116
+INDIRP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 120
+ADDRLP4 116
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ADDRLP4 120
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 124
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 $198
+JUMPV
+LABELV $233
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 108
+INDIRF4
+CNSTF4 0
+EQF4 $237
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ADDRLP4 108
+INDIRF4
+SUBF4
+CNSTF4 1174011904
+GEF4 $237
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 112
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRLP4 116
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 292
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 120
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 52
+ADDRLP4 120
+INDIRP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 124
+ADDRLP4 120
+INDIRP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 128
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 $198
+JUMPV
+LABELV $237
+ADDRLP4 112
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 1
+EQI4 $244
+ADDRLP4 112
+INDIRI4
+CNSTI4 2
+EQI4 $246
+ADDRGP4 $198
+JUMPV
+LABELV $244
+ADDRLP4 24
+ADDRGP4 $245
+ASGNP4
+ADDRGP4 $242
+JUMPV
+LABELV $246
+ADDRLP4 24
+ADDRGP4 $247
+ASGNP4
+LABELV $242
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $251
+JUMPV
+LABELV $248
+ADDRLP4 4
+CNSTI4 808
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 124
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+ADDRLP4 124
+INDIRI4
+EQI4 $253
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+ADDRLP4 124
+INDIRI4
+EQI4 $253
+ADDRGP4 $250
+JUMPV
+LABELV $253
+ADDRLP4 4
+CNSTP4 0
+ASGNP4
+LABELV $249
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $251
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $248
+LABELV $250
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRGP4 $256
+JUMPV
+LABELV $255
+ADDRLP4 8
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+NEI4 $258
+ADDRGP4 $257
+JUMPV
+LABELV $258
+LABELV $256
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 120
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 120
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $255
+LABELV $257
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $260
+ADDRGP4 $198
+JUMPV
+LABELV $260
+ADDRLP4 128
+CNSTI4 488
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 128
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 136
+CNSTI4 492
+ASGNI4
+ADDRLP4 28+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 136
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 140
+CNSTI4 496
+ASGNI4
+ADDRLP4 28+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 148
+CNSTI4 488
+ASGNI4
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 156
+CNSTI4 492
+ASGNI4
+ADDRLP4 40+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 156
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 160
+CNSTI4 496
+ASGNI4
+ADDRLP4 40+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 160
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 164
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 164
+INDIRF4
+CNSTF4 1148846080
+GEF4 $269
+ADDRLP4 168
+CNSTI4 488
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 168
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 168
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 172
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 172
+INDIRI4
+CNSTI4 0
+NEI4 $268
+LABELV $269
+ADDRLP4 40
+ARGP4
+ADDRLP4 176
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 176
+INDIRF4
+CNSTF4 1148846080
+GEF4 $266
+ADDRLP4 180
+CNSTI4 488
+ASGNI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 180
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 180
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 184
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 184
+INDIRI4
+CNSTI4 0
+EQI4 $266
+LABELV $268
+ADDRLP4 188
+CNSTI4 516
+ASGNI4
+ADDRLP4 192
+CNSTI4 616
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 188
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 192
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $266
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 196
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 568
+ADDP4
+ASGNP4
+ADDRLP4 196
+INDIRP4
+ADDRLP4 196
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 200
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 292
+ADDP4
+ASGNP4
+ADDRLP4 200
+INDIRP4
+ADDRLP4 200
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 204
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 204
+INDIRP4
+ADDRLP4 204
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 208
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 208
+INDIRP4
+ADDRLP4 208
+INDIRP4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 $198
+JUMPV
+LABELV $266
+ADDRLP4 196
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ASGNU4
+ADDRLP4 196
+INDIRU4
+CNSTU4 0
+EQU4 $271
+ADDRLP4 196
+INDIRU4
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+EQU4 $271
+ADDRLP4 204
+CNSTI4 488
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 204
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 212
+CNSTI4 492
+ASGNI4
+ADDRLP4 28+4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 212
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 216
+CNSTI4 496
+ASGNI4
+ADDRLP4 28+8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 216
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 224
+CNSTI4 488
+ASGNI4
+ADDRLP4 28
+ADDRFP4 8
+INDIRP4
+ADDRLP4 224
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 224
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 232
+CNSTI4 492
+ASGNI4
+ADDRLP4 28+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 232
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 232
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 236
+CNSTI4 496
+ASGNI4
+ADDRLP4 28+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 236
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 236
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ARGP4
+ADDRLP4 240
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 240
+INDIRF4
+CNSTF4 1148846080
+GEF4 $280
+ADDRLP4 244
+CNSTI4 488
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 244
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 244
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 248
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 248
+INDIRI4
+CNSTI4 0
+NEI4 $279
+LABELV $280
+ADDRLP4 40
+ARGP4
+ADDRLP4 252
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 252
+INDIRF4
+CNSTF4 1148846080
+GEF4 $277
+ADDRLP4 256
+CNSTI4 488
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 256
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 256
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 260
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 260
+INDIRI4
+CNSTI4 0
+EQI4 $277
+LABELV $279
+ADDRLP4 264
+CNSTI4 516
+ASGNI4
+ADDRLP4 268
+CNSTI4 616
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 264
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 264
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 268
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $277
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 272
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 572
+ADDP4
+ASGNP4
+ADDRLP4 272
+INDIRP4
+ADDRLP4 272
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 276
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 292
+ADDP4
+ASGNP4
+ADDRLP4 276
+INDIRP4
+ADDRLP4 276
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 280
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 280
+INDIRP4
+ADDRLP4 280
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 284
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 284
+INDIRP4
+ADDRLP4 284
+INDIRP4
+INDIRI4
+CNSTI4 65536
+BORI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $277
+LABELV $271
+LABELV $198
+endproc Team_FragBonuses 288 16
+export Team_CheckHurtCarrier
+proc Team_CheckHurtCarrier 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 516
+ASGNI4
+ADDRLP4 8
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+EQU4 $285
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRU4
+NEU4 $283
+LABELV $285
+ADDRGP4 $282
+JUMPV
+LABELV $283
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $286
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+LABELV $287
+ADDRLP4 12
+CNSTI4 516
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $288
+ADDRLP4 20
+CNSTI4 616
+ASGNI4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $288
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $288
+ADDRLP4 24
+CNSTI4 516
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $291
+ADDRLP4 32
+CNSTI4 616
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $291
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+LABELV $291
+LABELV $282
+endproc Team_CheckHurtCarrier 36 0
+export Team_ResetFlag
+proc Team_ResetFlag 20 12
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $299
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+EQI4 $297
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+EQI4 $298
+ADDRGP4 $295
+JUMPV
+LABELV $297
+ADDRLP4 4
+ADDRGP4 $245
+ASGNP4
+ADDRGP4 $296
+JUMPV
+LABELV $298
+ADDRLP4 4
+ADDRGP4 $247
+ASGNP4
+ADDRGP4 $296
+JUMPV
+LABELV $299
+ADDRLP4 4
+ADDRGP4 $300
+ASGNP4
+ADDRGP4 $296
+JUMPV
+LABELV $295
+CNSTP4 0
+RETP4
+ADDRGP4 $294
+JUMPV
+LABELV $296
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $302
+JUMPV
+LABELV $301
+ADDRLP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $304
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+ADDRGP4 $305
+JUMPV
+LABELV $304
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 RespawnItem
+CALLV
+pop
+LABELV $305
+LABELV $302
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $301
+ADDRFP4 0
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+RETP4
+LABELV $294
+endproc Team_ResetFlag 20 12
+export Team_ResetFlags
+proc Team_ResetFlags 0 4
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 4
+NEI4 $307
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_ResetFlag
+CALLP4
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_ResetFlag
+CALLP4
+pop
+LABELV $307
+LABELV $306
+endproc Team_ResetFlags 0 4
+export Team_ReturnFlagSound
+proc Team_ReturnFlagSound 12 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $311
+ADDRGP4 $313
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $310
+JUMPV
+LABELV $311
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $314
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $315
+JUMPV
+LABELV $314
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $315
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $310
+endproc Team_ReturnFlagSound 12 8
+export Team_TakeFlagSound
+proc Team_TakeFlagSound 16 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $317
+ADDRGP4 $319
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $316
+JUMPV
+LABELV $317
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $322
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $332
+ADDRGP4 $320
+JUMPV
+LABELV $322
+ADDRGP4 teamgame+12
+INDIRI4
+CNSTI4 0
+EQI4 $323
+ADDRGP4 teamgame+24
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 10000
+SUBI4
+LEI4 $326
+ADDRGP4 $316
+JUMPV
+LABELV $326
+LABELV $323
+ADDRGP4 teamgame+24
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRGP4 $321
+JUMPV
+LABELV $332
+ADDRGP4 teamgame+8
+INDIRI4
+CNSTI4 0
+EQI4 $333
+ADDRGP4 teamgame+20
+INDIRI4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 10000
+SUBI4
+LEI4 $336
+ADDRGP4 $316
+JUMPV
+LABELV $336
+LABELV $333
+ADDRGP4 teamgame+20
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+LABELV $320
+LABELV $321
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 8
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $342
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 4
+ASGNI4
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 5
+ASGNI4
+LABELV $343
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $316
+endproc Team_TakeFlagSound 16 8
+export Team_CaptureFlagSound
+proc Team_CaptureFlagSound 12 8
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $345
+ADDRGP4 $347
+ARGP4
+ADDRGP4 G_Printf
+CALLV
+pop
+ADDRGP4 $344
+JUMPV
+LABELV $345
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $348
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $349
+JUMPV
+LABELV $348
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $349
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 424
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 32
+BORI4
+ASGNI4
+LABELV $344
+endproc Team_CaptureFlagSound 12 8
+export Team_ReturnFlag
+proc Team_ReturnFlag 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 0
+ADDRGP4 Team_ResetFlag
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Team_ReturnFlagSound
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $351
+CNSTP4 0
+ARGP4
+ADDRGP4 $353
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRGP4 $352
+JUMPV
+LABELV $351
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $354
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+LABELV $352
+LABELV $350
+endproc Team_ReturnFlag 8 12
+export Team_FreeEntity
+proc Team_FreeEntity 0 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $356
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRGP4 $357
+JUMPV
+LABELV $356
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $358
+CNSTI4 2
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+ADDRGP4 $359
+JUMPV
+LABELV $358
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $360
+CNSTI4 0
+ARGI4
+ADDRGP4 Team_ReturnFlag
+CALLV
+pop
+LABELV $360
+LABELV $359
+LABELV $357
+LABELV $355
+endproc Team_FreeEntity 0 4
+export Team_DroppedFlagThink
+proc Team_DroppedFlagThink 8 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 7
+NEI4 $363
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $364
+JUMPV
+LABELV $363
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 8
+NEI4 $365
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $366
+JUMPV
+LABELV $365
+ADDRFP4 0
+INDIRP4
+CNSTI4 804
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+CNSTI4 9
+NEI4 $367
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $367
+LABELV $366
+LABELV $364
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 Team_ResetFlag
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Team_ReturnFlagSound
+CALLV
+pop
+LABELV $362
+endproc Team_DroppedFlagThink 8 8
+export Team_TouchOurFlag
+proc Team_TouchOurFlag 64 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $370
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRLP4 12
+CNSTI4 7
+ASGNI4
+LABELV $371
+ADDRFP4 0
+INDIRP4
+CNSTI4 536
+ADDP4
+INDIRI4
+CNSTI4 4096
+BANDI4
+CNSTI4 0
+EQI4 $372
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $374
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 576
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 592
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 Team_ResetFlag
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Team_ReturnFlagSound
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $369
+JUMPV
+LABELV $372
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $376
+CNSTI4 0
+RETI4
+ADDRGP4 $369
+JUMPV
+LABELV $376
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 OtherTeam
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 8
+INDIRP4
+CNSTI4 312
+ADDP4
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 teamgame
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 teamgame+4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddTeamScore
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Team_ForceGesture
+CALLV
+pop
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 564
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 2048
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRLP4 36
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 304
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Team_CaptureFlagSound
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $382
+ADDRLP4 0
+CNSTI4 808
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $387
+ADDRGP4 $383
+JUMPV
+LABELV $387
+ADDRLP4 40
+CNSTI4 616
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRI4
+EQI4 $389
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 588
+ADDP4
+CNSTF4 3231711232
+ASGNF4
+ADDRGP4 $390
+JUMPV
+LABELV $389
+ADDRLP4 44
+CNSTI4 616
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $391
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+EQU4 $393
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+LABELV $393
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 592
+ADDP4
+INDIRF4
+CNSTF4 1176256512
+ADDF4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+LEF4 $395
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 48
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 584
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 296
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 131072
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+ADDRGP4 $396
+JUMPV
+LABELV $395
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRF4
+CNSTF4 1176256512
+ADDF4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+LEF4 $399
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 48
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 584
+ADDP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 296
+ADDP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 60
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRI4
+CNSTI4 131072
+BORI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $399
+LABELV $396
+LABELV $391
+LABELV $390
+LABELV $383
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $385
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $382
+ADDRGP4 Team_ResetFlags
+CALLV
+pop
+ADDRGP4 CalculateRanks
+CALLV
+pop
+CNSTI4 0
+RETI4
+LABELV $369
+endproc Team_TouchOurFlag 64 16
+export Team_TouchEnemyFlag
+proc Team_TouchEnemyFlag 8 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 TeamName
+CALLP4
+ASGNP4
+CNSTP4 0
+ARGP4
+ADDRGP4 $404
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 512
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+NEI4 $405
+ADDRLP4 0
+INDIRP4
+CNSTI4 340
+ADDP4
+CNSTI4 2147483647
+ASGNI4
+ADDRGP4 $406
+JUMPV
+LABELV $405
+ADDRLP4 0
+INDIRP4
+CNSTI4 344
+ADDP4
+CNSTI4 2147483647
+ASGNI4
+LABELV $406
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 Team_SetFlagStatus
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 AddScore
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 596
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Team_TakeFlagSound
+CALLV
+pop
+CNSTI4 -1
+RETI4
+LABELV $403
+endproc Team_TouchEnemyFlag 8 16
+export Pickup_Team
+proc Pickup_Team 20 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $245
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $409
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $410
+JUMPV
+LABELV $409
+ADDRFP4 0
+INDIRP4
+CNSTI4 524
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $247
+ARGP4
+ADDRLP4 12
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $411
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRGP4 $412
+JUMPV
+LABELV $411
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $413
+ARGP4
+ADDRGP4 PrintMsg
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $408
+JUMPV
+LABELV $412
+LABELV $410
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+NEI4 $414
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Team_TouchOurFlag
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+ADDRGP4 $408
+JUMPV
+LABELV $414
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 Team_TouchEnemyFlag
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+RETI4
+LABELV $408
+endproc Pickup_Team 20 12
+export Team_GetLocation
+proc Team_GetLocation 48 8
+ADDRLP4 24
+CNSTP4 0
+ASGNP4
+ADDRLP4 20
+CNSTF4 1296039936
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRGP4 level+9172
+INDIRP4
+ASGNP4
+ADDRGP4 $420
+JUMPV
+LABELV $417
+ADDRLP4 32
+ADDRLP4 4
+INDIRF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 32
+INDIRF4
+ADDRLP4 32
+INDIRF4
+MULF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+ADDRLP4 4+4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ADDRLP4 4+8
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LEF4 $426
+ADDRGP4 $418
+JUMPV
+LABELV $426
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_InPVS
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 0
+NEI4 $428
+ADDRGP4 $418
+JUMPV
+LABELV $428
+ADDRLP4 20
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $418
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 604
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $420
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $417
+ADDRLP4 24
+INDIRP4
+RETP4
+LABELV $416
+endproc Team_GetLocation 48 8
+export Team_GetLocationMsg
+proc Team_GetLocationMsg 12 24
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Team_GetLocation
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $431
+CNSTI4 0
+RETI4
+ADDRGP4 $430
+JUMPV
+LABELV $431
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $433
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $435
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $435
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRI4
+CNSTI4 7
+LEI4 $437
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+CNSTI4 7
+ASGNI4
+LABELV $437
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $439
+ARGP4
+CNSTI4 94
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRI4
+CNSTI4 48
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $434
+JUMPV
+LABELV $433
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $440
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 636
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $434
+CNSTI4 1
+RETI4
+LABELV $430
+endproc Team_GetLocationMsg 12 24
+export SelectRandomTeamSpawnPoint
+proc SelectRandomTeamSpawnPoint 152 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $442
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $444
+ADDRLP4 8
+ADDRGP4 $446
+ASGNP4
+ADDRGP4 $443
+JUMPV
+LABELV $444
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $447
+ADDRLP4 8
+ADDRGP4 $449
+ASGNP4
+ADDRGP4 $443
+JUMPV
+LABELV $447
+CNSTP4 0
+RETP4
+ADDRGP4 $441
+JUMPV
+LABELV $442
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $450
+ADDRLP4 8
+ADDRGP4 $452
+ASGNP4
+ADDRGP4 $451
+JUMPV
+LABELV $450
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $453
+ADDRLP4 8
+ADDRGP4 $455
+ASGNP4
+ADDRGP4 $454
+JUMPV
+LABELV $453
+CNSTP4 0
+RETP4
+ADDRGP4 $441
+JUMPV
+LABELV $454
+LABELV $451
+LABELV $443
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $457
+JUMPV
+LABELV $456
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 SpotWouldTelefrag
+CALLI4
+ASGNI4
+ADDRLP4 144
+INDIRI4
+CNSTI4 0
+EQI4 $459
+ADDRGP4 $457
+JUMPV
+LABELV $459
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 148
+INDIRI4
+ASGNI4
+ADDRLP4 148
+INDIRI4
+CNSTI4 32
+NEI4 $461
+ADDRGP4 $458
+JUMPV
+LABELV $461
+LABELV $457
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 144
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 144
+INDIRP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $456
+LABELV $458
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $463
+CNSTP4 0
+ARGP4
+CNSTI4 524
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 148
+ADDRGP4 G_Find
+CALLP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+RETP4
+ADDRGP4 $441
+JUMPV
+LABELV $463
+ADDRLP4 148
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 148
+INDIRI4
+ADDRLP4 4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 140
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+INDIRP4
+RETP4
+LABELV $441
+endproc SelectRandomTeamSpawnPoint 152 12
+export SelectCTFSpawnPoint
+proc SelectCTFSpawnPoint 12 12
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 SelectRandomTeamSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $466
+ADDRGP4 vec3_origin
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 SelectSpawnPoint
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+RETP4
+ADDRGP4 $465
+JUMPV
+LABELV $466
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CNSTF4 1091567616
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $465
+endproc SelectCTFSpawnPoint 12 12
+proc SortClients 0 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+SUBI4
+RETI4
+LABELV $468
+endproc SortClients 0 0
+export TeamplayInfoMessage
+proc TeamplayInfoMessage 9408 36
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 612
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $470
+ADDRGP4 $469
+JUMPV
+LABELV $470
+ADDRLP4 9372
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 9372
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 9372
+INDIRI4
+ASGNI4
+ADDRGP4 $475
+JUMPV
+LABELV $472
+ADDRLP4 0
+CNSTI4 808
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $478
+ADDRLP4 9380
+CNSTI4 516
+ASGNI4
+ADDRLP4 9384
+CNSTI4 616
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 9380
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 9384
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 9380
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 9384
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $478
+ADDRLP4 9388
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 9388
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 9392
+CNSTI4 2
+ASGNI4
+ADDRLP4 9388
+INDIRI4
+ADDRLP4 9392
+INDIRI4
+LSHI4
+ADDRLP4 9244
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 9392
+INDIRI4
+LSHI4
+ADDRGP4 level+84
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $478
+LABELV $473
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $475
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+GEI4 $481
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LTI4 $472
+LABELV $481
+ADDRLP4 9244
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 SortClients
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRLP4 1052
+CNSTI1 0
+ASGNI1
+ADDRLP4 9376
+CNSTI4 0
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 9376
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 9376
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 9376
+INDIRI4
+ASGNI4
+ADDRGP4 $485
+JUMPV
+LABELV $482
+ADDRLP4 0
+CNSTI4 808
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $487
+ADDRLP4 9384
+CNSTI4 516
+ASGNI4
+ADDRLP4 9388
+CNSTI4 616
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 9384
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 9388
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 9384
+INDIRI4
+ADDP4
+INDIRP4
+ADDRLP4 9388
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $487
+ADDRLP4 9392
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+ASGNP4
+ADDRLP4 1036
+ADDRLP4 9392
+INDIRP4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 9392
+INDIRP4
+INDIRP4
+CNSTI4 196
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+GEI4 $489
+ADDRLP4 1036
+CNSTI4 0
+ASGNI4
+LABELV $489
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+GEI4 $491
+ADDRLP4 1040
+CNSTI4 0
+ASGNI4
+LABELV $491
+ADDRLP4 12
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $493
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 9400
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 9400
+INDIRP4
+CNSTI4 560
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRLP4 1040
+INDIRI4
+ARGI4
+ADDRLP4 9400
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 188
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 9404
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1048
+ADDRLP4 9404
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+ADDI4
+CVIU4 4
+CNSTU4 8192
+LEU4 $494
+ADDRGP4 $484
+JUMPV
+LABELV $494
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 1052
+ADDP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 1044
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 1048
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $487
+LABELV $483
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $485
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+GEI4 $496
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LTI4 $482
+LABELV $496
+LABELV $484
+ADDRGP4 $497
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 1052
+ARGP4
+ADDRLP4 9380
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRGP4 g_entities
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 808
+DIVI4
+ARGI4
+ADDRLP4 9380
+INDIRP4
+ARGP4
+ADDRGP4 trap_SendServerCommand
+CALLV
+pop
+LABELV $469
+endproc TeamplayInfoMessage 9408 36
+export CheckTeamStatus
+proc CheckTeamStatus 24 4
+ADDRGP4 level+32
+INDIRI4
+ADDRGP4 level+60
+INDIRI4
+SUBI4
+CNSTI4 1000
+LEI4 $499
+ADDRGP4 level+60
+ADDRGP4 level+32
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $508
+JUMPV
+LABELV $505
+ADDRLP4 0
+CNSTI4 808
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $510
+ADDRGP4 $506
+JUMPV
+LABELV $510
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $512
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+EQI4 $514
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $512
+LABELV $514
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 Team_GetLocation
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $515
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 560
+ADDP4
+ADDRLP4 8
+INDIRP4
+CNSTI4 732
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $516
+JUMPV
+LABELV $515
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 560
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $516
+LABELV $512
+LABELV $506
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $508
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $505
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $520
+JUMPV
+LABELV $517
+ADDRLP4 0
+CNSTI4 808
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 468
+ADDP4
+INDIRI4
+CNSTI4 2
+EQI4 $522
+ADDRGP4 $518
+JUMPV
+LABELV $522
+ADDRLP4 0
+INDIRP4
+CNSTI4 520
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $524
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 616
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+EQI4 $526
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+NEI4 $524
+LABELV $526
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 TeamplayInfoMessage
+CALLV
+pop
+LABELV $524
+LABELV $518
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $520
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_maxclients+12
+INDIRI4
+LTI4 $517
+LABELV $499
+LABELV $498
+endproc CheckTeamStatus 24 4
+export SP_team_CTF_redplayer
+proc SP_team_CTF_redplayer 0 0
+LABELV $527
+endproc SP_team_CTF_redplayer 0 0
+export SP_team_CTF_blueplayer
+proc SP_team_CTF_blueplayer 0 0
+LABELV $528
+endproc SP_team_CTF_blueplayer 0 0
+export SP_team_CTF_redspawn
+proc SP_team_CTF_redspawn 0 0
+LABELV $529
+endproc SP_team_CTF_redspawn 0 0
+export SP_team_CTF_bluespawn
+proc SP_team_CTF_bluespawn 0 0
+LABELV $530
+endproc SP_team_CTF_bluespawn 0 0
+bss
+export neutralObelisk
+align 4
+LABELV neutralObelisk
+skip 4
+export teamgame
+align 4
+LABELV teamgame
+skip 36
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import DeathmatchScoreboardMessage
+import G_SetStats
+import MoveClientToIntermission
+import FireWeapon
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import Weapon_HookThink
+import Weapon_HookFree
+import CheckGauntletAttack
+import SnapVectorTowards
+import CalcMuzzlePoint
+import LogAccuracyHit
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import G_RunMissile
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $497
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $493
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $455
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $452
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 115
+byte 1 112
+byte 1 97
+byte 1 119
+byte 1 110
+byte 1 0
+align 1
+LABELV $449
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $446
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $440
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $439
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 99
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $413
+byte 1 68
+byte 1 111
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 119
+byte 1 104
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 10
+byte 1 0
+align 1
+LABELV $404
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 103
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $378
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $374
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $354
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $353
+byte 1 84
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 104
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 100
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $347
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $319
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 84
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $313
+byte 1 87
+byte 1 97
+byte 1 114
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 83
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $300
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 110
+byte 1 101
+byte 1 117
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 108
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $247
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 98
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $245
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $225
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $214
+byte 1 37
+byte 1 115
+byte 1 94
+byte 1 55
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 103
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 115
+byte 1 32
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 99
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 33
+byte 1 10
+byte 1 0
+align 1
+LABELV $103
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 34
+byte 1 37
+byte 1 115
+byte 1 34
+byte 1 0
+align 1
+LABELV $98
+byte 1 80
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 77
+byte 1 115
+byte 1 103
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 0
+align 1
+LABELV $93
+byte 1 94
+byte 1 55
+byte 1 0
+align 1
+LABELV $92
+byte 1 94
+byte 1 51
+byte 1 0
+align 1
+LABELV $89
+byte 1 94
+byte 1 52
+byte 1 0
+align 1
+LABELV $86
+byte 1 94
+byte 1 49
+byte 1 0
+align 1
+LABELV $75
+byte 1 70
+byte 1 82
+byte 1 69
+byte 1 69
+byte 1 0
+align 1
+LABELV $74
+byte 1 83
+byte 1 80
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 65
+byte 1 84
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $71
+byte 1 66
+byte 1 76
+byte 1 85
+byte 1 69
+byte 1 0
+align 1
+LABELV $68
+byte 1 82
+byte 1 69
+byte 1 68
+byte 1 0
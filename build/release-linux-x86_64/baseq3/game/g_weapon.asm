@@ -0,0 +1,3949 @@
+export G_BounceProjectile
+code
+proc G_BounceProjectile 68 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 52
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 24
+ADDRLP4 44
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+CNSTF4 3221225472
+ADDRLP4 24
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 44
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 0+8
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 3221225472
+ADDRLP4 24
+INDIRF4
+MULF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 12
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1174405120
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1174405120
+ADDRLP4 12+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+CNSTF4 1174405120
+ADDRLP4 12+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $53
+endproc G_BounceProjectile 68 4
+export Weapon_Gauntlet
+proc Weapon_Gauntlet 0 0
+LABELV $64
+endproc Weapon_Gauntlet 0 0
+export CheckGauntletAttack
+proc CheckGauntletAttack 104 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRGP4 right
+ARGP4
+ADDRGP4 up
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRGP4 right
+ARGP4
+ADDRGP4 up
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 CalcMuzzlePoint
+CALLV
+pop
+ADDRLP4 80
+CNSTF4 1107296256
+ASGNF4
+ADDRLP4 60
+ADDRGP4 muzzle
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDRGP4 forward
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60+4
+ADDRGP4 muzzle+4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDRGP4 forward+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60+8
+ADDRGP4 muzzle+8
+INDIRF4
+CNSTF4 1107296256
+ADDRGP4 forward+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRLP4 84
+CNSTP4 0
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 4+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $72
+CNSTI4 0
+RETI4
+ADDRGP4 $65
+JUMPV
+LABELV $72
+ADDRLP4 0
+CNSTI4 808
+ADDRLP4 4+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $76
+ADDRLP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $76
+ADDRLP4 4+12
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRLP4 92
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 92
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4+24
+ARGP4
+ADDRLP4 96
+ADDRGP4 DirToByte
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 100
+CNSTI4 192
+ASGNI4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 100
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $76
+ADDRLP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $80
+CNSTI4 0
+RETI4
+ADDRGP4 $65
+JUMPV
+LABELV $80
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $82
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 61
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 G_AddEvent
+CALLV
+pop
+ADDRGP4 s_quadFactor
+ADDRGP4 g_quadfactor+8
+INDIRF4
+ASGNF4
+ADDRGP4 $83
+JUMPV
+LABELV $82
+ADDRGP4 s_quadFactor
+CNSTF4 1065353216
+ASGNF4
+LABELV $83
+ADDRLP4 76
+CNSTF4 1112014848
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 76
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 2
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $65
+endproc CheckGauntletAttack 104 32
+export SnapVectorTowards
+proc SnapVectorTowards 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $87
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+GTF4 $91
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRGP4 $92
+JUMPV
+LABELV $91
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CNSTI4 1
+ADDI4
+CVIF4 4
+ASGNF4
+LABELV $92
+LABELV $88
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $87
+LABELV $86
+endproc SnapVectorTowards 12 0
+export Bullet_Fire
+proc Bullet_Fire 144 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 92
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 84
+CNSTF4 1073741824
+CNSTF4 1078530011
+ADDRLP4 92
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 96
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 100
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 88
+CNSTF4 1098907648
+ADDRLP4 96
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 100
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDRFP4 4
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 84
+INDIRF4
+ARGF4
+ADDRLP4 104
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 108
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 84
+CNSTF4 1098907648
+ADDRLP4 104
+INDIRF4
+CNSTF4 1073741824
+ADDRLP4 108
+INDIRI4
+CNSTI4 32767
+BANDI4
+CVIF4 4
+CNSTF4 1191181824
+DIVF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+MULF4
+ADDRFP4 4
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 112
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 64
+ADDRGP4 muzzle
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRGP4 forward
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRGP4 muzzle+4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRGP4 forward+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRGP4 muzzle+8
+INDIRF4
+CNSTF4 1207959552
+ADDRGP4 forward+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 64
+INDIRF4
+ADDRGP4 right
+INDIRF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 64+4
+INDIRF4
+ADDRGP4 right+4
+INDIRF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRLP4 64+8
+INDIRF4
+ADDRGP4 right+8
+INDIRF4
+ADDRLP4 84
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64
+ADDRLP4 64
+INDIRF4
+ADDRGP4 up
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64+4
+ADDRLP4 64+4
+INDIRF4
+ADDRGP4 up+4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 64+8
+ADDRLP4 64+8
+INDIRF4
+ADDRGP4 up+8
+INDIRF4
+ADDRLP4 88
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+LABELV $112
+ADDRLP4 0
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRLP4 124
+CNSTP4 0
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 124
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 80
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $116
+ADDRGP4 $93
+JUMPV
+LABELV $116
+ADDRLP4 56
+CNSTI4 808
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0+12
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 SnapVectorTowards
+CALLV
+pop
+ADDRLP4 56
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $121
+ADDRLP4 56
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $121
+ADDRLP4 0+12
+ARGP4
+CNSTI4 48
+ARGI4
+ADDRLP4 132
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 136
+ADDRGP4 LogAccuracyHit
+CALLI4
+ASGNI4
+ADDRLP4 136
+INDIRI4
+CNSTI4 0
+EQI4 $122
+ADDRLP4 140
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 716
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $122
+JUMPV
+LABELV $121
+ADDRLP4 0+12
+ARGP4
+CNSTI4 49
+ARGI4
+ADDRLP4 132
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 132
+INDIRP4
+ASGNP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 136
+ADDRGP4 DirToByte
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 136
+INDIRI4
+ASGNI4
+LABELV $122
+ADDRLP4 60
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $114
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 3
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRGP4 $114
+JUMPV
+LABELV $113
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 10
+LTI4 $112
+LABELV $114
+LABELV $93
+endproc Bullet_Fire 144 32
+export BFG_Fire
+proc BFG_Fire 16 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 4
+ADDRGP4 fire_bfg
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $131
+endproc BFG_Fire 16 12
+export ShotgunPellet
+proc ShotgunPellet 108 32
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 64
+ADDRFP4 8
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 80
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+LABELV $133
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ARGP4
+ADDRLP4 96
+CNSTP4 0
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 96
+INDIRP4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 64
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 56
+CNSTI4 808
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $138
+CNSTI4 0
+RETI4
+ADDRGP4 $132
+JUMPV
+LABELV $138
+ADDRLP4 56
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $141
+ADDRLP4 92
+CNSTF4 1092616192
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 92
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 LogAccuracyHit
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+CNSTI4 0
+EQI4 $144
+CNSTI4 1
+RETI4
+ADDRGP4 $132
+JUMPV
+LABELV $144
+LABELV $141
+CNSTI4 0
+RETI4
+ADDRGP4 $132
+JUMPV
+LABELV $134
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 10
+LTI4 $133
+CNSTI4 0
+RETI4
+LABELV $132
+endproc ShotgunPellet 108 32
+export ShotgunPattern
+proc ShotgunPattern 108 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 60
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 VectorNormalize2
+CALLF4
+pop
+ADDRLP4 32
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 32
+ARGP4
+ADDRLP4 44
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 64
+ADDRFP4 12
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 248
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+CNSTI4 0
+ASGNI4
+LABELV $147
+ADDRFP4 8
+ARGP4
+ADDRLP4 68
+ADDRGP4 Q_crandom
+CALLF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 1098907648
+CNSTF4 1143930880
+ADDRLP4 68
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRFP4 8
+ARGP4
+ADDRLP4 72
+ADDRGP4 Q_crandom
+CALLF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1098907648
+CNSTF4 1143930880
+ADDRLP4 72
+INDIRF4
+MULF4
+MULF4
+ASGNF4
+ADDRLP4 80
+CNSTF4 1207959552
+ASGNF4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 80
+INDIRF4
+ADDRLP4 20+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+CNSTF4 1207959552
+ADDRLP4 20+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 32+4
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 32+8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 44+4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 44+8
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 ShotgunPellet
+CALLI4
+ASGNI4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 92
+INDIRI4
+ADDRLP4 96
+INDIRI4
+EQI4 $167
+ADDRLP4 60
+INDIRI4
+ADDRLP4 96
+INDIRI4
+NEI4 $167
+ADDRLP4 100
+CNSTI4 1
+ASGNI4
+ADDRLP4 60
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRLP4 104
+ADDRFP4 12
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 716
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+ADDRLP4 100
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $167
+LABELV $148
+ADDRLP4 56
+ADDRLP4 56
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 11
+LTI4 $147
+LABELV $146
+endproc ShotgunPattern 108 12
+export weapon_supershotgun_fire
+proc weapon_supershotgun_fire 20 16
+ADDRGP4 muzzle
+ARGP4
+CNSTI4 54
+ARGI4
+ADDRLP4 4
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+CNSTF4 1166016512
+ADDRGP4 forward
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+CNSTF4 1166016512
+ADDRGP4 forward+4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTF4 1166016512
+ADDRGP4 forward+8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 255
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 104
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ShotgunPattern
+CALLV
+pop
+LABELV $169
+endproc weapon_supershotgun_fire 20 16
+export weapon_grenadelauncher_fire
+proc weapon_grenadelauncher_fire 20 12
+ADDRLP4 4
+ADDRGP4 forward+8
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+CNSTF4 1045220557
+ADDF4
+ASGNF4
+ADDRGP4 forward
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 8
+ADDRGP4 fire_grenade
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $172
+endproc weapon_grenadelauncher_fire 20 12
+export Weapon_RocketLauncher_Fire
+proc Weapon_RocketLauncher_Fire 16 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 4
+ADDRGP4 fire_rocket
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $174
+endproc Weapon_RocketLauncher_Fire 16 12
+export Weapon_Plasmagun_Fire
+proc Weapon_Plasmagun_Fire 16 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 4
+ADDRGP4 fire_plasma
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 740
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 744
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+LABELV $175
+endproc Weapon_Plasmagun_Fire 16 12
+export weapon_railgun_fire
+proc weapon_railgun_fire 176 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 104
+CNSTF4 1120403456
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 112
+CNSTF4 1174405120
+ASGNF4
+ADDRLP4 88
+ADDRGP4 muzzle
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRGP4 forward
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 88+4
+ADDRGP4 muzzle+4
+INDIRF4
+ADDRLP4 112
+INDIRF4
+ADDRGP4 forward+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 88+8
+ADDRGP4 muzzle+8
+INDIRF4
+CNSTF4 1174405120
+ADDRGP4 forward+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 116
+CNSTI4 0
+ASGNI4
+ADDRLP4 60
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 108
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 100
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $183
+ADDRLP4 4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRLP4 120
+CNSTP4 0
+ASGNP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 120
+INDIRP4
+ARGP4
+ADDRLP4 88
+ARGP4
+ADDRLP4 100
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 4+52
+INDIRI4
+CNSTI4 1022
+LTI4 $186
+ADDRGP4 $185
+JUMPV
+LABELV $186
+ADDRLP4 0
+CNSTI4 808
+ADDRLP4 4+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $190
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 124
+ADDRGP4 LogAccuracyHit
+CALLI4
+ASGNI4
+ADDRLP4 124
+INDIRI4
+CNSTI4 0
+EQI4 $192
+ADDRLP4 108
+ADDRLP4 108
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $192
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 104
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 10
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $190
+ADDRLP4 4+48
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $195
+ADDRGP4 $185
+JUMPV
+LABELV $195
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 trap_UnlinkEntity
+CALLV
+pop
+ADDRLP4 60
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 60
+ADDRLP4 60
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $184
+ADDRLP4 60
+INDIRI4
+CNSTI4 4
+LTI4 $183
+LABELV $185
+ADDRLP4 64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $201
+JUMPV
+LABELV $198
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 68
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_LinkEntity
+CALLV
+pop
+LABELV $199
+ADDRLP4 64
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $201
+ADDRLP4 64
+INDIRI4
+ADDRLP4 60
+INDIRI4
+LTI4 $198
+ADDRLP4 4+12
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 SnapVectorTowards
+CALLV
+pop
+ADDRLP4 4+12
+ARGP4
+CNSTI4 53
+ARGI4
+ADDRLP4 120
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 84
+ADDRLP4 120
+INDIRP4
+ASGNP4
+ADDRLP4 124
+CNSTI4 168
+ASGNI4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 124
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 84
+INDIRP4
+CNSTI4 104
+ADDP4
+ADDRGP4 muzzle
+INDIRB
+ASGNB 12
+ADDRLP4 128
+ADDRLP4 84
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 128
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 right
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 132
+ADDRLP4 84
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 132
+INDIRP4
+ADDRLP4 132
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 right+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 136
+ADDRLP4 84
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+CNSTF4 1082130432
+ADDRGP4 right+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 140
+ADDRLP4 84
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 140
+INDIRP4
+ADDRLP4 140
+INDIRP4
+INDIRF4
+CNSTF4 3212836864
+ADDRGP4 up
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 144
+ADDRLP4 84
+INDIRP4
+CNSTI4 108
+ADDP4
+ASGNP4
+ADDRLP4 144
+INDIRP4
+ADDRLP4 144
+INDIRP4
+INDIRF4
+CNSTF4 3212836864
+ADDRGP4 up+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 148
+ADDRLP4 84
+INDIRP4
+CNSTI4 112
+ADDP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+ADDRLP4 148
+INDIRP4
+INDIRF4
+CNSTF4 3212836864
+ADDRGP4 up+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+EQI4 $208
+ADDRLP4 84
+INDIRP4
+CNSTI4 184
+ADDP4
+CNSTI4 255
+ASGNI4
+ADDRGP4 $209
+JUMPV
+LABELV $208
+ADDRLP4 4+24
+ARGP4
+ADDRLP4 152
+ADDRGP4 DirToByte
+CALLI4
+ASGNI4
+ADDRLP4 84
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 152
+INDIRI4
+ASGNI4
+LABELV $209
+ADDRLP4 152
+CNSTI4 168
+ASGNI4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 152
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 108
+INDIRI4
+CNSTI4 0
+NEI4 $212
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 708
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 708
+ADDP4
+ASGNP4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 156
+INDIRP4
+INDIRI4
+ADDRLP4 108
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 708
+ADDP4
+INDIRI4
+CNSTI4 2
+LTI4 $214
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 708
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 284
+ADDP4
+ASGNP4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 164
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 168
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 168
+INDIRP4
+ADDRLP4 168
+INDIRP4
+INDIRI4
+CNSTI4 -231497
+BANDI4
+ASGNI4
+ADDRLP4 172
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 104
+ADDP4
+ASGNP4
+ADDRLP4 172
+INDIRP4
+ADDRLP4 172
+INDIRP4
+INDIRI4
+CNSTI4 32768
+BORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 744
+ADDP4
+ADDRGP4 level+32
+INDIRI4
+CNSTI4 2000
+ADDI4
+ASGNI4
+LABELV $214
+ADDRLP4 160
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 716
+ADDP4
+ASGNP4
+ADDRLP4 160
+INDIRP4
+ADDRLP4 160
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $213
+LABELV $176
+endproc weapon_railgun_fire 176 32
+export Weapon_GrapplingHook_Fire
+proc Weapon_GrapplingHook_Fire 4 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 756
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $218
+ADDRLP4 0
+INDIRP4
+CNSTI4 760
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $218
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRGP4 fire_grapple
+CALLP4
+pop
+LABELV $218
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 756
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $217
+endproc Weapon_GrapplingHook_Fire 4 12
+export Weapon_HookFree
+proc Weapon_HookFree 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 760
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 -2049
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 G_FreeEntity
+CALLV
+pop
+LABELV $220
+endproc Weapon_HookFree 4 4
+export Weapon_HookThink
+proc Weapon_HookThink 52 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $222
+ADDRLP4 28
+CNSTI4 488
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 32
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 40
+CNSTF4 1056964608
+ASGNF4
+ADDRLP4 0
+ADDRLP4 36
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 436
+ADDP4
+INDIRF4
+ADDRLP4 36
+INDIRP4
+CNSTI4 448
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRLP4 32
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0+4
+ADDRLP4 44
+INDIRP4
+CNSTI4 492
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 440
+ADDP4
+INDIRF4
+ADDRLP4 44
+INDIRP4
+CNSTI4 452
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 48
+ADDRFP4 0
+INDIRP4
+CNSTI4 768
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0+8
+ADDRLP4 48
+INDIRP4
+CNSTI4 496
+ADDP4
+INDIRF4
+CNSTF4 1056964608
+ADDRLP4 48
+INDIRP4
+CNSTI4 444
+ADDP4
+INDIRF4
+ADDRLP4 48
+INDIRP4
+CNSTI4 456
+ADDP4
+INDIRF4
+ADDF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 SnapVectorTowards
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 G_SetOrigin
+CALLV
+pop
+LABELV $222
+ADDRFP4 0
+INDIRP4
+CNSTI4 600
+ADDP4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 92
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 488
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $221
+endproc Weapon_HookThink 52 8
+export Weapon_LightningFire
+proc Weapon_LightningFire 120 32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 84
+CNSTF4 1090519040
+ADDRGP4 s_quadFactor
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+CNSTI4 0
+ASGNI4
+LABELV $227
+ADDRLP4 88
+CNSTF4 1145044992
+ASGNF4
+ADDRLP4 60
+ADDRGP4 muzzle
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDRGP4 forward
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60+4
+ADDRGP4 muzzle+4
+INDIRF4
+ADDRLP4 88
+INDIRF4
+ADDRGP4 forward+4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 60+8
+ADDRGP4 muzzle+8
+INDIRF4
+CNSTF4 1145044992
+ADDRGP4 forward+8
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRLP4 92
+CNSTP4 0
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 60
+ARGP4
+ADDRLP4 80
+INDIRI4
+ARGI4
+CNSTI4 100663297
+ARGI4
+ADDRGP4 trap_Trace
+CALLV
+pop
+ADDRLP4 0+52
+INDIRI4
+CNSTI4 1023
+NEI4 $237
+ADDRGP4 $226
+JUMPV
+LABELV $237
+ADDRLP4 56
+CNSTI4 808
+ADDRLP4 0+52
+INDIRI4
+MULI4
+ADDRGP4 g_entities
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $241
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRLP4 0+12
+ARGP4
+ADDRLP4 84
+INDIRI4
+ARGI4
+CNSTI4 0
+ARGI4
+CNSTI4 11
+ARGI4
+ADDRGP4 G_Damage
+CALLV
+pop
+LABELV $241
+ADDRLP4 56
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $244
+ADDRLP4 56
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $244
+ADDRLP4 0+12
+ARGP4
+CNSTI4 50
+ARGI4
+ADDRLP4 100
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 56
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 104
+ADDRGP4 DirToByte
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRLP4 108
+CNSTI4 192
+ASGNI4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 108
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 112
+ADDRGP4 LogAccuracyHit
+CALLI4
+ASGNI4
+ADDRLP4 112
+INDIRI4
+CNSTI4 0
+EQI4 $229
+ADDRLP4 116
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 716
+ADDP4
+ASGNP4
+ADDRLP4 116
+INDIRP4
+ADDRLP4 116
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $244
+ADDRLP4 0+44
+INDIRI4
+CNSTI4 16
+BANDI4
+CNSTI4 0
+NEI4 $229
+ADDRLP4 0+12
+ARGP4
+CNSTI4 51
+ARGI4
+ADDRLP4 100
+ADDRGP4 G_TempEntity
+CALLP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 100
+INDIRP4
+ASGNP4
+ADDRLP4 0+24
+ARGP4
+ADDRLP4 104
+ADDRGP4 DirToByte
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRP4
+CNSTI4 184
+ADDP4
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $228
+ADDRLP4 76
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 10
+LTI4 $227
+LABELV $229
+LABELV $226
+endproc Weapon_LightningFire 120 32
+export LogAccuracyHit
+proc LogAccuracyHit 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 736
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $256
+CNSTI4 0
+RETI4
+ADDRGP4 $255
+JUMPV
+LABELV $256
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+NEU4 $258
+CNSTI4 0
+RETI4
+ADDRGP4 $255
+JUMPV
+LABELV $258
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $260
+CNSTI4 0
+RETI4
+ADDRGP4 $255
+JUMPV
+LABELV $260
+ADDRFP4 4
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $262
+CNSTI4 0
+RETI4
+ADDRGP4 $255
+JUMPV
+LABELV $262
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 184
+ADDP4
+INDIRI4
+CNSTI4 0
+GTI4 $264
+CNSTI4 0
+RETI4
+ADDRGP4 $255
+JUMPV
+LABELV $264
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 OnSameTeam
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $266
+CNSTI4 0
+RETI4
+ADDRGP4 $255
+JUMPV
+LABELV $266
+CNSTI4 1
+RETI4
+LABELV $255
+endproc LogAccuracyHit 4 8
+export CalcMuzzlePoint
+proc CalcMuzzlePoint 36 0
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 16
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 20
+ADDRFP4 16
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 16
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $268
+endproc CalcMuzzlePoint 36 0
+export CalcMuzzlePointOrigin
+proc CalcMuzzlePointOrigin 36 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 20
+ADDRFP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 164
+ADDP4
+INDIRI4
+CVIF4 4
+ADDF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 20
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 20
+ADDRFP4 20
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRF4
+CNSTF4 1096810496
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 20
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 20
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 20
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $269
+endproc CalcMuzzlePointOrigin 36 0
+export FireWeapon
+proc FireWeapon 16 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 316
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $271
+ADDRGP4 s_quadFactor
+ADDRGP4 g_quadfactor+8
+INDIRF4
+ASGNF4
+ADDRGP4 $272
+JUMPV
+LABELV $271
+ADDRGP4 s_quadFactor
+CNSTF4 1065353216
+ASGNF4
+LABELV $272
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $274
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $274
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 712
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $274
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 152
+ADDP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRGP4 right
+ARGP4
+ADDRGP4 up
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 516
+ADDP4
+INDIRP4
+CNSTI4 668
+ADDP4
+ARGP4
+ADDRGP4 forward
+ARGP4
+ADDRGP4 right
+ARGP4
+ADDRGP4 up
+ARGP4
+ADDRGP4 muzzle
+ARGP4
+ADDRGP4 CalcMuzzlePointOrigin
+CALLV
+pop
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 192
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $277
+ADDRLP4 8
+INDIRI4
+CNSTI4 10
+GTI4 $277
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $292-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $292
+address $279
+address $282
+address $281
+address $286
+address $287
+address $280
+address $289
+address $288
+address $290
+address $291
+code
+LABELV $279
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_Gauntlet
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $280
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_LightningFire
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $281
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 weapon_supershotgun_fire
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $282
+ADDRGP4 g_gametype+12
+INDIRI4
+CNSTI4 3
+EQI4 $283
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1128792064
+ARGF4
+CNSTI4 7
+ARGI4
+ADDRGP4 Bullet_Fire
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $283
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTF4 1128792064
+ARGF4
+CNSTI4 5
+ARGI4
+ADDRGP4 Bullet_Fire
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $286
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 weapon_grenadelauncher_fire
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $287
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_RocketLauncher_Fire
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $288
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_Plasmagun_Fire
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $289
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 weapon_railgun_fire
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $290
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BFG_Fire
+CALLV
+pop
+ADDRGP4 $277
+JUMPV
+LABELV $291
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Weapon_GrapplingHook_Fire
+CALLV
+pop
+LABELV $277
+LABELV $270
+endproc FireWeapon 16 24
+bss
+align 4
+LABELV muzzle
+skip 12
+align 4
+LABELV up
+skip 12
+align 4
+LABELV right
+skip 12
+align 4
+LABELV forward
+skip 12
+align 4
+LABELV s_quadFactor
+skip 4
+import trap_SnapVector
+import trap_GeneticParentsAndChildSelection
+import trap_BotResetWeaponState
+import trap_BotFreeWeaponState
+import trap_BotAllocWeaponState
+import trap_BotLoadWeaponWeights
+import trap_BotGetWeaponInfo
+import trap_BotChooseBestFightWeapon
+import trap_BotAddAvoidSpot
+import trap_BotInitMoveState
+import trap_BotFreeMoveState
+import trap_BotAllocMoveState
+import trap_BotPredictVisiblePosition
+import trap_BotMovementViewTarget
+import trap_BotReachabilityArea
+import trap_BotResetLastAvoidReach
+import trap_BotResetAvoidReach
+import trap_BotMoveInDirection
+import trap_BotMoveToGoal
+import trap_BotResetMoveState
+import trap_BotFreeGoalState
+import trap_BotAllocGoalState
+import trap_BotMutateGoalFuzzyLogic
+import trap_BotSaveGoalFuzzyLogic
+import trap_BotInterbreedGoalFuzzyLogic
+import trap_BotFreeItemWeights
+import trap_BotLoadItemWeights
+import trap_BotUpdateEntityItems
+import trap_BotInitLevelItems
+import trap_BotSetAvoidGoalTime
+import trap_BotAvoidGoalTime
+import trap_BotGetLevelItemGoal
+import trap_BotGetMapLocationGoal
+import trap_BotGetNextCampSpotGoal
+import trap_BotItemGoalInVisButNotVisible
+import trap_BotTouchingGoal
+import trap_BotChooseNBGItem
+import trap_BotChooseLTGItem
+import trap_BotGetSecondGoal
+import trap_BotGetTopGoal
+import trap_BotGoalName
+import trap_BotDumpGoalStack
+import trap_BotDumpAvoidGoals
+import trap_BotEmptyGoalStack
+import trap_BotPopGoal
+import trap_BotPushGoal
+import trap_BotResetAvoidGoals
+import trap_BotRemoveFromAvoidGoals
+import trap_BotResetGoalState
+import trap_BotSetChatName
+import trap_BotSetChatGender
+import trap_BotLoadChatFile
+import trap_BotReplaceSynonyms
+import trap_UnifyWhiteSpaces
+import trap_BotMatchVariable
+import trap_BotFindMatch
+import trap_StringContains
+import trap_BotGetChatMessage
+import trap_BotEnterChat
+import trap_BotChatLength
+import trap_BotReplyChat
+import trap_BotNumInitialChats
+import trap_BotInitialChat
+import trap_BotNumConsoleMessages
+import trap_BotNextConsoleMessage
+import trap_BotRemoveConsoleMessage
+import trap_BotQueueConsoleMessage
+import trap_BotFreeChatState
+import trap_BotAllocChatState
+import trap_Characteristic_String
+import trap_Characteristic_BInteger
+import trap_Characteristic_Integer
+import trap_Characteristic_BFloat
+import trap_Characteristic_Float
+import trap_BotFreeCharacter
+import trap_BotLoadCharacter
+import trap_EA_ResetInput
+import trap_EA_GetInput
+import trap_EA_EndRegular
+import trap_EA_View
+import trap_EA_Move
+import trap_EA_DelayedJump
+import trap_EA_Jump
+import trap_EA_SelectWeapon
+import trap_EA_MoveRight
+import trap_EA_MoveLeft
+import trap_EA_MoveBack
+import trap_EA_MoveForward
+import trap_EA_MoveDown
+import trap_EA_MoveUp
+import trap_EA_Crouch
+import trap_EA_Respawn
+import trap_EA_Use
+import trap_EA_Attack
+import trap_EA_Talk
+import trap_EA_Gesture
+import trap_EA_Action
+import trap_EA_Command
+import trap_EA_SayTeam
+import trap_EA_Say
+import trap_AAS_PredictClientMovement
+import trap_AAS_Swimming
+import trap_AAS_AlternativeRouteGoals
+import trap_AAS_PredictRoute
+import trap_AAS_EnableRoutingArea
+import trap_AAS_AreaTravelTimeToGoalArea
+import trap_AAS_AreaReachability
+import trap_AAS_IntForBSPEpairKey
+import trap_AAS_FloatForBSPEpairKey
+import trap_AAS_VectorForBSPEpairKey
+import trap_AAS_ValueForBSPEpairKey
+import trap_AAS_NextBSPEntity
+import trap_AAS_PointContents
+import trap_AAS_TraceAreas
+import trap_AAS_PointReachabilityAreaIndex
+import trap_AAS_PointAreaNum
+import trap_AAS_Time
+import trap_AAS_PresenceTypeBoundingBox
+import trap_AAS_Initialized
+import trap_AAS_EntityInfo
+import trap_AAS_AreaInfo
+import trap_AAS_BBoxAreas
+import trap_BotUserCommand
+import trap_BotGetServerCommand
+import trap_BotGetSnapshotEntity
+import trap_BotLibTest
+import trap_BotLibUpdateEntity
+import trap_BotLibLoadMap
+import trap_BotLibStartFrame
+import trap_BotLibDefine
+import trap_BotLibVarGet
+import trap_BotLibVarSet
+import trap_BotLibShutdown
+import trap_BotLibSetup
+import trap_DebugPolygonDelete
+import trap_DebugPolygonCreate
+import trap_GetEntityToken
+import trap_GetUsercmd
+import trap_BotFreeClient
+import trap_BotAllocateClient
+import trap_EntityContact
+import trap_EntitiesInBox
+import trap_UnlinkEntity
+import trap_LinkEntity
+import trap_AreasConnected
+import trap_AdjustAreaPortalState
+import trap_InPVSIgnorePortals
+import trap_InPVS
+import trap_PointContents
+import trap_Trace
+import trap_SetBrushModel
+import trap_GetServerinfo
+import trap_SetUserinfo
+import trap_GetUserinfo
+import trap_GetConfigstring
+import trap_SetConfigstring
+import trap_SendServerCommand
+import trap_DropClient
+import trap_LocateGameData
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_VariableIntegerValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_SendConsoleCommand
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Args
+import trap_Argv
+import trap_Argc
+import trap_RealTime
+import trap_Milliseconds
+import trap_Error
+import trap_Printf
+import g_proxMineTimeout
+import g_singlePlayer
+import g_enableBreath
+import g_enableDust
+import g_rankings
+import pmove_msec
+import pmove_fixed
+import g_smoothClients
+import g_blueteam
+import g_redteam
+import g_cubeTimeout
+import g_obeliskRespawnDelay
+import g_obeliskRegenAmount
+import g_obeliskRegenPeriod
+import g_obeliskHealth
+import g_filterBan
+import g_banIPs
+import g_teamForceBalance
+import g_teamAutoJoin
+import g_allowVote
+import g_blood
+import g_doWarmup
+import g_warmup
+import g_motd
+import g_synchronousClients
+import g_weaponTeamRespawn
+import g_weaponRespawn
+import g_debugDamage
+import g_debugAlloc
+import g_debugMove
+import g_inactivity
+import g_forcerespawn
+import g_quadfactor
+import g_knockback
+import g_speed
+import g_gravity
+import g_needpass
+import g_password
+import g_friendlyFire
+import g_capturelimit
+import g_timelimit
+import g_fraglimit
+import g_dmflags
+import g_restarted
+import g_maxGameClients
+import g_maxclients
+import g_cheats
+import g_dedicated
+import g_gametype
+import g_entities
+import level
+import Pickup_Team
+import CheckTeamStatus
+import TeamplayInfoMessage
+import Team_GetLocationMsg
+import Team_GetLocation
+import SelectCTFSpawnPoint
+import Team_FreeEntity
+import Team_ReturnFlag
+import Team_InitGame
+import Team_CheckHurtCarrier
+import Team_FragBonuses
+import Team_DroppedFlagThink
+import AddTeamScore
+import TeamColorString
+import OtherTeamName
+import TeamName
+import OtherTeam
+import BotTestAAS
+import BotAIStartFrame
+import BotAIShutdownClient
+import BotAISetupClient
+import BotAILoadMap
+import BotAIShutdown
+import BotAISetup
+import BotInterbreedEndMatch
+import Svcmd_BotList_f
+import Svcmd_AddBot_f
+import G_BotConnect
+import G_RemoveQueuedBotBegin
+import G_CheckBotSpawn
+import G_GetBotInfoByName
+import G_GetBotInfoByNumber
+import G_InitBots
+import Svcmd_AbortPodium_f
+import SpawnModelsOnVictoryPads
+import UpdateTournamentInfo
+import G_WriteSessionData
+import G_InitWorldSession
+import G_InitSessionData
+import G_ReadSessionData
+import Svcmd_GameMem_f
+import G_InitMemory
+import G_Alloc
+import CheckObeliskAttack
+import Team_CheckDroppedItem
+import OnSameTeam
+import G_RunClient
+import ClientEndFrame
+import ClientThink
+import ClientCommand
+import ClientBegin
+import ClientDisconnect
+import ClientUserinfoChanged
+import ClientConnect
+import G_Error
+import G_Printf
+import SendScoreboardMessageToAllClients
+import G_LogPrintf
+import G_RunThink
+import CheckTeamLeader
+import SetLeader
+import FindIntermissionPoint
+import DeathmatchScoreboardMessage
+import G_SetStats
+import MoveClientToIntermission
+import G_FilterPacket
+import G_ProcessIPBans
+import ConsoleCommand
+import SpotWouldTelefrag
+import CalculateRanks
+import AddScore
+import player_die
+import ClientSpawn
+import InitBodyQue
+import InitClientResp
+import InitClientPersistant
+import BeginIntermission
+import respawn
+import CopyToBodyQue
+import SelectSpawnPoint
+import SetClientViewAngle
+import PickTeam
+import TeamLeader
+import TeamCount
+import TeleportPlayer
+import trigger_teleporter_touch
+import Touch_DoorTrigger
+import G_RunMover
+import fire_grapple
+import fire_bfg
+import fire_rocket
+import fire_grenade
+import fire_plasma
+import fire_blaster
+import G_RunMissile
+import TossClientCubes
+import TossClientItems
+import body_die
+import G_InvulnerabilityEffect
+import G_RadiusDamage
+import G_Damage
+import CanDamage
+import BuildShaderStateConfig
+import AddRemap
+import G_SetOrigin
+import G_AddEvent
+import G_AddPredictableEvent
+import vectoyaw
+import vtos
+import tv
+import G_TouchSolids
+import G_TouchTriggers
+import G_EntitiesFree
+import G_FreeEntity
+import G_Sound
+import G_TempEntity
+import G_Spawn
+import G_InitGentity
+import G_SetMovedir
+import G_UseTargets
+import G_PickTarget
+import G_Find
+import G_KillBox
+import G_TeamCommand
+import G_SoundIndex
+import G_ModelIndex
+import SaveRegisteredItems
+import RegisterItem
+import ClearRegisteredItems
+import Touch_Item
+import Add_Ammo
+import ArmorIndex
+import Think_Weapon
+import FinishSpawningItem
+import G_SpawnItem
+import SetRespawn
+import LaunchItem
+import Drop_Item
+import PrecacheItem
+import UseHoldableItem
+import RespawnItem
+import G_RunItem
+import G_CheckTeamItems
+import Cmd_FollowCycle_f
+import SetTeam
+import BroadcastTeamChange
+import StopFollowing
+import Cmd_Score_f
+import G_NewString
+import G_SpawnEntitiesFromString
+import G_SpawnVector
+import G_SpawnInt
+import G_SpawnFloat
+import G_SpawnString
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
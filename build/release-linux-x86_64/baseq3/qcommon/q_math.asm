@@ -0,0 +1,6851 @@
+code
+proc VectorCompare 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+NEF4 $12
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+NEF4 $12
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+EQF4 $9
+LABELV $12
+CNSTI4 0
+RETI4
+ADDRGP4 $8
+JUMPV
+LABELV $9
+CNSTI4 1
+RETI4
+LABELV $8
+endproc VectorCompare 16 0
+proc VectorLength 20 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRF4
+RETF4
+LABELV $13
+endproc VectorLength 20 4
+proc VectorLengthSquared 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $14
+endproc VectorLengthSquared 16 0
+proc Distance 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+ADDRLP4 28
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+RETF4
+LABELV $15
+endproc Distance 32 4
+proc DistanceSquared 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $18
+endproc DistanceSquared 32 0
+proc VectorNormalizeFast 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 8
+INDIRF4
+MULF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Q_rsqrt
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+LABELV $25
+endproc VectorNormalizeFast 36 4
+proc VectorInverse 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $26
+endproc VectorInverse 12 0
+proc CrossProduct 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $27
+endproc CrossProduct 40 0
+data
+export vec3_origin
+align 4
+LABELV vec3_origin
+byte 4 0
+byte 4 0
+byte 4 0
+export axisDefault
+align 4
+LABELV axisDefault
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export colorBlack
+align 4
+LABELV colorBlack
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export colorRed
+align 4
+LABELV colorRed
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export colorGreen
+align 4
+LABELV colorGreen
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+export colorBlue
+align 4
+LABELV colorBlue
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+export colorYellow
+align 4
+LABELV colorYellow
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+export colorMagenta
+align 4
+LABELV colorMagenta
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+export colorCyan
+align 4
+LABELV colorCyan
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export colorWhite
+align 4
+LABELV colorWhite
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export colorLtGrey
+align 4
+LABELV colorLtGrey
+byte 4 1061158912
+byte 4 1061158912
+byte 4 1061158912
+byte 4 1065353216
+export colorMdGrey
+align 4
+LABELV colorMdGrey
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1065353216
+export colorDkGrey
+align 4
+LABELV colorDkGrey
+byte 4 1048576000
+byte 4 1048576000
+byte 4 1048576000
+byte 4 1065353216
+export g_color_table
+align 4
+LABELV g_color_table
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export bytedirs
+align 4
+LABELV bytedirs
+byte 4 3204879951
+byte 4 0
+byte 4 1062847556
+byte 4 3202531056
+byte 4 1047828139
+byte 4 1063074669
+byte 4 3197577718
+byte 4 0
+byte 4 1064605338
+byte 4 3198039930
+byte 4 1056964608
+byte 4 1062149053
+byte 4 3190184938
+byte 4 1049007711
+byte 4 1064532072
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 1062847556
+byte 4 1057396303
+byte 4 3189189110
+byte 4 1060597999
+byte 4 1060013330
+byte 4 1041705462
+byte 4 1060597999
+byte 4 1060013330
+byte 4 0
+byte 4 1057396303
+byte 4 1062847556
+byte 4 1050556282
+byte 4 1056964608
+byte 4 1062149053
+byte 4 1057396303
+byte 4 0
+byte 4 1062847556
+byte 4 1050094070
+byte 4 0
+byte 4 1064605338
+byte 4 1055047408
+byte 4 1047828139
+byte 4 1063074669
+byte 4 1042701290
+byte 4 1049007711
+byte 4 1064532072
+byte 4 3207496978
+byte 4 1041705462
+byte 4 1060597999
+byte 4 3209632701
+byte 4 1050556282
+byte 4 1056964608
+byte 4 3205921044
+byte 4 1054458931
+byte 4 1060121929
+byte 4 3210331204
+byte 4 1057396303
+byte 4 0
+byte 4 3210558317
+byte 4 1055047408
+byte 4 1047828139
+byte 4 3208081647
+byte 4 1060013330
+byte 4 1041705462
+byte 4 3207605577
+byte 4 1058437396
+byte 4 1054458931
+byte 4 3204448256
+byte 4 1062149053
+byte 4 1050556282
+byte 4 3195311787
+byte 4 1063074669
+byte 4 1055047408
+byte 4 3201942579
+byte 4 1060121929
+byte 4 1058437396
+byte 4 3208081647
+byte 4 1060013330
+byte 4 3189189110
+byte 4 3204448256
+byte 4 1062149053
+byte 4 3198039930
+byte 4 3204879951
+byte 4 1062847556
+byte 4 0
+byte 4 0
+byte 4 1062847556
+byte 4 3204879951
+byte 4 3195311787
+byte 4 1063074669
+byte 4 3202531056
+byte 4 0
+byte 4 1064605338
+byte 4 3197577718
+byte 4 3196491359
+byte 4 1064532072
+byte 4 3190184938
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1064605338
+byte 4 1050094070
+byte 4 3196491359
+byte 4 1064532072
+byte 4 1042701290
+byte 4 1047828139
+byte 4 1063074669
+byte 4 1055047408
+byte 4 1049007711
+byte 4 1064532072
+byte 4 1042701290
+byte 4 1056964608
+byte 4 1062149053
+byte 4 1050556282
+byte 4 1047828139
+byte 4 1063074669
+byte 4 3202531056
+byte 4 1049007711
+byte 4 1064532072
+byte 4 3190184938
+byte 4 1056964608
+byte 4 1062149053
+byte 4 3198039930
+byte 4 1062847556
+byte 4 1057396303
+byte 4 0
+byte 4 1060597999
+byte 4 1060013330
+byte 4 1041705462
+byte 4 1060597999
+byte 4 1060013330
+byte 4 3189189110
+byte 4 1057396303
+byte 4 1062847556
+byte 4 0
+byte 4 1054458931
+byte 4 1060121929
+byte 4 1058437396
+byte 4 1063074669
+byte 4 1055047408
+byte 4 1047828139
+byte 4 1060121929
+byte 4 1058437396
+byte 4 1054458931
+byte 4 1062149053
+byte 4 1050556282
+byte 4 1056964608
+byte 4 1060013330
+byte 4 1041705462
+byte 4 1060597999
+byte 4 1058437396
+byte 4 1054458931
+byte 4 1060121929
+byte 4 1064605338
+byte 4 1050094070
+byte 4 0
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1064532072
+byte 4 1042701290
+byte 4 1049007711
+byte 4 1062847556
+byte 4 3204879951
+byte 4 0
+byte 4 1064605338
+byte 4 3197577718
+byte 4 0
+byte 4 1063074669
+byte 4 3202531056
+byte 4 1047828139
+byte 4 1064532072
+byte 4 3190184938
+byte 4 1049007711
+byte 4 1062149053
+byte 4 3198039930
+byte 4 1056964608
+byte 4 1060013330
+byte 4 3189189110
+byte 4 1060597999
+byte 4 1062847556
+byte 4 0
+byte 4 1057396303
+byte 4 1063074669
+byte 4 1055047408
+byte 4 3195311787
+byte 4 1062149053
+byte 4 1050556282
+byte 4 3204448256
+byte 4 1064532072
+byte 4 1042701290
+byte 4 3196491359
+byte 4 1057396303
+byte 4 0
+byte 4 3210331204
+byte 4 1060013330
+byte 4 1041705462
+byte 4 3208081647
+byte 4 1060013330
+byte 4 3189189110
+byte 4 3208081647
+byte 4 1062847556
+byte 4 0
+byte 4 3204879951
+byte 4 1062149053
+byte 4 3198039930
+byte 4 3204448256
+byte 4 1063074669
+byte 4 3202531056
+byte 4 3195311787
+byte 4 1064532072
+byte 4 3190184938
+byte 4 3196491359
+byte 4 1041705462
+byte 4 1060597999
+byte 4 3207496978
+byte 4 1050556282
+byte 4 1056964608
+byte 4 3209632701
+byte 4 1054458931
+byte 4 1060121929
+byte 4 3205921044
+byte 4 1055047408
+byte 4 1047828139
+byte 4 3210558317
+byte 4 1058437396
+byte 4 1054458931
+byte 4 3207605577
+byte 4 1060121929
+byte 4 1058437396
+byte 4 3201942579
+byte 4 3189189110
+byte 4 1060597999
+byte 4 3207496978
+byte 4 3198039930
+byte 4 1056964608
+byte 4 3209632701
+byte 4 0
+byte 4 1057396303
+byte 4 3210331204
+byte 4 3204879951
+byte 4 0
+byte 4 3210331204
+byte 4 3202531056
+byte 4 1047828139
+byte 4 3210558317
+byte 4 3197577718
+byte 4 0
+byte 4 3212088986
+byte 4 3190184938
+byte 4 1049007711
+byte 4 3212015720
+byte 4 0
+byte 4 0
+byte 4 3212836864
+byte 4 1050094070
+byte 4 0
+byte 4 3212088986
+byte 4 1042701290
+byte 4 1049007711
+byte 4 3212015720
+byte 4 3202531056
+byte 4 3195311787
+byte 4 3210558317
+byte 4 3198039930
+byte 4 3204448256
+byte 4 3209632701
+byte 4 3190184938
+byte 4 3196491359
+byte 4 3212015720
+byte 4 0
+byte 4 3210331204
+byte 4 3204879951
+byte 4 3189189110
+byte 4 3208081647
+byte 4 3207496978
+byte 4 1041705462
+byte 4 3208081647
+byte 4 3207496978
+byte 4 0
+byte 4 3204879951
+byte 4 3210331204
+byte 4 1050556282
+byte 4 3204448256
+byte 4 3209632701
+byte 4 1055047408
+byte 4 3195311787
+byte 4 3210558317
+byte 4 1042701290
+byte 4 3196491359
+byte 4 3212015720
+byte 4 1047828139
+byte 4 3210558317
+byte 4 3202531056
+byte 4 1056964608
+byte 4 3209632701
+byte 4 3198039930
+byte 4 1054458931
+byte 4 3207605577
+byte 4 3205921044
+byte 4 1060597999
+byte 4 3207496978
+byte 4 3189189110
+byte 4 1060121929
+byte 4 3205921044
+byte 4 3201942579
+byte 4 1058437396
+byte 4 3201942579
+byte 4 3207605577
+byte 4 0
+byte 4 3212088986
+byte 4 3197577718
+byte 4 0
+byte 4 3212836864
+byte 4 0
+byte 4 1049007711
+byte 4 3212015720
+byte 4 3190184938
+byte 4 0
+byte 4 3210331204
+byte 4 1057396303
+byte 4 0
+byte 4 3212088986
+byte 4 1050094070
+byte 4 1047828139
+byte 4 3210558317
+byte 4 1055047408
+byte 4 1049007711
+byte 4 3212015720
+byte 4 1042701290
+byte 4 1056964608
+byte 4 3209632701
+byte 4 1050556282
+byte 4 1060597999
+byte 4 3207496978
+byte 4 1041705462
+byte 4 1057396303
+byte 4 3210331204
+byte 4 0
+byte 4 3195311787
+byte 4 3210558317
+byte 4 3202531056
+byte 4 3204448256
+byte 4 3209632701
+byte 4 3198039930
+byte 4 3196491359
+byte 4 3212015720
+byte 4 3190184938
+byte 4 3210331204
+byte 4 3204879951
+byte 4 0
+byte 4 3208081647
+byte 4 3207496978
+byte 4 3189189110
+byte 4 3208081647
+byte 4 3207496978
+byte 4 1041705462
+byte 4 3204879951
+byte 4 3210331204
+byte 4 0
+byte 4 3204448256
+byte 4 3209632701
+byte 4 1050556282
+byte 4 3195311787
+byte 4 3210558317
+byte 4 1055047408
+byte 4 3196491359
+byte 4 3212015720
+byte 4 1042701290
+byte 4 3210558317
+byte 4 3202531056
+byte 4 1047828139
+byte 4 3209632701
+byte 4 3198039930
+byte 4 1056964608
+byte 4 3207605577
+byte 4 3205921044
+byte 4 1054458931
+byte 4 3207496978
+byte 4 3189189110
+byte 4 1060597999
+byte 4 3202531056
+byte 4 3195311787
+byte 4 1063074669
+byte 4 3205921044
+byte 4 3201942579
+byte 4 1060121929
+byte 4 3198039930
+byte 4 3204448256
+byte 4 1062149053
+byte 4 3189189110
+byte 4 3208081647
+byte 4 1060013330
+byte 4 3201942579
+byte 4 3207605577
+byte 4 1058437396
+byte 4 3190184938
+byte 4 3196491359
+byte 4 1064532072
+byte 4 1055047408
+byte 4 3195311787
+byte 4 1063074669
+byte 4 1042701290
+byte 4 3196491359
+byte 4 1064532072
+byte 4 1050556282
+byte 4 3204448256
+byte 4 1062149053
+byte 4 1041705462
+byte 4 3208081647
+byte 4 1060013330
+byte 4 0
+byte 4 3204879951
+byte 4 1062847556
+byte 4 1054458931
+byte 4 3207605577
+byte 4 1058437396
+byte 4 1058437396
+byte 4 3201942579
+byte 4 1060121929
+byte 4 1060121929
+byte 4 3205921044
+byte 4 1054458931
+byte 4 3212088986
+byte 4 1050094070
+byte 4 0
+byte 4 3212015720
+byte 4 1042701290
+byte 4 1049007711
+byte 4 3212836864
+byte 4 0
+byte 4 0
+byte 4 3210331204
+byte 4 0
+byte 4 1057396303
+byte 4 3212088986
+byte 4 3197577718
+byte 4 0
+byte 4 3212015720
+byte 4 3190184938
+byte 4 1049007711
+byte 4 3210558317
+byte 4 1055047408
+byte 4 3195311787
+byte 4 3212015720
+byte 4 1042701290
+byte 4 3196491359
+byte 4 3209632701
+byte 4 1050556282
+byte 4 3204448256
+byte 4 3210558317
+byte 4 3202531056
+byte 4 3195311787
+byte 4 3212015720
+byte 4 3190184938
+byte 4 3196491359
+byte 4 3209632701
+byte 4 3198039930
+byte 4 3204448256
+byte 4 3207496978
+byte 4 1041705462
+byte 4 3208081647
+byte 4 3207496978
+byte 4 3189189110
+byte 4 3208081647
+byte 4 3210331204
+byte 4 0
+byte 4 3204879951
+byte 4 3207605577
+byte 4 1058437396
+byte 4 3201942579
+byte 4 3205921044
+byte 4 1054458931
+byte 4 3207605577
+byte 4 3201942579
+byte 4 1060121929
+byte 4 3205921044
+byte 4 3201942579
+byte 4 3207605577
+byte 4 3205921044
+byte 4 3205921044
+byte 4 3201942579
+byte 4 3207605577
+byte 4 3207605577
+byte 4 3205921044
+byte 4 3201942579
+export Q_rand
+code
+proc Q_rand 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 69069
+ADDRFP4 0
+INDIRP4
+INDIRI4
+MULI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+RETI4
+LABELV $43
+endproc Q_rand 4 0
+export Q_random
+proc Q_random 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Q_rand
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 65535
+BANDI4
+CVIF4 4
+CNSTF4 1199570944
+DIVF4
+RETF4
+LABELV $44
+endproc Q_random 4 4
+export Q_crandom
+proc Q_crandom 4 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ADDRGP4 Q_random
+CALLF4
+ASGNF4
+CNSTF4 1073741824
+ADDRLP4 0
+INDIRF4
+CNSTF4 1056964608
+SUBF4
+MULF4
+RETF4
+LABELV $45
+endproc Q_crandom 4 4
+export ClampChar
+proc ClampChar 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -128
+GEI4 $47
+CNSTI4 -128
+RETI4
+ADDRGP4 $46
+JUMPV
+LABELV $47
+ADDRFP4 0
+INDIRI4
+CNSTI4 127
+LEI4 $49
+CNSTI4 127
+RETI4
+ADDRGP4 $46
+JUMPV
+LABELV $49
+ADDRFP4 0
+INDIRI4
+CVII1 4
+CVII4 1
+RETI4
+LABELV $46
+endproc ClampChar 0 0
+export ClampShort
+proc ClampShort 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 -32768
+GEI4 $52
+CNSTI4 -32768
+RETI4
+ADDRGP4 $51
+JUMPV
+LABELV $52
+ADDRFP4 0
+INDIRI4
+CNSTI4 32767
+LEI4 $54
+CNSTI4 32767
+RETI4
+ADDRGP4 $51
+JUMPV
+LABELV $54
+ADDRFP4 0
+INDIRI4
+CVII2 4
+CVII4 2
+RETI4
+LABELV $51
+endproc ClampShort 0 0
+export DirToByte
+proc DirToByte 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $57
+CNSTI4 0
+RETI4
+ADDRGP4 $56
+JUMPV
+LABELV $57
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+ASGNI4
+LABELV $59
+ADDRLP4 24
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 bytedirs
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 bytedirs+4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 bytedirs+8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $65
+ADDRLP4 8
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $65
+LABELV $60
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 162
+LTI4 $59
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $56
+endproc DirToByte 28 0
+export ByteToDir
+proc ByteToDir 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $70
+ADDRFP4 0
+INDIRI4
+CNSTI4 162
+LTI4 $68
+LABELV $70
+ADDRFP4 4
+INDIRP4
+ADDRGP4 vec3_origin
+INDIRB
+ASGNB 12
+ADDRGP4 $67
+JUMPV
+LABELV $68
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 bytedirs
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $67
+endproc ByteToDir 4 0
+export ColorBytes3
+proc ColorBytes3 40 0
+ADDRLP4 12
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LTF4 $73
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $74
+JUMPV
+LABELV $73
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $74
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+CNSTF4 1132396544
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LTF4 $77
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $78
+JUMPV
+LABELV $77
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $78
+ADDRLP4 0+1
+ADDRLP4 8
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $81
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $82
+JUMPV
+LABELV $81
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $82
+ADDRLP4 0+2
+ADDRLP4 28
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU4
+RETU4
+LABELV $71
+endproc ColorBytes3 40 0
+export ColorBytes4
+proc ColorBytes4 52 0
+ADDRLP4 12
+CNSTF4 1132396544
+ADDRFP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 16
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+LTF4 $85
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 16
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $86
+JUMPV
+LABELV $85
+ADDRLP4 4
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $86
+ADDRLP4 0
+ADDRLP4 4
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+CNSTF4 1132396544
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 24
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+LTF4 $89
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+ADDRLP4 24
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $90
+JUMPV
+LABELV $89
+ADDRLP4 8
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $90
+ADDRLP4 0+1
+ADDRLP4 8
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 32
+CNSTF4 1132396544
+ADDRFP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+LTF4 $93
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+ADDRLP4 36
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $94
+JUMPV
+LABELV $93
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $94
+ADDRLP4 0+2
+ADDRLP4 28
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 44
+CNSTF4 1132396544
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 1325400064
+ASGNF4
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+LTF4 $97
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+ADDRLP4 48
+INDIRF4
+SUBF4
+CVFI4 4
+CVIU4 4
+CNSTU4 2147483648
+ADDU4
+ASGNU4
+ADDRGP4 $98
+JUMPV
+LABELV $97
+ADDRLP4 40
+ADDRLP4 44
+INDIRF4
+CVFI4 4
+CVIU4 4
+ASGNU4
+LABELV $98
+ADDRLP4 0+3
+ADDRLP4 40
+INDIRU4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU4
+RETU4
+LABELV $83
+endproc ColorBytes4 52 0
+export NormalizeColor
+proc NormalizeColor 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LEF4 $100
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $100
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LEF4 $102
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $102
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+NEF4 $104
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRGP4 $105
+JUMPV
+LABELV $104
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+LABELV $105
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $99
+endproc NormalizeColor 16 0
+export PlaneFromPoints
+proc PlaneFromPoints 76 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 12
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRLP4 12+4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 52
+CNSTI4 8
+ASGNI4
+ADDRLP4 12+8
+ADDRFP4 12
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 VectorNormalize
+CALLF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 0
+NEF4 $111
+CNSTI4 0
+RETI4
+ADDRGP4 $106
+JUMPV
+LABELV $111
+ADDRLP4 68
+CNSTI4 4
+ASGNI4
+ADDRLP4 72
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 72
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+CNSTI4 1
+RETI4
+LABELV $106
+endproc PlaneFromPoints 76 12
+export RotatePointAroundVector
+proc RotatePointAroundVector 260 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 148
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 148+8
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 160
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRLP4 160
+ARGP4
+ADDRLP4 148
+ARGP4
+ADDRLP4 176
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+ADDRLP4 40
+ADDRLP4 160
+INDIRF4
+ASGNF4
+ADDRLP4 40+12
+ADDRLP4 160+4
+INDIRF4
+ASGNF4
+ADDRLP4 40+24
+ADDRLP4 160+8
+INDIRF4
+ASGNF4
+ADDRLP4 40+4
+ADDRLP4 176
+INDIRF4
+ASGNF4
+ADDRLP4 40+12+4
+ADDRLP4 176+4
+INDIRF4
+ASGNF4
+ADDRLP4 40+24+4
+ADDRLP4 176+8
+INDIRF4
+ASGNF4
+ADDRLP4 40+8
+ADDRLP4 148
+INDIRF4
+ASGNF4
+ADDRLP4 40+12+8
+ADDRLP4 148+4
+INDIRF4
+ASGNF4
+ADDRLP4 40+24+8
+ADDRLP4 148+8
+INDIRF4
+ASGNF4
+ADDRLP4 112
+ARGP4
+ADDRLP4 40
+ARGP4
+CNSTI4 36
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 112+4
+ADDRLP4 40+12
+INDIRF4
+ASGNF4
+ADDRLP4 112+8
+ADDRLP4 40+24
+INDIRF4
+ASGNF4
+ADDRLP4 112+12
+ADDRLP4 40+4
+INDIRF4
+ASGNF4
+ADDRLP4 112+12+8
+ADDRLP4 40+24+4
+INDIRF4
+ASGNF4
+ADDRLP4 112+24
+ADDRLP4 40+8
+INDIRF4
+ASGNF4
+ADDRLP4 112+24+4
+ADDRLP4 40+12+8
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 36
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 228
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 76+24+8
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 76+12+4
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 228
+INDIRF4
+ASGNF4
+ADDRLP4 172
+CNSTF4 1078530011
+ADDRFP4 12
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 232
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 76
+ADDRLP4 232
+INDIRF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 236
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 76+4
+ADDRLP4 236
+INDIRF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 240
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 76+12
+ADDRLP4 240
+INDIRF4
+NEGF4
+ASGNF4
+ADDRLP4 172
+INDIRF4
+ARGF4
+ADDRLP4 244
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 76+12+4
+ADDRLP4 244
+INDIRF4
+ASGNF4
+ADDRLP4 40
+ARGP4
+ADDRLP4 76
+ARGP4
+ADDRLP4 188
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 188
+ARGP4
+ADDRLP4 112
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $158
+ADDRLP4 252
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ADDRLP4 252
+INDIRI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 252
+INDIRI4
+ADDRLP4 4+4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 252
+INDIRI4
+ADDRLP4 4+8
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $159
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $158
+LABELV $113
+endproc RotatePointAroundVector 260 12
+export RotateAroundDirection
+proc RotateAroundDirection 24 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 PerpendicularVector
+CALLV
+pop
+ADDRFP4 4
+INDIRF4
+CNSTF4 0
+EQF4 $165
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 4
+INDIRF4
+ARGF4
+ADDRGP4 RotatePointAroundVector
+CALLV
+pop
+LABELV $165
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+LABELV $164
+endproc RotateAroundDirection 24 16
+export vectoangles
+proc vectoangles 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+NEF4 $168
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+NEF4 $168
+ADDRLP4 20
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 20
+INDIRF4
+LEF4 $170
+ADDRLP4 4
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $169
+JUMPV
+LABELV $170
+ADDRLP4 4
+CNSTF4 1132920832
+ASGNF4
+ADDRGP4 $169
+JUMPV
+LABELV $168
+ADDRFP4 0
+INDIRP4
+INDIRF4
+CNSTF4 0
+EQF4 $172
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1127481344
+ADDRLP4 24
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRGP4 $173
+JUMPV
+LABELV $172
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+CNSTF4 0
+LEF4 $174
+ADDRLP4 0
+CNSTF4 1119092736
+ASGNF4
+ADDRGP4 $175
+JUMPV
+LABELV $174
+ADDRLP4 0
+CNSTF4 1132920832
+ASGNF4
+LABELV $175
+LABELV $173
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $176
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $176
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 28
+INDIRF4
+MULF4
+ADDF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 4
+CNSTF4 1127481344
+ADDRLP4 36
+INDIRF4
+MULF4
+CNSTF4 1078530011
+DIVF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 0
+GEF4 $178
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $178
+LABELV $169
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $167
+endproc vectoangles 40 8
+export AnglesToAxis
+proc AnglesToAxis 16 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 vec3_origin
+INDIRF4
+ADDRLP4 0
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ADDRGP4 vec3_origin+4
+INDIRF4
+ADDRLP4 0+4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRGP4 vec3_origin+8
+INDIRF4
+ADDRLP4 0+8
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $180
+endproc AnglesToAxis 16 16
+export AxisClear
+proc AxisClear 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $185
+endproc AxisClear 0 0
+export AxisCopy
+proc AxisCopy 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 4
+CNSTI4 24
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+LABELV $186
+endproc AxisCopy 8 0
+export ProjectPointOnPlane
+proc ProjectPointOnPlane 68 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 36
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 40
+CNSTI4 8
+ASGNI4
+ADDRLP4 44
+ADDRFP4 8
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ADDRLP4 24
+INDIRF4
+MULF4
+ADDRLP4 36
+INDIRF4
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 48
+INDIRF4
+ADDRLP4 48
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 40
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4+8
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4+4
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+ADDRLP4 64
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 4+8
+INDIRF4
+MULF4
+SUBF4
+ASGNF4
+LABELV $187
+endproc ProjectPointOnPlane 68 0
+export MakeNormalVectors
+proc MakeNormalVectors 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+NEGF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 4
+ASGNI4
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRLP4 32
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 CrossProduct
+CALLV
+pop
+LABELV $192
+endproc MakeNormalVectors 36 12
+export VectorRotate
+proc VectorRotate 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $193
+endproc VectorRotate 40 0
+export Q_rsqrt
+proc Q_rsqrt 24 0
+ADDRLP4 12
+CNSTF4 1069547520
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 8
+CNSTF4 1056964608
+ADDRLP4 16
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 1597463007
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+RSHI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 12
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $194
+endproc Q_rsqrt 24 0
+export Q_fabs
+proc Q_fabs 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 2147483647
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $195
+endproc Q_fabs 4 0
+export LerpAngle
+proc LerpAngle 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+CNSTF4 1127481344
+LEF4 $197
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $197
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+CNSTF4 3274964992
+GEF4 $199
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $199
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 0
+INDIRF4
+SUBF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $196
+endproc LerpAngle 8 0
+export AngleSubtract
+proc AngleSubtract 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ADDRFP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $203
+JUMPV
+LABELV $202
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $203
+ADDRLP4 0
+INDIRF4
+CNSTF4 1127481344
+GTF4 $202
+ADDRGP4 $206
+JUMPV
+LABELV $205
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+CNSTF4 1135869952
+ADDF4
+ASGNF4
+LABELV $206
+ADDRLP4 0
+INDIRF4
+CNSTF4 3274964992
+LTF4 $205
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $201
+endproc AngleSubtract 4 0
+export AnglesSubtract
+proc AnglesSubtract 20 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+LABELV $208
+endproc AnglesSubtract 20 8
+export AngleMod
+proc AngleMod 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+CNSTF4 1001652224
+CNSTF4 1127615329
+ADDRFP4 0
+INDIRF4
+MULF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+CVIF4 4
+MULF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $209
+endproc AngleMod 0 0
+export AngleNormalize360
+proc AngleNormalize360 0 0
+CNSTF4 1001652224
+CNSTF4 1127615329
+ADDRFP4 0
+INDIRF4
+MULF4
+CVFI4 4
+CNSTI4 65535
+BANDI4
+CVIF4 4
+MULF4
+RETF4
+LABELV $210
+endproc AngleNormalize360 0 0
+export AngleNormalize180
+proc AngleNormalize180 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 AngleNormalize360
+CALLF4
+ASGNF4
+ADDRFP4 0
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRF4
+CNSTF4 1127481344
+LEF4 $212
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+CNSTF4 1135869952
+SUBF4
+ASGNF4
+LABELV $212
+ADDRFP4 0
+INDIRF4
+RETF4
+LABELV $211
+endproc AngleNormalize180 4 4
+export AngleDelta
+proc AngleDelta 4 4
+ADDRFP4 0
+INDIRF4
+ADDRFP4 4
+INDIRF4
+SUBF4
+ARGF4
+ADDRLP4 0
+ADDRGP4 AngleNormalize180
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $214
+endproc AngleDelta 4 4
+export SetPlaneSignbits
+proc SetPlaneSignbits 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $216
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $220
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDRLP4 0
+INDIRI4
+LSHI4
+BORI4
+ASGNI4
+LABELV $220
+LABELV $217
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $216
+ADDRFP4 0
+INDIRP4
+CNSTI4 17
+ADDP4
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+LABELV $215
+endproc SetPlaneSignbits 12 0
+export BoxOnPlaneSide
+proc BoxOnPlaneSide 248 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 3
+GEI4 $223
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+GTF4 $225
+CNSTI4 1
+RETI4
+ADDRGP4 $222
+JUMPV
+LABELV $225
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRU1
+CVUI4 1
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+LTF4 $227
+CNSTI4 2
+RETI4
+ADDRGP4 $222
+JUMPV
+LABELV $227
+CNSTI4 3
+RETI4
+ADDRGP4 $222
+JUMPV
+LABELV $223
+ADDRLP4 12
+ADDRFP4 8
+INDIRP4
+CNSTI4 17
+ADDP4
+INDIRU1
+CVUI4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $229
+ADDRLP4 12
+INDIRI4
+CNSTI4 7
+GTI4 $229
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $240
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $240
+address $232
+address $233
+address $234
+address $235
+address $236
+address $237
+address $238
+address $239
+code
+LABELV $232
+ADDRLP4 24
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 8
+ASGNI4
+ADDRLP4 40
+ADDRFP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 44
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 40
+INDIRP4
+INDIRF4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $230
+JUMPV
+LABELV $233
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 56
+CNSTI4 4
+ASGNI4
+ADDRLP4 60
+ADDRFP4 8
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 64
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 68
+CNSTI4 8
+ASGNI4
+ADDRLP4 72
+ADDRFP4 8
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 52
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 64
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 72
+INDIRP4
+INDIRF4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $230
+JUMPV
+LABELV $234
+ADDRLP4 80
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 84
+CNSTI4 4
+ASGNI4
+ADDRLP4 88
+ADDRFP4 8
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 96
+CNSTI4 8
+ASGNI4
+ADDRLP4 100
+ADDRFP4 8
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 80
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 88
+INDIRP4
+INDIRF4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 100
+INDIRP4
+INDIRF4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 92
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 88
+INDIRP4
+INDIRF4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 84
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 100
+INDIRP4
+INDIRF4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $230
+JUMPV
+LABELV $235
+ADDRLP4 108
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 112
+CNSTI4 4
+ASGNI4
+ADDRLP4 116
+ADDRFP4 8
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 120
+CNSTI4 8
+ASGNI4
+ADDRLP4 124
+ADDRFP4 8
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 128
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 108
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 128
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 116
+INDIRP4
+INDIRF4
+ADDRLP4 128
+INDIRP4
+ADDRLP4 112
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 124
+INDIRP4
+INDIRF4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 120
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $230
+JUMPV
+LABELV $236
+ADDRLP4 136
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 140
+CNSTI4 4
+ASGNI4
+ADDRLP4 144
+ADDRFP4 8
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 148
+CNSTI4 8
+ASGNI4
+ADDRLP4 152
+ADDRFP4 8
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 156
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 136
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 144
+INDIRP4
+INDIRF4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 152
+INDIRP4
+INDIRF4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 156
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 144
+INDIRP4
+INDIRF4
+ADDRLP4 156
+INDIRP4
+ADDRLP4 140
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 152
+INDIRP4
+INDIRF4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 148
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $230
+JUMPV
+LABELV $237
+ADDRLP4 164
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 168
+CNSTI4 4
+ASGNI4
+ADDRLP4 172
+ADDRFP4 8
+INDIRP4
+ADDRLP4 168
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 176
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 180
+CNSTI4 8
+ASGNI4
+ADDRLP4 184
+ADDRFP4 8
+INDIRP4
+ADDRLP4 180
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 164
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 172
+INDIRP4
+INDIRF4
+ADDRLP4 176
+INDIRP4
+ADDRLP4 168
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 184
+INDIRP4
+INDIRF4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 180
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 176
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 172
+INDIRP4
+INDIRF4
+ADDRLP4 164
+INDIRP4
+ADDRLP4 168
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 184
+INDIRP4
+INDIRF4
+ADDRLP4 176
+INDIRP4
+ADDRLP4 180
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $230
+JUMPV
+LABELV $238
+ADDRLP4 192
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 196
+CNSTI4 4
+ASGNI4
+ADDRLP4 200
+ADDRFP4 8
+INDIRP4
+ADDRLP4 196
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 204
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 208
+CNSTI4 8
+ASGNI4
+ADDRLP4 212
+ADDRFP4 8
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 192
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 200
+INDIRP4
+INDIRF4
+ADDRLP4 204
+INDIRP4
+ADDRLP4 196
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 212
+INDIRP4
+INDIRF4
+ADDRLP4 204
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 204
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 200
+INDIRP4
+INDIRF4
+ADDRLP4 192
+INDIRP4
+ADDRLP4 196
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 212
+INDIRP4
+INDIRF4
+ADDRLP4 192
+INDIRP4
+ADDRLP4 208
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $230
+JUMPV
+LABELV $239
+ADDRLP4 220
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 224
+CNSTI4 4
+ASGNI4
+ADDRLP4 228
+ADDRFP4 8
+INDIRP4
+ADDRLP4 224
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 232
+CNSTI4 8
+ASGNI4
+ADDRLP4 236
+ADDRFP4 8
+INDIRP4
+ADDRLP4 232
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 220
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 228
+INDIRP4
+INDIRF4
+ADDRLP4 220
+INDIRP4
+ADDRLP4 224
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 236
+INDIRP4
+INDIRF4
+ADDRLP4 220
+INDIRP4
+ADDRLP4 232
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 240
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ADDRLP4 240
+INDIRP4
+INDIRF4
+MULF4
+ADDRLP4 228
+INDIRP4
+INDIRF4
+ADDRLP4 240
+INDIRP4
+ADDRLP4 224
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 236
+INDIRP4
+INDIRF4
+ADDRLP4 240
+INDIRP4
+ADDRLP4 232
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $230
+JUMPV
+LABELV $229
+ADDRLP4 244
+CNSTF4 0
+ASGNF4
+ADDRLP4 8
+ADDRLP4 244
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 244
+INDIRF4
+ASGNF4
+LABELV $230
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+LTF4 $241
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $241
+ADDRLP4 8
+INDIRF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+GEF4 $243
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+LABELV $243
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $222
+endproc BoxOnPlaneSide 248 0
+export RadiusFromBounds
+proc RadiusFromBounds 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $246
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+LEF4 $251
+ADDRLP4 32
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRLP4 32
+ADDRLP4 8
+INDIRF4
+ASGNF4
+LABELV $252
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+LABELV $247
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $246
+ADDRLP4 12
+ARGP4
+ADDRLP4 24
+ADDRGP4 VectorLength
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+RETF4
+LABELV $245
+endproc RadiusFromBounds 36 4
+export ClearBounds
+proc ClearBounds 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 1203982208
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+CNSTF4 3351465856
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $253
+endproc ClearBounds 16 0
+export AddPointToBounds
+proc AddPointToBounds 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+GEF4 $255
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $255
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+LEF4 $257
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+LABELV $257
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+GEF4 $259
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $259
+ADDRLP4 4
+CNSTI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+LEF4 $261
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $261
+ADDRLP4 8
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+GEF4 $263
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $263
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+LEF4 $265
+ADDRLP4 16
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $265
+LABELV $254
+endproc AddPointToBounds 20 0
+export BoundsIntersect
+proc BoundsIntersect 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+LTF4 $274
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $274
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $274
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+INDIRF4
+GTF4 $274
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $274
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+LEF4 $268
+LABELV $274
+CNSTI4 0
+RETI4
+ADDRGP4 $267
+JUMPV
+LABELV $268
+CNSTI4 1
+RETI4
+LABELV $267
+endproc BoundsIntersect 24 0
+export BoundsIntersectSphere
+proc BoundsIntersectSphere 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+GTF4 $282
+ADDRLP4 4
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+LTF4 $282
+ADDRLP4 20
+CNSTI4 4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $282
+ADDRLP4 24
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $282
+ADDRLP4 28
+CNSTI4 8
+ASGNI4
+ADDRLP4 32
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 32
+INDIRF4
+ADDRFP4 12
+INDIRF4
+SUBF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $282
+ADDRLP4 32
+INDIRF4
+ADDRFP4 12
+INDIRF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+GEF4 $276
+LABELV $282
+CNSTI4 0
+RETI4
+ADDRGP4 $275
+JUMPV
+LABELV $276
+CNSTI4 1
+RETI4
+LABELV $275
+endproc BoundsIntersectSphere 36 0
+export BoundsIntersectPoint
+proc BoundsIntersectPoint 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+GTF4 $290
+ADDRLP4 4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+LTF4 $290
+ADDRLP4 16
+CNSTI4 4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $290
+ADDRLP4 20
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+INDIRF4
+LTF4 $290
+ADDRLP4 24
+CNSTI4 8
+ASGNI4
+ADDRLP4 28
+ADDRFP4 8
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+GTF4 $290
+ADDRLP4 28
+INDIRF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRF4
+GEF4 $284
+LABELV $290
+CNSTI4 0
+RETI4
+ADDRGP4 $283
+JUMPV
+LABELV $284
+CNSTI4 1
+RETI4
+LABELV $283
+endproc BoundsIntersectPoint 32 0
+export VectorNormalize
+proc VectorNormalize 40 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $292
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $292
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $291
+endproc VectorNormalize 40 4
+export VectorNormalize2
+proc VectorNormalize2 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDRLP4 16
+INDIRF4
+ADDRLP4 16
+INDIRF4
+MULF4
+ADDF4
+ADDRLP4 20
+INDIRF4
+ADDRLP4 20
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+EQF4 $295
+ADDRLP4 4
+CNSTF4 1065353216
+ADDRLP4 0
+INDIRF4
+DIVF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 28
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $296
+JUMPV
+LABELV $295
+ADDRLP4 32
+CNSTF4 0
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRF4
+ASGNF4
+LABELV $296
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $294
+endproc VectorNormalize2 36 4
+export _VectorMA
+proc _VectorMA 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $297
+endproc _VectorMA 8 0
+export _DotProduct
+proc _DotProduct 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 12
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+RETF4
+LABELV $298
+endproc _DotProduct 16 0
+export _VectorSubtract
+proc _VectorSubtract 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+LABELV $299
+endproc _VectorSubtract 8 0
+export _VectorAdd
+proc _VectorAdd 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $300
+endproc _VectorAdd 8 0
+export _VectorCopy
+proc _VectorCopy 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $301
+endproc _VectorCopy 8 0
+export _VectorScale
+proc _VectorScale 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $302
+endproc _VectorScale 8 0
+export Vector4Scale
+proc Vector4Scale 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 4
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 12
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+MULF4
+ASGNF4
+LABELV $303
+endproc Vector4Scale 12 0
+export Q_log2
+proc Q_log2 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $306
+JUMPV
+LABELV $305
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $306
+ADDRLP4 4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+RSHI4
+ASGNI4
+ADDRFP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $305
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $304
+endproc Q_log2 8 0
+export MatrixMultiply
+proc MatrixMultiply 104 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 8
+CNSTI4 4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 20
+CNSTI4 8
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+CNSTI4 12
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 44
+CNSTI4 16
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 56
+CNSTI4 20
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+CNSTI4 24
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 68
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 80
+CNSTI4 28
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 80
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 92
+CNSTI4 32
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $308
+endproc MatrixMultiply 104 0
+bss
+align 4
+LABELV $310
+skip 4
+align 4
+LABELV $311
+skip 4
+align 4
+LABELV $312
+skip 4
+align 4
+LABELV $313
+skip 4
+align 4
+LABELV $314
+skip 4
+align 4
+LABELV $315
+skip 4
+export AngleVectors
+code
+proc AngleVectors 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTF4 1016003125
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 $312
+ADDRLP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 $315
+ADDRLP4 8
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1016003125
+ADDRFP4 0
+INDIRP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 $311
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 $314
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 0
+CNSTF4 1016003125
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 $310
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRGP4 $313
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $316
+ADDRFP4 4
+INDIRP4
+ADDRGP4 $314
+INDIRF4
+ADDRGP4 $315
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $314
+INDIRF4
+ADDRGP4 $312
+INDIRF4
+MULF4
+ASGNF4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $311
+INDIRF4
+NEGF4
+ASGNF4
+LABELV $316
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $318
+ADDRLP4 28
+CNSTF4 3212836864
+ASGNF4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 28
+INDIRF4
+ADDRGP4 $310
+INDIRF4
+MULF4
+ADDRGP4 $311
+INDIRF4
+MULF4
+ADDRGP4 $315
+INDIRF4
+MULF4
+ADDRLP4 28
+INDIRF4
+ADDRGP4 $313
+INDIRF4
+MULF4
+ADDRGP4 $312
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 32
+CNSTF4 3212836864
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 $310
+INDIRF4
+MULF4
+ADDRGP4 $311
+INDIRF4
+MULF4
+ADDRGP4 $312
+INDIRF4
+MULF4
+ADDRLP4 32
+INDIRF4
+ADDRGP4 $313
+INDIRF4
+MULF4
+ADDRGP4 $315
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 8
+INDIRP4
+CNSTI4 8
+ADDP4
+CNSTF4 3212836864
+ADDRGP4 $310
+INDIRF4
+MULF4
+ADDRGP4 $314
+INDIRF4
+MULF4
+ASGNF4
+LABELV $318
+ADDRFP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $320
+ADDRFP4 12
+INDIRP4
+ADDRGP4 $313
+INDIRF4
+ADDRGP4 $311
+INDIRF4
+MULF4
+ADDRGP4 $315
+INDIRF4
+MULF4
+ADDRGP4 $310
+INDIRF4
+NEGF4
+ADDRGP4 $312
+INDIRF4
+NEGF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 $313
+INDIRF4
+ADDRGP4 $311
+INDIRF4
+MULF4
+ADDRGP4 $312
+INDIRF4
+MULF4
+ADDRGP4 $310
+INDIRF4
+NEGF4
+ADDRGP4 $315
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRFP4 12
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRGP4 $313
+INDIRF4
+ADDRGP4 $314
+INDIRF4
+MULF4
+ASGNF4
+LABELV $320
+LABELV $309
+endproc AngleVectors 36 4
+export PerpendicularVector
+proc PerpendicularVector 40 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $326
+JUMPV
+LABELV $323
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 28
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ADDRLP4 4
+INDIRF4
+GEF4 $327
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 36
+INDIRF4
+ASGNF4
+LABELV $327
+LABELV $324
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $326
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $323
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 12
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 ProjectPointOnPlane
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 VectorNormalize
+CALLF4
+pop
+LABELV $322
+endproc PerpendicularVector 40 12
+export Q_isnan
+proc Q_isnan 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 0
+INDIRU4
+CNSTU4 2147483647
+BANDU4
+ASGNU4
+ADDRLP4 0
+CNSTU4 2139095040
+ADDRLP4 0
+INDIRU4
+SUBU4
+ASGNU4
+ADDRLP4 0
+INDIRU4
+CNSTI4 31
+RSHU4
+CVUI4 4
+RETI4
+LABELV $331
+endproc Q_isnan 4 0
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_acos
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
@@ -0,0 +1,5787 @@
+export Com_Clamp
+code
+proc Com_Clamp 0 0
+ADDRFP4 8
+ADDRFP4 8
+INDIRF4
+ASGNF4
+ADDRFP4 8
+INDIRF4
+ADDRFP4 0
+INDIRF4
+GEF4 $24
+ADDRFP4 0
+INDIRF4
+RETF4
+ADDRGP4 $23
+JUMPV
+LABELV $24
+ADDRFP4 8
+INDIRF4
+ADDRFP4 4
+INDIRF4
+LEF4 $26
+ADDRFP4 4
+INDIRF4
+RETF4
+ADDRGP4 $23
+JUMPV
+LABELV $26
+ADDRFP4 8
+INDIRF4
+RETF4
+LABELV $23
+endproc Com_Clamp 0 0
+export COM_SkipPath
+proc COM_SkipPath 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $30
+JUMPV
+LABELV $29
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $32
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $32
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $30
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $29
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $28
+endproc COM_SkipPath 4 0
+export COM_GetExtension
+proc COM_GetExtension 16 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $36
+JUMPV
+LABELV $35
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+EQI4 $40
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $38
+LABELV $40
+ADDRGP4 $41
+RETP4
+ADDRGP4 $34
+JUMPV
+LABELV $38
+LABELV $36
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 46
+NEI4 $35
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+RETP4
+LABELV $34
+endproc COM_GetExtension 16 4
+export COM_StripExtension
+proc COM_StripExtension 12 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $44
+JUMPV
+LABELV $43
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $46
+ADDRGP4 $42
+JUMPV
+LABELV $46
+LABELV $44
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $48
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 46
+NEI4 $43
+LABELV $48
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $49
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $49
+LABELV $42
+endproc COM_StripExtension 12 12
+export COM_DefaultExtension
+proc COM_DefaultExtension 76 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 68
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+ADDRGP4 $53
+JUMPV
+LABELV $52
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 46
+NEI4 $55
+ADDRGP4 $51
+JUMPV
+LABELV $55
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+LABELV $53
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+EQI4 $57
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+NEU4 $52
+LABELV $57
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $58
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $51
+endproc COM_DefaultExtension 76 20
+export ShortSwap
+proc ShortSwap 16 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRLP4 4
+ADDRFP4 0
+INDIRI2
+CVII4 2
+ASGNI4
+ADDRLP4 8
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRLP4 1
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDRLP4 1
+INDIRU1
+CVUI4 1
+ADDI4
+CVII2 4
+CVII4 2
+RETI4
+LABELV $59
+endproc ShortSwap 16 0
+export ShortNoSwap
+proc ShortNoSwap 0 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII2 4
+ASGNI2
+ADDRFP4 0
+INDIRI2
+CVII4 2
+RETI4
+LABELV $60
+endproc ShortNoSwap 0 0
+export LongSwap
+proc LongSwap 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTI4 255
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 12
+CNSTI4 8
+ASGNI4
+ADDRLP4 1
+ADDRFP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 16
+CNSTI4 16
+ASGNI4
+ADDRLP4 2
+ADDRFP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 20
+CNSTI4 24
+ASGNI4
+ADDRLP4 3
+ADDRFP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+RSHI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+CVIU4 4
+CVUU1 4
+ASGNU1
+ADDRLP4 0
+INDIRU1
+CVUI4 1
+ADDRLP4 20
+INDIRI4
+LSHI4
+ADDRLP4 1
+INDIRU1
+CVUI4 1
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDI4
+ADDRLP4 2
+INDIRU1
+CVUI4 1
+ADDRLP4 12
+INDIRI4
+LSHI4
+ADDI4
+ADDRLP4 3
+INDIRU1
+CVUI4 1
+ADDI4
+RETI4
+LABELV $61
+endproc LongSwap 24 0
+export LongNoSwap
+proc LongNoSwap 0 0
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $62
+endproc LongNoSwap 0 0
+export Long64Swap
+proc Long64Swap 12 0
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 7
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+1
+ADDRLP4 8
+INDIRP4
+CNSTI4 6
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+2
+ADDRFP4 4
+INDIRP4
+CNSTI4 5
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+3
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRP4
+CNSTI4 3
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+5
+ADDRFP4 4
+INDIRP4
+CNSTI4 2
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+6
+ADDRFP4 4
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRU1
+ASGNU1
+ADDRLP4 0+7
+ADDRFP4 4
+INDIRP4
+INDIRU1
+ASGNU1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRB
+ASGNB 8
+LABELV $63
+endproc Long64Swap 12 0
+export Long64NoSwap
+proc Long64NoSwap 0 0
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 8
+LABELV $72
+endproc Long64NoSwap 0 0
+export FloatSwap
+proc FloatSwap 8 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRU4
+CVUI4 4
+ARGI4
+ADDRLP4 4
+ADDRGP4 LongSwap
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 0
+INDIRF4
+RETF4
+LABELV $74
+endproc FloatSwap 8 4
+export FloatNoSwap
+proc FloatNoSwap 0 0
+ADDRFP4 0
+INDIRP4
+INDIRF4
+RETF4
+LABELV $75
+endproc FloatNoSwap 0 0
+export COM_BeginParseSession
+proc COM_BeginParseSession 0 16
+ADDRGP4 com_lines
+CNSTI4 0
+ASGNI4
+ADDRGP4 com_parsename
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $77
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $76
+endproc COM_BeginParseSession 0 16
+export COM_GetCurrentParseLine
+proc COM_GetCurrentParseLine 0 0
+ADDRGP4 com_lines
+INDIRI4
+RETI4
+LABELV $78
+endproc COM_GetCurrentParseLine 0 0
+export COM_Parse
+proc COM_Parse 4 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $79
+endproc COM_Parse 4 8
+bss
+align 1
+LABELV $81
+skip 4096
+export COM_ParseError
+code
+proc COM_ParseError 4 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRGP4 $81
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $83
+ARGP4
+ADDRGP4 com_parsename
+ARGP4
+ADDRGP4 com_lines
+INDIRI4
+ARGI4
+ADDRGP4 $81
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $80
+endproc COM_ParseError 4 16
+bss
+align 1
+LABELV $85
+skip 4096
+export COM_ParseWarning
+code
+proc COM_ParseWarning 4 16
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRGP4 $85
+ARGP4
+CNSTI4 4096
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRGP4 $87
+ARGP4
+ADDRGP4 com_parsename
+ARGP4
+ADDRGP4 com_lines
+INDIRI4
+ARGI4
+ADDRGP4 $85
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $84
+endproc COM_ParseWarning 4 16
+proc SkipWhitespace 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $90
+JUMPV
+LABELV $89
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $92
+CNSTP4 0
+RETP4
+ADDRGP4 $88
+JUMPV
+LABELV $92
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $94
+ADDRLP4 4
+ADDRGP4 com_lines
+ASGNP4
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $94
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $90
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+LEI4 $89
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $88
+endproc SkipWhitespace 12 0
+export COM_Compress
+proc COM_Compress 48 0
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $97
+ADDRGP4 $100
+JUMPV
+LABELV $99
+ADDRLP4 24
+CNSTI4 47
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $102
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+NEI4 $102
+ADDRGP4 $105
+JUMPV
+LABELV $104
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $105
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $107
+ADDRLP4 28
+INDIRI4
+CNSTI4 10
+NEI4 $104
+LABELV $107
+ADDRGP4 $103
+JUMPV
+LABELV $102
+ADDRLP4 4
+INDIRI4
+CNSTI4 47
+NEI4 $108
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $108
+ADDRGP4 $111
+JUMPV
+LABELV $110
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $111
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $113
+ADDRLP4 32
+INDIRI4
+CNSTI4 42
+NEI4 $110
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $110
+LABELV $113
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $109
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $109
+JUMPV
+LABELV $108
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+EQI4 $118
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+NEI4 $116
+LABELV $118
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+ASGNP4
+ADDRGP4 $117
+JUMPV
+LABELV $116
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+EQI4 $121
+ADDRLP4 4
+INDIRI4
+CNSTI4 9
+NEI4 $119
+LABELV $121
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRGP4 $120
+JUMPV
+LABELV $119
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $122
+ADDRLP4 36
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI1 10
+ASGNI1
+ADDRLP4 40
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 40
+INDIRI4
+ASGNI4
+LABELV $122
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $124
+ADDRLP4 36
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+CNSTI1 32
+ASGNI1
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $124
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+NEI4 $126
+ADDRLP4 36
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $129
+JUMPV
+LABELV $128
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $130
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+EQI4 $130
+ADDRLP4 44
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 44
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $132
+LABELV $129
+ADDRGP4 $128
+JUMPV
+LABELV $130
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+NEI4 $127
+ADDRLP4 40
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 40
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $127
+JUMPV
+LABELV $126
+ADDRLP4 8
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 36
+INDIRI4
+ADDP4
+ASGNP4
+LABELV $127
+LABELV $120
+LABELV $117
+LABELV $109
+LABELV $103
+LABELV $100
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $99
+LABELV $97
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+RETI4
+LABELV $96
+endproc COM_Compress 48 0
+export COM_ParseExt
+proc COM_ParseExt 36 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 com_token
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $139
+ADDRFP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 com_token
+RETP4
+ADDRGP4 $135
+JUMPV
+LABELV $138
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 16
+ADDRGP4 SkipWhitespace
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $141
+ADDRFP4 0
+INDIRP4
+CNSTP4 0
+ASGNP4
+ADDRGP4 com_token
+RETP4
+ADDRGP4 $135
+JUMPV
+LABELV $141
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $143
+ADDRFP4 4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $143
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 com_token
+RETP4
+ADDRGP4 $135
+JUMPV
+LABELV $143
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+CNSTI4 47
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+NEI4 $145
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ADDRLP4 24
+INDIRI4
+NEI4 $145
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $148
+JUMPV
+LABELV $147
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $148
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $150
+ADDRLP4 28
+INDIRI4
+CNSTI4 10
+NEI4 $147
+LABELV $150
+ADDRGP4 $146
+JUMPV
+LABELV $145
+ADDRLP4 4
+INDIRI4
+CNSTI4 47
+NEI4 $140
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 42
+NEI4 $140
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $154
+JUMPV
+LABELV $153
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $154
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $156
+ADDRLP4 32
+INDIRI4
+CNSTI4 42
+NEI4 $153
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $153
+LABELV $156
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $152
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+LABELV $152
+LABELV $146
+LABELV $139
+ADDRGP4 $138
+JUMPV
+LABELV $140
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+NEI4 $159
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $162
+JUMPV
+LABELV $161
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 16
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 16
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 34
+EQI4 $166
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $164
+LABELV $166
+ADDRLP4 8
+INDIRI4
+ADDRGP4 com_token
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 com_token
+RETP4
+ADDRGP4 $135
+JUMPV
+LABELV $164
+ADDRLP4 8
+INDIRI4
+CNSTI4 1023
+GEI4 $167
+ADDRLP4 8
+INDIRI4
+ADDRGP4 com_token
+ADDP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $167
+LABELV $162
+ADDRGP4 $161
+JUMPV
+LABELV $159
+LABELV $169
+ADDRLP4 8
+INDIRI4
+CNSTI4 1023
+GEI4 $172
+ADDRLP4 8
+INDIRI4
+ADDRGP4 com_token
+ADDP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $172
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 10
+NEI4 $174
+ADDRLP4 16
+ADDRGP4 com_lines
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $174
+LABELV $170
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+GTI4 $169
+ADDRLP4 8
+INDIRI4
+ADDRGP4 com_token
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 com_token
+RETP4
+LABELV $135
+endproc COM_ParseExt 36 8
+export COM_MatchToken
+proc COM_MatchToken 12 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+EQI4 $177
+CNSTI4 1
+ARGI4
+ADDRGP4 $179
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $177
+LABELV $176
+endproc COM_MatchToken 12 16
+export SkipBracedSection
+proc SkipBracedSection 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $181
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $184
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 123
+NEI4 $186
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $187
+JUMPV
+LABELV $186
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 125
+NEI4 $188
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $188
+LABELV $187
+LABELV $184
+LABELV $182
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $190
+ADDRFP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $181
+LABELV $190
+LABELV $180
+endproc SkipBracedSection 12 8
+export SkipRestOfLine
+proc SkipRestOfLine 16 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRGP4 $193
+JUMPV
+LABELV $192
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $195
+ADDRLP4 8
+ADDRGP4 com_lines
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $194
+JUMPV
+LABELV $195
+LABELV $193
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $192
+LABELV $194
+ADDRFP4 0
+INDIRP4
+ADDRLP4 4
+INDIRP4
+ASGNP4
+LABELV $191
+endproc SkipRestOfLine 16 0
+export Parse1DMatrix
+proc Parse1DMatrix 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $202
+JUMPV
+LABELV $199
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 12
+INDIRF4
+ASGNF4
+LABELV $200
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $202
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $199
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $203
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+LABELV $197
+endproc Parse1DMatrix 16 8
+export Parse2DMatrix
+proc Parse2DMatrix 8 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $208
+JUMPV
+LABELV $205
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 8
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRFP4 12
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 Parse1DMatrix
+CALLV
+pop
+LABELV $206
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $208
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $205
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $203
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+LABELV $204
+endproc Parse2DMatrix 8 12
+export Parse3DMatrix
+proc Parse3DMatrix 12 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $198
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $213
+JUMPV
+LABELV $210
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 12
+INDIRI4
+MULI4
+ADDRFP4 8
+INDIRI4
+MULI4
+CNSTI4 2
+LSHI4
+ADDRFP4 16
+INDIRP4
+ADDP4
+ARGP4
+ADDRGP4 Parse2DMatrix
+CALLV
+pop
+LABELV $211
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $213
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $210
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $203
+ARGP4
+ADDRGP4 COM_MatchToken
+CALLV
+pop
+LABELV $209
+endproc Parse3DMatrix 12 16
+export Com_HexStrToInt
+proc Com_HexStrToInt 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $217
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $215
+LABELV $217
+CNSTI4 -1
+RETI4
+ADDRGP4 $214
+JUMPV
+LABELV $215
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 48
+NEI4 $218
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 120
+NEI4 $218
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 2
+ASGNI4
+ADDRGP4 $223
+JUMPV
+LABELV $220
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 20
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 24
+ADDRLP4 16
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 48
+LTI4 $224
+ADDRLP4 24
+INDIRI4
+CNSTI4 57
+GTI4 $224
+ADDRLP4 16
+ADDRLP4 16
+INDIRI1
+CVII4 1
+CNSTI4 48
+SUBI4
+CVII1 4
+ASGNI1
+ADDRGP4 $225
+JUMPV
+LABELV $224
+ADDRLP4 28
+ADDRLP4 16
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 97
+LTI4 $226
+ADDRLP4 28
+INDIRI4
+CNSTI4 102
+GTI4 $226
+ADDRLP4 16
+ADDRLP4 16
+INDIRI1
+CVII4 1
+CNSTI4 97
+SUBI4
+CNSTI4 10
+ADDI4
+CVII1 4
+ASGNI1
+ADDRGP4 $227
+JUMPV
+LABELV $226
+CNSTI4 -1
+RETI4
+ADDRGP4 $214
+JUMPV
+LABELV $227
+LABELV $225
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI1
+CVII4 1
+ADDI4
+ASGNI4
+LABELV $221
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $223
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $220
+ADDRLP4 12
+INDIRI4
+RETI4
+ADDRGP4 $214
+JUMPV
+LABELV $218
+CNSTI4 -1
+RETI4
+LABELV $214
+endproc Com_HexStrToInt 32 4
+export Q_isprint
+proc Q_isprint 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $229
+ADDRLP4 0
+INDIRI4
+CNSTI4 126
+GTI4 $229
+CNSTI4 1
+RETI4
+ADDRGP4 $228
+JUMPV
+LABELV $229
+CNSTI4 0
+RETI4
+LABELV $228
+endproc Q_isprint 4 0
+export Q_islower
+proc Q_islower 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $232
+ADDRLP4 0
+INDIRI4
+CNSTI4 122
+GTI4 $232
+CNSTI4 1
+RETI4
+ADDRGP4 $231
+JUMPV
+LABELV $232
+CNSTI4 0
+RETI4
+LABELV $231
+endproc Q_islower 4 0
+export Q_isupper
+proc Q_isupper 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $235
+ADDRLP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $235
+CNSTI4 1
+RETI4
+ADDRGP4 $234
+JUMPV
+LABELV $235
+CNSTI4 0
+RETI4
+LABELV $234
+endproc Q_isupper 4 0
+export Q_isalpha
+proc Q_isalpha 8 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $241
+ADDRFP4 0
+INDIRI4
+CNSTI4 122
+LEI4 $240
+LABELV $241
+ADDRFP4 0
+INDIRI4
+CNSTI4 65
+LTI4 $238
+ADDRFP4 0
+INDIRI4
+CNSTI4 90
+GTI4 $238
+LABELV $240
+CNSTI4 1
+RETI4
+ADDRGP4 $237
+JUMPV
+LABELV $238
+CNSTI4 0
+RETI4
+LABELV $237
+endproc Q_isalpha 8 0
+export Q_strrchr
+proc Q_strrchr 12 0
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 8
+CNSTP4 0
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $244
+JUMPV
+LABELV $243
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRLP4 4
+INDIRI1
+CVII4 1
+NEI4 $246
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $246
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $244
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $243
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $248
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $248
+ADDRLP4 8
+INDIRP4
+RETP4
+LABELV $242
+endproc Q_strrchr 12 0
+export Q_isanumber
+proc Q_isanumber 0 0
+CNSTI4 0
+RETI4
+LABELV $250
+endproc Q_isanumber 0 0
+export Q_isintegral
+proc Q_isintegral 8 0
+ADDRLP4 4
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+NEF4 $253
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+ADDRGP4 $254
+JUMPV
+LABELV $253
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $254
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $251
+endproc Q_isintegral 8 0
+export Q_strncpyz
+proc Q_strncpyz 0 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $256
+CNSTI4 0
+ARGI4
+ADDRGP4 $258
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $256
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $259
+CNSTI4 0
+ARGI4
+ADDRGP4 $261
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $259
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+GEI4 $262
+CNSTI4 0
+ARGI4
+ADDRGP4 $264
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $262
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 strncpy
+CALLP4
+pop
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $255
+endproc Q_strncpyz 0 12
+export Q_stricmpn
+proc Q_stricmpn 36 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $266
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $268
+CNSTI4 0
+RETI4
+ADDRGP4 $265
+JUMPV
+LABELV $268
+CNSTI4 -1
+RETI4
+ADDRGP4 $265
+JUMPV
+LABELV $266
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $270
+CNSTI4 1
+RETI4
+ADDRGP4 $265
+JUMPV
+LABELV $270
+LABELV $272
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRLP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $275
+CNSTI4 0
+RETI4
+ADDRGP4 $265
+JUMPV
+LABELV $275
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $277
+ADDRLP4 0
+INDIRI4
+CNSTI4 97
+LTI4 $279
+ADDRLP4 0
+INDIRI4
+CNSTI4 122
+GTI4 $279
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+LABELV $279
+ADDRLP4 4
+INDIRI4
+CNSTI4 97
+LTI4 $281
+ADDRLP4 4
+INDIRI4
+CNSTI4 122
+GTI4 $281
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+LABELV $281
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $283
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $286
+ADDRLP4 32
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+LABELV $287
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $265
+JUMPV
+LABELV $283
+LABELV $277
+LABELV $273
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $272
+CNSTI4 0
+RETI4
+LABELV $265
+endproc Q_stricmpn 36 0
+export Q_strncmp
+proc Q_strncmp 28 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+LABELV $289
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+ADDRLP4 8
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $292
+CNSTI4 0
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $292
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $294
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GEI4 $297
+ADDRLP4 24
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $298
+JUMPV
+LABELV $297
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+LABELV $298
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $294
+LABELV $290
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $289
+CNSTI4 0
+RETI4
+LABELV $288
+endproc Q_strncmp 28 0
+export Q_stricmp
+proc Q_stricmp 12 12
+ADDRLP4 4
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $301
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 4
+INDIRU4
+EQU4 $301
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 99999
+ARGI4
+ADDRLP4 8
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $302
+JUMPV
+LABELV $301
+ADDRLP4 0
+CNSTI4 -1
+ASGNI4
+LABELV $302
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $299
+endproc Q_stricmp 12 12
+export Q_strlwr
+proc Q_strlwr 12 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $305
+JUMPV
+LABELV $304
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 tolower
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $305
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $304
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $303
+endproc Q_strlwr 12 4
+export Q_strupr
+proc Q_strupr 12 4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $309
+JUMPV
+LABELV $308
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8
+ADDRGP4 toupper
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 8
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $309
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $308
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $307
+endproc Q_strupr 12 4
+export Q_strcat
+proc Q_strcat 12 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $312
+CNSTI4 0
+ARGI4
+ADDRGP4 $314
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $312
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $311
+endproc Q_strcat 12 12
+export Q_stristr
+proc Q_stristr 36 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 8
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 1
+ADDRLP4 12
+INDIRI1
+ASGNI1
+ADDRLP4 12
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $316
+ADDRLP4 16
+ADDRLP4 1
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 97
+LTI4 $318
+ADDRLP4 16
+INDIRI4
+CNSTI4 122
+GTI4 $318
+ADDRLP4 1
+ADDRLP4 1
+INDIRI1
+CVII4 1
+CNSTI4 32
+SUBI4
+CVII1 4
+ASGNI1
+LABELV $318
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+LABELV $320
+LABELV $323
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 28
+ADDRLP4 24
+INDIRP4
+INDIRI1
+ASGNI1
+ADDRLP4 0
+ADDRLP4 28
+INDIRI1
+ASGNI1
+ADDRLP4 28
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $326
+CNSTP4 0
+RETP4
+ADDRGP4 $315
+JUMPV
+LABELV $326
+ADDRLP4 32
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 97
+LTI4 $328
+ADDRLP4 32
+INDIRI4
+CNSTI4 122
+GTI4 $328
+ADDRLP4 0
+ADDRLP4 0
+INDIRI1
+CVII4 1
+CNSTI4 32
+SUBI4
+CVII1 4
+ASGNI1
+LABELV $328
+LABELV $324
+ADDRLP4 0
+INDIRI1
+CVII4 1
+ADDRLP4 1
+INDIRI1
+CVII4 1
+NEI4 $323
+LABELV $321
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $320
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 -1
+ADDP4
+ASGNP4
+LABELV $316
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $315
+endproc Q_stristr 36 12
+export Q_PrintStrlen
+proc Q_PrintStrlen 28 0
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $331
+CNSTI4 0
+RETI4
+ADDRGP4 $330
+JUMPV
+LABELV $331
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $334
+JUMPV
+LABELV $333
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $336
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $336
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $336
+ADDRLP4 12
+INDIRI4
+CNSTI4 65
+LTI4 $339
+ADDRLP4 12
+INDIRI4
+CNSTI4 90
+LEI4 $338
+LABELV $339
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 97
+LTI4 $340
+ADDRLP4 16
+INDIRI4
+CNSTI4 122
+LEI4 $338
+LABELV $340
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 48
+LTI4 $336
+ADDRLP4 20
+INDIRI4
+CNSTI4 57
+GTI4 $336
+LABELV $338
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 2
+ADDP4
+ASGNP4
+ADDRGP4 $334
+JUMPV
+LABELV $336
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $334
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $333
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $330
+endproc Q_PrintStrlen 28 0
+export Q_CleanStr
+proc Q_CleanStr 40 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $343
+JUMPV
+LABELV $342
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $345
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 94
+NEI4 $345
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $345
+ADDRLP4 20
+INDIRI4
+CNSTI4 65
+LTI4 $348
+ADDRLP4 20
+INDIRI4
+CNSTI4 90
+LEI4 $347
+LABELV $348
+ADDRLP4 24
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 97
+LTI4 $349
+ADDRLP4 24
+INDIRI4
+CNSTI4 122
+LEI4 $347
+LABELV $349
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 48
+LTI4 $345
+ADDRLP4 28
+INDIRI4
+CNSTI4 57
+GTI4 $345
+LABELV $347
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $346
+JUMPV
+LABELV $345
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+LTI4 $350
+ADDRLP4 4
+INDIRI4
+CNSTI4 126
+GTI4 $350
+ADDRLP4 36
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+LABELV $350
+LABELV $346
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $343
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $342
+ADDRLP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $341
+endproc Q_CleanStr 40 0
+export Q_CountChar
+proc Q_CountChar 4 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $356
+JUMPV
+LABELV $353
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ADDRFP4 4
+INDIRI1
+CVII4 1
+NEI4 $357
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $357
+LABELV $354
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $356
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $353
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $352
+endproc Q_CountChar 4 0
+export Com_sprintf
+proc Com_sprintf 32012 16
+ADDRLP4 32004
+ADDRFP4 8+4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 32000
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 32004
+INDIRP4
+ARGP4
+ADDRLP4 32008
+ADDRGP4 Q_vsnprintf
+CALLI4
+ASGNI4
+ADDRLP4 32000
+ADDRLP4 32008
+INDIRI4
+ASGNI4
+ADDRLP4 32004
+CNSTP4 0
+ASGNP4
+ADDRLP4 32000
+INDIRI4
+CVIU4 4
+CNSTU4 32000
+LTU4 $361
+CNSTI4 0
+ARGI4
+ADDRGP4 $363
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $361
+ADDRLP4 32000
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $364
+ADDRGP4 $366
+ARGP4
+ADDRLP4 32000
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $364
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $359
+endproc Com_sprintf 32012 16
+bss
+align 1
+LABELV $368
+skip 64000
+data
+align 4
+LABELV $369
+byte 4 0
+export va
+code
+proc va 24 16
+ADDRLP4 8
+CNSTI4 32000
+ASGNI4
+ADDRLP4 12
+ADDRGP4 $369
+ASGNP4
+ADDRLP4 16
+ADDRLP4 12
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+BANDI4
+MULI4
+ADDRGP4 $368
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0+4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Q_vsnprintf
+CALLI4
+pop
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+INDIRP4
+RETP4
+LABELV $367
+endproc va 24 16
+export Com_TruncateLongString
+proc Com_TruncateLongString 8 12
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 64
+GTI4 $372
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $373
+JUMPV
+LABELV $372
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 29
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $374
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 -29
+ADDP4
+ARGP4
+ADDRGP4 Q_strcat
+CALLV
+pop
+LABELV $373
+LABELV $371
+endproc Com_TruncateLongString 8 12
+bss
+align 1
+LABELV $376
+skip 16384
+data
+align 4
+LABELV $377
+byte 4 0
+export Info_ValueForKey
+code
+proc Info_ValueForKey 8220 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 8196
+CNSTU4 0
+ASGNU4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8196
+INDIRU4
+EQU4 $380
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8196
+INDIRU4
+NEU4 $378
+LABELV $380
+ADDRGP4 $41
+RETP4
+ADDRGP4 $375
+JUMPV
+LABELV $378
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8200
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8200
+INDIRI4
+CNSTI4 8192
+LTI4 $381
+CNSTI4 1
+ARGI4
+ADDRGP4 $383
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $381
+ADDRLP4 8204
+ADDRGP4 $377
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ADDRLP4 8204
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $387
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRGP4 $387
+JUMPV
+LABELV $386
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $390
+JUMPV
+LABELV $389
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $392
+ADDRGP4 $41
+RETP4
+ADDRGP4 $375
+JUMPV
+LABELV $392
+ADDRLP4 8208
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8216
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8212
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 8212
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8212
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $390
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $389
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $377
+INDIRI4
+CNSTI4 13
+LSHI4
+ADDRGP4 $376
+ADDP4
+ASGNP4
+ADDRGP4 $395
+JUMPV
+LABELV $394
+ADDRLP4 8208
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8216
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8212
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 8212
+INDIRP4
+ADDRLP4 8216
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8208
+INDIRP4
+ADDRLP4 8212
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $395
+ADDRLP4 8208
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8208
+INDIRI4
+CNSTI4 92
+EQI4 $397
+ADDRLP4 8208
+INDIRI4
+CNSTI4 0
+NEI4 $394
+LABELV $397
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8212
+INDIRI4
+CNSTI4 0
+NEI4 $398
+ADDRGP4 $377
+INDIRI4
+CNSTI4 13
+LSHI4
+ADDRGP4 $376
+ADDP4
+RETP4
+ADDRGP4 $375
+JUMPV
+LABELV $398
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $400
+ADDRGP4 $388
+JUMPV
+LABELV $400
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $387
+ADDRGP4 $386
+JUMPV
+LABELV $388
+ADDRGP4 $41
+RETP4
+LABELV $375
+endproc Info_ValueForKey 8220 8
+export Info_NextPair
+proc Info_NextPair 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $403
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $403
+ADDRFP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 8
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRGP4 $406
+JUMPV
+LABELV $405
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $408
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $402
+JUMPV
+LABELV $408
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $406
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $405
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 $411
+JUMPV
+LABELV $410
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ADDRLP4 16
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $411
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 92
+EQI4 $413
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $410
+LABELV $413
+ADDRLP4 4
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+LABELV $402
+endproc Info_NextPair 20 0
+export Info_RemoveKey
+proc Info_RemoveKey 2080 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2056
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 2056
+INDIRI4
+CNSTI4 1024
+LTI4 $415
+CNSTI4 1
+ARGI4
+ADDRGP4 $417
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $415
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 2060
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 2060
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $421
+ADDRGP4 $414
+JUMPV
+LABELV $420
+ADDRLP4 1028
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $423
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $423
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $426
+JUMPV
+LABELV $425
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $428
+ADDRGP4 $414
+JUMPV
+LABELV $428
+ADDRLP4 2068
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 2076
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2072
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 2072
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2072
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $426
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $425
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1032
+ASGNP4
+ADDRGP4 $431
+JUMPV
+LABELV $430
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $433
+ADDRGP4 $414
+JUMPV
+LABELV $433
+ADDRLP4 2068
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 2076
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2072
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 2072
+INDIRP4
+ADDRLP4 2076
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 2068
+INDIRP4
+ADDRLP4 2072
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $431
+ADDRLP4 2068
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 92
+EQI4 $435
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $430
+LABELV $435
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 2072
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2072
+INDIRI4
+CNSTI4 0
+NEI4 $436
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2076
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 2076
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 memmove
+CALLP4
+pop
+ADDRGP4 $414
+JUMPV
+LABELV $436
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $438
+ADDRGP4 $414
+JUMPV
+LABELV $438
+LABELV $421
+ADDRGP4 $420
+JUMPV
+LABELV $414
+endproc Info_RemoveKey 2080 12
+export Info_RemoveKey_Big
+proc Info_RemoveKey_Big 16416 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 16392
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 16392
+INDIRI4
+CNSTI4 8192
+LTI4 $441
+CNSTI4 1
+ARGI4
+ADDRGP4 $443
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+LABELV $441
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 92
+ARGI4
+ADDRLP4 16396
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 16396
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $447
+ADDRGP4 $440
+JUMPV
+LABELV $446
+ADDRLP4 8196
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $449
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $449
+ADDRLP4 0
+ADDRLP4 4
+ASGNP4
+ADDRGP4 $452
+JUMPV
+LABELV $451
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $454
+ADDRGP4 $440
+JUMPV
+LABELV $454
+ADDRLP4 16404
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16412
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16408
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 16408
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16408
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $452
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 92
+NEI4 $451
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8200
+ASGNP4
+ADDRGP4 $457
+JUMPV
+LABELV $456
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $459
+ADDRGP4 $440
+JUMPV
+LABELV $459
+ADDRLP4 16404
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16412
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16408
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+ADDRLP4 16408
+INDIRP4
+ADDRLP4 16412
+INDIRI4
+ADDP4
+ASGNP4
+ADDRLP4 16404
+INDIRP4
+ADDRLP4 16408
+INDIRP4
+INDIRI1
+ASGNI1
+LABELV $457
+ADDRLP4 16404
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16404
+INDIRI4
+CNSTI4 92
+EQI4 $461
+ADDRLP4 16404
+INDIRI4
+CNSTI4 0
+NEI4 $456
+LABELV $461
+ADDRLP4 0
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 16408
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 16408
+INDIRI4
+CNSTI4 0
+NEI4 $462
+ADDRLP4 8196
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $440
+JUMPV
+LABELV $462
+ADDRFP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $464
+ADDRGP4 $440
+JUMPV
+LABELV $464
+LABELV $447
+ADDRGP4 $446
+JUMPV
+LABELV $440
+endproc Info_RemoveKey_Big 16416 8
+export Info_Validate
+proc Info_Validate 8 8
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 34
+ARGI4
+ADDRLP4 0
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $467
+CNSTI4 0
+RETI4
+ADDRGP4 $466
+JUMPV
+LABELV $467
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 59
+ARGI4
+ADDRLP4 4
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $469
+CNSTI4 0
+RETI4
+ADDRGP4 $466
+JUMPV
+LABELV $469
+CNSTI4 1
+RETI4
+LABELV $466
+endproc Info_Validate 8 8
+export Info_SetValueForKey
+proc Info_SetValueForKey 1048 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $472
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1028
+INDIRI4
+CNSTI4 1024
+LTI4 $479
+CNSTI4 1
+ARGI4
+ADDRGP4 $475
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+ADDRGP4 $479
+JUMPV
+LABELV $476
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 1032
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1032
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $482
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 1036
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 1036
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $480
+LABELV $482
+ADDRGP4 $483
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $471
+JUMPV
+LABELV $480
+LABELV $477
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $479
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $476
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Info_RemoveKey
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $486
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+CNSTI4 0
+NEI4 $484
+LABELV $486
+ADDRGP4 $471
+JUMPV
+LABELV $484
+ADDRLP4 4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 $487
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+ADDRLP4 1044
+INDIRI4
+ADDI4
+CNSTI4 1024
+LTI4 $488
+ADDRGP4 $490
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $471
+JUMPV
+LABELV $488
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $471
+endproc Info_SetValueForKey 1048 20
+export Info_SetValueForKey_Big
+proc Info_SetValueForKey_Big 8216 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRGP4 $472
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8196
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8196
+INDIRI4
+CNSTI4 8192
+LTI4 $497
+CNSTI4 1
+ARGI4
+ADDRGP4 $475
+ARGP4
+ADDRGP4 Com_Error
+CALLV
+pop
+ADDRGP4 $497
+JUMPV
+LABELV $494
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8200
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 8200
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $500
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRLP4 8204
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $498
+LABELV $500
+ADDRGP4 $483
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $491
+JUMPV
+LABELV $498
+LABELV $495
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $497
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $494
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Info_RemoveKey_Big
+CALLV
+pop
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $503
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8204
+INDIRI4
+CNSTI4 0
+NEI4 $501
+LABELV $503
+ADDRGP4 $491
+JUMPV
+LABELV $501
+ADDRLP4 4
+ARGP4
+CNSTI4 8192
+ARGI4
+ADDRGP4 $487
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 8208
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8208
+INDIRI4
+ADDRLP4 8212
+INDIRI4
+ADDI4
+CNSTI4 8192
+LTI4 $504
+ADDRGP4 $506
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $491
+JUMPV
+LABELV $504
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $491
+endproc Info_SetValueForKey_Big 8216 20
+proc Com_CharIsOneOfCharset 8 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CVII1 4
+ASGNI1
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $511
+JUMPV
+LABELV $508
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+ADDRFP4 0
+INDIRI1
+CVII4 1
+NEI4 $512
+CNSTI4 1
+RETI4
+ADDRGP4 $507
+JUMPV
+LABELV $512
+LABELV $509
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $511
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $508
+CNSTI4 0
+RETI4
+LABELV $507
+endproc Com_CharIsOneOfCharset 8 4
+export Com_SkipCharset
+proc Com_SkipCharset 8 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $516
+JUMPV
+LABELV $515
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 Com_CharIsOneOfCharset
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $517
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $519
+LABELV $516
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $515
+LABELV $517
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $514
+endproc Com_SkipCharset 8 8
+export Com_SkipTokens
+proc Com_SkipTokens 20 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $522
+JUMPV
+LABELV $521
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Com_CharIsOneOfCharset
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $524
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $527
+JUMPV
+LABELV $526
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $527
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ARGI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRLP4 16
+ADDRGP4 Com_CharIsOneOfCharset
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $526
+ADDRGP4 $525
+JUMPV
+LABELV $524
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $529
+ADDRGP4 $523
+JUMPV
+LABELV $529
+LABELV $525
+LABELV $522
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $521
+LABELV $523
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $531
+ADDRLP4 0
+INDIRP4
+RETP4
+ADDRGP4 $520
+JUMPV
+LABELV $531
+ADDRFP4 0
+INDIRP4
+RETP4
+LABELV $520
+endproc Com_SkipTokens 20 8
+bss
+align 4
+LABELV com_lines
+skip 4
+align 1
+LABELV com_parsename
+skip 1024
+align 1
+LABELV com_token
+skip 1024
+import Com_Printf
+import Com_Error
+import Info_RemoveKey_big
+import Com_RandomBytes
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $506
+byte 1 66
+byte 1 73
+byte 1 71
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $490
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 103
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $487
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 92
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $483
+byte 1 94
+byte 1 51
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 39
+byte 1 116
+byte 1 32
+byte 1 117
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 115
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 104
+byte 1 32
+byte 1 97
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 99
+byte 1 39
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $475
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $472
+byte 1 92
+byte 1 59
+byte 1 34
+byte 1 0
+align 1
+LABELV $443
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 66
+byte 1 105
+byte 1 103
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $417
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 82
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $383
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 95
+byte 1 86
+byte 1 97
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $374
+byte 1 32
+byte 1 46
+byte 1 46
+byte 1 46
+byte 1 32
+byte 1 0
+align 1
+LABELV $366
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $363
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 116
+byte 1 102
+byte 1 58
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 98
+byte 1 117
+byte 1 102
+byte 1 102
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $314
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 121
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 102
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $264
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 110
+byte 1 99
+byte 1 112
+byte 1 121
+byte 1 122
+byte 1 58
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 115
+byte 1 105
+byte 1 122
+byte 1 101
+byte 1 32
+byte 1 60
+byte 1 32
+byte 1 49
+byte 1 0
+align 1
+LABELV $261
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 110
+byte 1 99
+byte 1 112
+byte 1 121
+byte 1 122
+byte 1 58
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 115
+byte 1 114
+byte 1 99
+byte 1 0
+align 1
+LABELV $258
+byte 1 81
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 114
+byte 1 110
+byte 1 99
+byte 1 112
+byte 1 121
+byte 1 122
+byte 1 58
+byte 1 32
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 32
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $203
+byte 1 41
+byte 1 0
+align 1
+LABELV $198
+byte 1 40
+byte 1 0
+align 1
+LABELV $179
+byte 1 77
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 84
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 33
+byte 1 61
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $87
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $83
+byte 1 69
+byte 1 82
+byte 1 82
+byte 1 79
+byte 1 82
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $77
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $58
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $41
+byte 1 0
@@ -0,0 +1,4208 @@
+export UI_Alloc
+code
+proc UI_Alloc 12 0
+ADDRGP4 allocPoint
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDI4
+CNSTI4 131072
+LEI4 $69
+ADDRGP4 outOfMemory
+CNSTI4 1
+ASGNI4
+CNSTP4 0
+RETP4
+ADDRGP4 $68
+JUMPV
+LABELV $69
+ADDRLP4 4
+ADDRGP4 allocPoint
+ASGNP4
+ADDRLP4 8
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRGP4 memoryPool
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 31
+ADDI4
+CNSTI4 -32
+BANDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+RETP4
+LABELV $68
+endproc UI_Alloc 12 0
+export UI_InitMemory
+proc UI_InitMemory 4 0
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 allocPoint
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 outOfMemory
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $71
+endproc UI_InitMemory 4 0
+export UI_ParseInfos
+proc UI_ParseInfos 2084 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+CNSTI4 0
+ASGNI4
+ADDRGP4 $74
+JUMPV
+LABELV $73
+ADDRFP4 0
+ARGP4
+ADDRLP4 2056
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2056
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $76
+ADDRGP4 $75
+JUMPV
+LABELV $76
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $80
+ARGP4
+ADDRLP4 2060
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2060
+INDIRI4
+CNSTI4 0
+EQI4 $78
+ADDRGP4 $81
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $75
+JUMPV
+LABELV $78
+ADDRLP4 2052
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $82
+ADDRGP4 $84
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $75
+JUMPV
+LABELV $82
+ADDRLP4 1028
+CNSTI1 0
+ASGNI1
+ADDRGP4 $86
+JUMPV
+LABELV $85
+ADDRFP4 0
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 2064
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2064
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $88
+ADDRGP4 $90
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRGP4 $87
+JUMPV
+LABELV $88
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $93
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 2068
+INDIRI4
+CNSTI4 0
+NEI4 $91
+ADDRGP4 $87
+JUMPV
+LABELV $91
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 2072
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 2072
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $94
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $96
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $94
+ADDRLP4 1028
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $86
+ADDRGP4 $85
+JUMPV
+LABELV $87
+ADDRLP4 1028
+ARGP4
+ADDRLP4 2064
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 $97
+ARGP4
+ADDRLP4 2068
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 $98
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 2072
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 2072
+INDIRP4
+ARGP4
+ADDRLP4 2076
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 2064
+INDIRI4
+ADDRLP4 2068
+INDIRI4
+ADDI4
+ADDRLP4 2076
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 2080
+ADDRGP4 UI_Alloc
+CALLP4
+ASGNP4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+ADDRLP4 2080
+INDIRP4
+ASGNP4
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $99
+ADDRLP4 2052
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 8
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1028
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 2052
+ADDRLP4 2052
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $99
+LABELV $74
+ADDRGP4 $73
+JUMPV
+LABELV $75
+ADDRLP4 2052
+INDIRI4
+RETI4
+LABELV $72
+endproc UI_ParseInfos 2084 12
+proc UI_LoadArenasFromFile 8216 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8200
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8200
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $102
+ADDRGP4 $104
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $102
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+LTI4 $105
+ADDRGP4 $107
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 8192
+ARGI4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $105
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 8204
+ADDRGP4 ui_numArenas
+ASGNP4
+ADDRLP4 8208
+ADDRLP4 8204
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 1024
+ADDRLP4 8208
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8208
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 UI_ParseInfos
+CALLI4
+ASGNI4
+ADDRLP4 8204
+INDIRP4
+ADDRLP4 8208
+INDIRI4
+ADDRLP4 8212
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $101
+endproc UI_LoadArenasFromFile 8216 16
+proc UI_LoadArenas 1504 16
+ADDRGP4 ui_numArenas
+CNSTI4 0
+ASGNI4
+ADDRLP4 168
+ARGP4
+ADDRGP4 $109
+ARGP4
+ADDRGP4 $110
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 168+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $111
+ADDRLP4 168+16
+ARGP4
+ADDRGP4 UI_LoadArenasFromFile
+CALLV
+pop
+ADDRGP4 $112
+JUMPV
+LABELV $111
+ADDRGP4 $115
+ARGP4
+ADDRGP4 UI_LoadArenasFromFile
+CALLV
+pop
+LABELV $112
+ADDRGP4 $116
+ARGP4
+ADDRGP4 $117
+ARGP4
+ADDRLP4 440
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1464
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 152
+ADDRLP4 1464
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 440
+ASGNP4
+ADDRLP4 140
+CNSTI4 0
+ASGNI4
+ADDRGP4 $121
+JUMPV
+LABELV $118
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1468
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 144
+ADDRLP4 1468
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRGP4 $122
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 12
+ARGP4
+ADDRGP4 UI_LoadArenasFromFile
+CALLV
+pop
+LABELV $119
+ADDRLP4 1468
+CNSTI4 1
+ASGNI4
+ADDRLP4 140
+ADDRLP4 140
+INDIRI4
+ADDRLP4 1468
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 144
+INDIRI4
+ADDRLP4 1468
+INDIRI4
+ADDI4
+ADDRLP4 8
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $121
+ADDRLP4 140
+INDIRI4
+ADDRLP4 152
+INDIRI4
+LTI4 $118
+ADDRGP4 $123
+ARGP4
+ADDRGP4 ui_numArenas
+INDIRI4
+ARGI4
+ADDRLP4 1472
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1472
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 outOfMemory
+INDIRI4
+CNSTI4 0
+EQI4 $124
+ADDRGP4 $126
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $124
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $130
+JUMPV
+LABELV $127
+ADDRGP4 $132
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1476
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $131
+ARGP4
+ADDRLP4 1476
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $128
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $130
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $127
+ADDRLP4 1476
+CNSTI4 0
+ASGNI4
+ADDRGP4 ui_numSinglePlayerArenas
+ADDRLP4 1476
+INDIRI4
+ASGNI4
+ADDRGP4 ui_numSpecialSinglePlayerArenas
+ADDRLP4 1476
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1476
+INDIRI4
+ASGNI4
+ADDRGP4 $136
+JUMPV
+LABELV $133
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $137
+ARGP4
+ADDRLP4 1480
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1480
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $138
+ADDRGP4 $134
+JUMPV
+LABELV $138
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $142
+ARGP4
+ADDRLP4 1484
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 1484
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $140
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $143
+ARGP4
+ADDRLP4 1488
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 1488
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $144
+ADDRLP4 1492
+ADDRGP4 ui_numSpecialSinglePlayerArenas
+ASGNP4
+ADDRLP4 1492
+INDIRP4
+ADDRLP4 1492
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $134
+JUMPV
+LABELV $144
+ADDRLP4 1492
+ADDRGP4 ui_numSinglePlayerArenas
+ASGNP4
+ADDRLP4 1492
+INDIRP4
+ADDRLP4 1492
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $140
+LABELV $134
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $136
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $133
+ADDRLP4 0
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+CNSTI4 4
+MODI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $146
+ADDRLP4 1480
+ADDRGP4 ui_numSinglePlayerArenas
+ASGNP4
+ADDRLP4 1480
+INDIRP4
+ADDRLP4 1480
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $148
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRLP4 1488
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1488
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $146
+ADDRLP4 1480
+CNSTI4 0
+ASGNI4
+ADDRLP4 160
+ADDRLP4 1480
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 160
+INDIRI4
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 164
+INDIRI4
+ADDRGP4 ui_numSpecialSinglePlayerArenas
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1480
+INDIRI4
+ASGNI4
+ADDRGP4 $152
+JUMPV
+LABELV $149
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $137
+ARGP4
+ADDRLP4 1484
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1484
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $153
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $142
+ARGP4
+ADDRLP4 1488
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 1488
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $155
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $143
+ARGP4
+ADDRLP4 1492
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 148
+ADDRLP4 1492
+INDIRP4
+ASGNP4
+ADDRLP4 148
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $157
+ADDRGP4 $132
+ARGP4
+ADDRLP4 1496
+ADDRLP4 164
+INDIRI4
+ASGNI4
+ADDRLP4 164
+ADDRLP4 1496
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1496
+INDIRI4
+ARGI4
+ADDRLP4 1500
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $131
+ARGP4
+ADDRLP4 1500
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $150
+JUMPV
+LABELV $157
+ADDRGP4 $132
+ARGP4
+ADDRLP4 1496
+ADDRLP4 160
+INDIRI4
+ASGNI4
+ADDRLP4 160
+ADDRLP4 1496
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1496
+INDIRI4
+ARGI4
+ADDRLP4 1500
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $131
+ARGP4
+ADDRLP4 1500
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $150
+JUMPV
+LABELV $155
+LABELV $153
+ADDRGP4 $132
+ARGP4
+ADDRLP4 1488
+ADDRLP4 156
+INDIRI4
+ASGNI4
+ADDRLP4 156
+ADDRLP4 1488
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 1488
+INDIRI4
+ARGI4
+ADDRLP4 1492
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $131
+ARGP4
+ADDRLP4 1492
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $150
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $152
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $149
+LABELV $108
+endproc UI_LoadArenas 1504 16
+export UI_GetArenaInfoByNumber
+proc UI_GetArenaInfoByNumber 24 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $162
+ADDRFP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $160
+LABELV $162
+ADDRGP4 $163
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $159
+JUMPV
+LABELV $160
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $167
+JUMPV
+LABELV $164
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $131
+ARGP4
+ADDRLP4 12
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $168
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $168
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $159
+JUMPV
+LABELV $168
+LABELV $165
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $167
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $164
+CNSTP4 0
+RETP4
+LABELV $159
+endproc UI_GetArenaInfoByNumber 24 8
+export UI_GetArenaInfoByMap
+proc UI_GetArenaInfoByMap 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $174
+JUMPV
+LABELV $171
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $177
+ARGP4
+ADDRLP4 4
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $175
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $170
+JUMPV
+LABELV $175
+LABELV $172
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $174
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $171
+CNSTP4 0
+RETP4
+LABELV $170
+endproc UI_GetArenaInfoByMap 12 8
+export UI_GetSpecialArenaInfo
+proc UI_GetSpecialArenaInfo 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $182
+JUMPV
+LABELV $179
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $143
+ARGP4
+ADDRLP4 4
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $183
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_arenaInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $178
+JUMPV
+LABELV $183
+LABELV $180
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $182
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LTI4 $179
+CNSTP4 0
+RETP4
+LABELV $178
+endproc UI_GetSpecialArenaInfo 12 8
+proc UI_LoadBotsFromFile 8216 16
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8200
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8200
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $186
+ADDRGP4 $104
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $185
+JUMPV
+LABELV $186
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+LTI4 $188
+ADDRGP4 $107
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 8192
+ARGI4
+ADDRLP4 8204
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8204
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRGP4 $185
+JUMPV
+LABELV $188
+ADDRLP4 8
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRLP4 8204
+ADDRGP4 ui_numBots
+ASGNP4
+ADDRLP4 8208
+ADDRLP4 8204
+INDIRP4
+INDIRI4
+ASGNI4
+CNSTI4 1024
+ADDRLP4 8208
+INDIRI4
+SUBI4
+ARGI4
+ADDRLP4 8208
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_botInfos
+ADDP4
+ARGP4
+ADDRLP4 8212
+ADDRGP4 UI_ParseInfos
+CALLI4
+ASGNI4
+ADDRLP4 8204
+INDIRP4
+ADDRLP4 8208
+INDIRI4
+ADDRLP4 8212
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 outOfMemory
+INDIRI4
+CNSTI4 0
+EQI4 $190
+ADDRGP4 $192
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $190
+LABELV $185
+endproc UI_LoadBotsFromFile 8216 16
+proc UI_LoadBots 1452 16
+ADDRGP4 ui_numBots
+CNSTI4 0
+ASGNI4
+ADDRLP4 144
+ARGP4
+ADDRGP4 $194
+ARGP4
+ADDRGP4 $110
+ARGP4
+CNSTI4 80
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+ADDRLP4 144+16
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $195
+ADDRLP4 144+16
+ARGP4
+ADDRGP4 UI_LoadBotsFromFile
+CALLV
+pop
+ADDRGP4 $196
+JUMPV
+LABELV $195
+ADDRGP4 $199
+ARGP4
+ADDRGP4 UI_LoadBotsFromFile
+CALLV
+pop
+LABELV $196
+ADDRGP4 $116
+ARGP4
+ADDRGP4 $200
+ARGP4
+ADDRLP4 416
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRLP4 1440
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 140
+ADDRLP4 1440
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 416
+ASGNP4
+ADDRLP4 132
+CNSTI4 0
+ASGNI4
+ADDRGP4 $204
+JUMPV
+LABELV $201
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 1444
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 136
+ADDRLP4 1444
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $122
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 UI_LoadBotsFromFile
+CALLV
+pop
+LABELV $202
+ADDRLP4 1444
+CNSTI4 1
+ASGNI4
+ADDRLP4 132
+ADDRLP4 132
+INDIRI4
+ADDRLP4 1444
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 136
+INDIRI4
+ADDRLP4 1444
+INDIRI4
+ADDI4
+ADDRLP4 0
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $204
+ADDRLP4 132
+INDIRI4
+ADDRLP4 140
+INDIRI4
+LTI4 $201
+ADDRGP4 $205
+ARGP4
+ADDRGP4 ui_numBots
+INDIRI4
+ARGI4
+ADDRLP4 1448
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1448
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $193
+endproc UI_LoadBots 1452 16
+export UI_GetBotInfoByNumber
+proc UI_GetBotInfoByNumber 8 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $209
+ADDRFP4 0
+INDIRI4
+ADDRGP4 ui_numBots
+INDIRI4
+LTI4 $207
+LABELV $209
+ADDRGP4 $210
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+CNSTP4 0
+RETP4
+ADDRGP4 $206
+JUMPV
+LABELV $207
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_botInfos
+ADDP4
+INDIRP4
+RETP4
+LABELV $206
+endproc UI_GetBotInfoByNumber 8 8
+export UI_GetBotInfoByName
+proc UI_GetBotInfoByName 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $215
+JUMPV
+LABELV $212
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_botInfos
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 $216
+ARGP4
+ADDRLP4 8
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $217
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_botInfos
+ADDP4
+INDIRP4
+RETP4
+ADDRGP4 $211
+JUMPV
+LABELV $217
+LABELV $213
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $215
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numBots
+INDIRI4
+LTI4 $212
+CNSTP4 0
+RETP4
+LABELV $211
+endproc UI_GetBotInfoByName 16 8
+export UI_GetBestScore
+proc UI_GetBestScore 1088 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1056
+CNSTU4 0
+ASGNU4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 1056
+INDIRU4
+EQU4 $222
+ADDRFP4 8
+INDIRP4
+CVPU4 4
+ADDRLP4 1056
+INDIRU4
+NEU4 $220
+LABELV $222
+ADDRGP4 $219
+JUMPV
+LABELV $220
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $225
+ADDRFP4 0
+INDIRI4
+ADDRGP4 ui_numArenas
+INDIRI4
+LEI4 $223
+LABELV $225
+ADDRGP4 $219
+JUMPV
+LABELV $223
+ADDRLP4 1064
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 1064
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $226
+ADDRGP4 $230
+ARGP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1068
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1068
+INDIRP4
+ARGP4
+ADDRLP4 28
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $231
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 28
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1072
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1072
+INDIRP4
+ARGP4
+ADDRLP4 1076
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1076
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $234
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+LEI4 $232
+LABELV $234
+ADDRGP4 $227
+JUMPV
+LABELV $232
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+EQI4 $237
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $235
+LABELV $237
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 1052
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $235
+LABELV $227
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5
+LEI4 $226
+ADDRFP4 4
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRLP4 1052
+INDIRI4
+ASGNI4
+LABELV $219
+endproc UI_GetBestScore 1088 16
+export UI_SetBestScore
+proc UI_SetBestScore 1084 16
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+LTI4 $241
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+LEI4 $239
+LABELV $241
+ADDRGP4 $238
+JUMPV
+LABELV $239
+ADDRGP4 $242
+ARGP4
+ADDRLP4 1052
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 1052
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $245
+ADDRLP4 0
+INDIRI4
+CNSTI4 5
+LEI4 $243
+LABELV $245
+ADDRGP4 $238
+JUMPV
+LABELV $243
+ADDRGP4 $230
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1060
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1060
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $231
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+ARGP4
+ADDRLP4 1068
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+ADDRLP4 1068
+INDIRI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $246
+ADDRLP4 1044
+INDIRI4
+ADDRFP4 4
+INDIRI4
+GTI4 $246
+ADDRGP4 $238
+JUMPV
+LABELV $246
+ADDRGP4 $132
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 1076
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1076
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $230
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1080
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1080
+INDIRP4
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $238
+endproc UI_SetBestScore 1084 16
+export UI_LogAwardData
+proc UI_LogAwardData 1056 16
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $249
+ADDRGP4 $248
+JUMPV
+LABELV $249
+ADDRFP4 0
+INDIRI4
+CNSTI4 5
+LEI4 $251
+ADDRGP4 $253
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 1044
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 $248
+JUMPV
+LABELV $251
+ADDRGP4 $254
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $255
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1044
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1040
+ADDRLP4 1048
+INDIRI4
+ASGNI4
+ADDRGP4 $132
+ARGP4
+ADDRLP4 1040
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 1052
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $254
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $248
+endproc UI_LogAwardData 1056 16
+export UI_GetAwardLevel
+proc UI_GetAwardLevel 1048 16
+ADDRGP4 $254
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $255
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+RETI4
+LABELV $256
+endproc UI_GetAwardLevel 1048 16
+export UI_TierCompleted
+proc UI_TierCompleted 60 12
+ADDRLP4 16
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+DIVI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 28
+ADDRGP4 UI_GetNumSPTiers
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 28
+INDIRI4
+NEI4 $258
+ADDRGP4 $260
+ARGP4
+ADDRLP4 32
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRGP4 $131
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 40
+INDIRI4
+NEI4 $261
+CNSTI4 0
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $261
+ADDRGP4 $263
+ARGP4
+ADDRLP4 44
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 44
+INDIRP4
+ASGNP4
+ADDRLP4 48
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $266
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRGP4 $131
+ARGP4
+ADDRLP4 52
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ARGP4
+ADDRLP4 56
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEI4 $264
+LABELV $266
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $264
+CNSTI4 -1
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $258
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $267
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 UI_GetBestScore
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+EQI4 $271
+CNSTI4 -1
+RETI4
+ADDRGP4 $257
+JUMPV
+LABELV $271
+LABELV $268
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LTI4 $267
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+RETI4
+LABELV $257
+endproc UI_TierCompleted 60 12
+export UI_ShowTierVideo
+proc UI_ShowTierVideo 1052 16
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GTI4 $274
+CNSTI4 0
+RETI4
+ADDRGP4 $273
+JUMPV
+LABELV $274
+ADDRGP4 $276
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 1024
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $277
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $278
+CNSTI4 0
+RETI4
+ADDRGP4 $273
+JUMPV
+LABELV $278
+ADDRGP4 $132
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 1048
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1024
+ARGP4
+ADDRLP4 1048
+INDIRP4
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRGP4 $276
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+CNSTI4 1
+RETI4
+LABELV $273
+endproc UI_ShowTierVideo 1052 16
+export UI_CanShowTierVideo
+proc UI_CanShowTierVideo 1048 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $281
+CNSTI4 0
+RETI4
+ADDRGP4 $280
+JUMPV
+LABELV $281
+ADDRGP4 uis+11444
+INDIRI4
+CNSTI4 0
+EQI4 $283
+ADDRFP4 0
+INDIRI4
+CNSTI4 8
+EQI4 $283
+CNSTI4 0
+RETI4
+ADDRGP4 $280
+JUMPV
+LABELV $283
+ADDRGP4 $276
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $277
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 1040
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1040
+INDIRP4
+ARGP4
+ADDRLP4 1044
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $286
+CNSTI4 1
+RETI4
+ADDRGP4 $280
+JUMPV
+LABELV $286
+CNSTI4 0
+RETI4
+LABELV $280
+endproc UI_CanShowTierVideo 1048 16
+export UI_GetCurrentGame
+proc UI_GetCurrentGame 32 12
+ADDRGP4 $260
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $289
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $131
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 UI_GetBestScore
+CALLV
+pop
+ADDRLP4 28
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $293
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+LEI4 $291
+LABELV $293
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $291
+LABELV $289
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $297
+JUMPV
+LABELV $294
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 UI_GetBestScore
+CALLV
+pop
+ADDRLP4 20
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $300
+ADDRLP4 20
+INDIRI4
+CNSTI4 1
+LEI4 $298
+LABELV $300
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $298
+LABELV $295
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $297
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+LTI4 $294
+ADDRGP4 $263
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $301
+CNSTI4 -1
+RETI4
+ADDRGP4 $288
+JUMPV
+LABELV $301
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $131
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+RETI4
+LABELV $288
+endproc UI_GetCurrentGame 32 12
+export UI_NewGame
+proc UI_NewGame 0 8
+ADDRGP4 $304
+ARGP4
+ADDRGP4 $110
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $305
+ARGP4
+ADDRGP4 $110
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $306
+ARGP4
+ADDRGP4 $110
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $307
+ARGP4
+ADDRGP4 $110
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $308
+ARGP4
+ADDRGP4 $110
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $254
+ARGP4
+ADDRGP4 $110
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $276
+ARGP4
+ADDRGP4 $110
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $303
+endproc UI_NewGame 0 8
+export UI_GetNumArenas
+proc UI_GetNumArenas 0 0
+ADDRGP4 ui_numArenas
+INDIRI4
+RETI4
+LABELV $309
+endproc UI_GetNumArenas 0 0
+export UI_GetNumSPArenas
+proc UI_GetNumSPArenas 0 0
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+RETI4
+LABELV $310
+endproc UI_GetNumSPArenas 0 0
+export UI_GetNumSPTiers
+proc UI_GetNumSPTiers 0 0
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+CNSTI4 4
+DIVI4
+RETI4
+LABELV $311
+endproc UI_GetNumSPTiers 0 0
+export UI_GetNumBots
+proc UI_GetNumBots 0 0
+ADDRGP4 ui_numBots
+INDIRI4
+RETI4
+LABELV $312
+endproc UI_GetNumBots 0 0
+export UI_SPUnlock_f
+proc UI_SPUnlock_f 1048 16
+ADDRGP4 $304
+ARGP4
+ADDRLP4 24
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $317
+JUMPV
+LABELV $314
+ADDRLP4 8
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $231
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRGP4 $318
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $315
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $317
+ADDRLP4 0
+INDIRI4
+ADDRGP4 ui_numSinglePlayerArenas
+INDIRI4
+ADDRGP4 ui_numSpecialSinglePlayerArenas
+INDIRI4
+ADDI4
+LTI4 $314
+ADDRGP4 $304
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $319
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ShowTierVideo
+CALLI4
+pop
+LABELV $320
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LEI4 $319
+ADDRGP4 $323
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+ADDRGP4 UI_SPLevelMenu_ReInit
+CALLV
+pop
+LABELV $313
+endproc UI_SPUnlock_f 1048 16
+export UI_SPUnlockMedals_f
+proc UI_SPUnlockMedals_f 1044 16
+ADDRGP4 $254
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $325
+ADDRLP4 4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 $255
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 20
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 $329
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+LABELV $326
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $325
+ADDRGP4 $254
+ARGP4
+ADDRLP4 20
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $330
+ARGP4
+ADDRGP4 trap_Print
+CALLV
+pop
+LABELV $324
+endproc UI_SPUnlockMedals_f 1044 16
+export UI_InitGameinfo
+proc UI_InitGameinfo 0 0
+ADDRGP4 UI_InitMemory
+CALLV
+pop
+ADDRGP4 UI_LoadArenas
+CALLV
+pop
+ADDRGP4 UI_LoadBots
+CALLV
+pop
+ADDRGP4 uis+11444
+CNSTI4 0
+ASGNI4
+LABELV $331
+endproc UI_InitGameinfo 0 0
+bss
+align 4
+LABELV outOfMemory
+skip 4
+align 4
+LABELV allocPoint
+skip 4
+align 1
+LABELV memoryPool
+skip 131072
+align 4
+LABELV ui_numSpecialSinglePlayerArenas
+skip 4
+align 4
+LABELV ui_numSinglePlayerArenas
+skip 4
+align 4
+LABELV ui_arenaInfos
+skip 4096
+align 4
+LABELV ui_numArenas
+skip 4
+align 4
+LABELV ui_botInfos
+skip 4096
+export ui_numBots
+align 4
+LABELV ui_numBots
+skip 4
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $330
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 10
+byte 1 0
+align 1
+LABELV $329
+byte 1 49
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $323
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 116
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 49
+byte 1 10
+byte 1 0
+align 1
+LABELV $318
+byte 1 49
+byte 1 0
+align 1
+LABELV $308
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 53
+byte 1 0
+align 1
+LABELV $307
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 52
+byte 1 0
+align 1
+LABELV $306
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 51
+byte 1 0
+align 1
+LABELV $305
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $304
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $277
+byte 1 116
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $276
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 86
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $263
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $260
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $255
+byte 1 97
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $254
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $253
+byte 1 94
+byte 1 49
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 85
+byte 1 73
+byte 1 95
+byte 1 76
+byte 1 111
+byte 1 103
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 68
+byte 1 97
+byte 1 116
+byte 1 97
+byte 1 10
+byte 1 0
+align 1
+LABELV $242
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $231
+byte 1 108
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $230
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $216
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $210
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $205
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $200
+byte 1 46
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $199
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $194
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $192
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $177
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $163
+byte 1 94
+byte 1 49
+byte 1 73
+byte 1 110
+byte 1 118
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $148
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 103
+byte 1 110
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 99
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 100
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 121
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $143
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $142
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $137
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $132
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $131
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $126
+byte 1 94
+byte 1 51
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 109
+byte 1 101
+byte 1 109
+byte 1 111
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 112
+byte 1 111
+byte 1 111
+byte 1 108
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $123
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $122
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $117
+byte 1 46
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $116
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $115
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 120
+byte 1 116
+byte 1 0
+align 1
+LABELV $110
+byte 1 0
+align 1
+LABELV $109
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $107
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 44
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $104
+byte 1 94
+byte 1 49
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 102
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $98
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $97
+byte 1 92
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 92
+byte 1 0
+align 1
+LABELV $96
+byte 1 60
+byte 1 78
+byte 1 85
+byte 1 76
+byte 1 76
+byte 1 62
+byte 1 0
+align 1
+LABELV $93
+byte 1 125
+byte 1 0
+align 1
+LABELV $90
+byte 1 85
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $84
+byte 1 77
+byte 1 97
+byte 1 120
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 115
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 101
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 10
+byte 1 0
+align 1
+LABELV $81
+byte 1 77
+byte 1 105
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 123
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 105
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 10
+byte 1 0
+align 1
+LABELV $80
+byte 1 123
+byte 1 0
@@ -0,0 +1,1844 @@
+export vmMain
+code
+proc vmMain 12 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $69
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+GTI4 $69
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $82
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $82
+address $71
+address $72
+address $73
+address $74
+address $75
+address $76
+address $77
+address $78
+address $79
+address $80
+address $81
+code
+LABELV $71
+CNSTI4 4
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $72
+ADDRGP4 UI_Init
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $73
+ADDRGP4 UI_Shutdown
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $74
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_KeyEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $75
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_MouseEvent
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $76
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_Refresh
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $77
+ADDRLP4 4
+ADDRGP4 UI_IsFullscreen
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $78
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_SetActiveMenu
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $79
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_ConsoleCommand
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $80
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawConnectScreen
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $81
+CNSTI4 1
+RETI4
+ADDRGP4 $68
+JUMPV
+LABELV $69
+CNSTI4 -1
+RETI4
+LABELV $68
+endproc vmMain 12 8
+data
+align 4
+LABELV cvarTable
+address ui_ffa_fraglimit
+address $84
+address $85
+byte 4 1
+address ui_ffa_timelimit
+address $86
+address $87
+byte 4 1
+address ui_tourney_fraglimit
+address $88
+address $87
+byte 4 1
+address ui_tourney_timelimit
+address $89
+address $90
+byte 4 1
+address ui_team_fraglimit
+address $91
+address $87
+byte 4 1
+address ui_team_timelimit
+address $92
+address $85
+byte 4 1
+address ui_team_friendly
+address $93
+address $94
+byte 4 1
+address ui_ctf_capturelimit
+address $95
+address $96
+byte 4 1
+address ui_ctf_timelimit
+address $97
+address $98
+byte 4 1
+address ui_ctf_friendly
+address $99
+address $87
+byte 4 1
+address ui_arenasFile
+address $100
+address $101
+byte 4 80
+address ui_botsFile
+address $102
+address $101
+byte 4 80
+address ui_spScores1
+address $103
+address $101
+byte 4 65
+address ui_spScores2
+address $104
+address $101
+byte 4 65
+address ui_spScores3
+address $105
+address $101
+byte 4 65
+address ui_spScores4
+address $106
+address $101
+byte 4 65
+address ui_spScores5
+address $107
+address $101
+byte 4 65
+address ui_spAwards
+address $108
+address $101
+byte 4 65
+address ui_spVideos
+address $109
+address $101
+byte 4 65
+address ui_spSkill
+address $110
+address $111
+byte 4 33
+address ui_spSelection
+address $112
+address $101
+byte 4 64
+address ui_browserMaster
+address $113
+address $87
+byte 4 1
+address ui_browserGameType
+address $114
+address $87
+byte 4 1
+address ui_browserSortKey
+address $115
+address $116
+byte 4 1
+address ui_browserShowFull
+address $117
+address $94
+byte 4 1
+address ui_browserShowEmpty
+address $118
+address $94
+byte 4 1
+address ui_brassTime
+address $119
+address $120
+byte 4 1
+address ui_drawCrosshair
+address $121
+address $116
+byte 4 1
+address ui_drawCrosshairNames
+address $122
+address $94
+byte 4 1
+address ui_marks
+address $123
+address $94
+byte 4 1
+address ui_server1
+address $124
+address $101
+byte 4 1
+address ui_server2
+address $125
+address $101
+byte 4 1
+address ui_server3
+address $126
+address $101
+byte 4 1
+address ui_server4
+address $127
+address $101
+byte 4 1
+address ui_server5
+address $128
+address $101
+byte 4 1
+address ui_server6
+address $129
+address $101
+byte 4 1
+address ui_server7
+address $130
+address $101
+byte 4 1
+address ui_server8
+address $131
+address $101
+byte 4 1
+address ui_server9
+address $132
+address $101
+byte 4 1
+address ui_server10
+address $133
+address $101
+byte 4 1
+address ui_server11
+address $134
+address $101
+byte 4 1
+address ui_server12
+address $135
+address $101
+byte 4 1
+address ui_server13
+address $136
+address $101
+byte 4 1
+address ui_server14
+address $137
+address $101
+byte 4 1
+address ui_server15
+address $138
+address $101
+byte 4 1
+address ui_server16
+address $139
+address $101
+byte 4 1
+address ui_cdkeychecked
+address $140
+address $87
+byte 4 64
+address ui_ioq3
+address $141
+address $94
+byte 4 64
+align 4
+LABELV cvarTableSize
+byte 4 48
+export UI_RegisterCvars
+code
+proc UI_RegisterCvars 12 16
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $146
+JUMPV
+LABELV $143
+ADDRLP4 0
+INDIRP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $144
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $146
+ADDRLP4 4
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $143
+LABELV $142
+endproc UI_RegisterCvars 12 16
+export UI_UpdateCvars
+proc UI_UpdateCvars 8 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 cvarTable
+ASGNP4
+ADDRGP4 $151
+JUMPV
+LABELV $148
+ADDRLP4 4
+INDIRP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cvar_Update
+CALLV
+pop
+LABELV $149
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+ASGNP4
+LABELV $151
+ADDRLP4 0
+INDIRI4
+ADDRGP4 cvarTableSize
+INDIRI4
+LTI4 $148
+LABELV $147
+endproc UI_UpdateCvars 8 4
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+bss
+export ui_ioq3
+align 4
+LABELV ui_ioq3
+skip 272
+export ui_cdkeychecked
+align 4
+LABELV ui_cdkeychecked
+skip 272
+import ui_cdkey
+export ui_server16
+align 4
+LABELV ui_server16
+skip 272
+export ui_server15
+align 4
+LABELV ui_server15
+skip 272
+export ui_server14
+align 4
+LABELV ui_server14
+skip 272
+export ui_server13
+align 4
+LABELV ui_server13
+skip 272
+export ui_server12
+align 4
+LABELV ui_server12
+skip 272
+export ui_server11
+align 4
+LABELV ui_server11
+skip 272
+export ui_server10
+align 4
+LABELV ui_server10
+skip 272
+export ui_server9
+align 4
+LABELV ui_server9
+skip 272
+export ui_server8
+align 4
+LABELV ui_server8
+skip 272
+export ui_server7
+align 4
+LABELV ui_server7
+skip 272
+export ui_server6
+align 4
+LABELV ui_server6
+skip 272
+export ui_server5
+align 4
+LABELV ui_server5
+skip 272
+export ui_server4
+align 4
+LABELV ui_server4
+skip 272
+export ui_server3
+align 4
+LABELV ui_server3
+skip 272
+export ui_server2
+align 4
+LABELV ui_server2
+skip 272
+export ui_server1
+align 4
+LABELV ui_server1
+skip 272
+export ui_marks
+align 4
+LABELV ui_marks
+skip 272
+export ui_drawCrosshairNames
+align 4
+LABELV ui_drawCrosshairNames
+skip 272
+export ui_drawCrosshair
+align 4
+LABELV ui_drawCrosshair
+skip 272
+export ui_brassTime
+align 4
+LABELV ui_brassTime
+skip 272
+export ui_browserShowEmpty
+align 4
+LABELV ui_browserShowEmpty
+skip 272
+export ui_browserShowFull
+align 4
+LABELV ui_browserShowFull
+skip 272
+export ui_browserSortKey
+align 4
+LABELV ui_browserSortKey
+skip 272
+export ui_browserGameType
+align 4
+LABELV ui_browserGameType
+skip 272
+export ui_browserMaster
+align 4
+LABELV ui_browserMaster
+skip 272
+export ui_spSelection
+align 4
+LABELV ui_spSelection
+skip 272
+export ui_spSkill
+align 4
+LABELV ui_spSkill
+skip 272
+export ui_spVideos
+align 4
+LABELV ui_spVideos
+skip 272
+export ui_spAwards
+align 4
+LABELV ui_spAwards
+skip 272
+export ui_spScores5
+align 4
+LABELV ui_spScores5
+skip 272
+export ui_spScores4
+align 4
+LABELV ui_spScores4
+skip 272
+export ui_spScores3
+align 4
+LABELV ui_spScores3
+skip 272
+export ui_spScores2
+align 4
+LABELV ui_spScores2
+skip 272
+export ui_spScores1
+align 4
+LABELV ui_spScores1
+skip 272
+export ui_botsFile
+align 4
+LABELV ui_botsFile
+skip 272
+export ui_arenasFile
+align 4
+LABELV ui_arenasFile
+skip 272
+export ui_ctf_friendly
+align 4
+LABELV ui_ctf_friendly
+skip 272
+export ui_ctf_timelimit
+align 4
+LABELV ui_ctf_timelimit
+skip 272
+export ui_ctf_capturelimit
+align 4
+LABELV ui_ctf_capturelimit
+skip 272
+export ui_team_friendly
+align 4
+LABELV ui_team_friendly
+skip 272
+export ui_team_timelimit
+align 4
+LABELV ui_team_timelimit
+skip 272
+export ui_team_fraglimit
+align 4
+LABELV ui_team_fraglimit
+skip 272
+export ui_tourney_timelimit
+align 4
+LABELV ui_tourney_timelimit
+skip 272
+export ui_tourney_fraglimit
+align 4
+LABELV ui_tourney_fraglimit
+skip 272
+export ui_ffa_timelimit
+align 4
+LABELV ui_ffa_timelimit
+skip 272
+export ui_ffa_fraglimit
+align 4
+LABELV ui_ffa_fraglimit
+skip 272
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $141
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 105
+byte 1 111
+byte 1 113
+byte 1 51
+byte 1 0
+align 1
+LABELV $140
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 100
+byte 1 107
+byte 1 101
+byte 1 121
+byte 1 99
+byte 1 104
+byte 1 101
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $139
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 54
+byte 1 0
+align 1
+LABELV $138
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $137
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 52
+byte 1 0
+align 1
+LABELV $136
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 51
+byte 1 0
+align 1
+LABELV $135
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 50
+byte 1 0
+align 1
+LABELV $134
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 49
+byte 1 0
+align 1
+LABELV $133
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 48
+byte 1 0
+align 1
+LABELV $132
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 57
+byte 1 0
+align 1
+LABELV $131
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 56
+byte 1 0
+align 1
+LABELV $130
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 55
+byte 1 0
+align 1
+LABELV $129
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 54
+byte 1 0
+align 1
+LABELV $128
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 53
+byte 1 0
+align 1
+LABELV $127
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 52
+byte 1 0
+align 1
+LABELV $126
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 51
+byte 1 0
+align 1
+LABELV $125
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $124
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $123
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 107
+byte 1 115
+byte 1 0
+align 1
+LABELV $122
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $121
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 100
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 67
+byte 1 114
+byte 1 111
+byte 1 115
+byte 1 115
+byte 1 104
+byte 1 97
+byte 1 105
+byte 1 114
+byte 1 0
+align 1
+LABELV $120
+byte 1 50
+byte 1 53
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $119
+byte 1 99
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 97
+byte 1 115
+byte 1 115
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $118
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $117
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $116
+byte 1 52
+byte 1 0
+align 1
+LABELV $115
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $114
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $113
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $112
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $111
+byte 1 50
+byte 1 0
+align 1
+LABELV $110
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $109
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 86
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 115
+byte 1 0
+align 1
+LABELV $108
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 65
+byte 1 119
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 115
+byte 1 0
+align 1
+LABELV $107
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 53
+byte 1 0
+align 1
+LABELV $106
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 52
+byte 1 0
+align 1
+LABELV $105
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 51
+byte 1 0
+align 1
+LABELV $104
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 50
+byte 1 0
+align 1
+LABELV $103
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 49
+byte 1 0
+align 1
+LABELV $102
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $101
+byte 1 0
+align 1
+LABELV $100
+byte 1 103
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 115
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $99
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $98
+byte 1 51
+byte 1 48
+byte 1 0
+align 1
+LABELV $97
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $96
+byte 1 56
+byte 1 0
+align 1
+LABELV $95
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $94
+byte 1 49
+byte 1 0
+align 1
+LABELV $93
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $92
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $91
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $90
+byte 1 49
+byte 1 53
+byte 1 0
+align 1
+LABELV $89
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $88
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $87
+byte 1 48
+byte 1 0
+align 1
+LABELV $86
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $85
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $84
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
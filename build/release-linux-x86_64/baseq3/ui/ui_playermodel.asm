@@ -0,0 +1,3432 @@
+data
+align 4
+LABELV playermodel_artlist
+address $68
+address $69
+address $70
+address $71
+address $72
+address $73
+address $74
+address $75
+address $76
+address $77
+byte 4 0
+code
+proc PlayerModel_UpdateGrid 28 0
+ADDRLP4 4
+ADDRGP4 s_playermodel+37976
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $81
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_playermodel+5204
+INDIRI4
+GEI4 $85
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+288+4
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 s_playermodel+5208
+ADDP4
+ASGNP4
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTI4 -16385
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRGP4 $86
+JUMPV
+LABELV $85
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+288+4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $86
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+288+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTI4 -65
+CVIU4 4
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+288+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+LABELV $82
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $81
+ADDRGP4 s_playermodel+38048
+INDIRI4
+CNSTI4 16
+DIVI4
+ADDRGP4 s_playermodel+37976
+INDIRI4
+NEI4 $103
+ADDRLP4 0
+ADDRGP4 s_playermodel+38048
+INDIRI4
+CNSTI4 16
+MODI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+288+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 16
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+44
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTI4 -257
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $103
+ADDRGP4 s_playermodel+37980
+INDIRI4
+CNSTI4 1
+LEI4 $112
+ADDRGP4 s_playermodel+37976
+INDIRI4
+CNSTI4 0
+LEI4 $115
+ADDRLP4 12
+ADDRGP4 s_playermodel+3704+44
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTI4 -16385
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRGP4 $116
+JUMPV
+LABELV $115
+ADDRLP4 16
+ADDRGP4 s_playermodel+3704+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $116
+ADDRGP4 s_playermodel+37976
+INDIRI4
+ADDRGP4 s_playermodel+37980
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $122
+ADDRLP4 20
+ADDRGP4 s_playermodel+3792+44
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTI4 -16385
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRGP4 $113
+JUMPV
+LABELV $122
+ADDRLP4 24
+ADDRGP4 s_playermodel+3792+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 $113
+JUMPV
+LABELV $112
+ADDRLP4 12
+ADDRGP4 s_playermodel+3704+44
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 16
+ADDRGP4 s_playermodel+3792+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $113
+LABELV $79
+endproc PlayerModel_UpdateGrid 28 0
+proc PlayerModel_UpdateModel 32 28
+ADDRGP4 s_playermodel+4096
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1108
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+4
+CNSTF4 1125515264
+ASGNF4
+ADDRLP4 24
+CNSTF4 0
+ASGNF4
+ADDRLP4 0
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 28
+CNSTF4 0
+ASGNF4
+ADDRLP4 12+8
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 28
+INDIRF4
+ASGNF4
+ADDRGP4 s_playermodel+4096
+ARGP4
+ADDRGP4 s_playermodel+37984
+ARGP4
+ADDRGP4 UI_PlayerInfo_SetModel
+CALLV
+pop
+ADDRGP4 s_playermodel+4096
+ARGP4
+CNSTI4 22
+ARGI4
+CNSTI4 11
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 2
+ARGI4
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetInfo
+CALLV
+pop
+LABELV $134
+endproc PlayerModel_UpdateModel 32 28
+proc PlayerModel_SaveChanges 0 8
+ADDRGP4 $144
+ARGP4
+ADDRGP4 s_playermodel+37984
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $146
+ARGP4
+ADDRGP4 s_playermodel+37984
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $148
+ARGP4
+ADDRGP4 s_playermodel+37984
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $150
+ARGP4
+ADDRGP4 s_playermodel+37984
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $143
+endproc PlayerModel_SaveChanges 0 8
+proc PlayerModel_MenuEvent 12 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $153
+ADDRGP4 $152
+JUMPV
+LABELV $153
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+EQI4 $158
+ADDRLP4 0
+INDIRI4
+CNSTI4 101
+EQI4 $163
+ADDRLP4 0
+INDIRI4
+CNSTI4 102
+EQI4 $169
+ADDRGP4 $155
+JUMPV
+LABELV $158
+ADDRGP4 s_playermodel+37976
+INDIRI4
+CNSTI4 0
+LEI4 $156
+ADDRLP4 8
+ADDRGP4 s_playermodel+37976
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 PlayerModel_UpdateGrid
+CALLV
+pop
+ADDRGP4 $156
+JUMPV
+LABELV $163
+ADDRGP4 s_playermodel+37976
+INDIRI4
+ADDRGP4 s_playermodel+37980
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $156
+ADDRLP4 8
+ADDRGP4 s_playermodel+37976
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 PlayerModel_UpdateGrid
+CALLV
+pop
+ADDRGP4 $156
+JUMPV
+LABELV $169
+ADDRGP4 PlayerModel_SaveChanges
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $155
+LABELV $156
+LABELV $152
+endproc PlayerModel_MenuEvent 12 0
+proc PlayerModel_MenuKey 52 8
+ADDRLP4 8
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 134
+EQI4 $173
+ADDRLP4 12
+CNSTI4 135
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $182
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+GTI4 $196
+LABELV $195
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+EQI4 $194
+ADDRGP4 $171
+JUMPV
+LABELV $196
+ADDRLP4 16
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 163
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+EQI4 $173
+ADDRLP4 16
+INDIRI4
+CNSTI4 165
+EQI4 $182
+ADDRLP4 16
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LTI4 $171
+LABELV $197
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $194
+ADDRGP4 $171
+JUMPV
+LABELV $173
+ADDRGP4 s_playermodel
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+LTI4 $172
+ADDRLP4 28
+INDIRI4
+CNSTI4 15
+GTI4 $172
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LEI4 $176
+ADDRLP4 32
+ADDRGP4 s_playermodel
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRGP4 Menu_SetCursor
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $176
+ADDRGP4 s_playermodel+37976
+INDIRI4
+CNSTI4 0
+LEI4 $178
+ADDRLP4 32
+ADDRGP4 s_playermodel+37976
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 36
+ADDRGP4 s_playermodel
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 15
+ADDI4
+ARGI4
+ADDRGP4 Menu_SetCursor
+CALLV
+pop
+ADDRGP4 PlayerModel_UpdateGrid
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $178
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $182
+ADDRGP4 s_playermodel
+ARGP4
+ADDRLP4 32
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 0
+LTI4 $172
+ADDRLP4 36
+INDIRI4
+CNSTI4 15
+GTI4 $172
+ADDRLP4 40
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 15
+GEI4 $185
+ADDRGP4 s_playermodel+37976
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+CNSTI4 1
+ADDI4
+ADDRGP4 s_playermodel+5204
+INDIRI4
+GEI4 $185
+ADDRLP4 44
+ADDRGP4 s_playermodel
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Menu_SetCursor
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $185
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+NEI4 $189
+ADDRGP4 s_playermodel+37976
+INDIRI4
+ADDRGP4 s_playermodel+37980
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $189
+ADDRLP4 44
+ADDRGP4 s_playermodel+37976
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 s_playermodel
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 15
+SUBI4
+ARGI4
+ADDRGP4 Menu_SetCursor
+CALLV
+pop
+ADDRGP4 PlayerModel_UpdateGrid
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $189
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $170
+JUMPV
+LABELV $194
+ADDRGP4 PlayerModel_SaveChanges
+CALLV
+pop
+LABELV $171
+LABELV $172
+ADDRGP4 s_playermodel
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+LABELV $170
+endproc PlayerModel_MenuKey 52 8
+proc PlayerModel_PicEvent 48 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $199
+ADDRGP4 $198
+JUMPV
+LABELV $199
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $201
+ADDRLP4 20
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+288+44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTI4 -65
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 24
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+44
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+LABELV $202
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $201
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+288+44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 24
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+44
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTI4 -257
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 16
+ADDRGP4 s_playermodel+37976
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 $215
+ARGP4
+ADDRLP4 28
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 s_playermodel+5208
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $216
+ARGP4
+ADDRLP4 32
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $217
+ADDRGP4 s_playermodel+37984
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_playermodel+37984
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 5
+ADDP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 12
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+LEI4 $221
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+LABELV $221
+ADDRGP4 s_playermodel+3880+60
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_playermodel+3880+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+CNSTI4 5
+ADDP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 40
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+LEI4 $227
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+LABELV $227
+ADDRGP4 s_playermodel+3952+60
+INDIRP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 5
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_playermodel+3952+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 s_playermodel+38048
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CNSTI4 5242880
+LEI4 $234
+ADDRGP4 PlayerModel_UpdateModel
+CALLV
+pop
+LABELV $234
+LABELV $217
+LABELV $198
+endproc PlayerModel_PicEvent 48 12
+proc PlayerModel_DrawPlayer 12 24
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 trap_MemoryRemaining
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 5242880
+GTI4 $237
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+ARGI4
+ADDRGP4 $239
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $236
+JUMPV
+LABELV $237
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 s_playermodel+4096
+ARGP4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 2
+DIVI4
+ARGI4
+ADDRGP4 UI_DrawPlayer
+CALLV
+pop
+LABELV $236
+endproc PlayerModel_DrawPlayer 12 24
+proc PlayerModel_BuildList 4244 20
+ADDRGP4 $243
+ARGP4
+ADDRLP4 4196
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 84
+ADDRLP4 4196
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_playermodel+37976
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_playermodel+5204
+CNSTI4 0
+ASGNI4
+ADDRGP4 $246
+ARGP4
+ADDRGP4 $247
+ARGP4
+ADDRLP4 2148
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 4200
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 2144
+ADDRLP4 4200
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 2148
+ASGNP4
+ADDRLP4 92
+CNSTI4 0
+ASGNI4
+ADDRGP4 $251
+JUMPV
+LABELV $248
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 4204
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 4204
+INDIRI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+EQI4 $253
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 76
+INDIRP4
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 47
+NEI4 $253
+ADDRLP4 88
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 76
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $253
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 $257
+ARGP4
+ADDRLP4 4212
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4212
+INDIRI4
+CNSTI4 0
+EQI4 $259
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRGP4 $258
+ARGP4
+ADDRLP4 4216
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 4216
+INDIRI4
+CNSTI4 0
+NEI4 $255
+LABELV $259
+ADDRGP4 $249
+JUMPV
+LABELV $255
+ADDRGP4 $260
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 4220
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4220
+INDIRP4
+ARGP4
+ADDRGP4 $261
+ARGP4
+ADDRLP4 96
+ARGP4
+CNSTI4 2048
+ARGI4
+ADDRLP4 4224
+ADDRGP4 trap_FS_GetFileList
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 4224
+INDIRI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 96
+ASGNP4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $265
+JUMPV
+LABELV $262
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 4228
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 72
+ADDRLP4 4228
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 $216
+ARGP4
+CNSTI4 5
+ARGI4
+ADDRLP4 4232
+ADDRGP4 Q_stricmpn
+CALLI4
+ASGNI4
+ADDRLP4 4232
+INDIRI4
+CNSTI4 0
+NEI4 $267
+ADDRLP4 4240
+ADDRGP4 s_playermodel+5204
+ASGNP4
+ADDRLP4 4236
+ADDRLP4 4240
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4240
+INDIRP4
+ADDRLP4 4236
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4236
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 s_playermodel+5208
+ADDP4
+ARGP4
+CNSTI4 128
+ARGI4
+ADDRGP4 $273
+ARGP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $267
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+EQI4 $274
+ADDRGP4 $276
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 4236
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4236
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+pop
+LABELV $274
+LABELV $263
+ADDRLP4 4228
+CNSTI4 1
+ASGNI4
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+ADDRLP4 4228
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 64
+ADDRLP4 72
+INDIRI4
+ADDRLP4 4228
+INDIRI4
+ADDI4
+ADDRLP4 64
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $265
+ADDRLP4 68
+INDIRI4
+ADDRLP4 80
+INDIRI4
+GEI4 $277
+ADDRGP4 s_playermodel+5204
+INDIRI4
+CNSTI4 256
+LTI4 $262
+LABELV $277
+LABELV $249
+ADDRLP4 4204
+CNSTI4 1
+ASGNI4
+ADDRLP4 92
+ADDRLP4 92
+INDIRI4
+ADDRLP4 4204
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 88
+INDIRI4
+ADDRLP4 4204
+INDIRI4
+ADDI4
+ADDRLP4 76
+INDIRP4
+ADDP4
+ASGNP4
+LABELV $251
+ADDRLP4 92
+INDIRI4
+ADDRLP4 2144
+INDIRI4
+GEI4 $278
+ADDRGP4 s_playermodel+5204
+INDIRI4
+CNSTI4 256
+LTI4 $248
+LABELV $278
+ADDRGP4 s_playermodel+37980
+ADDRGP4 s_playermodel+5204
+INDIRI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRGP4 s_playermodel+5204
+INDIRI4
+CNSTI4 16
+MODI4
+CNSTI4 0
+EQI4 $281
+ADDRLP4 4208
+ADDRGP4 s_playermodel+37980
+ASGNP4
+ADDRLP4 4208
+INDIRP4
+ADDRLP4 4208
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $281
+LABELV $242
+endproc PlayerModel_BuildList 4244 20
+proc PlayerModel_SetMenuItems 96 12
+ADDRGP4 $286
+ARGP4
+ADDRGP4 s_playermodel+4024+60
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 s_playermodel+4024+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRGP4 $144
+ARGP4
+ADDRGP4 s_playermodel+37984
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $295
+JUMPV
+LABELV $292
+ADDRGP4 $215
+ARGP4
+ADDRLP4 80
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 80
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 s_playermodel+5208
+ADDP4
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $216
+ARGP4
+ADDRLP4 84
+ADDRGP4 strstr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $293
+ADDRLP4 16
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 5
+ADDP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $299
+ADDRGP4 s_playermodel+37984
+ARGP4
+ADDRLP4 16
+ARGP4
+ADDRLP4 88
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 88
+INDIRI4
+CNSTI4 0
+NEI4 $300
+ADDRGP4 s_playermodel+38048
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_playermodel+37976
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+SUBU4
+CVUI4 4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+LEI4 $305
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+LABELV $305
+ADDRGP4 s_playermodel+3880+60
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_playermodel+3880+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 5
+ADDP4
+ARGP4
+ADDRLP4 92
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 92
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 16
+LEI4 $311
+ADDRLP4 12
+CNSTI4 16
+ASGNI4
+LABELV $311
+ADDRGP4 s_playermodel+3952+60
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 5
+ADDP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_playermodel+3952+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 $294
+JUMPV
+LABELV $300
+LABELV $293
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $295
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_playermodel+5204
+INDIRI4
+LTI4 $292
+LABELV $294
+LABELV $285
+endproc PlayerModel_SetMenuItems 96 12
+bss
+align 1
+LABELV $318
+skip 32
+align 1
+LABELV $319
+skip 32
+align 1
+LABELV $320
+skip 32
+code
+proc PlayerModel_MenuInit 28 12
+ADDRGP4 s_playermodel
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 38052
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 PlayerModel_Cache
+CALLV
+pop
+ADDRGP4 s_playermodel+272
+ADDRGP4 PlayerModel_MenuKey
+ASGNP4
+ADDRGP4 s_playermodel+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_playermodel+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_playermodel+3368
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_playermodel+3368+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_playermodel+3368+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_playermodel+3368+60
+ADDRGP4 $331
+ASGNP4
+ADDRGP4 s_playermodel+3368+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_playermodel+3368+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_playermodel+3104
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playermodel+3104+4
+ADDRGP4 $72
+ASGNP4
+ADDRGP4 s_playermodel+3104+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_playermodel+3104+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_playermodel+3104+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_playermodel+3104+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_playermodel+3104+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_playermodel+3192
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playermodel+3192+4
+ADDRGP4 $73
+ASGNP4
+ADDRGP4 s_playermodel+3192+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_playermodel+3192+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_playermodel+3192+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_playermodel+3192+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_playermodel+3192+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_playermodel+3280
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playermodel+3280+4
+ADDRGP4 $74
+ASGNP4
+ADDRGP4 s_playermodel+3280+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_playermodel+3280+12
+CNSTI4 50
+ASGNI4
+ADDRGP4 s_playermodel+3280+16
+CNSTI4 59
+ASGNI4
+ADDRGP4 s_playermodel+3280+76
+CNSTI4 274
+ASGNI4
+ADDRGP4 s_playermodel+3280+80
+CNSTI4 274
+ASGNI4
+ADDRLP4 8
+CNSTI4 59
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $378
+JUMPV
+LABELV $375
+ADDRLP4 4
+CNSTI4 50
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $379
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+288
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+288+44
+ADDP4
+CNSTU4 16388
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+288+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+288+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+288+76
+ADDP4
+CNSTI4 64
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+288+80
+ADDP4
+CNSTI4 64
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+288+60
+ADDP4
+ADDRGP4 $71
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+288+84
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+44
+ADDP4
+CNSTU4 33028
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+48
+ADDP4
+ADDRGP4 PlayerModel_PicEvent
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+24
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+28
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+32
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+76
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+80
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+60
+ADDP4
+ADDRGP4 $70
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696+84
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 70
+ADDI4
+ASGNI4
+LABELV $380
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LTI4 $379
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 70
+ADDI4
+ASGNI4
+LABELV $376
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $378
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LTI4 $375
+ADDRGP4 s_playermodel+4024
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_playermodel+4024+44
+CNSTU4 16392
+ASGNU4
+ADDRGP4 s_playermodel+4024+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_playermodel+4024+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_playermodel+4024+60
+ADDRGP4 $318
+ASGNP4
+ADDRGP4 s_playermodel+4024+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_playermodel+4024+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 s_playermodel+3880
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_playermodel+3880+44
+CNSTU4 16392
+ASGNU4
+ADDRGP4 s_playermodel+3880+12
+CNSTI4 497
+ASGNI4
+ADDRGP4 s_playermodel+3880+16
+CNSTI4 54
+ASGNI4
+ADDRGP4 s_playermodel+3880+60
+ADDRGP4 $319
+ASGNP4
+ADDRGP4 s_playermodel+3880+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_playermodel+3880+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 s_playermodel+3952
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_playermodel+3952+44
+CNSTU4 16392
+ASGNU4
+ADDRGP4 s_playermodel+3952+12
+CNSTI4 497
+ASGNI4
+ADDRGP4 s_playermodel+3952+16
+CNSTI4 394
+ASGNI4
+ADDRGP4 s_playermodel+3952+60
+ADDRGP4 $320
+ASGNP4
+ADDRGP4 s_playermodel+3952+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_playermodel+3952+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 s_playermodel+3528
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playermodel+3528+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_playermodel+3528+56
+ADDRGP4 PlayerModel_DrawPlayer
+ASGNP4
+ADDRGP4 s_playermodel+3528+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_playermodel+3528+16
+CNSTI4 -40
+ASGNI4
+ADDRGP4 s_playermodel+3528+76
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_playermodel+3528+80
+CNSTI4 560
+ASGNI4
+ADDRGP4 s_playermodel+3616
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playermodel+3616+4
+ADDRGP4 $75
+ASGNP4
+ADDRGP4 s_playermodel+3616+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_playermodel+3616+12
+CNSTI4 125
+ASGNI4
+ADDRGP4 s_playermodel+3616+16
+CNSTI4 340
+ASGNI4
+ADDRGP4 s_playermodel+3616+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_playermodel+3616+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_playermodel+3704
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playermodel+3704+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_playermodel+3704+48
+ADDRGP4 PlayerModel_MenuEvent
+ASGNP4
+ADDRGP4 s_playermodel+3704+8
+CNSTI4 100
+ASGNI4
+ADDRGP4 s_playermodel+3704+12
+CNSTI4 125
+ASGNI4
+ADDRGP4 s_playermodel+3704+16
+CNSTI4 340
+ASGNI4
+ADDRGP4 s_playermodel+3704+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_playermodel+3704+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_playermodel+3704+60
+ADDRGP4 $76
+ASGNP4
+ADDRGP4 s_playermodel+3792
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playermodel+3792+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_playermodel+3792+48
+ADDRGP4 PlayerModel_MenuEvent
+ASGNP4
+ADDRGP4 s_playermodel+3792+8
+CNSTI4 101
+ASGNI4
+ADDRGP4 s_playermodel+3792+12
+CNSTI4 186
+ASGNI4
+ADDRGP4 s_playermodel+3792+16
+CNSTI4 340
+ASGNI4
+ADDRGP4 s_playermodel+3792+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_playermodel+3792+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_playermodel+3792+60
+ADDRGP4 $77
+ASGNP4
+ADDRGP4 s_playermodel+3440
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_playermodel+3440+4
+ADDRGP4 $68
+ASGNP4
+ADDRGP4 s_playermodel+3440+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_playermodel+3440+48
+ADDRGP4 PlayerModel_MenuEvent
+ASGNP4
+ADDRGP4 s_playermodel+3440+8
+CNSTI4 102
+ASGNI4
+ADDRGP4 s_playermodel+3440+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_playermodel+3440+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_playermodel+3440+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_playermodel+3440+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_playermodel+3440+60
+ADDRGP4 $69
+ASGNP4
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+3368
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+3104
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+3192
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+3280
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+4024
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+3880
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+3952
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $550
+ADDRGP4 s_playermodel
+ARGP4
+CNSTI4 88
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+288
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+CNSTI4 88
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 s_playermodel+1696
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $551
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+LTI4 $550
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+3528
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+3616
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+3704
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+3792
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 s_playermodel+3440
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 PlayerModel_SetMenuItems
+CALLV
+pop
+ADDRGP4 PlayerModel_UpdateGrid
+CALLV
+pop
+ADDRGP4 PlayerModel_UpdateModel
+CALLV
+pop
+LABELV $317
+endproc PlayerModel_MenuInit 28 12
+export PlayerModel_Cache
+proc PlayerModel_Cache 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $565
+JUMPV
+LABELV $562
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 playermodel_artlist
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $563
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $565
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 playermodel_artlist
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $562
+ADDRGP4 PlayerModel_BuildList
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $569
+JUMPV
+LABELV $566
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+LSHI4
+ADDRGP4 s_playermodel+5208
+ADDP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $567
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $569
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_playermodel+5204
+INDIRI4
+LTI4 $566
+LABELV $561
+endproc PlayerModel_Cache 4 4
+export UI_PlayerModelMenu
+proc UI_PlayerModelMenu 0 8
+ADDRGP4 PlayerModel_MenuInit
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 s_playermodel
+ARGP4
+CNSTI4 88
+ADDRGP4 s_playermodel+38048
+INDIRI4
+CNSTI4 16
+MODI4
+MULI4
+ADDRGP4 s_playermodel+288
+ADDP4
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $572
+endproc UI_PlayerModelMenu 0 8
+bss
+align 4
+LABELV s_playermodel
+skip 38052
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $331
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 77
+byte 1 79
+byte 1 68
+byte 1 69
+byte 1 76
+byte 1 0
+align 1
+LABELV $286
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $276
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 99
+byte 1 101
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 95
+byte 1 119
+byte 1 105
+byte 1 110
+byte 1 115
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $273
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $261
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $260
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $258
+byte 1 46
+byte 1 46
+byte 1 0
+align 1
+LABELV $257
+byte 1 46
+byte 1 0
+align 1
+LABELV $247
+byte 1 47
+byte 1 0
+align 1
+LABELV $246
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $243
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $239
+byte 1 76
+byte 1 79
+byte 1 87
+byte 1 32
+byte 1 77
+byte 1 69
+byte 1 77
+byte 1 79
+byte 1 82
+byte 1 89
+byte 1 0
+align 1
+LABELV $216
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 0
+align 1
+LABELV $215
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 0
+align 1
+LABELV $150
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $148
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $146
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $144
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $77
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $76
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $75
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $74
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 95
+byte 1 112
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $73
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $72
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $71
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $70
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $69
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $68
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
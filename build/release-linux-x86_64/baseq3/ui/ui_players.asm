@@ -0,0 +1,6426 @@
+code
+proc UI_PlayerInfo_SetWeapon 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1040
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+LABELV $69
+ADDRFP4 0
+INDIRP4
+CNSTI4 1104
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 988
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 992
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 996
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 0
+NEI4 $70
+ADDRGP4 $68
+JUMPV
+LABELV $70
+ADDRLP4 0
+ADDRGP4 bg_itemlist+52
+ASGNP4
+ADDRGP4 $75
+JUMPV
+LABELV $72
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $77
+ADDRGP4 $73
+JUMPV
+LABELV $77
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $79
+ADDRGP4 $74
+JUMPV
+LABELV $79
+LABELV $73
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+ASGNP4
+LABELV $75
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $72
+LABELV $74
+ADDRLP4 0
+INDIRP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $81
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 988
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+LABELV $81
+ADDRFP4 0
+INDIRP4
+CNSTI4 988
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $83
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+NEI4 $85
+ADDRFP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $69
+JUMPV
+LABELV $85
+ADDRFP4 4
+CNSTI4 2
+ASGNI4
+ADDRGP4 $69
+JUMPV
+LABELV $83
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+EQI4 $90
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+EQI4 $90
+ADDRFP4 4
+INDIRI4
+CNSTI4 9
+NEI4 $87
+LABELV $90
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $91
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 992
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+LABELV $87
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 COM_StripExtension
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRGP4 $92
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 996
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 1
+LTI4 $93
+ADDRLP4 76
+INDIRI4
+CNSTI4 10
+GTI4 $93
+ADDRLP4 76
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $106-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $106
+address $96
+address $97
+address $98
+address $99
+address $100
+address $101
+address $102
+address $103
+address $104
+address $105
+code
+LABELV $96
+ADDRFP4 0
+INDIRP4
+CNSTI4 1000
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1004
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $94
+JUMPV
+LABELV $97
+ADDRFP4 0
+INDIRP4
+CNSTI4 1000
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1004
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $94
+JUMPV
+LABELV $98
+ADDRFP4 0
+INDIRP4
+CNSTI4 1000
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1004
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $94
+JUMPV
+LABELV $99
+ADDRFP4 0
+INDIRP4
+CNSTI4 1000
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1004
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $94
+JUMPV
+LABELV $100
+ADDRFP4 0
+INDIRP4
+CNSTI4 1000
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1004
+ADDP4
+CNSTF4 1061158912
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $94
+JUMPV
+LABELV $101
+ADDRFP4 0
+INDIRP4
+CNSTI4 1000
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1004
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $94
+JUMPV
+LABELV $102
+ADDRFP4 0
+INDIRP4
+CNSTI4 1000
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1004
+ADDP4
+CNSTF4 1056964608
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $94
+JUMPV
+LABELV $103
+ADDRFP4 0
+INDIRP4
+CNSTI4 1000
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1004
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $94
+JUMPV
+LABELV $104
+ADDRFP4 0
+INDIRP4
+CNSTI4 1000
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1004
+ADDP4
+CNSTF4 1060320051
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $94
+JUMPV
+LABELV $105
+ADDRFP4 0
+INDIRP4
+CNSTI4 1000
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1004
+ADDP4
+CNSTF4 1058642330
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $94
+JUMPV
+LABELV $93
+ADDRFP4 0
+INDIRP4
+CNSTI4 1000
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1004
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1008
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+LABELV $94
+LABELV $68
+endproc UI_PlayerInfo_SetWeapon 84 12
+proc UI_ForceLegsAnim 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+BXORI4
+ADDRFP4 4
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 18
+NEI4 $109
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+CNSTI4 1000
+ASGNI4
+LABELV $109
+LABELV $108
+endproc UI_ForceLegsAnim 8 0
+proc UI_SetLegsAnim 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $112
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $112
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+LABELV $111
+endproc UI_SetLegsAnim 4 8
+proc UI_ForceTorsoAnim 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1048
+ADDP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 128
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+BANDI4
+ADDRLP4 4
+INDIRI4
+BXORI4
+ADDRFP4 4
+INDIRI4
+BORI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 6
+NEI4 $115
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+CNSTI4 2300
+ASGNI4
+LABELV $115
+ADDRFP4 4
+INDIRI4
+CNSTI4 7
+EQI4 $119
+ADDRFP4 4
+INDIRI4
+CNSTI4 8
+NEI4 $117
+LABELV $119
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+CNSTI4 500
+ASGNI4
+LABELV $117
+LABELV $114
+endproc UI_ForceTorsoAnim 12 0
+proc UI_SetTorsoAnim 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $121
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+ASGNP4
+ADDRFP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $121
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+LABELV $120
+endproc UI_SetTorsoAnim 4 8
+proc UI_TorsoSequencing 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1048
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1040
+ADDP4
+INDIRI4
+EQI4 $124
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+EQI4 $126
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+CNSTI4 300
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 9
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+LABELV $126
+LABELV $124
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $128
+ADDRGP4 $123
+JUMPV
+LABELV $128
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+NEI4 $130
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 UI_SetTorsoAnim
+CALLV
+pop
+ADDRGP4 $123
+JUMPV
+LABELV $130
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+EQI4 $134
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $132
+LABELV $134
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 UI_SetTorsoAnim
+CALLV
+pop
+ADDRGP4 $123
+JUMPV
+LABELV $132
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $135
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetWeapon
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+CNSTI4 300
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 10
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+ADDRGP4 $123
+JUMPV
+LABELV $135
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+NEI4 $137
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 UI_SetTorsoAnim
+CALLV
+pop
+LABELV $137
+LABELV $123
+endproc UI_TorsoSequencing 16 8
+proc UI_LegsSequencing 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $140
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+NEI4 $139
+CNSTF4 1078530011
+CNSTI4 1000
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+MULF4
+CNSTF4 1148846080
+DIVF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRGP4 jumpHeight
+CNSTF4 1113587712
+ADDRLP4 8
+INDIRF4
+MULF4
+ASGNF4
+ADDRGP4 $139
+JUMPV
+LABELV $140
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+NEI4 $144
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 19
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+CNSTI4 130
+ASGNI4
+ADDRGP4 jumpHeight
+CNSTF4 0
+ASGNF4
+ADDRGP4 $139
+JUMPV
+LABELV $144
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+NEI4 $146
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 22
+ARGI4
+ADDRGP4 UI_SetLegsAnim
+CALLV
+pop
+LABELV $146
+LABELV $139
+endproc UI_LegsSequencing 12 8
+proc UI_PositionEntityOnTag 84 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_CM_LerpTag
+CALLI4
+pop
+ADDRLP4 56
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $149
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 68
+INDIRP4
+ADDRLP4 68
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $150
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $149
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 60
+CNSTI4 28
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP
+ARGP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 64
+CNSTI4 100
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 64
+INDIRI4
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $148
+endproc UI_PositionEntityOnTag 84 24
+proc UI_PositionRotatedEntityOnTag 120 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 96
+ADDP4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ARGI4
+CNSTF4 1065353216
+ADDRFP4 4
+INDIRP4
+CNSTI4 100
+ADDP4
+INDIRF4
+SUBF4
+ARGF4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 trap_CM_LerpTag
+CALLI4
+pop
+ADDRLP4 92
+CNSTI4 68
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 92
+INDIRI4
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $155
+ADDRLP4 96
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 96
+INDIRP4
+ADDRLP4 96
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRF4
+CNSTI4 12
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $156
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LTI4 $155
+ADDRLP4 96
+CNSTI4 28
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 96
+INDIRI4
+ADDP
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+ADDRLP4 4+12
+ARGP4
+ADDRLP4 52
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRGP4 MatrixMultiply
+CALLV
+pop
+LABELV $154
+endproc UI_PositionRotatedEntityOnTag 120 24
+proc UI_SetLerpFrameAnimation 12 8
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+CNSTI4 0
+LTI4 $163
+ADDRFP4 8
+INDIRI4
+CNSTI4 31
+LTI4 $161
+LABELV $163
+ADDRGP4 $164
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $161
+ADDRLP4 0
+CNSTI4 28
+ADDRFP4 8
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $160
+endproc UI_SetLerpFrameAnimation 12 8
+proc UI_RunLerpFrame 48 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRI4
+NEI4 $168
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $166
+LABELV $168
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_SetLerpFrameAnimation
+CALLV
+pop
+LABELV $166
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LTI4 $169
+ADDRFP4 4
+INDIRP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+GEI4 $171
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $172
+JUMPV
+LABELV $171
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $172
+ADDRLP4 28
+CNSTI4 12
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRI4
+SUBI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+DIVI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+LTI4 $173
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $175
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRP4
+INDIRI4
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 $176
+JUMPV
+LABELV $175
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+LABELV $176
+LABELV $173
+ADDRFP4 4
+INDIRP4
+CNSTI4 8
+ADDP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+LEI4 $177
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+LABELV $177
+LABELV $169
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRGP4 dp_realtime
+INDIRI4
+CNSTI4 200
+ADDI4
+LEI4 $179
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+LABELV $179
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRGP4 dp_realtime
+INDIRI4
+LEI4 $181
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+LABELV $181
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+NEI4 $183
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $184
+JUMPV
+LABELV $183
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 16
+ADDP4
+CNSTF4 1065353216
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+CVIF4 4
+ADDRFP4 4
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+CVIF4 4
+DIVF4
+SUBF4
+ASGNF4
+LABELV $184
+LABELV $165
+endproc UI_RunLerpFrame 48 12
+proc UI_PlayerAnimation 16 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ADDRGP4 uis
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $186
+ADDRFP4 0
+INDIRP4
+CNSTI4 1080
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $186
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_LegsSequencing
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $188
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+CNSTI4 22
+NEI4 $188
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+CNSTI4 24
+ARGI4
+ADDRGP4 UI_RunLerpFrame
+CALLV
+pop
+ADDRGP4 $189
+JUMPV
+LABELV $188
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_RunLerpFrame
+CALLV
+pop
+LABELV $189
+ADDRFP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 12
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+ADDRGP4 uis
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $190
+ADDRFP4 0
+INDIRP4
+CNSTI4 1072
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $190
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_TorsoSequencing
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1048
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_RunLerpFrame
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 20
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 24
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $185
+endproc UI_PlayerAnimation 16 12
+proc UI_SwingAngles 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $193
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 20
+ADDRFP4 4
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+GTF4 $197
+ADDRLP4 0
+INDIRF4
+ADDRLP4 20
+INDIRF4
+NEGF4
+GEF4 $195
+LABELV $197
+ADDRFP4 20
+INDIRP4
+CNSTI4 1
+ASGNI4
+LABELV $195
+LABELV $193
+ADDRFP4 20
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $198
+ADDRGP4 $192
+JUMPV
+LABELV $198
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 12
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 fabs
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 16
+INDIRF4
+ASGNF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1056964608
+ADDRFP4 4
+INDIRF4
+MULF4
+GEF4 $200
+ADDRLP4 4
+CNSTF4 1056964608
+ASGNF4
+ADDRGP4 $201
+JUMPV
+LABELV $200
+ADDRLP4 4
+INDIRF4
+ADDRFP4 4
+INDIRF4
+GEF4 $202
+ADDRLP4 4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $203
+JUMPV
+LABELV $202
+ADDRLP4 4
+CNSTF4 1073741824
+ASGNF4
+LABELV $203
+LABELV $201
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+LTF4 $204
+ADDRLP4 8
+ADDRGP4 uis
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+LTF4 $206
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $206
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $205
+JUMPV
+LABELV $204
+ADDRLP4 0
+INDIRF4
+CNSTF4 0
+GEF4 $208
+ADDRLP4 8
+ADDRGP4 uis
+INDIRI4
+CVIF4 4
+ADDRLP4 4
+INDIRF4
+MULF4
+ADDRFP4 12
+INDIRF4
+NEGF4
+MULF4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+ADDRLP4 0
+INDIRF4
+GTF4 $210
+ADDRLP4 8
+ADDRLP4 0
+INDIRF4
+ASGNF4
+ADDRFP4 20
+INDIRP4
+CNSTI4 0
+ASGNI4
+LABELV $210
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ADDRLP4 8
+INDIRF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $208
+LABELV $205
+ADDRFP4 0
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 AngleSubtract
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+LEF4 $212
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+SUBF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRGP4 $213
+JUMPV
+LABELV $212
+ADDRLP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+NEGF4
+GEF4 $214
+ADDRFP4 0
+INDIRF4
+ADDRFP4 8
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ADDF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+LABELV $214
+LABELV $213
+LABELV $192
+endproc UI_SwingAngles 28 8
+proc UI_MovedirAdjustment 72 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1028
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1020
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1032
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1024
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1036
+ADDP4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 32
+CNSTP4 0
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRGP4 AngleVectors
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 36
+INDIRF4
+CNSTF4 1008981770
+GEF4 $219
+ADDRLP4 0
+CNSTF4 0
+ASGNF4
+LABELV $219
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Q_fabs
+CALLF4
+ASGNF4
+ADDRLP4 40
+INDIRF4
+CNSTF4 1008981770
+GEF4 $221
+ADDRLP4 0+4
+CNSTF4 0
+ASGNF4
+LABELV $221
+ADDRLP4 44
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 44
+INDIRF4
+NEF4 $225
+ADDRLP4 0
+INDIRF4
+ADDRLP4 44
+INDIRF4
+LEF4 $225
+CNSTF4 0
+RETF4
+ADDRGP4 $216
+JUMPV
+LABELV $225
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 48
+INDIRF4
+GEF4 $228
+ADDRLP4 0
+INDIRF4
+ADDRLP4 48
+INDIRF4
+LEF4 $228
+CNSTF4 1102053376
+RETF4
+ADDRGP4 $216
+JUMPV
+LABELV $228
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+GEF4 $231
+ADDRLP4 0
+INDIRF4
+ADDRLP4 52
+INDIRF4
+NEF4 $231
+CNSTF4 1110704128
+RETF4
+ADDRGP4 $216
+JUMPV
+LABELV $231
+ADDRLP4 56
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+GEF4 $234
+ADDRLP4 0
+INDIRF4
+ADDRLP4 56
+INDIRF4
+GEF4 $234
+CNSTF4 3249537024
+RETF4
+ADDRGP4 $216
+JUMPV
+LABELV $234
+ADDRLP4 60
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 60
+INDIRF4
+NEF4 $237
+ADDRLP4 0
+INDIRF4
+ADDRLP4 60
+INDIRF4
+GEF4 $237
+CNSTF4 0
+RETF4
+ADDRGP4 $216
+JUMPV
+LABELV $237
+ADDRLP4 64
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 64
+INDIRF4
+LEF4 $240
+ADDRLP4 0
+INDIRF4
+ADDRLP4 64
+INDIRF4
+GEF4 $240
+CNSTF4 1102053376
+RETF4
+ADDRGP4 $216
+JUMPV
+LABELV $240
+ADDRLP4 68
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ADDRLP4 68
+INDIRF4
+LEF4 $243
+ADDRLP4 0
+INDIRF4
+ADDRLP4 68
+INDIRF4
+NEF4 $243
+CNSTF4 3258187776
+RETF4
+ADDRGP4 $216
+JUMPV
+LABELV $243
+CNSTF4 3249537024
+RETF4
+LABELV $216
+endproc UI_MovedirAdjustment 72 16
+proc UI_PlayerAngles 80 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+INDIRB
+ASGNB 12
+ADDRLP4 12+4
+INDIRF4
+ARGF4
+ADDRLP4 44
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRLP4 12+4
+ADDRLP4 44
+INDIRF4
+ASGNF4
+ADDRLP4 48
+CNSTF4 0
+ASGNF4
+ADDRLP4 24+8
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 24
+ADDRLP4 48
+INDIRF4
+ASGNF4
+ADDRLP4 52
+CNSTF4 0
+ASGNF4
+ADDRLP4 0+8
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 52
+INDIRF4
+ASGNF4
+ADDRLP4 60
+CNSTI4 -129
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+BANDI4
+CNSTI4 22
+NEI4 $255
+ADDRFP4 0
+INDIRP4
+CNSTI4 1048
+ADDP4
+INDIRI4
+ADDRLP4 60
+INDIRI4
+BANDI4
+CNSTI4 11
+EQI4 $253
+LABELV $255
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $253
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 UI_MovedirAdjustment
+CALLF4
+ASGNF4
+ADDRLP4 36
+ADDRLP4 64
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRLP4 12+4
+INDIRF4
+ADDRLP4 36
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+ADDRLP4 12+4
+INDIRF4
+CNSTF4 1048576000
+ADDRLP4 36
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+ADDRLP4 0+4
+INDIRF4
+ARGF4
+CNSTF4 1103626240
+ARGF4
+CNSTF4 1119092736
+ARGF4
+CNSTF4 1050253722
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+ARGP4
+ADDRGP4 UI_SwingAngles
+CALLV
+pop
+ADDRLP4 24+4
+INDIRF4
+ARGF4
+CNSTF4 1109393408
+ARGF4
+CNSTF4 1119092736
+ARGF4
+CNSTF4 1050253722
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ARGP4
+ADDRGP4 UI_SwingAngles
+CALLV
+pop
+ADDRLP4 0+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 24+4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 1127481344
+LEF4 $264
+ADDRLP4 40
+CNSTF4 1061158912
+ADDRLP4 12
+INDIRF4
+CNSTF4 3283353600
+ADDF4
+MULF4
+ASGNF4
+ADDRGP4 $265
+JUMPV
+LABELV $264
+ADDRLP4 40
+CNSTF4 1061158912
+ADDRLP4 12
+INDIRF4
+MULF4
+ASGNF4
+LABELV $265
+ADDRLP4 40
+INDIRF4
+ARGF4
+CNSTF4 1097859072
+ARGF4
+CNSTF4 1106247680
+ARGF4
+CNSTF4 1036831949
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 96
+ADDP4
+ARGP4
+ADDRGP4 UI_SwingAngles
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 12
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 24
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 AnglesSubtract
+CALLV
+pop
+ADDRLP4 24
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRFP4 12
+INDIRP4
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+LABELV $246
+endproc UI_PlayerAngles 80 24
+proc UI_PlayerFloatSprite 140 12
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+68
+ADDRFP4 4
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRLP4 0+68+8
+ADDRLP4 0+68+8
+INDIRF4
+CNSTF4 1111490560
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 2
+ASGNI4
+ADDRLP4 0+112
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0+132
+CNSTF4 1092616192
+ASGNF4
+ADDRLP4 0+4
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $266
+endproc UI_PlayerFloatSprite 140 12
+export UI_MachinegunSpinAngle
+proc UI_MachinegunSpinAngle 32 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1100
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1092
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $274
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+INDIRF4
+CNSTF4 1063675494
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+MULF4
+ADDF4
+ASGNF4
+ADDRGP4 $275
+JUMPV
+LABELV $274
+ADDRLP4 4
+INDIRI4
+CNSTI4 1000
+LEI4 $276
+ADDRLP4 4
+CNSTI4 1000
+ASGNI4
+LABELV $276
+ADDRLP4 12
+CNSTF4 1056964608
+CNSTI4 1000
+ADDRLP4 4
+INDIRI4
+SUBI4
+CVIF4 4
+CNSTF4 1148846080
+DIVF4
+CNSTF4 1063675494
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+INDIRF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ADDRLP4 12
+INDIRF4
+MULF4
+ADDF4
+ASGNF4
+LABELV $275
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1048
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+NEI4 $278
+ADDRLP4 0
+CNSTI4 7
+ASGNI4
+LABELV $278
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+EQI4 $283
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $284
+JUMPV
+LABELV $283
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $284
+ADDRFP4 0
+INDIRP4
+CNSTI4 1092
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+NEI4 $280
+ADDRFP4 0
+INDIRP4
+CNSTI4 1100
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 AngleMod
+CALLF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1096
+ADDP4
+ADDRLP4 24
+INDIRF4
+ASGNF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $286
+ADDRLP4 28
+CNSTI4 1
+ASGNI4
+ADDRGP4 $287
+JUMPV
+LABELV $286
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+LABELV $287
+ADDRFP4 0
+INDIRP4
+CNSTI4 1092
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $280
+ADDRLP4 8
+INDIRF4
+RETF4
+LABELV $273
+endproc UI_MachinegunSpinAngle 32 4
+lit
+align 4
+LABELV $289
+byte 4 3246391296
+byte 4 3246391296
+byte 4 3250585600
+align 4
+LABELV $290
+byte 4 1098907648
+byte 4 1098907648
+byte 4 1107296256
+export UI_DrawPlayer
+code
+proc UI_DrawPlayer 1304 28
+ADDRFP4 16
+ADDRFP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 1084
+ADDRGP4 $289
+INDIRB
+ASGNB 12
+ADDRLP4 1096
+ADDRGP4 $290
+INDIRB
+ASGNB 12
+ADDRLP4 1260
+CNSTI4 0
+ASGNI4
+ADDRFP4 16
+INDIRP4
+INDIRI4
+ADDRLP4 1260
+INDIRI4
+EQI4 $295
+ADDRFP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ADDRLP4 1260
+INDIRI4
+EQI4 $295
+ADDRFP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ADDRLP4 1260
+INDIRI4
+EQI4 $295
+ADDRFP4 16
+INDIRP4
+CNSTI4 124
+ADDP4
+INDIRI4
+ADDRLP4 1260
+INDIRI4
+NEI4 $291
+LABELV $295
+ADDRGP4 $288
+JUMPV
+LABELV $291
+ADDRGP4 dp_realtime
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1060
+ADDP4
+INDIRI4
+CNSTI4 -1
+EQI4 $296
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1064
+ADDP4
+INDIRI4
+LEI4 $296
+ADDRFP4 16
+INDIRP4
+CNSTI4 1052
+ADDP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1060
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1056
+ADDP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1060
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1060
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1064
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1040
+ADDP4
+INDIRI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1052
+ADDP4
+INDIRI4
+EQI4 $298
+ADDRGP4 weaponChangeSound
+INDIRI4
+ARGI4
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $298
+LABELV $296
+ADDRFP4 0
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRFP4 8
+ARGP4
+ADDRFP4 12
+ARGP4
+ADDRGP4 UI_AdjustFrom640
+CALLV
+pop
+ADDRFP4 4
+ADDRFP4 4
+INDIRF4
+ADDRGP4 jumpHeight
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 0
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 368
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 380
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 520
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 660
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0+76
+CNSTI4 1
+ASGNI4
+ADDRLP4 0+36
+ARGP4
+ADDRGP4 AxisClear
+CALLV
+pop
+ADDRLP4 0
+ADDRFP4 0
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+4
+ADDRFP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+8
+ADDRFP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+12
+ADDRFP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0+16
+CNSTF4 1119092736
+ADDRLP4 0+8
+INDIRI4
+CVIF4 4
+CNSTF4 1142947840
+DIVF4
+MULF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+CNSTF4 1078530011
+ADDRLP4 0+16
+INDIRF4
+CNSTF4 1135869952
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 1268
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 1252
+ADDRLP4 0+8
+INDIRI4
+CVIF4 4
+ADDRLP4 1268
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 0+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1252
+INDIRF4
+ARGF4
+ADDRLP4 1272
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 0+20
+ADDRLP4 1272
+INDIRF4
+ASGNF4
+ADDRLP4 0+20
+CNSTF4 1122316001
+ADDRLP4 0+20
+INDIRF4
+MULF4
+ASGNF4
+ADDRLP4 1248
+CNSTF4 1060320051
+ADDRLP4 1096+8
+INDIRF4
+ADDRLP4 1084+8
+INDIRF4
+SUBF4
+MULF4
+ASGNF4
+CNSTF4 1056964608
+CNSTF4 1078530011
+ADDRLP4 0+16
+INDIRF4
+MULF4
+CNSTF4 1127481344
+DIVF4
+MULF4
+ARGF4
+ADDRLP4 1276
+ADDRGP4 tan
+CALLF4
+ASGNF4
+ADDRLP4 368
+ADDRLP4 1248
+INDIRF4
+ADDRLP4 1276
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 368+4
+CNSTF4 1056964608
+ADDRLP4 1084+4
+INDIRF4
+ADDRLP4 1096+4
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 368+8
+CNSTF4 3204448256
+ADDRLP4 1084+8
+INDIRF4
+ADDRLP4 1096+8
+INDIRF4
+ADDF4
+MULF4
+ASGNF4
+ADDRLP4 0+72
+ADDRGP4 dp_realtime
+INDIRI4
+ASGNI4
+ADDRGP4 trap_R_ClearScene
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 380+28
+ARGP4
+ADDRLP4 520+28
+ARGP4
+ADDRLP4 660+28
+ARGP4
+ADDRGP4 UI_PlayerAngles
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 380+96
+ARGP4
+ADDRLP4 380+80
+ARGP4
+ADDRLP4 380+100
+ARGP4
+ADDRLP4 520+96
+ARGP4
+ADDRLP4 520+80
+ARGP4
+ADDRLP4 520+100
+ARGP4
+ADDRGP4 UI_PlayerAnimation
+CALLV
+pop
+ADDRLP4 800
+CNSTI4 192
+ASGNI4
+ADDRLP4 380+8
+ADDRFP4 16
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 380+108
+ADDRFP4 16
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 380+68
+ADDRLP4 368
+INDIRB
+ASGNB 12
+ADDRLP4 380+12
+ADDRLP4 368
+INDIRB
+ASGNB 12
+ADDRLP4 380+4
+ADDRLP4 800
+INDIRI4
+ASGNI4
+ADDRLP4 380+84
+ADDRLP4 380+68
+INDIRB
+ASGNB 12
+ADDRLP4 380
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 380+8
+INDIRI4
+CNSTI4 0
+NEI4 $338
+ADDRGP4 $288
+JUMPV
+LABELV $338
+ADDRLP4 520+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 520+8
+INDIRI4
+CNSTI4 0
+NEI4 $342
+ADDRGP4 $288
+JUMPV
+LABELV $342
+ADDRLP4 520+108
+ADDRFP4 16
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 520+12
+ADDRLP4 368
+INDIRB
+ASGNB 12
+ADDRLP4 520
+ARGP4
+ADDRLP4 380
+ARGP4
+ADDRFP4 16
+INDIRP4
+INDIRI4
+ARGI4
+ADDRGP4 $347
+ARGP4
+ADDRGP4 UI_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 520+4
+ADDRLP4 800
+INDIRI4
+ASGNI4
+ADDRLP4 520
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRLP4 660+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 660+8
+INDIRI4
+CNSTI4 0
+NEI4 $350
+ADDRGP4 $288
+JUMPV
+LABELV $350
+ADDRLP4 660+108
+ADDRFP4 16
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 660+12
+ADDRLP4 368
+INDIRB
+ASGNB 12
+ADDRLP4 660
+ARGP4
+ADDRLP4 520
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $355
+ARGP4
+ADDRGP4 UI_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 660+4
+ADDRLP4 800
+INDIRI4
+ASGNI4
+ADDRLP4 660
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+ADDRFP4 16
+INDIRP4
+CNSTI4 1040
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $357
+ADDRLP4 804
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 804+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 988
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 804+12
+ADDRLP4 368
+INDIRB
+ASGNB 12
+ADDRLP4 804
+ARGP4
+ADDRLP4 520
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $361
+ARGP4
+ADDRGP4 UI_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 804+4
+ADDRLP4 800
+INDIRI4
+ASGNI4
+ADDRLP4 804
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $357
+ADDRLP4 1280
+ADDRFP4 16
+INDIRP4
+CNSTI4 1104
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1280
+INDIRI4
+CNSTI4 2
+EQI4 $366
+ADDRLP4 1280
+INDIRI4
+CNSTI4 1
+EQI4 $366
+ADDRLP4 1280
+INDIRI4
+CNSTI4 9
+NEI4 $363
+LABELV $366
+ADDRLP4 944
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 944+12
+ADDRLP4 368
+INDIRB
+ASGNB 12
+ADDRLP4 944+4
+ADDRLP4 800
+INDIRI4
+ASGNI4
+ADDRLP4 944+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 992
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1284+4
+CNSTF4 0
+ASGNF4
+ADDRLP4 1284
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 1296
+ADDRGP4 UI_MachinegunSpinAngle
+CALLF4
+ASGNF4
+ADDRLP4 1284+8
+ADDRLP4 1296
+INDIRF4
+ASGNF4
+ADDRLP4 1300
+ADDRFP4 16
+INDIRP4
+CNSTI4 1104
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1300
+INDIRI4
+CNSTI4 1
+EQI4 $374
+ADDRLP4 1300
+INDIRI4
+CNSTI4 9
+NEI4 $372
+LABELV $374
+ADDRLP4 1284
+ADDRLP4 1284+8
+INDIRF4
+ASGNF4
+ADDRLP4 1284+8
+CNSTF4 0
+ASGNF4
+LABELV $372
+ADDRLP4 1284
+ARGP4
+ADDRLP4 944+28
+ARGP4
+ADDRGP4 AnglesToAxis
+CALLV
+pop
+ADDRLP4 944
+ARGP4
+ADDRLP4 804
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 988
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $378
+ARGP4
+ADDRGP4 UI_PositionRotatedEntityOnTag
+CALLV
+pop
+ADDRLP4 944
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $363
+ADDRGP4 dp_realtime
+INDIRI4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1012
+ADDP4
+INDIRI4
+GTI4 $379
+ADDRFP4 16
+INDIRP4
+CNSTI4 996
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $381
+ADDRLP4 1108
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 140
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 1108+8
+ADDRFP4 16
+INDIRP4
+CNSTI4 996
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 1108+12
+ADDRLP4 368
+INDIRB
+ASGNB 12
+ADDRLP4 1108
+ARGP4
+ADDRLP4 804
+ARGP4
+ADDRFP4 16
+INDIRP4
+CNSTI4 988
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 $385
+ARGP4
+ADDRGP4 UI_PositionEntityOnTag
+CALLV
+pop
+ADDRLP4 1108+4
+ADDRLP4 800
+INDIRI4
+ASGNI4
+ADDRLP4 1108
+ARGP4
+ADDRGP4 trap_R_AddRefEntityToScene
+CALLV
+pop
+LABELV $381
+ADDRLP4 1288
+CNSTF4 0
+ASGNF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1000
+ADDP4
+INDIRF4
+ADDRLP4 1288
+INDIRF4
+NEF4 $390
+ADDRFP4 16
+INDIRP4
+CNSTI4 1004
+ADDP4
+INDIRF4
+ADDRLP4 1288
+INDIRF4
+NEF4 $390
+ADDRFP4 16
+INDIRP4
+CNSTI4 1008
+ADDP4
+INDIRF4
+ADDRLP4 1288
+INDIRF4
+EQF4 $387
+LABELV $390
+ADDRLP4 1292
+ADDRGP4 rand
+CALLI4
+ASGNI4
+ADDRLP4 1108+68
+ARGP4
+ADDRLP4 1292
+INDIRI4
+CNSTI4 31
+BANDI4
+CNSTI4 200
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1000
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1004
+ADDP4
+INDIRF4
+ARGF4
+ADDRFP4 16
+INDIRP4
+CNSTI4 1008
+ADDP4
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+LABELV $387
+LABELV $379
+ADDRFP4 16
+INDIRP4
+CNSTI4 1084
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $392
+ADDRGP4 $394
+ARGP4
+ADDRLP4 1284
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 16
+INDIRP4
+ARGP4
+ADDRLP4 368
+ARGP4
+ADDRLP4 1284
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerFloatSprite
+CALLV
+pop
+LABELV $392
+ADDRLP4 1284
+CNSTF4 1120403456
+ASGNF4
+ADDRLP4 368
+ADDRLP4 368
+INDIRF4
+ADDRLP4 1284
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 368+4
+ADDRLP4 368+4
+INDIRF4
+ADDRLP4 1284
+INDIRF4
+ADDF4
+ASGNF4
+ADDRLP4 368+8
+ADDRLP4 368+8
+INDIRF4
+CNSTF4 1120403456
+ADDF4
+ASGNF4
+ADDRLP4 368
+ARGP4
+CNSTF4 1140457472
+ARGF4
+ADDRLP4 1288
+CNSTF4 1065353216
+ASGNF4
+ADDRLP4 1288
+INDIRF4
+ARGF4
+ADDRLP4 1288
+INDIRF4
+ARGF4
+ADDRLP4 1288
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRLP4 1292
+CNSTF4 1120403456
+ASGNF4
+ADDRLP4 368
+ADDRLP4 368
+INDIRF4
+ADDRLP4 1292
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 368+4
+ADDRLP4 368+4
+INDIRF4
+ADDRLP4 1292
+INDIRF4
+SUBF4
+ASGNF4
+ADDRLP4 368+8
+ADDRLP4 368+8
+INDIRF4
+CNSTF4 1120403456
+SUBF4
+ASGNF4
+ADDRLP4 368
+ARGP4
+CNSTF4 1140457472
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 1296
+CNSTF4 0
+ASGNF4
+ADDRLP4 1296
+INDIRF4
+ARGF4
+ADDRLP4 1296
+INDIRF4
+ARGF4
+ADDRGP4 trap_R_AddLightToScene
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRGP4 trap_R_RenderScene
+CALLV
+pop
+LABELV $288
+endproc UI_DrawPlayer 1304 28
+proc UI_RegisterClientSkin 84 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 8
+ADDRFP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $400
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRLP4 64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $401
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $402
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterSkin
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRLP4 72
+INDIRI4
+ASGNI4
+ADDRLP4 80
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $406
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+EQI4 $406
+ADDRFP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ADDRLP4 80
+INDIRI4
+NEI4 $403
+LABELV $406
+CNSTI4 0
+RETI4
+ADDRGP4 $399
+JUMPV
+LABELV $403
+CNSTI4 1
+RETI4
+LABELV $399
+endproc UI_RegisterClientSkin 84 20
+proc UI_ParseAnimationFile 20068 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 868
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20028
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 20032
+ADDRGP4 trap_FS_FOpenFile
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 20032
+INDIRI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+GTI4 $408
+CNSTI4 0
+RETI4
+ADDRGP4 $407
+JUMPV
+LABELV $408
+ADDRLP4 24
+INDIRI4
+CVIU4 4
+CNSTU4 19999
+LTU4 $410
+ADDRGP4 $412
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+ADDRLP4 20028
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $407
+JUMPV
+LABELV $410
+ADDRLP4 28
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 20028
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_Read
+CALLV
+pop
+ADDRLP4 24
+INDIRI4
+ADDRLP4 28
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 20028
+INDIRI4
+ARGI4
+ADDRGP4 trap_FS_FCloseFile
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 28
+ASGNP4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRGP4 $414
+JUMPV
+LABELV $413
+ADDRLP4 16
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 20036
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20036
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $416
+ADDRGP4 $415
+JUMPV
+LABELV $416
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $420
+ARGP4
+ADDRLP4 20040
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20040
+INDIRI4
+CNSTI4 0
+NEI4 $418
+ADDRLP4 8
+ARGP4
+ADDRLP4 20044
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20044
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $414
+ADDRGP4 $415
+JUMPV
+LABELV $418
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $425
+ARGP4
+ADDRLP4 20044
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20044
+INDIRI4
+CNSTI4 0
+NEI4 $423
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $426
+ADDRLP4 8
+ARGP4
+ADDRLP4 20048
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20048
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $430
+ADDRGP4 $414
+JUMPV
+LABELV $430
+LABELV $427
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 3
+LTI4 $426
+ADDRGP4 $414
+JUMPV
+LABELV $423
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $434
+ARGP4
+ADDRLP4 20048
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20048
+INDIRI4
+CNSTI4 0
+NEI4 $432
+ADDRLP4 8
+ARGP4
+ADDRLP4 20052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $414
+ADDRGP4 $415
+JUMPV
+LABELV $432
+ADDRLP4 20052
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20052
+INDIRI4
+CNSTI4 48
+LTI4 $437
+ADDRLP4 20052
+INDIRI4
+CNSTI4 57
+GTI4 $437
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRGP4 $415
+JUMPV
+LABELV $437
+ADDRGP4 $439
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+LABELV $414
+ADDRGP4 $413
+JUMPV
+LABELV $415
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $440
+ADDRLP4 8
+ARGP4
+ADDRLP4 20036
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20036
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $444
+ADDRGP4 $442
+JUMPV
+LABELV $444
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20040
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ADDRLP4 20040
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+NEI4 $446
+ADDRLP4 20
+ADDRFP4 4
+INDIRP4
+CNSTI4 364
+ADDP4
+INDIRI4
+ADDRFP4 4
+INDIRP4
+CNSTI4 168
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $446
+ADDRLP4 4
+INDIRI4
+CNSTI4 13
+LTI4 $448
+ADDRLP4 20044
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 20044
+INDIRP4
+ADDRLP4 20044
+INDIRP4
+INDIRI4
+ADDRLP4 20
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $448
+ADDRLP4 8
+ARGP4
+ADDRLP4 20044
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20044
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $450
+ADDRGP4 $442
+JUMPV
+LABELV $450
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20048
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 4
+ADDP4
+ADDRLP4 20048
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 20052
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20052
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $452
+ADDRGP4 $442
+JUMPV
+LABELV $452
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20056
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 8
+ADDP4
+ADDRLP4 20056
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRLP4 20060
+ADDRGP4 COM_Parse
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 20060
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $454
+ADDRGP4 $442
+JUMPV
+LABELV $454
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 20064
+ADDRGP4 atof
+CALLF4
+ASGNF4
+ADDRLP4 12
+ADDRLP4 20064
+INDIRF4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+NEF4 $456
+ADDRLP4 12
+CNSTF4 1065353216
+ASGNF4
+LABELV $456
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 12
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 12
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+CNSTI4 28
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRFP4 4
+INDIRP4
+ADDP4
+CNSTI4 16
+ADDP4
+CNSTF4 1148846080
+ADDRLP4 12
+INDIRF4
+DIVF4
+CVFI4 4
+ASGNI4
+LABELV $441
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+LTI4 $440
+LABELV $442
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+EQI4 $458
+ADDRGP4 $460
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $407
+JUMPV
+LABELV $458
+CNSTI4 1
+RETI4
+LABELV $407
+endproc UI_ParseAnimationFile 20068 12
+export UI_RegisterClientModelname
+proc UI_RegisterClientModelname 220 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $462
+CNSTI4 0
+RETI4
+ADDRGP4 $461
+JUMPV
+LABELV $462
+ADDRLP4 64
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 64
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 196
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 192
+ADDRLP4 196
+INDIRP4
+ASGNP4
+ADDRLP4 192
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $464
+ADDRLP4 128
+ARGP4
+ADDRGP4 $466
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $465
+JUMPV
+LABELV $464
+ADDRLP4 128
+ARGP4
+ADDRLP4 192
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 192
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $465
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $467
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 200
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 200
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $468
+ADDRGP4 $470
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $461
+JUMPV
+LABELV $468
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $471
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 204
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+ADDRLP4 204
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $472
+ADDRGP4 $470
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $461
+JUMPV
+LABELV $472
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $474
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 208
+ADDRGP4 trap_R_RegisterModel
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 208
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $475
+ADDRGP4 $470
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $461
+JUMPV
+LABELV $475
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRLP4 212
+ADDRGP4 UI_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 212
+INDIRI4
+CNSTI4 0
+NEI4 $477
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 $466
+ARGP4
+ADDRLP4 216
+ADDRGP4 UI_RegisterClientSkin
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+NEI4 $479
+ADDRGP4 $481
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRLP4 128
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $461
+JUMPV
+LABELV $479
+LABELV $477
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $482
+ARGP4
+ADDRLP4 64
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ARGP4
+ADDRLP4 216
+ADDRGP4 UI_ParseAnimationFile
+CALLI4
+ASGNI4
+ADDRLP4 216
+INDIRI4
+CNSTI4 0
+NEI4 $483
+ADDRGP4 $485
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRGP4 Com_Printf
+CALLV
+pop
+CNSTI4 0
+RETI4
+ADDRGP4 $461
+JUMPV
+LABELV $483
+CNSTI4 1
+RETI4
+LABELV $461
+endproc UI_RegisterClientModelname 220 16
+export UI_PlayerInfo_SetModel
+proc UI_PlayerInfo_SetModel 12 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1108
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_RegisterClientModelname
+CALLI4
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1040
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1056
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1060
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1064
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1084
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1088
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetWeapon
+CALLV
+pop
+LABELV $486
+endproc UI_PlayerInfo_SetModel 12 12
+export UI_PlayerInfo_SetInfo
+proc UI_PlayerInfo_SetInfo 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1084
+ADDP4
+ADDRFP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1016
+ADDP4
+ADDRFP4 12
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1028
+ADDP4
+ADDRFP4 16
+INDIRP4
+INDIRB
+ASGNB 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 1088
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $488
+ADDRFP4 0
+INDIRP4
+CNSTI4 1088
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 jumpHeight
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ADDRFP4 12
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 20
+INDIRI4
+CNSTI4 -1
+EQI4 $487
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1040
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1056
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1060
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1064
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetWeapon
+CALLV
+pop
+ADDRGP4 $487
+JUMPV
+LABELV $488
+ADDRFP4 20
+INDIRI4
+CNSTI4 -1
+NEI4 $492
+ADDRFP4 0
+INDIRP4
+CNSTI4 1060
+ADDP4
+CNSTI4 -1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1064
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $493
+JUMPV
+LABELV $492
+ADDRFP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $494
+ADDRFP4 0
+INDIRP4
+CNSTI4 1060
+ADDP4
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1064
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+CNSTI4 250
+ADDI4
+ASGNI4
+LABELV $494
+LABELV $493
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1056
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $498
+ADDRFP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+NEI4 $496
+LABELV $498
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+ADDRFP4 4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1040
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1052
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_PlayerInfo_SetWeapon
+CALLV
+pop
+ADDRGP4 jumpHeight
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+ADDRGP4 $487
+JUMPV
+LABELV $496
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1044
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 18
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $499
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $501
+ADDRLP4 0
+INDIRI4
+CNSTI4 19
+NEI4 $499
+LABELV $501
+ADDRFP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $500
+JUMPV
+LABELV $499
+ADDRFP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $502
+ADDRGP4 jumpHeight
+CNSTF4 0
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1068
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceLegsAnim
+CALLV
+pop
+LABELV $502
+LABELV $500
+ADDRFP4 8
+INDIRI4
+CNSTI4 11
+EQI4 $506
+ADDRFP4 8
+INDIRI4
+CNSTI4 12
+NEI4 $504
+LABELV $506
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $509
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $507
+LABELV $509
+ADDRFP4 8
+CNSTI4 12
+ASGNI4
+ADDRGP4 $508
+JUMPV
+LABELV $507
+ADDRFP4 8
+CNSTI4 11
+ASGNI4
+LABELV $508
+LABELV $504
+ADDRFP4 8
+INDIRI4
+CNSTI4 7
+EQI4 $512
+ADDRFP4 8
+INDIRI4
+CNSTI4 8
+NEI4 $510
+LABELV $512
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $515
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $513
+LABELV $515
+ADDRFP4 8
+CNSTI4 8
+ASGNI4
+ADDRGP4 $514
+JUMPV
+LABELV $513
+ADDRFP4 8
+CNSTI4 7
+ASGNI4
+LABELV $514
+ADDRFP4 0
+INDIRP4
+CNSTI4 1012
+ADDP4
+ADDRGP4 dp_realtime
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $510
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 1048
+ADDP4
+INDIRI4
+CNSTI4 -129
+BANDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 1040
+ADDP4
+INDIRI4
+NEI4 $519
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+EQI4 $519
+ADDRLP4 0
+INDIRI4
+CNSTI4 9
+NEI4 $516
+LABELV $519
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $517
+JUMPV
+LABELV $516
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+EQI4 $522
+ADDRLP4 0
+INDIRI4
+CNSTI4 7
+NEI4 $520
+LABELV $522
+ADDRFP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $520
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $521
+JUMPV
+LABELV $520
+ADDRFP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $523
+ADDRFP4 0
+INDIRP4
+CNSTI4 1076
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 UI_ForceTorsoAnim
+CALLV
+pop
+LABELV $523
+LABELV $521
+LABELV $517
+LABELV $487
+endproc UI_PlayerInfo_SetInfo 40 8
+bss
+align 4
+LABELV jumpHeight
+skip 4
+align 4
+LABELV dp_realtime
+skip 4
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $485
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $482
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 46
+byte 1 99
+byte 1 102
+byte 1 103
+byte 1 0
+align 1
+LABELV $481
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $474
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $471
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $470
+byte 1 70
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $467
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $466
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $460
+byte 1 69
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 112
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 102
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $439
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 107
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 39
+byte 1 37
+byte 1 115
+byte 1 39
+byte 1 32
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $434
+byte 1 115
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $425
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $420
+byte 1 102
+byte 1 111
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 112
+byte 1 115
+byte 1 0
+align 1
+LABELV $412
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 111
+byte 1 32
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 10
+byte 1 0
+align 1
+LABELV $402
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $401
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 117
+byte 1 112
+byte 1 112
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $400
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 101
+byte 1 114
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $394
+byte 1 115
+byte 1 112
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 111
+byte 1 110
+byte 1 51
+byte 1 0
+align 1
+LABELV $385
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 0
+align 1
+LABELV $378
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $361
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $355
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 104
+byte 1 101
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $347
+byte 1 116
+byte 1 97
+byte 1 103
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 0
+align 1
+LABELV $164
+byte 1 66
+byte 1 97
+byte 1 100
+byte 1 32
+byte 1 97
+byte 1 110
+byte 1 105
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 32
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 98
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $92
+byte 1 95
+byte 1 102
+byte 1 108
+byte 1 97
+byte 1 115
+byte 1 104
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
+align 1
+LABELV $91
+byte 1 95
+byte 1 98
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 46
+byte 1 109
+byte 1 100
+byte 1 51
+byte 1 0
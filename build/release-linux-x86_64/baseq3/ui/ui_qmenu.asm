@@ -0,0 +1,8326 @@
+data
+export menu_text_color
+align 4
+LABELV menu_text_color
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export menu_dim_color
+align 4
+LABELV menu_dim_color
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1061158912
+export color_black
+align 4
+LABELV color_black
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export color_white
+align 4
+LABELV color_white
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export color_yellow
+align 4
+LABELV color_yellow
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+export color_blue
+align 4
+LABELV color_blue
+byte 4 0
+byte 4 0
+byte 4 1065353216
+byte 4 1065353216
+export color_lightOrange
+align 4
+LABELV color_lightOrange
+byte 4 1065353216
+byte 4 1059984507
+byte 4 0
+byte 4 1065353216
+export color_orange
+align 4
+LABELV color_orange
+byte 4 1065353216
+byte 4 1054615798
+byte 4 0
+byte 4 1065353216
+export color_red
+align 4
+LABELV color_red
+byte 4 1065353216
+byte 4 0
+byte 4 0
+byte 4 1065353216
+export color_dim
+align 4
+LABELV color_dim
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1048576000
+export pulse_color
+align 4
+LABELV pulse_color
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+export text_color_disabled
+align 4
+LABELV text_color_disabled
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1056964608
+byte 4 1065353216
+export text_color_normal
+align 4
+LABELV text_color_normal
+byte 4 1065353216
+byte 4 1054615798
+byte 4 0
+byte 4 1065353216
+export text_color_highlight
+align 4
+LABELV text_color_highlight
+byte 4 1065353216
+byte 4 1065353216
+byte 4 0
+byte 4 1065353216
+export listbar_color
+align 4
+LABELV listbar_color
+byte 4 1065353216
+byte 4 1054615798
+byte 4 0
+byte 4 1050253722
+export text_color_status
+align 4
+LABELV text_color_status
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+byte 4 1065353216
+code
+proc Text_Init 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $68
+endproc Text_Init 4 0
+proc Text_Draw 528 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 512
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 516
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI1 0
+ASGNI1
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $70
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $70
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $72
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $72
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $74
+ADDRLP4 520
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRGP4 $75
+JUMPV
+LABELV $74
+ADDRLP4 520
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $75
+ADDRLP4 512
+INDIRI4
+ARGI4
+ADDRLP4 516
+INDIRI4
+ARGI4
+ADDRLP4 0
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 520
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $69
+endproc Text_Draw 528 20
+proc BText_Init 4 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $76
+endproc BText_Init 4 0
+proc BText_Draw 20 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $78
+ADDRLP4 8
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRGP4 $79
+JUMPV
+LABELV $78
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $79
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawBannerString
+CALLV
+pop
+LABELV $77
+endproc BText_Draw 20 20
+proc PText_Init 36 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_ProportionalSizeScale
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 20
+INDIRF4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 UI_ProportionalStringWidth
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+CVIF4 4
+ADDRLP4 0
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+CNSTF4 1104674816
+ADDRLP4 0
+INDIRF4
+MULF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 16
+BANDU4
+CNSTU4 0
+EQU4 $81
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $82
+JUMPV
+LABELV $81
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8
+BANDU4
+CNSTU4 0
+EQU4 $83
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+LABELV $83
+LABELV $82
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+CNSTF4 1077936128
+ADDRLP4 0
+INDIRF4
+MULF4
+SUBF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+CVIF4 4
+CNSTF4 1077936128
+ADDRLP4 0
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 16
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $80
+endproc PText_Init 36 4
+proc PText_Draw 32 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $86
+ADDRLP4 12
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRGP4 $87
+JUMPV
+LABELV $86
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+ASGNP4
+LABELV $87
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 256
+BANDU4
+CNSTU4 0
+EQU4 $88
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+NEU4 $90
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRGP4 $91
+JUMPV
+LABELV $90
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 8192
+BORI4
+ASGNI4
+LABELV $91
+LABELV $88
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $85
+endproc PText_Draw 32 20
+export Bitmap_Init
+proc Bitmap_Init 20 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $93
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $93
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+GEI4 $95
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+NEGI4
+ASGNI4
+LABELV $95
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 16
+BANDU4
+CNSTU4 0
+EQU4 $97
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ASGNI4
+ADDRGP4 $98
+JUMPV
+LABELV $97
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8
+BANDU4
+CNSTU4 0
+EQU4 $99
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+LABELV $99
+LABELV $98
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $92
+endproc Bitmap_Init 20 0
+export Bitmap_Draw
+proc Bitmap_Draw 88 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 16
+BANDU4
+CNSTU4 0
+EQU4 $102
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 $103
+JUMPV
+LABELV $102
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8
+BANDU4
+CNSTU4 0
+EQU4 $104
+ADDRLP4 0
+ADDRLP4 0
+INDIRF4
+ADDRLP4 4
+INDIRF4
+CNSTF4 1073741824
+DIVF4
+SUBF4
+ASGNF4
+LABELV $104
+LABELV $103
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $106
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $106
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 48
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $108
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $108
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+LABELV $108
+LABELV $106
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $110
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $110
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+LABELV $110
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $113
+ADDRGP4 colorMdGrey
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $113
+JUMPV
+LABELV $112
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $116
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $116
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 60
+CNSTU4 0
+ASGNU4
+ADDRLP4 56
+INDIRU4
+CNSTU4 131072
+BANDU4
+ADDRLP4 60
+INDIRU4
+NEU4 $120
+ADDRLP4 56
+INDIRU4
+CNSTU4 256
+BANDU4
+ADDRLP4 60
+INDIRU4
+EQU4 $118
+LABELV $120
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 68
+INDIRP4
+CVPU4 4
+NEU4 $118
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $121
+ADDRLP4 72
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 72
+INDIRP4
+INDIRP4
+INDIRF4
+ASGNF4
+ADDRLP4 20+4
+ADDRLP4 72
+INDIRP4
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 20+8
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 20
+ASGNP4
+ADDRGP4 $122
+JUMPV
+LABELV $121
+ADDRLP4 16
+ADDRGP4 pulse_color
+ASGNP4
+LABELV $122
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 72
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+CNSTI4 12
+ADDP4
+CNSTF4 1056964608
+ADDRLP4 72
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $119
+JUMPV
+LABELV $118
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 80
+CNSTU4 0
+ASGNU4
+ADDRLP4 76
+INDIRU4
+CNSTU4 64
+BANDU4
+ADDRLP4 80
+INDIRU4
+NEU4 $128
+ADDRLP4 76
+INDIRU4
+CNSTU4 128
+BANDU4
+ADDRLP4 80
+INDIRU4
+EQU4 $126
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 84
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 84
+INDIRP4
+CVPU4 4
+NEU4 $126
+LABELV $128
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $129
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $130
+JUMPV
+LABELV $129
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $130
+LABELV $126
+LABELV $119
+LABELV $113
+LABELV $101
+endproc Bitmap_Draw 88 20
+proc Action_Init 28 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $132
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $133
+JUMPV
+LABELV $132
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $133
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 16
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $131
+endproc Action_Init 28 4
+proc Action_Draw 32 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 menu_text_color
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $135
+ADDRLP4 0
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRGP4 $136
+JUMPV
+LABELV $135
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 256
+BANDU4
+CNSTU4 0
+EQU4 $137
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $137
+ADDRLP4 0
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 12
+CNSTI4 16384
+ASGNI4
+ADDRGP4 $138
+JUMPV
+LABELV $137
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 128
+BANDU4
+CNSTU4 0
+EQU4 $139
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $139
+ADDRLP4 0
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRGP4 $140
+JUMPV
+LABELV $139
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 1
+BANDU4
+CNSTU4 0
+EQU4 $141
+ADDRLP4 12
+CNSTI4 4096
+ASGNI4
+ADDRLP4 0
+ADDRGP4 text_color_highlight
+ASGNP4
+LABELV $141
+LABELV $140
+LABELV $138
+LABELV $136
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $143
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 4096
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $143
+LABELV $134
+endproc Action_Draw 32 20
+proc RadioButton_Init 28 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $146
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $147
+JUMPV
+LABELV $146
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $147
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 8
+ADDI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 48
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 16
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $145
+endproc RadioButton_Init 28 4
+proc RadioButton_Key 44 8
+ADDRLP4 0
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 163
+EQI4 $154
+ADDRLP4 4
+CNSTI4 165
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+EQI4 $154
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+GTI4 $161
+LABELV $160
+ADDRLP4 8
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 13
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+EQI4 $154
+ADDRLP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $149
+LABELV $162
+ADDRLP4 16
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 134
+EQI4 $154
+ADDRLP4 16
+INDIRI4
+CNSTI4 135
+EQI4 $154
+ADDRGP4 $149
+JUMPV
+LABELV $161
+ADDRLP4 20
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 178
+ASGNI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+EQI4 $151
+ADDRLP4 20
+INDIRI4
+ADDRLP4 24
+INDIRI4
+GTI4 $164
+LABELV $163
+ADDRFP4 4
+INDIRI4
+CNSTI4 169
+EQI4 $154
+ADDRGP4 $149
+JUMPV
+LABELV $164
+ADDRLP4 28
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 185
+LTI4 $149
+ADDRLP4 28
+INDIRI4
+CNSTI4 188
+GTI4 $149
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $165-740
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $165
+address $154
+address $154
+address $154
+address $154
+code
+LABELV $151
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 512
+BANDU4
+CNSTU4 0
+NEU4 $152
+ADDRGP4 $150
+JUMPV
+LABELV $152
+LABELV $154
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $156
+ADDRLP4 32
+CNSTI4 1
+ASGNI4
+ADDRGP4 $157
+JUMPV
+LABELV $156
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+LABELV $157
+ADDRLP4 36
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $158
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $158
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $148
+JUMPV
+LABELV $149
+LABELV $150
+CNSTI4 0
+RETI4
+LABELV $148
+endproc RadioButton_Key 44 8
+proc RadioButton_Draw 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $169
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $170
+JUMPV
+LABELV $169
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $170
+ADDRLP4 12
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $171
+ADDRLP4 8
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRLP4 16
+CNSTI4 16
+ASGNI4
+ADDRGP4 $172
+JUMPV
+LABELV $171
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $173
+ADDRLP4 8
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 16
+CNSTI4 16400
+ASGNI4
+ADDRGP4 $174
+JUMPV
+LABELV $173
+ADDRLP4 8
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRLP4 16
+CNSTI4 16
+ASGNI4
+LABELV $174
+LABELV $172
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+EQI4 $175
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+SUBI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ADDRLP4 40
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $175
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $177
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $177
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $179
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRGP4 uis+11428
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+ADDI4
+CNSTI4 16
+ADDI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $182
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $180
+JUMPV
+LABELV $179
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+CNSTF4 1098907648
+ASGNF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRGP4 uis+11424
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+ADDI4
+CNSTI4 16
+ADDI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 $184
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $180
+LABELV $167
+endproc RadioButton_Draw 44 20
+proc Slider_Init 28 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $186
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $187
+JUMPV
+LABELV $186
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $187
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 8
+ADDI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 104
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+CNSTI4 16
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 24
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $185
+endproc Slider_Init 28 4
+proc Slider_Key 64 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 163
+EQI4 $199
+ADDRLP4 16
+CNSTI4 165
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $202
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+GTI4 $206
+LABELV $205
+ADDRLP4 20
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 134
+EQI4 $199
+ADDRLP4 20
+INDIRI4
+CNSTI4 135
+EQI4 $202
+ADDRGP4 $189
+JUMPV
+LABELV $206
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $191
+ADDRGP4 $189
+JUMPV
+LABELV $191
+ADDRLP4 4
+ADDRGP4 uis+8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+SUBI4
+CNSTI4 16
+SUBI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 32
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ASGNF4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+CNSTF4 1117782016
+DIVF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 32
+INDIRF4
+SUBF4
+MULF4
+ADDRLP4 32
+INDIRF4
+ADDF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+GEF4 $193
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ASGNF4
+ADDRGP4 $194
+JUMPV
+LABELV $193
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+LEF4 $195
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ASGNF4
+LABELV $195
+LABELV $194
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+EQF4 $197
+ADDRLP4 0
+ADDRGP4 menu_move_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $190
+JUMPV
+LABELV $197
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $190
+JUMPV
+LABELV $199
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+LEF4 $200
+ADDRLP4 56
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+SUBF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 menu_move_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $190
+JUMPV
+LABELV $200
+ADDRLP4 0
+ADDRGP4 menu_buzz_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $190
+JUMPV
+LABELV $202
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+GEF4 $203
+ADDRLP4 60
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRF4
+CNSTF4 1065353216
+ADDF4
+ASGNF4
+ADDRLP4 0
+ADDRGP4 menu_move_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $190
+JUMPV
+LABELV $203
+ADDRLP4 0
+ADDRGP4 menu_buzz_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $190
+JUMPV
+LABELV $189
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $190
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $207
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $207
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $207
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $188
+endproc Slider_Key 64 8
+proc Slider_Draw 44 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $211
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $212
+JUMPV
+LABELV $211
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $212
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $213
+ADDRLP4 12
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+ADDRGP4 $214
+JUMPV
+LABELV $213
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $215
+ADDRLP4 12
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 8
+CNSTI4 16400
+ASGNI4
+ADDRGP4 $216
+JUMPV
+LABELV $215
+ADDRLP4 12
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+LABELV $216
+LABELV $214
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+BORI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 UI_SetColor
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 8
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1119879168
+ARGF4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 sliderBar
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 UI_SetColor
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+LEF4 $217
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRF4
+ADDRLP4 40
+INDIRF4
+SUBF4
+DIVF4
+ASGNF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+CNSTF4 0
+GEF4 $219
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 0
+ASGNF4
+ADDRGP4 $218
+JUMPV
+LABELV $219
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+CNSTF4 1065353216
+LEF4 $218
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 1065353216
+ASGNF4
+ADDRGP4 $218
+JUMPV
+LABELV $217
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTF4 0
+ASGNF4
+LABELV $218
+ADDRLP4 8
+INDIRI4
+CNSTI4 16384
+BANDI4
+CNSTI4 0
+EQI4 $223
+ADDRLP4 16
+ADDRGP4 sliderButton_1
+INDIRI4
+ASGNI4
+ADDRGP4 $224
+JUMPV
+LABELV $223
+ADDRLP4 16
+ADDRGP4 sliderButton_0
+INDIRI4
+ASGNI4
+LABELV $224
+ADDRLP4 36
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+ADDI4
+CVIF4 4
+CNSTF4 1116733440
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRF4
+MULF4
+ADDF4
+CVFI4 4
+ADDRLP4 36
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1094713344
+ARGF4
+CNSTF4 1101004800
+ARGF4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $209
+endproc Slider_Draw 44 20
+proc SpinControl_Init 48 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $226
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRGP4 $227
+JUMPV
+LABELV $226
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $227
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+CNSTI4 8
+SUBI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $229
+JUMPV
+LABELV $228
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+LEI4 $231
+ADDRLP4 8
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $231
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $229
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $228
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 8
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 16
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $225
+endproc SpinControl_Init 48 4
+proc SpinControl_Key 32 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 163
+EQI4 $239
+ADDRLP4 8
+CNSTI4 165
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+EQI4 $242
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+GTI4 $246
+LABELV $245
+ADDRLP4 12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 134
+EQI4 $239
+ADDRLP4 12
+INDIRI4
+CNSTI4 135
+EQI4 $242
+ADDRGP4 $234
+JUMPV
+LABELV $246
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $236
+ADDRGP4 $234
+JUMPV
+LABELV $236
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRLP4 20
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+LTI4 $237
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $237
+ADDRLP4 0
+ADDRGP4 menu_move_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $235
+JUMPV
+LABELV $239
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $240
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 menu_move_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $235
+JUMPV
+LABELV $240
+ADDRLP4 0
+ADDRGP4 menu_buzz_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $235
+JUMPV
+LABELV $242
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $243
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRGP4 menu_move_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $235
+JUMPV
+LABELV $243
+ADDRLP4 0
+ADDRGP4 menu_buzz_sound
+INDIRI4
+ASGNI4
+LABELV $234
+LABELV $235
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $247
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $247
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 16
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $247
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $233
+endproc SpinControl_Key 32 8
+proc SpinControl_Draw 48 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 16
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $251
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $252
+JUMPV
+LABELV $251
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $252
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $253
+ADDRLP4 0
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRGP4 $254
+JUMPV
+LABELV $253
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $255
+ADDRLP4 0
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRGP4 $256
+JUMPV
+LABELV $255
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 1
+BANDU4
+CNSTU4 0
+EQU4 $257
+ADDRLP4 0
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRGP4 $258
+JUMPV
+LABELV $257
+ADDRLP4 0
+ADDRGP4 text_color_normal
+ASGNP4
+LABELV $258
+LABELV $256
+LABELV $254
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $259
+ADDRLP4 36
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 40
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRI4
+SUBI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+ADDRLP4 44
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $259
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 2
+BORI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $249
+endproc SpinControl_Draw 48 20
+proc ScrollList_Init 32 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $262
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+CNSTI4 1
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $263
+JUMPV
+LABELV $262
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $264
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+CNSTI4 3
+ASGNI4
+LABELV $264
+LABELV $263
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 8
+INDIRI4
+SUBI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8
+BANDU4
+CNSTU4 0
+EQU4 $266
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+LABELV $266
+LABELV $261
+endproc ScrollList_Init 32 0
+export ScrollList_Key
+proc ScrollList_Key 140 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 160
+LTI4 $352
+ADDRFP4 4
+INDIRI4
+CNSTI4 168
+GTI4 $353
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $354-640
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $354
+address $284
+address $316
+address $294
+address $334
+address $269
+address $343
+address $287
+address $325
+address $305
+code
+LABELV $352
+ADDRFP4 4
+INDIRI4
+CNSTI4 132
+LTI4 $269
+ADDRFP4 4
+INDIRI4
+CNSTI4 144
+GTI4 $269
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $356-528
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $356
+address $316
+address $325
+address $334
+address $343
+address $269
+address $269
+address $269
+address $269
+address $269
+address $305
+address $294
+address $284
+address $287
+code
+LABELV $353
+ADDRFP4 4
+INDIRI4
+CNSTI4 178
+EQI4 $271
+ADDRGP4 $269
+JUMPV
+LABELV $271
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 512
+BANDU4
+CNSTU4 0
+EQU4 $270
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 52
+INDIRI4
+SUBI4
+CNSTI4 3
+LSHI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8
+BANDU4
+CNSTU4 0
+EQU4 $274
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 2
+DIVI4
+SUBI4
+ASGNI4
+LABELV $274
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 4
+LSHI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 UI_CursorInRect
+CALLI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $276
+ADDRLP4 28
+ADDRGP4 uis+8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+SUBI4
+CNSTI4 8
+DIVI4
+ASGNI4
+ADDRLP4 36
+ADDRLP4 28
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ADDI4
+DIVI4
+ASGNI4
+ADDRLP4 32
+ADDRGP4 uis+12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+SUBI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 36
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+MULI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+GEI4 $280
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+EQI4 $282
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $282
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $282
+LABELV $280
+LABELV $276
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $284
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+EQI4 $285
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $285
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $285
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $287
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $288
+ADDRLP4 68
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+ASGNP4
+ADDRLP4 72
+ADDRLP4 68
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRLP4 72
+INDIRI4
+DIVI4
+CNSTI4 1
+ADDI4
+ADDRLP4 72
+INDIRI4
+MULI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ADDRLP4 68
+INDIRP4
+INDIRI4
+MULI4
+SUBI4
+ASGNI4
+ADDRGP4 $289
+JUMPV
+LABELV $288
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+SUBI4
+ASGNI4
+LABELV $289
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $290
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $290
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+EQI4 $292
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $292
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $292
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $294
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $295
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $295
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 0
+LEI4 $297
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $299
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $299
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $301
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $301
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $303
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $303
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $297
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $305
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1
+LEI4 $306
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $306
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $308
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 80
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+LEI4 $310
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $310
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+GEI4 $312
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $312
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $314
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $314
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $308
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $316
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $317
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $317
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 76
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ADDRLP4 76
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+GEI4 $319
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $321
+ADDRLP4 84
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 84
+INDIRP4
+ADDRLP4 84
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 $322
+JUMPV
+LABELV $321
+ADDRLP4 88
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 88
+INDIRP4
+ADDRLP4 88
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $322
+LABELV $319
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $323
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $323
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $325
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+NEI4 $326
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $326
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ADDRLP4 92
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+LTI4 $328
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $330
+ADDRLP4 100
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $331
+JUMPV
+LABELV $330
+ADDRLP4 104
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $331
+LABELV $328
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $332
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $332
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $334
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $335
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $335
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+GEI4 $337
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $337
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 112
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+GEI4 $339
+ADDRLP4 124
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 124
+INDIRP4
+ADDRLP4 124
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $339
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $341
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $341
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $343
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $344
+ADDRGP4 menu_null_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $344
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+LTI4 $346
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $346
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+CNSTI4 1
+SUBI4
+LEI4 $348
+ADDRLP4 136
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ASGNP4
+ADDRLP4 136
+INDIRP4
+ADDRLP4 136
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $348
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $350
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $350
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $269
+LABELV $270
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 Q_isprint
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $358
+CNSTI4 0
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $358
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 Q_isupper
+CALLI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $360
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 -32
+SUBI4
+ASGNI4
+LABELV $360
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $365
+JUMPV
+LABELV $362
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRLP4 8
+INDIRI4
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+MODI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 Q_isupper
+CALLI4
+ASGNI4
+ADDRLP4 60
+INDIRI4
+CNSTI4 0
+EQI4 $366
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -32
+SUBI4
+ASGNI4
+LABELV $366
+ADDRLP4 4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+NEI4 $368
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+GEI4 $370
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+LEI4 $372
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+LABELV $372
+LABELV $371
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+EQI4 $374
+ADDRFP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $376
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $376
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $374
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+ADDRGP4 $268
+JUMPV
+LABELV $368
+LABELV $363
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $365
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+LEI4 $362
+ADDRGP4 menu_buzz_sound
+INDIRI4
+RETI4
+LABELV $268
+endproc ScrollList_Key 140 16
+export ScrollList_Draw
+proc ScrollList_Draw 52 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $380
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRGP4 $381
+JUMPV
+LABELV $380
+ADDRLP4 36
+CNSTI4 0
+ASGNI4
+LABELV $381
+ADDRLP4 28
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $382
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $389
+JUMPV
+LABELV $386
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+LTI4 $390
+ADDRGP4 $388
+JUMPV
+LABELV $390
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRI4
+NEI4 $392
+ADDRLP4 20
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8
+BANDU4
+CNSTU4 0
+EQU4 $394
+ADDRLP4 20
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 2
+DIVI4
+CNSTI4 1
+ADDI4
+SUBI4
+ASGNI4
+LABELV $394
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 3
+LSHI4
+CVIF4 4
+ARGF4
+CNSTF4 1099956224
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 12
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $396
+ADDRLP4 8
+CNSTI4 16400
+ASGNI4
+ADDRGP4 $393
+JUMPV
+LABELV $396
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+ADDRGP4 $393
+JUMPV
+LABELV $392
+ADDRLP4 12
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRLP4 8
+CNSTI4 16
+ASGNI4
+LABELV $393
+ADDRFP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8
+BANDU4
+CNSTU4 0
+EQU4 $398
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+LABELV $398
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $387
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $389
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 84
+ADDP4
+INDIRI4
+ADDI4
+LTI4 $386
+LABELV $388
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 92
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 3
+LSHI4
+ADDI4
+ASGNI4
+LABELV $383
+ADDRLP4 32
+ADDRLP4 32
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $385
+ADDRLP4 32
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 88
+ADDP4
+INDIRI4
+LTI4 $382
+LABELV $378
+endproc ScrollList_Draw 52 20
+export Menu_AddItem
+proc Menu_AddItem 40 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 64
+LTI4 $401
+ADDRGP4 $403
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $401
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 36
+ADDP4
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 40
+ADDP4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRLP4 24
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTI4 -513
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 32768
+BANDU4
+CNSTU4 0
+NEU4 $404
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+LTI4 $406
+ADDRLP4 28
+INDIRI4
+CNSTI4 10
+GTI4 $406
+ADDRLP4 28
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $420-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $420
+address $413
+address $409
+address $411
+address $410
+address $412
+address $414
+address $415
+address $416
+address $417
+address $418
+code
+LABELV $409
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Action_Init
+CALLV
+pop
+ADDRGP4 $407
+JUMPV
+LABELV $410
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 MenuField_Init
+CALLV
+pop
+ADDRGP4 $407
+JUMPV
+LABELV $411
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 SpinControl_Init
+CALLV
+pop
+ADDRGP4 $407
+JUMPV
+LABELV $412
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 RadioButton_Init
+CALLV
+pop
+ADDRGP4 $407
+JUMPV
+LABELV $413
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Slider_Init
+CALLV
+pop
+ADDRGP4 $407
+JUMPV
+LABELV $414
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Bitmap_Init
+CALLV
+pop
+ADDRGP4 $407
+JUMPV
+LABELV $415
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 Text_Init
+CALLV
+pop
+ADDRGP4 $407
+JUMPV
+LABELV $416
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 ScrollList_Init
+CALLV
+pop
+ADDRGP4 $407
+JUMPV
+LABELV $417
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 PText_Init
+CALLV
+pop
+ADDRGP4 $407
+JUMPV
+LABELV $418
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 BText_Init
+CALLV
+pop
+ADDRGP4 $407
+JUMPV
+LABELV $406
+ADDRGP4 $419
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 36
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $407
+LABELV $404
+ADDRLP4 28
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $400
+endproc Menu_AddItem 40 8
+export Menu_CursorMoved
+proc Menu_CursorMoved 32 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+NEI4 $423
+ADDRGP4 $422
+JUMPV
+LABELV $423
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $425
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+GEI4 $425
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $427
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CALLV
+pop
+LABELV $427
+LABELV $425
+ADDRLP4 20
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+LTI4 $429
+ADDRLP4 20
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+GEI4 $429
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $431
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRLP4 0
+INDIRP4
+CALLV
+pop
+LABELV $431
+LABELV $429
+LABELV $422
+endproc Menu_CursorMoved 32 8
+export Menu_SetCursor
+proc Menu_SetCursor 4 4
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 24576
+BANDU4
+CNSTU4 0
+EQU4 $434
+ADDRGP4 $433
+JUMPV
+LABELV $434
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_CursorMoved
+CALLV
+pop
+LABELV $433
+endproc Menu_SetCursor 4 4
+export Menu_SetCursorToItem
+proc Menu_SetCursorToItem 4 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $440
+JUMPV
+LABELV $437
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRFP4 4
+INDIRP4
+CVPU4 4
+NEU4 $441
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Menu_SetCursor
+CALLV
+pop
+ADDRGP4 $436
+JUMPV
+LABELV $441
+LABELV $438
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $440
+ADDRLP4 0
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $437
+LABELV $436
+endproc Menu_SetCursorToItem 4 8
+export Menu_AdjustCursor
+proc Menu_AdjustCursor 24 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTP4 0
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $446
+JUMPV
+LABELV $445
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 26624
+BANDU4
+CNSTU4 0
+EQU4 $447
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $449
+LABELV $446
+ADDRLP4 12
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LTI4 $450
+ADDRLP4 12
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $445
+LABELV $450
+LABELV $447
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $451
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $452
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $455
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $457
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $443
+JUMPV
+LABELV $457
+ADDRFP4 0
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $446
+JUMPV
+LABELV $455
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $452
+JUMPV
+LABELV $451
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 0
+GEI4 $459
+ADDRFP4 0
+INDIRP4
+CNSTI4 276
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $461
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $463
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $443
+JUMPV
+LABELV $463
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $446
+JUMPV
+LABELV $461
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+LABELV $459
+LABELV $452
+LABELV $443
+endproc Menu_AdjustCursor 24 0
+export Menu_Draw
+proc Menu_Draw 40 20
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $469
+JUMPV
+LABELV $466
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 4096
+BANDU4
+CNSTU4 0
+EQU4 $470
+ADDRGP4 $467
+JUMPV
+LABELV $470
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $472
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 56
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRGP4 $473
+JUMPV
+LABELV $472
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $474
+ADDRLP4 8
+INDIRI4
+CNSTI4 10
+GTI4 $474
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $488-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $488
+address $479
+address $481
+address $480
+address $478
+address $477
+address $482
+address $483
+address $484
+address $485
+address $486
+code
+LABELV $477
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 RadioButton_Draw
+CALLV
+pop
+ADDRGP4 $475
+JUMPV
+LABELV $478
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 MenuField_Draw
+CALLV
+pop
+ADDRGP4 $475
+JUMPV
+LABELV $479
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Slider_Draw
+CALLV
+pop
+ADDRGP4 $475
+JUMPV
+LABELV $480
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 SpinControl_Draw
+CALLV
+pop
+ADDRGP4 $475
+JUMPV
+LABELV $481
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Action_Draw
+CALLV
+pop
+ADDRGP4 $475
+JUMPV
+LABELV $482
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bitmap_Draw
+CALLV
+pop
+ADDRGP4 $475
+JUMPV
+LABELV $483
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Text_Draw
+CALLV
+pop
+ADDRGP4 $475
+JUMPV
+LABELV $484
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 ScrollList_Draw
+CALLV
+pop
+ADDRGP4 $475
+JUMPV
+LABELV $485
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 PText_Draw
+CALLV
+pop
+ADDRGP4 $475
+JUMPV
+LABELV $486
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 BText_Draw
+CALLV
+pop
+ADDRGP4 $475
+JUMPV
+LABELV $474
+ADDRGP4 $487
+ARGP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 trap_Error
+CALLV
+pop
+LABELV $475
+LABELV $473
+ADDRGP4 uis+11388
+INDIRI4
+CNSTI4 0
+EQI4 $490
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 16384
+BANDU4
+CNSTU4 0
+NEU4 $493
+ADDRLP4 28
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 32
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+SUBI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRP4
+INDIRI4
+SUBI4
+ADDRLP4 36
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 512
+BANDU4
+CNSTU4 0
+EQU4 $495
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 colorYellow
+ARGP4
+ADDRGP4 UI_DrawRect
+CALLV
+pop
+ADDRGP4 $496
+JUMPV
+LABELV $495
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawRect
+CALLV
+pop
+LABELV $496
+LABELV $493
+LABELV $490
+LABELV $467
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $469
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $466
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 16
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+EQU4 $497
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CVPU4 4
+ADDRLP4 16
+INDIRU4
+EQU4 $497
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 52
+ADDP4
+INDIRP4
+CALLV
+pop
+LABELV $497
+LABELV $465
+endproc Menu_Draw 40 20
+export Menu_ItemAtCursor
+proc Menu_ItemAtCursor 12 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+LTI4 $502
+ADDRLP4 4
+INDIRI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+LTI4 $500
+LABELV $502
+CNSTP4 0
+RETP4
+ADDRGP4 $499
+JUMPV
+LABELV $500
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+ADDP4
+INDIRP4
+RETP4
+LABELV $499
+endproc Menu_ItemAtCursor 12 0
+export Menu_ActivateItem
+proc Menu_ActivateItem 4 8
+ADDRFP4 4
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $504
+ADDRLP4 0
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 48
+ADDP4
+INDIRP4
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 1048576
+BANDU4
+CNSTU4 0
+NEU4 $506
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $503
+JUMPV
+LABELV $506
+LABELV $504
+CNSTI4 0
+RETI4
+LABELV $503
+endproc Menu_ActivateItem 4 8
+export Menu_DefaultKey
+proc Menu_DefaultKey 108 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 27
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+EQI4 $511
+ADDRLP4 12
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $509
+LABELV $512
+ADDRFP4 4
+INDIRI4
+CNSTI4 179
+EQI4 $511
+ADDRGP4 $509
+JUMPV
+LABELV $511
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 menu_out_sound
+INDIRI4
+RETI4
+ADDRGP4 $508
+JUMPV
+LABELV $509
+ADDRFP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $515
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $513
+LABELV $515
+CNSTI4 0
+RETI4
+ADDRGP4 $508
+JUMPV
+LABELV $513
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTU4 0
+ASGNU4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+ADDRLP4 32
+INDIRU4
+EQU4 $516
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 24576
+BANDU4
+ADDRLP4 32
+INDIRU4
+NEU4 $516
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 1
+LTI4 $518
+ADDRLP4 36
+INDIRI4
+CNSTI4 8
+GTI4 $518
+ADDRLP4 36
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $526-4
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $526
+address $523
+address $518
+address $521
+address $525
+address $522
+address $518
+address $518
+address $524
+code
+LABELV $521
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 SpinControl_Key
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $519
+JUMPV
+LABELV $522
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 48
+ADDRGP4 RadioButton_Key
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $519
+JUMPV
+LABELV $523
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 Slider_Key
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 $519
+JUMPV
+LABELV $524
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 56
+ADDRGP4 ScrollList_Key
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $519
+JUMPV
+LABELV $525
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 4
+ARGP4
+ADDRLP4 60
+ADDRGP4 MenuField_Key
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+LABELV $518
+LABELV $519
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+EQI4 $528
+ADDRLP4 4
+INDIRI4
+RETI4
+ADDRGP4 $508
+JUMPV
+LABELV $528
+LABELV $516
+ADDRLP4 36
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+CNSTI4 155
+EQI4 $532
+ADDRLP4 40
+CNSTI4 156
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $534
+ADDRLP4 36
+INDIRI4
+ADDRLP4 40
+INDIRI4
+GTI4 $553
+LABELV $552
+ADDRLP4 44
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 13
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRLP4 48
+INDIRI4
+EQI4 $547
+ADDRLP4 44
+INDIRI4
+ADDRLP4 48
+INDIRI4
+GTI4 $555
+LABELV $554
+ADDRFP4 4
+INDIRI4
+CNSTI4 9
+EQI4 $539
+ADDRGP4 $530
+JUMPV
+LABELV $555
+ADDRLP4 52
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 132
+EQI4 $536
+ADDRLP4 52
+INDIRI4
+CNSTI4 133
+EQI4 $539
+ADDRGP4 $530
+JUMPV
+LABELV $553
+ADDRLP4 56
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 56
+INDIRI4
+CNSTI4 167
+EQI4 $539
+ADDRLP4 60
+CNSTI4 169
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+EQI4 $547
+ADDRLP4 56
+INDIRI4
+ADDRLP4 60
+INDIRI4
+GTI4 $557
+LABELV $556
+ADDRFP4 4
+INDIRI4
+CNSTI4 161
+EQI4 $536
+ADDRGP4 $530
+JUMPV
+LABELV $557
+ADDRLP4 64
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 178
+LTI4 $530
+ADDRLP4 64
+INDIRI4
+CNSTI4 188
+GTI4 $558
+ADDRLP4 64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $559-712
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $559
+address $542
+address $530
+address $542
+address $530
+address $530
+address $530
+address $530
+address $547
+address $547
+address $547
+address $547
+code
+LABELV $558
+ADDRLP4 68
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 217
+LTI4 $530
+ADDRLP4 68
+INDIRI4
+CNSTI4 232
+GTI4 $530
+ADDRLP4 68
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $561-868
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $561
+address $547
+address $547
+address $547
+address $547
+address $547
+address $547
+address $547
+address $547
+address $547
+address $547
+address $547
+address $547
+address $547
+address $547
+address $547
+address $547
+code
+LABELV $532
+ADDRLP4 72
+ADDRGP4 uis+11388
+ASGNP4
+ADDRLP4 72
+INDIRP4
+ADDRLP4 72
+INDIRP4
+INDIRI4
+CNSTI4 1
+BXORI4
+ASGNI4
+ADDRGP4 $531
+JUMPV
+LABELV $534
+CNSTI4 2
+ARGI4
+ADDRGP4 $535
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $531
+JUMPV
+LABELV $536
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 -1
+ARGI4
+ADDRGP4 Menu_AdjustCursor
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+EQI4 $531
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_CursorMoved
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 menu_move_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $531
+JUMPV
+LABELV $539
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 Menu_AdjustCursor
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ADDRFP4 0
+INDIRP4
+INDIRI4
+EQI4 $531
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Menu_CursorMoved
+CALLV
+pop
+ADDRLP4 4
+ADDRGP4 menu_move_sound
+INDIRI4
+ASGNI4
+ADDRGP4 $531
+JUMPV
+LABELV $542
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $531
+ADDRLP4 92
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+ASGNU4
+ADDRLP4 96
+CNSTU4 0
+ASGNU4
+ADDRLP4 92
+INDIRU4
+CNSTU4 512
+BANDU4
+ADDRLP4 96
+INDIRU4
+EQU4 $531
+ADDRLP4 92
+INDIRU4
+CNSTU4 24576
+BANDU4
+ADDRLP4 96
+INDIRU4
+NEU4 $531
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 100
+ADDRGP4 Menu_ActivateItem
+CALLI4
+ASGNI4
+ADDRLP4 100
+INDIRI4
+RETI4
+ADDRGP4 $508
+JUMPV
+LABELV $547
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $531
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 26624
+BANDU4
+CNSTU4 0
+NEU4 $531
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 104
+ADDRGP4 Menu_ActivateItem
+CALLI4
+ASGNI4
+ADDRLP4 104
+INDIRI4
+RETI4
+ADDRGP4 $508
+JUMPV
+LABELV $530
+LABELV $531
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $508
+endproc Menu_DefaultKey 108 8
+export Menu_Cache
+proc Menu_Cache 68 8
+ADDRGP4 $565
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11404
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $567
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11408
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $569
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11412
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $571
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11416
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $573
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11420
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $575
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11424
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $577
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11428
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $579
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11392
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 uis+56+11288
+INDIRI4
+CNSTI4 3
+NEI4 $580
+ADDRGP4 $585
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11396
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $581
+JUMPV
+LABELV $580
+ADDRGP4 $587
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11396
+ADDRLP4 32
+INDIRI4
+ASGNI4
+LABELV $581
+ADDRGP4 $589
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 uis+11400
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $590
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 36
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 menu_in_sound
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRGP4 $591
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 40
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 menu_move_sound
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRGP4 $592
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 44
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 menu_out_sound
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 $593
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 48
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 menu_buzz_sound
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRGP4 $594
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 52
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRGP4 weaponChangeSound
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRGP4 menu_null_sound
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $595
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 sliderBar
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRGP4 $596
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 sliderButton_0
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRGP4 $597
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 sliderButton_1
+ADDRLP4 64
+INDIRI4
+ASGNI4
+LABELV $563
+endproc Menu_Cache 68 8
+bss
+align 4
+LABELV sliderButton_1
+skip 4
+align 4
+LABELV sliderButton_0
+skip 4
+align 4
+LABELV sliderBar
+skip 4
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import list_color
+import name_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+export weaponChangeSound
+align 4
+LABELV weaponChangeSound
+skip 4
+export menu_null_sound
+align 4
+LABELV menu_null_sound
+skip 4
+export menu_buzz_sound
+align 4
+LABELV menu_buzz_sound
+skip 4
+export menu_out_sound
+align 4
+LABELV menu_out_sound
+skip 4
+export menu_move_sound
+align 4
+LABELV menu_move_sound
+skip 4
+export menu_in_sound
+align 4
+LABELV menu_in_sound
+skip 4
+import Menu_Focus
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $597
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $596
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 98
+byte 1 117
+byte 1 116
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $595
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 108
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $594
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 119
+byte 1 101
+byte 1 97
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 47
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 110
+byte 1 103
+byte 1 101
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $593
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 52
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $592
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 51
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $591
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 50
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $590
+byte 1 115
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 47
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 99
+byte 1 47
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 49
+byte 1 46
+byte 1 119
+byte 1 97
+byte 1 118
+byte 1 0
+align 1
+LABELV $589
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 0
+align 1
+LABELV $587
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 0
+align 1
+LABELV $585
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 82
+byte 1 97
+byte 1 103
+byte 1 101
+byte 1 80
+byte 1 114
+byte 1 111
+byte 1 0
+align 1
+LABELV $579
+byte 1 119
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $577
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 95
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $575
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 119
+byte 1 105
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 95
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $573
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 51
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 114
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 50
+byte 1 0
+align 1
+LABELV $571
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 50
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $569
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 95
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $567
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 111
+byte 1 110
+byte 1 116
+byte 1 49
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 112
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $565
+byte 1 103
+byte 1 102
+byte 1 120
+byte 1 47
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 98
+byte 1 105
+byte 1 103
+byte 1 99
+byte 1 104
+byte 1 97
+byte 1 114
+byte 1 115
+byte 1 0
+align 1
+LABELV $535
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $487
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 68
+byte 1 114
+byte 1 97
+byte 1 119
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $419
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 73
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 32
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 32
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $403
+byte 1 77
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 95
+byte 1 65
+byte 1 100
+byte 1 100
+byte 1 73
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 58
+byte 1 32
+byte 1 101
+byte 1 120
+byte 1 99
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 32
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 109
+byte 1 115
+byte 1 0
+align 1
+LABELV $184
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $182
+byte 1 111
+byte 1 102
+byte 1 102
+byte 1 0
@@ -0,0 +1,7052 @@
+data
+align 4
+LABELV master_items
+address $68
+address $69
+address $70
+address $71
+address $72
+address $73
+address $74
+byte 4 0
+align 4
+LABELV servertype_items
+address $75
+address $76
+address $77
+address $78
+address $79
+byte 4 0
+align 4
+LABELV sortkey_items
+address $80
+address $81
+address $82
+address $83
+address $84
+byte 4 0
+align 4
+LABELV gamenames
+address $85
+address $86
+address $87
+address $88
+address $89
+address $90
+address $91
+address $92
+address $93
+address $94
+address $95
+address $96
+address $97
+byte 4 0
+align 4
+LABELV netnames
+address $97
+address $98
+address $99
+byte 4 0
+align 1
+LABELV quake3worldMessage
+byte 1 86
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 119
+byte 1 119
+byte 1 119
+byte 1 46
+byte 1 113
+byte 1 117
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 51
+byte 1 119
+byte 1 111
+byte 1 114
+byte 1 108
+byte 1 100
+byte 1 46
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 45
+byte 1 32
+byte 1 78
+byte 1 101
+byte 1 119
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 67
+byte 1 111
+byte 1 109
+byte 1 109
+byte 1 117
+byte 1 110
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 44
+byte 1 32
+byte 1 69
+byte 1 118
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 44
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 0
+export punkbuster_items
+align 4
+LABELV punkbuster_items
+address $100
+address $101
+byte 4 0
+export punkbuster_msg
+align 4
+LABELV punkbuster_msg
+address $102
+address $103
+address $104
+address $105
+byte 4 0
+code
+proc ArenaServers_MaxPing 8 4
+ADDRGP4 $110
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+GEI4 $111
+ADDRLP4 0
+CNSTI4 100
+ASGNI4
+LABELV $111
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $109
+endproc ArenaServers_MaxPing 8 4
+proc ArenaServers_Compare 68 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 g_sortkey
+INDIRI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+LTI4 $114
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+GTI4 $114
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $137
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $137
+address $116
+address $117
+address $118
+address $127
+address $132
+code
+LABELV $116
+ADDRLP4 20
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 20
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+RETI4
+ADDRGP4 $113
+JUMPV
+LABELV $117
+ADDRLP4 28
+CNSTI4 89
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 28
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+RETI4
+ADDRGP4 $113
+JUMPV
+LABELV $118
+ADDRLP4 36
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 36
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ADDRLP4 36
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 8
+INDIRF4
+CNSTF4 0
+GEF4 $119
+ADDRLP4 8
+CNSTF4 0
+ASGNF4
+LABELV $119
+ADDRLP4 40
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 40
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+SUBI4
+CVIF4 4
+ASGNF4
+ADDRLP4 12
+INDIRF4
+CNSTF4 0
+GEF4 $121
+ADDRLP4 12
+CNSTF4 0
+ASGNF4
+LABELV $121
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+GEF4 $123
+CNSTI4 1
+RETI4
+ADDRGP4 $113
+JUMPV
+LABELV $123
+ADDRLP4 8
+INDIRF4
+ADDRLP4 12
+INDIRF4
+NEF4 $125
+CNSTI4 0
+RETI4
+ADDRGP4 $113
+JUMPV
+LABELV $125
+CNSTI4 -1
+RETI4
+ADDRGP4 $113
+JUMPV
+LABELV $127
+ADDRLP4 44
+CNSTI4 120
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $128
+CNSTI4 -1
+RETI4
+ADDRGP4 $113
+JUMPV
+LABELV $128
+ADDRLP4 48
+CNSTI4 120
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 48
+INDIRI4
+ADDP4
+INDIRI4
+NEI4 $130
+CNSTI4 0
+RETI4
+ADDRGP4 $113
+JUMPV
+LABELV $130
+CNSTI4 1
+RETI4
+ADDRGP4 $113
+JUMPV
+LABELV $132
+ADDRLP4 52
+CNSTI4 116
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 52
+INDIRI4
+ADDP4
+INDIRI4
+GEI4 $133
+CNSTI4 -1
+RETI4
+ADDRGP4 $113
+JUMPV
+LABELV $133
+ADDRLP4 56
+CNSTI4 116
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 56
+INDIRI4
+ADDP4
+INDIRI4
+LEI4 $135
+CNSTI4 1
+RETI4
+ADDRGP4 $113
+JUMPV
+LABELV $135
+ADDRLP4 60
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 60
+INDIRI4
+ADDP4
+ARGP4
+ADDRLP4 64
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+RETI4
+ADDRGP4 $113
+JUMPV
+LABELV $114
+CNSTI4 0
+RETI4
+LABELV $113
+endproc ArenaServers_Compare 68 8
+proc ArenaServers_Go 8 8
+ADDRLP4 0
+CNSTI4 72
+ADDRGP4 g_arenaservers+776+64
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+4072+68
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $143
+ADDRGP4 $145
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $143
+LABELV $138
+endproc ArenaServers_Go 8 8
+bss
+align 1
+LABELV $147
+skip 64
+code
+proc ArenaServers_UpdatePicture 4 16
+ADDRGP4 g_arenaservers+776+68
+INDIRI4
+CNSTI4 0
+NEI4 $148
+ADDRGP4 g_arenaservers+872+4
+CNSTP4 0
+ASGNP4
+ADDRGP4 $149
+JUMPV
+LABELV $148
+ADDRLP4 0
+CNSTI4 72
+ADDRGP4 g_arenaservers+776+64
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+4072+68
+ADDP4
+INDIRP4
+ASGNP4
+ADDRGP4 $147
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 89
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 g_arenaservers+872+4
+ADDRGP4 $147
+ASGNP4
+LABELV $149
+ADDRGP4 g_arenaservers+872+68
+CNSTI4 0
+ASGNI4
+LABELV $146
+endproc ArenaServers_UpdatePicture 4 16
+proc ArenaServers_UpdateMenu 68 48
+ADDRGP4 g_arenaservers+13800
+INDIRI4
+CNSTI4 0
+LEI4 $164
+ADDRGP4 g_arenaservers+13816
+INDIRI4
+CNSTI4 0
+EQI4 $167
+ADDRGP4 g_arenaservers+13812
+INDIRI4
+ADDRGP4 g_arenaservers+13800
+INDIRI4
+GTI4 $167
+ADDRGP4 g_arenaservers+1224+60
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $174
+ARGP4
+ADDRGP4 g_arenaservers+13812
+INDIRI4
+ARGI4
+ADDRGP4 g_arenaservers+13800
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 g_arenaservers+1296+60
+ADDRGP4 $179
+ASGNP4
+ADDRGP4 g_arenaservers+13808
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 152
+ARGI4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRGP4 $165
+JUMPV
+LABELV $167
+ADDRLP4 28
+ADDRGP4 g_arenaservers+360+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 32
+ADDRGP4 g_arenaservers+456+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 g_arenaservers+552+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 g_arenaservers+712+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+648+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+776+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+1544+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+1808+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_arenaservers+14860+44
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 64
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+CNSTI4 1
+LTI4 $200
+ADDRLP4 64
+INDIRI4
+CNSTI4 5
+GTI4 $200
+ADDRGP4 g_arenaservers+1296+60
+ADDRGP4 quake3worldMessage
+ASGNP4
+ADDRGP4 $165
+JUMPV
+LABELV $200
+ADDRGP4 g_arenaservers+1296+60
+ADDRGP4 $206
+ASGNP4
+ADDRGP4 $165
+JUMPV
+LABELV $164
+ADDRGP4 g_arenaservers+13816
+INDIRI4
+CNSTI4 0
+EQI4 $207
+ADDRGP4 g_arenaservers+1224+60
+INDIRP4
+ARGP4
+ADDRGP4 $212
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 g_arenaservers+1296+60
+ADDRGP4 $179
+ASGNP4
+ADDRLP4 28
+ADDRGP4 g_arenaservers+360+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 32
+ADDRGP4 g_arenaservers+456+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 g_arenaservers+552+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 g_arenaservers+712+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+648+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+776+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+1544+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+1808+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_arenaservers+14860+44
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $208
+JUMPV
+LABELV $207
+ADDRGP4 g_arenaservers+13800
+INDIRI4
+CNSTI4 0
+GEI4 $233
+ADDRGP4 g_arenaservers+1224+60
+INDIRP4
+ARGP4
+ADDRGP4 $238
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $234
+JUMPV
+LABELV $233
+ADDRGP4 g_arenaservers+1224+60
+INDIRP4
+ARGP4
+ADDRGP4 $241
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $234
+ADDRLP4 28
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+LTI4 $242
+ADDRLP4 28
+INDIRI4
+CNSTI4 5
+GTI4 $242
+ADDRGP4 g_arenaservers+1296+60
+ADDRGP4 quake3worldMessage
+ASGNP4
+ADDRGP4 $243
+JUMPV
+LABELV $242
+ADDRGP4 g_arenaservers+1296+60
+ADDRGP4 $206
+ASGNP4
+LABELV $243
+ADDRLP4 32
+ADDRGP4 g_arenaservers+360+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 g_arenaservers+456+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 g_arenaservers+552+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 44
+ADDRGP4 g_arenaservers+712+44
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ADDRLP4 44
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 48
+ADDRGP4 g_arenaservers+648+44
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 52
+ADDRGP4 g_arenaservers+776+44
+ASGNP4
+ADDRLP4 52
+INDIRP4
+ADDRLP4 52
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 56
+ADDRGP4 g_arenaservers+1544+44
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ADDRLP4 56
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 60
+ADDRGP4 g_arenaservers+1808+44
+ASGNP4
+ADDRLP4 60
+INDIRP4
+ADDRLP4 60
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRLP4 64
+ADDRGP4 g_arenaservers+14860+44
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ADDRLP4 64
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $208
+ADDRGP4 g_arenaservers+776+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+776+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+776+72
+CNSTI4 0
+ASGNI4
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+ADDRGP4 $163
+JUMPV
+LABELV $165
+ADDRLP4 0
+ADDRGP4 g_arenaservers+13808
+INDIRP4
+ASGNP4
+ADDRLP4 24
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRGP4 $277
+JUMPV
+LABELV $274
+ADDRLP4 4
+CNSTI4 72
+ADDRLP4 8
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+4072
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_emptyservers
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $279
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ADDRLP4 32
+INDIRI4
+NEI4 $279
+ADDRGP4 $275
+JUMPV
+LABELV $279
+ADDRGP4 g_fullservers
+INDIRI4
+CNSTI4 0
+NEI4 $281
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+NEI4 $281
+ADDRGP4 $275
+JUMPV
+LABELV $281
+ADDRLP4 40
+ADDRGP4 g_gametype
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CNSTI4 0
+LTI4 $283
+ADDRLP4 40
+INDIRI4
+CNSTI4 4
+GTI4 $283
+ADDRLP4 40
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $298
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $298
+address $284
+address $286
+address $289
+address $292
+address $295
+code
+LABELV $286
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $284
+ADDRGP4 $275
+JUMPV
+LABELV $289
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 3
+EQI4 $284
+ADDRGP4 $275
+JUMPV
+LABELV $292
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $284
+ADDRGP4 $275
+JUMPV
+LABELV $295
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+INDIRI4
+CNSTI4 4
+EQI4 $284
+ADDRGP4 $275
+JUMPV
+LABELV $283
+LABELV $284
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+INDIRI4
+GEI4 $299
+ADDRLP4 20
+ADDRGP4 $301
+ASGNP4
+ADDRGP4 $300
+JUMPV
+LABELV $299
+ADDRLP4 52
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 52
+INDIRI4
+CNSTI4 0
+EQI4 $302
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ADDRLP4 52
+INDIRI4
+LEI4 $302
+ADDRLP4 20
+ADDRGP4 $301
+ASGNP4
+ADDRGP4 $303
+JUMPV
+LABELV $302
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 200
+GEI4 $304
+ADDRLP4 20
+ADDRGP4 $306
+ASGNP4
+ADDRGP4 $305
+JUMPV
+LABELV $304
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+CNSTI4 400
+GEI4 $307
+ADDRLP4 20
+ADDRGP4 $309
+ASGNP4
+ADDRGP4 $308
+JUMPV
+LABELV $307
+ADDRLP4 20
+ADDRGP4 $310
+ASGNP4
+LABELV $308
+LABELV $305
+LABELV $303
+LABELV $300
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 68
+ARGI4
+ADDRGP4 $311
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 89
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 netnames
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $315
+ADDRLP4 56
+ADDRGP4 $312
+ASGNP4
+ADDRGP4 $316
+JUMPV
+LABELV $315
+ADDRLP4 56
+ADDRGP4 $313
+ASGNP4
+LABELV $316
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $275
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 152
+ADDP4
+ASGNP4
+LABELV $277
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LTI4 $274
+ADDRGP4 g_arenaservers+776+68
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+776+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+776+72
+CNSTI4 0
+ASGNI4
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+LABELV $163
+endproc ArenaServers_UpdateMenu 68 48
+proc ArenaServers_Remove 28 12
+ADDRGP4 g_arenaservers+776+68
+INDIRI4
+CNSTI4 0
+NEI4 $324
+ADDRGP4 $323
+JUMPV
+LABELV $324
+ADDRLP4 8
+CNSTI4 72
+ADDRGP4 g_arenaservers+776+64
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+4072
+ADDP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 8
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $334
+JUMPV
+LABELV $331
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+13832
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+NEI4 $336
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $339
+ADDRLP4 20
+CNSTI4 6
+ASGNI4
+ADDRLP4 24
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 g_arenaservers+13832
+ADDP4
+ARGP4
+ADDRLP4 24
+INDIRI4
+ADDRGP4 g_arenaservers+13832+64
+ADDP4
+ARGP4
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+ADDRLP4 20
+INDIRI4
+LSHI4
+CNSTI4 64
+SUBI4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $339
+ADDRLP4 16
+ADDRGP4 g_arenaservers+14856
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+13832
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 64
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $333
+JUMPV
+LABELV $336
+LABELV $332
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $334
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+LTI4 $331
+LABELV $333
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $352
+JUMPV
+LABELV $349
+CNSTI4 152
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $353
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $355
+ADDRLP4 16
+CNSTI4 152
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ADDRGP4 g_favoriteserverlist+152
+ADDP4
+ARGP4
+CNSTU4 152
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ADDRLP4 0
+INDIRI4
+SUBI4
+CNSTI4 1
+SUBI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $355
+ADDRLP4 12
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 152
+ASGNI4
+ADDRLP4 16
+INDIRI4
+ADDRLP4 12
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $351
+JUMPV
+LABELV $353
+LABELV $350
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $352
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+LTI4 $349
+LABELV $351
+ADDRGP4 g_arenaservers+13800
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+13812
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+ASGNI4
+LABELV $323
+endproc ArenaServers_Remove 28 12
+proc ArenaServers_Insert 84 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRP4
+ASGNP4
+ADDRLP4 12
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 12
+INDIRI4
+LTI4 $363
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 6
+EQI4 $363
+ADDRGP4 $362
+JUMPV
+LABELV $363
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+ADDRGP4 g_arenaservers+13824
+INDIRI4
+LTI4 $365
+ADDRLP4 0
+CNSTI4 152
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+13808
+INDIRP4
+ADDP4
+CNSTI4 -152
+ADDP4
+ASGNP4
+ADDRGP4 $366
+JUMPV
+LABELV $365
+ADDRLP4 0
+CNSTI4 152
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+13808
+INDIRP4
+ADDP4
+ASGNP4
+ADDRLP4 16
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $366
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $374
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+CNSTI4 22
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $375
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 89
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 89
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 0
+INDIRP4
+CNSTI4 89
+ADDP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $376
+ARGP4
+ADDRLP4 24
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 108
+ADDP4
+ADDRLP4 28
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $377
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 112
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 116
+ADDP4
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $378
+ARGP4
+ADDRLP4 40
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 140
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $379
+ARGP4
+ADDRLP4 48
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ARGP4
+ADDRLP4 52
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 144
+ADDP4
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $380
+ARGP4
+ADDRLP4 56
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 56
+INDIRP4
+ARGP4
+ADDRLP4 60
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 148
+ADDP4
+ADDRLP4 60
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 64
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+ADDRLP4 68
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 136
+ADDP4
+ADDRLP4 68
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $382
+ARGP4
+ADDRLP4 72
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 72
+INDIRP4
+ASGNP4
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $383
+ARGP4
+ADDRLP4 76
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 76
+INDIRP4
+ARGP4
+ADDRLP4 80
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 0
+GEI4 $384
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $385
+JUMPV
+LABELV $384
+ADDRLP4 4
+INDIRI4
+CNSTI4 11
+LEI4 $386
+ADDRLP4 4
+CNSTI4 12
+ASGNI4
+LABELV $386
+LABELV $385
+ADDRLP4 8
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $388
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $389
+JUMPV
+LABELV $388
+ADDRLP4 0
+INDIRP4
+CNSTI4 120
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 124
+ADDP4
+ARGP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gamenames
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 12
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $389
+LABELV $362
+endproc ArenaServers_Insert 84 12
+export ArenaServers_InsertFavorites
+proc ArenaServers_InsertFavorites 1040 12
+ADDRLP4 8
+CNSTI1 0
+ASGNI1
+ADDRLP4 8
+ARGP4
+ADDRGP4 $374
+ARGP4
+ADDRGP4 $391
+ARGP4
+ADDRGP4 Info_SetValueForKey
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $395
+JUMPV
+LABELV $392
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $400
+JUMPV
+LABELV $397
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+13832
+ADDP4
+ARGP4
+CNSTI4 152
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 1032
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1032
+INDIRI4
+CNSTI4 0
+NEI4 $401
+ADDRGP4 $399
+JUMPV
+LABELV $401
+LABELV $398
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $400
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+LTI4 $397
+LABELV $399
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+LTI4 $404
+ADDRLP4 1036
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+13832
+ADDP4
+ARGP4
+ADDRLP4 8
+ARGP4
+ADDRLP4 1036
+INDIRI4
+ARGI4
+ADDRGP4 ArenaServers_Insert
+CALLV
+pop
+LABELV $404
+LABELV $393
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $395
+ADDRLP4 4
+INDIRI4
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+LTI4 $392
+LABELV $390
+endproc ArenaServers_InsertFavorites 1040 12
+export ArenaServers_LoadFavorites
+proc ArenaServers_LoadFavorites 3556 12
+ADDRLP4 2508
+CNSTI4 0
+ASGNI4
+ADDRLP4 2512
+CNSTI1 0
+ASGNI1
+ADDRLP4 72
+ARGP4
+ADDRGP4 g_favoriteserverlist
+ARGP4
+CNSTI4 2432
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 68
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ASGNI4
+ADDRGP4 g_favoriteserverlist
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2432
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 3536
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_numfavoriteservers
+ADDRLP4 3536
+INDIRI4
+ASGNI4
+ADDRLP4 2504
+ADDRLP4 3536
+INDIRI4
+ASGNI4
+LABELV $408
+ADDRGP4 $412
+ARGP4
+ADDRLP4 2504
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 3540
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 3540
+INDIRP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $413
+ADDRGP4 $409
+JUMPV
+LABELV $413
+ADDRLP4 3544
+ADDRLP4 4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 3544
+INDIRI4
+CNSTI4 48
+LTI4 $417
+ADDRLP4 3544
+INDIRI4
+CNSTI4 57
+LEI4 $415
+LABELV $417
+ADDRGP4 $409
+JUMPV
+LABELV $415
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+13832
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $422
+JUMPV
+LABELV $419
+CNSTI4 152
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 72
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 3548
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 3548
+INDIRI4
+CNSTI4 0
+NEI4 $423
+ADDRGP4 $421
+JUMPV
+LABELV $423
+LABELV $420
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $422
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+LTI4 $419
+LABELV $421
+ADDRLP4 0
+INDIRI4
+ADDRLP4 68
+INDIRI4
+GEI4 $425
+ADDRLP4 3552
+CNSTI4 152
+ASGNI4
+ADDRLP4 3552
+INDIRI4
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 3552
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 72
+ADDP4
+ARGP4
+ADDRLP4 3552
+INDIRI4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 2508
+CNSTI4 1
+ASGNI4
+ADDRGP4 $426
+JUMPV
+LABELV $425
+CNSTI4 152
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 3552
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+CNSTI4 152
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+MULI4
+ADDRGP4 g_favoriteserverlist+116
+ADDP4
+ADDRLP4 3552
+INDIRI4
+ASGNI4
+LABELV $426
+ADDRLP4 3552
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRLP4 3552
+INDIRP4
+ADDRLP4 3552
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $409
+ADDRLP4 2504
+ADDRLP4 2504
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 2504
+INDIRI4
+CNSTI4 16
+LTI4 $408
+ADDRGP4 g_arenaservers+14856
+ADDRGP4 g_numfavoriteservers
+INDIRI4
+ASGNI4
+ADDRLP4 2508
+INDIRI4
+CNSTI4 0
+NEI4 $429
+ADDRGP4 g_numfavoriteservers
+CNSTI4 0
+ASGNI4
+LABELV $429
+LABELV $407
+endproc ArenaServers_LoadFavorites 3556 12
+proc ArenaServers_StopRefresh 0 16
+ADDRGP4 g_arenaservers+13816
+INDIRI4
+CNSTI4 0
+NEI4 $432
+ADDRGP4 $431
+JUMPV
+LABELV $432
+ADDRGP4 g_arenaservers+13816
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 6
+NEI4 $436
+ADDRGP4 ArenaServers_InsertFavorites
+CALLV
+pop
+LABELV $436
+ADDRGP4 g_arenaservers+13800
+INDIRI4
+CNSTI4 0
+LTI4 $438
+ADDRGP4 g_arenaservers+13812
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+13800
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+ASGNI4
+LABELV $438
+ADDRGP4 g_arenaservers+13808
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 152
+ARGI4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+LABELV $431
+endproc ArenaServers_StopRefresh 0 16
+proc ArenaServers_DoRefresh 1120 16
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 g_arenaservers+13828
+INDIRI4
+GEI4 $448
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 6
+EQI4 $452
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 0
+NEI4 $454
+ADDRGP4 g_servertype
+INDIRI4
+ARGI4
+ADDRLP4 1104
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+NEI4 $456
+ADDRGP4 $447
+JUMPV
+LABELV $456
+LABELV $454
+ADDRGP4 g_servertype
+INDIRI4
+ARGI4
+ADDRLP4 1104
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRLP4 1104
+INDIRI4
+CNSTI4 0
+GEI4 $458
+ADDRGP4 $447
+JUMPV
+LABELV $458
+LABELV $452
+LABELV $448
+ADDRGP4 uis+4
+INDIRI4
+ADDRGP4 g_arenaservers+13820
+INDIRI4
+GEI4 $460
+ADDRGP4 $447
+JUMPV
+LABELV $460
+ADDRGP4 g_arenaservers+13820
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 10
+ADDI4
+ASGNI4
+ADDRLP4 1104
+ADDRGP4 ArenaServers_MaxPing
+CALLI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 1104
+INDIRI4
+ASGNI4
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+LABELV $466
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRLP4 72
+ARGP4
+ADDRGP4 trap_LAN_GetPing
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $470
+ADDRGP4 $467
+JUMPV
+LABELV $470
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $472
+ADDRLP4 4
+ARGP4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+1896
+ADDP4
+ARGP4
+ADDRLP4 1108
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $476
+ADDRGP4 $474
+JUMPV
+LABELV $476
+LABELV $473
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $472
+LABELV $474
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+GEI4 $479
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $481
+ADDRLP4 72
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+1896+64
+ADDP4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+ADDRLP4 76
+INDIRI4
+GEI4 $486
+ADDRGP4 $467
+JUMPV
+LABELV $486
+LABELV $481
+ADDRLP4 72
+INDIRI4
+ADDRLP4 76
+INDIRI4
+LEI4 $488
+ADDRLP4 80
+CNSTI1 0
+ASGNI1
+ADDRLP4 72
+ADDRLP4 76
+INDIRI4
+ASGNI4
+ADDRGP4 $489
+JUMPV
+LABELV $488
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRLP4 80
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_LAN_GetPingInfo
+CALLV
+pop
+LABELV $489
+ADDRLP4 4
+ARGP4
+ADDRLP4 80
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 ArenaServers_Insert
+CALLV
+pop
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+1896
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $479
+ADDRLP4 68
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ClearPing
+CALLV
+pop
+LABELV $467
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 32
+LTI4 $466
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 6
+NEI4 $491
+ADDRGP4 g_arenaservers+13800
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+ASGNI4
+ADDRGP4 $492
+JUMPV
+LABELV $491
+ADDRGP4 g_servertype
+INDIRI4
+ARGI4
+ADDRLP4 1108
+ADDRGP4 trap_LAN_GetServerCount
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+13800
+ADDRLP4 1108
+INDIRI4
+ASGNI4
+LABELV $492
+ADDRLP4 68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $499
+JUMPV
+LABELV $496
+ADDRLP4 1108
+ADDRGP4 trap_LAN_GetPingQueueCount
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 32
+LTI4 $502
+ADDRGP4 $498
+JUMPV
+LABELV $502
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $504
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+1896
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $508
+ADDRGP4 $506
+JUMPV
+LABELV $508
+LABELV $505
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $504
+LABELV $506
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $511
+ADDRGP4 $498
+JUMPV
+LABELV $511
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 6
+NEI4 $513
+ADDRLP4 4
+ARGP4
+ADDRGP4 g_arenaservers+13812
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+13832
+ADDP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $514
+JUMPV
+LABELV $513
+ADDRGP4 g_servertype
+INDIRI4
+ARGI4
+ADDRGP4 g_arenaservers+13812
+INDIRI4
+ARGI4
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_LAN_GetServerAddressString
+CALLV
+pop
+LABELV $514
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+1896
+ADDP4
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+1896+64
+ADDP4
+ADDRGP4 uis+4
+INDIRI4
+ASGNI4
+ADDRGP4 $522
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 1112
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 0
+ARGI4
+ADDRLP4 1112
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 1116
+ADDRGP4 g_arenaservers+13812
+ASGNP4
+ADDRLP4 1116
+INDIRP4
+ADDRLP4 1116
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $497
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $499
+ADDRLP4 68
+INDIRI4
+CNSTI4 32
+GEI4 $524
+ADDRGP4 g_arenaservers+13812
+INDIRI4
+ADDRGP4 g_arenaservers+13800
+INDIRI4
+LTI4 $496
+LABELV $524
+LABELV $498
+ADDRLP4 1108
+ADDRGP4 trap_LAN_GetPingQueueCount
+CALLI4
+ASGNI4
+ADDRLP4 1108
+INDIRI4
+CNSTI4 0
+NEI4 $525
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 $447
+JUMPV
+LABELV $525
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+LABELV $447
+endproc ArenaServers_DoRefresh 1120 16
+proc ArenaServers_StartRefresh 88 16
+ADDRGP4 g_arenaservers+13808
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTU4 72
+ADDRGP4 g_arenaservers+13824
+INDIRI4
+CVIU4 4
+MULU4
+CVUI4 4
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $530
+CNSTI4 68
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+1896
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 trap_LAN_ClearPing
+CALLV
+pop
+LABELV $531
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+LTI4 $530
+ADDRGP4 g_arenaservers+13816
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+13812
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+13820
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+13800
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+13828
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 5000
+ADDI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 0
+NEI4 $542
+CNSTI4 2
+ARGI4
+ADDRGP4 $544
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $527
+JUMPV
+LABELV $542
+ADDRLP4 68
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+LTI4 $545
+ADDRLP4 68
+INDIRI4
+CNSTI4 5
+GTI4 $545
+ADDRLP4 72
+ADDRGP4 g_arenaservers+456+64
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+LTI4 $547
+ADDRLP4 72
+INDIRI4
+CNSTI4 4
+GTI4 $547
+ADDRLP4 72
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $560
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $560
+address $551
+address $552
+address $554
+address $556
+address $558
+code
+LABELV $547
+LABELV $551
+ADDRLP4 36
+CNSTI1 0
+ASGNI1
+ADDRGP4 $548
+JUMPV
+LABELV $552
+ADDRLP4 36
+ARGP4
+ADDRGP4 $553
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $548
+JUMPV
+LABELV $554
+ADDRLP4 36
+ARGP4
+ADDRGP4 $555
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $548
+JUMPV
+LABELV $556
+ADDRLP4 36
+ARGP4
+ADDRGP4 $557
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $548
+JUMPV
+LABELV $558
+ADDRLP4 36
+ARGP4
+ADDRGP4 $559
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $548
+ADDRGP4 g_emptyservers
+INDIRI4
+CNSTI4 0
+EQI4 $561
+ADDRLP4 36
+ARGP4
+ADDRGP4 $563
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $561
+ADDRGP4 g_fullservers
+INDIRI4
+CNSTI4 0
+EQI4 $564
+ADDRLP4 36
+ARGP4
+ADDRGP4 $566
+ARGP4
+ADDRGP4 strcat
+CALLP4
+pop
+LABELV $564
+ADDRLP4 4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $567
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+ADDRLP4 76
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $568
+ADDRGP4 $570
+ARGP4
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRLP4 36
+ARGP4
+ADDRLP4 80
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 80
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRGP4 $569
+JUMPV
+LABELV $568
+ADDRGP4 $572
+ARGP4
+ADDRLP4 80
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 $571
+ARGP4
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 1
+SUBI4
+ARGI4
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 36
+ARGP4
+ADDRLP4 84
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 84
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $569
+LABELV $545
+LABELV $527
+endproc ArenaServers_StartRefresh 88 16
+export ArenaServers_SaveChanges
+proc ArenaServers_SaveChanges 12 8
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $577
+JUMPV
+LABELV $574
+ADDRGP4 $412
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 g_arenaservers+13832
+ADDP4
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $575
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $577
+ADDRLP4 0
+INDIRI4
+ADDRGP4 g_arenaservers+14856
+INDIRI4
+LTI4 $574
+ADDRGP4 $583
+JUMPV
+LABELV $580
+ADDRGP4 $412
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $206
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $581
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $583
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $580
+LABELV $573
+endproc ArenaServers_SaveChanges 12 8
+export ArenaServers_Sort
+proc ArenaServers_Sort 0 16
+ADDRGP4 g_sortkey
+INDIRI4
+ADDRFP4 0
+INDIRI4
+NEI4 $585
+ADDRGP4 $584
+JUMPV
+LABELV $585
+ADDRGP4 g_sortkey
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+13808
+INDIRP4
+ARGP4
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+ARGI4
+CNSTI4 152
+ARGI4
+ADDRGP4 ArenaServers_Compare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $584
+endproc ArenaServers_Sort 0 16
+export ArenaServers_SetType
+proc ArenaServers_SetType 20 16
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+LTI4 $590
+ADDRFP4 0
+INDIRI4
+CNSTI4 5
+GTI4 $590
+ADDRGP4 $594
+JUMPV
+LABELV $593
+ADDRLP4 6
+ARGP4
+CNSTI4 11
+ARGI4
+ADDRGP4 $596
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 6
+ARGP4
+ADDRLP4 4
+ARGP4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $597
+ADDRGP4 $595
+JUMPV
+LABELV $597
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $594
+ADDRFP4 0
+INDIRI4
+CNSTI4 5
+LEI4 $593
+LABELV $595
+LABELV $590
+ADDRGP4 g_servertype
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $599
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+GTI4 $599
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $619
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $619
+address $601
+address $607
+address $607
+address $607
+address $607
+address $607
+address $613
+code
+LABELV $599
+LABELV $601
+ADDRLP4 8
+ADDRGP4 g_arenaservers+1368+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 g_arenaservers+13808
+ADDRGP4 g_localserverlist
+ASGNP4
+ADDRGP4 g_arenaservers+13804
+ADDRGP4 g_numlocalservers
+ASGNP4
+ADDRGP4 g_arenaservers+13824
+CNSTI4 128
+ASGNI4
+ADDRGP4 $600
+JUMPV
+LABELV $607
+ADDRLP4 12
+ADDRGP4 g_arenaservers+1368+44
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 g_arenaservers+13808
+ADDRGP4 g_globalserverlist
+ASGNP4
+ADDRGP4 g_arenaservers+13804
+ADDRGP4 g_numglobalservers
+ASGNP4
+ADDRGP4 g_arenaservers+13824
+CNSTI4 128
+ASGNI4
+ADDRGP4 $600
+JUMPV
+LABELV $613
+ADDRLP4 16
+ADDRGP4 g_arenaservers+1368+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTI4 -20481
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRGP4 g_arenaservers+13808
+ADDRGP4 g_favoriteserverlist
+ASGNP4
+ADDRGP4 g_arenaservers+13804
+ADDRGP4 g_numfavoriteservers
+ASGNP4
+ADDRGP4 g_arenaservers+13824
+CNSTI4 16
+ASGNI4
+LABELV $600
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+CNSTI4 0
+NEI4 $620
+ADDRGP4 ArenaServers_StartRefresh
+CALLV
+pop
+ADDRGP4 $621
+JUMPV
+LABELV $620
+ADDRGP4 g_arenaservers+13812
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+13800
+ADDRGP4 g_arenaservers+13804
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+LABELV $621
+ADDRGP4 g_arenaservers+1224+60
+INDIRP4
+ARGP4
+ADDRGP4 $629
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $589
+endproc ArenaServers_SetType 20 16
+proc Punkbuster_ConfirmEnable 8 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $631
+CNSTI4 1
+ARGI4
+ADDRGP4 trap_SetPbClStatus
+CALLV
+pop
+LABELV $631
+ADDRGP4 $635
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_arenaservers+14860+64
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $630
+endproc Punkbuster_ConfirmEnable 8 12
+proc Punkbuster_ConfirmDisable 8 12
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $637
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_SetPbClStatus
+CALLV
+pop
+ADDRGP4 punkbuster_msg
+ARGP4
+ADDRGP4 UI_Message
+CALLV
+pop
+LABELV $637
+ADDRGP4 $635
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 0
+INDIRF4
+ARGF4
+ADDRLP4 4
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_arenaservers+14860+64
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $636
+endproc Punkbuster_ConfirmDisable 8 12
+proc ArenaServers_Event 12 16
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $642
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+EQI4 $642
+ADDRGP4 $641
+JUMPV
+LABELV $642
+ADDRLP4 0
+INDIRI4
+CNSTI4 10
+LTI4 $644
+ADDRLP4 0
+INDIRI4
+CNSTI4 24
+GTI4 $644
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $698-40
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $698
+address $646
+address $654
+address $660
+address $666
+address $672
+address $678
+address $681
+address $683
+address $685
+address $686
+address $687
+address $688
+address $689
+address $690
+address $691
+code
+LABELV $646
+ADDRGP4 g_arenaservers+360+64
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 ArenaServers_SetType
+CALLI4
+ASGNI4
+ADDRGP4 g_arenaservers+360+64
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $651
+ARGP4
+ADDRGP4 g_arenaservers+360+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $654
+ADDRGP4 $655
+ARGP4
+ADDRGP4 g_arenaservers+456+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_gametype
+ADDRGP4 g_arenaservers+456+64
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $660
+ADDRGP4 $661
+ARGP4
+ADDRGP4 g_arenaservers+552+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_arenaservers+552+64
+INDIRI4
+ARGI4
+ADDRGP4 ArenaServers_Sort
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $666
+ADDRGP4 $667
+ARGP4
+ADDRGP4 g_arenaservers+648+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_fullservers
+ADDRGP4 g_arenaservers+648+60
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $672
+ADDRGP4 $673
+ARGP4
+ADDRGP4 g_arenaservers+712+60
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 g_emptyservers
+ADDRGP4 g_arenaservers+712+60
+INDIRI4
+ASGNI4
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $678
+ADDRFP4 4
+INDIRI4
+CNSTI4 1
+NEI4 $645
+ADDRGP4 ArenaServers_UpdatePicture
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $681
+ADDRGP4 g_arenaservers+776
+ARGP4
+CNSTI4 132
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $683
+ADDRGP4 g_arenaservers+776
+ARGP4
+CNSTI4 133
+ARGI4
+ADDRGP4 ScrollList_Key
+CALLI4
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $685
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 ArenaServers_SaveChanges
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $686
+ADDRGP4 ArenaServers_StartRefresh
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $687
+ADDRGP4 UI_SpecifyServerMenu
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $688
+CNSTI4 1
+ARGI4
+ADDRGP4 UI_StartServerMenu
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $689
+ADDRGP4 ArenaServers_Go
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $690
+ADDRGP4 ArenaServers_Remove
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $691
+ADDRGP4 g_arenaservers+14860+64
+INDIRI4
+CNSTI4 0
+EQI4 $692
+ADDRGP4 $696
+ARGP4
+CNSTI4 8209
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Punkbuster_ConfirmEnable
+ARGP4
+ADDRGP4 UI_ConfirmMenu_Style
+CALLV
+pop
+ADDRGP4 $645
+JUMPV
+LABELV $692
+ADDRGP4 $697
+ARGP4
+CNSTI4 8209
+ARGI4
+CNSTP4 0
+ARGP4
+ADDRGP4 Punkbuster_ConfirmDisable
+ARGP4
+ADDRGP4 UI_ConfirmMenu_Style
+CALLV
+pop
+LABELV $644
+LABELV $645
+LABELV $641
+endproc ArenaServers_Event 12 16
+proc ArenaServers_MenuDraw 0 4
+ADDRGP4 g_arenaservers+13816
+INDIRI4
+CNSTI4 0
+EQI4 $701
+ADDRGP4 ArenaServers_DoRefresh
+CALLV
+pop
+LABELV $701
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $700
+endproc ArenaServers_MenuDraw 0 4
+proc ArenaServers_MenuKey 16 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+CNSTI4 32
+NEI4 $705
+ADDRGP4 g_arenaservers+13816
+INDIRI4
+CNSTI4 0
+EQI4 $705
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $704
+JUMPV
+LABELV $705
+ADDRFP4 0
+INDIRI4
+CNSTI4 140
+EQI4 $711
+ADDRFP4 0
+INDIRI4
+CNSTI4 171
+NEI4 $708
+LABELV $711
+ADDRGP4 g_servertype
+INDIRI4
+CNSTI4 6
+NEI4 $708
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRLP4 4
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+ADDRGP4 g_arenaservers+776
+CVPU4 4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+NEU4 $708
+ADDRGP4 ArenaServers_Remove
+CALLV
+pop
+ADDRGP4 ArenaServers_UpdateMenu
+CALLV
+pop
+ADDRGP4 menu_move_sound
+INDIRI4
+RETI4
+ADDRGP4 $704
+JUMPV
+LABELV $708
+ADDRFP4 0
+INDIRI4
+CNSTI4 179
+EQI4 $714
+ADDRFP4 0
+INDIRI4
+CNSTI4 27
+NEI4 $712
+LABELV $714
+ADDRGP4 ArenaServers_StopRefresh
+CALLV
+pop
+ADDRGP4 ArenaServers_SaveChanges
+CALLV
+pop
+LABELV $712
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 Menu_DefaultKey
+CALLI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+RETI4
+LABELV $704
+endproc ArenaServers_MenuKey 16 8
+bss
+align 1
+LABELV $716
+skip 64
+code
+proc ArenaServers_MenuInit 48 16
+ADDRGP4 g_arenaservers
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 15044
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 ArenaServers_Cache
+CALLV
+pop
+ADDRGP4 g_arenaservers+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+268
+ADDRGP4 ArenaServers_MenuDraw
+ASGNP4
+ADDRGP4 g_arenaservers+272
+ADDRGP4 ArenaServers_MenuKey
+ASGNP4
+ADDRGP4 g_arenaservers+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 g_arenaservers+288+44
+CNSTU4 8
+ASGNU4
+ADDRGP4 g_arenaservers+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 g_arenaservers+288+60
+ADDRGP4 $730
+ASGNP4
+ADDRGP4 g_arenaservers+288+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 g_arenaservers+288+68
+ADDRGP4 color_white
+ASGNP4
+ADDRLP4 4
+CNSTI4 80
+ASGNI4
+ADDRGP4 g_arenaservers+360
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+360+4
+ADDRGP4 $738
+ASGNP4
+ADDRGP4 g_arenaservers+360+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+360+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+360+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 g_arenaservers+360+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+360+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+360+76
+ADDRGP4 master_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+456
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+456+4
+ADDRGP4 $754
+ASGNP4
+ADDRGP4 g_arenaservers+456+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+456+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+456+8
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+456+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+456+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+456+76
+ADDRGP4 servertype_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+552
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+552+4
+ADDRGP4 $770
+ASGNP4
+ADDRGP4 g_arenaservers+552+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+552+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+552+8
+CNSTI4 12
+ASGNI4
+ADDRGP4 g_arenaservers+552+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+552+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+552+76
+ADDRGP4 sortkey_items
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+648
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+648+4
+ADDRGP4 $786
+ASGNP4
+ADDRGP4 g_arenaservers+648+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+648+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+648+8
+CNSTI4 13
+ASGNI4
+ADDRGP4 g_arenaservers+648+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+648+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+712
+CNSTI4 5
+ASGNI4
+ADDRGP4 g_arenaservers+712+4
+ADDRGP4 $800
+ASGNP4
+ADDRGP4 g_arenaservers+712+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+712+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+712+8
+CNSTI4 14
+ASGNI4
+ADDRGP4 g_arenaservers+712+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+712+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 48
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+776
+CNSTI4 8
+ASGNI4
+ADDRGP4 g_arenaservers+776+44
+CNSTU4 128
+ASGNU4
+ADDRGP4 g_arenaservers+776+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 g_arenaservers+776+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+776+12
+CNSTI4 72
+ASGNI4
+ADDRGP4 g_arenaservers+776+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+776+80
+CNSTI4 68
+ASGNI4
+ADDRGP4 g_arenaservers+776+84
+CNSTI4 11
+ASGNI4
+ADDRGP4 g_arenaservers+776+76
+ADDRGP4 g_arenaservers+13288
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $829
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 g_arenaservers+13288
+ADDP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 g_arenaservers+4072
+ADDP4
+ASGNP4
+LABELV $830
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 128
+LTI4 $829
+ADDRGP4 g_arenaservers+872
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+872+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 g_arenaservers+872+12
+CNSTI4 72
+ASGNI4
+ADDRGP4 g_arenaservers+872+16
+CNSTI4 80
+ASGNI4
+ADDRGP4 g_arenaservers+872+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+872+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 g_arenaservers+872+64
+ADDRGP4 $848
+ASGNP4
+ADDRGP4 g_arenaservers+960
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+960+4
+ADDRGP4 $852
+ASGNP4
+ADDRGP4 g_arenaservers+960+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 g_arenaservers+960+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+960+12
+CNSTI4 560
+ASGNI4
+ADDRGP4 g_arenaservers+960+16
+CNSTI4 192
+ASGNI4
+ADDRGP4 g_arenaservers+960+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+960+80
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1048
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1048+44
+CNSTU4 2308
+ASGNU4
+ADDRGP4 g_arenaservers+1048+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1048+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 g_arenaservers+1048+12
+CNSTI4 560
+ASGNI4
+ADDRGP4 g_arenaservers+1048+16
+CNSTI4 192
+ASGNI4
+ADDRGP4 g_arenaservers+1048+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1048+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1048+60
+ADDRGP4 $882
+ASGNP4
+ADDRGP4 g_arenaservers+1136
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1136+44
+CNSTU4 2308
+ASGNU4
+ADDRGP4 g_arenaservers+1136+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1136+8
+CNSTI4 17
+ASGNI4
+ADDRGP4 g_arenaservers+1136+12
+CNSTI4 560
+ASGNI4
+ADDRGP4 g_arenaservers+1136+16
+CNSTI4 256
+ASGNI4
+ADDRGP4 g_arenaservers+1136+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1136+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1136+60
+ADDRGP4 $900
+ASGNP4
+ADDRLP4 4
+CNSTI4 376
+ASGNI4
+ADDRGP4 g_arenaservers+1224
+CNSTI4 7
+ASGNI4
+ADDRGP4 g_arenaservers+1224+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+1224+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1224+60
+ADDRGP4 $716
+ASGNP4
+ADDRGP4 g_arenaservers+1224+64
+CNSTI4 17
+ASGNI4
+ADDRGP4 g_arenaservers+1224+68
+ADDRGP4 menu_text_color
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRGP4 g_arenaservers+1296
+CNSTI4 7
+ASGNI4
+ADDRGP4 g_arenaservers+1296+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 g_arenaservers+1296+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+1296+60
+ADDRGP4 $206
+ASGNP4
+ADDRGP4 g_arenaservers+1296+64
+CNSTI4 17
+ASGNI4
+ADDRGP4 g_arenaservers+1296+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 g_arenaservers+1368
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1368+4
+ADDRGP4 $926
+ASGNP4
+ADDRGP4 g_arenaservers+1368+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1368+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1368+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 g_arenaservers+1368+12
+CNSTI4 450
+ASGNI4
+ADDRGP4 g_arenaservers+1368+16
+CNSTI4 86
+ASGNI4
+ADDRGP4 g_arenaservers+1368+76
+CNSTI4 96
+ASGNI4
+ADDRGP4 g_arenaservers+1368+80
+CNSTI4 48
+ASGNI4
+ADDRGP4 g_arenaservers+1368+60
+ADDRGP4 $943
+ASGNP4
+ADDRGP4 g_arenaservers+1456
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1456+4
+ADDRGP4 $947
+ASGNP4
+ADDRGP4 g_arenaservers+1456+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1456+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1456+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 g_arenaservers+1456+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 g_arenaservers+1456+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1456+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1456+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1456+60
+ADDRGP4 $964
+ASGNP4
+ADDRGP4 g_arenaservers+1632
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1632+4
+ADDRGP4 $968
+ASGNP4
+ADDRGP4 g_arenaservers+1632+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1632+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1632+8
+CNSTI4 20
+ASGNI4
+ADDRGP4 g_arenaservers+1632+12
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1632+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1632+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1632+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1632+60
+ADDRGP4 $985
+ASGNP4
+ADDRGP4 g_arenaservers+1544
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1544+4
+ADDRGP4 $989
+ASGNP4
+ADDRGP4 g_arenaservers+1544+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1544+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1544+8
+CNSTI4 19
+ASGNI4
+ADDRGP4 g_arenaservers+1544+12
+CNSTI4 256
+ASGNI4
+ADDRGP4 g_arenaservers+1544+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1544+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1544+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1544+60
+ADDRGP4 $1006
+ASGNP4
+ADDRGP4 g_arenaservers+1720
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1720+4
+ADDRGP4 $1010
+ASGNP4
+ADDRGP4 g_arenaservers+1720+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 g_arenaservers+1720+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1720+8
+CNSTI4 21
+ASGNI4
+ADDRGP4 g_arenaservers+1720+12
+CNSTI4 384
+ASGNI4
+ADDRGP4 g_arenaservers+1720+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1720+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1720+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1720+60
+ADDRGP4 $1027
+ASGNP4
+ADDRGP4 g_arenaservers+1808
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+1808+4
+ADDRGP4 $1031
+ASGNP4
+ADDRGP4 g_arenaservers+1808+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 g_arenaservers+1808+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+1808+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 g_arenaservers+1808+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 g_arenaservers+1808+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 g_arenaservers+1808+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 g_arenaservers+1808+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 g_arenaservers+1808+60
+ADDRGP4 $1048
+ASGNP4
+ADDRGP4 g_arenaservers+14860
+CNSTI4 3
+ASGNI4
+ADDRGP4 g_arenaservers+14860+4
+ADDRGP4 $1052
+ASGNP4
+ADDRGP4 g_arenaservers+14860+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 g_arenaservers+14860+48
+ADDRGP4 ArenaServers_Event
+ASGNP4
+ADDRGP4 g_arenaservers+14860+8
+CNSTI4 24
+ASGNI4
+ADDRGP4 g_arenaservers+14860+12
+CNSTI4 512
+ASGNI4
+ADDRGP4 g_arenaservers+14860+16
+CNSTI4 144
+ASGNI4
+ADDRGP4 g_arenaservers+14860+76
+ADDRGP4 punkbuster_items
+ASGNP4
+ADDRGP4 g_arenaservers+14956
+CNSTI4 6
+ASGNI4
+ADDRGP4 g_arenaservers+14956+4
+ADDRGP4 $1068
+ASGNP4
+ADDRGP4 g_arenaservers+14956+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 g_arenaservers+14956+12
+CNSTI4 526
+ASGNI4
+ADDRGP4 g_arenaservers+14956+16
+CNSTI4 176
+ASGNI4
+ADDRGP4 g_arenaservers+14956+76
+CNSTI4 32
+ASGNI4
+ADDRGP4 g_arenaservers+14956+80
+CNSTI4 16
+ASGNI4
+ADDRGP4 g_arenaservers+14956+64
+ADDRGP4 $848
+ASGNP4
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+456
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+552
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+648
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+712
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+872
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+776
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1224
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+960
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1048
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1136
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1368
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1456
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1632
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1544
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1720
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+1808
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+14860
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 g_arenaservers+14956
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 ArenaServers_LoadFavorites
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1077936128
+ARGF4
+ADDRGP4 ui_browserMaster+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_servertype
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 8
+ADDRGP4 g_servertype
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+LTI4 $1103
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+LABELV $1103
+ADDRGP4 g_arenaservers+360+64
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 ui_browserGameType+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_gametype
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+456+64
+ADDRGP4 g_gametype
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 ui_browserSortKey+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_sortkey
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+552+64
+ADDRGP4 g_sortkey
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 ui_browserShowFull+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_fullservers
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+648+60
+ADDRGP4 g_fullservers
+INDIRI4
+ASGNI4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 ui_browserShowEmpty+12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 28
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_emptyservers
+ADDRLP4 28
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 g_arenaservers+712+60
+ADDRGP4 g_emptyservers
+INDIRI4
+ASGNI4
+ADDRGP4 $635
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 32
+INDIRF4
+ARGF4
+ADDRLP4 36
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 g_arenaservers+14860+64
+ADDRLP4 36
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 g_servertype
+ASGNP4
+ADDRLP4 40
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 44
+ADDRGP4 ArenaServers_SetType
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRGP4 g_arenaservers+360+64
+ADDRLP4 44
+INDIRI4
+ASGNI4
+CNSTP4 0
+ARGP4
+ADDRGP4 $567
+ARGP4
+ADDRGP4 $206
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRGP4 trap_Cvar_Register
+CALLV
+pop
+LABELV $715
+endproc ArenaServers_MenuInit 48 16
+export ArenaServers_Cache
+proc ArenaServers_Cache 0 4
+ADDRGP4 $947
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $964
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1010
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1027
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $968
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $985
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $989
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1006
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1031
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1048
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $852
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $882
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $900
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $848
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1068
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1123
+endproc ArenaServers_Cache 0 4
+export UI_ArenaServersMenu
+proc UI_ArenaServersMenu 0 4
+ADDRGP4 ArenaServers_MenuInit
+CALLV
+pop
+ADDRGP4 g_arenaservers
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1124
+endproc UI_ArenaServersMenu 0 4
+bss
+align 4
+LABELV g_fullservers
+skip 4
+align 4
+LABELV g_emptyservers
+skip 4
+align 4
+LABELV g_sortkey
+skip 4
+align 4
+LABELV g_gametype
+skip 4
+align 4
+LABELV g_servertype
+skip 4
+align 4
+LABELV g_numfavoriteservers
+skip 4
+align 4
+LABELV g_favoriteserverlist
+skip 2432
+align 4
+LABELV g_numlocalservers
+skip 4
+align 4
+LABELV g_localserverlist
+skip 19456
+align 4
+LABELV g_numglobalservers
+skip 4
+align 4
+LABELV g_globalserverlist
+skip 19456
+align 4
+LABELV g_arenaservers
+skip 15044
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1068
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 112
+byte 1 98
+byte 1 108
+byte 1 111
+byte 1 103
+byte 1 111
+byte 1 0
+align 1
+LABELV $1052
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $1048
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1031
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1027
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1010
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1006
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $989
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $985
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $968
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 112
+byte 1 101
+byte 1 99
+byte 1 105
+byte 1 102
+byte 1 121
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $964
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $947
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $943
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $926
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $900
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $882
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $852
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $848
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $800
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $786
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 32
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $770
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 66
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $754
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $738
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $730
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 78
+byte 1 65
+byte 1 32
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 83
+byte 1 0
+align 1
+LABELV $697
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 63
+byte 1 0
+align 1
+LABELV $696
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 63
+byte 1 0
+align 1
+LABELV $673
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $667
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 104
+byte 1 111
+byte 1 119
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $661
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 83
+byte 1 111
+byte 1 114
+byte 1 116
+byte 1 75
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $655
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $651
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 98
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $635
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $629
+byte 1 104
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 102
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 104
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 117
+byte 1 112
+byte 1 100
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 0
+align 1
+LABELV $596
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $592
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 49
+byte 1 0
+align 1
+LABELV $572
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $571
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $570
+byte 1 103
+byte 1 108
+byte 1 111
+byte 1 98
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $567
+byte 1 100
+byte 1 101
+byte 1 98
+byte 1 117
+byte 1 103
+byte 1 95
+byte 1 112
+byte 1 114
+byte 1 111
+byte 1 116
+byte 1 111
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 0
+align 1
+LABELV $566
+byte 1 32
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $563
+byte 1 32
+byte 1 101
+byte 1 109
+byte 1 112
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $559
+byte 1 32
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $557
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $555
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $553
+byte 1 32
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $544
+byte 1 108
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $522
+byte 1 112
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $412
+byte 1 115
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 37
+byte 1 100
+byte 1 0
+align 1
+LABELV $391
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 0
+align 1
+LABELV $383
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $382
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $381
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $380
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $379
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $378
+byte 1 109
+byte 1 105
+byte 1 110
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $377
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $376
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $375
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $374
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $313
+byte 1 78
+byte 1 111
+byte 1 0
+align 1
+LABELV $312
+byte 1 89
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $311
+byte 1 37
+byte 1 45
+byte 1 50
+byte 1 48
+byte 1 46
+byte 1 50
+byte 1 48
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 49
+byte 1 50
+byte 1 46
+byte 1 49
+byte 1 50
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 47
+byte 1 37
+byte 1 50
+byte 1 100
+byte 1 32
+byte 1 37
+byte 1 45
+byte 1 56
+byte 1 46
+byte 1 56
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 51
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 37
+byte 1 51
+byte 1 100
+byte 1 32
+byte 1 94
+byte 1 51
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $310
+byte 1 94
+byte 1 49
+byte 1 0
+align 1
+LABELV $309
+byte 1 94
+byte 1 51
+byte 1 0
+align 1
+LABELV $306
+byte 1 94
+byte 1 50
+byte 1 0
+align 1
+LABELV $301
+byte 1 94
+byte 1 52
+byte 1 0
+align 1
+LABELV $241
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 117
+byte 1 110
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $238
+byte 1 78
+byte 1 111
+byte 1 32
+byte 1 82
+byte 1 101
+byte 1 115
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 77
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 46
+byte 1 0
+align 1
+LABELV $212
+byte 1 83
+byte 1 99
+byte 1 97
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $206
+byte 1 0
+align 1
+LABELV $179
+byte 1 80
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 115
+byte 1 32
+byte 1 83
+byte 1 80
+byte 1 65
+byte 1 67
+byte 1 69
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 112
+byte 1 0
+align 1
+LABELV $174
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 37
+byte 1 100
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $158
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $145
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 110
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $110
+byte 1 99
+byte 1 108
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $105
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 46
+byte 1 0
+align 1
+LABELV $104
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 107
+byte 1 101
+byte 1 32
+byte 1 73
+byte 1 73
+byte 1 73
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 0
+align 1
+LABELV $103
+byte 1 100
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $102
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 66
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 0
+align 1
+LABELV $101
+byte 1 69
+byte 1 110
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $100
+byte 1 68
+byte 1 105
+byte 1 115
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $99
+byte 1 85
+byte 1 68
+byte 1 80
+byte 1 54
+byte 1 0
+align 1
+LABELV $98
+byte 1 85
+byte 1 68
+byte 1 80
+byte 1 0
+align 1
+LABELV $97
+byte 1 63
+byte 1 63
+byte 1 63
+byte 1 0
+align 1
+LABELV $96
+byte 1 79
+byte 1 83
+byte 1 80
+byte 1 0
+align 1
+LABELV $95
+byte 1 85
+byte 1 114
+byte 1 98
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 84
+byte 1 101
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $94
+byte 1 81
+byte 1 51
+byte 1 70
+byte 1 0
+align 1
+LABELV $93
+byte 1 82
+byte 1 111
+byte 1 99
+byte 1 107
+byte 1 101
+byte 1 116
+byte 1 32
+byte 1 65
+byte 1 114
+byte 1 101
+byte 1 110
+byte 1 97
+byte 1 32
+byte 1 51
+byte 1 0
+align 1
+LABELV $92
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $91
+byte 1 79
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 76
+byte 1 111
+byte 1 97
+byte 1 100
+byte 1 0
+align 1
+LABELV $90
+byte 1 79
+byte 1 110
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $89
+byte 1 67
+byte 1 84
+byte 1 70
+byte 1 0
+align 1
+LABELV $88
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 77
+byte 1 0
+align 1
+LABELV $87
+byte 1 83
+byte 1 80
+byte 1 32
+byte 1 0
+align 1
+LABELV $86
+byte 1 49
+byte 1 118
+byte 1 49
+byte 1 0
+align 1
+LABELV $85
+byte 1 68
+byte 1 77
+byte 1 32
+byte 1 0
+align 1
+LABELV $84
+byte 1 80
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $83
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $82
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 83
+byte 1 112
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $81
+byte 1 77
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $80
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 78
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $79
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $78
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $77
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $76
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $75
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $74
+byte 1 70
+byte 1 97
+byte 1 118
+byte 1 111
+byte 1 114
+byte 1 105
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $73
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 53
+byte 1 0
+align 1
+LABELV $72
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 52
+byte 1 0
+align 1
+LABELV $71
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 51
+byte 1 0
+align 1
+LABELV $70
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 50
+byte 1 0
+align 1
+LABELV $69
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 49
+byte 1 0
+align 1
+LABELV $68
+byte 1 76
+byte 1 111
+byte 1 99
+byte 1 97
+byte 1 108
+byte 1 0
@@ -0,0 +1,4836 @@
+code
+proc PlayerIcon 80 20
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 68
+ADDRGP4 Q_strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $70
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $71
+JUMPV
+LABELV $70
+ADDRLP4 0
+ADDRGP4 $72
+ASGNP4
+LABELV $71
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $73
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $74
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $72
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $74
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $76
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $74
+LABELV $69
+endproc PlayerIcon 80 20
+proc PlayerIconHandle 68 12
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 PlayerIcon
+CALLV
+pop
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 64
+INDIRI4
+RETI4
+LABELV $77
+endproc PlayerIconHandle 68 12
+proc UI_SPLevelMenu_SetBots 1068 12
+ADDRGP4 levelMenuInfo+2512
+CNSTI4 0
+ASGNI4
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $80
+ADDRGP4 $78
+JUMPV
+LABELV $80
+ADDRGP4 levelMenuInfo+1948
+INDIRP4
+ARGP4
+ADDRGP4 $83
+ARGP4
+ADDRLP4 1036
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1036
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 12
+ASGNP4
+ADDRGP4 $85
+JUMPV
+LABELV $88
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $89
+ADDRLP4 1040
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+CNSTI4 0
+EQI4 $91
+ADDRLP4 1040
+INDIRI4
+CNSTI4 32
+EQI4 $88
+LABELV $91
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $92
+ADDRGP4 $86
+JUMPV
+LABELV $92
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $95
+JUMPV
+LABELV $94
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $95
+ADDRLP4 1044
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1044
+INDIRI4
+CNSTI4 0
+EQI4 $97
+ADDRLP4 1044
+INDIRI4
+CNSTI4 32
+NEI4 $94
+LABELV $97
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $98
+ADDRLP4 1048
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1048
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1048
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $98
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1048
+ADDRGP4 UI_GetBotInfoByName
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $100
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $104
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+ADDRLP4 1056
+ADDRGP4 PlayerIconHandle
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2516
+ADDP4
+ADDRLP4 1056
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $107
+ARGP4
+ADDRLP4 1060
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 1064
+CNSTI4 10
+ASGNI4
+ADDRLP4 1064
+INDIRI4
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+2544
+ADDP4
+ARGP4
+ADDRLP4 1060
+INDIRP4
+ARGP4
+ADDRLP4 1064
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $101
+JUMPV
+LABELV $100
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2516
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 1052
+CNSTI4 10
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+2544
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1052
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $101
+CNSTI4 10
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+2544
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+ADDRLP4 1052
+ADDRGP4 levelMenuInfo+2512
+ASGNP4
+ADDRLP4 1052
+INDIRP4
+ADDRLP4 1052
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $85
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $115
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+CNSTI4 7
+LTI4 $89
+LABELV $115
+LABELV $86
+LABELV $78
+endproc UI_SPLevelMenu_SetBots 1068 12
+proc UI_SPLevelMenu_SetMenuArena 84 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $117
+ARGP4
+ADDRLP4 64
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 64
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 levelMenuInfo+2212
+ADDP4
+ARGP4
+ADDRLP4 0
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 levelMenuInfo+2212
+ADDP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRLP4 68
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 levelMenuInfo+2276
+ADDP4
+ARGP4
+ADDRLP4 68
+INDIRI4
+ADDRGP4 levelMenuInfo+2292
+ADDP4
+ARGP4
+ADDRGP4 UI_GetBestScore
+CALLV
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2276
+ADDP4
+INDIRI4
+CNSTI4 8
+LEI4 $123
+ADDRFP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2276
+ADDP4
+CNSTI4 8
+ASGNI4
+LABELV $123
+ADDRGP4 $128
+ARGP4
+ADDRLP4 0
+ARGP4
+ADDRLP4 72
+ADDRGP4 va
+CALLP4
+ASGNP4
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 levelMenuInfo+1956
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 levelMenuInfo+1956
+ADDP4
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+NEI4 $129
+ADDRFP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 levelMenuInfo+1956
+ADDP4
+ARGP4
+ADDRGP4 $133
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $129
+CNSTI4 88
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $136
+ADDRLP4 80
+CNSTI4 88
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+44
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $137
+JUMPV
+LABELV $136
+ADDRLP4 80
+CNSTI4 88
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+44
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $137
+ADDRLP4 80
+CNSTI4 88
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448+44
+ADDP4
+ASGNP4
+ADDRLP4 80
+INDIRP4
+ADDRLP4 80
+INDIRP4
+INDIRU4
+CNSTI4 -16385
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $116
+endproc UI_SPLevelMenu_SetMenuArena 84 12
+proc UI_SPLevelMenu_SetMenuItems 44 12
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $145
+ADDRGP4 selectedArena
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $146
+JUMPV
+LABELV $145
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+NEI4 $147
+ADDRGP4 selectedArena
+CNSTI4 0
+ASGNI4
+LABELV $147
+LABELV $146
+ADDRLP4 12
+ADDRGP4 selectedArenaSet
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRGP4 trainingTier
+INDIRI4
+EQI4 $151
+ADDRLP4 12
+INDIRI4
+ADDRGP4 finalTier
+INDIRI4
+NEI4 $149
+LABELV $151
+ADDRGP4 selectedArena
+CNSTI4 0
+ASGNI4
+LABELV $149
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+EQI4 $152
+ADDRGP4 $154
+ARGP4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 selectedArena
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $152
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 trainingTier
+INDIRI4
+NEI4 $155
+ADDRGP4 $157
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_SPLevelMenu_SetMenuArena
+CALLV
+pop
+ADDRGP4 levelMenuInfo+1948
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 levelMenuInfo+448+12
+CNSTI4 256
+ASGNI4
+ADDRGP4 levelMenuInfo+448
+ARGP4
+ADDRGP4 Bitmap_Init
+CALLV
+pop
+ADDRLP4 28
+ADDRGP4 levelMenuInfo+448+32
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 levelMenuInfo+1952
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+ADDRGP4 levelMenuInfo+448+88+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 levelMenuInfo+448+176+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 levelMenuInfo+448+264+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 levelMenuInfo+1956+64
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+1956+128
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+1956+192
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+448+88+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $156
+JUMPV
+LABELV $155
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 finalTier
+INDIRI4
+NEI4 $190
+ADDRGP4 $192
+ARGP4
+ADDRLP4 16
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 24
+INDIRI4
+ASGNI4
+CNSTI4 0
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_SPLevelMenu_SetMenuArena
+CALLV
+pop
+ADDRGP4 levelMenuInfo+1948
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 levelMenuInfo+448+12
+CNSTI4 256
+ASGNI4
+ADDRGP4 levelMenuInfo+448
+ARGP4
+ADDRGP4 Bitmap_Init
+CALLV
+pop
+ADDRLP4 28
+ADDRGP4 levelMenuInfo+448+32
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 levelMenuInfo+1952
+CNSTI4 1
+ASGNI4
+ADDRLP4 32
+ADDRGP4 levelMenuInfo+448+88+44
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 36
+ADDRGP4 levelMenuInfo+448+176+44
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ADDRLP4 36
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 40
+ADDRGP4 levelMenuInfo+448+264+44
+ASGNP4
+ADDRLP4 40
+INDIRP4
+ADDRLP4 40
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 levelMenuInfo+1956+64
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+1956+128
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+1956+192
+CNSTI1 0
+ASGNI1
+ADDRGP4 levelMenuInfo+448+88+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+68
+CNSTI4 0
+ASGNI4
+ADDRGP4 $191
+JUMPV
+LABELV $190
+ADDRGP4 levelMenuInfo+448+12
+CNSTI4 46
+ASGNI4
+ADDRGP4 levelMenuInfo+448
+ARGP4
+ADDRGP4 Bitmap_Init
+CALLV
+pop
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+448+32
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 levelMenuInfo+1952
+CNSTI4 4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $230
+ADDRLP4 4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 UI_SPLevelMenu_SetMenuArena
+CALLV
+pop
+LABELV $231
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $230
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+EQI4 $234
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 selectedArena
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 20
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRGP4 levelMenuInfo+1948
+ADDRLP4 20
+INDIRP4
+ASGNP4
+LABELV $234
+LABELV $191
+LABELV $156
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 minTier
+INDIRI4
+NEI4 $237
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+360+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 $238
+JUMPV
+LABELV $237
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+360+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTI4 -20481
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $238
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 maxTier
+INDIRI4
+NEI4 $243
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+800+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 $244
+JUMPV
+LABELV $243
+ADDRLP4 16
+ADDRGP4 levelMenuInfo+800+44
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTI4 -20481
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $244
+ADDRGP4 UI_SPLevelMenu_SetBots
+CALLV
+pop
+LABELV $144
+endproc UI_SPLevelMenu_SetMenuItems 44 12
+proc UI_SPLevelMenu_ResetDraw 0 20
+CNSTI4 320
+ARGI4
+CNSTI4 356
+ARGI4
+ADDRGP4 $250
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 383
+ARGI4
+ADDRGP4 $251
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 410
+ARGI4
+ADDRGP4 $252
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 437
+ARGI4
+ADDRGP4 $253
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $249
+endproc UI_SPLevelMenu_ResetDraw 0 20
+proc UI_SPLevelMenu_ResetAction 0 8
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+NEI4 $255
+ADDRGP4 $254
+JUMPV
+LABELV $255
+ADDRGP4 UI_NewGame
+CALLV
+pop
+ADDRGP4 $154
+ARGP4
+CNSTF4 3229614080
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_SPLevelMenu
+CALLV
+pop
+LABELV $254
+endproc UI_SPLevelMenu_ResetAction 0 8
+proc UI_SPLevelMenu_ResetEvent 0 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $258
+ADDRGP4 $257
+JUMPV
+LABELV $258
+ADDRGP4 $260
+ARGP4
+ADDRGP4 UI_SPLevelMenu_ResetDraw
+ARGP4
+ADDRGP4 UI_SPLevelMenu_ResetAction
+ARGP4
+ADDRGP4 UI_ConfirmMenu
+CALLV
+pop
+LABELV $257
+endproc UI_SPLevelMenu_ResetEvent 0 12
+proc UI_SPLevelMenu_LevelEvent 12 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $262
+ADDRGP4 $261
+JUMPV
+LABELV $262
+ADDRLP4 0
+ADDRGP4 selectedArenaSet
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRGP4 trainingTier
+INDIRI4
+EQI4 $266
+ADDRLP4 0
+INDIRI4
+ADDRGP4 finalTier
+INDIRI4
+NEI4 $264
+LABELV $266
+ADDRGP4 $261
+JUMPV
+LABELV $264
+ADDRLP4 4
+ADDRGP4 selectedArena
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 11
+SUBI4
+ASGNI4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRLP4 4
+INDIRP4
+INDIRI4
+ADDI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRGP4 levelMenuInfo+1948
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRGP4 UI_SPLevelMenu_SetBots
+CALLV
+pop
+ADDRGP4 $154
+ARGP4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 selectedArena
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $261
+endproc UI_SPLevelMenu_LevelEvent 12 8
+proc UI_SPLevelMenu_LeftArrowEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $269
+ADDRGP4 $268
+JUMPV
+LABELV $269
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 minTier
+INDIRI4
+NEI4 $271
+ADDRGP4 $268
+JUMPV
+LABELV $271
+ADDRLP4 0
+ADDRGP4 selectedArenaSet
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 UI_SPLevelMenu_SetMenuItems
+CALLV
+pop
+LABELV $268
+endproc UI_SPLevelMenu_LeftArrowEvent 4 0
+proc UI_SPLevelMenu_RightArrowEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $274
+ADDRGP4 $273
+JUMPV
+LABELV $274
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 maxTier
+INDIRI4
+NEI4 $276
+ADDRGP4 $273
+JUMPV
+LABELV $276
+ADDRLP4 0
+ADDRGP4 selectedArenaSet
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 UI_SPLevelMenu_SetMenuItems
+CALLV
+pop
+LABELV $273
+endproc UI_SPLevelMenu_RightArrowEvent 4 0
+proc UI_SPLevelMenu_PlayerEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $279
+ADDRGP4 $278
+JUMPV
+LABELV $279
+ADDRGP4 UI_PlayerSettingsMenu
+CALLV
+pop
+LABELV $278
+endproc UI_SPLevelMenu_PlayerEvent 0 0
+proc UI_SPLevelMenu_AwardEvent 4 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $282
+ADDRGP4 $281
+JUMPV
+LABELV $282
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 17
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2488
+ADDP4
+INDIRI4
+ARGI4
+CNSTI4 7
+ARGI4
+ADDRGP4 trap_S_StartLocalSound
+CALLV
+pop
+LABELV $281
+endproc UI_SPLevelMenu_AwardEvent 4 8
+proc UI_SPLevelMenu_NextEvent 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $286
+ADDRGP4 $285
+JUMPV
+LABELV $286
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $288
+ADDRGP4 $285
+JUMPV
+LABELV $288
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+NEI4 $290
+ADDRGP4 selectedArena
+CNSTI4 0
+ASGNI4
+LABELV $290
+ADDRGP4 levelMenuInfo+1948
+INDIRP4
+ARGP4
+ADDRGP4 UI_SPSkillMenu
+CALLV
+pop
+LABELV $285
+endproc UI_SPLevelMenu_NextEvent 0 4
+proc UI_SPLevelMenu_BackEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $294
+ADDRGP4 $293
+JUMPV
+LABELV $294
+ADDRGP4 selectedArena
+INDIRI4
+CNSTI4 -1
+NEI4 $296
+ADDRGP4 selectedArena
+CNSTI4 0
+ASGNI4
+LABELV $296
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $293
+endproc UI_SPLevelMenu_BackEvent 0 0
+proc UI_SPLevelMenu_CustomEvent 0 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $299
+ADDRGP4 $298
+JUMPV
+LABELV $299
+CNSTI4 0
+ARGI4
+ADDRGP4 UI_StartServerMenu
+CALLV
+pop
+LABELV $298
+endproc UI_SPLevelMenu_CustomEvent 0 4
+proc UI_SPLevelMenu_MenuDraw 1160 20
+ADDRGP4 levelMenuInfo+1944
+INDIRI4
+CNSTI4 0
+EQI4 $302
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_SPLevelMenu
+CALLV
+pop
+ADDRGP4 $301
+JUMPV
+LABELV $302
+ADDRGP4 $107
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 16
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 314
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $104
+ARGP4
+ADDRLP4 104
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 104
+ARGP4
+ADDRGP4 levelMenuInfo+2336
+ARGP4
+ADDRLP4 1128
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 1128
+INDIRI4
+CNSTI4 0
+EQI4 $305
+ADDRGP4 levelMenuInfo+2336
+ARGP4
+ADDRLP4 104
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 levelMenuInfo+2336
+ARGP4
+ADDRGP4 levelMenuInfo+2400
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 PlayerIcon
+CALLV
+pop
+ADDRGP4 levelMenuInfo+888+68
+CNSTI4 0
+ASGNI4
+LABELV $305
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 340
+ASGNI4
+ADDRLP4 1132
+CNSTI4 0
+ASGNI4
+ADDRLP4 80
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 1132
+INDIRI4
+ASGNI4
+LABELV $315
+ADDRLP4 12
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2464
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 0
+LEI4 $320
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $322
+ADDRLP4 4
+CNSTI4 224
+ADDRLP4 80
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 2
+DIVI4
+CNSTI4 6
+LSHI4
+SUBI4
+ASGNI4
+ADDRGP4 $323
+JUMPV
+LABELV $322
+ADDRLP4 4
+ADDRLP4 80
+INDIRI4
+CNSTI4 2
+DIVI4
+CNSTI4 6
+LSHI4
+CNSTI4 368
+ADDI4
+ASGNI4
+LABELV $323
+ADDRLP4 1136
+CNSTI4 1
+ASGNI4
+ADDRLP4 80
+ADDRLP4 80
+INDIRI4
+ADDRLP4 1136
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 1136
+INDIRI4
+NEI4 $324
+ADDRGP4 $316
+JUMPV
+LABELV $324
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000000
+LTI4 $326
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $328
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000000
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $327
+JUMPV
+LABELV $326
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000
+LTI4 $329
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $331
+ARGP4
+ADDRLP4 12
+INDIRI4
+CNSTI4 1000
+DIVI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $330
+JUMPV
+LABELV $329
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $332
+ARGP4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $330
+LABELV $327
+ADDRLP4 4
+INDIRI4
+CNSTI4 24
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 48
+ADDI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 1
+ARGI4
+ADDRGP4 color_yellow
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $320
+LABELV $316
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $315
+ADDRGP4 $333
+ARGP4
+ADDRGP4 selectedArenaSet
+INDIRI4
+CNSTI4 1
+ADDI4
+ARGI4
+ADDRLP4 1136
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 18
+ARGI4
+CNSTI4 38
+ARGI4
+ADDRLP4 1136
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $337
+JUMPV
+LABELV $334
+ADDRLP4 1140
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1140
+INDIRI4
+ADDRGP4 levelMenuInfo+448+12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1140
+INDIRI4
+ADDRGP4 levelMenuInfo+448+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 96
+ADDI4
+CVIF4 4
+ARGF4
+CNSTF4 1124073472
+ARGF4
+CNSTF4 1099956224
+ARGF4
+ADDRGP4 color_black
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+LABELV $335
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $337
+ADDRLP4 0
+INDIRI4
+ADDRGP4 levelMenuInfo+1952
+INDIRI4
+LTI4 $334
+ADDRGP4 selectedArenaSet
+INDIRI4
+ADDRGP4 currentSet
+INDIRI4
+LEI4 $343
+CNSTI4 320
+ARGI4
+CNSTI4 216
+ARGI4
+ADDRGP4 $345
+ARGP4
+CNSTI4 33
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRGP4 $301
+JUMPV
+LABELV $343
+ADDRLP4 88
+ADDRGP4 color_white
+INDIRF4
+ASGNF4
+ADDRLP4 88+4
+ADDRGP4 color_white+4
+INDIRF4
+ASGNF4
+ADDRLP4 88+8
+ADDRGP4 color_white+8
+INDIRF4
+ASGNF4
+ADDRLP4 88+12
+ADDRGP4 color_white+12
+INDIRF4
+ASGNF4
+ADDRGP4 uis+4
+INDIRI4
+CNSTI4 75
+DIVI4
+CVIF4 4
+ARGF4
+ADDRLP4 1140
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 88+12
+CNSTF4 1056964608
+ADDRLP4 1140
+INDIRF4
+MULF4
+CNSTF4 1056964608
+ADDF4
+ASGNF4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $357
+JUMPV
+LABELV $354
+ADDRLP4 1148
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 1148
+INDIRI4
+ADDRGP4 levelMenuInfo+448+12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 1148
+INDIRI4
+ADDRGP4 levelMenuInfo+448+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 96
+ADDI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 levelMenuInfo+2212
+ADDP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2276
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $364
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1124073472
+ARGF4
+CNSTF4 1119879168
+ARGF4
+ADDRLP4 1152
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 1152
+INDIRI4
+LSHI4
+ADDRGP4 levelMenuInfo+2292
+ADDP4
+INDIRI4
+ADDRLP4 1152
+INDIRI4
+LSHI4
+ADDRGP4 levelMenuInfo+2316-4
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $364
+ADDRLP4 0
+INDIRI4
+ADDRGP4 selectedArena
+INDIRI4
+NEI4 $370
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRLP4 1152
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448
+ADDP4
+CVPU4 4
+ADDRLP4 1152
+INDIRP4
+CVPU4 4
+NEU4 $372
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $372
+ADDRLP4 1156
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+ADDRLP4 1156
+INDIRI4
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1124204544
+ARGF4
+CNSTF4 1122500608
+ARGF4
+ADDRGP4 levelMenuInfo+2308
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRGP4 $371
+JUMPV
+LABELV $370
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRLP4 1152
+ADDRGP4 Menu_ItemAtCursor
+CALLP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+448
+ADDP4
+CVPU4 4
+ADDRLP4 1152
+INDIRP4
+CVPU4 4
+NEU4 $376
+ADDRLP4 88
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 31
+SUBI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CNSTI4 30
+SUBI4
+CVIF4 4
+ARGF4
+CNSTF4 1132462080
+ARGF4
+CNSTF4 1130692608
+ARGF4
+ADDRGP4 levelMenuInfo+2312
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+CNSTP4 0
+ARGP4
+ADDRGP4 trap_R_SetColor
+CALLV
+pop
+LABELV $376
+LABELV $371
+LABELV $355
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $357
+ADDRLP4 0
+INDIRI4
+ADDRGP4 levelMenuInfo+1952
+INDIRI4
+LTI4 $354
+ADDRLP4 8
+CNSTI4 192
+ASGNI4
+ADDRGP4 levelMenuInfo+1948
+INDIRP4
+ARGP4
+ADDRGP4 $117
+ARGP4
+ADDRLP4 1144
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 1144
+INDIRP4
+ARGP4
+CNSTI4 20
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 104
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 levelMenuInfo+1948
+INDIRP4
+ARGP4
+ADDRGP4 $383
+ARGP4
+ADDRLP4 1148
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $381
+ARGP4
+ADDRLP4 104
+ARGP4
+ADDRLP4 1148
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+CNSTI4 320
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 16
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 24
+ADDI4
+ASGNI4
+ADDRLP4 84
+CNSTI4 90
+CNSTI4 7
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+SUBI4
+MULI4
+CNSTI4 2
+DIVI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $388
+JUMPV
+LABELV $385
+ADDRLP4 4
+ADDRLP4 84
+INDIRI4
+CNSTI4 18
+ADDI4
+CNSTI4 90
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2516
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $390
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1156
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2516
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+ADDRGP4 $391
+JUMPV
+LABELV $390
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 1156
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRLP4 1156
+INDIRF4
+ARGF4
+ADDRGP4 color_black
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 4
+INDIRI4
+CNSTI4 22
+ADDI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 18
+ADDI4
+ARGI4
+ADDRGP4 $394
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawProportionalString
+CALLV
+pop
+LABELV $391
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ARGI4
+CNSTI4 10
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+2544
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $386
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $388
+ADDRLP4 0
+INDIRI4
+ADDRGP4 levelMenuInfo+2512
+INDIRI4
+LTI4 $385
+LABELV $301
+endproc UI_SPLevelMenu_MenuDraw 1160 20
+export UI_SPLevelMenu_Cache
+proc UI_SPLevelMenu_Cache 32 8
+ADDRGP4 $397
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $398
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $399
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $400
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $133
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $401
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $402
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $403
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $404
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $405
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $406
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $407
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $408
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $409
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $410
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $411
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $412
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $413
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $414
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_medalPicNames
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 ui_medalSounds
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 8
+ADDRGP4 trap_S_RegisterSound
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 levelMenuInfo+2488
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+LABELV $415
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $414
+ADDRGP4 $398
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2308
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $397
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2312
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $401
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2316
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 $402
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2316+4
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $403
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2316+8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $404
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2316+12
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRGP4 $405
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRGP4 levelMenuInfo+2316+16
+ADDRLP4 28
+INDIRI4
+ASGNI4
+LABELV $396
+endproc UI_SPLevelMenu_Cache 32 8
+proc UI_SPLevelMenu_Init 128 12
+ADDRGP4 $431
+ARGP4
+ADDRLP4 84
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 16
+ADDRLP4 84
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+LTI4 $434
+ADDRLP4 16
+INDIRI4
+CNSTI4 5
+LEI4 $432
+LABELV $434
+ADDRGP4 $431
+ARGP4
+ADDRGP4 $435
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+LABELV $432
+ADDRGP4 levelMenuInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2616
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 levelMenuInfo+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 levelMenuInfo+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 levelMenuInfo+268
+ADDRGP4 UI_SPLevelMenu_MenuDraw
+ASGNP4
+ADDRGP4 UI_SPLevelMenu_Cache
+CALLV
+pop
+ADDRGP4 levelMenuInfo+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 levelMenuInfo+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 levelMenuInfo+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 levelMenuInfo+288+60
+ADDRGP4 $446
+ASGNP4
+ADDRGP4 levelMenuInfo+288+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 levelMenuInfo+288+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 levelMenuInfo+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+360+4
+ADDRGP4 $399
+ASGNP4
+ADDRGP4 levelMenuInfo+360+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+360+12
+CNSTI4 18
+ASGNI4
+ADDRGP4 levelMenuInfo+360+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+360+48
+ADDRGP4 UI_SPLevelMenu_LeftArrowEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+360+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 levelMenuInfo+360+76
+CNSTI4 16
+ASGNI4
+ADDRGP4 levelMenuInfo+360+80
+CNSTI4 114
+ASGNI4
+ADDRGP4 levelMenuInfo+360+60
+ADDRGP4 $400
+ASGNP4
+ADDRGP4 levelMenuInfo+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+448+4
+ADDRGP4 levelMenuInfo+1956
+ASGNP4
+ADDRGP4 levelMenuInfo+448+44
+CNSTU4 4
+ASGNU4
+ADDRGP4 levelMenuInfo+448+12
+CNSTI4 46
+ASGNI4
+ADDRGP4 levelMenuInfo+448+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+448+8
+CNSTI4 11
+ASGNI4
+ADDRGP4 levelMenuInfo+448+48
+ADDRGP4 UI_SPLevelMenu_LevelEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+448+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+448+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88+4
+ADDRGP4 levelMenuInfo+1956+64
+ASGNP4
+ADDRGP4 levelMenuInfo+448+88+44
+CNSTU4 4
+ASGNU4
+ADDRGP4 levelMenuInfo+448+88+12
+CNSTI4 186
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88+8
+CNSTI4 12
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88+48
+ADDRGP4 UI_SPLevelMenu_LevelEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+448+88+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+448+88+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+4
+ADDRGP4 levelMenuInfo+1956+128
+ASGNP4
+ADDRGP4 levelMenuInfo+448+176+44
+CNSTU4 4
+ASGNU4
+ADDRGP4 levelMenuInfo+448+176+12
+CNSTI4 326
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+8
+CNSTI4 13
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+48
+ADDRGP4 UI_SPLevelMenu_LevelEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+448+176+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+448+176+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+4
+ADDRGP4 levelMenuInfo+1956+192
+ASGNP4
+ADDRGP4 levelMenuInfo+448+264+44
+CNSTU4 4
+ASGNU4
+ADDRGP4 levelMenuInfo+448+264+12
+CNSTI4 466
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+8
+CNSTI4 14
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+48
+ADDRGP4 UI_SPLevelMenu_LevelEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+448+264+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+448+264+80
+CNSTI4 96
+ASGNI4
+ADDRGP4 levelMenuInfo+800
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+800+4
+ADDRGP4 $399
+ASGNP4
+ADDRGP4 levelMenuInfo+800+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+800+12
+CNSTI4 606
+ASGNI4
+ADDRGP4 levelMenuInfo+800+16
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+800+48
+ADDRGP4 UI_SPLevelMenu_RightArrowEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+800+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 levelMenuInfo+800+76
+CNSTI4 -16
+ASGNI4
+ADDRGP4 levelMenuInfo+800+80
+CNSTI4 114
+ASGNI4
+ADDRGP4 levelMenuInfo+800+60
+ADDRGP4 $400
+ASGNP4
+ADDRGP4 $104
+ARGP4
+ADDRGP4 levelMenuInfo+2336
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 levelMenuInfo+2336
+ARGP4
+ADDRGP4 levelMenuInfo+2400
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 PlayerIcon
+CALLV
+pop
+ADDRGP4 levelMenuInfo+888
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+888+4
+ADDRGP4 levelMenuInfo+2400
+ASGNP4
+ADDRGP4 levelMenuInfo+888+44
+CNSTU4 2052
+ASGNU4
+ADDRGP4 levelMenuInfo+888+12
+CNSTI4 288
+ASGNI4
+ADDRGP4 levelMenuInfo+888+16
+CNSTI4 340
+ASGNI4
+ADDRGP4 levelMenuInfo+888+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 levelMenuInfo+888+48
+ADDRGP4 UI_SPLevelMenu_PlayerEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+888+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+888+80
+CNSTI4 64
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $614
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 96
+ADDRGP4 UI_GetAwardLevel
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2464
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $615
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $614
+ADDRLP4 92
+CNSTI4 100
+ASGNI4
+ADDRGP4 levelMenuInfo+2464+16
+ADDRLP4 92
+INDIRI4
+ADDRGP4 levelMenuInfo+2464+16
+INDIRI4
+ADDRLP4 92
+INDIRI4
+DIVI4
+MULI4
+ASGNI4
+ADDRLP4 12
+CNSTI4 340
+ASGNI4
+ADDRLP4 96
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 96
+INDIRI4
+ASGNI4
+LABELV $623
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 levelMenuInfo+2464
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $627
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $630
+ADDRLP4 8
+CNSTI4 224
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+SUBI4
+CNSTI4 2
+DIVI4
+CNSTI4 6
+LSHI4
+SUBI4
+ASGNI4
+ADDRGP4 $631
+JUMPV
+LABELV $630
+ADDRLP4 8
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+DIVI4
+CNSTI4 6
+LSHI4
+CNSTI4 368
+ADDI4
+ASGNI4
+LABELV $631
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 ui_medalPicNames
+ADDP4
+INDIRP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+44
+ADDP4
+CNSTU4 1050628
+ASGNU4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+12
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+16
+ADDP4
+ADDRLP4 12
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 17
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+48
+ADDP4
+ADDRGP4 UI_SPLevelMenu_AwardEvent
+ASGNP4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+76
+ADDP4
+CNSTI4 48
+ASGNI4
+CNSTI4 88
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976+80
+ADDP4
+CNSTI4 48
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $627
+LABELV $624
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $623
+ADDRGP4 levelMenuInfo+1504
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+4
+ADDRGP4 $406
+ASGNP4
+ADDRGP4 levelMenuInfo+1504+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+1504+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+48
+ADDRGP4 UI_SPLevelMenu_BackEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1504+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1504+60
+ADDRGP4 $407
+ASGNP4
+ADDRGP4 levelMenuInfo+1592
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+4
+ADDRGP4 $410
+ASGNP4
+ADDRGP4 levelMenuInfo+1592+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+1592+12
+CNSTI4 170
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+48
+ADDRGP4 UI_SPLevelMenu_ResetEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1592+8
+CNSTI4 24
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1592+60
+ADDRGP4 $411
+ASGNP4
+ADDRGP4 levelMenuInfo+1680
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+4
+ADDRGP4 $412
+ASGNP4
+ADDRGP4 levelMenuInfo+1680+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 levelMenuInfo+1680+12
+CNSTI4 342
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+48
+ADDRGP4 UI_SPLevelMenu_CustomEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1680+8
+CNSTI4 25
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1680+60
+ADDRGP4 $413
+ASGNP4
+ADDRGP4 levelMenuInfo+1768
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+4
+ADDRGP4 $408
+ASGNP4
+ADDRGP4 levelMenuInfo+1768+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 levelMenuInfo+1768+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+48
+ADDRGP4 UI_SPLevelMenu_NextEvent
+ASGNP4
+ADDRGP4 levelMenuInfo+1768+8
+CNSTI4 26
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 levelMenuInfo+1768+60
+ADDRGP4 $409
+ASGNP4
+ADDRGP4 levelMenuInfo+1856
+CNSTI4 6
+ASGNI4
+ADDRGP4 levelMenuInfo+1856+44
+CNSTU4 1050628
+ASGNU4
+ADDRGP4 levelMenuInfo+1856+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+1856+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 levelMenuInfo+1856+76
+CNSTI4 640
+ASGNI4
+ADDRGP4 levelMenuInfo+1856+80
+CNSTI4 480
+ASGNI4
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+448+88
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+448+176
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+448+264
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 100
+ADDRGP4 levelMenuInfo+448+32
+ASGNP4
+ADDRLP4 100
+INDIRP4
+ADDRLP4 100
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRLP4 104
+ADDRGP4 levelMenuInfo+448+88+32
+ASGNP4
+ADDRLP4 104
+INDIRP4
+ADDRLP4 104
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRLP4 108
+ADDRGP4 levelMenuInfo+448+176+32
+ASGNP4
+ADDRLP4 108
+INDIRP4
+ADDRLP4 108
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRLP4 112
+ADDRGP4 levelMenuInfo+448+264+32
+ASGNP4
+ADDRLP4 112
+INDIRP4
+ADDRLP4 112
+INDIRP4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+800
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+888
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $761
+JUMPV
+LABELV $758
+ADDRGP4 levelMenuInfo
+ARGP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 levelMenuInfo+976
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $759
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $761
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LTI4 $758
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1504
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1592
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1768
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1856
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $154
+ARGP4
+ADDRLP4 20
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 20
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $768
+ADDRLP4 20
+ARGP4
+ADDRLP4 116
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 116
+INDIRI4
+ASGNI4
+ADDRLP4 124
+CNSTI4 4
+ASGNI4
+ADDRGP4 selectedArenaSet
+ADDRLP4 0
+INDIRI4
+ADDRLP4 124
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 selectedArena
+ADDRLP4 0
+INDIRI4
+ADDRLP4 124
+INDIRI4
+MODI4
+ASGNI4
+ADDRGP4 $769
+JUMPV
+LABELV $768
+ADDRGP4 selectedArenaSet
+ADDRGP4 currentSet
+INDIRI4
+ASGNI4
+ADDRGP4 selectedArena
+ADDRGP4 currentGame
+INDIRI4
+ASGNI4
+LABELV $769
+ADDRGP4 UI_SPLevelMenu_SetMenuItems
+CALLV
+pop
+LABELV $430
+endproc UI_SPLevelMenu_Init 128 12
+export UI_SPLevelMenu
+proc UI_SPLevelMenu 36 8
+ADDRGP4 trainingTier
+CNSTI4 -1
+ASGNI4
+ADDRGP4 $157
+ARGP4
+ADDRLP4 12
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $771
+ADDRGP4 minTier
+ADDRGP4 trainingTier
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $158
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $772
+JUMPV
+LABELV $771
+ADDRGP4 minTier
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 -2
+ASGNI4
+LABELV $772
+ADDRLP4 16
+ADDRGP4 UI_GetNumSPTiers
+CALLI4
+ASGNI4
+ADDRGP4 finalTier
+ADDRLP4 16
+INDIRI4
+ASGNI4
+ADDRGP4 $192
+ARGP4
+ADDRLP4 20
+ADDRGP4 UI_GetSpecialArenaInfo
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $773
+ADDRGP4 maxTier
+ADDRGP4 finalTier
+INDIRI4
+ASGNI4
+ADDRGP4 $774
+JUMPV
+LABELV $773
+ADDRLP4 24
+ADDRGP4 maxTier
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRGP4 finalTier
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRLP4 24
+INDIRP4
+INDIRI4
+ADDRGP4 minTier
+INDIRI4
+GEI4 $775
+ADDRGP4 maxTier
+ADDRGP4 minTier
+INDIRI4
+ASGNI4
+LABELV $775
+LABELV $774
+ADDRLP4 24
+ADDRGP4 UI_GetCurrentGame
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 -1
+NEI4 $777
+ADDRLP4 28
+ADDRGP4 UI_GetNumSPArenas
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 28
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 maxTier
+INDIRI4
+ADDRGP4 finalTier
+INDIRI4
+NEI4 $779
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $779
+LABELV $777
+ADDRLP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+NEI4 $781
+ADDRGP4 currentSet
+CNSTI4 -1
+ASGNI4
+ADDRGP4 currentGame
+CNSTI4 0
+ASGNI4
+ADDRGP4 $782
+JUMPV
+LABELV $781
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRGP4 currentSet
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 currentGame
+ADDRLP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+MODI4
+ASGNI4
+LABELV $782
+ADDRGP4 UI_SPLevelMenu_Init
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 levelMenuInfo
+ARGP4
+ADDRGP4 levelMenuInfo+1768
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $770
+endproc UI_SPLevelMenu 36 8
+export UI_SPLevelMenu_f
+proc UI_SPLevelMenu_f 0 4
+CNSTI4 2
+ARGI4
+ADDRGP4 trap_Key_SetCatcher
+CALLV
+pop
+ADDRGP4 uis+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 UI_SPLevelMenu
+CALLV
+pop
+LABELV $784
+endproc UI_SPLevelMenu_f 0 4
+export UI_SPLevelMenu_ReInit
+proc UI_SPLevelMenu_ReInit 0 0
+ADDRGP4 levelMenuInfo+1944
+CNSTI4 1
+ASGNI4
+LABELV $786
+endproc UI_SPLevelMenu_ReInit 0 0
+bss
+align 4
+LABELV maxTier
+skip 4
+align 4
+LABELV minTier
+skip 4
+align 4
+LABELV finalTier
+skip 4
+align 4
+LABELV trainingTier
+skip 4
+align 4
+LABELV currentGame
+skip 4
+align 4
+LABELV currentSet
+skip 4
+align 4
+LABELV selectedArena
+skip 4
+align 4
+LABELV selectedArenaSet
+skip 4
+align 4
+LABELV levelMenuInfo
+skip 2616
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $446
+byte 1 67
+byte 1 72
+byte 1 79
+byte 1 79
+byte 1 83
+byte 1 69
+byte 1 32
+byte 1 76
+byte 1 69
+byte 1 86
+byte 1 69
+byte 1 76
+byte 1 0
+align 1
+LABELV $435
+byte 1 50
+byte 1 0
+align 1
+LABELV $431
+byte 1 103
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 0
+align 1
+LABELV $413
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $412
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 115
+byte 1 107
+byte 1 105
+byte 1 114
+byte 1 109
+byte 1 105
+byte 1 115
+byte 1 104
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $411
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $410
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $409
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $408
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $407
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $406
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $405
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 53
+byte 1 0
+align 1
+LABELV $404
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 52
+byte 1 0
+align 1
+LABELV $403
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 51
+byte 1 0
+align 1
+LABELV $402
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 50
+byte 1 0
+align 1
+LABELV $401
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 112
+byte 1 108
+byte 1 101
+byte 1 116
+byte 1 101
+byte 1 49
+byte 1 0
+align 1
+LABELV $400
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $399
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $398
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $397
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $394
+byte 1 63
+byte 1 0
+align 1
+LABELV $383
+byte 1 108
+byte 1 111
+byte 1 110
+byte 1 103
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $381
+byte 1 37
+byte 1 115
+byte 1 58
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $345
+byte 1 65
+byte 1 67
+byte 1 67
+byte 1 69
+byte 1 83
+byte 1 83
+byte 1 32
+byte 1 68
+byte 1 69
+byte 1 78
+byte 1 73
+byte 1 69
+byte 1 68
+byte 1 0
+align 1
+LABELV $333
+byte 1 84
+byte 1 105
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $332
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $331
+byte 1 37
+byte 1 105
+byte 1 107
+byte 1 0
+align 1
+LABELV $328
+byte 1 37
+byte 1 105
+byte 1 109
+byte 1 0
+align 1
+LABELV $260
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 69
+byte 1 84
+byte 1 32
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 63
+byte 1 0
+align 1
+LABELV $253
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 111
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 102
+byte 1 114
+byte 1 111
+byte 1 109
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 98
+byte 1 101
+byte 1 103
+byte 1 105
+byte 1 110
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 46
+byte 1 0
+align 1
+LABELV $252
+byte 1 68
+byte 1 111
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 111
+byte 1 110
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 105
+byte 1 102
+byte 1 32
+byte 1 121
+byte 1 111
+byte 1 117
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 110
+byte 1 116
+byte 1 32
+byte 1 116
+byte 1 111
+byte 1 0
+align 1
+LABELV $251
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 32
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 118
+byte 1 97
+byte 1 114
+byte 1 105
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 115
+byte 1 46
+byte 1 0
+align 1
+LABELV $250
+byte 1 87
+byte 1 65
+byte 1 82
+byte 1 78
+byte 1 73
+byte 1 78
+byte 1 71
+byte 1 58
+byte 1 32
+byte 1 84
+byte 1 104
+byte 1 105
+byte 1 115
+byte 1 32
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 101
+byte 1 116
+byte 1 115
+byte 1 32
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 32
+byte 1 111
+byte 1 102
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 0
+align 1
+LABELV $192
+byte 1 102
+byte 1 105
+byte 1 110
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $158
+byte 1 110
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $157
+byte 1 116
+byte 1 114
+byte 1 97
+byte 1 105
+byte 1 110
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 0
+align 1
+LABELV $154
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 115
+byte 1 112
+byte 1 83
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 0
+align 1
+LABELV $133
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $128
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $117
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $107
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $104
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $83
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $76
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $73
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $72
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
@@ -0,0 +1,9160 @@
+data
+align 4
+LABELV gametype_items
+address $69
+address $70
+address $71
+address $72
+byte 4 0
+align 4
+LABELV gametype_remap
+byte 4 0
+byte 4 3
+byte 4 1
+byte 4 4
+align 4
+LABELV gametype_remap2
+byte 4 0
+byte 4 2
+byte 4 0
+byte 4 1
+byte 4 3
+code
+proc GametypeBits 36 8
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $75
+JUMPV
+LABELV $74
+ADDRLP4 8
+ARGP4
+CNSTI4 0
+ARGI4
+ADDRLP4 12
+ADDRGP4 COM_ParseExt
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $77
+ADDRGP4 $76
+JUMPV
+LABELV $77
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $81
+ARGP4
+ADDRLP4 16
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+NEI4 $79
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+BORI4
+ASGNI4
+ADDRGP4 $75
+JUMPV
+LABELV $79
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $84
+ARGP4
+ADDRLP4 20
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+NEI4 $82
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+BORI4
+ASGNI4
+ADDRGP4 $75
+JUMPV
+LABELV $82
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $87
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $85
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+ADDRGP4 $75
+JUMPV
+LABELV $85
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $90
+ARGP4
+ADDRLP4 28
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+NEI4 $88
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+BORI4
+ASGNI4
+ADDRGP4 $75
+JUMPV
+LABELV $88
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $93
+ARGP4
+ADDRLP4 32
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+NEI4 $91
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+BORI4
+ASGNI4
+LABELV $91
+LABELV $75
+ADDRGP4 $74
+JUMPV
+LABELV $76
+ADDRLP4 4
+INDIRI4
+RETI4
+LABELV $73
+endproc GametypeBits 36 8
+bss
+align 1
+LABELV $95
+skip 256
+code
+proc StartServer_Update 28 16
+ADDRLP4 4
+ADDRGP4 s_startserver+1948
+INDIRI4
+CNSTI4 2
+LSHI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $97
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ADDRGP4 s_startserver+1944
+INDIRI4
+LTI4 $101
+ADDRGP4 $119
+JUMPV
+LABELV $101
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $95
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $104
+ARGP4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_startserver+1956
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 12
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTI4 -65
+CVIU4 4
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 $95
+ADDP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 20
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+ADDRLP4 24
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+44
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTI4 -16385
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $98
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $97
+ADDRGP4 $119
+JUMPV
+LABELV $116
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTI4 -65
+CVIU4 4
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+4
+ADDP4
+CNSTP4 0
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 12
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTI4 -257
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 16
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+44
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $117
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $119
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $116
+ADDRGP4 s_startserver+1944
+INDIRI4
+CNSTI4 0
+NEI4 $130
+ADDRLP4 8
+ADDRGP4 s_startserver+1688+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 s_startserver+1776+60
+INDIRP4
+ARGP4
+ADDRGP4 $137
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 $131
+JUMPV
+LABELV $130
+ADDRLP4 8
+ADDRGP4 s_startserver+1688+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTI4 -16385
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 0
+ADDRGP4 s_startserver+1940
+INDIRI4
+ADDRLP4 4
+INDIRI4
+SUBI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $141
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+GEI4 $141
+ADDRLP4 16
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+44
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 20
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTI4 -257
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $141
+ADDRGP4 s_startserver+1776+60
+INDIRP4
+ARGP4
+ADDRGP4 s_startserver+1940
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_startserver+1956
+ADDP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $131
+ADDRGP4 s_startserver+1776+60
+INDIRP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+LABELV $94
+endproc StartServer_Update 28 16
+proc StartServer_MapEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $154
+ADDRGP4 $153
+JUMPV
+LABELV $154
+ADDRGP4 s_startserver+1940
+ADDRGP4 s_startserver+1948
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CNSTI4 11
+SUBI4
+ADDI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+LABELV $153
+endproc StartServer_MapEvent 0 0
+proc StartServer_GametypeEvent 52 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $159
+ADDRGP4 $158
+JUMPV
+LABELV $159
+ADDRLP4 20
+ADDRGP4 UI_GetNumArenas
+CALLI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver+1944
+CNSTI4 0
+ASGNI4
+ADDRLP4 24
+CNSTI4 2
+ASGNI4
+ADDRLP4 28
+ADDRGP4 gametype_remap
+ASGNP4
+ADDRLP4 12
+CNSTI4 1
+ADDRGP4 s_startserver+536+64
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI4
+LSHI4
+ASGNI4
+ADDRGP4 s_startserver+536+64
+INDIRI4
+ADDRLP4 24
+INDIRI4
+LSHI4
+ADDRLP4 28
+INDIRP4
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $164
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+BORI4
+ASGNI4
+LABELV $164
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $171
+JUMPV
+LABELV $168
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 32
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 36
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 GametypeBits
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+BANDI4
+CNSTI4 0
+NEI4 $173
+ADDRGP4 $169
+JUMPV
+LABELV $173
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $177
+ARGP4
+ADDRLP4 44
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRGP4 s_startserver+1944
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_startserver+1956
+ADDP4
+ARGP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_startserver+1944
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_startserver+1956
+ADDP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 s_startserver+1944
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+2980
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 s_startserver+1944
+ASGNP4
+ADDRLP4 48
+INDIRP4
+ADDRLP4 48
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $169
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $171
+ADDRLP4 0
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LTI4 $168
+ADDRLP4 32
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_startserver+1952
+ADDRGP4 s_startserver+1944
+INDIRI4
+ADDRLP4 32
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 32
+INDIRI4
+DIVI4
+ASGNI4
+ADDRGP4 s_startserver+1948
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+1940
+CNSTI4 0
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+LABELV $158
+endproc StartServer_GametypeEvent 52 12
+proc StartServer_MenuEvent 12 8
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $188
+ADDRGP4 $187
+JUMPV
+LABELV $188
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 15
+LTI4 $190
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+GTI4 $190
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $210-60
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $210
+address $193
+address $198
+address $209
+address $204
+code
+LABELV $193
+ADDRGP4 s_startserver+1948
+INDIRI4
+CNSTI4 0
+LEI4 $191
+ADDRLP4 8
+ADDRGP4 s_startserver+1948
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $198
+ADDRGP4 s_startserver+1948
+INDIRI4
+ADDRGP4 s_startserver+1952
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $191
+ADDRLP4 8
+ADDRGP4 s_startserver+1948
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 StartServer_Update
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $204
+ADDRGP4 $205
+ARGP4
+ADDRGP4 s_startserver+536+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 gametype_remap
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_startserver+1936
+INDIRI4
+ARGI4
+ADDRGP4 UI_ServerOptionsMenu
+CALLV
+pop
+ADDRGP4 $191
+JUMPV
+LABELV $209
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $190
+LABELV $191
+LABELV $187
+endproc StartServer_MenuEvent 12 8
+proc StartServer_LevelshotDraw 56 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $213
+ADDRGP4 $212
+JUMPV
+LABELV $213
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $215
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $215
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $217
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $217
+ADDRLP4 0
+INDIRP4
+CNSTI4 64
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+ADDRLP4 44
+INDIRI4
+ASGNI4
+LABELV $217
+LABELV $215
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $219
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+CNSTI4 0
+NEI4 $219
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+LABELV $219
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+CNSTI4 0
+EQI4 $221
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 68
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $221
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1105199104
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 44
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+DIVI4
+ADDI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 20
+ADDRGP4 s_startserver+1948
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LSHI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ADDI4
+CNSTI4 11
+SUBI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ADDRLP4 48
+INDIRI4
+LSHI4
+ADDRGP4 s_startserver+1956
+ADDP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+CNSTI4 28
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 64
+BANDU4
+CNSTU4 0
+EQU4 $225
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 12
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 16
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 72
+ADDP4
+INDIRI4
+ARGI4
+ADDRGP4 UI_DrawHandlePic
+CALLV
+pop
+LABELV $225
+LABELV $212
+endproc StartServer_LevelshotDraw 56 20
+bss
+align 1
+LABELV $228
+skip 64
+code
+proc StartServer_MenuInit 32 12
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 3236
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 StartServer_Cache
+CALLV
+pop
+ADDRGP4 s_startserver+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_startserver+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_startserver+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_startserver+288+60
+ADDRGP4 $238
+ASGNP4
+ADDRGP4 s_startserver+288+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_startserver+288+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_startserver+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+360+4
+ADDRGP4 $246
+ASGNP4
+ADDRGP4 s_startserver+360+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_startserver+360+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+360+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_startserver+360+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_startserver+360+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_startserver+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+448+4
+ADDRGP4 $260
+ASGNP4
+ADDRGP4 s_startserver+448+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_startserver+448+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_startserver+448+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_startserver+448+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_startserver+448+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_startserver+536
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_startserver+536+4
+ADDRGP4 $274
+ASGNP4
+ADDRGP4 s_startserver+536+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_startserver+536+48
+ADDRGP4 StartServer_GametypeEvent
+ASGNP4
+ADDRGP4 s_startserver+536+8
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_startserver+536+12
+CNSTI4 296
+ASGNI4
+ADDRGP4 s_startserver+536+16
+CNSTI4 368
+ASGNI4
+ADDRGP4 s_startserver+536+76
+ADDRGP4 gametype_items
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $287
+ADDRLP4 12
+CNSTI4 136
+ASGNI4
+ADDRLP4 20
+CNSTI4 2
+ASGNI4
+ADDRLP4 4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+MODI4
+MULI4
+CNSTI4 188
+ADDI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 20
+INDIRI4
+DIVI4
+MULI4
+CNSTI4 96
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+44
+ADDP4
+CNSTU4 16388
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+76
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+80
+ADDP4
+CNSTI4 96
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+60
+ADDP4
+ADDRGP4 $306
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+64
+ADDP4
+ADDRGP4 $309
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632+56
+ADDP4
+ADDRGP4 StartServer_LevelshotDraw
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+44
+ADDP4
+CNSTU4 33028
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 11
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+48
+ADDP4
+ADDRGP4 StartServer_MapEvent
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 30
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+76
+ADDP4
+CNSTI4 256
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+80
+ADDP4
+CNSTI4 248
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+24
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+28
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 128
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+32
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 128
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984+60
+ADDP4
+ADDRGP4 $337
+ASGNP4
+LABELV $288
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $287
+ADDRGP4 s_startserver+1336
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+1336+4
+ADDRGP4 $341
+ASGNP4
+ADDRGP4 s_startserver+1336+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_startserver+1336+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 s_startserver+1336+16
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_startserver+1336+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_startserver+1336+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_startserver+1424
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+1424+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_startserver+1424+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+1424+8
+CNSTI4 15
+ASGNI4
+ADDRGP4 s_startserver+1424+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 s_startserver+1424+16
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_startserver+1424+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+1424+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_startserver+1424+60
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 s_startserver+1512
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+1512+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_startserver+1512+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+1512+8
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_startserver+1512+12
+CNSTI4 321
+ASGNI4
+ADDRGP4 s_startserver+1512+16
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_startserver+1512+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+1512+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 s_startserver+1512+60
+ADDRGP4 $387
+ASGNP4
+ADDRGP4 s_startserver+1776
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_startserver+1776+44
+CNSTU4 16392
+ASGNU4
+ADDRGP4 s_startserver+1776+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_startserver+1776+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 s_startserver+1776+60
+ADDRGP4 $228
+ASGNP4
+ADDRGP4 s_startserver+1776+64
+CNSTI4 33
+ASGNI4
+ADDRGP4 s_startserver+1776+68
+ADDRGP4 text_color_normal
+ASGNP4
+ADDRGP4 s_startserver+1600
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+1600+4
+ADDRGP4 $404
+ASGNP4
+ADDRGP4 s_startserver+1600+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_startserver+1600+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+1600+8
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_startserver+1600+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+1600+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_startserver+1600+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_startserver+1600+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+1600+60
+ADDRGP4 $421
+ASGNP4
+ADDRGP4 s_startserver+1688
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+1688+4
+ADDRGP4 $425
+ASGNP4
+ADDRGP4 s_startserver+1688+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_startserver+1688+48
+ADDRGP4 StartServer_MenuEvent
+ASGNP4
+ADDRGP4 s_startserver+1688+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_startserver+1688+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_startserver+1688+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_startserver+1688+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_startserver+1688+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_startserver+1688+60
+ADDRGP4 $442
+ASGNP4
+ADDRGP4 s_startserver+1848
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_startserver+1848+44
+CNSTU4 1050628
+ASGNU4
+ADDRGP4 s_startserver+1848+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+1848+16
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_startserver+1848+76
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_startserver+1848+80
+CNSTI4 480
+ASGNI4
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $458
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+632
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_startserver+984
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $459
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LTI4 $458
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1336
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1424
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1512
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1600
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1688
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1776
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 s_startserver+1848
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+CNSTP4 0
+ARGP4
+CNSTI4 3
+ARGI4
+ADDRGP4 StartServer_GametypeEvent
+CALLV
+pop
+LABELV $227
+endproc StartServer_MenuInit 32 12
+export StartServer_Cache
+proc StartServer_Cache 100 16
+ADDRGP4 $404
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $421
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $425
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $442
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $246
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $260
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $337
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $306
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $309
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $341
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $369
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $387
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $472
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 72
+ADDRLP4 76
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 80
+ADDRGP4 UI_GetNumArenas
+CALLI4
+ASGNI4
+ADDRGP4 s_startserver+1944
+ADDRLP4 80
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $477
+JUMPV
+LABELV $474
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 84
+ADDRGP4 UI_GetArenaInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 4
+ADDRLP4 84
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $177
+ARGP4
+ADDRLP4 88
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_startserver+1956
+ADDP4
+ARGP4
+ADDRLP4 88
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_startserver+1956
+ADDP4
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 $172
+ARGP4
+ADDRLP4 92
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 92
+INDIRP4
+ARGP4
+ADDRLP4 96
+ADDRGP4 GametypeBits
+CALLI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_startserver+2980
+ADDP4
+ADDRLP4 96
+INDIRI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+EQI4 $482
+ADDRLP4 8
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $104
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_startserver+1956
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRLP4 8
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $482
+LABELV $475
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $477
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_startserver+1944
+INDIRI4
+LTI4 $474
+ADDRLP4 84
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_startserver+1952
+ADDRGP4 s_startserver+1944
+INDIRI4
+ADDRLP4 84
+INDIRI4
+ADDI4
+CNSTI4 1
+SUBI4
+ADDRLP4 84
+INDIRI4
+DIVI4
+ASGNI4
+LABELV $471
+endproc StartServer_Cache 100 16
+export UI_StartServerMenu
+proc UI_StartServerMenu 0 4
+ADDRGP4 StartServer_MenuInit
+CALLV
+pop
+ADDRGP4 s_startserver+1936
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_startserver
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $487
+endproc UI_StartServerMenu 0 4
+data
+align 4
+LABELV dedicated_list
+address $490
+address $491
+address $492
+byte 4 0
+align 4
+LABELV playerType_list
+address $493
+address $494
+address $495
+byte 4 0
+align 4
+LABELV playerTeam_list
+address $496
+address $497
+byte 4 0
+align 4
+LABELV botSkill_list
+address $498
+address $499
+address $500
+address $501
+address $502
+byte 4 0
+code
+proc BotAlreadySelected 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $504
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $508
+ADDRGP4 $505
+JUMPV
+LABELV $508
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+LTI4 $512
+ADDRLP4 4
+CNSTI4 96
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+64
+ADDP4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_serveroptions+5924
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+64
+ADDP4
+INDIRI4
+EQI4 $512
+ADDRGP4 $505
+JUMPV
+LABELV $512
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $520
+CNSTI4 1
+RETI4
+ADDRGP4 $503
+JUMPV
+LABELV $520
+LABELV $505
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $504
+CNSTI4 0
+RETI4
+LABELV $503
+endproc BotAlreadySelected 12 8
+proc ServerOptions_Start 160 24
+ADDRGP4 s_serveroptions+632+60+12
+ARGP4
+ADDRLP4 100
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 76
+ADDRLP4 100
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+964+60+12
+ARGP4
+ADDRLP4 104
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 104
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1296+60+12
+ARGP4
+ADDRLP4 108
+ADDRGP4 atoi
+CALLI4
+ASGNI4
+ADDRLP4 88
+ADDRLP4 108
+INDIRI4
+ASGNI4
+ADDRLP4 84
+ADDRGP4 s_serveroptions+536+64
+INDIRI4
+ASGNI4
+ADDRLP4 92
+ADDRGP4 s_serveroptions+1628+60
+INDIRI4
+ASGNI4
+ADDRLP4 96
+ADDRGP4 s_serveroptions+2024+60
+INDIRI4
+ASGNI4
+ADDRLP4 72
+ADDRGP4 s_serveroptions+2088+64
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 112
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRLP4 68
+ADDRLP4 112
+INDIRI4
+ASGNI4
+ADDRGP4 $544
+JUMPV
+LABELV $541
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $545
+ADDRGP4 $542
+JUMPV
+LABELV $545
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $549
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $549
+ADDRGP4 $542
+JUMPV
+LABELV $549
+ADDRLP4 68
+ADDRLP4 68
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $542
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $544
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $541
+ADDRLP4 116
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+ASGNI4
+ADDRLP4 116
+INDIRI4
+CNSTI4 0
+LTI4 $554
+ADDRLP4 116
+INDIRI4
+CNSTI4 4
+GTI4 $554
+ADDRLP4 116
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $571
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $571
+address $557
+address $560
+address $554
+address $563
+address $567
+code
+LABELV $557
+LABELV $554
+ADDRGP4 $558
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $559
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $555
+JUMPV
+LABELV $560
+ADDRGP4 $561
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $562
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $555
+JUMPV
+LABELV $563
+ADDRGP4 $564
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $565
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $566
+ARGP4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $555
+JUMPV
+LABELV $567
+ADDRGP4 $568
+ARGP4
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $569
+ARGP4
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $570
+ARGP4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $555
+CNSTF4 0
+ARGF4
+CNSTF4 1094713344
+ARGF4
+ADDRLP4 68
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 120
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $572
+ARGP4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+CNSTF4 1073741824
+ARGF4
+ADDRLP4 84
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 124
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $573
+ARGP4
+ADDRLP4 124
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 128
+ADDRLP4 76
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+ARGF4
+ADDRLP4 128
+INDIRF4
+ARGF4
+ADDRLP4 132
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $574
+ARGP4
+ADDRLP4 132
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 136
+ADDRLP4 80
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 140
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $575
+ARGP4
+ADDRLP4 140
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+CNSTF4 0
+ARGF4
+ADDRLP4 144
+ADDRLP4 88
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 144
+INDIRF4
+ARGF4
+ADDRLP4 148
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 $576
+ARGP4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $577
+ARGP4
+ADDRLP4 92
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $578
+ARGP4
+ADDRLP4 96
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $579
+ARGP4
+ADDRGP4 s_serveroptions+1692+60+12
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $583
+ARGP4
+ADDRGP4 s_serveroptions+5944+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $586
+ARGP4
+ADDRGP4 s_startserver+1940
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_startserver+1956
+ADDP4
+ARGP4
+ADDRLP4 152
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 152
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+CNSTI4 2
+ARGI4
+ADDRGP4 $589
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 1
+ASGNI4
+LABELV $590
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+INDIRI4
+CNSTI4 1
+EQI4 $594
+ADDRGP4 $591
+JUMPV
+LABELV $594
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $598
+ADDRGP4 $591
+JUMPV
+LABELV $598
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+INDIRI1
+CVII4 1
+CNSTI4 45
+NEI4 $601
+ADDRGP4 $591
+JUMPV
+LABELV $601
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+LTI4 $604
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $607
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+64
+ADDP4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 playerTeam_list
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $605
+JUMPV
+LABELV $604
+ADDRLP4 4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $611
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+ARGP4
+ADDRLP4 72
+INDIRI4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $605
+CNSTI4 2
+ARGI4
+ADDRLP4 4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $591
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $590
+ADDRLP4 84
+INDIRI4
+CNSTI4 0
+NEI4 $613
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+LTI4 $613
+ADDRGP4 $616
+ARGP4
+ADDRGP4 s_serveroptions+4272+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 playerTeam_list
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 156
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 2
+ARGI4
+ADDRLP4 156
+INDIRP4
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $613
+LABELV $523
+endproc ServerOptions_Start 160 24
+proc ServerOptions_InitPlayerItems 12 12
+ADDRGP4 s_serveroptions+5688
+INDIRI4
+CNSTI4 0
+EQI4 $620
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $621
+JUMPV
+LABELV $620
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+LABELV $621
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $623
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $624
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $623
+ADDRGP4 s_serveroptions+5688
+INDIRI4
+CNSTI4 0
+EQI4 $629
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+GEI4 $629
+ADDRLP4 0
+CNSTI4 8
+ASGNI4
+LABELV $633
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $634
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $633
+LABELV $629
+ADDRGP4 s_serveroptions+536+64
+INDIRI4
+CNSTI4 0
+NEI4 $639
+ADDRLP4 8
+ADDRGP4 s_serveroptions+2256+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 s_serveroptions+2256+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $647
+ARGP4
+ADDRGP4 s_serveroptions+5728
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRGP4 s_serveroptions+5728
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+LABELV $639
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+LTI4 $651
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $654
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+64
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $655
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LTI4 $654
+ADDRGP4 $663
+JUMPV
+LABELV $660
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+64
+ADDP4
+CNSTI4 1
+ASGNI4
+LABELV $661
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $663
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $660
+ADDRGP4 $652
+JUMPV
+LABELV $651
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $666
+ADDRLP4 8
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $667
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $666
+LABELV $652
+LABELV $619
+endproc ServerOptions_InitPlayerItems 12 12
+proc ServerOptions_SetPlayerItems 12 0
+ADDRGP4 s_serveroptions+536+64
+INDIRI4
+CNSTI4 0
+NEI4 $673
+ADDRGP4 s_serveroptions+2184+60
+ADDRGP4 $679
+ASGNP4
+ADDRLP4 8
+ADDRGP4 s_serveroptions+3408+44
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTI4 -4097
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 $674
+JUMPV
+LABELV $673
+ADDRGP4 s_serveroptions+2184+60
+ADDRGP4 $493
+ASGNP4
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+LABELV $674
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $687
+JUMPV
+LABELV $684
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $688
+ADDRLP4 8
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTI4 -20481
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRGP4 $689
+JUMPV
+LABELV $688
+ADDRLP4 8
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $689
+LABELV $685
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $687
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $684
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+GEI4 $696
+ADDRGP4 $672
+JUMPV
+LABELV $696
+ADDRLP4 0
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $702
+JUMPV
+LABELV $699
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+INDIRI4
+CNSTI4 2
+NEI4 $703
+ADDRLP4 8
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 $704
+JUMPV
+LABELV $703
+ADDRLP4 8
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTI4 -20481
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $704
+LABELV $700
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $702
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $699
+LABELV $672
+endproc ServerOptions_SetPlayerItems 12 0
+proc ServerOptions_Event 8 0
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+LTI4 $712
+ADDRLP4 0
+INDIRI4
+CNSTI4 24
+GTI4 $712
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $728-72
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $728
+address $722
+address $712
+address $715
+address $718
+address $718
+address $719
+address $725
+code
+LABELV $715
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $716
+ADDRGP4 $713
+JUMPV
+LABELV $716
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+ADDRGP4 $713
+JUMPV
+LABELV $718
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+ADDRGP4 $713
+JUMPV
+LABELV $719
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $720
+ADDRGP4 $713
+JUMPV
+LABELV $720
+ADDRGP4 ServerOptions_Start
+CALLV
+pop
+ADDRGP4 $713
+JUMPV
+LABELV $722
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $713
+ADDRGP4 $713
+JUMPV
+LABELV $725
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $726
+ADDRGP4 $713
+JUMPV
+LABELV $726
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $712
+LABELV $713
+LABELV $711
+endproc ServerOptions_Event 8 0
+proc ServerOptions_PlayerNameEvent 4 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $731
+ADDRGP4 $730
+JUMPV
+LABELV $731
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+5924
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+ARGP4
+ADDRGP4 UI_BotSelectMenu
+CALLV
+pop
+LABELV $730
+endproc ServerOptions_PlayerNameEvent 4 4
+proc ServerOptions_StatusBar 4 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $736
+JUMPV
+LABELV $736
+CNSTI4 320
+ARGI4
+CNSTI4 440
+ARGI4
+ADDRGP4 $739
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 colorWhite
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $737
+LABELV $735
+endproc ServerOptions_StatusBar 4 20
+proc ServerOptions_LevelshotDraw 20 20
+ADDRGP4 s_serveroptions+5920
+INDIRI4
+CNSTI4 0
+EQI4 $741
+ADDRGP4 s_serveroptions+5924
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+ARGP4
+ADDRGP4 s_serveroptions+5928
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+5920
+CNSTI4 0
+ASGNI4
+LABELV $741
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Bitmap_Draw
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 80
+ADDP4
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CVIF4 4
+ARGF4
+CNSTF4 1109393408
+ARGF4
+ADDRGP4 colorBlack
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 76
+ADDP4
+INDIRI4
+CNSTI4 2
+DIVI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 s_serveroptions+5696
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 16
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 gametype_remap2
+ADDP4
+INDIRI4
+ADDRLP4 16
+INDIRI4
+LSHI4
+ADDRGP4 gametype_items
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_orange
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $740
+endproc ServerOptions_LevelshotDraw 20 20
+proc ServerOptions_InitBotNames 1072 12
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+LTI4 $751
+ADDRGP4 s_serveroptions+5728+16
+ARGP4
+ADDRGP4 $756
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+5728+32
+ARGP4
+ADDRGP4 $759
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+NEI4 $760
+ADDRGP4 s_serveroptions+5728+48
+ARGP4
+ADDRGP4 $765
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $761
+JUMPV
+LABELV $760
+ADDRGP4 s_serveroptions+2256+288+64
+CNSTI4 2
+ASGNI4
+LABELV $761
+ADDRGP4 s_serveroptions+2256+384+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_serveroptions+2256+480+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_serveroptions+5728+96
+ARGP4
+ADDRGP4 $777
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+5728+112
+ARGP4
+ADDRGP4 $756
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+5728+128
+ARGP4
+ADDRGP4 $759
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+NEI4 $782
+ADDRGP4 s_serveroptions+5728+144
+ARGP4
+ADDRGP4 $765
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $783
+JUMPV
+LABELV $782
+ADDRGP4 s_serveroptions+2256+864+64
+CNSTI4 2
+ASGNI4
+LABELV $783
+ADDRGP4 s_serveroptions+2256+960+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_serveroptions+2256+1056+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 $750
+JUMPV
+LABELV $751
+ADDRLP4 4
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+5696
+ARGP4
+ADDRLP4 1048
+ADDRGP4 UI_GetArenaInfoByMap
+CALLP4
+ASGNP4
+ADDRLP4 1044
+ADDRLP4 1048
+INDIRP4
+ASGNP4
+ADDRLP4 1044
+INDIRP4
+ARGP4
+ADDRGP4 $797
+ARGP4
+ADDRLP4 1052
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ARGP4
+ADDRLP4 1052
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRLP4 20
+ASGNP4
+ADDRGP4 $799
+JUMPV
+LABELV $801
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $802
+ADDRLP4 1056
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1056
+INDIRI4
+CNSTI4 0
+EQI4 $804
+ADDRLP4 1056
+INDIRI4
+CNSTI4 32
+EQI4 $801
+LABELV $804
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $805
+ADDRGP4 $800
+JUMPV
+LABELV $805
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $808
+JUMPV
+LABELV $807
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $808
+ADDRLP4 1060
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 1060
+INDIRI4
+CNSTI4 0
+EQI4 $810
+ADDRLP4 1060
+INDIRI4
+CNSTI4 32
+NEI4 $807
+LABELV $810
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $811
+ADDRLP4 1064
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 1064
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 1064
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $811
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRLP4 1064
+ADDRGP4 UI_GetBotInfoByName
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 1064
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRGP4 $647
+ARGP4
+ADDRLP4 1068
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 1068
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+ARGP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $799
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $815
+ADDRLP4 4
+INDIRI4
+CNSTI4 12
+LTI4 $802
+LABELV $815
+LABELV $800
+ADDRLP4 12
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 $819
+JUMPV
+LABELV $816
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+ARGP4
+ADDRGP4 $821
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+LABELV $817
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $819
+ADDRLP4 12
+INDIRI4
+CNSTI4 12
+LTI4 $816
+ADDRGP4 $825
+JUMPV
+LABELV $822
+CNSTI4 96
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+CNSTI4 0
+ASGNI4
+LABELV $823
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $825
+ADDRLP4 4
+INDIRI4
+CNSTI4 8
+LTI4 $822
+ADDRGP4 $831
+JUMPV
+LABELV $828
+CNSTI4 96
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+INDIRI4
+CNSTI4 1
+NEI4 $832
+CNSTI4 96
+ADDRLP4 4
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+64
+ADDP4
+CNSTI4 2
+ASGNI4
+LABELV $832
+LABELV $829
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $831
+ADDRLP4 4
+INDIRI4
+CNSTI4 12
+LTI4 $828
+LABELV $750
+endproc ServerOptions_InitBotNames 1072 12
+bss
+align 1
+LABELV $839
+skip 64
+code
+proc ServerOptions_SetMenuItems 84 16
+ADDRLP4 0
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+LTI4 $840
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+GTI4 $840
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $879
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $879
+address $843
+address $851
+address $840
+address $858
+address $868
+code
+LABELV $843
+LABELV $840
+ADDRGP4 $558
+ARGP4
+ADDRLP4 4
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 8
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+964+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $847
+ARGP4
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $559
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 12
+INDIRF4
+ARGF4
+ADDRLP4 16
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+632+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $847
+ARGP4
+ADDRLP4 16
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $841
+JUMPV
+LABELV $851
+ADDRGP4 $561
+ARGP4
+ADDRLP4 20
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 20
+INDIRF4
+ARGF4
+ADDRLP4 24
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+964+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $847
+ARGP4
+ADDRLP4 24
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $562
+ARGP4
+ADDRLP4 28
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 28
+INDIRF4
+ARGF4
+ADDRLP4 32
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+632+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $847
+ARGP4
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $841
+JUMPV
+LABELV $858
+ADDRGP4 $564
+ARGP4
+ADDRLP4 36
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 36
+INDIRF4
+ARGF4
+ADDRLP4 40
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+964+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $847
+ARGP4
+ADDRLP4 40
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $565
+ARGP4
+ADDRLP4 44
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 44
+INDIRF4
+ARGF4
+ADDRLP4 48
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+632+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $847
+ARGP4
+ADDRLP4 48
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $867
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 52
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1628+60
+ADDRLP4 56
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $841
+JUMPV
+LABELV $868
+ADDRGP4 $872
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1120403456
+ARGF4
+ADDRLP4 60
+INDIRF4
+ARGF4
+ADDRLP4 64
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1296+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $847
+ARGP4
+ADDRLP4 64
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $569
+ARGP4
+ADDRLP4 68
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1148829696
+ARGF4
+ADDRLP4 68
+INDIRF4
+ARGF4
+ADDRLP4 72
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+632+60+12
+ARGP4
+CNSTI4 4
+ARGI4
+ADDRGP4 $847
+ARGP4
+ADDRLP4 72
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 $878
+ARGP4
+ADDRLP4 76
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 80
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+1628+60
+ADDRLP4 80
+INDIRF4
+CVFI4 4
+ASGNI4
+LABELV $841
+ADDRGP4 $579
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 s_serveroptions+1692+60+12
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 256
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $578
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+2024+60
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $839
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 $104
+ARGP4
+ADDRGP4 s_startserver+1940
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_startserver+1956
+ADDP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRGP4 s_serveroptions+360+4
+ADDRGP4 $839
+ASGNP4
+ADDRGP4 s_serveroptions+5696
+ARGP4
+ADDRGP4 s_startserver+1776+60
+INDIRP4
+ARGP4
+ADDRGP4 strcpy
+CALLP4
+pop
+ADDRGP4 s_serveroptions+5696
+ARGP4
+ADDRGP4 Q_strupr
+CALLP4
+pop
+ADDRGP4 ServerOptions_InitPlayerItems
+CALLV
+pop
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+ADDRGP4 ServerOptions_InitBotNames
+CALLV
+pop
+ADDRGP4 ServerOptions_SetPlayerItems
+CALLV
+pop
+LABELV $838
+endproc ServerOptions_SetMenuItems 84 16
+proc PlayerName_Draw 52 20
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 16
+ASGNI4
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ADDRLP4 32
+INDIRI4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 36
+ADDP4
+INDIRP4
+INDIRI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 40
+ADDP4
+INDIRI4
+NEI4 $898
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRGP4 $899
+JUMPV
+LABELV $898
+ADDRLP4 24
+CNSTI4 0
+ASGNI4
+LABELV $899
+ADDRLP4 20
+ADDRLP4 24
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 8192
+BANDU4
+CNSTU4 0
+EQU4 $900
+ADDRLP4 4
+ADDRGP4 text_color_disabled
+ASGNP4
+ADDRGP4 $901
+JUMPV
+LABELV $900
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $902
+ADDRLP4 4
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 16384
+BORI4
+ASGNI4
+ADDRGP4 $903
+JUMPV
+LABELV $902
+ADDRLP4 0
+INDIRP4
+CNSTI4 44
+ADDP4
+INDIRU4
+CNSTU4 1
+BANDU4
+CNSTU4 0
+EQU4 $904
+ADDRLP4 4
+ADDRGP4 text_color_highlight
+ASGNP4
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 4096
+BORI4
+ASGNI4
+ADDRGP4 $905
+JUMPV
+LABELV $904
+ADDRLP4 4
+ADDRGP4 text_color_normal
+ASGNP4
+LABELV $905
+LABELV $903
+LABELV $901
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $906
+ADDRLP4 40
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 44
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRLP4 48
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ADDRLP4 40
+INDIRI4
+SUBI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRLP4 0
+INDIRP4
+CNSTI4 32
+ADDP4
+INDIRI4
+ADDRLP4 44
+INDIRI4
+SUBI4
+ADDRLP4 48
+INDIRI4
+ADDI4
+CVIF4 4
+ARGF4
+ADDRGP4 listbar_color
+ARGP4
+ADDRGP4 UI_FillRect
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+CNSTI4 13
+ARGI4
+CNSTI4 4113
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawChar
+CALLV
+pop
+LABELV $906
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+SUBI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+CNSTI4 2
+BORI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 8
+INDIRI4
+CNSTI4 8
+ADDI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRP4
+CNSTI4 60
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 16
+INDIRI4
+ARGI4
+ADDRLP4 4
+INDIRP4
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $896
+endproc PlayerName_Draw 52 20
+proc ServerOptions_MenuInit 52 12
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 6040
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 s_serveroptions+5688
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $205
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1084227584
+ARGF4
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 12
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+5692
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $583
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+CNSTF4 0
+ARGF4
+CNSTF4 1065353216
+ARGF4
+ADDRLP4 16
+INDIRF4
+ARGF4
+ADDRLP4 20
+ADDRGP4 Com_Clamp
+CALLF4
+ASGNF4
+ADDRGP4 s_serveroptions+5944+64
+ADDRLP4 20
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 ServerOptions_Cache
+CALLV
+pop
+ADDRGP4 s_serveroptions+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_serveroptions+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_serveroptions+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_serveroptions+288+60
+ADDRGP4 $238
+ASGNP4
+ADDRGP4 s_serveroptions+288+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_serveroptions+288+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+360+44
+CNSTU4 16388
+ASGNU4
+ADDRGP4 s_serveroptions+360+12
+CNSTI4 352
+ASGNI4
+ADDRGP4 s_serveroptions+360+16
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_serveroptions+360+76
+CNSTI4 160
+ASGNI4
+ADDRGP4 s_serveroptions+360+80
+CNSTI4 120
+ASGNI4
+ADDRGP4 s_serveroptions+360+64
+ADDRGP4 $309
+ASGNP4
+ADDRGP4 s_serveroptions+360+56
+ADDRGP4 ServerOptions_LevelshotDraw
+ASGNP4
+ADDRGP4 s_serveroptions+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+448+44
+CNSTU4 16452
+ASGNU4
+ADDRGP4 s_serveroptions+448+12
+CNSTI4 314
+ASGNI4
+ADDRGP4 s_serveroptions+448+16
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_serveroptions+448+76
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_serveroptions+448+80
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_serveroptions+448+60
+ADDRGP4 $337
+ASGNP4
+ADDRLP4 4
+CNSTI4 272
+ASGNI4
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 4
+EQI4 $954
+ADDRGP4 s_serveroptions+964
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+964+4
+ADDRGP4 $960
+ASGNP4
+ADDRGP4 s_serveroptions+964+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_serveroptions+964+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+964+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+964+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+964+60+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+964+60+268
+CNSTI4 3
+ASGNI4
+ADDRGP4 $955
+JUMPV
+LABELV $954
+ADDRGP4 s_serveroptions+1296
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+1296+4
+ADDRGP4 $978
+ASGNP4
+ADDRGP4 s_serveroptions+1296+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_serveroptions+1296+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+1296+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1296+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+1296+60+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+1296+60+268
+CNSTI4 3
+ASGNI4
+LABELV $955
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+632
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+632+4
+ADDRGP4 $996
+ASGNP4
+ADDRGP4 s_serveroptions+632+44
+CNSTU4 290
+ASGNU4
+ADDRGP4 s_serveroptions+632+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+632+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+632+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+632+60+8
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+632+60+268
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+LTI4 $1011
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+1628
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+1628+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+1628+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+1628+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1628+4
+ADDRGP4 $1023
+ASGNP4
+LABELV $1011
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+2024
+CNSTI4 5
+ASGNI4
+ADDRGP4 s_serveroptions+2024+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+2024+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+2024+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2024+4
+ADDRGP4 $1033
+ASGNP4
+ADDRGP4 s_serveroptions+5688
+INDIRI4
+CNSTI4 0
+EQI4 $1034
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+536
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+536+8
+CNSTI4 22
+ASGNI4
+ADDRGP4 s_serveroptions+536+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+536+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+536+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+536+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+536+4
+ADDRGP4 $1050
+ASGNP4
+ADDRGP4 s_serveroptions+536+76
+ADDRGP4 dedicated_list
+ASGNP4
+LABELV $1034
+ADDRGP4 s_serveroptions+5688
+INDIRI4
+CNSTI4 0
+EQI4 $1053
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+1692
+CNSTI4 4
+ASGNI4
+ADDRGP4 s_serveroptions+1692+4
+ADDRGP4 $1059
+ASGNP4
+ADDRGP4 s_serveroptions+1692+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_serveroptions+1692+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+1692+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+1692+60+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_serveroptions+1692+60+268
+CNSTI4 64
+ASGNI4
+LABELV $1053
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+5944
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+5944+4
+ADDRGP4 $1075
+ASGNP4
+ADDRGP4 s_serveroptions+5944+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+5944+8
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_serveroptions+5944+12
+CNSTI4 456
+ASGNI4
+ADDRGP4 s_serveroptions+5944+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+5944+76
+ADDRGP4 punkbuster_items
+ASGNP4
+ADDRLP4 4
+CNSTI4 80
+ASGNI4
+ADDRGP4 s_serveroptions+2088
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_serveroptions+2088+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_serveroptions+2088+4
+ADDRGP4 $1091
+ASGNP4
+ADDRGP4 s_serveroptions+2088+4
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 s_serveroptions+2088+12
+ADDRLP4 24
+INDIRI4
+CNSTI4 3
+LSHI4
+CNSTI4 16
+ADDI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+2088+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2088+76
+ADDRGP4 botSkill_list
+ASGNP4
+ADDRGP4 s_serveroptions+2088+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 s_serveroptions+2184
+CNSTI4 7
+ASGNI4
+ADDRGP4 s_serveroptions+2184+44
+CNSTU4 2
+ASGNU4
+ADDRGP4 s_serveroptions+2184+12
+CNSTI4 40
+ASGNI4
+ADDRGP4 s_serveroptions+2184+16
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_serveroptions+2184+68
+ADDRGP4 color_orange
+ASGNP4
+ADDRGP4 s_serveroptions+2184+64
+CNSTI4 16
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1113
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256
+ADDP4
+CNSTI4 3
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+8
+ADDP4
+CNSTI4 20
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+48
+ADDP4
+ADDRGP4 ServerOptions_Event
+ASGNP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+12
+ADDP4
+CNSTI4 32
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256+76
+ADDP4
+ADDRGP4 playerType_list
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408
+ADDP4
+CNSTI4 7
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+12
+ADDP4
+CNSTI4 96
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+48
+ADDP4
+ADDRGP4 ServerOptions_PlayerNameEvent
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+56
+ADDP4
+ADDRGP4 PlayerName_Draw
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+68
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+64
+ADDP4
+CNSTI4 16
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408+60
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 s_serveroptions+5728
+ADDP4
+ASGNP4
+ADDRLP4 36
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 s_serveroptions+3408+24
+ADDP4
+ADDRLP4 36
+INDIRI4
+ADDRGP4 s_serveroptions+3408+16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 40
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 s_serveroptions+3408+32
+ADDP4
+ADDRLP4 40
+INDIRI4
+ADDRGP4 s_serveroptions+3408+16
+ADDP4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+ADDRLP4 44
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 s_serveroptions+3408+20
+ADDP4
+ADDRLP4 44
+INDIRI4
+ADDRGP4 s_serveroptions+3408+12
+ADDP4
+INDIRI4
+CNSTI4 8
+SUBI4
+ASGNI4
+ADDRLP4 48
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 s_serveroptions+3408+28
+ADDP4
+ADDRLP4 48
+INDIRI4
+ADDRGP4 s_serveroptions+3408+12
+ADDP4
+INDIRI4
+CNSTI4 128
+ADDI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272
+ADDP4
+CNSTI4 3
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+12
+ADDP4
+CNSTI4 240
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+16
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272+76
+ADDP4
+ADDRGP4 playerTeam_list
+ASGNP4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 20
+ADDI4
+ASGNI4
+LABELV $1114
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $1113
+ADDRGP4 s_serveroptions+5600
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+5600+4
+ADDRGP4 $404
+ASGNP4
+ADDRGP4 s_serveroptions+5600+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_serveroptions+5600+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+5600+8
+CNSTI4 24
+ASGNI4
+ADDRGP4 s_serveroptions+5600+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_serveroptions+5600+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_serveroptions+5600+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_serveroptions+5600+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_serveroptions+5600+60
+ADDRGP4 $421
+ASGNP4
+ADDRGP4 s_serveroptions+5512
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+5512+4
+ADDRGP4 $425
+ASGNP4
+ADDRGP4 s_serveroptions+5512+44
+CNSTU4 28944
+ASGNU4
+ADDRGP4 s_serveroptions+5512+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+5512+8
+CNSTI4 18
+ASGNI4
+ADDRGP4 s_serveroptions+5512+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_serveroptions+5512+16
+CNSTI4 344
+ASGNI4
+ADDRGP4 s_serveroptions+5512+52
+ADDRGP4 ServerOptions_StatusBar
+ASGNP4
+ADDRGP4 s_serveroptions+5512+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_serveroptions+5512+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_serveroptions+5512+60
+ADDRGP4 $442
+ASGNP4
+ADDRGP4 s_serveroptions+5424
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_serveroptions+5424+4
+ADDRGP4 $1218
+ASGNP4
+ADDRGP4 s_serveroptions+5424+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_serveroptions+5424+48
+ADDRGP4 ServerOptions_Event
+ASGNP4
+ADDRGP4 s_serveroptions+5424+8
+CNSTI4 23
+ASGNI4
+ADDRGP4 s_serveroptions+5424+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_serveroptions+5424+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_serveroptions+5424+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_serveroptions+5424+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_serveroptions+5424+60
+ADDRGP4 $1235
+ASGNP4
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+2088
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+2184
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1241
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $1245
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+2256
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1245
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+3408
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+LTI4 $1249
+ADDRGP4 s_serveroptions
+ARGP4
+CNSTI4 96
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_serveroptions+4272
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1249
+LABELV $1242
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 12
+LTI4 $1241
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 4
+EQI4 $1253
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+964
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 $1254
+JUMPV
+LABELV $1253
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+1296
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1254
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+632
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions+5692
+INDIRI4
+CNSTI4 3
+LTI4 $1259
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+1628
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1259
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+2024
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions+5688
+INDIRI4
+CNSTI4 0
+EQI4 $1264
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1264
+ADDRGP4 s_serveroptions+5688
+INDIRI4
+CNSTI4 0
+EQI4 $1268
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+1692
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1268
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5600
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5512
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5424
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 s_serveroptions+5944
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 ServerOptions_SetMenuItems
+CALLV
+pop
+LABELV $908
+endproc ServerOptions_MenuInit 52 12
+export ServerOptions_Cache
+proc ServerOptions_Cache 0 4
+ADDRGP4 $404
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $421
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1218
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1235
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $337
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $309
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1276
+endproc ServerOptions_Cache 0 4
+proc UI_ServerOptionsMenu 0 4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRGP4 ServerOptions_MenuInit
+CALLV
+pop
+ADDRGP4 s_serveroptions
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1277
+endproc UI_ServerOptionsMenu 0 4
+proc UI_BotSelectMenu_SortCompare 44 8
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+ADDRFP4 4
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 24
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+ASGNP4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 28
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 28
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $647
+ARGP4
+ADDRLP4 32
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+ADDRLP4 32
+INDIRP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRGP4 $647
+ARGP4
+ADDRLP4 36
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 20
+ADDRLP4 36
+INDIRP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+ADDRLP4 40
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 40
+INDIRI4
+RETI4
+LABELV $1279
+endproc UI_BotSelectMenu_SortCompare 44 8
+proc UI_BotSelectMenu_BuildList 12 16
+ADDRGP4 botSelectInfo+4772
+CNSTI4 0
+ASGNI4
+ADDRLP4 4
+ADDRGP4 UI_GetNumBots
+CALLI4
+ASGNI4
+ADDRGP4 botSelectInfo+4768
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 botSelectInfo+4776
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+CNSTI4 16
+MODI4
+CNSTI4 0
+EQI4 $1285
+ADDRLP4 8
+ADDRGP4 botSelectInfo+4776
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1285
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1292
+JUMPV
+LABELV $1289
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+4784
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+LABELV $1290
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1292
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+LTI4 $1289
+ADDRGP4 botSelectInfo+4784
+ARGP4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+ARGI4
+CNSTI4 4
+ARGI4
+ADDRGP4 UI_BotSelectMenu_SortCompare
+ARGP4
+ADDRGP4 qsort
+CALLV
+pop
+LABELV $1280
+endproc UI_BotSelectMenu_BuildList 12 16
+proc ServerPlayerIcon 80 20
+ADDRLP4 4
+ARGP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 4
+ARGP4
+CNSTI4 47
+ARGI4
+ADDRLP4 68
+ADDRGP4 Q_strrchr
+CALLP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 68
+INDIRP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $1299
+ADDRLP4 72
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 72
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 72
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 $1300
+JUMPV
+LABELV $1299
+ADDRLP4 0
+ADDRGP4 $1301
+ASGNP4
+LABELV $1300
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $1302
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRLP4 72
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+ASGNI4
+ADDRLP4 72
+INDIRI4
+CNSTI4 0
+NEI4 $1303
+ADDRLP4 0
+INDIRP4
+ARGP4
+ADDRGP4 $1301
+ARGP4
+ADDRLP4 76
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 76
+INDIRI4
+CNSTI4 0
+EQI4 $1303
+ADDRFP4 4
+INDIRP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+ADDRGP4 $1305
+ARGP4
+ADDRLP4 4
+ARGP4
+ADDRGP4 Com_sprintf
+CALLV
+pop
+LABELV $1303
+LABELV $1298
+endproc ServerPlayerIcon 80 20
+proc UI_BotSelectMenu_UpdateGrid 36 12
+ADDRLP4 4
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1308
+ADDRLP4 4
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+GEI4 $1312
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+4784
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 12
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $1316
+ARGP4
+ADDRLP4 16
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+8880
+ADDP4
+ARGP4
+CNSTI4 64
+ARGI4
+ADDRGP4 ServerPlayerIcon
+CALLV
+pop
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $647
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+ARGP4
+ADDRLP4 20
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+ARGP4
+ADDRGP4 Q_CleanStr
+CALLP4
+pop
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+8880
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+ARGP4
+ADDRLP4 28
+ADDRGP4 BotAlreadySelected
+CALLI4
+ASGNI4
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $1323
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+68
+ADDP4
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 $1324
+JUMPV
+LABELV $1323
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+68
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+LABELV $1324
+ADDRLP4 32
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 32
+INDIRP4
+ADDRLP4 32
+INDIRP4
+INDIRU4
+CNSTI4 -16385
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRGP4 $1313
+JUMPV
+LABELV $1312
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+4
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $1313
+ADDRLP4 12
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+44
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTI4 -65
+CVIU4 4
+BANDU4
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+68
+ADDP4
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+LABELV $1309
+ADDRLP4 12
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 12
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1308
+ADDRLP4 0
+ADDRGP4 botSelectInfo+4780
+INDIRI4
+CNSTI4 16
+MODI4
+ASGNI4
+ADDRLP4 16
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+44
+ADDP4
+ASGNP4
+ADDRLP4 16
+INDIRP4
+ADDRLP4 16
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 20
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 20
+INDIRP4
+ADDRLP4 20
+INDIRP4
+INDIRU4
+CNSTI4 -257
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRGP4 botSelectInfo+4776
+INDIRI4
+CNSTI4 1
+LEI4 $1348
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 0
+LEI4 $1351
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4416+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTI4 -16385
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRGP4 $1352
+JUMPV
+LABELV $1351
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4416+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $1352
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+ADDRGP4 botSelectInfo+4776
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $1358
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4504+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTI4 -16385
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRGP4 $1349
+JUMPV
+LABELV $1358
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4504+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRGP4 $1349
+JUMPV
+LABELV $1348
+ADDRLP4 24
+ADDRGP4 botSelectInfo+4416+44
+ASGNP4
+ADDRLP4 24
+INDIRP4
+ADDRLP4 24
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+ADDRLP4 28
+ADDRGP4 botSelectInfo+4504+44
+ASGNP4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 28
+INDIRP4
+INDIRU4
+CNSTU4 16384
+BORU4
+ASGNU4
+LABELV $1349
+LABELV $1306
+endproc UI_BotSelectMenu_UpdateGrid 36 12
+proc UI_BotSelectMenu_Default 28 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1374
+JUMPV
+LABELV $1371
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 16
+ADDRGP4 UI_GetBotInfoByNumber
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 16
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+ADDRGP4 $647
+ARGP4
+ADDRLP4 20
+ADDRGP4 Info_ValueForKey
+CALLP4
+ASGNP4
+ADDRLP4 12
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRLP4 12
+INDIRP4
+ARGP4
+ADDRLP4 24
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 0
+NEI4 $1376
+ADDRGP4 $1373
+JUMPV
+LABELV $1376
+LABELV $1372
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1374
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+LTI4 $1371
+LABELV $1373
+ADDRLP4 0
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+NEI4 $1378
+ADDRGP4 botSelectInfo+4780
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1370
+JUMPV
+LABELV $1378
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1385
+JUMPV
+LABELV $1382
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 botSelectInfo+4784
+ADDP4
+INDIRI4
+ADDRLP4 0
+INDIRI4
+NEI4 $1387
+ADDRGP4 $1384
+JUMPV
+LABELV $1387
+LABELV $1383
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1385
+ADDRLP4 4
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+LTI4 $1382
+LABELV $1384
+ADDRLP4 4
+INDIRI4
+ADDRGP4 botSelectInfo+4768
+INDIRI4
+NEI4 $1390
+ADDRGP4 botSelectInfo+4780
+CNSTI4 0
+ASGNI4
+ADDRGP4 $1370
+JUMPV
+LABELV $1390
+ADDRGP4 botSelectInfo+4780
+ADDRLP4 4
+INDIRI4
+ASGNI4
+LABELV $1370
+endproc UI_BotSelectMenu_Default 28 8
+proc UI_BotSelectMenu_LeftEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1396
+ADDRGP4 $1395
+JUMPV
+LABELV $1396
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 0
+LEI4 $1398
+ADDRLP4 0
+ADDRGP4 botSelectInfo+4772
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+SUBI4
+ASGNI4
+ADDRGP4 botSelectInfo+4780
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $1398
+LABELV $1395
+endproc UI_BotSelectMenu_LeftEvent 4 0
+proc UI_BotSelectMenu_RightEvent 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1405
+ADDRGP4 $1404
+JUMPV
+LABELV $1405
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+ADDRGP4 botSelectInfo+4776
+INDIRI4
+CNSTI4 1
+SUBI4
+GEI4 $1407
+ADDRLP4 0
+ADDRGP4 botSelectInfo+4772
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 botSelectInfo+4780
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 4
+LSHI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $1407
+LABELV $1404
+endproc UI_BotSelectMenu_RightEvent 4 0
+proc UI_BotSelectMenu_BotEvent 12 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1415
+ADDRGP4 $1414
+JUMPV
+LABELV $1415
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $1417
+ADDRLP4 4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTI4 -65
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTU4 256
+BORU4
+ASGNU4
+LABELV $1418
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 16
+LTI4 $1417
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+44
+ADDP4
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTU4 64
+BORU4
+ASGNU4
+ADDRLP4 8
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ADDRLP4 8
+INDIRP4
+INDIRU4
+CNSTI4 -257
+CVIU4 4
+BANDU4
+ASGNU4
+ADDRGP4 botSelectInfo+4780
+ADDRGP4 botSelectInfo+4772
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $1414
+endproc UI_BotSelectMenu_BotEvent 12 0
+proc UI_BotSelectMenu_BackEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1432
+ADDRGP4 $1431
+JUMPV
+LABELV $1432
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $1431
+endproc UI_BotSelectMenu_BackEvent 0 0
+proc UI_BotSelectMenu_SelectEvent 4 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $1435
+ADDRGP4 $1434
+JUMPV
+LABELV $1435
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 s_serveroptions+5920
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_serveroptions+5928
+ARGP4
+ADDRLP4 0
+CNSTI4 16
+ASGNI4
+ADDRGP4 botSelectInfo+4780
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MODI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+LABELV $1434
+endproc UI_BotSelectMenu_SelectEvent 4 12
+export UI_BotSelectMenu_Cache
+proc UI_BotSelectMenu_Cache 0 4
+ADDRGP4 $404
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $421
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1442
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1443
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1444
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1445
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $341
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $369
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $387
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1441
+endproc UI_BotSelectMenu_Cache 0 4
+proc UI_BotSelectMenu_Init 36 12
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 10160
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 botSelectInfo+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 botSelectInfo+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_Cache
+CALLV
+pop
+ADDRGP4 botSelectInfo+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 botSelectInfo+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 botSelectInfo+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 botSelectInfo+288+60
+ADDRGP4 $1456
+ASGNP4
+ADDRGP4 botSelectInfo+288+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 botSelectInfo+288+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 8
+CNSTI4 80
+ASGNI4
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+ADDRLP4 16
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $1464
+JUMPV
+LABELV $1461
+ADDRLP4 4
+CNSTI4 180
+ASGNI4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+LABELV $1465
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+44
+ADDP4
+CNSTU4 16388
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+4
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 6
+LSHI4
+ADDRGP4 botSelectInfo+8880
+ADDP4
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+76
+ADDP4
+CNSTI4 64
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+80
+ADDP4
+CNSTI4 64
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+60
+ADDP4
+ADDRGP4 $1445
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360+84
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768
+ADDP4
+CNSTI4 6
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+44
+ADDP4
+CNSTU4 33028
+ASGNU4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+48
+ADDP4
+ADDRGP4 UI_BotSelectMenu_BotEvent
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+8
+ADDP4
+ADDRLP4 0
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 16
+SUBI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+20
+ADDP4
+ADDRLP4 4
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+24
+ADDP4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+28
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+32
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+76
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+80
+ADDP4
+CNSTI4 128
+ASGNI4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+60
+ADDP4
+ADDRGP4 $1444
+ASGNP4
+CNSTI4 88
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768+84
+ADDP4
+ADDRGP4 colorRed
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176
+ADDP4
+CNSTI4 7
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+44
+ADDP4
+CNSTU4 2
+ASGNU4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+12
+ADDP4
+ADDRLP4 4
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+16
+ADDP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 64
+ADDI4
+ASGNI4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+60
+ADDP4
+ADDRLP4 0
+INDIRI4
+CNSTI4 4
+LSHI4
+ADDRGP4 botSelectInfo+9904
+ADDP4
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+68
+ADDP4
+ADDRGP4 color_orange
+ASGNP4
+CNSTI4 72
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176+64
+ADDP4
+CNSTI4 17
+ASGNI4
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 70
+ADDI4
+ASGNI4
+LABELV $1466
+ADDRLP4 24
+CNSTI4 1
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+ADDRLP4 24
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 12
+INDIRI4
+CNSTI4 4
+LTI4 $1465
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 86
+ADDI4
+ASGNI4
+LABELV $1462
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $1464
+ADDRLP4 16
+INDIRI4
+CNSTI4 4
+LTI4 $1461
+ADDRGP4 botSelectInfo+4328
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4328+4
+ADDRGP4 $341
+ASGNP4
+ADDRGP4 botSelectInfo+4328+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 botSelectInfo+4328+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 botSelectInfo+4328+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+4328+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 botSelectInfo+4328+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 botSelectInfo+4416
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4416+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 botSelectInfo+4416+48
+ADDRGP4 UI_BotSelectMenu_LeftEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4416+12
+CNSTI4 260
+ASGNI4
+ADDRGP4 botSelectInfo+4416+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+4416+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+4416+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 botSelectInfo+4416+60
+ADDRGP4 $369
+ASGNP4
+ADDRGP4 botSelectInfo+4504
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4504+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 botSelectInfo+4504+48
+ADDRGP4 UI_BotSelectMenu_RightEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4504+12
+CNSTI4 321
+ASGNI4
+ADDRGP4 botSelectInfo+4504+16
+CNSTI4 440
+ASGNI4
+ADDRGP4 botSelectInfo+4504+76
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+4504+80
+CNSTI4 32
+ASGNI4
+ADDRGP4 botSelectInfo+4504+60
+ADDRGP4 $387
+ASGNP4
+ADDRGP4 botSelectInfo+4680
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4680+4
+ADDRGP4 $404
+ASGNP4
+ADDRGP4 botSelectInfo+4680+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 botSelectInfo+4680+48
+ADDRGP4 UI_BotSelectMenu_BackEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4680+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 botSelectInfo+4680+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 botSelectInfo+4680+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 botSelectInfo+4680+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+4680+60
+ADDRGP4 $421
+ASGNP4
+ADDRGP4 botSelectInfo+4592
+CNSTI4 6
+ASGNI4
+ADDRGP4 botSelectInfo+4592+4
+ADDRGP4 $1442
+ASGNP4
+ADDRGP4 botSelectInfo+4592+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 botSelectInfo+4592+48
+ADDRGP4 UI_BotSelectMenu_SelectEvent
+ASGNP4
+ADDRGP4 botSelectInfo+4592+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 botSelectInfo+4592+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 botSelectInfo+4592+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 botSelectInfo+4592+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 botSelectInfo+4592+60
+ADDRGP4 $1443
+ASGNP4
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRLP4 16
+CNSTI4 0
+ASGNI4
+LABELV $1606
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 88
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+360
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 88
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+1768
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+CNSTI4 72
+ADDRLP4 16
+INDIRI4
+MULI4
+ADDRGP4 botSelectInfo+3176
+ADDP4
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+LABELV $1607
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 16
+LTI4 $1606
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4328
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4416
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4504
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 botSelectInfo+4592
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 UI_BotSelectMenu_BuildList
+CALLV
+pop
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_BotSelectMenu_Default
+CALLV
+pop
+ADDRGP4 botSelectInfo+4772
+ADDRGP4 botSelectInfo+4780
+INDIRI4
+CNSTI4 16
+DIVI4
+ASGNI4
+ADDRGP4 UI_BotSelectMenu_UpdateGrid
+CALLV
+pop
+LABELV $1446
+endproc UI_BotSelectMenu_Init 36 12
+export UI_BotSelectMenu
+proc UI_BotSelectMenu 0 4
+ADDRFP4 0
+INDIRP4
+ARGP4
+ADDRGP4 UI_BotSelectMenu_Init
+CALLV
+pop
+ADDRGP4 botSelectInfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $1620
+endproc UI_BotSelectMenu 0 4
+bss
+align 4
+LABELV botSelectInfo
+skip 10160
+align 4
+LABELV s_serveroptions
+skip 6040
+import punkbuster_items
+align 4
+LABELV s_startserver
+skip 3236
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import DriverInfo_Cache
+import GraphicsOptions_Cache
+import UI_GraphicsOptionsMenu
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1456
+byte 1 83
+byte 1 69
+byte 1 76
+byte 1 69
+byte 1 67
+byte 1 84
+byte 1 32
+byte 1 66
+byte 1 79
+byte 1 84
+byte 1 0
+align 1
+LABELV $1445
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $1444
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 111
+byte 1 112
+byte 1 112
+byte 1 111
+byte 1 110
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $1443
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1442
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1316
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 0
+align 1
+LABELV $1305
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1302
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 47
+byte 1 112
+byte 1 108
+byte 1 97
+byte 1 121
+byte 1 101
+byte 1 114
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 47
+byte 1 105
+byte 1 99
+byte 1 111
+byte 1 110
+byte 1 95
+byte 1 37
+byte 1 115
+byte 1 46
+byte 1 116
+byte 1 103
+byte 1 97
+byte 1 0
+align 1
+LABELV $1301
+byte 1 100
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $1235
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1218
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $1091
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 83
+byte 1 107
+byte 1 105
+byte 1 108
+byte 1 108
+byte 1 58
+byte 1 32
+byte 1 32
+byte 1 0
+align 1
+LABELV $1075
+byte 1 80
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $1059
+byte 1 72
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $1050
+byte 1 68
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 58
+byte 1 0
+align 1
+LABELV $1033
+byte 1 80
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 114
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $1023
+byte 1 70
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $996
+byte 1 84
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $978
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $960
+byte 1 70
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 32
+byte 1 76
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 58
+byte 1 0
+align 1
+LABELV $878
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $872
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $867
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 0
+align 1
+LABELV $847
+byte 1 37
+byte 1 105
+byte 1 0
+align 1
+LABELV $821
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 0
+align 1
+LABELV $797
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $777
+byte 1 115
+byte 1 97
+byte 1 114
+byte 1 103
+byte 1 101
+byte 1 0
+align 1
+LABELV $765
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $759
+byte 1 109
+byte 1 97
+byte 1 106
+byte 1 111
+byte 1 114
+byte 1 0
+align 1
+LABELV $756
+byte 1 103
+byte 1 114
+byte 1 117
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $739
+byte 1 48
+byte 1 32
+byte 1 61
+byte 1 32
+byte 1 78
+byte 1 79
+byte 1 32
+byte 1 76
+byte 1 73
+byte 1 77
+byte 1 73
+byte 1 84
+byte 1 0
+align 1
+LABELV $679
+byte 1 72
+byte 1 117
+byte 1 109
+byte 1 97
+byte 1 110
+byte 1 0
+align 1
+LABELV $647
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $616
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 53
+byte 1 59
+byte 1 32
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $611
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 10
+byte 1 0
+align 1
+LABELV $607
+byte 1 97
+byte 1 100
+byte 1 100
+byte 1 98
+byte 1 111
+byte 1 116
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 32
+byte 1 37
+byte 1 105
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $589
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 51
+byte 1 10
+byte 1 0
+align 1
+LABELV $586
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 119
+byte 1 97
+byte 1 105
+byte 1 116
+byte 1 32
+byte 1 59
+byte 1 32
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 32
+byte 1 37
+byte 1 115
+byte 1 10
+byte 1 0
+align 1
+LABELV $583
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 98
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 0
+align 1
+LABELV $579
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 104
+byte 1 111
+byte 1 115
+byte 1 116
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 0
+align 1
+LABELV $578
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 112
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $577
+byte 1 103
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 121
+byte 1 102
+byte 1 105
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $576
+byte 1 99
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $575
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $574
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $573
+byte 1 100
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 99
+byte 1 97
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $572
+byte 1 115
+byte 1 118
+byte 1 95
+byte 1 109
+byte 1 97
+byte 1 120
+byte 1 99
+byte 1 108
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $570
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $569
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $568
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $566
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 105
+byte 1 101
+byte 1 110
+byte 1 100
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $565
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $564
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $562
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $561
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $559
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 116
+byte 1 105
+byte 1 109
+byte 1 101
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $558
+byte 1 117
+byte 1 105
+byte 1 95
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 95
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 103
+byte 1 108
+byte 1 105
+byte 1 109
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $502
+byte 1 78
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 114
+byte 1 101
+byte 1 33
+byte 1 0
+align 1
+LABELV $501
+byte 1 72
+byte 1 97
+byte 1 114
+byte 1 100
+byte 1 99
+byte 1 111
+byte 1 114
+byte 1 101
+byte 1 0
+align 1
+LABELV $500
+byte 1 72
+byte 1 117
+byte 1 114
+byte 1 116
+byte 1 32
+byte 1 77
+byte 1 101
+byte 1 32
+byte 1 80
+byte 1 108
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $499
+byte 1 66
+byte 1 114
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 32
+byte 1 73
+byte 1 116
+byte 1 32
+byte 1 79
+byte 1 110
+byte 1 0
+align 1
+LABELV $498
+byte 1 73
+byte 1 32
+byte 1 67
+byte 1 97
+byte 1 110
+byte 1 32
+byte 1 87
+byte 1 105
+byte 1 110
+byte 1 0
+align 1
+LABELV $497
+byte 1 82
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $496
+byte 1 66
+byte 1 108
+byte 1 117
+byte 1 101
+byte 1 0
+align 1
+LABELV $495
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 45
+byte 1 0
+align 1
+LABELV $494
+byte 1 66
+byte 1 111
+byte 1 116
+byte 1 0
+align 1
+LABELV $493
+byte 1 79
+byte 1 112
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $492
+byte 1 73
+byte 1 110
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 116
+byte 1 0
+align 1
+LABELV $491
+byte 1 76
+byte 1 65
+byte 1 78
+byte 1 0
+align 1
+LABELV $490
+byte 1 78
+byte 1 111
+byte 1 0
+align 1
+LABELV $472
+byte 1 99
+byte 1 111
+byte 1 109
+byte 1 95
+byte 1 98
+byte 1 117
+byte 1 105
+byte 1 108
+byte 1 100
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 105
+byte 1 112
+byte 1 116
+byte 1 0
+align 1
+LABELV $442
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $425
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 110
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $421
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $404
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $387
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $369
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $341
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 103
+byte 1 115
+byte 1 95
+byte 1 97
+byte 1 114
+byte 1 114
+byte 1 111
+byte 1 119
+byte 1 115
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $337
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 0
+align 1
+LABELV $309
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 117
+byte 1 110
+byte 1 107
+byte 1 110
+byte 1 111
+byte 1 119
+byte 1 110
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $306
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 115
+byte 1 95
+byte 1 115
+byte 1 101
+byte 1 108
+byte 1 101
+byte 1 99
+byte 1 116
+byte 1 101
+byte 1 100
+byte 1 0
+align 1
+LABELV $274
+byte 1 71
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 32
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $260
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $246
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
+align 1
+LABELV $238
+byte 1 71
+byte 1 65
+byte 1 77
+byte 1 69
+byte 1 32
+byte 1 83
+byte 1 69
+byte 1 82
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 0
+align 1
+LABELV $205
+byte 1 103
+byte 1 95
+byte 1 103
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 84
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $177
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $172
+byte 1 116
+byte 1 121
+byte 1 112
+byte 1 101
+byte 1 0
+align 1
+LABELV $137
+byte 1 78
+byte 1 79
+byte 1 32
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 83
+byte 1 32
+byte 1 70
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $104
+byte 1 108
+byte 1 101
+byte 1 118
+byte 1 101
+byte 1 108
+byte 1 115
+byte 1 104
+byte 1 111
+byte 1 116
+byte 1 115
+byte 1 47
+byte 1 37
+byte 1 115
+byte 1 0
+align 1
+LABELV $93
+byte 1 99
+byte 1 116
+byte 1 102
+byte 1 0
+align 1
+LABELV $90
+byte 1 116
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 0
+align 1
+LABELV $87
+byte 1 115
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 108
+byte 1 101
+byte 1 0
+align 1
+LABELV $84
+byte 1 116
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 101
+byte 1 121
+byte 1 0
+align 1
+LABELV $81
+byte 1 102
+byte 1 102
+byte 1 97
+byte 1 0
+align 1
+LABELV $72
+byte 1 67
+byte 1 97
+byte 1 112
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 116
+byte 1 104
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 108
+byte 1 97
+byte 1 103
+byte 1 0
+align 1
+LABELV $71
+byte 1 84
+byte 1 111
+byte 1 117
+byte 1 114
+byte 1 110
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 116
+byte 1 0
+align 1
+LABELV $70
+byte 1 84
+byte 1 101
+byte 1 97
+byte 1 109
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 97
+byte 1 116
+byte 1 104
+byte 1 109
+byte 1 97
+byte 1 116
+byte 1 99
+byte 1 104
+byte 1 0
+align 1
+LABELV $69
+byte 1 70
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 65
+byte 1 108
+byte 1 108
+byte 1 0
@@ -0,0 +1,4888 @@
+data
+align 4
+LABELV driverinfo_artlist
+address $68
+address $69
+address $70
+address $71
+byte 4 0
+code
+proc DriverInfo_Event 4 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $74
+ADDRGP4 $73
+JUMPV
+LABELV $74
+ADDRLP4 0
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 100
+EQI4 $79
+ADDRGP4 $76
+JUMPV
+LABELV $79
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+LABELV $76
+LABELV $77
+LABELV $73
+endproc DriverInfo_Event 4 0
+proc DriverInfo_MenuDraw 12 20
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 80
+ARGI4
+ADDRGP4 $81
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 152
+ARGI4
+ADDRGP4 $82
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 192
+ARGI4
+ADDRGP4 $83
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 color_red
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 96
+ARGI4
+ADDRGP4 uis+56+1024
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 112
+ARGI4
+ADDRGP4 uis+56+2048
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 320
+ARGI4
+CNSTI4 128
+ARGI4
+ADDRGP4 uis+56
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRGP4 $89
+ARGP4
+ADDRGP4 uis+56+11272
+INDIRI4
+ARGI4
+ADDRGP4 uis+56+11276
+INDIRI4
+ARGI4
+ADDRGP4 uis+56+11280
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 va
+CALLP4
+ASGNP4
+CNSTI4 320
+ARGI4
+CNSTI4 168
+ARGI4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+CNSTI4 208
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $99
+JUMPV
+LABELV $96
+CNSTI4 316
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 18
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+CNSTI4 324
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+LSHI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648+4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+ADDI4
+ASGNI4
+LABELV $97
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $99
+ADDRLP4 0
+INDIRI4
+ADDRGP4 s_driverinfo+1904
+INDIRI4
+CNSTI4 2
+DIVI4
+LTI4 $96
+ADDRGP4 s_driverinfo+1904
+INDIRI4
+CNSTI4 1
+BANDI4
+CNSTI4 0
+EQI4 $104
+CNSTI4 320
+ARGI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRGP4 s_driverinfo+1904
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648-4
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 17
+ARGI4
+ADDRGP4 text_color_normal
+ARGP4
+ADDRGP4 UI_DrawString
+CALLV
+pop
+LABELV $104
+LABELV $80
+endproc DriverInfo_MenuDraw 12 20
+export DriverInfo_Cache
+proc DriverInfo_Cache 4 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+LABELV $111
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 driverinfo_artlist
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $115
+ADDRGP4 $113
+JUMPV
+LABELV $115
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 driverinfo_artlist
+ADDP4
+INDIRP4
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $112
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRGP4 $111
+JUMPV
+LABELV $113
+LABELV $110
+endproc DriverInfo_Cache 4 4
+proc UI_DriverInfo_Menu 36 12
+ADDRGP4 s_driverinfo
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 1908
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 DriverInfo_Cache
+CALLV
+pop
+ADDRGP4 s_driverinfo+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_driverinfo+268
+ADDRGP4 DriverInfo_MenuDraw
+ASGNP4
+ADDRGP4 s_driverinfo+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_driverinfo+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_driverinfo+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_driverinfo+288+60
+ADDRGP4 $127
+ASGNP4
+ADDRGP4 s_driverinfo+288+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_driverinfo+288+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_driverinfo+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_driverinfo+448+4
+ADDRGP4 $68
+ASGNP4
+ADDRGP4 s_driverinfo+448+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_driverinfo+448+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_driverinfo+448+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_driverinfo+448+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_driverinfo+448+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_driverinfo+536
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_driverinfo+536+4
+ADDRGP4 $69
+ASGNP4
+ADDRGP4 s_driverinfo+536+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_driverinfo+536+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_driverinfo+536+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_driverinfo+536+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_driverinfo+536+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_driverinfo+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_driverinfo+360+4
+ADDRGP4 $70
+ASGNP4
+ADDRGP4 s_driverinfo+360+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_driverinfo+360+48
+ADDRGP4 DriverInfo_Event
+ASGNP4
+ADDRGP4 s_driverinfo+360+8
+CNSTI4 100
+ASGNI4
+ADDRGP4 s_driverinfo+360+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_driverinfo+360+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_driverinfo+360+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_driverinfo+360+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_driverinfo+360+60
+ADDRGP4 $71
+ASGNP4
+ADDRGP4 s_driverinfo+624
+ARGP4
+ADDRGP4 uis+56+3072
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 0
+ADDRGP4 s_driverinfo+624
+ASGNP4
+ADDRGP4 $182
+JUMPV
+LABELV $185
+ADDRLP4 12
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRLP4 0
+ADDRLP4 12
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 12
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $186
+ADDRLP4 16
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 16
+INDIRI4
+CNSTI4 0
+EQI4 $188
+ADDRLP4 16
+INDIRI4
+CNSTI4 32
+EQI4 $185
+LABELV $188
+ADDRLP4 20
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 20
+INDIRI4
+CNSTI4 0
+EQI4 $194
+ADDRLP4 20
+INDIRI4
+CNSTI4 32
+EQI4 $194
+ADDRLP4 28
+ADDRGP4 s_driverinfo+1904
+ASGNP4
+ADDRLP4 24
+ADDRLP4 28
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 28
+INDIRP4
+ADDRLP4 24
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+ADDRLP4 24
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648
+ADDP4
+ADDRLP4 0
+INDIRP4
+ASGNP4
+ADDRGP4 $194
+JUMPV
+LABELV $193
+ADDRLP4 0
+ADDRLP4 0
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+LABELV $194
+ADDRLP4 32
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRLP4 32
+INDIRI4
+CNSTI4 0
+EQI4 $196
+ADDRLP4 32
+INDIRI4
+CNSTI4 32
+NEI4 $193
+LABELV $196
+LABELV $182
+ADDRGP4 s_driverinfo+1904
+INDIRI4
+CNSTI4 40
+GEI4 $197
+ADDRLP4 0
+INDIRP4
+INDIRI1
+CVII4 1
+CNSTI4 0
+NEI4 $186
+LABELV $197
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $201
+JUMPV
+LABELV $198
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 12
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 32
+LEI4 $204
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+SUBI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648
+ADDP4
+INDIRP4
+ADDP4
+CNSTI1 62
+ASGNI1
+ADDRLP4 8
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 s_driverinfo+1648
+ADDP4
+INDIRP4
+ADDP4
+CNSTI1 0
+ASGNI1
+LABELV $204
+LABELV $199
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $201
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_driverinfo+1904
+INDIRI4
+LTI4 $198
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 s_driverinfo+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_driverinfo
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+LABELV $117
+endproc UI_DriverInfo_Menu 36 12
+data
+align 4
+LABELV s_ivo_templates
+byte 4 6
+byte 4 1
+byte 4 3
+byte 4 0
+byte 4 2
+byte 4 2
+byte 4 2
+byte 4 1
+byte 4 0
+byte 4 1
+byte 4 4
+byte 4 1
+byte 4 2
+byte 4 0
+byte 4 2
+byte 4 2
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 1
+byte 4 3
+byte 4 1
+byte 4 2
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 2
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 2
+byte 4 1
+byte 4 1
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 3
+byte 4 1
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 0
+byte 4 1
+byte 4 0
+byte 4 0
+byte 4 1
+align 4
+LABELV builtinResolutions
+address $214
+address $215
+address $216
+address $217
+address $218
+address $219
+address $220
+address $221
+address $222
+address $223
+address $224
+address $225
+byte 4 0
+align 4
+LABELV resolutions
+address builtinResolutions
+align 4
+LABELV resolutionsDetected
+byte 4 0
+code
+proc GraphicsOptions_FindBuiltinResolution 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+NEI4 $227
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $226
+JUMPV
+LABELV $227
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $229
+CNSTI4 -1
+RETI4
+ADDRGP4 $226
+JUMPV
+LABELV $229
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $234
+JUMPV
+LABELV $231
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $235
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $226
+JUMPV
+LABELV $235
+LABELV $232
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $234
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $231
+CNSTI4 -1
+RETI4
+LABELV $226
+endproc GraphicsOptions_FindBuiltinResolution 12 8
+proc GraphicsOptions_FindDetectedResolution 12 8
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+NEI4 $238
+ADDRFP4 0
+INDIRI4
+RETI4
+ADDRGP4 $237
+JUMPV
+LABELV $238
+ADDRFP4 0
+INDIRI4
+CNSTI4 0
+GEI4 $240
+CNSTI4 -1
+RETI4
+ADDRGP4 $237
+JUMPV
+LABELV $240
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $245
+JUMPV
+LABELV $242
+ADDRLP4 4
+CNSTI4 2
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 builtinResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 0
+INDIRI4
+ADDRLP4 4
+INDIRI4
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 8
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 8
+INDIRI4
+CNSTI4 0
+NEI4 $246
+ADDRLP4 0
+INDIRI4
+RETI4
+ADDRGP4 $237
+JUMPV
+LABELV $246
+LABELV $243
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $245
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $242
+CNSTI4 -1
+RETI4
+LABELV $237
+endproc GraphicsOptions_FindDetectedResolution 12 8
+proc GraphicsOptions_GetInitialVideo 0 0
+ADDRGP4 s_ivo+16
+ADDRGP4 s_graphicsoptions+1572+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+32
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo
+ADDRGP4 s_graphicsoptions+920+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+4
+ADDRGP4 s_graphicsoptions+1188+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+36
+ADDRGP4 s_graphicsoptions+1380+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+8
+ADDRGP4 s_graphicsoptions+1112+68
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 s_ivo+12
+ADDRGP4 s_graphicsoptions+1284+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+24
+ADDRGP4 s_graphicsoptions+1668+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+28
+ADDRGP4 s_graphicsoptions+1764+64
+INDIRI4
+ASGNI4
+ADDRGP4 s_ivo+20
+ADDRGP4 s_graphicsoptions+1476+64
+INDIRI4
+ASGNI4
+LABELV $248
+endproc GraphicsOptions_GetInitialVideo 0 0
+proc GraphicsOptions_CheckConfig 8 4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $282
+JUMPV
+LABELV $279
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+16
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1572+64
+INDIRI4
+EQI4 $283
+ADDRGP4 $280
+JUMPV
+LABELV $283
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+32
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+EQI4 $288
+ADDRGP4 $280
+JUMPV
+LABELV $288
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates
+ADDP4
+INDIRI4
+ARGI4
+ADDRLP4 4
+ADDRGP4 GraphicsOptions_FindDetectedResolution
+CALLI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRGP4 s_graphicsoptions+920+64
+INDIRI4
+EQI4 $293
+ADDRGP4 $280
+JUMPV
+LABELV $293
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+4
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1188+64
+INDIRI4
+EQI4 $297
+ADDRGP4 $280
+JUMPV
+LABELV $297
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+8
+ADDP4
+INDIRI4
+CVIF4 4
+ADDRGP4 s_graphicsoptions+1112+68
+INDIRF4
+EQF4 $302
+ADDRGP4 $280
+JUMPV
+LABELV $302
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+12
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1284+64
+INDIRI4
+EQI4 $307
+ADDRGP4 $280
+JUMPV
+LABELV $307
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+24
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1668+64
+INDIRI4
+EQI4 $312
+ADDRGP4 $280
+JUMPV
+LABELV $312
+CNSTI4 40
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates+28
+ADDP4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1764+64
+INDIRI4
+EQI4 $317
+ADDRGP4 $280
+JUMPV
+LABELV $317
+ADDRGP4 s_graphicsoptions+824+64
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 $278
+JUMPV
+LABELV $280
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $282
+ADDRLP4 0
+INDIRI4
+CVIU4 4
+CNSTU4 5
+LTU4 $279
+ADDRGP4 s_graphicsoptions+824+64
+CNSTI4 5
+ASGNI4
+LABELV $278
+endproc GraphicsOptions_CheckConfig 8 4
+proc GraphicsOptions_UpdateMenuItems 8 0
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 1
+NEI4 $327
+ADDRGP4 s_graphicsoptions+1188+64
+CNSTI4 1
+ASGNI4
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1188+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 s_graphicsoptions+1572+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $328
+JUMPV
+LABELV $327
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1188+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $328
+ADDRGP4 s_graphicsoptions+1188+64
+INDIRI4
+CNSTI4 0
+EQI4 $345
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 1
+NEI4 $339
+LABELV $345
+ADDRGP4 s_graphicsoptions+1572+64
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1572+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 8192
+BORU4
+ASGNU4
+ADDRGP4 $340
+JUMPV
+LABELV $339
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1572+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTI4 -8193
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $340
+ADDRGP4 s_graphicsoptions+1380+64
+INDIRI4
+CNSTI4 0
+NEI4 $352
+ADDRGP4 s_graphicsoptions+1476+64
+INDIRI4
+CNSTI4 0
+NEI4 $356
+ADDRGP4 s_graphicsoptions+1476+64
+CNSTI4 1
+ASGNI4
+LABELV $356
+LABELV $352
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 0
+INDIRP4
+ADDRLP4 0
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+ADDRGP4 s_ivo
+INDIRI4
+ADDRGP4 s_graphicsoptions+920+64
+INDIRI4
+EQI4 $364
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTI4 -20481
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $364
+ADDRGP4 s_ivo+4
+INDIRI4
+ADDRGP4 s_graphicsoptions+1188+64
+INDIRI4
+EQI4 $370
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTI4 -20481
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $370
+ADDRGP4 s_ivo+36
+INDIRI4
+ADDRGP4 s_graphicsoptions+1380+64
+INDIRI4
+EQI4 $377
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTI4 -20481
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $377
+ADDRGP4 s_ivo+8
+INDIRI4
+CVIF4 4
+ADDRGP4 s_graphicsoptions+1112+68
+INDIRF4
+EQF4 $384
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTI4 -20481
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $384
+ADDRGP4 s_ivo+12
+INDIRI4
+ADDRGP4 s_graphicsoptions+1284+64
+INDIRI4
+EQI4 $391
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTI4 -20481
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $391
+ADDRGP4 s_ivo+16
+INDIRI4
+ADDRGP4 s_graphicsoptions+1572+64
+INDIRI4
+EQI4 $398
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTI4 -20481
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $398
+ADDRGP4 s_ivo+32
+INDIRI4
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+EQI4 $405
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTI4 -20481
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $405
+ADDRGP4 s_ivo+20
+INDIRI4
+ADDRGP4 s_graphicsoptions+1476+64
+INDIRI4
+EQI4 $412
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTI4 -20481
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $412
+ADDRGP4 s_ivo+24
+INDIRI4
+ADDRGP4 s_graphicsoptions+1668+64
+INDIRI4
+EQI4 $419
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTI4 -20481
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $419
+ADDRGP4 s_ivo+28
+INDIRI4
+ADDRGP4 s_graphicsoptions+1764+64
+INDIRI4
+EQI4 $426
+ADDRLP4 4
+ADDRGP4 s_graphicsoptions+1932+44
+ASGNP4
+ADDRLP4 4
+INDIRP4
+ADDRLP4 4
+INDIRP4
+INDIRU4
+CNSTI4 -20481
+CVIU4 4
+BANDU4
+ASGNU4
+LABELV $426
+ADDRGP4 GraphicsOptions_CheckConfig
+CALLV
+pop
+LABELV $326
+endproc GraphicsOptions_UpdateMenuItems 8 0
+proc GraphicsOptions_ApplyChanges 52 12
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $434
+ADDRGP4 $433
+JUMPV
+LABELV $434
+ADDRLP4 0
+ADDRGP4 s_graphicsoptions+1476+64
+INDIRI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+CNSTI4 0
+EQI4 $440
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+EQI4 $442
+ADDRLP4 0
+INDIRI4
+CNSTI4 2
+EQI4 $443
+ADDRGP4 $436
+JUMPV
+LABELV $440
+ADDRGP4 $441
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $437
+JUMPV
+LABELV $442
+ADDRGP4 $441
+ARGP4
+CNSTF4 1098907648
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $437
+JUMPV
+LABELV $443
+ADDRGP4 $441
+ARGP4
+CNSTF4 1107296256
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $436
+LABELV $437
+ADDRGP4 $444
+ARGP4
+CNSTF4 1077936128
+ADDRGP4 s_graphicsoptions+1112+68
+INDIRF4
+SUBF4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $447
+ARGP4
+ADDRGP4 s_graphicsoptions+1380+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+EQI4 $450
+ADDRGP4 s_graphicsoptions+920+64
+INDIRI4
+CNSTI4 -1
+EQI4 $458
+ADDRGP4 s_graphicsoptions+920+64
+INDIRI4
+CVIU4 4
+CNSTU4 32
+LTU4 $452
+LABELV $458
+ADDRGP4 s_graphicsoptions+920+64
+CNSTI4 0
+ASGNI4
+LABELV $452
+ADDRGP4 s_graphicsoptions+920+64
+INDIRI4
+ARGI4
+ADDRLP4 8
+ADDRGP4 GraphicsOptions_FindBuiltinResolution
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 -1
+NEI4 $463
+ADDRLP4 12
+ARGP4
+ADDRGP4 s_graphicsoptions+920+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 44
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+CNSTI1 0
+ASGNI1
+ADDRGP4 s_graphicsoptions+920+64
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+CNSTI4 120
+ARGI4
+ADDRLP4 48
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 28
+ARGP4
+ADDRLP4 48
+INDIRP4
+CNSTI4 1
+ADDP4
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 $469
+ARGP4
+ADDRLP4 12
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $470
+ARGP4
+ADDRLP4 28
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $463
+ADDRGP4 $471
+ARGP4
+ADDRLP4 4
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $451
+JUMPV
+LABELV $450
+ADDRGP4 $471
+ARGP4
+ADDRGP4 s_graphicsoptions+920+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $451
+ADDRGP4 $474
+ARGP4
+ADDRGP4 s_graphicsoptions+1188+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $477
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $478
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $479
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $480
+ARGP4
+ADDRGP4 s_graphicsoptions+1284+64
+INDIRI4
+CVIF4 4
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 s_graphicsoptions+1668+64
+INDIRI4
+CNSTI4 2
+NEI4 $483
+ADDRGP4 $487
+ARGP4
+CNSTF4 0
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $488
+ARGP4
+CNSTF4 1082130432
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $484
+JUMPV
+LABELV $483
+ADDRGP4 s_graphicsoptions+1668+64
+INDIRI4
+CNSTI4 1
+NEI4 $489
+ADDRGP4 $487
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $488
+ARGP4
+CNSTF4 1094713344
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $490
+JUMPV
+LABELV $489
+ADDRGP4 $487
+ARGP4
+CNSTF4 1065353216
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+ADDRGP4 $488
+ARGP4
+CNSTF4 1101004800
+ARGF4
+ADDRGP4 trap_Cvar_SetValue
+CALLV
+pop
+LABELV $490
+LABELV $484
+ADDRGP4 s_graphicsoptions+1764+64
+INDIRI4
+CNSTI4 0
+EQI4 $493
+ADDRGP4 $497
+ARGP4
+ADDRGP4 $498
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+ADDRGP4 $494
+JUMPV
+LABELV $493
+ADDRGP4 $497
+ARGP4
+ADDRGP4 $499
+ARGP4
+ADDRGP4 trap_Cvar_Set
+CALLV
+pop
+LABELV $494
+CNSTI4 2
+ARGI4
+ADDRGP4 $500
+ARGP4
+ADDRGP4 trap_Cmd_ExecuteText
+CALLV
+pop
+LABELV $433
+endproc GraphicsOptions_ApplyChanges 52 12
+proc GraphicsOptions_Event 16 4
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $502
+ADDRGP4 $501
+JUMPV
+LABELV $502
+ADDRLP4 4
+ADDRFP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 101
+LTI4 $504
+ADDRLP4 4
+INDIRI4
+CNSTI4 109
+GTI4 $504
+ADDRLP4 4
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $549-404
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $549
+address $544
+address $504
+address $524
+address $507
+address $543
+address $505
+address $546
+address $547
+address $548
+code
+LABELV $507
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 1
+NEI4 $505
+ADDRGP4 s_graphicsoptions+920+64
+INDIRI4
+CNSTI4 2
+GEI4 $512
+ADDRGP4 s_graphicsoptions+920+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 $505
+JUMPV
+LABELV $512
+ADDRGP4 s_graphicsoptions+920+64
+INDIRI4
+CNSTI4 6
+LEI4 $505
+ADDRGP4 s_graphicsoptions+920+64
+CNSTI4 6
+ASGNI4
+ADDRGP4 $505
+JUMPV
+LABELV $524
+ADDRLP4 0
+CNSTI4 40
+ADDRGP4 s_graphicsoptions+824+64
+INDIRI4
+MULI4
+ADDRGP4 s_ivo_templates
+ADDP4
+ASGNP4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ARGI4
+ADDRLP4 12
+ADDRGP4 GraphicsOptions_FindDetectedResolution
+CALLI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+64
+ADDRLP4 12
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1112+68
+ADDRLP4 0
+INDIRP4
+CNSTI4 8
+ADDP4
+INDIRI4
+CVIF4 4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1284+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 12
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1572+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 16
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1476+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 20
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1668+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 24
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1764+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 28
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1188+64
+ADDRLP4 0
+INDIRP4
+CNSTI4 4
+ADDP4
+INDIRI4
+ASGNI4
+ADDRGP4 $505
+JUMPV
+LABELV $543
+ADDRGP4 UI_DriverInfo_Menu
+CALLV
+pop
+ADDRGP4 $505
+JUMPV
+LABELV $544
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 $505
+JUMPV
+LABELV $546
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_DisplayOptionsMenu
+CALLV
+pop
+ADDRGP4 $505
+JUMPV
+LABELV $547
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_SoundOptionsMenu
+CALLV
+pop
+ADDRGP4 $505
+JUMPV
+LABELV $548
+ADDRGP4 UI_PopMenu
+CALLV
+pop
+ADDRGP4 UI_NetworkOptionsMenu
+CALLV
+pop
+LABELV $504
+LABELV $505
+LABELV $501
+endproc GraphicsOptions_Event 16 4
+proc GraphicsOptions_TQEvent 0 0
+ADDRFP4 4
+INDIRI4
+CNSTI4 3
+EQI4 $552
+ADDRGP4 $551
+JUMPV
+LABELV $552
+ADDRGP4 s_graphicsoptions+1112+68
+ADDRGP4 s_graphicsoptions+1112+68
+INDIRF4
+CNSTF4 1056964608
+ADDF4
+CVFI4 4
+CVIF4 4
+ASGNF4
+LABELV $551
+endproc GraphicsOptions_TQEvent 0 0
+export GraphicsOptions_MenuDraw
+proc GraphicsOptions_MenuDraw 0 4
+ADDRGP4 GraphicsOptions_UpdateMenuItems
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 Menu_Draw
+CALLV
+pop
+LABELV $558
+endproc GraphicsOptions_MenuDraw 0 4
+proc GraphicsOptions_SetMenuItems 1056 12
+ADDRGP4 $471
+ARGP4
+ADDRLP4 0
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 0
+INDIRF4
+CVFI4 4
+ARGI4
+ADDRLP4 4
+ADDRGP4 GraphicsOptions_FindDetectedResolution
+CALLI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+64
+ADDRLP4 4
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+64
+INDIRI4
+CNSTI4 0
+GEI4 $562
+ADDRGP4 resolutionsDetected
+INDIRI4
+CNSTI4 0
+EQI4 $566
+ADDRGP4 $469
+ARGP4
+ADDRLP4 12
+ARGP4
+CNSTI4 1022
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 12
+ARGP4
+ADDRLP4 1036
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1036
+INDIRI4
+ADDRLP4 12+1
+ADDP4
+CNSTI1 0
+ASGNI1
+ADDRLP4 12
+ARGP4
+ADDRLP4 1040
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 1040
+INDIRI4
+ADDRLP4 12
+ADDP4
+CNSTI1 120
+ASGNI1
+ADDRLP4 12
+ARGP4
+ADDRLP4 1044
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRLP4 12
+ARGP4
+ADDRLP4 1048
+ADDRGP4 strlen
+CALLI4
+ASGNI4
+ADDRGP4 $470
+ARGP4
+ADDRLP4 1044
+INDIRI4
+ADDRLP4 12
+ADDP4
+ARGP4
+CNSTU4 1024
+ADDRLP4 1048
+INDIRI4
+CVIU4 4
+SUBU4
+CVUI4 4
+ARGI4
+ADDRGP4 trap_Cvar_VariableStringBuffer
+CALLV
+pop
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+ADDRGP4 $572
+JUMPV
+LABELV $569
+ADDRLP4 12
+ARGP4
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+ARGP4
+ADDRLP4 1052
+ADDRGP4 strcmp
+CALLI4
+ASGNI4
+ADDRLP4 1052
+INDIRI4
+CNSTI4 0
+NEI4 $573
+ADDRGP4 s_graphicsoptions+920+64
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRGP4 $571
+JUMPV
+LABELV $573
+LABELV $570
+ADDRLP4 8
+ADDRLP4 8
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $572
+ADDRLP4 8
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 detectedResolutions
+ADDP4
+INDIRP4
+CVPU4 4
+CNSTU4 0
+NEU4 $569
+LABELV $571
+ADDRGP4 s_graphicsoptions+920+64
+INDIRI4
+CNSTI4 0
+GEI4 $567
+ADDRGP4 s_graphicsoptions+920+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $567
+JUMPV
+LABELV $566
+ADDRGP4 s_graphicsoptions+920+64
+CNSTI4 3
+ASGNI4
+LABELV $567
+LABELV $562
+ADDRGP4 $474
+ARGP4
+ADDRLP4 8
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1188+64
+ADDRLP4 8
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $447
+ARGP4
+ADDRLP4 12
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1380+64
+ADDRLP4 12
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRGP4 $444
+ARGP4
+ADDRLP4 16
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1112+68
+CNSTF4 1077936128
+ADDRLP4 16
+INDIRF4
+SUBF4
+ASGNF4
+ADDRGP4 s_graphicsoptions+1112+68
+INDIRF4
+CNSTF4 0
+GEF4 $591
+ADDRGP4 s_graphicsoptions+1112+68
+CNSTF4 0
+ASGNF4
+ADDRGP4 $592
+JUMPV
+LABELV $591
+ADDRGP4 s_graphicsoptions+1112+68
+INDIRF4
+CNSTF4 1077936128
+LEF4 $597
+ADDRGP4 s_graphicsoptions+1112+68
+CNSTF4 1077936128
+ASGNF4
+LABELV $597
+LABELV $592
+ADDRGP4 $480
+ARGP4
+ADDRLP4 24
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 24
+INDIRF4
+CNSTF4 0
+EQF4 $606
+ADDRLP4 20
+CNSTI4 1
+ASGNI4
+ADDRGP4 $607
+JUMPV
+LABELV $606
+ADDRLP4 20
+CNSTI4 0
+ASGNI4
+LABELV $607
+ADDRGP4 s_graphicsoptions+1284+64
+ADDRLP4 20
+INDIRI4
+ASGNI4
+ADDRGP4 $441
+ARGP4
+ADDRLP4 32
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 28
+ADDRLP4 32
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 40
+CNSTI4 16
+ASGNI4
+ADDRLP4 28
+INDIRI4
+ADDRLP4 40
+INDIRI4
+EQI4 $614
+ADDRLP4 28
+INDIRI4
+ADDRLP4 40
+INDIRI4
+GTI4 $621
+LABELV $620
+ADDRLP4 28
+INDIRI4
+CNSTI4 0
+EQI4 $611
+ADDRGP4 $608
+JUMPV
+LABELV $621
+ADDRLP4 28
+INDIRI4
+CNSTI4 32
+EQI4 $617
+ADDRGP4 $608
+JUMPV
+LABELV $608
+LABELV $611
+ADDRGP4 s_graphicsoptions+1476+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $614
+ADDRGP4 s_graphicsoptions+1476+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $609
+JUMPV
+LABELV $617
+ADDRGP4 s_graphicsoptions+1476+64
+CNSTI4 2
+ASGNI4
+LABELV $609
+ADDRGP4 $497
+ARGP4
+ADDRLP4 44
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRLP4 44
+INDIRP4
+ARGP4
+ADDRGP4 $499
+ARGP4
+ADDRLP4 48
+ADDRGP4 Q_stricmp
+CALLI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+NEI4 $622
+ADDRGP4 s_graphicsoptions+1764+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $623
+JUMPV
+LABELV $622
+ADDRGP4 s_graphicsoptions+1764+64
+CNSTI4 1
+ASGNI4
+LABELV $623
+ADDRGP4 $487
+ARGP4
+ADDRLP4 52
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 52
+INDIRF4
+CNSTF4 0
+LEF4 $628
+ADDRGP4 $488
+ARGP4
+ADDRLP4 56
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 56
+INDIRF4
+CNSTF4 1101004800
+LTF4 $630
+ADDRGP4 s_graphicsoptions+1668+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $629
+JUMPV
+LABELV $630
+ADDRGP4 s_graphicsoptions+1668+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $629
+JUMPV
+LABELV $628
+ADDRGP4 s_graphicsoptions+1668+64
+CNSTI4 2
+ASGNI4
+LABELV $629
+ADDRGP4 $477
+ARGP4
+ADDRLP4 60
+ADDRGP4 trap_Cvar_VariableValue
+CALLF4
+ASGNF4
+ADDRLP4 56
+ADDRLP4 60
+INDIRF4
+CVFI4 4
+ASGNI4
+ADDRLP4 68
+CNSTI4 16
+ASGNI4
+ADDRLP4 56
+INDIRI4
+ADDRLP4 68
+INDIRI4
+EQI4 $644
+ADDRLP4 56
+INDIRI4
+ADDRLP4 68
+INDIRI4
+GTI4 $651
+LABELV $650
+ADDRLP4 56
+INDIRI4
+CNSTI4 0
+EQI4 $641
+ADDRGP4 $638
+JUMPV
+LABELV $651
+ADDRLP4 56
+INDIRI4
+CNSTI4 32
+EQI4 $647
+ADDRGP4 $638
+JUMPV
+LABELV $638
+LABELV $641
+ADDRGP4 s_graphicsoptions+1572+64
+CNSTI4 0
+ASGNI4
+ADDRGP4 $639
+JUMPV
+LABELV $644
+ADDRGP4 s_graphicsoptions+1572+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 $639
+JUMPV
+LABELV $647
+ADDRGP4 s_graphicsoptions+1572+64
+CNSTI4 2
+ASGNI4
+LABELV $639
+ADDRGP4 s_graphicsoptions+1188+64
+INDIRI4
+CNSTI4 0
+NEI4 $652
+ADDRGP4 s_graphicsoptions+1572+64
+CNSTI4 0
+ASGNI4
+LABELV $652
+ADDRGP4 s_graphicsoptions+1016+64
+INDIRI4
+CNSTI4 1
+NEI4 $658
+ADDRGP4 s_graphicsoptions+1572+64
+CNSTI4 1
+ASGNI4
+LABELV $658
+LABELV $559
+endproc GraphicsOptions_SetMenuItems 1056 12
+data
+align 4
+LABELV $665
+address $666
+address $667
+byte 4 0
+align 4
+LABELV $668
+address $666
+address $669
+address $670
+byte 4 0
+align 4
+LABELV $671
+address $672
+address $673
+address $674
+address $675
+address $676
+address $677
+byte 4 0
+align 4
+LABELV $678
+address $679
+address $680
+byte 4 0
+align 4
+LABELV $681
+address $666
+address $669
+address $670
+byte 4 0
+align 4
+LABELV $682
+address $683
+address $684
+byte 4 0
+align 4
+LABELV $685
+address $686
+address $687
+address $688
+byte 4 0
+align 4
+LABELV $689
+address $690
+address $691
+byte 4 0
+export GraphicsOptions_MenuInit
+code
+proc GraphicsOptions_MenuInit 28 12
+ADDRGP4 s_graphicsoptions
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 2108
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRGP4 $692
+ARGP4
+ADDRLP4 4
+ADDRGP4 UI_Cvar_VariableString
+CALLP4
+ASGNP4
+ADDRGP4 resbuf
+ARGP4
+ADDRLP4 4
+INDIRP4
+ARGP4
+CNSTI4 1024
+ARGI4
+ADDRGP4 Q_strncpyz
+CALLV
+pop
+ADDRGP4 resbuf
+INDIRI1
+CVII4 1
+CNSTI4 0
+EQI4 $693
+ADDRLP4 8
+ADDRGP4 resbuf
+ASGNP4
+ADDRLP4 12
+CNSTU4 0
+ASGNU4
+ADDRGP4 $696
+JUMPV
+LABELV $695
+ADDRLP4 16
+ADDRLP4 12
+INDIRU4
+ASGNU4
+ADDRLP4 12
+ADDRLP4 16
+INDIRU4
+CNSTU4 1
+ADDU4
+ASGNU4
+ADDRLP4 16
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+ARGP4
+CNSTI4 32
+ARGI4
+ADDRLP4 20
+ADDRGP4 strchr
+CALLP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 20
+INDIRP4
+ASGNP4
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $698
+ADDRLP4 24
+ADDRLP4 8
+INDIRP4
+ASGNP4
+ADDRLP4 8
+ADDRLP4 24
+INDIRP4
+CNSTI4 1
+ADDP4
+ASGNP4
+ADDRLP4 24
+INDIRP4
+CNSTI1 0
+ASGNI1
+LABELV $698
+LABELV $696
+ADDRLP4 8
+INDIRP4
+CVPU4 4
+CNSTU4 0
+EQU4 $700
+ADDRLP4 12
+INDIRU4
+CNSTU4 31
+LTU4 $695
+LABELV $700
+ADDRLP4 12
+INDIRU4
+CNSTI4 2
+LSHU4
+ADDRGP4 detectedResolutions
+ADDP4
+CNSTP4 0
+ASGNP4
+ADDRLP4 12
+INDIRU4
+CNSTU4 0
+EQU4 $701
+ADDRGP4 resolutions
+ADDRGP4 detectedResolutions
+ASGNP4
+ADDRGP4 resolutionsDetected
+CNSTI4 1
+ASGNI4
+LABELV $701
+LABELV $693
+ADDRGP4 GraphicsOptions_Cache
+CALLV
+pop
+ADDRGP4 s_graphicsoptions+276
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+280
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+268
+ADDRGP4 GraphicsOptions_MenuDraw
+ASGNP4
+ADDRGP4 s_graphicsoptions+288
+CNSTI4 10
+ASGNI4
+ADDRGP4 s_graphicsoptions+288+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_graphicsoptions+288+16
+CNSTI4 16
+ASGNI4
+ADDRGP4 s_graphicsoptions+288+60
+ADDRGP4 $713
+ASGNP4
+ADDRGP4 s_graphicsoptions+288+68
+ADDRGP4 color_white
+ASGNP4
+ADDRGP4 s_graphicsoptions+288+64
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+360
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+360+4
+ADDRGP4 $68
+ASGNP4
+ADDRGP4 s_graphicsoptions+360+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_graphicsoptions+360+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_graphicsoptions+360+16
+CNSTI4 78
+ASGNI4
+ADDRGP4 s_graphicsoptions+360+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_graphicsoptions+360+80
+CNSTI4 329
+ASGNI4
+ADDRGP4 s_graphicsoptions+448
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+448+4
+ADDRGP4 $69
+ASGNP4
+ADDRGP4 s_graphicsoptions+448+44
+CNSTU4 16384
+ASGNU4
+ADDRGP4 s_graphicsoptions+448+12
+CNSTI4 376
+ASGNI4
+ADDRGP4 s_graphicsoptions+448+16
+CNSTI4 76
+ASGNI4
+ADDRGP4 s_graphicsoptions+448+76
+CNSTI4 256
+ASGNI4
+ADDRGP4 s_graphicsoptions+448+80
+CNSTI4 334
+ASGNI4
+ADDRGP4 s_graphicsoptions+536
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+536+44
+CNSTU4 16
+ASGNU4
+ADDRGP4 s_graphicsoptions+536+8
+CNSTI4 106
+ASGNI4
+ADDRGP4 s_graphicsoptions+536+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+536+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+536+16
+CNSTI4 186
+ASGNI4
+ADDRGP4 s_graphicsoptions+536+60
+ADDRGP4 $757
+ASGNP4
+ADDRGP4 s_graphicsoptions+536+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+536+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_graphicsoptions+608
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+608+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_graphicsoptions+608+8
+CNSTI4 107
+ASGNI4
+ADDRGP4 s_graphicsoptions+608+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+608+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+608+16
+CNSTI4 213
+ASGNI4
+ADDRGP4 s_graphicsoptions+608+60
+ADDRGP4 $775
+ASGNP4
+ADDRGP4 s_graphicsoptions+608+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+608+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_graphicsoptions+680
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_graphicsoptions+680+8
+CNSTI4 108
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+680+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+16
+CNSTI4 240
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+60
+ADDRGP4 $793
+ASGNP4
+ADDRGP4 s_graphicsoptions+680+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+680+68
+ADDRGP4 color_red
+ASGNP4
+ADDRGP4 s_graphicsoptions+752
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+752+44
+CNSTU4 272
+ASGNU4
+ADDRGP4 s_graphicsoptions+752+8
+CNSTI4 109
+ASGNI4
+ADDRGP4 s_graphicsoptions+752+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+752+12
+CNSTI4 216
+ASGNI4
+ADDRGP4 s_graphicsoptions+752+16
+CNSTI4 267
+ASGNI4
+ADDRGP4 s_graphicsoptions+752+60
+ADDRGP4 $811
+ASGNP4
+ADDRGP4 s_graphicsoptions+752+64
+CNSTI4 2
+ASGNI4
+ADDRGP4 s_graphicsoptions+752+68
+ADDRGP4 color_red
+ASGNP4
+ADDRLP4 0
+CNSTI4 132
+ASGNI4
+ADDRGP4 s_graphicsoptions+824
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+824+4
+ADDRGP4 $819
+ASGNP4
+ADDRGP4 s_graphicsoptions+824+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+824+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+824+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+824+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+824+8
+CNSTI4 103
+ASGNI4
+ADDRGP4 s_graphicsoptions+824+76
+ADDRGP4 $671
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 36
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016+4
+ADDRGP4 $835
+ASGNP4
+ADDRGP4 s_graphicsoptions+1016+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1016+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1016+76
+ADDRGP4 $665
+ASGNP4
+ADDRGP4 uis+56+11284
+INDIRI4
+CNSTI4 2
+NEI4 $849
+ADDRLP4 8
+CNSTI4 1
+ASGNI4
+ADDRGP4 $850
+JUMPV
+LABELV $849
+ADDRLP4 8
+CNSTI4 0
+ASGNI4
+LABELV $850
+ADDRGP4 s_graphicsoptions+1016+64
+ADDRLP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1380
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1380+4
+ADDRGP4 $854
+ASGNP4
+ADDRGP4 s_graphicsoptions+1380+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1380+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1380+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1380+76
+ADDRGP4 $689
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+920
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+4
+ADDRGP4 $866
+ASGNP4
+ADDRGP4 s_graphicsoptions+920+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+920+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+920+76
+ADDRGP4 resolutions
+INDIRP4
+ASGNP4
+ADDRGP4 s_graphicsoptions+920+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+920+8
+CNSTI4 104
+ASGNI4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1572
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1572+4
+ADDRGP4 $882
+ASGNP4
+ADDRGP4 s_graphicsoptions+1572+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1572+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1572+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1572+76
+ADDRGP4 $681
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1188
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1188+4
+ADDRGP4 $894
+ASGNP4
+ADDRGP4 s_graphicsoptions+1188+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1188+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1188+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1188+76
+ADDRGP4 $689
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1284
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1284+4
+ADDRGP4 $906
+ASGNP4
+ADDRGP4 s_graphicsoptions+1284+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1284+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1284+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1284+76
+ADDRGP4 $678
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1668
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1668+4
+ADDRGP4 $918
+ASGNP4
+ADDRGP4 s_graphicsoptions+1668+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1668+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1668+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1668+76
+ADDRGP4 $685
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1112
+CNSTI4 1
+ASGNI4
+ADDRGP4 s_graphicsoptions+1112+4
+ADDRGP4 $930
+ASGNP4
+ADDRGP4 s_graphicsoptions+1112+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1112+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1112+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1112+60
+CNSTF4 0
+ASGNF4
+ADDRGP4 s_graphicsoptions+1112+64
+CNSTF4 1077936128
+ASGNF4
+ADDRGP4 s_graphicsoptions+1112+48
+ADDRGP4 GraphicsOptions_TQEvent
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1476
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1476+4
+ADDRGP4 $946
+ASGNP4
+ADDRGP4 s_graphicsoptions+1476+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1476+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1476+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1476+76
+ADDRGP4 $668
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1764
+CNSTI4 3
+ASGNI4
+ADDRGP4 s_graphicsoptions+1764+4
+ADDRGP4 $958
+ASGNP4
+ADDRGP4 s_graphicsoptions+1764+44
+CNSTU4 258
+ASGNU4
+ADDRGP4 s_graphicsoptions+1764+12
+CNSTI4 400
+ASGNI4
+ADDRGP4 s_graphicsoptions+1764+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1764+76
+ADDRGP4 $682
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 32
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1860
+CNSTI4 9
+ASGNI4
+ADDRGP4 s_graphicsoptions+1860+44
+CNSTU4 264
+ASGNU4
+ADDRGP4 s_graphicsoptions+1860+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+1860+8
+CNSTI4 105
+ASGNI4
+ADDRGP4 s_graphicsoptions+1860+12
+CNSTI4 320
+ASGNI4
+ADDRGP4 s_graphicsoptions+1860+16
+ADDRLP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+1860+60
+ADDRGP4 $980
+ASGNP4
+ADDRGP4 s_graphicsoptions+1860+64
+CNSTI4 17
+ASGNI4
+ADDRGP4 s_graphicsoptions+1860+68
+ADDRGP4 color_red
+ASGNP4
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 18
+ADDI4
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020+4
+ADDRGP4 $70
+ASGNP4
+ADDRGP4 s_graphicsoptions+2020+44
+CNSTU4 260
+ASGNU4
+ADDRGP4 s_graphicsoptions+2020+48
+ADDRGP4 GraphicsOptions_Event
+ASGNP4
+ADDRGP4 s_graphicsoptions+2020+8
+CNSTI4 101
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020+12
+CNSTI4 0
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_graphicsoptions+2020+60
+ADDRGP4 $71
+ASGNP4
+ADDRGP4 s_graphicsoptions+1932
+CNSTI4 6
+ASGNI4
+ADDRGP4 s_graphicsoptions+1932+4
+ADDRGP4 $1007
+ASGNP4
+ADDRGP4 s_graphicsoptions+1932+44
+CNSTU4 20752
+ASGNU4
+ADDRGP4 s_graphicsoptions+1932+48
+ADDRGP4 GraphicsOptions_ApplyChanges
+ASGNP4
+ADDRGP4 s_graphicsoptions+1932+12
+CNSTI4 640
+ASGNI4
+ADDRGP4 s_graphicsoptions+1932+16
+CNSTI4 416
+ASGNI4
+ADDRGP4 s_graphicsoptions+1932+76
+CNSTI4 128
+ASGNI4
+ADDRGP4 s_graphicsoptions+1932+80
+CNSTI4 64
+ASGNI4
+ADDRGP4 s_graphicsoptions+1932+60
+ADDRGP4 $1022
+ASGNP4
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+288
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+360
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+448
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+536
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+608
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+680
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+752
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+824
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1016
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1380
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+920
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1572
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1188
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1284
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1668
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1112
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1476
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1764
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1860
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+2020
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+1932
+ARGP4
+ADDRGP4 Menu_AddItem
+CALLV
+pop
+ADDRGP4 GraphicsOptions_SetMenuItems
+CALLV
+pop
+ADDRGP4 GraphicsOptions_GetInitialVideo
+CALLV
+pop
+ADDRGP4 uis+56+11284
+INDIRI4
+CNSTI4 0
+NEI4 $1044
+ADDRGP4 uis+56+11288
+INDIRI4
+CNSTI4 1
+NEI4 $1044
+ADDRLP4 12
+ADDRGP4 s_graphicsoptions+1016+44
+ASGNP4
+ADDRLP4 12
+INDIRP4
+ADDRLP4 12
+INDIRP4
+INDIRU4
+CNSTU4 20480
+BORU4
+ASGNU4
+LABELV $1044
+LABELV $664
+endproc GraphicsOptions_MenuInit 28 12
+export GraphicsOptions_Cache
+proc GraphicsOptions_Cache 0 4
+ADDRGP4 $68
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $69
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $70
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $71
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1007
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+ADDRGP4 $1022
+ARGP4
+ADDRGP4 trap_R_RegisterShaderNoMip
+CALLI4
+pop
+LABELV $1052
+endproc GraphicsOptions_Cache 0 4
+export UI_GraphicsOptionsMenu
+proc UI_GraphicsOptionsMenu 0 8
+ADDRGP4 GraphicsOptions_MenuInit
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 UI_PushMenu
+CALLV
+pop
+ADDRGP4 s_graphicsoptions
+ARGP4
+ADDRGP4 s_graphicsoptions+536
+ARGP4
+ADDRGP4 Menu_SetCursorToItem
+CALLV
+pop
+LABELV $1053
+endproc UI_GraphicsOptionsMenu 0 8
+bss
+align 4
+LABELV detectedResolutions
+skip 128
+align 1
+LABELV resbuf
+skip 1024
+align 4
+LABELV s_graphicsoptions
+skip 2108
+align 4
+LABELV s_ivo
+skip 40
+align 4
+LABELV s_driverinfo
+skip 1908
+import UI_RankStatusMenu
+import RankStatus_Cache
+import UI_SignupMenu
+import Signup_Cache
+import UI_LoginMenu
+import Login_Cache
+import UI_RankingsMenu
+import Rankings_Cache
+import Rankings_DrawPassword
+import Rankings_DrawName
+import Rankings_DrawText
+import UI_InitGameinfo
+import UI_SPUnlockMedals_f
+import UI_SPUnlock_f
+import UI_GetAwardLevel
+import UI_LogAwardData
+import UI_NewGame
+import UI_GetCurrentGame
+import UI_CanShowTierVideo
+import UI_ShowTierVideo
+import UI_TierCompleted
+import UI_SetBestScore
+import UI_GetBestScore
+import UI_GetNumBots
+import UI_GetBotInfoByName
+import UI_GetBotInfoByNumber
+import UI_GetNumSPTiers
+import UI_GetNumSPArenas
+import UI_GetNumArenas
+import UI_GetSpecialArenaInfo
+import UI_GetArenaInfoByMap
+import UI_GetArenaInfoByNumber
+import UI_NetworkOptionsMenu
+import UI_NetworkOptionsMenu_Cache
+import UI_SoundOptionsMenu
+import UI_SoundOptionsMenu_Cache
+import UI_DisplayOptionsMenu
+import UI_DisplayOptionsMenu_Cache
+import UI_SaveConfigMenu
+import UI_SaveConfigMenu_Cache
+import UI_LoadConfigMenu
+import UI_LoadConfig_Cache
+import UI_TeamOrdersMenu_Cache
+import UI_TeamOrdersMenu_f
+import UI_TeamOrdersMenu
+import UI_RemoveBotsMenu
+import UI_RemoveBots_Cache
+import UI_AddBotsMenu
+import UI_AddBots_Cache
+import trap_SetPbClStatus
+import trap_VerifyCDKey
+import trap_SetCDKey
+import trap_GetCDKey
+import trap_MemoryRemaining
+import trap_LAN_GetPingInfo
+import trap_LAN_GetPing
+import trap_LAN_ClearPing
+import trap_LAN_ServerStatus
+import trap_LAN_GetPingQueueCount
+import trap_LAN_GetServerInfo
+import trap_LAN_GetServerAddressString
+import trap_LAN_GetServerCount
+import trap_GetConfigString
+import trap_GetGlconfig
+import trap_GetClientState
+import trap_GetClipboardData
+import trap_Key_SetCatcher
+import trap_Key_GetCatcher
+import trap_Key_ClearStates
+import trap_Key_SetOverstrikeMode
+import trap_Key_GetOverstrikeMode
+import trap_Key_IsDown
+import trap_Key_SetBinding
+import trap_Key_GetBindingBuf
+import trap_Key_KeynumToStringBuf
+import trap_S_RegisterSound
+import trap_S_StartLocalSound
+import trap_CM_LerpTag
+import trap_UpdateScreen
+import trap_R_DrawStretchPic
+import trap_R_SetColor
+import trap_R_RenderScene
+import trap_R_AddLightToScene
+import trap_R_AddPolyToScene
+import trap_R_AddRefEntityToScene
+import trap_R_ClearScene
+import trap_R_RegisterShaderNoMip
+import trap_R_RegisterSkin
+import trap_R_RegisterModel
+import trap_FS_Seek
+import trap_FS_GetFileList
+import trap_FS_FCloseFile
+import trap_FS_Write
+import trap_FS_Read
+import trap_FS_FOpenFile
+import trap_Cmd_ExecuteText
+import trap_Argv
+import trap_Argc
+import trap_Cvar_InfoStringBuffer
+import trap_Cvar_Create
+import trap_Cvar_Reset
+import trap_Cvar_SetValue
+import trap_Cvar_VariableStringBuffer
+import trap_Cvar_VariableValue
+import trap_Cvar_Set
+import trap_Cvar_Update
+import trap_Cvar_Register
+import trap_Milliseconds
+import trap_Error
+import trap_Print
+import UI_SPSkillMenu_Cache
+import UI_SPSkillMenu
+import UI_SPPostgameMenu_f
+import UI_SPPostgameMenu_Cache
+import UI_SPArena_Start
+import UI_SPLevelMenu_ReInit
+import UI_SPLevelMenu_f
+import UI_SPLevelMenu
+import UI_SPLevelMenu_Cache
+import uis
+import m_entersound
+import UI_StartDemoLoop
+import UI_Cvar_VariableString
+import UI_Argv
+import UI_ForceMenuOff
+import UI_PopMenu
+import UI_PushMenu
+import UI_SetActiveMenu
+import UI_IsFullscreen
+import UI_DrawTextBox
+import UI_AdjustFrom640
+import UI_CursorInRect
+import UI_DrawChar
+import UI_DrawString
+import UI_ProportionalStringWidth
+import UI_DrawProportionalString_AutoWrapped
+import UI_DrawProportionalString
+import UI_ProportionalSizeScale
+import UI_DrawBannerString
+import UI_LerpColor
+import UI_SetColor
+import UI_UpdateScreen
+import UI_DrawRect
+import UI_FillRect
+import UI_DrawHandlePic
+import UI_DrawNamedPic
+import UI_ClampCvar
+import UI_ConsoleCommand
+import UI_Refresh
+import UI_MouseEvent
+import UI_KeyEvent
+import UI_Shutdown
+import UI_Init
+import UI_RegisterClientModelname
+import UI_PlayerInfo_SetInfo
+import UI_PlayerInfo_SetModel
+import UI_DrawPlayer
+import ServerInfo_Cache
+import UI_ServerInfoMenu
+import UI_BotSelectMenu_Cache
+import UI_BotSelectMenu
+import ServerOptions_Cache
+import StartServer_Cache
+import UI_StartServerMenu
+import ArenaServers_Cache
+import UI_ArenaServersMenu
+import SpecifyServer_Cache
+import UI_SpecifyServerMenu
+import SpecifyLeague_Cache
+import UI_SpecifyLeagueMenu
+import Preferences_Cache
+import UI_PreferencesMenu
+import PlayerSettings_Cache
+import UI_PlayerSettingsMenu
+import PlayerModel_Cache
+import UI_PlayerModelMenu
+import UI_CDKeyMenu_f
+import UI_CDKeyMenu_Cache
+import UI_CDKeyMenu
+import UI_ModsMenu_Cache
+import UI_ModsMenu
+import UI_CinematicsMenu_Cache
+import UI_CinematicsMenu_f
+import UI_CinematicsMenu
+import Demos_Cache
+import UI_DemosMenu
+import Controls_Cache
+import UI_ControlsMenu
+import UI_DrawConnectScreen
+import TeamMain_Cache
+import UI_TeamMainMenu
+import UI_SetupMenu
+import UI_SetupMenu_Cache
+import UI_Message
+import UI_ConfirmMenu_Style
+import UI_ConfirmMenu
+import ConfirmMenu_Cache
+import UI_InGameMenu
+import InGame_Cache
+import UI_CreditMenu
+import UI_UpdateCvars
+import UI_RegisterCvars
+import UI_MainMenu
+import MainMenu_Cache
+import MenuField_Key
+import MenuField_Draw
+import MenuField_Init
+import MField_Draw
+import MField_CharEvent
+import MField_KeyDownEvent
+import MField_Clear
+import ui_medalSounds
+import ui_medalPicNames
+import ui_medalNames
+import text_color_highlight
+import text_color_normal
+import text_color_disabled
+import listbar_color
+import list_color
+import name_color
+import color_dim
+import color_red
+import color_orange
+import color_blue
+import color_yellow
+import color_white
+import color_black
+import menu_dim_color
+import menu_black_color
+import menu_red_color
+import menu_highlight_color
+import menu_dark_color
+import menu_grayed_color
+import menu_text_color
+import weaponChangeSound
+import menu_null_sound
+import menu_buzz_sound
+import menu_out_sound
+import menu_move_sound
+import menu_in_sound
+import ScrollList_Key
+import ScrollList_Draw
+import Bitmap_Draw
+import Bitmap_Init
+import Menu_DefaultKey
+import Menu_SetCursorToItem
+import Menu_SetCursor
+import Menu_ActivateItem
+import Menu_ItemAtCursor
+import Menu_Draw
+import Menu_AdjustCursor
+import Menu_AddItem
+import Menu_Focus
+import Menu_Cache
+import ui_ioq3
+import ui_cdkeychecked
+import ui_cdkey
+import ui_server16
+import ui_server15
+import ui_server14
+import ui_server13
+import ui_server12
+import ui_server11
+import ui_server10
+import ui_server9
+import ui_server8
+import ui_server7
+import ui_server6
+import ui_server5
+import ui_server4
+import ui_server3
+import ui_server2
+import ui_server1
+import ui_marks
+import ui_drawCrosshairNames
+import ui_drawCrosshair
+import ui_brassTime
+import ui_browserShowEmpty
+import ui_browserShowFull
+import ui_browserSortKey
+import ui_browserGameType
+import ui_browserMaster
+import ui_spSelection
+import ui_spSkill
+import ui_spVideos
+import ui_spAwards
+import ui_spScores5
+import ui_spScores4
+import ui_spScores3
+import ui_spScores2
+import ui_spScores1
+import ui_botsFile
+import ui_arenasFile
+import ui_ctf_friendly
+import ui_ctf_timelimit
+import ui_ctf_capturelimit
+import ui_team_friendly
+import ui_team_timelimit
+import ui_team_fraglimit
+import ui_tourney_timelimit
+import ui_tourney_fraglimit
+import ui_ffa_timelimit
+import ui_ffa_fraglimit
+import BG_PlayerTouchesItem
+import BG_PlayerStateToEntityStateExtraPolate
+import BG_PlayerStateToEntityState
+import BG_TouchJumpPad
+import BG_AddPredictableEventToPlayerstate
+import BG_EvaluateTrajectoryDelta
+import BG_EvaluateTrajectory
+import BG_CanItemBeGrabbed
+import BG_FindItemForHoldable
+import BG_FindItemForPowerup
+import BG_FindItemForWeapon
+import BG_FindItem
+import bg_numItems
+import bg_itemlist
+import Pmove
+import PM_UpdateViewAngles
+import Com_Printf
+import Com_Error
+import Info_NextPair
+import Info_Validate
+import Info_SetValueForKey_Big
+import Info_SetValueForKey
+import Info_RemoveKey_big
+import Info_RemoveKey
+import Info_ValueForKey
+import Com_TruncateLongString
+import va
+import Q_CountChar
+import Q_CleanStr
+import Q_PrintStrlen
+import Q_strcat
+import Q_strncpyz
+import Q_stristr
+import Q_strrchr
+import Q_strupr
+import Q_strlwr
+import Q_stricmpn
+import Q_strncmp
+import Q_stricmp
+import Q_isintegral
+import Q_isanumber
+import Q_isalpha
+import Q_isupper
+import Q_islower
+import Q_isprint
+import Com_RandomBytes
+import Com_SkipCharset
+import Com_SkipTokens
+import Com_sprintf
+import Com_HexStrToInt
+import Parse3DMatrix
+import Parse2DMatrix
+import Parse1DMatrix
+import SkipRestOfLine
+import SkipBracedSection
+import COM_MatchToken
+import COM_ParseWarning
+import COM_ParseError
+import COM_Compress
+import COM_ParseExt
+import COM_Parse
+import COM_GetCurrentParseLine
+import COM_BeginParseSession
+import COM_DefaultExtension
+import COM_StripExtension
+import COM_GetExtension
+import COM_SkipPath
+import Com_Clamp
+import Q_isnan
+import PerpendicularVector
+import AngleVectors
+import MatrixMultiply
+import MakeNormalVectors
+import RotateAroundDirection
+import RotatePointAroundVector
+import ProjectPointOnPlane
+import PlaneFromPoints
+import AngleDelta
+import AngleNormalize180
+import AngleNormalize360
+import AnglesSubtract
+import AngleSubtract
+import LerpAngle
+import AngleMod
+import BoundsIntersectPoint
+import BoundsIntersectSphere
+import BoundsIntersect
+import BoxOnPlaneSide
+import SetPlaneSignbits
+import AxisCopy
+import AxisClear
+import AnglesToAxis
+import vectoangles
+import Q_crandom
+import Q_random
+import Q_rand
+import Q_acos
+import Q_log2
+import VectorRotate
+import Vector4Scale
+import VectorNormalize2
+import VectorNormalize
+import CrossProduct
+import VectorInverse
+import VectorNormalizeFast
+import DistanceSquared
+import Distance
+import VectorLengthSquared
+import VectorLength
+import VectorCompare
+import AddPointToBounds
+import ClearBounds
+import RadiusFromBounds
+import NormalizeColor
+import ColorBytes4
+import ColorBytes3
+import _VectorMA
+import _VectorScale
+import _VectorCopy
+import _VectorAdd
+import _VectorSubtract
+import _DotProduct
+import ByteToDir
+import DirToByte
+import ClampShort
+import ClampChar
+import Q_rsqrt
+import Q_fabs
+import axisDefault
+import vec3_origin
+import g_color_table
+import colorDkGrey
+import colorMdGrey
+import colorLtGrey
+import colorWhite
+import colorCyan
+import colorMagenta
+import colorYellow
+import colorBlue
+import colorGreen
+import colorRed
+import colorBlack
+import bytedirs
+import Hunk_Alloc
+import FloatSwap
+import LongSwap
+import ShortSwap
+import acos
+import fabs
+import abs
+import tan
+import atan2
+import cos
+import sin
+import sqrt
+import floor
+import ceil
+import memcpy
+import memset
+import memmove
+import sscanf
+import Q_snprintf
+import Q_vsnprintf
+import _atoi
+import atoi
+import _atof
+import atof
+import toupper
+import tolower
+import strncpy
+import strstr
+import strchr
+import strcmp
+import strcpy
+import strcat
+import strlen
+import rand
+import srand
+import qsort
+lit
+align 1
+LABELV $1022
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $1007
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 97
+byte 1 99
+byte 1 99
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $980
+byte 1 68
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 32
+byte 1 73
+byte 1 110
+byte 1 102
+byte 1 111
+byte 1 0
+align 1
+LABELV $958
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 70
+byte 1 105
+byte 1 108
+byte 1 116
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $946
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 58
+byte 1 0
+align 1
+LABELV $930
+byte 1 84
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $918
+byte 1 71
+byte 1 101
+byte 1 111
+byte 1 109
+byte 1 101
+byte 1 116
+byte 1 114
+byte 1 105
+byte 1 99
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 116
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 58
+byte 1 0
+align 1
+LABELV $906
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 58
+byte 1 0
+align 1
+LABELV $894
+byte 1 70
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 58
+byte 1 0
+align 1
+LABELV $882
+byte 1 67
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 32
+byte 1 68
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 104
+byte 1 58
+byte 1 0
+align 1
+LABELV $866
+byte 1 86
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 111
+byte 1 32
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 58
+byte 1 0
+align 1
+LABELV $854
+byte 1 71
+byte 1 76
+byte 1 32
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $835
+byte 1 71
+byte 1 76
+byte 1 32
+byte 1 68
+byte 1 114
+byte 1 105
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 58
+byte 1 0
+align 1
+LABELV $819
+byte 1 71
+byte 1 114
+byte 1 97
+byte 1 112
+byte 1 104
+byte 1 105
+byte 1 99
+byte 1 115
+byte 1 32
+byte 1 83
+byte 1 101
+byte 1 116
+byte 1 116
+byte 1 105
+byte 1 110
+byte 1 103
+byte 1 115
+byte 1 58
+byte 1 0
+align 1
+LABELV $811
+byte 1 78
+byte 1 69
+byte 1 84
+byte 1 87
+byte 1 79
+byte 1 82
+byte 1 75
+byte 1 0
+align 1
+LABELV $793
+byte 1 83
+byte 1 79
+byte 1 85
+byte 1 78
+byte 1 68
+byte 1 0
+align 1
+LABELV $775
+byte 1 68
+byte 1 73
+byte 1 83
+byte 1 80
+byte 1 76
+byte 1 65
+byte 1 89
+byte 1 0
+align 1
+LABELV $757
+byte 1 71
+byte 1 82
+byte 1 65
+byte 1 80
+byte 1 72
+byte 1 73
+byte 1 67
+byte 1 83
+byte 1 0
+align 1
+LABELV $713
+byte 1 83
+byte 1 89
+byte 1 83
+byte 1 84
+byte 1 69
+byte 1 77
+byte 1 32
+byte 1 83
+byte 1 69
+byte 1 84
+byte 1 85
+byte 1 80
+byte 1 0
+align 1
+LABELV $692
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 118
+byte 1 97
+byte 1 105
+byte 1 108
+byte 1 97
+byte 1 98
+byte 1 108
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 115
+byte 1 0
+align 1
+LABELV $691
+byte 1 79
+byte 1 110
+byte 1 0
+align 1
+LABELV $690
+byte 1 79
+byte 1 102
+byte 1 102
+byte 1 0
+align 1
+LABELV $688
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 0
+align 1
+LABELV $687
+byte 1 77
+byte 1 101
+byte 1 100
+byte 1 105
+byte 1 117
+byte 1 109
+byte 1 0
+align 1
+LABELV $686
+byte 1 76
+byte 1 111
+byte 1 119
+byte 1 0
+align 1
+LABELV $684
+byte 1 84
+byte 1 114
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $683
+byte 1 66
+byte 1 105
+byte 1 108
+byte 1 105
+byte 1 110
+byte 1 101
+byte 1 97
+byte 1 114
+byte 1 0
+align 1
+LABELV $680
+byte 1 86
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 0
+align 1
+LABELV $679
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 109
+byte 1 97
+byte 1 112
+byte 1 0
+align 1
+LABELV $677
+byte 1 67
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 0
+align 1
+LABELV $676
+byte 1 70
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $675
+byte 1 70
+byte 1 97
+byte 1 115
+byte 1 116
+byte 1 0
+align 1
+LABELV $674
+byte 1 78
+byte 1 111
+byte 1 114
+byte 1 109
+byte 1 97
+byte 1 108
+byte 1 0
+align 1
+LABELV $673
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $672
+byte 1 86
+byte 1 101
+byte 1 114
+byte 1 121
+byte 1 32
+byte 1 72
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 32
+byte 1 81
+byte 1 117
+byte 1 97
+byte 1 108
+byte 1 105
+byte 1 116
+byte 1 121
+byte 1 0
+align 1
+LABELV $670
+byte 1 51
+byte 1 50
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $669
+byte 1 49
+byte 1 54
+byte 1 32
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 0
+align 1
+LABELV $667
+byte 1 86
+byte 1 111
+byte 1 111
+byte 1 100
+byte 1 111
+byte 1 111
+byte 1 0
+align 1
+LABELV $666
+byte 1 68
+byte 1 101
+byte 1 102
+byte 1 97
+byte 1 117
+byte 1 108
+byte 1 116
+byte 1 0
+align 1
+LABELV $500
+byte 1 118
+byte 1 105
+byte 1 100
+byte 1 95
+byte 1 114
+byte 1 101
+byte 1 115
+byte 1 116
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 10
+byte 1 0
+align 1
+LABELV $499
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 69
+byte 1 83
+byte 1 84
+byte 1 0
+align 1
+LABELV $498
+byte 1 71
+byte 1 76
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 95
+byte 1 77
+byte 1 73
+byte 1 80
+byte 1 77
+byte 1 65
+byte 1 80
+byte 1 95
+byte 1 76
+byte 1 73
+byte 1 78
+byte 1 69
+byte 1 65
+byte 1 82
+byte 1 0
+align 1
+LABELV $497
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 77
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $488
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 117
+byte 1 98
+byte 1 100
+byte 1 105
+byte 1 118
+byte 1 105
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $487
+byte 1 114
+byte 1 95
+byte 1 108
+byte 1 111
+byte 1 100
+byte 1 66
+byte 1 105
+byte 1 97
+byte 1 115
+byte 1 0
+align 1
+LABELV $480
+byte 1 114
+byte 1 95
+byte 1 118
+byte 1 101
+byte 1 114
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 76
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $479
+byte 1 114
+byte 1 95
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $478
+byte 1 114
+byte 1 95
+byte 1 100
+byte 1 101
+byte 1 112
+byte 1 116
+byte 1 104
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $477
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $474
+byte 1 114
+byte 1 95
+byte 1 102
+byte 1 117
+byte 1 108
+byte 1 108
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $471
+byte 1 114
+byte 1 95
+byte 1 109
+byte 1 111
+byte 1 100
+byte 1 101
+byte 1 0
+align 1
+LABELV $470
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 104
+byte 1 101
+byte 1 105
+byte 1 103
+byte 1 104
+byte 1 116
+byte 1 0
+align 1
+LABELV $469
+byte 1 114
+byte 1 95
+byte 1 99
+byte 1 117
+byte 1 115
+byte 1 116
+byte 1 111
+byte 1 109
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 116
+byte 1 104
+byte 1 0
+align 1
+LABELV $447
+byte 1 114
+byte 1 95
+byte 1 97
+byte 1 108
+byte 1 108
+byte 1 111
+byte 1 119
+byte 1 69
+byte 1 120
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 115
+byte 1 105
+byte 1 111
+byte 1 110
+byte 1 115
+byte 1 0
+align 1
+LABELV $444
+byte 1 114
+byte 1 95
+byte 1 112
+byte 1 105
+byte 1 99
+byte 1 109
+byte 1 105
+byte 1 112
+byte 1 0
+align 1
+LABELV $441
+byte 1 114
+byte 1 95
+byte 1 116
+byte 1 101
+byte 1 120
+byte 1 116
+byte 1 117
+byte 1 114
+byte 1 101
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 0
+align 1
+LABELV $225
+byte 1 56
+byte 1 53
+byte 1 54
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 32
+byte 1 119
+byte 1 105
+byte 1 100
+byte 1 101
+byte 1 32
+byte 1 115
+byte 1 99
+byte 1 114
+byte 1 101
+byte 1 101
+byte 1 110
+byte 1 0
+align 1
+LABELV $224
+byte 1 50
+byte 1 48
+byte 1 52
+byte 1 56
+byte 1 120
+byte 1 49
+byte 1 53
+byte 1 51
+byte 1 54
+byte 1 0
+align 1
+LABELV $223
+byte 1 49
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 50
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $222
+byte 1 49
+byte 1 50
+byte 1 56
+byte 1 48
+byte 1 120
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 0
+align 1
+LABELV $221
+byte 1 49
+byte 1 49
+byte 1 53
+byte 1 50
+byte 1 120
+byte 1 56
+byte 1 54
+byte 1 52
+byte 1 0
+align 1
+LABELV $220
+byte 1 49
+byte 1 48
+byte 1 50
+byte 1 52
+byte 1 120
+byte 1 55
+byte 1 54
+byte 1 56
+byte 1 0
+align 1
+LABELV $219
+byte 1 57
+byte 1 54
+byte 1 48
+byte 1 120
+byte 1 55
+byte 1 50
+byte 1 48
+byte 1 0
+align 1
+LABELV $218
+byte 1 56
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 54
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $217
+byte 1 54
+byte 1 52
+byte 1 48
+byte 1 120
+byte 1 52
+byte 1 56
+byte 1 48
+byte 1 0
+align 1
+LABELV $216
+byte 1 53
+byte 1 49
+byte 1 50
+byte 1 120
+byte 1 51
+byte 1 56
+byte 1 52
+byte 1 0
+align 1
+LABELV $215
+byte 1 52
+byte 1 48
+byte 1 48
+byte 1 120
+byte 1 51
+byte 1 48
+byte 1 48
+byte 1 0
+align 1
+LABELV $214
+byte 1 51
+byte 1 50
+byte 1 48
+byte 1 120
+byte 1 50
+byte 1 52
+byte 1 48
+byte 1 0
+align 1
+LABELV $127
+byte 1 68
+byte 1 82
+byte 1 73
+byte 1 86
+byte 1 69
+byte 1 82
+byte 1 32
+byte 1 73
+byte 1 78
+byte 1 70
+byte 1 79
+byte 1 0
+align 1
+LABELV $89
+byte 1 99
+byte 1 111
+byte 1 108
+byte 1 111
+byte 1 114
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 90
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 32
+byte 1 115
+byte 1 116
+byte 1 101
+byte 1 110
+byte 1 99
+byte 1 105
+byte 1 108
+byte 1 40
+byte 1 37
+byte 1 100
+byte 1 45
+byte 1 98
+byte 1 105
+byte 1 116
+byte 1 115
+byte 1 41
+byte 1 0
+align 1
+LABELV $83
+byte 1 69
+byte 1 88
+byte 1 84
+byte 1 69
+byte 1 78
+byte 1 83
+byte 1 73
+byte 1 79
+byte 1 78
+byte 1 83
+byte 1 0
+align 1
+LABELV $82
+byte 1 80
+byte 1 73
+byte 1 88
+byte 1 69
+byte 1 76
+byte 1 70
+byte 1 79
+byte 1 82
+byte 1 77
+byte 1 65
+byte 1 84
+byte 1 0
+align 1
+LABELV $81
+byte 1 86
+byte 1 69
+byte 1 78
+byte 1 68
+byte 1 79
+byte 1 82
+byte 1 0
+align 1
+LABELV $71
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 49
+byte 1 0
+align 1
+LABELV $70
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 98
+byte 1 97
+byte 1 99
+byte 1 107
+byte 1 95
+byte 1 48
+byte 1 0
+align 1
+LABELV $69
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 49
+byte 1 95
+byte 1 114
+byte 1 0
+align 1
+LABELV $68
+byte 1 109
+byte 1 101
+byte 1 110
+byte 1 117
+byte 1 47
+byte 1 97
+byte 1 114
+byte 1 116
+byte 1 47
+byte 1 102
+byte 1 114
+byte 1 97
+byte 1 109
+byte 1 101
+byte 1 50
+byte 1 95
+byte 1 108
+byte 1 0
@@ -0,0 +1,390 @@
+export vmMain
+code
+proc vmMain 60 12
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 8
+CNSTF4 1061158912
+ASGNF4
+ADDRLP4 4
+CNSTF4 0
+ASGNF4
+ADDRLP4 12
+CNSTI4 0
+ASGNI4
+ADDRLP4 48
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRLP4 48
+INDIRI4
+CNSTI4 0
+LTI4 $3
+ADDRLP4 48
+INDIRI4
+CNSTI4 8
+GTI4 $3
+ADDRLP4 48
+INDIRI4
+CNSTI4 2
+LSHI4
+ADDRGP4 $52
+ADDP4
+INDIRP4
+JUMPV
+lit
+align 4
+LABELV $52
+address $5
+address $10
+address $15
+address $20
+address $25
+address $30
+address $35
+address $40
+address $47
+code
+LABELV $5
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $9
+JUMPV
+LABELV $6
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 0
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $7
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $9
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $6
+ADDRGP4 $4
+JUMPV
+LABELV $10
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $14
+JUMPV
+LABELV $11
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $12
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $14
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $11
+ADDRGP4 $4
+JUMPV
+LABELV $15
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $19
+JUMPV
+LABELV $16
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $17
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $19
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $16
+ADDRGP4 $4
+JUMPV
+LABELV $20
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $24
+JUMPV
+LABELV $21
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $22
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $24
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $21
+ADDRGP4 $4
+JUMPV
+LABELV $25
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $29
+JUMPV
+LABELV $26
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 52
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 52
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $27
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $29
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $26
+ADDRGP4 $4
+JUMPV
+LABELV $30
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $34
+JUMPV
+LABELV $31
+ADDRLP4 8
+INDIRF4
+ARGF4
+ADDRLP4 4
+INDIRF4
+ARGF4
+ADDRLP4 56
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 4
+ADDRLP4 4
+INDIRF4
+ADDRLP4 56
+INDIRF4
+ADDF4
+ASGNF4
+LABELV $32
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $34
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $31
+ADDRGP4 $4
+JUMPV
+LABELV $35
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $39
+JUMPV
+LABELV $36
+ADDRLP4 16
+ARGP4
+ADDRLP4 0
+INDIRI4
+ARGI4
+CNSTI4 16
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+LABELV $37
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $39
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $36
+ADDRLP4 12
+ADDRLP4 16
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRGP4 $4
+JUMPV
+LABELV $40
+ADDRLP4 16
+CNSTI1 1
+ASGNI1
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $44
+JUMPV
+LABELV $41
+ADDRLP4 16+16
+ARGP4
+ADDRLP4 16
+ARGP4
+CNSTI4 16
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+LABELV $42
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $44
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $41
+ADDRLP4 12
+ADDRLP4 16+16
+INDIRI1
+CVII4 1
+ASGNI4
+ADDRGP4 $4
+JUMPV
+LABELV $47
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRGP4 $51
+JUMPV
+LABELV $48
+ADDRLP4 0
+INDIRI4
+ARGI4
+ADDRLP4 52
+ADDRGP4 stackArg
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 12
+INDIRI4
+ADDRLP4 52
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $49
+ADDRLP4 0
+ADDRLP4 0
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $51
+ADDRLP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+LTI4 $48
+LABELV $3
+LABELV $4
+ADDRLP4 12
+INDIRI4
+ADDRLP4 4
+INDIRF4
+CVFI4 4
+ADDI4
+RETI4
+LABELV $2
+endproc vmMain 60 12
+import stackArg
+import floor
+import sqrt
+import atan2
+import cos
+import sin
+import memcpy
+import memset
@@ -0,0 +1,1142 @@
+export vmMain
+code
+proc vmMain 68 24
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRGP4 seed
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 0
+ASGNI4
+ADDRLP4 0
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRLP4 16
+ADDRLP4 32
+INDIRI4
+ASGNI4
+ADDRGP4 $5
+JUMPV
+LABELV $2
+ADDRLP4 36
+ADDRGP4 Random
+CALLI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 36
+INDIRI4
+ASGNI4
+ADDRLP4 40
+ADDRGP4 Random
+CALLI4
+ASGNI4
+ADDRLP4 8
+ADDRLP4 40
+INDIRI4
+ASGNI4
+ADDRLP4 44
+ADDRGP4 Random
+CALLI4
+ASGNI4
+ADDRLP4 12
+ADDRLP4 44
+INDIRI4
+ASGNI4
+ADDRLP4 48
+ADDRGP4 Random
+CALLI4
+ASGNI4
+ADDRLP4 20
+ADDRLP4 48
+INDIRI4
+ASGNI4
+ADDRLP4 52
+ADDRGP4 Random
+CALLI4
+ASGNI4
+ADDRLP4 24
+ADDRLP4 52
+INDIRI4
+ASGNI4
+ADDRLP4 56
+ADDRGP4 Random
+CALLI4
+ASGNI4
+ADDRLP4 28
+ADDRLP4 56
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 20
+INDIRI4
+ARGI4
+ADDRLP4 24
+INDIRI4
+ARGI4
+ADDRLP4 28
+INDIRI4
+ARGI4
+ADDRLP4 60
+ADDRGP4 TestExpressions
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 31
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 60
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ARGI4
+ADDRLP4 8
+INDIRI4
+ARGI4
+ADDRLP4 12
+INDIRI4
+ARGI4
+ADDRLP4 64
+ADDRGP4 TestSystemCalls
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 31
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 64
+INDIRI4
+ADDI4
+ASGNI4
+LABELV $3
+ADDRLP4 16
+ADDRLP4 16
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $5
+ADDRLP4 16
+INDIRI4
+ADDRFP4 0
+INDIRI4
+LTI4 $2
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $1
+endproc vmMain 68 24
+proc TestExpressions 84 0
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRFP4 12
+ADDRFP4 12
+INDIRI4
+ASGNI4
+ADDRFP4 16
+ADDRFP4 16
+INDIRI4
+ASGNI4
+ADDRFP4 20
+ADDRFP4 20
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 8
+CNSTI4 31
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDRFP4 16
+INDIRI4
+MULI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 32
+CNSTI4 65535
+ASGNI4
+ADDRLP4 36
+CNSTI4 1
+ASGNI4
+ADDRLP4 40
+ADDRFP4 16
+INDIRI4
+ADDRLP4 32
+INDIRI4
+BANDI4
+ADDRLP4 36
+INDIRI4
+BORI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 40
+INDIRI4
+DIVI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 40
+INDIRI4
+MODI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 44
+ADDRFP4 16
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 44
+INDIRI4
+LSHI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 44
+INDIRI4
+RSHI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 48
+ADDRFP4 12
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 48
+INDIRI4
+NEGI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 48
+INDIRI4
+BCOMI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDRFP4 20
+INDIRI4
+MULI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDRFP4 20
+INDIRI4
+ADDRLP4 32
+INDIRI4
+BANDI4
+ADDRLP4 36
+INDIRI4
+BORI4
+DIVI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDRFP4 20
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+LSHI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 56
+ADDRFP4 16
+INDIRI4
+ADDRFP4 20
+INDIRI4
+BXORI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+NEGI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDRLP4 56
+INDIRI4
+BCOMI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDRFP4 20
+INDIRI4
+ADDRFP4 0
+INDIRI4
+MULI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDRFP4 20
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 32
+INDIRI4
+BANDI4
+ADDRLP4 36
+INDIRI4
+BORI4
+MODI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRFP4 0
+INDIRI4
+ADDRFP4 4
+INDIRI4
+ADDRFP4 8
+INDIRI4
+ADDRFP4 12
+INDIRI4
+ADDRFP4 16
+INDIRI4
+ADDRFP4 20
+INDIRI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 8
+INDIRI4
+BANDI4
+RSHI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ADDI4
+ASGNI4
+ADDRLP4 60
+ADDRFP4 0
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 64
+ADDRFP4 4
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 68
+ADDRFP4 8
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 72
+ADDRFP4 12
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 76
+ADDRFP4 16
+INDIRI4
+CVIU4 4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 60
+INDIRU4
+ADDRLP4 64
+INDIRU4
+ADDRLP4 68
+INDIRU4
+ADDRLP4 72
+INDIRU4
+ADDRLP4 76
+INDIRU4
+MULU4
+ADDU4
+ADDU4
+ADDU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ADDI4
+ASGNI4
+ADDRLP4 80
+ADDRLP4 76
+INDIRU4
+CNSTU4 1
+BORU4
+ASGNU4
+ADDRLP4 4
+ADDRLP4 60
+INDIRU4
+ADDRLP4 64
+INDIRU4
+ADDRLP4 68
+INDIRU4
+ADDRLP4 72
+INDIRU4
+ADDRLP4 80
+INDIRU4
+DIVU4
+ADDU4
+ADDU4
+ADDU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRU4
+ADDRLP4 64
+INDIRU4
+ADDRLP4 68
+INDIRU4
+ADDRLP4 72
+INDIRU4
+ADDRLP4 80
+INDIRU4
+MODU4
+ADDU4
+ADDU4
+ADDU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 60
+INDIRU4
+ADDRLP4 64
+INDIRU4
+ADDRLP4 68
+INDIRU4
+ADDRLP4 72
+INDIRU4
+ADDRLP4 44
+INDIRI4
+RSHU4
+ADDU4
+ADDU4
+ADDU4
+ASGNU4
+ADDRLP4 0
+ADDRLP4 8
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRU4
+CVUI4 4
+ADDI4
+ASGNI4
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $6
+endproc TestExpressions 84 0
+proc FloatBits 0 0
+ADDRFP4 0
+INDIRI4
+RETI4
+LABELV $7
+endproc FloatBits 0 0
+proc TestSystemCalls 180 12
+ADDRFP4 0
+ADDRFP4 0
+INDIRI4
+ASGNI4
+ADDRFP4 4
+ADDRFP4 4
+INDIRI4
+ASGNI4
+ADDRFP4 8
+ADDRFP4 8
+INDIRI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 0
+ASGNI4
+ADDRLP4 84
+CNSTI4 100000
+ASGNI4
+ADDRLP4 88
+CNSTF4 1115684864
+ASGNF4
+ADDRLP4 72
+ADDRFP4 0
+INDIRI4
+ADDRLP4 84
+INDIRI4
+MODI4
+CVIF4 4
+ADDRLP4 88
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 76
+ADDRFP4 4
+INDIRI4
+ADDRLP4 84
+INDIRI4
+MODI4
+CVIF4 4
+ADDRLP4 88
+INDIRF4
+DIVF4
+ASGNF4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 92
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 92
+INDIRF4
+ARGF4
+ADDRLP4 96
+ADDRGP4 FloatBits
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 31
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 96
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 72
+INDIRF4
+NEGF4
+ARGF4
+ADDRLP4 100
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 100
+INDIRF4
+ARGF4
+ADDRLP4 104
+ADDRGP4 FloatBits
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 31
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 104
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 72
+INDIRF4
+ADDRLP4 72
+INDIRF4
+MULF4
+ARGF4
+ADDRLP4 112
+ADDRGP4 sqrt
+CALLF4
+ASGNF4
+ADDRLP4 112
+INDIRF4
+ARGF4
+ADDRLP4 116
+ADDRGP4 FloatBits
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 31
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 116
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 120
+ADDRGP4 sin
+CALLF4
+ASGNF4
+ADDRLP4 120
+INDIRF4
+ARGF4
+ADDRLP4 124
+ADDRGP4 FloatBits
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 31
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 124
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 128
+ADDRGP4 cos
+CALLF4
+ASGNF4
+ADDRLP4 128
+INDIRF4
+ARGF4
+ADDRLP4 132
+ADDRGP4 FloatBits
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 31
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 132
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 72
+INDIRF4
+ARGF4
+ADDRLP4 76
+INDIRF4
+ARGF4
+ADDRLP4 136
+ADDRGP4 atan2
+CALLF4
+ASGNF4
+ADDRLP4 136
+INDIRF4
+ARGF4
+ADDRLP4 140
+ADDRGP4 FloatBits
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 31
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 140
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 144
+CNSTI4 31
+ASGNI4
+ADDRLP4 80
+ADDRFP4 8
+INDIRI4
+CNSTI4 1
+BANDI4
+ADDRLP4 144
+INDIRI4
+LSHI4
+ASGNI4
+ADDRLP4 80
+INDIRF4
+ARGF4
+ADDRLP4 148
+ADDRGP4 floor
+CALLF4
+ASGNF4
+ADDRLP4 148
+INDIRF4
+ARGF4
+ADDRLP4 152
+ADDRGP4 FloatBits
+CALLI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 144
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 152
+INDIRI4
+ADDI4
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ARGI4
+ADDRLP4 156
+ADDRGP4 stackArg
+CALLI4
+ASGNI4
+ADDRLP4 0
+CNSTI4 31
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 156
+INDIRI4
+ADDI4
+ASGNI4
+ADDRLP4 8
+ARGP4
+ADDRFP4 8
+INDIRI4
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 160
+CNSTI4 15
+ASGNI4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 160
+INDIRI4
+BANDI4
+ADDRLP4 8
+ADDP4
+ARGP4
+ADDRFP4 4
+INDIRI4
+ARGI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 160
+INDIRI4
+BANDI4
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 40
+ARGP4
+CNSTI4 0
+ARGI4
+CNSTI4 32
+ARGI4
+ADDRGP4 memset
+CALLP4
+pop
+ADDRLP4 168
+CNSTI4 15
+ASGNI4
+ADDRFP4 4
+INDIRI4
+ADDRLP4 168
+INDIRI4
+BANDI4
+ADDRLP4 40
+ADDP4
+ARGP4
+ADDRFP4 8
+INDIRI4
+ADDRLP4 168
+INDIRI4
+BANDI4
+ADDRLP4 8
+ADDP4
+ARGP4
+ADDRFP4 0
+INDIRI4
+ADDRLP4 168
+INDIRI4
+BANDI4
+ARGI4
+ADDRGP4 memcpy
+CALLP4
+pop
+ADDRLP4 4
+CNSTI4 0
+ASGNI4
+ADDRGP4 $12
+JUMPV
+LABELV $9
+ADDRLP4 172
+CNSTI4 31
+ASGNI4
+ADDRLP4 0
+ADDRLP4 172
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 8
+ADDP4
+INDIRI1
+CVII4 1
+ADDI4
+ASGNI4
+ADDRLP4 0
+ADDRLP4 172
+INDIRI4
+ADDRLP4 0
+INDIRI4
+MULI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 40
+ADDP4
+INDIRI1
+CVII4 1
+ADDI4
+ASGNI4
+LABELV $10
+ADDRLP4 4
+ADDRLP4 4
+INDIRI4
+CNSTI4 1
+ADDI4
+ASGNI4
+LABELV $12
+ADDRLP4 4
+INDIRI4
+CVIU4 4
+CNSTU4 32
+LTU4 $9
+ADDRLP4 0
+INDIRI4
+RETI4
+LABELV $8
+endproc TestSystemCalls 180 12
+proc Random 8 0
+ADDRLP4 0
+ADDRGP4 seed
+ASGNP4
+ADDRLP4 0
+INDIRP4
+CNSTI4 1103515245
+ADDRLP4 0
+INDIRP4
+INDIRI4
+MULI4
+CNSTI4 12345
+ADDI4
+ASGNI4
+ADDRLP4 4
+ADDRLP4 0
+INDIRP4
+INDIRI4
+ASGNI4
+ADDRLP4 4
+INDIRI4
+ADDRLP4 4
+INDIRI4
+CNSTI4 16
+RSHI4
+BXORI4
+RETI4
+LABELV $13
+endproc Random 8 0
+bss
+align 4
+LABELV seed
+skip 4
+import stackArg
+import floor
+import sqrt
+import atan2
+import cos
+import sin
+import memcpy
+import memset
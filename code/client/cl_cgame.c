@@ -382,6 +382,137 @@ void CL_CM_LoadMap( const char *mapname ) {
 	CM_LoadMap( mapname, qtrue, &checksum );
 }
 
+/*
+====================
+ASSET READAHEAD
+
+The models and sounds named in the configstrings are read into the
+page cache on the job threads while the cgame registers them one by
+one. Parsing stays on the main thread, there is nothing to decode in
+wav and md3 files. Only a few files are open at a time, the next one
+is opened when the cgame registers something and a read has finished.
+====================
+*/
+
+#define	MAX_READAHEAD		( MAX_MODELS + MAX_SOUNDS )
+#define	READAHEAD_FILES		16		// reads in flight
+
+typedef struct {
+	backgroundRead_t	read;
+	job_t				job;
+	qboolean			active;
+} readahead_t;
+
+static readahead_t	cl_readahead[READAHEAD_FILES];
+static int			cl_readaheadStrings[MAX_READAHEAD];	// configstring numbers
+static int			cl_numReadahead;
+static int			cl_nextReadahead;
+
+static void CL_ReadaheadJob( void *data ) {
+	readahead_t	*r = data;
+
+	FS_BackgroundRead( &r->read, NULL );
+}
+
+/*
+====================
+CL_QueueReadahead
+
+Opens the next files for the reads that have finished
+====================
+*/
+static void CL_QueueReadahead( void ) {
+	readahead_t	*r;
+	const char	*name;
+	int			i;
+
+	for ( i = 0 ; i < READAHEAD_FILES ; i++ ) {
+		r = &cl_readahead[i];
+		if ( r->active ) {
+			if ( r->job.state != JOB_DONE ) {
+				continue;
+			}
+			r->active = qfalse;
+		}
+
+		while ( cl_nextReadahead < cl_numReadahead ) {
+			name = cl.gameState.stringData + cl.gameState.stringOffsets[cl_readaheadStrings[cl_nextReadahead++]];
+			if ( FS_OpenBackgroundRead( name, &r->read ) < 0 ) {
+				continue;
+			}
+			if ( !r->read.data && !r->read.fp ) {
+				FS_CloseBackgroundRead( &r->read );
+				continue;
+			}
+
+			r->job.function = CL_ReadaheadJob;
+			r->job.data = r;
+			if ( !Sys_AddJob( &r->job ) ) {
+				FS_CloseBackgroundRead( &r->read );
+				cl_nextReadahead = cl_numReadahead;
+				break;
+			}
+			r->active = qtrue;
+			break;
+		}
+	}
+}
+
+static void CL_AddReadahead( int index ) {
+	const char	*name;
+
+	name = cl.gameState.stringData + cl.gameState.stringOffsets[index];
+	if ( !name[0] || name[0] == '*' || cl_numReadahead == MAX_READAHEAD ) {
+		return;
+	}
+	cl_readaheadStrings[cl_numReadahead++] = index;
+}
+
+/*
+====================
+CL_StartReadahead
+====================
+*/
+static void CL_StartReadahead( void ) {
+	int		i;
+
+	if ( !Sys_NumJobThreads() ) {
+		return;
+	}
+
+	for ( i = 1 ; i < MAX_MODELS ; i++ ) {
+		CL_AddReadahead( CS_MODELS + i );
+	}
+	for ( i = 1 ; i < MAX_SOUNDS ; i++ ) {
+		CL_AddReadahead( CS_SOUNDS + i );
+	}
+
+	CL_QueueReadahead();
+}
+
+/*
+====================
+CL_StopReadahead
+
+Drops what the cgame got to before the threads did
+====================
+*/
+static void CL_StopReadahead( void ) {
+	int		i;
+
+	for ( i = 0 ; i < READAHEAD_FILES ; i++ ) {
+		if ( !cl_readahead[i].active ) {
+			continue;
+		}
+		if ( Sys_CancelJob( &cl_readahead[i].job ) ) {
+			FS_CloseBackgroundRead( &cl_readahead[i].read );
+		}
+		cl_readahead[i].active = qfalse;
+	}
+	cl_numReadahead = 0;
+	cl_nextReadahead = 0;
+}
+
 /*
 ====================
 CL_ShutdonwCGame
@@ -390,6 +521,7 @@ CL_ShutdonwCGame
 */
 void CL_ShutdownCGame( void ) {
 	Key_SetCatcher( Key_GetCatcher( ) & ~KEYCATCH_CGAME );
+	CL_StopReadahead();
 	cls.cgameStarted = qfalse;
 	if ( !cgvm ) {
 		return;
@@ -529,6 +661,7 @@ intptr_t CL_CgameSystemCalls( intptr_t *args ) {
 		S_Respatialize( args[1], VMA(2), VMA(3), args[4] );
 		return 0;
 	case CG_S_REGISTERSOUND:
+		CL_QueueReadahead();
 		return S_RegisterSound( VMA(1), args[2] );
 	case CG_S_STARTBACKGROUNDTRACK:
 		S_StartBackgroundTrack( VMA(1), VMA(2) );
@@ -537,6 +670,7 @@ intptr_t CL_CgameSystemCalls( intptr_t *args ) {
 		re.LoadWorld( VMA(1) );
 		return 0; 
 	case CG_R_REGISTERMODEL:
+		CL_QueueReadahead();
 		return re.RegisterModel( VMA(1) );
 	case CG_R_REGISTERSKIN:
 		return re.RegisterSkin( VMA(1) );
@@ -633,7 +767,7 @@ intptr_t CL_CgameSystemCalls( intptr_t *args ) {
 	case CG_SQRT:
 		return FloatAsInt( sqrt( VMF(1) ) );
 	case CG_FLOOR:
-		return FloatAsInt( floor( VMF(1) ) );
+		return FloatAsInt( VM_Floor( VMF(1) ) );
 	case CG_CEIL:
 		return FloatAsInt( ceil( VMF(1) ) );
 	case CG_ACOS:
@@ -704,6 +838,18 @@ intptr_t CL_CgameSystemCalls( intptr_t *args ) {
 	return 0;
 }
 
+// system calls compiled cgame code handles without CL_CgameSystemCalls
+static const vmFastSyscall_t cl_cgameFastSyscalls[] = {
+	{ CG_MEMSET,	VMSC_MEMSET },
+	{ CG_MEMCPY,	VMSC_MEMCPY },
+	{ CG_SIN,		VMSC_SIN },
+	{ CG_COS,		VMSC_COS },
+	{ CG_ATAN2,		VMSC_ATAN2 },
+	{ CG_SQRT,		VMSC_SQRT },
+	{ CG_FLOOR,		VMSC_FLOOR },
+	{ 0,			VMSC_NONE }
+};
+
 
 /*
 ====================
@@ -728,6 +874,11 @@ void CL_InitCGame( void ) {
 	mapname = Info_ValueForKey( info, "mapname" );
 	Com_sprintf( cl.mapname, sizeof( cl.mapname ), "maps/%s.bsp", mapname );
 
+	// a listen server started recording the load in SV_SpawnServer
+	if ( !com_sv_running->integer ) {
+		FS_BeginMapLoad( mapname );
+	}
+
 	// load the dll or bytecode
 	if ( cl_connectedToPureServer != 0 ) {
 		// if sv_pure is set we only allow qvms to be loaded
@@ -736,17 +887,21 @@ void CL_InitCGame( void ) {
 	else {
 		interpret = Cvar_VariableValue( "vm_cgame" );
 	}
-	cgvm = VM_Create( "cgame", CL_CgameSystemCalls, interpret );
+	cgvm = VM_Create( "cgame", CL_CgameSystemCalls, cl_cgameFastSyscalls, interpret );
 	if ( !cgvm ) {
 		Com_Error( ERR_DROP, "VM_Create on cgame failed" );
 	}
 	cls.state = CA_LOADING;
 
+	CL_StartReadahead();
+
 	// init for this gamestate
 	// use the lastExecutedServerCommand instead of the serverCommandSequence
 	// otherwise server commands sent just before a gamestate are dropped
 	VM_Call( cgvm, CG_INIT, clc.serverMessageSequence, clc.lastExecutedServerCommand, clc.clientNum );
 
+	CL_StopReadahead();
+
 	// reset any CVAR_CHEAT cvars registered by cgame
 	if ( !clc.demoplaying && !cl_connectedToCheatServer )
 		Cvar_SetCheatState();
@@ -763,6 +918,8 @@ void CL_InitCGame( void ) {
 	// on the card even if the driver does deferred loading
 	re.EndRegistration();
 
+	FS_EndMapLoad();
+
 	// make sure everything is paged in
 	if (!Sys_LowPhysicalMemory()) {
 		Com_TouchMemory();
@@ -1062,6 +1219,7 @@ void CL_SetCGameTime( void ) {
 			clc.timeDemoStart = clc.timeDemoLastFrame = now;
 			clc.timeDemoMinDuration = INT_MAX;
 			clc.timeDemoMaxDuration = 0;
+			re.PhaseTimes( qfalse );
 		}
 
 		frameDuration = now - clc.timeDemoLastFrame;
@@ -1216,7 +1216,7 @@ void CL_KeyEvent (int key, qboolean down, unsigned time) {
 	if ( down && ( key < 128 || key == K_MOUSE1 ) &&
 		( clc.demoplaying || cls.state == CA_CINEMATIC ) && Key_GetCatcher( ) == 0 ) {
 
-		if (Cvar_VariableValue ("com_cameraMode") == 0) {
+		if ( !com_cameraMode->integer ) {
 			Cvar_Set ("nextdemo","");
 			key = K_ESCAPE;
 		}
@@ -98,6 +98,10 @@ cvar_t	*cl_guidServerUniq;
 
 cvar_t	*cl_consoleKeys;
 
+// owned by the game and ui modules, but checked every frame
+cvarRef_t	cl_gametype = { "g_gametype" };
+cvarRef_t	cl_singlePlayerActive = { "ui_singlePlayerActive" };
+
 clientActive_t		cl;
 clientConnection_t	clc;
 clientStatic_t		cls;
@@ -221,7 +225,7 @@ void CL_Voip_f( void )
 		reason = "Speex not initialized";
 	else if (!cl_connectedToVoipServer)
 		reason = "Server doesn't support VoIP";
-	else if ( Cvar_VariableValue( "g_gametype" ) == GT_SINGLE_PLAYER || Cvar_VariableValue("ui_singlePlayerActive"))
+	else if ( Cvar_RefInteger( &cl_gametype ) == GT_SINGLE_PLAYER || Cvar_RefValue( &cl_singlePlayerActive ))
 		reason = "running in single-player mode";
 
 	if (reason != NULL) {
@@ -301,7 +305,7 @@ void CL_CaptureVoip(void)
 			dontCapture = qtrue;  // not connected to a server.
 		else if (!cl_connectedToVoipServer)
 			dontCapture = qtrue;  // server doesn't support VoIP.
-		else if ( Cvar_VariableValue( "g_gametype" ) == GT_SINGLE_PLAYER || Cvar_VariableValue("ui_singlePlayerActive"))
+		else if ( Cvar_RefInteger( &cl_gametype ) == GT_SINGLE_PLAYER || Cvar_RefValue( &cl_singlePlayerActive ))
 			dontCapture = qtrue;  // single player game.
 		else if (clc.demoplaying)
 			dontCapture = qtrue;  // playing back a demo.
@@ -756,6 +760,7 @@ void CL_DemoCompleted( void )
 					clc.timeDemoMaxDuration,
 					CL_DemoFrameDurationSDev( ) );
 			Com_Printf( "%s", buffer );
+			re.PhaseTimes( qtrue );
 
 			// Write a log of all the frame durations
 			if( cl_timedemoLog && strlen( cl_timedemoLog->string ) > 0 )
@@ -2839,18 +2844,20 @@ void CL_InitRef( void ) {
 	ri.Printf = CL_RefPrintf;
 	ri.Error = Com_Error;
 	ri.Milliseconds = CL_ScaledMilliseconds;
+	ri.Microseconds = Sys_Microseconds;
 	ri.Malloc = CL_RefMalloc;
 	ri.Free = Z_Free;
-#ifdef HUNK_DEBUG
-	ri.Hunk_AllocDebug = Hunk_AllocDebug;
-#else
-	ri.Hunk_Alloc = Hunk_Alloc;
-#endif
+	ri.Hunk_AllocLabel = Hunk_AllocLabel;
 	ri.Hunk_AllocateTempMemory = Hunk_AllocateTempMemory;
 	ri.Hunk_FreeTempMemory = Hunk_FreeTempMemory;
 	ri.CM_DrawDebugSurface = CM_DrawDebugSurface;
 	ri.FS_ReadFile = FS_ReadFile;
 	ri.FS_FreeFile = FS_FreeFile;
+	ri.FS_MapFile = FS_MapFile;
+	ri.FS_FreeMappedFile = FS_FreeMappedFile;
+	ri.FS_OpenBackgroundRead = FS_OpenBackgroundRead;
+	ri.FS_BackgroundRead = FS_BackgroundRead;
+	ri.FS_CloseBackgroundRead = FS_CloseBackgroundRead;
 	ri.FS_WriteFile = FS_WriteFile;
 	ri.FS_FreeFileList = FS_FreeFileList;
 	ri.FS_ListFiles = FS_ListFiles;
@@ -2868,6 +2875,11 @@ void CL_InitRef( void ) {
   
 	ri.CL_WriteAVIVideoFrame = CL_WriteAVIVideoFrame;
 
+	ri.NumJobThreads = Sys_NumJobThreads;
+	ri.AddJob = Sys_AddJob;
+	ri.FinishJob = Sys_FinishJob;
+	ri.CancelJob = Sys_CancelJob;
+
 	ret = GetRefAPI( REF_API_VERSION, &ri );
 
 #if defined __USEA3D && defined __A3D_GEOM
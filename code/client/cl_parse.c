@@ -321,6 +321,8 @@ void CL_ParseSnapshot( msg_t *msg ) {
 		cl.snap.deltaNum, cl.snap.ping );
 	}
 
+	Com_JournalChecksum( &cl.snap.ps, sizeof( cl.snap.ps ) );
+
 	cl.newSnapshots = qtrue;
 }
 
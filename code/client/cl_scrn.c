@@ -31,6 +31,8 @@ cvar_t		*cl_graphheight;
 cvar_t		*cl_graphscale;
 cvar_t		*cl_graphshift;
 
+static cvarRef_t	scr_anaglyphMode = { "r_anaglyphMode" };
+
 /*
 ================
 SCR_DrawNamedPic
@@ -362,7 +364,7 @@ void SCR_DrawVoipMeter( void ) {
 		return;  // not connected to a server.
 	else if (!cl_connectedToVoipServer)
 		return;  // server doesn't support VoIP.
-	else if ( Cvar_VariableValue( "g_gametype" ) == GT_SINGLE_PLAYER || Cvar_VariableValue("ui_singlePlayerActive"))
+	else if ( Cvar_RefInteger( &cl_gametype ) == GT_SINGLE_PLAYER || Cvar_RefValue( &cl_singlePlayerActive ))
 		return;  // single player game.
 	else if (clc.demoplaying)
 		return;  // playing back a demo.
@@ -576,7 +578,7 @@ void SCR_UpdateScreen( void ) {
 	if( uivm || com_dedicated->integer )
 	{
 		// if running in stereo, we need to draw the frame twice
-		if ( cls.glconfig.stereoEnabled || Cvar_VariableIntegerValue("r_anaglyphMode")) {
+		if ( cls.glconfig.stereoEnabled || Cvar_RefInteger( &scr_anaglyphMode )) {
 			SCR_DrawScreenField( STEREO_LEFT );
 			SCR_DrawScreenField( STEREO_RIGHT );
 		} else {
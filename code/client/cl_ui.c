@@ -1005,7 +1005,7 @@ intptr_t CL_UISystemCalls( intptr_t *args ) {
 		return FloatAsInt( sqrt( VMF(1) ) );
 
 	case UI_FLOOR:
-		return FloatAsInt( floor( VMF(1) ) );
+		return FloatAsInt( VM_Floor( VMF(1) ) );
 
 	case UI_CEIL:
 		return FloatAsInt( ceil( VMF(1) ) );
@@ -1068,6 +1068,18 @@ intptr_t CL_UISystemCalls( intptr_t *args ) {
 	return 0;
 }
 
+// system calls compiled ui code handles without CL_UISystemCalls
+static const vmFastSyscall_t cl_uiFastSyscalls[] = {
+	{ UI_MEMSET,	VMSC_MEMSET },
+	{ UI_MEMCPY,	VMSC_MEMCPY },
+	{ UI_SIN,		VMSC_SIN },
+	{ UI_COS,		VMSC_COS },
+	{ UI_ATAN2,		VMSC_ATAN2 },
+	{ UI_SQRT,		VMSC_SQRT },
+	{ UI_FLOOR,		VMSC_FLOOR },
+	{ 0,			VMSC_NONE }
+};
+
 /*
 ====================
 CL_ShutdownUI
@@ -1103,7 +1115,7 @@ void CL_InitUI( void ) {
 	else {
 		interpret = Cvar_VariableValue( "vm_ui" );
 	}
-	uivm = VM_Create( "ui", CL_UISystemCalls, interpret );
+	uivm = VM_Create( "ui", CL_UISystemCalls, cl_uiFastSyscalls, interpret );
 	if ( !uivm ) {
 		Com_Error( ERR_FATAL, "VM_Create on UI failed" );
 	}
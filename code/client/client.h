@@ -388,6 +388,8 @@ extern	cvar_t	*m_side;
 extern	cvar_t	*m_filter;
 
 extern	cvar_t	*cl_timedemo;
+extern	cvarRef_t	cl_gametype;
+extern	cvarRef_t	cl_singlePlayerActive;
 extern	cvar_t	*cl_aviFrameRate;
 extern	cvar_t	*cl_aviMotionJpeg;
 
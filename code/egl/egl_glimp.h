@@ -51,8 +51,24 @@ void GLimp_SetGamma(unsigned char red[256], unsigned char green[256],
 qboolean GLimp_SpawnRenderThread(void (*function) (void));
 void GLimp_FrontEndSleep(void);
 void *GLimp_RendererSleep(void);
-void GLimp_RenderThreadWrapper(void *data);
 void GLimp_WakeRenderer(void *data);
+void GLimp_SetCurrentContext(qboolean current);
+
+/*
+ * egl_state.c filters the qgl* calls for these, the backend
+ * implements them.
+ */
+void glimp_enable(GLenum cap);
+void glimp_disable(GLenum cap);
+void glimp_blend_func(GLenum sfactor, GLenum dfactor);
+void glimp_depth_func(GLenum func);
+void glimp_active_texture(GLenum texture);
+void glimp_bind_texture(GLenum target, GLuint texture);
+void glimp_tex_parameteri(GLenum target, GLenum pname, GLint param);
+void glimp_delete_textures(GLsizei n, const GLuint *textures);
+
+void egl_state_reset(void);
+GLint egl_state_texture_parameter(GLuint texture, GLenum pname);
 
 #define WINDOW_CLASS_NAME	"Quake III: Arena"
 
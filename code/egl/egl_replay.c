@@ -0,0 +1,575 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+/*
+ * Replays a trace recorded with r_glTrace through the qgl calls of the
+ * backend this is linked with, and reports the CPU time each frame
+ * took.
+ *
+ *	glreplay [-q] <trace>
+ *	glreplay-null [-q] <trace>
+ *
+ * glreplay is linked with the backend of the client it was built with,
+ * glreplay-null with null_glimp.c, so the difference between the two
+ * is what the driver costs and glreplay-null alone is the dispatch and
+ * state tracking overhead. -q only prints the totals.
+ */
+#include <stdint.h>
+#include <time.h>
+
+#include "../renderer/tr_local.h"
+#include "egl_trace.h"
+
+/* what the backends need from the rest of the game */
+refimport_t ri;
+glconfig_t glConfig;
+
+void (APIENTRY * qglMultiTexCoord2fARB) (GLenum texture, GLfloat s, GLfloat t);
+void (APIENTRY * qglActiveTextureARB) (GLenum texture);
+void (APIENTRY * qglClientActiveTextureARB) (GLenum texture);
+void (APIENTRY * qglLockArraysEXT) (GLint, GLint);
+void (APIENTRY * qglUnlockArraysEXT) (void);
+
+/* every cvar reads as "" and 0, so r_glTrace is off and r_mode unset */
+static cvar_t replay_cvar = { "", "" };
+
+cvar_t *r_mode = &replay_cvar;
+cvar_t *r_allowExtensions = &replay_cvar;
+cvar_t *r_ext_compressed_textures = &replay_cvar;
+cvar_t *r_ext_multitexture = &replay_cvar;
+
+qboolean
+R_GetModeInfo(int *width, int *height, float *windowAspect, int mode)
+{
+	return qfalse;
+}
+
+void
+IN_Init(void)
+{
+}
+
+void
+IN_Shutdown(void)
+{
+}
+
+static void QDECL
+replay_printf(int printLevel, const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	vprintf(fmt, ap);
+	va_end(ap);
+}
+
+static cvar_t *
+replay_cvar_get(const char *name, const char *value, int flags)
+{
+	return &replay_cvar;
+}
+
+static void
+replay_add_command(const char *name, void (*cmd)(void))
+{
+}
+
+static void
+replay_remove_command(const char *name)
+{
+}
+
+/* for q_shared.c */
+void QDECL
+Com_Printf(const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	vprintf(fmt, ap);
+	va_end(ap);
+}
+
+void QDECL
+Com_Error(int level, const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	vfprintf(stderr, fmt, ap);
+	va_end(ap);
+	exit(1);
+}
+
+/*
+ * The whole trace is read in up front, so the data of the records can
+ * be handed straight to the calls, and reading the file does not show
+ * up in the frame times.
+ */
+static unsigned int *replay_trace;
+static int replay_words;
+
+static int
+replay_load(const char *filename)
+{
+	FILE *file;
+	long size;
+
+	file = fopen(filename, "rb");
+	if (!file) {
+		fprintf(stderr, "Error: failed to open %s\n", filename);
+		return -1;
+	}
+
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	replay_trace = malloc(size);
+	if (!replay_trace) {
+		fprintf(stderr, "Error: no memory for %ld bytes of trace\n",
+			size);
+		fclose(file);
+		return -1;
+	}
+
+	if (fread(replay_trace, size, 1, file) != 1) {
+		fprintf(stderr, "Error: failed to read %s\n", filename);
+		fclose(file);
+		return -1;
+	}
+	fclose(file);
+
+	replay_words = size / 4;
+
+	if (replay_words < 2 || replay_trace[0] != TRACE_MAGIC) {
+		fprintf(stderr, "Error: %s is not a trace\n", filename);
+		return -1;
+	}
+
+	if (replay_trace[1] != TRACE_VERSION) {
+		fprintf(stderr, "Error: %s is version %d, not %d\n",
+			filename, replay_trace[1], TRACE_VERSION);
+		return -1;
+	}
+
+	return 0;
+}
+
+/*
+ * Buffer object names are handed out by the driver, so the ones in
+ * the trace are mapped to the ones we got.
+ */
+#define REPLAY_BUFFERS	16384
+
+static GLuint replay_buffers[REPLAY_BUFFERS];
+
+static GLuint
+replay_buffer(GLuint buffer)
+{
+	if (buffer < REPLAY_BUFFERS && replay_buffers[buffer])
+		return replay_buffers[buffer];
+	return buffer;
+}
+
+#define REPLAY_ARGS	12
+
+union replay_arg {
+	int i;
+	float f;
+	struct {
+		const void *data;
+		int size;
+	} d;
+};
+
+/*
+ * Returns the word after the record, or -1 if the record doesn't fit
+ * in the trace. Every word read is checked against the end of the
+ * record, which is checked against the end of the trace.
+ */
+static int
+replay_decode(int word, enum trace_call *call, union replay_arg *args)
+{
+	const char *format;
+	unsigned int size;
+	int start, end, i;
+
+	start = word;
+	if (replay_words - word < 2)
+		goto broken;
+
+	*call = replay_trace[word];
+	size = replay_trace[word + 1];
+	if (*call >= TRACE_CALL_COUNT ||
+	    size / 4 > (unsigned int) (replay_words - word - 2))
+		goto broken;
+	end = word + 2 + size / 4;
+	word += 2;
+
+	format = trace_calls[*call].format;
+	for (i = 0; format[i] && i < REPLAY_ARGS; i++) {
+		if (word >= end)
+			goto broken;
+
+		if (format[i] == 'd') {
+			size = replay_trace[word];
+			if (size / 4 + (size % 4 != 0) >
+			    (unsigned int) (end - word - 1))
+				goto broken;
+			args[i].d.size = size;
+			args[i].d.data = size ? &replay_trace[word + 1] : NULL;
+			word += 1 + size / 4 + (size % 4 != 0);
+		} else {
+			/* ints and floats are both just the word */
+			args[i].i = replay_trace[word];
+			word++;
+		}
+	}
+
+	return end;
+
+broken:
+	fprintf(stderr, "Error: broken record at word %d\n", start);
+	return -1;
+}
+
+/*
+ * Pointers into buffer objects were traced as offsets.
+ */
+static const GLvoid *
+replay_pointer(union replay_arg *offset, union replay_arg *data)
+{
+	if (data->d.data)
+		return data->d.data;
+	return (const GLvoid *) (intptr_t) offset->i;
+}
+
+static void
+replay_call(enum trace_call call, union replay_arg *a)
+{
+	static void *pixels;
+	static int pixels_size;
+	const GLuint *names;
+	int i;
+
+	switch (call) {
+	case TRACE_FRAME:
+		GLimp_EndFrame();
+		break;
+	case TRACE_ACTIVE_TEXTURE:
+		qglActiveTexture(a[0].i);
+		break;
+	case TRACE_ALPHA_FUNC:
+		qglAlphaFunc(a[0].i, a[1].f);
+		break;
+	case TRACE_BIND_BUFFER:
+		qglBindBuffer(a[0].i, replay_buffer(a[1].i));
+		break;
+	case TRACE_BIND_TEXTURE:
+		qglBindTexture(a[0].i, a[1].i);
+		break;
+	case TRACE_BLEND_FUNC:
+		qglBlendFunc(a[0].i, a[1].i);
+		break;
+	case TRACE_BUFFER_DATA:
+		qglBufferData(a[0].i, a[1].i, a[3].d.data, a[2].i);
+		break;
+	case TRACE_CLEAR:
+		qglClear(a[0].i);
+		break;
+	case TRACE_CLEAR_COLOR:
+		qglClearColor(a[0].f, a[1].f, a[2].f, a[3].f);
+		break;
+	case TRACE_CLEAR_DEPTH:
+		qglClearDepthf(a[0].f);
+		break;
+	case TRACE_CLEAR_STENCIL:
+		qglClearStencil(a[0].i);
+		break;
+	case TRACE_CLIENT_ACTIVE_TEXTURE:
+		qglClientActiveTexture(a[0].i);
+		break;
+	case TRACE_CLIP_PLANE:
+		qglClipPlanef(a[0].i, a[1].d.data);
+		break;
+	case TRACE_COLOR:
+		qglColor4f(a[0].f, a[1].f, a[2].f, a[3].f);
+		break;
+	case TRACE_COLOR_MASK:
+		qglColorMask(a[0].i, a[1].i, a[2].i, a[3].i);
+		break;
+	case TRACE_COLOR_POINTER:
+		qglColorPointer(a[0].i, a[1].i, a[2].i,
+				replay_pointer(&a[3], &a[4]));
+		break;
+	case TRACE_CULL_FACE:
+		qglCullFace(a[0].i);
+		break;
+	case TRACE_DELETE_BUFFERS:
+		names = a[0].d.data;
+		for (i = 0; i < a[0].d.size / 4; i++) {
+			GLuint buffer = replay_buffer(names[i]);
+
+			qglDeleteBuffers(1, &buffer);
+			if (names[i] < REPLAY_BUFFERS)
+				replay_buffers[names[i]] = 0;
+		}
+		break;
+	case TRACE_DELETE_TEXTURES:
+		qglDeleteTextures(a[0].d.size / 4, a[0].d.data);
+		break;
+	case TRACE_DEPTH_FUNC:
+		qglDepthFunc(a[0].i);
+		break;
+	case TRACE_DEPTH_MASK:
+		qglDepthMask(a[0].i);
+		break;
+	case TRACE_DEPTH_RANGE:
+		qglDepthRangef(a[0].f, a[1].f);
+		break;
+	case TRACE_DISABLE:
+		qglDisable(a[0].i);
+		break;
+	case TRACE_DISABLE_CLIENT_STATE:
+		qglDisableClientState(a[0].i);
+		break;
+	case TRACE_DRAW_ARRAYS:
+		qglDrawArrays(a[0].i, a[1].i, a[2].i);
+		break;
+	case TRACE_DRAW_BUFFER:
+		qglDrawBuffer(a[0].i);
+		break;
+	case TRACE_DRAW_ELEMENTS:
+		qglDrawElements(a[0].i, a[1].i, a[2].i,
+				replay_pointer(&a[3], &a[4]));
+		break;
+	case TRACE_ENABLE:
+		qglEnable(a[0].i);
+		break;
+	case TRACE_ENABLE_CLIENT_STATE:
+		qglEnableClientState(a[0].i);
+		break;
+	case TRACE_FINISH:
+		qglFinish();
+		break;
+	case TRACE_FLUSH:
+		qglFlush();
+		break;
+	case TRACE_GEN_BUFFERS:
+		names = a[0].d.data;
+		for (i = 0; i < a[0].d.size / 4; i++) {
+			GLuint buffer;
+
+			qglGenBuffers(1, &buffer);
+			if (names[i] < REPLAY_BUFFERS)
+				replay_buffers[names[i]] = buffer;
+		}
+		break;
+	case TRACE_LINE_WIDTH:
+		qglLineWidth(a[0].f);
+		break;
+	case TRACE_LOAD_IDENTITY:
+		qglLoadIdentity();
+		break;
+	case TRACE_LOAD_MATRIX:
+		qglLoadMatrixf(a[0].d.data);
+		break;
+	case TRACE_LOCK_ARRAYS:
+		qglLockArrays(a[0].i, a[1].i);
+		break;
+	case TRACE_MATERIAL:
+		qglMaterialf(a[0].i, a[1].i, a[2].f);
+		break;
+	case TRACE_MATRIX_MODE:
+		qglMatrixMode(a[0].i);
+		break;
+	case TRACE_MULTI_TEX_COORD:
+		qglMultiTexCoord4f(a[0].i, a[1].f, a[2].f, a[3].f, a[4].f);
+		break;
+	case TRACE_NORMAL_POINTER:
+		qglNormalPointer(a[1].i, a[2].i, replay_pointer(&a[3], &a[4]));
+		break;
+	case TRACE_NUM_VERTICES:
+		qglNumVertices(a[0].i);
+		break;
+	case TRACE_ORTHO:
+		qglOrthof(a[0].f, a[1].f, a[2].f, a[3].f, a[4].f, a[5].f);
+		break;
+	case TRACE_POLYGON_OFFSET:
+		qglPolygonOffset(a[0].f, a[1].f);
+		break;
+	case TRACE_POP_MATRIX:
+		qglPopMatrix();
+		break;
+	case TRACE_PUSH_MATRIX:
+		qglPushMatrix();
+		break;
+	case TRACE_READ_PIXELS:
+		if (a[2].i * a[3].i * 4 > pixels_size) {
+			pixels_size = a[2].i * a[3].i * 4;
+			pixels = realloc(pixels, pixels_size);
+		}
+		qglReadPixels(a[0].i, a[1].i, a[2].i, a[3].i, a[4].i, a[5].i,
+			      pixels);
+		break;
+	case TRACE_SCISSOR:
+		qglScissor(a[0].i, a[1].i, a[2].i, a[3].i);
+		break;
+	case TRACE_SHADE_MODEL:
+		qglShadeModel(a[0].i);
+		break;
+	case TRACE_STENCIL_FUNC:
+		qglStencilFunc(a[0].i, a[1].i, a[2].i);
+		break;
+	case TRACE_STENCIL_MASK:
+		qglStencilMask(a[0].i);
+		break;
+	case TRACE_STENCIL_OP:
+		qglStencilOp(a[0].i, a[1].i, a[2].i);
+		break;
+	case TRACE_TEX_COORD_POINTER:
+		qglTexCoordPointer(a[0].i, a[1].i, a[2].i,
+				   replay_pointer(&a[3], &a[4]));
+		break;
+	case TRACE_TEX_ENVF:
+		qglTexEnvf(a[0].i, a[1].i, a[2].f);
+		break;
+	case TRACE_TEX_ENVI:
+		qglTexEnvi(a[0].i, a[1].i, a[2].i);
+		break;
+	case TRACE_TEX_IMAGE_2D:
+		qglTexImage2D(a[0].i, a[1].i, a[2].i, a[3].i, a[4].i, a[5].i,
+			      a[6].i, a[7].i, a[8].d.data);
+		break;
+	case TRACE_TEX_PARAMETERI:
+		qglTexParameteri(a[0].i, a[1].i, a[2].i);
+		break;
+	case TRACE_TEX_SUB_IMAGE_2D:
+		qglTexSubImage2D(a[0].i, a[1].i, a[2].i, a[3].i, a[4].i,
+				 a[5].i, a[6].i, a[7].i, a[8].d.data);
+		break;
+	case TRACE_TRANSLATE:
+		qglTranslatef(a[0].f, a[1].f, a[2].f);
+		break;
+	case TRACE_UNLOCK_ARRAYS:
+		qglUnlockArrays();
+		break;
+	case TRACE_VERTEX_POINTER:
+		qglVertexPointer(a[0].i, a[1].i, a[2].i,
+				 replay_pointer(&a[3], &a[4]));
+		break;
+	case TRACE_VIEWPORT:
+		qglViewport(a[0].i, a[1].i, a[2].i, a[3].i);
+		break;
+	default:
+		break;
+	}
+}
+
+static double
+replay_milliseconds(clockid_t clock)
+{
+	struct timespec ts;
+
+	clock_gettime(clock, &ts);
+	return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+int
+main(int argc, char *argv[])
+{
+	union replay_arg args[REPLAY_ARGS];
+	enum trace_call call;
+	const char *filename = NULL;
+	int quiet = 0;
+	int word, frames = 0, calls = 0;
+	double cpu_start, wall_start, cpu, wall;
+	double cpu_total = 0, wall_total = 0, cpu_min = 0, cpu_max = 0;
+	int i;
+
+	for (i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-q"))
+			quiet = 1;
+		else
+			filename = argv[i];
+	}
+
+	if (!filename) {
+		fprintf(stderr, "Usage: %s [-q] <trace>\n", argv[0]);
+		return 1;
+	}
+
+	if (replay_load(filename))
+		return 1;
+
+	ri.Printf = replay_printf;
+	ri.Cvar_Get = replay_cvar_get;
+	ri.Cmd_AddCommand = replay_add_command;
+	ri.Cmd_RemoveCommand = replay_remove_command;
+	GLimp_Init();
+
+	cpu_start = replay_milliseconds(CLOCK_PROCESS_CPUTIME_ID);
+	wall_start = replay_milliseconds(CLOCK_MONOTONIC);
+
+	for (word = 2; word < replay_words; ) {
+		word = replay_decode(word, &call, args);
+		if (word < 0)
+			break;
+
+		calls++;
+
+		replay_call(call, args);
+
+		if (call != TRACE_FRAME)
+			continue;
+
+		cpu = replay_milliseconds(CLOCK_PROCESS_CPUTIME_ID) - cpu_start;
+		wall = replay_milliseconds(CLOCK_MONOTONIC) - wall_start;
+
+		if (!quiet)
+			printf("frame %5d: %6d calls %8.3fms cpu %8.3fms\n",
+			       frames, calls, cpu, wall);
+
+		if (!frames || cpu < cpu_min)
+			cpu_min = cpu;
+		if (!frames || cpu > cpu_max)
+			cpu_max = cpu;
+		cpu_total += cpu;
+		wall_total += wall;
+		frames++;
+		calls = 0;
+
+		cpu_start = replay_milliseconds(CLOCK_PROCESS_CPUTIME_ID);
+		wall_start = replay_milliseconds(CLOCK_MONOTONIC);
+	}
+
+	if (frames)
+		printf("%d frames, cpu %.3fms average, %.3fms min, %.3fms max, "
+		       "%.3fms per frame\n", frames, cpu_total / frames,
+		       cpu_min, cpu_max, wall_total / frames);
+
+	GLimp_Shutdown();
+
+	return 0;
+}
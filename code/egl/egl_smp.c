@@ -0,0 +1,218 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+#include "../sys/sys_local.h"
+#include "../qcommon/q_shared.h"
+#include "egl_glimp.h"
+#include "../client/client.h"
+#include "../renderer/tr_local.h"
+
+#ifdef SMP
+/*
+===========================================================
+
+SMP acceleration
+
+The same handshake as the SDL backend, on pthreads. The context
+follows whoever is allowed to draw: the render thread owns it
+between GLimp_WakeRenderer and GLimp_RendererSleep, the front end
+gets it back in GLimp_FrontEndSleep so it can upload between
+frames. Each backend provides GLimp_SetCurrentContext.
+
+===========================================================
+*/
+
+#include <pthread.h>
+
+static pthread_mutex_t	smpMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t	renderCommandsEvent = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t	renderCompletedEvent = PTHREAD_COND_INITIALIZER;
+static void				(*glimpRenderThread)( void ) = NULL;
+static pthread_t		renderThread;
+static qboolean			renderThreadRunning = qfalse;
+
+static void				*smpData = NULL;
+static qboolean			smpDataReady;
+
+/*
+===============
+GLimp_RenderThreadWrapper
+===============
+*/
+static void *GLimp_RenderThreadWrapper( void *arg )
+{
+	Com_Printf( "Render thread starting\n" );
+
+	glimpRenderThread();
+
+	GLimp_SetCurrentContext( qfalse );
+
+	Com_Printf( "Render thread terminating\n" );
+
+	return NULL;
+}
+
+/*
+===============
+GLimp_SpawnRenderThread
+===============
+*/
+qboolean GLimp_SpawnRenderThread( void (*function)( void ) )
+{
+	int		ret;
+
+	if ( renderThreadRunning ) {
+		Com_Printf( "Already a render thread? Trying to clean it up...\n" );
+		GLimp_WakeRenderer( NULL );
+	}
+
+	smpData = NULL;
+	smpDataReady = qfalse;
+
+	// the front end keeps drawing until it hands the first frame over
+	glimpRenderThread = function;
+	ret = pthread_create( &renderThread, NULL, GLimp_RenderThreadWrapper, NULL );
+	if ( ret ) {
+		ri.Printf( PRINT_ALL, "pthread_create returned %d: %s\n", ret, strerror( ret ) );
+		glimpRenderThread = NULL;
+		return qfalse;
+	}
+	renderThreadRunning = qtrue;
+
+	return qtrue;
+}
+
+/*
+===============
+GLimp_RendererSleep
+===============
+*/
+void *GLimp_RendererSleep( void )
+{
+	void	*data;
+
+	GLimp_SetCurrentContext( qfalse );
+
+	pthread_mutex_lock( &smpMutex );
+	{
+		// data that was taken but is still set is the frame just
+		// rendered, data that is ready was handed over before the
+		// thread first got here
+		if ( !smpDataReady ) {
+			smpData = NULL;
+
+			// after this, the front end can exit GLimp_FrontEndSleep
+			pthread_cond_signal( &renderCompletedEvent );
+		}
+
+		while ( !smpDataReady ) {
+			pthread_cond_wait( &renderCommandsEvent, &smpMutex );
+		}
+
+		data = smpData;
+		smpDataReady = qfalse;
+	}
+	pthread_mutex_unlock( &smpMutex );
+
+	if ( data ) {
+		GLimp_SetCurrentContext( qtrue );
+	}
+
+	return data;
+}
+
+/*
+===============
+GLimp_FrontEndSleep
+===============
+*/
+void GLimp_FrontEndSleep( void )
+{
+	pthread_mutex_lock( &smpMutex );
+	{
+		while ( smpData ) {
+			pthread_cond_wait( &renderCompletedEvent, &smpMutex );
+		}
+	}
+	pthread_mutex_unlock( &smpMutex );
+
+	GLimp_SetCurrentContext( qtrue );
+}
+
+/*
+===============
+GLimp_WakeRenderer
+
+A NULL data makes the render thread exit, it is waited for so
+the front end has the context back for the shutdown
+===============
+*/
+void GLimp_WakeRenderer( void *data )
+{
+	if ( !renderThreadRunning ) {
+		return;
+	}
+
+	GLimp_SetCurrentContext( qfalse );
+
+	pthread_mutex_lock( &smpMutex );
+	{
+		assert( smpData == NULL );
+		smpData = data;
+		smpDataReady = qtrue;
+
+		// after this, the renderer can continue through GLimp_RendererSleep
+		pthread_cond_signal( &renderCommandsEvent );
+	}
+	pthread_mutex_unlock( &smpMutex );
+
+	if ( !data ) {
+		pthread_join( renderThread, NULL );
+		renderThreadRunning = qfalse;
+		glimpRenderThread = NULL;
+		GLimp_SetCurrentContext( qtrue );
+	}
+}
+
+#else
+
+// No SMP - stubs
+qboolean GLimp_SpawnRenderThread( void (*function)( void ) )
+{
+	ri.Printf( PRINT_WARNING, "ERROR: SMP support was disabled at compile time\n");
+	return qfalse;
+}
+
+void *GLimp_RendererSleep( void )
+{
+	return NULL;
+}
+
+void GLimp_FrontEndSleep( void )
+{
+}
+
+void GLimp_WakeRenderer( void *data )
+{
+}
+
+#endif
@@ -0,0 +1,311 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+#include "../qcommon/q_shared.h"
+#include "egl_glimp.h"
+#include "qgl.h"
+
+/*
+ * Redundant state filtering.
+ *
+ * The qgl* entry points for the state the renderer sets most often
+ * live here, in front of the glimp_* ones of whichever backend is
+ * built. A call that sets what is already set is dropped before it
+ * gets to the backend, where it would cost a driver or limare state
+ * update. The backends call egl_state_reset() whenever the context
+ * state is not what we think it is anymore.
+ *
+ * Only texture names below STATE_TEXTURES have their parameters
+ * tracked, which covers everything tr_image.c creates.
+ */
+#define STATE_UNITS		2
+#define STATE_TEXTURES		4096
+#define STATE_UNKNOWN		-1
+
+enum {
+	STATE_MIN_FILTER,
+	STATE_MAG_FILTER,
+	STATE_WRAP_S,
+	STATE_WRAP_T,
+	STATE_PARAMETERS
+};
+
+/* the capabilities that are tracked, GL_TEXTURE_2D is per unit */
+static const GLenum state_caps[] = {
+	GL_ALPHA_TEST,
+	GL_BLEND,
+	GL_CLIP_PLANE0,
+	GL_CULL_FACE,
+	GL_DEPTH_TEST,
+	GL_POLYGON_OFFSET_FILL,
+	GL_SCISSOR_TEST,
+	GL_STENCIL_TEST,
+};
+
+#define STATE_CAPS	((int) (sizeof(state_caps) / sizeof(state_caps[0])))
+
+static int state_enabled[STATE_CAPS];
+static int state_texture_enabled[STATE_UNITS];
+
+static GLenum state_blend_src, state_blend_dst;
+static GLenum state_depth_func;
+
+static int state_unit;
+static GLint state_bound[STATE_UNITS];
+static GLint state_parameters[STATE_TEXTURES][STATE_PARAMETERS];
+
+static int state_forwarded;
+static int state_dropped;
+
+void
+egl_state_reset(void)
+{
+	int i;
+
+	for (i = 0; i < STATE_CAPS; i++)
+		state_enabled[i] = STATE_UNKNOWN;
+	for (i = 0; i < STATE_UNITS; i++) {
+		state_texture_enabled[i] = STATE_UNKNOWN;
+		state_bound[i] = STATE_UNKNOWN;
+	}
+
+	/* none of these are valid values */
+	state_blend_src = 0xFFFFFFFF;
+	state_blend_dst = 0xFFFFFFFF;
+	state_depth_func = 0xFFFFFFFF;
+
+	state_unit = STATE_UNKNOWN;
+
+	memset(state_parameters, 0, sizeof(state_parameters));
+}
+
+/*
+ * Returns the tracked value of a texture parameter, 0 when it is not
+ * known.
+ */
+GLint
+egl_state_texture_parameter(GLuint texture, GLenum pname)
+{
+	if (texture >= STATE_TEXTURES)
+		return 0;
+
+	switch (pname) {
+	case GL_TEXTURE_MIN_FILTER:
+		return state_parameters[texture][STATE_MIN_FILTER];
+	case GL_TEXTURE_MAG_FILTER:
+		return state_parameters[texture][STATE_MAG_FILTER];
+	case GL_TEXTURE_WRAP_S:
+		return state_parameters[texture][STATE_WRAP_S];
+	case GL_TEXTURE_WRAP_T:
+		return state_parameters[texture][STATE_WRAP_T];
+	default:
+		return 0;
+	}
+}
+
+/*
+ * Counts the calls that got to the backend and the ones dropped since
+ * the last time, for r_speeds.
+ */
+void
+qglStateCounters(int *forwarded, int *dropped)
+{
+	*forwarded = state_forwarded;
+	*dropped = state_dropped;
+
+	state_forwarded = 0;
+	state_dropped = 0;
+}
+
+/*
+ * Returns where the enable state of cap is kept, NULL when it is not
+ * tracked.
+ */
+static int *
+state_cap(GLenum cap)
+{
+	int i;
+
+	if (cap == GL_TEXTURE_2D) {
+		if (state_unit == STATE_UNKNOWN)
+			return NULL;
+		return &state_texture_enabled[state_unit];
+	}
+
+	for (i = 0; i < STATE_CAPS; i++)
+		if (state_caps[i] == cap)
+			return &state_enabled[i];
+
+	return NULL;
+}
+
+static int
+state_set_cap(GLenum cap, int enable)
+{
+	int *state = state_cap(cap);
+
+	if (state) {
+		if (*state == enable) {
+			state_dropped++;
+			return 0;
+		}
+		*state = enable;
+	}
+
+	state_forwarded++;
+	return 1;
+}
+
+void
+qglEnable(GLenum cap)
+{
+	if (state_set_cap(cap, 1))
+		glimp_enable(cap);
+}
+
+void
+qglDisable(GLenum cap)
+{
+	if (state_set_cap(cap, 0))
+		glimp_disable(cap);
+}
+
+void
+qglBlendFunc(GLenum sfactor, GLenum dfactor)
+{
+	if (sfactor == state_blend_src && dfactor == state_blend_dst) {
+		state_dropped++;
+		return;
+	}
+	state_blend_src = sfactor;
+	state_blend_dst = dfactor;
+
+	state_forwarded++;
+	glimp_blend_func(sfactor, dfactor);
+}
+
+void
+qglDepthFunc(GLenum func)
+{
+	if (func == state_depth_func) {
+		state_dropped++;
+		return;
+	}
+	state_depth_func = func;
+
+	state_forwarded++;
+	glimp_depth_func(func);
+}
+
+void
+qglActiveTexture(GLenum texture)
+{
+	int unit = texture - GL_TEXTURE0;
+
+	if (unit == state_unit) {
+		state_dropped++;
+		return;
+	}
+
+	/* the backend complains about the units it doesn't have */
+	state_unit = (unit >= 0 && unit < STATE_UNITS) ? unit : STATE_UNKNOWN;
+
+	state_forwarded++;
+	glimp_active_texture(texture);
+}
+
+void
+qglBindTexture(GLenum target, GLuint texture)
+{
+	if (state_unit != STATE_UNKNOWN) {
+		if (state_bound[state_unit] == (GLint) texture) {
+			state_dropped++;
+			return;
+		}
+		state_bound[state_unit] = texture;
+	}
+
+	state_forwarded++;
+	glimp_bind_texture(target, texture);
+}
+
+void
+qglTexParameteri(GLenum target, GLenum pname, GLint param)
+{
+	GLint texture = STATE_UNKNOWN;
+	GLint *parameter = NULL;
+
+	if (state_unit != STATE_UNKNOWN)
+		texture = state_bound[state_unit];
+
+	if (texture > 0 && texture < STATE_TEXTURES) {
+		switch (pname) {
+		case GL_TEXTURE_MIN_FILTER:
+			parameter = &state_parameters[texture][STATE_MIN_FILTER];
+			break;
+		case GL_TEXTURE_MAG_FILTER:
+			parameter = &state_parameters[texture][STATE_MAG_FILTER];
+			break;
+		case GL_TEXTURE_WRAP_S:
+			parameter = &state_parameters[texture][STATE_WRAP_S];
+			break;
+		case GL_TEXTURE_WRAP_T:
+			parameter = &state_parameters[texture][STATE_WRAP_T];
+			break;
+		default:
+			break;
+		}
+	}
+
+	if (parameter) {
+		if (*parameter == param) {
+			state_dropped++;
+			return;
+		}
+		*parameter = param;
+	}
+
+	state_forwarded++;
+	glimp_tex_parameteri(target, pname, param);
+}
+
+/*
+ * A deleted texture is unbound, and its name can come back for a new
+ * texture with the default parameters.
+ */
+void
+qglDeleteTextures(GLsizei n, const GLuint *textures)
+{
+	int i, unit;
+
+	for (i = 0; i < n; i++) {
+		for (unit = 0; unit < STATE_UNITS; unit++)
+			if (state_bound[unit] == (GLint) textures[i])
+				state_bound[unit] = 0;
+
+		if (textures[i] < STATE_TEXTURES)
+			memset(state_parameters[textures[i]], 0,
+			       sizeof(state_parameters[textures[i]]));
+	}
+
+	glimp_delete_textures(n, textures);
+}
@@ -0,0 +1,523 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <GLES/gl.h>
+
+#include "egl_trace.h"
+
+const struct trace_call_info trace_calls[TRACE_CALL_COUNT] = {
+	[TRACE_FRAME] = { "Frame", "" },
+
+	[TRACE_ACTIVE_TEXTURE] = { "ActiveTexture", "i" },
+	[TRACE_ALPHA_FUNC] = { "AlphaFunc", "if" },
+	[TRACE_BIND_BUFFER] = { "BindBuffer", "ii" },
+	[TRACE_BIND_TEXTURE] = { "BindTexture", "ii" },
+	[TRACE_BLEND_FUNC] = { "BlendFunc", "ii" },
+	/* target, size, usage, data */
+	[TRACE_BUFFER_DATA] = { "BufferData", "iiid" },
+	[TRACE_CLEAR] = { "Clear", "i" },
+	[TRACE_CLEAR_COLOR] = { "ClearColor", "ffff" },
+	[TRACE_CLEAR_DEPTH] = { "ClearDepthf", "f" },
+	[TRACE_CLEAR_STENCIL] = { "ClearStencil", "i" },
+	[TRACE_CLIENT_ACTIVE_TEXTURE] = { "ClientActiveTexture", "i" },
+	[TRACE_CLIP_PLANE] = { "ClipPlanef", "id" },
+	[TRACE_COLOR] = { "Color4f", "ffff" },
+	[TRACE_COLOR_MASK] = { "ColorMask", "iiii" },
+	/* size, type, stride, buffer offset, client data */
+	[TRACE_COLOR_POINTER] = { "ColorPointer", "iiiid" },
+	[TRACE_CULL_FACE] = { "CullFace", "i" },
+	[TRACE_DELETE_BUFFERS] = { "DeleteBuffers", "d" },
+	[TRACE_DELETE_TEXTURES] = { "DeleteTextures", "d" },
+	[TRACE_DEPTH_FUNC] = { "DepthFunc", "i" },
+	[TRACE_DEPTH_MASK] = { "DepthMask", "i" },
+	[TRACE_DEPTH_RANGE] = { "DepthRangef", "ff" },
+	[TRACE_DISABLE] = { "Disable", "i" },
+	[TRACE_DISABLE_CLIENT_STATE] = { "DisableClientState", "i" },
+	[TRACE_DRAW_ARRAYS] = { "DrawArrays", "iii" },
+	[TRACE_DRAW_BUFFER] = { "DrawBuffer", "i" },
+	/* mode, count, type, buffer offset, client indices */
+	[TRACE_DRAW_ELEMENTS] = { "DrawElements", "iiiid" },
+	[TRACE_ENABLE] = { "Enable", "i" },
+	[TRACE_ENABLE_CLIENT_STATE] = { "EnableClientState", "i" },
+	[TRACE_FINISH] = { "Finish", "" },
+	[TRACE_FLUSH] = { "Flush", "" },
+	/* the names that were handed out */
+	[TRACE_GEN_BUFFERS] = { "GenBuffers", "d" },
+	[TRACE_LINE_WIDTH] = { "LineWidth", "f" },
+	[TRACE_LOAD_IDENTITY] = { "LoadIdentity", "" },
+	[TRACE_LOAD_MATRIX] = { "LoadMatrixf", "d" },
+	[TRACE_LOCK_ARRAYS] = { "LockArrays", "ii" },
+	[TRACE_MATERIAL] = { "Materialf", "iif" },
+	[TRACE_MATRIX_MODE] = { "MatrixMode", "i" },
+	[TRACE_MULTI_TEX_COORD] = { "MultiTexCoord4f", "iffff" },
+	[TRACE_NORMAL_POINTER] = { "NormalPointer", "iiiid" },
+	[TRACE_NUM_VERTICES] = { "NumVertices", "i" },
+	[TRACE_ORTHO] = { "Orthof", "ffffff" },
+	[TRACE_POLYGON_OFFSET] = { "PolygonOffset", "ff" },
+	[TRACE_POP_MATRIX] = { "PopMatrix", "" },
+	[TRACE_PUSH_MATRIX] = { "PushMatrix", "" },
+	[TRACE_READ_PIXELS] = { "ReadPixels", "iiiiii" },
+	[TRACE_SCISSOR] = { "Scissor", "iiii" },
+	[TRACE_SHADE_MODEL] = { "ShadeModel", "i" },
+	[TRACE_STENCIL_FUNC] = { "StencilFunc", "iii" },
+	[TRACE_STENCIL_MASK] = { "StencilMask", "i" },
+	[TRACE_STENCIL_OP] = { "StencilOp", "iii" },
+	[TRACE_TEX_COORD_POINTER] = { "TexCoordPointer", "iiiid" },
+	[TRACE_TEX_ENVF] = { "TexEnvf", "iif" },
+	[TRACE_TEX_ENVI] = { "TexEnvi", "iii" },
+	/* target, level, internalformat, width, height, border,
+	 * format, type, pixels */
+	[TRACE_TEX_IMAGE_2D] = { "TexImage2D", "iiiiiiiid" },
+	[TRACE_TEX_PARAMETERI] = { "TexParameteri", "iii" },
+	/* target, level, xoffset, yoffset, width, height,
+	 * format, type, pixels */
+	[TRACE_TEX_SUB_IMAGE_2D] = { "TexSubImage2D", "iiiiiiiid" },
+	[TRACE_TRANSLATE] = { "Translatef", "fff" },
+	[TRACE_UNLOCK_ARRAYS] = { "UnlockArrays", "" },
+	[TRACE_VERTEX_POINTER] = { "VertexPointer", "iiiid" },
+	[TRACE_VIEWPORT] = { "Viewport", "iiii" },
+};
+
+static FILE *trace_file;
+
+/*
+ * What it takes to write out the vertex arrays that live in client
+ * memory when they get drawn.
+ */
+enum {
+	TRACE_ARRAY_VERTEX,
+	TRACE_ARRAY_COLOR,
+	TRACE_ARRAY_NORMAL,
+	TRACE_ARRAY_TEX_COORD0,
+	TRACE_ARRAY_TEX_COORD1,
+	TRACE_ARRAYS
+};
+
+static struct trace_array {
+	enum trace_call call;
+	int enabled;
+	GLint size;
+	GLenum type;
+	GLsizei stride;
+	const GLvoid *pointer;
+	GLuint buffer;
+} trace_arrays[TRACE_ARRAYS] = {
+	[TRACE_ARRAY_VERTEX] = { .call = TRACE_VERTEX_POINTER },
+	[TRACE_ARRAY_COLOR] = { .call = TRACE_COLOR_POINTER },
+	[TRACE_ARRAY_NORMAL] = { .call = TRACE_NORMAL_POINTER },
+	[TRACE_ARRAY_TEX_COORD0] = { .call = TRACE_TEX_COORD_POINTER },
+	[TRACE_ARRAY_TEX_COORD1] = { .call = TRACE_TEX_COORD_POINTER },
+};
+
+static int trace_client_texture;
+static GLuint trace_array_buffer;
+static GLuint trace_element_buffer;
+
+int
+trace_open(const char *filename)
+{
+	unsigned int header[2] = { TRACE_MAGIC, TRACE_VERSION };
+	int i;
+
+	trace_close();
+
+	trace_file = fopen(filename, "wb");
+	if (!trace_file) {
+		fprintf(stderr, "%s: failed to open %s\n", __func__, filename);
+		return -1;
+	}
+
+	/* the draws write a lot of small records */
+	setvbuf(trace_file, NULL, _IOFBF, 1 << 20);
+
+	fwrite(header, sizeof(header), 1, trace_file);
+
+	/* we start out with the state of a new context */
+	for (i = 0; i < TRACE_ARRAYS; i++) {
+		trace_arrays[i].enabled = 0;
+		trace_arrays[i].pointer = NULL;
+		trace_arrays[i].buffer = 0;
+	}
+	trace_client_texture = 0;
+	trace_array_buffer = 0;
+	trace_element_buffer = 0;
+
+	return 0;
+}
+
+void
+trace_close(void)
+{
+	if (!trace_file)
+		return;
+
+	fclose(trace_file);
+	trace_file = NULL;
+}
+
+static int
+trace_padded(int size)
+{
+	return (size + 3) & ~3;
+}
+
+static void
+trace_write(enum trace_call call, va_list ap)
+{
+	static const char padding[4];
+	const char *format = trace_calls[call].format;
+	unsigned int header[2];
+	va_list count;
+	int i;
+
+	header[0] = call;
+	header[1] = 0;
+
+	va_copy(count, ap);
+	for (i = 0; format[i]; i++) {
+		if (format[i] == 'd') {
+			const void *data = va_arg(count, const void *);
+			int size = va_arg(count, int);
+
+			header[1] += 4 + (data ? trace_padded(size) : 0);
+		} else {
+			if (format[i] == 'f')
+				va_arg(count, double);
+			else
+				va_arg(count, int);
+			header[1] += 4;
+		}
+	}
+	va_end(count);
+
+	fwrite(header, sizeof(header), 1, trace_file);
+
+	for (i = 0; format[i]; i++) {
+		if (format[i] == 'f') {
+			float value = va_arg(ap, double);
+
+			fwrite(&value, 4, 1, trace_file);
+		} else if (format[i] == 'd') {
+			const void *data = va_arg(ap, const void *);
+			int size = va_arg(ap, int);
+
+			if (!data)
+				size = 0;
+
+			fwrite(&size, 4, 1, trace_file);
+			if (size) {
+				fwrite(data, size, 1, trace_file);
+				fwrite(padding, trace_padded(size) - size, 1,
+				       trace_file);
+			}
+		} else {
+			int value = va_arg(ap, int);
+
+			fwrite(&value, 4, 1, trace_file);
+		}
+	}
+}
+
+/*
+ * Takes the arguments as trace_calls[call].format says, a 'd' is a
+ * pointer followed by a size in bytes.
+ */
+void
+trace_call(enum trace_call call, ...)
+{
+	va_list ap;
+
+	if (!trace_file)
+		return;
+
+	va_start(ap, call);
+	trace_write(call, ap);
+	va_end(ap);
+}
+
+static int
+trace_type_size(GLenum type)
+{
+	switch (type) {
+	case GL_BYTE:
+	case GL_UNSIGNED_BYTE:
+		return 1;
+	case GL_SHORT:
+	case GL_UNSIGNED_SHORT:
+		return 2;
+	default:
+		return 4;
+	}
+}
+
+static struct trace_array *
+trace_array_get(enum trace_call call)
+{
+	switch (call) {
+	case TRACE_VERTEX_POINTER:
+		return &trace_arrays[TRACE_ARRAY_VERTEX];
+	case TRACE_COLOR_POINTER:
+		return &trace_arrays[TRACE_ARRAY_COLOR];
+	case TRACE_NORMAL_POINTER:
+		return &trace_arrays[TRACE_ARRAY_NORMAL];
+	default:
+		return &trace_arrays[TRACE_ARRAY_TEX_COORD0 +
+				     trace_client_texture];
+	}
+}
+
+/*
+ * Pointers into buffer objects are written out right away, pointers
+ * to client memory wait for the draw that tells us how much of it is
+ * used.
+ */
+void
+trace_pointer(enum trace_call call, GLint size, GLenum type, GLsizei stride,
+	      const GLvoid *pointer)
+{
+	struct trace_array *array;
+
+	if (!trace_file)
+		return;
+
+	array = trace_array_get(call);
+	array->size = size;
+	array->type = type;
+	array->stride = stride;
+	array->pointer = pointer;
+	array->buffer = trace_array_buffer;
+
+	if (array->buffer)
+		trace_call(call, size, type, stride, (int) (intptr_t) pointer,
+			   NULL, 0);
+}
+
+void
+trace_client_state(GLenum array, int enable)
+{
+	int index;
+
+	if (!trace_file)
+		return;
+
+	switch (array) {
+	case GL_VERTEX_ARRAY:
+		index = TRACE_ARRAY_VERTEX;
+		break;
+	case GL_COLOR_ARRAY:
+		index = TRACE_ARRAY_COLOR;
+		break;
+	case GL_NORMAL_ARRAY:
+		index = TRACE_ARRAY_NORMAL;
+		break;
+	case GL_TEXTURE_COORD_ARRAY:
+		index = TRACE_ARRAY_TEX_COORD0 + trace_client_texture;
+		break;
+	default:
+		index = -1;
+		break;
+	}
+
+	if (index >= 0)
+		trace_arrays[index].enabled = enable;
+
+	trace_call(enable ? TRACE_ENABLE_CLIENT_STATE :
+		   TRACE_DISABLE_CLIENT_STATE, array);
+}
+
+void
+trace_client_active_texture(GLenum texture)
+{
+	if (!trace_file)
+		return;
+
+	if (texture == GL_TEXTURE1)
+		trace_client_texture = 1;
+	else
+		trace_client_texture = 0;
+
+	trace_call(TRACE_CLIENT_ACTIVE_TEXTURE, texture);
+}
+
+void
+trace_bind_buffer(GLenum target, GLuint buffer)
+{
+	if (!trace_file)
+		return;
+
+	if (target == GL_ARRAY_BUFFER)
+		trace_array_buffer = buffer;
+	else if (target == GL_ELEMENT_ARRAY_BUFFER)
+		trace_element_buffer = buffer;
+
+	trace_call(TRACE_BIND_BUFFER, target, buffer);
+}
+
+/*
+ * Writes out the client memory arrays, as far as count vertices reach.
+ */
+static void
+trace_arrays_write(int count)
+{
+	int texture = trace_client_texture;
+	int i;
+
+	for (i = 0; i < TRACE_ARRAYS; i++) {
+		struct trace_array *array = &trace_arrays[i];
+		int element, stride;
+
+		if (!array->enabled || array->buffer || !array->pointer)
+			continue;
+
+		element = array->size * trace_type_size(array->type);
+		stride = array->stride ? array->stride : element;
+
+		if (i >= TRACE_ARRAY_TEX_COORD0 &&
+		    texture != i - TRACE_ARRAY_TEX_COORD0) {
+			texture = i - TRACE_ARRAY_TEX_COORD0;
+			trace_call(TRACE_CLIENT_ACTIVE_TEXTURE,
+				   GL_TEXTURE0 + texture);
+		}
+
+		trace_call(array->call, array->size, array->type,
+			   array->stride, 0, array->pointer,
+			   count ? (count - 1) * stride + element : 0);
+	}
+
+	if (texture != trace_client_texture)
+		trace_call(TRACE_CLIENT_ACTIVE_TEXTURE,
+			   GL_TEXTURE0 + trace_client_texture);
+}
+
+void
+trace_draw_arrays(GLenum mode, GLint first, GLsizei count)
+{
+	if (!trace_file)
+		return;
+
+	trace_arrays_write(first + count);
+	trace_call(TRACE_DRAW_ARRAYS, mode, first, count);
+}
+
+void
+trace_draw_elements(GLenum mode, GLsizei count, GLenum type,
+		    const GLvoid *indices)
+{
+	unsigned int max = 0;
+	int i;
+
+	if (!trace_file)
+		return;
+
+	if (trace_element_buffer) {
+		/* the arrays had better be in buffer objects too */
+		trace_arrays_write(0);
+		trace_call(TRACE_DRAW_ELEMENTS, mode, count, type,
+			   (int) (intptr_t) indices, NULL, 0);
+		return;
+	}
+
+	for (i = 0; i < count; i++) {
+		unsigned int index;
+
+		if (type == GL_UNSIGNED_BYTE)
+			index = ((const GLubyte *) indices)[i];
+		else if (type == GL_UNSIGNED_SHORT)
+			index = ((const GLushort *) indices)[i];
+		else
+			index = ((const GLuint *) indices)[i];
+
+		if (index > max)
+			max = index;
+	}
+
+	trace_arrays_write(count ? max + 1 : 0);
+	trace_call(TRACE_DRAW_ELEMENTS, mode, count, type, 0, indices,
+		   count * trace_type_size(type));
+}
+
+/*
+ * The size of an image with the default unpack alignment of 4.
+ */
+static int
+trace_pixels_size(GLsizei width, GLsizei height, GLenum format, GLenum type)
+{
+	int pixel;
+
+	switch (type) {
+	case GL_UNSIGNED_SHORT_5_6_5:
+	case GL_UNSIGNED_SHORT_4_4_4_4:
+	case GL_UNSIGNED_SHORT_5_5_5_1:
+		pixel = 2;
+		break;
+	default:
+		switch (format) {
+		case GL_ALPHA:
+		case GL_LUMINANCE:
+			pixel = 1;
+			break;
+		case GL_LUMINANCE_ALPHA:
+			pixel = 2;
+			break;
+		case GL_RGB:
+			pixel = 3;
+			break;
+		default:
+			pixel = 4;
+			break;
+		}
+		break;
+	}
+
+	return trace_padded(width * pixel) * height;
+}
+
+void
+trace_tex_image(GLenum target, GLint level, GLint internalformat,
+		GLsizei width, GLsizei height, GLint border, GLenum format,
+		GLenum type, const GLvoid *pixels)
+{
+	if (!trace_file)
+		return;
+
+	trace_call(TRACE_TEX_IMAGE_2D, target, level, internalformat,
+		   width, height, border, format, type, pixels,
+		   trace_pixels_size(width, height, format, type));
+}
+
+void
+trace_tex_sub_image(GLenum target, GLint level, GLint xoffset, GLint yoffset,
+		    GLsizei width, GLsizei height, GLenum format, GLenum type,
+		    const GLvoid *pixels)
+{
+	if (!trace_file)
+		return;
+
+	trace_call(TRACE_TEX_SUB_IMAGE_2D, target, level, xoffset, yoffset,
+		   width, height, format, type, pixels,
+		   trace_pixels_size(width, height, format, type));
+}
@@ -0,0 +1,141 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+#ifndef __EGL_TRACE_H__
+#define __EGL_TRACE_H__
+
+/*
+ * Binary traces of the qgl calls, written while playing and replayed
+ * by egl_replay.c.
+ *
+ * A trace starts with the magic and the version, followed by records.
+ * A record is a call number and the size of its arguments in bytes,
+ * followed by the arguments as 32 bit words in host byte order. Data
+ * arguments are a size word followed by the data, padded out to a
+ * word.
+ *
+ * Vertex arrays in client memory are written out with each draw, as
+ * far as its indices reach. Pointers into buffer objects are kept as
+ * offsets.
+ */
+#define TRACE_MAGIC	(('Q' << 0) | ('3' << 8) | ('G' << 16) | ('T' << 24))
+#define TRACE_VERSION	1
+
+enum trace_call {
+	TRACE_FRAME,		/* GLimp_EndFrame */
+
+	TRACE_ACTIVE_TEXTURE,
+	TRACE_ALPHA_FUNC,
+	TRACE_BIND_BUFFER,
+	TRACE_BIND_TEXTURE,
+	TRACE_BLEND_FUNC,
+	TRACE_BUFFER_DATA,
+	TRACE_CLEAR,
+	TRACE_CLEAR_COLOR,
+	TRACE_CLEAR_DEPTH,
+	TRACE_CLEAR_STENCIL,
+	TRACE_CLIENT_ACTIVE_TEXTURE,
+	TRACE_CLIP_PLANE,
+	TRACE_COLOR,
+	TRACE_COLOR_MASK,
+	TRACE_COLOR_POINTER,
+	TRACE_CULL_FACE,
+	TRACE_DELETE_BUFFERS,
+	TRACE_DELETE_TEXTURES,
+	TRACE_DEPTH_FUNC,
+	TRACE_DEPTH_MASK,
+	TRACE_DEPTH_RANGE,
+	TRACE_DISABLE,
+	TRACE_DISABLE_CLIENT_STATE,
+	TRACE_DRAW_ARRAYS,
+	TRACE_DRAW_BUFFER,
+	TRACE_DRAW_ELEMENTS,
+	TRACE_ENABLE,
+	TRACE_ENABLE_CLIENT_STATE,
+	TRACE_FINISH,
+	TRACE_FLUSH,
+	TRACE_GEN_BUFFERS,
+	TRACE_LINE_WIDTH,
+	TRACE_LOAD_IDENTITY,
+	TRACE_LOAD_MATRIX,
+	TRACE_LOCK_ARRAYS,
+	TRACE_MATERIAL,
+	TRACE_MATRIX_MODE,
+	TRACE_MULTI_TEX_COORD,
+	TRACE_NORMAL_POINTER,
+	TRACE_NUM_VERTICES,
+	TRACE_ORTHO,
+	TRACE_POLYGON_OFFSET,
+	TRACE_POP_MATRIX,
+	TRACE_PUSH_MATRIX,
+	TRACE_READ_PIXELS,
+	TRACE_SCISSOR,
+	TRACE_SHADE_MODEL,
+	TRACE_STENCIL_FUNC,
+	TRACE_STENCIL_MASK,
+	TRACE_STENCIL_OP,
+	TRACE_TEX_COORD_POINTER,
+	TRACE_TEX_ENVF,
+	TRACE_TEX_ENVI,
+	TRACE_TEX_IMAGE_2D,
+	TRACE_TEX_PARAMETERI,
+	TRACE_TEX_SUB_IMAGE_2D,
+	TRACE_TRANSLATE,
+	TRACE_UNLOCK_ARRAYS,
+	TRACE_VERTEX_POINTER,
+	TRACE_VIEWPORT,
+
+	TRACE_CALL_COUNT
+};
+
+/*
+ * The arguments of a call: 'i' is an integer or enum, 'f' a float and
+ * 'd' a pointer and a size in bytes, stored as data.
+ */
+struct trace_call_info {
+	const char *name;
+	const char *format;
+};
+
+extern const struct trace_call_info trace_calls[TRACE_CALL_COUNT];
+
+/* recording, everything but trace_open() does nothing without a trace */
+int trace_open(const char *filename);
+void trace_close(void);
+
+void trace_call(enum trace_call call, ...);
+void trace_pointer(enum trace_call call, GLint size, GLenum type,
+		   GLsizei stride, const GLvoid *pointer);
+void trace_client_state(GLenum array, int enable);
+void trace_client_active_texture(GLenum texture);
+void trace_bind_buffer(GLenum target, GLuint buffer);
+void trace_draw_arrays(GLenum mode, GLint first, GLsizei count);
+void trace_draw_elements(GLenum mode, GLsizei count, GLenum type,
+			 const GLvoid *indices);
+void trace_tex_image(GLenum target, GLint level, GLint internalformat,
+		     GLsizei width, GLsizei height, GLint border,
+		     GLenum format, GLenum type, const GLvoid *pixels);
+void trace_tex_sub_image(GLenum target, GLint level, GLint xoffset,
+			 GLint yoffset, GLsizei width, GLsizei height,
+			 GLenum format, GLenum type, const GLvoid *pixels);
+
+#endif
@@ -24,6 +24,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdarg.h>
 #include <string.h>
 
 /* for fbdev poking */
@@ -44,6 +45,11 @@ typedef khronos_int32_t  GLclampx;
 #define GL_COLOR_ARRAY                    0x8076
 #define GL_TEXTURE_COORD_ARRAY            0x8078
 #define GL_ALPHA_TEST                     0x0BC0
+#define GL_TEXTURE_ENV                    0x2300
+#define GL_TEXTURE_ENV_MODE               0x2200
+#define GL_MODULATE                       0x2100
+#define GL_DECAL                          0x2101
+#define GL_ADD                            0x0104
 
 #undef ALIGN
 #define USE_REAL_GL_CALLS 1
@@ -212,253 +218,493 @@ make_window(int width, int height)
 		GLimp_HandleError();
 }
 
-unsigned int program_single_texture;
-unsigned int program_dual_texture;
-unsigned int program_current;
-int program_single_texture_matrix;
-int program_dual_texture_matrix;
-
-int
-program_single_texture_load(void)
-{
-	static const char* vertex_source =
-		"uniform mat4 uMatrix;\n"
-		"\n"
-		"attribute vec4 aPosition;\n"
-		"attribute vec4 aColor;\n"
-		"attribute vec2 aTexCoord0;\n"
-		"\n"
-		"varying vec4 vColor;\n"
-		"varying vec2 vTexCoord0;\n"
-		"\n"
-		"void main()\n"
-		"{\n"
-		"    gl_Position = uMatrix * aPosition;\n"
-		"    vColor = aColor;\n"
-		"    vTexCoord0 = aTexCoord0;\n"
-		"}\n";
-
-	static const char* fragment_source =
-		"precision mediump float;\n"
-		"\n"
-		"varying vec4 vColor;\n"
-		"varying vec2 vTexCoord0;\n"
-		"\n"
-		"uniform sampler2D uTexture0;\n"
-		"\n"
-		"void main()\n"
-		"{\n"
-		"    gl_FragColor = clamp(vColor * texture2D(uTexture0, vTexCoord0), 0.0, 1.0);\n"
-		"}\n";
-	int ret;
-
-	int vertex_shader = glCreateShader(GL_VERTEX_SHADER);
-	if (!vertex_shader) {
-		printf("Error: glCreateShader(GL_VERTEX_SHADER) failed: %d (%s)\n",
-		       eglGetError(), eglStrError(eglGetError()));
-		return -1;
-	}
-
+/*
+ *
+ * Programs.
+ *
+ * Each combination of the emulated fixed function state a draw uses
+ * gets its own generated program, kept until shutdown. Besides the
+ * texture environment of both units, this covers the alpha test, the
+ * texture matrices, the environment and fog texture coordinates and
+ * the vertex deforms the renderer leaves to us, see qglStageFeatures().
+ *
+ */
+#define PROGRAM_TEXTURE1	0x0001	/* second texture unit */
+#define PROGRAM_ALPHA_GT0	0x0002	/* the alpha tests of GL_State */
+#define PROGRAM_ALPHA_LT128	0x0004
+#define PROGRAM_ALPHA_GE128	0x0008
+
+/* per unit, shifted by PROGRAM_UNIT_SHIFT for the second one */
+#define PROGRAM_ENV_REPLACE	0x0010
+#define PROGRAM_ENV_ADD		0x0020
+#define PROGRAM_ENV_DECAL	0x0040
+#define PROGRAM_MATRIX		0x0080	/* texture matrix */
+#define PROGRAM_ENVIRONMENT	0x0100	/* environment mapped coordinates */
+#define PROGRAM_FOG		0x0200	/* fog coordinates */
+#define PROGRAM_UNIT_SHIFT	6
+
+#define PROGRAM_UNIT(key, unit)	(((key) >> ((unit) * PROGRAM_UNIT_SHIFT)) & \
+				 (((PROGRAM_FOG << 1) - 1) & ~(PROGRAM_ENV_REPLACE - 1)))
 
-	glShaderSource(vertex_shader, 1, &vertex_source, NULL);
-	glCompileShader(vertex_shader);
+/*
+ * A deform code per qglDeformVertexes index: the QGL_DEFORM_*, with
+ * the QGL_WAVE_* added for QGL_DEFORM_WAVE.
+ */
+#define PROGRAM_DEFORM_SHIFT	16
+#define PROGRAM_DEFORM_BITS	4
+
+#define PROGRAM_DEFORM(key, index) (((key) >> (PROGRAM_DEFORM_SHIFT + \
+				    (index) * PROGRAM_DEFORM_BITS)) & \
+				    ((1 << PROGRAM_DEFORM_BITS) - 1))
+
+#define MAX_PROGRAMS		128
+
+enum {
+	ATTRIB_POSITION,
+	ATTRIB_COLOR,
+	ATTRIB_TEXCOORD0,
+	ATTRIB_TEXCOORD1,
+	ATTRIB_NORMAL,
+	ATTRIB_DEFORM_COORD,
+	ATTRIB_COUNT
+};
 
-	glGetShaderiv(vertex_shader, GL_COMPILE_STATUS, &ret);
-	if (!ret) {
-		char *log;
+struct program {
+	unsigned int key;
+	GLuint program;		/* 0 when it failed to build */
+	unsigned int used;	/* program_clock when last drawn with */
+
+	GLint matrix;
+	GLint texture_matrix[2];
+	GLint view_origin;
+	GLint fog_distance;
+	GLint fog_depth;
+	GLint fog_eye;
+	GLint deform[QGL_MAX_DEFORMS];
+
+	/* what was last uploaded to the uniforms */
+	int matrix_serial;
+	int texture_matrix_serial[2];
+	int texgen_serial;
+	int deform_serial;
+};
 
-		printf("Error: vertex shader compilation failed!:\n");
-		glGetShaderiv(vertex_shader, GL_INFO_LOG_LENGTH, &ret);
+static struct program programs[MAX_PROGRAMS];
+static int program_count;
+static unsigned int program_clock;
+static struct program *program_current;
 
-		if (ret > 1) {
-			log = malloc(ret);
-			glGetShaderInfoLog(vertex_shader, ret, NULL, log);
-			printf("%s", log);
-		}
-		return -1;
-	} else
-		printf("Vertex shader compilation succeeded!\n");
+static void
+source_add(char *source, int size, const char *format, ...)
+{
+	int length = strlen(source);
+	va_list args;
 
-	int fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
-	if (!fragment_shader) {
-		printf("Error: glCreateShader(GL_FRAGMENT_SHADER) failed: %d (%s)\n",
-		       eglGetError(), eglStrError(eglGetError()));
-		return -1;
-	}
+	va_start(args, format);
+	vsnprintf(source + length, size - length, format, args);
+	va_end(args);
+}
 
+/* the waveforms of tr.sinTable and friends */
+static const char *program_waves[] = {
+	"    return sin(x * 6.2831853);\n",
+	"    return fract(x) < 0.5 ? 1.0 : -1.0;\n",
+	"    return (fract(x) < 0.5 ? 1.0 : -1.0) *\n"
+	"        (1.0 - abs(2.0 * fract(2.0 * x) - 1.0));\n",
+	"    return fract(x);\n",
+	"    return 1.0 - fract(x);\n"
+};
 
-	glShaderSource(fragment_shader, 1, &fragment_source, NULL);
-	glCompileShader(fragment_shader);
+#define PROGRAM_WAVES	((int) (sizeof(program_waves) / sizeof(program_waves[0])))
 
-	glGetShaderiv(fragment_shader, GL_COMPILE_STATUS, &ret);
-	if (!ret) {
-		char *log;
+/*
+ * The deforms of tr_shade_calc.c, moving the position and normal
+ * globals main() starts from.
+ */
+static void
+program_source_deforms(unsigned int key, char *vertex, int size)
+{
+	int waves = 0, noise = 0;
+	int index, deform;
 
-		printf("Error: fragment shader compilation failed!:\n");
-		glGetShaderiv(fragment_shader, GL_INFO_LOG_LENGTH, &ret);
+	for (index = 0; index < QGL_MAX_DEFORMS; index++) {
+		deform = PROGRAM_DEFORM(key, index);
 
-		if (ret > 1) {
-			log = malloc(ret);
-			glGetShaderInfoLog(fragment_shader, ret, NULL, log);
-			printf("%s", log);
-		}
-		return -1;
-	} else
-		printf("Fragment shader compilation succeeded!\n");
+		if (deform >= QGL_DEFORM_WAVE)
+			waves |= 1 << (deform - QGL_DEFORM_WAVE);
+		else if (deform == QGL_DEFORM_NORMALS)
+			noise = 1;
 
-	int program = glCreateProgram();
-	if (!program) {
-		printf("Error: failed to create program!\n");
-		return -1;
+		if (deform != QGL_DEFORM_NONE)
+			source_add(vertex, size,
+				   "uniform vec4 uDeform%d;\n", index);
 	}
 
-	glAttachShader(program, vertex_shader);
-	glAttachShader(program, fragment_shader);
-
-	glBindAttribLocation(program, 0, "aPosition");
-	glBindAttribLocation(program, 1, "aColor");
-	glBindAttribLocation(program, 2, "aTexCoord0");
-
-	glLinkProgram(program);
+	for (index = 0; index < PROGRAM_WAVES; index++)
+		if (waves & (1 << index))
+			source_add(vertex, size,
+				   "\n"
+				   "float wave%d(float x)\n"
+				   "{\n"
+				   "%s"
+				   "}\n", index, program_waves[index]);
+
+	/*
+	 * A hashed lattice instead of the table of R_NoiseGet4f, it is
+	 * as smooth and wraps the same way.
+	 */
+	if (noise)
+		source_add(vertex, size,
+			   "\n"
+			   "float hash(vec4 p)\n"
+			   "{\n"
+			   "    p = mod(p, 256.0);\n"
+			   "    return fract(sin(dot(p, vec4(12.9898, 78.233, 45.164, 94.673))) *\n"
+			   "                 43758.5453) * 2.0 - 1.0;\n"
+			   "}\n"
+			   "\n"
+			   "float noise3(vec4 i, vec3 f)\n"
+			   "{\n"
+			   "    float a = mix(hash(i), hash(i + vec4(1.0, 0.0, 0.0, 0.0)), f.x);\n"
+			   "    float b = mix(hash(i + vec4(0.0, 1.0, 0.0, 0.0)),\n"
+			   "                  hash(i + vec4(1.0, 1.0, 0.0, 0.0)), f.x);\n"
+			   "    float c = mix(hash(i + vec4(0.0, 0.0, 1.0, 0.0)),\n"
+			   "                  hash(i + vec4(1.0, 0.0, 1.0, 0.0)), f.x);\n"
+			   "    float d = mix(hash(i + vec4(0.0, 1.0, 1.0, 0.0)),\n"
+			   "                  hash(i + vec4(1.0, 1.0, 1.0, 0.0)), f.x);\n"
+			   "\n"
+			   "    return mix(mix(a, b, f.y), mix(c, d, f.y), f.z);\n"
+			   "}\n"
+			   "\n"
+			   "float noise(vec4 p)\n"
+			   "{\n"
+			   "    vec4 i = floor(p);\n"
+			   "    vec4 f = p - i;\n"
+			   "\n"
+			   "    return mix(noise3(i, f.xyz),\n"
+			   "               noise3(i + vec4(0.0, 0.0, 0.0, 1.0), f.xyz), f.w);\n"
+			   "}\n");
+}
 
-	glGetProgramiv(program, GL_LINK_STATUS, &ret);
-	if (!ret) {
-		char *log;
+static void
+program_source_deform(int index, int deform, char *vertex, int size)
+{
+	switch (deform) {
+	case QGL_DEFORM_NONE:
+		break;
+	case QGL_DEFORM_NORMALS:
+		/* RB_CalcDeformNormals */
+		source_add(vertex, size,
+			   "    normal += uDeform%d.x * vec3(\n"
+			   "        noise(vec4(position.xyz * 0.98, uDeform%d.y)),\n"
+			   "        noise(vec4(100.0 + position.x * 0.98, position.yz * 0.98, uDeform%d.y)),\n"
+			   "        noise(vec4(200.0 + position.x * 0.98, position.yz * 0.98, uDeform%d.y)));\n"
+			   "    normal = normalize(normal);\n",
+			   index, index, index, index);
+		break;
+	case QGL_DEFORM_BULGE:
+		/* RB_CalcBulgeVertexes */
+		source_add(vertex, size,
+			   "    position.xyz += normal * sin(aDeformTexCoord.x * uDeform%d.x +\n"
+			   "                                 uDeform%d.z) * uDeform%d.y;\n",
+			   index, index, index);
+		break;
+	case QGL_DEFORM_MOVE:
+		/* RB_CalcMoveVertexes */
+		source_add(vertex, size,
+			   "    position.xyz += uDeform%d.xyz;\n", index);
+		break;
+	default:
+		/* RB_CalcDeformVertexes */
+		source_add(vertex, size,
+			   "    position.xyz += normal * (uDeform%d.x + uDeform%d.y *\n"
+			   "        wave%d(uDeform%d.z + dot(position.xyz, vec3(uDeform%d.w))));\n",
+			   index, index, deform - QGL_DEFORM_WAVE, index, index);
+		break;
+	}
+}
 
-		printf("Error: program linking failed!:\n");
-		glGetProgramiv(program, GL_INFO_LOG_LENGTH, &ret);
+static void
+program_source(unsigned int key, char *vertex, char *fragment, int size)
+{
+	int units = (key & PROGRAM_TEXTURE1) ? 2 : 1;
+	int environment = 0, fog = 0, normals = 0, bulge = 0;
+	int unit, bits, index, deform;
 
-		if (ret > 1) {
-			log = malloc(ret);
-			glGetProgramInfoLog(program, ret, NULL, log);
-			printf("%s", log);
-		}
-		return -1;
-	} else
-		printf("program linking succeeded!\n");
+	vertex[0] = 0;
+	fragment[0] = 0;
 
-	glUseProgram(program);
+	for (unit = 0; unit < units; unit++) {
+		bits = PROGRAM_UNIT(key, unit);
+		environment |= bits & PROGRAM_ENVIRONMENT;
+		fog |= bits & PROGRAM_FOG;
+	}
 
-	int handle = glGetUniformLocation(program, "uMatrix");
+	/* only the move deform doesn't read the normals */
+	normals = environment;
+	for (index = 0; index < QGL_MAX_DEFORMS; index++) {
+		deform = PROGRAM_DEFORM(key, index);
+		if (deform != QGL_DEFORM_NONE && deform != QGL_DEFORM_MOVE)
+			normals = 1;
+		if (deform == QGL_DEFORM_BULGE)
+			bulge = 1;
+	}
 
-	GLint texture_loc = glGetUniformLocation(program, "uTexture0");
-	glUniform1i(texture_loc, 0); // 0 -> GL_TEXTURE0 in glActiveTexture
+	source_add(vertex, size,
+		   "uniform mat4 uMatrix;\n"
+		   "\n"
+		   "attribute vec4 aPosition;\n"
+		   "attribute vec4 aColor;\n"
+		   "\n"
+		   "varying vec4 vColor;\n"
+		   "\n"
+		   "vec4 position;\n");
+
+	if (normals)
+		source_add(vertex, size,
+			   "attribute vec3 aNormal;\n"
+			   "vec3 normal;\n");
+	if (bulge)
+		source_add(vertex, size,
+			   "attribute vec2 aDeformTexCoord;\n");
+	source_add(vertex, size, "\n");
+
+	source_add(fragment, size,
+		   "precision mediump float;\n"
+		   "\n"
+		   "varying vec4 vColor;\n");
+
+	for (unit = 0; unit < units; unit++) {
+		bits = PROGRAM_UNIT(key, unit);
+
+		if (!(bits & (PROGRAM_ENVIRONMENT | PROGRAM_FOG)))
+			source_add(vertex, size,
+				   "attribute vec2 aTexCoord%d;\n", unit);
+		if (bits & PROGRAM_MATRIX)
+			source_add(vertex, size,
+				   "uniform mat4 uTextureMatrix%d;\n", unit);
+		source_add(vertex, size, "varying vec2 vTexCoord%d;\n", unit);
+
+		source_add(fragment, size,
+			   "varying vec2 vTexCoord%d;\n"
+			   "uniform sampler2D uTexture%d;\n", unit, unit);
+	}
 
-	program_single_texture = program;
-	program_single_texture_matrix = handle;
+	program_source_deforms(key, vertex, size);
+
+	/* RB_CalcEnvironmentTexCoords */
+	if (environment)
+		source_add(vertex, size,
+			   "\n"
+			   "uniform vec3 uViewOrigin;\n"
+			   "\n"
+			   "vec2 environment()\n"
+			   "{\n"
+			   "    vec3 viewer = normalize(uViewOrigin - position.xyz);\n"
+			   "    vec3 reflected = normal * 2.0 * dot(normal, viewer) - viewer;\n"
+			   "\n"
+			   "    return vec2(0.5 + reflected.y * 0.5, 0.5 - reflected.z * 0.5);\n"
+			   "}\n");
+
+	/* RB_CalcFogTexCoords */
+	if (fog)
+		source_add(vertex, size,
+			   "\n"
+			   "uniform vec4 uFogDistance;\n"
+			   "uniform vec4 uFogDepth;\n"
+			   "uniform float uFogEyeT;\n"
+			   "\n"
+			   "vec2 fog()\n"
+			   "{\n"
+			   "    float s = dot(position.xyz, uFogDistance.xyz) + uFogDistance.w;\n"
+			   "    float t = dot(position.xyz, uFogDepth.xyz) + uFogDepth.w;\n"
+			   "\n"
+			   "    if (uFogEyeT < 0.0) {\n"
+			   "        if (t < 1.0)\n"
+			   "            t = 1.0 / 32.0;\n"
+			   "        else\n"
+			   "            t = 1.0 / 32.0 + 30.0 / 32.0 * t / (t - uFogEyeT);\n"
+			   "    } else {\n"
+			   "        if (t < 0.0)\n"
+			   "            t = 1.0 / 32.0;\n"
+			   "        else\n"
+			   "            t = 31.0 / 32.0;\n"
+			   "    }\n"
+			   "\n"
+			   "    return vec2(s, t);\n"
+			   "}\n");
+
+	source_add(vertex, size,
+		   "\n"
+		   "void main()\n"
+		   "{\n"
+		   "    position = aPosition;\n");
+	if (normals)
+		source_add(vertex, size, "    normal = aNormal;\n");
+
+	for (index = 0; index < QGL_MAX_DEFORMS; index++)
+		program_source_deform(index, PROGRAM_DEFORM(key, index),
+				      vertex, size);
+
+	source_add(vertex, size,
+		   "    gl_Position = uMatrix * position;\n"
+		   "    vColor = aColor;\n");
+
+	source_add(fragment, size,
+		   "\n"
+		   "void main()\n"
+		   "{\n"
+		   "    vec4 color = vColor;\n"
+		   "    vec4 texel;\n");
+
+	for (unit = 0; unit < units; unit++) {
+		const char *st;
+
+		bits = PROGRAM_UNIT(key, unit);
+
+		if (bits & PROGRAM_ENVIRONMENT)
+			st = "environment()";
+		else if (bits & PROGRAM_FOG)
+			st = "fog()";
+		else
+			st = unit ? "aTexCoord1" : "aTexCoord0";
 
-	return 0;
-}
+		if (bits & PROGRAM_MATRIX)
+			source_add(vertex, size,
+				   "    vTexCoord%d = (uTextureMatrix%d * "
+				   "vec4(%s, 0.0, 1.0)).xy;\n", unit, unit, st);
+		else
+			source_add(vertex, size,
+				   "    vTexCoord%d = %s;\n", unit, st);
+
+		source_add(fragment, size,
+			   "\n"
+			   "    texel = texture2D(uTexture%d, vTexCoord%d);\n",
+			   unit, unit);
+
+		if (bits & PROGRAM_ENV_REPLACE)
+			source_add(fragment, size,
+				   "    color = texel;\n");
+		else if (bits & PROGRAM_ENV_ADD)
+			source_add(fragment, size,
+				   "    color = vec4(color.rgb + texel.rgb, "
+				   "color.a * texel.a);\n");
+		else if (bits & PROGRAM_ENV_DECAL)
+			source_add(fragment, size,
+				   "    color = vec4(mix(color.rgb, texel.rgb, "
+				   "texel.a), color.a);\n");
+		else
+			source_add(fragment, size,
+				   "    color = color * texel;\n");
+	}
 
-int
-program_dual_texture_load(void)
-{
-	static const char* vertex_source =
-		"uniform mat4 uMatrix;\n"
-		"\n"
-		"attribute vec4 aPosition;\n"
-		"attribute vec4 aColor;\n"
-		"attribute vec2 aTexCoord0;\n"
-		"attribute vec2 aTexCoord1;\n"
-		"\n"
-		"varying vec4 vColor;\n"
-		"varying vec2 vTexCoord0;\n"
-		"varying vec2 vTexCoord1;\n"
-		"\n"
-		"void main()\n"
-		"{\n"
-		"    gl_Position = uMatrix * aPosition;\n"
-		"    vColor = aColor;\n"
-		"    vTexCoord0 = aTexCoord0;\n"
-		"    vTexCoord1 = aTexCoord1;\n"
-		"}\n";
-
-	static const char* fragment_source =
-		"precision mediump float;\n"
-		"\n"
-		"varying vec4 vColor;\n"
-		"varying vec2 vTexCoord0;\n"
-		"varying vec2 vTexCoord1;\n"
-		"\n"
-		"uniform sampler2D uTexture0;\n"
-		"uniform sampler2D uTexture1;\n"
-		"\n"
-		"void main()\n"
-		"{\n"
-		"    gl_FragColor = clamp(vColor * "
-		"texture2D(uTexture0, vTexCoord0) *"
-		"texture2D(uTexture1, vTexCoord1),"
-		" 0.0, 1.0);\n"
-		"}\n";
-	int ret;
-
-	int vertex_shader = glCreateShader(GL_VERTEX_SHADER);
-	if (!vertex_shader) {
-		printf("Error: glCreateShader(GL_VERTEX_SHADER) failed: %d (%s)\n",
+	source_add(vertex, size, "}\n");
+
+	source_add(fragment, size,
+		   "\n"
+		   "    color = clamp(color, 0.0, 1.0);\n");
+
+	if (key & PROGRAM_ALPHA_GT0)
+		source_add(fragment, size,
+			   "    if (color.a <= 0.0)\n"
+			   "        discard;\n");
+	else if (key & PROGRAM_ALPHA_LT128)
+		source_add(fragment, size,
+			   "    if (color.a >= 0.5)\n"
+			   "        discard;\n");
+	else if (key & PROGRAM_ALPHA_GE128)
+		source_add(fragment, size,
+			   "    if (color.a < 0.5)\n"
+			   "        discard;\n");
+
+	source_add(fragment, size,
+		   "    gl_FragColor = color;\n"
+		   "}\n");
+}
+
+static GLuint
+shader_compile(GLenum type, const char *source)
+{
+	GLuint shader;
+	GLint ret;
+
+	shader = glCreateShader(type);
+	if (!shader) {
+		printf("Error: glCreateShader(%s) failed: %d (%s)\n",
+		       type == GL_VERTEX_SHADER ?
+		       "GL_VERTEX_SHADER" : "GL_FRAGMENT_SHADER",
 		       eglGetError(), eglStrError(eglGetError()));
-		return -1;
+		return 0;
 	}
 
+	glShaderSource(shader, 1, &source, NULL);
+	glCompileShader(shader);
 
-	glShaderSource(vertex_shader, 1, &vertex_source, NULL);
-	glCompileShader(vertex_shader);
-
-	glGetShaderiv(vertex_shader, GL_COMPILE_STATUS, &ret);
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &ret);
 	if (!ret) {
 		char *log;
 
-		printf("Error: vertex shader compilation failed!:\n");
-		glGetShaderiv(vertex_shader, GL_INFO_LOG_LENGTH, &ret);
+		printf("Error: %s shader compilation failed!:\n",
+		       type == GL_VERTEX_SHADER ? "vertex" : "fragment");
+		glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &ret);
 
 		if (ret > 1) {
 			log = malloc(ret);
-			glGetShaderInfoLog(vertex_shader, ret, NULL, log);
+			glGetShaderInfoLog(shader, ret, NULL, log);
 			printf("%s", log);
+			free(log);
 		}
-		return -1;
-	} else
-		printf("Vertex shader compilation succeeded!\n");
+		printf("%s", source);
 
-	int fragment_shader = glCreateShader(GL_FRAGMENT_SHADER);
-	if (!fragment_shader) {
-		printf("Error: glCreateShader(GL_FRAGMENT_SHADER) failed: %d (%s)\n",
-		       eglGetError(), eglStrError(eglGetError()));
-		return -1;
+		glDeleteShader(shader);
+		return 0;
 	}
 
+	return shader;
+}
 
-	glShaderSource(fragment_shader, 1, &fragment_source, NULL);
-	glCompileShader(fragment_shader);
+static GLuint
+program_link(unsigned int key)
+{
+	static char vertex_source[8192];
+	static char fragment_source[8192];
+	GLuint vertex_shader, fragment_shader, program;
+	GLint ret;
 
-	glGetShaderiv(fragment_shader, GL_COMPILE_STATUS, &ret);
-	if (!ret) {
-		char *log;
+	program_source(key, vertex_source, fragment_source,
+		       sizeof(vertex_source));
 
-		printf("Error: fragment shader compilation failed!:\n");
-		glGetShaderiv(fragment_shader, GL_INFO_LOG_LENGTH, &ret);
+	vertex_shader = shader_compile(GL_VERTEX_SHADER, vertex_source);
+	if (!vertex_shader)
+		return 0;
 
-		if (ret > 1) {
-			log = malloc(ret);
-			glGetShaderInfoLog(fragment_shader, ret, NULL, log);
-			printf("%s", log);
-		}
-		return -1;
-	} else
-		printf("Fragment shader compilation succeeded!\n");
+	fragment_shader = shader_compile(GL_FRAGMENT_SHADER, fragment_source);
+	if (!fragment_shader) {
+		glDeleteShader(vertex_shader);
+		return 0;
+	}
 
-	int program = glCreateProgram();
+	program = glCreateProgram();
 	if (!program) {
 		printf("Error: failed to create program!\n");
-		return -1;
+		glDeleteShader(vertex_shader);
+		glDeleteShader(fragment_shader);
+		return 0;
 	}
 
 	glAttachShader(program, vertex_shader);
 	glAttachShader(program, fragment_shader);
 
-	glBindAttribLocation(program, 0, "aPosition");
-	glBindAttribLocation(program, 1, "aColor");
-	glBindAttribLocation(program, 2, "aTexCoord0");
-	glBindAttribLocation(program, 3, "aTexCoord1");
+	/* the shaders go with the program */
+	glDeleteShader(vertex_shader);
+	glDeleteShader(fragment_shader);
+
+	glBindAttribLocation(program, ATTRIB_POSITION, "aPosition");
+	glBindAttribLocation(program, ATTRIB_COLOR, "aColor");
+	glBindAttribLocation(program, ATTRIB_TEXCOORD0, "aTexCoord0");
+	glBindAttribLocation(program, ATTRIB_TEXCOORD1, "aTexCoord1");
+	glBindAttribLocation(program, ATTRIB_NORMAL, "aNormal");
+	glBindAttribLocation(program, ATTRIB_DEFORM_COORD, "aDeformTexCoord");
 
 	glLinkProgram(program);
 
@@ -466,31 +712,141 @@ program_dual_texture_load(void)
 	if (!ret) {
 		char *log;
 
-		printf("Error: program linking failed!:\n");
+		printf("Error: program 0x%04X linking failed!:\n", key);
 		glGetProgramiv(program, GL_INFO_LOG_LENGTH, &ret);
 
 		if (ret > 1) {
 			log = malloc(ret);
 			glGetProgramInfoLog(program, ret, NULL, log);
 			printf("%s", log);
+			free(log);
 		}
-		return -1;
-	} else
-		printf("program linking succeeded!\n");
 
-	glUseProgram(program);
+		glDeleteProgram(program);
+		return 0;
+	}
+
+	return program;
+}
 
-	int handle = glGetUniformLocation(program, "uMatrix");
+/*
+ * Once the table is full, the program that was drawn with the longest
+ * ago makes room for the new one.
+ */
+static struct program *
+program_evict(void)
+{
+	struct program *program = &programs[0];
+	int i;
 
-	GLint texture_loc = glGetUniformLocation(program, "uTexture0");
-	glUniform1i(texture_loc, 0); // 0 -> GL_TEXTURE0 in glActiveTexture
-	texture_loc = glGetUniformLocation(program, "uTexture1");
-	glUniform1i(texture_loc, 1); // 1 -> GL_TEXTURE1 in glActiveTexture
+	for (i = 1; i < program_count; i++)
+		if (programs[i].used < program->used)
+			program = &programs[i];
 
-	program_dual_texture = program;
-	program_dual_texture_matrix = handle;
+	if (program->program)
+		glDeleteProgram(program->program);
+	if (program == program_current)
+		program_current = NULL;
 
-	return 0;
+	return program;
+}
+
+/*
+ * Returns NULL when the program can't be built, the draw is dropped then.
+ * A failed program stays in the table, so it is only reported once.
+ */
+static struct program *
+program_get(unsigned int key)
+{
+	struct program *program;
+	int i, index;
+
+	program_clock++;
+
+	if (program_current && program_current->key == key) {
+		program_current->used = program_clock;
+		return program_current;
+	}
+
+	for (i = 0; i < program_count; i++)
+		if (programs[i].key == key)
+			break;
+
+	if (i < program_count) {
+		program = &programs[i];
+	} else {
+		if (program_count < MAX_PROGRAMS)
+			program = &programs[program_count++];
+		else
+			program = program_evict();
+
+		program->key = key;
+		program->program = program_link(key);
+		if (program->program) {
+			GLuint id = program->program;
+
+			glUseProgram(id);
+			glUniform1i(glGetUniformLocation(id, "uTexture0"), 0);
+			if (key & PROGRAM_TEXTURE1)
+				glUniform1i(glGetUniformLocation(id,
+								 "uTexture1"),
+					    1);
+
+			program->matrix = glGetUniformLocation(id, "uMatrix");
+			program->texture_matrix[0] =
+				glGetUniformLocation(id, "uTextureMatrix0");
+			program->texture_matrix[1] =
+				glGetUniformLocation(id, "uTextureMatrix1");
+			program->view_origin =
+				glGetUniformLocation(id, "uViewOrigin");
+			program->fog_distance =
+				glGetUniformLocation(id, "uFogDistance");
+			program->fog_depth =
+				glGetUniformLocation(id, "uFogDepth");
+			program->fog_eye = glGetUniformLocation(id, "uFogEyeT");
+			for (index = 0; index < QGL_MAX_DEFORMS; index++) {
+				char name[16];
+
+				snprintf(name, sizeof(name), "uDeform%d", index);
+				program->deform[index] =
+					glGetUniformLocation(id, name);
+			}
+
+			program->matrix_serial = -1;
+			program->texture_matrix_serial[0] = -1;
+			program->texture_matrix_serial[1] = -1;
+			program->texgen_serial = -1;
+			program->deform_serial = -1;
+
+			program_current = program;
+		}
+	}
+
+	program->used = program_clock;
+
+	if (!program->program)
+		return NULL;
+
+	if (program != program_current) {
+		glUseProgram(program->program);
+		program_current = program;
+	}
+
+	return program;
+}
+
+static void
+program_shutdown(void)
+{
+	int i;
+
+	for (i = 0; i < program_count; i++)
+		if (programs[i].program)
+			glDeleteProgram(programs[i].program);
+
+	program_count = 0;
+	program_clock = 0;
+	program_current = NULL;
 }
 
 /*
@@ -502,8 +858,15 @@ float matrix_modelview[16];
 float matrix_projection[16];
 float matrix_transform[16];
 int matrix_dirty;
+int matrix_serial;
 int matrix_mode = GL_MODELVIEW;
 
+/* GL_TEXTURE, for each unit */
+static int texture_current;
+static float matrix_texture[2][16];
+static int matrix_texture_set[2];
+static int matrix_texture_serial[2];
+
 void
 matrix_identity_set(float *matrix)
 {
@@ -528,6 +891,9 @@ matrix_identity_set(float *matrix)
 	matrix[15] = 1.0;
 }
 
+/*
+ * The programs pick up the new transform when they are next used.
+ */
 void
 matrix_upload(void)
 {
@@ -559,17 +925,7 @@ matrix_upload(void)
 			(matrix_modelview[i + 3] * matrix_projection[15]);
 	}
 
-	glUseProgram(program_single_texture);
-	glUniformMatrix4fv(program_single_texture_matrix, 1, GL_FALSE,
-			   matrix_transform);
-
-	glUseProgram(program_dual_texture);
-	glUniformMatrix4fv(program_dual_texture_matrix, 1, GL_FALSE,
-			   matrix_transform);
-
-	if (program_current != program_dual_texture)
-		glUseProgram(program_current);
-
+	matrix_serial++;
 	matrix_dirty = 0;
 }
 
@@ -578,6 +934,10 @@ matrix_init(void)
 {
 	matrix_identity_set(matrix_modelview);
 	matrix_identity_set(matrix_projection);
+	matrix_identity_set(matrix_texture[0]);
+	matrix_identity_set(matrix_texture[1]);
+	matrix_texture_set[0] = 0;
+	matrix_texture_set[1] = 0;
 
 	matrix_dirty = 1;
 }
@@ -621,6 +981,13 @@ qglOrthof(float left, float right, float bottom, float top,
 void
 qglLoadMatrixf(const GLfloat *m)
 {
+	if (matrix_mode == GL_TEXTURE) {
+		memcpy(matrix_texture[texture_current], m, 16 * sizeof(float));
+		matrix_texture_set[texture_current] = 1;
+		matrix_texture_serial[texture_current]++;
+		return;
+	}
+
 	if (matrix_mode == GL_PROJECTION)
 		memcpy(matrix_projection, m, 16 * sizeof(float));
 	else
@@ -632,6 +999,12 @@ qglLoadMatrixf(const GLfloat *m)
 void
 qglLoadIdentity(void)
 {
+	if (matrix_mode == GL_TEXTURE) {
+		/* the programs without PROGRAM_MATRIX are used instead */
+		matrix_texture_set[texture_current] = 0;
+		return;
+	}
+
 	if (matrix_mode == GL_PROJECTION)
 		matrix_identity_set(matrix_projection);
 	else
@@ -656,10 +1029,11 @@ GLimp_Init(void)
 {
 	EGLint major, minor;
 	int fb_width, fb_height;
-	int ret;
 
 	ri.Printf(PRINT_ALL, "Initializing GLESv2 backend.\n");
 
+	egl_state_reset();
+
 	bzero(&glConfig, sizeof(glConfig));
 
 	fbdev_size(&fb_width, &fb_height);
@@ -687,17 +1061,10 @@ GLimp_Init(void)
 	glConfig.driverType = GLDRV_ICD;
 	glConfig.hardwareType = GLHW_GENERIC;
 
-	ret = program_single_texture_load();
-	if (ret)
-		return;
-
-	ret = program_dual_texture_load();
-	if (ret)
+	/* the rest are built when a draw first needs them */
+	if (!program_get(PROGRAM_TEXTURE1) || !program_get(0))
 		return;
 
-	glUseProgram(program_single_texture);
-	program_current = program_single_texture;
-
 	qglMultiTexCoord2fARB = qglMultiTexCoord2f;
 	qglActiveTextureARB = qglActiveTexture;
 	qglClientActiveTextureARB = qglClientActiveTexture;
@@ -733,11 +1100,18 @@ void GLimp_EndFrame(void)
 	frame_count++;
 }
 
+static void stream_shutdown(void);
+
 void GLimp_Shutdown(void)
 {
 	IN_Shutdown();
 
 	glFinish();
+
+	program_shutdown();
+	stream_shutdown();
+
+	egl_state_reset();
 }
 
 void qglCallList(GLuint list)
@@ -749,26 +1123,16 @@ void GLimp_SetGamma(unsigned char red[256], unsigned char green[256],
 {
 }
 
-qboolean GLimp_SpawnRenderThread(void (*function) (void))
-{
-	return qfalse;
-}
-
-void GLimp_FrontEndSleep(void)
-{
-}
-
-void *GLimp_RendererSleep(void)
-{
-	return NULL;
-}
-
-void GLimp_RenderThreadWrapper(void *data)
-{
-}
-
-void GLimp_WakeRenderer(void *data)
+/*
+ * The SMP render thread in egl_smp.c moves the context between threads.
+ */
+void GLimp_SetCurrentContext(qboolean current)
 {
+	if (current)
+		eglMakeCurrent(eglDisplay, eglSurface, eglSurface, eglContext);
+	else
+		eglMakeCurrent(eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE,
+			       EGL_NO_CONTEXT);
 }
 
 void
@@ -776,21 +1140,6 @@ qglDrawBuffer(GLenum mode)
 {
 }
 
-void
-qglNumVertices(GLint count)
-{
-}
-
-void
-qglLockArrays(GLint j, GLsizei size)
-{
-}
-
-void
-qglUnlockArrays(void)
-{
-}
-
 /*
  *
  * Actual GL calls.
@@ -814,10 +1163,17 @@ qglClearDepthf(GLclampf depth)
 	glClearDepthf(depth);
 }
 
+/*
+ * The alpha test is done by the PROGRAM_ALPHA_* programs. GL_State only
+ * has GT0, LT128 and GE128, so the function implies the reference.
+ */
+static int alpha_test;
+static GLenum alpha_func = GL_ALWAYS;
+
 void
 qglAlphaFunc(GLenum func, GLclampf ref)
 {
-	//glAlphaFunc(func, ref);
+	alpha_func = func;
 }
 
 void
@@ -851,7 +1207,7 @@ qglDepthRangef(GLclampf zNear, GLclampf zFar)
 }
 
 void
-qglBlendFunc(GLenum sfactor, GLenum dfactor)
+glimp_blend_func(GLenum sfactor, GLenum dfactor)
 {
 	glBlendFunc(sfactor, dfactor);
 }
@@ -863,7 +1219,7 @@ qglDepthMask(GLboolean flag)
 }
 
 void
-qglDepthFunc(GLenum func)
+glimp_depth_func(GLenum func)
 {
 	glDepthFunc(func);
 }
@@ -882,7 +1238,6 @@ static int color_size;
 static int color_pitch;
 static const unsigned int *color_ptr;
 
-static int texture_current;
 static int texture_coord_current;
 
 static int texture0_active;
@@ -901,8 +1256,186 @@ static int vertex_size;
 static int vertex_pitch;
 static const unsigned int *vertex_ptr;
 
+static int normal_active;
+static int normal_pitch;
+static const unsigned int *normal_ptr;
+
+/* qglColor4f, used when the color array is off */
+static GLfloat color_current[4] = { 1.0, 1.0, 1.0, 1.0 };
+
+/* GL_TEXTURE_ENV_MODE of each unit */
+static GLenum texture_env[2] = { GL_MODULATE, GL_MODULATE };
+
+/*
+ * Texture coordinates the vertex program generates, instead of reading
+ * them from the unit's array, see qglTexGenEnvironment and qglTexGenFog.
+ */
+enum {
+	TEXGEN_NONE,
+	TEXGEN_ENVIRONMENT,
+	TEXGEN_FOG
+};
+
+static int texgen[2];
+static GLfloat texgen_view_origin[3];
+static GLfloat texgen_fog_distance[4];
+static GLfloat texgen_fog_depth[4];
+static GLfloat texgen_fog_eye;
+static int texgen_serial;
+
+/* qglDeformVertexes, as PROGRAM_DEFORM codes */
+static int deforms[QGL_MAX_DEFORMS];
+static GLfloat deform_params[QGL_MAX_DEFORMS][4];
+static int deform_serial;
+
+static int deform_coord_pitch;
+static const unsigned int *deform_coord_ptr;
+
+/* the generic vertex attribute arrays that are enabled */
+static unsigned int attrib_arrays;
+
+/*
+ * Buffer objects bound by the renderer. Like in GL, each array
+ * remembers the buffer that was bound when its pointer was set.
+ */
+static GLuint array_buffer;
+static GLuint color_buffer;
+static GLuint coord0_buffer;
+static GLuint coord1_buffer;
+static GLuint vertex_buffer;
+static GLuint normal_buffer;
+static GLuint deform_coord_buffer;
+static GLuint bound_array_buffer;
+
+static void
+array_buffer_bind(GLuint buffer)
+{
+	if (bound_array_buffer == buffer)
+		return;
+
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	bound_array_buffer = buffer;
+}
+
+/*
+ * Arrays locked by the tessellator are streamed into a buffer object.
+ * The lock gives the vertex range, so the driver doesn't have to scan
+ * the indices to find out how much of each client array to copy, and
+ * the positions, which don't change while locked, are only uploaded
+ * once for all the stages.
+ *
+ * Every upload goes behind the previous one, so it never overwrites
+ * data a queued draw still reads and the driver doesn't have to wait
+ * for the GPU. A full buffer is orphaned and filled from the start.
+ */
+#define STREAM_REGION_SIZE	(SHADER_MAX_VERTEXES * 16)
+#define STREAM_BUFFER_SIZE	(STREAM_REGION_SIZE * 64)
+
+static GLuint stream_buffer;
+static int stream_offset;
+static int locked_first;
+static int locked_count;
+static const unsigned int *locked_vertex_ptr;
+static const unsigned int *locked_normal_ptr;
+static const unsigned int *locked_deform_coord_ptr;
+static const GLvoid *locked_vertex_offset;
+static const GLvoid *locked_normal_offset;
+static const GLvoid *locked_deform_coord_offset;
+
 void
-qglEnable(GLenum cap)
+qglNumVertices(GLint count)
+{
+}
+
+void
+qglLockArrays(GLint first, GLsizei size)
+{
+	if (!stream_buffer) {
+		glGenBuffers(1, &stream_buffer);
+		array_buffer_bind(stream_buffer);
+		glBufferData(GL_ARRAY_BUFFER, STREAM_BUFFER_SIZE, NULL,
+			     GL_STREAM_DRAW);
+		stream_offset = 0;
+	}
+
+	locked_first = first;
+	locked_count = size;
+	locked_vertex_ptr = NULL;
+	locked_normal_ptr = NULL;
+	locked_deform_coord_ptr = NULL;
+}
+
+void
+qglUnlockArrays(void)
+{
+	locked_count = 0;
+	locked_vertex_ptr = NULL;
+	locked_normal_ptr = NULL;
+	locked_deform_coord_ptr = NULL;
+}
+
+static int
+stream_fits(int pitch)
+{
+	return (locked_first + locked_count) * pitch <= STREAM_REGION_SIZE;
+}
+
+/* the space an array of the locked range takes in the stream buffer */
+static int
+stream_size(int pitch)
+{
+	return ((locked_first + locked_count) * pitch + 15) & ~15;
+}
+
+/*
+ * Makes room for the arrays of a draw. The driver gives an orphaned
+ * buffer new storage, so the arrays kept from earlier draws are gone
+ * and have to be uploaded again.
+ */
+static void
+stream_reserve(int size)
+{
+	if (stream_offset + size <= STREAM_BUFFER_SIZE)
+		return;
+
+	glBufferData(GL_ARRAY_BUFFER, STREAM_BUFFER_SIZE, NULL,
+		     GL_STREAM_DRAW);
+	stream_offset = 0;
+	locked_vertex_ptr = NULL;
+	locked_normal_ptr = NULL;
+	locked_deform_coord_ptr = NULL;
+}
+
+/*
+ * Returns the offset of the array in the stream buffer, for
+ * glVertexAttribPointer.
+ */
+static const GLvoid *
+stream_upload(const void *ptr, int pitch)
+{
+	int offset = stream_offset;
+
+	glBufferSubData(GL_ARRAY_BUFFER, offset + locked_first * pitch,
+			locked_count * pitch,
+			(const char *) ptr + locked_first * pitch);
+	stream_offset += stream_size(pitch);
+
+	return (const GLvoid *) (size_t) offset;
+}
+
+static void
+stream_shutdown(void)
+{
+	if (stream_buffer) {
+		glDeleteBuffers(1, &stream_buffer);
+		stream_buffer = 0;
+	}
+	bound_array_buffer = 0;
+	attrib_arrays = 0;
+}
+
+void
+glimp_enable(GLenum cap)
 {
 	if (cap == GL_TEXTURE_2D) {
 		if (texture_current)
@@ -910,13 +1443,13 @@ qglEnable(GLenum cap)
 		else
 			texture0_active = 1;
 	} else if (cap == GL_ALPHA_TEST)
-		;
+		alpha_test = 1;
 	else
 		glEnable(cap);
 }
 
 void
-qglDisable(GLenum cap)
+glimp_disable(GLenum cap)
 {
 	if (cap == GL_TEXTURE_2D) {
 		if (texture_current)
@@ -924,19 +1457,19 @@ qglDisable(GLenum cap)
 		else
 			texture0_active = 0;
 	} else if (cap == GL_ALPHA_TEST)
-		;
+		alpha_test = 0;
 	else
 		glDisable(cap);
 }
 
 void
-qglDeleteTextures(GLsizei n, const GLuint *textures)
+glimp_delete_textures(GLsizei n, const GLuint *textures)
 {
 	glDeleteTextures(n, textures);
 }
 
 void
-qglBindTexture(GLenum target, GLuint id)
+glimp_bind_texture(GLenum target, GLuint id)
 {
 	glBindTexture(target, id);
 }
@@ -951,13 +1484,13 @@ qglTexImage2D(GLenum target, GLint level, GLint internalformat,
 }
 
 void
-qglTexParameteri(GLenum target, GLenum pname, GLint param)
+glimp_tex_parameteri(GLenum target, GLenum pname, GLint param)
 {
 	glTexParameteri(target, pname, param);
 }
 
 void
-qglActiveTexture(GLenum texture)
+glimp_active_texture(GLenum texture)
 {
 	//printf("%s(%s);\n", __func__, GLEnumString(texture));
 
@@ -1006,6 +1539,10 @@ qglDisableClientState(GLenum array)
 		color_size = 0;
 		color_pitch = 0;
 		color_ptr = NULL;
+	} else if (array == GL_NORMAL_ARRAY) {
+		normal_active = 0;
+		normal_pitch = 0;
+		normal_ptr = NULL;
 	} else if (array != GL_VERTEX_ARRAY)
 		fprintf(stderr, "%s: Error: unknown array: 0x%04X\n",
 		       __func__, array);
@@ -1023,6 +1560,8 @@ qglEnableClientState(GLenum array)
 			coord0_active = 1;
 	} else if (array == GL_COLOR_ARRAY)
 		color_active = 1;
+	else if (array == GL_NORMAL_ARRAY)
+		normal_active = 1;
 	else if (array != GL_VERTEX_ARRAY)
 		fprintf(stderr, "%s: Error: unknown array: 0x%04X\n",
 			__func__, array);
@@ -1041,10 +1580,12 @@ qglTexCoordPointer(GLint size, GLenum type, GLsizei stride,
 		coord1_size = size;
 		coord1_pitch = stride;
 		coord1_ptr = pointer;
+		coord1_buffer = array_buffer;
 	} else {
 		coord0_size = size;
 		coord0_pitch = stride;
 		coord0_ptr = pointer;
+		coord0_buffer = array_buffer;
 	}
 }
 
@@ -1060,6 +1601,7 @@ qglColorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
 		color_size = size;
 		color_pitch = stride;
 		color_ptr = pointer;
+		color_buffer = array_buffer;
 	} else
 		fprintf(stderr, "%s: Error: color is not active.\n",
 		       __func__);
@@ -1076,80 +1618,438 @@ qglVertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid *pointer)
 	vertex_size = size;
 	vertex_pitch = stride;
 	vertex_ptr = pointer;
+	vertex_buffer = array_buffer;
 }
 
 void
-qglDrawElements(GLenum mode, GLsizei indices_count, GLenum type,
-		const GLvoid *ptr)
+qglNormalPointer(GLenum type, GLsizei stride, const GLvoid *pointer)
 {
-#if 0
-	const unsigned short *indices = ptr;
-	int count = 0;
-	int i;
-
-	if (type != GL_UNSIGNED_SHORT) {
+	if (type != GL_FLOAT) {
 		fprintf(stderr, "%s: Error: unsupported type.\n", __func__);
 		return;
 	}
 
-	for (i = 0; i < indices_count; i++)
-		if (indices[i] > count)
-			count = indices[i];
-	count++;
-#endif
+	normal_pitch = stride;
+	normal_ptr = pointer;
+	normal_buffer = array_buffer;
+}
+
+/*
+ * Everything but turbulent tcMods, the per vertex lighting and the
+ * colors adjusted for fog can be left to the programs.
+ */
+int
+qglStageFeatures(void)
+{
+	return QGL_STAGE_CONSTANT_COLOR | QGL_STAGE_TEXTURE_MATRIX |
+		QGL_STAGE_ENVIRONMENT | QGL_STAGE_FOG | QGL_STAGE_DEFORM;
+}
+
+/*
+ * The environment mapping of RB_CalcEnvironmentTexCoords, for the
+ * active texture unit. Needs the normal array.
+ */
+void
+qglTexGenEnvironment(const GLfloat *viewOrigin)
+{
+	if (!viewOrigin) {
+		texgen[texture_current] = TEXGEN_NONE;
+		return;
+	}
+
+	texgen[texture_current] = TEXGEN_ENVIRONMENT;
+	memcpy(texgen_view_origin, viewOrigin, sizeof(texgen_view_origin));
+	texgen_serial++;
+}
+
+/*
+ * The fog coordinates of RB_CalcFogTexCoords, for the active texture
+ * unit. The eye is outside of the fog volume when eyeT is negative.
+ */
+void
+qglTexGenFog(const GLfloat *distance, const GLfloat *depth, GLfloat eyeT)
+{
+	if (!distance) {
+		texgen[texture_current] = TEXGEN_NONE;
+		return;
+	}
+
+	texgen[texture_current] = TEXGEN_FOG;
+	memcpy(texgen_fog_distance, distance, sizeof(texgen_fog_distance));
+	memcpy(texgen_fog_depth, depth, sizeof(texgen_fog_depth));
+	texgen_fog_eye = eyeT;
+	texgen_serial++;
+}
+
+/*
+ * Sets the deform at the index, see QGL_DEFORM_*. All but the move
+ * deform need the normal array.
+ */
+void
+qglDeformVertexes(int index, int type, int wave, const GLfloat *params)
+{
+	if (index < 0 || index >= QGL_MAX_DEFORMS ||
+	    type < QGL_DEFORM_NONE || type > QGL_DEFORM_WAVE ||
+	    wave < QGL_WAVE_SIN || wave >= PROGRAM_WAVES) {
+		fprintf(stderr, "%s: Error: unsupported deform %d/%d\n",
+			__func__, type, wave);
+		return;
+	}
+
+	if (type == QGL_DEFORM_WAVE)
+		type += wave;
+	deforms[index] = type;
+
+	if (type != QGL_DEFORM_NONE) {
+		memcpy(deform_params[index], params,
+		       sizeof(deform_params[index]));
+		deform_serial++;
+	}
+}
+
+/*
+ * The untransformed texture coordinates the bulge deform reads.
+ */
+void
+qglDeformTexCoordPointer(GLsizei stride, const GLvoid *pointer)
+{
+	deform_coord_pitch = stride;
+	deform_coord_ptr = pointer;
+	deform_coord_buffer = array_buffer;
+}
+
+void
+qglGenBuffers(GLsizei n, GLuint *buffers)
+{
+	glGenBuffers(n, buffers);
+}
+
+void
+qglDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+	int i;
+
+	for (i = 0; i < n; i++) {
+		if (array_buffer == buffers[i])
+			array_buffer = 0;
+		if (bound_array_buffer == buffers[i])
+			bound_array_buffer = 0;
+	}
+
+	glDeleteBuffers(n, buffers);
+}
+
+void
+qglBindBuffer(GLenum target, GLuint buffer)
+{
+	/* array buffers are bound for each attribute when drawing */
+	if (target == GL_ARRAY_BUFFER)
+		array_buffer = buffer;
+	else
+		glBindBuffer(target, buffer);
+}
+
+void
+qglBufferData(GLenum target, GLsizeiptr size, const GLvoid *data,
+	      GLenum usage)
+{
+	if (target == GL_ARRAY_BUFFER)
+		array_buffer_bind(array_buffer);
+
+	glBufferData(target, size, data, usage);
+}
+
+static unsigned int
+program_key(int dual)
+{
+	unsigned int key = 0, bits;
+	int unit, index;
+
+	if (dual)
+		key |= PROGRAM_TEXTURE1;
+
+	if (alpha_test) {
+		if (alpha_func == GL_GREATER)
+			key |= PROGRAM_ALPHA_GT0;
+		else if (alpha_func == GL_LESS)
+			key |= PROGRAM_ALPHA_LT128;
+		else if (alpha_func == GL_GEQUAL)
+			key |= PROGRAM_ALPHA_GE128;
+	}
+
+	for (unit = 0; unit < (dual ? 2 : 1); unit++) {
+		bits = 0;
+
+		if (texture_env[unit] == GL_REPLACE)
+			bits |= PROGRAM_ENV_REPLACE;
+		else if (texture_env[unit] == GL_ADD)
+			bits |= PROGRAM_ENV_ADD;
+		else if (texture_env[unit] == GL_DECAL)
+			bits |= PROGRAM_ENV_DECAL;
+
+		if (matrix_texture_set[unit])
+			bits |= PROGRAM_MATRIX;
+
+		if (texgen[unit] == TEXGEN_ENVIRONMENT)
+			bits |= PROGRAM_ENVIRONMENT;
+		else if (texgen[unit] == TEXGEN_FOG)
+			bits |= PROGRAM_FOG;
+
+		key |= bits << (unit * PROGRAM_UNIT_SHIFT);
+	}
+
+	for (index = 0; index < QGL_MAX_DEFORMS; index++)
+		key |= deforms[index] << (PROGRAM_DEFORM_SHIFT +
+					 index * PROGRAM_DEFORM_BITS);
+
+	return key;
+}
+
+/*
+ * Brings the uniforms of the current program up to date.
+ */
+static void
+program_uniforms(struct program *program)
+{
+	int unit, index;
+
+	if (program->matrix_serial != matrix_serial) {
+		glUniformMatrix4fv(program->matrix, 1, GL_FALSE,
+				   matrix_transform);
+		program->matrix_serial = matrix_serial;
+	}
+
+	for (unit = 0; unit < 2; unit++) {
+		if (program->texture_matrix[unit] == -1 ||
+		    program->texture_matrix_serial[unit] ==
+		    matrix_texture_serial[unit])
+			continue;
+
+		glUniformMatrix4fv(program->texture_matrix[unit], 1, GL_FALSE,
+				   matrix_texture[unit]);
+		program->texture_matrix_serial[unit] =
+			matrix_texture_serial[unit];
+	}
+
+	if (program->texgen_serial != texgen_serial) {
+		if (program->view_origin != -1)
+			glUniform3fv(program->view_origin, 1,
+				     texgen_view_origin);
+		if (program->fog_distance != -1) {
+			glUniform4fv(program->fog_distance, 1,
+				     texgen_fog_distance);
+			glUniform4fv(program->fog_depth, 1, texgen_fog_depth);
+			glUniform1f(program->fog_eye, texgen_fog_eye);
+		}
+		program->texgen_serial = texgen_serial;
+	}
+
+	if (program->deform_serial != deform_serial) {
+		for (index = 0; index < QGL_MAX_DEFORMS; index++)
+			if (program->deform[index] != -1)
+				glUniform4fv(program->deform[index], 1,
+					     deform_params[index]);
+		program->deform_serial = deform_serial;
+	}
+}
+
+static void
+attrib_arrays_enable(unsigned int arrays)
+{
+	unsigned int changed = arrays ^ attrib_arrays;
+	int i;
+
+	for (i = 0; i < ATTRIB_COUNT; i++) {
+		if (!(changed & (1 << i)))
+			continue;
+
+		if (arrays & (1 << i))
+			glEnableVertexAttribArray(i);
+		else
+			glDisableVertexAttribArray(i);
+	}
+
+	attrib_arrays = arrays;
+}
+
+void
+qglDrawElements(GLenum mode, GLsizei indices_count, GLenum type,
+		const GLvoid *ptr)
+{
+	struct program *program;
+	unsigned int arrays;
+	int dual, stream, size, index;
+	int vpitch, cpitch, t0pitch, t1pitch, npitch, dpitch;
 
 	if (matrix_dirty)
 		matrix_upload();
 
-	/* Switch programs. */
-	if (!color_active) {
-		printf("%s: Error: draw %d has no colors\n",
+	if (!texture0_active || (!coord0_active && !texgen[0])) {
+		printf("%s: Error: draw %d has no textures\n",
 		       __func__, draw_count);
 		return;
-	} else if (!coord0_active || !texture0_active) {
-		printf("%s: Error: draw %d has no textures\n",
+	}
+
+	dual = texture1_active && (coord1_active || texgen[1]);
+
+	/* the arrays the program reads */
+	arrays = 1 << ATTRIB_POSITION;
+	if (color_active)
+		arrays |= 1 << ATTRIB_COLOR;
+	if (!texgen[0])
+		arrays |= 1 << ATTRIB_TEXCOORD0;
+	if (dual && !texgen[1])
+		arrays |= 1 << ATTRIB_TEXCOORD1;
+	if (texgen[0] == TEXGEN_ENVIRONMENT ||
+	    (dual && texgen[1] == TEXGEN_ENVIRONMENT))
+		arrays |= 1 << ATTRIB_NORMAL;
+	for (index = 0; index < QGL_MAX_DEFORMS; index++) {
+		if (deforms[index] != QGL_DEFORM_NONE &&
+		    deforms[index] != QGL_DEFORM_MOVE)
+			arrays |= 1 << ATTRIB_NORMAL;
+		if (deforms[index] == QGL_DEFORM_BULGE)
+			arrays |= 1 << ATTRIB_DEFORM_COORD;
+	}
+	if ((arrays & (1 << ATTRIB_NORMAL)) && !normal_active) {
+		printf("%s: Error: draw %d has no normals\n",
 		       __func__, draw_count);
 		return;
-	} else if (!coord1_active || !texture1_active) {
-		//printf("%s: coord1 is not active!\n", __func__);
+	}
+
+	program = program_get(program_key(dual));
+	if (!program)
+		return;
+	program_uniforms(program);
+
+	vpitch = vertex_pitch ? vertex_pitch : vertex_size * 4;
+	cpitch = color_pitch ? color_pitch : color_size;
+	t0pitch = coord0_pitch ? coord0_pitch : coord0_size * 4;
+	t1pitch = coord1_pitch ? coord1_pitch : coord1_size * 4;
+	npitch = normal_pitch ? normal_pitch : 3 * 4;
+	dpitch = deform_coord_pitch ? deform_coord_pitch : 2 * 4;
+
+	/*
+	 * Only the arrays in the mask are streamed, it already leaves out
+	 * inactive colors and texture coordinates, like the client array
+	 * path below.
+	 */
+	stream = locked_count && !vertex_buffer && stream_fits(vpitch);
+	size = stream_size(vpitch);
+	if (arrays & (1 << ATTRIB_COLOR)) {
+		stream = stream && !color_buffer && stream_fits(cpitch);
+		size += stream_size(cpitch);
+	}
+	if (arrays & (1 << ATTRIB_TEXCOORD0)) {
+		stream = stream && !coord0_buffer && stream_fits(t0pitch);
+		size += stream_size(t0pitch);
+	}
+	if (arrays & (1 << ATTRIB_TEXCOORD1)) {
+		stream = stream && !coord1_buffer && stream_fits(t1pitch);
+		size += stream_size(t1pitch);
+	}
+	if (arrays & (1 << ATTRIB_NORMAL)) {
+		stream = stream && !normal_buffer && stream_fits(npitch);
+		size += stream_size(npitch);
+	}
+	if (arrays & (1 << ATTRIB_DEFORM_COORD)) {
+		stream = stream && !deform_coord_buffer && stream_fits(dpitch);
+		size += stream_size(dpitch);
+	}
+
+	if (stream) {
+		array_buffer_bind(stream_buffer);
+		stream_reserve(size);
 
-		if (program_current != program_single_texture) {
-			glUseProgram(program_single_texture);
-			program_current = program_single_texture;
+		if (vertex_ptr != locked_vertex_ptr) {
+			locked_vertex_offset = stream_upload(vertex_ptr, vpitch);
+			locked_vertex_ptr = vertex_ptr;
+		}
+		glVertexAttribPointer(ATTRIB_POSITION, vertex_size, GL_FLOAT,
+				      GL_FALSE, vpitch, locked_vertex_offset);
+
+		if (arrays & (1 << ATTRIB_COLOR))
+			glVertexAttribPointer(ATTRIB_COLOR, color_size,
+					      GL_UNSIGNED_BYTE, GL_TRUE, cpitch,
+					      stream_upload(color_ptr, cpitch));
+
+		if (arrays & (1 << ATTRIB_TEXCOORD0))
+			glVertexAttribPointer(ATTRIB_TEXCOORD0, coord0_size,
+					      GL_FLOAT, GL_FALSE, t0pitch,
+					      stream_upload(coord0_ptr, t0pitch));
+
+		if (arrays & (1 << ATTRIB_TEXCOORD1))
+			glVertexAttribPointer(ATTRIB_TEXCOORD1, coord1_size,
+					      GL_FLOAT, GL_FALSE, t1pitch,
+					      stream_upload(coord1_ptr, t1pitch));
+
+		/* like the positions, normals don't change while locked */
+		if (arrays & (1 << ATTRIB_NORMAL)) {
+			if (normal_ptr != locked_normal_ptr) {
+				locked_normal_offset =
+					stream_upload(normal_ptr, npitch);
+				locked_normal_ptr = normal_ptr;
+			}
+			glVertexAttribPointer(ATTRIB_NORMAL, 3, GL_FLOAT,
+					      GL_FALSE, npitch,
+					      locked_normal_offset);
+		}
+
+		if (arrays & (1 << ATTRIB_DEFORM_COORD)) {
+			if (deform_coord_ptr != locked_deform_coord_ptr) {
+				locked_deform_coord_offset =
+					stream_upload(deform_coord_ptr, dpitch);
+				locked_deform_coord_ptr = deform_coord_ptr;
+			}
+			glVertexAttribPointer(ATTRIB_DEFORM_COORD, 2, GL_FLOAT,
+					      GL_FALSE, dpitch,
+					      locked_deform_coord_offset);
 		}
 	} else {
-		//printf("%s: coord1 is active!\n", __func__);
+		array_buffer_bind(vertex_buffer);
+		glVertexAttribPointer(ATTRIB_POSITION, vertex_size, GL_FLOAT,
+				      GL_FALSE, vertex_pitch, vertex_ptr);
+
+		if (arrays & (1 << ATTRIB_COLOR)) {
+			array_buffer_bind(color_buffer);
+			glVertexAttribPointer(ATTRIB_COLOR, color_size,
+					      GL_UNSIGNED_BYTE, GL_TRUE,
+					      color_pitch, color_ptr);
+		}
 
-		if (program_current != program_dual_texture) {
-			glUseProgram(program_dual_texture);
-			program_current = program_dual_texture;
+		if (arrays & (1 << ATTRIB_TEXCOORD0)) {
+			array_buffer_bind(coord0_buffer);
+			glVertexAttribPointer(ATTRIB_TEXCOORD0, coord0_size,
+					      GL_FLOAT, GL_FALSE, coord0_pitch,
+					      coord0_ptr);
 		}
-	}
 
-	glVertexAttribPointer(0, vertex_size, GL_FLOAT,
-			      GL_FALSE, vertex_pitch, vertex_ptr);
-	glEnableVertexAttribArray(0);
+		if (arrays & (1 << ATTRIB_TEXCOORD1)) {
+			array_buffer_bind(coord1_buffer);
+			glVertexAttribPointer(ATTRIB_TEXCOORD1, coord1_size,
+					      GL_FLOAT, GL_FALSE, coord1_pitch,
+					      coord1_ptr);
+		}
 
-	if (color_active) {
-		glVertexAttribPointer(1, color_size, GL_UNSIGNED_BYTE,
-				      GL_TRUE, color_pitch, color_ptr);
-		glEnableVertexAttribArray(1);
-	} else
-		printf("Color is not active!\n");
+		if (arrays & (1 << ATTRIB_NORMAL)) {
+			array_buffer_bind(normal_buffer);
+			glVertexAttribPointer(ATTRIB_NORMAL, 3, GL_FLOAT,
+					      GL_FALSE, normal_pitch,
+					      normal_ptr);
+		}
 
-	if (coord0_active && texture0_active) {
-		//printf("coord0: %d, %d, %p\n", coord0_size, coord0_pitch, coord0_ptr);
-		glVertexAttribPointer(2, coord0_size, GL_FLOAT,
-				      GL_FALSE, coord0_pitch, coord0_ptr);
-		glEnableVertexAttribArray(2);
+		if (arrays & (1 << ATTRIB_DEFORM_COORD)) {
+			array_buffer_bind(deform_coord_buffer);
+			glVertexAttribPointer(ATTRIB_DEFORM_COORD, 2, GL_FLOAT,
+					      GL_FALSE, deform_coord_pitch,
+					      deform_coord_ptr);
+		}
 	}
 
-	if (coord1_active && texture1_active) {
-		//printf("coord1: %d, %d, %p\n", coord1_size, coord1_pitch, coord1_ptr);
-		glVertexAttribPointer(3, coord1_size, GL_FLOAT,
-				      GL_FALSE, coord1_pitch, coord1_ptr);
-		glEnableVertexAttribArray(3);
-	}
+	/* the color of the whole draw when there is no array */
+	if (!(arrays & (1 << ATTRIB_COLOR)))
+		glVertexAttrib4fv(ATTRIB_COLOR, color_current);
+
+	attrib_arrays_enable(arrays);
 
 	glDrawElements(GL_TRIANGLES, indices_count,
 		       GL_UNSIGNED_SHORT, ptr);
@@ -1203,7 +2103,10 @@ qglClipPlanef(GLenum plane, const GLfloat *equation)
 void
 qglColor4f (GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
-	fprintf(stderr, "Error: %s() called!\n", __func__);
+	color_current[0] = red;
+	color_current[1] = green;
+	color_current[2] = blue;
+	color_current[3] = alpha;
 }
 
 void
@@ -1227,7 +2130,7 @@ qglMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
 void
 qglTexEnvf(GLenum target, GLenum pname, GLfloat param)
 {
-	fprintf(stderr, "Error: %s() called!\n", __func__);
+	qglTexEnvi(target, pname, param);
 }
 
 void
@@ -1317,5 +2220,11 @@ qglStencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 void
 qglTexEnvi(GLenum target, GLenum pname, GLint param)
 {
-	fprintf(stderr, "Error: %s() called!\n", __func__);
+	if (target != GL_TEXTURE_ENV || pname != GL_TEXTURE_ENV_MODE) {
+		fprintf(stderr, "%s: Error: unsupported parameter 0x%04X\n",
+			__func__, pname);
+		return;
+	}
+
+	texture_env[texture_current] = param;
 }
@@ -225,6 +225,8 @@ GLimp_Init(void)
 
 	ri.Printf(PRINT_ALL, "Initializing Limare backend.\n");
 
+	egl_state_reset();
+
 	state = limare_init();
 	if (!state)
 		return;
@@ -314,6 +316,8 @@ void GLimp_Shutdown(void)
 	IN_Shutdown();
 
 	limare_finish(state);
+
+	egl_state_reset();
 }
 
 void qglCallList(GLuint list)
@@ -325,25 +329,12 @@ void GLimp_SetGamma(unsigned char red[256], unsigned char green[256],
 {
 }
 
-qboolean GLimp_SpawnRenderThread(void (*function) (void))
-{
-	return qfalse;
-}
-
-void GLimp_FrontEndSleep(void)
-{
-}
-
-void *GLimp_RendererSleep(void)
-{
-	return NULL;
-}
-
-void GLimp_RenderThreadWrapper(void *data)
-{
-}
-
-void GLimp_WakeRenderer(void *data)
+/*
+ * Limare is not bound to a thread, the SMP handshake in egl_smp.c
+ * already keeps the front end and the render thread from drawing
+ * at the same time.
+ */
+void GLimp_SetCurrentContext(qboolean current)
 {
 }
 
@@ -352,21 +343,6 @@ qglDrawBuffer(GLenum mode)
 {
 }
 
-void
-qglNumVertices(GLint count)
-{
-}
-
-void
-qglLockArrays(GLint j, GLsizei size)
-{
-}
-
-void
-qglUnlockArrays(void)
-{
-}
-
 /*
  *
  * Actual GL calls.
@@ -427,7 +403,7 @@ qglDepthRangef(GLclampf zNear, GLclampf zFar)
 }
 
 void
-qglBlendFunc(GLenum sfactor, GLenum dfactor)
+glimp_blend_func(GLenum sfactor, GLenum dfactor)
 {
 	limare_blend_func(state, sfactor, dfactor);
 }
@@ -439,7 +415,7 @@ qglDepthMask(GLboolean flag)
 }
 
 void
-qglDepthFunc(GLenum func)
+glimp_depth_func(GLenum func)
 {
 	limare_depth_func(state, func);
 }
@@ -467,10 +443,12 @@ static int texture_id;
 static int texture_handles[TEXTURE_HANDLE_COUNT];
 
 static int texture_dump_start;
-static int texture_filter_min;
-static int texture_filter_mag;
-static int texture_wrap_s;
-static int texture_wrap_t;
+
+/*
+ * The parameters themselves are kept by egl_state.c, which drops the
+ * ones that do not change, so we only note that some got set.
+ */
+static int texture_parameters_dirty;
 
 /*
  * For tracking draws.
@@ -503,6 +481,72 @@ static int vertex_size;
 static int vertex_pitch;
 static const unsigned int *vertex_ptr;
 
+/*
+ * The tessellator locks its arrays over the vertexes it filled in, so
+ * draws know how many attributes to upload without scanning the
+ * indices. Positions don't change while locked, they are only handed
+ * to each program once per lock.
+ */
+static int vertex_count;
+static int locked_count;
+static const unsigned int *locked_vertex_ptr;
+static unsigned int locked_vertex_programs[2];
+static int locked_vertex_program_count;
+
+void
+qglNumVertices(GLint count)
+{
+	vertex_count = count;
+}
+
+void
+qglLockArrays(GLint first, GLsizei size)
+{
+	locked_count = first + size;
+	locked_vertex_ptr = NULL;
+	locked_vertex_program_count = 0;
+}
+
+void
+qglUnlockArrays(void)
+{
+	locked_count = 0;
+	vertex_count = 0;
+	locked_vertex_ptr = NULL;
+	locked_vertex_program_count = 0;
+}
+
+static int
+locked_vertex_uploaded(void)
+{
+	int i;
+
+	if (!locked_count || vertex_ptr != locked_vertex_ptr)
+		return 0;
+
+	for (i = 0; i < locked_vertex_program_count; i++)
+		if (locked_vertex_programs[i] == program_current)
+			return 1;
+
+	return 0;
+}
+
+static void
+locked_vertex_upload(void)
+{
+	if (!locked_count)
+		return;
+
+	if (vertex_ptr != locked_vertex_ptr) {
+		locked_vertex_ptr = vertex_ptr;
+		locked_vertex_program_count = 0;
+	}
+
+	if (locked_vertex_program_count < 2)
+		locked_vertex_programs[locked_vertex_program_count++] =
+			program_current;
+}
+
 /*
  *
  * Handle textures.
@@ -535,7 +579,7 @@ texture_handle_get(int id)
 }
 
 void
-qglEnable(GLenum cap)
+glimp_enable(GLenum cap)
 {
 	if (cap == GL_TEXTURE_2D) {
 		if (texture_current)
@@ -547,7 +591,7 @@ qglEnable(GLenum cap)
 }
 
 void
-qglDisable(GLenum cap)
+glimp_disable(GLenum cap)
 {
 	if (cap == GL_TEXTURE_2D) {
 		if (texture_current)
@@ -558,28 +602,94 @@ qglDisable(GLenum cap)
 		limare_disable(state, cap);
 }
 
+/*
+ * No buffer objects, the zero names keep the renderer on client arrays.
+ */
 void
-qglDeleteTextures(GLsizei n, const GLuint *textures)
+qglGenBuffers(GLsizei n, GLuint *buffers)
 {
-	texture_dump_start = 1;
+	memset(buffers, 0, n * sizeof(*buffers));
 }
 
 void
-qglBindTexture(GLenum target, GLuint id)
+qglDeleteBuffers(GLsizei n, const GLuint *buffers)
 {
-	if (texture_dump_start && texture_filter_min &&
-	    texture_filter_mag && texture_wrap_s && texture_wrap_t) {
-		int handle = texture_handle_get(texture_id);
+}
+
+void
+qglBindBuffer(GLenum target, GLuint buffer)
+{
+}
 
-		limare_texture_parameters(state, handle,
-					  texture_filter_min,
-					  texture_filter_mag,
-					  texture_wrap_s,
-					  texture_wrap_t);
-		texture_filter_min = 0;
-		texture_filter_mag = 0;
-		texture_wrap_s = 0;
-		texture_wrap_t = 0;
+void
+qglBufferData(GLenum target, GLsizeiptr size, const GLvoid *data,
+	      GLenum usage)
+{
+}
+
+/*
+ * Colors and texture coordinates all come from the CPU.
+ */
+int
+qglStageFeatures(void)
+{
+	return 0;
+}
+
+void
+qglNormalPointer(GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+	fprintf(stderr, "Error: %s() called!\n", __func__);
+}
+
+void
+qglTexGenEnvironment(const GLfloat *viewOrigin)
+{
+	fprintf(stderr, "Error: %s() called!\n", __func__);
+}
+
+void
+qglTexGenFog(const GLfloat *distance, const GLfloat *depth, GLfloat eyeT)
+{
+	fprintf(stderr, "Error: %s() called!\n", __func__);
+}
+
+void
+qglDeformVertexes(int index, int deform, int wave, const GLfloat *params)
+{
+	fprintf(stderr, "Error: %s() called!\n", __func__);
+}
+
+void
+qglDeformTexCoordPointer(GLsizei stride, const GLvoid *pointer)
+{
+	fprintf(stderr, "Error: %s() called!\n", __func__);
+}
+
+void
+glimp_delete_textures(GLsizei n, const GLuint *textures)
+{
+	texture_dump_start = 1;
+}
+
+void
+glimp_bind_texture(GLenum target, GLuint id)
+{
+	if (texture_dump_start && texture_parameters_dirty) {
+		int min = egl_state_texture_parameter(texture_id,
+						      GL_TEXTURE_MIN_FILTER);
+		int mag = egl_state_texture_parameter(texture_id,
+						      GL_TEXTURE_MAG_FILTER);
+		int wrap_s = egl_state_texture_parameter(texture_id,
+							 GL_TEXTURE_WRAP_S);
+		int wrap_t = egl_state_texture_parameter(texture_id,
+							 GL_TEXTURE_WRAP_T);
+
+		if (min && mag && wrap_s && wrap_t)
+			limare_texture_parameters(state,
+						  texture_handle_get(texture_id),
+						  min, mag, wrap_s, wrap_t);
+		texture_parameters_dirty = 0;
 	}
 
 	texture_id = id;
@@ -621,23 +731,17 @@ qglTexImage2D(GLenum target, GLint level, GLint internalformat,
 }
 
 void
-qglTexParameteri(GLenum target, GLenum pname, GLint param)
+glimp_tex_parameteri(GLenum target, GLenum pname, GLint param)
 {
 	if (!texture_dump_start)
 		return;
 
 	switch (pname) {
 	case GL_TEXTURE_MIN_FILTER:
-		texture_filter_min = param;
-		return;
 	case GL_TEXTURE_MAG_FILTER:
-		texture_filter_mag = param;
-		return;
 	case GL_TEXTURE_WRAP_S:
-		texture_wrap_s = param;
-		return;
 	case GL_TEXTURE_WRAP_T:
-		texture_wrap_t = param;
+		texture_parameters_dirty = 1;
 		return;
 	default:
 		fprintf(stderr, "%s: unknown pname 0x%04X\n", __func__, pname);
@@ -646,7 +750,7 @@ qglTexParameteri(GLenum target, GLenum pname, GLint param)
 }
 
 void
-qglActiveTexture(GLenum texture)
+glimp_active_texture(GLenum texture)
 {
 	if (texture > GL_TEXTURE1) {
 		printf("Error: %s(%s) not supported\n",
@@ -770,10 +874,16 @@ qglDrawElements(GLenum mode, GLsizei indices_count, GLenum type,
 		return;
 	}
 
-	for (i = 0; i < indices_count; i++)
-		if (indices[i] > count)
-			count = indices[i];
-	count++;
+	if (locked_count)
+		count = locked_count;
+	else if (vertex_count)
+		count = vertex_count;
+	else {
+		for (i = 0; i < indices_count; i++)
+			if (indices[i] > count)
+				count = indices[i];
+		count++;
+	}
 
 	if (matrix_dirty)
 		matrix_upload();
@@ -799,9 +909,13 @@ qglDrawElements(GLenum mode, GLsizei indices_count, GLenum type,
 		}
 	}
 
-	limare_attribute_pointer(state, "aPosition", LIMARE_ATTRIB_FLOAT,
-				 vertex_size, vertex_pitch, count,
-				 (void *) vertex_ptr);
+	if (!locked_vertex_uploaded()) {
+		limare_attribute_pointer(state, "aPosition",
+					 LIMARE_ATTRIB_FLOAT,
+					 vertex_size, vertex_pitch, count,
+					 (void *) vertex_ptr);
+		locked_vertex_upload();
+	}
 
 	if (color_active)
 		limare_attribute_pointer(state, "aColor", LIMARE_ATTRIB_U8N,
@@ -0,0 +1,1095 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <EGL/egl.h>
+#include <GLES/gl.h>
+
+#include "../sys/sys_local.h"
+#include "../qcommon/q_shared.h"
+#include "egl_glimp.h"
+#include "../client/client.h"
+#include "../renderer/tr_local.h"
+
+/*
+ * Null GL backend, built with USE_NULLGL=1.
+ *
+ * Nothing is drawn and no GL library is needed: the qgl* calls only
+ * record the state they set and count the work they were given, so
+ * the whole renderer, front end and back end, runs on a machine
+ * without a GPU. A timedemo then measures the CPU side of rendering
+ * alone. The recorded state can be read back with qglGetIntegerv()
+ * and qglGetBooleanv(), and printed with the nullglinfo command.
+ */
+#define NULL_UNITS		2
+#define NULL_CAPS		32
+#define NULL_STACK_DEPTH	32
+#define NULL_MAX_TEXTURE_SIZE	2048
+
+enum {
+	NULL_MODELVIEW,
+	NULL_PROJECTION,
+	NULL_TEXTURE,
+	NULL_MATRICES
+};
+
+struct null_counters {
+	int calls;
+	int draws;
+	int indices;
+	int vertices;
+	int clears;
+	int texture_uploads;
+	int texture_bytes;
+	int buffer_bytes;
+};
+
+static struct {
+	GLenum caps[NULL_CAPS];
+	int caps_count;
+	int texture_enabled[NULL_UNITS];
+
+	int unit;
+	int client_unit;
+	GLuint bound[NULL_UNITS];
+	GLuint array_buffer;
+	GLuint element_buffer;
+	GLuint buffers;
+
+	GLenum blend_src, blend_dst;
+	GLenum depth_func;
+	GLboolean depth_mask;
+	GLboolean color_mask[4];
+	GLenum alpha_func;
+	GLfloat alpha_ref;
+	GLenum cull_face;
+
+	GLint viewport[4];
+	GLint scissor[4];
+	GLfloat color[4];
+
+	int vertex_array, color_array, normal_array;
+	int texcoord_array[NULL_UNITS];
+
+	int locked_count;
+	int num_vertices;
+
+	int matrix_mode;
+	int matrix_depth[NULL_MATRICES];
+	GLfloat matrix[NULL_MATRICES][NULL_STACK_DEPTH][16];
+
+	int frames;
+	struct null_counters frame;
+	struct null_counters last;
+	struct null_counters total;
+} null;
+
+/*
+ *
+ * State.
+ *
+ */
+static void
+null_call(void)
+{
+	null.frame.calls++;
+}
+
+static int
+null_cap_enabled(GLenum cap)
+{
+	int i;
+
+	if (cap == GL_TEXTURE_2D)
+		return null.texture_enabled[null.unit];
+
+	for (i = 0; i < null.caps_count; i++)
+		if (null.caps[i] == cap)
+			return 1;
+
+	return 0;
+}
+
+static GLfloat *
+null_matrix(void)
+{
+	return null.matrix[null.matrix_mode][null.matrix_depth[null.matrix_mode]];
+}
+
+static void
+null_matrix_identity(GLfloat *m)
+{
+	memset(m, 0, 16 * sizeof(GLfloat));
+	m[0] = m[5] = m[10] = m[15] = 1.0f;
+}
+
+/* m = m * n, column major like GL */
+static void
+null_matrix_multiply(GLfloat *m, const GLfloat *n)
+{
+	GLfloat r[16];
+	int i, j;
+
+	for (i = 0; i < 4; i++)
+		for (j = 0; j < 4; j++)
+			r[j * 4 + i] = m[0 * 4 + i] * n[j * 4 + 0] +
+				m[1 * 4 + i] * n[j * 4 + 1] +
+				m[2 * 4 + i] * n[j * 4 + 2] +
+				m[3 * 4 + i] * n[j * 4 + 3];
+
+	memcpy(m, r, sizeof(r));
+}
+
+static void
+null_reset(void)
+{
+	int i, j;
+
+	memset(&null, 0, sizeof(null));
+
+	null.blend_src = GL_ONE;
+	null.blend_dst = GL_ZERO;
+	null.depth_func = GL_LESS;
+	null.depth_mask = GL_TRUE;
+	for (i = 0; i < 4; i++) {
+		null.color_mask[i] = GL_TRUE;
+		null.color[i] = 1.0f;
+	}
+	null.alpha_func = GL_ALWAYS;
+	null.cull_face = GL_BACK;
+
+	for (i = 0; i < NULL_MATRICES; i++)
+		for (j = 0; j < NULL_STACK_DEPTH; j++)
+			null_matrix_identity(null.matrix[i][j]);
+}
+
+static void
+null_counters_add(struct null_counters *to, const struct null_counters *from)
+{
+	to->calls += from->calls;
+	to->draws += from->draws;
+	to->indices += from->indices;
+	to->vertices += from->vertices;
+	to->clears += from->clears;
+	to->texture_uploads += from->texture_uploads;
+	to->texture_bytes += from->texture_bytes;
+	to->buffer_bytes += from->buffer_bytes;
+}
+
+static void
+null_counters_print(const char *name, const struct null_counters *counters)
+{
+	ri.Printf(PRINT_ALL, "%s: %i calls %i draws %i indices %i vertices "
+		  "%i clears\n", name, counters->calls, counters->draws,
+		  counters->indices, counters->vertices, counters->clears);
+	ri.Printf(PRINT_ALL, "%s: %i texture uploads, %i bytes, %i buffer "
+		  "bytes\n", name, counters->texture_uploads,
+		  counters->texture_bytes, counters->buffer_bytes);
+}
+
+/*
+ * The nullglinfo command.
+ */
+static void
+null_info(void)
+{
+	int i;
+
+	ri.Printf(PRINT_ALL, "null GL after %i frames\n", null.frames);
+
+	ri.Printf(PRINT_ALL, "enabled:");
+	for (i = 0; i < null.caps_count; i++)
+		ri.Printf(PRINT_ALL, " 0x%04X", null.caps[i]);
+	ri.Printf(PRINT_ALL, "\n");
+
+	for (i = 0; i < NULL_UNITS; i++)
+		ri.Printf(PRINT_ALL, "unit %i: texture %u%s, texcoords %s\n",
+			  i, null.bound[i],
+			  null.texture_enabled[i] ? " enabled" : "",
+			  null.texcoord_array[i] ? "on" : "off");
+
+	ri.Printf(PRINT_ALL, "blend 0x%04X 0x%04X, depth 0x%04X mask %i, "
+		  "alpha 0x%04X %g, color mask %i%i%i%i\n",
+		  null.blend_src, null.blend_dst, null.depth_func,
+		  null.depth_mask, null.alpha_func, null.alpha_ref,
+		  null.color_mask[0], null.color_mask[1], null.color_mask[2],
+		  null.color_mask[3]);
+	ri.Printf(PRINT_ALL, "viewport %i %i %i %i, scissor %i %i %i %i\n",
+		  null.viewport[0], null.viewport[1], null.viewport[2],
+		  null.viewport[3], null.scissor[0], null.scissor[1],
+		  null.scissor[2], null.scissor[3]);
+	ri.Printf(PRINT_ALL, "arrays: vertex %s color %s normal %s, "
+		  "buffers %u, matrix depths %i %i %i\n",
+		  null.vertex_array ? "on" : "off",
+		  null.color_array ? "on" : "off",
+		  null.normal_array ? "on" : "off", null.buffers,
+		  null.matrix_depth[NULL_MODELVIEW],
+		  null.matrix_depth[NULL_PROJECTION],
+		  null.matrix_depth[NULL_TEXTURE]);
+
+	null_counters_print("last frame", &null.last);
+	null_counters_print("total", &null.total);
+}
+
+/*
+ *
+ * Window system.
+ *
+ */
+void
+GLimp_Init(void)
+{
+	ri.Printf(PRINT_ALL, "Initializing null GL backend\n");
+
+	egl_state_reset();
+	null_reset();
+
+	bzero(&glConfig, sizeof(glConfig));
+
+	if (!R_GetModeInfo(&glConfig.vidWidth, &glConfig.vidHeight,
+			   &glConfig.windowAspect, r_mode->integer)) {
+		glConfig.vidWidth = 640;
+		glConfig.vidHeight = 480;
+		glConfig.windowAspect = 640.0f / 480.0f;
+	}
+
+	null.viewport[2] = null.scissor[2] = glConfig.vidWidth;
+	null.viewport[3] = null.scissor[3] = glConfig.vidHeight;
+
+	glConfig.isFullscreen = qtrue;
+	glConfig.colorBits = 32;
+	glConfig.depthBits = 24;
+	glConfig.stencilBits = 8;
+	glConfig.textureCompression = TC_NONE;
+	glConfig.textureEnvAddAvailable = qtrue;
+
+	// This values force the UI to disable driver selection
+	glConfig.driverType = GLDRV_ICD;
+	glConfig.hardwareType = GLHW_GENERIC;
+
+	Q_strncpyz(glConfig.vendor_string, (const char *) qglGetString(GL_VENDOR),
+		   sizeof(glConfig.vendor_string));
+	Q_strncpyz(glConfig.renderer_string,
+		   (const char *) qglGetString(GL_RENDERER),
+		   sizeof(glConfig.renderer_string));
+	Q_strncpyz(glConfig.version_string,
+		   (const char *) qglGetString(GL_VERSION),
+		   sizeof(glConfig.version_string));
+
+	qglActiveTextureARB = qglActiveTexture;
+	qglClientActiveTextureARB = qglClientActiveTexture;
+	glConfig.numTextureUnits = NULL_UNITS;
+
+	qglLockArraysEXT = qglLockArrays;
+	qglUnlockArraysEXT = qglUnlockArrays;
+
+	ri.Cmd_AddCommand("nullglinfo", null_info);
+
+	IN_Init();
+
+	ri.Printf(PRINT_ALL, "------------------\n");
+}
+
+void
+GLimp_Shutdown(void)
+{
+	IN_Shutdown();
+
+	ri.Cmd_RemoveCommand("nullglinfo");
+
+	egl_state_reset();
+	null_reset();
+}
+
+void
+GLimp_EndFrame(void)
+{
+	null.last = null.frame;
+	null_counters_add(&null.total, &null.frame);
+	memset(&null.frame, 0, sizeof(null.frame));
+
+	null.frames++;
+}
+
+void
+GLimp_LogComment(char *comment)
+{
+}
+
+void
+GLimp_SetGamma(unsigned char red[256], unsigned char green[256],
+	       unsigned char blue[256])
+{
+}
+
+void
+GLimp_SetCurrentContext(qboolean current)
+{
+}
+
+/*
+ *
+ * Backend calls behind egl_state.c.
+ *
+ */
+void
+glimp_enable(GLenum cap)
+{
+	null_call();
+
+	if (cap == GL_TEXTURE_2D)
+		null.texture_enabled[null.unit] = 1;
+	else if (!null_cap_enabled(cap) && null.caps_count < NULL_CAPS)
+		null.caps[null.caps_count++] = cap;
+}
+
+void
+glimp_disable(GLenum cap)
+{
+	int i;
+
+	null_call();
+
+	if (cap == GL_TEXTURE_2D) {
+		null.texture_enabled[null.unit] = 0;
+		return;
+	}
+
+	for (i = 0; i < null.caps_count; i++)
+		if (null.caps[i] == cap) {
+			null.caps[i] = null.caps[--null.caps_count];
+			return;
+		}
+}
+
+void
+glimp_blend_func(GLenum sfactor, GLenum dfactor)
+{
+	null_call();
+
+	null.blend_src = sfactor;
+	null.blend_dst = dfactor;
+}
+
+void
+glimp_depth_func(GLenum func)
+{
+	null_call();
+
+	null.depth_func = func;
+}
+
+void
+glimp_active_texture(GLenum texture)
+{
+	int unit = texture - GL_TEXTURE0;
+
+	null_call();
+
+	if (unit >= 0 && unit < NULL_UNITS)
+		null.unit = unit;
+}
+
+void
+glimp_bind_texture(GLenum target, GLuint texture)
+{
+	null_call();
+
+	null.bound[null.unit] = texture;
+}
+
+void
+glimp_tex_parameteri(GLenum target, GLenum pname, GLint param)
+{
+	null_call();
+}
+
+void
+glimp_delete_textures(GLsizei n, const GLuint *textures)
+{
+	int i, unit;
+
+	null_call();
+
+	for (i = 0; i < n; i++)
+		for (unit = 0; unit < NULL_UNITS; unit++)
+			if (null.bound[unit] == textures[i])
+				null.bound[unit] = 0;
+}
+
+/*
+ *
+ * The rest of the qgl calls.
+ *
+ */
+void
+qglCallList(GLuint list)
+{
+	null_call();
+}
+
+void
+qglDrawBuffer(GLenum mode)
+{
+	null_call();
+}
+
+void
+qglNumVertices(GLint count)
+{
+	null.num_vertices = count;
+}
+
+void
+qglLockArrays(GLint first, GLsizei size)
+{
+	null_call();
+
+	null.locked_count = size;
+}
+
+void
+qglUnlockArrays(void)
+{
+	null_call();
+
+	null.locked_count = 0;
+}
+
+/*
+ * None of the stage work is taken over, so tr_shade.c does all of it
+ * on the CPU, like it would for the fixed function backend.
+ */
+int
+qglStageFeatures(void)
+{
+	return 0;
+}
+
+void
+qglTexGenEnvironment(const GLfloat *viewOrigin)
+{
+}
+
+void
+qglTexGenFog(const GLfloat *distance, const GLfloat *depth, GLfloat eyeT)
+{
+}
+
+void
+qglDeformVertexes(int index, int deform, int wave, const GLfloat *params)
+{
+}
+
+void
+qglDeformTexCoordPointer(GLsizei stride, const GLvoid *pointer)
+{
+}
+
+void
+qglAlphaFunc(GLenum func, GLclampf ref)
+{
+	null_call();
+
+	null.alpha_func = func;
+	null.alpha_ref = ref;
+}
+
+void
+qglAlphaFuncx(GLenum func, GLclampx ref)
+{
+	qglAlphaFunc(func, ref / 65536.0f);
+}
+
+void
+qglClearColor(GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
+{
+	null_call();
+}
+
+void
+qglClearDepthf(GLclampf depth)
+{
+	null_call();
+}
+
+void
+qglClearStencil(GLint s)
+{
+	null_call();
+}
+
+void
+qglClear(GLbitfield mask)
+{
+	null_call();
+
+	null.frame.clears++;
+}
+
+void
+qglClipPlanef(GLenum plane, const GLfloat *equation)
+{
+	null_call();
+}
+
+void
+qglColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+	null_call();
+
+	null.color[0] = red;
+	null.color[1] = green;
+	null.color[2] = blue;
+	null.color[3] = alpha;
+}
+
+void
+qglColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+	null_call();
+
+	null.color_mask[0] = red;
+	null.color_mask[1] = green;
+	null.color_mask[2] = blue;
+	null.color_mask[3] = alpha;
+}
+
+void
+qglCullFace(GLenum mode)
+{
+	null_call();
+
+	null.cull_face = mode;
+}
+
+void
+qglDepthMask(GLboolean flag)
+{
+	null_call();
+
+	null.depth_mask = flag;
+}
+
+void
+qglDepthRangef(GLclampf zNear, GLclampf zFar)
+{
+	null_call();
+}
+
+void
+qglLineWidth(GLfloat width)
+{
+	null_call();
+}
+
+void
+qglMaterialf(GLenum face, GLenum pname, GLfloat param)
+{
+	null_call();
+}
+
+void
+qglMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+{
+	null_call();
+}
+
+void
+qglPolygonOffset(GLfloat factor, GLfloat units)
+{
+	null_call();
+}
+
+void
+qglScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	null_call();
+
+	null.scissor[0] = x;
+	null.scissor[1] = y;
+	null.scissor[2] = width;
+	null.scissor[3] = height;
+}
+
+void
+qglViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+	null_call();
+
+	null.viewport[0] = x;
+	null.viewport[1] = y;
+	null.viewport[2] = width;
+	null.viewport[3] = height;
+}
+
+void
+qglShadeModel(GLenum mode)
+{
+	null_call();
+}
+
+void
+qglStencilFunc(GLenum func, GLint ref, GLuint mask)
+{
+	null_call();
+}
+
+void
+qglStencilMask(GLuint mask)
+{
+	null_call();
+}
+
+void
+qglStencilOp(GLenum fail, GLenum zfail, GLenum zpass)
+{
+	null_call();
+}
+
+void
+qglTexEnvf(GLenum target, GLenum pname, GLfloat param)
+{
+	null_call();
+}
+
+void
+qglTexEnvi(GLenum target, GLenum pname, GLint param)
+{
+	null_call();
+}
+
+void
+qglTexImage2D(GLenum target, GLint level, GLint internalformat,
+	      GLsizei width, GLsizei height, GLint border, GLenum format,
+	      GLenum type, const GLvoid *pixels)
+{
+	null_call();
+
+	null.frame.texture_uploads++;
+	null.frame.texture_bytes += width * height * 4;
+}
+
+void
+qglTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset,
+		 GLsizei width, GLsizei height, GLenum format, GLenum type,
+		 const GLvoid *pixels)
+{
+	null_call();
+
+	null.frame.texture_uploads++;
+	null.frame.texture_bytes += width * height * 4;
+}
+
+/*
+ * Matrices.
+ */
+void
+qglMatrixMode(GLenum mode)
+{
+	null_call();
+
+	switch (mode) {
+	case GL_MODELVIEW:
+		null.matrix_mode = NULL_MODELVIEW;
+		break;
+	case GL_PROJECTION:
+		null.matrix_mode = NULL_PROJECTION;
+		break;
+	case GL_TEXTURE:
+		null.matrix_mode = NULL_TEXTURE;
+		break;
+	default:
+		break;
+	}
+}
+
+void
+qglLoadIdentity(void)
+{
+	null_call();
+
+	null_matrix_identity(null_matrix());
+}
+
+void
+qglLoadMatrixf(const GLfloat *m)
+{
+	null_call();
+
+	memcpy(null_matrix(), m, 16 * sizeof(GLfloat));
+}
+
+void
+qglPushMatrix(void)
+{
+	int *depth = &null.matrix_depth[null.matrix_mode];
+
+	null_call();
+
+	if (*depth + 1 < NULL_STACK_DEPTH) {
+		memcpy(null_matrix() + 16, null_matrix(), 16 * sizeof(GLfloat));
+		(*depth)++;
+	}
+}
+
+void
+qglPopMatrix(void)
+{
+	null_call();
+
+	if (null.matrix_depth[null.matrix_mode])
+		null.matrix_depth[null.matrix_mode]--;
+}
+
+void
+qglTranslatef(GLfloat x, GLfloat y, GLfloat z)
+{
+	GLfloat m[16];
+
+	null_call();
+
+	null_matrix_identity(m);
+	m[12] = x;
+	m[13] = y;
+	m[14] = z;
+	null_matrix_multiply(null_matrix(), m);
+}
+
+void
+qglOrthof(GLfloat left, GLfloat right, GLfloat bottom, GLfloat top,
+	  GLfloat zNear, GLfloat zFar)
+{
+	GLfloat m[16];
+
+	null_call();
+
+	null_matrix_identity(m);
+	m[0] = 2.0f / (right - left);
+	m[5] = 2.0f / (top - bottom);
+	m[10] = -2.0f / (zFar - zNear);
+	m[12] = -(right + left) / (right - left);
+	m[13] = -(top + bottom) / (top - bottom);
+	m[14] = -(zFar + zNear) / (zFar - zNear);
+	null_matrix_multiply(null_matrix(), m);
+}
+
+/*
+ * Arrays and buffers.
+ */
+void
+qglClientActiveTexture(GLenum texture)
+{
+	int unit = texture - GL_TEXTURE0;
+
+	null_call();
+
+	if (unit >= 0 && unit < NULL_UNITS)
+		null.client_unit = unit;
+}
+
+static int *
+null_array(GLenum array)
+{
+	switch (array) {
+	case GL_VERTEX_ARRAY:
+		return &null.vertex_array;
+	case GL_COLOR_ARRAY:
+		return &null.color_array;
+	case GL_NORMAL_ARRAY:
+		return &null.normal_array;
+	case GL_TEXTURE_COORD_ARRAY:
+		return &null.texcoord_array[null.client_unit];
+	default:
+		return NULL;
+	}
+}
+
+void
+qglEnableClientState(GLenum array)
+{
+	int *enabled = null_array(array);
+
+	null_call();
+
+	if (enabled)
+		*enabled = 1;
+}
+
+void
+qglDisableClientState(GLenum array)
+{
+	int *enabled = null_array(array);
+
+	null_call();
+
+	if (enabled)
+		*enabled = 0;
+}
+
+void
+qglVertexPointer(GLint size, GLenum type, GLsizei stride,
+		 const GLvoid *pointer)
+{
+	null_call();
+}
+
+void
+qglColorPointer(GLint size, GLenum type, GLsizei stride,
+		const GLvoid *pointer)
+{
+	null_call();
+}
+
+void
+qglNormalPointer(GLenum type, GLsizei stride, const GLvoid *pointer)
+{
+	null_call();
+}
+
+void
+qglTexCoordPointer(GLint size, GLenum type, GLsizei stride,
+		   const GLvoid *pointer)
+{
+	null_call();
+}
+
+void
+qglGenBuffers(GLsizei n, GLuint *buffers)
+{
+	int i;
+
+	null_call();
+
+	for (i = 0; i < n; i++)
+		buffers[i] = ++null.buffers;
+}
+
+void
+qglDeleteBuffers(GLsizei n, const GLuint *buffers)
+{
+	int i;
+
+	null_call();
+
+	for (i = 0; i < n; i++) {
+		if (null.array_buffer == buffers[i])
+			null.array_buffer = 0;
+		if (null.element_buffer == buffers[i])
+			null.element_buffer = 0;
+	}
+}
+
+void
+qglBindBuffer(GLenum target, GLuint buffer)
+{
+	null_call();
+
+	if (target == GL_ARRAY_BUFFER)
+		null.array_buffer = buffer;
+	else if (target == GL_ELEMENT_ARRAY_BUFFER)
+		null.element_buffer = buffer;
+}
+
+void
+qglBufferData(GLenum target, GLsizeiptr size, const GLvoid *data,
+	      GLenum usage)
+{
+	null_call();
+
+	if (data)
+		null.frame.buffer_bytes += size;
+}
+
+/*
+ * The vertices a draw touches are the locked range, or the count
+ * tr_shade.c gives with qglNumVertices() when nothing is locked.
+ */
+void
+qglDrawElements(GLenum mode, GLsizei count, GLenum type,
+		const GLvoid *indices)
+{
+	null_call();
+
+	null.frame.draws++;
+	null.frame.indices += count;
+	null.frame.vertices += null.locked_count ?
+		null.locked_count : null.num_vertices;
+}
+
+void
+qglDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+	null_call();
+
+	null.frame.draws++;
+	null.frame.vertices += count;
+}
+
+void
+qglFinish(void)
+{
+	null_call();
+}
+
+void
+qglFlush(void)
+{
+	null_call();
+}
+
+/*
+ * Queries, answered from the recorded state.
+ */
+GLenum
+qglGetError(void)
+{
+	return GL_NO_ERROR;
+}
+
+const GLubyte *
+qglGetString(GLenum name)
+{
+	switch (name) {
+	case GL_VENDOR:
+		return (const GLubyte *) "ioquake3";
+	case GL_RENDERER:
+		return (const GLubyte *) "null";
+	case GL_VERSION:
+		return (const GLubyte *) "OpenGL ES-CM 1.1 null";
+	case GL_EXTENSIONS:
+	default:
+		return (const GLubyte *) "";
+	}
+}
+
+void
+qglGetIntegerv(GLenum pname, GLint *params)
+{
+	int i;
+
+	switch (pname) {
+	case GL_MAX_TEXTURE_SIZE:
+		params[0] = NULL_MAX_TEXTURE_SIZE;
+		break;
+	case GL_MAX_TEXTURE_UNITS:
+		params[0] = NULL_UNITS;
+		break;
+	case GL_ACTIVE_TEXTURE:
+		params[0] = GL_TEXTURE0 + null.unit;
+		break;
+	case GL_CLIENT_ACTIVE_TEXTURE:
+		params[0] = GL_TEXTURE0 + null.client_unit;
+		break;
+	case GL_TEXTURE_BINDING_2D:
+		params[0] = null.bound[null.unit];
+		break;
+	case GL_ARRAY_BUFFER_BINDING:
+		params[0] = null.array_buffer;
+		break;
+	case GL_ELEMENT_ARRAY_BUFFER_BINDING:
+		params[0] = null.element_buffer;
+		break;
+	case GL_BLEND_SRC:
+		params[0] = null.blend_src;
+		break;
+	case GL_BLEND_DST:
+		params[0] = null.blend_dst;
+		break;
+	case GL_DEPTH_FUNC:
+		params[0] = null.depth_func;
+		break;
+	case GL_ALPHA_TEST_FUNC:
+		params[0] = null.alpha_func;
+		break;
+	case GL_CULL_FACE_MODE:
+		params[0] = null.cull_face;
+		break;
+	case GL_MATRIX_MODE:
+		params[0] = null.matrix_mode == NULL_PROJECTION ?
+			GL_PROJECTION : null.matrix_mode == NULL_TEXTURE ?
+			GL_TEXTURE : GL_MODELVIEW;
+		break;
+	case GL_VIEWPORT:
+		for (i = 0; i < 4; i++)
+			params[i] = null.viewport[i];
+		break;
+	case GL_SCISSOR_BOX:
+		for (i = 0; i < 4; i++)
+			params[i] = null.scissor[i];
+		break;
+	default:
+		params[0] = 0;
+		break;
+	}
+}
+
+void
+qglGetBooleanv(GLenum pname, GLboolean *params)
+{
+	int i;
+
+	switch (pname) {
+	case GL_COLOR_WRITEMASK:
+		for (i = 0; i < 4; i++)
+			params[i] = null.color_mask[i];
+		break;
+	case GL_DEPTH_WRITEMASK:
+		params[0] = null.depth_mask;
+		break;
+	default:
+		params[0] = null_cap_enabled(pname) ? GL_TRUE : GL_FALSE;
+		break;
+	}
+}
+
+/*
+ * Screenshots and flares read back black.
+ */
+void
+qglReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format,
+	      GLenum type, GLvoid *pixels)
+{
+	int size = width * height;
+
+	null_call();
+
+	switch (format) {
+	case GL_RGB:
+		size *= 3;
+		break;
+	case GL_RGBA:
+		size *= 4;
+		break;
+	default:
+		break;
+	}
+
+	if (type == GL_FLOAT)
+		size *= sizeof(GLfloat);
+
+	memset(pixels, 0, size);
+}
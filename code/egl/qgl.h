@@ -73,8 +73,62 @@ void qglTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset,
 		      GLenum type, const GLvoid *pixels);
 void qglVertexPointer(GLint size, GLenum type, GLsizei stride,
 		      const GLvoid *pointer);
+void qglGenBuffers(GLsizei n, GLuint *buffers);
+void qglDeleteBuffers(GLsizei n, const GLuint *buffers);
+void qglBindBuffer(GLenum target, GLuint buffer);
+void qglBufferData(GLenum target, GLsizeiptr size, const GLvoid *data,
+		   GLenum usage);
 void qglViewport(GLint x, GLint y, GLsizei width, GLsizei height);
 
+/*
+ * Shader stage work a backend can take over from tr_shade.c. The
+ * calls that go with a bit are only made when qglStageFeatures()
+ * returns it.
+ */
+#define QGL_STAGE_CONSTANT_COLOR	0x01	/* qglColor4f, color array off */
+#define QGL_STAGE_TEXTURE_MATRIX	0x02	/* GL_TEXTURE matrix per unit */
+#define QGL_STAGE_ENVIRONMENT		0x04	/* qglTexGenEnvironment */
+#define QGL_STAGE_FOG			0x08	/* qglTexGenFog */
+#define QGL_STAGE_DEFORM		0x10	/* qglDeformVertexes */
+
+/*
+ * Vertex deforms for qglDeformVertexes, applied in the order of their
+ * index before anything else reads the positions and normals. The
+ * time is already folded into the parameters:
+ *
+ * WAVE: base, amplitude, phase, spread along the normal
+ * NORMALS: amplitude, noise time
+ * BULGE: width, height, phase along the qglDeformTexCoordPointer s
+ * MOVE: the offset
+ */
+#define QGL_DEFORM_NONE			0
+#define QGL_DEFORM_NORMALS		1
+#define QGL_DEFORM_BULGE		2
+#define QGL_DEFORM_MOVE			3
+#define QGL_DEFORM_WAVE			4
+
+#define QGL_WAVE_SIN			0
+#define QGL_WAVE_SQUARE			1
+#define QGL_WAVE_TRIANGLE		2
+#define QGL_WAVE_SAWTOOTH		3
+#define QGL_WAVE_INVERSE_SAWTOOTH	4
+
+#define QGL_MAX_DEFORMS			3
+
+int qglStageFeatures(void);
+void qglNormalPointer(GLenum type, GLsizei stride, const GLvoid *pointer);
+void qglTexGenEnvironment(const GLfloat *viewOrigin);
+void qglTexGenFog(const GLfloat *distance, const GLfloat *depth, GLfloat eyeT);
+void qglDeformVertexes(int index, int deform, int wave, const GLfloat *params);
+void qglDeformTexCoordPointer(GLsizei stride, const GLvoid *pointer);
+
+/*
+ * Redundant enables, blend and depth funcs, texture binds and texture
+ * parameters never get to the backend. Returns how many of those calls
+ * were passed on and how many were dropped since the last call.
+ */
+void qglStateCounters(int *forwarded, int *dropped);
+
 #ifndef USE_REAL_GL_CALLS
 // Prevent calls to the 'normal' GL functions
 #define glAlphaFunc CALL_THE_QGL_VERSION_OF_glAlphaFunc
@@ -24,19 +24,29 @@
 
 /*
  * Memory allocation and freeing are controlled by the regular library
- * routines ri.Malloc() and ri.Free().
+ * routines ri.Malloc() and ri.Free(), unless the decompressor was set up
+ * by R_DecodeJPG, which may run on a job thread and brings its own.
  */
 
 GLOBAL(void *)
 jpeg_get_small (j_common_ptr cinfo, size_t sizeofobject)
 {
+  imageDecode_t *d = (imageDecode_t *) cinfo->client_data;
+
+  if (d)
+    return d->alloc(sizeofobject);
   return (void *) ri.Malloc(sizeofobject);
 }
 
 GLOBAL(void)
 jpeg_free_small (j_common_ptr cinfo, void * object, size_t sizeofobject)
 {
-  ri.Free(object);
+  imageDecode_t *d = (imageDecode_t *) cinfo->client_data;
+
+  if (d)
+    d->free(object);
+  else
+    ri.Free(object);
 }
 
 
@@ -50,13 +60,13 @@ jpeg_free_small (j_common_ptr cinfo, void * object, size_t sizeofobject)
 GLOBAL(void FAR *)
 jpeg_get_large (j_common_ptr cinfo, size_t sizeofobject)
 {
-  return (void FAR *) ri.Malloc(sizeofobject);
+  return (void FAR *) jpeg_get_small(cinfo, sizeofobject);
 }
 
 GLOBAL(void)
 jpeg_free_large (j_common_ptr cinfo, void FAR * object, size_t sizeofobject)
 {
-  ri.Free(object);
+  jpeg_free_small(cinfo, object, sizeofobject);
 }
 
 
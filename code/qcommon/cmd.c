@@ -315,6 +315,7 @@ typedef struct cmd_function_s
 {
 	struct cmd_function_s	*next;
 	char					*name;
+	unsigned				hashValue;
 	xcommand_t				function;
 	completionFunc_t	complete;
 } cmd_function_t;
@@ -327,6 +328,97 @@ static	char		cmd_cmd[BIG_INFO_STRING]; // the original command we received (no t
 
 static	cmd_function_t	*cmd_functions;		// possible commands to execute
 
+// open addressing on the full name hash, grown to stay under half full
+#define	CMD_HASH_MIN		256
+#define	CMD_HASH_DELETED	( (cmd_function_t *)&cmd_hashTable )
+static	cmd_function_t	**cmd_hashTable;
+static	int				cmd_hashSize;
+static	int				cmd_hashUsed;		// commands and deleted slots
+
+/*
+============
+Cmd_HashSlot
+
+Returns the slot holding the name, or the first free one.
+Names are matched case insensitive, like Cmd_ExecuteString does.
+============
+*/
+static cmd_function_t **Cmd_HashSlot( const char *cmd_name, unsigned hash ) {
+	cmd_function_t	**slot, **deleted;
+	int				i;
+
+	deleted = NULL;
+	for ( i = hash & ( cmd_hashSize - 1 ) ; ; i = ( i + 1 ) & ( cmd_hashSize - 1 ) ) {
+		slot = &cmd_hashTable[i];
+		if ( !*slot ) {
+			return deleted ? deleted : slot;
+		}
+		if ( *slot == CMD_HASH_DELETED ) {
+			if ( !deleted ) {
+				deleted = slot;
+			}
+			continue;
+		}
+		if ( (*slot)->hashValue == hash && !Q_stricmp( cmd_name, (*slot)->name ) ) {
+			return slot;
+		}
+	}
+}
+
+/*
+============
+Cmd_FindCommand
+============
+*/
+static cmd_function_t *Cmd_FindCommand( const char *cmd_name ) {
+	cmd_function_t	*cmd;
+
+	if ( !cmd_hashSize ) {
+		return NULL;
+	}
+	cmd = *Cmd_HashSlot( cmd_name, Com_HashKeyNoCase( cmd_name ) );
+	if ( cmd == CMD_HASH_DELETED ) {
+		return NULL;
+	}
+	return cmd;
+}
+
+/*
+============
+Cmd_RehashCommands
+
+Rebuilds the table without the deleted slots, doubling it if
+the commands alone would fill more than a quarter of it
+============
+*/
+static void Cmd_RehashCommands( void ) {
+	cmd_function_t	*cmd;
+	int				count;
+
+	count = 0;
+	for ( cmd = cmd_functions ; cmd ; cmd = cmd->next ) {
+		count++;
+	}
+
+	if ( cmd_hashTable ) {
+		Z_Free( cmd_hashTable );
+	}
+	if ( cmd_hashSize < CMD_HASH_MIN ) {
+		cmd_hashSize = CMD_HASH_MIN;
+	}
+	while ( count * 4 >= cmd_hashSize ) {
+		cmd_hashSize *= 2;
+	}
+
+	// use a small malloc, commands are added before the main zone exists
+	cmd_hashTable = S_Malloc( cmd_hashSize * sizeof( *cmd_hashTable ) );
+	Com_Memset( cmd_hashTable, 0, cmd_hashSize * sizeof( *cmd_hashTable ) );
+	for ( cmd = cmd_functions ; cmd ; cmd = cmd->next ) {
+		*Cmd_HashSlot( cmd->name, cmd->hashValue ) = cmd;
+	}
+	cmd_hashUsed = count;
+}
+
 /*
 ============
 Cmd_Argc
@@ -587,26 +679,37 @@ Cmd_AddCommand
 ============
 */
 void	Cmd_AddCommand( const char *cmd_name, xcommand_t function ) {
-	cmd_function_t	*cmd;
-	
+	cmd_function_t	*cmd, **slot;
+	unsigned		hash;
+
+	if ( ( cmd_hashUsed + 1 ) * 2 > cmd_hashSize ) {
+		Cmd_RehashCommands();
+	}
+
 	// fail if the command already exists
-	for ( cmd = cmd_functions ; cmd ; cmd=cmd->next ) {
-		if ( !strcmp( cmd_name, cmd->name ) ) {
-			// allow completion-only commands to be silently doubled
-			if ( function != NULL ) {
-				Com_Printf ("Cmd_AddCommand: %s already defined\n", cmd_name);
-			}
-			return;
+	hash = Com_HashKeyNoCase( cmd_name );
+	slot = Cmd_HashSlot( cmd_name, hash );
+	if ( *slot && *slot != CMD_HASH_DELETED ) {
+		// allow completion-only commands to be silently doubled
+		if ( function != NULL ) {
+			Com_Printf ("Cmd_AddCommand: %s already defined\n", cmd_name);
 		}
+		return;
 	}
 
 	// use a small malloc to avoid zone fragmentation
 	cmd = S_Malloc (sizeof(cmd_function_t));
 	cmd->name = CopyString( cmd_name );
+	cmd->hashValue = hash;
 	cmd->function = function;
 	cmd->complete = NULL;
 	cmd->next = cmd_functions;
 	cmd_functions = cmd;
+
+	if ( !*slot ) {
+		cmd_hashUsed++;
+	}
+	*slot = cmd;
 }
 
 /*
@@ -617,10 +720,9 @@ Cmd_SetCommandCompletionFunc
 void Cmd_SetCommandCompletionFunc( const char *command, completionFunc_t complete ) {
 	cmd_function_t	*cmd;
 
-	for( cmd = cmd_functions; cmd; cmd = cmd->next ) {
-		if( !Q_stricmp( command, cmd->name ) ) {
-			cmd->complete = complete;
-		}
+	cmd = Cmd_FindCommand( command );
+	if ( cmd ) {
+		cmd->complete = complete;
 	}
 }
 
@@ -632,14 +734,16 @@ Cmd_RemoveCommand
 void	Cmd_RemoveCommand( const char *cmd_name ) {
 	cmd_function_t	*cmd, **back;
 
+	cmd = Cmd_FindCommand( cmd_name );
+	if ( !cmd ) {
+		// command wasn't active
+		return;
+	}
+	*Cmd_HashSlot( cmd->name, cmd->hashValue ) = CMD_HASH_DELETED;
+
 	back = &cmd_functions;
 	while( 1 ) {
-		cmd = *back;
-		if ( !cmd ) {
-			// command wasn't active
-			return;
-		}
-		if ( !strcmp( cmd_name, cmd->name ) ) {
+		if ( *back == cmd ) {
 			*back = cmd->next;
 			if (cmd->name) {
 				Z_Free(cmd->name);
@@ -647,7 +751,7 @@ void	Cmd_RemoveCommand( const char *cmd_name ) {
 			Z_Free (cmd);
 			return;
 		}
-		back = &cmd->next;
+		back = &(*back)->next;
 	}
 }
 
@@ -673,10 +777,9 @@ Cmd_CompleteArgument
 void Cmd_CompleteArgument( const char *command, char *args, int argNum ) {
 	cmd_function_t	*cmd;
 
-	for( cmd = cmd_functions; cmd; cmd = cmd->next ) {
-		if( !Q_stricmp( command, cmd->name ) && cmd->complete ) {
-			cmd->complete( args, argNum );
-		}
+	cmd = Cmd_FindCommand( command );
+	if( cmd && cmd->complete ) {
+		cmd->complete( args, argNum );
 	}
 }
 
@@ -689,7 +792,7 @@ A complete command line has been parsed, so try to execute it
 ============
 */
 void	Cmd_ExecuteString( const char *text ) {	
-	cmd_function_t	*cmd, **prev;
+	cmd_function_t	*cmd;
 
 	// execute the command line
 	Cmd_TokenizeString( text );		
@@ -697,25 +800,12 @@ void	Cmd_ExecuteString( const char *text ) {
 		return;		// no tokens
 	}
 
-	// check registered command functions	
-	for ( prev = &cmd_functions ; *prev ; prev = &cmd->next ) {
-		cmd = *prev;
-		if ( !Q_stricmp( cmd_argv[0],cmd->name ) ) {
-			// rearrange the links so that the command will be
-			// near the head of the list next time it is used
-			*prev = cmd->next;
-			cmd->next = cmd_functions;
-			cmd_functions = cmd;
-
-			// perform the action
-			if ( !cmd->function ) {
-				// let the cgame or game handle it
-				break;
-			} else {
-				cmd->function ();
-			}
-			return;
-		}
+	// check registered command functions, a command without
+	// a function is left to the cgame or game
+	cmd = Cmd_FindCommand( cmd_argv[0] );
+	if ( cmd && cmd->function ) {
+		cmd->function ();
+		return;
 	}
 	
 	// check cvars
@@ -41,6 +41,13 @@ int demo_protocols[] =
 #define DEF_COMHUNKMEGS		64
 #define DEF_COMZONEMEGS		24
 #define DEF_COMHUNKMEGS_S	XSTRING(DEF_COMHUNKMEGS)
+#define MAX_COMHUNKMEGS		2047
+#if defined(__LP64__) || defined(_WIN64)
+#define DEF_COMHUNKMAXMEGS	1024
+#else
+#define DEF_COMHUNKMAXMEGS	256
+#endif
+#define DEF_COMHUNKMAXMEGS_S	XSTRING(DEF_COMHUNKMAXMEGS)
 #define DEF_COMZONEMEGS_S	XSTRING(DEF_COMZONEMEGS)
 
 int		com_argc;
@@ -83,6 +90,7 @@ cvar_t	*com_maxfpsUnfocused;
 cvar_t	*com_minimized;
 cvar_t	*com_maxfpsMinimized;
 cvar_t	*com_standalone;
+cvar_t	*com_jobThreads;
 
 // com_speeds times
 int		time_game;
@@ -688,6 +696,26 @@ int Com_HashKey(char *string, int maxlen) {
 	return hash;
 }
 
+/*
+============
+Com_HashKeyNoCase
+
+FNV-1a of the lower case string, spread well enough
+for open addressing on the low bits
+============
+*/
+unsigned Com_HashKeyNoCase( const char *string ) {
+	unsigned	hash;
+
+	hash = 2166136261u;
+	while ( *string ) {
+		hash ^= (unsigned)tolower( *(const unsigned char *)string );
+		hash *= 16777619u;
+		string++;
+	}
+	return hash;
+}
+
 /*
 ================
 Com_RealTime
@@ -724,7 +752,12 @@ int Com_RealTime(qtime_t *qtime) {
 There is never any space between memblocks, and there will never be two
 contiguous free memblocks.
 
-The rover can be left pointing at a non-empty block
+Free blocks are also kept on segregated free lists by size, so finding a
+block does not depend on how many blocks are in use. Sizes below
+ZONE_SMALL_LIMIT have one list per multiple of 8 bytes, so any block on
+the list for a size fits and small allocations take the first block of
+the first non empty list. Larger sizes share a list per quarter of a
+power of two, only the list of the requested size itself is searched.
 
 The zone calls are pretty much only used for small strings and structures,
 all big things are allocated on the hunk.
@@ -734,6 +767,12 @@ all big things are allocated on the hunk.
 #define	ZONEID	0x1d4a11
 #define MINFRAGMENT	64
 
+#define	ZONE_SMALL_LIMIT	1024
+#define	ZONE_SMALL_BINS		( ZONE_SMALL_LIMIT >> 3 )
+#define	ZONE_LARGE_BINS		( ( 31 - 10 ) * 4 )		// 4 per power of two from 1024 up
+#define	ZONE_BINS			( ZONE_SMALL_BINS + ZONE_LARGE_BINS )
+#define	ZONE_BIN_WORDS		( ( ZONE_BINS + 31 ) >> 5 )
+
 typedef struct zonedebug_s {
 	char *label;
 	char *file;
@@ -751,11 +790,27 @@ typedef struct memblock_s {
 #endif
 } memblock_t;
 
+// free list links, stored after the header of free blocks
+typedef struct {
+	memblock_t	*nextFree, *prevFree;
+} memfree_t;
+
+#define	FREELINKS(block)	((memfree_t *)((block) + 1))
+#define	MINBLOCK			PAD( sizeof(memblock_t) + sizeof(memfree_t), sizeof(intptr_t) )
+
 typedef struct {
 	int		size;			// total bytes malloced, including header
 	int		used;			// total bytes used
 	memblock_t	blocklist;	// start / end cap for linked list
-	memblock_t	*rover;
+	memblock_t	*bins[ZONE_BINS];			// free blocks by size
+	unsigned	binMask[ZONE_BIN_WORDS];	// non empty bins
+
+	// statistics for Com_Meminfo_f
+	int		allocs;
+	int		frees;
+	int		probes;			// free blocks looked at by all allocations
+	int		maxProbes;
+	int		binSearches;	// bitmap words looked at by all allocations
 } memzone_t;
 
 // main zone for all "dynamic" memory allocation
@@ -766,6 +821,96 @@ memzone_t	*smallzone;
 
 void Z_CheckHeap( void );
 
+/*
+========================
+Z_BinForSize
+
+The list a free block of the given size is kept on
+========================
+*/
+static int Z_BinForSize( int size ) {
+	int		bits;
+
+	if ( size < ZONE_SMALL_LIMIT ) {
+		return size >> 3;
+	}
+
+	for ( bits = 10 ; ( size >> ( bits + 1 ) ) && bits < 30 ; bits++ ) {
+	}
+	return ZONE_SMALL_BINS + ( bits - 10 ) * 4 + ( ( size >> ( bits - 2 ) ) & 3 );
+}
+
+/*
+========================
+Z_LinkFree
+========================
+*/
+static void Z_LinkFree( memzone_t *zone, memblock_t *block ) {
+	memfree_t	*links;
+	int			bin;
+
+	bin = Z_BinForSize( block->size );
+	links = FREELINKS( block );
+	links->prevFree = NULL;
+	links->nextFree = zone->bins[bin];
+	if ( links->nextFree ) {
+		FREELINKS( links->nextFree )->prevFree = block;
+	}
+	zone->bins[bin] = block;
+	zone->binMask[bin >> 5] |= 1u << ( bin & 31 );
+}
+
+/*
+========================
+Z_UnlinkFree
+========================
+*/
+static void Z_UnlinkFree( memzone_t *zone, memblock_t *block ) {
+	memfree_t	*links;
+	int			bin;
+
+	bin = Z_BinForSize( block->size );
+	links = FREELINKS( block );
+	if ( links->prevFree ) {
+		FREELINKS( links->prevFree )->nextFree = links->nextFree;
+	} else {
+		zone->bins[bin] = links->nextFree;
+		if ( !zone->bins[bin] ) {
+			zone->binMask[bin >> 5] &= ~( 1u << ( bin & 31 ) );
+		}
+	}
+	if ( links->nextFree ) {
+		FREELINKS( links->nextFree )->prevFree = links->prevFree;
+	}
+}
+
+/*
+========================
+Z_FirstBin
+
+The first non empty bin at or after bin, -1 if there is none
+========================
+*/
+static int Z_FirstBin( memzone_t *zone, int bin ) {
+	unsigned	bits;
+	int			i;
+
+	for ( i = bin >> 5 ; i < ZONE_BIN_WORDS ; i++ ) {
+		zone->binSearches++;
+		bits = zone->binMask[i];
+		if ( i == bin >> 5 ) {
+			bits &= ~0u << ( bin & 31 );
+		}
+		if ( bits ) {
+			for ( bin = i << 5 ; !( bits & 1 ) ; bits >>= 1 ) {
+				bin++;
+			}
+			return bin;
+		}
+	}
+	return -1;
+}
+
 /*
 ========================
 Z_ClearZone
@@ -776,19 +921,20 @@ void Z_ClearZone( memzone_t *zone, int size ) {
 	
 	// set the entire zone to one free block
 
+	Com_Memset( zone, 0, sizeof( *zone ) );
 	zone->blocklist.next = zone->blocklist.prev = block =
-		(memblock_t *)( (byte *)zone + sizeof(memzone_t) );
+		(memblock_t *)( (byte *)zone + PAD( sizeof(memzone_t), sizeof(intptr_t) ) );
 	zone->blocklist.tag = 1;	// in use block
 	zone->blocklist.id = 0;
 	zone->blocklist.size = 0;
-	zone->rover = block;
 	zone->size = size;
 	zone->used = 0;
 	
 	block->prev = block->next = &zone->blocklist;
 	block->tag = 0;			// free block
 	block->id = ZONEID;
-	block->size = size - sizeof(memzone_t);
+	block->size = size - PAD( sizeof(memzone_t), sizeof(intptr_t) );
+	Z_LinkFree( zone, block );
 }
 
 /*
@@ -847,6 +993,7 @@ void Z_Free( void *ptr ) {
 	}
 
 	zone->used -= block->size;
+	zone->frees++;
 	// set the block to something that should cause problems
 	// if it is referenced...
 	Com_Memset( ptr, 0xaa, block->size - sizeof( *block ) );
@@ -856,27 +1003,23 @@ void Z_Free( void *ptr ) {
 	other = block->prev;
 	if (!other->tag) {
 		// merge with previous free block
+		Z_UnlinkFree( zone, other );
 		other->size += block->size;
 		other->next = block->next;
 		other->next->prev = other;
-		if (block == zone->rover) {
-			zone->rover = other;
-		}
 		block = other;
 	}
 
-	zone->rover = block;
-
 	other = block->next;
 	if ( !other->tag ) {
 		// merge the next free block onto the end
+		Z_UnlinkFree( zone, other );
 		block->size += other->size;
 		block->next = other->next;
 		block->next->prev = block;
-		if (other == zone->rover) {
-			zone->rover = block;
-		}
 	}
+
+	Z_LinkFree( zone, block );
 }
 
 
@@ -886,8 +1029,8 @@ Z_FreeTags
 ================
 */
 void Z_FreeTags( int tag ) {
-	int			count;
 	memzone_t	*zone;
+	memblock_t	*block, *prev;
 
 	if ( tag == TAG_SMALL ) {
 		zone = smallzone;
@@ -895,18 +1038,15 @@ void Z_FreeTags( int tag ) {
 	else {
 		zone = mainzone;
 	}
-	count = 0;
-	// use the rover as our pointer, because
-	// Z_Free automatically adjusts it
-	zone->rover = zone->blocklist.next;
-	do {
-		if ( zone->rover->tag == tag ) {
-			count++;
-			Z_Free( (void *)(zone->rover + 1) );
-			continue;
+
+	for ( block = zone->blocklist.next ; block != &zone->blocklist ; block = block->next ) {
+		if ( block->tag == tag ) {
+			prev = block->prev;
+			Z_Free( (void *)(block + 1) );
+			// the freed block may have been merged into the previous one
+			block = prev->tag ? prev->next : prev;
 		}
-		zone->rover = zone->rover->next;
-	} while ( zone->rover != &zone->blocklist );
+	}
 }
 
 
@@ -920,8 +1060,8 @@ void *Z_TagMallocDebug( int size, int tag, char *label, char *file, int line ) {
 #else
 void *Z_TagMalloc( int size, int tag ) {
 #endif
-	int		extra, allocSize;
-	memblock_t	*start, *rover, *new, *base;
+	int		extra, allocSize, bin, probes;
+	memblock_t	*base, *new;
 	memzone_t *zone;
 
 	if (!tag) {
@@ -936,39 +1076,57 @@ void *Z_TagMalloc( int size, int tag ) {
 	}
 
 	allocSize = size;
-	//
-	// scan through the block list looking for the first free block
-	// of sufficient size
-	//
 	size += sizeof(memblock_t);	// account for size of block header
 	size += 4;					// space for memory trash tester
 	size = PAD(size, sizeof(intptr_t));		// align to 32/64 bit boundary
-	
-	base = rover = zone->rover;
-	start = base->prev;
-	
-	do {
-		if (rover == start)	{
+	if ( size < MINBLOCK ) {
+		size = MINBLOCK;		// room for the free list links once it is freed
+	}
+
+	//
+	// any block on a small bin at or above the size fits, blocks on
+	// the large bin of the size itself have to be checked
+	//
+	base = NULL;
+	probes = 0;
+	if ( size < ZONE_SMALL_LIMIT ) {
+		bin = ( size + 7 ) >> 3;
+	} else {
+		bin = Z_BinForSize( size );
+		for ( base = zone->bins[bin] ; base ; base = FREELINKS( base )->nextFree ) {
+			probes++;
+			if ( base->size >= size ) {
+				break;
+			}
+		}
+		bin++;
+	}
+	if ( !base ) {
+		bin = Z_FirstBin( zone, bin );
+		if ( bin < 0 ) {
 #ifdef ZONE_DEBUG
 			Z_LogHeap();
 #endif
-			// scaned all the way around the list
 			Com_Error( ERR_FATAL, "Z_Malloc: failed on allocation of %i bytes from the %s zone",
 								size, zone == smallzone ? "small" : "main");
 			return NULL;
 		}
-		if (rover->tag) {
-			base = rover = rover->next;
-		} else {
-			rover = rover->next;
-		}
-	} while (base->tag || base->size < size);
-	
+		base = zone->bins[bin];
+		probes++;
+	}
+
+	zone->allocs++;
+	zone->probes += probes;
+	if ( probes > zone->maxProbes ) {
+		zone->maxProbes = probes;
+	}
+
 	//
 	// found a block big enough
 	//
+	Z_UnlinkFree( zone, base );
 	extra = base->size - size;
-	if (extra > MINFRAGMENT) {
+	if (extra > MINFRAGMENT && extra >= MINBLOCK) {
 		// there will be a free fragment after the allocated block
 		new = (memblock_t *) ((byte *)base + size );
 		new->size = extra;
@@ -979,11 +1137,11 @@ void *Z_TagMalloc( int size, int tag ) {
 		new->next->prev = new;
 		base->next = new;
 		base->size = size;
+		Z_LinkFree( zone, new );
 	}
 	
 	base->tag = tag;			// no longer a free block
 	
-	zone->rover = base->next;	// next allocation will start looking here
 	zone->used += base->size;	//
 	
 	base->id = ZONEID;
@@ -1220,23 +1378,80 @@ typedef struct hunkblock_s {
 	int size;
 	byte printed;
 	struct hunkblock_s *next;
-	char *label;
-	char *file;
+	const char *label;
+	const char *file;
 	int line;
 } hunkblock_t;
 
 static	hunkblock_t *hunkblocks;
 
+// permanent bytes per Hunk_Alloc call site, kept in all builds
+#define	MAX_HUNK_SITES	512		// must be a power of two
+
+typedef struct {
+	const char	*label;
+	const char	*file;
+	int			line;
+	int			bytes;
+	int			count;
+	int			markBytes;
+	int			markCount;
+} hunkSite_t;
+
+static	hunkSite_t	hunkSites[MAX_HUNK_SITES];
+static	int			numHunkSites;
+static	hunkSite_t	*hunkOtherSite;		// the last free slot, once the table is full
+
+static void Hunk_Usage_f( void );
+
 static	hunkUsed_t	hunk_low, hunk_high;
 static	hunkUsed_t	*hunk_permanent, *hunk_temp;
 
+// the hunk is a reservation of s_hunkTotal bytes of address space, each
+// bank commits pages from its end as it grows and the uncommitted space
+// between the two banks faults on any access
+#define	HUNK_COMMIT_CHUNK	0x100000
+
 static	byte	*s_hunkData = NULL;
 static	int		s_hunkTotal;
+static	int		s_hunkMegs;				// com_hunkMegs in bytes, only a warning level now
+static	int		s_hunkLowCommitted;
+static	int		s_hunkHighCommitted;
+static	qboolean	s_hunkWarned;
 
 static	int		s_zoneTotal;
 static	int		s_smallZoneTotal;
 
 
+/*
+=================
+Com_ZoneStats
+=================
+*/
+static void Com_ZoneStats( memzone_t *zone, const char *name ) {
+	memblock_t	*block;
+	int			freeBytes, freeBlocks, largest;
+
+	freeBytes = 0;
+	freeBlocks = 0;
+	largest = 0;
+	for ( block = zone->blocklist.next ; block != &zone->blocklist ; block = block->next ) {
+		if ( !block->tag ) {
+			freeBytes += block->size;
+			freeBlocks++;
+			if ( block->size > largest ) {
+				largest = block->size;
+			}
+		}
+	}
+
+	Com_Printf( "%8i bytes free in %i %s zone blocks, largest %i, %i%% fragmented\n", freeBytes, freeBlocks,
+		name, largest, freeBytes ? 100 - (int)( (float)largest * 100 / freeBytes ) : 0 );
+	Com_Printf( "        %8i allocs, %i frees, %.2f free blocks and %.2f bin words checked per alloc, at most %i blocks\n",
+		zone->allocs, zone->frees, zone->allocs ? (float)zone->probes / zone->allocs : 0,
+		zone->allocs ? (float)zone->binSearches / zone->allocs : 0, zone->maxProbes );
+}
+
 /*
 =================
 Com_Meminfo_f
@@ -1296,6 +1511,8 @@ void Com_Meminfo_f( void ) {
 	}
 
 	Com_Printf( "%8i bytes total hunk\n", s_hunkTotal );
+	Com_Printf( "%8i bytes committed hunk, %i low and %i high\n", s_hunkLowCommitted + s_hunkHighCommitted,
+		s_hunkLowCommitted, s_hunkHighCommitted );
 	Com_Printf( "%8i bytes total zone\n", s_zoneTotal );
 	Com_Printf( "\n" );
 	Com_Printf( "%8i low mark\n", hunk_low.mark );
@@ -1327,6 +1544,9 @@ void Com_Meminfo_f( void ) {
 	Com_Printf( "        %8i bytes in dynamic renderer\n", rendererBytes );
 	Com_Printf( "        %8i bytes in dynamic other\n", zoneBytes - ( botlibBytes + rendererBytes ) );
 	Com_Printf( "        %8i bytes in small Zone memory\n", smallZoneBytes );
+	Com_Printf( "\n" );
+	Com_ZoneStats( mainzone, "main" );
+	Com_ZoneStats( smallzone, "small" );
 }
 
 /*
@@ -1528,21 +1748,46 @@ void Com_InitHunkMemory( void ) {
 	}
 
 	if ( cv->integer < nMinAlloc ) {
-		s_hunkTotal = 1024 * 1024 * nMinAlloc;
-	    Com_Printf(pMsg, nMinAlloc, s_hunkTotal / (1024 * 1024));
+		s_hunkMegs = 1024 * 1024 * nMinAlloc;
+	    Com_Printf(pMsg, nMinAlloc, s_hunkMegs / (1024 * 1024));
+	} else if ( cv->integer > MAX_COMHUNKMEGS ) {
+		s_hunkMegs = 1024 * 1024 * MAX_COMHUNKMEGS;
 	} else {
-		s_hunkTotal = cv->integer * 1024 * 1024;
+		s_hunkMegs = cv->integer * 1024 * 1024;
+	}
+
+	// reserve room to grow past com_hunkMegs, only the pages that
+	// are actually used get committed
+	cv = Cvar_Get( "com_hunkMaxMegs", DEF_COMHUNKMAXMEGS_S, CVAR_LATCH | CVAR_ARCHIVE );
+	s_hunkTotal = s_hunkMegs;
+	if ( cv->integer > s_hunkTotal / ( 1024 * 1024 ) ) {
+		s_hunkTotal = ( cv->integer < MAX_COMHUNKMEGS ? cv->integer : MAX_COMHUNKMEGS ) * 1024 * 1024;
 	}
 
-	s_hunkData = calloc( s_hunkTotal + 31, 1 );
-	if ( !s_hunkData ) {
-		Com_Error( ERR_FATAL, "Hunk data failed to allocate %i megs", s_hunkTotal / (1024*1024) );
+	s_hunkData = Sys_ReserveMemory( s_hunkTotal );
+	if ( !s_hunkData && s_hunkTotal > s_hunkMegs ) {
+		s_hunkTotal = s_hunkMegs;
+		s_hunkData = Sys_ReserveMemory( s_hunkTotal );
+	}
+
+	if ( s_hunkData ) {
+		s_hunkLowCommitted = 0;
+		s_hunkHighCommitted = 0;
+	} else {
+		// no reservations on this system, allocate it all up front
+		s_hunkData = calloc( s_hunkTotal + 31, 1 );
+		if ( !s_hunkData ) {
+			Com_Error( ERR_FATAL, "Hunk data failed to allocate %i megs", s_hunkTotal / (1024*1024) );
+		}
+		// cacheline align
+		s_hunkData = (byte *) ( ( (intptr_t)s_hunkData + 31 ) & ~31 );
+		s_hunkLowCommitted = s_hunkTotal;
+		s_hunkHighCommitted = 0;
 	}
-	// cacheline align
-	s_hunkData = (byte *) ( ( (intptr_t)s_hunkData + 31 ) & ~31 );
 	Hunk_Clear();
 
 	Cmd_AddCommand( "meminfo", Com_Meminfo_f );
+	Cmd_AddCommand( "hunkusage", Hunk_Usage_f );
 #ifdef ZONE_DEBUG
 	Cmd_AddCommand( "zonelog", Z_LogHeap );
 #endif
@@ -1574,8 +1819,15 @@ The server calls this after the level and game VM have been loaded
 ===================
 */
 void Hunk_SetMark( void ) {
+	int		i;
+
 	hunk_low.mark = hunk_low.permanent;
 	hunk_high.mark = hunk_high.permanent;
+
+	for ( i = 0 ; i < MAX_HUNK_SITES ; i++ ) {
+		hunkSites[i].markBytes = hunkSites[i].bytes;
+		hunkSites[i].markCount = hunkSites[i].count;
+	}
 }
 
 /*
@@ -1586,8 +1838,15 @@ The client calls this before starting a vid_restart or snd_restart
 =================
 */
 void Hunk_ClearToMark( void ) {
+	int		i;
+
 	hunk_low.permanent = hunk_low.temp = hunk_low.mark;
 	hunk_high.permanent = hunk_high.temp = hunk_high.mark;
+
+	for ( i = 0 ; i < MAX_HUNK_SITES ; i++ ) {
+		hunkSites[i].bytes = hunkSites[i].markBytes;
+		hunkSites[i].count = hunkSites[i].markCount;
+	}
 }
 
 /*
@@ -1636,6 +1895,11 @@ void Hunk_Clear( void ) {
 	hunk_permanent = &hunk_low;
 	hunk_temp = &hunk_high;
 
+	Com_Memset( hunkSites, 0, sizeof( hunkSites ) );
+	numHunkSites = 0;
+	hunkOtherSite = NULL;
+	s_hunkWarned = qfalse;
+
 	Com_Printf( "Hunk_Clear: reset the hunk ok\n" );
 	VM_Clear();
 #ifdef HUNK_DEBUG
@@ -1663,16 +1927,175 @@ static void Hunk_SwapBanks( void ) {
 
 /*
 =================
-Hunk_Alloc
+Hunk_Commit
 
-Allocate permanent (until the hunk is cleared) memory
+Makes sure the first used bytes of a bank are backed by memory
 =================
 */
-#ifdef HUNK_DEBUG
-void *Hunk_AllocDebug( int size, ha_pref preference, char *label, char *file, int line ) {
-#else
-void *Hunk_Alloc( int size, ha_pref preference ) {
-#endif
+static qboolean Hunk_Commit( hunkUsed_t *bank, int used ) {
+	int		*committed, *other;
+	int		size;
+	byte	*base;
+
+	if ( bank == &hunk_low ) {
+		committed = &s_hunkLowCommitted;
+		other = &s_hunkHighCommitted;
+	} else {
+		committed = &s_hunkHighCommitted;
+		other = &s_hunkLowCommitted;
+	}
+
+	if ( used <= *committed ) {
+		return qtrue;
+	}
+
+	// whatever is left past the other bank's pages is already committed
+	size = PAD( used, HUNK_COMMIT_CHUNK );
+	if ( size > s_hunkTotal - *other ) {
+		size = s_hunkTotal - *other;
+	}
+	if ( size <= *committed ) {
+		return qtrue;
+	}
+
+	if ( bank == &hunk_low ) {
+		base = s_hunkData + *committed;
+	} else {
+		base = s_hunkData + s_hunkTotal - size;
+	}
+	if ( !Sys_CommitMemory( base, size - *committed ) ) {
+		return qfalse;
+	}
+	*committed = size;
+
+	if ( !s_hunkWarned && s_hunkLowCommitted + s_hunkHighCommitted > s_hunkMegs ) {
+		s_hunkWarned = qtrue;
+		Com_Printf( S_COLOR_YELLOW "WARNING: hunk grew past com_hunkMegs %i\n", s_hunkMegs / ( 1024 * 1024 ) );
+	}
+	return qtrue;
+}
+
+/*
+=================
+Hunk_CountSite
+=================
+*/
+static void Hunk_CountSite( const char *label, const char *file, int line, int size ) {
+	hunkSite_t	*site;
+	int			hash, i;
+
+	// the strings are literals, so each call site has its own file pointer
+	hash = ( line * 31 + (int)( (intptr_t)file >> 4 ) ) & ( MAX_HUNK_SITES - 1 );
+	for ( i = 0 ; i < MAX_HUNK_SITES ; i++ ) {
+		site = &hunkSites[hash];
+		if ( !site->file ) {
+			if ( numHunkSites == MAX_HUNK_SITES - 1 ) {
+				// full, the last free slot collects everything else
+				label = "other sites";
+				file = "";
+				line = 0;
+				hunkOtherSite = site;
+			}
+			site->label = label;
+			site->file = file;
+			site->line = line;
+			numHunkSites++;
+			break;
+		}
+		if ( site->file == file && site->line == line ) {
+			break;
+		}
+		hash = ( hash + 1 ) & ( MAX_HUNK_SITES - 1 );
+	}
+
+	// a new site after the table filled up
+	if ( i == MAX_HUNK_SITES ) {
+		site = hunkOtherSite;
+	}
+
+	site->bytes += size;
+	site->count++;
+}
+
+/*
+=================
+Hunk_CompareSites
+=================
+*/
+static int Hunk_CompareSites( const void *a, const void *b ) {
+	return ( *(hunkSite_t **)b )->bytes - ( *(hunkSite_t **)a )->bytes;
+}
+
+/*
+=================
+Hunk_Usage_f
+
+Lists the permanent hunk memory by source file, or by
+call site with "hunkusage sites"
+=================
+*/
+static void Hunk_Usage_f( void ) {
+	hunkSite_t	*sorted[MAX_HUNK_SITES];
+	hunkSite_t	files[MAX_HUNK_SITES];
+	hunkSite_t	*site;
+	qboolean	bySite;
+	int			i, j, num, sites, total;
+
+	bySite = ( Cmd_Argc() > 1 && !Q_stricmp( Cmd_Argv( 1 ), "sites" ) );
+
+	num = 0;
+	sites = 0;
+	total = 0;
+	for ( i = 0 ; i < MAX_HUNK_SITES ; i++ ) {
+		site = &hunkSites[i];
+		if ( !site->file || !site->bytes ) {
+			continue;
+		}
+		total += site->bytes;
+		sites++;
+
+		if ( bySite ) {
+			sorted[num++] = site;
+			continue;
+		}
+
+		for ( j = 0 ; j < num ; j++ ) {
+			if ( !Q_stricmp( files[j].file, COM_SkipPath( (char *)site->file ) ) ) {
+				break;
+			}
+		}
+		if ( j == num ) {
+			Com_Memset( &files[j], 0, sizeof( files[j] ) );
+			files[j].file = COM_SkipPath( (char *)site->file );
+			sorted[num++] = &files[j];
+		}
+		files[j].bytes += site->bytes;
+		files[j].count += site->count;
+	}
+
+	qsort( sorted, num, sizeof( sorted[0] ), Hunk_CompareSites );
+
+	for ( i = 0 ; i < num ; i++ ) {
+		site = sorted[i];
+		if ( bySite ) {
+			Com_Printf( "%8i bytes in %5i allocs  %s:%i (%s)\n", site->bytes, site->count,
+				COM_SkipPath( (char *)site->file ), site->line, site->label );
+		} else {
+			Com_Printf( "%8i bytes in %5i allocs  %s\n", site->bytes, site->count, site->file );
+		}
+	}
+	Com_Printf( "%8i bytes permanent hunk from %i call sites\n", total, sites );
+}
+
+/*
+=================
+Hunk_AllocLabel
+
+Allocate permanent (until the hunk is cleared) memory,
+use it through the Hunk_Alloc macro
+=================
+*/
+void *Hunk_AllocLabel( int size, ha_pref preference, const char *label, const char *file, int line ) {
 	void	*buf;
 
 	if ( s_hunkData == NULL)
@@ -1703,7 +2126,13 @@ void *Hunk_Alloc( int size, ha_pref preference ) {
 		Hunk_Log();
 		Hunk_SmallLog();
 #endif
-		Com_Error( ERR_DROP, "Hunk_Alloc failed on %i", size );
+		Hunk_Usage_f();
+		Com_Error( ERR_DROP, "Hunk_Alloc failed on %i from %s:%i", size, COM_SkipPath( (char *)file ), line );
+	}
+
+	if ( !Hunk_Commit( hunk_permanent, hunk_permanent->permanent + size ) ) {
+		Com_Error( ERR_DROP, "Hunk_Alloc could not commit %i bytes from %s:%i", size,
+			COM_SkipPath( (char *)file ), line );
 	}
 
 	if ( hunk_permanent == &hunk_low ) {
@@ -1717,6 +2146,7 @@ void *Hunk_Alloc( int size, ha_pref preference ) {
 	hunk_permanent->temp = hunk_permanent->permanent;
 
 	Com_Memset( buf, 0, size );
+	Hunk_CountSite( label, file, line, size );
 
 #ifdef HUNK_DEBUG
 	{
@@ -1765,6 +2195,10 @@ void *Hunk_AllocateTempMemory( int size ) {
 		Com_Error( ERR_DROP, "Hunk_AllocateTempMemory: failed on %i", size );
 	}
 
+	if ( !Hunk_Commit( hunk_temp, hunk_temp->temp + size ) ) {
+		Com_Error( ERR_DROP, "Hunk_AllocateTempMemory: could not commit %i bytes", size );
+	}
+
 	if ( hunk_temp == &hunk_low ) {
 		buf = (void *)(s_hunkData + hunk_temp->temp);
 		hunk_temp->temp += size;
@@ -1902,12 +2336,27 @@ static int com_pushedEventsHead = 0;
 static int com_pushedEventsTail = 0;
 static sysEvent_t	com_pushedEvents[MAX_PUSHED_EVENTS];
 
+// a replay runs as fast as it can and is timed, the playerstate
+// checksum of the recording is kept in journalsum.dat to compare with
+static unsigned	com_journalChecksum;
+static int		com_journalStates;
+static unsigned	com_recordedChecksum;
+static int		com_recordedStates = -1;
+
+static unsigned	*com_replayFrameUsec;
+static int		com_replayFrames;
+static int		com_replayFramesAllocated;
+static int		com_replayStartMsec;
+static int		com_replayStartCPU;
+
 /*
 =================
 Com_InitJournaling
 =================
 */
 void Com_InitJournaling( void ) {
+	char	*sum;
+
 	Com_StartupVariable( "journal" );
 	com_journal = Cvar_Get ("journal", "0", CVAR_INIT);
 	if ( !com_journal->integer ) {
@@ -1922,16 +2371,122 @@ void Com_InitJournaling( void ) {
 		Com_Printf( "Replaying journaled events\n");
 		FS_FOpenFileRead( "journal.dat", &com_journalFile, qtrue );
 		FS_FOpenFileRead( "journaldata.dat", &com_journalDataFile, qtrue );
+
+		if ( FS_ReadFile( "journalsum.dat", (void **)&sum ) > 0 ) {
+			if ( sscanf( sum, "%x %i", &com_recordedChecksum, &com_recordedStates ) != 2 ) {
+				com_recordedStates = -1;
+			}
+			FS_FreeFile( sum );
+		}
+		com_replayStartMsec = Sys_Milliseconds();
+		com_replayStartCPU = Sys_ProcessMilliseconds();
 	}
 
 	if ( !com_journalFile || !com_journalDataFile ) {
-		Cvar_Set( "com_journal", "0" );
+		Cvar_Set( "journal", "0" );
 		com_journalFile = 0;
 		com_journalDataFile = 0;
 		Com_Printf( "Couldn't open journal files\n" );
 	}
 }
 
+/*
+=================
+Com_JournalChecksum
+
+Folds game state that must come out the same in a replay,
+like the playerstates, into the journal checksum
+=================
+*/
+void Com_JournalChecksum( const void *data, int length ) {
+	if ( !com_journal || !com_journal->integer ) {
+		return;
+	}
+	com_journalChecksum = ( com_journalChecksum << 5 | com_journalChecksum >> 27 )
+		^ Com_BlockChecksum( data, length );
+	com_journalStates++;
+}
+
+/*
+=================
+Com_JournalFrameTime
+=================
+*/
+static void Com_JournalFrameTime( unsigned usec ) {
+	if ( com_replayFrames == com_replayFramesAllocated ) {
+		com_replayFramesAllocated = com_replayFramesAllocated ? com_replayFramesAllocated * 2 : 4096;
+		com_replayFrameUsec = realloc( com_replayFrameUsec,
+			com_replayFramesAllocated * sizeof( *com_replayFrameUsec ) );
+		if ( !com_replayFrameUsec ) {
+			Com_Error( ERR_FATAL, "Com_JournalFrameTime: out of memory" );
+		}
+	}
+	com_replayFrameUsec[com_replayFrames++] = usec;
+}
+
+/*
+=================
+Com_CompareFrameTimes
+=================
+*/
+static int Com_CompareFrameTimes( const void *a, const void *b ) {
+	unsigned	ua = *(const unsigned *)a, ub = *(const unsigned *)b;
+
+	return ua < ub ? -1 : ua > ub;
+}
+
+/*
+=================
+Com_ShutdownJournaling
+
+Writes the checksum of a recording, or reports on a replay
+=================
+*/
+static void Com_ShutdownJournaling( void ) {
+	fileHandle_t	f;
+	unsigned		*usec;
+	int				n;
+	char			*sum;
+
+	if ( !com_journal || !com_journal->integer ) {
+		return;
+	}
+
+	if ( com_journal->integer == 1 ) {
+		sum = va( "%08x %i\n", com_journalChecksum, com_journalStates );
+		f = FS_FOpenFileWrite( "journalsum.dat" );
+		if ( f ) {
+			FS_Write( sum, strlen( sum ), f );
+			FS_FCloseFile( f );
+		}
+		return;
+	}
+
+	n = com_replayFrames;
+	usec = com_replayFrameUsec;
+	Com_Printf( "journal replay: %i frames in %i msec, %i msec cpu\n", n,
+		Sys_Milliseconds() - com_replayStartMsec, Sys_ProcessMilliseconds() - com_replayStartCPU );
+	if ( n ) {
+		qsort( usec, n, sizeof( *usec ), Com_CompareFrameTimes );
+		Com_Printf( "frame usec: min %u, median %u, 90%% %u, 99%% %u, max %u\n",
+			usec[0], usec[n / 2], usec[n * 9 / 10], usec[n * 99 / 100], usec[n - 1] );
+	}
+
+	Com_Printf( "checksum %08x over %i states", com_journalChecksum, com_journalStates );
+	if ( com_recordedStates < 0 ) {
+		Com_Printf( ", nothing recorded to compare with\n" );
+	} else if ( com_recordedChecksum == com_journalChecksum && com_recordedStates == com_journalStates ) {
+		Com_Printf( ", same as the recording\n" );
+	} else {
+		Com_Printf( S_COLOR_YELLOW ", the recording has %08x over %i states\n",
+			com_recordedChecksum, com_recordedStates );
+	}
+
+	free( com_replayFrameUsec );
+	com_replayFrameUsec = NULL;
+	com_replayFrames = com_replayFramesAllocated = 0;
+}
+
 /*
 ========================================================================
 
@@ -2063,6 +2618,12 @@ sysEvent_t	Com_GetRealEvent( void ) {
 	// either get an event from the system or the journal file
 	if ( com_journal->integer == 2 ) {
 		r = FS_Read( &ev, sizeof(ev), com_journalFile );
+		if ( r == 0 ) {
+			// the recording stopped without a quit
+			Com_Printf( "End of journal\n" );
+			Cmd_TokenizeString( "" );
+			Com_Quit_f();
+		}
 		if ( r != sizeof(ev) ) {
 			Com_Error( ERR_FATAL, "Error reading from journal file" );
 		}
@@ -2544,6 +3105,11 @@ void Com_Init( char *commandLine ) {
 	// done early so bind command exists
 	CL_InitKeyCommands();
 
+	// the filesystem startup already runs jobs, a thread count
+	// from the config files is picked up below
+	com_jobThreads = Cvar_Get( "com_jobThreads", "2", CVAR_ARCHIVE | CVAR_LATCH );
+	Sys_InitJobs( com_jobThreads->integer );
+
 	FS_InitFilesystem ();
 
 	Com_InitJournaling();
@@ -2611,6 +3177,7 @@ void Com_Init( char *commandLine ) {
 	com_standalone = Cvar_Get( "com_standalone", "0", CVAR_INIT );
 
 	com_introPlayed = Cvar_Get( "com_introplayed", "0", CVAR_ARCHIVE);
+	com_jobThreads = Cvar_Get( "com_jobThreads", "2", CVAR_ARCHIVE | CVAR_LATCH );
 
 	if ( com_developer && com_developer->integer ) {
 		Cmd_AddCommand ("error", Com_Error_f);
@@ -2627,6 +3194,11 @@ void Com_Init( char *commandLine ) {
 
 	Sys_Init();
 
+	if ( com_jobThreads->integer != Sys_NumJobThreads() ) {
+		Sys_ShutdownJobs();
+		Sys_InitJobs( com_jobThreads->integer );
+	}
+
 	// Pick a random port value
 	Com_RandomBytes( (byte*)&qport, sizeof(int) );
 	Netchan_Init( qport & 0xffff );
@@ -2816,6 +3388,7 @@ void Com_Frame( void ) {
 	int		msec, minMsec;
 	static int	lastTime;
 	int key;
+	unsigned	frameStart;
  
 	int		timeBeforeFirstEvents;
 	int           timeBeforeServer;
@@ -2831,6 +3404,8 @@ void Com_Frame( void ) {
 		return;			// an ERR_DROP was thrown
 	}
 
+	frameStart = com_journal->integer == 2 ? Sys_Microseconds() : 0;
+
 	timeBeforeFirstEvents =0;
 	timeBeforeServer =0;
 	timeBeforeEvents =0;
@@ -2873,7 +3448,8 @@ void Com_Frame( void ) {
 		// The existing Sys_Sleep implementations aren't really
 		// precise enough to be of use beyond 100fps
 		// FIXME: implement a more precise sleep (RDTSC or something)
-		if( timeRemaining >= 10 )
+		// a replay has the time in its events
+		if( timeRemaining >= 10 && com_journal->integer != 2 )
 			Sys_Sleep( timeRemaining );
 
 		com_frameTime = Com_EventLoop();
@@ -2984,6 +3560,10 @@ void Com_Frame( void ) {
 	// old net chan encryption key
 	key = lastTime * 0x87243987;
 
+	if ( com_journal->integer == 2 ) {
+		Com_JournalFrameTime( Sys_Microseconds() - frameStart );
+	}
+
 	com_frameNumber++;
 }
 
@@ -2993,6 +3573,9 @@ Com_Shutdown
 =================
 */
 void Com_Shutdown (void) {
+	Sys_ShutdownJobs();
+	Com_ShutdownJournaling();
+
 	if (logfile) {
 		FS_FCloseFile (logfile);
 		logfile = 0;
@@ -32,30 +32,41 @@ int			cvar_modifiedFlags;
 cvar_t		cvar_indexes[MAX_CVARS];
 int			cvar_numIndexes;
 
-#define FILE_HASH_SIZE		256
-static	cvar_t*		hashTable[FILE_HASH_SIZE];
+// open addressing on the full name hash, there can never be more
+// than MAX_CVARS names so the table stays at most half full
+#define	CVAR_HASH_SIZE		( MAX_CVARS * 2 )
+#define	CVAR_HASH_DELETED	( (cvar_t *)&cvar_hashTable )
+static	cvar_t		*cvar_hashTable[CVAR_HASH_SIZE];
 
 cvar_t *Cvar_Set2( const char *var_name, const char *value, qboolean force);
 
 /*
-================
-return a hash value for the filename
-================
+============
+Cvar_HashSlot
+
+Returns the slot holding the name, or the first free one
+============
 */
-static long generateHashValue( const char *fname ) {
+static cvar_t **Cvar_HashSlot( const char *var_name, unsigned hash ) {
+	cvar_t	**slot, **deleted;
 	int		i;
-	long	hash;
-	char	letter;
 
-	hash = 0;
-	i = 0;
-	while (fname[i] != '\0') {
-		letter = tolower(fname[i]);
-		hash+=(long)(letter)*(i+119);
-		i++;
+	deleted = NULL;
+	for ( i = hash & ( CVAR_HASH_SIZE - 1 ) ; ; i = ( i + 1 ) & ( CVAR_HASH_SIZE - 1 ) ) {
+		slot = &cvar_hashTable[i];
+		if ( !*slot ) {
+			return deleted ? deleted : slot;
+		}
+		if ( *slot == CVAR_HASH_DELETED ) {
+			if ( !deleted ) {
+				deleted = slot;
+			}
+			continue;
+		}
+		if ( (*slot)->hashValue == hash && !Q_stricmp( var_name, (*slot)->name ) ) {
+			return slot;
+		}
 	}
-	hash &= (FILE_HASH_SIZE-1);
-	return hash;
 }
 
 /*
@@ -86,17 +97,53 @@ Cvar_FindVar
 */
 static cvar_t *Cvar_FindVar( const char *var_name ) {
 	cvar_t	*var;
-	long hash;
 
-	hash = generateHashValue(var_name);
-	
-	for (var=hashTable[hash] ; var ; var=var->hashNext) {
-		if (!Q_stricmp(var_name, var->name)) {
-			return var;
-		}
+	var = *Cvar_HashSlot( var_name, Com_HashKeyNoCase( var_name ) );
+	if ( var == CVAR_HASH_DELETED ) {
+		return NULL;
+	}
+	return var;
+}
+
+/*
+============
+Cvar_Ref
+============
+*/
+cvar_t *Cvar_Ref( cvarRef_t *ref ) {
+	// cvar_restart clears the cvars the user created
+	if ( !ref->var || !ref->var->name ) {
+		ref->var = Cvar_FindVar( ref->name );
 	}
+	return ref->var;
+}
 
-	return NULL;
+/*
+============
+Cvar_RefValue
+============
+*/
+float Cvar_RefValue( cvarRef_t *ref ) {
+	cvar_t	*var;
+
+	var = Cvar_Ref( ref );
+	if (!var)
+		return 0;
+	return var->value;
+}
+
+/*
+============
+Cvar_RefInteger
+============
+*/
+int Cvar_RefInteger( cvarRef_t *ref ) {
+	cvar_t	*var;
+
+	var = Cvar_Ref( ref );
+	if (!var)
+		return 0;
+	return var->integer;
 }
 
 /*
@@ -303,7 +350,6 @@ The flags will be or'ed in if the variable exists.
 */
 cvar_t *Cvar_Get( const char *var_name, const char *var_value, int flags ) {
 	cvar_t	*var;
-	long	hash;
 
 	if ( !var_name || ! var_value ) {
 		Com_Error( ERR_FATAL, "Cvar_Get: NULL parameter" );
@@ -397,9 +443,8 @@ cvar_t *Cvar_Get( const char *var_name, const char *var_value, int flags ) {
 	// note what types of cvars have been modified (userinfo, archive, serverinfo, systeminfo)
 	cvar_modifiedFlags |= var->flags;
 
-	hash = generateHashValue(var_name);
-	var->hashNext = hashTable[hash];
-	hashTable[hash] = var;
+	var->hashValue = Com_HashKeyNoCase( var_name );
+	*Cvar_HashSlot( var_name, var->hashValue ) = var;
 
 	return var;
 }
@@ -918,6 +963,7 @@ void Cvar_Restart_f( void ) {
 		// throw out any variables the user created
 		if ( var->flags & CVAR_USER_CREATED ) {
 			*prev = var->next;
+			*Cvar_HashSlot( var->name, var->hashValue ) = CVAR_HASH_DELETED;
 			if ( var->name ) {
 				Z_Free( var->name );
 			}
@@ -932,7 +978,7 @@ void Cvar_Restart_f( void ) {
 			}
 			// clear the var completely, since we
 			// can't remove the index from the list
-			Com_Memset( var, 0, sizeof( var ) );
+			Com_Memset( var, 0, sizeof( *var ) );
 			continue;
 		}
 
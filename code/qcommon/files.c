@@ -198,6 +198,10 @@ static const unsigned pak_checksums[] = {
 #define MAX_ZPATH			256
 #define	MAX_SEARCH_PATHS	4096
 #define MAX_FILEHASH_SIZE	1024
+#define	MAX_MAPPED_32_KB	0x80000		// address space for mapped paks in 32 bit builds
+#define	MAX_MANIFEST_TEXT	0x20000		// qpaths recorded while loading a map
+#define	MANIFEST_HASH_SIZE	4096
+#define	MANIFEST_MERGE_GAP	0x10000		// readahead ranges closer than this are merged
 
 typedef struct fileInPack_s {
 	char					*name;		// name of the file
@@ -217,6 +221,8 @@ typedef struct {
 	int				hashSize;					// hash table size (power of 2)
 	fileInPack_t*	*hashTable;					// hash table
 	fileInPack_t*	buildBuffer;				// buffer with the filenames etc.
+	void			*mapped;					// the whole pk3 mapped read only, or NULL
+	int				mappedSize;
 } pack_t;
 
 typedef struct {
@@ -224,13 +230,45 @@ typedef struct {
 	char		gamedir[MAX_OSPATH];	// baseq3
 } directory_t;
 
+// a zip file read by a job thread, turned into a pack_t on the main thread
+typedef struct {
+	job_t			job;
+	char			pakFilename[MAX_OSPATH];
+	unz_s			zip;
+	qboolean		ok;
+	int				numNames;
+	char			*names;				// lower case and zero terminated, in zip order
+	unsigned long	*positions;			// file info position of each name
+	int				checksum;
+	int				pure_checksum;
+	void			*mapped;
+	int				mappedSize;
+	int				msec;				// time spent scanning
+} zipScan_t;
+
 typedef struct searchpath_s {
 	struct searchpath_s *next;
 
 	pack_t		*pack;		// only one of pack / dir will be non NULL
 	directory_t	*dir;
+	int			order;		// position in fs_searchpaths when the file index was built
 } searchpath_t;
 
+// merged index over the contents of all search paths
+#define	FS_INDEX_MAX_DIRS	32
+#define	FS_INDEX_MAX_NAMES	0x10000		// looked up names that are in no pak
+
+typedef struct fsIndexEntry_s {
+	const char				*name;
+	searchpath_t			*search;		// pak holding the file, NULL if only looked up
+	fileInPack_t			*pakFile;
+	struct fsIndexEntry_s	*alt;			// same name in a later pak
+	struct fsIndexEntry_s	*next;			// next name in the hash chain
+	int						dirGeneration;	// dirKnown / dirFound are valid for this generation
+	unsigned				dirKnown;		// directories probed for this name
+	unsigned				dirFound;		// directories the file was found in
+} fsIndexEntry_t;
+
 static	char		fs_gamedir[MAX_OSPATH];	// this will be a single file name with no separators
 static	cvar_t		*fs_debug;
 static	cvar_t		*fs_homepath;
@@ -248,6 +286,32 @@ static	int			fs_readCount;			// total bytes read
 static	int			fs_loadCount;			// total files read
 static	int			fs_loadStack;			// total files in memory
 static	int			fs_packFiles;			// total number of files in packs
+static	int			fs_mappedKB;			// total size of mapped packs
+static	int			fs_mappedCount;			// files returned in place by FS_MapFile
+
+static	cvar_t			*fs_index;
+static	fsIndexEntry_t	**fs_indexTable;
+static	int				fs_indexSize;			// hash table size (power of 2)
+static	fsIndexEntry_t	*fs_indexBuffer;		// entries for all files in packs
+static	searchpath_t	*fs_indexDirs[FS_INDEX_MAX_DIRS];
+static	int				fs_indexNumDirs;
+static	int				fs_indexNames;			// entries added by lookups
+static	int				fs_indexGeneration;		// bumped on every write below the home path
+static	int				fs_indexLookups;
+static	int				fs_indexProbes;			// directory probes that went to the OS
+static	int				fs_indexMisses;
+
+static	cvar_t		*fs_manifest;
+static	qboolean	fs_manifestRecording;
+static	char		fs_manifestMap[MAX_QPATH];
+static	char		fs_manifestPath[MAX_OSPATH];	// below the home path, empty if not saved
+static	char		fs_manifestText[MAX_MANIFEST_TEXT];	// one qpath per line in load order
+static	int			fs_manifestTextLen;
+static	int			fs_manifestHash[MANIFEST_HASH_SIZE];	// offset + 1 in fs_manifestText
+static	int			fs_manifestFiles;
+static	unsigned	fs_manifestChecksum;	// of the manifest read at the start of the load
+static	int			fs_manifestReadaheadKB;	// -1 if there was no manifest
+static	int			fs_manifestStartTime;
 
 static int fs_fakeChkSum;
 static int fs_checksumFeed;
@@ -478,7 +542,7 @@ FS_CreatePath
 Creates any directories needed to store the given filename
 ============
 */
-static qboolean FS_CreatePath (char *OSPath) {
+qboolean FS_CreatePath (char *OSPath) {
 	char	*ofs;
 	
 	// make absolutely sure that it can't back up the path
@@ -504,6 +568,7 @@ static qboolean FS_CreatePath (char *OSPath) {
 FS_CheckFilenameIsNotExecutable
 
 ERR_FATAL if trying to maniuplate a file with the platform library extension
+or a native code cache, which is written by the vm compiler directly
 =================
  */
 static void FS_CheckFilenameIsNotExecutable( const char *filename,
@@ -515,6 +580,12 @@ static void FS_CheckFilenameIsNotExecutable( const char *filename,
 		Com_Error( ERR_FATAL, "%s: Not allowed to manipulate '%s' due "
 			"to %s extension\n", function, filename, DLL_EXT );
 	}
+
+	if( !Q_stricmp( COM_GetExtension( filename ), VM_CACHE_EXT ) )
+	{
+		Com_Error( ERR_FATAL, "%s: Not allowed to manipulate '%s' due "
+			"to .%s extension\n", function, filename, VM_CACHE_EXT );
+	}
 }
 
 
@@ -577,6 +648,7 @@ FS_Remove
 void FS_Remove( const char *osPath ) {
 	FS_CheckFilenameIsNotExecutable( osPath, __func__ );
 
+	fs_indexGeneration++;
 	remove( osPath );
 }
 
@@ -589,6 +661,7 @@ FS_HomeRemove
 void FS_HomeRemove( const char *homePath ) {
 	FS_CheckFilenameIsNotExecutable( homePath, __func__ );
 
+	fs_indexGeneration++;
 	remove( FS_BuildOSPath( fs_homepath->string,
 			fs_gamedir, homePath ) );
 }
@@ -673,6 +746,7 @@ fileHandle_t FS_SV_FOpenFileWrite( const char *filename ) {
 	}
 
 	Com_DPrintf( "writing to: %s\n", ospath );
+	fs_indexGeneration++;
 	fsh[f].handleFiles.file.o = fopen( ospath, "wb" );
 
 	Q_strncpyz( fsh[f].name, filename, sizeof( fsh[f].name ) );
@@ -779,6 +853,7 @@ void FS_SV_Rename( const char *from, const char *to ) {
 
 	FS_CheckFilenameIsNotExecutable( to_ospath, __func__ );
 
+	fs_indexGeneration++;
 	if (rename( from_ospath, to_ospath )) {
 		// Failed, try copying it and deleting the original
 		FS_CopyFile ( from_ospath, to_ospath );
@@ -813,6 +888,7 @@ void FS_Rename( const char *from, const char *to ) {
 
 	FS_CheckFilenameIsNotExecutable( to_ospath, __func__ );
 
+	fs_indexGeneration++;
 	if (rename( from_ospath, to_ospath )) {
 		// Failed, try copying it and deleting the original
 		FS_CopyFile ( from_ospath, to_ospath );
@@ -883,6 +959,7 @@ fileHandle_t FS_FOpenFileWrite( const char *filename ) {
 	// enabling the following line causes a recursive function call loop
 	// when running with +set logfile 1 +set developer 1
 	//Com_DPrintf( "writing to: %s\n", ospath );
+	fs_indexGeneration++;
 	fsh[f].handleFiles.file.o = fopen( ospath, "wb" );
 
 	Q_strncpyz( fsh[f].name, filename, sizeof( fsh[f].name ) );
@@ -928,6 +1005,7 @@ fileHandle_t FS_FOpenFileAppend( const char *filename ) {
 		return 0;
 	}
 
+	fs_indexGeneration++;
 	fsh[f].handleFiles.file.o = fopen( ospath, "ab" );
 	fsh[f].handleSync = qfalse;
 	if (!fsh[f].handleFiles.file.o) {
@@ -972,6 +1050,511 @@ qboolean FS_FilenameCompare( const char *s1, const char *s2 ) {
 	return qfalse;		// strings are equal
 }
 
+/*
+===========
+FS_AllowedFromDirectory
+
+When connected to a pure server only config, menu, demo and
+journal files may come from outside of a pak
+===========
+*/
+static qboolean FS_AllowedFromDirectory( const char *filename ) {
+	char	demoExt[16];
+	int		l;
+
+	if ( !fs_numServerPaks ) {
+		return qtrue;
+	}
+
+	Com_sprintf( demoExt, sizeof( demoExt ), ".dm_%d", PROTOCOL_VERSION );
+	l = strlen( filename );
+
+	// FIXME TTimo I'm not sure about the fs_numServerPaks test
+	// if you are using FS_ReadFile to find out if a file exists,
+	//   this test can make the search fail although the file is in the directory
+	// I had the problem on https://zerowing.idsoftware.com/bugzilla/show_bug.cgi?id=8
+	// turned out I used FS_FileExists instead
+	if ( Q_stricmp( filename + l - 4, ".cfg" )		// for config files
+		&& Q_stricmp( filename + l - 5, ".menu" )	// menu files
+		&& Q_stricmp( filename + l - 5, ".game" )	// menu files
+		&& Q_stricmp( filename + l - strlen(demoExt), demoExt )	// menu files
+		&& Q_stricmp( filename + l - 4, ".dat" ) ) {	// for journal files
+		return qfalse;
+	}
+	return qtrue;
+}
+
+/*
+=================================================================================
+
+MERGED FILE INDEX
+
+A single hash table over the contents of all search paths, so a lookup
+doesn't have to probe the hash table of every pk3 and fopen every
+directory in turn. Pak contents are entered when the search paths are
+set up, directories are probed on demand and the result, found or not,
+is kept with the name until something is written below the home path.
+
+Files added to a directory by other programs are not seen until the
+next FS_Restart, set fs_index 0 to search the paths one by one.
+
+=================================================================================
+*/
+
+/*
+================
+FS_IndexHash
+
+Hash of the whole name, case and separator insensitive like FS_FilenameCompare
+================
+*/
+static unsigned FS_IndexHash( const char *fname ) {
+	unsigned	hash;
+	int			c;
+
+	hash = 0;
+	while ( ( c = *fname++ ) != '\0' ) {
+		if ( c >= 'A' && c <= 'Z' ) {
+			c += 'a' - 'A';
+		}
+		if ( c == '\\' || c == ':' ) {
+			c = '/';
+		}
+		hash = hash * 31 + c;
+	}
+	hash ^= hash >> 16;
+	return hash & ( fs_indexSize - 1 );
+}
+
+/*
+================
+FS_IndexSameSpelling
+
+Directory probes are only remembered for the exact spelling they were
+made with, the OS may be case sensitive
+================
+*/
+static qboolean FS_IndexSameSpelling( const char *s1, const char *s2 ) {
+	int		c1, c2;
+
+	do {
+		c1 = *s1++;
+		c2 = *s2++;
+
+		if ( c1 == '\\' || c1 == PATH_SEP ) {
+			c1 = '/';
+		}
+		if ( c2 == '\\' || c2 == PATH_SEP ) {
+			c2 = '/';
+		}
+
+		if ( c1 != c2 ) {
+			return qfalse;
+		}
+	} while ( c1 );
+
+	return qtrue;
+}
+
+/*
+================
+FS_IndexFind
+
+Returns the entry for a name, entries for names that are in no
+pak are added when create is set
+================
+*/
+static fsIndexEntry_t *FS_IndexFind( const char *filename, qboolean create ) {
+	fsIndexEntry_t	*entry;
+	unsigned		hash;
+	char			*name;
+
+	hash = FS_IndexHash( filename );
+	for ( entry = fs_indexTable[hash] ; entry ; entry = entry->next ) {
+		if ( !FS_FilenameCompare( entry->name, filename ) ) {
+			return entry;
+		}
+	}
+
+	if ( !create || fs_indexNames >= FS_INDEX_MAX_NAMES ) {
+		return NULL;
+	}
+
+	entry = Z_Malloc( sizeof( *entry ) + strlen( filename ) + 1 );
+	name = (char *)( entry + 1 );
+	strcpy( name, filename );
+	entry->name = name;
+	entry->next = fs_indexTable[hash];
+	fs_indexTable[hash] = entry;
+	fs_indexNames++;
+
+	return entry;
+}
+
+/*
+================
+FS_FreeIndex
+================
+*/
+static void FS_FreeIndex( void ) {
+	fsIndexEntry_t	*entry, *next;
+	int				i;
+
+	if ( !fs_indexTable ) {
+		return;
+	}
+
+	// entries added by lookups were allocated one by one
+	for ( i = 0 ; i < fs_indexSize ; i++ ) {
+		for ( entry = fs_indexTable[i] ; entry ; entry = next ) {
+			next = entry->next;
+			if ( !entry->search ) {
+				Z_Free( entry );
+			}
+		}
+	}
+
+	if ( fs_indexBuffer ) {
+		Z_Free( fs_indexBuffer );
+	}
+	Z_Free( fs_indexTable );
+
+	fs_indexTable = NULL;
+	fs_indexBuffer = NULL;
+	fs_indexSize = 0;
+	fs_indexNumDirs = 0;
+	fs_indexNames = 0;
+}
+
+/*
+================
+FS_BuildIndex
+
+Enters the contents of all paks in search order, must be called
+again whenever fs_searchpaths changes
+================
+*/
+static void FS_BuildIndex( void ) {
+	searchpath_t	*search;
+	fsIndexEntry_t	*entry, *head;
+	fileInPack_t	*pakFile;
+	unsigned		hash;
+	int				i, order, numFiles, numEntries;
+
+	FS_FreeIndex();
+
+	numFiles = 0;
+	fs_indexNumDirs = 0;
+	for ( search = fs_searchpaths, order = 0 ; search ; search = search->next, order++ ) {
+		search->order = order;
+		if ( search->pack ) {
+			numFiles += search->pack->numfiles;
+		} else if ( fs_indexNumDirs == FS_INDEX_MAX_DIRS ) {
+			Com_Printf( "WARNING: more than %i directories in the search path, file index disabled\n", FS_INDEX_MAX_DIRS );
+			fs_indexNumDirs = 0;
+			return;
+		} else {
+			fs_indexDirs[fs_indexNumDirs++] = search;
+		}
+	}
+
+	for ( fs_indexSize = 1024 ; fs_indexSize < numFiles ; fs_indexSize <<= 1 ) {
+	}
+	fs_indexTable = Z_Malloc( fs_indexSize * sizeof( *fs_indexTable ) );
+	if ( numFiles ) {
+		fs_indexBuffer = Z_Malloc( numFiles * sizeof( *fs_indexBuffer ) );
+	}
+
+	numEntries = 0;
+	for ( search = fs_searchpaths ; search ; search = search->next ) {
+		if ( !search->pack ) {
+			continue;
+		}
+		for ( i = 0 ; i < search->pack->numfiles ; i++ ) {
+			pakFile = &search->pack->buildBuffer[i];
+			if ( !pakFile->name ) {
+				break;		// the zip directory was cut short
+			}
+
+			hash = FS_IndexHash( pakFile->name );
+			for ( head = fs_indexTable[hash] ; head ; head = head->next ) {
+				if ( !FS_FilenameCompare( head->name, pakFile->name ) ) {
+					break;
+				}
+			}
+
+			if ( head ) {
+				// already in an earlier pak, keep it as an alternative for
+				// pure servers. Duplicates within one zip resolve like the
+				// pak hash table does, to the last one
+				for ( ; head->alt ; head = head->alt ) {
+				}
+				if ( head->search == search ) {
+					head->pakFile = pakFile;
+					continue;
+				}
+			}
+
+			entry = &fs_indexBuffer[numEntries++];
+			entry->name = pakFile->name;
+			entry->search = search;
+			entry->pakFile = pakFile;
+
+			if ( head ) {
+				head->alt = entry;
+			} else {
+				entry->next = fs_indexTable[hash];
+				fs_indexTable[hash] = entry;
+			}
+		}
+	}
+
+	fs_indexGeneration++;
+	fs_indexLookups = 0;
+	fs_indexProbes = 0;
+	fs_indexMisses = 0;
+}
+
+/*
+================
+FS_IndexSearch
+
+Returns the first search path that has the file, or NULL. When pure is
+set paks that are not on the pure list are skipped as well as directories
+for files that may not come from outside of a pak on a pure server. A
+file found in a directory is left open in *fp if fp is not NULL.
+================
+*/
+static searchpath_t *FS_IndexSearch( const char *filename, qboolean pure, fileInPack_t **pakFile, FILE **fp ) {
+	fsIndexEntry_t	*entry, *pak;
+	searchpath_t	*search;
+	qboolean		cache;
+	unsigned		bit;
+	FILE			*f;
+	int				d;
+
+	fs_indexLookups++;
+
+	entry = FS_IndexFind( filename, qtrue );
+	pak = ( entry && entry->search ) ? entry : NULL;
+
+	cache = entry && FS_IndexSameSpelling( entry->name, filename );
+	if ( cache && entry->dirGeneration != fs_indexGeneration ) {
+		entry->dirGeneration = fs_indexGeneration;
+		entry->dirKnown = 0;
+		entry->dirFound = 0;
+	}
+
+	d = 0;
+	for ( ;; ) {
+		if ( d < fs_indexNumDirs && ( !pak || fs_indexDirs[d]->order < pak->search->order ) ) {
+			search = fs_indexDirs[d];
+			bit = 1u << d++;
+
+			if ( pure && !FS_AllowedFromDirectory( filename ) ) {
+				continue;
+			}
+			if ( cache && ( entry->dirKnown & bit ) ) {
+				if ( !( entry->dirFound & bit ) ) {
+					continue;
+				}
+				if ( !fp ) {
+					*pakFile = NULL;
+					return search;
+				}
+			}
+
+			fs_indexProbes++;
+			f = fopen( FS_BuildOSPath( search->dir->path, search->dir->gamedir, filename ), "rb" );
+			if ( cache ) {
+				entry->dirKnown |= bit;
+				if ( f ) {
+					entry->dirFound |= bit;
+				} else {
+					entry->dirFound &= ~bit;
+				}
+			}
+			if ( !f ) {
+				continue;
+			}
+
+			if ( fp ) {
+				*fp = f;
+			} else {
+				fclose( f );
+			}
+			*pakFile = NULL;
+			return search;
+		}
+
+		if ( !pak ) {
+			break;
+		}
+		if ( !pure || FS_PakIsPure( pak->search->pack ) ) {
+			*pakFile = pak->pakFile;
+			return pak->search;
+		}
+		pak = pak->alt;
+	}
+
+	fs_indexMisses++;
+	return NULL;
+}
+
+/*
+===========
+FS_RecordManifestFile
+
+Adds a file opened while loading a map to the manifest, every
+file only once in the order it was first opened
+===========
+*/
+static void FS_RecordManifestFile( const char *filename ) {
+	int		hash, ofs, len, i;
+
+	if ( !fs_manifestRecording ) {
+		return;
+	}
+
+	len = strlen( filename );
+	if ( fs_manifestTextLen + len + 1 > MAX_MANIFEST_TEXT ) {
+		return;
+	}
+
+	hash = FS_HashFileName( filename, MANIFEST_HASH_SIZE );
+	for ( i = 0 ; i < MANIFEST_HASH_SIZE ; i++ ) {
+		ofs = fs_manifestHash[hash];
+		if ( !ofs ) {
+			break;
+		}
+		ofs--;
+		if ( !Q_stricmpn( fs_manifestText + ofs, filename, len ) && fs_manifestText[ofs + len] == '\n' ) {
+			return;
+		}
+		hash = ( hash + 1 ) & ( MANIFEST_HASH_SIZE - 1 );
+	}
+	if ( i == MANIFEST_HASH_SIZE ) {
+		return;
+	}
+
+	fs_manifestHash[hash] = fs_manifestTextLen + 1;
+	Com_Memcpy( fs_manifestText + fs_manifestTextLen, filename, len );
+	fs_manifestText[fs_manifestTextLen + len] = '\n';
+	fs_manifestTextLen += len + 1;
+	fs_manifestFiles++;
+}
+
+/*
+===========
+FS_OpenFileInPak
+
+Sets up a handle for reading a file found in a pak
+===========
+*/
+static int FS_OpenFileInPak( const char *filename, pack_t *pak, fileInPack_t *pakFile, fileHandle_t file, qboolean uniqueFILE ) {
+	unz_s			*zfi;
+	FILE			*temp;
+	int				l;
+
+	// mark the pak as having been referenced and mark specifics on cgame and ui
+	// shaders, txt, arena files  by themselves do not count as a reference as 
+	// these are loaded from all pk3s 
+	// from every pk3 file.. 
+	l = strlen( filename );
+	if ( !(pak->referenced & FS_GENERAL_REF)) {
+		if ( Q_stricmp(filename + l - 7, ".shader") != 0 &&
+			Q_stricmp(filename + l - 4, ".txt") != 0 &&
+			Q_stricmp(filename + l - 4, ".cfg") != 0 &&
+			Q_stricmp(filename + l - 7, ".config") != 0 &&
+			strstr(filename, "levelshots") == NULL &&
+			Q_stricmp(filename + l - 4, ".bot") != 0 &&
+			Q_stricmp(filename + l - 6, ".arena") != 0 &&
+			Q_stricmp(filename + l - 5, ".menu") != 0) {
+			pak->referenced |= FS_GENERAL_REF;
+		}
+	}
+
+	if (!(pak->referenced & FS_QAGAME_REF) && strstr(filename, "qagame.qvm")) {
+		pak->referenced |= FS_QAGAME_REF;
+	}
+	if (!(pak->referenced & FS_CGAME_REF) && strstr(filename, "cgame.qvm")) {
+		pak->referenced |= FS_CGAME_REF;
+	}
+	if (!(pak->referenced & FS_UI_REF) && strstr(filename, "ui.qvm")) {
+		pak->referenced |= FS_UI_REF;
+	}
+
+	if ( uniqueFILE ) {
+		// open a new file on the pakfile
+		fsh[file].handleFiles.file.z = unzReOpen (pak->pakFilename, pak->handle);
+		if (fsh[file].handleFiles.file.z == NULL) {
+			Com_Error (ERR_FATAL, "Couldn't reopen %s", pak->pakFilename);
+		}
+	} else {
+		fsh[file].handleFiles.file.z = pak->handle;
+	}
+	Q_strncpyz( fsh[file].name, filename, sizeof( fsh[file].name ) );
+	fsh[file].zipFile = qtrue;
+	zfi = (unz_s *)fsh[file].handleFiles.file.z;
+	// in case the file was new
+	temp = zfi->file;
+	// set the file position in the zip file (also sets the current file info)
+	unzSetCurrentFileInfoPosition(pak->handle, pakFile->pos);
+	if ( zfi != pak->handle ) {
+		// copy the file info into the unzip structure
+		Com_Memcpy( zfi, pak->handle, sizeof(unz_s) );
+	}
+	// we copy this back into the structure
+	zfi->file = temp;
+	// open the file in the zip
+	unzOpenCurrentFile( fsh[file].handleFiles.file.z );
+	fsh[file].zipFilePos = pakFile->pos;
+
+	FS_RecordManifestFile( filename );
+
+	if ( fs_debug->integer ) {
+		Com_Printf( "FS_FOpenFileRead: %s (found in '%s')\n", 
+			filename, pak->pakFilename );
+	}
+	return zfi->cur_file_info.uncompressed_size;
+}
+
+/*
+===========
+FS_OpenFileInDir
+
+Sets up a handle for reading a file opened in a directory
+===========
+*/
+static int FS_OpenFileInDir( const char *filename, directory_t *dir, FILE *f, fileHandle_t file ) {
+	char demoExt[16];
+	int l;
+
+	fsh[file].handleFiles.file.o = f;
+
+	Com_sprintf (demoExt, sizeof(demoExt), ".dm_%d",PROTOCOL_VERSION );
+	l = strlen( filename );
+	if ( Q_stricmp( filename + l - 4, ".cfg" )		// for config files
+		&& Q_stricmp( filename + l - 5, ".menu" )	// menu files
+		&& Q_stricmp( filename + l - 5, ".game" )	// menu files
+		&& Q_stricmp( filename + l - strlen(demoExt), demoExt )	// menu files
+		&& Q_stricmp( filename + l - 4, ".dat" ) ) {	// for journal files
+		fs_fakeChkSum = random();
+	}
+
+	Q_strncpyz( fsh[file].name, filename, sizeof( fsh[file].name ) );
+	fsh[file].zipFile = qfalse;
+
+	FS_RecordManifestFile( filename );
+
+	if ( fs_debug->integer ) {
+		Com_Printf( "FS_FOpenFileRead: %s (found in '%s/%s')\n", filename,
+			dir->path, dir->gamedir );
+	}
+
+	return FS_filelength (file);
+}
+
 /*
 ===========
 FS_FOpenFileRead
@@ -991,10 +1574,7 @@ int FS_FOpenFileRead( const char *filename, fileHandle_t *file, qboolean uniqueF
 	fileInPack_t	*pakFile;
 	directory_t		*dir;
 	long			hash;
-	unz_s			*zfi;
 	FILE			*temp;
-	int				l;
-	char demoExt[16];
 
 	hash = 0;
 
@@ -1004,6 +1584,10 @@ int FS_FOpenFileRead( const char *filename, fileHandle_t *file, qboolean uniqueF
 
 	if ( file == NULL ) {
 		// just wants to see if file is there
+		if ( fs_indexTable && fs_index->integer ) {
+			return FS_IndexSearch( filename, qfalse, &pakFile, NULL ) != NULL;
+		}
+
 		for ( search = fs_searchpaths ; search ; search = search->next ) {
 			//
 			if ( search->pack ) {
@@ -1041,7 +1625,6 @@ int FS_FOpenFileRead( const char *filename, fileHandle_t *file, qboolean uniqueF
 		Com_Error( ERR_FATAL, "FS_FOpenFileRead: NULL 'filename' parameter passed\n" );
 	}
 
-	Com_sprintf (demoExt, sizeof(demoExt), ".dm_%d",PROTOCOL_VERSION );
 	// qpaths are not supposed to have a leading slash
 	if ( filename[0] == '/' || filename[0] == '\\' ) {
 		filename++;
@@ -1062,142 +1645,64 @@ int FS_FOpenFileRead( const char *filename, fileHandle_t *file, qboolean uniqueF
 		return -1;
 	}
 
-	//
-	// search through the path, one element at a time
-	//
-
 	*file = FS_HandleForFile();
 	fsh[*file].handleFiles.unique = uniqueFILE;
 
-	for ( search = fs_searchpaths ; search ; search = search->next ) {
-		//
-		if ( search->pack ) {
-			hash = FS_HashFileName(filename, search->pack->hashSize);
+	if ( fs_indexTable && fs_index->integer ) {
+		search = FS_IndexSearch( filename, qtrue, &pakFile, &temp );
+		if ( search && search->pack ) {
+			return FS_OpenFileInPak( filename, search->pack, pakFile, *file, uniqueFILE );
 		}
-		// is the element a pak file?
-		if ( search->pack && search->pack->hashTable[hash] ) {
-			// disregard if it doesn't match one of the allowed pure pak files
-			if ( !FS_PakIsPure(search->pack) ) {
-				continue;
-			}
-
-			// look through all the pak file elements
-			pak = search->pack;
-			pakFile = pak->hashTable[hash];
-			do {
-				// case and separator insensitive comparisons
-				if ( !FS_FilenameCompare( pakFile->name, filename ) ) {
-					// found it!
-
-					// mark the pak as having been referenced and mark specifics on cgame and ui
-					// shaders, txt, arena files  by themselves do not count as a reference as 
-					// these are loaded from all pk3s 
-					// from every pk3 file.. 
-					l = strlen( filename );
-					if ( !(pak->referenced & FS_GENERAL_REF)) {
-						if ( Q_stricmp(filename + l - 7, ".shader") != 0 &&
-							Q_stricmp(filename + l - 4, ".txt") != 0 &&
-							Q_stricmp(filename + l - 4, ".cfg") != 0 &&
-							Q_stricmp(filename + l - 7, ".config") != 0 &&
-							strstr(filename, "levelshots") == NULL &&
-							Q_stricmp(filename + l - 4, ".bot") != 0 &&
-							Q_stricmp(filename + l - 6, ".arena") != 0 &&
-							Q_stricmp(filename + l - 5, ".menu") != 0) {
-							pak->referenced |= FS_GENERAL_REF;
-						}
-					}
-
-					if (!(pak->referenced & FS_QAGAME_REF) && strstr(filename, "qagame.qvm")) {
-						pak->referenced |= FS_QAGAME_REF;
-					}
-					if (!(pak->referenced & FS_CGAME_REF) && strstr(filename, "cgame.qvm")) {
-						pak->referenced |= FS_CGAME_REF;
-					}
-					if (!(pak->referenced & FS_UI_REF) && strstr(filename, "ui.qvm")) {
-						pak->referenced |= FS_UI_REF;
-					}
+		if ( search ) {
+			return FS_OpenFileInDir( filename, search->dir, temp, *file );
+		}
+	} else {
+		//
+		// search through the path, one element at a time
+		//
+		for ( search = fs_searchpaths ; search ; search = search->next ) {
+			//
+			if ( search->pack ) {
+				hash = FS_HashFileName(filename, search->pack->hashSize);
+			}
+			// is the element a pak file?
+			if ( search->pack && search->pack->hashTable[hash] ) {
+				// disregard if it doesn't match one of the allowed pure pak files
+				if ( !FS_PakIsPure(search->pack) ) {
+					continue;
+				}
 
-					if ( uniqueFILE ) {
-						// open a new file on the pakfile
-						fsh[*file].handleFiles.file.z = unzReOpen (pak->pakFilename, pak->handle);
-						if (fsh[*file].handleFiles.file.z == NULL) {
-							Com_Error (ERR_FATAL, "Couldn't reopen %s", pak->pakFilename);
-						}
-					} else {
-						fsh[*file].handleFiles.file.z = pak->handle;
-					}
-					Q_strncpyz( fsh[*file].name, filename, sizeof( fsh[*file].name ) );
-					fsh[*file].zipFile = qtrue;
-					zfi = (unz_s *)fsh[*file].handleFiles.file.z;
-					// in case the file was new
-					temp = zfi->file;
-					// set the file position in the zip file (also sets the current file info)
-					unzSetCurrentFileInfoPosition(pak->handle, pakFile->pos);
-                                        if ( zfi != pak->handle ) {
-						// copy the file info into the unzip structure
-						Com_Memcpy( zfi, pak->handle, sizeof(unz_s) );
-                                        }
-					// we copy this back into the structure
-					zfi->file = temp;
-					// open the file in the zip
-					unzOpenCurrentFile( fsh[*file].handleFiles.file.z );
-					fsh[*file].zipFilePos = pakFile->pos;
-
-					if ( fs_debug->integer ) {
-						Com_Printf( "FS_FOpenFileRead: %s (found in '%s')\n", 
-							filename, pak->pakFilename );
+				// look through all the pak file elements
+				pak = search->pack;
+				pakFile = pak->hashTable[hash];
+				do {
+					// case and separator insensitive comparisons
+					if ( !FS_FilenameCompare( pakFile->name, filename ) ) {
+						// found it!
+						return FS_OpenFileInPak( filename, pak, pakFile, *file, uniqueFILE );
 					}
-					return zfi->cur_file_info.uncompressed_size;
-				}
-				pakFile = pakFile->next;
-			} while(pakFile != NULL);
-		} else if ( search->dir ) {
-			// check a file in the directory tree
-
-			// if we are running restricted, the only files we
-			// will allow to come from the directory are .cfg files
-			l = strlen( filename );
-			// FIXME TTimo I'm not sure about the fs_numServerPaks test
-			// if you are using FS_ReadFile to find out if a file exists,
-			//   this test can make the search fail although the file is in the directory
-			// I had the problem on https://zerowing.idsoftware.com/bugzilla/show_bug.cgi?id=8
-			// turned out I used FS_FileExists instead
-			if ( fs_numServerPaks ) {
+					pakFile = pakFile->next;
+				} while(pakFile != NULL);
+			} else if ( search->dir ) {
+				// check a file in the directory tree
 
-				if ( Q_stricmp( filename + l - 4, ".cfg" )		// for config files
-					&& Q_stricmp( filename + l - 5, ".menu" )	// menu files
-					&& Q_stricmp( filename + l - 5, ".game" )	// menu files
-					&& Q_stricmp( filename + l - strlen(demoExt), demoExt )	// menu files
-					&& Q_stricmp( filename + l - 4, ".dat" ) ) {	// for journal files
+				// if we are running restricted, the only files we
+				// will allow to come from the directory are .cfg files
+				if ( !FS_AllowedFromDirectory( filename ) ) {
 					continue;
 				}
-			}
 
-			dir = search->dir;
+				dir = search->dir;
 			
-			netpath = FS_BuildOSPath( dir->path, dir->gamedir, filename );
-			fsh[*file].handleFiles.file.o = fopen (netpath, "rb");
-			if ( !fsh[*file].handleFiles.file.o ) {
-				continue;
-			}
-
-			if ( Q_stricmp( filename + l - 4, ".cfg" )		// for config files
-				&& Q_stricmp( filename + l - 5, ".menu" )	// menu files
-				&& Q_stricmp( filename + l - 5, ".game" )	// menu files
-				&& Q_stricmp( filename + l - strlen(demoExt), demoExt )	// menu files
-				&& Q_stricmp( filename + l - 4, ".dat" ) ) {	// for journal files
-				fs_fakeChkSum = random();
-			}
-
-			Q_strncpyz( fsh[*file].name, filename, sizeof( fsh[*file].name ) );
-			fsh[*file].zipFile = qfalse;
-			if ( fs_debug->integer ) {
-				Com_Printf( "FS_FOpenFileRead: %s (found in '%s/%s')\n", filename,
-					dir->path, dir->gamedir );
-			}
+				netpath = FS_BuildOSPath( dir->path, dir->gamedir, filename );
+				temp = fopen (netpath, "rb");
+				if ( !temp ) {
+					continue;
+				}
 
-			return FS_filelength (*file);
-		}		
+				return FS_OpenFileInDir( filename, dir, temp, *file );
+			}		
+		}
 	}
 	
 #ifdef FS_MISSING
@@ -1436,6 +1941,7 @@ int	FS_FileIsInPAK(const char *filename, int *pChecksum ) {
 	searchpath_t	*search;
 	pack_t			*pak;
 	fileInPack_t	*pakFile;
+	fsIndexEntry_t	*entry;
 	long			hash = 0;
 
 	if ( !fs_searchpaths ) {
@@ -1458,6 +1964,20 @@ int	FS_FileIsInPAK(const char *filename, int *pChecksum ) {
 		return -1;
 	}
 
+	if ( fs_indexTable && fs_index->integer ) {
+		fs_indexLookups++;
+		for ( entry = FS_IndexFind( filename, qfalse ) ; entry && entry->search ; entry = entry->alt ) {
+			if ( FS_PakIsPure( entry->search->pack ) ) {
+				if (pChecksum) {
+					*pChecksum = entry->search->pack->pure_checksum;
+				}
+				return 1;
+			}
+		}
+		fs_indexMisses++;
+		return -1;
+	}
+
 	//
 	// search through the path, one element at a time
 	//
@@ -1489,146 +2009,550 @@ int	FS_FileIsInPAK(const char *filename, int *pChecksum ) {
 			} while(pakFile != NULL);
 		}
 	}
-	return -1;
+	return -1;
+}
+
+/*
+============
+FS_ReadFile
+
+Filename are relative to the quake search path
+a null buffer will just return the file length without loading
+============
+*/
+int FS_ReadFile( const char *qpath, void **buffer ) {
+	fileHandle_t	h;
+	byte*			buf;
+	qboolean		isConfig;
+	int				len;
+
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization\n" );
+	}
+
+	if ( !qpath || !qpath[0] ) {
+		Com_Error( ERR_FATAL, "FS_ReadFile with empty name\n" );
+	}
+
+	buf = NULL;	// quiet compiler warning
+
+	// if this is a .cfg file and we are playing back a journal, read
+	// it from the journal file
+	if ( strstr( qpath, ".cfg" ) ) {
+		isConfig = qtrue;
+		if ( com_journal && com_journal->integer == 2 ) {
+			int		r;
+
+			Com_DPrintf( "Loading %s from journal file.\n", qpath );
+			r = FS_Read( &len, sizeof( len ), com_journalDataFile );
+			if ( r != sizeof( len ) ) {
+				if (buffer != NULL) *buffer = NULL;
+				return -1;
+			}
+			// if the file didn't exist when the journal was created
+			if (!len) {
+				if (buffer == NULL) {
+					return 1;			// hack for old journal files
+				}
+				*buffer = NULL;
+				return -1;
+			}
+			if (buffer == NULL) {
+				return len;
+			}
+
+			buf = Hunk_AllocateTempMemory(len+1);
+			*buffer = buf;
+
+			r = FS_Read( buf, len, com_journalDataFile );
+			if ( r != len ) {
+				Com_Error( ERR_FATAL, "Read from journalDataFile failed" );
+			}
+
+			fs_loadCount++;
+			fs_loadStack++;
+
+			// guarantee that it will have a trailing 0 for string operations
+			buf[len] = 0;
+
+			return len;
+		}
+	} else {
+		isConfig = qfalse;
+	}
+
+	// look for it in the filesystem or pack files
+	len = FS_FOpenFileRead( qpath, &h, qfalse );
+	if ( h == 0 ) {
+		if ( buffer ) {
+			*buffer = NULL;
+		}
+		// if we are journalling and it is a config file, write a zero to the journal file
+		if ( isConfig && com_journal && com_journal->integer == 1 ) {
+			Com_DPrintf( "Writing zero for %s to journal file.\n", qpath );
+			len = 0;
+			FS_Write( &len, sizeof( len ), com_journalDataFile );
+			FS_Flush( com_journalDataFile );
+		}
+		return -1;
+	}
+	
+	if ( !buffer ) {
+		if ( isConfig && com_journal && com_journal->integer == 1 ) {
+			Com_DPrintf( "Writing len for %s to journal file.\n", qpath );
+			FS_Write( &len, sizeof( len ), com_journalDataFile );
+			FS_Flush( com_journalDataFile );
+		}
+		FS_FCloseFile( h);
+		return len;
+	}
+
+	fs_loadCount++;
+	fs_loadStack++;
+
+	buf = Hunk_AllocateTempMemory(len+1);
+	*buffer = buf;
+
+	FS_Read (buf, len, h);
+
+	// guarantee that it will have a trailing 0 for string operations
+	buf[len] = 0;
+	FS_FCloseFile( h );
+
+	// if we are journalling and it is a config file, write it to the journal file
+	if ( isConfig && com_journal && com_journal->integer == 1 ) {
+		Com_DPrintf( "Writing %s to journal file.\n", qpath );
+		FS_Write( &len, sizeof( len ), com_journalDataFile );
+		FS_Write( buf, len, com_journalDataFile );
+		FS_Flush( com_journalDataFile );
+	}
+	return len;
+}
+
+/*
+=============
+FS_FreeFile
+=============
+*/
+void FS_FreeFile( void *buffer ) {
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization\n" );
+	}
+	if ( !buffer ) {
+		Com_Error( ERR_FATAL, "FS_FreeFile( NULL )" );
+	}
+	fs_loadStack--;
+
+	Hunk_FreeTempMemory( buffer );
+
+	// if all of our temp files are free, clear all of our space
+	if ( fs_loadStack == 0 ) {
+		Hunk_ClearTempMemory();
+	}
+}
+
+/*
+============
+FS_MapFile
+
+Like FS_ReadFile, but a file that is stored without compression in a
+mapped pk3 is returned in place. Compressed files are inflated straight
+from the mapping into temp memory.
+============
+*/
+int FS_MapFile( const char *qpath, const void **buffer ) {
+	fileHandle_t	h;
+	const void		*data;
+	byte			*buf;
+	int				len;
+
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization\n" );
+	}
+
+	if ( !qpath || !qpath[0] ) {
+		Com_Error( ERR_FATAL, "FS_MapFile with empty name\n" );
+	}
+
+	// config files may have to go through the journal
+	if ( strstr( qpath, ".cfg" ) ) {
+		return FS_ReadFile( qpath, (void **)buffer );
+	}
+
+	len = FS_FOpenFileRead( qpath, &h, qfalse );
+	if ( h == 0 ) {
+		*buffer = NULL;
+		return -1;
+	}
+
+	fs_loadCount++;
+	fs_loadStack++;
+
+	if ( fsh[h].zipFile ) {
+		data = unzGetCurrentFileMapping( fsh[h].handleFiles.file.z );
+		if ( data ) {
+			FS_FCloseFile( h );
+			fs_mappedCount++;
+			*buffer = data;
+			return len;
+		}
+	}
+
+	buf = Hunk_AllocateTempMemory(len+1);
+	*buffer = buf;
+
+	FS_Read (buf, len, h);
+
+	// guarantee that it will have a trailing 0 for string operations
+	buf[len] = 0;
+	FS_FCloseFile( h );
+
+	return len;
+}
+
+/*
+============
+FS_FreeMappedFile
+============
+*/
+void FS_FreeMappedFile( const void *buffer ) {
+	searchpath_t	*search;
+	const byte		*base;
+
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization\n" );
+	}
+	if ( !buffer ) {
+		Com_Error( ERR_FATAL, "FS_FreeMappedFile( NULL )" );
+	}
+
+	for ( search = fs_searchpaths ; search ; search = search->next ) {
+		if ( !search->pack || !search->pack->mapped ) {
+			continue;
+		}
+		base = search->pack->mapped;
+		if ( (const byte *)buffer >= base && (const byte *)buffer < base + search->pack->mappedSize ) {
+			// nothing to free, the mapping stays until FS_Shutdown
+			fs_loadStack--;
+			if ( fs_loadStack == 0 ) {
+				Hunk_ClearTempMemory();
+			}
+			return;
+		}
+	}
+
+	FS_FreeFile( (void *)buffer );
+}
+
+/*
+============
+FS_OpenBackgroundRead
+
+Files in a pk3 can only be read in the background when the pk3 is mapped,
+the shared unzip handles must not be used from another thread.
+============
+*/
+int FS_OpenBackgroundRead( const char *qpath, backgroundRead_t *read ) {
+	fileHandle_t	h;
+	const void		*data;
+	int				len;
+	int				deflated;
+	unsigned long	compressedSize;
+
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization\n" );
+	}
+
+	Com_Memset( read, 0, sizeof( *read ) );
+
+	if ( !qpath || !qpath[0] || strstr( qpath, ".cfg" ) ) {
+		return -1;
+	}
+
+	len = FS_FOpenFileRead( qpath, &h, qfalse );
+	if ( h == 0 ) {
+		return -1;
+	}
+
+	if ( fsh[h].zipFile ) {
+		data = unzGetCurrentFileRawMapping( fsh[h].handleFiles.file.z, &deflated, &compressedSize );
+		FS_FCloseFile( h );
+		if ( !data ) {
+			return -1;
+		}
+		read->data = data;
+		read->compressedSize = compressedSize;
+		read->deflated = deflated;
+	} else {
+		// the FILE moves over to the background read
+		read->fp = fsh[h].handleFiles.file.o;
+		read->compressedSize = len;
+		Com_Memset( &fsh[h], 0, sizeof( fsh[h] ) );
+	}
+
+	read->length = len;
+	return len;
+}
+
+/*
+============
+FS_BackgroundRead
+============
+*/
+qboolean FS_BackgroundRead( backgroundRead_t *read, void *buffer ) {
+	const volatile byte	*p;
+	byte			scratch[4096];
+	int				i, r;
+	qboolean		ok;
+
+	ok = qtrue;
+
+	if ( read->fp ) {
+		for ( i = 0 ; i < read->length ; i += r ) {
+			r = read->length - i;
+			if ( buffer ) {
+				r = fread( (byte *)buffer + i, 1, r, read->fp );
+			} else {
+				if ( r > sizeof( scratch ) ) {
+					r = sizeof( scratch );
+				}
+				r = fread( scratch, 1, r, read->fp );
+			}
+			if ( r <= 0 ) {
+				ok = qfalse;
+				break;
+			}
+		}
+	} else if ( read->data ) {
+		if ( !buffer ) {
+			// fault the pages in
+			p = read->data;
+			for ( i = 0 ; i < read->compressedSize ; i += sizeof( scratch ) ) {
+				scratch[0] = p[i];
+			}
+		} else if ( read->deflated ) {
+			ok = ( unzInflateBuffer( read->data, read->compressedSize, buffer, read->length ) == UNZ_OK );
+		} else {
+			Com_Memcpy( buffer, read->data, read->length );
+		}
+	} else {
+		ok = qfalse;
+	}
+
+	FS_CloseBackgroundRead( read );
+	return ok;
+}
+
+/*
+============
+FS_CloseBackgroundRead
+============
+*/
+void FS_CloseBackgroundRead( backgroundRead_t *read ) {
+	if ( read->fp ) {
+		fclose( read->fp );
+	}
+	Com_Memset( read, 0, sizeof( *read ) );
 }
 
 /*
 ============
-FS_ReadFile
+FS_ManifestReadahead
 
-Filename are relative to the quake search path
-a null buffer will just return the file length without loading
+Asks the OS to read the files listed in a manifest ahead, in the order
+they will be opened. Neighbouring files in a pk3 are merged into one
+range so the whole load becomes a few long sequential reads. Files in
+pk3s that could not be mapped get no readahead.
+
+Opening the files marks their paks referenced, and the manifest may list
+files only the client loads, so the referenced flags are put back
 ============
 */
-int FS_ReadFile( const char *qpath, void **buffer ) {
+static int FS_ManifestReadahead( const char *text ) {
+	static int		referenced[MAX_SEARCH_PATHS];
+	searchpath_t	*search;
+	char			name[MAX_QPATH];
 	fileHandle_t	h;
-	byte*			buf;
-	qboolean		isConfig;
-	int				len;
-
-	if ( !fs_searchpaths ) {
-		Com_Error( ERR_FATAL, "Filesystem call made without initialization\n" );
-	}
+	unzFile			span;
+	const byte		*start, *end, *data;
+	unsigned long	compressedSize;
+	int				deflated, len, total, numPaks, fakeChkSum;
 
-	if ( !qpath || !qpath[0] ) {
-		Com_Error( ERR_FATAL, "FS_ReadFile with empty name\n" );
+	numPaks = 0;
+	for ( search = fs_searchpaths ; search && numPaks < MAX_SEARCH_PATHS ; search = search->next ) {
+		if ( search->pack ) {
+			referenced[numPaks++] = search->pack->referenced;
+		}
 	}
+	fakeChkSum = fs_fakeChkSum;
 
-	buf = NULL;	// quiet compiler warning
-
-	// if this is a .cfg file and we are playing back a journal, read
-	// it from the journal file
-	if ( strstr( qpath, ".cfg" ) ) {
-		isConfig = qtrue;
-		if ( com_journal && com_journal->integer == 2 ) {
-			int		r;
+	span = NULL;
+	start = end = NULL;
+	total = 0;
 
-			Com_DPrintf( "Loading %s from journal file.\n", qpath );
-			r = FS_Read( &len, sizeof( len ), com_journalDataFile );
-			if ( r != sizeof( len ) ) {
-				if (buffer != NULL) *buffer = NULL;
-				return -1;
-			}
-			// if the file didn't exist when the journal was created
-			if (!len) {
-				if (buffer == NULL) {
-					return 1;			// hack for old journal files
-				}
-				*buffer = NULL;
-				return -1;
-			}
-			if (buffer == NULL) {
-				return len;
+	while ( *text ) {
+		for ( len = 0 ; text[len] && text[len] != '\n' ; len++ ) {
+		}
+		name[0] = 0;
+		if ( len < sizeof( name ) ) {
+			Com_Memcpy( name, text, len );
+			name[len] = 0;
+			if ( len && name[len - 1] == '\r' ) {
+				name[len - 1] = 0;
 			}
+		}
+		text += len;
+		if ( *text ) {
+			text++;
+		}
 
-			buf = Hunk_AllocateTempMemory(len+1);
-			*buffer = buf;
+		if ( !name[0] ) {
+			continue;
+		}
+		len = FS_FOpenFileRead( name, &h, qfalse );
+		if ( !h ) {
+			continue;
+		}
 
-			r = FS_Read( buf, len, com_journalDataFile );
-			if ( r != len ) {
-				Com_Error( ERR_FATAL, "Read from journalDataFile failed" );
+		if ( fsh[h].zipFile ) {
+			data = unzGetCurrentFileRawMapping( fsh[h].handleFiles.file.z, &deflated, &compressedSize );
+			if ( data && span == fsh[h].handleFiles.file.z && data >= start && data <= end + MANIFEST_MERGE_GAP ) {
+				if ( data + compressedSize > end ) {
+					end = data + compressedSize;
+				}
+			} else if ( data ) {
+				if ( start ) {
+					Sys_Readahead( start, end - start );
+					total += end - start;
+				}
+				span = fsh[h].handleFiles.file.z;
+				start = data;
+				end = data + compressedSize;
 			}
-
-			fs_loadCount++;
-			fs_loadStack++;
-
-			// guarantee that it will have a trailing 0 for string operations
-			buf[len] = 0;
-
-			return len;
+		} else {
+			Sys_ReadaheadFile( fsh[h].handleFiles.file.o );
+			total += len;
 		}
-	} else {
-		isConfig = qfalse;
+		FS_FCloseFile( h );
 	}
 
-	// look for it in the filesystem or pack files
-	len = FS_FOpenFileRead( qpath, &h, qfalse );
-	if ( h == 0 ) {
-		if ( buffer ) {
-			*buffer = NULL;
-		}
-		// if we are journalling and it is a config file, write a zero to the journal file
-		if ( isConfig && com_journal && com_journal->integer == 1 ) {
-			Com_DPrintf( "Writing zero for %s to journal file.\n", qpath );
-			len = 0;
-			FS_Write( &len, sizeof( len ), com_journalDataFile );
-			FS_Flush( com_journalDataFile );
-		}
-		return -1;
+	if ( start ) {
+		Sys_Readahead( start, end - start );
+		total += end - start;
 	}
-	
-	if ( !buffer ) {
-		if ( isConfig && com_journal && com_journal->integer == 1 ) {
-			Com_DPrintf( "Writing len for %s to journal file.\n", qpath );
-			FS_Write( &len, sizeof( len ), com_journalDataFile );
-			FS_Flush( com_journalDataFile );
+
+	numPaks = 0;
+	for ( search = fs_searchpaths ; search && numPaks < MAX_SEARCH_PATHS ; search = search->next ) {
+		if ( search->pack ) {
+			search->pack->referenced = referenced[numPaks++];
 		}
-		FS_FCloseFile( h);
-		return len;
 	}
+	fs_fakeChkSum = fakeChkSum;
 
-	fs_loadCount++;
-	fs_loadStack++;
+	return total;
+}
 
-	buf = Hunk_AllocateTempMemory(len+1);
-	*buffer = buf;
+/*
+============
+FS_BeginMapLoad
 
-	FS_Read (buf, len, h);
+Manifests are kept per map and per set of pure paks, so a manifest
+never describes files from paks other than the ones it was made with
+============
+*/
+void FS_BeginMapLoad( const char *mapname ) {
+	static int		checksums[MAX_SEARCH_PATHS];
+	searchpath_t	*search;
+	fileHandle_t	f;
+	char			*text;
+	int				numPaks, len;
 
-	// guarantee that it will have a trailing 0 for string operations
-	buf[len] = 0;
-	FS_FCloseFile( h );
+	if ( !fs_searchpaths ) {
+		Com_Error( ERR_FATAL, "Filesystem call made without initialization\n" );
+	}
 
-	// if we are journalling and it is a config file, write it to the journal file
-	if ( isConfig && com_journal && com_journal->integer == 1 ) {
-		Com_DPrintf( "Writing %s to journal file.\n", qpath );
-		FS_Write( &len, sizeof( len ), com_journalDataFile );
-		FS_Write( buf, len, com_journalDataFile );
-		FS_Flush( com_journalDataFile );
+	// a load that never finished is thrown away
+	fs_manifestRecording = qfalse;
+	fs_manifestTextLen = 0;
+	fs_manifestFiles = 0;
+	Com_Memset( fs_manifestHash, 0, sizeof( fs_manifestHash ) );
+	fs_manifestChecksum = 0;
+	fs_manifestReadaheadKB = -1;
+	fs_manifestPath[0] = 0;
+	Q_strncpyz( fs_manifestMap, mapname, sizeof( fs_manifestMap ) );
+
+	fs_manifestStartTime = Sys_Milliseconds();
+
+	// the map name may come from a server, it must not leave the manifest directory
+	if ( fs_manifest->integer && mapname[0] && !strstr( mapname, ".." ) && !strstr( mapname, "::" ) ) {
+		numPaks = 0;
+		for ( search = fs_searchpaths ; search ; search = search->next ) {
+			if ( search->pack && FS_PakIsPure( search->pack ) && numPaks < MAX_SEARCH_PATHS ) {
+				checksums[numPaks++] = search->pack->checksum;
+			}
+		}
+		Com_sprintf( fs_manifestPath, sizeof( fs_manifestPath ), "%s/manifests/%s-%08x.txt",
+			fs_gamedir, mapname, numPaks ? Com_BlockChecksum( checksums, numPaks * sizeof( int ) ) : 0 );
+
+		len = FS_SV_FOpenFileRead( fs_manifestPath, &f );
+		if ( f ) {
+			if ( len > 0 && len <= MAX_MANIFEST_TEXT ) {
+				text = Z_Malloc( len + 1 );
+				FS_Read( text, len, f );
+				text[len] = 0;
+				FS_FCloseFile( f );
+
+				fs_manifestChecksum = Com_BlockChecksum( text, len );
+				fs_manifestReadaheadKB = FS_ManifestReadahead( text ) >> 10;
+				Z_Free( text );
+			} else {
+				FS_FCloseFile( f );
+			}
+		}
 	}
-	return len;
+
+	fs_manifestRecording = qtrue;
 }
 
 /*
-=============
-FS_FreeFile
-=============
+============
+FS_EndMapLoad
+
+The manifest is only written when the files opened changed
+============
 */
-void FS_FreeFile( void *buffer ) {
-	if ( !fs_searchpaths ) {
-		Com_Error( ERR_FATAL, "Filesystem call made without initialization\n" );
+void FS_EndMapLoad( void ) {
+	fileHandle_t	f;
+	int				msec;
+
+	if ( !fs_manifestRecording ) {
+		return;
 	}
-	if ( !buffer ) {
-		Com_Error( ERR_FATAL, "FS_FreeFile( NULL )" );
+	fs_manifestRecording = qfalse;
+
+	msec = Sys_Milliseconds() - fs_manifestStartTime;
+	if ( fs_manifestReadaheadKB >= 0 ) {
+		Com_Printf( "%s loaded in %i msec, %i files, %i KB read ahead from the manifest\n",
+			fs_manifestMap, msec, fs_manifestFiles, fs_manifestReadaheadKB );
+	} else {
+		Com_Printf( "%s loaded in %i msec, %i files, no manifest\n",
+			fs_manifestMap, msec, fs_manifestFiles );
 	}
-	fs_loadStack--;
 
-	Hunk_FreeTempMemory( buffer );
+	if ( !fs_manifestPath[0] || !fs_manifestFiles ) {
+		return;
+	}
+	if ( fs_manifestReadaheadKB >= 0 && Com_BlockChecksum( fs_manifestText, fs_manifestTextLen ) == fs_manifestChecksum ) {
+		return;
+	}
 
-	// if all of our temp files are free, clear all of our space
-	if ( fs_loadStack == 0 ) {
-		Hunk_ClearTempMemory();
+	f = FS_SV_FOpenFileWrite( fs_manifestPath );
+	if ( !f ) {
+		Com_Printf( "WARNING: couldn't write %s\n", fs_manifestPath );
+		return;
 	}
+	FS_Write( fs_manifestText, fs_manifestTextLen, f );
+	FS_FCloseFile( f );
 }
 
 /*
@@ -1672,40 +2596,44 @@ ZIP FILE LOADING
 
 /*
 =================
-FS_LoadZipFile
+FS_ScanZipFile
 
-Creates a new pak_t in the search chain for the contents
-of a zip file.
+Reads the central directory of a zip file and computes the checksums.
+Runs on a job thread, so everything is allocated with malloc and the
+results are only turned into a pack_t by FS_LoadZipFile.
 =================
 */
-static pack_t *FS_LoadZipFile( char *zipfile, const char *basename )
+static void FS_ScanZipFile( void *data )
 {
-	fileInPack_t	*buildBuffer;
-	pack_t			*pack;
+	zipScan_t		*scan;
 	unzFile			uf;
-	int				err;
-	unz_global_info gi;
 	char			filename_inzip[MAX_ZPATH];
 	unz_file_info	file_info;
-	int				i, len;
-	long			hash;
-	int				fs_numHeaderLongs;
-	int				*fs_headerLongs;
+	int				i, len, err;
+	int				numHeaderLongs;
+	int				*headerLongs;
 	char			*namePtr;
 
-	fs_numHeaderLongs = 0;
-
-	uf = unzOpen(zipfile);
-	err = unzGetGlobalInfo (uf,&gi);
+	scan = data;
+	scan->msec = Sys_Milliseconds();
 
-	if (err != UNZ_OK)
-		return NULL;
+	if ( unzOpenNoAlloc( scan->pakFilename, &scan->zip ) != UNZ_OK ) {
+		scan->msec = Sys_Milliseconds() - scan->msec;
+		return;
+	}
+	uf = (unzFile)&scan->zip;
 
-	fs_packFiles += gi.number_entry;
+	// 32 bit builds map on the main thread to keep to the address space budget
+	if ( sizeof( void * ) >= 8 ) {
+		scan->mapped = Sys_MapFile( scan->pakFilename, &scan->mappedSize );
+		if ( scan->mapped ) {
+			unzSetMapping( uf, scan->mapped, scan->mappedSize );
+		}
+	}
 
 	len = 0;
 	unzGoToFirstFile(uf);
-	for (i = 0; i < gi.number_entry; i++)
+	for (i = 0; i < scan->zip.gi.number_entry; i++)
 	{
 		err = unzGetCurrentFileInfo(uf, &file_info, filename_inzip, sizeof(filename_inzip), NULL, 0, NULL, 0);
 		if (err != UNZ_OK) {
@@ -1715,15 +2643,108 @@ static pack_t *FS_LoadZipFile( char *zipfile, const char *basename )
 		unzGoToNextFile(uf);
 	}
 
-	buildBuffer = Z_Malloc( (gi.number_entry * sizeof( fileInPack_t )) + len );
-	namePtr = ((char *) buildBuffer) + gi.number_entry * sizeof( fileInPack_t );
-	fs_headerLongs = Z_Malloc( ( gi.number_entry + 1 ) * sizeof(int) );
-	fs_headerLongs[ fs_numHeaderLongs++ ] = LittleLong( fs_checksumFeed );
+	scan->names = malloc( len ? len : 1 );
+	scan->positions = malloc( ( scan->zip.gi.number_entry + 1 ) * sizeof( *scan->positions ) );
+	headerLongs = malloc( ( scan->zip.gi.number_entry + 1 ) * sizeof( int ) );
+	if ( !scan->names || !scan->positions || !headerLongs ) {
+		free( headerLongs );
+		scan->msec = Sys_Milliseconds() - scan->msec;
+		return;
+	}
+
+	numHeaderLongs = 0;
+	headerLongs[ numHeaderLongs++ ] = LittleLong( fs_checksumFeed );
+
+	namePtr = scan->names;
+	unzGoToFirstFile(uf);
+	for (i = 0; i < scan->zip.gi.number_entry; i++)
+	{
+		err = unzGetCurrentFileInfo(uf, &file_info, filename_inzip, sizeof(filename_inzip), NULL, 0, NULL, 0);
+		if (err != UNZ_OK) {
+			break;
+		}
+		if (file_info.uncompressed_size > 0) {
+			headerLongs[numHeaderLongs++] = LittleLong(file_info.crc);
+		}
+		Q_strlwr( filename_inzip );
+		strcpy( namePtr, filename_inzip );
+		namePtr += strlen(filename_inzip) + 1;
+		// store the file position in the zip
+		unzGetCurrentFileInfoPosition(uf, &scan->positions[i]);
+		unzGoToNextFile(uf);
+	}
+	scan->numNames = i;
+
+	scan->checksum = Com_BlockChecksum( &headerLongs[ 1 ], 4 * ( numHeaderLongs - 1 ) );
+	scan->pure_checksum = Com_BlockChecksum( headerLongs, 4 * numHeaderLongs );
+	scan->checksum = LittleLong( scan->checksum );
+	scan->pure_checksum = LittleLong( scan->pure_checksum );
+
+	free( headerLongs );
+
+	scan->ok = qtrue;
+	scan->msec = Sys_Milliseconds() - scan->msec;
+}
+
+/*
+=================
+FS_FreeZipScan
+=================
+*/
+static void FS_FreeZipScan( zipScan_t *scan )
+{
+	free( scan->names );
+	free( scan->positions );
+	scan->names = NULL;
+	scan->positions = NULL;
+}
+
+/*
+=================
+FS_LoadZipFile
+
+Creates a new pak_t in the search chain for the contents
+of a zip file scanned by FS_ScanZipFile.
+=================
+*/
+static pack_t *FS_LoadZipFile( zipScan_t *scan, const char *basename )
+{
+	fileInPack_t	*buildBuffer;
+	pack_t			*pack;
+	unzFile			uf;
+	int				i, len;
+	long			hash;
+	char			*namePtr;
+
+	if ( !scan->ok ) {
+		if ( scan->zip.file ) {
+			fclose( scan->zip.file );
+		}
+		if ( scan->mapped ) {
+			Sys_UnmapFile( scan->mapped, scan->mappedSize );
+		}
+		FS_FreeZipScan( scan );
+		return NULL;
+	}
+
+	uf = unzAllocHandle( &scan->zip );
+
+	fs_packFiles += scan->zip.gi.number_entry;
+
+	len = 0;
+	namePtr = scan->names;
+	for (i = 0; i < scan->numNames; i++) {
+		len += strlen( namePtr + len ) + 1;
+	}
+
+	buildBuffer = Z_Malloc( (scan->zip.gi.number_entry * sizeof( fileInPack_t )) + len );
+	namePtr = ((char *) buildBuffer) + scan->zip.gi.number_entry * sizeof( fileInPack_t );
+	Com_Memcpy( namePtr, scan->names, len );
 
 	// get the hash table size from the number of files in the zip
 	// because lots of custom pk3 files have less than 32 or 64 files
 	for (i = 1; i <= MAX_FILEHASH_SIZE; i <<= 1) {
-		if (i > gi.number_entry) {
+		if (i > scan->zip.gi.number_entry) {
 			break;
 		}
 	}
@@ -1735,7 +2756,7 @@ static pack_t *FS_LoadZipFile( char *zipfile, const char *basename )
 		pack->hashTable[i] = NULL;
 	}
 
-	Q_strncpyz( pack->pakFilename, zipfile, sizeof( pack->pakFilename ) );
+	Q_strncpyz( pack->pakFilename, scan->pakFilename, sizeof( pack->pakFilename ) );
 	Q_strncpyz( pack->pakBasename, basename, sizeof( pack->pakBasename ) );
 
 	// strip .pk3 if needed
@@ -1744,37 +2765,41 @@ static pack_t *FS_LoadZipFile( char *zipfile, const char *basename )
 	}
 
 	pack->handle = uf;
-	pack->numfiles = gi.number_entry;
-	unzGoToFirstFile(uf);
-
-	for (i = 0; i < gi.number_entry; i++)
-	{
-		err = unzGetCurrentFileInfo(uf, &file_info, filename_inzip, sizeof(filename_inzip), NULL, 0, NULL, 0);
-		if (err != UNZ_OK) {
-			break;
+	pack->numfiles = scan->zip.gi.number_entry;
+
+	// reads from the pak go through the mapping where the OS allows it,
+	// 32 bit builds keep most of the address space for the hunk
+	pack->mapped = scan->mapped;
+	pack->mappedSize = scan->mappedSize;
+	if ( !pack->mapped && sizeof( void * ) < 8 ) {
+		pack->mapped = Sys_MapFile( scan->pakFilename, &pack->mappedSize );
+		if ( pack->mapped && fs_mappedKB + ( pack->mappedSize >> 10 ) > MAX_MAPPED_32_KB ) {
+			Sys_UnmapFile( pack->mapped, pack->mappedSize );
+			pack->mapped = NULL;
 		}
-		if (file_info.uncompressed_size > 0) {
-			fs_headerLongs[fs_numHeaderLongs++] = LittleLong(file_info.crc);
+		if ( pack->mapped ) {
+			unzSetMapping( uf, pack->mapped, pack->mappedSize );
 		}
-		Q_strlwr( filename_inzip );
-		hash = FS_HashFileName(filename_inzip, pack->hashSize);
+	}
+	if ( pack->mapped ) {
+		fs_mappedKB += pack->mappedSize >> 10;
+	}
+
+	for (i = 0; i < scan->numNames; i++)
+	{
+		hash = FS_HashFileName(namePtr, pack->hashSize);
 		buildBuffer[i].name = namePtr;
-		strcpy( buildBuffer[i].name, filename_inzip );
-		namePtr += strlen(filename_inzip) + 1;
-		// store the file position in the zip
-		unzGetCurrentFileInfoPosition(uf, &buildBuffer[i].pos);
+		namePtr += strlen(namePtr) + 1;
+		buildBuffer[i].pos = scan->positions[i];
 		//
 		buildBuffer[i].next = pack->hashTable[hash];
 		pack->hashTable[hash] = &buildBuffer[i];
-		unzGoToNextFile(uf);
 	}
 
-	pack->checksum = Com_BlockChecksum( &fs_headerLongs[ 1 ], 4 * ( fs_numHeaderLongs - 1 ) );
-	pack->pure_checksum = Com_BlockChecksum( fs_headerLongs, 4 * fs_numHeaderLongs );
-	pack->checksum = LittleLong( pack->checksum );
-	pack->pure_checksum = LittleLong( pack->pure_checksum );
+	pack->checksum = scan->checksum;
+	pack->pure_checksum = scan->pure_checksum;
 
-	Z_Free(fs_headerLongs);
+	FS_FreeZipScan( scan );
 
 	pack->buildBuffer = buildBuffer;
 	return pack;
@@ -2394,6 +3419,13 @@ void FS_Path_f( void ) {
 	}
 
 
+	Com_Printf( "\n%i MB of pk3 files mapped, %i files returned in place\n", fs_mappedKB >> 10, fs_mappedCount );
+
+	if ( fs_indexTable ) {
+		Com_Printf( "file index: %i lookups, %i directory probes, %i not found, %i names added\n",
+			fs_indexLookups, fs_indexProbes, fs_indexMisses, fs_indexNames );
+	}
+
 	Com_Printf( "\n" );
 	for ( i = 1 ; i < MAX_FILE_HANDLES ; i++ ) {
 		if ( fsh[i].handleFiles.file.o ) {
@@ -2449,6 +3481,8 @@ void FS_AddGameDirectory( const char *path, const char *dir ) {
 	char			*pakfile;
 	int				numfiles;
 	char			**pakfiles;
+	zipScan_t		*scans;
+	int				begin, start, listed, queued, waited, scanned;
 
 	// Unique
 	for ( sp = fs_searchpaths ; sp ; sp = sp->next ) {
@@ -2471,16 +3505,47 @@ void FS_AddGameDirectory( const char *path, const char *dir ) {
 	fs_searchpaths = search;
 
 	// find all pak files in this directory
+	begin = Sys_Milliseconds();
 	pakfile = FS_BuildOSPath( path, dir, "" );
 	pakfile[ strlen(pakfile) - 1 ] = 0;	// strip the trailing slash
 
 	pakfiles = Sys_ListFiles( pakfile, ".pk3", NULL, &numfiles, qfalse );
 
 	qsort( pakfiles, numfiles, sizeof(char*), paksort );
+	listed = Sys_Milliseconds();
+
+	if ( !numfiles ) {
+		Sys_FreeFileList( pakfiles );
+		return;
+	}
 
+	// the zip directories are read and checksummed in parallel,
+	// the paks are still added to the search path in sorted order
+	scans = Z_Malloc( numfiles * sizeof( *scans ) );
 	for ( i = 0 ; i < numfiles ; i++ ) {
 		pakfile = FS_BuildOSPath( path, dir, pakfiles[i] );
-		if ( ( pak = FS_LoadZipFile( pakfile, pakfiles[i] ) ) == 0 )
+		Q_strncpyz( scans[i].pakFilename, pakfile, sizeof( scans[i].pakFilename ) );
+		scans[i].job.function = FS_ScanZipFile;
+		scans[i].job.data = &scans[i];
+		if ( !Sys_AddJob( &scans[i].job ) ) {
+			FS_ScanZipFile( &scans[i] );
+		}
+	}
+	queued = Sys_Milliseconds();
+
+	waited = 0;
+	scanned = 0;
+	for ( i = 0 ; i < numfiles ; i++ ) {
+		start = Sys_Milliseconds();
+		Sys_FinishJob( &scans[i].job );
+		waited += Sys_Milliseconds() - start;
+		scanned += scans[i].msec;
+
+		if ( fs_debug->integer ) {
+			Com_Printf( "%s: %lu files, %i msec\n", scans[i].pakFilename, scans[i].zip.gi.number_entry, scans[i].msec );
+		}
+
+		if ( ( pak = FS_LoadZipFile( &scans[i], pakfiles[i] ) ) == 0 )
 			continue;
 		// store the game name for downloading
 		strcpy(pak->pakGamename, dir);
@@ -2491,7 +3556,15 @@ void FS_AddGameDirectory( const char *path, const char *dir ) {
 		fs_searchpaths = search;
 	}
 
+	if ( fs_debug->integer ) {
+		start = Sys_Milliseconds();
+		Com_Printf( "%s/%s: %i paks in %i msec, %i listing, %i waiting for scans, %i building, "
+			"%i scanning on %i job threads\n", path, dir, numfiles, start - begin, listed - begin,
+			waited, start - queued - waited, scanned, Sys_NumJobThreads() );
+	}
+
 	// done
+	Z_Free( scans );
 	Sys_FreeFileList( pakfiles );
 }
 
@@ -2666,18 +3739,27 @@ void FS_Shutdown( qboolean closemfp ) {
 	searchpath_t	*p, *next;
 	int	i;
 
+	// background reads may still be using the mapped pk3 files
+	Sys_WaitForJobs();
+
 	for(i = 0; i < MAX_FILE_HANDLES; i++) {
 		if (fsh[i].fileSize) {
 			FS_FCloseFile(i);
 		}
 	}
 
+	FS_FreeIndex();
+
 	// free everything
 	for ( p = fs_searchpaths ; p ; p = next ) {
 		next = p->next;
 
 		if ( p->pack ) {
 			unzClose(p->pack->handle);
+			if ( p->pack->mapped ) {
+				Sys_UnmapFile( p->pack->mapped, p->pack->mappedSize );
+				fs_mappedKB -= p->pack->mappedSize >> 10;
+			}
 			Z_Free( p->pack->buildBuffer );
 			Z_Free( p->pack );
 		}
@@ -2759,6 +3841,8 @@ static void FS_Startup( const char *gameName )
 	Com_Printf( "----- FS_Startup -----\n" );
 
 	fs_debug = Cvar_Get( "fs_debug", "0", 0 );
+	fs_index = Cvar_Get( "fs_index", "1", 0 );
+	fs_manifest = Cvar_Get( "fs_manifest", "1", CVAR_ARCHIVE );
 	fs_basepath = Cvar_Get ("fs_basepath", Sys_DefaultInstallPath(), CVAR_INIT );
 	fs_basegame = Cvar_Get ("fs_basegame", "", CVAR_INIT );
 	homePath = Sys_DefaultHomePath();
@@ -2829,6 +3913,8 @@ static void FS_Startup( const char *gameName )
 	// reorder the pure pk3 files according to server order
 	FS_ReorderPurePaks();
 
+	FS_BuildIndex();
+
 	// print the current search paths
 	FS_Path_f();
 
@@ -601,6 +601,9 @@ void NET_SendPacket( netsrc_t sock, int length, const void *data, netadr_t to )
 	if ( to.type == NA_BAD ) {
 		return;
 	}
+	if ( com_journal->integer == 2 ) {
+		return;		// a replay already has the answers in the journal
+	}
 
 	if ( sock == NS_CLIENT && cl_packetdelay->integer > 0 ) {
 		NET_QueuePacket( length, data, to, cl_packetdelay->integer );
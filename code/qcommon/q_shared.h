@@ -275,12 +275,9 @@ typedef enum {
 	h_dontcare
 } ha_pref;
 
-#ifdef HUNK_DEBUG
-#define Hunk_Alloc( size, preference )				Hunk_AllocDebug(size, preference, #size, __FILE__, __LINE__)
-void *Hunk_AllocDebug( int size, ha_pref preference, char *label, char *file, int line );
-#else
-void *Hunk_Alloc( int size, ha_pref preference );
-#endif
+// every allocation is accounted to its call site, see the hunkusage command
+#define Hunk_Alloc( size, preference )				Hunk_AllocLabel(size, preference, #size, __FILE__, __LINE__)
+void *Hunk_AllocLabel( int size, ha_pref preference, const char *label, const char *file, int line );
 
 #define Com_Memset memset
 #define Com_Memcpy memcpy
@@ -817,7 +814,7 @@ typedef struct cvar_s {
 	float			min;
 	float			max;
 	struct cvar_s *next;
-	struct cvar_s *hashNext;
+	unsigned		hashValue;
 } cvar_t;
 
 #define	MAX_CVAR_VALUE_STRING	256
@@ -336,11 +336,34 @@ typedef enum {
 	TRAP_TESTPRINTFLOAT
 } sharedTraps_t;
 
+// system calls that compiled code may handle without going through
+// the systemCalls dispatcher, the list ends with VMSC_NONE
+typedef enum {
+	VMSC_NONE,
+	VMSC_MEMSET,		// Com_Memset( VMA(1), args[2], args[3] ), returns 0
+	VMSC_MEMCPY,		// Com_Memcpy( VMA(1), VMA(2), args[3] ), returns 0
+	VMSC_SQRT,			// FloatAsInt( sqrt( VMF(1) ) )
+	VMSC_FLOOR,			// FloatAsInt( VM_Floor( VMF(1) ) )
+	VMSC_SIN,			// FloatAsInt( sin( VMF(1) ) )
+	VMSC_COS,			// FloatAsInt( cos( VMF(1) ) )
+	VMSC_ATAN2,			// FloatAsInt( atan2( VMF(1), VMF(2) ) )
+	VMSC_DIRECT			// func( args ), args[1] is the first argument
+} vmSyscallType_t;
+
+typedef struct {
+	int					num;		// as seen by systemCalls
+	vmSyscallType_t		type;
+	intptr_t			(*func)( int *args );
+} vmFastSyscall_t;
+
 void	VM_Init( void );
-vm_t	*VM_Create( const char *module, intptr_t (*systemCalls)(intptr_t *), 
-				   vmInterpret_t interpret );
+vm_t	*VM_Create( const char *module, intptr_t (*systemCalls)(intptr_t *),
+				   const vmFastSyscall_t *fastSyscalls, vmInterpret_t interpret );
 // module should be bare: "cgame", not "cgame.dll" or "vm/cgame.qvm"
 
+// extension of the native code cache, the file system won't write these
+#define	VM_CACHE_EXT	"vmc"
+
 void	VM_Free( vm_t *vm );
 void	VM_Clear(void);
 void	VM_Forced_Unload_Start(void);
@@ -363,6 +386,9 @@ static ID_INLINE float _vmf(intptr_t x)
 }
 #define	VMF(x)	_vmf(args[x])
 
+// floor with the sign of zero kept, which -ffast-math throws away
+float	VM_Floor( float x );
+
 
 /*
 ==============================================================
@@ -506,6 +532,18 @@ char	*Cvar_VariableString( const char *var_name );
 void	Cvar_VariableStringBuffer( const char *var_name, char *buffer, int bufsize );
 // returns an empty string if not defined
 
+// engine code that reads a cvar it does not own every frame keeps
+// one of these instead of looking the name up each time
+typedef struct {
+	const char	*name;
+	cvar_t		*var;		// NULL until the cvar exists
+} cvarRef_t;
+
+cvar_t	*Cvar_Ref( cvarRef_t *ref );
+float	Cvar_RefValue( cvarRef_t *ref );
+int		Cvar_RefInteger( cvarRef_t *ref );
+// returns 0 if not defined
+
 int	Cvar_Flags(const char *var_name);
 // returns CVAR_NONEXISTENT if cvar doesn't exist or the flags of that particular CVAR.
 
@@ -595,6 +633,8 @@ void	FS_FreeFileList( char **list );
 qboolean FS_FileExists( const char *file );
 
 char   *FS_BuildOSPath( const char *base, const char *game, const char *qpath );
+// creates the directories of an OS path, qtrue if the path was refused
+qboolean FS_CreatePath( char *OSPath );
 
 int		FS_LoadStack( void );
 
@@ -641,6 +681,42 @@ void	FS_ForceFlush( fileHandle_t f );
 void	FS_FreeFile( void *buffer );
 // frees the memory returned by FS_ReadFile
 
+int		FS_MapFile( const char *qpath, const void **buffer );
+// like FS_ReadFile, but files stored uncompressed in a pk3 are returned
+// in place from the mapped pk3 without a copy. The buffer is read-only,
+// not zero terminated, and only valid until the next filesystem restart.
+
+void	FS_FreeMappedFile( const void *buffer );
+// releases the buffer returned by FS_MapFile
+
+typedef struct {
+	const void	*data;				// stored or deflated data in a mapped pk3
+	void		*fp;				// FILE of a loose file
+	int			compressedSize;
+	int			length;
+	qboolean	deflated;
+} backgroundRead_t;
+
+int		FS_OpenBackgroundRead( const char *qpath, backgroundRead_t *read );
+// finds a file for FS_BackgroundRead, returns the length or -1 if the file
+// does not exist or can't be read outside of the main thread. Every
+// successful open has to be followed by FS_BackgroundRead or
+// FS_CloseBackgroundRead.
+
+qboolean FS_BackgroundRead( backgroundRead_t *read, void *buffer );
+// reads the whole file opened with FS_OpenBackgroundRead and closes it.
+// Safe to call from a job thread, touches no filesystem state. With a NULL
+// buffer the data is only brought into the page cache.
+
+void	FS_CloseBackgroundRead( backgroundRead_t *read );
+
+void	FS_BeginMapLoad( const char *mapname );
+// starts recording the files opened while loading a map and issues
+// readahead for the files the last load of the same map opened
+
+void	FS_EndMapLoad( void );
+// stops recording, saves the manifest and reports the load time
+
 void	FS_WriteFile( const char *qpath, const void *buffer, int size );
 // writes a complete file, creating any subdirectories needed
 
@@ -789,8 +865,10 @@ void 		Com_Quit_f( void );
 
 int			Com_Milliseconds( void );	// will be journaled properly
 unsigned	Com_BlockChecksum( const void *buffer, int length );
+void		Com_JournalChecksum( const void *data, int length );
 char		*Com_MD5File(const char *filename, int length, const char *prefix, int prefix_len);
 int			Com_HashKey(char *string, int maxlen);
+unsigned	Com_HashKeyNoCase( const char *string );
 int			Com_Filter(char *filter, char *name, int casesensitive);
 int			Com_FilterPath(char *filter, char *name, int casesensitive);
 int			Com_RealTime(qtime_t *qtime);
@@ -1041,6 +1119,12 @@ void	Sys_Print( const char *msg );
 // any game related timing information should come from event timestamps
 int		Sys_Milliseconds (void);
 
+// wraps around every 71 minutes, only use differences
+unsigned	Sys_Microseconds( void );
+
+// user and system time used by the whole process
+int		Sys_ProcessMilliseconds( void );
+
 void	Sys_SnapVector( float *v );
 
 qboolean Sys_RandomBytes( byte *string, int len );
@@ -1078,6 +1162,34 @@ char *Sys_ConsoleInput(void);
 
 char **Sys_ListFiles( const char *directory, const char *extension, char *filter, int *numfiles, qboolean wantsubs );
 void	Sys_FreeFileList( char **list );
+void	*Sys_MapFile( const char *path, int *length );
+void	Sys_UnmapFile( void *base, int length );
+void	Sys_Readahead( const void *base, int length );
+void	Sys_ReadaheadFile( FILE *f );
+void	*Sys_ReserveMemory( int length );
+qboolean	Sys_CommitMemory( void *base, int length );
+
+typedef enum {
+	JOB_IDLE,
+	JOB_QUEUED,
+	JOB_RUNNING,
+	JOB_DONE
+} jobState_t;
+
+typedef struct job_s {
+	void			(*function)( void *data );
+	void			*data;
+	volatile jobState_t	state;
+	struct job_s	*next;
+} job_t;
+
+void	Sys_InitJobs( int numThreads );
+void	Sys_ShutdownJobs( void );
+int		Sys_NumJobThreads( void );
+qboolean Sys_AddJob( job_t *job );
+void	Sys_FinishJob( job_t *job );
+qboolean Sys_CancelJob( job_t *job );
+void	Sys_WaitForJobs( void );
 void	Sys_Sleep(int msec);
 
 qboolean Sys_LowPhysicalMemory( void );
@@ -1235,7 +1235,7 @@ extern  int unzStringFileNameCompare (const char* fileName1,const char* fileName
 */
 extern uLong unzlocal_SearchCentralDir(FILE *fin)
 {
-	unsigned char* buf;
+	unsigned char buf[BUFREADCOMMENT+4];
 	uLong uSizeFile;
 	uLong uBackRead;
 	uLong uMaxBack=0xffff; /* maximum size of global comment */
@@ -1250,10 +1250,6 @@ extern uLong unzlocal_SearchCentralDir(FILE *fin)
 	if (uMaxBack>uSizeFile)
 		uMaxBack = uSizeFile;
 
-	buf = (unsigned char*)ALLOC(BUFREADCOMMENT+4);
-	if (buf==NULL)
-		return 0;
-
 	uBackRead = 4;
 	while (uBackRead<uMaxBack)
 	{
@@ -1284,7 +1280,6 @@ extern uLong unzlocal_SearchCentralDir(FILE *fin)
 		if (uPosFound!=0)
 			break;
 	}
-	TRYFREE(buf);
 	return uPosFound;
 }
 
@@ -1305,18 +1300,12 @@ extern unzFile unzReOpen (const char* path, unzFile file)
 }
 
 /*
-  Open a Zip file. path contain the full pathname (by example,
-     on a Windows NT computer "c:\\test\\zlib109.zip" or on an Unix computer
-	 "zlib/zlib109.zip".
-	 If the zipfile cannot be opened (file don't exist or in not valid), the
-	   return value is NULL.
-     Else, the return value is a unzFile Handle, usable with other function
-	   of this unzip package.
+  Read the central directory information of a zipfile into *s without
+    allocating anything.
 */
-extern unzFile unzOpen (const char* path)
+extern int unzOpenNoAlloc (const char* path, unz_s *s)
 {
 	unz_s us;
-	unz_s *s;
 	uLong central_pos,uL;
 	FILE * fin ;
 
@@ -1332,7 +1321,7 @@ extern unzFile unzOpen (const char* path)
 
     fin=fopen(path,"rb");
 	if (fin==NULL)
-		return NULL;
+		return UNZ_ERRNO;
 
 	central_pos = unzlocal_SearchCentralDir(fin);
 	if (central_pos==0)
@@ -1386,7 +1375,7 @@ extern unzFile unzOpen (const char* path)
 	if (err!=UNZ_OK)
 	{
 		fclose(fin);
-		return NULL;
+		return err;
 	}
 
 	us.file=fin;
@@ -1394,12 +1383,55 @@ extern unzFile unzOpen (const char* path)
 		                    (us.offset_central_dir+us.size_central_dir);
 	us.central_pos = central_pos;
     us.pfile_in_zip_read = NULL;
-	
+	us.mapped = NULL;
+	us.mapped_size = 0;
 
-	s=(unz_s*)ALLOC(sizeof(unz_s));
 	*s=us;
+	return UNZ_OK;
+}
+
+extern unzFile unzAllocHandle (const unz_s *us)
+{
+	unz_s *s;
+
+	s=(unz_s*)ALLOC(sizeof(unz_s));
+	*s=*us;
+	return (unzFile)s;
+}
+
+/*
+  Open a Zip file. path contain the full pathname (by example,
+     on a Windows NT computer "c:\\test\\zlib109.zip" or on an Unix computer
+	 "zlib/zlib109.zip".
+	 If the zipfile cannot be opened (file don't exist or in not valid), the
+	   return value is NULL.
+     Else, the return value is a unzFile Handle, usable with other function
+	   of this unzip package.
+*/
+extern unzFile unzOpen (const char* path)
+{
+	unz_s us;
+
+	if (unzOpenNoAlloc(path,&us)!=UNZ_OK)
+		return NULL;
+
 //	unzGoToFirstFile((unzFile)s);	
-	return (unzFile)s;	
+	return unzAllocHandle(&us);
+}
+
+
+/*
+  Read file data from a mapping of the whole zipfile
+*/
+extern void unzSetMapping (unzFile file, const void *base, unsigned long size)
+{
+	unz_s* s;
+	if (file==NULL)
+		return;
+	s=(unz_s*)file;
+
+	s->mapped = (const unsigned char*)base;
+	s->mapped_size = base ? size : 0;
 }
 
 
@@ -1770,6 +1802,60 @@ extern int unzLocateFile (unzFile file, const char *szFileName, int iCaseSensiti
 }
 
 
+#define unzlocal_mappedShort(p) ((uLong)(p)[0] | ((uLong)(p)[1] << 8))
+#define unzlocal_mappedLong(p) (unzlocal_mappedShort(p) | (unzlocal_mappedShort((p) + 2) << 16))
+
+/*
+  Same as unzlocal_CheckCurrentFileCoherencyHeader, reading the static
+        header from the mapping
+*/
+static int unzlocal_CheckMappedFileCoherencyHeader (unz_s* s, uInt* piSizeVar,
+													uLong *poffset_local_extrafield,
+													uInt *psize_local_extrafield)
+{
+	const unsigned char *p;
+	uLong pos,uFlags;
+	uLong size_filename;
+	uLong size_extra_field;
+
+	pos = s->cur_file_info_internal.offset_curfile + s->byte_before_the_zipfile;
+	if (pos > s->mapped_size || s->mapped_size - pos < SIZEZIPLOCALHEADER)
+		return UNZ_ERRNO;
+	p = s->mapped + pos;
+
+	if (unzlocal_mappedLong(p) != 0x04034b50)
+		return UNZ_BADZIPFILE;
+
+	uFlags = unzlocal_mappedShort(p + 6);
+
+	if (unzlocal_mappedShort(p + 8) != s->cur_file_info.compression_method)
+		return UNZ_BADZIPFILE;
+
+	if ((s->cur_file_info.compression_method!=0) &&
+		(s->cur_file_info.compression_method!=Z_DEFLATED))
+		return UNZ_BADZIPFILE;
+
+	/* unzlocal_getLong sign extends, compare the low 32 bits only */
+	if ((uFlags & 8)==0 &&
+		((unzlocal_mappedLong(p + 14) != (s->cur_file_info.crc & 0xffffffffUL)) ||
+		 (unzlocal_mappedLong(p + 18) != (s->cur_file_info.compressed_size & 0xffffffffUL)) ||
+		 (unzlocal_mappedLong(p + 22) != (s->cur_file_info.uncompressed_size & 0xffffffffUL))))
+		return UNZ_BADZIPFILE;
+
+	size_filename = unzlocal_mappedShort(p + 26);
+	if (size_filename != s->cur_file_info.size_filename)
+		return UNZ_BADZIPFILE;
+
+	size_extra_field = unzlocal_mappedShort(p + 28);
+
+	*piSizeVar = (uInt)(size_filename + size_extra_field);
+	*poffset_local_extrafield = s->cur_file_info_internal.offset_curfile +
+									SIZEZIPLOCALHEADER + size_filename;
+	*psize_local_extrafield = (uInt)size_extra_field;
+
+	return UNZ_OK;
+}
+
 /*
   Read the static header of the current zipfile
   Check the coherency of the static header and info in the end of central
@@ -1790,6 +1876,10 @@ static int unzlocal_CheckCurrentFileCoherencyHeader (unz_s* s, uInt* piSizeVar,
 	*poffset_local_extrafield = 0;
 	*psize_local_extrafield = 0;
 
+	if (s->mapped != NULL)
+		return unzlocal_CheckMappedFileCoherencyHeader(s,piSizeVar,
+					poffset_local_extrafield,psize_local_extrafield);
+
 	if (fseek(s->file,s->cur_file_info_internal.offset_curfile +
 								s->byte_before_the_zipfile,SEEK_SET)!=0)
 		return UNZ_ERRNO;
@@ -1891,12 +1981,19 @@ extern int unzOpenCurrentFile (unzFile file)
 	if (pfile_in_zip_read_info==NULL)
 		return UNZ_INTERNALERROR;
 
-	pfile_in_zip_read_info->read_buffer=(char*)ALLOC(UNZ_BUFSIZE);
+	pfile_in_zip_read_info->mapped = s->mapped;
+	pfile_in_zip_read_info->mapped_size = s->mapped_size;
+
+	/* a mapped zipfile is read in place */
+	if (s->mapped != NULL)
+		pfile_in_zip_read_info->read_buffer=NULL;
+	else
+		pfile_in_zip_read_info->read_buffer=(char*)ALLOC(UNZ_BUFSIZE);
 	pfile_in_zip_read_info->offset_local_extrafield = offset_local_extrafield;
 	pfile_in_zip_read_info->size_local_extrafield = size_local_extrafield;
 	pfile_in_zip_read_info->pos_local_extrafield=0;
 
-	if (pfile_in_zip_read_info->read_buffer==NULL)
+	if (pfile_in_zip_read_info->read_buffer==NULL && s->mapped==NULL)
 	{
 		TRYFREE(pfile_in_zip_read_info);
 		return UNZ_INTERNALERROR;
@@ -1978,7 +2075,8 @@ extern int unzReadCurrentFile  (unzFile file, void *buf, unsigned len)
 		return UNZ_PARAMERROR;
 
 
-	if ((pfile_in_zip_read_info->read_buffer == NULL))
+	if ((pfile_in_zip_read_info->read_buffer == NULL) &&
+		(pfile_in_zip_read_info->mapped == NULL))
 		return UNZ_END_OF_LIST_OF_FILE;
 	if (len==0)
 		return 0;
@@ -1997,39 +2095,54 @@ extern int unzReadCurrentFile  (unzFile file, void *buf, unsigned len)
             (pfile_in_zip_read_info->rest_read_compressed>0))
 		{
 			uInt uReadThis = UNZ_BUFSIZE;
+			if (pfile_in_zip_read_info->mapped != NULL)
+				uReadThis = (uInt)pfile_in_zip_read_info->rest_read_compressed;
 			if (pfile_in_zip_read_info->rest_read_compressed<uReadThis)
 				uReadThis = (uInt)pfile_in_zip_read_info->rest_read_compressed;
 			if (uReadThis == 0)
 				return UNZ_EOF;
-			if (s->cur_file_info.compressed_size == pfile_in_zip_read_info->rest_read_compressed)
-				if (fseek(pfile_in_zip_read_info->file,
-						  pfile_in_zip_read_info->pos_in_zipfile + 
-							 pfile_in_zip_read_info->byte_before_the_zipfile,SEEK_SET)!=0)
+			if (pfile_in_zip_read_info->mapped != NULL)
+			{
+				/* hand the rest of the compressed data to inflate in one piece */
+				uLong pos = pfile_in_zip_read_info->pos_in_zipfile +
+							pfile_in_zip_read_info->byte_before_the_zipfile;
+				if (pos > pfile_in_zip_read_info->mapped_size ||
+					uReadThis > pfile_in_zip_read_info->mapped_size - pos)
 					return UNZ_ERRNO;
-			if (fread(pfile_in_zip_read_info->read_buffer,uReadThis,1,
-                         pfile_in_zip_read_info->file)!=1)
-				return UNZ_ERRNO;
+				pfile_in_zip_read_info->stream.next_in =
+                    (Byte*)(pfile_in_zip_read_info->mapped + pos);
+			}
+			else
+			{
+				if (s->cur_file_info.compressed_size == pfile_in_zip_read_info->rest_read_compressed)
+					if (fseek(pfile_in_zip_read_info->file,
+							  pfile_in_zip_read_info->pos_in_zipfile + 
+								 pfile_in_zip_read_info->byte_before_the_zipfile,SEEK_SET)!=0)
+						return UNZ_ERRNO;
+				if (fread(pfile_in_zip_read_info->read_buffer,uReadThis,1,
+                             pfile_in_zip_read_info->file)!=1)
+					return UNZ_ERRNO;
+				pfile_in_zip_read_info->stream.next_in = 
+                    (Byte*)pfile_in_zip_read_info->read_buffer;
+			}
 			pfile_in_zip_read_info->pos_in_zipfile += uReadThis;
 
 			pfile_in_zip_read_info->rest_read_compressed-=uReadThis;
 			
-			pfile_in_zip_read_info->stream.next_in = 
-                (Byte*)pfile_in_zip_read_info->read_buffer;
 			pfile_in_zip_read_info->stream.avail_in = (uInt)uReadThis;
 		}
 
 		if (pfile_in_zip_read_info->compression_method==0)
 		{
-			uInt uDoCopy,i ;
+			uInt uDoCopy;
 			if (pfile_in_zip_read_info->stream.avail_out < 
                             pfile_in_zip_read_info->stream.avail_in)
 				uDoCopy = pfile_in_zip_read_info->stream.avail_out ;
 			else
 				uDoCopy = pfile_in_zip_read_info->stream.avail_in ;
 				
-			for (i=0;i<uDoCopy;i++)
-				*(pfile_in_zip_read_info->stream.next_out+i) =
-                        *(pfile_in_zip_read_info->stream.next_in+i);
+			Com_Memcpy(pfile_in_zip_read_info->stream.next_out,
+                       pfile_in_zip_read_info->stream.next_in, uDoCopy);
 					
 //			pfile_in_zip_read_info->crc32 = crc32(pfile_in_zip_read_info->crc32,
 //								pfile_in_zip_read_info->stream.next_out,
@@ -2085,6 +2198,108 @@ extern int unzReadCurrentFile  (unzFile file, void *buf, unsigned len)
 }
 
 
+/*
+  Return the data of the current file in the mapping if it is stored
+*/
+extern const void *unzGetCurrentFileMapping (unzFile file)
+{
+	unz_s* s;
+	file_in_zip_read_info_s* pfile_in_zip_read_info;
+	uLong pos;
+
+	if (file==NULL)
+		return NULL;
+	s=(unz_s*)file;
+    pfile_in_zip_read_info=s->pfile_in_zip_read;
+
+	if (pfile_in_zip_read_info==NULL || pfile_in_zip_read_info->mapped==NULL)
+		return NULL;
+	if (pfile_in_zip_read_info->compression_method!=0)
+		return NULL;
+
+	/* the start of the data, whatever has been read already */
+	pos = pfile_in_zip_read_info->pos_in_zipfile +
+			pfile_in_zip_read_info->byte_before_the_zipfile -
+			(s->cur_file_info.compressed_size - pfile_in_zip_read_info->rest_read_compressed);
+	if (pos > pfile_in_zip_read_info->mapped_size ||
+		s->cur_file_info.compressed_size > pfile_in_zip_read_info->mapped_size - pos)
+		return NULL;
+
+	return pfile_in_zip_read_info->mapped + pos;
+}
+
+/*
+  Return the start of the raw, possibly deflated, data of the current
+  file in the mapping. Nothing may have been read from the file yet.
+*/
+extern const void *unzGetCurrentFileRawMapping (unzFile file, int *deflated, uLong *compressed_size)
+{
+	unz_s* s;
+	file_in_zip_read_info_s* pfile_in_zip_read_info;
+	uLong pos;
+
+	if (file==NULL)
+		return NULL;
+	s=(unz_s*)file;
+    pfile_in_zip_read_info=s->pfile_in_zip_read;
+
+	if (pfile_in_zip_read_info==NULL || pfile_in_zip_read_info->mapped==NULL)
+		return NULL;
+	if (pfile_in_zip_read_info->rest_read_compressed!=s->cur_file_info.compressed_size)
+		return NULL;
+
+	pos = pfile_in_zip_read_info->pos_in_zipfile +
+			pfile_in_zip_read_info->byte_before_the_zipfile;
+	if (pos > pfile_in_zip_read_info->mapped_size ||
+		s->cur_file_info.compressed_size > pfile_in_zip_read_info->mapped_size - pos)
+		return NULL;
+
+	*deflated = (pfile_in_zip_read_info->compression_method==Z_DEFLATED);
+	*compressed_size = s->cur_file_info.compressed_size;
+	return pfile_in_zip_read_info->mapped + pos;
+}
+
+static voidp unzlocal_threadAlloc (voidp opaque, unsigned items, unsigned size)
+{
+	return (voidp)malloc(items*size);
+}
+
+static void unzlocal_threadFree (voidp opaque, voidp ptr)
+{
+	free(ptr);
+}
+
+/*
+  Inflate a raw deflate stream. Only uses malloc, so it can be called
+  from any thread.
+*/
+extern int unzInflateBuffer (const void* src, uLong src_size, void* dest, uLong dest_size)
+{
+	z_stream stream;
+	int err;
+
+	Com_Memset(&stream, 0, sizeof(stream));
+	stream.zalloc = (alloc_func)unzlocal_threadAlloc;
+	stream.zfree = (free_func)unzlocal_threadFree;
+
+	if (inflateInit2(&stream, -MAX_WBITS)!=Z_OK)
+		return UNZ_INTERNALERROR;
+
+	stream.next_in = (Byte*)src;
+	stream.avail_in = (uInt)src_size;
+	stream.next_out = (Byte*)dest;
+	stream.avail_out = (uInt)dest_size;
+
+	err = inflate(&stream, Z_SYNC_FLUSH);
+	inflateEnd(&stream);
+
+	if (err!=Z_OK && err!=Z_STREAM_END)
+		return err;
+	if (stream.total_out!=dest_size)
+		return UNZ_BADZIPFILE;
+	return UNZ_OK;
+}
+
 /*
   Give the current position in uncompressed data
 */
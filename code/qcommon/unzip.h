@@ -127,6 +127,8 @@ typedef struct
 	FILE* file;                 /* io structore of the zipfile */
 	unsigned long compression_method;   /* compression method (0==store) */
 	unsigned long byte_before_the_zipfile;/* unsigned char before the zipfile, (>0 for sfx)*/
+	const unsigned char* mapped;        /* the zipfile mapped into memory, or NULL */
+	unsigned long mapped_size;
 } file_in_zip_read_info_s;
 
 
@@ -152,6 +154,8 @@ typedef struct
 	                                    file if we are decompressing it */
 	unsigned char*	tmpFile;
 	int	tmpPos,tmpSize;
+	const unsigned char* mapped;        /* the zipfile mapped into memory, or NULL */
+	unsigned long mapped_size;
 } unz_s;
 
 #define UNZ_OK                                  (0)
@@ -191,6 +195,17 @@ extern unzFile unzReOpen (const char* path, unzFile file);
 	   of this unzip package.
 */
 
+extern int unzOpenNoAlloc (const char *path, unz_s *s);
+extern unzFile unzAllocHandle (const unz_s *us);
+
+/*
+  Like unzOpen, but the state is stored in *s and nothing is allocated, so
+    it can be used from any thread. The other functions can be called with
+    (unzFile)s as long as no file in the zip is opened. unzAllocHandle turns
+    it into a handle for unzClose, the FILE moves over to the new handle.
+  return UNZ_OK if there is no problem.
+*/
+
 extern int unzClose (unzFile file);
 
 /*
@@ -199,6 +214,14 @@ extern int unzClose (unzFile file);
     these files MUST be closed with unzipCloseCurrentFile before call unzipClose.
   return UNZ_OK if there is no problem. */
 
+extern void unzSetMapping (unzFile file, const void *base, unsigned long size);
+
+/*
+  Read file data from a mapping of the whole zipfile instead of seeking
+  and reading through the FILE. Handles reopened with unzReOpen afterwards
+  share the mapping, it must stay valid until all of them are closed.
+*/
+
 extern int unzGetGlobalInfo (unzFile file, unz_global_info *pglobal_info);
 
 /*
@@ -308,6 +331,30 @@ extern int unzReadCurrentFile (unzFile file, void* buf, unsigned len);
     (UNZ_ERRNO for IO error, or zLib error for uncompress error)
 */
 
+extern const void *unzGetCurrentFileMapping (unzFile file);
+
+/*
+  Return the data of the current file (opened by unzOpenCurrentFile) in
+  the mapping set with unzSetMapping, if it is stored without compression.
+  return NULL if the file is compressed or the zipfile is not mapped
+*/
+
+extern const void *unzGetCurrentFileRawMapping (unzFile file, int *deflated, unsigned long *compressed_size);
+
+/*
+  Return the raw data of the current file in the mapping before anything
+  has been read from it, with its compressed size and whether it is
+  deflated or stored.
+  return NULL if the zipfile is not mapped
+*/
+
+extern int unzInflateBuffer (const void* src, unsigned long src_size, void* dest, unsigned long dest_size);
+
+/*
+  Inflate a raw deflate stream of dest_size bytes. Does not use the zone
+  and may be called from any thread.
+*/
+
 extern long unztell(unzFile file);
 
 /*
@@ -49,6 +49,10 @@ vm_t	vmTable[MAX_VM];
 
 void VM_VmInfo_f( void );
 void VM_VmProfile_f( void );
+void VM_VmTest_f( void );
+void VM_VmBench_f( void );
+static void VM_SampleAlloc( vm_t *vm );
+static void VM_SampleDiscard( vm_t *vm );
 
 
 
@@ -73,9 +77,13 @@ void VM_Init( void ) {
 	Cvar_Get( "vm_cgame", "2", CVAR_ARCHIVE );	// !@# SHIP WITH SET TO 2
 	Cvar_Get( "vm_game", "2", CVAR_ARCHIVE );	// !@# SHIP WITH SET TO 2
 	Cvar_Get( "vm_ui", "2", CVAR_ARCHIVE );		// !@# SHIP WITH SET TO 2
+	Cvar_Get( "vm_optimize", "1", CVAR_ARCHIVE );	// register allocating x86_64 compiler
+	Cvar_Get( "vm_cache", "0", CVAR_ARCHIVE );	// keep compiled x86_64 code on disk
 
 	Cmd_AddCommand ("vmprofile", VM_VmProfile_f );
 	Cmd_AddCommand ("vminfo", VM_VmInfo_f );
+	Cmd_AddCommand ("vmtest", VM_VmTest_f );
+	Cmd_AddCommand ("vmbench", VM_VmBench_f );
 
 	Com_Memset( vmTable, 0, sizeof( vmTable ) );
 }
@@ -152,6 +160,138 @@ int VM_SymbolToValue( vm_t *vm, const char *symbol ) {
 }
 
 
+/*
+===============
+VM_InstructionForOffset
+
+Maps an offset into the compiled code back to the instruction it was
+generated for
+===============
+*/
+int VM_InstructionForOffset( vm_t *vm, int offset ) {
+	int		lo, hi, mid;
+
+	lo = 0;
+	hi = ( vm->instructionPointersLength >> 2 ) - 1;
+	while ( lo < hi ) {
+		mid = ( lo + hi + 1 ) >> 1;
+		if ( vm->instructionPointers[mid] <= offset ) {
+			lo = mid;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	return lo;
+}
+
+
+/*
+===============
+VM_FunctionForInstruction
+
+Returns the index of the function containing an instruction, -1 if
+it is in front of the first one
+===============
+*/
+static int VM_FunctionForInstruction( vm_t *vm, int instruction ) {
+	int		lo, hi, mid;
+
+	if ( !vm->numFunctions || instruction < vm->functions[0].start ) {
+		return -1;
+	}
+
+	lo = 0;
+	hi = vm->numFunctions - 1;
+	while ( lo < hi ) {
+		mid = ( lo + hi + 1 ) >> 1;
+		if ( vm->functions[mid].start <= instruction ) {
+			lo = mid;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	return lo;
+}
+
+
+/*
+===============
+VM_FindFunctions
+
+Every function starts with an OP_ENTER, remember where they are and
+how large their stack frames are so call chains can be followed
+===============
+*/
+static void VM_FindFunctions( vm_t *vm, vmHeader_t *header ) {
+	byte	*code;
+	int		pass;
+	int		pc;
+	int		op;
+	int		instruction;
+	int		count;
+
+	code = (byte *)header + header->codeOffset;
+
+	for ( pass = 0 ; pass < 2 ; pass++ ) {
+		pc = 0;
+		count = 0;
+		for ( instruction = 0 ; instruction < header->instructionCount ; instruction++ ) {
+			if ( pc >= header->codeLength ) {
+				break;
+			}
+			op = code[ pc++ ];
+
+			// these are the only opcodes that aren't a single byte
+			switch ( op ) {
+			case OP_ENTER:
+				if ( pass ) {
+					vm->functions[count].start = instruction;
+					vm->functions[count].frameSize = code[pc] | ( code[pc+1] << 8 )
+						| ( code[pc+2] << 16 ) | ( code[pc+3] << 24 );
+				}
+				count++;
+				pc += 4;
+				break;
+			case OP_CONST:
+			case OP_LOCAL:
+			case OP_LEAVE:
+			case OP_EQ:
+			case OP_NE:
+			case OP_LTI:
+			case OP_LEI:
+			case OP_GTI:
+			case OP_GEI:
+			case OP_LTU:
+			case OP_LEU:
+			case OP_GTU:
+			case OP_GEU:
+			case OP_EQF:
+			case OP_NEF:
+			case OP_LTF:
+			case OP_LEF:
+			case OP_GTF:
+			case OP_GEF:
+			case OP_BLOCK_COPY:
+				pc += 4;
+				break;
+			case OP_ARG:
+				pc += 1;
+				break;
+			default:
+				break;
+			}
+		}
+
+		if ( !pass ) {
+			vm->numFunctions = count;
+			vm->functions = Hunk_Alloc( count * sizeof( *vm->functions ), h_high );
+		}
+	}
+}
+
+
 /*
 =====================
 VM_SymbolForCompiledPointer
@@ -383,6 +523,9 @@ vmHeader_t *VM_LoadQVM( vm_t *vm, qboolean alloc ) {
 		return NULL;
 	}
 
+	// identifies the image for the native code cache
+	vm->checksum = Com_BlockChecksum( header.v, length );
+
 	if( LittleLong( header.h->vmMagic ) == VM_MAGIC_VER2 ) {
 		Com_Printf( "...which has vmMagic VM_MAGIC_VER2\n" );
 
@@ -483,13 +626,15 @@ vm_t *VM_Restart( vm_t *vm ) {
 	if ( vm->dllHandle ) {
 		char	name[MAX_QPATH];
 		intptr_t	(*systemCall)( intptr_t *parms );
+		const vmFastSyscall_t	*fastSyscalls;
 		
 		systemCall = vm->systemCall;	
+		fastSyscalls = vm->fastSyscalls;
 		Q_strncpyz( name, vm->name, sizeof( name ) );
 
 		VM_Free( vm );
 
-		vm = VM_Create( name, systemCall, VMI_NATIVE );
+		vm = VM_Create( name, systemCall, fastSyscalls, VMI_NATIVE );
 		return vm;
 	}
 
@@ -518,8 +663,8 @@ it will attempt to load as a system dll
 
 #define	STACK_SIZE	0x20000
 
-vm_t *VM_Create( const char *module, intptr_t (*systemCalls)(intptr_t *), 
-				vmInterpret_t interpret ) {
+vm_t *VM_Create( const char *module, intptr_t (*systemCalls)(intptr_t *),
+				const vmFastSyscall_t *fastSyscalls, vmInterpret_t interpret ) {
 	vm_t		*vm;
 	vmHeader_t	*header;
 	int			i, remaining;
@@ -553,6 +698,7 @@ vm_t *VM_Create( const char *module, intptr_t (*systemCalls)(intptr_t *),
 
 	Q_strncpyz( vm->name, module, sizeof( vm->name ) );
 	vm->systemCall = systemCalls;
+	vm->fastSyscalls = fastSyscalls;
 
 	if ( interpret == VMI_NATIVE ) {
 		// try to load as a system dll
@@ -575,6 +721,8 @@ vm_t *VM_Create( const char *module, intptr_t (*systemCalls)(intptr_t *),
 	vm->instructionPointersLength = header->instructionCount * 4;
 	vm->instructionPointers = Hunk_Alloc( vm->instructionPointersLength, h_high );
 
+	VM_FindFunctions( vm, header );
+
 	// copy or compile the instructions
 	vm->codeLength = header->codeLength;
 
@@ -587,8 +735,17 @@ vm_t *VM_Create( const char *module, intptr_t (*systemCalls)(intptr_t *),
 	}
 #else
 	if ( interpret >= VMI_COMPILED ) {
+		int compileStart = Sys_Milliseconds();
+
 		vm->compiled = qtrue;
 		VM_Compile( vm, header );
+
+		vm->compileTime = Sys_Milliseconds() - compileStart;
+		if ( vm->cacheState == VMCACHE_LOADED ) {
+			Com_Printf( "%s loaded from native code cache in %i msec\n", module, vm->compileTime );
+		} else if ( vm->compiled ) {
+			Com_Printf( "%s compiled in %i msec\n", module, vm->compileTime );
+		}
 	}
 #endif
 	// VM_Compile may have reset vm->compiled if compilation failed
@@ -607,6 +764,8 @@ vm_t *VM_Create( const char *module, intptr_t (*systemCalls)(intptr_t *),
 	vm->programStack = vm->dataMask + 1;
 	vm->stackBottom = vm->programStack - STACK_SIZE;
 
+	VM_SampleAlloc( vm );
+
 	Com_Printf("%s loaded in %d bytes on the hunk\n", module, remaining - Hunk_MemoryRemaining());
 
 	return vm;
@@ -632,6 +791,8 @@ void VM_Free( vm_t *vm ) {
 		}
 	}
 
+	VM_SampleDiscard( vm );
+
 	if(vm->destroy)
 		vm->destroy(vm);
 
@@ -705,6 +866,25 @@ void *VM_ExplicitArgPtr( vm_t *vm, intptr_t intValue ) {
 	}
 }
 
+/*
+==============
+VM_Floor
+
+The floor system calls of all modules and the compiled code go
+through here, so they agree on floor( -0.0f ) whatever the flags
+the engine was built with
+==============
+*/
+float VM_Floor( float x ) {
+	floatint_t	fi;
+
+	fi.f = x;
+	if ( !( fi.i & 0x7fffffff ) ) {
+		return fi.f;
+	}
+	return floor( x );
+}
+
 
 /*
 ==============
@@ -802,6 +982,382 @@ intptr_t	QDECL VM_Call( vm_t *vm, int callnum, ... ) {
 
 //=================================================================
 
+/*
+Sampling profiler for compiled vms. A profiling timer interrupts the
+engine, the platform code maps the interrupted native pc back to a qvm
+instruction and hands it to VM_ProfileSample together with the
+programStack. The return instructions stored by OP_CALL in the stack
+frames give the call chain.
+*/
+
+#define	MAX_VM_SAMPLES	32768
+
+typedef struct {
+	int		vm;						// index into vmTable
+	int		depth;
+	int		pc[VM_SAMPLE_DEPTH];	// innermost first, -1 for engine code
+} vmSample_t;
+
+static vmSample_t	vmSamples[MAX_VM_SAMPLES];
+static int			vmNumSamples;
+static int			vmDroppedSamples;
+static int			vmSampleHz;
+static volatile int	vmSamplesLocked;
+
+static void VM_SampleAlloc( vm_t *vm ) {
+	if ( !vmSampleHz || !vm->compiled || vm->sampleHits ) {
+		return;
+	}
+	vm->sampleHits = Z_Malloc( vm->instructionPointersLength );
+	vm->sampleSyscalls = 0;
+}
+
+// forget the samples of a vm that is about to go away
+static void VM_SampleDiscard( vm_t *vm ) {
+	int		i, j;
+
+	if ( !vm->sampleHits ) {
+		return;
+	}
+
+	vmSamplesLocked = 1;
+
+	for ( i = j = 0 ; i < vmNumSamples ; i++ ) {
+		if ( &vmTable[ vmSamples[i].vm ] != vm ) {
+			vmSamples[j++] = vmSamples[i];
+		}
+	}
+	vmNumSamples = j;
+
+	Z_Free( vm->sampleHits );
+	vm->sampleHits = NULL;
+	vm->sampleSyscalls = 0;
+
+	vmSamplesLocked = 0;
+}
+
+/*
+==============
+VM_ProfileSample
+
+Called from a signal handler, instruction is -1 if the vm was in a
+system call. Must not allocate or print anything.
+==============
+*/
+void VM_ProfileSample( vm_t *vm, int instruction, int programStack ) {
+	vmSample_t	*sample;
+	int			numInstructions;
+	int			func;
+	int			ret;
+
+	if ( vmSamplesLocked || !vm->sampleHits ) {
+		return;
+	}
+
+	if ( instruction < 0 ) {
+		vm->sampleSyscalls++;
+	} else {
+		vm->sampleHits[instruction]++;
+	}
+
+	if ( vmNumSamples == MAX_VM_SAMPLES ) {
+		vmDroppedSamples++;
+		return;
+	}
+
+	sample = &vmSamples[vmNumSamples];
+	sample->vm = vm - vmTable;
+	sample->pc[0] = instruction;
+	sample->depth = 1;
+
+	numInstructions = vm->instructionPointersLength >> 2;
+
+	while ( sample->depth < VM_SAMPLE_DEPTH ) {
+		// the frame is allocated by the OP_ENTER at the start of the function
+		if ( instruction >= 0 ) {
+			func = VM_FunctionForInstruction( vm, instruction );
+			if ( func < 0 ) {
+				break;
+			}
+			if ( instruction != vm->functions[func].start ) {
+				programStack += vm->functions[func].frameSize;
+			}
+		}
+
+		if ( programStack < vm->stackBottom || programStack > vm->dataMask - 3 ) {
+			break;
+		}
+
+		// -1 marks the frame set up by VM_CallCompiled
+		ret = *(int *)( vm->dataBase + programStack );
+		if ( ret <= 0 || ret > numInstructions ) {
+			break;
+		}
+
+		instruction = ret - 1;
+		sample->pc[ sample->depth++ ] = instruction;
+	}
+
+	vmNumSamples++;
+}
+
+static const char *VM_FunctionName( vm_t *vm, int func ) {
+	vmSymbol_t	*sym;
+
+	if ( func < 0 ) {
+		return "[engine]";
+	}
+
+	sym = VM_ValueToFunctionSymbol( vm, vm->instructionPointers[ vm->functions[func].start ] );
+	if ( sym->symName[0] ) {
+		return sym->symName;
+	}
+
+	return va( "func_%i", vm->functions[func].start );
+}
+
+static int VM_SampleFunction( vm_t *vm, int instruction ) {
+	return instruction < 0 ? -1 : VM_FunctionForInstruction( vm, instruction );
+}
+
+static void VM_SampleStart( int hz ) {
+#ifdef VM_SAMPLING_PROFILER
+	int		i;
+
+	if ( vmSampleHz ) {
+		Com_Printf( "vm sampling is already running\n" );
+		return;
+	}
+
+	if ( hz < 10 ) {
+		hz = 10;
+	} else if ( hz > 10000 ) {
+		hz = 10000;
+	}
+
+	for ( i = 0 ; i < MAX_VM ; i++ ) {
+		VM_SampleDiscard( &vmTable[i] );
+	}
+	vmNumSamples = 0;
+	vmDroppedSamples = 0;
+
+	vmSampleHz = hz;
+	for ( i = 0 ; i < MAX_VM ; i++ ) {
+		if ( vmTable[i].name[0] ) {
+			VM_SampleAlloc( &vmTable[i] );
+		}
+	}
+
+	if ( !VM_SampleTimerStart( hz ) ) {
+		Com_Printf( "couldn't start the profiling timer\n" );
+		vmSampleHz = 0;
+		return;
+	}
+
+	Com_Printf( "sampling compiled vms at %i Hz\n", hz );
+#else
+	Com_Printf( "vm sampling is not supported on this platform\n" );
+#endif
+}
+
+static void VM_SampleStop( void ) {
+	if ( !vmSampleHz ) {
+		Com_Printf( "vm sampling is not running\n" );
+		return;
+	}
+
+#ifdef VM_SAMPLING_PROFILER
+	VM_SampleTimerStop();
+#endif
+	vmSampleHz = 0;
+	Com_Printf( "vm sampling stopped, %i call chains recorded", vmNumSamples );
+	if ( vmDroppedSamples ) {
+		Com_Printf( ", %i dropped", vmDroppedSamples );
+	}
+	Com_Printf( "\n" );
+}
+
+typedef struct {
+	int		func;
+	int		self;
+	int		total;
+} vmSampleFunc_t;
+
+static int QDECL VM_SampleFuncSort( const void *a, const void *b ) {
+	const vmSampleFunc_t *fa = a, *fb = b;
+
+	if ( fa->self != fb->self ) {
+		return fb->self - fa->self;
+	}
+	return fb->total - fa->total;
+}
+
+/*
+==============
+VM_SampleFlat
+
+Samples per function. self counts the samples in the function itself,
+total the call chains the function is part of.
+==============
+*/
+static void VM_SampleFlat( vm_t *vm ) {
+	vmSampleFunc_t	*funcs;
+	int				*seen;
+	int				hits, chains;
+	int				numInstructions;
+	int				i, j, f;
+
+	numInstructions = vm->instructionPointersLength >> 2;
+
+	// the last slot is for the engine
+	funcs = Z_Malloc( ( vm->numFunctions + 1 ) * sizeof( *funcs ) );
+	seen = Z_Malloc( ( vm->numFunctions + 1 ) * sizeof( *seen ) );
+
+	for ( i = 0 ; i <= vm->numFunctions ; i++ ) {
+		funcs[i].func = i < vm->numFunctions ? i : -1;
+	}
+
+	hits = vm->sampleSyscalls;
+	funcs[vm->numFunctions].self = vm->sampleSyscalls;
+	for ( i = 0 ; i < numInstructions ; i++ ) {
+		if ( !vm->sampleHits[i] ) {
+			continue;
+		}
+		hits += vm->sampleHits[i];
+		f = VM_FunctionForInstruction( vm, i );
+		if ( f >= 0 ) {
+			funcs[f].self += vm->sampleHits[i];
+		}
+	}
+
+	chains = 0;
+	for ( i = 0 ; i < vmNumSamples ; i++ ) {
+		if ( &vmTable[ vmSamples[i].vm ] != vm ) {
+			continue;
+		}
+		chains++;
+		for ( j = 0 ; j < vmSamples[i].depth ; j++ ) {
+			f = VM_SampleFunction( vm, vmSamples[i].pc[j] );
+			if ( f < 0 ) {
+				f = vm->numFunctions;
+			}
+			// count recursive functions once
+			if ( seen[f] != chains ) {
+				seen[f] = chains;
+				funcs[f].total++;
+			}
+		}
+	}
+
+	qsort( funcs, vm->numFunctions + 1, sizeof( *funcs ), VM_SampleFuncSort );
+
+	Com_Printf( "%s: %i samples, %i call chains\n", vm->name, hits, chains );
+	Com_Printf( "  self  total  samples function\n" );
+	for ( i = 0 ; i <= vm->numFunctions ; i++ ) {
+		if ( !funcs[i].self && !funcs[i].total ) {
+			break;
+		}
+		Com_Printf( "%5.1f%% %5.1f%% %8i %s\n",
+			hits ? 100.0f * funcs[i].self / hits : 0.0f,
+			chains ? 100.0f * funcs[i].total / chains : 0.0f,
+			funcs[i].self, VM_FunctionName( vm, funcs[i].func ) );
+	}
+
+	Z_Free( seen );
+	Z_Free( funcs );
+}
+
+typedef struct {
+	int		vm;
+	int		depth;
+	int		func[VM_SAMPLE_DEPTH];
+	int		count;
+} vmSampleChain_t;
+
+static int QDECL VM_SampleChainCompare( const void *a, const void *b ) {
+	const vmSampleChain_t *ca = a, *cb = b;
+
+	if ( ca->vm != cb->vm ) {
+		return ca->vm - cb->vm;
+	}
+	if ( ca->depth != cb->depth ) {
+		return ca->depth - cb->depth;
+	}
+	return memcmp( ca->func, cb->func, ca->depth * sizeof( ca->func[0] ) );
+}
+
+static int QDECL VM_SampleChainSort( const void *a, const void *b ) {
+	return ( (const vmSampleChain_t *)b )->count - ( (const vmSampleChain_t *)a )->count;
+}
+
+/*
+==============
+VM_SampleCalls
+
+The most frequent call chains, outermost function first
+==============
+*/
+#define	MAX_PRINTED_CHAINS	32
+
+static void VM_SampleCalls( void ) {
+	vmSampleChain_t	*chains;
+	vm_t			*vm;
+	char			line[MAX_STRING_CHARS];
+	int				numChains;
+	int				i, j;
+
+	if ( !vmNumSamples ) {
+		Com_Printf( "no call chains recorded\n" );
+		return;
+	}
+
+	vmSamplesLocked = 1;
+
+	chains = Z_Malloc( vmNumSamples * sizeof( *chains ) );
+	for ( i = 0 ; i < vmNumSamples ; i++ ) {
+		vm = &vmTable[ vmSamples[i].vm ];
+		chains[i].vm = vmSamples[i].vm;
+		chains[i].depth = vmSamples[i].depth;
+		for ( j = 0 ; j < vmSamples[i].depth ; j++ ) {
+			chains[i].func[j] = VM_SampleFunction( vm, vmSamples[i].pc[j] );
+		}
+	}
+
+	// merge identical chains
+	qsort( chains, vmNumSamples, sizeof( *chains ), VM_SampleChainCompare );
+	numChains = 0;
+	for ( i = 0 ; i < vmNumSamples ; i++ ) {
+		if ( numChains && !VM_SampleChainCompare( &chains[numChains-1], &chains[i] ) ) {
+			chains[numChains-1].count++;
+			continue;
+		}
+		chains[numChains] = chains[i];
+		chains[numChains].count = 1;
+		numChains++;
+	}
+
+	qsort( chains, numChains, sizeof( *chains ), VM_SampleChainSort );
+
+	for ( i = 0 ; i < numChains && i < MAX_PRINTED_CHAINS ; i++ ) {
+		vm = &vmTable[ chains[i].vm ];
+		line[0] = 0;
+		for ( j = chains[i].depth - 1 ; j >= 0 ; j-- ) {
+			Q_strcat( line, sizeof( line ), VM_FunctionName( vm, chains[i].func[j] ) );
+			if ( j ) {
+				Q_strcat( line, sizeof( line ), " > " );
+			}
+		}
+		Com_Printf( "%5.1f%% %6i %s: %s\n", 100.0f * chains[i].count / vmNumSamples,
+			chains[i].count, vm->name, line );
+	}
+	Com_Printf( "%i distinct call chains in %i samples\n", numChains, vmNumSamples );
+
+	Z_Free( chains );
+
+	vmSamplesLocked = 0;
+}
+
+
 static int QDECL VM_ProfileSort( const void *a, const void *b ) {
 	vmSymbol_t	*sa, *sb;
 
@@ -828,6 +1384,32 @@ void VM_VmProfile_f( void ) {
 	vmSymbol_t	**sorted, *sym;
 	int			i;
 	double		total;
+	qboolean	sampled;
+
+	if ( Cmd_Argc() > 1 ) {
+		if ( !Q_stricmp( Cmd_Argv( 1 ), "start" ) ) {
+			VM_SampleStart( Cmd_Argc() > 2 ? atoi( Cmd_Argv( 2 ) ) : 250 );
+		} else if ( !Q_stricmp( Cmd_Argv( 1 ), "stop" ) ) {
+			VM_SampleStop();
+		} else if ( !Q_stricmp( Cmd_Argv( 1 ), "calls" ) ) {
+			VM_SampleCalls();
+		} else {
+			Com_Printf( "usage: vmprofile [start [hz] | stop | calls]\n" );
+		}
+		return;
+	}
+
+	// sampled profiles of the compiled vms
+	sampled = qfalse;
+	for ( i = 0 ; i < MAX_VM ; i++ ) {
+		if ( vmTable[i].sampleHits ) {
+			VM_SampleFlat( &vmTable[i] );
+			sampled = qtrue;
+		}
+	}
+	if ( sampled ) {
+		return;
+	}
 
 	if ( !lastVM ) {
 		return;
@@ -891,11 +1473,199 @@ void VM_VmInfo_f( void ) {
 			Com_Printf( "interpreted\n" );
 		}
 		Com_Printf( "    code length : %7i\n", vm->codeLength );
+		if ( vm->compiled ) {
+			Com_Printf( "    compile time: %7i msec\n", vm->compileTime );
+			Com_Printf( "    native cache: %s (checksum %08x)\n",
+				vm->cacheState == VMCACHE_LOADED ? "loaded" :
+				vm->cacheState == VMCACHE_STORED ? "stored" : "unused", vm->checksum );
+		}
 		Com_Printf( "    table length: %7i\n", vm->instructionPointersLength );
 		Com_Printf( "    data length : %7i\n", vm->dataMask + 1 );
 	}
 }
 
+/*
+==============
+VM_VmTest_f
+
+Runs vm/vmtest.qvm interpreted and compiled and compares the results,
+a regression test for the compiler and its inline system calls
+==============
+*/
+#define	VMTEST_SEEDS	16
+#define	VMTEST_ROUNDS	1000
+#define	VMTEST_STACKARG	0		// system call number of VM_TestStackArg
+
+static int FloatAsInt( float f ) {
+	floatint_t fi;
+	fi.f = f;
+	return fi.i;
+}
+
+// the first argument read through vm->programStack, the way the
+// profiler and recursive vm entries find the stack of the caller
+static intptr_t VM_TestStackArg( int *args ) {
+	return *(int *)( currentVM->dataBase + ( ( currentVM->programStack + 12 ) & currentVM->dataMask ) );
+}
+
+static intptr_t VM_TestSystemCalls( intptr_t *args ) {
+	switch( args[0] ) {
+	case VMTEST_STACKARG:
+		return VM_TestStackArg( NULL );
+
+	case TRAP_MEMSET:
+		Com_Memset( VMA(1), args[2], args[3] );
+		return 0;
+
+	case TRAP_MEMCPY:
+		Com_Memcpy( VMA(1), VMA(2), args[3] );
+		return 0;
+
+	case TRAP_SIN:
+		return FloatAsInt( sin( VMF(1) ) );
+
+	case TRAP_COS:
+		return FloatAsInt( cos( VMF(1) ) );
+
+	case TRAP_ATAN2:
+		return FloatAsInt( atan2( VMF(1), VMF(2) ) );
+
+	case TRAP_SQRT:
+		return FloatAsInt( sqrt( VMF(1) ) );
+
+	case TRAP_FLOOR:
+		return FloatAsInt( VM_Floor( VMF(1) ) );
+
+	default:
+		Com_Error( ERR_DROP, "Bad vmtest system trap: %ld", (long int) args[0] );
+	}
+	return -1;
+}
+
+static const vmFastSyscall_t vm_testFastSyscalls[] = {
+	{ VMTEST_STACKARG,	VMSC_DIRECT,	VM_TestStackArg },
+	{ TRAP_MEMSET,	VMSC_MEMSET },
+	{ TRAP_MEMCPY,	VMSC_MEMCPY },
+	{ TRAP_SIN,		VMSC_SIN },
+	{ TRAP_COS,		VMSC_COS },
+	{ TRAP_ATAN2,	VMSC_ATAN2 },
+	{ TRAP_SQRT,	VMSC_SQRT },
+	{ TRAP_FLOOR,	VMSC_FLOOR },
+	{ 0,			VMSC_NONE }
+};
+
+void VM_VmTest_f( void ) {
+	vm_t	*vm;
+	int		results[2][VMTEST_SEEDS];
+	int		i, pass, failed;
+
+	if ( com_sv_running->integer ) {
+		Com_Printf( "vmtest can't be run with a server running\n" );
+		return;
+	}
+
+	for ( pass = 0 ; pass < 2 ; pass++ ) {
+		vm = VM_Create( "vmtest", VM_TestSystemCalls, vm_testFastSyscalls, pass ? VMI_COMPILED : VMI_BYTECODE );
+		if ( !vm ) {
+			Com_Printf( "vmtest: couldn't load vm/vmtest.qvm\n" );
+			return;
+		}
+
+		for ( i = 0 ; i < VMTEST_SEEDS ; i++ ) {
+			results[pass][i] = VM_Call( vm, VMTEST_ROUNDS, i );
+		}
+
+		VM_Free( vm );
+	}
+
+	failed = 0;
+	for ( i = 0 ; i < VMTEST_SEEDS ; i++ ) {
+		if ( results[0][i] != results[1][i] ) {
+			Com_Printf( "vmtest: seed %i interpreted %08x compiled %08x\n", i, results[0][i], results[1][i] );
+			failed++;
+		}
+	}
+
+	if ( failed ) {
+		Com_Printf( "vmtest: %i of %i seeds FAILED\n", failed, VMTEST_SEEDS );
+	} else {
+		Com_Printf( "vmtest: all %i seeds passed\n", VMTEST_SEEDS );
+	}
+}
+
+/*
+==============
+VM_VmBench_f
+
+Times the system calls of vm/vmbench.qvm in compiled code, through the
+dispatcher and with the inline system calls of vmtest. The time of the
+empty loop is taken off, the best of a few runs is printed.
+==============
+*/
+#define	VMBENCH_CALLS	1000000
+#define	VMBENCH_RUNS	5
+
+static const char *vmBenchTests[] = {
+	"loop",
+	"sqrt",
+	"floor",
+	"sin",
+	"cos",
+	"atan2",
+	"memset(16)",
+	"memcpy(16)",
+	"direct"
+};
+
+#define	VMBENCH_TESTS	( (int)( sizeof( vmBenchTests ) / sizeof( vmBenchTests[0] ) ) )
+
+void VM_VmBench_f( void ) {
+	vm_t		*vm;
+	unsigned	usec[2][VMBENCH_TESTS];
+	unsigned	start, best;
+	int			i, pass, run;
+
+	if ( com_sv_running->integer ) {
+		Com_Printf( "vmbench can't be run with a server running\n" );
+		return;
+	}
+
+	for ( pass = 0 ; pass < 2 ; pass++ ) {
+		vm = VM_Create( "vmbench", VM_TestSystemCalls, pass ? vm_testFastSyscalls : NULL, VMI_COMPILED );
+		if ( !vm ) {
+			Com_Printf( "vmbench: couldn't load vm/vmbench.qvm\n" );
+			return;
+		}
+
+		for ( i = 0 ; i < VMBENCH_TESTS ; i++ ) {
+			best = 0;
+			for ( run = 0 ; run < VMBENCH_RUNS ; run++ ) {
+				start = Sys_Microseconds();
+				VM_Call( vm, i, VMBENCH_CALLS );
+				start = Sys_Microseconds() - start;
+				if ( !run || start < best ) {
+					best = start;
+				}
+			}
+			usec[pass][i] = best;
+		}
+
+		VM_Free( vm );
+	}
+
+	Com_Printf( "ns per call, dispatcher -> inline:\n" );
+	for ( i = 0 ; i < VMBENCH_TESTS ; i++ ) {
+		if ( !i ) {
+			Com_Printf( "%-12s %6.1f -> %6.1f\n", vmBenchTests[i],
+				usec[0][i] * 1000.0f / VMBENCH_CALLS, usec[1][i] * 1000.0f / VMBENCH_CALLS );
+			continue;
+		}
+		Com_Printf( "%-12s %6.1f -> %6.1f\n", vmBenchTests[i],
+			( (int)usec[0][i] - (int)usec[0][0] ) * 1000.0f / VMBENCH_CALLS,
+			( (int)usec[1][i] - (int)usec[1][0] ) * 1000.0f / VMBENCH_CALLS );
+	}
+}
+
 /*
 ===============
 VM_LogSyscalls
@@ -120,6 +120,23 @@ typedef struct vmSymbol_s {
 	char	symName[1];		// variable sized
 } vmSymbol_t;
 
+typedef struct vmFunction_s {
+	int		start;			// instruction number of the OP_ENTER
+	int		frameSize;
+} vmFunction_t;
+
+// sampling profiler for compiled code, see VM_SampleTimerStart
+#if defined(__linux__) && defined(__x86_64__) && !defined(NO_VM_COMPILED)
+#define	VM_SAMPLING_PROFILER
+#endif
+
+#define	VM_SAMPLE_DEPTH				16	// frames kept per sampled call chain
+
+// vm_t->cacheState
+#define	VMCACHE_UNUSED				0	// compiled without the native code cache
+#define	VMCACHE_LOADED				1	// code was mapped from the cache
+#define	VMCACHE_STORED				2	// compiled and written to the cache
+
 #define	VM_OFFSET_PROGRAM_STACK		0
 #define	VM_OFFSET_SYSTEM_CALL		4
 
@@ -133,6 +150,8 @@ struct vm_s {
    
     char		name[MAX_QPATH];
 
+	const vmFastSyscall_t	*fastSyscalls;	// may be NULL
+
 	// for dynamic linked modules
 	void		*dllHandle;
 	intptr_t			(QDECL *entryPoint)( int callNum, ... );
@@ -144,6 +163,9 @@ struct vm_s {
 	qboolean	compiled;
 	byte		*codeBase;
 	int			codeLength;
+	int			compileTime;	// msec spent in VM_Compile
+	unsigned	checksum;		// of the qvm file
+	int			cacheState;		// VMCACHE_*
 
 	int			*instructionPointers;
 	int			instructionPointersLength;
@@ -164,6 +186,12 @@ struct vm_s {
 
 	byte		*jumpTableTargets;
 	int			numJumpTableTargets;
+
+	vmFunction_t	*functions;		// sorted by start
+	int			numFunctions;
+
+	int			*sampleHits;		// sampling profiler hits per instruction
+	int			sampleSyscalls;		// samples taken in engine code called by the vm
 };
 
 
@@ -177,6 +205,10 @@ void VM_PrepareInterpreter( vm_t *vm, vmHeader_t *header );
 int	VM_CallInterpreted( vm_t *vm, int *args );
 
 vmSymbol_t *VM_ValueToFunctionSymbol( vm_t *vm, int value );
+int VM_InstructionForOffset( vm_t *vm, int offset );
+void VM_ProfileSample( vm_t *vm, int instruction, int programStack );
+qboolean VM_SampleTimerStart( int hz );
+void VM_SampleTimerStop( void );
 int VM_SymbolToValue( vm_t *vm, const char *symbol );
 const char *VM_ValueToSymbol( vm_t *vm, int value );
 void VM_LogSyscalls( int *args );
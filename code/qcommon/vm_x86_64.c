@@ -22,42 +22,23 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 */
 // vm_x86_64.c -- load time compiler and execution environment for x86-64
 
+#define _GNU_SOURCE	// REG_RIP
+
 #include "vm_local.h"
+#include "vm_x86_64_assembler.h"
 
 #include <sys/mman.h>
-#include <sys/stat.h>
 #include <sys/types.h>
-#include <sys/wait.h>
+#include <sys/stat.h>
 #include <sys/time.h>
-#include <time.h>
+#include <sys/syscall.h>
 #include <fcntl.h>
-#include <errno.h>
+#include <signal.h>
+#include <ucontext.h>
 #include <unistd.h>
-#include <stdarg.h>
 
-//#define USE_GAS
 //#define DEBUG_VM
 
-#ifdef DEBUG_VM
-#define Dfprintf(fd, args...) fprintf(fd, ##args)
-static FILE* qdasmout;
-#else
-#define Dfprintf(args...)
-#endif
-
-#define VM_X86_64_MMAP
-
-#ifndef USE_GAS
-void assembler_set_output(char* buf);
-size_t assembler_get_code_size(void);
-void assembler_init(int pass);
-void assemble_line(const char* input, size_t len);
-#ifdef Dfprintf
-#undef Dfprintf
-#define Dfprintf(args...)
-#endif
-#endif // USE_GAS
-
 static void VM_Destroy_Compiled(vm_t* self);
 
 /*
@@ -225,102 +206,54 @@ static unsigned char op_argsize[256] =
 	[OP_BLOCK_COPY] = 4,
 };
 
-#ifdef USE_GAS
-#define emit(x...) \
-	do { fprintf(fh_s, ##x); fputc('\n', fh_s); } while(0)
-#else
-void emit(const char* fmt, ...)
-{
-	va_list ap;
-	char line[4096];
-	va_start(ap, fmt);
-	Q_vsnprintf(line, sizeof(line), fmt, ap);
-	va_end(ap);
-	assemble_line(line, strlen(line));
-}
-#endif // USE_GAS
 
-#ifdef USE_GAS
-#define JMPIARG \
-	emit("jmp i_%08x", iarg);
-#else
+// two labels per instruction: its start and one for local use
+#define LABEL_INSTR(i) (2*(i))
+#define LABEL_LOCAL(i) (2*(i)+1)
+
 #define JMPIARG \
-	emit("movq $%lu, %%rax", vm->codeBase+vm->instructionPointers[iarg]); \
-	emit("jmpq *%rax");
-#endif
- 
+	emit_reloc(vm, VMRELOC_CODE, vm->instructionPointers[iarg], R_RAX); \
+	emit(I_JMP, REG(R_RAX), NONE);
+
 // integer compare and jump
 #define IJ(op) \
-	emit("subq $8, %%rsi"); \
-	emit("movl 4(%%rsi), %%eax"); \
-	emit("cmpl 8(%%rsi), %%eax"); \
-	emit(op " i_%08x", instruction+1); \
+	emit(I_SUBQ, IMM(8), REG(R_RSI)); \
+	emit(I_MOVL, MEM(R_RSI, 4), REG(R_EAX)); \
+	emit(I_CMPL, MEM(R_RSI, 8), REG(R_EAX)); \
+	emit(op, LABEL(LABEL_INSTR(instruction+1)), NONE); \
 	JMPIARG \
 	neednilabel = 1;
 
-#ifdef USE_X87
-#define FJ(bits, op) \
-	emit("subq $8, %%rsi");\
-	emit("flds 4(%%rsi)");\
-	emit("fcomps 8(%%rsi)");\
-	emit("fnstsw %%ax");\
-	emit("testb $" #bits ", %%ah");\
-	emit(op " i_%08x", instruction+1);\
-	JMPIARG \
-	neednilabel = 1;
-#define XJ(x)
-#else
-#define FJ(x, y)
 #define XJ(op) \
-	emit("subq $8, %%rsi");\
-	emit("movss 4(%%rsi), %%xmm0");\
-	emit("ucomiss 8(%%rsi), %%xmm0");\
-	emit("jp i_%08x", instruction+1);\
-	emit(op " i_%08x", instruction+1);\
+	emit(I_SUBQ, IMM(8), REG(R_RSI)); \
+	emit(I_MOVSS, MEM(R_RSI, 4), REG(R_XMM0)); \
+	emit(I_UCOMISS, MEM(R_RSI, 8), REG(R_XMM0)); \
+	emit(I_JP, LABEL(LABEL_INSTR(instruction+1)), NONE); \
+	emit(op, LABEL(LABEL_INSTR(instruction+1)), NONE); \
 	JMPIARG \
 	neednilabel = 1;
-#endif
 
 #define SIMPLE(op) \
-	emit("subq $4, %%rsi"); \
-	emit("movl 4(%%rsi), %%eax"); \
-	emit(op " %%eax, 0(%%rsi)");
-
-#ifdef USE_X87
-#define FSIMPLE(op) \
-	emit("subq $4, %%rsi"); \
-	emit("flds 0(%%rsi)"); \
-	emit(op " 4(%%rsi)"); \
-	emit("fstps 0(%%rsi)");
-#define XSIMPLE(op)
-#else
-#define FSIMPLE(op)
+	emit(I_SUBQ, IMM(4), REG(R_RSI)); \
+	emit(I_MOVL, MEM(R_RSI, 4), REG(R_EAX)); \
+	emit(op, REG(R_EAX), MEM(R_RSI, 0));
+
 #define XSIMPLE(op) \
-	emit("subq $4, %%rsi"); \
-	emit("movss 0(%%rsi), %%xmm0"); \
-	emit(op " 4(%%rsi), %%xmm0"); \
-	emit("movss %%xmm0, 0(%%rsi)");
-#endif
+	emit(I_SUBQ, IMM(4), REG(R_RSI)); \
+	emit(I_MOVSS, MEM(R_RSI, 0), REG(R_XMM0)); \
+	emit(op, MEM(R_RSI, 4), REG(R_XMM0)); \
+	emit(I_MOVSS, REG(R_XMM0), MEM(R_RSI, 0));
 
 #define SHIFT(op) \
-	emit("subq $4, %%rsi"); \
-	emit("movl 4(%%rsi), %%ecx"); \
-	emit("movl 0(%%rsi), %%eax"); \
-	emit(op " %%cl, %%eax"); \
-	emit("movl %%eax, 0(%%rsi)");
+	emit(I_SUBQ, IMM(4), REG(R_RSI)); \
+	emit(I_MOVL, MEM(R_RSI, 4), REG(R_ECX)); \
+	emit(I_MOVL, MEM(R_RSI, 0), REG(R_EAX)); \
+	emit(op, REG(R_CL), REG(R_EAX)); \
+	emit(I_MOVL, REG(R_EAX), MEM(R_RSI, 0));
 
 #if 1
 #define RANGECHECK(reg) \
-	emit("andl $0x%x, %%" #reg, vm->dataMask);
-#elif 0
-#define RANGECHECK(reg) \
-	emit("pushl %%" #reg); \
-	emit("andl $0x%x, %%" #reg, ~vm->dataMask); \
-	emit("jz rangecheck_ok_i_%08x", instruction); \
-	emit("int3"); \
-	emit("rangecheck_ok_i_%08x:", instruction); \
-	emit("popl %%" #reg); \
-	emit("andl $0x%x, %%" #reg, vm->dataMask);
+	emit(I_ANDL, IMM(vm->dataMask), REG(reg));
 #else
 #define RANGECHECK(reg)
 #endif
@@ -333,200 +266,1389 @@ void emit(const char* fmt, ...)
 	do { Com_Printf(S_COLOR_RED "instruction not implemented: %x\n", x); vm->compiled = qfalse; return; } while(0)
 #endif
 
-static void* getentrypoint(vm_t* vm)
+static void block_copy_vm(unsigned dest, unsigned src, unsigned count)
 {
-#ifdef USE_GAS
-       return vm->codeBase+64; // skip ELF header
-#else
-       return vm->codeBase;
-#endif // USE_GAS
+	unsigned dataMask = currentVM->dataMask;
+
+	if ((dest & dataMask) != dest
+	|| (src & dataMask) != src
+	|| ((dest+count) & dataMask) != dest + count
+	|| ((src+count) & dataMask) != src + count)
+	{
+		Com_Error(ERR_DROP, "OP_BLOCK_COPY out of range!\n");
+	}
+
+	memcpy(currentVM->dataBase+dest, currentVM->dataBase+src, count);
 }
 
-#ifdef USE_GAS
-char* mmapfile(const char* fn, size_t* size)
+/*
+=================
+relocations
+
+The generated code is position independent except for a few 64 bit
+immediates loaded with movq. Each of them is recorded so the code can
+be written to the native code cache and moved to a different address
+when it is mapped again.
+=================
+*/
+
+/* float versions of the math system calls, same results as the
+ * FloatAsInt( sin( VMF(1) ) ) in the system call handlers, floor
+ * is the VM_Floor they use */
+static float VM_Sin(float x) { return sin(x); }
+static float VM_Cos(float x) { return cos(x); }
+static float VM_Atan2(float y, float x) { return atan2(y, x); }
+
+typedef enum
+{
+	VMRELOC_CODE,		// vm->codeBase + addend
+	VMRELOC_IPTRS,		// vm->instructionPointers
+	VMRELOC_SYSCALL,	// callAsmCall
+	VMRELOC_BLOCKCOPY,	// block_copy_vm
+	VMRELOC_FLOOR,		// VM_Floor
+	VMRELOC_SIN,		// VM_Sin
+	VMRELOC_COS,		// VM_Cos
+	VMRELOC_ATAN2,		// VM_Atan2
+	VMRELOC_MEMSET,		// memset
+	VMRELOC_MEMCPY,		// memcpy
+	VMRELOC_PROGRAMSTACK,	// &vm->programStack
+	VMRELOC_DIRECT		// vm->fastSyscalls[addend].func
+} vmreloctype_t;
+
+typedef struct
 {
-	int fd = -1;
-	char* mem = NULL;
-	struct stat stb;
+	unsigned	offset;		// of the immediate in the code
+	int		type;
+	int		addend;
+} vmreloc_t;
 
-	fd = open(fn, O_RDONLY);
-	if(fd == -1)
-		goto out;
+static vmreloc_t* relocs;
+static unsigned numRelocs;
 
-	if(fstat(fd, &stb) == -1)
-		goto out;
+static unsigned long VM_RelocValue(vm_t* vm, int type, int addend)
+{
+	switch(type)
+	{
+		case VMRELOC_CODE:
+			return (unsigned long)vm->codeBase + addend;
+		case VMRELOC_IPTRS:
+			return (unsigned long)vm->instructionPointers;
+		case VMRELOC_SYSCALL:
+			return (unsigned long)callAsmCall;
+		case VMRELOC_BLOCKCOPY:
+			return (unsigned long)block_copy_vm;
+		case VMRELOC_FLOOR:
+			return (unsigned long)VM_Floor;
+		case VMRELOC_SIN:
+			return (unsigned long)VM_Sin;
+		case VMRELOC_COS:
+			return (unsigned long)VM_Cos;
+		case VMRELOC_ATAN2:
+			return (unsigned long)VM_Atan2;
+		case VMRELOC_MEMSET:
+			return (unsigned long)memset;
+		case VMRELOC_MEMCPY:
+			return (unsigned long)memcpy;
+		case VMRELOC_PROGRAMSTACK:
+			return (unsigned long)&vm->programStack;
+		default:
+			return (unsigned long)vm->fastSyscalls[addend].func;
+	}
+}
 
-	*size = stb.st_size;
+// movq $address, %reg and remember where the address went
+static void emit_reloc(vm_t* vm, int type, int addend, reg_t reg)
+{
+	emit(I_MOVQ, IMM(VM_RelocValue(vm, type, addend)), REG(reg));
 
-	mem = mmap(NULL, stb.st_size, PROT_READ|PROT_EXEC, MAP_SHARED, fd, 0);
-	if(mem == (void*)-1)
-		mem = NULL;
+	if(relocs)
+	{
+		relocs[numRelocs].offset = assembler_get_code_size() - 8;
+		relocs[numRelocs].type = type;
+		relocs[numRelocs].addend = addend;
+	}
+	++numRelocs;
+}
 
-out:
-	if(fd != -1)
-		close(fd);
+/*
+=================
+register allocating code generator
+
+When vm_optimize is set the top of the opStack is kept in a small
+virtual stack of constants, local addresses and registers. Items are
+only written to the opStack in memory before jump targets, calls, jumps
+and the instructions that still use the plain templates above. rsi
+always points to the top of the part of the opStack that lives in
+memory, the virtual items sit on top of it.
+
+  ebx, r9d, r11d - r14d  general purpose pool
+  xmm1 - xmm7            float pool
+  eax, ecx, edx, xmm0    scratch within a single instruction
+=================
+*/
+
+typedef enum
+{
+	VI_CONST,	// constant value
+	VI_LOCAL,	// programStack + value
+	VI_REG,		// general purpose register from the pool
+	VI_XMM		// sse register from the pool
+} vitemtype_t;
+
+typedef struct
+{
+	vitemtype_t	type;
+	int		value;
+} vitem_t;
+
+#define MAX_VSTACK 32
+
+static const reg_t gpreg32[] = { R_EBX, R_R9D, R_R11D, R_R12D, R_R13D, R_R14D };
+static const reg_t gpreg64[] = { R_RBX, R_R9, R_R11, R_R12, R_R13, R_R14 };
+#define NUM_GPREGS (sizeof(gpreg32)/sizeof(gpreg32[0]))
+#define NUM_XMMREGS 7
+#define XMMREG(n) (R_XMM0 | ((n) + 1))
+
+static vitem_t vstack[MAX_VSTACK];
+static int vdepth;
+static unsigned gpused;
+static unsigned xmmused;
+static unsigned vdataMask;
 
-	return mem;
+static void vreset(unsigned dataMask)
+{
+	vdepth = 0;
+	gpused = 0;
+	xmmused = 0;
+	vdataMask = dataMask;
 }
 
-static int doas(char* in, char* out, unsigned char** compiledcode)
+static void vfree(vitem_t* vi)
 {
-	unsigned char* mem;
-	size_t size = -1;
-	pid_t pid;
+	if(vi->type == VI_REG)
+		gpused &= ~(1 << vi->value);
+	else if(vi->type == VI_XMM)
+		xmmused &= ~(1 << vi->value);
+}
 
-	Com_Printf("running assembler < %s > %s\n", in, out);
-	pid = fork();
-	if(pid == -1)
+// write a virtual item to ofs(%rsi)
+static void vstoreitem(vitem_t* vi, int ofs)
+{
+	switch(vi->type)
 	{
-		Com_Printf(S_COLOR_RED "can't fork\n");
-		return -1;
+		case VI_CONST:
+			emit(I_MOVL, IMM(vi->value), MEM(R_RSI, ofs));
+			break;
+		case VI_LOCAL:
+			emit(I_MOVL, REG(R_EDI), MEM(R_RSI, ofs));
+			if(vi->value)
+				emit(I_ADDL, IMM(vi->value), MEM(R_RSI, ofs));
+			break;
+		case VI_REG:
+			emit(I_MOVL, REG(gpreg32[vi->value]), MEM(R_RSI, ofs));
+			break;
+		case VI_XMM:
+			emit(I_MOVSS, REG(XMMREG(vi->value)), MEM(R_RSI, ofs));
+			break;
 	}
+	vfree(vi);
+}
+
+// move all virtual items to the opStack in memory
+static void vflush(void)
+{
+	int i;
 
-	if(!pid)
+	if(!vdepth)
+		return;
+
+	for(i = 0; i < vdepth; ++i)
+		vstoreitem(&vstack[i], 4 * (i + 1));
+
+	emit(I_ADDQ, IMM(4 * vdepth), REG(R_RSI));
+	vdepth = 0;
+}
+
+// move the bottom virtual item to memory to free a register
+static void vspill(void)
+{
+	if(!vdepth)
+		Com_Error(ERR_DROP, "VM_Compile: out of registers");
+
+	vstoreitem(&vstack[0], 4);
+	emit(I_ADDQ, IMM(4), REG(R_RSI));
+	memmove(vstack, vstack + 1, (--vdepth) * sizeof(vstack[0]));
+}
+
+static int vallocreg(void)
+{
+	unsigned i;
+
+	for(;;)
 	{
-		char* const argv[] = {
-			"as",
-			"-o",
-			out,
-			in,
-			NULL
-		};
-
-		execvp(argv[0], argv);
-		_exit(-1);
+		for(i = 0; i < NUM_GPREGS; ++i)
+		{
+			if(!(gpused & (1 << i)))
+			{
+				gpused |= 1 << i;
+				return i;
+			}
+		}
+		vspill();
 	}
-	else
+}
+
+static int vallocxmm(void)
+{
+	int i;
+
+	for(;;)
 	{
-		int status;
-		if(waitpid(pid, &status, 0) == -1)
+		for(i = 0; i < NUM_XMMREGS; ++i)
 		{
-			Com_Printf(S_COLOR_RED "can't wait for as: %s\n", strerror(errno));
-			return -1;
+			if(!(xmmused & (1 << i)))
+			{
+				xmmused |= 1 << i;
+				return i;
+			}
 		}
+		vspill();
+	}
+}
+
+static void vpush(vitemtype_t type, int value)
+{
+	if(vdepth == MAX_VSTACK)
+		vspill();
+
+	vstack[vdepth].type = type;
+	vstack[vdepth].value = value;
+	++vdepth;
+}
+
+// the caller owns the register of the returned item until it is freed or pushed again
+static vitem_t vpop(void)
+{
+	vitem_t vi;
+
+	if(vdepth)
+		return vstack[--vdepth];
+
+	vi.type = VI_REG;
+	vi.value = vallocreg();
+	emit(I_MOVL, MEM(R_RSI, 0), REG(gpreg32[vi.value]));
+	emit(I_SUBQ, IMM(4), REG(R_RSI));
+
+	return vi;
+}
+
+static void vtoreg(vitem_t* vi)
+{
+	int r;
+
+	if(vi->type == VI_REG)
+		return;
+
+	r = vallocreg();
+
+	switch(vi->type)
+	{
+		case VI_CONST:
+			if(vi->value)
+				emit(I_MOVL, IMM(vi->value), REG(gpreg32[r]));
+			else
+				emit(I_XORL, REG(gpreg32[r]), REG(gpreg32[r]));
+			break;
+		case VI_LOCAL:
+			emit(I_MOVL, REG(R_EDI), REG(gpreg32[r]));
+			if(vi->value)
+				emit(I_ADDL, IMM(vi->value), REG(gpreg32[r]));
+			break;
+		case VI_XMM:
+			emit(I_MOVD, REG(XMMREG(vi->value)), REG(gpreg32[r]));
+			vfree(vi);
+			break;
+		default:
+			break;
+	}
+
+	vi->type = VI_REG;
+	vi->value = r;
+}
+
+static void vtoxmm(vitem_t* vi)
+{
+	int x;
+
+	if(vi->type == VI_XMM)
+		return;
+
+	x = vallocxmm();
+
+	switch(vi->type)
+	{
+		case VI_CONST:
+		case VI_LOCAL:
+			if(vi->type == VI_CONST)
+				emit(I_MOVL, IMM(vi->value), REG(R_EAX));
+			else
+			{
+				emit(I_MOVL, REG(R_EDI), REG(R_EAX));
+				emit(I_ADDL, IMM(vi->value), REG(R_EAX));
+			}
+			emit(I_MOVD, REG(R_EAX), REG(XMMREG(x)));
+			break;
+		case VI_REG:
+			emit(I_MOVD, REG(gpreg32[vi->value]), REG(XMMREG(x)));
+			vfree(vi);
+			break;
+		default:
+			break;
+	}
+
+	vi->type = VI_XMM;
+	vi->value = x;
+}
+
+// operand for the right hand side of an integer instruction
+static arg_t vsrc(vitem_t* vi)
+{
+	if(vi->type == VI_CONST)
+		return IMM(vi->value);
+
+	vtoreg(vi);
+	return REG(gpreg32[vi->value]);
+}
+
+/* Memory operand for an address in the data segment. The address is
+ * masked like in the interpreter. Registers of the item are released
+ * but stay valid for the following instruction */
+static arg_t vaddr(vitem_t* vi)
+{
+	switch(vi->type)
+	{
+		case VI_CONST:
+			return MEM(R_R8, vi->value & vdataMask);
+		case VI_LOCAL:
+			emit(I_MOVL, REG(R_EDI), REG(R_ECX));
+			if(vi->value)
+				emit(I_ADDL, IMM(vi->value), REG(R_ECX));
+			emit(I_ANDL, IMM(vdataMask), REG(R_ECX));
+			return MEMX(R_R8, R_RCX, 1, 0);
+		case VI_XMM:
+			vtoreg(vi);
+			/* fall through */
+		default:
+			emit(I_ANDL, IMM(vdataMask), REG(gpreg32[vi->value]));
+			vfree(vi);
+			return MEMX(R_R8, gpreg64[vi->value], 1, 0);
+	}
+}
+
+// number of opStack items an instruction consumes and produces
+static int oppops(int op)
+{
+	switch(op)
+	{
+		case OP_CONST: case OP_LOCAL: case OP_PUSH:
+			return 0;
+		case OP_EQ: case OP_NE: case OP_LTI: case OP_LEI: case OP_GTI:
+		case OP_GEI: case OP_LTU: case OP_LEU: case OP_GTU: case OP_GEU:
+		case OP_EQF: case OP_NEF: case OP_LTF: case OP_LEF: case OP_GTF:
+		case OP_GEF: case OP_STORE1: case OP_STORE2: case OP_STORE4:
+		case OP_BLOCK_COPY: case OP_ADD: case OP_SUB: case OP_DIVI:
+		case OP_DIVU: case OP_MODI: case OP_MODU: case OP_MULI: case OP_MULU:
+		case OP_BAND: case OP_BOR: case OP_BXOR: case OP_LSH: case OP_RSHI:
+		case OP_RSHU: case OP_ADDF: case OP_SUBF: case OP_DIVF: case OP_MULF:
+			return 2;
+		default:
+			return 1;
+	}
+}
 
-		if(!WIFEXITED(status))
+static int oppushes(int op)
+{
+	switch(op)
+	{
+		case OP_CONST: case OP_LOCAL: case OP_PUSH: case OP_LOAD1:
+		case OP_LOAD2: case OP_LOAD4: case OP_SEX8: case OP_SEX16:
+		case OP_NEGI: case OP_ADD: case OP_SUB: case OP_DIVI: case OP_DIVU:
+		case OP_MODI: case OP_MODU: case OP_MULI: case OP_MULU: case OP_BAND:
+		case OP_BOR: case OP_BXOR: case OP_BCOM: case OP_LSH: case OP_RSHI:
+		case OP_RSHU: case OP_NEGF: case OP_ADDF: case OP_SUBF: case OP_DIVF:
+		case OP_MULF: case OP_CVIF: case OP_CVFI:
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+/* Follow the value produced by instruction i through its basic block and
+ * check whether it ends up in a float operation */
+static qboolean vfloatconsumer(const byte* ops, const byte* jused, int i, int count)
+{
+	int depth = 0;
+	int j;
+
+	for(j = i + 1; j < count && j < i + 32 && !jused[j]; ++j)
+	{
+		int pops = oppops(ops[j]);
+
+		if(ops[j] == OP_ENTER || ops[j] == OP_LEAVE)
+			break;
+
+		if(pops > depth)
 		{
-			Com_Printf(S_COLOR_RED "as died\n");
-			return -1;
+			switch(ops[j])
+			{
+				case OP_EQF: case OP_NEF: case OP_LTF: case OP_LEF:
+				case OP_GTF: case OP_GEF: case OP_NEGF: case OP_ADDF:
+				case OP_SUBF: case OP_DIVF: case OP_MULF: case OP_CVFI:
+					return qtrue;
+				default:
+					return qfalse;
+			}
 		}
-		if(WEXITSTATUS(status))
+
+		depth += oppushes(ops[j]) - pops;
+	}
+
+	return qfalse;
+}
+
+/* Find all instructions that can be entered other than by falling through.
+ * Returns qfalse if the program uses jumps the analysis can't follow */
+static qboolean VM_FindJumpTargets(vm_t* vm, const byte* ops, const int* args, byte* jused, int count)
+{
+	int i, v;
+
+	for(i = 0; i < vm->numJumpTableTargets; i++)
+	{
+		v = *(int *)(vm->jumpTableTargets + i * sizeof(int));
+		if(v < 0 || v >= count)
+			return qfalse;
+		jused[v] = 1;
+	}
+
+	for(i = 0; i < count; ++i)
+	{
+		switch(ops[i])
 		{
-			Com_Printf(S_COLOR_RED "as failed with status %d\n", WEXITSTATUS(status));
-			return -1;
+			case OP_ENTER:
+				jused[i] = 1;
+				break;
+			case OP_JUMP:
+				if(!i || ops[i-1] != OP_CONST)
+				{
+					if(!vm->numJumpTableTargets)
+						return qfalse;
+					break;
+				}
+				/* fall through */
+			case OP_CALL:
+				if(!i || ops[i-1] != OP_CONST)
+					break;
+				v = args[i-1];
+				if(ops[i] == OP_CALL && v < 0)
+					break;
+				if(v < 0 || v >= count)
+					return qfalse;
+				jused[v] = 1;
+				break;
+			case OP_EQ: case OP_NE: case OP_LTI: case OP_LEI: case OP_GTI:
+			case OP_GEI: case OP_LTU: case OP_LEU: case OP_GTU: case OP_GEU:
+			case OP_EQF: case OP_NEF: case OP_LTF: case OP_LEF: case OP_GTF:
+			case OP_GEF:
+				v = args[i];
+				if(v < 0 || v >= count)
+					return qfalse;
+				jused[v] = 1;
+				break;
 		}
 	}
 
-	Com_Printf("done\n");
+	return qtrue;
+}
+
+
+// save the registers of the generated code and align the stack for a C call
+static void vsavestate(void)
+{
+	emit(I_PUSH, REG(R_RSI), NONE);
+	emit(I_PUSH, REG(R_RDI), NONE);
+	emit(I_PUSH, REG(R_R8), NONE);
+	emit(I_PUSH, REG(R_R9), NONE);
+	emit(I_PUSH, REG(R_R10), NONE);
+	emit(I_MOVQ, REG(R_RSP), REG(R_RBX)); // we need to align the stack pointer
+	emit(I_SUBQ, IMM(8), REG(R_RBX));     //   |
+	emit(I_ANDQ, IMM(127), REG(R_RBX));   //   |
+	emit(I_SUBQ, REG(R_RBX), REG(R_RSP)); // <-+
+	emit(I_PUSH, REG(R_RBX), NONE);
+}
+
+static void vrestorestate(void)
+{
+	emit(I_POP, REG(R_RBX), NONE);
+	emit(I_ADDQ, REG(R_RBX), REG(R_RSP));
+	emit(I_POP, REG(R_R10), NONE);
+	emit(I_POP, REG(R_R9), NONE);
+	emit(I_POP, REG(R_R8), NONE);
+	emit(I_POP, REG(R_RDI), NONE);
+	emit(I_POP, REG(R_RSI), NONE);
+}
+
+// args[n] of a system call, OP_CALL left programStack in rdi
+#define VMARG(n) MEMX(R_R8, R_RDI, 1, 4 + 4 * (n))
+
+static int VM_NumFastSyscalls(vm_t* vm)
+{
+	int i = 0;
 
-	mem = (unsigned char*)mmapfile(out, &size);
-	if(!mem)
+	if(vm->fastSyscalls)
 	{
-		Com_Printf(S_COLOR_RED "can't mmap object file %s: %s\n", out, strerror(errno));
+		while(vm->fastSyscalls[i].type != VMSC_NONE)
+			++i;
+	}
+
+	return i;
+}
+
+static int VM_FindFastSyscall(vm_t* vm, int num)
+{
+	int i;
+
+	if(!vm->fastSyscalls)
 		return -1;
+
+	for(i = 0; vm->fastSyscalls[i].type != VMSC_NONE; ++i)
+	{
+		if(vm->fastSyscalls[i].num == num)
+			return i;
 	}
 
-	*compiledcode = mem;
+	return -1;
+}
+
+/* System calls from vm->fastSyscalls. sqrt is inlined, the others
+ * call the native function directly instead of going through
+ * callAsmCall and the system call dispatcher */
+static void vfastsyscall(vm_t* vm, int index)
+{
+	int r;
 
-	return size;
+	switch(vm->fastSyscalls[index].type)
+	{
+		/* rep stosb and movsb start too slowly for the small
+		 * sizes qvms use, the libc functions are faster */
+		case VMSC_MEMSET:
+		case VMSC_MEMCPY:
+			vsavestate();
+			emit(I_MOVL, VMARG(3), REG(R_EDX));
+			emit(I_MOVL, VMARG(2), REG(R_ESI));
+			if(vm->fastSyscalls[index].type == VMSC_MEMCPY)
+			{
+				emit(I_ANDL, IMM(vdataMask), REG(R_ESI));
+				emit(I_ADDQ, REG(R_R8), REG(R_RSI));
+			}
+			emit(I_MOVL, VMARG(1), REG(R_EDI));
+			emit(I_ANDL, IMM(vdataMask), REG(R_EDI));
+			emit(I_ADDQ, REG(R_R8), REG(R_RDI));
+			emit_reloc(vm, VMRELOC_MEMSET + vm->fastSyscalls[index].type - VMSC_MEMSET, 0, R_RAX);
+			emit(I_CALLQ, REG(R_RAX), NONE);
+			vrestorestate();
+			vpush(VI_CONST, 0);
+			break;
+
+		case VMSC_SQRT:
+			r = vallocxmm();
+			emit(I_SQRTSS, VMARG(1), REG(XMMREG(r)));
+			vpush(VI_XMM, r);
+			break;
+
+		case VMSC_FLOOR:
+		case VMSC_SIN:
+		case VMSC_COS:
+		case VMSC_ATAN2:
+			emit(I_MOVSS, VMARG(1), REG(R_XMM0));
+			if(vm->fastSyscalls[index].type == VMSC_ATAN2)
+				emit(I_MOVSS, VMARG(2), REG(R_XMM1));
+			vsavestate();
+			emit_reloc(vm, VMRELOC_FLOOR + vm->fastSyscalls[index].type - VMSC_FLOOR, 0, R_RAX);
+			emit(I_CALLQ, REG(R_RAX), NONE);
+			vrestorestate();
+			r = vallocxmm();
+			emit(I_MOVSS, REG(R_XMM0), REG(XMMREG(r)));
+			vpush(VI_XMM, r);
+			break;
+
+		default:
+			vsavestate();
+			// what callAsmCall does, the profiler and recursive vm
+			// entries read the stack of the calling vm from there
+			emit_reloc(vm, VMRELOC_PROGRAMSTACK, 0, R_RAX);
+			emit(I_MOVL, REG(R_EDI), REG(R_EDX));
+			emit(I_SUBL, IMM(4), REG(R_EDX));
+			emit(I_MOVL, REG(R_EDX), MEM(R_RAX, 0));
+			emit(I_ADDQ, REG(R_R8), REG(R_RDI));  // pointer to args[0] in rdi
+			emit(I_ADDQ, IMM(4), REG(R_RDI));
+			emit_reloc(vm, VMRELOC_DIRECT, index, R_RAX);
+			emit(I_CALLQ, REG(R_RAX), NONE);
+			vrestorestate();
+			r = vallocreg();
+			emit(I_MOVL, REG(R_EAX), REG(gpreg32[r]));
+			vpush(VI_REG, r);
+			break;
+	}
 }
-#endif // USE_GAS
 
-static void block_copy_vm(unsigned dest, unsigned src, unsigned count)
+static void vsyscall(vm_t* vm, int num)
 {
-	unsigned dataMask = currentVM->dataMask;
+	int r;
 
-	if ((dest & dataMask) != dest
-	|| (src & dataMask) != src
-	|| ((dest+count) & dataMask) != dest + count
-	|| ((src+count) & dataMask) != src + count)
+	r = VM_FindFastSyscall(vm, -num - 1);
+	if(r >= 0)
 	{
-		Com_Error(ERR_DROP, "OP_BLOCK_COPY out of range!\n");
+		vfastsyscall(vm, r);
+		return;
 	}
 
-	memcpy(currentVM->dataBase+dest, currentVM->dataBase+src, count);
+	vsavestate();
+	                                      // first argument already in rdi
+	emit(I_MOVQ, IMM(-num - 1), REG(R_RSI)); // second argument in rsi
+	emit_reloc(vm, VMRELOC_SYSCALL, 0, R_RAX);
+	emit(I_CALLQ, REG(R_RAX), NONE);
+	vrestorestate();
+
+	r = vallocreg();
+	emit(I_MOVL, REG(R_EAX), REG(gpreg32[r]));
+	vpush(VI_REG, r);
+}
+
+/* Translate a single instruction with the register allocator. Returns
+ * qfalse if the instruction has to be emitted by the plain templates, the
+ * virtual stack is flushed in that case */
+static qboolean VM_CompileOptimized(vm_t* vm, int instruction, const byte* ops, const int* args, const byte* jused, int count)
+{
+	int op = ops[instruction];
+	int iarg = args[instruction];
+	vitem_t a, b;
+	arg_t addr;
+	asmop_t aop = I_NOP;
+	int r;
+
+	switch(op)
+	{
+		case OP_IGNORE:
+			break;
+		case OP_CONST:
+			vpush(VI_CONST, iarg);
+			break;
+		case OP_LOCAL:
+			vpush(VI_LOCAL, iarg);
+			break;
+		case OP_PUSH:
+			vpush(VI_CONST, 0);
+			break;
+		case OP_POP:
+			if(vdepth)
+			{
+				a = vpop();
+				vfree(&a);
+			}
+			else
+				emit(I_SUBQ, IMM(4), REG(R_RSI));
+			break;
+		case OP_JUMP:
+			if(!vdepth || vstack[vdepth-1].type != VI_CONST)
+				goto fallback;
+			a = vpop();
+			vflush();
+			emit(I_JMP, LABEL(LABEL_INSTR(a.value)), NONE);
+			break;
+		case OP_CALL:
+			if(!vdepth || vstack[vdepth-1].type != VI_CONST)
+				goto fallback;
+			a = vpop();
+			vflush();
+			emit(I_MOVL, IMM(instruction+1), MEMX(R_R8, R_RDI, 1, 0));  // save next instruction
+			if(a.value < 0)
+				vsyscall(vm, a.value);
+			else
+				emit(I_CALLQ, LABEL(LABEL_INSTR(a.value)), NONE); // the result is left in memory
+			break;
+
+		case OP_LOAD1:
+		case OP_LOAD2:
+		case OP_LOAD4:
+			a = vpop();
+			addr = vaddr(&a);
+			if(op == OP_LOAD4 && vfloatconsumer(ops, jused, instruction, count))
+			{
+				r = vallocxmm();
+				emit(I_MOVSS, addr, REG(XMMREG(r)));
+				vpush(VI_XMM, r);
+				break;
+			}
+			r = vallocreg();
+			if(op == OP_LOAD1)
+				emit(I_MOVZBL, addr, REG(gpreg32[r]));
+			else if(op == OP_LOAD2)
+				emit(I_MOVZWL, addr, REG(gpreg32[r]));
+			else
+				emit(I_MOVL, addr, REG(gpreg32[r]));
+			vpush(VI_REG, r);
+			break;
+		case OP_STORE4:
+		case OP_ARG:
+			b = vpop();
+			if(op == OP_ARG)
+			{
+				a.type = VI_LOCAL;
+				a.value = iarg;
+			}
+			else
+				a = vpop();
+			if(b.type == VI_LOCAL)
+				vtoreg(&b);
+			addr = vaddr(&a);
+			if(b.type == VI_CONST)
+				emit(I_MOVL, IMM(b.value), addr);
+			else if(b.type == VI_XMM)
+				emit(I_MOVSS, REG(XMMREG(b.value)), addr);
+			else
+				emit(I_MOVL, REG(gpreg32[b.value]), addr);
+			vfree(&b);
+			break;
+		case OP_STORE1:
+		case OP_STORE2:
+			b = vpop();
+			a = vpop();
+			switch(b.type)
+			{
+				case VI_CONST:
+					emit(I_MOVL, IMM(b.value), REG(R_EAX));
+					break;
+				case VI_LOCAL:
+					emit(I_MOVL, REG(R_EDI), REG(R_EAX));
+					emit(I_ADDL, IMM(b.value), REG(R_EAX));
+					break;
+				case VI_REG:
+					emit(I_MOVL, REG(gpreg32[b.value]), REG(R_EAX));
+					break;
+				case VI_XMM:
+					emit(I_MOVD, REG(XMMREG(b.value)), REG(R_EAX));
+					break;
+			}
+			vfree(&b);
+			addr = vaddr(&a);
+			if(op == OP_STORE1)
+				emit(I_MOVB, REG(R_AL), addr);
+			else
+				emit(I_MOVW, REG(R_AX), addr);
+			break;
+
+		case OP_SEX8:
+		case OP_SEX16:
+			a = vpop();
+			r = (op == OP_SEX8) ? 24 : 16;
+			if(a.type == VI_CONST)
+			{
+				vpush(VI_CONST, (op == OP_SEX8) ? (signed char)a.value : (short)a.value);
+				break;
+			}
+			vtoreg(&a);
+			emit(I_SHLL, IMM(r), REG(gpreg32[a.value]));
+			emit(I_SARL, IMM(r), REG(gpreg32[a.value]));
+			vpush(VI_REG, a.value);
+			break;
+		case OP_NEGI:
+		case OP_BCOM:
+			a = vpop();
+			if(a.type == VI_CONST)
+			{
+				vpush(VI_CONST, op == OP_NEGI ? -a.value : ~a.value);
+				break;
+			}
+			vtoreg(&a);
+			emit(op == OP_NEGI ? I_NEGL : I_NOTL, REG(gpreg32[a.value]), NONE);
+			vpush(VI_REG, a.value);
+			break;
+		case OP_NEGF:
+			a = vpop();
+			if(a.type == VI_CONST)
+			{
+				vpush(VI_CONST, a.value ^ 0x80000000);
+				break;
+			}
+			vtoreg(&a);
+			emit(I_XORL, IMM((int)0x80000000), REG(gpreg32[a.value]));
+			vpush(VI_REG, a.value);
+			break;
+
+		case OP_ADD:
+		case OP_SUB:
+		case OP_BAND:
+		case OP_BOR:
+		case OP_BXOR:
+			b = vpop();
+			a = vpop();
+			if(a.type == VI_CONST && b.type == VI_CONST)
+			{
+				switch(op)
+				{
+					case OP_ADD:  r = a.value + b.value; break;
+					case OP_SUB:  r = a.value - b.value; break;
+					case OP_BAND: r = a.value & b.value; break;
+					case OP_BOR:  r = a.value | b.value; break;
+					default:      r = a.value ^ b.value; break;
+				}
+				vpush(VI_CONST, r);
+				break;
+			}
+			if(op == OP_ADD && a.type == VI_LOCAL && b.type == VI_CONST)
+			{
+				vpush(VI_LOCAL, a.value + b.value);
+				break;
+			}
+			if(op == OP_ADD && a.type == VI_CONST && b.type == VI_LOCAL)
+			{
+				vpush(VI_LOCAL, a.value + b.value);
+				break;
+			}
+			if(op == OP_SUB && a.type == VI_LOCAL && b.type == VI_CONST)
+			{
+				vpush(VI_LOCAL, a.value - b.value);
+				break;
+			}
+			vtoreg(&a);
+			switch(op)
+			{
+				case OP_ADD:  aop = I_ADDL; break;
+				case OP_SUB:  aop = I_SUBL; break;
+				case OP_BAND: aop = I_ANDL; break;
+				case OP_BOR:  aop = I_ORL; break;
+				default:      aop = I_XORL; break;
+			}
+			emit(aop, vsrc(&b), REG(gpreg32[a.value]));
+			vfree(&b);
+			vpush(VI_REG, a.value);
+			break;
+		case OP_MULI:
+		case OP_MULU:
+		case OP_DIVI:
+		case OP_DIVU:
+		case OP_MODI:
+		case OP_MODU:
+			b = vpop();
+			a = vpop();
+			if(a.type == VI_CONST && b.type == VI_CONST && (op == OP_MULI || op == OP_MULU))
+			{
+				vpush(VI_CONST, a.value * b.value);
+				break;
+			}
+			vtoreg(&a);
+			vtoreg(&b);
+			emit(I_MOVL, REG(gpreg32[a.value]), REG(R_EAX));
+			switch(op)
+			{
+				case OP_MULI:
+					emit(I_IMULL, REG(gpreg32[b.value]), NONE);
+					break;
+				case OP_MULU:
+					emit(I_MULL, REG(gpreg32[b.value]), NONE);
+					break;
+				case OP_DIVI:
+				case OP_MODI:
+					emit(I_CDQ, NONE, NONE);
+					emit(I_IDIVL, REG(gpreg32[b.value]), NONE);
+					break;
+				default:
+					emit(I_XORL, REG(R_EDX), REG(R_EDX));
+					emit(I_DIVL, REG(gpreg32[b.value]), NONE);
+					break;
+			}
+			if(op == OP_MODI || op == OP_MODU)
+				emit(I_MOVL, REG(R_EDX), REG(gpreg32[a.value]));
+			else
+				emit(I_MOVL, REG(R_EAX), REG(gpreg32[a.value]));
+			vfree(&b);
+			vpush(VI_REG, a.value);
+			break;
+		case OP_LSH:
+		case OP_RSHI:
+		case OP_RSHU:
+			b = vpop();
+			a = vpop();
+			aop = (op == OP_LSH) ? I_SHLL : (op == OP_RSHI) ? I_SARL : I_SHRL;
+			if(b.type == VI_CONST)
+			{
+				if(a.type == VI_CONST)
+				{
+					if(op == OP_LSH)
+						r = a.value << (b.value & 31);
+					else if(op == OP_RSHI)
+						r = a.value >> (b.value & 31);
+					else
+						r = (unsigned)a.value >> (b.value & 31);
+					vpush(VI_CONST, r);
+					break;
+				}
+				vtoreg(&a);
+				emit(aop, IMM(b.value & 31), REG(gpreg32[a.value]));
+				vpush(VI_REG, a.value);
+				break;
+			}
+			vtoreg(&a);
+			vtoreg(&b);
+			emit(I_MOVL, REG(gpreg32[b.value]), REG(R_ECX));
+			emit(aop, REG(R_CL), REG(gpreg32[a.value]));
+			vfree(&b);
+			vpush(VI_REG, a.value);
+			break;
+
+		case OP_ADDF:
+		case OP_SUBF:
+		case OP_DIVF:
+		case OP_MULF:
+			b = vpop();
+			a = vpop();
+			vtoxmm(&a);
+			vtoxmm(&b);
+			switch(op)
+			{
+				case OP_ADDF: aop = I_ADDSS; break;
+				case OP_SUBF: aop = I_SUBSS; break;
+				case OP_DIVF: aop = I_DIVSS; break;
+				default:      aop = I_MULSS; break;
+			}
+			emit(aop, REG(XMMREG(b.value)), REG(XMMREG(a.value)));
+			vfree(&b);
+			vpush(VI_XMM, a.value);
+			break;
+		case OP_CVIF:
+			a = vpop();
+			if(a.type == VI_CONST)
+			{
+				floatint_t fi;
+				fi.f = a.value;
+				vpush(VI_CONST, fi.i);
+				break;
+			}
+			vtoreg(&a);
+			r = vallocxmm();
+			emit(I_CVTSI2SS, REG(gpreg32[a.value]), REG(XMMREG(r)));
+			vfree(&a);
+			vpush(VI_XMM, r);
+			break;
+		case OP_CVFI:
+			a = vpop();
+			vtoxmm(&a);
+			r = vallocreg();
+			emit(I_CVTTSS2SI, REG(XMMREG(a.value)), REG(gpreg32[r]));
+			vfree(&a);
+			vpush(VI_REG, r);
+			break;
+
+		case OP_EQ:   aop = I_JE;   goto intcompare;
+		case OP_NE:   aop = I_JNE;  goto intcompare;
+		case OP_LTI:  aop = I_JL;   goto intcompare;
+		case OP_LEI:  aop = I_JNG;  goto intcompare;
+		case OP_GTI:  aop = I_JNLE; goto intcompare;
+		case OP_GEI:  aop = I_JNL;  goto intcompare;
+		case OP_LTU:  aop = I_JB;   goto intcompare;
+		case OP_LEU:  aop = I_JBE;  goto intcompare;
+		case OP_GTU:  aop = I_JA;   goto intcompare;
+		case OP_GEU:  aop = I_JNB;
+intcompare:
+			b = vpop();
+			a = vpop();
+			if(a.type == VI_CONST && b.type == VI_CONST)
+			{
+				qboolean taken;
+				switch(op)
+				{
+					case OP_EQ:  taken = a.value == b.value; break;
+					case OP_NE:  taken = a.value != b.value; break;
+					case OP_LTI: taken = a.value < b.value; break;
+					case OP_LEI: taken = a.value <= b.value; break;
+					case OP_GTI: taken = a.value > b.value; break;
+					case OP_GEI: taken = a.value >= b.value; break;
+					case OP_LTU: taken = (unsigned)a.value < (unsigned)b.value; break;
+					case OP_LEU: taken = (unsigned)a.value <= (unsigned)b.value; break;
+					case OP_GTU: taken = (unsigned)a.value > (unsigned)b.value; break;
+					default:     taken = (unsigned)a.value >= (unsigned)b.value; break;
+				}
+				vflush();
+				if(taken)
+					emit(I_JMP, LABEL(LABEL_INSTR(iarg)), NONE);
+				break;
+			}
+			vtoreg(&a);
+			if(b.type != VI_CONST)
+				vtoreg(&b);
+			vfree(&a);
+			vfree(&b);
+			vflush();
+			emit(I_CMPL, vsrc(&b), REG(gpreg32[a.value]));
+			emit(aop, LABEL(LABEL_INSTR(iarg)), NONE);
+			break;
+		case OP_EQF:
+		case OP_NEF:
+		case OP_LTF:
+		case OP_LEF:
+		case OP_GTF:
+		case OP_GEF:
+			b = vpop();
+			a = vpop();
+			vtoxmm(&a);
+			vtoxmm(&b);
+			vfree(&a);
+			vfree(&b);
+			vflush();
+			switch(op)
+			{
+				case OP_EQF:
+					emit(I_UCOMISS, REG(XMMREG(b.value)), REG(XMMREG(a.value)));
+					emit(I_JP, LABEL(LABEL_LOCAL(instruction)), NONE);
+					emit(I_JE, LABEL(LABEL_INSTR(iarg)), NONE);
+					emit_label(LABEL_LOCAL(instruction));
+					break;
+				case OP_NEF:
+					emit(I_UCOMISS, REG(XMMREG(b.value)), REG(XMMREG(a.value)));
+					emit(I_JP, LABEL(LABEL_INSTR(iarg)), NONE);
+					emit(I_JNE, LABEL(LABEL_INSTR(iarg)), NONE);
+					break;
+				case OP_LTF:
+					emit(I_UCOMISS, REG(XMMREG(a.value)), REG(XMMREG(b.value)));
+					emit(I_JA, LABEL(LABEL_INSTR(iarg)), NONE);
+					break;
+				case OP_LEF:
+					emit(I_UCOMISS, REG(XMMREG(a.value)), REG(XMMREG(b.value)));
+					emit(I_JNB, LABEL(LABEL_INSTR(iarg)), NONE);
+					break;
+				case OP_GTF:
+					emit(I_UCOMISS, REG(XMMREG(b.value)), REG(XMMREG(a.value)));
+					emit(I_JA, LABEL(LABEL_INSTR(iarg)), NONE);
+					break;
+				default:
+					emit(I_UCOMISS, REG(XMMREG(b.value)), REG(XMMREG(a.value)));
+					emit(I_JNB, LABEL(LABEL_INSTR(iarg)), NONE);
+					break;
+			}
+			break;
+
+		default:
+fallback:
+			vflush();
+			return qfalse;
+	}
+
+	return qtrue;
 }
 
 /*
 =================
-VM_Compile
+native code cache
+
+Compiled code is stored in vm/<name>.x86_64.vmc below the home
+directory, keyed by the checksum of the qvm file, the engine build and
+the compiler settings. Layout:
+
+  vmcache_t header
+  instructionPointers[instructionCount]
+  vmreloc_t[numRelocs]
+  code, starting at a page aligned offset so it can be mapped directly
 =================
 */
-void VM_Compile( vm_t *vm, vmHeader_t *header ) {
-	unsigned char op;
-	int pc;
-	unsigned instruction;
-	char* code;
-	unsigned iarg = 0;
-	unsigned char barg = 0;
-	int neednilabel = 0;
-	struct timeval tvstart =  {0, 0};
-
-#ifdef USE_GAS
-	byte* compiledcode;
-	int   compiledsize;
-	void* entryPoint;
-	char fn_s[2*MAX_QPATH]; // output file for assembler code
-	char fn_o[2*MAX_QPATH]; // file written by as
-#ifdef DEBUG_VM
-	char fn_d[MAX_QPATH]; // disassembled
-#endif
-	FILE* fh_s;
-	int fd_s, fd_o;
 
-	gettimeofday(&tvstart, NULL);
+#define VMCACHE_MAGIC	(('C'<<24)+('M'<<16)+('V'<<8)+'Q')
+#define VMCACHE_VERSION	4
+#define VMCACHE_BUILD	Q3_VERSION " " PLATFORM_STRING " " __DATE__ " " __TIME__
 
-	Com_Printf("compiling %s\n", vm->name);
+typedef struct
+{
+	int		magic;
+	int		version;
+	char		build[64];
+	unsigned	checksum;		// of the qvm file
+	int		optimize;		// vm_optimize used for the code
+	unsigned	syscalls;		// VM_FastSyscallKey
+	unsigned	dataMask;
+	int		instructionCount;
+	int		codeLength;
+	int		numRelocs;
+	int		codeOffset;		// file offset of the code
+} vmcache_t;
+
+// the code depends on which system calls were handled by vfastsyscall
+static unsigned VM_FastSyscallKey(vm_t* vm)
+{
+	unsigned key = 0;
+	int i;
 
-#ifdef DEBUG_VM
-	snprintf(fn_s, sizeof(fn_s), "%.63s.s", vm->name);
-	snprintf(fn_o, sizeof(fn_o), "%.63s.o", vm->name);
-	fd_s = open(fn_s, O_CREAT|O_WRONLY|O_TRUNC, 0644);
-	fd_o = open(fn_o, O_CREAT|O_WRONLY|O_TRUNC, 0644);
-#else
-	snprintf(fn_s, sizeof(fn_s), "/tmp/%.63s.s_XXXXXX", vm->name);
-	snprintf(fn_o, sizeof(fn_o), "/tmp/%.63s.o_XXXXXX", vm->name);
-	fd_s = mkstemp(fn_s);
-	fd_o = mkstemp(fn_o);
-#endif
-	if(fd_s == -1 || fd_o == -1)
+	for(i = 0; i < VM_NumFastSyscalls(vm); ++i)
+		key = key * 31 + vm->fastSyscalls[i].num * 16 + vm->fastSyscalls[i].type;
+
+	return key;
+}
+
+static void VM_CacheFileName(vm_t* vm, char* filename, int size)
+{
+	Com_sprintf(filename, size, "vm/%s.x86_64." VM_CACHE_EXT, vm->name);
+}
+
+/*
+=================
+VM_LoadCompiledCache
+
+Maps the cached code of a qvm and patches its relocations. Returns
+qfalse if there is no usable cache file, the caller compiles then.
+=================
+*/
+static qboolean VM_LoadCompiledCache(vm_t* vm, vmHeader_t* header, int optimize)
+{
+	char filename[MAX_QPATH];
+	char* ospath;
+	vmcache_t cache;
+	vmreloc_t* rel = NULL;
+	struct stat st;
+	byte* code;
+	int fd;
+	int i;
+
+	VM_CacheFileName(vm, filename, sizeof(filename));
+	ospath = FS_BuildOSPath(Cvar_VariableString("fs_homepath"), "", filename);
+
+	fd = open(ospath, O_RDONLY);
+	if(fd == -1)
+		return qfalse;
+
+	if(read(fd, &cache, sizeof(cache)) != sizeof(cache)
+	|| fstat(fd, &st) == -1
+	|| cache.magic != VMCACHE_MAGIC
+	|| cache.version != VMCACHE_VERSION
+	|| strncmp(cache.build, VMCACHE_BUILD, sizeof(cache.build))
+	|| cache.checksum != vm->checksum
+	|| cache.optimize != optimize
+	|| cache.syscalls != VM_FastSyscallKey(vm)
+	|| cache.dataMask != vm->dataMask
+	|| cache.instructionCount != header->instructionCount
+	|| cache.codeLength <= 0
+	|| cache.numRelocs < 0
+	|| cache.codeOffset <= 0
+	|| cache.codeOffset % getpagesize()
+	|| cache.codeOffset < sizeof(cache) + cache.instructionCount * 4 + cache.numRelocs * sizeof(vmreloc_t)
+	|| st.st_size < (off_t)cache.codeOffset + cache.codeLength)
 	{
-		if(fd_s != -1) close(fd_s);
-		if(fd_o != -1) close(fd_o);
-		unlink(fn_s);
-		unlink(fn_o);
+		Com_Printf("%s: native code cache is out of date\n", vm->name);
+		close(fd);
+		return qfalse;
+	}
 
-		Com_Printf(S_COLOR_RED "can't create temporary file %s for vm\n", fn_s);
-		vm->compiled = qfalse;
-		return;
+	if(read(fd, vm->instructionPointers, cache.instructionCount * 4) != cache.instructionCount * 4)
+		goto fail;
+
+	for(i = 0; i < cache.instructionCount; ++i)
+	{
+		if(vm->instructionPointers[i] < 0 || vm->instructionPointers[i] >= cache.codeLength)
+			goto fail;
 	}
 
-#ifdef DEBUG_VM
-	strcpy(fn_d,vm->name);
-	strcat(fn_d, ".qdasm");
+	if(cache.numRelocs)
+	{
+		rel = Z_Malloc(cache.numRelocs * sizeof(vmreloc_t));
+		if(read(fd, rel, cache.numRelocs * sizeof(vmreloc_t)) != cache.numRelocs * sizeof(vmreloc_t))
+			goto fail;
+	}
 
-	qdasmout = fopen(fn_d, "w");
-#endif
+	code = mmap(NULL, cache.codeLength, PROT_READ|PROT_WRITE, MAP_PRIVATE, fd, cache.codeOffset);
+	if(code == (void*)-1)
+		goto fail;
+
+	vm->codeBase = code;
+	vm->codeLength = cache.codeLength;
 
-	fh_s = fdopen(fd_s, "wb");
-	if(!fh_s)
+	for(i = 0; i < cache.numRelocs; ++i)
 	{
-		Com_Printf(S_COLOR_RED "can't write %s\n", fn_s);
-		vm->compiled = qfalse;
+		if(rel[i].offset > cache.codeLength - 8
+		|| rel[i].type < VMRELOC_CODE || rel[i].type > VMRELOC_DIRECT
+		|| (rel[i].type == VMRELOC_DIRECT && (rel[i].addend < 0 || rel[i].addend >= VM_NumFastSyscalls(vm)
+			|| vm->fastSyscalls[rel[i].addend].type != VMSC_DIRECT)))
+		{
+			munmap(code, cache.codeLength);
+			goto fail;
+		}
+		*(unsigned long*)(code + rel[i].offset) = VM_RelocValue(vm, rel[i].type, rel[i].addend);
+	}
+
+	if(mprotect(code, cache.codeLength, PROT_READ|PROT_EXEC))
+		Com_Error(ERR_DROP, "VM_CompileX86: mprotect failed");
+
+	if(rel)
+		Z_Free(rel);
+	close(fd);
+
+	vm->destroy = VM_Destroy_Compiled;
+	vm->cacheState = VMCACHE_LOADED;
+
+	Com_Printf("VM file %s mapped from native code cache, %i bytes of code (%p - %p)\n",
+		vm->name, vm->codeLength, vm->codeBase, vm->codeBase+vm->codeLength);
+
+	return qtrue;
+
+fail:
+	Com_Printf("%s: native code cache is damaged\n", vm->name);
+	if(rel)
+		Z_Free(rel);
+	close(fd);
+	return qfalse;
+}
+
+/*
+=================
+VM_WriteCache
+=================
+*/
+static qboolean VM_WriteCache(int fd, const void* data, int length)
+{
+	const byte* p = data;
+	ssize_t len;
+
+	while(length > 0)
+	{
+		len = write(fd, p, length);
+		if(len <= 0)
+			return qfalse;
+		p += len;
+		length -= len;
+	}
+
+	return qtrue;
+}
+
+/*
+=================
+VM_StoreCompiledCache
+
+Written directly rather than through the file system, which refuses
+.vmc files so that no qvm can plant code for the next load
+=================
+*/
+static void VM_StoreCompiledCache(vm_t* vm, vmHeader_t* header, int optimize)
+{
+	char filename[MAX_QPATH];
+	char ospath[MAX_OSPATH];
+	char pad[1024];
+	vmcache_t cache;
+	qboolean ok;
+	int fd;
+	int pos;
+	int len;
+
+	VM_CacheFileName(vm, filename, sizeof(filename));
+	Q_strncpyz(ospath, FS_BuildOSPath(Cvar_VariableString("fs_homepath"), "", filename), sizeof(ospath));
+
+	Com_Memset(&cache, 0, sizeof(cache));
+	cache.magic = VMCACHE_MAGIC;
+	cache.version = VMCACHE_VERSION;
+	Q_strncpyz(cache.build, VMCACHE_BUILD, sizeof(cache.build));
+	cache.checksum = vm->checksum;
+	cache.optimize = optimize;
+	cache.syscalls = VM_FastSyscallKey(vm);
+	cache.dataMask = vm->dataMask;
+	cache.instructionCount = header->instructionCount;
+	cache.codeLength = vm->codeLength;
+	cache.numRelocs = numRelocs;
+
+	pos = sizeof(cache) + cache.instructionCount * 4 + cache.numRelocs * sizeof(vmreloc_t);
+	cache.codeOffset = (pos + getpagesize() - 1) & ~(getpagesize() - 1);
+
+	if(FS_CreatePath(ospath))
 		return;
+
+	fd = open(ospath, O_WRONLY|O_CREAT|O_TRUNC, 0600);
+	if(fd == -1)
+		return;
+
+	ok = VM_WriteCache(fd, &cache, sizeof(cache))
+		&& VM_WriteCache(fd, vm->instructionPointers, cache.instructionCount * 4)
+		&& VM_WriteCache(fd, relocs, cache.numRelocs * sizeof(vmreloc_t));
+
+	Com_Memset(pad, 0, sizeof(pad));
+	for(; ok && pos < cache.codeOffset; pos += len)
+	{
+		len = cache.codeOffset - pos;
+		if(len > sizeof(pad))
+			len = sizeof(pad);
+		ok = VM_WriteCache(fd, pad, len);
 	}
 
-	emit("start:");
-	emit("or %%r8, %%r8"); // check whether to set up instruction pointers
-	emit("jnz main");
-	emit("jmp setupinstructionpointers");
+	if(ok && VM_WriteCache(fd, vm->codeBase, vm->codeLength))
+		vm->cacheState = VMCACHE_STORED;
 
-	emit("main:");
-#else  // USE_GAS
+	close(fd);
+}
+
+/*
+=================
+VM_Compile
+=================
+*/
+void VM_Compile( vm_t *vm, vmHeader_t *header ) {
+	unsigned char op;
+	int pc;
+	unsigned instruction;
+	char* code;
+	int iarg = 0;
+	unsigned char barg = 0;
+	int neednilabel = 0;
 	int pass;
 	size_t compiledOfs = 0;
+	qboolean optimize;
+	byte* ops = NULL;
+	int* args = NULL;
+	byte* jused = NULL;
+	qboolean useCache;
+	int cacheKey;
+
+	optimize = Cvar_VariableIntegerValue("vm_optimize") ? qtrue : qfalse;
+	useCache = Cvar_VariableIntegerValue("vm_cache") ? qtrue : qfalse;
+
+	// the setting, not what VM_FindJumpTargets allows for this qvm
+	cacheKey = optimize;
+
+	if(useCache && VM_LoadCompiledCache(vm, header, cacheKey))
+		return;
+
+	if(optimize)
+	{
+		ops = Z_Malloc(header->instructionCount);
+		args = Z_Malloc(header->instructionCount * sizeof(int));
+		jused = Z_Malloc(header->instructionCount);
+
+		pc = 0;
+		code = (char *)header + header->codeOffset;
+		for ( instruction = 0; instruction < header->instructionCount; ++instruction )
+		{
+			op = code[ pc++ ];
+			ops[instruction] = op;
+			if(op_argsize[op] == 4)
+			{
+				args[instruction] = *(int*)(code+pc);
+				pc += 4;
+			}
+			else if(op_argsize[op] == 1)
+				args[instruction] = (byte)code[pc++];
+		}
 
-	gettimeofday(&tvstart, NULL);
+		if(!VM_FindJumpTargets(vm, ops, args, jused, header->instructionCount))
+		{
+			Com_Printf("%s uses jumps that can't be followed, not optimizing\n", vm->name);
+			optimize = qfalse;
+		}
+	}
+
+	relocs = NULL;
 
 	for (pass = 0; pass < 2; ++pass) {
 
@@ -539,11 +1661,17 @@ void VM_Compile( vm_t *vm, vmHeader_t *header ) {
 			Com_Error(ERR_DROP, "VM_CompileX86: can't mmap memory");
 
 		assembler_set_output((char*)vm->codeBase);
+
+		// the first pass counted them
+		if(numRelocs)
+			relocs = Z_Malloc(numRelocs * sizeof(vmreloc_t));
 	}
 
-	assembler_init(pass);
+	numRelocs = 0;
+
+	assembler_init(pass, LABEL_INSTR(header->instructionCount + 1));
 
-#endif // USE_GAS
+	vreset(vm->dataMask);
 
 	// translate all instructions
 	pc = 0;
@@ -554,42 +1682,40 @@ void VM_Compile( vm_t *vm, vmHeader_t *header ) {
 		op = code[ pc ];
 		++pc;
 
-#ifndef USE_GAS
+		// the opStack must be in memory wherever we can jump to
+		if(optimize && jused[instruction])
+			vflush();
+
 		vm->instructionPointers[instruction] = assembler_get_code_size();
-#endif
 
 		/* store current instruction number in r15 for debugging */
 #if 1
-		emit("nop");
-		emit("movq $%d, %%r15", instruction);
-		emit("nop");
+		if(!optimize)
+		{
+			emit(I_NOP, NONE, NONE);
+			emit(I_MOVQ, IMM(instruction), REG(R_R15));
+			emit(I_NOP, NONE, NONE);
+		}
 #endif
 
 		if(op_argsize[op] == 4)
 		{
 			iarg = *(int*)(code+pc);
 			pc += 4;
-			Dfprintf(qdasmout, "%s %8u\n", opnames[op], iarg);
 		}
 		else if(op_argsize[op] == 1)
 		{
 			barg = code[pc++];
-			Dfprintf(qdasmout, "%s %8hhu\n", opnames[op], barg);
-		}
-		else
-		{
-			Dfprintf(qdasmout, "%s\n", opnames[op]);
 		}
 
-#ifdef USE_GAS
-		emit("i_%08x:", instruction);
-#else
-		if(neednilabel)
+		if(neednilabel || (optimize && jused[instruction]))
 		{
-			emit("i_%08x:", instruction);
+			emit_label(LABEL_INSTR(instruction));
 			neednilabel = 0;
 		}
-#endif
+
+		if(optimize && VM_CompileOptimized(vm, instruction, ops, args, jused, header->instructionCount))
+			continue;
 
 		switch ( op )
 		{
@@ -597,348 +1723,314 @@ void VM_Compile( vm_t *vm, vmHeader_t *header ) {
 				NOTIMPL(op);
 				break;
 			case OP_IGNORE:
-				emit("nop");
+				emit(I_NOP, NONE, NONE);
 				break;
 			case OP_BREAK:
-				emit("int3");
+				emit(I_INT3, NONE, NONE);
 				break;
 			case OP_ENTER:
-				emit("subl $%d, %%edi", iarg);
-				RANGECHECK(edi);
+				emit(I_SUBL, IMM(iarg), REG(R_EDI));
+				RANGECHECK(R_EDI);
 				break;
 			case OP_LEAVE:
-				emit("addl $%d, %%edi", iarg);          // get rid of stack frame
-				emit("ret");
+				emit(I_ADDL, IMM(iarg), REG(R_EDI));          // get rid of stack frame
+				emit(I_RET, NONE, NONE);
 				break;
 			case OP_CALL:
-				emit("movl 0(%%rsi), %%eax");  // get instr from stack
-				emit("subq $4, %%rsi");
-				emit("movl $%d, 0(%%r8, %%rdi, 1)", instruction+1);  // save next instruction
-				emit("orl %%eax, %%eax");
-				emit("jl callSyscall%d", instruction);
-				emit("movq $%lu, %%rbx", (unsigned long)vm->instructionPointers);
-				emit("movl (%%rbx, %%rax, 4), %%eax"); // load new relative jump address
-				emit("addq %%r10, %%rax");
-				emit("callq *%%rax");
-				emit("jmp i_%08x", instruction+1);
-				emit("callSyscall%d:", instruction);
-//				emit("fnsave 4(%%rsi)");
-				emit("push %%rsi");
-				emit("push %%rdi");
-				emit("push %%r8");
-				emit("push %%r9");
-				emit("push %%r10");
-				emit("movq %%rsp, %%rbx"); // we need to align the stack pointer
-				emit("subq $8, %%rbx");    //   |
-				emit("andq $127, %%rbx");  //   |
-				emit("subq %%rbx, %%rsp"); // <-+
-				emit("push %%rbx");
-				emit("negl %%eax");        // convert to actual number
-				emit("decl %%eax");
-				                           // first argument already in rdi
-				emit("movq %%rax, %%rsi"); // second argument in rsi
-				emit("movq $%lu, %%rax", (unsigned long)callAsmCall);
-				emit("callq *%%rax");
-				emit("pop %%rbx");
-				emit("addq %%rbx, %%rsp");
-				emit("pop %%r10");
-				emit("pop %%r9");
-				emit("pop %%r8");
-				emit("pop %%rdi");
-				emit("pop %%rsi");
-//				emit("frstor 4(%%rsi)");
-				emit("addq $4, %%rsi");
-				emit("movl %%eax, (%%rsi)"); // store return value
+				emit(I_MOVL, MEM(R_RSI, 0), REG(R_EAX));  // get instr from stack
+				emit(I_SUBQ, IMM(4), REG(R_RSI));
+				emit(I_MOVL, IMM(instruction+1), MEMX(R_R8, R_RDI, 1, 0));  // save next instruction
+				emit(I_ORL, REG(R_EAX), REG(R_EAX));
+				emit(I_JL, LABEL(LABEL_LOCAL(instruction)), NONE);
+				emit_reloc(vm, VMRELOC_IPTRS, 0, R_RBX);
+				emit(I_MOVL, MEMX(R_RBX, R_RAX, 4, 0), REG(R_EAX)); // load new relative jump address
+				emit(I_ADDQ, REG(R_R10), REG(R_RAX));
+				emit(I_CALLQ, REG(R_RAX), NONE);
+				emit(I_JMP, LABEL(LABEL_INSTR(instruction+1)), NONE);
+				emit_label(LABEL_LOCAL(instruction));
+				emit(I_PUSH, REG(R_RSI), NONE);
+				emit(I_PUSH, REG(R_RDI), NONE);
+				emit(I_PUSH, REG(R_R8), NONE);
+				emit(I_PUSH, REG(R_R9), NONE);
+				emit(I_PUSH, REG(R_R10), NONE);
+				emit(I_MOVQ, REG(R_RSP), REG(R_RBX)); // we need to align the stack pointer
+				emit(I_SUBQ, IMM(8), REG(R_RBX));     //   |
+				emit(I_ANDQ, IMM(127), REG(R_RBX));   //   |
+				emit(I_SUBQ, REG(R_RBX), REG(R_RSP)); // <-+
+				emit(I_PUSH, REG(R_RBX), NONE);
+				emit(I_NEGL, REG(R_EAX), NONE);       // convert to actual number
+				emit(I_DECL, REG(R_EAX), NONE);
+				                                      // first argument already in rdi
+				emit(I_MOVQ, REG(R_RAX), REG(R_RSI)); // second argument in rsi
+				emit_reloc(vm, VMRELOC_SYSCALL, 0, R_RAX);
+				emit(I_CALLQ, REG(R_RAX), NONE);
+				emit(I_POP, REG(R_RBX), NONE);
+				emit(I_ADDQ, REG(R_RBX), REG(R_RSP));
+				emit(I_POP, REG(R_R10), NONE);
+				emit(I_POP, REG(R_R9), NONE);
+				emit(I_POP, REG(R_R8), NONE);
+				emit(I_POP, REG(R_RDI), NONE);
+				emit(I_POP, REG(R_RSI), NONE);
+				emit(I_ADDQ, IMM(4), REG(R_RSI));
+				emit(I_MOVL, REG(R_EAX), MEM(R_RSI, 0)); // store return value
 				neednilabel = 1;
 				break;
 			case OP_PUSH:
-				emit("addq $4, %%rsi");
+				emit(I_ADDQ, IMM(4), REG(R_RSI));
 				break;
 			case OP_POP:
-				emit("subq $4, %%rsi");
+				emit(I_SUBQ, IMM(4), REG(R_RSI));
 				break;
 			case OP_CONST:
-				emit("addq $4, %%rsi");
-				emit("movl $%d, 0(%%rsi)", iarg);
+				emit(I_ADDQ, IMM(4), REG(R_RSI));
+				emit(I_MOVL, IMM(iarg), MEM(R_RSI, 0));
 				break;
 			case OP_LOCAL:
-				emit("movl %%edi, %%ebx");
-				emit("addl $%d,%%ebx", iarg);
-				emit("addq $4, %%rsi");
-				emit("movl %%ebx, 0(%%rsi)");
+				emit(I_MOVL, REG(R_EDI), REG(R_EBX));
+				emit(I_ADDL, IMM(iarg), REG(R_EBX));
+				emit(I_ADDQ, IMM(4), REG(R_RSI));
+				emit(I_MOVL, REG(R_EBX), MEM(R_RSI, 0));
 				break;
 			case OP_JUMP:
-				emit("movl 0(%%rsi), %%eax"); // get instr from stack
-				emit("subq $4, %%rsi");
-				emit("movq $%lu, %%rbx", (unsigned long)vm->instructionPointers);
-				emit("movl (%%rbx, %%rax, 4), %%eax"); // load new relative jump address
-				emit("addq %%r10, %%rax");
-				emit("jmp *%%rax");
+				emit(I_MOVL, MEM(R_RSI, 0), REG(R_EAX)); // get instr from stack
+				emit(I_SUBQ, IMM(4), REG(R_RSI));
+				emit_reloc(vm, VMRELOC_IPTRS, 0, R_RBX);
+				emit(I_MOVL, MEMX(R_RBX, R_RAX, 4, 0), REG(R_EAX)); // load new relative jump address
+				emit(I_ADDQ, REG(R_R10), REG(R_RAX));
+				emit(I_JMP, REG(R_RAX), NONE);
 				break;
 			case OP_EQ:
-				IJ("jne");
+				IJ(I_JNE);
 				break;
 			case OP_NE:
-				IJ("je");
+				IJ(I_JE);
 				break;
 			case OP_LTI:
-				IJ("jnl");
+				IJ(I_JNL);
 				break;
 			case OP_LEI:
-				IJ("jnle");
+				IJ(I_JNLE);
 				break;
 			case OP_GTI:
-				IJ("jng");
+				IJ(I_JNG);
 				break;
 			case OP_GEI:
-				IJ("jnge");
+				IJ(I_JNGE);
 				break;
 			case OP_LTU:
-				IJ("jnb");
+				IJ(I_JNB);
 				break;
 			case OP_LEU:
-				IJ("jnbe");
+				IJ(I_JNBE);
 				break;
 			case OP_GTU:
-				IJ("jna");
+				IJ(I_JNA);
 				break;
 			case OP_GEU:
-				IJ("jnae");
+				IJ(I_JNAE);
 				break;
 			case OP_EQF:
-				FJ(0x40, "jz");
-				XJ("jnz");
+				XJ(I_JNZ);
 				break;
 			case OP_NEF:
-				FJ(0x40, "jnz");
-#ifndef USE_X87
-				emit("subq $8, %%rsi");
-				emit("movss 4(%%rsi), %%xmm0");
-				emit("ucomiss 8(%%rsi), %%xmm0");
-				emit("jp dojump_i_%08x", instruction);
-				emit("jz i_%08x", instruction+1);
-				emit("dojump_i_%08x:", instruction);
+				emit(I_SUBQ, IMM(8), REG(R_RSI));
+				emit(I_MOVSS, MEM(R_RSI, 4), REG(R_XMM0));
+				emit(I_UCOMISS, MEM(R_RSI, 8), REG(R_XMM0));
+				emit(I_JP, LABEL(LABEL_LOCAL(instruction)), NONE);
+				emit(I_JZ, LABEL(LABEL_INSTR(instruction+1)), NONE);
+				emit_label(LABEL_LOCAL(instruction));
 				JMPIARG
 				neednilabel = 1;
-#endif
 				break;
 			case OP_LTF:
-				FJ(0x01, "jz");
-				XJ("jnc");
+				XJ(I_JNC);
 				break;
 			case OP_LEF:
-				FJ(0x41, "jz");
-				XJ("ja");
+				XJ(I_JA);
 				break;
 			case OP_GTF:
-				FJ(0x41, "jnz");
-				XJ("jbe");
+				XJ(I_JBE);
 				break;
 			case OP_GEF:
-				FJ(0x01, "jnz");
-				XJ("jb");
+				XJ(I_JB);
 				break;
 			case OP_LOAD1:
-				emit("movl 0(%%rsi), %%eax"); // get value from stack
-				RANGECHECK(eax);
-				emit("movb 0(%%r8, %%rax, 1), %%al"); // deref into eax
-				emit("andq $255, %%rax");
-				emit("movl %%eax, 0(%%rsi)"); // store on stack
+				emit(I_MOVL, MEM(R_RSI, 0), REG(R_EAX)); // get value from stack
+				RANGECHECK(R_EAX);
+				emit(I_MOVB, MEMX(R_R8, R_RAX, 1, 0), REG(R_AL)); // deref into eax
+				emit(I_ANDQ, IMM(255), REG(R_RAX));
+				emit(I_MOVL, REG(R_EAX), MEM(R_RSI, 0)); // store on stack
 				break;
 			case OP_LOAD2:
-				emit("movl 0(%%rsi), %%eax"); // get value from stack
-				RANGECHECK(eax);
-				emit("movw 0(%%r8, %%rax, 1), %%ax"); // deref into eax
-				emit("movl %%eax, 0(%%rsi)"); // store on stack
+				emit(I_MOVL, MEM(R_RSI, 0), REG(R_EAX)); // get value from stack
+				RANGECHECK(R_EAX);
+				emit(I_MOVW, MEMX(R_R8, R_RAX, 1, 0), REG(R_AX)); // deref into eax
+				emit(I_MOVL, REG(R_EAX), MEM(R_RSI, 0)); // store on stack
 				break;
 			case OP_LOAD4:
-				emit("movl 0(%%rsi), %%eax"); // get value from stack
-				RANGECHECK(eax); // not a pointer!?
-				emit("movl 0(%%r8, %%rax, 1), %%eax"); // deref into eax
-				emit("movl %%eax, 0(%%rsi)"); // store on stack
+				emit(I_MOVL, MEM(R_RSI, 0), REG(R_EAX)); // get value from stack
+				RANGECHECK(R_EAX); // not a pointer!?
+				emit(I_MOVL, MEMX(R_R8, R_RAX, 1, 0), REG(R_EAX)); // deref into eax
+				emit(I_MOVL, REG(R_EAX), MEM(R_RSI, 0)); // store on stack
 				break;
 			case OP_STORE1:
-				emit("movl 0(%%rsi), %%eax"); // get value from stack
-				emit("andq $255, %%rax");
-				emit("movl -4(%%rsi), %%ebx"); // get pointer from stack
-				RANGECHECK(ebx);
-				emit("movb %%al, 0(%%r8, %%rbx, 1)"); // store in memory
-				emit("subq $8, %%rsi");
+				emit(I_MOVL, MEM(R_RSI, 0), REG(R_EAX)); // get value from stack
+				emit(I_ANDQ, IMM(255), REG(R_RAX));
+				emit(I_MOVL, MEM(R_RSI, -4), REG(R_EBX)); // get pointer from stack
+				RANGECHECK(R_EBX);
+				emit(I_MOVB, REG(R_AL), MEMX(R_R8, R_RBX, 1, 0)); // store in memory
+				emit(I_SUBQ, IMM(8), REG(R_RSI));
 				break;
 			case OP_STORE2:
-				emit("movl 0(%%rsi), %%eax"); // get value from stack
-				emit("movl -4(%%rsi), %%ebx"); // get pointer from stack
-				RANGECHECK(ebx);
-				emit("movw %%ax, 0(%%r8, %%rbx, 1)"); // store in memory
-				emit("subq $8, %%rsi");
+				emit(I_MOVL, MEM(R_RSI, 0), REG(R_EAX)); // get value from stack
+				emit(I_MOVL, MEM(R_RSI, -4), REG(R_EBX)); // get pointer from stack
+				RANGECHECK(R_EBX);
+				emit(I_MOVW, REG(R_AX), MEMX(R_R8, R_RBX, 1, 0)); // store in memory
+				emit(I_SUBQ, IMM(8), REG(R_RSI));
 				break;
 			case OP_STORE4:
-				emit("movl -4(%%rsi), %%ebx"); // get pointer from stack
-				RANGECHECK(ebx);
-				emit("movl 0(%%rsi), %%ecx"); // get value from stack
-				emit("movl %%ecx, 0(%%r8, %%rbx, 1)"); // store in memory
-				emit("subq $8, %%rsi");
+				emit(I_MOVL, MEM(R_RSI, -4), REG(R_EBX)); // get pointer from stack
+				RANGECHECK(R_EBX);
+				emit(I_MOVL, MEM(R_RSI, 0), REG(R_ECX)); // get value from stack
+				emit(I_MOVL, REG(R_ECX), MEMX(R_R8, R_RBX, 1, 0)); // store in memory
+				emit(I_SUBQ, IMM(8), REG(R_RSI));
 				break;
 			case OP_ARG:
-				emit("subq $4, %%rsi");
-				emit("movl 4(%%rsi), %%eax"); // get value from stack
-				emit("movl $0x%hhx, %%ebx", barg);
-				emit("addl %%edi, %%ebx");
-				RANGECHECK(ebx);
-				emit("movl %%eax, 0(%%r8,%%rbx, 1)"); // store in args space
+				emit(I_SUBQ, IMM(4), REG(R_RSI));
+				emit(I_MOVL, MEM(R_RSI, 4), REG(R_EAX)); // get value from stack
+				emit(I_MOVL, IMM(barg), REG(R_EBX));
+				emit(I_ADDL, REG(R_EDI), REG(R_EBX));
+				RANGECHECK(R_EBX);
+				emit(I_MOVL, REG(R_EAX), MEMX(R_R8, R_RBX, 1, 0)); // store in args space
 				break;
 			case OP_BLOCK_COPY:
 
-				emit("subq $8, %%rsi");
-				emit("push %%rsi");
-				emit("push %%rdi");
-				emit("push %%r8");
-				emit("push %%r9");
-				emit("push %%r10");
-				emit("movl 4(%%rsi), %%edi");  // 1st argument dest
-				emit("movl 8(%%rsi), %%esi");  // 2nd argument src
-				emit("movl $%d, %%edx", iarg); // 3rd argument count
-				emit("movq $%lu, %%rax", (unsigned long)block_copy_vm);
-				emit("callq *%%rax");
-				emit("pop %%r10");
-				emit("pop %%r9");
-				emit("pop %%r8");
-				emit("pop %%rdi");
-				emit("pop %%rsi");
+				emit(I_SUBQ, IMM(8), REG(R_RSI));
+				emit(I_PUSH, REG(R_RSI), NONE);
+				emit(I_PUSH, REG(R_RDI), NONE);
+				emit(I_PUSH, REG(R_R8), NONE);
+				emit(I_PUSH, REG(R_R9), NONE);
+				emit(I_PUSH, REG(R_R10), NONE);
+				emit(I_MOVL, MEM(R_RSI, 4), REG(R_EDI));  // 1st argument dest
+				emit(I_MOVL, MEM(R_RSI, 8), REG(R_ESI));  // 2nd argument src
+				emit(I_MOVL, IMM(iarg), REG(R_EDX)); // 3rd argument count
+				emit_reloc(vm, VMRELOC_BLOCKCOPY, 0, R_RAX);
+				emit(I_CALLQ, REG(R_RAX), NONE);
+				emit(I_POP, REG(R_R10), NONE);
+				emit(I_POP, REG(R_R9), NONE);
+				emit(I_POP, REG(R_R8), NONE);
+				emit(I_POP, REG(R_RDI), NONE);
+				emit(I_POP, REG(R_RSI), NONE);
 
 				break;
 			case OP_SEX8:
-				emit("movw 0(%%rsi), %%ax");
-				emit("andq $255, %%rax");
-				emit("cbw");
-				emit("cwde");
-				emit("movl %%eax, 0(%%rsi)");
+				emit(I_MOVW, MEM(R_RSI, 0), REG(R_AX));
+				emit(I_ANDQ, IMM(255), REG(R_RAX));
+				emit(I_CBW, NONE, NONE);
+				emit(I_CWDE, NONE, NONE);
+				emit(I_MOVL, REG(R_EAX), MEM(R_RSI, 0));
 				break;
 			case OP_SEX16:
-				emit("movw 0(%%rsi), %%ax");
-				emit("cwde");
-				emit("movl %%eax, 0(%%rsi)");
+				emit(I_MOVW, MEM(R_RSI, 0), REG(R_AX));
+				emit(I_CWDE, NONE, NONE);
+				emit(I_MOVL, REG(R_EAX), MEM(R_RSI, 0));
 				break;
 			case OP_NEGI:
-				emit("negl 0(%%rsi)");
+				emit(I_NEGL, MEM(R_RSI, 0), NONE);
 				break;
 			case OP_ADD:
-				SIMPLE("addl");
+				SIMPLE(I_ADDL);
 				break;
 			case OP_SUB:
-				SIMPLE("subl");
+				SIMPLE(I_SUBL);
 				break;
 			case OP_DIVI:
-				emit("subq $4, %%rsi");
-				emit("movl 0(%%rsi), %%eax");
-				emit("cdq");
-				emit("idivl 4(%%rsi)");
-				emit("movl %%eax, 0(%%rsi)");
+				emit(I_SUBQ, IMM(4), REG(R_RSI));
+				emit(I_MOVL, MEM(R_RSI, 0), REG(R_EAX));
+				emit(I_CDQ, NONE, NONE);
+				emit(I_IDIVL, MEM(R_RSI, 4), NONE);
+				emit(I_MOVL, REG(R_EAX), MEM(R_RSI, 0));
 				break;
 			case OP_DIVU:
-				emit("subq $4, %%rsi");
-				emit("movl 0(%%rsi), %%eax");
-				emit("xorq %%rdx, %%rdx");
-				emit("divl 4(%%rsi)");
-				emit("movl %%eax, 0(%%rsi)");
+				emit(I_SUBQ, IMM(4), REG(R_RSI));
+				emit(I_MOVL, MEM(R_RSI, 0), REG(R_EAX));
+				emit(I_XORQ, REG(R_RDX), REG(R_RDX));
+				emit(I_DIVL, MEM(R_RSI, 4), NONE);
+				emit(I_MOVL, REG(R_EAX), MEM(R_RSI, 0));
 				break;
 			case OP_MODI:
-				emit("subq $4, %%rsi");
-				emit("movl 0(%%rsi), %%eax");
-				emit("xorl %%edx, %%edx");
-				emit("cdq");
-				emit("idivl 4(%%rsi)");
-				emit("movl %%edx, 0(%%rsi)");
+				emit(I_SUBQ, IMM(4), REG(R_RSI));
+				emit(I_MOVL, MEM(R_RSI, 0), REG(R_EAX));
+				emit(I_XORL, REG(R_EDX), REG(R_EDX));
+				emit(I_CDQ, NONE, NONE);
+				emit(I_IDIVL, MEM(R_RSI, 4), NONE);
+				emit(I_MOVL, REG(R_EDX), MEM(R_RSI, 0));
 				break;
 			case OP_MODU:
-				emit("subq $4, %%rsi");
-				emit("movl 0(%%rsi), %%eax");
-				emit("xorl %%edx, %%edx");
-				emit("divl 4(%%rsi)");
-				emit("movl %%edx, 0(%%rsi)");
+				emit(I_SUBQ, IMM(4), REG(R_RSI));
+				emit(I_MOVL, MEM(R_RSI, 0), REG(R_EAX));
+				emit(I_XORL, REG(R_EDX), REG(R_EDX));
+				emit(I_DIVL, MEM(R_RSI, 4), NONE);
+				emit(I_MOVL, REG(R_EDX), MEM(R_RSI, 0));
 				break;
 			case OP_MULI:
-				emit("subq $4, %%rsi");
-				emit("movl 0(%%rsi), %%eax");
-				emit("imull 4(%%rsi)");
-				emit("movl %%eax, 0(%%rsi)");
+				emit(I_SUBQ, IMM(4), REG(R_RSI));
+				emit(I_MOVL, MEM(R_RSI, 0), REG(R_EAX));
+				emit(I_IMULL, MEM(R_RSI, 4), NONE);
+				emit(I_MOVL, REG(R_EAX), MEM(R_RSI, 0));
 				break;
 			case OP_MULU:
-				emit("subq $4, %%rsi");
-				emit("movl 0(%%rsi), %%eax");
-				emit("mull 4(%%rsi)");
-				emit("movl %%eax, 0(%%rsi)");
+				emit(I_SUBQ, IMM(4), REG(R_RSI));
+				emit(I_MOVL, MEM(R_RSI, 0), REG(R_EAX));
+				emit(I_MULL, MEM(R_RSI, 4), NONE);
+				emit(I_MOVL, REG(R_EAX), MEM(R_RSI, 0));
 				break;
 			case OP_BAND:
-				SIMPLE("andl");
+				SIMPLE(I_ANDL);
 				break;
 			case OP_BOR:
-				SIMPLE("orl");
+				SIMPLE(I_ORL);
 				break;
 			case OP_BXOR:
-				SIMPLE("xorl");
+				SIMPLE(I_XORL);
 				break;
 			case OP_BCOM:
-				emit("notl 0(%%rsi)");
+				emit(I_NOTL, MEM(R_RSI, 0), NONE);
 				break;
 			case OP_LSH:
-				SHIFT("shl");
+				SHIFT(I_SHLL);
 				break;
 			case OP_RSHI:
-				SHIFT("sarl");
+				SHIFT(I_SARL);
 				break;
 			case OP_RSHU:
-				SHIFT("shrl");
+				SHIFT(I_SHRL);
 				break;
 			case OP_NEGF:
-#ifdef USE_X87
-				emit("flds 0(%%rsi)");
-				emit("fchs");
-				emit("fstps 0(%%rsi)");
-#else
-				emit("movl $0x80000000, %%eax");
-				emit("xorl %%eax, 0(%%rsi)");
-#endif
+				emit(I_MOVL, IMM((int)0x80000000), REG(R_EAX));
+				emit(I_XORL, REG(R_EAX), MEM(R_RSI, 0));
 				break;
 			case OP_ADDF:
-				FSIMPLE("fadds");
-				XSIMPLE("addss");
+				XSIMPLE(I_ADDSS);
 				break;
 			case OP_SUBF:
-				FSIMPLE("fsubs");
-				XSIMPLE("subss");
+				XSIMPLE(I_SUBSS);
 				break;
 			case OP_DIVF:
-				FSIMPLE("fdivs");
-				XSIMPLE("divss");
+				XSIMPLE(I_DIVSS);
 				break;
 			case OP_MULF:
-				FSIMPLE("fmuls");
-				XSIMPLE("mulss");
+				XSIMPLE(I_MULSS);
 				break;
 			case OP_CVIF:
-#ifdef USE_X87
-				emit("filds 0(%%rsi)");
-				emit("fstps 0(%%rsi)");
-#else
-				emit("movl 0(%%rsi), %%eax");
-				emit("cvtsi2ss %%eax, %%xmm0");
-				emit("movss %%xmm0, 0(%%rsi)");
-#endif
+				emit(I_MOVL, MEM(R_RSI, 0), REG(R_EAX));
+				emit(I_CVTSI2SS, REG(R_EAX), REG(R_XMM0));
+				emit(I_MOVSS, REG(R_XMM0), MEM(R_RSI, 0));
 				break;
 			case OP_CVFI:
-#ifdef USE_X87
-				emit("flds 0(%%rsi)");
-				emit("fnstcw 4(%%rsi)");
-				emit("movw $0x0F7F, 8(%%rsi)"); // round toward zero
-				emit("fldcw 8(%%rsi)");
-				emit("fistpl 0(%%rsi)");
-				emit("fldcw 4(%%rsi)");
-#else
-				emit("movss 0(%%rsi), %%xmm0");
-				emit("cvttss2si %%xmm0, %%eax");
-				emit("movl %%eax, 0(%%rsi)");
-#endif
+				emit(I_MOVSS, MEM(R_RSI, 0), REG(R_XMM0));
+				emit(I_CVTTSS2SI, REG(R_XMM0), REG(R_EAX));
+				emit(I_MOVL, REG(R_EAX), MEM(R_RSI, 0));
 				break;
 			default:
 				NOTIMPL(op);
@@ -946,104 +2038,40 @@ void VM_Compile( vm_t *vm, vmHeader_t *header ) {
 		}
 	}
 
-#ifdef USE_GAS
-	emit("setupinstructionpointers:");
-	emit("movq $%lu, %%rax", (unsigned long)vm->instructionPointers);
-	for ( instruction = 0; instruction < header->instructionCount; ++instruction )
-	{
-		emit("movl $i_%08x-start, %d(%%rax)", instruction, instruction*4);
-	}
-	emit("ret");
-
-	emit("debugger:");
-	if(1);
-	{
-		int i = 6;
-		while(i--)
-		{
-			emit("nop");
-			emit("int3");
-		}
 	}
-
-	fflush(fh_s);
-	fclose(fh_s);
-
-	compiledsize = doas(fn_s, fn_o, &compiledcode);
-	if(compiledsize == -1)
-	{
-		vm->compiled = qfalse;
-		goto out;
-	}
-
-	vm->codeBase   = compiledcode; // remember to skip ELF header!
-	vm->codeLength = compiledsize;
-
-#else  // USE_GAS
-	}
-	assembler_init(0);
+	assembler_free();
 
 	if(mprotect(vm->codeBase, compiledOfs, PROT_READ|PROT_EXEC))
 		Com_Error(ERR_DROP, "VM_CompileX86: mprotect failed");
-#endif // USE_GAS
-
-	vm->destroy = VM_Destroy_Compiled;
-	
-#ifdef USE_GAS
-	entryPoint = getentrypoint(vm);
-
-//	__asm__ __volatile__ ("int3");
-	Com_Printf("computing jump table\n");
 
-	// call code with r8 set to zero to set up instruction pointers
-	__asm__ __volatile__ (
-		"	xorq %%r8,%%r8		\r\n" \
-		"	movq %0,%%r10		\r\n" \
-		"	callq *%%r10		\r\n" \
-		:
-		: "m" (entryPoint)
-		: "%r8", "%r10", "%rax"
-	);
-
-#ifdef DEBUG_VM
-	fflush(qdasmout);
-	fclose(qdasmout);
-#endif
-
-out:
-	close(fd_o);
-
-#ifndef DEBUG_VM
-	if(!com_developer->integer)
+	if(optimize)
 	{
-		unlink(fn_o);
-		unlink(fn_s);
+		Z_Free(ops);
+		Z_Free(args);
+		Z_Free(jused);
 	}
-#endif
-#endif // USE_GAS
+
+	vm->destroy = VM_Destroy_Compiled;
 
 	if(vm->compiled)
 	{
-		struct timeval tvdone =  {0, 0};
-		struct timeval dur =  {0, 0};
 		Com_Printf( "VM file %s compiled to %i bytes of code (%p - %p)\n", vm->name, vm->codeLength, vm->codeBase, vm->codeBase+vm->codeLength );
 
-		gettimeofday(&tvdone, NULL);
-		timersub(&tvdone, &tvstart, &dur);
-		Com_Printf( "compilation took %lu.%06lu seconds\n", dur.tv_sec, dur.tv_usec );
+		if(useCache)
+			VM_StoreCompiledCache(vm, header, cacheKey);
+	}
+
+	if(relocs)
+	{
+		Z_Free(relocs);
+		relocs = NULL;
 	}
 }
 
 
 void VM_Destroy_Compiled(vm_t* self)
 {
-#ifdef USE_GAS
-	munmap(self->codeBase, self->codeLength);
-#elif _WIN32
-	VirtualFree(self->codeBase, 0, MEM_RELEASE);
-#else
 	munmap(self->codeBase, self->codeLength);
-#endif
 }
 
 /*
@@ -1080,7 +2108,7 @@ int	VM_CallCompiled( vm_t *vm, int *args ) {
 	programStack = vm->programStack;
 	stackOnEntry = programStack;
 
-	// set up the stack frame 
+	// set up the stack frame
 	image = vm->dataBase;
 #ifdef DEBUG_VM
 	memData = (char*)image;
@@ -1104,7 +2132,7 @@ int	VM_CallCompiled( vm_t *vm, int *args ) {
 	*(int *)&image[ programStack ] = -1;	// will terminate the loop on return
 
 	// off we go into generated code...
-	entryPoint = getentrypoint(vm);
+	entryPoint = vm->codeBase;
 	opStack = &stack;
 
 	__asm__ __volatile__ (
@@ -1119,7 +2147,8 @@ int	VM_CallCompiled( vm_t *vm, int *args ) {
 		"	movq %%rsi, %1		\r\n" \
 		: "=m" (programStack), "=m" (opStack)
 		: "m" (entryPoint), "m" (vm->dataBase), "m" (programStack), "m" (opStack)
-		: "%rsi", "%rdi", "%rax", "%rbx", "%rcx", "%rdx", "%r8", "%r10", "%r15", "%xmm0"
+		: "%rsi", "%rdi", "%rax", "%rbx", "%rcx", "%rdx", "%r8", "%r9", "%r10", "%r11", "%r12", "%r13", "%r14", "%r15",
+		  "%xmm0", "%xmm1", "%xmm2", "%xmm3", "%xmm4", "%xmm5", "%xmm6", "%xmm7"
 	);
 
 	if ( opStack != &stack[1] ) {
@@ -1134,3 +2163,71 @@ int	VM_CallCompiled( vm_t *vm, int *args ) {
 
 	return *(int *)opStack;
 }
+
+#ifdef VM_SAMPLING_PROFILER
+/*
+==============
+sampling profiler
+
+SIGPROF is delivered while the process uses cpu time. If the main
+thread was running generated code the interrupted rip is mapped to the
+qvm instruction, rdi holds the programStack there. Everything else with
+a vm on the call stack is time spent in system calls.
+==============
+*/
+
+static struct sigaction oldProfAction;
+
+static void VM_ProfileSignal(int sig, siginfo_t* info, void* context)
+{
+	ucontext_t* uc = context;
+	vm_t* vm = currentVM;
+	byte* pc;
+
+	// only the main thread runs vms
+	if(!vm || !vm->compiled || !vm->callLevel || syscall(SYS_gettid) != getpid())
+		return;
+
+	pc = (byte*)uc->uc_mcontext.gregs[REG_RIP];
+
+	if(pc >= vm->codeBase && pc < vm->codeBase + vm->codeLength)
+		VM_ProfileSample(vm, VM_InstructionForOffset(vm, pc - vm->codeBase), (int)uc->uc_mcontext.gregs[REG_RDI]);
+	else
+		VM_ProfileSample(vm, -1, vm->programStack + 4); // see callAsmCall
+}
+
+qboolean VM_SampleTimerStart(int hz)
+{
+	struct sigaction sa;
+	struct itimerval timer;
+
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_sigaction = VM_ProfileSignal;
+	sa.sa_flags = SA_SIGINFO | SA_RESTART;
+	sigemptyset(&sa.sa_mask);
+
+	if(sigaction(SIGPROF, &sa, &oldProfAction))
+		return qfalse;
+
+	timer.it_interval.tv_sec = 0;
+	timer.it_interval.tv_usec = 1000000 / hz;
+	timer.it_value = timer.it_interval;
+
+	if(setitimer(ITIMER_PROF, &timer, NULL))
+	{
+		sigaction(SIGPROF, &oldProfAction, NULL);
+		return qfalse;
+	}
+
+	return qtrue;
+}
+
+void VM_SampleTimerStop(void)
+{
+	struct itimerval timer;
+
+	memset(&timer, 0, sizeof(timer));
+	setitimer(ITIMER_PROF, &timer, NULL);
+	sigaction(SIGPROF, &oldProfAction, NULL);
+}
+#endif
@@ -0,0 +1,214 @@
+/*
+===========================================================================
+vm_x86_64_assembler.h -- binary code emitter for x86-64
+
+Copyright (C) 2007 Ludwig Nussel <ludwig.nussel@suse.de>, Novell inc.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+#ifndef VM_X86_64_ASSEMBLER_H
+#define VM_X86_64_ASSEMBLER_H
+
+#include <stddef.h>
+
+/*
+ * Instructions are encoded directly from operand descriptions, AT&T
+ * operand order (source first). Labels are numbers handed out by the
+ * caller, forward references are resolved by running the code generator
+ * twice with identical input.
+ */
+
+typedef unsigned long asmu64_t;
+
+typedef enum
+{
+	T_NONE      = 0x00,
+	T_REGISTER  = 0x01,
+	T_IMMEDIATE = 0x02,
+	T_MEMORY    = 0x04,
+	T_LABEL     = 0x08,
+	T_ABSOLUTE  = 0x80
+} argtype_t;
+
+typedef enum {
+	R_8   = 0x100,
+	R_16  = 0x200,
+	R_64  = 0x800,
+	R_MSZ = 0xF00,  // size mask
+	R_XMM = 0x2000, // xmm register. year, sucks
+	R_EAX =  0x00,
+	R_EBX =  0x03,
+	R_ECX =  0x01,
+	R_EDX =  0x02,
+	R_ESI =  0x06,
+	R_EDI =  0x07,
+	R_ESP =  0x04,
+	R_RAX =  R_EAX | R_64,
+	R_RBX =  R_EBX | R_64,
+	R_RCX =  R_ECX | R_64,
+	R_RDX =  R_EDX | R_64,
+	R_RSI =  R_ESI | R_64,
+	R_RDI =  R_EDI | R_64,
+	R_RSP =  R_ESP | R_64,
+	R_R8  =  0x08  | R_64,
+	R_R9  =  0x09  | R_64,
+	R_R10 =  0x0A  | R_64,
+	R_R11 =  0x0B  | R_64,
+	R_R12 =  0x0C  | R_64,
+	R_R13 =  0x0D  | R_64,
+	R_R14 =  0x0E  | R_64,
+	R_R15 =  0x0F  | R_64,
+	R_R9D =  0x09,
+	R_R11D = 0x0B,
+	R_R12D = 0x0C,
+	R_R13D = 0x0D,
+	R_R14D = 0x0E,
+	R_AL  =  R_EAX | R_8,
+	R_AX  =  R_EAX | R_16,
+	R_CL  =  R_ECX | R_8,
+	R_XMM0 = 0x00  | R_XMM,
+	R_XMM1 = 0x01  | R_XMM,
+	R_XMM2 = 0x02  | R_XMM,
+	R_XMM3 = 0x03  | R_XMM,
+	R_XMM4 = 0x04  | R_XMM,
+	R_XMM5 = 0x05  | R_XMM,
+	R_XMM6 = 0x06  | R_XMM,
+	R_XMM7 = 0x07  | R_XMM,
+	R_MGP =  0x0F, // mask for general purpose registers
+} reg_t;
+
+typedef struct {
+	unsigned disp;
+	argtype_t basetype;
+	union {
+		asmu64_t imm;
+		reg_t reg;
+	} base;
+	argtype_t indextype;
+	union {
+		asmu64_t imm;
+		reg_t reg;
+	} index;
+	unsigned scale;
+} memref_t;
+
+typedef struct {
+	argtype_t type;
+	union {
+		asmu64_t imm;
+		reg_t reg;
+		memref_t mem;
+		unsigned label;
+	} v;
+} arg_t;
+
+#define NONE ((arg_t){ .type = T_NONE })
+#define REG(r) ((arg_t){ .type = T_REGISTER, .v.reg = (r) })
+#define IMM(i) ((arg_t){ .type = T_IMMEDIATE, .v.imm = (asmu64_t)(i) })
+#define LABEL(l) ((arg_t){ .type = T_LABEL, .v.label = (l) })
+// disp(base)
+#define MEM(b, d) ((arg_t){ .type = T_MEMORY, .v.mem = { .disp = (d), \
+	.basetype = T_REGISTER, .base.reg = (b), .indextype = T_NONE } })
+// disp(base, index, scale)
+#define MEMX(b, i, s, d) ((arg_t){ .type = T_MEMORY, .v.mem = { .disp = (d), \
+	.basetype = T_REGISTER, .base.reg = (b), \
+	.indextype = T_REGISTER, .index.reg = (i), .scale = (s) } })
+
+typedef enum {
+	I_ADDL,
+	I_ADDQ,
+	I_ADDSS,
+	I_ANDL,
+	I_ANDQ,
+	I_CALLQ,
+	I_CBW,
+	I_CDQ,
+	I_CMPL,
+	I_CMPQ,
+	I_CVTSI2SS,
+	I_CVTTSS2SI,
+	I_CWDE,
+	I_DECL,
+	I_DECQ,
+	I_DIVL,
+	I_DIVQ,
+	I_DIVSS,
+	I_IDIVL,
+	I_IMULL,
+	I_INT3,
+	I_JA,
+	I_JBE,
+	I_JB,
+	I_JE,
+	I_JL,
+	I_JMP,
+	I_JNAE,
+	I_JNA,
+	I_JNBE,
+	I_JNB,
+	I_JNC,
+	I_JNE,
+	I_JNGE,
+	I_JNG,
+	I_JNLE,
+	I_JNL,
+	I_JNZ,
+	I_JP,
+	I_JZ,
+	I_MOVB,
+	I_MOVD,
+	I_MOVL,
+	I_MOVQ,
+	I_MOVSS,
+	I_MOVW,
+	I_MOVZBL,
+	I_MOVZWL,
+	I_MULL,
+	I_MULSS,
+	I_NEGL,
+	I_NEGQ,
+	I_NOP,
+	I_NOTL,
+	I_NOTQ,
+	I_ORL,
+	I_POP,
+	I_PUSH,
+	I_REP_MOVSB,
+	I_REP_STOSB,
+	I_RET,
+	I_SARL,
+	I_SHLL,
+	I_SHRL,
+	I_SQRTSS,
+	I_SUBL,
+	I_SUBQ,
+	I_SUBSS,
+	I_UCOMISS,
+	I_XORL,
+	I_XORQ,
+	I_MAX
+} asmop_t;
+
+void assembler_init(int pass, unsigned numlabels);
+void assembler_free(void);
+void assembler_set_output(char* buf);
+size_t assembler_get_code_size(void);
+
+void emit(asmop_t op, arg_t arg1, arg_t arg2);
+void emit_label(unsigned label);
+
+#endif
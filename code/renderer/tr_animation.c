@@ -38,20 +38,20 @@ frame.
 R_AddAnimSurfaces
 ==============
 */
-void R_AddAnimSurfaces( trRefEntity_t *ent ) {
+void R_AddAnimSurfaces( frontEndWork_t *work, trRefEntity_t *ent ) {
 	md4Header_t		*header;
 	md4Surface_t	*surface;
 	md4LOD_t		*lod;
 	shader_t		*shader;
 	int				i;
 
-	header = (md4Header_t *) tr.currentModel->md4;
+	header = (md4Header_t *) work->currentModel->md4;
 	lod = (md4LOD_t *)( (byte *)header + header->ofsLODs );
 
 	surface = (md4Surface_t *)( (byte *)lod + lod->ofsSurfaces );
 	for ( i = 0 ; i < lod->numSurfaces ; i++ ) {
 		shader = R_GetShaderByHandle( surface->shaderIndex );
-		R_AddDrawSurf( (void *)surface, shader, 0 /*fogNum*/, qfalse );
+		R_AddDrawSurf( work, (void *)surface, shader, 0 /*fogNum*/, qfalse );
 		surface = (md4Surface_t *)( (byte *)surface + surface->ofsEnd );
 	}
 }
@@ -178,7 +178,7 @@ R_MDRCullModel
 =============
 */
 
-static int R_MDRCullModel( mdrHeader_t *header, trRefEntity_t *ent ) {
+static int R_MDRCullModel( frontEndWork_t *work, mdrHeader_t *header, trRefEntity_t *ent ) {
 	vec3_t		bounds[2];
 	mdrFrame_t	*oldFrame, *newFrame;
 	int			i, frameSize;
@@ -194,21 +194,21 @@ static int R_MDRCullModel( mdrHeader_t *header, trRefEntity_t *ent ) {
 	{
 		if ( ent->e.frame == ent->e.oldframe )
 		{
-			switch ( R_CullLocalPointAndRadius( newFrame->localOrigin, newFrame->radius ) )
+			switch ( R_CullLocalPointAndRadius( &work->or, newFrame->localOrigin, newFrame->radius ) )
 			{
 				// Ummm... yeah yeah I know we don't really have an md3 here.. but we pretend
 				// we do. After all, the purpose of md4s are not that different, are they?
 				
 				case CULL_OUT:
-					tr.pc.c_sphere_cull_md3_out++;
+					work->pc.c_sphere_cull_md3_out++;
 					return CULL_OUT;
 
 				case CULL_IN:
-					tr.pc.c_sphere_cull_md3_in++;
+					work->pc.c_sphere_cull_md3_in++;
 					return CULL_IN;
 
 				case CULL_CLIP:
-					tr.pc.c_sphere_cull_md3_clip++;
+					work->pc.c_sphere_cull_md3_clip++;
 					break;
 			}
 		}
@@ -216,28 +216,28 @@ static int R_MDRCullModel( mdrHeader_t *header, trRefEntity_t *ent ) {
 		{
 			int sphereCull, sphereCullB;
 
-			sphereCull  = R_CullLocalPointAndRadius( newFrame->localOrigin, newFrame->radius );
+			sphereCull  = R_CullLocalPointAndRadius( &work->or, newFrame->localOrigin, newFrame->radius );
 			if ( newFrame == oldFrame ) {
 				sphereCullB = sphereCull;
 			} else {
-				sphereCullB = R_CullLocalPointAndRadius( oldFrame->localOrigin, oldFrame->radius );
+				sphereCullB = R_CullLocalPointAndRadius( &work->or, oldFrame->localOrigin, oldFrame->radius );
 			}
 
 			if ( sphereCull == sphereCullB )
 			{
 				if ( sphereCull == CULL_OUT )
 				{
-					tr.pc.c_sphere_cull_md3_out++;
+					work->pc.c_sphere_cull_md3_out++;
 					return CULL_OUT;
 				}
 				else if ( sphereCull == CULL_IN )
 				{
-					tr.pc.c_sphere_cull_md3_in++;
+					work->pc.c_sphere_cull_md3_in++;
 					return CULL_IN;
 				}
 				else
 				{
-					tr.pc.c_sphere_cull_md3_clip++;
+					work->pc.c_sphere_cull_md3_clip++;
 				}
 			}
 		}
@@ -249,17 +249,17 @@ static int R_MDRCullModel( mdrHeader_t *header, trRefEntity_t *ent ) {
 		bounds[1][i] = oldFrame->bounds[1][i] > newFrame->bounds[1][i] ? oldFrame->bounds[1][i] : newFrame->bounds[1][i];
 	}
 
-	switch ( R_CullLocalBox( bounds ) )
+	switch ( R_CullLocalBox( &work->or, bounds ) )
 	{
 		case CULL_IN:
-			tr.pc.c_box_cull_md3_in++;
+			work->pc.c_box_cull_md3_in++;
 			return CULL_IN;
 		case CULL_CLIP:
-			tr.pc.c_box_cull_md3_clip++;
+			work->pc.c_box_cull_md3_clip++;
 			return CULL_CLIP;
 		case CULL_OUT:
 		default:
-			tr.pc.c_box_cull_md3_out++;
+			work->pc.c_box_cull_md3_out++;
 			return CULL_OUT;
 	}
 }
@@ -314,7 +314,7 @@ R_MDRAddAnimSurfaces
 
 // much stuff in there is just copied from R_AddMd3Surfaces in tr_mesh.c
 
-void R_MDRAddAnimSurfaces( trRefEntity_t *ent ) {
+void R_MDRAddAnimSurfaces( frontEndWork_t *work, trRefEntity_t *ent ) {
 	mdrHeader_t		*header;
 	mdrSurface_t	*surface;
 	mdrLOD_t		*lod;
@@ -326,7 +326,7 @@ void R_MDRAddAnimSurfaces( trRefEntity_t *ent ) {
 	int				cull;
 	qboolean	personalModel;
 
-	header = (mdrHeader_t *) tr.currentModel->md4;
+	header = (mdrHeader_t *) work->currentModel->md4;
 	
 	personalModel = (ent->e.renderfx & RF_THIRD_PERSON) && !tr.viewParms.isPortal;
 	
@@ -348,7 +348,7 @@ void R_MDRAddAnimSurfaces( trRefEntity_t *ent ) {
 		|| (ent->e.oldframe < 0) )
 	{
 		ri.Printf( PRINT_DEVELOPER, "R_MDRAddAnimSurfaces: no such frame %d to %d for '%s'\n",
-			   ent->e.oldframe, ent->e.frame, tr.currentModel->name );
+			   ent->e.oldframe, ent->e.frame, work->currentModel->name );
 		ent->e.frame = 0;
 		ent->e.oldframe = 0;
 	}
@@ -357,13 +357,13 @@ void R_MDRAddAnimSurfaces( trRefEntity_t *ent ) {
 	// cull the entire model if merged bounding box of both frames
 	// is outside the view frustum.
 	//
-	cull = R_MDRCullModel (header, ent);
+	cull = R_MDRCullModel (work, header, ent);
 	if ( cull == CULL_OUT ) {
 		return;
 	}	
 
 	// figure out the current LOD of the model we're rendering, and set the lod pointer respectively.
-	lodnum = R_ComputeLOD(ent);
+	lodnum = R_ComputeLOD(work, ent);
 	// check whether this model has as that many LODs at all. If not, try the closest thing we got.
 	if(header->numLODs <= 0)
 		return;
@@ -420,7 +420,7 @@ void R_MDRAddAnimSurfaces( trRefEntity_t *ent ) {
 			&& !(ent->e.renderfx & ( RF_NOSHADOW | RF_DEPTHHACK ) )
 			&& shader->sort == SS_OPAQUE )
 		{
-			R_AddDrawSurf( (void *)surface, tr.shadowShader, 0, qfalse );
+			R_AddDrawSurf( work, (void *)surface, tr.shadowShader, 0, qfalse );
 		}
 
 		// projection shadows work fine with personal models
@@ -429,11 +429,11 @@ void R_MDRAddAnimSurfaces( trRefEntity_t *ent ) {
 			&& (ent->e.renderfx & RF_SHADOW_PLANE )
 			&& shader->sort == SS_OPAQUE )
 		{
-			R_AddDrawSurf( (void *)surface, tr.projectionShadowShader, 0, qfalse );
+			R_AddDrawSurf( work, (void *)surface, tr.projectionShadowShader, 0, qfalse );
 		}
 
 		if (!personalModel)
-			R_AddDrawSurf( (void *)surface, shader, fogNum, qfalse );
+			R_AddDrawSurf( work, (void *)surface, shader, fogNum, qfalse );
 
 		surface = (mdrSurface_t *)( (byte *)surface + surface->ofsEnd );
 	}
@@ -194,6 +194,33 @@ void GL_TexEnv( int env )
 	}
 }
 
+/*
+** GL_TexMatrix
+**
+** Loads the texture matrix of the current texture unit, NULL for
+** identity. Only backends with QGL_STAGE_TEXTURE_MATRIX get here.
+*/
+void GL_TexMatrix( const float *matrix )
+{
+	if ( !matrix && !glState.texMatrix[glState.currenttmu] )
+	{
+		return;
+	}
+
+	glState.texMatrix[glState.currenttmu] = ( matrix != NULL );
+
+	qglMatrixMode( GL_TEXTURE );
+	if ( matrix )
+	{
+		qglLoadMatrixf( matrix );
+	}
+	else
+	{
+		qglLoadIdentity();
+	}
+	qglMatrixMode( GL_MODELVIEW );
+}
+
 /*
 ** GL_State
 **
@@ -513,6 +540,109 @@ void RB_BeginDrawingView (void) {
 
 #define	MAC_EVENT_PUMP_MSEC		5
 
+/*
+==================
+RB_ShaderReadsEntity
+
+Returns qtrue if drawing the shader looks at more of the current
+entity than its transform and shader time
+==================
+*/
+static qboolean RB_ShaderReadsEntity( const shader_t *shader ) {
+	shaderStage_t	*pStage;
+	int				i, b, tm;
+
+	// the shadows are cast along the entity's light direction
+	if ( shader == tr.shadowShader || shader == tr.projectionShadowShader ) {
+		return qtrue;
+	}
+	for ( i = 0 ; i < shader->numDeforms ; i++ ) {
+		if ( shader->deforms[i].deformation == DEFORM_PROJECTION_SHADOW ) {
+			return qtrue;
+		}
+	}
+
+	for ( i = 0 ; i < MAX_SHADER_STAGES ; i++ ) {
+		pStage = shader->stages[i];
+		if ( !pStage ) {
+			break;
+		}
+
+		switch ( pStage->rgbGen ) {
+		case CGEN_ENTITY:
+		case CGEN_ONE_MINUS_ENTITY:
+		case CGEN_LIGHTING_DIFFUSE:
+			return qtrue;
+		default:
+			break;
+		}
+
+		if ( pStage->alphaGen == AGEN_ENTITY || pStage->alphaGen == AGEN_ONE_MINUS_ENTITY ) {
+			return qtrue;
+		}
+
+		for ( b = 0 ; b < NUM_TEXTURE_BUNDLES ; b++ ) {
+			for ( tm = 0 ; tm < pStage->bundle[b].numTexMods ; tm++ ) {
+				if ( pStage->bundle[b].texMods[tm].type == TMOD_ENTITY_TRANSLATE ) {
+					return qtrue;
+				}
+			}
+		}
+	}
+
+	return qfalse;
+}
+
+/*
+==================
+RB_MergeEntity
+
+Surfaces of another entity can go into the current batch when they
+end up in the same place and the shader reads nothing else about the
+entity, like brush models that haven't moved and the world, or
+sprites and beams, which are built in world space. Counts the merge.
+==================
+*/
+static qboolean RB_MergeEntity( int entityNum ) {
+	const trRefEntity_t	*ent, *old;
+	orientationr_t		or;
+
+	if ( !r_mergeEntities->integer ) {
+		return qfalse;
+	}
+
+	old = backEnd.currentEntity;
+	if ( entityNum == ENTITYNUM_WORLD ) {
+		ent = &tr.worldEntity;
+	} else {
+		ent = &backEnd.refdef.entities[entityNum];
+	}
+
+	// depth hacked entities have their own projection
+	if ( ( ent->e.renderfx | old->e.renderfx ) & RF_DEPTHHACK ) {
+		return qfalse;
+	}
+	if ( ent->e.shaderTime != old->e.shaderTime ) {
+		return qfalse;
+	}
+	if ( RB_ShaderReadsEntity( tess.shader ) ) {
+		return qfalse;
+	}
+
+	if ( entityNum == ENTITYNUM_WORLD ) {
+		or = backEnd.viewParms.world;
+	} else {
+		R_RotateForEntity( ent, &backEnd.viewParms, &or );
+	}
+	if ( memcmp( or.modelMatrix, backEnd.or.modelMatrix, sizeof( or.modelMatrix ) ) ) {
+		return qfalse;
+	}
+
+	tess.numMergedEntities++;
+	backEnd.pc.c_mergedEntities++;
+	return qtrue;
+}
+
 /*
 ==================
 RB_RenderDrawSurfList
@@ -528,6 +658,11 @@ void RB_RenderDrawSurfList( drawSurf_t *drawSurfs, int numDrawSurfs ) {
 	drawSurf_t		*drawSurf;
 	int				oldSort;
 	float			originalTime;
+	unsigned		start = 0;
+
+	if ( tr.phaseTiming ) {
+		start = ri.Microseconds();
+	}
 
 	// save original time for entity shader offsets
 	originalTime = backEnd.refdef.floatTime;
@@ -560,9 +695,10 @@ void RB_RenderDrawSurfList( drawSurf_t *drawSurfs, int numDrawSurfs ) {
 		//
 		// change the tess parameters if needed
 		// a "entityMergable" shader is a shader that can have surfaces from seperate
-		// entities merged into a single batch, like smoke and blood puff sprites
-		if (shader != oldShader || fogNum != oldFogNum || dlighted != oldDlighted 
-			|| ( entityNum != oldEntityNum && !shader->entityMergable ) ) {
+		// entities merged into a single batch, like smoke and blood puff sprites,
+		// other entities are merged when it makes no difference
+		if (shader != oldShader || fogNum != oldFogNum || dlighted != oldDlighted
+			|| ( entityNum != oldEntityNum && !shader->entityMergable && !RB_MergeEntity( entityNum ) ) ) {
 			if (oldShader != NULL) {
 				RB_EndSurface();
 			}
@@ -692,6 +828,10 @@ void RB_RenderDrawSurfList( drawSurf_t *drawSurfs, int numDrawSurfs ) {
 
 	// add light flares on lights that aren't obscured
 	RB_RenderFlares();
+
+	if ( tr.phaseTiming ) {
+		tr.phaseUsec[RP_SURFACES] += ri.Microseconds() - start;
+	}
 }
 
 
@@ -1090,6 +1230,7 @@ RB_SwapBuffers
 */
 const void	*RB_SwapBuffers( const void *data ) {
 	const swapBuffersCommand_t	*cmd;
+	unsigned	start = 0;
 
 	// finish any 2D drawing if needed
 	if ( tess.numIndexes ) {
@@ -1124,6 +1265,10 @@ const void	*RB_SwapBuffers( const void *data ) {
 #endif
 
 
+	if ( tr.phaseTiming ) {
+		start = ri.Microseconds();
+	}
+
 	if ( !glState.finishCalled ) {
 		qglFinish();
 	}
@@ -1132,6 +1277,10 @@ const void	*RB_SwapBuffers( const void *data ) {
 
 	GLimp_EndFrame();
 
+	if ( tr.phaseTiming ) {
+		tr.phaseUsec[RP_SWAP] += ri.Microseconds() - start;
+	}
+
 	backEnd.projection2D = qfalse;
 
 	return (const void *)(cmd + 1);
@@ -1147,8 +1296,10 @@ smp extensions, or asynchronously by another thread.
 */
 void RB_ExecuteRenderCommands( const void *data ) {
 	int		t1, t2;
+	unsigned	start;
 
 	t1 = ri.Milliseconds ();
+	start = tr.phaseTiming ? ri.Microseconds() : 0;
 
 	if ( !r_smp->integer || data == backEndData[0]->commands.cmds ) {
 		backEnd.smpFrame = 0;
@@ -1190,6 +1341,9 @@ void RB_ExecuteRenderCommands( const void *data ) {
 			// stop rendering on this thread
 			t2 = ri.Milliseconds ();
 			backEnd.pc.msec = t2 - t1;
+			if ( tr.phaseTiming ) {
+				tr.phaseUsec[RP_BACKEND] += ri.Microseconds() - start;
+			}
 			return;
 		}
 	}
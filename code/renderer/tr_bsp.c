@@ -1458,6 +1458,9 @@ static	void R_LoadShaders( lump_t *l ) {
 	for ( i=0 ; i<count ; i++ ) {
 		out[i].surfaceFlags = LittleLong( out[i].surfaceFlags );
 		out[i].contentFlags = LittleLong( out[i].contentFlags );
+
+		// start decoding the images while the rest of the map loads
+		R_PreloadShaderImages( out[i].shader );
 	}
 }
 
@@ -1871,6 +1874,8 @@ void RE_LoadWorldMap( const char *name ) {
 	// only set tr.world now that we know the entire level has loaded properly
 	tr.world = &s_worldData;
 
+	R_CreateWorldVBOs();
+
     ri.FS_FreeFile( buffer.v );
 }
 
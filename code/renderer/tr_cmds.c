@@ -69,6 +69,23 @@ void R_PerformanceCounters( void ) {
 		ri.Printf( PRINT_ALL, "flare adds:%i tests:%i renders:%i\n", 
 			backEnd.pc.c_flareAdds, backEnd.pc.c_flareTests, backEnd.pc.c_flareRenders );
 	}
+	else if (r_speeds->integer == 7 )
+	{
+		frameArena_t	*arena = &backEndData[tr.smpFrame]->arena;
+
+		ri.Printf( PRINT_ALL, "arena:%i/%iKB dropped polys:%i surfs:%i ents:%i dlights:%i\n",
+			( arena->low + arena->high ) / 1024, arena->size / 1024, tr.pc.c_droppedPolys,
+			tr.pc.c_droppedDrawSurfs, tr.pc.c_droppedEntities, tr.pc.c_droppedDlights );
+	}
+	else if (r_speeds->integer == 8 )
+	{
+		int	forwarded, dropped;
+
+		qglStateCounters( &forwarded, &dropped );
+		ri.Printf( PRINT_ALL, "draws:%i unmerged:%i merged ents:%i state calls:%i dropped:%i\n",
+			backEnd.pc.c_draws, backEnd.pc.c_unmergedDraws, backEnd.pc.c_mergedEntities,
+			forwarded, dropped );
+	}
 
 	Com_Memset( &tr.pc, 0, sizeof( tr.pc ) );
 	Com_Memset( &backEnd.pc, 0, sizeof( backEnd.pc ) );
@@ -536,6 +553,51 @@ void RE_EndFrame( int *frontEndMsec, int *backEndMsec ) {
 		*backEndMsec = backEnd.pc.msec;
 	}
 	backEnd.pc.msec = 0;
+
+	if ( tr.phaseTiming ) {
+		tr.phaseFrames++;
+	}
+}
+
+/*
+=============
+RE_PhaseTimes
+
+Starts timing the renderer phases, or prints how many msec per
+frame each of them took since they were started and stops.
+=============
+*/
+void RE_PhaseTimes( qboolean report ) {
+	static const char *names[RP_NUM_PHASES] = {
+		"world", "entities", "sort", "front end",
+		"surfaces", "shading", "swap", "back end"
+	};
+	int		i;
+
+	// the back end may still be working on the last frame
+	R_SyncRenderThread();
+
+	if ( !report ) {
+		Com_Memset( tr.phaseUsec, 0, sizeof( tr.phaseUsec ) );
+		tr.phaseFrames = 0;
+		tr.phaseTiming = qtrue;
+		return;
+	}
+
+	if ( !tr.phaseTiming ) {
+		return;
+	}
+	tr.phaseTiming = qfalse;
+
+	if ( !tr.phaseFrames ) {
+		return;
+	}
+
+	ri.Printf( PRINT_ALL, "renderer msec per frame over %i frames:\n", tr.phaseFrames );
+	for ( i = 0 ; i < RP_NUM_PHASES ; i++ ) {
+		ri.Printf( PRINT_ALL, "%10s %7.3f\n", names[i],
+			tr.phaseUsec[i] / ( 1000.0f * tr.phaseFrames ) );
+	}
 }
 
 /*
@@ -843,22 +843,85 @@ image_t *R_CreateImage( const char *name, const byte *pic, int width, int height
 
 //===================================================================
 
+/*
+=================
+R_InitImageDecode
+=================
+*/
+void R_InitImageDecode( imageDecode_t *d, const char *name, const byte *buffer, int length,
+					void *(*alloc)( int size ), void (*free)( void *ptr ) ) {
+	Com_Memset( d, 0, sizeof( *d ) );
+	d->name = name;
+	d->buffer = buffer;
+	d->length = length;
+	d->alloc = alloc;
+	d->free = free;
+}
+
+/*
+=================
+R_ImageDecodeError
+
+Drops whatever has been decoded so far, always returns qfalse
+=================
+*/
+qboolean R_ImageDecodeError( imageDecode_t *d, int errorLevel, const char *fmt, ... ) {
+	va_list		argptr;
+
+	if ( d->pic ) {
+		d->free( d->pic );
+		d->pic = NULL;
+	}
+
+	d->errorLevel = errorLevel;
+	va_start( argptr, fmt );
+	Q_vsnprintf( d->error, sizeof( d->error ), fmt, argptr );
+	va_end( argptr );
+
+	return qfalse;
+}
+
+/*
+=================
+R_FinishImageDecode
+
+Reports the outcome of a decode on the main thread
+=================
+*/
+void R_FinishImageDecode( imageDecode_t *d, byte **pic, int *width, int *height ) {
+	if ( d->warning[0] ) {
+		ri.Printf( PRINT_WARNING, "%s", d->warning );
+	}
+	if ( d->error[0] ) {
+		ri.Error( d->errorLevel, "%s", d->error );
+	}
+
+	*pic = d->pic;
+	if ( width ) {
+		*width = d->width;
+	}
+	if ( height ) {
+		*height = d->height;
+	}
+}
+
 typedef struct
 {
 	char *ext;
 	void (*ImageLoader)( const char *, unsigned char **, int *, int * );
+	qboolean (*Decoder)( imageDecode_t *d );
 } imageExtToLoaderMap_t;
 
 // Note that the ordering indicates the order of preference used
 // when there are multiple images of different formats available
 static imageExtToLoaderMap_t imageLoaders[ ] =
 {
-	{ "tga",  R_LoadTGA },
-	{ "jpg",  R_LoadJPG },
-	{ "jpeg", R_LoadJPG },
-	{ "png",  R_LoadPNG },
-	{ "pcx",  R_LoadPCX },
-	{ "bmp",  R_LoadBMP }
+	{ "tga",  R_LoadTGA, R_DecodeTGA },
+	{ "jpg",  R_LoadJPG, R_DecodeJPG },
+	{ "jpeg", R_LoadJPG, R_DecodeJPG },
+	{ "png",  R_LoadPNG, NULL },
+	{ "pcx",  R_LoadPCX, NULL },
+	{ "bmp",  R_LoadBMP, NULL }
 };
 
 static int numImageLoaders = sizeof( imageLoaders ) /
@@ -941,6 +1004,333 @@ void R_LoadImage( const char *name, byte **pic, int *width, int *height )
 }
 
 
+/*
+=================================================================
+
+IMAGE PRELOADING
+
+While a map loads, the images named by the shaders of the world are
+read and decoded on the job threads in the order they were queued.
+R_FindImageFile takes the decoded pics, so only the upload is left
+for the main thread. Formats without an in-memory decoder are only
+read ahead into the page cache. At most r_preloadImages images are
+held decoded and not yet taken.
+
+=================================================================
+*/
+
+#define	MAX_PRELOAD_IMAGES	1024
+
+typedef enum {
+	PRELOAD_WAITING,		// not handed to the job threads yet
+	PRELOAD_QUEUED,
+	PRELOAD_TAKEN			// picked up or skipped by R_FindImageFile
+} preloadState_t;
+
+typedef struct preloadImage_s {
+	char				name[MAX_QPATH];		// as requested by the shader
+	char				fileName[MAX_QPATH];	// the file R_LoadImage would load
+	preloadState_t		state;
+	qboolean			(*decoder)( imageDecode_t *d );
+	qboolean			decoded;
+	backgroundRead_t	read;
+	imageDecode_t		decode;
+	job_t				job;
+	struct preloadImage_s	*next;
+} preloadImage_t;
+
+static preloadImage_t	*preloadImages[MAX_PRELOAD_IMAGES];
+static preloadImage_t	*preloadHash[FILE_HASH_SIZE];
+static int				numPreloadImages;
+static int				nextPreloadImage;		// next one to queue
+static int				numPreloadsAhead;		// queued and not taken
+static int				numPreloadsTaken;
+static qboolean			preloadDisabled;		// there are no job threads
+
+static void *R_PreloadAlloc( int size ) {
+	return malloc( size );
+}
+
+static void R_PreloadFree( void *ptr ) {
+	free( ptr );
+}
+
+/*
+=================
+R_PreloadImageJob
+
+Runs on a job thread
+=================
+*/
+static void R_PreloadImageJob( void *data ) {
+	preloadImage_t	*p = data;
+	byte			*buffer;
+
+	if ( !p->decoder ) {
+		ri.FS_BackgroundRead( &p->read, NULL );
+		return;
+	}
+
+	buffer = malloc( p->read.length );
+	if ( !buffer ) {
+		ri.FS_CloseBackgroundRead( &p->read );
+		return;
+	}
+
+	if ( ri.FS_BackgroundRead( &p->read, buffer ) ) {
+		R_InitImageDecode( &p->decode, p->fileName, buffer, p->read.length, R_PreloadAlloc, R_PreloadFree );
+		p->decoded = p->decoder( &p->decode );
+	}
+
+	free( buffer );
+}
+
+/*
+=================
+R_QueuePreloadedImages
+=================
+*/
+static void R_QueuePreloadedImages( void ) {
+	preloadImage_t	*p;
+
+	while ( nextPreloadImage < numPreloadImages && numPreloadsAhead < r_preloadImages->integer ) {
+		p = preloadImages[nextPreloadImage++];
+		if ( p->state != PRELOAD_WAITING ) {
+			continue;
+		}
+
+		// files are only opened once they are queued to keep the number
+		// of open loose files down
+		if ( ri.FS_OpenBackgroundRead( p->fileName, &p->read ) < 0 ) {
+			p->state = PRELOAD_TAKEN;
+			continue;
+		}
+
+		p->job.function = R_PreloadImageJob;
+		p->job.data = p;
+		if ( !ri.AddJob( &p->job ) ) {
+			ri.FS_CloseBackgroundRead( &p->read );
+			preloadDisabled = qtrue;
+			return;
+		}
+		p->state = PRELOAD_QUEUED;
+		numPreloadsAhead++;
+	}
+}
+
+/*
+=================
+R_FindPreloadedImage
+=================
+*/
+static preloadImage_t *R_FindPreloadedImage( const char *name ) {
+	preloadImage_t	*p;
+
+	for ( p = preloadHash[generateHashValue( name )] ; p ; p = p->next ) {
+		if ( !strcmp( name, p->name ) ) {
+			return p;
+		}
+	}
+
+	return NULL;
+}
+
+/*
+=================
+R_OpenPreloadFile
+
+Returns qtrue if the file exists. Files that exist but can only be read
+on the main thread leave the fileName empty.
+=================
+*/
+static qboolean R_OpenPreloadFile( const char *name, char *fileName ) {
+	backgroundRead_t	read;
+
+	if ( ri.FS_OpenBackgroundRead( name, &read ) < 0 ) {
+		return qfalse;
+	}
+
+	if ( read.data || read.fp ) {
+		Q_strncpyz( fileName, name, MAX_QPATH );
+	} else {
+		fileName[0] = 0;
+	}
+	ri.FS_CloseBackgroundRead( &read );
+
+	return qtrue;
+}
+
+/*
+=================
+R_PreloadImage
+
+Finds the file the same way R_LoadImage does and queues it
+=================
+*/
+void R_PreloadImage( const char *name ) {
+	preloadImage_t	*p;
+	image_t			*image;
+	char			localName[MAX_QPATH];
+	char			altName[MAX_QPATH];
+	char			fileName[MAX_QPATH];
+	const char		*ext;
+	int				i;
+	long			hash;
+	qboolean		found;
+
+	if ( !r_preloadImages->integer || preloadDisabled ) {
+		return;
+	}
+	if ( !name[0] || name[0] == '*' || strlen( name ) >= MAX_QPATH ) {
+		return;
+	}
+	if ( numPreloadImages == MAX_PRELOAD_IMAGES ) {
+		return;
+	}
+
+	hash = generateHashValue( name );
+	for ( image = hashTable[hash] ; image ; image = image->next ) {
+		if ( !strcmp( name, image->imgName ) ) {
+			return;
+		}
+	}
+	if ( R_FindPreloadedImage( name ) ) {
+		return;
+	}
+
+	Q_strncpyz( localName, name, sizeof( localName ) );
+	found = qfalse;
+
+	ext = COM_GetExtension( localName );
+	if ( *ext ) {
+		for ( i = 0 ; i < numImageLoaders ; i++ ) {
+			if ( !Q_stricmp( ext, imageLoaders[i].ext ) ) {
+				break;
+			}
+		}
+		if ( i < numImageLoaders ) {
+			found = R_OpenPreloadFile( localName, fileName );
+			if ( !found ) {
+				COM_StripExtension( name, localName, sizeof( localName ) );
+			}
+		}
+	}
+
+	for ( i = 0 ; i < numImageLoaders && !found ; i++ ) {
+		Com_sprintf( altName, sizeof( altName ), "%s.%s", localName, imageLoaders[i].ext );
+		found = R_OpenPreloadFile( altName, fileName );
+	}
+
+	if ( !found || !fileName[0] ) {
+		return;
+	}
+
+	ext = COM_GetExtension( fileName );
+	for ( i = 0 ; i < numImageLoaders ; i++ ) {
+		if ( !Q_stricmp( ext, imageLoaders[i].ext ) ) {
+			break;
+		}
+	}
+
+	p = ri.Malloc( sizeof( *p ) );
+	Com_Memset( p, 0, sizeof( *p ) );
+	Q_strncpyz( p->name, name, sizeof( p->name ) );
+	Q_strncpyz( p->fileName, fileName, sizeof( p->fileName ) );
+	p->decoder = imageLoaders[i].Decoder;
+	p->state = PRELOAD_WAITING;
+	p->next = preloadHash[hash];
+	preloadHash[hash] = p;
+	preloadImages[numPreloadImages++] = p;
+
+	R_QueuePreloadedImages();
+}
+
+/*
+=================
+R_TakePreloadedImage
+
+The pic has to be released with R_PreloadFree
+=================
+*/
+static qboolean R_TakePreloadedImage( const char *name, byte **pic, int *width, int *height ) {
+	preloadImage_t	*p;
+	qboolean		queued;
+
+	p = R_FindPreloadedImage( name );
+	if ( !p || p->state == PRELOAD_TAKEN ) {
+		return qfalse;
+	}
+
+	queued = ( p->state == PRELOAD_QUEUED );
+	p->state = PRELOAD_TAKEN;
+	numPreloadsTaken++;
+
+	if ( !queued ) {
+		return qfalse;
+	}
+
+	if ( p->decoder ) {
+		ri.FinishJob( &p->job );
+	} else if ( ri.CancelJob( &p->job ) ) {
+		ri.FS_CloseBackgroundRead( &p->read );
+	}
+	numPreloadsAhead--;
+	R_QueuePreloadedImages();
+
+	// anything that went wrong is repeated by R_LoadImage
+	if ( !p->decoded ) {
+		return qfalse;
+	}
+
+	if ( p->decode.warning[0] ) {
+		ri.Printf( PRINT_WARNING, "%s", p->decode.warning );
+	}
+	*pic = p->decode.pic;
+	*width = p->decode.width;
+	*height = p->decode.height;
+	p->decode.pic = NULL;
+
+	return qtrue;
+}
+
+/*
+=================
+R_ClearPreloadedImages
+
+Drops everything that has not been taken by the end of the registration
+=================
+*/
+void R_ClearPreloadedImages( void ) {
+	preloadImage_t	*p;
+	int				i;
+
+	if ( !numPreloadImages ) {
+		return;
+	}
+
+	for ( i = 0 ; i < numPreloadImages ; i++ ) {
+		p = preloadImages[i];
+		if ( p->state == PRELOAD_QUEUED ) {
+			if ( ri.CancelJob( &p->job ) ) {
+				ri.FS_CloseBackgroundRead( &p->read );
+			}
+		}
+		if ( p->decode.pic ) {
+			R_PreloadFree( p->decode.pic );
+		}
+		ri.Free( p );
+	}
+
+	ri.Printf( PRINT_DEVELOPER, "%i of %i preloaded images used\n", numPreloadsTaken, numPreloadImages );
+
+	Com_Memset( preloadHash, 0, sizeof( preloadHash ) );
+	numPreloadImages = 0;
+	nextPreloadImage = 0;
+	numPreloadsAhead = 0;
+	numPreloadsTaken = 0;
+	preloadDisabled = qfalse;
+}
+
 /*
 ===============
 R_FindImageFile
@@ -954,6 +1344,7 @@ image_t	*R_FindImageFile( const char *name, qboolean mipmap, qboolean allowPicmi
 	int		width, height;
 	byte	*pic;
 	long	hash;
+	qboolean	preloaded;
 
 	if (!name) {
 		return NULL;
@@ -983,15 +1374,22 @@ image_t	*R_FindImageFile( const char *name, qboolean mipmap, qboolean allowPicmi
 	}
 
 	//
-	// load the pic from disk
+	// load the pic from disk, unless it has been preloaded
 	//
-	R_LoadImage( name, &pic, &width, &height );
+	preloaded = R_TakePreloadedImage( name, &pic, &width, &height );
+	if ( !preloaded ) {
+		R_LoadImage( name, &pic, &width, &height );
+	}
 	if ( pic == NULL ) {
 		return NULL;
 	}
 
 	image = R_CreateImage( ( char * ) name, pic, width, height, mipmap, allowPicmip, glWrapClampMode );
-	ri.Free( pic );
+	if ( preloaded ) {
+		R_PreloadFree( pic );
+	} else {
+		ri.Free( pic );
+	}
 	return image;
 }
 
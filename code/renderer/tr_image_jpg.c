@@ -30,10 +30,44 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
  * You may also wish to include "jerror.h".
  */
 
+#include <setjmp.h>
+
 #define JPEG_INTERNALS
 #include "../jpeg-6b/jpeglib.h"
 
-void R_LoadJPG( const char *filename, unsigned char **pic, int *width, int *height ) {
+/* Error handler that returns to R_DecodeJPG instead of ending the
+ * game, the decoder may be running on a job thread.
+ */
+typedef struct {
+  struct jpeg_error_mgr pub;	/* "public" fields */
+  jmp_buf setjmp_buffer;	/* for return to caller */
+  imageDecode_t *d;
+} decode_error_mgr;
+
+static void
+decode_error_exit (j_common_ptr cinfo)
+{
+  decode_error_mgr *err = (decode_error_mgr *) cinfo->err;
+  char buffer[JMSG_LENGTH_MAX];
+
+  (*cinfo->err->format_message) (cinfo, buffer);
+  R_ImageDecodeError( err->d, ERR_FATAL, "%s\n", buffer );
+
+  longjmp(err->setjmp_buffer, 1);
+}
+
+static void
+decode_output_message (j_common_ptr cinfo)
+{
+  decode_error_mgr *err = (decode_error_mgr *) cinfo->err;
+  char buffer[JMSG_LENGTH_MAX];
+
+  (*cinfo->err->format_message) (cinfo, buffer);
+  if (!err->d->warning[0])
+    Com_sprintf(err->d->warning, sizeof(err->d->warning), "%s\n", buffer);
+}
+
+qboolean R_DecodeJPG( imageDecode_t *d ) {
   /* This struct contains the JPEG decompression parameters and pointers to
    * working space (which is allocated as needed by the JPEG library).
    */
@@ -42,53 +76,42 @@ void R_LoadJPG( const char *filename, unsigned char **pic, int *width, int *heig
    * Note that this struct must live as long as the main JPEG parameter
    * struct, to avoid dangling-pointer problems.
    */
-  /* This struct represents a JPEG error handler.  It is declared separately
-   * because applications often want to supply a specialized error handler
-   * (see the second half of this file for an example).  But here we just
-   * take the easy way out and use the standard error handler, which will
-   * print a message on stderr and call exit() if compression fails.
-   * Note that this struct must live as long as the main JPEG parameter
-   * struct, to avoid dangling-pointer problems.
-   */
-  struct jpeg_error_mgr jerr;
+  decode_error_mgr jerr;
   /* More stuff */
   JSAMPARRAY buffer;		/* Output row buffer */
   unsigned row_stride;		/* physical row width in output buffer */
   unsigned pixelcount, memcount;
   unsigned char *out;
-  int len;
-	union {
-		byte *b;
-		void *v;
-	} fbuffer;
   byte  *buf;
 
-  /* In this example we want to open the input file before doing anything else,
-   * so that the setjmp() error recovery below can assume the file is open.
-   * VERY IMPORTANT: use "b" option to fopen() if you are on a machine that
-   * requires it in order to read binary files.
-   */
-
-  len = ri.FS_ReadFile ( ( char * ) filename, &fbuffer.v);
-  if (!fbuffer.b || len < 0) {
-	return;
-  }
-
   /* Step 1: allocate and initialize JPEG decompression object */
 
-  /* We have to set up the error handler first, in case the initialization
-   * step fails.  (Unlikely, but it could happen if you are out of memory.)
-   * This routine fills in the contents of struct jerr, and returns jerr's
-   * address which we place into the link field in cinfo.
+  /* We set up the normal JPEG error routines, then override error_exit
+   * and output_message.
    */
-  cinfo.err = jpeg_std_error(&jerr);
+  cinfo.err = jpeg_std_error(&jerr.pub);
+  jerr.pub.error_exit = decode_error_exit;
+  jerr.pub.output_message = decode_output_message;
+  jerr.d = d;
+
+  /* Establish the setjmp return context for decode_error_exit to use. */
+  if (setjmp(jerr.setjmp_buffer)) {
+    /* If we get here, the JPEG code has signaled an error.
+     * We need to clean up the JPEG object and return.
+     */
+    jpeg_destroy_decompress(&cinfo);
+    return qfalse;
+  }
+
+  /* The memory manager allocates through the decode as well */
+  cinfo.client_data = d;
 
   /* Now we can initialize the JPEG decompression object. */
   jpeg_create_decompress(&cinfo);
 
   /* Step 2: specify data source (eg, a file) */
 
-  jpeg_mem_src(&cinfo, fbuffer.b, len);
+  jpeg_mem_src(&cinfo, (unsigned char *)d->buffer, d->length);
 
   /* Step 3: read file parameters with jpeg_read_header() */
 
@@ -126,17 +149,19 @@ void R_LoadJPG( const char *filename, unsigned char **pic, int *width, int *heig
       || ((pixelcount * 4) / cinfo.output_width) / 4 != cinfo.output_height
       || pixelcount > 0x1FFFFFFF || cinfo.output_components > 4) // 4*1FFFFFFF == 0x7FFFFFFC < 0x7FFFFFFF
   {
-    ri.Error (ERR_DROP, "LoadJPG: %s has an invalid image size: %dx%d*4=%d, components: %d\n", filename,
+    R_ImageDecodeError (d, ERR_DROP, "LoadJPG: %s has an invalid image size: %dx%d*4=%d, components: %d\n", d->name,
 		    cinfo.output_width, cinfo.output_height, pixelcount * 4, cinfo.output_components);
+    jpeg_destroy_decompress(&cinfo);
+    return qfalse;
   }
 
   memcount = pixelcount * 4;
   row_stride = cinfo.output_width * cinfo.output_components;
 
-  out = ri.Malloc(memcount);
+  out = d->pic = d->alloc(memcount);
 
-  *width = cinfo.output_width;
-  *height = cinfo.output_height;
+  d->width = cinfo.output_width;
+  d->height = cinfo.output_height;
 
   /* Step 6: while (scan lines remain to be read) */
   /*           jpeg_read_scanlines(...); */
@@ -187,8 +212,6 @@ void R_LoadJPG( const char *filename, unsigned char **pic, int *width, int *heig
 	}
   }
 
-  *pic = out;
-
   /* Step 7: Finish decompression */
 
   (void) jpeg_finish_decompress(&cinfo);
@@ -201,18 +224,30 @@ void R_LoadJPG( const char *filename, unsigned char **pic, int *width, int *heig
   /* This is an important step since it will release a good deal of memory. */
   jpeg_destroy_decompress(&cinfo);
 
-  /* After finish_decompress, we can close the input file.
-   * Here we postpone it until after no more JPEG errors are possible,
-   * so as to simplify the setjmp error logic above.  (Actually, I don't
-   * think that jpeg_destroy can do an error exit, but why assume anything...)
-   */
-  ri.FS_FreeFile (fbuffer.v);
+  /* And we're done! */
+  return qtrue;
+}
 
-  /* At this point you may want to check to see whether any corrupt-data
-   * warnings occurred (test whether jerr.pub.num_warnings is nonzero).
-   */
+void R_LoadJPG( const char *filename, unsigned char **pic, int *width, int *height ) {
+  imageDecode_t d;
+  int len;
+	union {
+		const byte *b;
+		const void *v;
+	} fbuffer;
 
-  /* And we're done! */
+  *pic = NULL;
+
+  len = ri.FS_MapFile ( filename, &fbuffer.v);
+  if (!fbuffer.b || len < 0) {
+	return;
+  }
+
+  R_InitImageDecode( &d, filename, fbuffer.b, len, ri.Malloc, ri.Free );
+  R_DecodeJPG( &d );
+  ri.FS_FreeMappedFile (fbuffer.v);
+
+  R_FinishImageDecode( &d, pic, width, height );
 }
 
 
@@ -330,7 +365,7 @@ void SaveJPG(char * filename, int quality, int image_width, int image_height, un
    * compression/decompression processes, in existence at once.  We refer
    * to any one struct (and its associated working data) as a "JPEG object".
    */
-  struct jpeg_compress_struct cinfo;
+  struct jpeg_compress_struct cinfo = {NULL};
   /* This struct represents a JPEG error handler.  It is declared separately
    * because applications often want to supply a specialized error handler
    * (see the second half of this file for an example).  But here we just
@@ -442,7 +477,7 @@ int SaveJPGToBuffer( byte *buffer, int quality,
     int image_width, int image_height,
     byte *image_buffer )
 {
-  struct jpeg_compress_struct cinfo;
+  struct jpeg_compress_struct cinfo = {NULL};
   struct jpeg_error_mgr jerr;
   JSAMPROW row_pointer[1];	/* pointer to JSAMPLE row[s] */
   int row_stride;		/* physical row width in image buffer */
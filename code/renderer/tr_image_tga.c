@@ -38,43 +38,29 @@ typedef struct _TargaHeader {
 	unsigned char	pixel_size, attributes;
 } TargaHeader;
 
-void R_LoadTGA ( const char *name, byte **pic, int *width, int *height)
+/*
+=============
+R_DecodeTGA
+=============
+*/
+qboolean R_DecodeTGA( imageDecode_t *d )
 {
 	unsigned	columns, rows, numPixels;
 	byte	*pixbuf;
 	int		row, column;
-	byte	*buf_p;
-	byte	*end;
-	union {
-		byte *b;
-		void *v;
-	} buffer;
+	const byte	*buf_p;
+	const byte	*end;
 	TargaHeader	targa_header;
 	byte		*targa_rgba;
-	int length;
-
-	*pic = NULL;
-
-	if(width)
-		*width = 0;
-	if(height)
-		*height = 0;
+	const char	*name = d->name;
 
-	//
-	// load the file
-	//
-	length = ri.FS_ReadFile ( ( char * ) name, &buffer.v);
-	if (!buffer.b || length < 0) {
-		return;
-	}
-
-	if(length < 18)
+	if(d->length < 18)
 	{
-		ri.Error( ERR_DROP, "LoadTGA: header too short (%s)\n", name );
+		return R_ImageDecodeError( d, ERR_DROP, "LoadTGA: header too short (%s)\n", name );
 	}
 
-	buf_p = buffer.b;
-	end = buffer.b + length;
+	buf_p = d->buffer;
+	end = d->buffer + d->length;
 
 	targa_header.id_length = buf_p[0];
 	targa_header.colormap_type = buf_p[1];
@@ -103,17 +89,17 @@ void R_LoadTGA ( const char *name, byte **pic, int *width, int *height)
 		&& targa_header.image_type!=10
 		&& targa_header.image_type != 3 ) 
 	{
-		ri.Error (ERR_DROP, "LoadTGA: Only type 2 (RGB), 3 (gray), and 10 (RGB) TGA images supported\n");
+		return R_ImageDecodeError( d, ERR_DROP, "LoadTGA: Only type 2 (RGB), 3 (gray), and 10 (RGB) TGA images supported\n");
 	}
 
 	if ( targa_header.colormap_type != 0 )
 	{
-		ri.Error( ERR_DROP, "LoadTGA: colormaps not supported\n" );
+		return R_ImageDecodeError( d, ERR_DROP, "LoadTGA: colormaps not supported\n" );
 	}
 
 	if ( ( targa_header.pixel_size != 32 && targa_header.pixel_size != 24 ) && targa_header.image_type != 3 )
 	{
-		ri.Error (ERR_DROP, "LoadTGA: Only 32 or 24 bit images supported (no colormaps)\n");
+		return R_ImageDecodeError( d, ERR_DROP, "LoadTGA: Only 32 or 24 bit images supported (no colormaps)\n");
 	}
 
 	columns = targa_header.width;
@@ -122,16 +108,16 @@ void R_LoadTGA ( const char *name, byte **pic, int *width, int *height)
 
 	if(!columns || !rows || numPixels > 0x7FFFFFFF || numPixels / columns / 4 != rows)
 	{
-		ri.Error (ERR_DROP, "LoadTGA: %s has an invalid image size\n", name);
+		return R_ImageDecodeError( d, ERR_DROP, "LoadTGA: %s has an invalid image size\n", name);
 	}
 
 
-	targa_rgba = ri.Malloc (numPixels);
+	targa_rgba = d->pic = d->alloc (numPixels);
 
 	if (targa_header.id_length != 0)
 	{
 		if (buf_p + targa_header.id_length > end)
-			ri.Error( ERR_DROP, "LoadTGA: header too short (%s)\n", name );
+			return R_ImageDecodeError( d, ERR_DROP, "LoadTGA: header too short (%s)\n", name );
 
 		buf_p += targa_header.id_length;  // skip TARGA image comment
 	}
@@ -140,7 +126,7 @@ void R_LoadTGA ( const char *name, byte **pic, int *width, int *height)
 	{ 
 		if(buf_p + columns*rows*targa_header.pixel_size/8 > end)
 		{
-			ri.Error (ERR_DROP, "LoadTGA: file truncated (%s)\n", name);
+			return R_ImageDecodeError( d, ERR_DROP, "LoadTGA: file truncated (%s)\n", name);
 		}
 
 		// Uncompressed RGB or gray scale image
@@ -183,7 +169,7 @@ void R_LoadTGA ( const char *name, byte **pic, int *width, int *height)
 					*pixbuf++ = alphabyte;
 					break;
 				default:
-					ri.Error( ERR_DROP, "LoadTGA: illegal pixel_size '%d' in file '%s'\n", targa_header.pixel_size, name );
+					return R_ImageDecodeError( d, ERR_DROP, "LoadTGA: illegal pixel_size '%d' in file '%s'\n", targa_header.pixel_size, name );
 					break;
 				}
 			}
@@ -201,12 +187,12 @@ void R_LoadTGA ( const char *name, byte **pic, int *width, int *height)
 			pixbuf = targa_rgba + row*columns*4;
 			for(column=0; column<columns; ) {
 				if(buf_p + 1 > end)
-					ri.Error (ERR_DROP, "LoadTGA: file truncated (%s)\n", name);
+					return R_ImageDecodeError( d, ERR_DROP, "LoadTGA: file truncated (%s)\n", name);
 				packetHeader= *buf_p++;
 				packetSize = 1 + (packetHeader & 0x7f);
 				if (packetHeader & 0x80) {        // run-length packet
 					if(buf_p + targa_header.pixel_size/8 > end)
-						ri.Error (ERR_DROP, "LoadTGA: file truncated (%s)\n", name);
+						return R_ImageDecodeError( d, ERR_DROP, "LoadTGA: file truncated (%s)\n", name);
 					switch (targa_header.pixel_size) {
 						case 24:
 								blue = *buf_p++;
@@ -221,7 +207,7 @@ void R_LoadTGA ( const char *name, byte **pic, int *width, int *height)
 								alphabyte = *buf_p++;
 								break;
 						default:
-							ri.Error( ERR_DROP, "LoadTGA: illegal pixel_size '%d' in file '%s'\n", targa_header.pixel_size, name );
+							return R_ImageDecodeError( d, ERR_DROP, "LoadTGA: illegal pixel_size '%d' in file '%s'\n", targa_header.pixel_size, name );
 							break;
 					}
 	
@@ -244,7 +230,7 @@ void R_LoadTGA ( const char *name, byte **pic, int *width, int *height)
 				else {                            // non run-length packet
 
 					if(buf_p + targa_header.pixel_size/8*packetSize > end)
-						ri.Error (ERR_DROP, "LoadTGA: file truncated (%s)\n", name);
+						return R_ImageDecodeError( d, ERR_DROP, "LoadTGA: file truncated (%s)\n", name);
 					for(j=0;j<packetSize;j++) {
 						switch (targa_header.pixel_size) {
 							case 24:
@@ -267,7 +253,7 @@ void R_LoadTGA ( const char *name, byte **pic, int *width, int *height)
 									*pixbuf++ = alphabyte;
 									break;
 							default:
-								ri.Error( ERR_DROP, "LoadTGA: illegal pixel_size '%d' in file '%s'\n", targa_header.pixel_size, name );
+								return R_ImageDecodeError( d, ERR_DROP, "LoadTGA: illegal pixel_size '%d' in file '%s'\n", targa_header.pixel_size, name );
 								break;
 						}
 						column++;
@@ -306,15 +292,48 @@ void R_LoadTGA ( const char *name, byte **pic, int *width, int *height)
 #endif
   // instead we just print a warning
   if (targa_header.attributes & 0x20) {
-    ri.Printf( PRINT_WARNING, "WARNING: '%s' TGA file header declares top-down image, ignoring\n", name);
+    Com_sprintf( d->warning, sizeof( d->warning ), "WARNING: '%s' TGA file header declares top-down image, ignoring\n", name);
   }
 
-  if (width)
-	  *width = columns;
-  if (height)
-	  *height = rows;
+  d->width = columns;
+  d->height = rows;
+  d->pic = targa_rgba;
+
+  return qtrue;
+}
+
+/*
+=============
+R_LoadTGA
+=============
+*/
+void R_LoadTGA ( const char *name, byte **pic, int *width, int *height)
+{
+	imageDecode_t	d;
+	union {
+		const byte *b;
+		const void *v;
+	} buffer;
+	int length;
+
+	*pic = NULL;
+
+	if(width)
+		*width = 0;
+	if(height)
+		*height = 0;
+
+	//
+	// load the file
+	//
+	length = ri.FS_MapFile ( name, &buffer.v);
+	if (!buffer.b || length < 0) {
+		return;
+	}
 
-  *pic = targa_rgba;
+	R_InitImageDecode( &d, name, buffer.b, length, ri.Malloc, ri.Free );
+	R_DecodeTGA( &d );
+	ri.FS_FreeMappedFile (buffer.v);
 
-  ri.FS_FreeFile (buffer.v);
+	R_FinishImageDecode( &d, pic, width, height );
 }
@@ -115,6 +115,8 @@ cvar_t	*r_singleShader;
 cvar_t	*r_roundImagesDown;
 cvar_t	*r_colorMipLevels;
 cvar_t	*r_picmip;
+cvar_t	*r_preloadImages;
+cvar_t	*r_parallelFrontEnd;
 cvar_t	*r_showtris;
 cvar_t	*r_showsky;
 cvar_t	*r_shownormals;
@@ -150,14 +152,17 @@ cvar_t	*r_showImages;
 cvar_t	*r_ambientScale;
 cvar_t	*r_directedScale;
 cvar_t	*r_debugLight;
+cvar_t	*r_developer;
 cvar_t	*r_debugSort;
 cvar_t	*r_printShaders;
 cvar_t	*r_saveFontData;
 
 cvar_t	*r_maxpolys;
-int		max_polys;
 cvar_t	*r_maxpolyverts;
-int		max_polyverts;
+cvar_t	*r_frameArenaKB;
+cvar_t	*r_vbo;
+cvar_t	*r_gpuStages;
+cvar_t	*r_mergeEntities;
 
 void (APIENTRY * qglMultiTexCoord2fARB) (GLenum texture, GLfloat s, GLfloat t);
 void (APIENTRY * qglActiveTextureARB) (GLenum texture);
@@ -209,6 +214,9 @@ static void InitOpenGL( void )
 		}
 	}
 
+	// shader stage work the backend can take over
+	glState.stageFeatures = r_gpuStages->integer ? qglStageFeatures() : 0;
+
 	// init command buffers and SMP
 	R_InitCommandBuffers();
 
@@ -773,6 +781,10 @@ void GL_SetDefaultState( void )
 	// make sure our GL state vector is set correctly
 	//
 	glState.glStateBits = GLS_DEPTHTEST_DISABLE | GLS_DEPTHMASK_TRUE;
+	glState.texMatrix[0] = glState.texMatrix[1] = qfalse;
+	glState.texGen[0] = glState.texGen[1] = TCGEN_BAD;
+	glState.numDeforms = 0;
+	glState.normalArray = qfalse;
 
 #if !defined(NOKIA)
 	qglPolygonMode (GL_FRONT_AND_BACK, GL_FILL);
@@ -901,6 +913,8 @@ void R_Register( void )
 	r_ext_max_anisotropy = ri.Cvar_Get( "r_ext_max_anisotropy", "2", CVAR_ARCHIVE | CVAR_LATCH );
 
 	r_picmip = ri.Cvar_Get ("r_picmip", "1", CVAR_ARCHIVE | CVAR_LATCH );
+	r_preloadImages = ri.Cvar_Get( "r_preloadImages", "16", CVAR_ARCHIVE );
+	r_parallelFrontEnd = ri.Cvar_Get( "r_parallelFrontEnd", "1", CVAR_ARCHIVE );
 	r_roundImagesDown = ri.Cvar_Get ("r_roundImagesDown", "1", CVAR_ARCHIVE | CVAR_LATCH );
 	r_colorMipLevels = ri.Cvar_Get ("r_colorMipLevels", "0", CVAR_LATCH );
 	ri.Cvar_CheckRange( r_picmip, 0, 16, qtrue );
@@ -975,6 +989,7 @@ void R_Register( void )
 	r_showImages = ri.Cvar_Get( "r_showImages", "0", CVAR_TEMP );
 
 	r_debugLight = ri.Cvar_Get( "r_debuglight", "0", CVAR_TEMP );
+	r_developer = ri.Cvar_Get( "developer", "0", CVAR_TEMP );
 	r_debugSort = ri.Cvar_Get( "r_debugSort", "0", CVAR_CHEAT );
 	r_printShaders = ri.Cvar_Get( "r_printShaders", "0", 0 );
 	r_saveFontData = ri.Cvar_Get( "r_saveFontData", "0", 0 );
@@ -1017,6 +1032,10 @@ void R_Register( void )
 
 	r_maxpolys = ri.Cvar_Get( "r_maxpolys", va("%d", MAX_POLYS), 0);
 	r_maxpolyverts = ri.Cvar_Get( "r_maxpolyverts", va("%d", MAX_POLYVERTS), 0);
+	r_frameArenaKB = ri.Cvar_Get( "r_frameArenaKB", "1024", CVAR_ARCHIVE | CVAR_LATCH );
+	r_vbo = ri.Cvar_Get( "r_vbo", "1", CVAR_ARCHIVE | CVAR_LATCH );
+	r_gpuStages = ri.Cvar_Get( "r_gpuStages", "1", CVAR_ARCHIVE | CVAR_LATCH );
+	r_mergeEntities = ri.Cvar_Get( "r_mergeEntities", "1", CVAR_ARCHIVE );
 
 	// make sure all the commands added here are also
 	// removed in R_Shutdown
@@ -1038,6 +1057,7 @@ R_Init
 void R_Init( void ) {	
 	int	err;
 	int i;
+	int arenaSize;
 	byte *ptr;
 
 	ri.Printf( PRINT_ALL, "----- R_Init -----\n" );
@@ -1092,28 +1112,37 @@ void R_Init( void ) {
 
 	R_Register();
 
-	max_polys = r_maxpolys->integer;
-	if (max_polys < MAX_POLYS)
-		max_polys = MAX_POLYS;
-
-	max_polyverts = r_maxpolyverts->integer;
-	if (max_polyverts < MAX_POLYVERTS)
-		max_polyverts = MAX_POLYVERTS;
-
-	ptr = ri.Hunk_Alloc( sizeof( *backEndData[0] ) + sizeof(srfPoly_t) * max_polys + sizeof(polyVert_t) * max_polyverts, h_low);
-	backEndData[0] = (backEndData_t *) ptr;
-	backEndData[0]->polys = (srfPoly_t *) ((char *) ptr + sizeof( *backEndData[0] ));
-	backEndData[0]->polyVerts = (polyVert_t *) ((char *) ptr + sizeof( *backEndData[0] ) + sizeof(srfPoly_t) * max_polys);
-	if ( r_smp->integer ) {
-		ptr = ri.Hunk_Alloc( sizeof( *backEndData[1] ) + sizeof(srfPoly_t) * max_polys + sizeof(polyVert_t) * max_polyverts, h_low);
-		backEndData[1] = (backEndData_t *) ptr;
-		backEndData[1]->polys = (srfPoly_t *) ((char *) ptr + sizeof( *backEndData[1] ));
-		backEndData[1]->polyVerts = (polyVert_t *) ((char *) ptr + sizeof( *backEndData[1] ) + sizeof(srfPoly_t) * max_polys);
-	} else {
-		backEndData[1] = NULL;
+	// the old poly limits still work as a minimum arena size
+	i = r_maxpolys->integer > MAX_POLYS ? r_maxpolys->integer : MAX_POLYS;
+	arenaSize = r_maxpolyverts->integer > MAX_POLYVERTS ? r_maxpolyverts->integer : MAX_POLYVERTS;
+	arenaSize = i * sizeof( srfPoly_t ) + arenaSize * sizeof( polyVert_t );
+	if ( arenaSize < r_frameArenaKB->integer * 1024 ) {
+		arenaSize = r_frameArenaKB->integer * 1024;
+	}
+	arenaSize = PAD( arenaSize, 16 );
+
+	for ( i = 0 ; i < SMP_FRAMES ; i++ ) {
+		if ( i && !r_smp->integer ) {
+			backEndData[i] = NULL;
+			continue;
+		}
+		ptr = ri.Hunk_Alloc( sizeof( *backEndData[i] ) + arenaSize, h_low );
+		backEndData[i] = (backEndData_t *) ptr;
+		backEndData[i]->arena.base = ptr + sizeof( *backEndData[i] );
+		backEndData[i]->arena.size = arenaSize;
+		backEndData[i]->polys = (srfPoly_t *) backEndData[i]->arena.base;
 	}
 	R_ToggleSmpFrame();
 
+	// one surface buffer for the main thread and one for each job thread
+	tr.numFrontEndWork = 1 + ri.NumJobThreads();
+	if ( tr.numFrontEndWork > MAX_FRONTEND_WORK ) {
+		tr.numFrontEndWork = MAX_FRONTEND_WORK;
+	}
+	for ( i = 0 ; i < tr.numFrontEndWork ; i++ ) {
+		tr.frontEndWork[i].drawSurfs = ri.Hunk_Alloc( MAX_DRAWSURFS * sizeof( drawSurf_t ), h_low );
+	}
+
 	InitOpenGL();
 
 	R_InitImages();
@@ -1154,9 +1183,12 @@ void RE_Shutdown( qboolean destroyWindow ) {
 	ri.Cmd_RemoveCommand( "shaderstate" );
 
 
+	R_ClearPreloadedImages();
+
 	if ( tr.registered ) {
 		R_SyncRenderThread();
 		R_ShutdownCommandBuffers();
+		R_ShutdownWorldVBOs();
 		R_DeleteTextures();
 	}
 
@@ -1179,6 +1211,7 @@ Touch all images to make sure they are resident
 =============
 */
 void RE_EndRegistration( void ) {
+	R_ClearPreloadedImages();
 	R_SyncRenderThread();
 	if (!Sys_LowPhysicalMemory()) {
 		RB_ShowImages();
@@ -1220,6 +1253,7 @@ refexport_t *GetRefAPI ( int apiVersion, refimport_t *rimp ) {
 
 	re.BeginFrame = RE_BeginFrame;
 	re.EndFrame = RE_EndFrame;
+	re.PhaseTimes = RE_PhaseTimes;
 
 	re.MarkFragments = R_MarkFragments;
 	re.LerpTag = R_LerpTag;
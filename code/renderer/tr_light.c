@@ -35,8 +35,7 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 R_TransformDlights
 
 Transforms the origins of an array of dlights.
-Used by both the front end (for DlightBmodel) and
-the back end (before doing the lighting calculation)
+Used by the back end (before doing the lighting calculation)
 ===============
 */
 void R_TransformDlights( int count, dlight_t *dl, orientationr_t *or) {
@@ -56,27 +55,34 @@ void R_TransformDlights( int count, dlight_t *dl, orientationr_t *or) {
 R_DlightBmodel
 
 Determine which dynamic lights may effect this bmodel
+
+The lights are transformed into the local space of the work
+without writing them back, other works may be looking at them
 =============
 */
-void R_DlightBmodel( bmodel_t *bmodel ) {
+void R_DlightBmodel( frontEndWork_t *work, bmodel_t *bmodel ) {
 	int			i, j;
 	dlight_t	*dl;
 	int			mask;
 	msurface_t	*surf;
-
-	// transform all the lights
-	R_TransformDlights( tr.refdef.num_dlights, tr.refdef.dlights, &tr.or );
+	vec3_t		temp, transformed;
 
 	mask = 0;
 	for ( i=0 ; i<tr.refdef.num_dlights ; i++ ) {
 		dl = &tr.refdef.dlights[i];
 
+		// transform the light
+		VectorSubtract( dl->origin, work->or.origin, temp );
+		transformed[0] = DotProduct( temp, work->or.axis[0] );
+		transformed[1] = DotProduct( temp, work->or.axis[1] );
+		transformed[2] = DotProduct( temp, work->or.axis[2] );
+
 		// see if the point is close enough to the bounds to matter
 		for ( j = 0 ; j < 3 ; j++ ) {
-			if ( dl->transformed[j] - bmodel->bounds[1][j] > dl->radius ) {
+			if ( transformed[j] - bmodel->bounds[1][j] > dl->radius ) {
 				break;
 			}
-			if ( bmodel->bounds[0][j] - dl->transformed[j] > dl->radius ) {
+			if ( bmodel->bounds[0][j] - transformed[j] > dl->radius ) {
 				break;
 			}
 		}
@@ -88,7 +94,7 @@ void R_DlightBmodel( bmodel_t *bmodel ) {
 		mask |= 1 << i;
 	}
 
-	tr.currentEntity->needDlights = (mask != 0);
+	work->currentEntity->needDlights = (mask != 0);
 
 	// set the dlight bits in all the surfaces
 	for ( i = 0 ; i < bmodel->numSurfaces ; i++ ) {
@@ -115,7 +121,6 @@ LIGHT SAMPLING
 
 extern	cvar_t	*r_ambientScale;
 extern	cvar_t	*r_directedScale;
-extern	cvar_t	*r_debugLight;
 
 /*
 =================
@@ -610,6 +610,11 @@ typedef struct {
 	// dynamic lighting information
 	int			dlightBits[SMP_FRAMES];
 
+	// range in the world buffer objects, vbo is 0 if not in one
+	int			vbo;
+	int			vboFirstIndex;
+	int			vboNumIndexes;
+
 	// triangle definitions (no normals at points)
 	int			numPoints;
 	int			numIndices;
@@ -631,6 +636,11 @@ typedef struct {
 	vec3_t			localOrigin;
 	float			radius;
 
+	// range in the world buffer objects, vbo is 0 if not in one
+	int				vbo;
+	int				vboFirstIndex;
+	int				vboNumIndexes;
+
 	// triangle definitions
 	int				numIndexes;
 	int				*indexes;
@@ -823,8 +833,64 @@ typedef struct {
 	int		c_leafs;
 	int		c_dlightSurfaces;
 	int		c_dlightSurfacesCulled;
+
+	// things the scene had no room for this frame
+	int		c_droppedPolys;
+	int		c_droppedDrawSurfs;
+	int		c_droppedEntities;
+	int		c_droppedDlights;
 } frontEndCounters_t;
 
+// renderer phases timed for RE_PhaseTimes, the totals include the
+// phases above them
+typedef enum {
+	RP_WORLD,			// R_AddWorldSurfaces
+	RP_ENTITIES,		// R_AddEntitySurfaces
+	RP_SORT,			// R_RadixSort
+	RP_FRONTEND,		// all of RE_RenderScene
+
+	RP_SURFACES,		// RB_RenderDrawSurfList, shading included
+	RP_SHADING,			// the stage iterators, from all of the back end
+	RP_SWAP,			// qglFinish and GLimp_EndFrame
+	RP_BACKEND,			// all of RB_ExecuteRenderCommands
+
+	RP_NUM_PHASES
+} renderPhase_t;
+
+/*
+** frontEndWork_t
+**
+** The state of generating draw surfaces for the world or for some of
+** the entities. The world subtrees and the entities are split between
+** the job threads, each with its own frontEndWork_t, and what they
+** added is merged into tr.refdef before sorting.
+*/
+#define	MAX_FRONTEND_WORK		4
+
+typedef struct {
+	int					currentEntityNum;
+	int					shiftedEntityNum;	// currentEntityNum << QSORT_ENTITYNUM_SHIFT
+	trRefEntity_t		*currentEntity;
+	model_t				*currentModel;
+	orientationr_t		or;					// for current entity
+
+	drawSurf_t			*drawSurfs;			// MAX_DRAWSURFS, wraps like tr.refdef
+	int					numDrawSurfs;
+
+	vec3_t				visBounds[2];		// of the world leafs added
+	frontEndCounters_t	pc;
+
+	// surfaces may be added by another work at the same time
+	qboolean			shared;
+
+	// jobs can't call ri.Error, it is raised after merging
+	const char			*error;
+
+	job_t				job;
+	int					index;				// of the first subtree or entity
+	int					step;				// to the next one
+} frontEndWork_t;
+
 #define	FOG_TABLE_SIZE		256
 #define FUNCTABLE_SIZE		1024
 #define FUNCTABLE_SIZE2		10
@@ -839,6 +905,11 @@ typedef struct {
 	int			texEnv[2];
 	int			faceCulling;
 	unsigned long	glStateBits;
+	int			stageFeatures;		// QGL_STAGE_* bits the backend evaluates
+	qboolean	texMatrix[2];		// a texture matrix other than identity is loaded
+	int			texGen[2];			// TCGEN_* the backend generates, TCGEN_BAD for none
+	int			numDeforms;			// deforms the backend applies to the positions
+	qboolean	normalArray;
 } glstate_t;
 
 
@@ -853,6 +924,10 @@ typedef struct {
 	int		c_flareTests;
 	int		c_flareRenders;
 
+	int		c_draws;
+	int		c_unmergedDraws;	// what the draws would have been without RB_MergeEntity
+	int		c_mergedEntities;
+
 	int		msec;			// total msec for backend run
 } backEndCounters_t;
 
@@ -921,8 +996,6 @@ typedef struct {
 	trRefEntity_t			*currentEntity;
 	trRefEntity_t			worldEntity;		// point currentEntity at this when rendering world
 	int						currentEntityNum;
-	int						shiftedEntityNum;	// currentEntityNum << QSORT_ENTITYNUM_SHIFT
-	model_t					*currentModel;
 
 	viewParms_t				viewParms;
 
@@ -942,6 +1015,13 @@ typedef struct {
 	frontEndCounters_t		pc;
 	int						frontEndMsec;		// not in pc due to clearing issue
 
+	frontEndWork_t			frontEndWork[MAX_FRONTEND_WORK];
+	int						numFrontEndWork;	// with buffers allocated
+
+	qboolean				phaseTiming;		// RE_PhaseTimes is collecting
+	unsigned				phaseUsec[RP_NUM_PHASES];
+	int						phaseFrames;
+
 	//
 	// put large tables at the end, so most elements will be
 	// within the +/32K indexed range on risc processors
@@ -1060,6 +1140,8 @@ extern	cvar_t	*r_singleShader;				// make most world faces use default shader
 extern	cvar_t	*r_roundImagesDown;
 extern	cvar_t	*r_colorMipLevels;				// development aid to see texture mip usage
 extern	cvar_t	*r_picmip;						// controls picmip values
+extern	cvar_t	*r_preloadImages;				// number of images decoded ahead on the job threads
+extern	cvar_t	*r_parallelFrontEnd;			// generate the surfaces of a view on the job threads too
 extern	cvar_t	*r_finish;
 extern	cvar_t	*r_drawBuffer;
 extern  cvar_t  *r_glDriver;
@@ -1091,6 +1173,9 @@ extern	cvar_t	*r_portalOnly;
 extern	cvar_t	*r_subdivisions;
 extern	cvar_t	*r_lodCurveError;
 extern	cvar_t	*r_smp;
+extern	cvar_t	*r_vbo;
+extern	cvar_t	*r_gpuStages;
+extern	cvar_t	*r_mergeEntities;
 extern	cvar_t	*r_showSmp;
 extern	cvar_t	*r_skipBackEnd;
 
@@ -1109,6 +1194,8 @@ extern	cvar_t	*r_simpleMipMaps;
 
 extern	cvar_t	*r_showImages;
 extern	cvar_t	*r_debugSort;
+extern	cvar_t	*r_debugLight;
+extern	cvar_t	*r_developer;					// "developer", the jobs must not print its messages
 
 extern	cvar_t	*r_printShaders;
 extern	cvar_t	*r_saveFontData;
@@ -1124,28 +1211,32 @@ void R_SwapBuffers( int );
 
 void R_RenderView( viewParms_t *parms );
 
-void R_AddMD3Surfaces( trRefEntity_t *e );
+void R_AddMD3Surfaces( frontEndWork_t *work, trRefEntity_t *e );
 void R_AddNullModelSurfaces( trRefEntity_t *e );
 void R_AddBeamSurfaces( trRefEntity_t *e );
 void R_AddRailSurfaces( trRefEntity_t *e, qboolean isUnderwater );
 void R_AddLightningBoltSurfaces( trRefEntity_t *e );
 
-void R_AddPolygonSurfaces( void );
+void R_AddPolygonSurfaces( frontEndWork_t *work );
 
 void R_DecomposeSort( unsigned sort, int *entityNum, shader_t **shader, 
 					 int *fogNum, int *dlightMap );
 
-void R_AddDrawSurf( surfaceType_t *surface, shader_t *shader, int fogIndex, int dlightMap );
+void R_AddDrawSurf( frontEndWork_t *work, surfaceType_t *surface, shader_t *shader, int fogIndex, int dlightMap );
+void R_BeginFrontEndWork( frontEndWork_t *work, int entityNum );
+void R_MergeFrontEndWork( frontEndWork_t *work );
+int R_NumFrontEndWork( void );
+void R_RunFrontEndWork( int numWork, void (*function)( void *data ) );
 
 
 #define	CULL_IN		0		// completely unclipped
 #define	CULL_CLIP	1		// clipped by one or more planes
 #define	CULL_OUT	2		// completely outside the clipping planes
 void R_LocalNormalToWorld (vec3_t local, vec3_t world);
-void R_LocalPointToWorld (vec3_t local, vec3_t world);
-int R_CullLocalBox (vec3_t bounds[2]);
+void R_LocalPointToWorld (const orientationr_t *or, vec3_t local, vec3_t world);
+int R_CullLocalBox (const orientationr_t *or, vec3_t bounds[2]);
 int R_CullPointAndRadius( vec3_t origin, float radius );
-int R_CullLocalPointAndRadius( vec3_t origin, float radius );
+int R_CullLocalPointAndRadius( const orientationr_t *or, vec3_t origin, float radius );
 
 void R_SetupProjection(viewParms_t *dest, float zProj, qboolean computeFrustum);
 void R_RotateForEntity( const trRefEntity_t *ent, const viewParms_t *viewParms, orientationr_t *or );
@@ -1160,6 +1251,7 @@ void	GL_TextureMode( const char *string );
 void	GL_CheckErrors( void );
 void	GL_State( unsigned long stateVector );
 void	GL_TexEnv( int env );
+void	GL_TexMatrix( const float *matrix );
 void	GL_Cull( int cullType );
 
 #define GLS_SRCBLEND_ZERO						0x00000001
@@ -1232,11 +1324,13 @@ void	R_InitFogTable( void );
 float	R_FogFactor( float s, float t );
 void	R_InitImages( void );
 void	R_DeleteTextures( void );
+void	R_PreloadImage( const char *name );
+void	R_ClearPreloadedImages( void );
 int		R_SumOfUsedImages( void );
 void	R_InitSkins( void );
 skin_t	*R_GetSkinByHandle( qhandle_t hSkin );
 
-int R_ComputeLOD( trRefEntity_t *ent );
+int R_ComputeLOD( frontEndWork_t *work, trRefEntity_t *ent );
 
 const void *RB_TakeVideoFrameCmd( const void *data );
 
@@ -1253,6 +1347,7 @@ shader_t	*R_GetShaderByHandle( qhandle_t hShader );
 shader_t	*R_GetShaderByState( int index, long *cycleTime );
 shader_t *R_FindShaderByName( const char *name );
 void		R_InitShaders( void );
+void		R_PreloadShaderImages( const char *name );
 void		R_ShaderList_f( void );
 void    R_RemapShader(const char *oldShader, const char *newShader, const char *timeOffset);
 
@@ -1295,9 +1390,24 @@ typedef struct stageVars
 {
 	color4ub_t	colors[SHADER_MAX_VERTEXES];
 	vec2_t		texcoords[NUM_TEXTURE_BUNDLES][SHADER_MAX_VERTEXES];
+
+	// what is left to the backend instead, see glState.stageFeatures
+	qboolean	constantColor;			// color holds the color of every vertex
+	color4ub_t	color;
+	int			texGen[NUM_TEXTURE_BUNDLES];	// TCGEN_BAD when texcoords holds the result
+	qboolean	hasTexMatrix[NUM_TEXTURE_BUNDLES];
+	float		texMatrix[NUM_TEXTURE_BUNDLES][16];
 } stageVars_t;
 
 
+#define	MAX_VBO_RANGES	256
+
+typedef struct {
+	int			vbo;
+	int			firstIndex;
+	int			numIndexes;
+} vboRange_t;
+
 typedef struct shaderCommands_s 
 {
 	glIndex_t	indexes[SHADER_MAX_INDEXES] ALIGN(16);
@@ -1316,10 +1426,16 @@ typedef struct shaderCommands_s
 	int			fogNum;
 
 	int			dlightBits;	// or together of all vertexDlightBits
+	int			numMergedEntities;	// entity changes that didn't end the batch
 
 	int			numIndexes;
 	int			numVertexes;
 
+	// world surfaces already in buffer objects, drawn
+	// before the tessellated ones
+	int			numVBORanges;
+	vboRange_t	vboRanges[MAX_VBO_RANGES];
+
 	// info extracted from current shader
 	int			numPasses;
 	void		(*currentStageIteratorFunc)( void );
@@ -1352,10 +1468,15 @@ WORLD MAP
 ============================================================
 */
 
-void R_AddBrushModelSurfaces( trRefEntity_t *e );
+void R_AddBrushModelSurfaces( frontEndWork_t *work, trRefEntity_t *e );
 void R_AddWorldSurfaces( void );
 qboolean R_inPVS( const vec3_t p1, const vec3_t p2 );
 
+void R_CreateWorldVBOs( void );
+void R_ShutdownWorldVBOs( void );
+qboolean RB_AddWorldVBOSurface( int vbo, int firstIndex, int numIndexes, int dlightBits );
+void RB_DrawWorldVBOs( void );
+
 
 /*
 ============================================================
@@ -1379,7 +1500,7 @@ LIGHTS
 ============================================================
 */
 
-void R_DlightBmodel( bmodel_t *bmodel );
+void R_DlightBmodel( frontEndWork_t *work, bmodel_t *bmodel );
 void R_SetupEntityLighting( const trRefdef_t *refdef, trRefEntity_t *ent );
 void R_TransformDlights( int count, dlight_t *dl, orientationr_t *or );
 int R_LightForPoint( vec3_t point, vec3_t ambientLight, vec3_t directedLight, vec3_t lightDir );
@@ -1448,6 +1569,7 @@ SCENE GENERATION
 */
 
 void R_ToggleSmpFrame( void );
+void *R_FrameAlloc( int size );
 
 void RE_ClearScene( void );
 void RE_AddRefEntityToScene( const refEntity_t *ent );
@@ -1486,10 +1608,10 @@ ANIMATED MODELS
 */
 
 // void R_MakeAnimModel( model_t *model );      haven't seen this one really, so not needed I guess.
-void R_AddAnimSurfaces( trRefEntity_t *ent );
+void R_AddAnimSurfaces( frontEndWork_t *work, trRefEntity_t *ent );
 void RB_SurfaceAnim( md4Surface_t *surfType );
 #ifdef RAVENMD4
-void R_MDRAddAnimSurfaces( trRefEntity_t *ent );
+void R_MDRAddAnimSurfaces( frontEndWork_t *work, trRefEntity_t *ent );
 void RB_MDRSurfaceAnim( md4Surface_t *surface );
 #endif
 
@@ -1507,6 +1629,31 @@ void R_LoadPCX( const char *name, byte **pic, int *width, int *height );
 void R_LoadPNG( const char *name, byte **pic, int *width, int *height );
 void R_LoadTGA( const char *name, byte **pic, int *width, int *height );
 
+// decoding from memory, done for the loaders above and by the image
+// preloader on the job threads. Errors and warnings are returned in
+// the struct instead of going through ri.Error and ri.Printf.
+typedef struct {
+	const char	*name;
+	const byte	*buffer;
+	int			length;
+	void		*(*alloc)( int size );
+	void		(*free)( void *ptr );
+
+	byte		*pic;
+	int			width, height;
+	int			errorLevel;
+	char		error[256];			// set if decoding failed
+	char		warning[256];
+} imageDecode_t;
+
+void R_InitImageDecode( imageDecode_t *d, const char *name, const byte *buffer, int length,
+					void *(*alloc)( int size ), void (*free)( void *ptr ) );
+qboolean R_ImageDecodeError( imageDecode_t *d, int errorLevel, const char *fmt, ... ) __attribute__ ((format (printf, 3, 4)));
+void R_FinishImageDecode( imageDecode_t *d, byte **pic, int *width, int *height );
+
+qboolean R_DecodeJPG( imageDecode_t *d );
+qboolean R_DecodeTGA( imageDecode_t *d );
+
 /*
 =============================================================
 =============================================================
@@ -1516,19 +1663,27 @@ void	R_TransformModelToClip( const vec3_t src, const float *modelMatrix, const f
 void	R_TransformClipToWindow( const vec4_t clip, const viewParms_t *view, vec4_t normalized, vec4_t window );
 
 void	RB_DeformTessGeometry( void );
+qboolean RB_CalcDeformParams( const deformStage_t *ds, int *deform, int *wave, float params[4] );
 
 void	RB_CalcEnvironmentTexCoords( float *dstTexCoords );
 void	RB_CalcFogTexCoords( float *dstTexCoords );
+void	RB_CalcFogVectors( vec4_t fogDistanceVector, vec4_t fogDepthVector, float *eyeT );
 void	RB_CalcScrollTexCoords( const float scroll[2], float *dstTexCoords );
 void	RB_CalcRotateTexCoords( float rotSpeed, float *dstTexCoords );
 void	RB_CalcScaleTexCoords( const float scale[2], float *dstTexCoords );
 void	RB_CalcTurbulentTexCoords( const waveForm_t *wf, float *dstTexCoords );
 void	RB_CalcTransformTexCoords( const texModInfo_t *tmi, float *dstTexCoords );
+void	RB_CalcScrollTexMatrix( const float scroll[2], texModInfo_t *tmi );
+void	RB_CalcRotateTexMatrix( float rotSpeed, texModInfo_t *tmi );
+void	RB_CalcScaleTexMatrix( const float scale[2], texModInfo_t *tmi );
+void	RB_CalcStretchTexMatrix( const waveForm_t *wf, texModInfo_t *tmi );
 void	RB_CalcModulateColorsByFog( unsigned char *dstColors );
 void	RB_CalcModulateAlphasByFog( unsigned char *dstColors );
 void	RB_CalcModulateRGBAsByFog( unsigned char *dstColors );
 void	RB_CalcWaveAlpha( const waveForm_t *wf, unsigned char *dstColors );
 void	RB_CalcWaveColor( const waveForm_t *wf, unsigned char *dstColors );
+float	RB_CalcWaveAlphaSingle( const waveForm_t *wf );
+float	RB_CalcWaveColorSingle( const waveForm_t *wf );
 void	RB_CalcAlphaFromEntity( unsigned char *dstColors );
 void	RB_CalcAlphaFromOneMinusEntity( unsigned char *dstColors );
 void	RB_CalcStretchTexCoords( const waveForm_t *wf, float *texCoords );
@@ -1652,12 +1807,23 @@ typedef enum {
 } renderCommand_t;
 
 
-// these are sort of arbitrary limits.
-// the limits apply to the sum of all scenes in a frame --
+// the frame arena is never smaller than these, the
+// limits apply to the sum of all scenes in a frame --
 // the main view, all the 3D icons, etc
 #define	MAX_POLYS		600
 #define	MAX_POLYVERTS	3000
 
+// memory for the variable sized parts of a frame, reset when the
+// frame is toggled.  The srfPoly_t array grows up from the bottom
+// and R_FrameAlloc hands out everything else from the top, so the
+// polys and their verts share one budget instead of two counts
+typedef struct {
+	byte		*base;
+	int			size;
+	int			low;				// bytes of srfPoly_t at the bottom
+	int			high;				// bytes handed out from the top
+} frameArena_t;
+
 // all of the information needed by the back end must be
 // contained in a backEndData_t.  This entire structure is
 // duplicated so the front and back end can run in parallel
@@ -1666,14 +1832,11 @@ typedef struct {
 	drawSurf_t	drawSurfs[MAX_DRAWSURFS];
 	dlight_t	dlights[MAX_DLIGHTS];
 	trRefEntity_t	entities[MAX_ENTITIES];
-	srfPoly_t	*polys;//[MAX_POLYS];
-	polyVert_t	*polyVerts;//[MAX_POLYVERTS];
+	srfPoly_t	*polys;				// the bottom of the arena
+	frameArena_t	arena;
 	renderCommandList_t	commands;
 } backEndData_t;
 
-extern	int		max_polys;
-extern	int		max_polyverts;
-
 extern	backEndData_t	*backEndData[SMP_FRAMES];	// the second one may not be allocated
 
 extern	volatile renderCommandList_t	*renderCommandList;
@@ -1696,6 +1859,7 @@ void RE_StretchPic ( float x, float y, float w, float h,
 					  float s1, float t1, float s2, float t2, qhandle_t hShader );
 void RE_BeginFrame( stereoFrame_t stereoFrame );
 void RE_EndFrame( int *frontEndMsec, int *backEndMsec );
+void RE_PhaseTimes( qboolean report );
 void SaveJPG(char * filename, int quality, int image_width, int image_height, unsigned char *image_buffer);
 int SaveJPGToBuffer( byte *buffer, int quality,
 		int image_width, int image_height,
@@ -50,7 +50,7 @@ R_CullLocalBox
 Returns CULL_IN, CULL_CLIP, or CULL_OUT
 =================
 */
-int R_CullLocalBox (vec3_t bounds[2]) {
+int R_CullLocalBox (const orientationr_t *or, vec3_t bounds[2]) {
 	int		i, j;
 	vec3_t	transformed[8];
 	float	dists[8];
@@ -69,10 +69,10 @@ int R_CullLocalBox (vec3_t bounds[2]) {
 		v[1] = bounds[(i>>1)&1][1];
 		v[2] = bounds[(i>>2)&1][2];
 
-		VectorCopy( tr.or.origin, transformed[i] );
-		VectorMA( transformed[i], v[0], tr.or.axis[0], transformed[i] );
-		VectorMA( transformed[i], v[1], tr.or.axis[1], transformed[i] );
-		VectorMA( transformed[i], v[2], tr.or.axis[2], transformed[i] );
+		VectorCopy( or->origin, transformed[i] );
+		VectorMA( transformed[i], v[0], or->axis[0], transformed[i] );
+		VectorMA( transformed[i], v[1], or->axis[1], transformed[i] );
+		VectorMA( transformed[i], v[2], or->axis[2], transformed[i] );
 	}
 
 	// check against frustum planes
@@ -109,11 +109,11 @@ int R_CullLocalBox (vec3_t bounds[2]) {
 /*
 ** R_CullLocalPointAndRadius
 */
-int R_CullLocalPointAndRadius( vec3_t pt, float radius )
+int R_CullLocalPointAndRadius( const orientationr_t *or, vec3_t pt, float radius )
 {
 	vec3_t transformed;
 
-	R_LocalPointToWorld( pt, transformed );
+	R_LocalPointToWorld( or, pt, transformed );
 
 	return R_CullPointAndRadius( transformed, radius );
 }
@@ -175,10 +175,10 @@ R_LocalPointToWorld
 
 =================
 */
-void R_LocalPointToWorld (vec3_t local, vec3_t world) {
-	world[0] = local[0] * tr.or.axis[0][0] + local[1] * tr.or.axis[1][0] + local[2] * tr.or.axis[2][0] + tr.or.origin[0];
-	world[1] = local[0] * tr.or.axis[0][1] + local[1] * tr.or.axis[1][1] + local[2] * tr.or.axis[2][1] + tr.or.origin[1];
-	world[2] = local[0] * tr.or.axis[0][2] + local[1] * tr.or.axis[1][2] + local[2] * tr.or.axis[2][2] + tr.or.origin[2];
+void R_LocalPointToWorld (const orientationr_t *or, vec3_t local, vec3_t world) {
+	world[0] = local[0] * or->axis[0][0] + local[1] * or->axis[1][0] + local[2] * or->axis[2][0] + or->origin[0];
+	world[1] = local[0] * or->axis[0][1] + local[1] * or->axis[1][1] + local[2] * or->axis[2][1] + or->origin[1];
+	world[2] = local[0] * or->axis[0][2] + local[1] * or->axis[1][2] + local[2] * or->axis[2][2] + or->origin[2];
 }
 
 /*
@@ -1104,19 +1104,169 @@ static void R_RadixSort( drawSurf_t *source, int size )
 R_AddDrawSurf
 =================
 */
-void R_AddDrawSurf( surfaceType_t *surface, shader_t *shader, 
+void R_AddDrawSurf( frontEndWork_t *work, surfaceType_t *surface, shader_t *shader, 
 				   int fogIndex, int dlightMap ) {
 	int			index;
 
 	// instead of checking for overflow, we just mask the index
 	// so it wraps around
-	index = tr.refdef.numDrawSurfs & DRAWSURF_MASK;
+	index = work->numDrawSurfs & DRAWSURF_MASK;
 	// the sort data is packed into a single 32 bit value so it can be
 	// compared quickly during the qsorting process
-	tr.refdef.drawSurfs[index].sort = (shader->sortedIndex << QSORT_SHADERNUM_SHIFT) 
-		| tr.shiftedEntityNum | ( fogIndex << QSORT_FOGNUM_SHIFT ) | (int)dlightMap;
-	tr.refdef.drawSurfs[index].surface = surface;
-	tr.refdef.numDrawSurfs++;
+	work->drawSurfs[index].sort = (shader->sortedIndex << QSORT_SHADERNUM_SHIFT) 
+		| work->shiftedEntityNum | ( fogIndex << QSORT_FOGNUM_SHIFT ) | (int)dlightMap;
+	work->drawSurfs[index].surface = surface;
+	work->numDrawSurfs++;
+}
+
+/*
+=================
+R_NumFrontEndWork
+
+How many works the surfaces of a view are split between, one for
+the main thread and one for each job thread that has a buffer
+=================
+*/
+int R_NumFrontEndWork( void ) {
+	int		num;
+
+	if ( !r_parallelFrontEnd->integer ) {
+		return 1;
+	}
+
+	// jobs must not print
+	if ( r_debugLight->integer || r_developer->integer ) {
+		return 1;
+	}
+
+#ifndef __GNUC__
+	// R_AddWorldSurface needs an atomic compare and swap
+	return 1;
+#endif
+
+	num = 1 + ri.NumJobThreads();
+	if ( num > tr.numFrontEndWork ) {
+		num = tr.numFrontEndWork;
+	}
+	return num;
+}
+
+/*
+=================
+R_BeginFrontEndWork
+
+Starts adding surfaces for entityNum, ENTITYNUM_WORLD for the world
+=================
+*/
+void R_BeginFrontEndWork( frontEndWork_t *work, int entityNum ) {
+	work->numDrawSurfs = 0;
+	ClearBounds( work->visBounds[0], work->visBounds[1] );
+	Com_Memset( &work->pc, 0, sizeof( work->pc ) );
+	work->error = NULL;
+
+	work->currentEntityNum = entityNum;
+	work->shiftedEntityNum = entityNum << QSORT_ENTITYNUM_SHIFT;
+	if ( entityNum == ENTITYNUM_WORLD ) {
+		work->currentEntity = &tr.worldEntity;
+		work->or = tr.viewParms.world;
+	}
+}
+
+/*
+=================
+R_MergeFrontEndWork
+
+Appends the surfaces of a finished work to tr.refdef, in the
+order they were added. Errors recorded by the work are left to
+the caller, which must finish all its jobs before raising them
+=================
+*/
+void R_MergeFrontEndWork( frontEndWork_t *work ) {
+	frontEndCounters_t	*pc;
+	int					i, num, index;
+
+	// a work that wrapped around kept only the last MAX_DRAWSURFS
+	num = work->numDrawSurfs;
+	if ( num > MAX_DRAWSURFS ) {
+		tr.pc.c_droppedDrawSurfs += num - MAX_DRAWSURFS;
+		num = MAX_DRAWSURFS;
+	}
+
+	for ( i = work->numDrawSurfs - num ; i < work->numDrawSurfs ; i++ ) {
+		index = tr.refdef.numDrawSurfs & DRAWSURF_MASK;
+		tr.refdef.drawSurfs[index] = work->drawSurfs[i & DRAWSURF_MASK];
+		tr.refdef.numDrawSurfs++;
+	}
+
+	for ( i = 0 ; i < 3 ; i++ ) {
+		if ( work->visBounds[0][i] < tr.viewParms.visBounds[0][i] ) {
+			tr.viewParms.visBounds[0][i] = work->visBounds[0][i];
+		}
+		if ( work->visBounds[1][i] > tr.viewParms.visBounds[1][i] ) {
+			tr.viewParms.visBounds[1][i] = work->visBounds[1][i];
+		}
+	}
+
+	pc = &work->pc;
+	tr.pc.c_sphere_cull_patch_in += pc->c_sphere_cull_patch_in;
+	tr.pc.c_sphere_cull_patch_clip += pc->c_sphere_cull_patch_clip;
+	tr.pc.c_sphere_cull_patch_out += pc->c_sphere_cull_patch_out;
+	tr.pc.c_box_cull_patch_in += pc->c_box_cull_patch_in;
+	tr.pc.c_box_cull_patch_clip += pc->c_box_cull_patch_clip;
+	tr.pc.c_box_cull_patch_out += pc->c_box_cull_patch_out;
+	tr.pc.c_sphere_cull_md3_in += pc->c_sphere_cull_md3_in;
+	tr.pc.c_sphere_cull_md3_clip += pc->c_sphere_cull_md3_clip;
+	tr.pc.c_sphere_cull_md3_out += pc->c_sphere_cull_md3_out;
+	tr.pc.c_box_cull_md3_in += pc->c_box_cull_md3_in;
+	tr.pc.c_box_cull_md3_clip += pc->c_box_cull_md3_clip;
+	tr.pc.c_box_cull_md3_out += pc->c_box_cull_md3_out;
+	tr.pc.c_leafs += pc->c_leafs;
+	tr.pc.c_dlightSurfaces += pc->c_dlightSurfaces;
+	tr.pc.c_dlightSurfacesCulled += pc->c_dlightSurfacesCulled;
+}
+
+/*
+=================
+R_RunFrontEndWork
+
+Calls function for the first numWork works, all but the first one
+on the job threads, and merges them in order. Each work is told
+to take every numWork'th piece of the view starting at its index.
+=================
+*/
+void R_RunFrontEndWork( int numWork, void (*function)( void *data ) ) {
+	frontEndWork_t	*work;
+	int				i;
+
+	// queue the jobs before the main thread starts on its own
+	for ( i = numWork - 1 ; i >= 0 ; i-- ) {
+		work = &tr.frontEndWork[i];
+		R_BeginFrontEndWork( work, ENTITYNUM_WORLD );
+		work->shared = ( numWork > 1 );
+		work->index = i;
+		work->step = numWork;
+		work->job.function = function;
+		work->job.data = work;
+		if ( i && ri.AddJob( &work->job ) ) {
+			continue;
+		}
+		function( work );
+	}
+
+	// nothing may leave this function while a job is still running
+	for ( i = 0 ; i < numWork ; i++ ) {
+		ri.FinishJob( &tr.frontEndWork[i].job );
+	}
+
+	for ( i = 0 ; i < numWork ; i++ ) {
+		if ( tr.frontEndWork[i].error ) {
+			ri.Error( ERR_DROP, "%s", tr.frontEndWork[i].error );
+		}
+	}
+
+	for ( i = 0 ; i < numWork ; i++ ) {
+		R_MergeFrontEndWork( &tr.frontEndWork[i] );
+	}
 }
 
 /*
@@ -1143,6 +1293,7 @@ void R_SortDrawSurfs( drawSurf_t *drawSurfs, int numDrawSurfs ) {
 	int				entityNum;
 	int				dlighted;
 	int				i;
+	unsigned		start = 0;
 
 	// it is possible for some views to not have any surfaces
 	if ( numDrawSurfs < 1 ) {
@@ -1155,12 +1306,21 @@ void R_SortDrawSurfs( drawSurf_t *drawSurfs, int numDrawSurfs ) {
 	// wrapped around in the buffer and we will be missing
 	// the first surfaces, not the last ones
 	if ( numDrawSurfs > MAX_DRAWSURFS ) {
+		tr.pc.c_droppedDrawSurfs += numDrawSurfs - MAX_DRAWSURFS;
 		numDrawSurfs = MAX_DRAWSURFS;
 	}
 
 	// sort the drawsurfs by sort type, then orientation, then shader
+	if ( tr.phaseTiming ) {
+		start = ri.Microseconds();
+	}
+
 	R_RadixSort( drawSurfs, numDrawSurfs );
 
+	if ( tr.phaseTiming ) {
+		tr.phaseUsec[RP_SORT] += ri.Microseconds() - start;
+	}
+
 	// check for any pass through drawing, which
 	// may cause another view to be rendered first
 	for ( i = 0 ; i < numDrawSurfs ; i++ ) {
@@ -1190,96 +1350,129 @@ void R_SortDrawSurfs( drawSurf_t *drawSurfs, int numDrawSurfs ) {
 
 /*
 =============
-R_AddEntitySurfaces
+R_AddEntitySurface
 =============
 */
-void R_AddEntitySurfaces (void) {
+static void R_AddEntitySurface( frontEndWork_t *work, int entityNum ) {
 	trRefEntity_t	*ent;
 	shader_t		*shader;
 
-	if ( !r_drawentities->integer ) {
-		return;
-	}
+	ent = work->currentEntity = &tr.refdef.entities[entityNum];
 
-	for ( tr.currentEntityNum = 0; 
-	      tr.currentEntityNum < tr.refdef.num_entities; 
-		  tr.currentEntityNum++ ) {
-		ent = tr.currentEntity = &tr.refdef.entities[tr.currentEntityNum];
+	ent->needDlights = qfalse;
 
-		ent->needDlights = qfalse;
+	// preshift the value we are going to OR into the drawsurf sort
+	work->currentEntityNum = entityNum;
+	work->shiftedEntityNum = entityNum << QSORT_ENTITYNUM_SHIFT;
 
-		// preshift the value we are going to OR into the drawsurf sort
-		tr.shiftedEntityNum = tr.currentEntityNum << QSORT_ENTITYNUM_SHIFT;
+	//
+	// the weapon model must be handled special --
+	// we don't want the hacked weapon position showing in 
+	// mirrors, because the true body position will already be drawn
+	//
+	if ( (ent->e.renderfx & RF_FIRST_PERSON) && tr.viewParms.isPortal) {
+		return;
+	}
 
-		//
-		// the weapon model must be handled special --
-		// we don't want the hacked weapon position showing in 
-		// mirrors, because the true body position will already be drawn
-		//
-		if ( (ent->e.renderfx & RF_FIRST_PERSON) && tr.viewParms.isPortal) {
-			continue;
+	// simple generated models, like sprites and beams, are not culled
+	switch ( ent->e.reType ) {
+	case RT_PORTALSURFACE:
+		break;		// don't draw anything
+	case RT_SPRITE:
+	case RT_BEAM:
+	case RT_LIGHTNING:
+	case RT_RAIL_CORE:
+	case RT_RAIL_RINGS:
+		// self blood sprites, talk balloons, etc should not be drawn in the primary
+		// view.  We can't just do this check for all entities, because md3
+		// entities may still want to cast shadows from them
+		if ( (ent->e.renderfx & RF_THIRD_PERSON) && !tr.viewParms.isPortal) {
+			return;
 		}
+		shader = R_GetShaderByHandle( ent->e.customShader );
+		R_AddDrawSurf( work, &entitySurface, shader, R_SpriteFogNum( ent ), 0 );
+		break;
 
-		// simple generated models, like sprites and beams, are not culled
-		switch ( ent->e.reType ) {
-		case RT_PORTALSURFACE:
-			break;		// don't draw anything
-		case RT_SPRITE:
-		case RT_BEAM:
-		case RT_LIGHTNING:
-		case RT_RAIL_CORE:
-		case RT_RAIL_RINGS:
-			// self blood sprites, talk balloons, etc should not be drawn in the primary
-			// view.  We can't just do this check for all entities, because md3
-			// entities may still want to cast shadows from them
-			if ( (ent->e.renderfx & RF_THIRD_PERSON) && !tr.viewParms.isPortal) {
-				continue;
-			}
-			shader = R_GetShaderByHandle( ent->e.customShader );
-			R_AddDrawSurf( &entitySurface, shader, R_SpriteFogNum( ent ), 0 );
-			break;
-
-		case RT_MODEL:
-			// we must set up parts of tr.or for model culling
-			R_RotateForEntity( ent, &tr.viewParms, &tr.or );
+	case RT_MODEL:
+		// we must set up parts of work->or for model culling
+		R_RotateForEntity( ent, &tr.viewParms, &work->or );
 
-			tr.currentModel = R_GetModelByHandle( ent->e.hModel );
-			if (!tr.currentModel) {
-				R_AddDrawSurf( &entitySurface, tr.defaultShader, 0, 0 );
-			} else {
-				switch ( tr.currentModel->type ) {
-				case MOD_MESH:
-					R_AddMD3Surfaces( ent );
-					break;
-				case MOD_MD4:
-					R_AddAnimSurfaces( ent );
-					break;
+		work->currentModel = R_GetModelByHandle( ent->e.hModel );
+		if (!work->currentModel) {
+			R_AddDrawSurf( work, &entitySurface, tr.defaultShader, 0, 0 );
+		} else {
+			switch ( work->currentModel->type ) {
+			case MOD_MESH:
+				R_AddMD3Surfaces( work, ent );
+				break;
+			case MOD_MD4:
+				R_AddAnimSurfaces( work, ent );
+				break;
 #ifdef RAVENMD4
-				case MOD_MDR:
-					R_MDRAddAnimSurfaces( ent );
-					break;
+			case MOD_MDR:
+				R_MDRAddAnimSurfaces( work, ent );
+				break;
 #endif
-				case MOD_BRUSH:
-					R_AddBrushModelSurfaces( ent );
-					break;
-				case MOD_BAD:		// null model axis
-					if ( (ent->e.renderfx & RF_THIRD_PERSON) && !tr.viewParms.isPortal) {
-						break;
-					}
-					shader = R_GetShaderByHandle( ent->e.customShader );
-					R_AddDrawSurf( &entitySurface, tr.defaultShader, 0, 0 );
-					break;
-				default:
-					ri.Error( ERR_DROP, "R_AddEntitySurfaces: Bad modeltype" );
+			case MOD_BRUSH:
+				R_AddBrushModelSurfaces( work, ent );
+				break;
+			case MOD_BAD:		// null model axis
+				if ( (ent->e.renderfx & RF_THIRD_PERSON) && !tr.viewParms.isPortal) {
 					break;
 				}
+				R_AddDrawSurf( work, &entitySurface, tr.defaultShader, 0, 0 );
+				break;
+			default:
+				work->error = "R_AddEntitySurfaces: Bad modeltype";
+				break;
 			}
-			break;
-		default:
-			ri.Error( ERR_DROP, "R_AddEntitySurfaces: Bad reType" );
 		}
+		break;
+	default:
+		work->error = "R_AddEntitySurfaces: Bad reType";
+		break;
 	}
+}
 
+/*
+=============
+R_EntitySurfacesJob
+
+Runs on a job thread
+=============
+*/
+static void R_EntitySurfacesJob( void *data ) {
+	frontEndWork_t	*work = data;
+	int				i;
+
+	for ( i = work->index ; i < tr.refdef.num_entities && !work->error ; i += work->step ) {
+		R_AddEntitySurface( work, i );
+	}
+}
+
+/*
+=============
+R_AddEntitySurfaces
+=============
+*/
+void R_AddEntitySurfaces (void) {
+	trRefEntity_t	*ent;
+	int				i, numWork;
+
+	if ( !r_drawentities->integer ) {
+		return;
+	}
+
+	numWork = R_NumFrontEndWork();
+
+	// R_GetShaderByHandle warns about bad handles, not from the jobs
+	for ( i = 0, ent = tr.refdef.entities ; i < tr.refdef.num_entities && numWork > 1 ; i++, ent++ ) {
+		if ( ent->e.customShader < 0 || ent->e.customShader >= tr.numShaders ) {
+			numWork = 1;
+		}
+	}
+
+	R_RunFrontEndWork( numWork, R_EntitySurfacesJob );
 }
 
 
@@ -1289,9 +1482,24 @@ R_GenerateDrawSurfs
 ====================
 */
 void R_GenerateDrawSurfs( void ) {
+	frontEndWork_t	*work;
+	unsigned		start = 0;
+
+	if ( tr.phaseTiming ) {
+		start = ri.Microseconds();
+	}
+
 	R_AddWorldSurfaces ();
 
-	R_AddPolygonSurfaces();
+	if ( tr.phaseTiming ) {
+		tr.phaseUsec[RP_WORLD] += ri.Microseconds() - start;
+	}
+
+	work = &tr.frontEndWork[0];
+	R_BeginFrontEndWork( work, ENTITYNUM_WORLD );
+	work->shared = qfalse;
+	R_AddPolygonSurfaces( work );
+	R_MergeFrontEndWork( work );
 
 	// set the projection matrix with the minimum zfar
 	// now that we have the world bounded
@@ -1305,7 +1513,15 @@ void R_GenerateDrawSurfs( void ) {
 	// we know the size of the clipping volume. Now set the rest of the projection matrix.
 	R_SetupProjectionZ (&tr.viewParms);
 
+	if ( tr.phaseTiming ) {
+		start = ri.Microseconds();
+	}
+
 	R_AddEntitySurfaces ();
+
+	if ( tr.phaseTiming ) {
+		tr.phaseUsec[RP_ENTITIES] += ri.Microseconds() - start;
+	}
 }
 
 /*
@@ -75,7 +75,7 @@ static float ProjectRadius( float r, vec3_t location )
 R_CullModel
 =============
 */
-static int R_CullModel( md3Header_t *header, trRefEntity_t *ent ) {
+static int R_CullModel( frontEndWork_t *work, md3Header_t *header, trRefEntity_t *ent ) {
 	vec3_t		bounds[2];
 	md3Frame_t	*oldFrame, *newFrame;
 	int			i;
@@ -89,18 +89,18 @@ static int R_CullModel( md3Header_t *header, trRefEntity_t *ent ) {
 	{
 		if ( ent->e.frame == ent->e.oldframe )
 		{
-			switch ( R_CullLocalPointAndRadius( newFrame->localOrigin, newFrame->radius ) )
+			switch ( R_CullLocalPointAndRadius( &work->or, newFrame->localOrigin, newFrame->radius ) )
 			{
 			case CULL_OUT:
-				tr.pc.c_sphere_cull_md3_out++;
+				work->pc.c_sphere_cull_md3_out++;
 				return CULL_OUT;
 
 			case CULL_IN:
-				tr.pc.c_sphere_cull_md3_in++;
+				work->pc.c_sphere_cull_md3_in++;
 				return CULL_IN;
 
 			case CULL_CLIP:
-				tr.pc.c_sphere_cull_md3_clip++;
+				work->pc.c_sphere_cull_md3_clip++;
 				break;
 			}
 		}
@@ -108,28 +108,28 @@ static int R_CullModel( md3Header_t *header, trRefEntity_t *ent ) {
 		{
 			int sphereCull, sphereCullB;
 
-			sphereCull  = R_CullLocalPointAndRadius( newFrame->localOrigin, newFrame->radius );
+			sphereCull  = R_CullLocalPointAndRadius( &work->or, newFrame->localOrigin, newFrame->radius );
 			if ( newFrame == oldFrame ) {
 				sphereCullB = sphereCull;
 			} else {
-				sphereCullB = R_CullLocalPointAndRadius( oldFrame->localOrigin, oldFrame->radius );
+				sphereCullB = R_CullLocalPointAndRadius( &work->or, oldFrame->localOrigin, oldFrame->radius );
 			}
 
 			if ( sphereCull == sphereCullB )
 			{
 				if ( sphereCull == CULL_OUT )
 				{
-					tr.pc.c_sphere_cull_md3_out++;
+					work->pc.c_sphere_cull_md3_out++;
 					return CULL_OUT;
 				}
 				else if ( sphereCull == CULL_IN )
 				{
-					tr.pc.c_sphere_cull_md3_in++;
+					work->pc.c_sphere_cull_md3_in++;
 					return CULL_IN;
 				}
 				else
 				{
-					tr.pc.c_sphere_cull_md3_clip++;
+					work->pc.c_sphere_cull_md3_clip++;
 				}
 			}
 		}
@@ -141,17 +141,17 @@ static int R_CullModel( md3Header_t *header, trRefEntity_t *ent ) {
 		bounds[1][i] = oldFrame->bounds[1][i] > newFrame->bounds[1][i] ? oldFrame->bounds[1][i] : newFrame->bounds[1][i];
 	}
 
-	switch ( R_CullLocalBox( bounds ) )
+	switch ( R_CullLocalBox( &work->or, bounds ) )
 	{
 	case CULL_IN:
-		tr.pc.c_box_cull_md3_in++;
+		work->pc.c_box_cull_md3_in++;
 		return CULL_IN;
 	case CULL_CLIP:
-		tr.pc.c_box_cull_md3_clip++;
+		work->pc.c_box_cull_md3_clip++;
 		return CULL_CLIP;
 	case CULL_OUT:
 	default:
-		tr.pc.c_box_cull_md3_out++;
+		work->pc.c_box_cull_md3_out++;
 		return CULL_OUT;
 	}
 }
@@ -163,7 +163,7 @@ R_ComputeLOD
 
 =================
 */
-int R_ComputeLOD( trRefEntity_t *ent ) {
+int R_ComputeLOD( frontEndWork_t *work, trRefEntity_t *ent ) {
 	float radius;
 	float flod, lodscale;
 	float projectedRadius;
@@ -174,7 +174,7 @@ int R_ComputeLOD( trRefEntity_t *ent ) {
 #endif
 	int lod;
 
-	if ( tr.currentModel->numLods < 2 )
+	if ( work->currentModel->numLods < 2 )
 	{
 		// model has only 1 LOD level, skip computations and bias
 		lod = 0;
@@ -187,10 +187,10 @@ int R_ComputeLOD( trRefEntity_t *ent ) {
 #ifdef RAVENMD4
 		// This is an MDR model.
 		
-		if(tr.currentModel->md4)
+		if(work->currentModel->md4)
 		{
 			int frameSize;
-			mdr = (mdrHeader_t *) tr.currentModel->md4;
+			mdr = (mdrHeader_t *) work->currentModel->md4;
 			frameSize = (size_t) (&((mdrFrame_t *)0)->bones[mdr->numBones]);
 			
 			mdrframe = (mdrFrame_t *) ((byte *) mdr + mdr->ofsFrames + frameSize * ent->e.frame);
@@ -200,7 +200,7 @@ int R_ComputeLOD( trRefEntity_t *ent ) {
 		else
 #endif
 		{
-			frame = ( md3Frame_t * ) ( ( ( unsigned char * ) tr.currentModel->md3[0] ) + tr.currentModel->md3[0]->ofsFrames );
+			frame = ( md3Frame_t * ) ( ( ( unsigned char * ) work->currentModel->md3[0] ) + work->currentModel->md3[0]->ofsFrames );
 
 			frame += ent->e.frame;
 
@@ -219,23 +219,23 @@ int R_ComputeLOD( trRefEntity_t *ent ) {
 			flod = 0;
 		}
 
-		flod *= tr.currentModel->numLods;
+		flod *= work->currentModel->numLods;
 		lod = myftol( flod );
 
 		if ( lod < 0 )
 		{
 			lod = 0;
 		}
-		else if ( lod >= tr.currentModel->numLods )
+		else if ( lod >= work->currentModel->numLods )
 		{
-			lod = tr.currentModel->numLods - 1;
+			lod = work->currentModel->numLods - 1;
 		}
 	}
 
 	lod += r_lodbias->integer;
 	
-	if ( lod >= tr.currentModel->numLods )
-		lod = tr.currentModel->numLods - 1;
+	if ( lod >= work->currentModel->numLods )
+		lod = work->currentModel->numLods - 1;
 	if ( lod < 0 )
 		lod = 0;
 
@@ -285,7 +285,7 @@ R_AddMD3Surfaces
 
 =================
 */
-void R_AddMD3Surfaces( trRefEntity_t *ent ) {
+void R_AddMD3Surfaces( frontEndWork_t *work, trRefEntity_t *ent ) {
 	int				i;
 	md3Header_t		*header = NULL;
 	md3Surface_t	*surface = NULL;
@@ -300,8 +300,8 @@ void R_AddMD3Surfaces( trRefEntity_t *ent ) {
 	personalModel = (ent->e.renderfx & RF_THIRD_PERSON) && !tr.viewParms.isPortal;
 
 	if ( ent->e.renderfx & RF_WRAP_FRAMES ) {
-		ent->e.frame %= tr.currentModel->md3[0]->numFrames;
-		ent->e.oldframe %= tr.currentModel->md3[0]->numFrames;
+		ent->e.frame %= work->currentModel->md3[0]->numFrames;
+		ent->e.oldframe %= work->currentModel->md3[0]->numFrames;
 	}
 
 	//
@@ -310,13 +310,13 @@ void R_AddMD3Surfaces( trRefEntity_t *ent ) {
 	// when the surfaces are rendered, they don't need to be
 	// range checked again.
 	//
-	if ( (ent->e.frame >= tr.currentModel->md3[0]->numFrames) 
+	if ( (ent->e.frame >= work->currentModel->md3[0]->numFrames) 
 		|| (ent->e.frame < 0)
-		|| (ent->e.oldframe >= tr.currentModel->md3[0]->numFrames)
+		|| (ent->e.oldframe >= work->currentModel->md3[0]->numFrames)
 		|| (ent->e.oldframe < 0) ) {
 			ri.Printf( PRINT_DEVELOPER, "R_AddMD3Surfaces: no such frame %d to %d for '%s'\n",
 				ent->e.oldframe, ent->e.frame,
-				tr.currentModel->name );
+				work->currentModel->name );
 			ent->e.frame = 0;
 			ent->e.oldframe = 0;
 	}
@@ -324,15 +324,15 @@ void R_AddMD3Surfaces( trRefEntity_t *ent ) {
 	//
 	// compute LOD
 	//
-	lod = R_ComputeLOD( ent );
+	lod = R_ComputeLOD( work, ent );
 
-	header = tr.currentModel->md3[lod];
+	header = work->currentModel->md3[lod];
 
 	//
 	// cull the entire model if merged bounding box of both frames
 	// is outside the view frustum.
 	//
-	cull = R_CullModel ( header, ent );
+	cull = R_CullModel ( work, header, ent );
 	if ( cull == CULL_OUT ) {
 		return;
 	}
@@ -395,7 +395,7 @@ void R_AddMD3Surfaces( trRefEntity_t *ent ) {
 			&& fogNum == 0
 			&& !(ent->e.renderfx & ( RF_NOSHADOW | RF_DEPTHHACK ) ) 
 			&& shader->sort == SS_OPAQUE ) {
-			R_AddDrawSurf( (void *)surface, tr.shadowShader, 0, qfalse );
+			R_AddDrawSurf( work, (void *)surface, tr.shadowShader, 0, qfalse );
 		}
 
 		// projection shadows work fine with personal models
@@ -403,12 +403,12 @@ void R_AddMD3Surfaces( trRefEntity_t *ent ) {
 			&& fogNum == 0
 			&& (ent->e.renderfx & RF_SHADOW_PLANE )
 			&& shader->sort == SS_OPAQUE ) {
-			R_AddDrawSurf( (void *)surface, tr.projectionShadowShader, 0, qfalse );
+			R_AddDrawSurf( work, (void *)surface, tr.projectionShadowShader, 0, qfalse );
 		}
 
 		// don't add third_person objects if not viewing through a portal
 		if ( !personalModel ) {
-			R_AddDrawSurf( (void *)surface, shader, fogNum, qfalse );
+			R_AddDrawSurf( work, (void *)surface, shader, fogNum, qfalse );
 		}
 
 		surface = (md3Surface_t *)( (byte *)surface + surface->ofsEnd );
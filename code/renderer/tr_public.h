@@ -82,6 +82,10 @@ typedef struct {
 	// if the pointers are not NULL, timing info will be returned
 	void	(*EndFrame)( int *frontEndMsec, int *backEndMsec );
 
+	// qfalse starts timing the renderer phases, qtrue prints the
+	// milliseconds per frame each took since then and stops
+	void	(*PhaseTimes)( qboolean report );
+
 
 	int		(*MarkFragments)( int numPoints, const vec3_t *points, const vec3_t projection,
 				   int maxPoints, vec3_t pointBuffer, int maxFragments, markFragment_t *fragmentBuffer );
@@ -114,14 +118,11 @@ typedef struct {
 	// milliseconds should only be used for profiling, never
 	// for anything game related.  Get time from the refdef
 	int		(*Milliseconds)( void );
+	unsigned	(*Microseconds)( void );
 
 	// stack based memory allocation for per-level things that
 	// won't be freed
-#ifdef HUNK_DEBUG
-	void	*(*Hunk_AllocDebug)( int size, ha_pref pref, char *label, char *file, int line );
-#else
-	void	*(*Hunk_Alloc)( int size, ha_pref pref );
-#endif
+	void	*(*Hunk_AllocLabel)( int size, ha_pref pref, const char *label, const char *file, int line );
 	void	*(*Hunk_AllocateTempMemory)( int size );
 	void	(*Hunk_FreeTempMemory)( void *block );
 
@@ -149,6 +150,13 @@ typedef struct {
 	int		(*FS_FileIsInPAK)( const char *name, int *pCheckSum );
 	int		(*FS_ReadFile)( const char *name, void **buf );
 	void	(*FS_FreeFile)( void *buf );
+	// read-only, not zero terminated, possibly straight from a mapped pk3
+	int		(*FS_MapFile)( const char *name, const void **buf );
+	void	(*FS_FreeMappedFile)( const void *buf );
+	// FS_BackgroundRead is the only one that may be called from a job
+	int		(*FS_OpenBackgroundRead)( const char *name, backgroundRead_t *read );
+	qboolean (*FS_BackgroundRead)( backgroundRead_t *read, void *buffer );
+	void	(*FS_CloseBackgroundRead)( backgroundRead_t *read );
 	char **	(*FS_ListFiles)( const char *name, const char *extension, int *numfilesfound );
 	void	(*FS_FreeFileList)( char **filelist );
 	void	(*FS_WriteFile)( const char *qpath, const void *buffer, int size );
@@ -160,6 +168,12 @@ typedef struct {
 	e_status (*CIN_RunCinematic) (int handle);
 
 	void	(*CL_WriteAVIVideoFrame)( const byte *buffer, int size );
+
+	// work on the job threads, AddJob returns qfalse if there are none
+	int		(*NumJobThreads)( void );
+	qboolean (*AddJob)( job_t *job );
+	void	(*FinishJob)( job_t *job );
+	qboolean (*CancelJob)( job_t *job );
 } refimport_t;
 
 
@@ -33,8 +33,6 @@ int			r_firstSceneEntity;
 int			r_numpolys;
 int			r_firstScenePoly;
 
-int			r_numpolyverts;
-
 
 /*
 ====================
@@ -52,6 +50,8 @@ void R_ToggleSmpFrame( void ) {
 	}
 
 	backEndData[tr.smpFrame]->commands.used = 0;
+	backEndData[tr.smpFrame]->arena.low = 0;
+	backEndData[tr.smpFrame]->arena.high = 0;
 
 	r_firstSceneDrawSurf = 0;
 
@@ -63,8 +63,27 @@ void R_ToggleSmpFrame( void ) {
 
 	r_numpolys = 0;
 	r_firstScenePoly = 0;
+}
 
-	r_numpolyverts = 0;
+/*
+====================
+R_FrameAlloc
+
+Memory that is only needed until this frame has been rendered,
+NULL if the frame arena is full
+====================
+*/
+void *R_FrameAlloc( int size ) {
+	frameArena_t	*arena;
+
+	arena = &backEndData[tr.smpFrame]->arena;
+	size = PAD( size, 16 );
+	if ( arena->low + arena->high + size > arena->size ) {
+		return NULL;
+	}
+	arena->high += size;
+
+	return arena->base + arena->size - arena->high;
 }
 
 
@@ -92,20 +111,18 @@ DISCRETE POLYS
 =====================
 R_AddPolygonSurfaces
 
-Adds all the scene's polys into this view's drawsurf list
+Adds all the scene's polys into this view's drawsurf list,
+through a work begun for ENTITYNUM_WORLD
 =====================
 */
-void R_AddPolygonSurfaces( void ) {
+void R_AddPolygonSurfaces( frontEndWork_t *work ) {
 	int			i;
 	shader_t	*sh;
 	srfPoly_t	*poly;
 
-	tr.currentEntityNum = ENTITYNUM_WORLD;
-	tr.shiftedEntityNum = tr.currentEntityNum << QSORT_ENTITYNUM_SHIFT;
-
 	for ( i = 0, poly = tr.refdef.polys; i < tr.refdef.numPolys ; i++, poly++ ) {
 		sh = R_GetShaderByHandle( poly->hShader );
-		R_AddDrawSurf( ( void * )poly, sh, poly->fogIndex, qfalse );
+		R_AddDrawSurf( work, ( void * )poly, sh, poly->fogIndex, qfalse );
 	}
 }
 
@@ -117,6 +134,7 @@ RE_AddPolyToScene
 */
 void RE_AddPolyToScene( qhandle_t hShader, int numVerts, const polyVert_t *verts, int numPolys ) {
 	srfPoly_t	*poly;
+	frameArena_t	*arena;
 	int			i, j;
 	int			fogIndex;
 	fog_t		*fog;
@@ -131,23 +149,27 @@ void RE_AddPolyToScene( qhandle_t hShader, int numVerts, const polyVert_t *verts
 		return;
 	}
 
+	arena = &backEndData[tr.smpFrame]->arena;
+
 	for ( j = 0; j < numPolys; j++ ) {
-		if ( r_numpolyverts + numVerts > max_polyverts || r_numpolys >= max_polys ) {
+		if ( arena->low + sizeof( *poly ) + PAD( numVerts * sizeof( *verts ), 16 ) + arena->high > arena->size ) {
       /*
       NOTE TTimo this was initially a PRINT_WARNING
       but it happens a lot with high fighting scenes and particles
       since we don't plan on changing the const and making for room for those effects
       simply cut this message to developer only
       */
-			ri.Printf( PRINT_DEVELOPER, "WARNING: RE_AddPolyToScene: r_max_polys or r_max_polyverts reached\n");
+			ri.Printf( PRINT_DEVELOPER, "WARNING: RE_AddPolyToScene: r_frameArenaKB reached\n");
+			tr.pc.c_droppedPolys += numPolys - j;
 			return;
 		}
 
 		poly = &backEndData[tr.smpFrame]->polys[r_numpolys];
+		arena->low += sizeof( *poly );
 		poly->surfaceType = SF_POLY;
 		poly->hShader = hShader;
 		poly->numVerts = numVerts;
-		poly->verts = &backEndData[tr.smpFrame]->polyVerts[r_numpolyverts];
+		poly->verts = R_FrameAlloc( numVerts * sizeof( *verts ) );
 		
 		Com_Memcpy( poly->verts, &verts[numVerts*j], numVerts * sizeof( *verts ) );
 
@@ -159,7 +181,6 @@ void RE_AddPolyToScene( qhandle_t hShader, int numVerts, const polyVert_t *verts
 		}
 		// done.
 		r_numpolys++;
-		r_numpolyverts += numVerts;
 
 		// if no world is loaded
 		if ( tr.world == NULL ) {
@@ -209,6 +230,7 @@ void RE_AddRefEntityToScene( const refEntity_t *ent ) {
 		return;
 	}
 	if ( r_numentities >= MAX_ENTITIES ) {
+		tr.pc.c_droppedEntities++;
 		return;
 	}
 	if ( ent->reType < 0 || ent->reType >= RT_MAX_REF_ENTITY_TYPE ) {
@@ -235,6 +257,7 @@ void RE_AddDynamicLightToScene( const vec3_t org, float intensity, float r, floa
 		return;
 	}
 	if ( r_numdlights >= MAX_DLIGHTS ) {
+		tr.pc.c_droppedDlights++;
 		return;
 	}
 	if ( intensity <= 0 ) {
@@ -287,6 +310,7 @@ to handle mirrors,
 void RE_RenderScene( const refdef_t *fd ) {
 	viewParms_t		parms;
 	int				startTime;
+	unsigned		phaseStart;
 
 	if ( !tr.registered ) {
 		return;
@@ -298,6 +322,7 @@ void RE_RenderScene( const refdef_t *fd ) {
 	}
 
 	startTime = ri.Milliseconds();
+	phaseStart = tr.phaseTiming ? ri.Microseconds() : 0;
 
 	if (!tr.world && !( fd->rdflags & RDF_NOWORLDMODEL ) ) {
 		ri.Error (ERR_DROP, "R_RenderScene: NULL worldmodel");
@@ -407,4 +432,7 @@ void RE_RenderScene( const refdef_t *fd ) {
 	r_firstScenePoly = r_numpolys;
 
 	tr.frontEndMsec += ri.Milliseconds() - startTime;
+	if ( tr.phaseTiming ) {
+		tr.phaseUsec[RP_FRONTEND] += ri.Microseconds() - phaseStart;
+	}
 }
@@ -45,6 +45,7 @@ without compiled vertex arrays.
 static void R_DrawElements( int numIndexes, const glIndex_t* indexes )
 {
 	qglDrawElements(GL_TRIANGLES, numIndexes, GL_INDEX_TYPE, indexes);
+	backEnd.pc.c_draws++;
 }
 
 
@@ -92,6 +93,262 @@ static void R_BindAnimatedImage( textureBundle_t *bundle ) {
 	GL_Bind( bundle->image[ index ] );
 }
 
+/*
+=================
+SetNormalArray
+
+The backend reads the normals for environment mapping on either
+unit and for all deforms but move
+=================
+*/
+static void SetNormalArray( void ) {
+	qboolean	normals;
+	int			i;
+
+	normals = ( glState.texGen[0] == TCGEN_ENVIRONMENT_MAPPED || glState.texGen[1] == TCGEN_ENVIRONMENT_MAPPED );
+	for ( i = 0; i < glState.numDeforms; i++ ) {
+		if ( tess.shader->deforms[i].deformation != DEFORM_MOVE ) {
+			normals = qtrue;
+		}
+	}
+
+	if ( normals ) {
+		if ( !glState.normalArray ) {
+			qglEnableClientState( GL_NORMAL_ARRAY );
+		}
+		qglNormalPointer( GL_FLOAT, 16, tess.normal );
+	} else if ( glState.normalArray ) {
+		qglDisableClientState( GL_NORMAL_ARRAY );
+	}
+	glState.normalArray = normals;
+}
+
+/*
+=================
+SetTexGen
+
+Starts or stops the backend generating the texture coordinates of
+the current texture unit, see glState.stageFeatures
+=================
+*/
+static void SetTexGen( int texGen ) {
+	int			tmu = glState.currenttmu;
+	vec4_t		fogDistanceVector, fogDepthVector;
+	float		eyeT;
+
+	if ( texGen == TCGEN_ENVIRONMENT_MAPPED ) {
+		qglTexGenEnvironment( backEnd.or.viewOrigin );
+	} else if ( texGen == TCGEN_FOG ) {
+		RB_CalcFogVectors( fogDistanceVector, fogDepthVector, &eyeT );
+		qglTexGenFog( fogDistanceVector, fogDepthVector, eyeT );
+	} else {
+		if ( glState.texGen[tmu] == TCGEN_ENVIRONMENT_MAPPED ) {
+			qglTexGenEnvironment( NULL );
+		} else if ( glState.texGen[tmu] == TCGEN_FOG ) {
+			qglTexGenFog( NULL, NULL, 0 );
+		}
+		texGen = TCGEN_BAD;
+	}
+
+	glState.texGen[tmu] = texGen;
+	SetNormalArray();
+}
+
+/*
+=================
+StagesReadDeforms
+
+Returns qtrue if something the stages, dlights or fog compute on
+the CPU reads the positions or the normals the deforms change
+=================
+*/
+static qboolean StagesReadDeforms( shaderCommands_t *input, qboolean positions, qboolean normals ) {
+	shaderStage_t	*pStage;
+	textureBundle_t	*bundle;
+	int				stage, b, tm;
+
+	if ( positions ) {
+		if ( input->dlightBits ) {
+			return qtrue;
+		}
+		if ( input->fogNum && input->shader->fogPass && !( glState.stageFeatures & QGL_STAGE_FOG ) ) {
+			return qtrue;
+		}
+	}
+
+	for ( stage = 0; stage < MAX_SHADER_STAGES; stage++ ) {
+		pStage = input->xstages[stage];
+		if ( !pStage ) {
+			break;
+		}
+
+		if ( normals && pStage->rgbGen == CGEN_LIGHTING_DIFFUSE ) {
+			return qtrue;
+		}
+		if ( pStage->alphaGen == AGEN_LIGHTING_SPECULAR ) {
+			return qtrue;
+		}
+		if ( positions && ( pStage->alphaGen == AGEN_PORTAL || pStage->adjustColorsForFog != ACFF_NONE ) ) {
+			return qtrue;
+		}
+
+		for ( b = 0; b < NUM_TEXTURE_BUNDLES; b++ ) {
+			bundle = &pStage->bundle[b];
+
+			if ( positions && bundle->tcGen == TCGEN_VECTOR ) {
+				return qtrue;
+			}
+
+			// environment and fog coordinates the backend can't
+			// generate, see ComputeTexMatrix
+			if ( bundle->tcGen == TCGEN_ENVIRONMENT_MAPPED || bundle->tcGen == TCGEN_FOG ) {
+				if ( !( glState.stageFeatures & QGL_STAGE_TEXTURE_MATRIX ) ) {
+					return qtrue;
+				}
+				if ( bundle->tcGen == TCGEN_ENVIRONMENT_MAPPED && !( glState.stageFeatures & QGL_STAGE_ENVIRONMENT ) ) {
+					return qtrue;
+				}
+				if ( bundle->tcGen == TCGEN_FOG && !( glState.stageFeatures & QGL_STAGE_FOG ) ) {
+					return qtrue;
+				}
+			}
+
+			for ( tm = 0; tm < bundle->numTexMods; tm++ ) {
+				if ( bundle->texMods[tm].type != TMOD_TURBULENT ) {
+					continue;
+				}
+				// also keeps environment and fog coordinates on the CPU
+				if ( positions || bundle->tcGen == TCGEN_ENVIRONMENT_MAPPED ) {
+					return qtrue;
+				}
+			}
+		}
+	}
+
+	return qfalse;
+}
+
+/*
+=================
+SetDeforms
+
+Leaves the deforms of the shader to the backend when it can do all
+of them and nothing evaluated on the CPU reads their result. Returns
+qfalse if RB_DeformTessGeometry has to do them instead.
+=================
+*/
+static qboolean SetDeforms( shaderCommands_t *input ) {
+	shader_t	*shader = input->shader;
+	int			deform[MAX_SHADER_DEFORMS];
+	int			wave[MAX_SHADER_DEFORMS];
+	float		params[MAX_SHADER_DEFORMS][4];
+	qboolean	positions, normals;
+	int			i;
+
+	if ( !( glState.stageFeatures & QGL_STAGE_DEFORM ) || !shader->numDeforms ) {
+		return qfalse;
+	}
+
+	// the debug views look at the tessellator
+	if ( r_showtris->integer || r_shownormals->integer ) {
+		return qfalse;
+	}
+
+	positions = normals = qfalse;
+	for ( i = 0; i < shader->numDeforms; i++ ) {
+		if ( !RB_CalcDeformParams( &shader->deforms[i], &deform[i], &wave[i], params[i] ) ) {
+			return qfalse;
+		}
+		if ( deform[i] == QGL_DEFORM_NORMALS ) {
+			normals = qtrue;
+		} else {
+			positions = qtrue;
+		}
+	}
+
+	if ( StagesReadDeforms( input, positions, normals ) ) {
+		return qfalse;
+	}
+
+	for ( i = 0; i < shader->numDeforms; i++ ) {
+		qglDeformVertexes( i, deform[i], wave[i], params[i] );
+		if ( deform[i] == QGL_DEFORM_BULGE ) {
+			qglDeformTexCoordPointer( 16, input->texCoords[0][0] );
+		}
+	}
+	glState.numDeforms = shader->numDeforms;
+	SetNormalArray();
+
+	return qtrue;
+}
+
+/*
+=================
+ClearDeforms
+=================
+*/
+static void ClearDeforms( void ) {
+	int		i;
+
+	if ( !glState.numDeforms ) {
+		return;
+	}
+
+	for ( i = 0; i < glState.numDeforms; i++ ) {
+		qglDeformVertexes( i, QGL_DEFORM_NONE, QGL_WAVE_SIN, NULL );
+	}
+	glState.numDeforms = 0;
+	SetNormalArray();
+}
+
+/*
+=================
+SetTexCoordArray
+
+Points the current texture unit at the texture coordinates
+ComputeTexCoords left for the bundle
+=================
+*/
+static void SetTexCoordArray( shaderCommands_t *input, int bundle ) {
+	switch ( input->svars.texGen[bundle] ) {
+	case TCGEN_TEXTURE:
+		qglTexCoordPointer( 2, GL_FLOAT, 16, input->texCoords[0][0] );
+		break;
+	case TCGEN_LIGHTMAP:
+		qglTexCoordPointer( 2, GL_FLOAT, 16, input->texCoords[0][1] );
+		break;
+	case TCGEN_ENVIRONMENT_MAPPED:
+	case TCGEN_FOG:
+		break;
+	default:
+		qglTexCoordPointer( 2, GL_FLOAT, 0, input->svars.texcoords[bundle] );
+		break;
+	}
+
+	SetTexGen( input->svars.texGen[bundle] );
+	GL_TexMatrix( input->svars.hasTexMatrix[bundle] ? input->svars.texMatrix[bundle] : NULL );
+}
+
+/*
+=================
+SetColorArray
+
+A stage with the same color on every vertex is drawn without a
+color array when the backend allows it
+=================
+*/
+static void SetColorArray( shaderCommands_t *input ) {
+	const byte	*color = input->svars.color;
+
+	if ( input->svars.constantColor ) {
+		qglDisableClientState( GL_COLOR_ARRAY );
+		qglColor4f( color[0] / 255.0f, color[1] / 255.0f, color[2] / 255.0f, color[3] / 255.0f );
+	} else {
+		qglEnableClientState( GL_COLOR_ARRAY );
+		qglColorPointer( 4, GL_UNSIGNED_BYTE, 0, input->svars.colors );
+	}
+}
+
 /*
 ================
 DrawTris
@@ -175,9 +432,11 @@ void RB_BeginSurface( shader_t *shader, int fogNum ) {
 
 	tess.numIndexes = 0;
 	tess.numVertexes = 0;
+	tess.numVBORanges = 0;
 	tess.shader = state;
 	tess.fogNum = fogNum;
 	tess.dlightBits = 0;		// will be OR'd in by surface functions
+	tess.numMergedEntities = 0;
 	tess.xstages = state->stages;
 	tess.numPasses = state->numUnfoggedPasses;
 	tess.currentStageIteratorFunc = state->optimalStageIteratorFunc;
@@ -219,7 +478,7 @@ static void DrawMultitextured( shaderCommands_t *input, int stage ) {
 	// base
 	//
 	GL_SelectTexture( 0 );
-	qglTexCoordPointer( 2, GL_FLOAT, 0, input->svars.texcoords[0] );
+	SetTexCoordArray( input, 0 );
 	R_BindAnimatedImage( &pStage->bundle[0] );
 
 	//
@@ -235,7 +494,7 @@ static void DrawMultitextured( shaderCommands_t *input, int stage ) {
 		GL_TexEnv( tess.shader->multitextureEnv );
 	}
 
-	qglTexCoordPointer( 2, GL_FLOAT, 0, input->svars.texcoords[1] );
+	SetTexCoordArray( input, 1 );
 
 	R_BindAnimatedImage( &pStage->bundle[1] );
 
@@ -245,6 +504,8 @@ static void DrawMultitextured( shaderCommands_t *input, int stage ) {
 	// disable texturing on TEXTURE1, then select TEXTURE0
 	//
 	//qglDisableClientState( GL_TEXTURE_COORD_ARRAY );
+	SetTexGen( TCGEN_BAD );
+	GL_TexMatrix( NULL );
 	qglDisable( GL_TEXTURE_2D );
 
 	GL_SelectTexture( 0 );
@@ -599,19 +860,26 @@ static void RB_FogPass( void ) {
 	fog_t		*fog;
 	int			i;
 
-	qglEnableClientState( GL_COLOR_ARRAY );
-	qglColorPointer( 4, GL_UNSIGNED_BYTE, 0, tess.svars.colors );
-
-	qglEnableClientState( GL_TEXTURE_COORD_ARRAY);
-	qglTexCoordPointer( 2, GL_FLOAT, 0, tess.svars.texcoords[0] );
-
 	fog = tr.world->fogs + tess.fogNum;
 
-	for ( i = 0; i < tess.numVertexes; i++ ) {
-		* ( int * )&tess.svars.colors[i] = fog->colorInt;
+	if ( glState.stageFeatures & QGL_STAGE_CONSTANT_COLOR ) {
+		tess.svars.constantColor = qtrue;
+		* ( int * )tess.svars.color = fog->colorInt;
+	} else {
+		tess.svars.constantColor = qfalse;
+		for ( i = 0; i < tess.numVertexes; i++ ) {
+			* ( int * )&tess.svars.colors[i] = fog->colorInt;
+		}
 	}
+	SetColorArray( &tess );
 
-	RB_CalcFogTexCoords( ( float * ) tess.svars.texcoords[0] );
+	qglEnableClientState( GL_TEXTURE_COORD_ARRAY);
+	if ( glState.stageFeatures & QGL_STAGE_FOG ) {
+		SetTexGen( TCGEN_FOG );
+	} else {
+		qglTexCoordPointer( 2, GL_FLOAT, 0, tess.svars.texcoords[0] );
+		RB_CalcFogTexCoords( ( float * ) tess.svars.texcoords[0] );
+	}
 
 	GL_Bind( tr.fogImage );
 
@@ -622,6 +890,104 @@ static void RB_FogPass( void ) {
 	}
 
 	R_DrawElements( tess.numIndexes, tess.indexes );
+
+	SetTexGen( TCGEN_BAD );
+	if ( tess.svars.constantColor ) {
+		tess.svars.constantColor = qfalse;
+		SetColorArray( &tess );
+	}
+}
+
+/*
+===============
+ComputeConstantColor
+
+Gives the color of a stage whose rgbGen and alphaGen are the same
+for every vertex, or returns qfalse
+===============
+*/
+static qboolean ComputeConstantColor( shaderStage_t *pStage, byte *color )
+{
+	trRefEntity_t	*ent = backEnd.currentEntity;
+	int				v;
+
+	if ( tess.fogNum && pStage->adjustColorsForFog != ACFF_NONE ) {
+		return qfalse;
+	}
+
+	switch ( pStage->rgbGen )
+	{
+		case CGEN_IDENTITY:
+			color[0] = color[1] = color[2] = color[3] = 0xff;
+			break;
+		case CGEN_IDENTITY_LIGHTING:
+			color[0] = color[1] = color[2] = color[3] = tr.identityLightByte;
+			break;
+		case CGEN_CONST:
+			*(int *)color = *(int *)pStage->constantColor;
+			break;
+		case CGEN_FOG:
+			*(int *)color = tr.world->fogs[tess.fogNum].colorInt;
+			break;
+		case CGEN_WAVEFORM:
+			v = myftol( 255 * RB_CalcWaveColorSingle( &pStage->rgbWave ) );
+			color[0] = color[1] = color[2] = v;
+			color[3] = 0xff;
+			break;
+		case CGEN_ENTITY:
+			if ( !ent ) {
+				return qfalse;
+			}
+			*(int *)color = *(int *)ent->e.shaderRGBA;
+			break;
+		case CGEN_ONE_MINUS_ENTITY:
+			if ( !ent ) {
+				return qfalse;
+			}
+			color[0] = 0xff - ent->e.shaderRGBA[0];
+			color[1] = 0xff - ent->e.shaderRGBA[1];
+			color[2] = 0xff - ent->e.shaderRGBA[2];
+			color[3] = 0xff - ent->e.shaderRGBA[3];
+			break;
+		default:
+			return qfalse;
+	}
+
+	switch ( pStage->alphaGen )
+	{
+	case AGEN_SKIP:
+		break;
+	case AGEN_IDENTITY:
+		color[3] = 0xff;
+		break;
+	case AGEN_CONST:
+		color[3] = pStage->constantColor[3];
+		break;
+	case AGEN_WAVEFORM:
+		color[3] = 255 * RB_CalcWaveAlphaSingle( &pStage->alphaWave );
+		break;
+	case AGEN_ENTITY:
+		if ( !ent ) {
+			return qfalse;
+		}
+		color[3] = ent->e.shaderRGBA[3];
+		break;
+	case AGEN_ONE_MINUS_ENTITY:
+		if ( !ent ) {
+			return qfalse;
+		}
+		color[3] = 0xff - ent->e.shaderRGBA[3];
+		break;
+	default:
+		return qfalse;
+	}
+
+	if ( r_greyscale->integer ) {
+		v = ( color[0] + color[1] + color[2] ) / 3;
+		color[0] = color[1] = color[2] = v;
+	}
+
+	return qtrue;
 }
 
 /*
@@ -633,6 +999,12 @@ static void ComputeColors( shaderStage_t *pStage )
 {
 	int		i;
 
+	tess.svars.constantColor = ( glState.stageFeatures & QGL_STAGE_CONSTANT_COLOR ) &&
+		ComputeConstantColor( pStage, tess.svars.color );
+	if ( tess.svars.constantColor ) {
+		return;
+	}
+
 	//
 	// rgbGen
 	//
@@ -830,6 +1202,115 @@ static void ComputeColors( shaderStage_t *pStage )
 	}
 }
 
+/*
+===============
+ComputeTexMatrix
+
+Leaves the texture coordinates of a bundle to the backend when they
+come straight from a vertex array or the backend can generate them,
+and all the tcMods fold into one matrix
+===============
+*/
+static qboolean ComputeTexMatrix( textureBundle_t *bundle, int b ) {
+	texModInfo_t	tmi, total, t;
+	float			*m;
+	int				tm;
+
+	if ( !( glState.stageFeatures & QGL_STAGE_TEXTURE_MATRIX ) ) {
+		return qfalse;
+	}
+
+	switch ( bundle->tcGen )
+	{
+	case TCGEN_TEXTURE:
+	case TCGEN_LIGHTMAP:
+		break;
+	case TCGEN_ENVIRONMENT_MAPPED:
+		if ( !( glState.stageFeatures & QGL_STAGE_ENVIRONMENT ) ) {
+			return qfalse;
+		}
+		break;
+	case TCGEN_FOG:
+		if ( !( glState.stageFeatures & QGL_STAGE_FOG ) ) {
+			return qfalse;
+		}
+		break;
+	default:
+		return qfalse;
+	}
+
+	total.matrix[0][0] = 1;
+	total.matrix[1][0] = 0;
+	total.translate[0] = 0;
+	total.matrix[0][1] = 0;
+	total.matrix[1][1] = 1;
+	total.translate[1] = 0;
+
+	for ( tm = 0; tm < bundle->numTexMods; tm++ ) {
+		if ( bundle->texMods[tm].type == TMOD_NONE ) {
+			break;
+		}
+
+		switch ( bundle->texMods[tm].type )
+		{
+		case TMOD_ENTITY_TRANSLATE:
+			RB_CalcScrollTexMatrix( backEnd.currentEntity->e.shaderTexCoord, &tmi );
+			break;
+		case TMOD_SCROLL:
+			RB_CalcScrollTexMatrix( bundle->texMods[tm].scroll, &tmi );
+			break;
+		case TMOD_SCALE:
+			RB_CalcScaleTexMatrix( bundle->texMods[tm].scale, &tmi );
+			break;
+		case TMOD_STRETCH:
+			RB_CalcStretchTexMatrix( &bundle->texMods[tm].wave, &tmi );
+			break;
+		case TMOD_TRANSFORM:
+			tmi = bundle->texMods[tm];
+			break;
+		case TMOD_ROTATE:
+			RB_CalcRotateTexMatrix( bundle->texMods[tm].rotateSpeed, &tmi );
+			break;
+		default:
+			// turbulence moves each vertex differently
+			return qfalse;
+		}
+
+		// apply tmi after what is there already
+		t = total;
+		total.matrix[0][0] = tmi.matrix[0][0] * t.matrix[0][0] + tmi.matrix[1][0] * t.matrix[0][1];
+		total.matrix[1][0] = tmi.matrix[0][0] * t.matrix[1][0] + tmi.matrix[1][0] * t.matrix[1][1];
+		total.translate[0] = tmi.matrix[0][0] * t.translate[0] + tmi.matrix[1][0] * t.translate[1] + tmi.translate[0];
+		total.matrix[0][1] = tmi.matrix[0][1] * t.matrix[0][0] + tmi.matrix[1][1] * t.matrix[0][1];
+		total.matrix[1][1] = tmi.matrix[0][1] * t.matrix[1][0] + tmi.matrix[1][1] * t.matrix[1][1];
+		total.translate[1] = tmi.matrix[0][1] * t.translate[0] + tmi.matrix[1][1] * t.translate[1] + tmi.translate[1];
+	}
+
+	tess.svars.texGen[b] = bundle->tcGen;
+	tess.svars.hasTexMatrix[b] = ( tm > 0 );
+
+	// column major, applied to ( s, t, 0, 1 )
+	m = tess.svars.texMatrix[b];
+	m[0] = total.matrix[0][0];
+	m[1] = total.matrix[0][1];
+	m[2] = 0;
+	m[3] = 0;
+	m[4] = total.matrix[1][0];
+	m[5] = total.matrix[1][1];
+	m[6] = 0;
+	m[7] = 0;
+	m[8] = 0;
+	m[9] = 0;
+	m[10] = 1;
+	m[11] = 0;
+	m[12] = total.translate[0];
+	m[13] = total.translate[1];
+	m[14] = 0;
+	m[15] = 1;
+
+	return qtrue;
+}
+
 /*
 ===============
 ComputeTexCoords
@@ -842,6 +1323,13 @@ static void ComputeTexCoords( shaderStage_t *pStage ) {
 	for ( b = 0; b < NUM_TEXTURE_BUNDLES; b++ ) {
 		int tm;
 
+		tess.svars.texGen[b] = TCGEN_BAD;
+		tess.svars.hasTexMatrix[b] = qfalse;
+
+		if ( ComputeTexMatrix( &pStage->bundle[b], b ) ) {
+			continue;
+		}
+
 		//
 		// generate the texture coordinates
 		//
@@ -952,8 +1440,7 @@ static void RB_IterateStagesGeneric( shaderCommands_t *input )
 
 		if ( !setArraysOnce )
 		{
-			qglEnableClientState( GL_COLOR_ARRAY );
-			qglColorPointer( 4, GL_UNSIGNED_BYTE, 0, input->svars.colors );
+			SetColorArray( input );
 		}
 
 		//
@@ -967,7 +1454,7 @@ static void RB_IterateStagesGeneric( shaderCommands_t *input )
 		{
 			if ( !setArraysOnce )
 			{
-				qglTexCoordPointer( 2, GL_FLOAT, 0, input->svars.texcoords[0] );
+				SetTexCoordArray( input, 0 );
 			}
 
 			//
@@ -993,6 +1480,18 @@ static void RB_IterateStagesGeneric( shaderCommands_t *input )
 			break;
 		}
 	}
+
+	//
+	// leave the color array and texture unit the way the
+	// passes that follow expect them
+	//
+	if ( input->svars.constantColor )
+	{
+		input->svars.constantColor = qfalse;
+		SetColorArray( input );
+	}
+	SetTexGen( TCGEN_BAD );
+	GL_TexMatrix( NULL );
 }
 
 
@@ -1008,7 +1507,9 @@ void RB_StageIteratorGeneric( void )
 	if (!input->numVertexes)
 		return;
 
-	RB_DeformTessGeometry();
+	if ( !SetDeforms( input ) ) {
+		RB_DeformTessGeometry();
+	}
 
 	//
 	// log this call
@@ -1038,9 +1539,10 @@ void RB_StageIteratorGeneric( void )
 	// if there is only a single pass then we can enable color
 	// and texture arrays before we compile, otherwise we need
 	// to avoid compiling those arrays since they will change
-	// during multipass rendering
+	// during multipass rendering, or when the backend evaluates
+	// part of the stage and the arrays depend on it
 	//
-	if ( tess.numPasses > 1 || input->shader->multitextureEnv )
+	if ( tess.numPasses > 1 || input->shader->multitextureEnv || glState.stageFeatures )
 	{
 		setArraysOnce = qfalse;
 		qglDisableClientState (GL_COLOR_ARRAY);
@@ -1096,10 +1598,12 @@ void RB_StageIteratorGeneric( void )
 		RB_FogPass();
 	}
 
-	// 
+	ClearDeforms();
+
+	//
 	// unlock arrays
 	//
-	if (qglUnlockArraysEXT) 
+	if (qglUnlockArraysEXT)
 	{
 		qglUnlockArraysEXT();
 		GLimp_LogComment( "glUnlockArraysEXT\n" );
@@ -1217,11 +1721,9 @@ void RB_StageIteratorLightmappedMultitexture( void ) {
 	GL_Cull( input->shader->cullType );
 
 	//
-	// set color, pointers, and lock
+	// set color
 	//
 	GL_State( GLS_DEFAULT );
-	qglNumVertices(input->numVertexes);
-	qglVertexPointer( 3, GL_FLOAT, 16, input->xyz );
 
 #ifdef REPLACE_MODE
 	qglDisableClientState( GL_COLOR_ARRAY );
@@ -1229,7 +1731,6 @@ void RB_StageIteratorLightmappedMultitexture( void ) {
 	qglShadeModel( GL_FLAT );
 #else
 	qglEnableClientState( GL_COLOR_ARRAY );
-	qglColorPointer( 4, GL_UNSIGNED_BYTE, 0, tess.constantColor255 );
 #endif
 
 	//
@@ -1239,7 +1740,6 @@ void RB_StageIteratorLightmappedMultitexture( void ) {
 
 	qglEnableClientState( GL_TEXTURE_COORD_ARRAY );
 	R_BindAnimatedImage( &tess.xstages[0]->bundle[0] );
-	qglTexCoordPointer( 2, GL_FLOAT, 16, tess.texCoords[0][0] );
 
 	//
 	// configure second stage
@@ -1253,17 +1753,35 @@ void RB_StageIteratorLightmappedMultitexture( void ) {
 	}
 	R_BindAnimatedImage( &tess.xstages[0]->bundle[1] );
 	qglEnableClientState( GL_TEXTURE_COORD_ARRAY );
-	qglTexCoordPointer( 2, GL_FLOAT, 16, tess.texCoords[0][1] );
 
 	//
-	// lock arrays
+	// surfaces already in buffer objects
 	//
-	if ( qglLockArraysEXT ) {
-		qglLockArraysEXT(0, input->numVertexes);
-		GLimp_LogComment( "glLockArraysEXT\n" );
+	if ( input->numVBORanges ) {
+		RB_DrawWorldVBOs();
 	}
 
-	R_DrawElements( input->numIndexes, input->indexes );
+	//
+	// set pointers and lock
+	//
+	if ( input->numIndexes ) {
+		qglNumVertices(input->numVertexes);
+		qglVertexPointer( 3, GL_FLOAT, 16, input->xyz );
+#ifndef REPLACE_MODE
+		qglColorPointer( 4, GL_UNSIGNED_BYTE, 0, tess.constantColor255 );
+#endif
+		GL_SelectTexture( 0 );
+		qglTexCoordPointer( 2, GL_FLOAT, 16, tess.texCoords[0][0] );
+		GL_SelectTexture( 1 );
+		qglTexCoordPointer( 2, GL_FLOAT, 16, tess.texCoords[0][1] );
+
+		if ( qglLockArraysEXT ) {
+			qglLockArraysEXT(0, input->numVertexes);
+			GLimp_LogComment( "glLockArraysEXT\n" );
+		}
+
+		R_DrawElements( input->numIndexes, input->indexes );
+	}
 
 	//
 	// disable texturing on TEXTURE1, then select TEXTURE0
@@ -1277,6 +1795,10 @@ void RB_StageIteratorLightmappedMultitexture( void ) {
 	qglShadeModel( GL_SMOOTH );
 #endif
 
+	if ( !input->numIndexes ) {
+		return;
+	}
+
 	// 
 	// now do any dynamic lighting needed
 	//
@@ -1305,10 +1827,11 @@ void RB_StageIteratorLightmappedMultitexture( void ) {
 */
 void RB_EndSurface( void ) {
 	shaderCommands_t *input;
+	int			draws;
 
 	input = &tess;
 
-	if (input->numIndexes == 0) {
+	if (input->numIndexes == 0 && input->numVBORanges == 0) {
 		return;
 	}
 
@@ -1340,7 +1863,18 @@ void RB_EndSurface( void ) {
 	//
 	// call off to shader specific tess end function
 	//
-	tess.currentStageIteratorFunc();
+	draws = backEnd.pc.c_draws;
+	if ( tr.phaseTiming ) {
+		unsigned	start = ri.Microseconds();
+
+		tess.currentStageIteratorFunc();
+		tr.phaseUsec[RP_SHADING] += ri.Microseconds() - start;
+	} else {
+		tess.currentStageIteratorFunc();
+	}
+
+	// each merged entity would have taken the same draws on its own
+	backEnd.pc.c_unmergedDraws += ( backEnd.pc.c_draws - draws ) * ( 1 + tess.numMergedEntities );
 
 	//
 	// draw debugging stuff
@@ -1353,6 +1887,7 @@ void RB_EndSurface( void ) {
 	}
 	// clear shader so we can tell we don't have any unclosed surfaces
 	tess.numIndexes = 0;
+	tess.numVBORanges = 0;
 
 	GLimp_LogComment( "----------\n" );
 }
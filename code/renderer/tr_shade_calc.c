@@ -84,23 +84,31 @@ static float EvalWaveFormClamped( const waveForm_t *wf )
 }
 
 /*
-** RB_CalcStretchTexCoords
+** RB_CalcStretchTexMatrix
 */
-void RB_CalcStretchTexCoords( const waveForm_t *wf, float *st )
+void RB_CalcStretchTexMatrix( const waveForm_t *wf, texModInfo_t *tmi )
 {
 	float p;
-	texModInfo_t tmi;
 
 	p = 1.0f / EvalWaveForm( wf );
 
-	tmi.matrix[0][0] = p;
-	tmi.matrix[1][0] = 0;
-	tmi.translate[0] = 0.5f - 0.5f * p;
+	tmi->matrix[0][0] = p;
+	tmi->matrix[1][0] = 0;
+	tmi->translate[0] = 0.5f - 0.5f * p;
 
-	tmi.matrix[0][1] = 0;
-	tmi.matrix[1][1] = p;
-	tmi.translate[1] = 0.5f - 0.5f * p;
+	tmi->matrix[0][1] = 0;
+	tmi->matrix[1][1] = p;
+	tmi->translate[1] = 0.5f - 0.5f * p;
+}
 
+/*
+** RB_CalcStretchTexCoords
+*/
+void RB_CalcStretchTexCoords( const waveForm_t *wf, float *st )
+{
+	texModInfo_t tmi;
+
+	RB_CalcStretchTexMatrix( wf, &tmi );
 	RB_CalcTransformTexCoords( &tmi, st );
 }
 
@@ -532,6 +540,63 @@ static void Autosprite2Deform( void ) {
 }
 
 
+/*
+=====================
+RB_CalcDeformParams
+
+What qglDeformVertexes needs to do the deform, with the time
+folded in. Returns qfalse if it has to be done on the CPU.
+=====================
+*/
+qboolean RB_CalcDeformParams( const deformStage_t *ds, int *deform, int *wave, float params[4] ) {
+	const waveForm_t	*wf = &ds->deformationWave;
+	float				phase;
+
+	*wave = QGL_WAVE_SIN;
+
+	switch ( ds->deformation ) {
+	case DEFORM_WAVE:
+		if ( wf->func < GF_SIN || wf->func > GF_INVERSE_SAWTOOTH ) {
+			return qfalse;
+		}
+		*deform = QGL_DEFORM_WAVE;
+		*wave = QGL_WAVE_SIN + wf->func - GF_SIN;
+
+		// only the fraction counts, like for the table lookup
+		phase = wf->phase + tess.shaderTime * wf->frequency;
+		params[0] = wf->base;
+		params[1] = wf->amplitude;
+		params[2] = phase - floor( phase );
+		params[3] = wf->frequency ? ds->deformationSpread : 0;
+		return qtrue;
+	case DEFORM_NORMALS:
+		*deform = QGL_DEFORM_NORMALS;
+		params[0] = wf->amplitude;
+		params[1] = tess.shaderTime * wf->frequency;
+		params[2] = 0;
+		params[3] = 0;
+		return qtrue;
+	case DEFORM_BULGE:
+		*deform = QGL_DEFORM_BULGE;
+		phase = backEnd.refdef.time * ds->bulgeSpeed * 0.001f;
+		params[0] = ds->bulgeWidth;
+		params[1] = ds->bulgeHeight;
+		params[2] = phase - floor( phase / ( M_PI * 2 ) ) * M_PI * 2;
+		params[3] = 0;
+		return qtrue;
+	case DEFORM_MOVE:
+		if ( wf->func < GF_SIN || wf->func > GF_INVERSE_SAWTOOTH ) {
+			return qfalse;
+		}
+		*deform = QGL_DEFORM_MOVE;
+		VectorScale( ds->moveVector, EvalWaveForm( wf ), params );
+		params[3] = 0;
+		return qtrue;
+	default:
+		return qfalse;
+	}
+}
+
 /*
 =====================
 RB_DeformTessGeometry
@@ -675,18 +740,15 @@ void RB_CalcAlphaFromOneMinusEntity( unsigned char *dstColors )
 }
 
 /*
-** RB_CalcWaveColor
+** RB_CalcWaveColorSingle
+**
+** The intensity RB_CalcWaveColor gives every vertex
 */
-void RB_CalcWaveColor( const waveForm_t *wf, unsigned char *dstColors )
+float RB_CalcWaveColorSingle( const waveForm_t *wf )
 {
-	int i;
-	int v;
 	float glow;
-	int *colors = ( int * ) dstColors;
-	byte	color[4];
-
 
-  if ( wf->func == GF_NOISE ) {
+	if ( wf->func == GF_NOISE ) {
 		glow = wf->base + R_NoiseGet4f( 0, 0, 0, ( tess.shaderTime + wf->phase ) * wf->frequency ) * wf->amplitude;
 	} else {
 		glow = EvalWaveForm( wf ) * tr.identityLight;
@@ -699,7 +761,20 @@ void RB_CalcWaveColor( const waveForm_t *wf, unsigned char *dstColors )
 		glow = 1;
 	}
 
-	v = myftol( 255 * glow );
+	return glow;
+}
+
+/*
+** RB_CalcWaveColor
+*/
+void RB_CalcWaveColor( const waveForm_t *wf, unsigned char *dstColors )
+{
+	int i;
+	int v;
+	int *colors = ( int * ) dstColors;
+	byte	color[4];
+
+	v = myftol( 255 * RB_CalcWaveColorSingle( wf ) );
 	color[0] = color[1] = color[2] = v;
 	color[3] = 255;
 	v = *(int *)color;
@@ -709,6 +784,14 @@ void RB_CalcWaveColor( const waveForm_t *wf, unsigned char *dstColors )
 	}
 }
 
+/*
+** RB_CalcWaveAlphaSingle
+*/
+float RB_CalcWaveAlphaSingle( const waveForm_t *wf )
+{
+	return EvalWaveFormClamped( wf );
+}
+
 /*
 ** RB_CalcWaveAlpha
 */
@@ -716,11 +799,8 @@ void RB_CalcWaveAlpha( const waveForm_t *wf, unsigned char *dstColors )
 {
 	int i;
 	int v;
-	float glow;
-
-	glow = EvalWaveFormClamped( wf );
 
-	v = 255 * glow;
+	v = 255 * RB_CalcWaveAlphaSingle( wf );
 
 	for ( i = 0; i < tess.numVertexes; i++, dstColors += 4 )
 	{
@@ -798,22 +878,16 @@ TEX COORDS
 
 /*
 ========================
-RB_CalcFogTexCoords
+RB_CalcFogVectors
 
-To do the clipped fog plane really correctly, we should use
-projected textures, but I don't trust the drivers and it
-doesn't fit our shader data.
+The planes RB_CalcFogTexCoords measures each vertex against, for
+backends that generate the fog coordinates themselves. The eye is
+outside of the fog volume when eyeT is negative.
 ========================
 */
-void RB_CalcFogTexCoords( float *st ) {
-	int			i;
-	float		*v;
-	float		s, t;
-	float		eyeT;
-	qboolean	eyeOutside;
+void RB_CalcFogVectors( vec4_t fogDistanceVector, vec4_t fogDepthVector, float *eyeT ) {
 	fog_t		*fog;
 	vec3_t		local;
-	vec4_t		fogDistanceVector, fogDepthVector = {0, 0, 0, 0};
 
 	fog = tr.world->fogs + tess.fogNum;
 
@@ -840,11 +914,35 @@ void RB_CalcFogTexCoords( float *st ) {
 			fog->surface[1] * backEnd.or.axis[2][1] + fog->surface[2] * backEnd.or.axis[2][2];
 		fogDepthVector[3] = -fog->surface[3] + DotProduct( backEnd.or.origin, fog->surface );
 
-		eyeT = DotProduct( backEnd.or.viewOrigin, fogDepthVector ) + fogDepthVector[3];
+		*eyeT = DotProduct( backEnd.or.viewOrigin, fogDepthVector ) + fogDepthVector[3];
 	} else {
-		eyeT = 1;	// non-surface fog always has eye inside
+		VectorClear( fogDepthVector );
+		fogDepthVector[3] = 0;
+		*eyeT = 1;	// non-surface fog always has eye inside
 	}
 
+	fogDistanceVector[3] += 1.0/512;
+}
+
+/*
+========================
+RB_CalcFogTexCoords
+
+To do the clipped fog plane really correctly, we should use
+projected textures, but I don't trust the drivers and it
+doesn't fit our shader data.
+========================
+*/
+void RB_CalcFogTexCoords( float *st ) {
+	int			i;
+	float		*v;
+	float		s, t;
+	float		eyeT;
+	qboolean	eyeOutside;
+	vec4_t		fogDistanceVector, fogDepthVector;
+
+	RB_CalcFogVectors( fogDistanceVector, fogDepthVector, &eyeT );
+
 	// see if the viewpoint is outside
 	// this is needed for clipping distance even for constant fog
 
@@ -854,8 +952,6 @@ void RB_CalcFogTexCoords( float *st ) {
 		eyeOutside = qfalse;
 	}
 
-	fogDistanceVector[3] += 1.0/512;
-
 	// calculate density for each point
 	for (i = 0, v = tess.xyz[0] ; i < tess.numVertexes ; i++, v += 4) {
 		// calculate the length in fog
@@ -972,6 +1068,45 @@ void RB_CalcScrollTexCoords( const float scrollSpeed[2], float *st )
 	}
 }
 
+/*
+** RB_CalcScaleTexMatrix
+*/
+void RB_CalcScaleTexMatrix( const float scale[2], texModInfo_t *tmi )
+{
+	tmi->matrix[0][0] = scale[0];
+	tmi->matrix[1][0] = 0;
+	tmi->translate[0] = 0;
+
+	tmi->matrix[0][1] = 0;
+	tmi->matrix[1][1] = scale[1];
+	tmi->translate[1] = 0;
+}
+
+/*
+** RB_CalcScrollTexMatrix
+*/
+void RB_CalcScrollTexMatrix( const float scrollSpeed[2], texModInfo_t *tmi )
+{
+	float timeScale = tess.shaderTime;
+	float adjustedScrollS, adjustedScrollT;
+
+	adjustedScrollS = scrollSpeed[0] * timeScale;
+	adjustedScrollT = scrollSpeed[1] * timeScale;
+
+	// clamp so coordinates don't continuously get larger, causing problems
+	// with hardware limits
+	adjustedScrollS = adjustedScrollS - floor( adjustedScrollS );
+	adjustedScrollT = adjustedScrollT - floor( adjustedScrollT );
+
+	tmi->matrix[0][0] = 1;
+	tmi->matrix[1][0] = 0;
+	tmi->translate[0] = adjustedScrollS;
+
+	tmi->matrix[0][1] = 0;
+	tmi->matrix[1][1] = 1;
+	tmi->translate[1] = adjustedScrollT;
+}
+
 /*
 ** RB_CalcTransformTexCoords
 */
@@ -990,15 +1125,14 @@ void RB_CalcTransformTexCoords( const texModInfo_t *tmi, float *st  )
 }
 
 /*
-** RB_CalcRotateTexCoords
+** RB_CalcRotateTexMatrix
 */
-void RB_CalcRotateTexCoords( float degsPerSecond, float *st )
+void RB_CalcRotateTexMatrix( float degsPerSecond, texModInfo_t *tmi )
 {
 	float timeScale = tess.shaderTime;
 	float degs;
 	int index;
 	float sinValue, cosValue;
-	texModInfo_t tmi;
 
 	degs = -degsPerSecond * timeScale;
 	index = degs * ( FUNCTABLE_SIZE / 360.0f );
@@ -1006,14 +1140,23 @@ void RB_CalcRotateTexCoords( float degsPerSecond, float *st )
 	sinValue = tr.sinTable[ index & FUNCTABLE_MASK ];
 	cosValue = tr.sinTable[ ( index + FUNCTABLE_SIZE / 4 ) & FUNCTABLE_MASK ];
 
-	tmi.matrix[0][0] = cosValue;
-	tmi.matrix[1][0] = -sinValue;
-	tmi.translate[0] = 0.5 - 0.5 * cosValue + 0.5 * sinValue;
+	tmi->matrix[0][0] = cosValue;
+	tmi->matrix[1][0] = -sinValue;
+	tmi->translate[0] = 0.5 - 0.5 * cosValue + 0.5 * sinValue;
+
+	tmi->matrix[0][1] = sinValue;
+	tmi->matrix[1][1] = cosValue;
+	tmi->translate[1] = 0.5 - 0.5 * sinValue - 0.5 * cosValue;
+}
 
-	tmi.matrix[0][1] = sinValue;
-	tmi.matrix[1][1] = cosValue;
-	tmi.translate[1] = 0.5 - 0.5 * sinValue - 0.5 * cosValue;
+/*
+** RB_CalcRotateTexCoords
+*/
+void RB_CalcRotateTexCoords( float degsPerSecond, float *st )
+{
+	texModInfo_t tmi;
 
+	RB_CalcRotateTexMatrix( degsPerSecond, &tmi );
 	RB_CalcTransformTexCoords( &tmi, st );
 }
 
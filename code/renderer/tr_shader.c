@@ -2361,6 +2361,74 @@ static char *FindShaderInShaderText( const char *shadername ) {
 }
 
 
+/*
+==================
+R_PreloadShaderImages
+
+Hands the images a shader is going to load to the image preloader
+==================
+*/
+void R_PreloadShaderImages( const char *name ) {
+	static char	*suf[6] = {"rt", "bk", "lf", "ft", "up", "dn"};
+	char		strippedName[MAX_QPATH];
+	char		*text, *token;
+	int			depth, i, box;
+
+	if ( !r_preloadImages->integer ) {
+		return;
+	}
+
+	COM_StripExtension( name, strippedName, sizeof( strippedName ) );
+
+	text = FindShaderInShaderText( strippedName );
+	if ( !text ) {
+		// a single image, see R_FindShader
+		R_PreloadImage( name );
+		return;
+	}
+
+	depth = 0;
+	while ( 1 ) {
+		token = COM_ParseExt( &text, qtrue );
+		if ( !token[0] ) {
+			break;
+		}
+
+		if ( token[0] == '{' ) {
+			depth++;
+		} else if ( token[0] == '}' ) {
+			if ( --depth <= 0 ) {
+				break;
+			}
+		} else if ( !Q_stricmp( token, "map" ) || !Q_stricmp( token, "clampmap" ) ) {
+			token = COM_ParseExt( &text, qfalse );
+			if ( token[0] != '$' ) {
+				R_PreloadImage( token );
+			}
+		} else if ( !Q_stricmp( token, "animMap" ) ) {
+			COM_ParseExt( &text, qfalse );
+			while ( 1 ) {
+				token = COM_ParseExt( &text, qfalse );
+				if ( !token[0] ) {
+					break;
+				}
+				R_PreloadImage( token );
+			}
+		} else if ( !Q_stricmp( token, "skyParms" ) ) {
+			// outerbox, cloudheight, innerbox
+			for ( box = 0 ; box < 3 ; box++ ) {
+				token = COM_ParseExt( &text, qfalse );
+				if ( box == 1 || !token[0] || !strcmp( token, "-" ) ) {
+					continue;
+				}
+				for ( i = 0 ; i < 6 ; i++ ) {
+					R_PreloadImage( va( "%s_%s.tga", token, suf[i] ) );
+				}
+			}
+		}
+	}
+}
+
 /*
 ==================
 R_FindShaderByName
@@ -232,6 +232,9 @@ static void RB_SurfaceTriangles( srfTriangles_t *srf ) {
 	qboolean	needsNormal;
 
 	dlightBits = srf->dlightBits[backEnd.smpFrame];
+	if ( RB_AddWorldVBOSurface( srf->vbo, srf->vboFirstIndex, srf->vboNumIndexes, dlightBits ) ) {
+		return;
+	}
 	tess.dlightBits |= dlightBits;
 
 	RB_CHECKOVERFLOW( srf->numVerts, srf->numIndexes );
@@ -909,9 +912,13 @@ static void RB_SurfaceFace( srfSurfaceFace_t *surf ) {
 	int			numPoints;
 	int			dlightBits;
 
+	dlightBits = surf->dlightBits[backEnd.smpFrame];
+	if ( RB_AddWorldVBOSurface( surf->vbo, surf->vboFirstIndex, surf->vboNumIndexes, dlightBits ) ) {
+		return;
+	}
+
 	RB_CHECKOVERFLOW( surf->numPoints, surf->numIndices );
 
-	dlightBits = surf->dlightBits[backEnd.smpFrame];
 	tess.dlightBits |= dlightBits;
 
 	indices = ( unsigned * ) ( ( ( char  * ) surf ) + surf->ofsIndices );
@@ -0,0 +1,391 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+// tr_vbo.c
+
+#include "tr_local.h"
+
+/*
+=============================================================================
+
+WORLD BUFFER OBJECTS
+
+Faces and triangle soups whose shader takes the lightmapped multitexture
+path only ever need their positions, both texture coordinates and a white
+color, so they are uploaded once at load time. The back end then only
+queues index ranges for them; everything that has to be computed per
+frame (deforms, dlights, fog, curves at their current lod) still goes
+through the tessellator.
+
+Indexes are 16 bits, so the surfaces are split over pools of at most
+65536 vertexes. Surfaces are laid out by shader so a batch mostly comes
+out as a few long ranges.
+
+=============================================================================
+*/
+
+#define	MAX_WORLD_VBOS		64
+#define	MAX_VBO_VERTEXES	0x10000
+
+typedef struct {
+	vec3_t		xyz;
+	vec2_t		st;
+	vec2_t		lightmap;
+	byte		color[4];
+} vboVert_t;
+
+#define	VBO_OFS(x)	((void *)&((vboVert_t *)0)->x)
+
+typedef struct {
+	GLuint		vertexBuffer;
+	GLuint		indexBuffer;
+	int			numVertexes;
+	int			numIndexes;
+} worldVBO_t;
+
+static worldVBO_t	worldVBOs[MAX_WORLD_VBOS];
+static int			numWorldVBOs;
+
+/*
+===============
+R_VBOSurfaceSize
+
+Returns qfalse if the surface can't live in a buffer object
+===============
+*/
+static qboolean R_VBOSurfaceSize( msurface_t *surf, int *numVertexes, int *numIndexes ) {
+	srfSurfaceFace_t	*face;
+	srfTriangles_t		*tri;
+
+	*numVertexes = 0;
+	*numIndexes = 0;
+
+	if ( surf->shader->optimalStageIteratorFunc != RB_StageIteratorLightmappedMultitexture ) {
+		return qfalse;
+	}
+
+	switch ( *surf->data ) {
+	case SF_FACE:
+		face = (srfSurfaceFace_t *)surf->data;
+		*numVertexes = face->numPoints;
+		*numIndexes = face->numIndices;
+		break;
+	case SF_TRIANGLES:
+		tri = (srfTriangles_t *)surf->data;
+		*numVertexes = tri->numVerts;
+		*numIndexes = tri->numIndexes;
+		break;
+	default:
+		return qfalse;
+	}
+
+	return *numVertexes > 0 && *numIndexes > 0 && *numVertexes <= MAX_VBO_VERTEXES;
+}
+
+/*
+===============
+R_CompareVBOSurfaces
+===============
+*/
+static int R_CompareVBOSurfaces( const void *a, const void *b ) {
+	msurface_t	*sa = *(msurface_t **)a;
+	msurface_t	*sb = *(msurface_t **)b;
+
+	if ( sa->shader->index != sb->shader->index ) {
+		return sa->shader->index - sb->shader->index;
+	}
+	return sa - sb;
+}
+
+/*
+===============
+R_CopyVBOSurface
+
+Copies the surface into the pool at the given offsets and
+remembers where it went
+===============
+*/
+static void R_CopyVBOSurface( msurface_t *surf, vboVert_t *verts, glIndex_t *indexes,
+							 int vbo, int firstVertex, int firstIndex ) {
+	srfSurfaceFace_t	*face;
+	srfTriangles_t		*tri;
+	unsigned			*faceIndexes;
+	float				*v;
+	drawVert_t			*dv;
+	int					i;
+
+	verts += firstVertex;
+	indexes += firstIndex;
+
+	if ( *surf->data == SF_FACE ) {
+		face = (srfSurfaceFace_t *)surf->data;
+		for ( i = 0, v = face->points[0] ; i < face->numPoints ; i++, v += VERTEXSIZE ) {
+			VectorCopy( v, verts[i].xyz );
+			verts[i].st[0] = v[3];
+			verts[i].st[1] = v[4];
+			verts[i].lightmap[0] = v[5];
+			verts[i].lightmap[1] = v[6];
+			*(int *)verts[i].color = -1;
+		}
+		faceIndexes = (unsigned *)( (byte *)face + face->ofsIndices );
+		for ( i = 0 ; i < face->numIndices ; i++ ) {
+			indexes[i] = firstVertex + faceIndexes[i];
+		}
+		face->vbo = vbo + 1;
+		face->vboFirstIndex = firstIndex;
+		face->vboNumIndexes = face->numIndices;
+	} else {
+		tri = (srfTriangles_t *)surf->data;
+		for ( i = 0, dv = tri->verts ; i < tri->numVerts ; i++, dv++ ) {
+			VectorCopy( dv->xyz, verts[i].xyz );
+			verts[i].st[0] = dv->st[0];
+			verts[i].st[1] = dv->st[1];
+			verts[i].lightmap[0] = dv->lightmap[0];
+			verts[i].lightmap[1] = dv->lightmap[1];
+			*(int *)verts[i].color = -1;
+		}
+		for ( i = 0 ; i < tri->numIndexes ; i++ ) {
+			indexes[i] = firstVertex + tri->indexes[i];
+		}
+		tri->vbo = vbo + 1;
+		tri->vboFirstIndex = firstIndex;
+		tri->vboNumIndexes = tri->numIndexes;
+	}
+}
+
+/*
+===============
+R_UploadWorldVBO
+===============
+*/
+static void R_UploadWorldVBO( worldVBO_t *vbo, msurface_t **surfs, int numSurfs ) {
+	vboVert_t	*verts;
+	glIndex_t	*indexes;
+	int			numVertexes, numIndexes;
+	int			i;
+
+	verts = ri.Hunk_AllocateTempMemory( vbo->numVertexes * sizeof( *verts ) );
+	indexes = ri.Hunk_AllocateTempMemory( vbo->numIndexes * sizeof( *indexes ) );
+
+	vbo->numVertexes = 0;
+	vbo->numIndexes = 0;
+	for ( i = 0 ; i < numSurfs ; i++ ) {
+		if ( !R_VBOSurfaceSize( surfs[i], &numVertexes, &numIndexes ) ) {
+			continue;
+		}
+		R_CopyVBOSurface( surfs[i], verts, indexes, vbo - worldVBOs, vbo->numVertexes, vbo->numIndexes );
+		vbo->numVertexes += numVertexes;
+		vbo->numIndexes += numIndexes;
+	}
+
+	qglBindBuffer( GL_ARRAY_BUFFER, vbo->vertexBuffer );
+	qglBufferData( GL_ARRAY_BUFFER, vbo->numVertexes * sizeof( *verts ), verts, GL_STATIC_DRAW );
+	qglBindBuffer( GL_ELEMENT_ARRAY_BUFFER, vbo->indexBuffer );
+	qglBufferData( GL_ELEMENT_ARRAY_BUFFER, vbo->numIndexes * sizeof( *indexes ), indexes, GL_STATIC_DRAW );
+
+	ri.Hunk_FreeTempMemory( indexes );
+	ri.Hunk_FreeTempMemory( verts );
+}
+
+/*
+===============
+R_CreateWorldVBOs
+
+Called after the world surfaces and their shaders are loaded
+===============
+*/
+void R_CreateWorldVBOs( void ) {
+	msurface_t	**surfs;
+	worldVBO_t	*vbo;
+	int			numSurfs, first;
+	int			numVertexes, numIndexes;
+	int			totalVertexes;
+	GLuint		buffers[2];
+	int			i;
+
+	numWorldVBOs = 0;
+	if ( !r_vbo->integer || !tr.world ) {
+		return;
+	}
+
+	R_SyncRenderThread();
+
+	surfs = ri.Hunk_AllocateTempMemory( tr.world->numsurfaces * sizeof( *surfs ) );
+	numSurfs = 0;
+	for ( i = 0 ; i < tr.world->numsurfaces ; i++ ) {
+		if ( R_VBOSurfaceSize( &tr.world->surfaces[i], &numVertexes, &numIndexes ) ) {
+			surfs[numSurfs++] = &tr.world->surfaces[i];
+		}
+	}
+	qsort( surfs, numSurfs, sizeof( *surfs ), R_CompareVBOSurfaces );
+
+	totalVertexes = 0;
+	vbo = NULL;
+	first = 0;
+	for ( i = 0 ; i <= numSurfs ; i++ ) {
+		if ( i < numSurfs ) {
+			R_VBOSurfaceSize( surfs[i], &numVertexes, &numIndexes );
+			if ( vbo && vbo->numVertexes + numVertexes <= MAX_VBO_VERTEXES ) {
+				vbo->numVertexes += numVertexes;
+				vbo->numIndexes += numIndexes;
+				continue;
+			}
+		}
+
+		// the current pool is full, upload it
+		if ( vbo ) {
+			totalVertexes += vbo->numVertexes;
+			R_UploadWorldVBO( vbo, surfs + first, i - first );
+			numWorldVBOs++;
+			vbo = NULL;
+		}
+		if ( i == numSurfs || numWorldVBOs == MAX_WORLD_VBOS ) {
+			break;
+		}
+
+		// a zero name means the backend has no buffer objects
+		qglGenBuffers( 2, buffers );
+		if ( !buffers[0] || !buffers[1] ) {
+			break;
+		}
+
+		vbo = &worldVBOs[numWorldVBOs];
+		vbo->vertexBuffer = buffers[0];
+		vbo->indexBuffer = buffers[1];
+		vbo->numVertexes = numVertexes;
+		vbo->numIndexes = numIndexes;
+		first = i;
+	}
+
+	qglBindBuffer( GL_ARRAY_BUFFER, 0 );
+	qglBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+
+	ri.Hunk_FreeTempMemory( surfs );
+
+	if ( numWorldVBOs ) {
+		ri.Printf( PRINT_ALL, "%i world vertexes in %i buffer objects\n", totalVertexes, numWorldVBOs );
+	}
+}
+
+/*
+===============
+R_ShutdownWorldVBOs
+===============
+*/
+void R_ShutdownWorldVBOs( void ) {
+	int		i;
+
+	for ( i = 0 ; i < numWorldVBOs ; i++ ) {
+		qglDeleteBuffers( 1, &worldVBOs[i].vertexBuffer );
+		qglDeleteBuffers( 1, &worldVBOs[i].indexBuffer );
+	}
+	Com_Memset( worldVBOs, 0, sizeof( worldVBOs ) );
+	numWorldVBOs = 0;
+}
+
+/*
+===============
+RB_AddWorldVBOSurface
+
+Queues the surface's index range instead of tessellating it.
+Returns qfalse if the surface has to go through the tessellator
+this time.
+===============
+*/
+qboolean RB_AddWorldVBOSurface( int vbo, int firstIndex, int numIndexes, int dlightBits ) {
+	vboRange_t	*range;
+
+	if ( !vbo || vbo > numWorldVBOs ) {
+		return qfalse;
+	}
+
+	// dlights and fog are computed from the tessellated positions,
+	// and the debug views only look at the tessellator
+	if ( tess.currentStageIteratorFunc != RB_StageIteratorLightmappedMultitexture
+		|| dlightBits || ( tess.fogNum && tess.shader->fogPass )
+		|| r_showtris->integer || r_shownormals->integer ) {
+		return qfalse;
+	}
+
+	// surfaces laid out next to each other make one draw
+	if ( tess.numVBORanges ) {
+		range = &tess.vboRanges[tess.numVBORanges - 1];
+		if ( range->vbo == vbo && range->firstIndex + range->numIndexes == firstIndex ) {
+			range->numIndexes += numIndexes;
+			return qtrue;
+		}
+	}
+
+	if ( tess.numVBORanges == MAX_VBO_RANGES ) {
+		RB_EndSurface();
+		RB_BeginSurface( tess.shader, tess.fogNum );
+	}
+
+	range = &tess.vboRanges[tess.numVBORanges++];
+	range->vbo = vbo;
+	range->firstIndex = firstIndex;
+	range->numIndexes = numIndexes;
+
+	return qtrue;
+}
+
+/*
+===============
+RB_DrawWorldVBOs
+
+Draws the queued ranges with the textures the stage iterator
+has set up, and leaves texture unit 1 selected like it found it
+===============
+*/
+void RB_DrawWorldVBOs( void ) {
+	vboRange_t	*range;
+	worldVBO_t	*vbo;
+	int			current;
+	int			i;
+
+	current = 0;
+	for ( i = 0, range = tess.vboRanges ; i < tess.numVBORanges ; i++, range++ ) {
+		if ( range->vbo != current ) {
+			current = range->vbo;
+			vbo = &worldVBOs[current - 1];
+
+			qglBindBuffer( GL_ARRAY_BUFFER, vbo->vertexBuffer );
+			qglBindBuffer( GL_ELEMENT_ARRAY_BUFFER, vbo->indexBuffer );
+
+			qglVertexPointer( 3, GL_FLOAT, sizeof( vboVert_t ), VBO_OFS( xyz ) );
+			qglColorPointer( 4, GL_UNSIGNED_BYTE, sizeof( vboVert_t ), VBO_OFS( color ) );
+			GL_SelectTexture( 0 );
+			qglTexCoordPointer( 2, GL_FLOAT, sizeof( vboVert_t ), VBO_OFS( st ) );
+			GL_SelectTexture( 1 );
+			qglTexCoordPointer( 2, GL_FLOAT, sizeof( vboVert_t ), VBO_OFS( lightmap ) );
+		}
+
+		qglDrawElements( GL_TRIANGLES, range->numIndexes, GL_INDEX_TYPE,
+			(void *)( range->firstIndex * sizeof( glIndex_t ) ) );
+		backEnd.pc.c_draws++;
+
+		backEnd.pc.c_indexes += range->numIndexes;
+		backEnd.pc.c_totalIndexes += range->numIndexes;
+	}
+
+	qglBindBuffer( GL_ARRAY_BUFFER, 0 );
+	qglBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+}
@@ -31,10 +31,10 @@ Returns true if the grid is completely culled away.
 Also sets the clipped hint bit in tess
 =================
 */
-static qboolean	R_CullTriSurf( srfTriangles_t *cv ) {
+static qboolean	R_CullTriSurf( frontEndWork_t *work, srfTriangles_t *cv ) {
 	int 	boxCull;
 
-	boxCull = R_CullLocalBox( cv->bounds );
+	boxCull = R_CullLocalBox( &work->or, cv->bounds );
 
 	if ( boxCull == CULL_OUT ) {
 		return qtrue;
@@ -50,7 +50,7 @@ Returns true if the grid is completely culled away.
 Also sets the clipped hint bit in tess
 =================
 */
-static qboolean	R_CullGrid( srfGridMesh_t *cv ) {
+static qboolean	R_CullGrid( frontEndWork_t *work, srfGridMesh_t *cv ) {
 	int 	boxCull;
 	int 	sphereCull;
 
@@ -58,8 +58,8 @@ static qboolean	R_CullGrid( srfGridMesh_t *cv ) {
 		return qtrue;
 	}
 
-	if ( tr.currentEntityNum != ENTITYNUM_WORLD ) {
-		sphereCull = R_CullLocalPointAndRadius( cv->localOrigin, cv->meshRadius );
+	if ( work->currentEntityNum != ENTITYNUM_WORLD ) {
+		sphereCull = R_CullLocalPointAndRadius( &work->or, cv->localOrigin, cv->meshRadius );
 	} else {
 		sphereCull = R_CullPointAndRadius( cv->localOrigin, cv->meshRadius );
 	}
@@ -68,33 +68,33 @@ static qboolean	R_CullGrid( srfGridMesh_t *cv ) {
 	// check for trivial reject
 	if ( sphereCull == CULL_OUT )
 	{
-		tr.pc.c_sphere_cull_patch_out++;
+		work->pc.c_sphere_cull_patch_out++;
 		return qtrue;
 	}
 	// check bounding box if necessary
 	else if ( sphereCull == CULL_CLIP )
 	{
-		tr.pc.c_sphere_cull_patch_clip++;
+		work->pc.c_sphere_cull_patch_clip++;
 
-		boxCull = R_CullLocalBox( cv->meshBounds );
+		boxCull = R_CullLocalBox( &work->or, cv->meshBounds );
 
 		if ( boxCull == CULL_OUT ) 
 		{
-			tr.pc.c_box_cull_patch_out++;
+			work->pc.c_box_cull_patch_out++;
 			return qtrue;
 		}
 		else if ( boxCull == CULL_IN )
 		{
-			tr.pc.c_box_cull_patch_in++;
+			work->pc.c_box_cull_patch_in++;
 		}
 		else
 		{
-			tr.pc.c_box_cull_patch_clip++;
+			work->pc.c_box_cull_patch_clip++;
 		}
 	}
 	else
 	{
-		tr.pc.c_sphere_cull_patch_in++;
+		work->pc.c_sphere_cull_patch_in++;
 	}
 
 	return qfalse;
@@ -111,7 +111,7 @@ added to the sorting list.
 This will also allow mirrors on both sides of a model without recursion.
 ================
 */
-static qboolean	R_CullSurface( surfaceType_t *surface, shader_t *shader ) {
+static qboolean	R_CullSurface( frontEndWork_t *work, surfaceType_t *surface, shader_t *shader ) {
 	srfSurfaceFace_t *sface;
 	float			d;
 
@@ -120,11 +120,11 @@ static qboolean	R_CullSurface( surfaceType_t *surface, shader_t *shader ) {
 	}
 
 	if ( *surface == SF_GRID ) {
-		return R_CullGrid( (srfGridMesh_t *)surface );
+		return R_CullGrid( work, (srfGridMesh_t *)surface );
 	}
 
 	if ( *surface == SF_TRIANGLES ) {
-		return R_CullTriSurf( (srfTriangles_t *)surface );
+		return R_CullTriSurf( work, (srfTriangles_t *)surface );
 	}
 
 	if ( *surface != SF_FACE ) {
@@ -141,7 +141,7 @@ static qboolean	R_CullSurface( surfaceType_t *surface, shader_t *shader ) {
 	}
 
 	sface = ( srfSurfaceFace_t * ) surface;
-	d = DotProduct (tr.or.viewOrigin, sface->plane.normal);
+	d = DotProduct (work->or.viewOrigin, sface->plane.normal);
 
 	// don't cull exactly on the plane, because there are levels of rounding
 	// through the BSP, ICD, and hardware that may cause pixel gaps if an
@@ -160,7 +160,7 @@ static qboolean	R_CullSurface( surfaceType_t *surface, shader_t *shader ) {
 }
 
 
-static int R_DlightFace( srfSurfaceFace_t *face, int dlightBits ) {
+static int R_DlightFace( frontEndWork_t *work, srfSurfaceFace_t *face, int dlightBits ) {
 	float		d;
 	int			i;
 	dlight_t	*dl;
@@ -178,14 +178,14 @@ static int R_DlightFace( srfSurfaceFace_t *face, int dlightBits ) {
 	}
 
 	if ( !dlightBits ) {
-		tr.pc.c_dlightSurfacesCulled++;
+		work->pc.c_dlightSurfacesCulled++;
 	}
 
 	face->dlightBits[ tr.smpFrame ] = dlightBits;
 	return dlightBits;
 }
 
-static int R_DlightGrid( srfGridMesh_t *grid, int dlightBits ) {
+static int R_DlightGrid( frontEndWork_t *work, srfGridMesh_t *grid, int dlightBits ) {
 	int			i;
 	dlight_t	*dl;
 
@@ -206,7 +206,7 @@ static int R_DlightGrid( srfGridMesh_t *grid, int dlightBits ) {
 	}
 
 	if ( !dlightBits ) {
-		tr.pc.c_dlightSurfacesCulled++;
+		work->pc.c_dlightSurfacesCulled++;
 	}
 
 	grid->dlightBits[ tr.smpFrame ] = dlightBits;
@@ -256,11 +256,11 @@ that is touched by one or more dlights, so try to throw out
 more dlights if possible.
 ====================
 */
-static int R_DlightSurface( msurface_t *surf, int dlightBits ) {
+static int R_DlightSurface( frontEndWork_t *work, msurface_t *surf, int dlightBits ) {
 	if ( *surf->data == SF_FACE ) {
-		dlightBits = R_DlightFace( (srfSurfaceFace_t *)surf->data, dlightBits );
+		dlightBits = R_DlightFace( work, (srfSurfaceFace_t *)surf->data, dlightBits );
 	} else if ( *surf->data == SF_GRID ) {
-		dlightBits = R_DlightGrid( (srfGridMesh_t *)surf->data, dlightBits );
+		dlightBits = R_DlightGrid( work, (srfGridMesh_t *)surf->data, dlightBits );
 	} else if ( *surf->data == SF_TRIANGLES ) {
 		dlightBits = R_DlightTrisurf( (srfTriangles_t *)surf->data, dlightBits );
 	} else {
@@ -268,7 +268,7 @@ static int R_DlightSurface( msurface_t *surf, int dlightBits ) {
 	}
 
 	if ( dlightBits ) {
-		tr.pc.c_dlightSurfaces++;
+		work->pc.c_dlightSurfaces++;
 	}
 
 	return dlightBits;
@@ -281,26 +281,39 @@ static int R_DlightSurface( msurface_t *surf, int dlightBits ) {
 R_AddWorldSurface
 ======================
 */
-static void R_AddWorldSurface( msurface_t *surf, int dlightBits ) {
-	if ( surf->viewCount == tr.viewCount ) {
+static void R_AddWorldSurface( frontEndWork_t *work, msurface_t *surf, int dlightBits ) {
+	int		viewCount;
+
+	viewCount = surf->viewCount;
+	if ( viewCount == tr.viewCount ) {
 		return;		// already in this view
 	}
 
-	surf->viewCount = tr.viewCount;
+#ifdef __GNUC__
+	// another work may be adding the same surface from another leaf
+	if ( work->shared ) {
+		if ( !__sync_bool_compare_and_swap( &surf->viewCount, viewCount, tr.viewCount ) ) {
+			return;
+		}
+	} else
+#endif
+	{
+		surf->viewCount = tr.viewCount;
+	}
 	// FIXME: bmodel fog?
 
 	// try to cull before dlighting or adding
-	if ( R_CullSurface( surf->data, surf->shader ) ) {
+	if ( R_CullSurface( work, surf->data, surf->shader ) ) {
 		return;
 	}
 
 	// check for dlighting
 	if ( dlightBits ) {
-		dlightBits = R_DlightSurface( surf, dlightBits );
+		dlightBits = R_DlightSurface( work, surf, dlightBits );
 		dlightBits = ( dlightBits != 0 );
 	}
 
-	R_AddDrawSurf( surf->data, surf->shader, surf->fogIndex, dlightBits );
+	R_AddDrawSurf( work, surf->data, surf->shader, surf->fogIndex, dlightBits );
 }
 
 /*
@@ -316,7 +329,7 @@ static void R_AddWorldSurface( msurface_t *surf, int dlightBits ) {
 R_AddBrushModelSurfaces
 =================
 */
-void R_AddBrushModelSurfaces ( trRefEntity_t *ent ) {
+void R_AddBrushModelSurfaces ( frontEndWork_t *work, trRefEntity_t *ent ) {
 	bmodel_t	*bmodel;
 	int			clip;
 	model_t		*pModel;
@@ -326,15 +339,15 @@ void R_AddBrushModelSurfaces ( trRefEntity_t *ent ) {
 
 	bmodel = pModel->bmodel;
 
-	clip = R_CullLocalBox( bmodel->bounds );
+	clip = R_CullLocalBox( &work->or, bmodel->bounds );
 	if ( clip == CULL_OUT ) {
 		return;
 	}
 	
-	R_DlightBmodel( bmodel );
+	R_DlightBmodel( work, bmodel );
 
 	for ( i = 0 ; i < bmodel->numSurfaces ; i++ ) {
-		R_AddWorldSurface( bmodel->firstSurface + i, tr.currentEntity->needDlights );
+		R_AddWorldSurface( work, bmodel->firstSurface + i, ent->needDlights );
 	}
 }
 
@@ -347,68 +360,89 @@ void R_AddBrushModelSurfaces ( trRefEntity_t *ent ) {
 =============================================================
 */
 
-
 /*
 ================
-R_RecursiveWorldNode
+R_CullWorldNode
+
+Returns qtrue if nothing under the node can be visible, and
+clears the planeBits of the frustum planes it is in front of
 ================
 */
-static void R_RecursiveWorldNode( mnode_t *node, int planeBits, int dlightBits ) {
+static qboolean R_CullWorldNode( mnode_t *node, int *planeBits ) {
+	int		i, r;
 
-	do {
-		int			newDlights[2];
+	// if the node wasn't marked as potentially visible, exit
+	if (node->visframe != tr.visCount) {
+		return qtrue;
+	}
 
-		// if the node wasn't marked as potentially visible, exit
-		if (node->visframe != tr.visCount) {
-			return;
+	// if the bounding volume is outside the frustum, nothing
+	// inside can be visible OPTIMIZE: don't do this all the way to leafs?
+
+	if ( r_nocull->integer ) {
+		return qfalse;
+	}
+
+	for ( i = 0 ; i < 4 ; i++ ) {
+		if ( *planeBits & ( 1 << i ) ) {
+			r = BoxOnPlaneSide(node->mins, node->maxs, &tr.viewParms.frustum[i]);
+			if (r == 2) {
+				return qtrue;					// culled
+			}
+			if ( r == 1 ) {
+				*planeBits &= ~( 1 << i );		// all descendants will also be in front
+			}
 		}
+	}
+
+	return qfalse;
+}
 
-		// if the bounding volume is outside the frustum, nothing
-		// inside can be visible OPTIMIZE: don't do this all the way to leafs?
+/*
+================
+R_SplitWorldDlights
 
-		if ( !r_nocull->integer ) {
-			int		r;
+Determines which dlights are needed on each side of a node
+================
+*/
+static void R_SplitWorldDlights( mnode_t *node, int dlightBits, int newDlights[2] ) {
+	int			i;
+	dlight_t	*dl;
+	float		dist;
 
-			if ( planeBits & 1 ) {
-				r = BoxOnPlaneSide(node->mins, node->maxs, &tr.viewParms.frustum[0]);
-				if (r == 2) {
-					return;						// culled
-				}
-				if ( r == 1 ) {
-					planeBits &= ~1;			// all descendants will also be in front
-				}
-			}
+	newDlights[0] = 0;
+	newDlights[1] = 0;
+	if ( !dlightBits ) {
+		return;
+	}
 
-			if ( planeBits & 2 ) {
-				r = BoxOnPlaneSide(node->mins, node->maxs, &tr.viewParms.frustum[1]);
-				if (r == 2) {
-					return;						// culled
-				}
-				if ( r == 1 ) {
-					planeBits &= ~2;			// all descendants will also be in front
-				}
+	for ( i = 0 ; i < tr.refdef.num_dlights ; i++ ) {
+		if ( dlightBits & ( 1 << i ) ) {
+			dl = &tr.refdef.dlights[i];
+			dist = DotProduct( dl->origin, node->plane->normal ) - node->plane->dist;
+			
+			if ( dist > -dl->radius ) {
+				newDlights[0] |= ( 1 << i );
 			}
-
-			if ( planeBits & 4 ) {
-				r = BoxOnPlaneSide(node->mins, node->maxs, &tr.viewParms.frustum[2]);
-				if (r == 2) {
-					return;						// culled
-				}
-				if ( r == 1 ) {
-					planeBits &= ~4;			// all descendants will also be in front
-				}
+			if ( dist < dl->radius ) {
+				newDlights[1] |= ( 1 << i );
 			}
+		}
+	}
+}
 
-			if ( planeBits & 8 ) {
-				r = BoxOnPlaneSide(node->mins, node->maxs, &tr.viewParms.frustum[3]);
-				if (r == 2) {
-					return;						// culled
-				}
-				if ( r == 1 ) {
-					planeBits &= ~8;			// all descendants will also be in front
-				}
-			}
+/*
+================
+R_RecursiveWorldNode
+================
+*/
+static void R_RecursiveWorldNode( frontEndWork_t *work, mnode_t *node, int planeBits, int dlightBits ) {
+
+	do {
+		int			newDlights[2];
 
+		if ( R_CullWorldNode( node, &planeBits ) ) {
+			return;
 		}
 
 		if ( node->contents != -1 ) {
@@ -417,33 +451,10 @@ static void R_RecursiveWorldNode( mnode_t *node, int planeBits, int dlightBits )
 
 		// node is just a decision point, so go down both sides
 		// since we don't care about sort orders, just go positive to negative
-
-		// determine which dlights are needed
-		newDlights[0] = 0;
-		newDlights[1] = 0;
-		if ( dlightBits ) {
-			int	i;
-
-			for ( i = 0 ; i < tr.refdef.num_dlights ; i++ ) {
-				dlight_t	*dl;
-				float		dist;
-
-				if ( dlightBits & ( 1 << i ) ) {
-					dl = &tr.refdef.dlights[i];
-					dist = DotProduct( dl->origin, node->plane->normal ) - node->plane->dist;
-					
-					if ( dist > -dl->radius ) {
-						newDlights[0] |= ( 1 << i );
-					}
-					if ( dist < dl->radius ) {
-						newDlights[1] |= ( 1 << i );
-					}
-				}
-			}
-		}
+		R_SplitWorldDlights( node, dlightBits, newDlights );
 
 		// recurse down the children, front side first
-		R_RecursiveWorldNode (node->children[0], planeBits, newDlights[0] );
+		R_RecursiveWorldNode (work, node->children[0], planeBits, newDlights[0] );
 
 		// tail recurse
 		node = node->children[1];
@@ -455,28 +466,11 @@ static void R_RecursiveWorldNode( mnode_t *node, int planeBits, int dlightBits )
 		int			c;
 		msurface_t	*surf, **mark;
 
-		tr.pc.c_leafs++;
+		work->pc.c_leafs++;
 
 		// add to z buffer bounds
-		if ( node->mins[0] < tr.viewParms.visBounds[0][0] ) {
-			tr.viewParms.visBounds[0][0] = node->mins[0];
-		}
-		if ( node->mins[1] < tr.viewParms.visBounds[0][1] ) {
-			tr.viewParms.visBounds[0][1] = node->mins[1];
-		}
-		if ( node->mins[2] < tr.viewParms.visBounds[0][2] ) {
-			tr.viewParms.visBounds[0][2] = node->mins[2];
-		}
-
-		if ( node->maxs[0] > tr.viewParms.visBounds[1][0] ) {
-			tr.viewParms.visBounds[1][0] = node->maxs[0];
-		}
-		if ( node->maxs[1] > tr.viewParms.visBounds[1][1] ) {
-			tr.viewParms.visBounds[1][1] = node->maxs[1];
-		}
-		if ( node->maxs[2] > tr.viewParms.visBounds[1][2] ) {
-			tr.viewParms.visBounds[1][2] = node->maxs[2];
-		}
+		AddPointToBounds( node->mins, work->visBounds[0], work->visBounds[1] );
+		AddPointToBounds( node->maxs, work->visBounds[0], work->visBounds[1] );
 
 		// add the individual surfaces
 		mark = node->firstmarksurface;
@@ -485,13 +479,81 @@ static void R_RecursiveWorldNode( mnode_t *node, int planeBits, int dlightBits )
 			// the surface may have already been added if it
 			// spans multiple leafs
 			surf = *mark;
-			R_AddWorldSurface( surf, dlightBits );
+			R_AddWorldSurface( work, surf, dlightBits );
 			mark++;
 		}
 	}
 
 }
 
+/*
+=============================================================
+
+	PARALLEL WORLD TRAVERSAL
+
+The top of the tree is walked on the main thread down to
+WORLD_SPLIT_DEPTH, and the subtrees left are handed out to
+the works in turn.
+
+=============================================================
+*/
+
+#define	WORLD_SPLIT_DEPTH		4
+#define	MAX_WORLD_SUBTREES		( 1 << WORLD_SPLIT_DEPTH )
+
+typedef struct {
+	mnode_t		*node;
+	int			planeBits;
+	int			dlightBits;
+} worldSubtree_t;
+
+static worldSubtree_t	worldSubtrees[MAX_WORLD_SUBTREES];
+static int				numWorldSubtrees;
+
+/*
+================
+R_SplitWorldNode
+================
+*/
+static void R_SplitWorldNode( mnode_t *node, int planeBits, int dlightBits, int depth ) {
+	int		newDlights[2];
+
+	if ( R_CullWorldNode( node, &planeBits ) ) {
+		return;
+	}
+
+	if ( node->contents != -1 || !depth ) {
+		worldSubtrees[numWorldSubtrees].node = node;
+		worldSubtrees[numWorldSubtrees].planeBits = planeBits;
+		worldSubtrees[numWorldSubtrees].dlightBits = dlightBits;
+		numWorldSubtrees++;
+		return;
+	}
+
+	R_SplitWorldDlights( node, dlightBits, newDlights );
+
+	R_SplitWorldNode( node->children[0], planeBits, newDlights[0], depth - 1 );
+	R_SplitWorldNode( node->children[1], planeBits, newDlights[1], depth - 1 );
+}
+
+/*
+================
+R_WorldSubtreesJob
+
+Runs on a job thread
+================
+*/
+static void R_WorldSubtreesJob( void *data ) {
+	frontEndWork_t	*work = data;
+	worldSubtree_t	*subtree;
+	int				i;
+
+	for ( i = work->index ; i < numWorldSubtrees ; i += work->step ) {
+		subtree = &worldSubtrees[i];
+		R_RecursiveWorldNode( work, subtree->node, subtree->planeBits, subtree->dlightBits );
+	}
+}
+
 
 /*
 ===============
@@ -643,6 +705,8 @@ R_AddWorldSurfaces
 =============
 */
 void R_AddWorldSurfaces (void) {
+	int		numWork, dlightBits;
+
 	if ( !r_drawworld->integer ) {
 		return;
 	}
@@ -651,9 +715,6 @@ void R_AddWorldSurfaces (void) {
 		return;
 	}
 
-	tr.currentEntityNum = ENTITYNUM_WORLD;
-	tr.shiftedEntityNum = tr.currentEntityNum << QSORT_ENTITYNUM_SHIFT;
-
 	// determine which leaves are in the PVS / areamask
 	R_MarkLeaves ();
 
@@ -664,5 +725,18 @@ void R_AddWorldSurfaces (void) {
 	if ( tr.refdef.num_dlights > 32 ) {
 		tr.refdef.num_dlights = 32 ;
 	}
-	R_RecursiveWorldNode( tr.world->nodes, 15, ( 1 << tr.refdef.num_dlights ) - 1 );
+	dlightBits = ( 1 << tr.refdef.num_dlights ) - 1;
+
+	numWork = R_NumFrontEndWork();
+	if ( numWork == 1 ) {
+		worldSubtrees[0].node = tr.world->nodes;
+		worldSubtrees[0].planeBits = 15;
+		worldSubtrees[0].dlightBits = dlightBits;
+		numWorldSubtrees = 1;
+	} else {
+		numWorldSubtrees = 0;
+		R_SplitWorldNode( tr.world->nodes, 15, dlightBits, WORLD_SPLIT_DEPTH );
+	}
+
+	R_RunFrontEndWork( numWork, R_WorldSubtreesJob );
 }
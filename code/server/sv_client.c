@@ -50,7 +50,7 @@ void SV_GetChallenge( netadr_t from ) {
 	challenge_t	*challenge;
 
 	// ignore if we are in single player
-	if ( Cvar_VariableValue( "g_gametype" ) == GT_SINGLE_PLAYER || Cvar_VariableValue("ui_singlePlayerActive")) {
+	if ( sv_gametype->integer == GT_SINGLE_PLAYER || Cvar_RefValue( &sv_singlePlayerActive )) {
 		return;
 	}
 
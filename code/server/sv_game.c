@@ -842,7 +842,7 @@ intptr_t SV_GameSystemCalls( intptr_t *args ) {
 		return 0;
 
 	case TRAP_FLOOR:
-		return FloatAsInt( floor( VMF(1) ) );
+		return FloatAsInt( VM_Floor( VMF(1) ) );
 
 	case TRAP_CEIL:
 		return FloatAsInt( ceil( VMF(1) ) );
@@ -854,6 +854,31 @@ intptr_t SV_GameSystemCalls( intptr_t *args ) {
 	return -1;
 }
 
+/*
+====================
+SV_GameTrace
+
+trap_Trace called directly from compiled code
+====================
+*/
+static intptr_t SV_GameTrace( int *args ) {
+	SV_Trace( VMA(1), VMA(2), VMA(3), VMA(4), VMA(5), args[6], args[7], /*int capsule*/ qfalse );
+	return 0;
+}
+
+// system calls compiled game code handles without SV_GameSystemCalls
+static const vmFastSyscall_t sv_gameFastSyscalls[] = {
+	{ G_TRACE,		VMSC_DIRECT,	SV_GameTrace },
+	{ TRAP_MEMSET,	VMSC_MEMSET },
+	{ TRAP_MEMCPY,	VMSC_MEMCPY },
+	{ TRAP_SIN,		VMSC_SIN },
+	{ TRAP_COS,		VMSC_COS },
+	{ TRAP_ATAN2,	VMSC_ATAN2 },
+	{ TRAP_SQRT,	VMSC_SQRT },
+	{ TRAP_FLOOR,	VMSC_FLOOR },
+	{ 0,			VMSC_NONE }
+};
+
 /*
 ===============
 SV_ShutdownGameProgs
@@ -942,7 +967,7 @@ void SV_InitGameProgs( void ) {
 	}
 
 	// load the dll or bytecode
-	gvm = VM_Create( "qagame", SV_GameSystemCalls, Cvar_VariableValue( "vm_game" ) );
+	gvm = VM_Create( "qagame", SV_GameSystemCalls, sv_gameFastSyscalls, Cvar_VariableValue( "vm_game" ) );
 	if ( !gvm ) {
 		Com_Error( ERR_FATAL, "VM_Create on game failed" );
 	}
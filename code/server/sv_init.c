@@ -479,6 +479,8 @@ void SV_SpawnServer( char *server, qboolean killBots ) {
 	sv.checksumFeed = ( ((int) rand() << 16) ^ rand() ) ^ Com_Milliseconds();
 	FS_Restart( sv.checksumFeed );
 
+	FS_BeginMapLoad( server );
+
 	CM_LoadMap( va("maps/%s.bsp", server), qfalse, &checksum );
 
 	// set serverinfo visible name
@@ -617,6 +619,11 @@ void SV_SpawnServer( char *server, qboolean killBots ) {
 
 	Hunk_SetMark();
 
+	// a listen server finishes the load in CL_InitCGame
+	if ( com_dedicated->integer ) {
+		FS_EndMapLoad();
+	}
+
 	Com_Printf ("-----------------------------------\n");
 }
 
@@ -53,6 +53,7 @@ cvar_t	*sv_maxRate;
 cvar_t	*sv_minPing;
 cvar_t	*sv_maxPing;
 cvar_t	*sv_gametype;
+cvarRef_t	sv_singlePlayerActive = { "ui_singlePlayerActive" };
 cvar_t	*sv_pure;
 cvar_t	*sv_floodProtect;
 cvar_t	*sv_lanForceRate; // dedicated 1 (LAN) server forces local client rates to 99999 (bug #491)
@@ -243,6 +244,10 @@ void SV_MasterHeartbeat( void ) {
 		return;		// only dedicated servers send heartbeats
 	}
 
+	if ( com_journal->integer == 2 ) {
+		return;		// a replay doesn't talk to the masters
+	}
+
 	// if not time yet, don't send anything
 	if ( svs.time < svs.nextHeartbeatTime ) {
 		return;
@@ -336,7 +341,7 @@ static void SVC_Status( netadr_t from ) {
 	char	infostring[MAX_INFO_STRING];
 
 	// ignore if we are in single player
-	if ( Cvar_VariableValue( "g_gametype" ) == GT_SINGLE_PLAYER ) {
+	if ( sv_gametype->integer == GT_SINGLE_PLAYER ) {
 		return;
 	}
 
@@ -381,7 +386,7 @@ void SVC_Info( netadr_t from ) {
 	char	infostring[MAX_INFO_STRING];
 
 	// ignore if we are in single player
-	if ( Cvar_VariableValue( "g_gametype" ) == GT_SINGLE_PLAYER || Cvar_VariableValue("ui_singlePlayerActive")) {
+	if ( sv_gametype->integer == GT_SINGLE_PLAYER || Cvar_RefValue( &sv_singlePlayerActive )) {
 		return;
 	}
 
@@ -780,6 +785,7 @@ happen before SV_Frame is called
 void SV_Frame( int msec ) {
 	int		frameMsec;
 	int		startTime;
+	int		i;
 
 	// the menu kills the server with this cvar
 	if ( sv_killserver->integer ) {
@@ -793,7 +799,9 @@ void SV_Frame( int msec ) {
 		// Running as a server, but no map loaded
 #ifdef DEDICATED
 		// Block until something interesting happens
-		Sys_Sleep(-1);
+		if ( com_journal->integer != 2 ) {
+			Sys_Sleep(-1);
+		}
 #endif
 
 		return;
@@ -823,8 +831,11 @@ void SV_Frame( int msec ) {
 
 	if ( com_dedicated->integer && sv.timeResidual < frameMsec ) {
 		// NET_Sleep will give the OS time slices until either get a packet
-		// or time enough for a server frame has gone by
-		NET_Sleep(frameMsec - sv.timeResidual);
+		// or time enough for a server frame has gone by,
+		// a replay gets its packets and time from the journal
+		if ( com_journal->integer != 2 ) {
+			NET_Sleep(frameMsec - sv.timeResidual);
+		}
 		return;
 	}
 
@@ -881,6 +892,14 @@ void SV_Frame( int msec ) {
 		VM_Call (gvm, GAME_RUN_FRAME, sv.time);
 	}
 
+	if ( com_journal->integer ) {
+		for ( i = 0 ; i < sv_maxclients->integer ; i++ ) {
+			if ( svs.clients[i].state == CS_ACTIVE ) {
+				Com_JournalChecksum( SV_GameClientNum( i ), sizeof( playerState_t ) );
+			}
+		}
+	}
+
 	if ( com_speeds->integer ) {
 		time_game = Sys_Milliseconds () - startTime;
 	}
@@ -0,0 +1,355 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+
+#include "../qcommon/q_shared.h"
+#include "../qcommon/qcommon.h"
+
+/*
+=============================================================================
+
+BACKGROUND JOBS
+
+A small pool of worker threads taking jobs from a single fifo. The
+job_t is owned by the caller and must stay valid until the job is
+done or has been cancelled. Job functions run without any engine
+state, they must not touch the zone, the hunk, cvars, the file
+handles or print anything.
+
+=============================================================================
+*/
+
+#define MAX_JOB_THREADS		8
+
+#ifdef _WIN32
+
+#include <windows.h>
+
+typedef HANDLE				jobThread_t;
+
+// condition variables need Vista, the Makefile still targets XP. Wakeups
+// of the job threads are counted in a semaphore, a thread that finds
+// nothing to do just waits again. The done event stays set until every
+// thread that was waiting on it has woken up.
+static CRITICAL_SECTION		jobLock;
+static HANDLE				jobWork;
+static HANDLE				jobDone;
+static int					jobDoneWaiters;
+
+#define JobLock()			EnterCriticalSection( &jobLock )
+#define JobUnlock()			LeaveCriticalSection( &jobLock )
+#define JobSignalWork()		ReleaseSemaphore( jobWork, 1, NULL )
+#define JobBroadcastWork()	ReleaseSemaphore( jobWork, MAX_JOB_THREADS, NULL )
+#define JobBroadcastDone()	SetEvent( jobDone )
+
+static void JobWaitWork( void ) {
+	JobUnlock();
+	WaitForSingleObject( jobWork, INFINITE );
+	JobLock();
+}
+
+static void JobWaitDone( void ) {
+	jobDoneWaiters++;
+	JobUnlock();
+	WaitForSingleObject( jobDone, INFINITE );
+	JobLock();
+	if ( !--jobDoneWaiters ) {
+		ResetEvent( jobDone );
+	}
+}
+
+#else
+
+#include <pthread.h>
+
+typedef pthread_t			jobThread_t;
+
+static pthread_mutex_t		jobLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t		jobWork = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t		jobDone = PTHREAD_COND_INITIALIZER;
+
+#define JobLock()			pthread_mutex_lock( &jobLock )
+#define JobUnlock()			pthread_mutex_unlock( &jobLock )
+#define JobWaitWork()		pthread_cond_wait( &jobWork, &jobLock )
+#define JobWaitDone()		pthread_cond_wait( &jobDone, &jobLock )
+#define JobSignalWork()		pthread_cond_signal( &jobWork )
+#define JobBroadcastWork()	pthread_cond_broadcast( &jobWork )
+#define JobBroadcastDone()	pthread_cond_broadcast( &jobDone )
+
+#endif
+
+static jobThread_t	jobThreads[MAX_JOB_THREADS];
+static int			numJobThreads;
+static qboolean		jobsQuit;
+
+static job_t		*jobHead;
+static job_t		*jobTail;
+static int			jobsRunning;
+
+/*
+=================
+Sys_UnlinkJob
+
+The lock must be held
+=================
+*/
+static void Sys_UnlinkJob( job_t *job ) {
+	job_t	**prev;
+
+	for ( prev = &jobHead ; *prev ; prev = &(*prev)->next ) {
+		if ( *prev == job ) {
+			*prev = job->next;
+			break;
+		}
+	}
+
+	if ( jobTail == job ) {
+		for ( jobTail = jobHead ; jobTail && jobTail->next ; jobTail = jobTail->next ) {
+		}
+	}
+	job->next = NULL;
+}
+
+/*
+=================
+Sys_JobThread
+=================
+*/
+#ifdef _WIN32
+static DWORD WINAPI Sys_JobThread( LPVOID arg )
+#else
+static void *Sys_JobThread( void *arg )
+#endif
+{
+	job_t	*job;
+
+	JobLock();
+	for ( ;; ) {
+		while ( !jobHead && !jobsQuit ) {
+			JobWaitWork();
+		}
+		if ( !jobHead ) {
+			break;
+		}
+
+		job = jobHead;
+		jobHead = job->next;
+		if ( !jobHead ) {
+			jobTail = NULL;
+		}
+		job->next = NULL;
+		job->state = JOB_RUNNING;
+		jobsRunning++;
+		JobUnlock();
+
+		job->function( job->data );
+
+		JobLock();
+		job->state = JOB_DONE;
+		jobsRunning--;
+		JobBroadcastDone();
+	}
+	JobUnlock();
+
+	return 0;
+}
+
+/*
+=================
+Sys_InitJobs
+=================
+*/
+void Sys_InitJobs( int numThreads ) {
+	int		i;
+
+	if ( numJobThreads ) {
+		return;
+	}
+
+	if ( numThreads > MAX_JOB_THREADS ) {
+		numThreads = MAX_JOB_THREADS;
+	}
+
+#ifdef _WIN32
+	// created once, like the statically initialized pthread objects
+	if ( !jobWork ) {
+		InitializeCriticalSection( &jobLock );
+		jobWork = CreateSemaphore( NULL, 0, 0x7fffffff, NULL );
+		jobDone = CreateEvent( NULL, TRUE, FALSE, NULL );
+	}
+#endif
+
+	jobsQuit = qfalse;
+	for ( i = 0 ; i < numThreads ; i++ ) {
+#ifdef _WIN32
+		jobThreads[i] = CreateThread( NULL, 0, Sys_JobThread, NULL, 0, NULL );
+		if ( !jobThreads[i] ) {
+			break;
+		}
+#else
+		if ( pthread_create( &jobThreads[i], NULL, Sys_JobThread, NULL ) ) {
+			break;
+		}
+#endif
+	}
+	numJobThreads = i;
+
+	if ( numJobThreads ) {
+		Com_Printf( "%i job threads started\n", numJobThreads );
+	}
+}
+
+/*
+=================
+Sys_ShutdownJobs
+
+Whatever is still queued is run before the threads exit
+=================
+*/
+void Sys_ShutdownJobs( void ) {
+	int		i;
+
+	if ( !numJobThreads ) {
+		return;
+	}
+
+	JobLock();
+	jobsQuit = qtrue;
+	JobBroadcastWork();
+	JobUnlock();
+
+	for ( i = 0 ; i < numJobThreads ; i++ ) {
+#ifdef _WIN32
+		WaitForSingleObject( jobThreads[i], INFINITE );
+		CloseHandle( jobThreads[i] );
+#else
+		pthread_join( jobThreads[i], NULL );
+#endif
+	}
+	numJobThreads = 0;
+}
+
+/*
+=================
+Sys_NumJobThreads
+=================
+*/
+int Sys_NumJobThreads( void ) {
+	return numJobThreads;
+}
+
+/*
+=================
+Sys_AddJob
+
+Returns qfalse without queueing anything if there are no job threads,
+the caller should do the work itself then
+=================
+*/
+qboolean Sys_AddJob( job_t *job ) {
+	if ( !numJobThreads ) {
+		return qfalse;
+	}
+
+	JobLock();
+	job->state = JOB_QUEUED;
+	job->next = NULL;
+	if ( jobTail ) {
+		jobTail->next = job;
+	} else {
+		jobHead = job;
+	}
+	jobTail = job;
+	JobSignalWork();
+	JobUnlock();
+
+	return qtrue;
+}
+
+/*
+=================
+Sys_FinishJob
+
+Makes sure the job is done. A job that has not been picked up
+by a thread yet is run by the caller instead of waiting for it.
+=================
+*/
+void Sys_FinishJob( job_t *job ) {
+	JobLock();
+	if ( job->state == JOB_QUEUED ) {
+		Sys_UnlinkJob( job );
+		job->state = JOB_RUNNING;
+		JobUnlock();
+
+		job->function( job->data );
+		job->state = JOB_DONE;
+		return;
+	}
+
+	while ( job->state == JOB_RUNNING ) {
+		JobWaitDone();
+	}
+	JobUnlock();
+}
+
+/*
+=================
+Sys_CancelJob
+
+Removes a job that has not been started, or waits for it to finish.
+Returns qtrue if the job function never ran.
+=================
+*/
+qboolean Sys_CancelJob( job_t *job ) {
+	JobLock();
+	if ( job->state == JOB_QUEUED ) {
+		Sys_UnlinkJob( job );
+		job->state = JOB_IDLE;
+		JobUnlock();
+		return qtrue;
+	}
+
+	while ( job->state == JOB_RUNNING ) {
+		JobWaitDone();
+	}
+	JobUnlock();
+
+	return qfalse;
+}
+
+/*
+=================
+Sys_WaitForJobs
+
+Waits until all queued jobs are done
+=================
+*/
+void Sys_WaitForJobs( void ) {
+	if ( !numJobThreads ) {
+		return;
+	}
+
+	JobLock();
+	while ( jobHead || jobsRunning ) {
+		JobWaitDone();
+	}
+	JobUnlock();
+}
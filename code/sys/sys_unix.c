@@ -32,7 +32,10 @@ Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
 #include <dirent.h>
 #include <unistd.h>
 #include <sys/mman.h>
+#include <fcntl.h>
 #include <sys/time.h>
+#include <sys/resource.h>
+#include <time.h>
 #include <pwd.h>
 #include <libgen.h>
 
@@ -105,6 +108,40 @@ int Sys_Milliseconds (void)
 	return curtime;
 }
 
+/*
+================
+Sys_Microseconds
+================
+*/
+unsigned Sys_Microseconds( void )
+{
+#ifdef CLOCK_MONOTONIC
+	struct timespec ts;
+
+	clock_gettime( CLOCK_MONOTONIC, &ts );
+	return (unsigned)ts.tv_sec * 1000000u + ts.tv_nsec / 1000;
+#else
+	struct timeval tp;
+
+	gettimeofday( &tp, NULL );
+	return (unsigned)tp.tv_sec * 1000000u + tp.tv_usec;
+#endif
+}
+
+/*
+================
+Sys_ProcessMilliseconds
+================
+*/
+int Sys_ProcessMilliseconds( void )
+{
+	struct rusage usage;
+
+	getrusage( RUSAGE_SELF, &usage );
+	return ( usage.ru_utime.tv_sec + usage.ru_stime.tv_sec ) * 1000
+		+ ( usage.ru_utime.tv_usec + usage.ru_stime.tv_usec ) / 1000;
+}
+
 #if !id386
 /*
 ==================
@@ -427,6 +464,115 @@ void Sys_FreeFileList( char **list )
 	Z_Free( list );
 }
 
+/*
+==================
+Sys_MapFile
+
+Maps a whole file read only, NULL if that is not possible
+==================
+*/
+void *Sys_MapFile( const char *path, int *length )
+{
+	struct stat st;
+	void        *base;
+	int         fd;
+
+	fd = open( path, O_RDONLY );
+	if( fd < 0 )
+		return NULL;
+
+	if( fstat( fd, &st ) < 0 || st.st_size <= 0 || st.st_size > 0x7fffffff )
+	{
+		close( fd );
+		return NULL;
+	}
+
+	base = mmap( NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+	close( fd );
+
+	if( base == MAP_FAILED )
+		return NULL;
+
+	*length = st.st_size;
+	return base;
+}
+
+/*
+==================
+Sys_UnmapFile
+==================
+*/
+void Sys_UnmapFile( void *base, int length )
+{
+	munmap( base, length );
+}
+
+/*
+==================
+Sys_ReserveMemory
+
+Reserves address space without backing it, NULL if that is not possible
+==================
+*/
+void *Sys_ReserveMemory( int length )
+{
+	void	*base;
+	int		flags = MAP_PRIVATE | MAP_ANON;
+
+#ifdef MAP_NORESERVE
+	flags |= MAP_NORESERVE;
+#endif
+	base = mmap( NULL, length, PROT_NONE, flags, -1, 0 );
+	if( base == MAP_FAILED )
+		return NULL;
+
+	return base;
+}
+
+/*
+==================
+Sys_CommitMemory
+
+Makes part of a reservation readable and writable, the pages
+read as zero until they are written
+==================
+*/
+qboolean Sys_CommitMemory( void *base, int length )
+{
+	return mprotect( base, length, PROT_READ | PROT_WRITE ) == 0;
+}
+
+/*
+==================
+Sys_Readahead
+
+Starts reading part of a mapped file into the page cache
+==================
+*/
+void Sys_Readahead( const void *base, int length )
+{
+#ifdef MADV_WILLNEED
+	uintptr_t page = sysconf( _SC_PAGESIZE );
+	uintptr_t start = (uintptr_t)base & ~( page - 1 );
+
+	madvise( (void *)start, (uintptr_t)base + length - start, MADV_WILLNEED );
+#endif
+}
+
+/*
+==================
+Sys_ReadaheadFile
+
+Starts reading a whole file into the page cache
+==================
+*/
+void Sys_ReadaheadFile( FILE *f )
+{
+#ifdef POSIX_FADV_WILLNEED
+	posix_fadvise( fileno( f ), 0, 0, POSIX_FADV_WILLNEED );
+#endif
+}
+
 #ifdef MACOS_X
 /*
 =================
@@ -110,6 +110,42 @@ int Sys_Milliseconds (void)
 	return sys_curtime;
 }
 
+/*
+================
+Sys_Microseconds
+================
+*/
+unsigned Sys_Microseconds( void )
+{
+	static LARGE_INTEGER	frequency;
+	LARGE_INTEGER			count;
+
+	if( !frequency.QuadPart )
+		QueryPerformanceFrequency( &frequency );
+	QueryPerformanceCounter( &count );
+
+	// split so the multiply can't overflow on machines with a long uptime
+	return (unsigned)( count.QuadPart / frequency.QuadPart * 1000000
+		+ count.QuadPart % frequency.QuadPart * 1000000 / frequency.QuadPart );
+}
+
+/*
+================
+Sys_ProcessMilliseconds
+================
+*/
+int Sys_ProcessMilliseconds( void )
+{
+	FILETIME	creation, exit, kernel, user;
+
+	if( !GetProcessTimes( GetCurrentProcess( ), &creation, &exit, &kernel, &user ) )
+		return 0;
+
+	// 100 nanosecond units
+	return (int)( ( ( (unsigned __int64)kernel.dwHighDateTime << 32 | kernel.dwLowDateTime )
+		+ ( (unsigned __int64)user.dwHighDateTime << 32 | user.dwLowDateTime ) ) / 10000 );
+}
+
 #ifndef __GNUC__ //see snapvectora.s
 /*
 ================
@@ -509,6 +545,102 @@ void Sys_FreeFileList( char **list )
 	Z_Free( list );
 }
 
+/*
+==============
+Sys_MapFile
+
+Maps a whole file read only, NULL if that is not possible
+==============
+*/
+void *Sys_MapFile( const char *path, int *length )
+{
+	HANDLE	file, mapping;
+	DWORD	size;
+	void	*base;
+
+	file = CreateFile( path, GENERIC_READ, FILE_SHARE_READ, NULL,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+	if( file == INVALID_HANDLE_VALUE )
+		return NULL;
+
+	size = GetFileSize( file, NULL );
+	if( size == INVALID_FILE_SIZE || size == 0 || size > 0x7fffffff )
+	{
+		CloseHandle( file );
+		return NULL;
+	}
+
+	mapping = CreateFileMapping( file, NULL, PAGE_READONLY, 0, 0, NULL );
+	CloseHandle( file );
+	if( !mapping )
+		return NULL;
+
+	// the view keeps the mapping alive
+	base = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+	CloseHandle( mapping );
+	if( !base )
+		return NULL;
+
+	*length = size;
+	return base;
+}
+
+/*
+==============
+Sys_UnmapFile
+==============
+*/
+void Sys_UnmapFile( void *base, int length )
+{
+	UnmapViewOfFile( base );
+}
+
+/*
+==============
+Sys_ReserveMemory
+
+Reserves address space without backing it, NULL if that is not possible
+==============
+*/
+void *Sys_ReserveMemory( int length )
+{
+	return VirtualAlloc( NULL, length, MEM_RESERVE, PAGE_NOACCESS );
+}
+
+/*
+==============
+Sys_CommitMemory
+
+Makes part of a reservation readable and writable, the pages
+read as zero until they are written
+==============
+*/
+qboolean Sys_CommitMemory( void *base, int length )
+{
+	return VirtualAlloc( base, length, MEM_COMMIT, PAGE_READWRITE ) != NULL;
+}
+
+/*
+==============
+Sys_Readahead
+
+PrefetchVirtualMemory is not available before Windows 8, the
+mapped pages are faulted in on first use instead
+==============
+*/
+void Sys_Readahead( const void *base, int length )
+{
+}
+
+/*
+==============
+Sys_ReadaheadFile
+==============
+*/
+void Sys_ReadaheadFile( FILE *f )
+{
+}
+
 
 /*
 ==============
@@ -0,0 +1,119 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+//
+// vmbench.c -- system call timing qvm for the x86_64 vm compiler
+//
+// vmMain makes one kind of system call over and over. The "vmbench"
+// command times it compiled with and without the inline system calls,
+// the test numbers must match vmBenchTests in vm.c.
+
+void	*memset( void *dest, int c, int count );
+void	*memcpy( void *dest, const void *src, int count );
+float	sin( float x );
+float	cos( float x );
+float	atan2( float y, float x );
+float	sqrt( float x );
+float	floor( float x );
+int		stackArg( int x );
+
+typedef enum {
+	BENCH_LOOP,
+	BENCH_SQRT,
+	BENCH_FLOOR,
+	BENCH_SIN,
+	BENCH_COS,
+	BENCH_ATAN2,
+	BENCH_MEMSET,
+	BENCH_MEMCPY,
+	BENCH_DIRECT
+} benchTest_t;
+
+/*
+================
+vmMain
+
+Makes arg0 calls of test command, the empty loop is the baseline.
+This must be the very first function compiled into the .qvm file
+================
+*/
+int vmMain( int command, int arg0, int arg1, int arg2, int arg3, int arg4, int arg5, int arg6, int arg7, int arg8, int arg9, int arg10, int arg11  ) {
+	char	buffer[32];
+	float	x, f;
+	int		i, h;
+
+	x = 0.75f;
+	f = 0;
+	h = 0;
+
+	switch ( command ) {
+	case BENCH_LOOP:
+		for ( i = 0 ; i < arg0 ; i++ ) {
+			h += i;
+		}
+		break;
+	case BENCH_SQRT:
+		for ( i = 0 ; i < arg0 ; i++ ) {
+			f += sqrt( x );
+		}
+		break;
+	case BENCH_FLOOR:
+		for ( i = 0 ; i < arg0 ; i++ ) {
+			f += floor( x );
+		}
+		break;
+	case BENCH_SIN:
+		for ( i = 0 ; i < arg0 ; i++ ) {
+			f += sin( x );
+		}
+		break;
+	case BENCH_COS:
+		for ( i = 0 ; i < arg0 ; i++ ) {
+			f += cos( x );
+		}
+		break;
+	case BENCH_ATAN2:
+		for ( i = 0 ; i < arg0 ; i++ ) {
+			f += atan2( x, f );
+		}
+		break;
+	case BENCH_MEMSET:
+		for ( i = 0 ; i < arg0 ; i++ ) {
+			memset( buffer, i, 16 );
+		}
+		h = buffer[0];
+		break;
+	case BENCH_MEMCPY:
+		buffer[0] = 1;
+		for ( i = 0 ; i < arg0 ; i++ ) {
+			memcpy( buffer + 16, buffer, 16 );
+		}
+		h = buffer[16];
+		break;
+	case BENCH_DIRECT:
+		for ( i = 0 ; i < arg0 ; i++ ) {
+			h += stackArg( i );
+		}
+		break;
+	}
+
+	return h + (int)f;
+}
@@ -0,0 +1,159 @@
+/*
+===========================================================================
+Copyright (C) 1999-2005 Id Software, Inc.
+
+This file is part of Quake III Arena source code.
+
+Quake III Arena source code is free software; you can redistribute it
+and/or modify it under the terms of the GNU General Public License as
+published by the Free Software Foundation; either version 2 of the License,
+or (at your option) any later version.
+
+Quake III Arena source code is distributed in the hope that it will be
+useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with Quake III Arena source code; if not, write to the Free Software
+Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+===========================================================================
+*/
+//
+// vmtest.c -- regression qvm for the x86_64 vm compiler
+//
+// The operations at the bottom of these expressions are four to six
+// values deep on the vm stack, so vm_optimize 1 does them in r12, r13
+// and r14. The system calls are handled inline or by a direct call in
+// compiled code and by the dispatcher when interpreted, they must give
+// the same bits. The "vmtest" command runs this interpreted and compiled
+// and compares what vmMain returns.
+
+void	*memset( void *dest, int c, int count );
+void	*memcpy( void *dest, const void *src, int count );
+float	sin( float x );
+float	cos( float x );
+float	atan2( float y, float x );
+float	sqrt( float x );
+float	floor( float x );
+int		stackArg( int x );
+
+static int TestExpressions( int a, int b, int c, int d, int e, int f );
+static int TestSystemCalls( int a, int b, int c );
+static int Random( void );
+
+static int			seed;
+
+/*
+================
+vmMain
+
+Returns a hash of command rounds of the expressions, starting from arg0.
+This must be the very first function compiled into the .qvm file
+================
+*/
+int vmMain( int command, int arg0, int arg1, int arg2, int arg3, int arg4, int arg5, int arg6, int arg7, int arg8, int arg9, int arg10, int arg11  ) {
+	int		a, b, c, d, e, f;
+	int		i, h;
+
+	seed = arg0;
+	h = 0;
+	for ( i = 0 ; i < command ; i++ ) {
+		a = Random();
+		b = Random();
+		c = Random();
+		d = Random();
+		e = Random();
+		f = Random();
+		h = h * 31 + TestExpressions( a, b, c, d, e, f );
+		h = h * 31 + TestSystemCalls( a, b, c );
+	}
+
+	return h;
+}
+
+static int TestExpressions( int a, int b, int c, int d, int e, int f ) {
+	int			h;
+	unsigned	u;
+
+	h = 0;
+
+	// four deep
+	h = h * 31 + ( a + ( b + ( c + ( d * e ) ) ) );
+	h = h * 31 + ( a + ( b + ( c + ( d / ( ( e & 0xffff ) | 1 ) ) ) ) );
+	h = h * 31 + ( a + ( b + ( c + ( d % ( ( e & 0xffff ) | 1 ) ) ) ) );
+	h = h * 31 + ( a + ( b + ( c + ( d << ( e & 31 ) ) ) ) );
+	h = h * 31 + ( a + ( b + ( c + ( d >> ( e & 31 ) ) ) ) );
+	h = h * 31 + ( a + ( b + ( c + -( d + e ) ) ) );
+	h = h * 31 + ( a + ( b + ( c + ~( d + e ) ) ) );
+
+	// five deep
+	h = h * 31 + ( a + ( b + ( c + ( d + ( e * f ) ) ) ) );
+	h = h * 31 + ( a + ( b + ( c + ( d + ( e / ( ( f & 0xffff ) | 1 ) ) ) ) ) );
+	h = h * 31 + ( a + ( b + ( c + ( d + ( e << ( f & 31 ) ) ) ) ) );
+	h = h * 31 + ( a + ( b + ( c + ( d + -( e ^ f ) ) ) ) );
+	h = h * 31 + ( a + ( b + ( c + ( d + ~( e ^ f ) ) ) ) );
+
+	// six deep
+	h = h * 31 + ( a + ( b + ( c + ( d + ( e + ( f * a ) ) ) ) ) );
+	h = h * 31 + ( a + ( b + ( c + ( d + ( e + ( f % ( ( a & 0xffff ) | 1 ) ) ) ) ) ) );
+	h = h * 31 + ( a + ( b + ( c + ( d + ( e + ( f >> ( a & 31 ) ) ) ) ) ) );
+
+	// unsigned
+	u = (unsigned)a + ( (unsigned)b + ( (unsigned)c + ( (unsigned)d * (unsigned)e ) ) );
+	h = h * 31 + (int)u;
+	u = (unsigned)a + ( (unsigned)b + ( (unsigned)c + ( (unsigned)d / ( (unsigned)e | 1 ) ) ) );
+	h = h * 31 + (int)u;
+	u = (unsigned)a + ( (unsigned)b + ( (unsigned)c + ( (unsigned)d % ( (unsigned)e | 1 ) ) ) );
+	h = h * 31 + (int)u;
+	u = (unsigned)a + ( (unsigned)b + ( (unsigned)c + ( (unsigned)d >> ( e & 31 ) ) ) );
+	h = h * 31 + (int)u;
+
+	return h;
+}
+
+static int FloatBits( float f ) {
+	return *(int *)&f;
+}
+
+static int TestSystemCalls( int a, int b, int c ) {
+	char		buffer[32], copy[32];
+	float		x, y;
+	int			h, i, bits;
+
+	h = 0;
+
+	// whole numbers, fractions and both signs
+	x = ( a % 100000 ) / 64.0f;
+	y = ( b % 100000 ) / 64.0f;
+
+	h = h * 31 + FloatBits( floor( x ) );
+	h = h * 31 + FloatBits( floor( -x ) );
+	h = h * 31 + FloatBits( sqrt( x * x ) );
+	h = h * 31 + FloatBits( sin( x ) );
+	h = h * 31 + FloatBits( cos( x ) );
+	h = h * 31 + FloatBits( atan2( x, y ) );
+
+	// floor keeps the sign of zero
+	bits = ( c & 1 ) << 31;
+	h = h * 31 + FloatBits( floor( *(float *)&bits ) );
+
+	// direct calls leave the stack where the engine can find it
+	h = h * 31 + stackArg( a );
+
+	memset( buffer, c, sizeof( buffer ) );
+	memset( buffer + ( a & 15 ), b, b & 15 );
+	memset( copy, 0, sizeof( copy ) );
+	memcpy( copy + ( b & 15 ), buffer + ( c & 15 ), a & 15 );
+	for ( i = 0 ; i < sizeof( buffer ) ; i++ ) {
+		h = h * 31 + buffer[i];
+		h = h * 31 + copy[i];
+	}
+
+	return h;
+}
+
+static int Random( void ) {
+	seed = seed * 1103515245 + 12345;
+	return seed ^ ( seed >> 16 );
+}
@@ -0,0 +1,11 @@
+code
+
+equ	stackArg				-1
+equ	memset					-101
+equ	memcpy					-102
+equ	sin						-104
+equ	cos						-105
+equ	atan2					-106
+equ	sqrt					-107
+equ	floor					-111
+